@@ -11,7 +11,10 @@
 #include "esp_log.h"
 #include "esp_tls.h"
 #include "esp_http_client.h"
+#include "esp_timer.h"
 #include "cJSON.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 #include <cstring>
 #include <string>
 #include <sys/time.h>
@@ -45,6 +48,7 @@ typedef struct {
     esp_mqtt_client_handle_t mqtt_client;  // MQTT client handle
     cJSON* last_status;                 // Last received status JSON
     time_t last_update;                 // Last update timestamp
+    time_t last_report;                 // Last parsed status report
     time_t last_activity;               // Last activity (data received) timestamp
     char* data_buffer;                  // Buffer for fragmented MQTT data
     int buffer_len;                     // Current buffer length
@@ -53,12 +57,31 @@ typedef struct {
     int sd_write_failures;              // Consecutive SD write failures
     bool use_spiffs_only;               // Skip SD card after repeated failures
     char last_snapshot_path[256];       // Path to last captured snapshot
+    int64_t connect_start_us;           // MQTT_EVENT_BEFORE_CONNECT of the current attempt
+    bambu_printer_stats_t stats;        // Guarded by stats_lock
 } printer_slot_t;
 
 // Global state
 static printer_slot_t printers[BAMBU_MAX_PRINTERS] = {0};
-static esp_event_handler_t registered_handler = NULL;
+// Event handlers (GUI, web event stream); kept across deinit/init
+#define BAMBU_MAX_EVENT_HANDLERS 4
+static esp_event_handler_t registered_handlers[BAMBU_MAX_EVENT_HANDLERS] = {0};
 static bool monitor_initialized = false;
+// Counters are written from the MQTT tasks and read by the web server
+static portMUX_TYPE stats_lock = portMUX_INITIALIZER_UNLOCKED;
+// last_status is replaced on the MQTT tasks and copied by other tasks; a
+// mutex rather than stats_lock because cJSON_Duplicate() allocates. Also
+// held while a slot's active flag and device_id change, for
+// bambu_copy_device_id() on the web server tasks.
+static SemaphoreHandle_t status_lock = NULL;
+// Held while slots are added or removed (reinit_bambu_monitor on a web worker)
+// and by the calls other tasks make on a slot's MQTT client and config
+// strings. Recursive: bambu_send_query() goes through bambu_send_query_index().
+// Never taken on the MQTT tasks, which removal stops while holding it.
+static SemaphoreHandle_t slot_lock = NULL;
+
+#define SLOT_LOCK()     xSemaphoreTakeRecursive(slot_lock, portMAX_DELAY)
+#define SLOT_UNLOCK()   xSemaphoreGiveRecursive(slot_lock)
 
 // Connection pool management (max 2 concurrent MQTT connections)
 #define MAX_CONCURRENT_CONNECTIONS 2
@@ -80,6 +103,29 @@ static void mqtt_event_handler(void* handler_args, esp_event_base_t base,
                               int32_t event_id, void* event_data);
 static void process_printer_data(int index, const char* topic, const char* data, int data_len);
 
+/**
+ * @brief Call every registered event handler
+ */
+static void notify_handlers(int32_t event_id, int index, const cJSON* print = NULL) {
+    bambu_event_data_t data = { index, print };
+    for (int i = 0; i < BAMBU_MAX_EVENT_HANDLERS; i++) {
+        if (registered_handlers[i]) {
+            registered_handlers[i](NULL, BAMBU_EVENT_BASE, event_id, &data);
+        }
+    }
+}
+
+/**
+ * @brief Add one timing to a total/max pair of a printer's counters
+ */
+static void stats_time(uint64_t* total, uint32_t* max, int64_t start_us) {
+    uint32_t us = (uint32_t)(esp_timer_get_time() - start_us);
+    portENTER_CRITICAL(&stats_lock);
+    *total += us;
+    if (us > *max) *max = us;
+    portEXIT_CRITICAL(&stats_lock);
+}
+
 /**
  * @brief Check if SD card is available and create printer directory
  * Result is cached after first check.
@@ -281,8 +327,18 @@ static void mqtt_event_handler(void* handler_args, esp_event_base_t base,
     printer_slot_t* printer = &printers[index];
     
     switch (event->event_id) {
+        case MQTT_EVENT_BEFORE_CONNECT:
+            printer->connect_start_us = esp_timer_get_time();
+            break;
+            
         case MQTT_EVENT_CONNECTED: {
             ESP_LOGI(TAG, "[%d] MQTT connected to %s", index, printer->config.ip_address);
+            portENTER_CRITICAL(&stats_lock);
+            printer->stats.connects++;
+            if (printer->connect_start_us) {
+                printer->stats.handshake_ms = (uint32_t)((esp_timer_get_time() - printer->connect_start_us) / 1000);
+            }
+            portEXIT_CRITICAL(&stats_lock);
             printer->connected = true;
             printer->state = BAMBU_STATE_IDLE;
             time(&printer->last_activity);  // Track connection time
@@ -297,14 +353,15 @@ static void mqtt_event_handler(void* handler_args, esp_event_base_t base,
             ESP_LOGI(TAG, "[%d] Subscribed to %s (msg_id: %d)", index, topic, msg_id);
             
             // Notify handler
-            if (registered_handler) {
-                registered_handler(NULL, BAMBU_EVENT_BASE, BAMBU_PRINTER_CONNECTED, (void*)(intptr_t)index);
-            }
+            notify_handlers(BAMBU_PRINTER_CONNECTED, index);
             break;
         }
         
         case MQTT_EVENT_DISCONNECTED: {
             ESP_LOGW(TAG, "[%d] MQTT disconnected from %s", index, printer->config.ip_address);
+            portENTER_CRITICAL(&stats_lock);
+            printer->stats.disconnects++;
+            portEXIT_CRITICAL(&stats_lock);
             if (printer->connected) {
                 active_connection_count--;
             }
@@ -313,9 +370,7 @@ static void mqtt_event_handler(void* handler_args, esp_event_base_t base,
             
             ESP_LOGI(TAG, "Active connections: %d/%d", active_connection_count, MAX_CONCURRENT_CONNECTIONS);
             
-            if (registered_handler) {
-                registered_handler(NULL, BAMBU_EVENT_BASE, BAMBU_PRINTER_DISCONNECTED, (void*)(intptr_t)index);
-            }
+            notify_handlers(BAMBU_PRINTER_DISCONNECTED, index);
             break;
         }
         
@@ -325,6 +380,13 @@ static void mqtt_event_handler(void* handler_args, esp_event_base_t base,
             
             // Handle fragmented MQTT messages
             if (event->data_len > 0) {
+                portENTER_CRITICAL(&stats_lock);
+                printer->stats.bytes += event->data_len;
+                if (event->current_data_offset + event->data_len >= event->total_data_len) {
+                    printer->stats.messages++;
+                }
+                portEXIT_CRITICAL(&stats_lock);
+                
                 // Store topic on first fragment
                 if (event->current_data_offset == 0 && event->topic_len > 0) {
                     if (event->topic_len < sizeof(printer->topic_buffer)) {
@@ -432,7 +494,13 @@ static void process_printer_data(int index, const char* topic, const char* data,
     // Parse JSON - use ParseWithLength to handle large messages better
     if (data_len <= 0 || data_len > 65536) return;
     
+    int64_t parse_start_us = esp_timer_get_time();
     cJSON* json = cJSON_ParseWithLength(data, data_len);
+    portENTER_CRITICAL(&stats_lock);
+    printer->stats.parses++;
+    if (!json) printer->stats.parse_errors++;
+    portEXIT_CRITICAL(&stats_lock);
+    stats_time(&printer->stats.parse_us_total, &printer->stats.parse_us_max, parse_start_us);
     
     if (!json) {
         // Rate-limit error logging (max once per 30 seconds per printer)
@@ -447,11 +515,15 @@ static void process_printer_data(int index, const char* topic, const char* data,
         return;
     }
     
-    // Update cached status
-    if (printer->last_status) {
-        cJSON_Delete(printer->last_status);
-    }
+    // Update cached status; json stays ours to read, only this task replaces it
+    xSemaphoreTake(status_lock, portMAX_DELAY);
+    cJSON* old_status = printer->last_status;
     printer->last_status = json;
+    printer->last_report = time(NULL);
+    xSemaphoreGive(status_lock);
+    if (old_status) {
+        cJSON_Delete(old_status);
+    }
     
     // Extract printer state
     cJSON* print_obj = cJSON_GetObjectItem(json, "print");
@@ -528,6 +600,7 @@ static void process_printer_data(int index, const char* topic, const char* data,
             }
             
             // Write to file - try SD card first (with retry), fallback to SPIFFS
+            int64_t write_start_us = esp_timer_get_time();
             char* output = cJSON_PrintUnformatted(mini);
             if (output) {
                 size_t len = strlen(output);
@@ -622,15 +695,17 @@ static void process_printer_data(int index, const char* topic, const char* data,
                     }
                 }
                 cJSON_free(output);
+                portENTER_CRITICAL(&stats_lock);
+                printer->stats.cache_writes++;
+                portEXIT_CRITICAL(&stats_lock);
+                stats_time(&printer->stats.cache_write_us_total, &printer->stats.cache_write_us_max, write_start_us);
             }
             cJSON_Delete(mini);
         }
     }
     
-    // Notify handler
-    if (registered_handler) {
-        registered_handler(NULL, BAMBU_EVENT_BASE, BAMBU_STATUS_UPDATED, (void*)(intptr_t)index);
-    }
+    // Notify handlers with the parsed report; json is still ours here
+    notify_handlers(BAMBU_STATUS_UPDATED, index, print_obj);
 }
 
 /**
@@ -651,6 +726,16 @@ esp_err_t bambu_monitor_init(void) {
         return ESP_OK;
     }
     
+    // Kept across deinit/init, like the event handlers
+    if (!status_lock) {
+        status_lock = xSemaphoreCreateMutex();
+        if (!status_lock) return ESP_ERR_NO_MEM;
+    }
+    if (!slot_lock) {
+        slot_lock = xSemaphoreCreateRecursiveMutex();
+        if (!slot_lock) return ESP_ERR_NO_MEM;
+    }
+    
     // Initialize all printer slots
     memset(printers, 0, sizeof(printers));
     for (int i = 0; i < BAMBU_MAX_PRINTERS; i++) {
@@ -670,7 +755,7 @@ esp_err_t bambu_monitor_init_single(const bambu_printer_config_t* config) {
     return (idx >= 0) ? ESP_OK : ESP_FAIL;
 }
 
-int bambu_add_printer(const bambu_printer_config_t* config) {
+static int add_printer_locked(const bambu_printer_config_t* config) {
     if (!monitor_initialized) {
         ESP_LOGE(TAG, "Not initialized");
         return -1;
@@ -751,8 +836,14 @@ int bambu_add_printer(const bambu_printer_config_t* config) {
     esp_mqtt_client_register_event(printer->mqtt_client, (esp_mqtt_event_id_t)ESP_EVENT_ANY_ID, 
                                    mqtt_event_handler, (void*)(intptr_t)index);
     
-    printer->active = true;
+    portENTER_CRITICAL(&stats_lock);
+    memset(&printer->stats, 0, sizeof(printer->stats));
+    portEXIT_CRITICAL(&stats_lock);
+    printer->connect_start_us = 0;
     printer->state = BAMBU_STATE_OFFLINE;
+    xSemaphoreTake(status_lock, portMAX_DELAY);
+    printer->active = true;
+    xSemaphoreGive(status_lock);
     
     ESP_LOGI(TAG, "[%d] Added printer: %s at %s:%d", 
              index, config->device_id, config->ip_address, printer->config.port);
@@ -760,7 +851,18 @@ int bambu_add_printer(const bambu_printer_config_t* config) {
     return index;
 }
 
-esp_err_t bambu_remove_printer(int index) {
+int bambu_add_printer(const bambu_printer_config_t* config) {
+    if (!slot_lock) {
+        ESP_LOGE(TAG, "Not initialized");
+        return -1;
+    }
+    SLOT_LOCK();
+    int index = add_printer_locked(config);
+    SLOT_UNLOCK();
+    return index;
+}
+
+static esp_err_t remove_printer_locked(int index) {
     if (index < 0 || index >= BAMBU_MAX_PRINTERS || !printers[index].active) {
         return ESP_ERR_INVALID_ARG;
     }
@@ -776,10 +878,14 @@ esp_err_t bambu_remove_printer(int index) {
         printer->mqtt_client = NULL;
     }
     
-    // Free status JSON
-    if (printer->last_status) {
-        cJSON_Delete(printer->last_status);
-        printer->last_status = NULL;
+    // Free status JSON; the slot stops being active for readers here
+    xSemaphoreTake(status_lock, portMAX_DELAY);
+    cJSON* old_status = printer->last_status;
+    printer->last_status = NULL;
+    printer->active = false;
+    xSemaphoreGive(status_lock);
+    if (old_status) {
+        cJSON_Delete(old_status);
     }
     
     // Free data buffer
@@ -793,7 +899,6 @@ esp_err_t bambu_remove_printer(int index) {
     // Free config
     free_printer_config(&printer->config);
     
-    printer->active = false;
     printer->connected = false;
     printer->state = BAMBU_STATE_OFFLINE;
     
@@ -801,6 +906,24 @@ esp_err_t bambu_remove_printer(int index) {
     return ESP_OK;
 }
 
+esp_err_t bambu_remove_printer(int index) {
+    if (!slot_lock) return ESP_ERR_INVALID_STATE;
+    SLOT_LOCK();
+    esp_err_t ret = remove_printer_locked(index);
+    SLOT_UNLOCK();
+    return ret;
+}
+
+bool bambu_get_printer_stats(int index, bambu_printer_stats_t* stats) {
+    if (index < 0 || index >= BAMBU_MAX_PRINTERS || !printers[index].active || !stats) {
+        return false;
+    }
+    portENTER_CRITICAL(&stats_lock);
+    *stats = printers[index].stats;
+    portEXIT_CRITICAL(&stats_lock);
+    return true;
+}
+
 int bambu_get_printer_count(void) {
     int count = 0;
     for (int i = 0; i < BAMBU_MAX_PRINTERS; i++) {
@@ -810,14 +933,15 @@ int bambu_get_printer_count(void) {
 }
 
 esp_err_t bambu_monitor_deinit(void) {
+    if (slot_lock) SLOT_LOCK();
     for (int i = 0; i < BAMBU_MAX_PRINTERS; i++) {
         if (printers[i].active) {
-            bambu_remove_printer(i);
+            remove_printer_locked(i);
         }
     }
     
-    registered_handler = NULL;
     monitor_initialized = false;
+    if (slot_lock) SLOT_UNLOCK();
     sdcard_available = -1;  // Reset SD card check for next init
     
     ESP_LOGI(TAG, "Monitor deinitialized");
@@ -845,14 +969,27 @@ cJSON* bambu_get_status_json(int index) {
     if (index < 0 || index >= BAMBU_MAX_PRINTERS || !printers[index].active) {
         return NULL;
     }
-    if (!printers[index].last_status) {
-        return NULL;
-    }
-    return cJSON_Duplicate(printers[index].last_status, 1);
+    xSemaphoreTake(status_lock, portMAX_DELAY);
+    cJSON* copy = printers[index].last_status ? cJSON_Duplicate(printers[index].last_status, 1) : NULL;
+    xSemaphoreGive(status_lock);
+    return copy;
 }
 
 esp_err_t bambu_register_event_handler(esp_event_handler_t handler) {
-    registered_handler = handler;
+    int free_slot = -1;
+    for (int i = 0; i < BAMBU_MAX_EVENT_HANDLERS; i++) {
+        if (registered_handlers[i] == handler) {
+            return ESP_OK;
+        }
+        if (!registered_handlers[i] && free_slot < 0) {
+            free_slot = i;
+        }
+    }
+    if (free_slot < 0) {
+        ESP_LOGE(TAG, "No free event handler slot");
+        return ESP_ERR_NO_MEM;
+    }
+    registered_handlers[free_slot] = handler;
     return ESP_OK;
 }
 
@@ -875,7 +1012,7 @@ esp_err_t bambu_monitor_start(void) {
     return (started > 0) ? ESP_OK : ESP_FAIL;
 }
 
-esp_err_t bambu_start_printer(int index) {
+static esp_err_t start_printer_locked(int index) {
     if (index < 0 || index >= BAMBU_MAX_PRINTERS || !printers[index].active) {
         return ESP_ERR_INVALID_ARG;
     }
@@ -917,21 +1054,31 @@ esp_err_t bambu_start_printer(int index) {
     return esp_mqtt_client_start(printers[index].mqtt_client);
 }
 
+esp_err_t bambu_start_printer(int index) {
+    if (!slot_lock) return ESP_ERR_INVALID_STATE;
+    SLOT_LOCK();
+    esp_err_t ret = start_printer_locked(index);
+    SLOT_UNLOCK();
+    return ret;
+}
+
 esp_err_t bambu_stop_printer(int index) {
-    if (index < 0 || index >= BAMBU_MAX_PRINTERS || !printers[index].active) {
-        return ESP_ERR_INVALID_ARG;
-    }
-    
-    if (printers[index].mqtt_client) {
-        esp_mqtt_client_stop(printers[index].mqtt_client);
-        printers[index].connected = false;
-        printers[index].state = BAMBU_STATE_OFFLINE;
+    if (!slot_lock) return ESP_ERR_INVALID_STATE;
+    SLOT_LOCK();
+    esp_err_t ret = ESP_ERR_INVALID_ARG;
+    if (index >= 0 && index < BAMBU_MAX_PRINTERS && printers[index].active) {
+        if (printers[index].mqtt_client) {
+            esp_mqtt_client_stop(printers[index].mqtt_client);
+            printers[index].connected = false;
+            printers[index].state = BAMBU_STATE_OFFLINE;
+        }
+        ret = ESP_OK;
     }
-    
-    return ESP_OK;
+    SLOT_UNLOCK();
+    return ret;
 }
 
-esp_err_t bambu_send_query_index(int index) {
+static esp_err_t send_query_index_locked(int index) {
     if (index < 0 || index >= BAMBU_MAX_PRINTERS || !printers[index].active) {
         return ESP_ERR_INVALID_ARG;
     }
@@ -971,7 +1118,15 @@ esp_err_t bambu_send_query_index(int index) {
     return ESP_OK;
 }
 
-esp_err_t bambu_send_query(void) {
+esp_err_t bambu_send_query_index(int index) {
+    if (!slot_lock) return ESP_ERR_INVALID_STATE;
+    SLOT_LOCK();
+    esp_err_t ret = send_query_index_locked(index);
+    SLOT_UNLOCK();
+    return ret;
+}
+
+static esp_err_t send_query_locked(void) {
     int sent = 0;
     time_t now;
     time(&now);
@@ -1013,7 +1168,15 @@ esp_err_t bambu_send_query(void) {
     return (sent > 0) ? ESP_OK : ESP_FAIL;
 }
 
-esp_err_t bambu_send_command(int index, const char* command) {
+esp_err_t bambu_send_query(void) {
+    if (!slot_lock) return ESP_ERR_INVALID_STATE;
+    SLOT_LOCK();
+    esp_err_t ret = send_query_locked();
+    SLOT_UNLOCK();
+    return ret;
+}
+
+static esp_err_t send_command_locked(int index, const char* command) {
     if (index < 0 || index >= BAMBU_MAX_PRINTERS || !printers[index].active) {
         return ESP_ERR_INVALID_ARG;
     }
@@ -1029,6 +1192,14 @@ esp_err_t bambu_send_command(int index, const char* command) {
     return (msg_id >= 0) ? ESP_OK : ESP_FAIL;
 }
 
+esp_err_t bambu_send_command(int index, const char* command) {
+    if (!slot_lock) return ESP_ERR_INVALID_STATE;
+    SLOT_LOCK();
+    esp_err_t ret = send_command_locked(index, command);
+    SLOT_UNLOCK();
+    return ret;
+}
+
 const char* bambu_get_device_id(int index) {
     if (index < 0 || index >= BAMBU_MAX_PRINTERS || !printers[index].active) {
         return NULL;
@@ -1036,6 +1207,50 @@ const char* bambu_get_device_id(int index) {
     return printers[index].config.device_id;
 }
 
+bool bambu_copy_device_id(int index, char* buf, size_t len) {
+    if (!buf || !len) return false;
+    buf[0] = '\0';
+    if (index < 0 || index >= BAMBU_MAX_PRINTERS || !status_lock) return false;
+    xSemaphoreTake(status_lock, portMAX_DELAY);
+    bool active = printers[index].active && printers[index].config.device_id;
+    if (active) strlcpy(buf, printers[index].config.device_id, len);
+    xSemaphoreGive(status_lock);
+    return active;
+}
+
+int bambu_find_printer(const char* ip_address, const char* access_code) {
+    if (!ip_address || !access_code || !slot_lock) return -1;
+    int found = -1;
+    SLOT_LOCK();
+    for (int i = 0; i < BAMBU_MAX_PRINTERS; i++) {
+        if (printers[i].active && printers[i].config.ip_address && printers[i].config.access_code &&
+            strcmp(printers[i].config.ip_address, ip_address) == 0 &&
+            strcmp(printers[i].config.access_code, access_code) == 0) {
+            found = i;
+            break;
+        }
+    }
+    SLOT_UNLOCK();
+    return found;
+}
+
+bool bambu_is_printer_connected(int index) {
+    if (index < 0 || index >= BAMBU_MAX_PRINTERS || !printers[index].active) {
+        return false;
+    }
+    return printers[index].connected;
+}
+
+int bambu_get_status_age(int index) {
+    if (index < 0 || index >= BAMBU_MAX_PRINTERS || !printers[index].active) {
+        return -1;
+    }
+    xSemaphoreTake(status_lock, portMAX_DELAY);
+    int age = printers[index].last_status ? (int)(time(NULL) - printers[index].last_report) : -1;
+    xSemaphoreGive(status_lock);
+    return age;
+}
+
 bool bambu_is_printer_active(int index) {
     if (index < 0 || index >= BAMBU_MAX_PRINTERS) {
         return false;
@@ -17,6 +17,9 @@ extern "C" {
 // Maximum number of simultaneous printer connections
 #define BAMBU_MAX_PRINTERS 6
 
+// Buffer size for bambu_copy_device_id() (serials are 15 characters)
+#define BAMBU_DEVICE_ID_LEN 32
+
 ESP_EVENT_DECLARE_BASE(BAMBU_EVENT_BASE);
 
 typedef enum {
@@ -25,6 +28,12 @@ typedef enum {
     BAMBU_PRINTER_DISCONNECTED,
 } bambu_event_id_t;
 
+// event_data of every BAMBU_EVENT_BASE event, valid during the handler call only
+typedef struct {
+    int index;              // Printer slot
+    const cJSON* print;     // BAMBU_STATUS_UPDATED: the report's "print" object (NULL if none)
+} bambu_event_data_t;
+
 typedef enum {
     BAMBU_STATE_IDLE,
     BAMBU_STATE_PRINTING,
@@ -42,6 +51,22 @@ typedef struct {
     bool disable_ssl_verify;  // Skip SSL certificate verification
 } bambu_printer_config_t;
 
+// Counters of a printer slot since it was added (for /metrics)
+typedef struct {
+    uint32_t messages;              // Complete MQTT messages received
+    uint64_t bytes;                 // MQTT payload bytes received
+    uint32_t parse_errors;          // Messages that were not valid JSON
+    uint32_t connects;              // MQTT sessions established
+    uint32_t disconnects;           // Sessions lost or connection attempts failed
+    uint32_t handshake_ms;          // Last connect: TCP + TLS + MQTT CONNECT until CONNACK
+    uint32_t parses;                // JSON parse time of received messages
+    uint64_t parse_us_total;
+    uint32_t parse_us_max;
+    uint32_t cache_writes;          // Status cache file writes (SD or SPIFFS), incl. retries
+    uint64_t cache_write_us_total;
+    uint32_t cache_write_us_max;
+} bambu_printer_stats_t;
+
 /**
  * @brief Initialize Bambu Monitor component (multi-printer support)
  * 
@@ -115,8 +140,14 @@ cJSON* bambu_get_status_json(int index);
 /**
  * @brief Register event handler for printer events
  * 
+ * Up to 4 handlers; each is called from the MQTT task, so keep it short.
+ * event_data is a const bambu_event_data_t*; read the report from it rather
+ * than copying it with bambu_get_status_json().
+ * Handlers stay registered across bambu_monitor_deinit(), registering the
+ * same one again does nothing.
+ * 
  * @param handler Event handler function
- * @return ESP_OK on success
+ * @return ESP_OK on success, ESP_ERR_NO_MEM if all slots are taken
  */
 esp_err_t bambu_register_event_handler(esp_event_handler_t handler);
 
@@ -170,11 +201,49 @@ esp_err_t bambu_send_command(int index, const char* command);
 /**
  * @brief Get printer serial/device ID by index
  * 
+ * The string is freed when the printer is removed (reinit_bambu_monitor), so
+ * only the MQTT tasks may hold it; other tasks use bambu_copy_device_id()
+ * 
  * @param index Printer index (0-5)
  * @return Device ID string or NULL if not configured
  */
 const char* bambu_get_device_id(int index);
 
+/**
+ * @brief Copy printer serial/device ID by index, safe from any task
+ * 
+ * @param index Printer index (0-5)
+ * @param buf Receives the ID, "" if the slot is not active
+ * @param len Size of buf (BAMBU_DEVICE_ID_LEN)
+ * @return true if the slot is active
+ */
+bool bambu_copy_device_id(int index, char* buf, size_t len);
+
+/**
+ * @brief Find a monitored printer by IP address and access code
+ * 
+ * @param ip_address Printer IP address
+ * @param access_code LAN access code; must match the configured one
+ * @return Printer index (0-5), or -1 if no active printer matches both
+ */
+int bambu_find_printer(const char* ip_address, const char* access_code);
+
+/**
+ * @brief Check if the MQTT session to a printer is up
+ * 
+ * @param index Printer index (0-5)
+ * @return true if connected
+ */
+bool bambu_is_printer_connected(int index);
+
+/**
+ * @brief Get the age of the cached status
+ * 
+ * @param index Printer index (0-5)
+ * @return Seconds since the last report from the printer, -1 if none yet
+ */
+int bambu_get_status_age(int index);
+
 /**
  * @brief Check if a printer slot is in use
  * 
@@ -183,6 +252,15 @@ const char* bambu_get_device_id(int index);
  */
 bool bambu_is_printer_active(int index);
 
+/**
+ * @brief Copy a printer's counters
+ * 
+ * @param index Printer index (0-5)
+ * @param stats Filled with the counters since the printer was added
+ * @return false if no printer is configured at this index
+ */
+bool bambu_get_printer_stats(int index, bambu_printer_stats_t* stats);
+
 /**
  * @brief Reset SD card availability check
  * 
@@ -143,6 +143,7 @@ SettingsConfig::SettingsConfig(string filename)
 
 void SettingsConfig::load_config()
 {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
     ESP_LOGD(TAG,"******************* Loading JSON *******************");
 
     if (!file_name.empty()) read_json_file();   // read into jsonString
@@ -299,7 +300,8 @@ void SettingsConfig::load_config()
 }
 
 void SettingsConfig::save_config()
-{    
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex);
     ESP_LOGD(TAG,"******************* Saving JSON *******************");
     // Create json object
 	root=cJSON_CreateObject();
@@ -512,6 +514,7 @@ void SettingsConfig::write_json_file()
 
 void SettingsConfig::add_printer(const string &name, const string &ip, const string &token, const string &serial)
 {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
     if (PrinterList.size() >= MAX_PRINTERS) {
         ESP_LOGW(TAG, "Maximum printers reached (%d)", MAX_PRINTERS);
         return;
@@ -531,6 +534,7 @@ void SettingsConfig::add_printer(const string &name, const string &ip, const str
 
 void SettingsConfig::remove_printer(int index)
 {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
     if (index >= 0 && index < (int)PrinterList.size()) {
         PrinterList.erase(PrinterList.begin() + index);
         ESP_LOGI(TAG, "Removed printer at index %d", index);
@@ -539,6 +543,7 @@ void SettingsConfig::remove_printer(int index)
 
 printer_config_t SettingsConfig::get_printer(int index)
 {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
     printer_config_t empty_printer = {"", "", "", "", false, true};
     if (index >= 0 && index < (int)PrinterList.size()) {
         return PrinterList[index];
@@ -548,11 +553,13 @@ printer_config_t SettingsConfig::get_printer(int index)
 
 int SettingsConfig::get_printer_count()
 {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
     return PrinterList.size();
 }
 
 void SettingsConfig::add_weather_location(const string &name, const string &city, const string &country, float lat, float lon)
 {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
     if (WeatherLocations.size() >= MAX_WEATHER_LOCATIONS) {
         ESP_LOGW(TAG, "Maximum weather locations reached (%d)", MAX_WEATHER_LOCATIONS);
         return;
@@ -573,6 +580,7 @@ void SettingsConfig::add_weather_location(const string &name, const string &city
 
 void SettingsConfig::remove_weather_location(int index)
 {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
     if (index >= 0 && index < (int)WeatherLocations.size()) {
         WeatherLocations.erase(WeatherLocations.begin() + index);
         ESP_LOGI(TAG, "Removed weather location at index %d", index);
@@ -581,6 +589,7 @@ void SettingsConfig::remove_weather_location(int index)
 
 weather_location_t SettingsConfig::get_weather_location(int index)
 {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
     weather_location_t empty_location = {"", "", "", 0.0f, 0.0f, false};
     if (index >= 0 && index < (int)WeatherLocations.size()) {
         return WeatherLocations[index];
@@ -590,11 +599,13 @@ weather_location_t SettingsConfig::get_weather_location(int index)
 
 int SettingsConfig::get_weather_location_count()
 {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
     return WeatherLocations.size();
 }
 
 void SettingsConfig::add_network(const string &name, const string &subnet)
 {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
     if (NetworkList.size() >= MAX_NETWORKS) {
         ESP_LOGW(TAG, "Maximum networks reached (%d)", MAX_NETWORKS);
         return;
@@ -611,6 +622,7 @@ void SettingsConfig::add_network(const string &name, const string &subnet)
 
 void SettingsConfig::remove_network(int index)
 {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
     if (index >= 0 && index < (int)NetworkList.size()) {
         NetworkList.erase(NetworkList.begin() + index);
         ESP_LOGI(TAG, "Removed network at index %d", index);
@@ -619,6 +631,7 @@ void SettingsConfig::remove_network(int index)
 
 network_config_t SettingsConfig::get_network(int index)
 {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
     network_config_t empty_network = {"", "", false};
     if (index >= 0 && index < (int)NetworkList.size()) {
         return NetworkList[index];
@@ -628,5 +641,6 @@ network_config_t SettingsConfig::get_network(int index)
 
 int SettingsConfig::get_network_count()
 {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
     return NetworkList.size();
 }
\ No newline at end of file
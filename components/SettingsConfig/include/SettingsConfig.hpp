@@ -45,6 +45,7 @@ Config Json format:
 #include <inttypes.h>
 #include <esp_log.h>
 #include <fstream>
+#include <mutex>
 #include <cJSON.h>
 
 using namespace std;
@@ -122,6 +123,10 @@ class SettingsConfig
         // Network configuration for scanner
         vector<network_config_t> NetworkList;  // List of networks to scan for printers
 
+        // Held by the methods below; callers on other tasks (web handlers) hold
+        // it too while they read or change the fields and lists directly
+        std::recursive_mutex mutex;
+
         //SettingsConfig();
         SettingsConfig(string filename);
         void load_config();
@@ -0,0 +1,166 @@
+/*
+ * CBOR Writer Implementation
+ *
+ * Maps and arrays are written with indefinite length (0xbf/0x9f ... 0xff) so
+ * nothing has to be counted up front. Integers use the shortest head; a
+ * number is sent as a single-precision float when that is exact, otherwise
+ * as a double. As in JsonWriter, numbers that are not finite are written as
+ * null, and after a send error the writer stops sending.
+ */
+
+#include "CborWriter.hpp"
+#include <cmath>
+#include <cstring>
+
+#define CBOR_UINT           0
+#define CBOR_NEGINT         1
+#define CBOR_TEXT           3
+#define CBOR_ARRAY_INDEF    0x9f
+#define CBOR_MAP_INDEF      0xbf
+#define CBOR_BREAK          0xff
+#define CBOR_FALSE          0xf4
+#define CBOR_TRUE           0xf5
+#define CBOR_NULL           0xf6
+#define CBOR_FLOAT32        0xfa
+#define CBOR_FLOAT64        0xfb
+
+CborWriter::CborWriter(httpd_req_t *req) : req(req), len(0), err(ESP_OK) {
+    httpd_resp_set_type(req, "application/cbor");
+}
+
+void CborWriter::flush() {
+    if (len && err == ESP_OK) {
+        err = httpd_resp_send_chunk(req, (const char *)buf, len);
+    }
+    len = 0;
+}
+
+void CborWriter::put(const void *data, size_t n) {
+    const uint8_t *p = (const uint8_t *)data;
+    while (n) {
+        if (len == sizeof(buf)) flush();
+        size_t room = sizeof(buf) - len;
+        size_t take = n < room ? n : room;
+        memcpy(buf + len, p, take);
+        len += take;
+        p += take;
+        n -= take;
+    }
+}
+
+void CborWriter::put(uint8_t b) {
+    if (len == sizeof(buf)) flush();
+    buf[len++] = b;
+}
+
+// Initial byte plus big-endian argument
+void CborWriter::head(uint8_t major, uint64_t value) {
+    major <<= 5;
+    int bytes;
+    if (value < 24) {
+        put((uint8_t)(major | value));
+        return;
+    } else if (value <= 0xff) {
+        put((uint8_t)(major | 24));
+        bytes = 1;
+    } else if (value <= 0xffff) {
+        put((uint8_t)(major | 25));
+        bytes = 2;
+    } else if (value <= 0xffffffffULL) {
+        put((uint8_t)(major | 26));
+        bytes = 4;
+    } else {
+        put((uint8_t)(major | 27));
+        bytes = 8;
+    }
+    for (int shift = (bytes - 1) * 8; shift >= 0; shift -= 8) {
+        put((uint8_t)(value >> shift));
+    }
+}
+
+void CborWriter::text(const char *s) {
+    size_t n = strlen(s);
+    head(CBOR_TEXT, n);
+    put(s, n);
+}
+
+void CborWriter::key(const char *k) {
+    if (k) text(k);
+}
+
+CborWriter &CborWriter::begin_object(const char *k) {
+    key(k);
+    put((uint8_t)CBOR_MAP_INDEF);
+    return *this;
+}
+
+CborWriter &CborWriter::end_object() {
+    put((uint8_t)CBOR_BREAK);
+    return *this;
+}
+
+CborWriter &CborWriter::begin_array(const char *k) {
+    key(k);
+    put((uint8_t)CBOR_ARRAY_INDEF);
+    return *this;
+}
+
+CborWriter &CborWriter::end_array() {
+    put((uint8_t)CBOR_BREAK);
+    return *this;
+}
+
+CborWriter &CborWriter::str(const char *k, const char *value) {
+    key(k);
+    if (value) text(value);
+    else put((uint8_t)CBOR_NULL);
+    return *this;
+}
+
+CborWriter &CborWriter::integer(const char *k, int64_t value) {
+    key(k);
+    if (value >= 0) head(CBOR_UINT, (uint64_t)value);
+    else head(CBOR_NEGINT, (uint64_t)(-1 - value));
+    return *this;
+}
+
+CborWriter &CborWriter::number(const char *k, double value) {
+    key(k);
+    if (!std::isfinite(value)) {
+        put((uint8_t)CBOR_NULL);
+        return *this;
+    }
+    float single = (float)value;
+    if ((double)single == value) {
+        uint32_t bits;
+        memcpy(&bits, &single, sizeof(bits));
+        put((uint8_t)CBOR_FLOAT32);
+        for (int shift = 24; shift >= 0; shift -= 8) put((uint8_t)(bits >> shift));
+    } else {
+        uint64_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        put((uint8_t)CBOR_FLOAT64);
+        for (int shift = 56; shift >= 0; shift -= 8) put((uint8_t)(bits >> shift));
+    }
+    return *this;
+}
+
+CborWriter &CborWriter::boolean(const char *k, bool value) {
+    key(k);
+    put((uint8_t)(value ? CBOR_TRUE : CBOR_FALSE));
+    return *this;
+}
+
+CborWriter &CborWriter::null(const char *k) {
+    key(k);
+    put((uint8_t)CBOR_NULL);
+    return *this;
+}
+
+esp_err_t CborWriter::finish() {
+    flush();
+    if (err == ESP_OK) {
+        err = httpd_resp_send_chunk(req, NULL, 0);
+    }
+    return err;
+}
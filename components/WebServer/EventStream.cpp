@@ -0,0 +1,305 @@
+/*
+ * Event Stream Implementation
+ *
+ * Every kind of update is a topic with one current payload (a compact JSON
+ * object). Publishing a payload that differs from the current one marks
+ * the topic pending for every subscriber; the sender task then writes one
+ * "event: <name>\ndata: <payload>\n\n" per pending topic. A subscriber's
+ * queue is thus bounded by the number of topics: a browser that falls
+ * behind gets the latest value of each topic once, never a backlog.
+ *
+ * Events (i is the BambuMonitor printer index):
+ *   state       {"i":0,"serial":"...","connected":true,"state":"RUNNING"}
+ *   progress    {"i":0,"percent":42,"remaining_min":31,"layer":120,"total_layers":300}
+ *   temps       {"i":0,"nozzle":215,"nozzle_target":220,"bed":60,"bed_target":60}
+ *   discovery   {"in_progress":true,"progress":40,"count":2}
+ *   ota         {"state":"downloading","kb":512} / {"state":"failed","message":"..."}
+ *
+ * Printer topics are rendered from FleetState's merged record of each
+ * printer. Subscribers get the current payload of every topic when they
+ * connect.
+ */
+
+#include "EventStream.hpp"
+#include "BambuMonitor.hpp"
+#include "tux_events.hpp"
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+
+const char* EventStream::TAG = "EventStream";
+
+// Each subscriber holds one of the server's max_open_sockets (7)
+#ifdef CONFIG_TUX_SSE_MAX_CLIENTS
+#define SSE_MAX_CLIENTS         CONFIG_TUX_SSE_MAX_CLIENTS
+#else
+#define SSE_MAX_CLIENTS         2
+#endif
+
+#define SSE_BATCH_MS            250     // Updates arriving within this window go out together
+#define SSE_KEEPALIVE_US        (15 * 1000000LL)
+#define SSE_RETRY_MS            "5000"  // Browser reconnect delay
+
+#define SSE_TOPICS_PER_PRINTER  3
+#define SSE_TOPIC_STATE         0
+#define SSE_TOPIC_PROGRESS      1
+#define SSE_TOPIC_TEMPS         2
+#define SSE_TOPIC_DISCOVERY     (BAMBU_MAX_PRINTERS * SSE_TOPICS_PER_PRINTER)
+#define SSE_TOPIC_OTA           (SSE_TOPIC_DISCOVERY + 1)
+#define SSE_TOPIC_COUNT         (SSE_TOPIC_OTA + 1)
+
+static_assert(SSE_TOPIC_COUNT <= 32, "pending topics are a 32-bit mask");
+
+namespace {
+
+struct Client {
+    httpd_req_t *req;           // Async request copy, nullptr if the slot is free
+    uint32_t pending;           // Topics to send
+    int64_t last_send_us;
+};
+
+std::mutex s_lock;
+std::string s_payloads[SSE_TOPIC_COUNT];
+Client s_clients[SSE_MAX_CLIENTS];
+int s_client_count = 0;
+TaskHandle_t s_task = nullptr;
+
+const char *topic_event(int topic) {
+    if (topic == SSE_TOPIC_DISCOVERY) return "discovery";
+    if (topic == SSE_TOPIC_OTA) return "ota";
+    switch (topic % SSE_TOPICS_PER_PRINTER) {
+        case SSE_TOPIC_STATE: return "state";
+        case SSE_TOPIC_PROGRESS: return "progress";
+        default: return "temps";
+    }
+}
+
+void append_json_string(std::string &out, const char *s) {
+    out += '"';
+    for (; s && *s; s++) {
+        unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += (char)c;
+        } else if (c < 0x20) {
+            char esc[8];
+            snprintf(esc, sizeof(esc), "\\u%04x", c);
+            out += esc;
+        } else {
+            out += (char)c;
+        }
+    }
+    out += '"';
+}
+
+void append_field(std::string &out, const char *key, int value) {
+    if (value < 0) return;
+    char buf[40];
+    snprintf(buf, sizeof(buf), ",\"%s\":%d", key, value);
+    out += buf;
+}
+
+} // namespace
+
+void EventStream::publish(int topic, const char *payload) {
+    bool wake;
+    {
+        std::lock_guard<std::mutex> lock(s_lock);
+        if (s_payloads[topic] == payload) return;
+        s_payloads[topic] = payload;
+        for (Client &c : s_clients) {
+            if (c.req) c.pending |= 1u << topic;
+        }
+        wake = s_client_count > 0;
+    }
+    if (wake && s_task) xTaskNotifyGive(s_task);
+}
+
+void EventStream::publish_discovery(bool in_progress, int progress, int found) {
+    char payload[80];
+    snprintf(payload, sizeof(payload), "{\"in_progress\":%s,\"progress\":%d,\"count\":%d}",
+             in_progress ? "true" : "false", progress, found);
+    publish(SSE_TOPIC_DISCOVERY, payload);
+}
+
+void EventStream::printer_changed(int index, const FleetState::Printer &f) {
+    char head[16];
+    snprintf(head, sizeof(head), "{\"i\":%d", index);
+    int topic = index * SSE_TOPICS_PER_PRINTER;
+
+    char serial[BAMBU_DEVICE_ID_LEN];
+    bambu_copy_device_id(index, serial, sizeof(serial));
+    std::string state = head;
+    state += ",\"serial\":";
+    append_json_string(state, serial);
+    state += f.connected ? ",\"connected\":true" : ",\"connected\":false";
+    if (f.state[0]) {
+        state += ",\"state\":";
+        append_json_string(state, f.state);
+    }
+    state += '}';
+    publish(topic + SSE_TOPIC_STATE, state.c_str());
+
+    std::string progress = head;
+    append_field(progress, "percent", f.percent);
+    append_field(progress, "remaining_min", f.remaining_min);
+    append_field(progress, "layer", f.layer);
+    append_field(progress, "total_layers", f.total_layers);
+    progress += '}';
+    publish(topic + SSE_TOPIC_PROGRESS, progress.c_str());
+
+    std::string temps = head;
+    append_field(temps, "nozzle", f.nozzle);
+    append_field(temps, "nozzle_target", f.nozzle_target);
+    append_field(temps, "bed", f.bed);
+    append_field(temps, "bed_target", f.bed_target);
+    temps += '}';
+    publish(topic + SSE_TOPIC_TEMPS, temps.c_str());
+}
+
+void EventStream::on_tux_event(void *arg, esp_event_base_t base, int32_t event_id, void *event_data) {
+    (void)arg;
+    (void)base;
+    const char *state;
+    switch (event_id) {
+        case TUX_EVENT_OTA_STARTED: state = "started"; break;
+        case TUX_EVENT_OTA_ROLLBACK: state = "rollback"; break;
+        case TUX_EVENT_OTA_COMPLETED: state = "completed"; break;
+        case TUX_EVENT_OTA_FAILED: state = "failed"; break;
+        case TUX_EVENT_OTA_ABORTED: state = "aborted"; break;
+        case TUX_EVENT_OTA_IN_PROGRESS: {
+            // Bytes read so far; ota.c also posts "Download completed" under this
+            // ID, which reads as an implausibly large count
+            int bytes = event_data ? *(int *)event_data : -1;
+            char payload[64];
+            if (bytes >= 0 && bytes < 16 * 1024 * 1024) {
+                snprintf(payload, sizeof(payload), "{\"state\":\"downloading\",\"kb\":%d}", bytes / 1024);
+            } else {
+                snprintf(payload, sizeof(payload), "{\"state\":\"downloaded\"}");
+            }
+            publish(SSE_TOPIC_OTA, payload);
+            return;
+        }
+        default:
+            return;
+    }
+
+    std::string payload = "{\"state\":\"";
+    payload += state;
+    payload += "\",\"message\":";
+    append_json_string(payload, (const char *)event_data);
+    payload += '}';
+    publish(SSE_TOPIC_OTA, payload.c_str());
+}
+
+void EventStream::sender_task(void *pvParameter) {
+    (void)pvParameter;
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(SSE_KEEPALIVE_US / 1000));
+        // Let a burst of updates coalesce into the pending masks
+        vTaskDelay(pdMS_TO_TICKS(SSE_BATCH_MS));
+        int64_t now_us = esp_timer_get_time();
+
+        for (int i = 0; i < SSE_MAX_CLIENTS; i++) {
+            httpd_req_t *req;
+            std::string out;
+            {
+                std::lock_guard<std::mutex> lock(s_lock);
+                Client &c = s_clients[i];
+                if (!c.req) continue;
+                for (int topic = 0; topic < SSE_TOPIC_COUNT; topic++) {
+                    if (!(c.pending & (1u << topic))) continue;
+                    out += "event: ";
+                    out += topic_event(topic);
+                    out += "\ndata: ";
+                    out += s_payloads[topic];
+                    out += "\n\n";
+                }
+                c.pending = 0;
+                if (out.empty() && now_us - c.last_send_us < SSE_KEEPALIVE_US) continue;
+                req = c.req;
+            }
+            // Comment line: keeps proxies from timing out and finds dead clients
+            if (out.empty()) out = ": keepalive\n\n";
+
+            // Only this task sends on a subscribed request
+            esp_err_t err = httpd_resp_send_chunk(req, out.data(), out.size());
+            {
+                std::lock_guard<std::mutex> lock(s_lock);
+                if (err == ESP_OK) {
+                    s_clients[i].last_send_us = now_us;
+                } else {
+                    s_clients[i].req = nullptr;
+                    s_client_count--;
+                }
+            }
+            if (err != ESP_OK) {
+                ESP_LOGI(TAG, "Subscriber %d gone (%s)", i, esp_err_to_name(err));
+                httpd_req_async_handler_complete(req);
+            }
+        }
+    }
+}
+
+esp_err_t EventStream::handle_subscribe(httpd_req_t *req) {
+    int slot = -1;
+    if (s_task) {
+        std::lock_guard<std::mutex> lock(s_lock);
+        for (int i = 0; i < SSE_MAX_CLIENTS && slot < 0; i++) {
+            if (!s_clients[i].req) slot = i;
+        }
+    }
+    if (slot < 0) {
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        httpd_resp_set_hdr(req, "Retry-After", "10");
+        return httpd_resp_sendstr(req, "Too many event subscribers");
+    }
+
+    // Detach so the httpd task is free; the sender task owns the copy from now on
+    httpd_req_t *stream = nullptr;
+    if (httpd_req_async_handler_begin(req, &stream) != ESP_OK) {
+        return httpd_resp_send_500(req);
+    }
+    httpd_resp_set_type(stream, "text/event-stream");
+    httpd_resp_set_hdr(stream, "Cache-Control", "no-store");
+    if (httpd_resp_send_chunk(stream, "retry: " SSE_RETRY_MS "\n\n", strlen("retry: " SSE_RETRY_MS "\n\n")) != ESP_OK) {
+        httpd_req_async_handler_complete(stream);
+        return ESP_OK;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(s_lock);
+        Client &c = s_clients[slot];
+        c.req = stream;
+        c.pending = 0;
+        c.last_send_us = esp_timer_get_time();
+        for (int topic = 0; topic < SSE_TOPIC_COUNT; topic++) {
+            if (!s_payloads[topic].empty()) c.pending |= 1u << topic;
+        }
+        s_client_count++;
+    }
+    ESP_LOGI(TAG, "Subscriber %d connected", slot);
+    xTaskNotifyGive(s_task);
+    return ESP_OK;
+}
+
+int EventStream::subscriber_count() {
+    std::lock_guard<std::mutex> lock(s_lock);
+    return s_client_count;
+}
+
+esp_err_t EventStream::start() {
+    if (s_task) return ESP_OK;
+    if (xTaskCreate(sender_task, "sse_sender", 4096, NULL, 3, &s_task) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create sender task");
+        s_task = nullptr;
+        return ESP_ERR_NO_MEM;
+    }
+    esp_event_handler_instance_register(TUX_EVENTS, ESP_EVENT_ANY_ID, on_tux_event, NULL, NULL);
+    return ESP_OK;
+}
@@ -0,0 +1,114 @@
+/*
+ * Fleet State Implementation
+ *
+ * BambuMonitor calls on_bambu_event() from the printer's MQTT task after
+ * each report, with the parsed "print" object. Only the fields the report
+ * carries are merged, straight from that object; temperatures
+ * are kept in whole degrees so sensor noise does not count as a change.
+ * Readers on other tasks get copies from snapshot(), never the report.
+ */
+
+#include "FleetState.hpp"
+#include <cJSON.h>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+
+namespace {
+
+std::mutex s_lock;
+FleetState::Printer s_printers[BAMBU_MAX_PRINTERS];
+uint32_t s_seq = 1;
+FleetState::listener_fn s_listener = nullptr;
+bool s_started = false;
+
+int json_int(const cJSON *obj, const char *key, int current) {
+    cJSON *item = cJSON_GetObjectItem(obj, key);
+    return cJSON_IsNumber(item) ? item->valueint : current;
+}
+
+int json_degrees(const cJSON *obj, const char *key, int current) {
+    cJSON *item = cJSON_GetObjectItem(obj, key);
+    return cJSON_IsNumber(item) ? (int)lround(item->valuedouble) : current;
+}
+
+// Compares what the fleet view and the event stream publish
+bool same(const FleetState::Printer &a, const FleetState::Printer &b) {
+    return a.connected == b.connected && strcmp(a.state, b.state) == 0 &&
+           a.percent == b.percent && a.remaining_min == b.remaining_min &&
+           a.layer == b.layer && a.total_layers == b.total_layers &&
+           a.nozzle == b.nozzle && a.nozzle_target == b.nozzle_target &&
+           a.bed == b.bed && a.bed_target == b.bed_target;
+}
+
+} // namespace
+
+void FleetState::on_bambu_event(void *arg, esp_event_base_t base, int32_t event_id, void *event_data) {
+    (void)arg;
+    (void)base;
+    const bambu_event_data_t *data = (const bambu_event_data_t *)event_data;
+    int index = data->index;
+    if (index < 0 || index >= BAMBU_MAX_PRINTERS) return;
+
+    Printer p;
+    {
+        std::lock_guard<std::mutex> lock(s_lock);
+        p = s_printers[index];
+    }
+
+    if (event_id == BAMBU_PRINTER_CONNECTED) {
+        p.connected = true;
+    } else if (event_id == BAMBU_PRINTER_DISCONNECTED) {
+        p.connected = false;
+    } else if (event_id == BAMBU_STATUS_UPDATED) {
+        p.connected = true;
+        const cJSON *print = data->print;
+        if (print) {
+            cJSON *state = cJSON_GetObjectItem(print, "gcode_state");
+            if (cJSON_IsString(state)) {
+                snprintf(p.state, sizeof(p.state), "%s", state->valuestring);
+            }
+            p.percent = json_int(print, "mc_percent", p.percent);
+            p.remaining_min = json_int(print, "mc_remaining_time", p.remaining_min);
+            p.layer = json_int(print, "layer_num", p.layer);
+            p.total_layers = json_int(print, "total_layer_num", p.total_layers);
+            p.nozzle = json_degrees(print, "nozzle_temper", p.nozzle);
+            p.nozzle_target = json_degrees(print, "nozzle_target_temper", p.nozzle_target);
+            p.bed = json_degrees(print, "bed_temper", p.bed);
+            p.bed_target = json_degrees(print, "bed_target_temper", p.bed_target);
+            p.ams_status = json_int(print, "ams_status", p.ams_status);
+            p.ams_rfid_status = json_int(print, "ams_rfid_status", p.ams_rfid_status);
+            p.print_error = json_int(print, "print_error", p.print_error);
+            cJSON *wifi = cJSON_GetObjectItem(print, "wifi_signal");
+            if (cJSON_IsString(wifi)) {
+                snprintf(p.wifi_signal, sizeof(p.wifi_signal), "%s", wifi->valuestring);
+            }
+        }
+    } else {
+        return;
+    }
+
+    bool changed;
+    {
+        std::lock_guard<std::mutex> lock(s_lock);
+        changed = !same(s_printers[index], p);
+        s_printers[index] = p;
+        if (changed) s_seq++;
+    }
+    if (changed && s_listener) s_listener(index, p);
+}
+
+uint32_t FleetState::snapshot(Printer out[BAMBU_MAX_PRINTERS]) {
+    std::lock_guard<std::mutex> lock(s_lock);
+    for (int i = 0; i < BAMBU_MAX_PRINTERS; i++) out[i] = s_printers[i];
+    return s_seq;
+}
+
+esp_err_t FleetState::start(listener_fn on_change) {
+    if (s_started) return ESP_OK;
+    s_listener = on_change;
+    esp_err_t err = bambu_register_event_handler(on_bambu_event);
+    s_started = (err == ESP_OK);
+    return err;
+}
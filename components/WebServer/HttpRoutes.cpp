@@ -0,0 +1,333 @@
+/*
+ * HTTP Routes Implementation
+ *
+ * Every URI is registered with dispatch() and its Entry as user_ctx.
+ * SYNC routes run on the httpd task as before. ASYNC routes are detached
+ * with httpd_req_async_handler_begin() and queued for a worker, which runs
+ * the same handler on the request copy and completes it. A route at its
+ * max_inflight, or a full queue, answers 503 with Retry-After right away.
+ * timeout_ms runs from arrival: a job that waited past it is dropped, and a
+ * running handler bounds its own network waits with remaining_ms().
+ * Routes of one group count against a single in-flight limit, so with
+ * max_inflight 1 their handlers never run at the same time on two workers.
+ */
+
+#include "HttpRoutes.hpp"
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include <cJSON.h>
+#include <cstring>
+
+const char* HttpRoutes::TAG = "HttpRoutes";
+
+#ifdef CONFIG_TUX_HTTP_WORKERS
+#define HTTP_WORKERS            CONFIG_TUX_HTTP_WORKERS
+#else
+#define HTTP_WORKERS            2
+#endif
+#define HTTP_QUEUE_LEN          8
+#define HTTP_WORKER_STACK       6144    // Handlers build cJSON replies and may write files
+#define HTTP_MAX_ROUTES         32      // Routes listed in stats_json()
+
+// A registered route and its statistics, written under s_lock
+struct HttpRoutes::Entry {
+    Route route;
+    Entry *limit;               // Holds the inflight count: this entry, or the first of its group
+    int inflight;
+    uint32_t count;
+    uint32_t rejected;          // Route or queue full
+    uint32_t timeouts;          // No worker within timeout_ms
+    uint32_t overruns;          // Ran longer than timeout_ms
+    uint32_t max_ms;
+    uint32_t hist[HTTP_ROUTE_BUCKETS];
+};
+
+namespace {
+
+struct Job {
+    httpd_req_t *req;           // Async copy, owned by the worker
+    HttpRoutes::Entry *entry;
+    int64_t start_us;           // Arrival on the httpd task
+};
+
+// Request each worker is running and when its route's timeout_ms runs out
+struct Running {
+    httpd_req_t *req;
+    int64_t deadline_us;
+};
+
+portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+HttpRoutes::Entry *s_entries[HTTP_MAX_ROUTES];  // Never freed: httpd holds them as user_ctx
+size_t s_entry_count = 0;
+Running s_running[HTTP_WORKERS];
+QueueHandle_t s_queue = nullptr;
+
+// API responses are live data: never reused without asking again. no-cache
+// rather than no-store so a response with an ETag (/api/fleet) can be
+// revalidated with If-None-Match. Handlers add their own headers.
+void api_headers(httpd_req_t *req, const HttpRoutes::Route &route) {
+    if (strncmp(route.uri, "/api/", 5) == 0) {
+        httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+    }
+}
+
+void send_busy(httpd_req_t *req, const char *reason) {
+    httpd_resp_set_status(req, "503 Service Unavailable");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Retry-After", "2");
+    std::string body = std::string("{\"success\":false,\"error\":\"") + reason + "\"}";
+    httpd_resp_send(req, body.c_str(), body.length());
+}
+
+// Upper bound (ms) of the bucket holding the given fraction of requests
+uint32_t percentile_ms(const HttpRoutes::Entry &r, float fraction) {
+    uint32_t total = 0;
+    for (int i = 0; i < HTTP_ROUTE_BUCKETS; i++) total += r.hist[i];
+    if (!total) return 0;
+    uint32_t target = (uint32_t)(fraction * total + 0.999f);
+    uint32_t seen = 0;
+    for (int i = 0; i < HTTP_ROUTE_BUCKETS; i++) {
+        seen += r.hist[i];
+        if (seen >= target) {
+            uint32_t bound = 1u << i;
+            return bound < r.max_ms ? bound : r.max_ms;
+        }
+    }
+    return r.max_ms;
+}
+
+const char *method_name(httpd_method_t method) {
+    switch (method) {
+        case HTTP_GET: return "GET";
+        case HTTP_POST: return "POST";
+        case HTTP_PUT: return "PUT";
+        case HTTP_DELETE: return "DELETE";
+        default: return "OTHER";
+    }
+}
+
+} // namespace
+
+void HttpRoutes::record(Entry *entry, int64_t elapsed_us) {
+    uint32_t ms = (uint32_t)(elapsed_us / 1000);
+    int bucket = 0;
+    while (bucket < HTTP_ROUTE_BUCKETS - 1 && ms >= (1u << bucket)) bucket++;
+
+    const Route &route = entry->route;
+    portENTER_CRITICAL(&s_lock);
+    entry->count++;
+    entry->hist[bucket]++;
+    if (ms > entry->max_ms) entry->max_ms = ms;
+    if (route.mode == ASYNC && route.timeout_ms > 0 && ms > (uint32_t)route.timeout_ms) {
+        entry->overruns++;
+    }
+    portEXIT_CRITICAL(&s_lock);
+}
+
+int HttpRoutes::remaining_ms(httpd_req_t *req, int wanted_ms) {
+    int64_t deadline_us = 0;
+    portENTER_CRITICAL(&s_lock);
+    for (int i = 0; i < HTTP_WORKERS; i++) {
+        if (s_running[i].req == req) deadline_us = s_running[i].deadline_us;
+    }
+    portEXIT_CRITICAL(&s_lock);
+    if (!deadline_us) return wanted_ms;
+
+    int64_t left_ms = (deadline_us - esp_timer_get_time()) / 1000;
+    if (left_ms < 0) left_ms = 0;
+    return left_ms < wanted_ms ? (int)left_ms : wanted_ms;
+}
+
+esp_err_t HttpRoutes::dispatch(httpd_req_t *req) {
+    Entry *entry = (Entry *)req->user_ctx;
+    const Route &route = entry->route;
+    int64_t start_us = esp_timer_get_time();
+
+    if (route.mode == SYNC || !s_queue) {
+        api_headers(req, route);
+        esp_err_t err = route.handler(req);
+        record(entry, esp_timer_get_time() - start_us);
+        return err;
+    }
+
+    Entry *limit = entry->limit;
+    portENTER_CRITICAL(&s_lock);
+    bool busy = limit->inflight >= limit->route.max_inflight;
+    if (busy) entry->rejected++;
+    else limit->inflight++;
+    portEXIT_CRITICAL(&s_lock);
+    if (busy) {
+        ESP_LOGW(TAG, "%s %s busy, rejected", method_name(route.method), route.uri);
+        send_busy(req, "Busy, try again");
+        return ESP_OK;
+    }
+
+    Job job = { nullptr, entry, start_us };
+    if (httpd_req_async_handler_begin(req, &job.req) != ESP_OK) {
+        // Could not detach (out of memory): run it here rather than fail
+        api_headers(req, route);
+        esp_err_t err = route.handler(req);
+        record(entry, esp_timer_get_time() - start_us);
+        portENTER_CRITICAL(&s_lock);
+        limit->inflight--;
+        portEXIT_CRITICAL(&s_lock);
+        return err;
+    }
+    if (xQueueSend(s_queue, &job, 0) != pdTRUE) {
+        send_busy(job.req, "Server busy, try again");
+        httpd_req_async_handler_complete(job.req);
+        portENTER_CRITICAL(&s_lock);
+        limit->inflight--;
+        entry->rejected++;
+        portEXIT_CRITICAL(&s_lock);
+    }
+    return ESP_OK;
+}
+
+void HttpRoutes::worker_task(void *pvParameter) {
+    Running *running = (Running *)pvParameter;
+    Job job;
+    while (true) {
+        if (xQueueReceive(s_queue, &job, portMAX_DELAY) != pdTRUE) continue;
+        const Route &route = job.entry->route;
+
+        int64_t waited_us = esp_timer_get_time() - job.start_us;
+        if (route.timeout_ms > 0 && waited_us > (int64_t)route.timeout_ms * 1000) {
+            ESP_LOGW(TAG, "%s %s waited %lld ms for a worker, dropped", method_name(route.method),
+                     route.uri, (long long)(waited_us / 1000));
+            send_busy(job.req, "Timed out waiting for a worker");
+            portENTER_CRITICAL(&s_lock);
+            job.entry->timeouts++;
+            portEXIT_CRITICAL(&s_lock);
+        } else {
+            if (route.timeout_ms > 0) {
+                portENTER_CRITICAL(&s_lock);
+                running->req = job.req;
+                running->deadline_us = job.start_us + (int64_t)route.timeout_ms * 1000;
+                portEXIT_CRITICAL(&s_lock);
+            }
+            api_headers(job.req, route);
+            route.handler(job.req);
+            record(job.entry, esp_timer_get_time() - job.start_us);
+            portENTER_CRITICAL(&s_lock);
+            running->req = nullptr;
+            portEXIT_CRITICAL(&s_lock);
+        }
+
+        // Free the slot before completing: a client that sends its next
+        // request as soon as this response ends must not find it taken
+        portENTER_CRITICAL(&s_lock);
+        job.entry->limit->inflight--;
+        portEXIT_CRITICAL(&s_lock);
+        httpd_req_async_handler_complete(job.req);
+    }
+}
+
+esp_err_t HttpRoutes::start_workers() {
+    if (s_queue) return ESP_OK;
+    s_queue = xQueueCreate(HTTP_QUEUE_LEN, sizeof(Job));
+    if (!s_queue) return ESP_ERR_NO_MEM;
+
+    int started = 0;
+    for (int i = 0; i < HTTP_WORKERS; i++) {
+        char name[16];
+        snprintf(name, sizeof(name), "http_worker%d", i);
+        if (xTaskCreate(worker_task, name, HTTP_WORKER_STACK, &s_running[i], tskIDLE_PRIORITY + 5, NULL) == pdPASS) {
+            started++;
+        }
+    }
+    if (!started) {
+        // Without workers ASYNC routes fall back to running on the httpd task
+        vQueueDelete(s_queue);
+        s_queue = nullptr;
+        ESP_LOGE(TAG, "No worker tasks, all routes run synchronously");
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "%d HTTP worker(s) started", started);
+    return ESP_OK;
+}
+
+esp_err_t HttpRoutes::register_routes(httpd_handle_t server, const Route *routes, size_t count) {
+    esp_err_t result = ESP_OK;
+    for (size_t i = 0; i < count; i++) {
+        Entry *entry = new Entry();
+        entry->route = routes[i];
+        entry->limit = entry;
+        if (routes[i].group) {
+            portENTER_CRITICAL(&s_lock);
+            for (size_t k = 0; k < s_entry_count; k++) {
+                const char *group = s_entries[k]->route.group;
+                if (group && strcmp(group, routes[i].group) == 0) {
+                    entry->limit = s_entries[k]->limit;
+                    break;
+                }
+            }
+            portEXIT_CRITICAL(&s_lock);
+        }
+
+        httpd_uri_t uri = {};
+        uri.uri = routes[i].uri;
+        uri.method = routes[i].method;
+        uri.handler = dispatch;
+        uri.user_ctx = entry;
+        esp_err_t err = httpd_register_uri_handler(server, &uri);
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to register %s %s: %s", method_name(routes[i].method), routes[i].uri,
+                     esp_err_to_name(err));
+            delete entry;
+            result = err;
+            continue;
+        }
+        portENTER_CRITICAL(&s_lock);
+        if (s_entry_count < HTTP_MAX_ROUTES) s_entries[s_entry_count++] = entry;
+        portEXIT_CRITICAL(&s_lock);
+    }
+    return result;
+}
+
+std::string HttpRoutes::stats_json() {
+    cJSON *root = cJSON_CreateObject();
+    cJSON *routes = cJSON_AddArrayToObject(root, "routes");
+    cJSON_AddNumberToObject(root, "workers", s_queue ? HTTP_WORKERS : 0);
+    cJSON_AddNumberToObject(root, "queued", s_queue ? (int)uxQueueMessagesWaiting(s_queue) : 0);
+    // One entry at a time is copied under the lock; cJSON allocates outside it
+    for (size_t i = 0; ; i++) {
+        Entry copy;
+        int inflight = 0;           // Of the route's group, if it has one
+        portENTER_CRITICAL(&s_lock);
+        bool more = i < s_entry_count;
+        if (more) {
+            copy = *s_entries[i];
+            inflight = copy.limit->inflight;
+        }
+        portEXIT_CRITICAL(&s_lock);
+        if (!more) break;
+        if (!copy.count && !copy.rejected && !copy.timeouts) continue;
+        cJSON *o = cJSON_CreateObject();
+        cJSON_AddStringToObject(o, "method", method_name(copy.route.method));
+        cJSON_AddStringToObject(o, "uri", copy.route.uri);
+        cJSON_AddBoolToObject(o, "async", copy.route.mode == ASYNC);
+        cJSON_AddNumberToObject(o, "count", copy.count);
+        cJSON_AddNumberToObject(o, "p50_ms", percentile_ms(copy, 0.50f));
+        cJSON_AddNumberToObject(o, "p90_ms", percentile_ms(copy, 0.90f));
+        cJSON_AddNumberToObject(o, "p99_ms", percentile_ms(copy, 0.99f));
+        cJSON_AddNumberToObject(o, "max_ms", copy.max_ms);
+        if (copy.route.mode == ASYNC) {
+            if (copy.route.group) cJSON_AddStringToObject(o, "group", copy.route.group);
+            cJSON_AddNumberToObject(o, "inflight", inflight);
+            cJSON_AddNumberToObject(o, "rejected", copy.rejected);
+            cJSON_AddNumberToObject(o, "timeouts", copy.timeouts);
+            cJSON_AddNumberToObject(o, "overruns", copy.overruns);
+        }
+        cJSON_AddItemToArray(routes, o);
+    }
+    char *json = cJSON_PrintUnformatted(root);
+    std::string out = json ? json : "{}";
+    free(json);
+    cJSON_Delete(root);
+    return out;
+}
@@ -0,0 +1,166 @@
+/*
+ * JSON Writer Implementation
+ *
+ * Output is compact (no whitespace). Strings are escaped as cJSON does:
+ * quote, backslash and control characters; UTF-8 passes through. Numbers
+ * that are not finite are written as null. After a send error the writer
+ * stops sending and finish() reports the error; nesting deeper than
+ * JSON_WRITER_MAX_DEPTH is such an error too (ESP_ERR_INVALID_SIZE), so a
+ * response with broken separators is never completed.
+ */
+
+#include "JsonWriter.hpp"
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <inttypes.h>
+
+JsonWriter::JsonWriter(httpd_req_t *req) : req(req), len(0), depth(0), has_items(0), err(ESP_OK) {
+    httpd_resp_set_type(req, "application/json");
+}
+
+void JsonWriter::flush() {
+    if (len && err == ESP_OK) {
+        err = httpd_resp_send_chunk(req, buf, len);
+    }
+    len = 0;
+}
+
+void JsonWriter::put(const char *data, size_t n) {
+    while (n) {
+        if (len == sizeof(buf)) flush();
+        size_t room = sizeof(buf) - len;
+        size_t take = n < room ? n : room;
+        memcpy(buf + len, data, take);
+        len += take;
+        data += take;
+        n -= take;
+    }
+}
+
+void JsonWriter::put(char c) {
+    if (len == sizeof(buf)) flush();
+    buf[len++] = c;
+}
+
+void JsonWriter::put_string(const char *s) {
+    put('"');
+    const char *run = s;
+    for (; *s; s++) {
+        unsigned char c = (unsigned char)*s;
+        if (c >= 0x20 && c != '"' && c != '\\') continue;
+        put(run, s - run);
+        run = s + 1;
+        switch (c) {
+            case '"':  put("\\\"", 2); break;
+            case '\\': put("\\\\", 2); break;
+            case '\n': put("\\n", 2); break;
+            case '\r': put("\\r", 2); break;
+            case '\t': put("\\t", 2); break;
+            case '\b': put("\\b", 2); break;
+            case '\f': put("\\f", 2); break;
+            default: {
+                char esc[8];
+                snprintf(esc, sizeof(esc), "\\u%04x", c);
+                put(esc, 6);
+            }
+        }
+    }
+    put(run, s - run);
+    put('"');
+}
+
+// Separator and key before a member of the current container
+void JsonWriter::member(const char *key) {
+    if (depth >= JSON_WRITER_MAX_DEPTH) return;     // Too deep: err is set, nothing is sent
+    uint32_t bit = 1u << depth;
+    if (has_items & bit) put(',');
+    has_items |= bit;
+    if (key) {
+        put_string(key);
+        put(':');
+    }
+}
+
+// Enter a container; depth keeps counting past the cap so the ends match
+void JsonWriter::open() {
+    if (++depth < JSON_WRITER_MAX_DEPTH) {
+        has_items &= ~(1u << depth);
+    } else if (err == ESP_OK) {
+        err = ESP_ERR_INVALID_SIZE;
+    }
+}
+
+JsonWriter &JsonWriter::begin_object(const char *key) {
+    member(key);
+    put('{');
+    open();
+    return *this;
+}
+
+JsonWriter &JsonWriter::end_object() {
+    if (depth > 0) depth--;
+    put('}');
+    return *this;
+}
+
+JsonWriter &JsonWriter::begin_array(const char *key) {
+    member(key);
+    put('[');
+    open();
+    return *this;
+}
+
+JsonWriter &JsonWriter::end_array() {
+    if (depth > 0) depth--;
+    put(']');
+    return *this;
+}
+
+JsonWriter &JsonWriter::str(const char *key, const char *value) {
+    member(key);
+    if (value) put_string(value);
+    else put("null", 4);
+    return *this;
+}
+
+JsonWriter &JsonWriter::integer(const char *key, int64_t value) {
+    member(key);
+    char tmp[24];
+    int n = snprintf(tmp, sizeof(tmp), "%" PRId64, value);
+    put(tmp, n);
+    return *this;
+}
+
+JsonWriter &JsonWriter::number(const char *key, double value) {
+    member(key);
+    if (!std::isfinite(value)) {
+        put("null", 4);
+        return *this;
+    }
+    char tmp[32];
+    int n = snprintf(tmp, sizeof(tmp), "%.15g", value);
+    put(tmp, n);
+    return *this;
+}
+
+JsonWriter &JsonWriter::boolean(const char *key, bool value) {
+    member(key);
+    if (value) put("true", 4);
+    else put("false", 5);
+    return *this;
+}
+
+JsonWriter &JsonWriter::null(const char *key) {
+    member(key);
+    put("null", 4);
+    return *this;
+}
+
+esp_err_t JsonWriter::finish() {
+    flush();
+    if (err == ESP_OK) {
+        err = httpd_resp_send_chunk(req, NULL, 0);
+    }
+    return err;
+}
@@ -0,0 +1,119 @@
+/*
+ * Metrics Writer Implementation
+ *
+ * Label values escape backslash, double quote and newline as the format
+ * requires; HELP text escapes backslash and newline. Doubles that are not
+ * finite are written as NaN, +Inf or -Inf. As in JsonWriter, after a send
+ * error the writer stops sending and finish() reports the error.
+ */
+
+#include "MetricsWriter.hpp"
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <inttypes.h>
+
+MetricsWriter::MetricsWriter(httpd_req_t *req) : req(req), len(0), err(ESP_OK) {
+    httpd_resp_set_type(req, "text/plain; version=0.0.4; charset=utf-8");
+}
+
+void MetricsWriter::flush() {
+    if (len && err == ESP_OK) {
+        err = httpd_resp_send_chunk(req, buf, len);
+    }
+    len = 0;
+}
+
+void MetricsWriter::put(const char *data, size_t n) {
+    while (n) {
+        if (len == sizeof(buf)) flush();
+        size_t room = sizeof(buf) - len;
+        size_t take = n < room ? n : room;
+        memcpy(buf + len, data, take);
+        len += take;
+        data += take;
+        n -= take;
+    }
+}
+
+void MetricsWriter::put(const char *s) {
+    put(s, strlen(s));
+}
+
+void MetricsWriter::put(char c) {
+    if (len == sizeof(buf)) flush();
+    buf[len++] = c;
+}
+
+MetricsWriter &MetricsWriter::family(const char *name, const char *type, const char *help) {
+    put("# HELP ");
+    put(name);
+    put(' ');
+    for (; *help; help++) {
+        if (*help == '\\') put("\\\\", 2);
+        else if (*help == '\n') put("\\n", 2);
+        else put(*help);
+    }
+    put("\n# TYPE ");
+    put(name);
+    put(' ');
+    put(type);
+    put('\n');
+    return *this;
+}
+
+void MetricsWriter::label(bool first, const char *key, const char *value) {
+    put(first ? '{' : ',');
+    put(key);
+    put("=\"", 2);
+    for (; value && *value; value++) {
+        if (*value == '\\') put("\\\\", 2);
+        else if (*value == '"') put("\\\"", 2);
+        else if (*value == '\n') put("\\n", 2);
+        else put(*value);
+    }
+    put('"');
+}
+
+// Metric name and label set, up to the space before the value
+void MetricsWriter::series(const char *name, const char *k1, const char *v1, const char *k2, const char *v2) {
+    put(name);
+    if (k1) label(true, k1, v1);
+    if (k2) label(!k1, k2, v2);
+    if (k1 || k2) put('}');
+    put(' ');
+}
+
+MetricsWriter &MetricsWriter::integer(const char *name, int64_t value,
+                                      const char *k1, const char *v1, const char *k2, const char *v2) {
+    series(name, k1, v1, k2, v2);
+    char tmp[24];
+    int n = snprintf(tmp, sizeof(tmp), "%" PRId64 "\n", value);
+    put(tmp, n);
+    return *this;
+}
+
+MetricsWriter &MetricsWriter::number(const char *name, double value,
+                                     const char *k1, const char *v1, const char *k2, const char *v2) {
+    series(name, k1, v1, k2, v2);
+    if (std::isnan(value)) {
+        put("NaN\n");
+    } else if (std::isinf(value)) {
+        put(value > 0 ? "+Inf\n" : "-Inf\n");
+    } else {
+        // Whole numbers (counters passed as double) are written exactly
+        char tmp[32];
+        bool whole = value == std::trunc(value) && std::fabs(value) < 1e15;
+        int n = snprintf(tmp, sizeof(tmp), whole ? "%.0f\n" : "%.9g\n", value);
+        put(tmp, n);
+    }
+    return *this;
+}
+
+esp_err_t MetricsWriter::finish() {
+    flush();
+    if (err == ESP_OK) {
+        err = httpd_resp_send_chunk(req, NULL, 0);
+    }
+    return err;
+}
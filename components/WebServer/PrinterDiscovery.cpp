@@ -1,15 +1,20 @@
 /*
  * Printer Discovery Implementation
- * Uses mDNS for local network discovery, IP scanning for additional networks
+ * Uses SSDP announcements and mDNS for the local network, IP scanning for
+ * additional networks
  */
 
 #include "PrinterDiscovery.hpp"
+#include "SubnetScanner.hpp"
+#include "SsdpListener.hpp"
 #include "SettingsConfig.hpp"
 #include "../BambuMonitor/include/BambuMonitor.hpp"
 #include <cstring>
+#include <cstdlib>
 #include <esp_err.h>
 #include <esp_log.h>
 #include <esp_system.h>
+#include <esp_timer.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <freertos/semphr.h>
@@ -19,6 +24,7 @@
 #include <arpa/inet.h>
 #include <vector>
 #include <mutex>
+#include <memory>
 #include <esp_netif.h>
 #include <fcntl.h>
 #include <errno.h>
@@ -31,6 +37,14 @@ extern SettingsConfig *cfg;
 const char* PrinterDiscovery::TAG = "PrinterDiscovery";
 PrinterFoundCallback PrinterDiscovery::s_printer_found_callback = nullptr;
 
+// Printers found by mDNS or scans, kept between discovery runs
+#define DISCOVERY_MAX_KNOWN     32
+// Hosts on either side of a known printer scanned before the full sweep
+#define DISCOVERY_NEIGHBOURS    8
+
+static std::mutex s_known_mutex;
+static std::vector<PrinterDiscovery::PrinterInfo> s_known;
+
 PrinterDiscovery::PrinterDiscovery() {
 }
 
@@ -109,10 +123,100 @@ std::vector<std::string> PrinterDiscovery::parse_subnet_ips(const std::string &s
     return ips;
 }
 
+// Placeholder values that a later sighting may replace
+static bool is_generic(const std::string &value) {
+    return value.empty() || value == "Unknown" || value == "Bambu Lab Printer";
+}
+
+void PrinterDiscovery::remember(const PrinterInfo &info) {
+    if (info.ip_address.empty()) return;
+    std::lock_guard<std::mutex> lock(s_known_mutex);
+    
+    auto it = s_known.end();
+    if (!info.serial.empty()) {
+        it = std::find_if(s_known.begin(), s_known.end(),
+            [&info](const PrinterInfo &p) { return p.serial == info.serial; });
+    }
+    if (it == s_known.end()) {
+        it = std::find_if(s_known.begin(), s_known.end(),
+            [&info](const PrinterInfo &p) { return p.ip_address == info.ip_address; });
+    }
+    if (it == s_known.end()) {
+        if (s_known.size() >= DISCOVERY_MAX_KNOWN) {
+            it = std::min_element(s_known.begin(), s_known.end(),
+                [](const PrinterInfo &a, const PrinterInfo &b) { return a.last_seen_us < b.last_seen_us; });
+            *it = PrinterInfo();
+        } else {
+            it = s_known.insert(s_known.end(), PrinterInfo());
+        }
+    }
+    
+    // Keep the most specific details seen so far
+    it->ip_address = info.ip_address;
+    if (!is_generic(info.hostname) || it->hostname.empty()) it->hostname = info.hostname;
+    if (!is_generic(info.model) || it->model.empty()) it->model = info.model;
+    if (!info.serial.empty()) it->serial = info.serial;
+    it->source = info.source;
+    it->last_seen_us = info.last_seen_us ? info.last_seen_us : esp_timer_get_time();
+}
+
+std::vector<PrinterDiscovery::PrinterInfo> PrinterDiscovery::known_printers() {
+    // Announced printers carry the freshest details; known entries fill in the rest
+    std::vector<PrinterInfo> printers = SsdpListener::printers();
+    {
+        std::lock_guard<std::mutex> lock(s_known_mutex);
+        for (const auto &known : s_known) {
+            bool announced = std::any_of(printers.begin(), printers.end(), [&known](const PrinterInfo &p) {
+                return p.ip_address == known.ip_address || (!known.serial.empty() && p.serial == known.serial);
+            });
+            if (!announced) {
+                printers.push_back(known);
+            }
+        }
+    }
+    std::stable_sort(printers.begin(), printers.end(),
+        [](const PrinterInfo &a, const PrinterInfo &b) { return a.last_seen_us > b.last_seen_us; });
+    return printers;
+}
+
+void PrinterDiscovery::forget_older_than(int64_t run_start_us) {
+    std::lock_guard<std::mutex> lock(s_known_mutex);
+    s_known.erase(std::remove_if(s_known.begin(), s_known.end(), [run_start_us](const PrinterInfo &p) {
+        if (p.last_seen_us >= run_start_us) return false;
+        ESP_LOGI(TAG, "%s no longer answers, dropped", p.ip_address.c_str());
+        return true;
+    }), s_known.end());
+}
+
+void PrinterDiscovery::prioritize_ips(std::vector<std::string> &ips) {
+    std::vector<std::string> known_ips;
+    {
+        std::lock_guard<std::mutex> lock(s_known_mutex);
+        for (const auto &p : s_known) known_ips.push_back(p.ip_address);
+    }
+    if (known_ips.empty()) return;
+    
+    // 0: known printer, 1: within DISCOVERY_NEIGHBOURS hosts of one, 2: the rest
+    auto rank = [&known_ips](const std::string &ip) {
+        size_t dot = ip.rfind('.');
+        int rank = 2;
+        for (const auto &known : known_ips) {
+            if (known == ip) return 0;
+            size_t kdot = known.rfind('.');
+            if (dot == std::string::npos || kdot != dot || known.compare(0, dot, ip, 0, dot) != 0) continue;
+            int distance = abs(atoi(known.c_str() + kdot + 1) - atoi(ip.c_str() + dot + 1));
+            if (distance <= DISCOVERY_NEIGHBOURS) rank = 1;
+        }
+        return rank;
+    };
+    std::stable_sort(ips.begin(), ips.end(),
+        [&rank](const std::string &a, const std::string &b) { return rank(a) < rank(b); });
+}
+
 std::vector<PrinterDiscovery::PrinterInfo> PrinterDiscovery::scan_subnet(const std::string &subnet, ProgressCallback progress_cb) {
     std::vector<PrinterInfo> discovered;
     
-    ESP_LOGI(TAG, "=== Starting sequential IP scan for subnet: %s ===", subnet.c_str());
+    ESP_LOGI(TAG, "=== Starting parallel IP scan for subnet: %s ===", subnet.c_str());
     
     std::vector<std::string> ips_to_scan = parse_subnet_ips(subnet, 254);
     int total_ips = ips_to_scan.size();
@@ -123,59 +227,52 @@ std::vector<PrinterDiscovery::PrinterInfo> PrinterDiscovery::scan_subnet(const s
         return discovered;
     }
     
-    ESP_LOGI(TAG, "Scanning %d IPs sequentially from subnet %s (no parallel tasks)", total_ips, subnet.c_str());
     if (progress_cb) progress_cb(0, 100);
     
-    int found_count = 0;
-    int scanned_count = 0;
+    // Known printers and their neighbours answer in the first window
+    prioritize_ips(ips_to_scan);
     
-    // Sequential scan - test each IP one at a time (like bambu_project)
-    // This avoids task creation failures and memory exhaustion
-    for (int i = 0; i < total_ips; i++) {
-        const std::string &ip = ips_to_scan[i];
-        
-        // Test connection directly without creating a task
-        bool found = test_connection(ip, 8883, 500);
-        
-        if (found) {
+    // Probe the MQTT port of every host, a window of connects at a time
+    SubnetScanner::Options opt;
+    opt.port = 8883;
+#ifdef CONFIG_TUX_DISCOVERY_SCAN_WINDOW
+    opt.window = CONFIG_TUX_DISCOVERY_SCAN_WINDOW;
+    opt.timeout_ms = CONFIG_TUX_DISCOVERY_CONNECT_TIMEOUT_MS;
+#endif
+    
+    int last_progress = -1;
+    SubnetScanner::scan(ips_to_scan, opt,
+        [&discovered](const std::string &ip) {
             PrinterInfo info;
             info.ip_address = ip;
             info.hostname = "Bambu Lab Printer";
             info.model = "Unknown";
+            info.source = "scan";
+            info.last_seen_us = esp_timer_get_time();
             discovered.push_back(info);
-            found_count++;
-            ESP_LOGI(TAG, "✓ Found printer at: %s", ip.c_str());
+            remember(info);
             
             // Notify static callback immediately
             if (s_printer_found_callback) {
                 s_printer_found_callback(ip);
             }
-        } else {
-            ESP_LOGD(TAG, "✗ No printer at: %s", ip.c_str());
-        }
-        scanned_count++;
-        
-        // Update progress
-        if (progress_cb) {
-            int progress = (scanned_count * 100) / total_ips;
+        },
+        [&progress_cb, &last_progress](int done, int total) {
+            int progress = (done * 100) / total;
+            if (!progress_cb || progress == last_progress) return;
+            last_progress = progress;
             if (progress % 10 == 0) {  // Log every 10%
-                ESP_LOGI(TAG, "Progress: %d%% (%d/%d IPs scanned)", progress, scanned_count, total_ips);
+                ESP_LOGI(TAG, "Progress: %d%% (%d/%d IPs scanned)", progress, done, total);
             }
             progress_cb(progress, 100);
-        }
-        
-        // Yield occasionally to prevent watchdog timeout
-        if (i % 20 == 0) {
-            vTaskDelay(10 / portTICK_PERIOD_MS);
-        }
-    }
+        });
     
     // Report 100% complete
     if (progress_cb) {
         progress_cb(100, 100);
     }
     
-    ESP_LOGI(TAG, "=== Subnet scan complete: Found %d printers out of %d IPs scanned ===", found_count, scanned_count);
+    ESP_LOGI(TAG, "=== Subnet scan complete: Found %d printers out of %d IPs scanned ===", (int)discovered.size(), total_ips);
     return discovered;
 }
 
@@ -229,7 +326,10 @@ std::vector<PrinterDiscovery::PrinterInfo> PrinterDiscovery::discover_mdns(int t
         
         // Only add if we have both hostname and IP
         if (!info.hostname.empty() && !info.ip_address.empty()) {
+            info.source = "mdns";
+            info.last_seen_us = esp_timer_get_time();
             discovered.push_back(info);
+            remember(info);
             
             // Notify callback if set
             if (s_printer_found_callback) {
@@ -247,7 +347,7 @@ std::vector<PrinterDiscovery::PrinterInfo> PrinterDiscovery::discover_mdns(int t
 }
 
 std::vector<PrinterDiscovery::PrinterInfo> PrinterDiscovery::discover(int timeout_ms, ProgressCallback progress_cb) {
-    std::vector<PrinterInfo> discovered;
+    const int64_t run_start_us = esp_timer_get_time();
     
     ESP_LOGI(TAG, "=== Starting Bambu Lab printer discovery ===");
     
@@ -258,32 +358,58 @@ std::vector<PrinterDiscovery::PrinterInfo> PrinterDiscovery::discover(int timeou
         ESP_LOGW(TAG, "No progress callback provided");
     }
     
-    // Step 1: Try mDNS discovery first (fast, works on local network)
-    ESP_LOGI(TAG, "Step 1: mDNS discovery on local network...");
+    // Step 0: Printers that announced themselves over SSDP (instant, includes serial)
+    std::vector<PrinterInfo> announced = SsdpListener::printers();
+    ESP_LOGI(TAG, "Step 0: %d printer(s) known from SSDP announcements", (int)announced.size());
+    for (const auto &printer : announced) {
+        if (s_printer_found_callback) {
+            s_printer_found_callback(printer.ip_address);
+        }
+    }
+    
+    // Step 1: Re-probe printers found by earlier runs (one connect window)
+    std::vector<PrinterInfo> known = known_printers();
+    std::vector<std::string> known_ips;
+    for (const auto &printer : known) {
+        if (printer.source != "ssdp") known_ips.push_back(printer.ip_address);
+    }
+    if (!known_ips.empty()) {
+        ESP_LOGI(TAG, "Step 1: Re-probing %d known printer(s)...", (int)known_ips.size());
+        SubnetScanner::Options opt;
+#ifdef CONFIG_TUX_DISCOVERY_CONNECT_TIMEOUT_MS
+        opt.timeout_ms = CONFIG_TUX_DISCOVERY_CONNECT_TIMEOUT_MS;
+#endif
+        SubnetScanner::scan(known_ips, opt, [&known](const std::string &ip) {
+            for (auto printer : known) {
+                if (printer.ip_address != ip) continue;
+                printer.last_seen_us = esp_timer_get_time();
+                remember(printer);
+            }
+            if (s_printer_found_callback) {
+                s_printer_found_callback(ip);
+            }
+        });
+    }
+    
+    // Step 2: mDNS discovery (fast, works on local network)
+    ESP_LOGI(TAG, "Step 2: mDNS discovery on local network...");
     if (progress_cb) progress_cb(5, 100);
     
     std::vector<PrinterInfo> mdns_results = discover_mdns(2000);  // 2 second timeout
     if (!mdns_results.empty()) {
         ESP_LOGI(TAG, "mDNS found %d printer(s) on local network", (int)mdns_results.size());
-        discovered.insert(discovered.end(), mdns_results.begin(), mdns_results.end());
     }
     
     if (progress_cb) progress_cb(15, 100);
     
-    // Step 2: Get configured networks from SettingsConfig for IP scanning
+    // Step 3: IP scanning on the networks configured in SettingsConfig
+    int network_count = cfg ? cfg->get_network_count() : 0;
     if (!cfg) {
         ESP_LOGE(TAG, "ERROR: cfg is NULL!");
-        if (progress_cb) progress_cb(100, 100);
-        return discovered;
-    }
-    
-    int network_count = cfg->get_network_count();
-    ESP_LOGI(TAG, "Step 2: IP scanning on %d configured network(s)...", network_count);
-    
-    if (network_count <= 0) {
+    } else if (network_count <= 0) {
         ESP_LOGI(TAG, "No additional networks configured for IP scanning.");
-        if (progress_cb) progress_cb(100, 100);
-        return discovered;
+    } else {
+        ESP_LOGI(TAG, "Step 3: IP scanning on %d configured network(s)...", network_count);
     }
     
     // Calculate progress range for IP scanning (15-100%)
@@ -317,22 +443,12 @@ std::vector<PrinterDiscovery::PrinterInfo> PrinterDiscovery::discover(int timeou
         
         std::vector<PrinterInfo> subnet_results = scan_subnet(network.subnet, network_progress_cb);
         ESP_LOGI(TAG, "  → Scan complete: Found %d printers", (int)subnet_results.size());
-        
-        // Add results, avoiding duplicates (by IP)
-        for (const auto& printer : subnet_results) {
-            bool duplicate = false;
-            for (const auto& existing : discovered) {
-                if (existing.ip_address == printer.ip_address) {
-                    duplicate = true;
-                    break;
-                }
-            }
-            if (!duplicate) {
-                discovered.push_back(printer);
-            }
-        }
     }
     
+    // A complete run answers for every known printer: drop the ones that stayed silent
+    forget_older_than(run_start_us);
+    std::vector<PrinterInfo> discovered = known_printers();
+    
     // Ensure progress shows 100% at the end
     if (progress_cb) {
         progress_cb(100, 100);
@@ -440,6 +556,7 @@ std::string PrinterDiscovery::extract_serial_from_topic(const std::string &topic
 }
 
 // Structure to hold MQTT query task parameters and results
+// Shared by the caller and the task; whoever finishes last frees it
 struct mqtt_query_params {
     std::string ip;
     std::string access_code;
@@ -447,6 +564,10 @@ struct mqtt_query_params {
     PrinterDiscovery::PrinterStatus result;
     SemaphoreHandle_t done_semaphore;
     bool task_complete;
+    
+    ~mqtt_query_params() {
+        if (done_semaphore) vSemaphoreDelete(done_semaphore);
+    }
 };
 
 // Structure to hold MQTT message data
@@ -526,10 +647,56 @@ static void mqtt_event_handler(void *handler_args, esp_event_base_t base, int32_
     }
 }
 
-// Task function that runs the MQTT query with adequate stack for mbedTLS
-static void mqtt_query_task(void *pvParameters) {
-    mqtt_query_params *params = (mqtt_query_params *)pvParameters;
-    
+// Results of temporary MQTT queries, so repeated lookups skip the TLS handshake
+#define QUERY_CACHE_SIZE    4
+#define QUERY_CACHE_TTL_US  (60 * 1000000LL)
+
+struct query_cache_entry {
+    std::string access_code;
+    PrinterDiscovery::PrinterStatus status;
+    int64_t time_us;
+};
+
+static std::mutex s_query_cache_mutex;
+static std::vector<query_cache_entry> s_query_cache;
+
+// One temporary MQTT/TLS client at a time (~40KB while connected); the query
+// task hands the slot back when it ends, even if the caller stopped waiting
+static SemaphoreHandle_t query_slot() {
+    static SemaphoreHandle_t slot = [] {
+        SemaphoreHandle_t sem = xSemaphoreCreateBinary();
+        if (sem) xSemaphoreGive(sem);
+        return sem;
+    }();
+    return slot;
+}
+
+static bool query_cache_lookup(const std::string &ip, const std::string &access_code, PrinterDiscovery::PrinterStatus &status) {
+    std::lock_guard<std::mutex> lock(s_query_cache_mutex);
+    int64_t now_us = esp_timer_get_time();
+    for (const auto &entry : s_query_cache) {
+        if (entry.status.ip_address == ip && entry.access_code == access_code &&
+            now_us - entry.time_us < QUERY_CACHE_TTL_US) {
+            status = entry.status;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void query_cache_store(const std::string &access_code, const PrinterDiscovery::PrinterStatus &status) {
+    std::lock_guard<std::mutex> lock(s_query_cache_mutex);
+    s_query_cache.erase(std::remove_if(s_query_cache.begin(), s_query_cache.end(),
+        [&status](const query_cache_entry &e) { return e.status.ip_address == status.ip_address; }),
+        s_query_cache.end());
+    if (s_query_cache.size() >= QUERY_CACHE_SIZE) {
+        s_query_cache.erase(s_query_cache.begin());     // Oldest first
+    }
+    s_query_cache.push_back({access_code, status, esp_timer_get_time()});
+}
+
+// Runs the MQTT query; called on a task with adequate stack for mbedTLS
+static void mqtt_query_run(mqtt_query_params *params) {
     ESP_LOGI(MQTT_TAG, "MQTT query task started for %s", params->ip.c_str());
     
     params->result.ip_address = params->ip;
@@ -545,8 +712,6 @@ static void mqtt_query_task(void *pvParameters) {
         if (msg_data.connect_semaphore) vSemaphoreDelete(msg_data.connect_semaphore);
         params->result.state = "ERROR";
         params->task_complete = true;
-        xSemaphoreGive(params->done_semaphore);
-        vTaskDelete(NULL);
         return;
     }
     
@@ -560,8 +725,6 @@ static void mqtt_query_task(void *pvParameters) {
         if (msg_data.connect_semaphore) vSemaphoreDelete(msg_data.connect_semaphore);
         params->result.state = "LOW_MEMORY";
         params->task_complete = true;
-        xSemaphoreGive(params->done_semaphore);
-        vTaskDelete(NULL);
         return;
     }
     
@@ -601,8 +764,6 @@ static void mqtt_query_task(void *pvParameters) {
         vSemaphoreDelete(msg_data.connect_semaphore);
         params->result.state = "ERROR";
         params->task_complete = true;
-        xSemaphoreGive(params->done_semaphore);
-        vTaskDelete(NULL);
         return;
     }
     
@@ -618,8 +779,6 @@ static void mqtt_query_task(void *pvParameters) {
         vSemaphoreDelete(msg_data.connect_semaphore);
         params->result.state = "ERROR";
         params->task_complete = true;
-        xSemaphoreGive(params->done_semaphore);
-        vTaskDelete(NULL);
         return;
     }
     
@@ -634,8 +793,6 @@ static void mqtt_query_task(void *pvParameters) {
         vSemaphoreDelete(msg_data.connect_semaphore);
         params->result.state = "CONNECT_TIMEOUT";
         params->task_complete = true;
-        xSemaphoreGive(params->done_semaphore);
-        vTaskDelete(NULL);
         return;
     }
     
@@ -689,9 +846,15 @@ static void mqtt_query_task(void *pvParameters) {
     vSemaphoreDelete(msg_data.connect_semaphore);
     
     params->task_complete = true;
-    xSemaphoreGive(params->done_semaphore);
-    
     ESP_LOGI(MQTT_TAG, "MQTT query task complete");
+}
+
+static void mqtt_query_task(void *pvParameters) {
+    std::shared_ptr<mqtt_query_params> *params = (std::shared_ptr<mqtt_query_params> *)pvParameters;
+    mqtt_query_run(params->get());
+    xSemaphoreGive((*params)->done_semaphore);
+    xSemaphoreGive(query_slot());
+    delete params;  // Frees the parameters if the caller stopped waiting
     vTaskDelete(NULL);
 }
 
@@ -699,11 +862,35 @@ PrinterDiscovery::PrinterStatus PrinterDiscovery::query_printer_status(const std
     PrinterStatus status;
     status.ip_address = ip;
     
-    ESP_LOGI(TAG, "Starting MQTT query for printer at %s with timeout %d ms", ip.c_str(), timeout_ms);
+    if (query_cache_lookup(ip, access_code, status)) {
+        ESP_LOGI(TAG, "Printer at %s answered recently, serial %s", ip.c_str(), status.serial.c_str());
+        return status;
+    }
+    
+    // timeout_ms bounds the whole call; the query task may outlive it
+    int64_t deadline_us = esp_timer_get_time() + (int64_t)timeout_ms * 1000;
+    auto left_ms = [deadline_us]() {
+        int64_t left = (deadline_us - esp_timer_get_time()) / 1000;
+        return left > 0 ? (int)left : 0;
+    };
+    
+    if (!query_slot() || xSemaphoreTake(query_slot(), pdMS_TO_TICKS(timeout_ms)) != pdTRUE) {
+        ESP_LOGW(TAG, "Another printer query is still running");
+        status.state = "BUSY";
+        return status;
+    }
+    // The query we waited for may have been for the same printer
+    if (query_cache_lookup(ip, access_code, status)) {
+        xSemaphoreGive(query_slot());
+        return status;
+    }
+    
+    ESP_LOGI(TAG, "Starting MQTT query for printer at %s with timeout %d ms", ip.c_str(), left_ms());
     
     // Verify connection first (quick TCP check)
-    if (!test_connection(ip, 8883, 500)) {
+    if (left_ms() == 0 || !test_connection(ip, 8883, std::min(500, left_ms()))) {
         ESP_LOGE(TAG, "Printer not reachable at %s:8883", ip.c_str());
+        xSemaphoreGive(query_slot());
         status.state = "OFFLINE";
         return status;
     }
@@ -711,48 +898,51 @@ PrinterDiscovery::PrinterStatus PrinterDiscovery::query_printer_status(const std
     ESP_LOGI(TAG, "✓ Printer reachable at %s:8883", ip.c_str());
     
     // Create parameters structure for the task
-    mqtt_query_params params;
-    params.ip = ip;
-    params.access_code = access_code;
-    params.timeout_ms = timeout_ms;
-    params.task_complete = false;
-    params.done_semaphore = xSemaphoreCreateBinary();
-    
-    if (!params.done_semaphore) {
+    std::shared_ptr<mqtt_query_params> params = std::make_shared<mqtt_query_params>();
+    params->ip = ip;
+    params->access_code = access_code;
+    params->timeout_ms = std::max(left_ms(), 1000);    // Task's own limit; ours is the deadline
+    params->task_complete = false;
+    params->done_semaphore = xSemaphoreCreateBinary();
+    
+    if (!params->done_semaphore) {
         ESP_LOGE(TAG, "Failed to create done semaphore");
+        xSemaphoreGive(query_slot());
         status.state = "ERROR";
         return status;
     }
     
     // Create task with large stack for mbedTLS SSL operations (12KB)
     // The httpd task only has 4KB which is not enough for SSL handshake
+    std::shared_ptr<mqtt_query_params> *task_ref = new std::shared_ptr<mqtt_query_params>(params);
     BaseType_t task_created = xTaskCreate(
         mqtt_query_task,
         "mqtt_query",
         12288,  // 12KB stack - mbedTLS needs ~8KB for SSL handshake
-        &params,
+        task_ref,
         5,      // Priority
         NULL
     );
     
     if (task_created != pdPASS) {
         ESP_LOGE(TAG, "Failed to create MQTT query task");
-        vSemaphoreDelete(params.done_semaphore);
+        delete task_ref;
+        xSemaphoreGive(query_slot());
         status.state = "ERROR";
         return status;
     }
     
-    // Wait for task to complete with overall timeout (connection + query + buffer)
-    int total_timeout = timeout_ms + 5000;  // Add 5s for SSL handshake overhead
-    if (xSemaphoreTake(params.done_semaphore, pdMS_TO_TICKS(total_timeout)) == pdTRUE) {
-        status = params.result;
+    // Wait for the task until the deadline; it hands the slot back itself
+    if (xSemaphoreTake(params->done_semaphore, pdMS_TO_TICKS(left_ms())) == pdTRUE) {
+        status = params->result;
         ESP_LOGI(TAG, "MQTT query completed with state: %s", status.state.c_str());
+        if (!status.serial.empty()) {
+            query_cache_store(access_code, status);
+        }
     } else {
         ESP_LOGW(TAG, "MQTT query task timed out");
         status.state = "TIMEOUT";
     }
     
-    vSemaphoreDelete(params.done_semaphore);
-    
     return status;
 }
@@ -0,0 +1,256 @@
+/*
+ * SSDP Listener Implementation
+ *
+ * Bambu printers send an SSDP NOTIFY every few seconds, to the broadcast
+ * address and the SSDP multicast group, on UDP port 2021:
+ *
+ *   NOTIFY * HTTP/1.1
+ *   Location: 192.168.1.42
+ *   NT: urn:bambulab-com:device:3dprinter:1
+ *   USN: 01S00A123456789
+ *   Cache-Control: max-age=1800
+ *   DevModel.bambu.com: C12
+ *   DevName.bambu.com: Workshop P1S
+ *
+ * Each announcement refreshes the printer's entry; entries expire after the
+ * announced max-age (capped by TUX_DISCOVERY_SSDP_TTL_S) or on ssdp:byebye.
+ */
+
+#include "SsdpListener.hpp"
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <lwip/sockets.h>
+#include <arpa/inet.h>
+#include <cstring>
+#include <strings.h>
+#include <errno.h>
+#include <unistd.h>
+#include <algorithm>
+#include <mutex>
+
+const char* SsdpListener::TAG = "SsdpListener";
+
+#define SSDP_PORT               2021
+#define SSDP_MULTICAST_ADDR     "239.255.255.250"
+#define SSDP_MAX_PRINTERS       16
+#define SSDP_BUFFER_SIZE        1024
+
+#ifdef CONFIG_TUX_DISCOVERY_SSDP_TTL_S
+#define SSDP_TTL_S              CONFIG_TUX_DISCOVERY_SSDP_TTL_S
+#else
+#define SSDP_TTL_S              300
+#endif
+
+namespace {
+
+struct SeenPrinter {
+    PrinterDiscovery::PrinterInfo info;     // info.last_seen_us: last NOTIFY
+    int64_t expires_us;
+};
+
+std::mutex s_table_mutex;
+std::vector<SeenPrinter> s_table;
+TaskHandle_t s_task = nullptr;
+
+// Header value if the line is "<key>: value", else NULL
+const char *header_value(const std::string &line, const char *key) {
+    size_t key_len = strlen(key);
+    if (line.size() <= key_len || line[key_len] != ':' || strncasecmp(line.c_str(), key, key_len) != 0) {
+        return nullptr;
+    }
+    const char *v = line.c_str() + key_len + 1;
+    while (*v == ' ' || *v == '\t') v++;
+    return v;
+}
+
+// Host part of a Location value: "192.168.1.42", "http://192.168.1.42:80/x"
+std::string location_host(const char *value) {
+    std::string host = value;
+    size_t scheme = host.find("://");
+    if (scheme != std::string::npos) host.erase(0, scheme + 3);
+    size_t end = host.find_first_of(":/");
+    if (end != std::string::npos) host.erase(end);
+    struct in_addr addr;
+    return inet_pton(AF_INET, host.c_str(), &addr) == 1 ? host : std::string();
+}
+
+} // namespace
+
+std::string SsdpListener::model_name(const std::string &code) {
+    static const struct { const char *code; const char *name; } models[] = {
+        {"BL-P001", "X1C"}, {"BL-P002", "X1"}, {"C13", "X1E"},
+        {"C11", "P1P"}, {"C12", "P1S"},
+        {"N1", "A1 mini"}, {"N2S", "A1"},
+        {"O1D", "H2D"},
+    };
+    for (const auto &m : models) {
+        if (code == m.code) return m.name;
+    }
+    return code.empty() ? "Unknown" : code;
+}
+
+bool SsdpListener::parse(const char *data, size_t len, PrinterDiscovery::PrinterInfo &info,
+                         int *max_age_s, bool *byebye) {
+    std::string msg(data, strnlen(data, len));
+    *max_age_s = 0;
+    *byebye = false;
+    if (msg.compare(0, 6, "NOTIFY") != 0 && msg.compare(0, 12, "HTTP/1.1 200") != 0) {
+        return false;
+    }
+
+    bool is_printer = false;
+    std::string model_code;
+    size_t pos = msg.find('\n');
+    while (pos != std::string::npos && pos + 1 < msg.size()) {
+        size_t end = msg.find('\n', pos + 1);
+        std::string line = msg.substr(pos + 1, end == std::string::npos ? std::string::npos : end - pos - 1);
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        pos = end;
+
+        const char *v;
+        if ((v = header_value(line, "NT")) || (v = header_value(line, "ST"))) {
+            is_printer = strstr(v, "bambulab-com:device:3dprinter") != nullptr;
+        } else if ((v = header_value(line, "NTS"))) {
+            *byebye = strcasecmp(v, "ssdp:byebye") == 0;
+        } else if ((v = header_value(line, "USN"))) {
+            info.serial = v;
+        } else if ((v = header_value(line, "Location"))) {
+            info.ip_address = location_host(v);
+        } else if ((v = header_value(line, "Cache-Control"))) {
+            const char *age = strcasestr(v, "max-age=");
+            if (age) *max_age_s = atoi(age + 8);
+        } else if ((v = header_value(line, "DevModel.bambu.com"))) {
+            model_code = v;
+        } else if ((v = header_value(line, "DevName.bambu.com"))) {
+            info.hostname = v;
+        }
+    }
+
+    if (!is_printer || info.serial.empty()) return false;
+    info.model = model_name(model_code);
+    if (info.hostname.empty()) {
+        info.hostname = model_code.empty() ? "Bambu Lab Printer" : "Bambu Lab " + info.model;
+    }
+    return true;
+}
+
+bool SsdpListener::handle_datagram(const char *data, size_t len, const char *src_ip) {
+    PrinterDiscovery::PrinterInfo info;
+    int max_age_s;
+    bool byebye;
+    if (!parse(data, len, info, &max_age_s, &byebye)) return false;
+    if (info.ip_address.empty() && src_ip) info.ip_address = src_ip;
+
+    int ttl_s = (max_age_s > 0) ? std::min(max_age_s, SSDP_TTL_S) : SSDP_TTL_S;
+    int64_t now_us = esp_timer_get_time();
+
+    std::lock_guard<std::mutex> lock(s_table_mutex);
+    auto it = std::find_if(s_table.begin(), s_table.end(),
+                           [&info](const SeenPrinter &p) { return p.info.serial == info.serial; });
+    if (byebye) {
+        if (it != s_table.end()) {
+            ESP_LOGI(TAG, "%s (%s) left", info.serial.c_str(), it->info.ip_address.c_str());
+            s_table.erase(it);
+        }
+        return true;
+    }
+
+    if (it == s_table.end()) {
+        if (s_table.size() >= SSDP_MAX_PRINTERS) {
+            // Replace the printer heard from least recently
+            it = std::min_element(s_table.begin(), s_table.end(),
+                                  [](const SeenPrinter &a, const SeenPrinter &b) { return a.info.last_seen_us < b.info.last_seen_us; });
+        } else {
+            it = s_table.insert(s_table.end(), SeenPrinter());
+        }
+        ESP_LOGI(TAG, "✓ %s %s (%s) at %s", info.model.c_str(), info.hostname.c_str(),
+                 info.serial.c_str(), info.ip_address.c_str());
+    } else if (it->info.ip_address != info.ip_address) {
+        ESP_LOGI(TAG, "%s moved to %s", info.serial.c_str(), info.ip_address.c_str());
+    }
+    it->info = info;
+    it->info.source = "ssdp";
+    it->info.last_seen_us = now_us;
+    it->expires_us = now_us + (int64_t)ttl_s * 1000000;
+    return true;
+}
+
+std::vector<PrinterDiscovery::PrinterInfo> SsdpListener::printers() {
+    std::vector<PrinterDiscovery::PrinterInfo> result;
+    int64_t now_us = esp_timer_get_time();
+
+    std::lock_guard<std::mutex> lock(s_table_mutex);
+    s_table.erase(std::remove_if(s_table.begin(), s_table.end(),
+                                 [now_us](const SeenPrinter &p) { return p.expires_us <= now_us; }),
+                  s_table.end());
+    std::vector<const SeenPrinter *> sorted;
+    for (const auto &p : s_table) sorted.push_back(&p);
+    std::sort(sorted.begin(), sorted.end(),
+              [](const SeenPrinter *a, const SeenPrinter *b) { return a->info.last_seen_us > b->info.last_seen_us; });
+    for (const SeenPrinter *p : sorted) result.push_back(p->info);
+    return result;
+}
+
+void SsdpListener::listener_task(void *pvParameter) {
+    (void)pvParameter;
+    int sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (sock < 0) {
+        ESP_LOGE(TAG, "Failed to create socket: %d", errno);
+        s_task = nullptr;
+        vTaskDelete(NULL);
+        return;
+    }
+
+    int reuse = 1;
+    setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(SSDP_PORT);
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        ESP_LOGE(TAG, "Failed to bind UDP %d: %d", SSDP_PORT, errno);
+        close(sock);
+        s_task = nullptr;
+        vTaskDelete(NULL);
+        return;
+    }
+
+    // Most printers broadcast; some firmware only sends to the SSDP group
+    struct ip_mreq mreq = {};
+    inet_pton(AF_INET, SSDP_MULTICAST_ADDR, &mreq.imr_multiaddr);
+    mreq.imr_interface.s_addr = htonl(INADDR_ANY);
+    if (setsockopt(sock, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) < 0) {
+        ESP_LOGW(TAG, "Could not join " SSDP_MULTICAST_ADDR ", broadcasts only");
+    }
+
+    ESP_LOGI(TAG, "Listening for printer announcements on UDP %d", SSDP_PORT);
+
+    char buf[SSDP_BUFFER_SIZE];
+    while (true) {
+        struct sockaddr_in src = {};
+        socklen_t src_len = sizeof(src);
+        int len = recvfrom(sock, buf, sizeof(buf) - 1, 0, (struct sockaddr *)&src, &src_len);
+        if (len < 0) {
+            ESP_LOGW(TAG, "recvfrom failed: %d", errno);
+            vTaskDelay(pdMS_TO_TICKS(1000));
+            continue;
+        }
+        buf[len] = '\0';
+        char src_ip[INET_ADDRSTRLEN];
+        inet_ntop(AF_INET, &src.sin_addr, src_ip, sizeof(src_ip));
+        handle_datagram(buf, len, src_ip);
+    }
+}
+
+esp_err_t SsdpListener::start() {
+    if (s_task) return ESP_OK;
+    if (xTaskCreate(listener_task, "ssdp_listener", 4096, NULL, 2, &s_task) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create listener task");
+        s_task = nullptr;
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,185 @@
+/*
+ * Subnet Scanner Implementation
+ *
+ * Keeps up to `window` sockets connecting at once. Every socket is
+ * non-blocking; one select() waits for any of them to become writable
+ * (connected or refused) or for the earliest deadline. Finished sockets are
+ * closed and their slots refilled straight away, so a /24 costs roughly
+ * (hosts / window) * timeout instead of hosts * timeout.
+ */
+
+#include "SubnetScanner.hpp"
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <lwip/sockets.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <unistd.h>
+#include <algorithm>
+
+const char* SubnetScanner::TAG = "SubnetScanner";
+
+// Sockets left for the rest of the firmware: httpd (max_open_sockets 7 + 3
+// internal), the MQTT clients and the SSDP listener
+#define SCAN_RESERVED_SOCKETS 14
+
+// socket() failures tolerated with nothing in flight before giving up
+#define SCAN_MAX_SOCKET_RETRIES 20
+
+int SubnetScanner::max_window() {
+#ifdef CONFIG_LWIP_MAX_SOCKETS
+    return std::max(1, CONFIG_LWIP_MAX_SOCKETS - SCAN_RESERVED_SOCKETS);
+#else
+    return 32;
+#endif
+}
+
+namespace {
+
+struct Probe {
+    int sock;
+    int index;
+    int64_t deadline_us;
+};
+
+// Start a non-blocking connect; returns the socket, or -1 with *done set when
+// the attempt finished at once (*found tells how)
+int start_connect(const std::string &ip, int port, bool *done, bool *found) {
+    *done = false;
+    *found = false;
+
+    struct sockaddr_in dest_addr = {};
+    dest_addr.sin_family = AF_INET;
+    dest_addr.sin_port = htons(port);
+    if (inet_pton(AF_INET, ip.c_str(), &dest_addr.sin_addr) != 1) {
+        *done = true;
+        return -1;
+    }
+
+    int sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (sock < 0) return -1;                // Out of sockets, caller retries
+    int flags = fcntl(sock, F_GETFL, 0);
+    fcntl(sock, F_SETFL, flags | O_NONBLOCK);
+
+    if (connect(sock, (struct sockaddr *)&dest_addr, sizeof(dest_addr)) == 0) {
+        *done = true;
+        *found = true;
+    } else if (errno != EINPROGRESS) {
+        *done = true;                       // Refused/unreachable immediately
+    }
+    if (*done) {
+        close(sock);
+        return -1;
+    }
+    return sock;
+}
+
+} // namespace
+
+std::vector<std::string> SubnetScanner::scan(const std::vector<std::string> &ips, const Options &opt,
+                                             FoundCallback found_cb, ScanProgressCallback progress_cb) {
+    std::vector<std::string> found;
+    const int total = ips.size();
+    int window = std::max(1, std::min(opt.window, max_window()));
+    const int64_t timeout_us = (int64_t)opt.timeout_ms * 1000;
+
+    std::vector<Probe> inflight;
+    inflight.reserve(window);
+    int next = 0;
+    int finished = 0;
+    int reported = -1;
+    int socket_retries = 0;
+    const int64_t start_us = esp_timer_get_time();
+
+    ESP_LOGI(TAG, "Probing %d hosts on port %d, %d in flight, %d ms timeout",
+             total, opt.port, window, opt.timeout_ms);
+
+    auto retire = [&](int index, bool ok) {
+        finished++;
+        if (ok) {
+            found.push_back(ips[index]);
+            ESP_LOGI(TAG, "✓ %s:%d open", ips[index].c_str(), opt.port);
+            if (found_cb) found_cb(ips[index]);
+        }
+    };
+
+    while (finished < total) {
+        // Top up the window
+        while ((int)inflight.size() < window && next < total) {
+            bool done, ok;
+            int sock = start_connect(ips[next], opt.port, &done, &ok);
+            if (sock >= 0) {
+                inflight.push_back({sock, next, esp_timer_get_time() + timeout_us});
+                next++;
+            } else if (done) {
+                retire(next, ok);
+                next++;
+            } else {
+                // socket() failed: something else holds sockets, run with fewer
+                if (!inflight.empty()) {
+                    window = inflight.size();
+                    ESP_LOGW(TAG, "Out of sockets, window reduced to %d", window);
+                } else if (++socket_retries > SCAN_MAX_SOCKET_RETRIES) {
+                    ESP_LOGE(TAG, "No sockets available, %d hosts not probed", total - next);
+                    finished += total - next;
+                    next = total;
+                } else {
+                    usleep(50 * 1000);
+                }
+                break;
+            }
+        }
+
+        if (!inflight.empty()) {
+            fd_set writefds;
+            FD_ZERO(&writefds);
+            int maxfd = -1;
+            int64_t wake_us = inflight[0].deadline_us;
+            for (const Probe &p : inflight) {
+                FD_SET(p.sock, &writefds);
+                maxfd = std::max(maxfd, p.sock);
+                wake_us = std::min(wake_us, p.deadline_us);
+            }
+
+            int64_t wait_us = std::max<int64_t>(0, wake_us - esp_timer_get_time());
+            struct timeval tv;
+            tv.tv_sec = wait_us / 1000000;
+            tv.tv_usec = wait_us % 1000000;
+            int n = select(maxfd + 1, NULL, &writefds, NULL, &tv);
+            if (n < 0 && errno != EINTR) {
+                ESP_LOGE(TAG, "select() failed: %d", errno);
+                FD_ZERO(&writefds);
+            }
+
+            // Retire completions and expired probes, keep the rest in order
+            const int64_t now_us = esp_timer_get_time();
+            size_t keep = 0;
+            for (size_t i = 0; i < inflight.size(); i++) {
+                Probe &p = inflight[i];
+                if (n > 0 && FD_ISSET(p.sock, &writefds)) {
+                    int conn_err = 0;
+                    socklen_t len = sizeof(conn_err);
+                    getsockopt(p.sock, SOL_SOCKET, SO_ERROR, &conn_err, &len);
+                    close(p.sock);
+                    retire(p.index, conn_err == 0);
+                } else if (now_us >= p.deadline_us) {
+                    close(p.sock);
+                    retire(p.index, false);
+                } else {
+                    inflight[keep++] = p;
+                }
+            }
+            inflight.resize(keep);
+        }
+
+        if (progress_cb && finished != reported) {
+            reported = finished;
+            progress_cb(finished, total);
+        }
+    }
+
+    ESP_LOGI(TAG, "Probed %d hosts in %lld ms, %d open", total,
+             (long long)((esp_timer_get_time() - start_us) / 1000), (int)found.size());
+    return found;
+}
@@ -0,0 +1,56 @@
+/*
+ * CBOR Writer
+ * Same interface as JsonWriter but emits CBOR (RFC 8949), for pollers that
+ * would rather not parse text. Sent in chunks from a fixed buffer.
+ */
+
+#ifndef CBOR_WRITER_HPP
+#define CBOR_WRITER_HPP
+
+#include <esp_http_server.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define CBOR_WRITER_CHUNK       512
+
+class CborWriter {
+public:
+    /**
+     * Start a CBOR response (sets the content type); the caller opens the root
+     */
+    explicit CborWriter(httpd_req_t *req);
+
+    // Containers (indefinite length); pass a key inside maps, nullptr at the root or in arrays
+    CborWriter &begin_object(const char *key = nullptr);
+    CborWriter &end_object();
+    CborWriter &begin_array(const char *key = nullptr);
+    CborWriter &end_array();
+
+    // Values; key as above
+    CborWriter &str(const char *key, const char *value);
+    CborWriter &integer(const char *key, int64_t value);
+    CborWriter &number(const char *key, double value);
+    CborWriter &boolean(const char *key, bool value);
+    CborWriter &null(const char *key);
+
+    /**
+     * Flush the buffer and end the chunked response
+     * @return first send error, if any
+     */
+    esp_err_t finish();
+
+private:
+    httpd_req_t *req;
+    uint8_t buf[CBOR_WRITER_CHUNK];
+    size_t len;
+    esp_err_t err;
+
+    void flush();
+    void put(const void *data, size_t n);
+    void put(uint8_t b);
+    void head(uint8_t major, uint64_t value);
+    void text(const char *s);
+    void key(const char *k);
+};
+
+#endif // CBOR_WRITER_HPP
@@ -0,0 +1,48 @@
+/*
+ * Event Stream
+ * Server-Sent Events at /api/events: printer state, progress and
+ * temperatures from BambuMonitor, discovery progress and OTA progress are
+ * pushed to subscribed browsers as they change instead of being polled
+ */
+
+#ifndef EVENT_STREAM_HPP
+#define EVENT_STREAM_HPP
+
+#include "FleetState.hpp"
+#include <esp_http_server.h>
+#include <esp_event.h>
+
+class EventStream {
+public:
+    /**
+     * Start the sender task and subscribe to OTA events (once)
+     */
+    static esp_err_t start();
+
+    /**
+     * GET /api/events: keep the connection open as an event stream
+     * (503 when all subscriber slots are taken)
+     */
+    static esp_err_t handle_subscribe(httpd_req_t *req);
+
+    /**
+     * Discovery progress, from the discovery task
+     * @param found: Printers known so far
+     */
+    static void publish_discovery(bool in_progress, int progress, int found);
+
+    /**
+     * FleetState listener: publish a printer's state, progress and temps
+     */
+    static void printer_changed(int index, const FleetState::Printer &printer);
+
+    static int subscriber_count();
+
+private:
+    static const char *TAG;
+    static void publish(int topic, const char *payload);
+    static void sender_task(void *pvParameter);
+    static void on_tux_event(void *arg, esp_event_base_t base, int32_t event_id, void *event_data);
+};
+
+#endif // EVENT_STREAM_HPP
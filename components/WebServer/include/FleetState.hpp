@@ -0,0 +1,55 @@
+/*
+ * Fleet State
+ * Typed live state of every monitored printer, merged from BambuMonitor's
+ * (often partial) reports, with a sequence number that changes whenever
+ * any printer's state does
+ */
+
+#ifndef FLEET_STATE_HPP
+#define FLEET_STATE_HPP
+
+#include "BambuMonitor.hpp"
+#include <esp_err.h>
+#include <stdint.h>
+
+class FleetState {
+public:
+    // Unknown values are -1 (numbers) or "" (state)
+    struct Printer {
+        bool connected = false;
+        char state[16] = "";
+        int percent = -1;
+        int remaining_min = -1;
+        int layer = -1;
+        int total_layers = -1;
+        int nozzle = -1;            // Temperatures in whole degrees C
+        int nozzle_target = -1;
+        int bed = -1;
+        int bed_target = -1;
+        // Details kept for /api/printer/query; changes to these alone do not
+        // change the sequence number or call the listener
+        int ams_status = -1;
+        int ams_rfid_status = -1;
+        int print_error = -1;
+        char wifi_signal[12] = "";
+    };
+
+    typedef void (*listener_fn)(int index, const Printer &printer);
+
+    /**
+     * Follow BambuMonitor events (once)
+     * @param on_change: Called with a printer's new state when it changes
+     */
+    static esp_err_t start(listener_fn on_change);
+
+    /**
+     * Copy of every printer slot
+     * @return Sequence number of this state
+     */
+    static uint32_t snapshot(Printer out[BAMBU_MAX_PRINTERS]);
+
+private:
+    static void on_bambu_event(void *arg, esp_event_base_t base, int32_t event_id, void *event_data);
+};
+
+#endif // FLEET_STATE_HPP
@@ -0,0 +1,67 @@
+/*
+ * HTTP Routes
+ * Registers URI handlers through one dispatcher that times every request and
+ * hands slow routes to a small worker pool (httpd_req_async_handler_begin),
+ * so the httpd task keeps serving pages and status polls meanwhile
+ */
+
+#ifndef HTTP_ROUTES_HPP
+#define HTTP_ROUTES_HPP
+
+#include <esp_http_server.h>
+#include <string>
+
+// Latency histogram: bucket 0 < 1 ms, bucket i in [2^(i-1), 2^i) ms, last one open-ended
+#define HTTP_ROUTE_BUCKETS  18
+
+class HttpRoutes {
+public:
+    typedef esp_err_t (*handler_fn)(httpd_req_t *req);
+
+    enum Mode { SYNC, ASYNC };
+
+    struct Route {
+        const char *uri;
+        httpd_method_t method;
+        handler_fn handler;
+        Mode mode;
+        int max_inflight;           // ASYNC: running + queued before 503
+        int timeout_ms;             // ASYNC: bound from arrival; a job still queued then is dropped, a
+                                    // running handler bounds its waits with remaining_ms()
+        const char *group;          // ASYNC: routes naming the same group share the first one's
+                                    // max_inflight (handlers that must not overlap), or nullptr
+    };
+
+    struct Entry;                   // Registered route with its statistics
+
+    /**
+     * Start the worker tasks (once)
+     */
+    static esp_err_t start_workers();
+
+    /**
+     * Register routes with the server (copied, so the array may be temporary)
+     */
+    static esp_err_t register_routes(httpd_handle_t server, const Route *routes, size_t count);
+
+    /**
+     * Time a handler may still block, for the waits it does itself
+     * @param wanted_ms: the handler's own limit
+     * @return wanted_ms, cut to what is left of the route's timeout_ms when a
+     *         worker runs the request (0 if it has run out)
+     */
+    static int remaining_ms(httpd_req_t *req, int wanted_ms);
+
+    /**
+     * Per-route request counts and latency percentiles as JSON
+     */
+    static std::string stats_json();
+
+private:
+    static const char *TAG;
+    static esp_err_t dispatch(httpd_req_t *req);
+    static void worker_task(void *pvParameter);
+    static void record(Entry *entry, int64_t elapsed_us);
+};
+
+#endif // HTTP_ROUTES_HPP
@@ -0,0 +1,60 @@
+/*
+ * JSON Writer
+ * Serialises a JSON response straight into a fixed buffer that is sent with
+ * httpd_resp_send_chunk() whenever it fills, so a response costs the same
+ * RAM however long it gets (no cJSON tree, no printed copy)
+ */
+
+#ifndef JSON_WRITER_HPP
+#define JSON_WRITER_HPP
+
+#include <esp_http_server.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define JSON_WRITER_CHUNK       512
+#define JSON_WRITER_MAX_DEPTH   16      // Deeper nesting fails with ESP_ERR_INVALID_SIZE
+
+class JsonWriter {
+public:
+    /**
+     * Start a JSON response (sets the content type); the caller opens the root
+     */
+    explicit JsonWriter(httpd_req_t *req);
+
+    // Containers; pass a key inside objects, nullptr at the root or in arrays
+    JsonWriter &begin_object(const char *key = nullptr);
+    JsonWriter &end_object();
+    JsonWriter &begin_array(const char *key = nullptr);
+    JsonWriter &end_array();
+
+    // Values; key as above
+    JsonWriter &str(const char *key, const char *value);
+    JsonWriter &integer(const char *key, int64_t value);
+    JsonWriter &number(const char *key, double value);
+    JsonWriter &boolean(const char *key, bool value);
+    JsonWriter &null(const char *key);
+
+    /**
+     * Flush the buffer and end the chunked response
+     * @return first send error, or ESP_ERR_INVALID_SIZE if nested too deep
+     */
+    esp_err_t finish();
+
+private:
+    httpd_req_t *req;
+    char buf[JSON_WRITER_CHUNK];
+    size_t len;
+    int depth;
+    uint32_t has_items;         // Bit per depth: container already has a member
+    esp_err_t err;
+
+    void flush();
+    void put(const char *data, size_t n);
+    void put(char c);
+    void put_string(const char *s);
+    void member(const char *key);
+    void open();
+};
+
+#endif // JSON_WRITER_HPP
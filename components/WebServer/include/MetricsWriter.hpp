@@ -0,0 +1,61 @@
+/*
+ * Metrics Writer
+ * Prometheus text exposition format (version 0.0.4), written into a fixed
+ * buffer that is sent with httpd_resp_send_chunk() whenever it fills. The
+ * caller copies its counters and streams them out; nothing is allocated.
+ */
+
+#ifndef METRICS_WRITER_HPP
+#define METRICS_WRITER_HPP
+
+#include <esp_http_server.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define METRICS_WRITER_CHUNK    512
+
+class MetricsWriter {
+public:
+    /**
+     * Start a metrics response (sets the content type)
+     */
+    explicit MetricsWriter(httpd_req_t *req);
+
+    /**
+     * HELP and TYPE lines; call once before the family's samples
+     * @param type: "counter", "gauge", "summary" or "histogram"
+     */
+    MetricsWriter &family(const char *name, const char *type, const char *help);
+
+    /**
+     * One sample line, with up to two labels (pass nullptr for unused ones);
+     * label values are escaped
+     */
+    MetricsWriter &integer(const char *name, int64_t value,
+                           const char *k1 = nullptr, const char *v1 = nullptr,
+                           const char *k2 = nullptr, const char *v2 = nullptr);
+    MetricsWriter &number(const char *name, double value,
+                          const char *k1 = nullptr, const char *v1 = nullptr,
+                          const char *k2 = nullptr, const char *v2 = nullptr);
+
+    /**
+     * Flush the buffer and end the chunked response
+     * @return first send error, if any
+     */
+    esp_err_t finish();
+
+private:
+    httpd_req_t *req;
+    char buf[METRICS_WRITER_CHUNK];
+    size_t len;
+    esp_err_t err;
+
+    void flush();
+    void put(const char *data, size_t n);
+    void put(const char *s);
+    void put(char c);
+    void label(bool first, const char *key, const char *value);
+    void series(const char *name, const char *k1, const char *v1, const char *k2, const char *v2);
+};
+
+#endif // METRICS_WRITER_HPP
@@ -1,6 +1,6 @@
 /*
  * Printer Discovery Helper
- * Detects Bambu Lab printers on the network using mDNS
+ * Detects Bambu Lab printers on the network using SSDP, mDNS and IP scans
  */
 
 #ifndef PRINTER_DISCOVERY_HPP
@@ -8,6 +8,7 @@
 
 #include <vector>
 #include <string>
+#include <stdint.h>
 #include <esp_log.h>
 #include <functional>
 
@@ -27,6 +28,9 @@ public:
         std::string hostname;
         std::string ip_address;
         std::string model;  // e.g., "X1", "P1P", etc.
+        std::string serial; // From the SSDP announcement, empty when unknown
+        std::string source; // "ssdp", "mdns" or "scan"
+        int64_t last_seen_us = 0;   // esp_timer time the printer last answered
     };
     
     struct PrinterStatus {
@@ -56,7 +60,8 @@ public:
     
     /**
      * Discover Bambu Lab printers on the network
-     * Uses mDNS first, then falls back to IP scanning on configured networks
+     * Starts from the printers announced over SSDP, then adds mDNS results
+     * and IP scans of the configured networks
      * 
      * @param timeout_ms: How long to search (default 4000ms)
      * @param progress_cb: Optional callback for progress updates (current, total)
@@ -64,6 +69,18 @@ public:
      */
     std::vector<PrinterInfo> discover(int timeout_ms = 4000, ProgressCallback progress_cb = nullptr);
     
+    /**
+     * Printers known from earlier discoveries plus current SSDP announcements,
+     * most recently seen first. Kept across discovery runs; an entry is dropped
+     * when a complete run no longer finds it.
+     */
+    static std::vector<PrinterInfo> known_printers();
+    
+    /**
+     * Add or refresh a printer in the known table (keyed by serial, else IP)
+     */
+    static void remember(const PrinterInfo &info);
+    
     /**
      * Scan specific subnet for printers via HTTP probing
      * @param subnet: CIDR notation (e.g., "192.168.1.0/24")
@@ -97,7 +114,7 @@ public:
      * Connects to printer MQTT broker and retrieves current status
      * @param ip: Printer IP address
      * @param access_code: Printer access code (MQTT password)
-     * @param timeout_ms: Connection timeout in milliseconds
+     * @param timeout_ms: Longest the call blocks, waiting for the query slot included
      * @return PrinterStatus with retrieved data or empty on error
      */
     static PrinterStatus query_printer_status(const std::string &ip, const std::string &access_code, int timeout_ms = 5000);
@@ -121,6 +138,17 @@ private:
      * @return Vector of IP addresses to scan
      */
     std::vector<std::string> parse_subnet_ips(const std::string &subnet, int max_ips = 50);
+    
+    /**
+     * Reorder scan targets: known printers, then their neighbouring hosts,
+     * then the rest in the original order
+     */
+    static void prioritize_ips(std::vector<std::string> &ips);
+    
+    /**
+     * Drop known printers not seen since a discovery run started
+     */
+    static void forget_older_than(int64_t run_start_us);
 };
 
 #endif // PRINTER_DISCOVERY_HPP
@@ -0,0 +1,53 @@
+/*
+ * SSDP Listener
+ * Collects the NOTIFY announcements Bambu Lab printers broadcast on UDP 2021
+ * into a table of printers seen recently
+ */
+
+#ifndef SSDP_LISTENER_HPP
+#define SSDP_LISTENER_HPP
+
+#include "PrinterDiscovery.hpp"
+#include <esp_err.h>
+#include <vector>
+#include <string>
+
+class SsdpListener {
+public:
+    /**
+     * Start the background listener task (once; later calls do nothing)
+     */
+    static esp_err_t start();
+
+    /**
+     * Printers announced within their TTL, most recently seen first
+     */
+    static std::vector<PrinterDiscovery::PrinterInfo> printers();
+
+    /**
+     * Parse one datagram and update the table
+     * @param src_ip: Sender address, used when the announcement has no Location
+     * @return true if it was a Bambu printer announcement
+     */
+    static bool handle_datagram(const char *data, size_t len, const char *src_ip);
+
+    /**
+     * Parse a NOTIFY (or M-SEARCH response) from a Bambu printer
+     * @param max_age_s: Cache-Control max-age, 0 if absent
+     * @param byebye: Set for ssdp:byebye (printer leaving)
+     * @return false if the datagram is not a Bambu printer announcement
+     */
+    static bool parse(const char *data, size_t len, PrinterDiscovery::PrinterInfo &info,
+                      int *max_age_s, bool *byebye);
+
+    /**
+     * Product name for a DevModel code ("C12" -> "P1S"); unknown codes are returned as is
+     */
+    static std::string model_name(const std::string &code);
+
+private:
+    static const char *TAG;
+    static void listener_task(void *pvParameter);
+};
+
+#endif // SSDP_LISTENER_HPP
@@ -0,0 +1,46 @@
+/*
+ * Subnet Scanner
+ * Probes a list of IPv4 hosts for an open TCP port with a window of
+ * non-blocking connect()s in flight, all waited on by one select()
+ */
+
+#ifndef SUBNET_SCANNER_HPP
+#define SUBNET_SCANNER_HPP
+
+#include <vector>
+#include <string>
+#include <functional>
+
+class SubnetScanner {
+public:
+    struct Options {
+        int port = 8883;            // Bambu MQTT (TLS)
+        int timeout_ms = 500;       // Per host, from its connect()
+        int window = 16;            // Connects in flight; capped by max_window()
+    };
+
+    // Host answered on the port: (ip_address) -> void
+    typedef std::function<void(const std::string&)> FoundCallback;
+    // Hosts finished so far: (done, total) -> void
+    typedef std::function<void(int, int)> ScanProgressCallback;
+
+    /**
+     * Probe all hosts and return the ones that accepted a connection
+     * Hosts are reported through found_cb as they answer, not in list order.
+     * progress_cb is called whenever the finished count changes.
+     */
+    static std::vector<std::string> scan(const std::vector<std::string> &ips, const Options &opt,
+                                         FoundCallback found_cb = nullptr,
+                                         ScanProgressCallback progress_cb = nullptr);
+
+    /**
+     * Most sockets a scan may hold at once: the lwIP socket limit minus what
+     * the web server and the MQTT clients need
+     */
+    static int max_window();
+
+private:
+    static const char *TAG;
+};
+
+#endif // SUBNET_SCANNER_HPP
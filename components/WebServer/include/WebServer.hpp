@@ -26,6 +26,9 @@ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
 #include <vector>
 #include <string>
 
+class JsonWriter;
+class MetricsWriter;
+
 class WebServer {
 public:
     WebServer();
@@ -34,18 +37,35 @@ public:
     esp_err_t start();
     esp_err_t stop();
     bool is_running();
+
+    // Performance data from the UI profiler, served at /api/perf (set by main)
+    typedef std::string (*perf_json_fn_t)();
+    typedef void (*perf_control_fn_t)(int hud, bool reset);  // hud: 1 show, 0 hide, -1 unchanged
+    static void set_perf_hooks(perf_json_fn_t json_fn, perf_control_fn_t control_fn);
+    // Scripted UI benchmark, served at /api/perf/bench (set by main)
+    typedef std::string (*perf_bench_fn_t)(int slides, bool png);
+    static void set_perf_bench_hook(perf_bench_fn_t bench_fn);
+    // Application metrics (storage, LVGL) appended to /metrics (set by main)
+    typedef void (*metrics_fn_t)(MetricsWriter &out);
+    static void set_metrics_hook(metrics_fn_t metrics_fn);
     
 private:
     httpd_handle_t server;
     
     // Discovery state management
-    static std::vector<std::string> g_discovered_ips;
-    static bool g_discovery_in_progress;
-    static int g_discovery_progress;
+    static volatile bool g_discovery_in_progress;
+    static volatile int g_discovery_progress;
+    static int64_t g_discovery_finished_us;
     static TaskHandle_t g_discovery_task;
+
+    static perf_json_fn_t g_perf_json;
+    static perf_control_fn_t g_perf_control;
+    static perf_bench_fn_t g_perf_bench;
+    static metrics_fn_t g_metrics;
     
     // Background discovery task
     static void discovery_task_handler(void *pvParameter);
+    static int write_discovered_printers(JsonWriter &json, const char *key);
     
     // Handler declarations
     static esp_err_t handle_root(httpd_req_t *req);
@@ -63,11 +83,16 @@ private:
     static esp_err_t handle_api_printers_discover_status(httpd_req_t *req);
     static esp_err_t handle_api_printer_info(httpd_req_t *req);
     static esp_err_t handle_api_printer_query(httpd_req_t *req);
+    static esp_err_t handle_api_fleet(httpd_req_t *req);
     static esp_err_t handle_api_test_connection(httpd_req_t *req);
     static esp_err_t handle_api_device_info(httpd_req_t *req);
     static esp_err_t handle_api_networks_get(httpd_req_t *req);
     static esp_err_t handle_api_networks_post(httpd_req_t *req);
     static esp_err_t handle_api_networks_delete(httpd_req_t *req);
+    static esp_err_t handle_api_perf(httpd_req_t *req);
+    static esp_err_t handle_api_perf_bench(httpd_req_t *req);
+    static esp_err_t handle_api_perf_http(httpd_req_t *req);
+    static esp_err_t handle_metrics(httpd_req_t *req);
 };
 
 extern WebServer *web_server;
@@ -0,0 +1,139 @@
+/*
+ * File cache replay (main/helpers/helper_lv_fs_cache.hpp)
+ *
+ * Puts the real block cache in front of an lv_fs driver over a host
+ * directory (F: and S: both map to ROOT) and replays a trace of LVGL file
+ * accesses through lv_fs: the FSTRACE lines of a device log captured with
+ * TUX_FS_CACHE_TRACE, or a trace written by scripts/fs_cache_bench.py.
+ * Every read is checked against the file contents.
+ *
+ * Prints one JSON object: the cache's /api/perf section, the reads LVGL
+ * made (each one a drive call without the cache) and the calls that
+ * reached the drive. The cache settings are the Kconfig defaults unless
+ * CONFIG_TUX_FS_CACHE_BLOCK_SIZE/_BLOCKS/_READAHEAD are defined;
+ * fs_cache_bench.py builds one replay per setting it compares.
+ *
+ * Usage: fs_cache_replay ROOT TRACE
+ * Exit status is 1 if a read returned wrong data.
+ */
+
+#include "helper_lv_fs_cache.hpp"
+#include "host_fs_dir.hpp"
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+static std::map<std::string, std::vector<uint8_t>> contents;
+
+static const std::vector<uint8_t> &file_contents(const std::string &root, const std::string &path)
+{
+    auto it = contents.find(path);
+    if (it != contents.end()) return it->second;
+    std::vector<uint8_t> &data = contents[path];
+    FILE *f = fopen((root + "/" + path).c_str(), "rb");
+    if (f) {
+        uint8_t buf[4096];
+        size_t n;
+        while ((n = fread(buf, 1, sizeof(buf), f)) > 0) data.insert(data.end(), buf, buf + n);
+        fclose(f);
+    }
+    return data;
+}
+
+struct ReplayFile {
+    lv_fs_file_t file;
+    std::string path;       // Without the drive letter
+};
+
+int main(int argc, char **argv)
+{
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s ROOT TRACE\n", argv[0]);
+        return 2;
+    }
+    const std::string root = argv[1];
+    FILE *trace = fopen(argv[2], "r");
+    if (!trace) {
+        perror(argv[2]);
+        return 2;
+    }
+
+    lv_fs_drv_t *drives[] = { host_fs_dir_register('F', root), host_fs_dir_register('S', root) };
+    if (lv_fs_cache_init() != ESP_OK) return 2;
+
+    std::map<std::string, ReplayFile> open_files;
+    std::vector<uint8_t> buf;
+    uint32_t lv_reads = 0, mismatches = 0, missing = 0;
+    uint64_t lv_bytes = 0;
+    char line[512];
+    while (fgets(line, sizeof(line), trace)) {
+        const char *rec = strstr(line, "FSTRACE ");
+        std::istringstream in(rec ? rec + 8 : line);
+        std::string op, id;
+        if (!(in >> op >> id)) continue;
+
+        if (op == "open") {
+            std::string path;
+            in >> path;
+            if (path.size() < 2 || path[1] != ':') path = "F:" + path;
+            ReplayFile &f = open_files[id];
+            f.path = path.substr(2);
+            if (lv_fs_open(&f.file, path.c_str(), LV_FS_MODE_RD) != LV_FS_RES_OK) {
+                missing++;
+                open_files.erase(id);
+            }
+        } else if (op == "read") {
+            uint32_t pos = 0, len = 0;
+            in >> pos >> len;
+            auto it = open_files.find(id);
+            if (it == open_files.end()) continue;
+            ReplayFile &f = it->second;
+            buf.resize(len);
+            uint32_t br = 0;
+            lv_fs_seek(&f.file, pos, LV_FS_SEEK_SET);
+            lv_fs_res_t res = lv_fs_read(&f.file, buf.data(), len, &br);
+            const std::vector<uint8_t> &ref = file_contents(root, f.path);
+            uint32_t expect = pos < ref.size() ? LV_MIN(len, (uint32_t)(ref.size() - pos)) : 0;
+            if (res != LV_FS_RES_OK || br != expect || (br && memcmp(buf.data(), ref.data() + pos, br) != 0)) {
+                fprintf(stderr, "%s: read at %u+%u returned %u bytes, wrong data\n", f.path.c_str(), pos, len, br);
+                mismatches++;
+            }
+            lv_reads++;
+            lv_bytes += br;
+        } else if (op == "close") {
+            auto it = open_files.find(id);
+            if (it == open_files.end()) continue;
+            lv_fs_close(&it->second.file);
+            open_files.erase(it);
+        }
+    }
+    fclose(trace);
+    for (auto &it : open_files) lv_fs_close(&it.second.file);
+
+    host_fs_dir_t drive = {};
+    for (lv_fs_drv_t *drv : drives) {
+        drive.opens += host_fs_dir(drv)->opens;
+        drive.reads += host_fs_dir(drv)->reads;
+        drive.seeks += host_fs_dir(drv)->seeks;
+        drive.bytes += host_fs_dir(drv)->bytes;
+    }
+
+    cJSON *out = cJSON_CreateObject();
+    lv_fs_cache_stats_json(out);
+    cJSON_AddNumberToObject(cJSON_GetObjectItem(out, "fs_cache"), "readahead_blocks", FS_CACHE_READAHEAD);
+    cJSON_AddNumberToObject(out, "lv_reads", lv_reads);
+    cJSON_AddNumberToObject(out, "lv_kb", (double)(lv_bytes / 1024));
+    cJSON_AddNumberToObject(out, "missing_files", missing);
+    cJSON_AddNumberToObject(out, "mismatches", mismatches);
+    cJSON *d = cJSON_AddObjectToObject(out, "drive");
+    cJSON_AddNumberToObject(d, "opens", drive.opens);
+    cJSON_AddNumberToObject(d, "reads", drive.reads);
+    cJSON_AddNumberToObject(d, "seeks", drive.seeks);
+    cJSON_AddNumberToObject(d, "kb", (double)(drive.bytes / 1024));
+    char *json = cJSON_PrintUnformatted(out);
+    printf("%s\n", json);
+    cJSON_free(json);
+    cJSON_Delete(out);
+    return mismatches ? 1 : 0;
+}
@@ -0,0 +1,30 @@
+/*
+ * Minimal check macros for the host tests: failures are printed and counted,
+ * the test keeps running, and host_check_result() gives the exit code
+ */
+
+#ifndef HOST_CHECK_HPP
+#define HOST_CHECK_HPP
+
+#include <stdio.h>
+
+static int host_check_failures = 0;
+
+#define CHECK(cond) do { \
+        if (!(cond)) { \
+            host_check_failures++; \
+            fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond); \
+        } \
+    } while (0)
+
+static inline int host_check_result(const char *name)
+{
+    if (host_check_failures) {
+        fprintf(stderr, "%s: %d check(s) failed\n", name, host_check_failures);
+        return 1;
+    }
+    printf("%s: ok\n", name);
+    return 0;
+}
+
+#endif // HOST_CHECK_HPP
@@ -0,0 +1,94 @@
+/*
+ * lv_fs driver over a host directory, for the host tests
+ *
+ * host_fs_dir_register('F', "/path/to/dir") makes "F:/bg/x.tlz" read
+ * dir/bg/x.tlz with stdio. Every driver call is counted so tests can see
+ * how many reads reach the "flash".
+ */
+
+#ifndef HOST_FS_DIR_HPP
+#define HOST_FS_DIR_HPP
+
+#include "lvgl/lvgl.h"
+#include <stdio.h>
+#include <string>
+
+typedef struct {
+    std::string root;
+    uint32_t opens;
+    uint32_t reads;
+    uint32_t seeks;
+    uint64_t bytes;
+} host_fs_dir_t;
+
+static void *host_fs_open(lv_fs_drv_t *drv, const char *path, lv_fs_mode_t mode)
+{
+    host_fs_dir_t *d = (host_fs_dir_t *)drv->user_data;
+    FILE *f = fopen((d->root + "/" + path).c_str(), (mode & LV_FS_MODE_WR) ? "r+b" : "rb");
+    if (f) d->opens++;
+    return f;
+}
+
+static lv_fs_res_t host_fs_close(lv_fs_drv_t *drv, void *file_p)
+{
+    LV_UNUSED(drv);
+    fclose((FILE *)file_p);
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t host_fs_read(lv_fs_drv_t *drv, void *file_p, void *buf, uint32_t btr, uint32_t *br)
+{
+    host_fs_dir_t *d = (host_fs_dir_t *)drv->user_data;
+    *br = (uint32_t)fread(buf, 1, btr, (FILE *)file_p);
+    d->reads++;
+    d->bytes += *br;
+    return ferror((FILE *)file_p) ? LV_FS_RES_FS_ERR : LV_FS_RES_OK;
+}
+
+static lv_fs_res_t host_fs_write(lv_fs_drv_t *drv, void *file_p, const void *buf, uint32_t btw, uint32_t *bw)
+{
+    LV_UNUSED(drv);
+    *bw = (uint32_t)fwrite(buf, 1, btw, (FILE *)file_p);
+    return *bw == btw ? LV_FS_RES_OK : LV_FS_RES_FS_ERR;
+}
+
+static lv_fs_res_t host_fs_seek(lv_fs_drv_t *drv, void *file_p, uint32_t pos, lv_fs_whence_t whence)
+{
+    host_fs_dir_t *d = (host_fs_dir_t *)drv->user_data;
+    d->seeks++;
+    int origin = whence == LV_FS_SEEK_SET ? SEEK_SET : whence == LV_FS_SEEK_CUR ? SEEK_CUR : SEEK_END;
+    long offset = whence == LV_FS_SEEK_SET ? (long)pos : (long)(int32_t)pos;
+    return fseek((FILE *)file_p, offset, origin) == 0 ? LV_FS_RES_OK : LV_FS_RES_FS_ERR;
+}
+
+static lv_fs_res_t host_fs_tell(lv_fs_drv_t *drv, void *file_p, uint32_t *pos_p)
+{
+    LV_UNUSED(drv);
+    *pos_p = (uint32_t)ftell((FILE *)file_p);
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_drv_t *host_fs_dir_register(char letter, const std::string &root)
+{
+    lv_fs_drv_t *drv = new lv_fs_drv_t;
+    host_fs_dir_t *d = new host_fs_dir_t();
+    d->root = root;
+    lv_fs_drv_init(drv);
+    drv->letter = letter;
+    drv->open_cb = host_fs_open;
+    drv->close_cb = host_fs_close;
+    drv->read_cb = host_fs_read;
+    drv->write_cb = host_fs_write;
+    drv->seek_cb = host_fs_seek;
+    drv->tell_cb = host_fs_tell;
+    drv->user_data = d;
+    lv_fs_drv_register(drv);
+    return drv;
+}
+
+static inline host_fs_dir_t *host_fs_dir(lv_fs_drv_t *drv)
+{
+    return (host_fs_dir_t *)drv->user_data;
+}
+
+#endif // HOST_FS_DIR_HPP
@@ -0,0 +1,324 @@
+/*
+ * Host stub: the part of the cJSON API the helpers use to build and print
+ * documents, and a plain parser for config files (no comments, \u escapes
+ * kept as-is). Layout and names follow cJSON so code that walks items
+ * directly compiles unchanged.
+ */
+
+#pragma once
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+#define cJSON_Invalid   0
+#define cJSON_False     (1 << 0)
+#define cJSON_True      (1 << 1)
+#define cJSON_NULL      (1 << 2)
+#define cJSON_Number    (1 << 3)
+#define cJSON_String    (1 << 4)
+#define cJSON_Array     (1 << 5)
+#define cJSON_Object    (1 << 6)
+
+typedef int cJSON_bool;
+
+typedef struct cJSON {
+    struct cJSON *next;
+    struct cJSON *prev;
+    struct cJSON *child;
+    int type;
+    char *valuestring;
+    int valueint;
+    double valuedouble;
+    char *string;
+} cJSON;
+
+static inline cJSON *cjson_stub_new(int type)
+{
+    cJSON *item = (cJSON *)calloc(1, sizeof(cJSON));
+    item->type = type;
+    return item;
+}
+
+static inline cJSON *cJSON_CreateObject(void) { return cjson_stub_new(cJSON_Object); }
+static inline cJSON *cJSON_CreateArray(void) { return cjson_stub_new(cJSON_Array); }
+static inline cJSON *cJSON_CreateNull(void) { return cjson_stub_new(cJSON_NULL); }
+static inline cJSON *cJSON_CreateBool(cJSON_bool b) { return cjson_stub_new(b ? cJSON_True : cJSON_False); }
+
+static inline cJSON *cJSON_CreateNumber(double num)
+{
+    cJSON *item = cjson_stub_new(cJSON_Number);
+    item->valuedouble = num;
+    item->valueint = num >= 2147483647.0 ? 2147483647 : num <= -2147483648.0 ? (-2147483647 - 1) : (int)num;
+    return item;
+}
+
+static inline cJSON *cJSON_CreateString(const char *s)
+{
+    cJSON *item = cjson_stub_new(cJSON_String);
+    item->valuestring = strdup(s);
+    return item;
+}
+
+static inline void cJSON_Delete(cJSON *item)
+{
+    while (item) {
+        cJSON *next = item->next;
+        cJSON_Delete(item->child);
+        free(item->valuestring);
+        free(item->string);
+        free(item);
+        item = next;
+    }
+}
+
+static inline cJSON_bool cJSON_AddItemToArray(cJSON *array, cJSON *item)
+{
+    if (!array || !item) return 0;
+    if (!array->child) {
+        array->child = item;
+        item->prev = item;      // cJSON keeps the last item in child->prev
+    } else {
+        cJSON *last = array->child->prev;
+        last->next = item;
+        item->prev = last;
+        array->child->prev = item;
+    }
+    return 1;
+}
+
+static inline cJSON_bool cJSON_AddItemToObject(cJSON *object, const char *name, cJSON *item)
+{
+    if (!item) return 0;
+    free(item->string);
+    item->string = strdup(name);
+    return cJSON_AddItemToArray(object, item);
+}
+
+static inline cJSON *cjson_stub_add(cJSON *object, const char *name, cJSON *item)
+{
+    if (!cJSON_AddItemToObject(object, name, item)) {
+        cJSON_Delete(item);
+        return NULL;
+    }
+    return item;
+}
+
+static inline cJSON *cJSON_AddObjectToObject(cJSON *o, const char *name) { return cjson_stub_add(o, name, cJSON_CreateObject()); }
+static inline cJSON *cJSON_AddArrayToObject(cJSON *o, const char *name) { return cjson_stub_add(o, name, cJSON_CreateArray()); }
+static inline cJSON *cJSON_AddNumberToObject(cJSON *o, const char *name, double n) { return cjson_stub_add(o, name, cJSON_CreateNumber(n)); }
+static inline cJSON *cJSON_AddStringToObject(cJSON *o, const char *name, const char *s) { return cjson_stub_add(o, name, cJSON_CreateString(s)); }
+static inline cJSON *cJSON_AddBoolToObject(cJSON *o, const char *name, cJSON_bool b) { return cjson_stub_add(o, name, cJSON_CreateBool(b)); }
+static inline cJSON *cJSON_AddNullToObject(cJSON *o, const char *name) { return cjson_stub_add(o, name, cJSON_CreateNull()); }
+
+static inline cJSON *cJSON_GetObjectItemCaseSensitive(const cJSON *object, const char *name)
+{
+    for (cJSON *c = object ? object->child : NULL; c; c = c->next) {
+        if (c->string && strcmp(c->string, name) == 0) return c;
+    }
+    return NULL;
+}
+
+#define cJSON_GetObjectItem(object, name) cJSON_GetObjectItemCaseSensitive(object, name)
+
+static inline int cJSON_GetArraySize(const cJSON *array)
+{
+    int n = 0;
+    for (cJSON *c = array ? array->child : NULL; c; c = c->next) n++;
+    return n;
+}
+
+static inline cJSON *cJSON_GetArrayItem(const cJSON *array, int index)
+{
+    cJSON *c = array ? array->child : NULL;
+    while (c && index-- > 0) c = c->next;
+    return c;
+}
+
+#define cJSON_ArrayForEach(element, array) \
+    for (element = (array) ? (array)->child : NULL; element; element = element->next)
+
+static inline char *cJSON_GetStringValue(const cJSON *item)
+{
+    return item && item->type == cJSON_String ? item->valuestring : NULL;
+}
+
+static inline cJSON_bool cJSON_IsNumber(const cJSON *item) { return item && item->type == cJSON_Number; }
+static inline cJSON_bool cJSON_IsString(const cJSON *item) { return item && item->type == cJSON_String; }
+static inline cJSON_bool cJSON_IsObject(const cJSON *item) { return item && item->type == cJSON_Object; }
+static inline cJSON_bool cJSON_IsArray(const cJSON *item) { return item && item->type == cJSON_Array; }
+static inline cJSON_bool cJSON_IsBool(const cJSON *item) { return item && (item->type & (cJSON_True | cJSON_False)); }
+static inline cJSON_bool cJSON_IsTrue(const cJSON *item) { return item && item->type == cJSON_True; }
+
+static inline void cjson_stub_print_string(std::string &out, const char *s)
+{
+    out += '"';
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\') {
+            out += '\\';
+            out += *s;
+        } else if ((unsigned char)*s < 0x20) {
+            char esc[8];
+            snprintf(esc, sizeof(esc), "\\u%04x", *s);
+            out += esc;
+        } else {
+            out += *s;
+        }
+    }
+    out += '"';
+}
+
+static inline void cjson_stub_print(std::string &out, const cJSON *item)
+{
+    char num[32];
+    switch (item->type) {
+        case cJSON_False: out += "false"; break;
+        case cJSON_True: out += "true"; break;
+        case cJSON_Number:
+            if (!isfinite(item->valuedouble)) out += "null";
+            else if (item->valuedouble == (double)item->valueint) {
+                snprintf(num, sizeof(num), "%d", item->valueint);
+                out += num;
+            } else {
+                snprintf(num, sizeof(num), "%.17g", item->valuedouble);
+                out += num;
+            }
+            break;
+        case cJSON_String: cjson_stub_print_string(out, item->valuestring); break;
+        case cJSON_Array:
+        case cJSON_Object: {
+            bool object = item->type == cJSON_Object;
+            out += object ? '{' : '[';
+            for (cJSON *c = item->child; c; c = c->next) {
+                if (c != item->child) out += ',';
+                if (object) {
+                    cjson_stub_print_string(out, c->string);
+                    out += ':';
+                }
+                cjson_stub_print(out, c);
+            }
+            out += object ? '}' : ']';
+            break;
+        }
+        default: out += "null"; break;
+    }
+}
+
+static inline char *cJSON_PrintUnformatted(const cJSON *item)
+{
+    std::string out;
+    cjson_stub_print(out, item);
+    return strdup(out.c_str());
+}
+
+// Documents are small here, so the pretty-printed form is the compact one
+static inline char *cJSON_Print(const cJSON *item)
+{
+    return cJSON_PrintUnformatted(item);
+}
+
+static inline const char *cjson_stub_skip(const char *p)
+{
+    while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') p++;
+    return p;
+}
+
+static inline const char *cjson_stub_parse_string(const char *p, char **out)
+{
+    std::string s;
+    for (p++; *p && *p != '"'; p++) {
+        if (*p == '\\') {
+            p++;
+            switch (*p) {
+                case 'n': s += '\n'; break;
+                case 't': s += '\t'; break;
+                case 'r': s += '\r'; break;
+                case 'b': s += '\b'; break;
+                case 'f': s += '\f'; break;
+                case 'u': s += "\\u"; break;
+                case '\0': return NULL;
+                default: s += *p; break;
+            }
+        } else {
+            s += *p;
+        }
+    }
+    if (*p != '"') return NULL;
+    *out = strdup(s.c_str());
+    return p + 1;
+}
+
+static inline const char *cjson_stub_parse_value(const char *p, cJSON **out, int depth)
+{
+    p = cjson_stub_skip(p);
+    if (depth > 32) return NULL;
+    if (*p == '{' || *p == '[') {
+        bool object = *p == '{';
+        cJSON *item = cjson_stub_new(object ? cJSON_Object : cJSON_Array);
+        p = cjson_stub_skip(p + 1);
+        if (*p == (object ? '}' : ']')) {
+            *out = item;
+            return p + 1;
+        }
+        while (p) {
+            char *name = NULL;
+            if (object) {
+                if (*p != '"' || !(p = cjson_stub_parse_string(p, &name))) break;
+                p = cjson_stub_skip(p);
+                if (*p != ':') { free(name); break; }
+                p++;
+            }
+            cJSON *child = NULL;
+            p = cjson_stub_parse_value(p, &child, depth + 1);
+            if (!p) { free(name); break; }
+            child->string = name;
+            cJSON_AddItemToArray(item, child);
+            p = cjson_stub_skip(p);
+            if (*p == ',') {
+                p = cjson_stub_skip(p + 1);
+                continue;
+            }
+            if (*p == (object ? '}' : ']')) {
+                *out = item;
+                return p + 1;
+            }
+            break;
+        }
+        cJSON_Delete(item);
+        return NULL;
+    }
+    if (*p == '"') {
+        cJSON *item = cjson_stub_new(cJSON_String);
+        p = cjson_stub_parse_string(p, &item->valuestring);
+        if (!p) { cJSON_Delete(item); return NULL; }
+        *out = item;
+        return p;
+    }
+    if (strncmp(p, "true", 4) == 0) { *out = cJSON_CreateBool(1); return p + 4; }
+    if (strncmp(p, "false", 5) == 0) { *out = cJSON_CreateBool(0); return p + 5; }
+    if (strncmp(p, "null", 4) == 0) { *out = cJSON_CreateNull(); return p + 4; }
+    char *end = NULL;
+    double num = strtod(p, &end);
+    if (end == p) return NULL;
+    *out = cJSON_CreateNumber(num);
+    return end;
+}
+
+static inline cJSON *cJSON_Parse(const char *value)
+{
+    cJSON *item = NULL;
+    const char *end = value ? cjson_stub_parse_value(value, &item, 0) : NULL;
+    if (!end) return NULL;
+    if (*cjson_stub_skip(end)) {
+        cJSON_Delete(item);
+        return NULL;
+    }
+    return item;
+}
+
+static inline void cJSON_free(void *p)
+{
+    free(p);
+}
@@ -0,0 +1,37 @@
+/*
+ * Host stub: capability allocations come from malloc; the test can make the
+ * SPIRAM capability fail to exercise the internal RAM fallback
+ */
+
+#pragma once
+
+#include <stdlib.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#define MALLOC_CAP_8BIT     (1 << 2)
+#define MALLOC_CAP_DMA      (1 << 3)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+
+static bool heap_caps_stub_no_psram = false;
+
+static inline void *heap_caps_malloc(size_t size, uint32_t caps)
+{
+    if ((caps & MALLOC_CAP_SPIRAM) && heap_caps_stub_no_psram) return NULL;
+    return malloc(size);
+}
+
+static inline void heap_caps_free(void *p)
+{
+    free(p);
+}
+
+static inline size_t heap_caps_get_free_size(uint32_t caps)
+{
+    return (caps & MALLOC_CAP_SPIRAM) && heap_caps_stub_no_psram ? 0 : 4 * 1024 * 1024;
+}
+
+// esp_system.h on the device, where the FreeRTOS headers pull it in
+static inline uint32_t esp_get_free_heap_size(void) { return (uint32_t)heap_caps_get_free_size(MALLOC_CAP_INTERNAL); }
+static inline uint32_t esp_get_minimum_free_heap_size(void) { return esp_get_free_heap_size(); }
@@ -0,0 +1,8 @@
+/*
+ * Host stub: nothing built on the host makes HTTP requests; this only lets
+ * the headers that include the client compile
+ */
+
+#pragma once
+
+#include "esp_err.h"
@@ -0,0 +1,145 @@
+/*
+ * Host stub: the response side of esp_http_server; a request collects what
+ * is sent to it so the response writers can be checked. URI registration and
+ * async requests are recorded for the dispatcher: an async copy hands its
+ * response back to the request it was detached from when it completes.
+ */
+
+#pragma once
+
+#include "esp_err.h"
+#include <stddef.h>
+#include <string.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+typedef enum {
+    HTTP_DELETE = 0,
+    HTTP_GET = 1,
+    HTTP_POST = 3,
+    HTTP_PUT = 4,
+} httpd_method_t;
+
+#define HTTPD_RESP_USE_STRLEN   -1
+
+typedef void *httpd_handle_t;
+
+typedef struct httpd_req {
+    std::string type;
+    std::string body;
+    int chunks = 0;
+    bool ended = false;         // Zero-length chunk sent
+    esp_err_t fail_at = ESP_OK; // Returned by every send once set
+    void *user_ctx = nullptr;
+    std::string status = "200 OK";
+    std::vector<std::pair<std::string, std::string>> headers;
+    struct httpd_req *origin = nullptr;     // Async copy: the request it was detached from
+    bool completed = false;                 // Async copy completed; under httpd_stub_lock
+} httpd_req_t;
+
+typedef struct httpd_uri {
+    const char *uri;
+    httpd_method_t method;
+    esp_err_t (*handler)(httpd_req_t *r);
+    void *user_ctx;
+} httpd_uri_t;
+
+inline std::vector<httpd_uri_t> httpd_stub_uris;
+
+// Inline variables: one instance across translation units
+inline std::mutex httpd_stub_lock;
+inline std::condition_variable httpd_stub_cv;
+
+static inline esp_err_t httpd_register_uri_handler(httpd_handle_t handle, const httpd_uri_t *uri)
+{
+    httpd_stub_uris.push_back(*uri);
+    return ESP_OK;
+}
+
+static inline esp_err_t httpd_req_async_handler_begin(httpd_req_t *r, httpd_req_t **out)
+{
+    *out = new httpd_req_t(*r);
+    (*out)->origin = r;
+    return ESP_OK;
+}
+
+static inline esp_err_t httpd_req_async_handler_complete(httpd_req_t *r)
+{
+    {
+        std::lock_guard<std::mutex> lock(httpd_stub_lock);
+        httpd_req_t *origin = r->origin;
+        origin->type = r->type;
+        origin->body = r->body;
+        origin->chunks = r->chunks;
+        origin->ended = r->ended;
+        origin->status = r->status;
+        origin->headers = r->headers;
+        origin->completed = true;
+    }
+    httpd_stub_cv.notify_all();
+    delete r;
+    return ESP_OK;
+}
+
+// Wait until the async copy of r completed; false after ms
+static inline bool httpd_stub_wait_completed(httpd_req_t *r, int ms)
+{
+    std::unique_lock<std::mutex> lock(httpd_stub_lock);
+    return httpd_stub_cv.wait_for(lock, std::chrono::milliseconds(ms), [r] { return r->completed; });
+}
+
+static inline const char *httpd_stub_header(const httpd_req_t *r, const char *field)
+{
+    for (const auto &h : r->headers) {
+        if (h.first == field) return h.second.c_str();
+    }
+    return nullptr;
+}
+
+static inline esp_err_t httpd_resp_set_status(httpd_req_t *r, const char *status)
+{
+    r->status = status;
+    return ESP_OK;
+}
+
+static inline esp_err_t httpd_resp_set_hdr(httpd_req_t *r, const char *field, const char *value)
+{
+    r->headers.emplace_back(field, value);
+    return ESP_OK;
+}
+
+static inline esp_err_t httpd_resp_set_type(httpd_req_t *r, const char *type)
+{
+    r->type = type;
+    return ESP_OK;
+}
+
+static inline esp_err_t httpd_resp_send_chunk(httpd_req_t *r, const char *buf, ssize_t len)
+{
+    if (r->fail_at != ESP_OK) return r->fail_at;
+    if (!buf || !len) {
+        r->ended = true;
+    } else {
+        r->body.append(buf, len);
+        r->chunks++;
+    }
+    return ESP_OK;
+}
+
+static inline esp_err_t httpd_resp_send(httpd_req_t *r, const char *buf, ssize_t len)
+{
+    if (r->fail_at != ESP_OK) return r->fail_at;
+    if (buf && len == HTTPD_RESP_USE_STRLEN) len = strlen(buf);
+    if (buf && len > 0) r->body.append(buf, len);
+    r->ended = true;
+    return ESP_OK;
+}
+
+static inline esp_err_t httpd_resp_sendstr(httpd_req_t *r, const char *str)
+{
+    return httpd_resp_send(r, str, HTTPD_RESP_USE_STRLEN);
+}
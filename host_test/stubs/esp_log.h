@@ -0,0 +1,13 @@
+/*
+ * Host stub: ESP_LOGx print to stdout/stderr, debug and verbose are dropped
+ */
+
+#pragma once
+
+#include <stdio.h>
+
+#define ESP_LOGE(tag, fmt, ...) fprintf(stderr, "E %s: " fmt "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, fmt, ...) fprintf(stderr, "W %s: " fmt "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGI(tag, fmt, ...) printf("I %s: " fmt "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGD(tag, fmt, ...) do { (void)(tag); } while (0)
+#define ESP_LOGV(tag, fmt, ...) do { (void)(tag); } while (0)
@@ -0,0 +1,27 @@
+/*
+ * Host stub: the running image is "host"
+ */
+
+#pragma once
+
+#include <string.h>
+#include "esp_partition.h"
+
+typedef struct {
+    char version[32];
+    char project_name[32];
+} esp_app_desc_t;
+
+static inline const esp_partition_t *esp_ota_get_running_partition(void)
+{
+    static const esp_partition_t running = {"host", 0, 0};
+    return &running;
+}
+
+static inline esp_err_t esp_ota_get_partition_description(const esp_partition_t *partition, esp_app_desc_t *desc)
+{
+    memset(desc, 0, sizeof(*desc));
+    strcpy(desc->version, "host");
+    strcpy(desc->project_name, "esp32-tux");
+    return ESP_OK;
+}
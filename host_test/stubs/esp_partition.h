@@ -0,0 +1,14 @@
+/*
+ * Host stub: a partition is just its label
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef struct {
+    const char *label;
+    uint32_t address;
+    uint32_t size;
+} esp_partition_t;
@@ -0,0 +1,17 @@
+/*
+ * Host stub: esp_timer_get_time() from the monotonic clock, plus an offset
+ * tests can advance to skip ahead in time (shared by all translation units)
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <chrono>
+
+inline int64_t esp_timer_stub_offset_us = 0;
+
+static inline int64_t esp_timer_get_time(void)
+{
+    using namespace std::chrono;
+    return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count() + esp_timer_stub_offset_us;
+}
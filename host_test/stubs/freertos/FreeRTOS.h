@@ -0,0 +1,75 @@
+/*
+ * Host stub of the FreeRTOS API used by the helpers under test
+ *
+ * Tasks are std::threads, queues and semaphores are built on a mutex and a
+ * condition variable, and critical sections (portMUX) are a spinlock. One
+ * tick is one millisecond.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE             0
+#define pdTRUE              1
+#define pdFAIL              pdFALSE
+#define pdPASS              pdTRUE
+#define portMAX_DELAY       ((TickType_t)0xffffffffUL)
+#define portTICK_PERIOD_MS  1
+#define configTICK_RATE_HZ  1000
+#define pdMS_TO_TICKS(ms)   ((TickType_t)(ms))
+#define tskNO_AFFINITY      0x7FFFFFFF
+#define tskIDLE_PRIORITY    0
+
+// Wait on `cv` until `ready()` or `ticks` ms pass (portMAX_DELAY: forever)
+template <typename Pred>
+static inline bool freertos_stub_wait(std::condition_variable &cv, std::unique_lock<std::mutex> &lock,
+                                      TickType_t ticks, Pred ready)
+{
+    if (ticks == portMAX_DELAY) {
+        cv.wait(lock, ready);
+        return true;
+    }
+    return cv.wait_for(lock, std::chrono::milliseconds(ticks), ready);
+}
+
+/* Critical sections */
+
+typedef struct {
+    std::atomic_flag flag;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED { ATOMIC_FLAG_INIT }
+
+// Called after every critical section, where the device could switch tasks:
+// a test sets it to run another "task" at exactly that point
+static void (*portmux_stub_exit_hook)(portMUX_TYPE *mux) = NULL;
+
+static inline void portENTER_CRITICAL(portMUX_TYPE *mux)
+{
+    while (mux->flag.test_and_set(std::memory_order_acquire)) std::this_thread::yield();
+}
+
+static inline void portEXIT_CRITICAL(portMUX_TYPE *mux)
+{
+    mux->flag.clear(std::memory_order_release);
+    if (portmux_stub_exit_hook) portmux_stub_exit_hook(mux);
+}
+
+#define portENTER_CRITICAL_ISR(mux)     portENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL_ISR(mux)      portEXIT_CRITICAL(mux)
+#define taskENTER_CRITICAL(mux)         portENTER_CRITICAL(mux)
+#define taskEXIT_CRITICAL(mux)          portEXIT_CRITICAL(mux)
@@ -0,0 +1,56 @@
+/*
+ * Host stub: FreeRTOS queues (copy-in, copy-out, fixed length)
+ */
+
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct freertos_stub_queue {
+    std::mutex lock;
+    std::condition_variable cv;
+    std::deque<std::vector<uint8_t>> items;
+    UBaseType_t length;
+    UBaseType_t item_size;
+} *QueueHandle_t;
+
+static inline QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size)
+{
+    QueueHandle_t q = new freertos_stub_queue();
+    q->length = length;
+    q->item_size = item_size;
+    return q;
+}
+
+static inline void vQueueDelete(QueueHandle_t q)
+{
+    delete q;
+}
+
+static inline BaseType_t xQueueSend(QueueHandle_t q, const void *item, TickType_t ticks)
+{
+    std::unique_lock<std::mutex> lock(q->lock);
+    if (!freertos_stub_wait(q->cv, lock, ticks, [q] { return q->items.size() < q->length; })) return pdFALSE;
+    const uint8_t *p = (const uint8_t *)item;
+    q->items.emplace_back(p, p + q->item_size);
+    q->cv.notify_all();
+    return pdTRUE;
+}
+
+#define xQueueSendToBack(q, item, ticks) xQueueSend(q, item, ticks)
+
+static inline BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t ticks)
+{
+    std::unique_lock<std::mutex> lock(q->lock);
+    if (!freertos_stub_wait(q->cv, lock, ticks, [q] { return !q->items.empty(); })) return pdFALSE;
+    memcpy(item, q->items.front().data(), q->item_size);
+    q->items.pop_front();
+    q->cv.notify_all();
+    return pdTRUE;
+}
+
+static inline UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q)
+{
+    std::lock_guard<std::mutex> lock(q->lock);
+    return (UBaseType_t)q->items.size();
+}
@@ -0,0 +1,49 @@
+/*
+ * Host stub: binary/counting semaphores and mutexes (a mutex is a binary
+ * semaphore that starts given; no priority inheritance)
+ */
+
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct freertos_stub_sem {
+    std::mutex lock;
+    std::condition_variable cv;
+    UBaseType_t count;
+    UBaseType_t max;
+} *SemaphoreHandle_t;
+
+static inline SemaphoreHandle_t freertos_stub_sem_create(UBaseType_t max, UBaseType_t initial)
+{
+    SemaphoreHandle_t s = new freertos_stub_sem();
+    s->count = initial;
+    s->max = max;
+    return s;
+}
+
+#define xSemaphoreCreateBinary()            freertos_stub_sem_create(1, 0)
+#define xSemaphoreCreateMutex()             freertos_stub_sem_create(1, 1)
+#define xSemaphoreCreateCounting(max, init) freertos_stub_sem_create(max, init)
+
+static inline void vSemaphoreDelete(SemaphoreHandle_t s)
+{
+    delete s;
+}
+
+static inline BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t ticks)
+{
+    std::unique_lock<std::mutex> lock(s->lock);
+    if (!freertos_stub_wait(s->cv, lock, ticks, [s] { return s->count > 0; })) return pdFALSE;
+    s->count--;
+    return pdTRUE;
+}
+
+static inline BaseType_t xSemaphoreGive(SemaphoreHandle_t s)
+{
+    std::lock_guard<std::mutex> lock(s->lock);
+    if (s->count >= s->max) return pdFALSE;
+    s->count++;
+    s->cv.notify_one();
+    return pdTRUE;
+}
@@ -0,0 +1,82 @@
+/*
+ * Host stub: FreeRTOS tasks as detached std::threads, with task notifications
+ */
+
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+typedef void (*TaskFunction_t)(void *);
+
+typedef struct freertos_stub_task {
+    std::mutex lock;
+    std::condition_variable cv;
+    uint32_t notify;
+} *TaskHandle_t;
+
+static thread_local TaskHandle_t freertos_stub_current = NULL;
+
+static inline TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    if (!freertos_stub_current) freertos_stub_current = new freertos_stub_task();   // Threads not created here
+    return freertos_stub_current;
+}
+
+static inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack,
+                                                 void *arg, UBaseType_t prio, TaskHandle_t *out, BaseType_t core)
+{
+    (void)name;
+    (void)stack;
+    (void)prio;
+    (void)core;
+    TaskHandle_t task = new freertos_stub_task();
+    task->notify = 0;
+    if (out) *out = task;
+    std::thread([fn, arg, task]() {
+        freertos_stub_current = task;
+        fn(arg);
+    }).detach();
+    return pdPASS;
+}
+
+static inline BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack, void *arg,
+                                     UBaseType_t prio, TaskHandle_t *out)
+{
+    return xTaskCreatePinnedToCore(fn, name, stack, arg, prio, out, tskNO_AFFINITY);
+}
+
+// Threads cannot be killed from outside; vTaskDelete(NULL) is followed by a
+// return in the code under test, which ends the thread
+static inline void vTaskDelete(TaskHandle_t task)
+{
+    (void)task;
+}
+
+static inline void vTaskDelay(TickType_t ticks)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+static inline TickType_t xTaskGetTickCount(void)
+{
+    using namespace std::chrono;
+    return (TickType_t)duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+static inline BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    std::lock_guard<std::mutex> lock(task->lock);
+    task->notify++;
+    task->cv.notify_all();
+    return pdPASS;
+}
+
+static inline uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks)
+{
+    TaskHandle_t task = xTaskGetCurrentTaskHandle();
+    std::unique_lock<std::mutex> lock(task->lock);
+    freertos_stub_wait(task->cv, lock, ticks, [task] { return task->notify > 0; });
+    uint32_t value = task->notify;
+    if (value) task->notify = clear ? 0 : value - 1;
+    return value;
+}
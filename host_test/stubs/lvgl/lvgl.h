@@ -0,0 +1,325 @@
+/*
+ * Host stub of the LVGL 8.3 API used by the helpers under test
+ *
+ * Only the types and calls the tested headers touch, with the same layout
+ * and color settings as components/lv_conf.h (16 bit, byte swapped). lv_fs
+ * dispatches to registered drivers like LVGL does; the image decoder
+ * registry keeps the last decoder created.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+
+#define LV_COLOR_DEPTH              16
+#define LV_COLOR_16_SWAP            1
+#define LV_IMG_PX_SIZE_ALPHA_BYTE   3
+
+#define LV_UNUSED(x)    (void)(x)
+#define LV_MIN(a, b)    ((a) < (b) ? (a) : (b))
+#define LV_MAX(a, b)    ((a) > (b) ? (a) : (b))
+
+typedef int16_t lv_coord_t;
+typedef uint8_t lv_opa_t;
+
+typedef enum {
+    LV_RES_INV = 0,
+    LV_RES_OK,
+} lv_res_t;
+
+typedef union {
+    uint16_t full;
+} lv_color_t;
+
+static inline lv_color_t lv_color_make(uint8_t r, uint8_t g, uint8_t b)
+{
+    uint16_t v = (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+    lv_color_t c;
+    c.full = LV_COLOR_16_SWAP ? (uint16_t)((v >> 8) | (v << 8)) : v;
+    return c;
+}
+
+static inline uint32_t lv_tick_get(void)
+{
+    using namespace std::chrono;
+    return (uint32_t)duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+/* Timers and objects are opaque to the helpers */
+typedef struct _lv_timer_t lv_timer_t;
+typedef struct _lv_obj_t lv_obj_t;
+
+/* Images */
+
+enum {
+    LV_IMG_CF_UNKNOWN = 0,
+    LV_IMG_CF_RAW = 1,
+    LV_IMG_CF_TRUE_COLOR = 4,
+    LV_IMG_CF_TRUE_COLOR_ALPHA = 5,
+    LV_IMG_CF_INDEXED_8BIT = 10,
+    LV_IMG_CF_USER_ENCODED_0 = 24,
+};
+typedef uint8_t lv_img_cf_t;
+
+typedef struct {
+    uint32_t cf : 5;
+    uint32_t always_zero : 3;
+    uint32_t reserved : 2;
+    uint32_t w : 11;
+    uint32_t h : 11;
+} lv_img_header_t;
+
+typedef struct {
+    lv_img_header_t header;
+    uint32_t data_size;
+    const uint8_t *data;
+} lv_img_dsc_t;
+
+typedef enum {
+    LV_IMG_SRC_VARIABLE,
+    LV_IMG_SRC_FILE,
+    LV_IMG_SRC_SYMBOL,
+    LV_IMG_SRC_UNKNOWN,
+} lv_img_src_t;
+
+// Same rule as LVGL: printable ASCII first byte is a path, 0xF7 a symbol
+static inline lv_img_src_t lv_img_src_get_type(const void *src)
+{
+    if (!src) return LV_IMG_SRC_UNKNOWN;
+    const uint8_t *u8 = (const uint8_t *)src;
+    if (u8[0] >= 0x20 && u8[0] <= 0x7F) return LV_IMG_SRC_FILE;
+    if (u8[0] >= 0x80) return LV_IMG_SRC_SYMBOL;
+    return LV_IMG_SRC_VARIABLE;
+}
+
+/* File system */
+
+typedef enum {
+    LV_FS_RES_OK = 0,
+    LV_FS_RES_HW_ERR,
+    LV_FS_RES_FS_ERR,
+    LV_FS_RES_NOT_EX,
+    LV_FS_RES_FULL,
+    LV_FS_RES_LOCKED,
+    LV_FS_RES_DENIED,
+    LV_FS_RES_BUSY,
+    LV_FS_RES_TOUT,
+    LV_FS_RES_NOT_IMP,
+    LV_FS_RES_OUT_OF_MEM,
+    LV_FS_RES_INV_PARAM,
+    LV_FS_RES_UNKNOWN,
+} lv_fs_res_t;
+
+typedef uint8_t lv_fs_mode_t;
+enum {
+    LV_FS_MODE_WR = 0x01,
+    LV_FS_MODE_RD = 0x02,
+};
+
+typedef enum {
+    LV_FS_SEEK_SET = 0x00,
+    LV_FS_SEEK_CUR = 0x01,
+    LV_FS_SEEK_END = 0x02,
+} lv_fs_whence_t;
+
+typedef struct _lv_fs_drv_t {
+    char letter;
+    uint16_t cache_size;
+    bool (*ready_cb)(struct _lv_fs_drv_t *drv);
+    void *(*open_cb)(struct _lv_fs_drv_t *drv, const char *path, lv_fs_mode_t mode);
+    lv_fs_res_t (*close_cb)(struct _lv_fs_drv_t *drv, void *file_p);
+    lv_fs_res_t (*read_cb)(struct _lv_fs_drv_t *drv, void *file_p, void *buf, uint32_t btr, uint32_t *br);
+    lv_fs_res_t (*write_cb)(struct _lv_fs_drv_t *drv, void *file_p, const void *buf, uint32_t btw, uint32_t *bw);
+    lv_fs_res_t (*seek_cb)(struct _lv_fs_drv_t *drv, void *file_p, uint32_t pos, lv_fs_whence_t whence);
+    lv_fs_res_t (*tell_cb)(struct _lv_fs_drv_t *drv, void *file_p, uint32_t *pos_p);
+    void *user_data;
+} lv_fs_drv_t;
+
+typedef struct {
+    void *file_d;
+    lv_fs_drv_t *drv;
+} lv_fs_file_t;
+
+static lv_fs_drv_t *lv_stub_fs_drivers[8];
+
+static inline void lv_fs_drv_init(lv_fs_drv_t *drv)
+{
+    memset(drv, 0, sizeof(*drv));
+}
+
+static inline void lv_fs_drv_register(lv_fs_drv_t *drv)
+{
+    for (lv_fs_drv_t *&slot : lv_stub_fs_drivers) {
+        if (!slot) {
+            slot = drv;
+            return;
+        }
+    }
+}
+
+static inline lv_fs_drv_t *lv_fs_get_drv(char letter)
+{
+    for (lv_fs_drv_t *drv : lv_stub_fs_drivers) {
+        if (drv && drv->letter == letter) return drv;
+    }
+    return NULL;
+}
+
+static inline lv_fs_res_t lv_fs_open(lv_fs_file_t *file_p, const char *path, lv_fs_mode_t mode)
+{
+    file_p->file_d = NULL;
+    file_p->drv = NULL;
+    if (!path || !path[0] || path[1] != ':') return LV_FS_RES_INV_PARAM;
+    lv_fs_drv_t *drv = lv_fs_get_drv(path[0]);
+    if (!drv || !drv->open_cb) return LV_FS_RES_NOT_EX;
+    void *fd = drv->open_cb(drv, path + 2, mode);
+    if (fd == NULL || fd == (void *)(-1)) return LV_FS_RES_UNKNOWN;
+    file_p->file_d = fd;
+    file_p->drv = drv;
+    return LV_FS_RES_OK;
+}
+
+static inline lv_fs_res_t lv_fs_close(lv_fs_file_t *file_p)
+{
+    if (!file_p->drv) return LV_FS_RES_INV_PARAM;
+    lv_fs_res_t res = file_p->drv->close_cb(file_p->drv, file_p->file_d);
+    file_p->file_d = NULL;
+    file_p->drv = NULL;
+    return res;
+}
+
+static inline lv_fs_res_t lv_fs_read(lv_fs_file_t *file_p, void *buf, uint32_t btr, uint32_t *br)
+{
+    if (br) *br = 0;
+    if (!file_p->drv) return LV_FS_RES_INV_PARAM;
+    uint32_t tmp = 0;
+    return file_p->drv->read_cb(file_p->drv, file_p->file_d, buf, btr, br ? br : &tmp);
+}
+
+static inline lv_fs_res_t lv_fs_seek(lv_fs_file_t *file_p, uint32_t pos, lv_fs_whence_t whence)
+{
+    if (!file_p->drv) return LV_FS_RES_INV_PARAM;
+    return file_p->drv->seek_cb(file_p->drv, file_p->file_d, pos, whence);
+}
+
+static inline lv_fs_res_t lv_fs_tell(lv_fs_file_t *file_p, uint32_t *pos)
+{
+    if (!file_p->drv) return LV_FS_RES_INV_PARAM;
+    return file_p->drv->tell_cb(file_p->drv, file_p->file_d, pos);
+}
+
+static inline const char *lv_fs_get_ext(const char *fn)
+{
+    const char *dot = strrchr(fn, '.');
+    if (!dot || strchr(dot, '/')) return "";
+    return dot + 1;
+}
+
+/* Image decoders */
+
+struct _lv_img_decoder_dsc_t;
+
+typedef struct _lv_img_decoder_t {
+    lv_res_t (*info_cb)(struct _lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header);
+    lv_res_t (*open_cb)(struct _lv_img_decoder_t *decoder, struct _lv_img_decoder_dsc_t *dsc);
+    lv_res_t (*read_line_cb)(struct _lv_img_decoder_t *decoder, struct _lv_img_decoder_dsc_t *dsc,
+                             lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t *buf);
+    void (*close_cb)(struct _lv_img_decoder_t *decoder, struct _lv_img_decoder_dsc_t *dsc);
+    void *user_data;
+} lv_img_decoder_t;
+
+typedef struct _lv_img_decoder_dsc_t {
+    lv_img_decoder_t *decoder;
+    const void *src;
+    lv_img_src_t src_type;
+    lv_img_header_t header;
+    const uint8_t *img_data;
+    uint32_t time_to_open;
+    const char *error_msg;
+    void *user_data;
+} lv_img_decoder_dsc_t;
+
+typedef lv_res_t (*lv_img_decoder_info_f_t)(lv_img_decoder_t *, const void *, lv_img_header_t *);
+typedef lv_res_t (*lv_img_decoder_open_f_t)(lv_img_decoder_t *, lv_img_decoder_dsc_t *);
+typedef lv_res_t (*lv_img_decoder_read_line_f_t)(lv_img_decoder_t *, lv_img_decoder_dsc_t *,
+                                                 lv_coord_t, lv_coord_t, lv_coord_t, uint8_t *);
+typedef void (*lv_img_decoder_close_f_t)(lv_img_decoder_t *, lv_img_decoder_dsc_t *);
+
+static lv_img_decoder_t lv_stub_img_decoder;
+
+static inline lv_img_decoder_t *lv_img_decoder_create(void)
+{
+    memset(&lv_stub_img_decoder, 0, sizeof(lv_stub_img_decoder));
+    return &lv_stub_img_decoder;
+}
+
+static inline void lv_img_decoder_set_info_cb(lv_img_decoder_t *d, lv_img_decoder_info_f_t cb) { d->info_cb = cb; }
+static inline void lv_img_decoder_set_open_cb(lv_img_decoder_t *d, lv_img_decoder_open_f_t cb) { d->open_cb = cb; }
+static inline void lv_img_decoder_set_read_line_cb(lv_img_decoder_t *d, lv_img_decoder_read_line_f_t cb) { d->read_line_cb = cb; }
+static inline void lv_img_decoder_set_close_cb(lv_img_decoder_t *d, lv_img_decoder_close_f_t cb) { d->close_cb = cb; }
+
+/* Display driver: only the draw buffer handshake that flush_cb/wait_cb see */
+
+typedef struct {
+    lv_coord_t x1;
+    lv_coord_t y1;
+    lv_coord_t x2;
+    lv_coord_t y2;
+} lv_area_t;
+
+typedef struct {
+    void *buf1;
+    void *buf2;
+    void *buf_act;
+    uint32_t size;
+    std::atomic<int> flushing;          // volatile in LVGL; atomic so ThreadSanitizer sees the handshake
+    std::atomic<int> flushing_last;
+} lv_disp_draw_buf_t;
+
+typedef struct _lv_disp_drv_t {
+    lv_coord_t hor_res;
+    lv_coord_t ver_res;
+    lv_disp_draw_buf_t *draw_buf;
+    void (*flush_cb)(struct _lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p);
+    void (*wait_cb)(struct _lv_disp_drv_t *disp_drv);
+    void *user_data;
+} lv_disp_drv_t;
+
+static inline void lv_disp_flush_ready(lv_disp_drv_t *disp_drv)
+{
+    disp_drv->draw_buf->flushing = 0;
+    disp_drv->draw_buf->flushing_last = 0;
+}
+
+/* Widgets and timers: no-ops for helpers that draw an overlay (profiler HUD) */
+
+typedef void (*lv_timer_cb_t)(lv_timer_t *timer);
+typedef uint32_t lv_style_selector_t;
+
+#define LV_OPA_70           178
+#define LV_ALIGN_TOP_RIGHT  3
+
+static inline lv_color_t lv_color_hex(uint32_t c)
+{
+    return lv_color_make((uint8_t)(c >> 16), (uint8_t)(c >> 8), (uint8_t)c);
+}
+
+static inline lv_color_t lv_color_black(void) { return lv_color_make(0, 0, 0); }
+static inline lv_timer_t *lv_timer_create(lv_timer_cb_t cb, uint32_t period, void *user_data) { return NULL; }
+static inline void lv_timer_del(lv_timer_t *timer) {}
+static inline void lv_timer_ready(lv_timer_t *timer) {}
+static inline lv_obj_t *lv_layer_top(void) { return NULL; }
+static inline lv_obj_t *lv_label_create(lv_obj_t *parent) { return NULL; }
+static inline void lv_label_set_text(lv_obj_t *obj, const char *text) {}
+static inline void lv_label_set_text_fmt(lv_obj_t *obj, const char *fmt, ...) {}
+static inline void lv_obj_del(lv_obj_t *obj) {}
+static inline void lv_obj_align(lv_obj_t *obj, uint8_t align, lv_coord_t x, lv_coord_t y) {}
+static inline void lv_obj_set_style_bg_color(lv_obj_t *obj, lv_color_t value, lv_style_selector_t sel) {}
+static inline void lv_obj_set_style_bg_opa(lv_obj_t *obj, lv_opa_t value, lv_style_selector_t sel) {}
+static inline void lv_obj_set_style_text_color(lv_obj_t *obj, lv_color_t value, lv_style_selector_t sel) {}
+static inline void lv_obj_set_style_pad_all(lv_obj_t *obj, lv_coord_t value, lv_style_selector_t sel) {}
@@ -0,0 +1,11 @@
+/*
+ * Host stub: lwIP's BSD socket API is the host's own
+ */
+
+#pragma once
+
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
@@ -0,0 +1,199 @@
+/*
+ * Host test: carousel slide diff (main/widgets/carousel_diff.hpp)
+ *
+ * Applies the returned operations to a simulated flex container and checks
+ * the resulting order, which panels were reused, and that the number of
+ * creates, deletes and moves is the minimum.
+ */
+
+#include "carousel_diff.hpp"
+#include "host_check.hpp"
+#include <algorithm>
+#include <random>
+#include <string>
+
+struct Panel {
+    std::string key;
+    bool created;
+};
+
+// Builds key lists (all printer slides, type 1; "-" is a keyless slide)
+static std::vector<carousel_key_t> keys(const std::vector<std::string> &names) {
+    std::vector<carousel_key_t> out;
+    for (const auto &n : names) out.push_back({n == "-" ? "" : n.c_str(), 1});
+    return out;
+}
+
+// Runs the diff against a simulated container, returns the final panels
+static std::vector<Panel> apply(const std::vector<std::string> &old_names,
+                                const std::vector<std::string> &new_names,
+                                int current, carousel_diff_t *out) {
+    carousel_diff_t d = carousel_diff(keys(old_names), keys(new_names), current);
+    *out = d;
+
+    std::vector<int> flex;  // Old index, or 100 + desired index for created panels
+    for (int j = 0; j < (int)old_names.size(); j++) {
+        if (std::find(d.removed.begin(), d.removed.end(), j) == d.removed.end()) flex.push_back(j);
+    }
+    for (int i = 0; i < (int)new_names.size(); i++) {
+        if (d.source[i] < 0) flex.push_back(100 + i);
+    }
+    auto id_of = [&](int slide) { return d.source[slide] >= 0 ? d.source[slide] : 100 + slide; };
+    for (const carousel_move_t &m : d.moves) {
+        int id = id_of(m.slide);
+        flex.erase(std::find(flex.begin(), flex.end(), id));
+        flex.insert(flex.begin() + m.to, id);
+    }
+
+    std::vector<Panel> panels;
+    for (int id : flex) {
+        if (id >= 100) panels.push_back({new_names[id - 100], true});
+        else panels.push_back({old_names[id], false});
+    }
+    return panels;
+}
+
+static void check_order(const std::vector<Panel> &panels, const std::vector<std::string> &want) {
+    CHECK(panels.size() == want.size());
+    for (size_t i = 0; i < panels.size() && i < want.size(); i++) CHECK(panels[i].key == want[i]);
+}
+
+static int count_created(const carousel_diff_t &d) {
+    return (int)std::count(d.source.begin(), d.source.end(), -1);
+}
+
+static void test_unchanged() {
+    carousel_diff_t d;
+    auto p = apply({"a", "b", "c"}, {"a", "b", "c"}, 1, &d);
+    check_order(p, {"a", "b", "c"});
+    CHECK(count_created(d) == 0);
+    CHECK(d.removed.empty());
+    CHECK(d.moves.empty());
+    CHECK(d.current == 1);
+}
+
+static void test_insert() {
+    carousel_diff_t d;
+    auto p = apply({"a", "c"}, {"a", "b", "c"}, 1, &d);
+    check_order(p, {"a", "b", "c"});
+    CHECK(count_created(d) == 1);
+    CHECK(p[1].created && !p[0].created && !p[2].created);
+    CHECK(d.removed.empty());
+    CHECK(d.moves.size() == 1);         // New panel is appended, then moved once
+    CHECK(d.current == 2);              // Still on "c"
+
+    auto q = apply({"a", "b"}, {"a", "b", "c"}, 0, &d);
+    check_order(q, {"a", "b", "c"});
+    CHECK(d.moves.empty());             // Appended at the end: no move
+}
+
+static void test_remove() {
+    carousel_diff_t d;
+    auto p = apply({"a", "b", "c"}, {"a", "c"}, 2, &d);
+    check_order(p, {"a", "c"});
+    CHECK(count_created(d) == 0);
+    CHECK(d.removed.size() == 1 && d.removed[0] == 1);
+    CHECK(d.moves.empty());
+    CHECK(d.current == 1);
+
+    apply({"a", "b", "c"}, {"a", "c"}, 1, &d);
+    CHECK(d.current == 0);              // Current slide went away
+}
+
+static void test_moves_minimal() {
+    carousel_diff_t d;
+    check_order(apply({"a", "b", "c"}, {"b", "c", "a"}, 0, &d), {"b", "c", "a"});
+    CHECK(d.moves.size() == 1);
+    CHECK(d.current == 2);              // Follows "a"
+
+    check_order(apply({"a", "b", "c"}, {"c", "a", "b"}, 0, &d), {"c", "a", "b"});
+    CHECK(d.moves.size() == 1);
+
+    check_order(apply({"a", "b", "c", "d"}, {"d", "c", "b", "a"}, 0, &d), {"d", "c", "b", "a"});
+    CHECK(d.moves.size() == 3);
+
+    check_order(apply({"a", "b"}, {"b", "a"}, 0, &d), {"b", "a"});
+    CHECK(d.moves.size() == 1);
+    CHECK(count_created(d) == 0);
+}
+
+static void test_keyless_and_type() {
+    carousel_diff_t d;
+    auto p = apply({"-", "a"}, {"-", "a"}, 0, &d);
+    check_order(p, {"-", "a"});
+    CHECK(p[0].created && !p[1].created);   // Keyless slides never match
+    CHECK(d.removed.size() == 1);
+    CHECK(d.current == 0);
+
+    std::vector<carousel_key_t> old_keys = {{"a", 1}}, new_keys = {{"a", 0}};
+    d = carousel_diff(old_keys, new_keys, 0);
+    CHECK(d.source[0] == -1 && d.removed.size() == 1);
+    CHECK(d.current == 0);
+}
+
+// Minimum moves = kept panels not in the longest run already in order
+static int min_moves(const std::vector<int> &seq) {
+    std::vector<int> len(seq.size(), 1);
+    int best = 0;
+    for (size_t i = 0; i < seq.size(); i++) {
+        for (size_t k = 0; k < i; k++) {
+            if (seq[k] < seq[i]) len[i] = std::max(len[i], len[k] + 1);
+        }
+        best = std::max(best, len[i]);
+    }
+    return (int)seq.size() - best;
+}
+
+static void test_random() {
+    std::mt19937 rng(1234);
+    const std::vector<std::string> pool = {"a", "b", "c", "d", "e", "f", "g", "h", "i", "j", "k", "l"};
+    for (int round = 0; round < 2000; round++) {
+        std::vector<std::string> shuffled = pool;
+        std::shuffle(shuffled.begin(), shuffled.end(), rng);
+        std::vector<std::string> old_names(shuffled.begin(), shuffled.begin() + rng() % 11);
+        std::shuffle(shuffled.begin(), shuffled.end(), rng);
+        std::vector<std::string> new_names(shuffled.begin(), shuffled.begin() + rng() % 11);
+        int current = old_names.empty() ? 0 : (int)(rng() % old_names.size());
+
+        carousel_diff_t d;
+        auto p = apply(old_names, new_names, current, &d);
+        check_order(p, new_names);
+
+        // Every surviving key reuses its panel, every other one is created or removed
+        std::vector<int> kept_old_order;
+        int survivors = 0;
+        for (size_t i = 0; i < new_names.size(); i++) {
+            bool existed = std::find(old_names.begin(), old_names.end(), new_names[i]) != old_names.end();
+            CHECK(p[i].created == !existed);
+            survivors += existed;
+        }
+        CHECK((int)d.removed.size() == (int)old_names.size() - survivors);
+
+        // Moves: minimal over the flex order after deletes and appends
+        std::vector<int> seq;
+        for (size_t j = 0; j < old_names.size(); j++) {
+            auto it = std::find(new_names.begin(), new_names.end(), old_names[j]);
+            if (it != new_names.end()) seq.push_back((int)(it - new_names.begin()));
+        }
+        for (size_t i = 0; i < new_names.size(); i++) {
+            if (d.source[i] < 0) seq.push_back((int)i);
+        }
+        CHECK((int)d.moves.size() == min_moves(seq));
+
+        if (!old_names.empty()) {
+            auto it = std::find(new_names.begin(), new_names.end(), old_names[current]);
+            int want = it == new_names.end() ? 0 : (int)(it - new_names.begin());
+            CHECK(d.current == want);
+        }
+    }
+}
+
+int main() {
+    test_unchanged();
+    test_insert();
+    test_remove();
+    test_moves_minimal();
+    test_keyless_and_type();
+    test_random();
+    return host_check_result("carousel_diff");
+}
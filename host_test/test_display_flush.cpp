@@ -0,0 +1,135 @@
+/*
+ * Host test: display flush pipeline (main/helpers/helper_display_flush.hpp)
+ *
+ * Drives display_flush()/display_wait() the way LVGL's refresh does with two
+ * draw buffers (render a band into the active buffer, wait while the other
+ * one is still flushing, flush, swap) against a simulated panel whose push
+ * takes a fixed transfer time. Checks that no buffer is written while it is
+ * being sent, that every band arrives intact, and that the asynchronous
+ * pipeline overlaps rendering with transfers: a frame must take clearly less
+ * than the synchronous render + transfer sum.
+ */
+
+#include "helper_display_flush.hpp"
+#include "host_check.hpp"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#define HOR_RES     320
+#define BAND_ROWS   24
+#define BANDS       10
+#define FRAMES      5
+#define RENDER_MS   3
+#define TRANSFER_MS 3
+
+static lv_color_t buf_a[HOR_RES * BAND_ROWS];
+static lv_color_t buf_b[HOR_RES * BAND_ROWS];
+static std::atomic<lv_color_t *> in_transfer{nullptr};
+static std::atomic<int> bands_pushed{0};
+static std::atomic<int> bands_corrupt{0};
+static std::atomic<int> pushes_off_thread{0};
+static std::thread::id render_thread;
+
+static uint16_t band_value(int frame, int band)
+{
+    return (uint16_t)(frame * 37 + band * 101 + 1);
+}
+
+// Simulated panel: the buffer must stay untouched for the whole transfer
+static void sim_push(const lv_area_t *area, lv_color_t *color_p)
+{
+    size_t n = (size_t)(area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1);
+    uint16_t expect = color_p[0].full;
+    in_transfer = color_p;
+    std::this_thread::sleep_for(std::chrono::milliseconds(TRANSFER_MS));
+    bool intact = true;
+    for (size_t i = 0; i < n; i++) intact = intact && color_p[i].full == expect;
+    in_transfer = nullptr;
+    if (!intact) bands_corrupt++;
+    if (std::this_thread::get_id() != render_thread) pushes_off_thread++;
+    bands_pushed++;
+}
+
+// Render into the active buffer in two halves, as LVGL's draw code takes time
+static void sim_render(lv_color_t *buf, uint16_t value)
+{
+    CHECK(in_transfer.load() != buf);
+    const size_t n = HOR_RES * BAND_ROWS;
+    for (size_t i = 0; i < n / 2; i++) buf[i].full = value;
+    std::this_thread::sleep_for(std::chrono::milliseconds(RENDER_MS));
+    CHECK(in_transfer.load() != buf);
+    for (size_t i = n / 2; i < n; i++) buf[i].full = value;
+}
+
+// LVGL 8.3 refresh of one frame (lv_refr.c draw_buf_flush), then wait for
+// the last band so frame times compare end to end
+static void sim_frame(lv_disp_drv_t *drv, int frame)
+{
+    lv_disp_draw_buf_t *draw_buf = drv->draw_buf;
+    for (int band = 0; band < BANDS; band++) {
+        sim_render((lv_color_t *)draw_buf->buf_act, band_value(frame, band));
+        while (draw_buf->flushing) drv->wait_cb(drv);
+        draw_buf->flushing = 1;
+        draw_buf->flushing_last = band == BANDS - 1;
+        lv_area_t area = { 0, (lv_coord_t)(band * BAND_ROWS), HOR_RES - 1, (lv_coord_t)(band * BAND_ROWS + BAND_ROWS - 1) };
+        drv->flush_cb(drv, &area, (lv_color_t *)draw_buf->buf_act);
+        draw_buf->buf_act = draw_buf->buf_act == draw_buf->buf1 ? draw_buf->buf2 : draw_buf->buf1;
+    }
+    while (draw_buf->flushing) drv->wait_cb(drv);
+}
+
+// Average frame time in ms
+static double run(bool async)
+{
+    lv_disp_draw_buf_t draw_buf = {};
+    draw_buf.buf1 = buf_a;
+    draw_buf.buf2 = buf_b;
+    draw_buf.buf_act = buf_a;
+    draw_buf.size = HOR_RES * BAND_ROWS;
+    lv_disp_drv_t drv = {};
+    drv.hor_res = HOR_RES;
+    drv.ver_res = BANDS * BAND_ROWS;
+    drv.draw_buf = &draw_buf;
+    drv.flush_cb = display_flush;
+    drv.wait_cb = display_wait;
+
+    CHECK(display_flush_start(sim_push, async, 1) == async);
+    display_stats = {};
+    bands_pushed = 0;
+    bands_corrupt = 0;
+    pushes_off_thread = 0;
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < FRAMES; frame++) sim_frame(&drv, frame);
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count() / FRAMES;
+
+    CHECK(bands_pushed == FRAMES * BANDS);
+    CHECK(bands_corrupt == 0);
+    CHECK(display_stats.flushes == FRAMES * BANDS);
+    CHECK(display_stats.px == (uint32_t)FRAMES * BANDS * HOR_RES * BAND_ROWS);
+    if (async) {
+        CHECK(pushes_off_thread == FRAMES * BANDS);
+        CHECK(display_stats.wait_us > 0);
+    } else {
+        CHECK(pushes_off_thread == 0);
+    }
+    printf("%-5s flush: %5.1f ms/frame (%d bands, %d ms render + %d ms transfer each), waited %.1f ms/frame\n",
+           async ? "async" : "sync", ms, BANDS, RENDER_MS, TRANSFER_MS,
+           display_stats.wait_us / 1000.0 / FRAMES);
+    return ms;
+}
+
+int main()
+{
+    render_thread = std::this_thread::get_id();
+
+    double sync_ms = run(false);
+    double async_ms = run(true);
+
+    // Ideal overlap is (BANDS + 1) * 3 ms vs BANDS * 6 ms; leave room for the scheduler
+    CHECK(sync_ms >= BANDS * (RENDER_MS + TRANSFER_MS));
+    CHECK(async_ms < 0.8 * sync_ms);
+    printf("overlap: async frame is %.0f%% of sync\n", 100.0 * async_ms / sync_ms);
+    return host_check_result("display_flush");
+}
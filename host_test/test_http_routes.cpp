@@ -0,0 +1,195 @@
+/*
+ * Host test: HTTP route dispatcher (components/WebServer/HttpRoutes.cpp)
+ *
+ * Routes are registered with the stub server and called as the httpd task
+ * would call them: SYNC routes answer on the caller, ASYNC routes run on the
+ * two workers. Checks that routes of one group never run at once (the config
+ * writers), that ungrouped routes do, that a route at its limit answers 503
+ * with Retry-After, that a job which waited past its timeout is dropped
+ * without running, and the statistics.
+ */
+
+#include "HttpRoutes.hpp"
+#include "host_check.hpp"
+#include <esp_timer.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#define WAIT_MS 2000
+
+// Handlers park here until the test opens the gate
+struct Gate {
+    std::mutex lock;
+    std::condition_variable cv;
+    bool open = false;
+    int running = 0;
+    int max_running = 0;
+    int entered = 0;
+
+    void pass() {
+        std::unique_lock<std::mutex> l(lock);
+        entered++;
+        running++;
+        if (running > max_running) max_running = running;
+        cv.notify_all();
+        cv.wait(l, [this] { return open; });
+        running--;
+    }
+    bool wait_entered(int n) {
+        std::unique_lock<std::mutex> l(lock);
+        return cv.wait_for(l, std::chrono::milliseconds(WAIT_MS), [&] { return entered >= n; });
+    }
+    void release() {
+        std::lock_guard<std::mutex> l(lock);
+        open = true;
+        cv.notify_all();
+    }
+    void reset() {
+        std::lock_guard<std::mutex> l(lock);
+        open = false;
+        running = max_running = entered = 0;
+    }
+};
+
+static Gate g_gate;
+static std::atomic<int> g_remaining_ms{-1};
+static std::atomic<int> g_slow_calls{0};
+
+static esp_err_t handle_sync(httpd_req_t *req)
+{
+    return httpd_resp_sendstr(req, "sync");
+}
+
+static esp_err_t handle_gated(httpd_req_t *req)
+{
+    g_remaining_ms = HttpRoutes::remaining_ms(req, 60000);
+    g_gate.pass();
+    return httpd_resp_sendstr(req, "{}");
+}
+
+static esp_err_t handle_slow(httpd_req_t *req)
+{
+    g_slow_calls++;
+    return httpd_resp_sendstr(req, "{}");
+}
+
+static const HttpRoutes::Route routes[] = {
+    {"/api/sync", HTTP_GET, handle_sync, HttpRoutes::SYNC, 0, 0, nullptr},
+    {"/api/a", HTTP_POST, handle_gated, HttpRoutes::ASYNC, 1, 10000, "config"},
+    {"/api/b", HTTP_DELETE, handle_gated, HttpRoutes::ASYNC, 1, 10000, "config"},
+    {"/api/c", HTTP_GET, handle_gated, HttpRoutes::ASYNC, 1, 10000, nullptr},
+    {"/api/d", HTTP_GET, handle_gated, HttpRoutes::ASYNC, 1, 10000, nullptr},
+    {"/api/slow", HTTP_GET, handle_slow, HttpRoutes::ASYNC, 1, 50, nullptr},
+};
+
+// What httpd does for a request to uri: the registered handler with its user_ctx
+static esp_err_t call(const char *uri, httpd_method_t method, httpd_req_t *req)
+{
+    for (const httpd_uri_t &u : httpd_stub_uris) {
+        if (strcmp(u.uri, uri) == 0 && u.method == method) {
+            req->user_ctx = u.user_ctx;
+            return u.handler(req);
+        }
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+static void test_sync()
+{
+    httpd_req_t req;
+    CHECK(call("/api/sync", HTTP_GET, &req) == ESP_OK);
+    CHECK(req.body == "sync");
+    CHECK(!req.completed);                  // Answered on the caller, never detached
+    const char *cache = httpd_stub_header(&req, "Cache-Control");
+    CHECK(cache && strcmp(cache, "no-cache") == 0);
+}
+
+// Two config writers: the second is turned away while the first runs
+static void test_group()
+{
+    g_gate.reset();
+    httpd_req_t a, b;
+    CHECK(call("/api/a", HTTP_POST, &a) == ESP_OK);
+    CHECK(g_gate.wait_entered(1));
+    CHECK(g_remaining_ms > 0 && g_remaining_ms <= 10000);
+
+    CHECK(call("/api/b", HTTP_DELETE, &b) == ESP_OK);
+    CHECK(b.status.rfind("503", 0) == 0);
+    const char *retry = httpd_stub_header(&b, "Retry-After");
+    CHECK(retry && strcmp(retry, "2") == 0);
+
+    g_gate.release();
+    CHECK(httpd_stub_wait_completed(&a, WAIT_MS));
+    CHECK(a.status == "200 OK");
+    CHECK(a.body == "{}");
+
+    // The group's slot is free again
+    httpd_req_t b2;
+    CHECK(call("/api/b", HTTP_DELETE, &b2) == ESP_OK);
+    CHECK(httpd_stub_wait_completed(&b2, WAIT_MS));
+    CHECK(b2.status == "200 OK");
+    CHECK(g_gate.max_running == 1);
+}
+
+// Routes without a group run side by side on the two workers
+static void test_parallel()
+{
+    g_gate.reset();
+    httpd_req_t c, d;
+    CHECK(call("/api/c", HTTP_GET, &c) == ESP_OK);
+    CHECK(call("/api/d", HTTP_GET, &d) == ESP_OK);
+    CHECK(g_gate.wait_entered(2));
+    CHECK(g_gate.max_running == 2);
+    g_gate.release();
+    CHECK(httpd_stub_wait_completed(&c, WAIT_MS));
+    CHECK(httpd_stub_wait_completed(&d, WAIT_MS));
+    CHECK(c.status == "200 OK" && d.status == "200 OK");
+}
+
+// Both workers busy: a queued job past its timeout_ms is answered 503 unrun
+static void test_timeout()
+{
+    g_gate.reset();
+    httpd_req_t c, d, slow;
+    CHECK(call("/api/c", HTTP_GET, &c) == ESP_OK);
+    CHECK(call("/api/d", HTTP_GET, &d) == ESP_OK);
+    CHECK(g_gate.wait_entered(2));
+    CHECK(call("/api/slow", HTTP_GET, &slow) == ESP_OK);
+    CHECK(!slow.completed);
+
+    esp_timer_stub_offset_us += 100 * 1000;
+    g_gate.release();
+    CHECK(httpd_stub_wait_completed(&slow, WAIT_MS));
+    CHECK(slow.status.rfind("503", 0) == 0);
+    CHECK(g_slow_calls == 0);
+    CHECK(httpd_stub_wait_completed(&c, WAIT_MS));
+    CHECK(httpd_stub_wait_completed(&d, WAIT_MS));
+}
+
+static void test_stats()
+{
+    std::string stats = HttpRoutes::stats_json();
+    CHECK(stats.find("\"workers\":2") != std::string::npos);
+    CHECK(stats.find("\"uri\":\"/api/a\"") != std::string::npos);
+    CHECK(stats.find("\"group\":\"config\"") != std::string::npos);
+    CHECK(stats.find("\"rejected\":1") != std::string::npos);   // /api/b while /api/a ran
+    CHECK(stats.find("\"timeouts\":1") != std::string::npos);   // /api/slow
+}
+
+int main()
+{
+    CHECK(HttpRoutes::start_workers() == ESP_OK);
+    CHECK(HttpRoutes::register_routes(nullptr, routes, sizeof(routes) / sizeof(routes[0])) == ESP_OK);
+    CHECK(httpd_stub_uris.size() == sizeof(routes) / sizeof(routes[0]));
+
+    test_sync();
+    test_group();
+    test_parallel();
+    test_timeout();
+    test_stats();
+    return host_check_result("http_routes");
+}
@@ -0,0 +1,248 @@
+/*
+ * Host test and benchmark: TLZ image decoder (main/helpers/helper_img_tlz.hpp)
+ *
+ * Decodes the images written by tlz_fixtures.py line by line, as LVGL's
+ * draw code does, from a file and from a variable source, and compares the
+ * pixels with the source. Then times full redraws of the shipped
+ * flash_assets/bg images: one redraw opens the image and reads every line,
+ * which is what the device pays per frame with the LVGL image cache off.
+ *
+ * Usage: test_img_tlz FIXTURE_DIR [ASSET_DIR]
+ */
+
+#include "helper_img_tlz.hpp"
+#include "host_check.hpp"
+#include "host_fs_dir.hpp"
+#include <string>
+#include <vector>
+
+static std::vector<uint8_t> read_file(const std::string &path)
+{
+    std::vector<uint8_t> out;
+    FILE *f = fopen(path.c_str(), "rb");
+    if (!f) return out;
+    uint8_t buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.insert(out.end(), buf, buf + n);
+    fclose(f);
+    return out;
+}
+
+// Variable source over a .tlz file loaded into memory (as img2tlz --c-array)
+struct VarImage {
+    std::vector<uint8_t> bytes;
+    lv_img_dsc_t dsc;
+
+    explicit VarImage(const std::vector<uint8_t> &file) : bytes(file) {
+        memcpy(&dsc.header, bytes.data(), sizeof(lv_img_header_t));
+        dsc.data = bytes.data() + sizeof(lv_img_header_t);
+        dsc.data_size = (uint32_t)(bytes.size() - sizeof(lv_img_header_t));
+    }
+};
+
+struct Decoded {
+    lv_img_header_t header;
+    std::vector<uint8_t> pixels;
+    bool ok;
+};
+
+static uint8_t px_bytes(const lv_img_header_t &h)
+{
+    return h.cf == LV_IMG_CF_TRUE_COLOR_ALPHA ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t);
+}
+
+// One redraw: info, open, every line top to bottom, close
+static Decoded decode(const void *src)
+{
+    lv_img_decoder_t *dec = &lv_stub_img_decoder;
+    Decoded out = {};
+    if (dec->info_cb(dec, src, &out.header) != LV_RES_OK) return out;
+
+    lv_img_decoder_dsc_t dsc = {};
+    dsc.decoder = dec;
+    dsc.src = src;
+    dsc.src_type = lv_img_src_get_type(src);
+    dsc.header = out.header;
+    if (dec->open_cb(dec, &dsc) != LV_RES_OK) return out;
+
+    const size_t stride = (size_t)out.header.w * px_bytes(out.header);
+    out.pixels.resize(stride * out.header.h);
+    out.ok = true;
+    for (lv_coord_t y = 0; y < (lv_coord_t)out.header.h; y++) {
+        if (dec->read_line_cb(dec, &dsc, 0, y, out.header.w, out.pixels.data() + y * stride) != LV_RES_OK) {
+            out.ok = false;
+            break;
+        }
+    }
+    dec->close_cb(dec, &dsc);
+    return out;
+}
+
+// Expected decoder output for the source pixels of an RGB565 fixture
+static std::vector<uint8_t> expect_rgb565(const std::vector<uint8_t> &raw)
+{
+    std::vector<uint8_t> out(raw.size());
+    for (size_t i = 0; i + 1 < raw.size(); i += 2) {
+        uint16_t v = raw[i] | (raw[i + 1] << 8);
+        lv_color_t c;
+        c.full = LV_COLOR_16_SWAP ? (uint16_t)((v >> 8) | (v << 8)) : v;
+        memcpy(&out[i], &c, sizeof(c));
+    }
+    return out;
+}
+
+// ... and of an 8-bit palette fixture (B, G, R, A palette, then indices)
+static std::vector<uint8_t> expect_indexed(const std::vector<uint8_t> &raw)
+{
+    std::vector<uint8_t> out;
+    for (size_t i = 256 * 4; i < raw.size(); i++) {
+        const uint8_t *p = &raw[raw[i] * 4];
+        lv_color_t c = lv_color_make(p[2], p[1], p[0]);
+        out.insert(out.end(), (uint8_t *)&c, (uint8_t *)&c + sizeof(c));
+        out.push_back(p[3]);
+    }
+    return out;
+}
+
+static void check_fixture(const std::string &dir, const char *name, bool indexed)
+{
+    std::vector<uint8_t> raw = read_file(dir + "/" + name + ".raw");
+    std::vector<uint8_t> tlz = read_file(dir + "/" + name + ".tlz");
+    CHECK(!raw.empty() && !tlz.empty());
+    if (raw.empty() || tlz.empty()) return;
+    std::vector<uint8_t> want = indexed ? expect_indexed(raw) : expect_rgb565(raw);
+
+    std::string path = std::string("F:/") + name + ".tlz";
+    Decoded from_file = decode(path.c_str());
+    CHECK(from_file.ok);
+    CHECK(from_file.header.cf == (indexed ? LV_IMG_CF_TRUE_COLOR_ALPHA : LV_IMG_CF_TRUE_COLOR));
+    CHECK(from_file.pixels == want);
+
+    VarImage var(tlz);
+    Decoded from_var = decode(&var.dsc);
+    CHECK(from_var.ok);
+    CHECK(from_var.pixels == want);
+}
+
+// Partial lines in an order that jumps between bands, as invalidated areas do
+static void check_random_access(const std::string &dir)
+{
+    std::vector<uint8_t> raw = read_file(dir + "/grad565.raw");
+    std::vector<uint8_t> want = expect_rgb565(raw);
+    lv_img_decoder_t *dec = &lv_stub_img_decoder;
+
+    lv_img_decoder_dsc_t dsc = {};
+    dsc.decoder = dec;
+    dsc.src = "F:/grad565.tlz";
+    dsc.src_type = LV_IMG_SRC_FILE;
+    CHECK(dec->info_cb(dec, dsc.src, &dsc.header) == LV_RES_OK);
+    CHECK(dec->open_cb(dec, &dsc) == LV_RES_OK);
+    const int w = dsc.header.w, h = dsc.header.h;
+
+    uint32_t seed = 1;
+    for (int i = 0; i < 500; i++) {
+        seed = seed * 1103515245u + 12345u;
+        int y = (seed >> 8) % h;
+        int x = (seed >> 4) % w;
+        int len = 1 + (int)((seed >> 16) % (w - x));
+        std::vector<uint8_t> line(len * 2);
+        CHECK(dec->read_line_cb(dec, &dsc, x, y, len, line.data()) == LV_RES_OK);
+        CHECK(memcmp(line.data(), &want[(y * w + x) * 2], line.size()) == 0);
+    }
+
+    uint8_t line[2];
+    CHECK(dec->read_line_cb(dec, &dsc, 0, h, 1, line) == LV_RES_INV);     // Out of range
+    CHECK(dec->read_line_cb(dec, &dsc, w - 1, 0, 2, line) == LV_RES_INV);
+    dec->close_cb(dec, &dsc);
+}
+
+// A damaged band is reported, never written past the band buffer
+static void check_corrupt(const std::string &dir)
+{
+    VarImage var(read_file(dir + "/grad565.tlz"));
+    const uint8_t *payload = var.dsc.data;
+    uint32_t first_band = tlz_rd32(payload + TLZ_HEADER_LEN);
+    uint32_t second_band = tlz_rd32(payload + TLZ_HEADER_LEN + 4);
+    for (uint32_t i = first_band; i < second_band; i++) {
+        var.bytes[sizeof(lv_img_header_t) + i] = 0xFF;
+    }
+    Decoded d = decode(&var.dsc);
+    CHECK(!d.ok);
+
+    // Not a TLZ image at all
+    VarImage junk(std::vector<uint8_t>(64, 0x5A));
+    junk.dsc.header.cf = LV_IMG_CF_USER_ENCODED_0;
+    lv_img_header_t header;
+    CHECK(lv_stub_img_decoder.info_cb(&lv_stub_img_decoder, &junk.dsc, &header) == LV_RES_INV);
+}
+
+// Per-frame cost of a full redraw of each shipped image
+static void bench(const std::string &asset_dir, lv_fs_drv_t *drv)
+{
+    static const char *const images[] = { "bg/dev_bg9.tlz", "bg/tux-logo.tlz" };
+    const int frames = 20;
+
+    printf("\n%-18s %9s %11s %11s %11s %11s\n", "image", "size", "file us", "flash us", "inflate us", "memcpy us");
+    for (const char *name : images) {
+        std::vector<uint8_t> file = read_file(asset_dir + "/" + name);
+        if (file.empty()) {
+            printf("%-18s missing\n", name);
+            continue;
+        }
+        std::string path = std::string("S:/") + name;
+        VarImage var(file);
+        Decoded first = decode(path.c_str());
+        CHECK(first.ok);
+        CHECK(decode(&var.dsc).pixels == first.pixels);
+
+        // From a file through lv_fs (SPIFFS/SD path)
+        memset(&img_tlz_stats, 0, sizeof(img_tlz_stats));
+        uint32_t reads0 = host_fs_dir(drv)->reads;
+        int64_t t0 = esp_timer_get_time();
+        for (int i = 0; i < frames; i++) decode(path.c_str());
+        int64_t file_us = (esp_timer_get_time() - t0) / frames;
+        uint32_t reads = (host_fs_dir(drv)->reads - reads0) / frames;
+
+        // From the memory-mapped asset partition (variable source)
+        memset(&img_tlz_stats, 0, sizeof(img_tlz_stats));
+        t0 = esp_timer_get_time();
+        for (int i = 0; i < frames; i++) decode(&var.dsc);
+        int64_t var_us = (esp_timer_get_time() - t0) / frames;
+        int64_t inflate_us = (int64_t)(img_tlz_stats.decode_us / frames);
+
+        // Baseline: the same frame stored uncompressed, copied line by line
+        const size_t stride = first.pixels.size() / first.header.h;
+        std::vector<uint8_t> dst(stride);
+        t0 = esp_timer_get_time();
+        for (int i = 0; i < frames; i++) {
+            for (uint32_t y = 0; y < first.header.h; y++) memcpy(dst.data(), &first.pixels[y * stride], stride);
+        }
+        int64_t copy_us = (esp_timer_get_time() - t0) / frames;
+        CHECK(dst.size() == stride);
+
+        char dims[16];
+        snprintf(dims, sizeof(dims), "%ux%u", (unsigned)first.header.w, (unsigned)first.header.h);
+        printf("%-18s %9s %11lld %11lld %11lld %11lld   (%u drive reads/frame)\n", name, dims,
+               (long long)file_us, (long long)var_us, (long long)inflate_us, (long long)copy_us, reads);
+    }
+    img_tlz_log_stats();
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s FIXTURE_DIR [ASSET_DIR]\n", argv[0]);
+        return 2;
+    }
+    host_fs_dir_register('F', argv[1]);
+    img_tlz_init();
+
+    check_fixture(argv[1], "grad565", false);
+    check_fixture(argv[1], "flat565", false);
+    check_fixture(argv[1], "pal8a", true);
+    check_random_access(argv[1]);
+    check_corrupt(argv[1]);
+
+    if (argc > 2) bench(argv[2], host_fs_dir_register('S', argv[2]));
+    return host_check_result("img_tlz");
+}
@@ -0,0 +1,104 @@
+/*
+ * Host test: JSON writer (components/WebServer/JsonWriter.cpp)
+ *
+ * Checks separators and escaping against known output, a response longer
+ * than the chunk buffer, and that nesting past JSON_WRITER_MAX_DEPTH fails
+ * instead of sending JSON with the separators of the outer containers off.
+ */
+
+#include "JsonWriter.hpp"
+#include "host_check.hpp"
+#include <cmath>
+#include <string>
+
+static void test_shape()
+{
+    httpd_req_t req;
+    JsonWriter json(&req);
+    json.begin_object()
+        .str("name", "A1 \"mini\"\n")
+        .integer("n", -42)
+        .number("pi", 3.25)
+        .number("nan", NAN)
+        .boolean("ok", true)
+        .null("none")
+        .begin_array("list").integer(nullptr, 1).begin_object().end_object().integer(nullptr, 2).end_array()
+        .begin_object("empty").end_object()
+        .end_object();
+    CHECK(json.finish() == ESP_OK);
+    CHECK(req.type == "application/json");
+    CHECK(req.ended);
+    CHECK(req.body == "{\"name\":\"A1 \\\"mini\\\"\\n\",\"n\":-42,\"pi\":3.25,\"nan\":null,\"ok\":true,"
+                      "\"none\":null,\"list\":[1,{},2],\"empty\":{}}");
+}
+
+static void test_long()
+{
+    httpd_req_t req;
+    JsonWriter json(&req);
+    json.begin_array();
+    std::string expect = "[";
+    for (int i = 0; i < 1000; i++) {
+        json.integer(nullptr, i);
+        expect += (i ? "," : "") + std::to_string(i);
+    }
+    json.end_array();
+    expect += "]";
+    CHECK(json.finish() == ESP_OK);
+    CHECK(req.body == expect);
+    CHECK(req.chunks > 1);
+}
+
+// Deepest nesting that is allowed still comes out right
+static void test_max_depth()
+{
+    httpd_req_t req;
+    JsonWriter json(&req);
+    std::string expect;
+    for (int i = 1; i < JSON_WRITER_MAX_DEPTH; i++) {
+        json.begin_array();
+        json.integer(nullptr, i);
+        expect += (i > 1 ? ",[" : "[") + std::to_string(i);
+    }
+    for (int i = 1; i < JSON_WRITER_MAX_DEPTH; i++) {
+        json.end_array();
+        expect += "]";
+    }
+    CHECK(json.finish() == ESP_OK);
+    CHECK(req.body == expect);
+}
+
+// One level too deep: the error is reported and the response is not ended
+static void test_too_deep()
+{
+    httpd_req_t req;
+    JsonWriter json(&req);
+    json.begin_object();
+    for (int i = 0; i < JSON_WRITER_MAX_DEPTH; i++) json.begin_array("a");
+    for (int i = 0; i < JSON_WRITER_MAX_DEPTH; i++) json.end_array();
+    json.integer("after", 1);
+    json.end_object();
+    CHECK(json.finish() == ESP_ERR_INVALID_SIZE);
+    CHECK(!req.ended);
+}
+
+// A send error stops the writer and is what finish() reports
+static void test_send_error()
+{
+    httpd_req_t req;
+    req.fail_at = ESP_FAIL;
+    JsonWriter json(&req);
+    json.begin_object().str("k", "v").end_object();
+    CHECK(json.finish() == ESP_FAIL);
+    CHECK(req.body.empty());
+}
+
+int main()
+{
+    test_shape();
+    test_long();
+    test_max_depth();
+    test_too_deep();
+    test_send_error();
+    return host_check_result("json_writer");
+}
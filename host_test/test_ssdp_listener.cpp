@@ -0,0 +1,160 @@
+/*
+ * Host test: SSDP printer announcements (components/WebServer/SsdpListener.cpp)
+ *
+ * Parses the datagrams in fixtures/ssdp, then replays them over loopback to
+ * the real listener task on UDP 2021 and checks the printer table: one
+ * entry per serial, the sender address when there is no Location, byebye,
+ * expiry after max-age and after the TTL cap (by moving esp_timer ahead),
+ * non-Bambu devices ignored, and the table limit.
+ *
+ * Usage: test_ssdp_listener FIXTURE_DIR
+ */
+
+#include "SsdpListener.hpp"
+#include "host_check.hpp"
+#include "esp_timer.h"
+#include <lwip/sockets.h>
+#include <chrono>
+#include <string>
+#include <thread>
+
+static std::string fixture_dir;
+
+static std::string fixture(const char *name)
+{
+    std::string out;
+    FILE *f = fopen((fixture_dir + "/" + name).c_str(), "rb");
+    CHECK(f != NULL);
+    if (!f) return out;
+    char buf[1024];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.append(buf, n);
+    fclose(f);
+    return out;
+}
+
+static void send_udp(const std::string &msg)
+{
+    int s = socket(AF_INET, SOCK_DGRAM, 0);
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(2021);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    sendto(s, msg.data(), msg.size(), 0, (struct sockaddr *)&addr, sizeof(addr));
+    close(s);
+}
+
+// Wait for the listener task to catch up with what was sent
+static bool wait_for_count(size_t count)
+{
+    for (int i = 0; i < 200; i++) {
+        if (SsdpListener::printers().size() == count) return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return false;
+}
+
+static const PrinterDiscovery::PrinterInfo *find(const std::vector<PrinterDiscovery::PrinterInfo> &v,
+                                                 const char *serial)
+{
+    for (const auto &p : v) {
+        if (p.serial == serial) return &p;
+    }
+    return nullptr;
+}
+
+static void test_parse()
+{
+    PrinterDiscovery::PrinterInfo info;
+    int max_age;
+    bool byebye;
+    std::string p1s = fixture("p1s_notify.txt");
+    CHECK(SsdpListener::parse(p1s.data(), p1s.size(), info, &max_age, &byebye));
+    CHECK(info.serial == "01P00C123456789");
+    CHECK(info.ip_address == "192.168.1.42");
+    CHECK(info.model == "P1S");
+    CHECK(info.hostname == "Workshop P1S");
+    CHECK(max_age == 1800 && !byebye);
+
+    PrinterDiscovery::PrinterInfo x1c;
+    std::string msg = fixture("x1c_notify.txt");
+    CHECK(SsdpListener::parse(msg.data(), msg.size(), x1c, &max_age, &byebye));
+    CHECK(x1c.model == "X1C" && x1c.hostname == "X1C-Garage" && max_age == 60);
+
+    PrinterDiscovery::PrinterInfo bye;
+    msg = fixture("x1c_byebye.txt");
+    CHECK(SsdpListener::parse(msg.data(), msg.size(), bye, &max_age, &byebye));
+    CHECK(byebye && bye.serial == "00M09A350100999");
+
+    PrinterDiscovery::PrinterInfo other;
+    msg = fixture("media_renderer.txt");
+    CHECK(!SsdpListener::parse(msg.data(), msg.size(), other, &max_age, &byebye));
+    CHECK(!SsdpListener::parse("garbage", 7, other, &max_age, &byebye));
+    CHECK(!SsdpListener::parse(p1s.data(), 40, other, &max_age, &byebye));     // Cut before NT and USN
+    CHECK(SsdpListener::model_name("C13") == "X1E" && SsdpListener::model_name("Z9") == "Z9");
+}
+
+static void test_replay()
+{
+    CHECK(SsdpListener::start() == ESP_OK);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));   // Let the task bind
+
+    for (const char *name : {"p1s_notify.txt", "x1c_notify.txt", "a1_no_location.txt", "media_renderer.txt"}) {
+        send_udp(fixture(name));
+    }
+    CHECK(wait_for_count(3));
+    auto v = SsdpListener::printers();
+    const PrinterDiscovery::PrinterInfo *a1 = find(v, "03919C440100001");
+    CHECK(a1 && a1->ip_address == "127.0.0.1" && a1->model == "A1" && a1->hostname == "Bambu Lab A1");
+    CHECK(find(v, "01P00C123456789") && find(v, "01P00C123456789")->source == "ssdp");
+
+    // Repeated announcements refresh, not duplicate; the newest comes first
+    send_udp(fixture("p1s_notify.txt"));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    v = SsdpListener::printers();
+    CHECK(v.size() == 3 && v[0].serial == "01P00C123456789");
+
+    send_udp(fixture("x1c_byebye.txt"));
+    CHECK(wait_for_count(2));
+    CHECK(!find(SsdpListener::printers(), "00M09A350100999"));
+    send_udp(fixture("x1c_notify.txt"));
+    CHECK(wait_for_count(3));
+
+    // The X1C announced max-age=60; the P1S's 1800 is capped at 300 s, as is the A1's default
+    esp_timer_stub_offset_us = 61LL * 1000000;
+    v = SsdpListener::printers();
+    CHECK(v.size() == 2 && !find(v, "00M09A350100999"));
+    esp_timer_stub_offset_us = 301LL * 1000000;
+    CHECK(SsdpListener::printers().empty());
+
+    // Announcing again after expiry brings the printer back
+    send_udp(fixture("p1s_notify.txt"));
+    CHECK(wait_for_count(1));
+}
+
+static void test_table_limit()
+{
+    for (int k = 0; k < 20; k++) {
+        std::string msg = "NOTIFY * HTTP/1.1\r\nNT: urn:bambulab-com:device:3dprinter:1\r\nUSN: SER" +
+                          std::to_string(k) + "\r\nLocation: 10.0.0." + std::to_string(k) + "\r\n\r\n";
+        CHECK(SsdpListener::handle_datagram(msg.data(), msg.size(), "1.2.3.4"));
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    auto v = SsdpListener::printers();
+    CHECK(v.size() == 16);
+    CHECK(!v.empty() && v[0].serial == "SER19" && v[0].ip_address == "10.0.0.19");
+    CHECK(!find(v, "SER0") && !find(v, "SER3") && find(v, "SER4"));
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s FIXTURE_DIR\n", argv[0]);
+        return 2;
+    }
+    fixture_dir = argv[1];
+    test_parse();
+    test_replay();
+    test_table_limit();
+    return host_check_result("ssdp_listener");
+}
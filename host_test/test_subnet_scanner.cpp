@@ -0,0 +1,124 @@
+/*
+ * Host test: subnet scan (components/WebServer/SubnetScanner.cpp)
+ *
+ * Scans 127.0.0.1-254 over loopback with listeners on a few of those
+ * addresses, for several window sizes: exactly the listening hosts are
+ * found, each reported once through the callback, and progress counts up
+ * to the host count. A listener on another port, an invalid address and
+ * hosts that never answer (a listener whose backlog is full drops the SYN)
+ * are not reported, and the unanswered ones cost one timeout, not one each.
+ */
+
+#include "SubnetScanner.hpp"
+#include "host_check.hpp"
+#include "esp_timer.h"
+#include <lwip/sockets.h>
+#include <set>
+#include <string>
+#include <vector>
+
+static int listen_on(const char *ip, int port, int backlog)
+{
+    int s = socket(AF_INET, SOCK_STREAM, 0);
+    int one = 1;
+    setsockopt(s, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    inet_pton(AF_INET, ip, &addr.sin_addr);
+    if (bind(s, (struct sockaddr *)&addr, sizeof(addr)) != 0 || listen(s, backlog) != 0) {
+        perror(ip);
+        close(s);
+        return -1;
+    }
+    return s;
+}
+
+static int bound_port(int s)
+{
+    struct sockaddr_in addr = {};
+    socklen_t len = sizeof(addr);
+    getsockname(s, (struct sockaddr *)&addr, &len);
+    return ntohs(addr.sin_port);
+}
+
+static void test_loopback_scan()
+{
+    // First listener picks a free port, the others share it
+    int first = listen_on("127.0.0.3", 0, 64);
+    CHECK(first >= 0);
+    if (first < 0) return;
+    const int port = bound_port(first);
+    std::set<std::string> want = {"127.0.0.3"};
+    for (const char *ip : {"127.0.0.77", "127.0.0.200", "127.0.0.254"}) {
+        CHECK(listen_on(ip, port, 64) >= 0);
+        want.insert(ip);
+    }
+    CHECK(listen_on("127.0.0.9", port + 1 < 65536 ? port + 1 : port - 1, 4) >= 0);
+
+    std::vector<std::string> ips;
+    for (int i = 1; i < 255; i++) ips.push_back("127.0.0." + std::to_string(i));
+    ips.push_back("not-an-ip");
+
+    for (int window : {1, 16, 32}) {
+        SubnetScanner::Options opt;
+        opt.port = port;
+        opt.window = window;
+        opt.timeout_ms = 300;
+        std::multiset<std::string> reported;
+        int last = 0;
+        bool monotonic = true;
+        auto found = SubnetScanner::scan(ips, opt,
+            [&](const std::string &ip) { reported.insert(ip); },
+            [&](int done, int total) {
+                monotonic = monotonic && done > last && total == (int)ips.size();
+                last = done;
+            });
+        std::set<std::string> found_set(found.begin(), found.end());
+        CHECK(found.size() == want.size());
+        CHECK(found_set == want);
+        CHECK(std::set<std::string>(reported.begin(), reported.end()) == want);
+        CHECK(reported.size() == want.size());
+        CHECK(monotonic);
+        CHECK(last == (int)ips.size());
+    }
+}
+
+static void test_timeouts()
+{
+    // Backlog 0 and nobody accepting: once the queue holds one connection,
+    // further SYNs are dropped and those connects stay in progress
+    int s = listen_on("127.0.0.50", 0, 0);
+    CHECK(s >= 0);
+    if (s < 0) return;
+    const int port = bound_port(s);
+    int filler = socket(AF_INET, SOCK_STREAM, 0);
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    inet_pton(AF_INET, "127.0.0.50", &addr.sin_addr);
+    CHECK(connect(filler, (struct sockaddr *)&addr, sizeof(addr)) == 0);
+
+    std::vector<std::string> ips(20, "127.0.0.50");
+    SubnetScanner::Options opt;
+    opt.port = port;
+    opt.window = 20;
+    opt.timeout_ms = 300;
+    int64_t t0 = esp_timer_get_time();
+    auto found = SubnetScanner::scan(ips, opt);
+    int64_t ms = (esp_timer_get_time() - t0) / 1000;
+    printf("20 unanswered hosts, window 20: %lld ms\n", (long long)ms);
+    CHECK(found.empty());
+    CHECK(ms >= opt.timeout_ms - 10);
+    CHECK(ms < 3 * opt.timeout_ms);
+
+    close(filler);
+    close(s);
+}
+
+int main()
+{
+    test_loopback_scan();
+    test_timeouts();
+    return host_check_result("subnet_scanner");
+}
@@ -0,0 +1,183 @@
+/*
+ * Host test: UI message bus (main/helpers/helper_ui_bus.hpp)
+ *
+ * Replays the interleaving where a slot post coalesces into a slot whose
+ * first poster then finds the ring full, checks that a full ring drops plain
+ * messages but never slot payloads, and stress-tests the lock-free ring with
+ * several producer threads against a consumer: every plain message arrives
+ * once and in per-producer order, and each slot ends with its last payload
+ * delivered.
+ *
+ * Build with -DTUX_HOST_TSAN=ON to run it under ThreadSanitizer.
+ */
+
+#include <atomic>
+
+static std::atomic<uint32_t> gui_wakes(0);
+static void gui_wake() { gui_wakes++; }
+
+#include "helper_ui_bus.hpp"
+#include "host_check.hpp"
+#include <thread>
+#include <vector>
+
+static ui_msg_t call_msg(uintptr_t arg)
+{
+    ui_msg_t msg = {};
+    msg.type = ui_msg_type::CALL;
+    msg.call.arg = (void *)arg;
+    return msg;
+}
+
+static int drain(std::vector<ui_msg_t> &out)
+{
+    ui_msg_t msg;
+    int n = 0;
+    while (ui_bus_take(msg)) {
+        out.push_back(msg);
+        n++;
+    }
+    return n;
+}
+
+/* Poster B coalesces while poster A, which owns the token, finds the ring full */
+
+static bool coalesced_ok = false;
+
+static void post_b_hook(portMUX_TYPE *mux)
+{
+    if (mux != &ui_bus_slot_lock) return;
+    portmux_stub_exit_hook = NULL;
+    coalesced_ok = ui_bus_post_lv_msg(2, "B", UI_BUS_SLOT_PRINTER);
+}
+
+static void test_coalesced_into_full_ring()
+{
+    for (int i = 0; i < UI_BUS_RING_LEN; i++) CHECK(ui_bus_post(call_msg(i)));
+    CHECK(!ui_bus_post(call_msg(999)));
+    uint32_t dropped = ui_bus_dropped.load();
+    uint32_t coalesced = ui_bus_coalesced.load();
+
+    portmux_stub_exit_hook = post_b_hook;
+    bool a_ok = ui_bus_post_lv_msg(1, "A", UI_BUS_SLOT_PRINTER);
+    CHECK(portmux_stub_exit_hook == NULL);     // B ran between A's slot update and token push
+    CHECK(coalesced_ok);
+    CHECK(a_ok);
+    CHECK(ui_bus_coalesced.load() == coalesced + 1);
+    CHECK(ui_bus_dropped.load() == dropped);
+    CHECK(ui_bus_orphaned.load() == 1);
+    CHECK(ui_bus_pending());
+
+    // More posts to the orphaned slot coalesce as well
+    CHECK(ui_bus_post_lv_msg(3, "C", UI_BUS_SLOT_PRINTER));
+
+    std::vector<ui_msg_t> got;
+    drain(got);
+    CHECK(got.size() == UI_BUS_RING_LEN + 1);
+    for (int i = 0; i < UI_BUS_RING_LEN && i < (int)got.size(); i++) {
+        CHECK(got[i].type == ui_msg_type::CALL && (uintptr_t)got[i].call.arg == (uintptr_t)i);
+    }
+    if (got.size() == UI_BUS_RING_LEN + 1) {
+        CHECK(got.back().type == ui_msg_type::LV_MSG);
+        CHECK(got.back().lv_msg.id == 3 && strcmp(got.back().lv_msg.text, "C") == 0);
+    }
+    CHECK(!ui_bus_pending());
+    CHECK(!ui_bus_slot_pending[UI_BUS_SLOT_PRINTER]);
+
+    // The slot works normally again: one token, one delivery
+    CHECK(ui_bus_post_lv_msg(4, NULL, UI_BUS_SLOT_PRINTER));
+    CHECK(ui_bus_post_lv_msg(5, NULL, UI_BUS_SLOT_PRINTER));
+    CHECK(ui_bus_depth() == 1);
+    got.clear();
+    drain(got);
+    CHECK(got.size() == 1 && got[0].lv_msg.id == 5 && !got[0].lv_msg.has_text);
+}
+
+/* Producers against a live consumer */
+
+#define PRODUCERS       6
+#define POSTS           100000
+#define STRESS_SLOTS    3       // Two producers share each slot
+
+static void test_stress()
+{
+    std::atomic<int> running(PRODUCERS);
+    std::atomic<uint64_t> sent_sum(0), sent_count(0);
+    std::vector<std::thread> threads;
+    for (int p = 0; p < PRODUCERS; p++) {
+        threads.emplace_back([&, p] {
+            for (int i = 0; i < POSTS; i++) {
+                if (i % 3 == 0) {
+                    uint32_t id = (uint32_t)(p * POSTS + i);
+                    CHECK(ui_bus_post_lv_msg(id, NULL, UI_BUS_SLOT_WEATHER + p % STRESS_SLOTS));
+                    continue;
+                }
+                uintptr_t v = (uintptr_t)p * POSTS + i;
+                while (!ui_bus_post(call_msg(v))) std::this_thread::yield();
+                sent_sum += v;
+                sent_count++;
+            }
+            running--;
+        });
+    }
+
+    uint64_t sum = 0, count = 0;
+    std::vector<int> last_call(PRODUCERS, -1);
+    std::vector<uint32_t> last_slot_id(STRESS_SLOTS, UINT32_MAX);
+    bool order_ok = true, types_ok = true;
+    auto consume = [&](const ui_msg_t &msg) {
+        if (msg.type == ui_msg_type::CALL) {
+            uintptr_t v = (uintptr_t)msg.call.arg;
+            int p = (int)(v / POSTS), i = (int)(v % POSTS);
+            order_ok = order_ok && p < PRODUCERS && i > last_call[p];
+            if (p < PRODUCERS) last_call[p] = i;
+            sum += v;
+            count++;
+        } else if (msg.type == ui_msg_type::LV_MSG) {
+            int slot = (int)(msg.lv_msg.id / POSTS) % STRESS_SLOTS;
+            last_slot_id[slot] = msg.lv_msg.id;
+        } else {
+            types_ok = false;
+        }
+    };
+
+    ui_msg_t msg;
+    while (running > 0 || ui_bus_pending()) {
+        if (ui_bus_take(msg)) consume(msg);
+        else std::this_thread::yield();
+    }
+    for (auto &t : threads) t.join();
+    while (ui_bus_take(msg)) consume(msg);
+
+    CHECK(order_ok);
+    CHECK(types_ok);
+    CHECK(count == sent_count && sum == sent_sum);
+    for (int s = 0; s < STRESS_SLOTS; s++) {
+        // The last payload written to the slot is the last one delivered
+        CHECK(last_slot_id[s] == ui_bus_slots[UI_BUS_SLOT_WEATHER + s].lv_msg.id);
+    }
+    for (int s = 0; s < UI_BUS_SLOTS; s++) CHECK(!ui_bus_slot_pending[s] && !ui_bus_slot_orphan[s]);
+    CHECK(ui_bus_orphans.load() == 0);
+    printf("stress: %llu calls, %u coalesced, %u ring-full retries, %u orphaned slot posts, max depth %u\n",
+           (unsigned long long)count, ui_bus_coalesced.load(), ui_bus_dropped.load(),
+           ui_bus_orphaned.load(), ui_bus_stats.max_depth);
+}
+
+static void test_stats_json()
+{
+    cJSON *root = cJSON_CreateObject();
+    ui_bus_stats_json(root);
+    cJSON *bus = cJSON_GetObjectItem(root, "ui_bus");
+    CHECK(cJSON_IsNumber(cJSON_GetObjectItem(bus, "orphaned")));
+    CHECK(cJSON_GetObjectItem(bus, "capacity")->valueint == UI_BUS_RING_LEN);
+    cJSON_Delete(root);
+}
+
+int main()
+{
+    test_coalesced_into_full_ring();
+    test_stress();
+    test_stats_json();
+    CHECK(gui_wakes.load() > 0);
+    return host_check_result("ui_bus");
+}
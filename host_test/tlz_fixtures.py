@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+"""
+Writes the TLZ test images for test_img_tlz into the given directory.
+
+Each image is encoded with scripts/img2tlz.py and written as <name>.tlz
+next to <name>.raw, the source pixels the decoder has to reproduce:
+
+    grad565   RGB565 gradient with a noisy block, 16-row bands (last one short)
+    flat565   RGB565 single colour, 255-row bands (one band, long LZ4 runs)
+    pal8a     8-bit palette with a transparent entry, 7-row bands
+
+Usage: tlz_fixtures.py OUTPUT_DIR
+"""
+
+import os
+import random
+import struct
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "scripts"))
+import img2tlz  # noqa: E402
+
+
+def rgb565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def write(out_dir, name, cf, w, h, data, band_rows):
+    payload = img2tlz.encode(cf, w, h, data, band_rows)
+    with open(os.path.join(out_dir, name + ".tlz"), "wb") as f:
+        f.write(img2tlz.make_header(img2tlz.CF_USER_ENCODED_0, w, h))
+        f.write(payload)
+    with open(os.path.join(out_dir, name + ".raw"), "wb") as f:
+        f.write(data)
+
+
+def main():
+    out_dir = sys.argv[1]
+    os.makedirs(out_dir, exist_ok=True)
+    rng = random.Random(7)
+
+    w, h = 173, 61
+    px = []
+    for y in range(h):
+        for x in range(w):
+            if 40 <= x < 80 and 20 <= y < 40:
+                px.append(rng.getrandbits(16))
+            else:
+                px.append(rgb565(x * 255 // w, y * 255 // h, (x + y) & 0xFF))
+    write(out_dir, "grad565", img2tlz.CF_TRUE_COLOR, w, h, struct.pack("<%dH" % len(px), *px), 16)
+
+    w, h = 64, 200
+    write(out_dir, "flat565", img2tlz.CF_TRUE_COLOR, w, h,
+          struct.pack("<H", rgb565(30, 144, 255)) * (w * h), 255)
+
+    w, h = 50, 37
+    palette = bytearray(256 * 4)
+    colours = [(0, 0, 0, 0), (255, 0, 0, 255), (0, 255, 0, 128), (0, 0, 255, 255), (250, 250, 250, 255)]
+    for i, (r, g, b, a) in enumerate(colours):
+        palette[i * 4:i * 4 + 4] = bytes((b, g, r, a))  # LVGL order: B, G, R, A
+    idx = bytes((x // 10 + y) % len(colours) for y in range(h) for x in range(w))
+    write(out_dir, "pal8a", img2tlz.CF_INDEXED_8BIT, w, h, bytes(palette) + idx, 7)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
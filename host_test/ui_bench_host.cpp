@@ -0,0 +1,246 @@
+/*
+ * Host test: UI bench (main/gui.hpp, main/helpers/helper_ui_bench.hpp)
+ *
+ * Builds the real UI - gui.hpp, the carousel, tux_panel.c, the fonts and the
+ * settings page - against LVGL from the components/lvgl submodule, with a
+ * memory framebuffer as the display and a scripted finger as the touch panel.
+ * Runs the /api/perf/bench scenarios headless (build, swipe, theme switch,
+ * full rebuild, every language in fatfs/lang) and writes their PNGs, then
+ * swipes the restored home carousel by touch and saves the framebuffer.
+ *
+ * LVGL time is virtual: the tick is advanced by hand, so animations and
+ * timers run as fast as the host can draw.
+ *
+ *   ui_bench_host <png dir> [slides per type]     (run from the repo root)
+ */
+
+static const char *TAG = "ui_bench_host";
+
+#include <stdlib.h>
+#include <string.h>
+#include "lvgl/lvgl.h"
+#include "SettingsConfig.hpp"
+#include "esp_ota_ops.h"
+#include "helper_profiler.hpp"
+#include "helper_io_worker.hpp"
+
+SettingsConfig *cfg = nullptr;
+
+// SettingsConfig.cpp reports SD card errors to main.cpp
+extern "C" {
+void storage_health_record_sd_error(void) {}
+bool storage_backup_config_to_spiffs(void) { return true; }
+}
+
+/*
+ * Display stand-in: what helper_display.hpp provides to gui.hpp on the device,
+ * with a framebuffer in memory instead of the LovyanGFX panel
+ */
+#define HOST_HOR_RES    320         // WT32-SC01, portrait
+#define HOST_VER_RES    480
+#define HOST_TICK_MS    5           // GUI task period with the tickless mode off
+
+struct host_lcd_t {
+    uint8_t brightness = 128;
+    uint8_t getBrightness() const { return brightness; }
+    void setBrightness(uint8_t value) { brightness = value; }
+};
+
+static host_lcd_t lcd;
+static lv_disp_t *disp;
+static lv_theme_t *theme_current;
+static lv_color_t bg_theme_color;
+static lv_timer_t *gui_wake_timer = NULL;
+
+static lv_color_t host_fb[HOST_HOR_RES * HOST_VER_RES];
+static lv_color_t host_draw_px[HOST_HOR_RES * 40];
+static lv_disp_draw_buf_t host_draw_buf;
+static uint64_t host_flushed_px = 0;
+
+struct host_touch_t {
+    bool pressed = false;
+    lv_point_t point = {0, 0};
+};
+static host_touch_t host_touch;
+static void (*g_touch_callback)(void) = nullptr;
+
+// The harness is the LVGL task: there is no other thread to wake or lock out
+static void gui_wake() {}
+void lvgl_acquire(void) {}
+void lvgl_release(void) {}
+
+void set_touch_callback(void (*callback)(void))
+{
+    g_touch_callback = callback;
+}
+
+static void host_flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p)
+{
+    int32_t w = lv_area_get_width(area);
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        memcpy(&host_fb[y * HOST_HOR_RES + area->x1], color_p, w * sizeof(lv_color_t));
+        color_p += w;
+    }
+    host_flushed_px += (uint64_t)w * lv_area_get_height(area);
+    lv_disp_flush_ready(drv);
+}
+
+static void host_touch_read(lv_indev_drv_t *drv, lv_indev_data_t *data)
+{
+    data->point = host_touch.point;
+    data->state = host_touch.pressed ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+    if (host_touch.pressed && g_touch_callback) g_touch_callback();
+}
+
+static void host_display_init()
+{
+    lv_disp_draw_buf_init(&host_draw_buf, host_draw_px, NULL, sizeof(host_draw_px) / sizeof(host_draw_px[0]));
+
+    static lv_disp_drv_t disp_drv;
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.hor_res = HOST_HOR_RES;
+    disp_drv.ver_res = HOST_VER_RES;
+    disp_drv.flush_cb = host_flush;
+    disp_drv.draw_buf = &host_draw_buf;
+    disp = lv_disp_drv_register(&disp_drv);
+
+    static lv_indev_drv_t indev_drv;
+    lv_indev_drv_init(&indev_drv);
+    indev_drv.type = LV_INDEV_TYPE_POINTER;
+    indev_drv.read_cb = host_touch_read;
+    lv_indev_drv_register(&indev_drv);
+
+    prof_init();
+    theme_current = lv_theme_default_init(disp, lv_palette_main(LV_PALETTE_BLUE),
+                                          lv_palette_main(LV_PALETTE_RED),
+                                          LV_USE_THEME_DEFAULT, &font_montserrat_int_14);
+    bg_theme_color = lv_palette_darken(LV_PALETTE_GREY, 5);
+}
+
+// Run the LVGL timers over ms of virtual time
+static void host_run_ms(uint32_t ms)
+{
+    for (uint32_t t = 0; t < ms; t += HOST_TICK_MS) {
+        lv_tick_inc(HOST_TICK_MS);
+        lv_timer_handler();
+    }
+}
+
+#include "helper_ui_bus.hpp"
+
+// Device services gui.hpp calls; none of them apply on the host
+static const void *asset_img_src(const char *name, const void *fallback) { return fallback; }
+static esp_err_t wifi_prov_mgr_is_provisioned(bool *provisioned)
+{
+    *provisioned = false;
+    return ESP_OK;
+}
+static void wifi_prov_mgr_reset_provisioning() {}
+
+#include "gui.hpp"
+#include "helpers/helper_ui_bench.hpp"
+#include "pages/page_settings.hpp"
+#include "host_check.hpp"
+
+#define HOST_WEATHER_LOCATIONS 3
+
+// Filled in directly: load_config() and save_config() use /sdcard or /spiffs
+static void host_config()
+{
+    cfg = new SettingsConfig("");
+    cfg->CurrentTheme = "dark";
+    cfg->WeatherAPIkey = "host";
+    cfg->WeatherLocations = {
+        {"Home", "Kleve", "Germany", 51.79f, 6.14f, true},
+        {"Office", "Amsterdam", "Netherlands", 52.37f, 4.90f, true},
+        {"Lab", "Warsaw", "Poland", 52.23f, 21.01f, true},
+    };
+}
+
+static bool host_png_ok(const char *dir, const char *name)
+{
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%s.png", dir, name);
+    FILE *f = fopen(path, "rb");
+    if (!f) return false;
+    uint8_t sig[8] = {0};
+    bool ok = fread(sig, 1, sizeof(sig), f) == sizeof(sig) && memcmp(sig, "\x89PNG\r\n\x1a\n", 8) == 0;
+    fseek(f, 0, SEEK_END);
+    ok = ok && ftell(f) > (long)(HOST_HOR_RES * 3);
+    fclose(f);
+    return ok;
+}
+
+// What the panel shows: the framebuffer as written by the flush callback
+static bool host_fb_png(const char *dir, const char *name)
+{
+    lv_img_dsc_t img = {};
+    img.header.cf = LV_IMG_CF_TRUE_COLOR;
+    img.header.w = HOST_HOR_RES;
+    img.header.h = HOST_VER_RES;
+    img.data_size = sizeof(host_fb);
+    img.data = (const uint8_t *)host_fb;
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%s.png", dir, name);
+    return ui_bench_write_png(path, &img);
+}
+
+// Drag a finger across the screen, then let the scroll snap settle
+static void host_swipe(lv_coord_t from_x, lv_coord_t to_x, lv_coord_t y)
+{
+    const int steps = 12;
+    host_touch.pressed = true;
+    for (int i = 0; i <= steps; i++) {
+        host_touch.point.x = from_x + (to_x - from_x) * i / steps;
+        host_touch.point.y = y;
+        host_run_ms(LV_INDEV_DEF_READ_PERIOD);
+    }
+    host_touch.pressed = false;
+    host_run_ms(1000);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <png dir> [slides per type]\n", argv[0]);
+        return 2;
+    }
+    const char *png_dir = argv[1];
+    int per_type = argc > 2 ? atoi(argv[2]) : UI_BENCH_MAX_PER_TYPE;
+
+    host_config();
+    lv_init();
+    host_display_init();
+    lv_setup_styles();
+    ui_bus_start();
+    show_ui();
+    launch_settings();
+    host_run_ms(1500);                      // Screen fade-in
+    CHECK(carousel_widget != nullptr);
+    CHECK(host_flushed_px > 0);
+    if (!carousel_widget) return host_check_result("ui_bench");
+
+    // Bench scenarios, as GET /api/perf/bench runs them on the device
+    std::string report = ui_bench_run(per_type, png_dir);
+    printf("%s\n", report.c_str());
+    CHECK(report.find("\"error\"") == std::string::npos);
+    CHECK(report.find("\"name\":\"language\"") != std::string::npos);
+    CHECK(host_png_ok(png_dir, "build"));
+    CHECK(host_png_ok(png_dir, "theme"));
+    CHECK(host_png_ok(png_dir, "language"));
+    CHECK(lang_count() > 1);                // Packs from fatfs/lang
+    CHECK(get_language() == LANG_EN);       // Restored afterwards
+
+    // The restored carousel holds the configured weather slides; swipe by touch
+    host_run_ms(500);
+    CHECK(carousel_widget->slides.size() == HOST_WEATHER_LOCATIONS);
+    lv_obj_t *scroll = carousel_widget->scroll_container;
+    lv_coord_t w = lv_obj_get_width(scroll);
+    CHECK(carousel_widget->get_current_slide() == 0);
+    host_swipe(w * 4 / 5, w / 5, lv_obj_get_height(scroll) / 2);
+    CHECK(carousel_widget->get_current_slide() == 1);
+    CHECK(lv_obj_get_scroll_x(scroll) == w);
+    CHECK(host_fb_png(png_dir, "swipe_touch"));
+
+    return host_check_result("ui_bench");
+}
@@ -0,0 +1,22 @@
+/*
+ * Host UI bench: components/lv_conf.h, the configuration the LVGL library is
+ * built with on the device, with two host changes:
+ *   - a larger LVGL heap, since objects grow with 64-bit pointers (lv_mem
+ *     figures in the report are host sizes, not device sizes)
+ *   - a failed LVGL assert aborts the test instead of spinning
+ */
+
+#ifndef TUX_HOST_LV_CONF_H
+#define TUX_HOST_LV_CONF_H
+
+#include "../../components/lv_conf.h"
+
+#undef LV_MEM_SIZE
+#define LV_MEM_SIZE (192U * 1024U)
+
+#undef LV_ASSERT_HANDLER_INCLUDE
+#undef LV_ASSERT_HANDLER
+#define LV_ASSERT_HANDLER_INCLUDE <stdlib.h>
+#define LV_ASSERT_HANDLER abort();
+
+#endif // TUX_HOST_LV_CONF_H
@@ -0,0 +1,10 @@
+/*
+ * Host UI bench: the Kconfig options the UI code reads, at their defaults.
+ * CONFIG_TUX_LVGL_TICKLESS stays off: the bench drives lv_tick_inc() itself,
+ * so animations run on virtual time.
+ */
+
+#pragma once
+
+#define CONFIG_TUX_UI_IPC_BUDGET_US     4000
+#define CONFIG_TUX_LANG_GLYPH_CACHE_KB  16
@@ -1,7 +1,7 @@
 /*******************************************************************************
  * Size: 14 px
  * Bpp: 4
- * Opts: --no-compress --bpp 4 --size 14 --font Montserrat-Medium-static.ttf --range 0x20-0x7F,0x100-0x17F,0x400-0x4FF --symbols °•ąćęłńóśźżĄĆĘŁŃÓŚŹŻ --format lvgl -o font_montserrat_int_14.c
+ * Opts: --no-compress --bpp 4 --size 14 --font Montserrat-Medium-static.ttf --range 0x20-0x7F,0x100-0x17F --symbols °•ąćęłńóśźżĄĆĘŁŃÓŚŹŻ --format lvgl -o font_montserrat_int_14.c
  ******************************************************************************/
 
 #ifdef LV_LVGL_H_INCLUDE_SIMPLE
@@ -1858,1990 +1858,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0x4, 0xb0, 0x0, 0x4, 0xb0, 0x0, 0x4, 0xb0,
     0x0,
 
-    /* U+0400 "Ѐ" */
-    0x0, 0x72, 0x0, 0x0, 0x0, 0x3c, 0x10, 0x0,
-    0x0, 0x2, 0x50, 0x0, 0x5f, 0xff, 0xff, 0xf5,
-    0x5b, 0x0, 0x0, 0x0, 0x5b, 0x0, 0x0, 0x0,
-    0x5b, 0x0, 0x0, 0x0, 0x5b, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xb0, 0x5b, 0x0, 0x0, 0x0,
-    0x5b, 0x0, 0x0, 0x0, 0x5b, 0x0, 0x0, 0x0,
-    0x5b, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf8,
-
-    /* U+0401 "Ё" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb4, 0x3c, 0x0,
-    0x0, 0x10, 0x2, 0x0, 0x5f, 0xff, 0xff, 0xf5,
-    0x5b, 0x0, 0x0, 0x0, 0x5b, 0x0, 0x0, 0x0,
-    0x5b, 0x0, 0x0, 0x0, 0x5b, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xb0, 0x5b, 0x0, 0x0, 0x0,
-    0x5b, 0x0, 0x0, 0x0, 0x5b, 0x0, 0x0, 0x0,
-    0x5b, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf8,
-
-    /* U+0402 "Ђ" */
-    0xcf, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x6a,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x6a, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xa4, 0x89, 0x82, 0x0, 0x0, 0x6f, 0xb7, 0x69,
-    0xf4, 0x0, 0x6, 0xa0, 0x0, 0x5, 0xc0, 0x0,
-    0x6a, 0x0, 0x0, 0x1f, 0x0, 0x6, 0xa0, 0x0,
-    0x2, 0xe0, 0x0, 0x6a, 0x0, 0x1, 0xb9, 0x0,
-    0x6, 0xa0, 0x5f, 0xe9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0403 "Ѓ" */
-    0x0, 0x0, 0x45, 0x0, 0x0, 0x4c, 0x10, 0x0,
-    0x7, 0x0, 0x5, 0xff, 0xff, 0xfd, 0x5a, 0x0,
-    0x0, 0x5, 0xa0, 0x0, 0x0, 0x5a, 0x0, 0x0,
-    0x5, 0xa0, 0x0, 0x0, 0x5a, 0x0, 0x0, 0x5,
-    0xa0, 0x0, 0x0, 0x5a, 0x0, 0x0, 0x5, 0xa0,
-    0x0, 0x0, 0x5a, 0x0, 0x0, 0x5, 0xa0, 0x0,
-    0x0,
-
-    /* U+0404 "Є" */
-    0x0, 0x7, 0xdf, 0xeb, 0x30, 0x0, 0xbc, 0x30,
-    0x15, 0xe2, 0x6, 0xc0, 0x0, 0x0, 0x10, 0xd,
-    0x40, 0x0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xee, 0xee, 0xd0, 0x0, 0x1f, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x40, 0x0, 0x0, 0x0,
-    0x6, 0xc0, 0x0, 0x0, 0x10, 0x0, 0xbc, 0x30,
-    0x16, 0xe2, 0x0, 0x7, 0xdf, 0xeb, 0x30,
-
-    /* U+0405 "Ѕ" */
-    0x0, 0x8e, 0xfe, 0xa2, 0x0, 0x9a, 0x10, 0x16,
-    0x50, 0xf, 0x10, 0x0, 0x0, 0x0, 0xf2, 0x0,
-    0x0, 0x0, 0x8, 0xd5, 0x0, 0x0, 0x0, 0x6,
-    0xcf, 0xb5, 0x0, 0x0, 0x0, 0x16, 0xd8, 0x0,
-    0x0, 0x0, 0x2, 0xf0, 0x0, 0x0, 0x0, 0xf,
-    0x1, 0xe6, 0x0, 0x1a, 0xa0, 0x3, 0xae, 0xfe,
-    0x80, 0x0,
-
-    /* U+0406 "І" */
-    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x5a,
-
-    /* U+0407 "Ї" */
-    0x0, 0x0, 0xa6, 0x2d, 0x10, 0x2, 0x6, 0xa0,
-    0x6, 0xa0, 0x6, 0xa0, 0x6, 0xa0, 0x6, 0xa0,
-    0x6, 0xa0, 0x6, 0xa0, 0x6, 0xa0, 0x6, 0xa0,
-    0x6, 0xa0, 0x6, 0xa0,
-
-    /* U+0408 "Ј" */
-    0xb, 0xff, 0xfd, 0x0, 0x0, 0x2d, 0x0, 0x0,
-    0x2d, 0x0, 0x0, 0x2d, 0x0, 0x0, 0x2d, 0x0,
-    0x0, 0x2d, 0x0, 0x0, 0x2d, 0x0, 0x0, 0x2d,
-    0x10, 0x0, 0x4c, 0x89, 0x10, 0xb8, 0x9, 0xff,
-    0xa0,
-
-    /* U+0409 "Љ" */
-    0x0, 0x5f, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x59, 0x0, 0x0, 0xc7, 0x0, 0x0, 0x0,
-    0x0, 0x68, 0x0, 0x0, 0xc7, 0x0, 0x0, 0x0,
-    0x0, 0x68, 0x0, 0x0, 0xc7, 0x0, 0x0, 0x0,
-    0x0, 0x77, 0x0, 0x0, 0xcf, 0xee, 0xed, 0x70,
-    0x0, 0x76, 0x0, 0x0, 0xc7, 0x0, 0x2, 0xc7,
-    0x0, 0x95, 0x0, 0x0, 0xc7, 0x0, 0x0, 0x3e,
-    0x0, 0xb4, 0x0, 0x0, 0xc7, 0x0, 0x0, 0x1f,
-    0x0, 0xe1, 0x0, 0x0, 0xc7, 0x0, 0x0, 0x4d,
-    0x7, 0xc0, 0x0, 0x0, 0xc7, 0x0, 0x14, 0xd7,
-    0xce, 0x30, 0x0, 0x0, 0xcf, 0xff, 0xfd, 0x60,
-
-    /* U+040A "Њ" */
-    0x5a, 0x0, 0x0, 0x8, 0xc0, 0x0, 0x0, 0x0,
-    0x5a, 0x0, 0x0, 0x8, 0xc0, 0x0, 0x0, 0x0,
-    0x5a, 0x0, 0x0, 0x8, 0xc0, 0x0, 0x0, 0x0,
-    0x5a, 0x0, 0x0, 0x8, 0xc0, 0x0, 0x0, 0x0,
-    0x5a, 0x0, 0x0, 0x8, 0xc0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x0,
-    0x5a, 0x0, 0x0, 0x8, 0xc0, 0x0, 0x2b, 0xa0,
-    0x5a, 0x0, 0x0, 0x8, 0xc0, 0x0, 0x1, 0xf0,
-    0x5a, 0x0, 0x0, 0x8, 0xc0, 0x0, 0x1, 0xf0,
-    0x5a, 0x0, 0x0, 0x8, 0xc0, 0x0, 0x1a, 0x90,
-    0x5a, 0x0, 0x0, 0x8, 0xfe, 0xee, 0xe8, 0x0,
-
-    /* U+040B "Ћ" */
-    0xdf, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x6a,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x6a, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0xae, 0xfe,
-    0x80, 0x0, 0x6, 0xd5, 0x10, 0x3d, 0x80, 0x0,
-    0x6a, 0x0, 0x0, 0x3e, 0x0, 0x6, 0xa0, 0x0,
-    0x1, 0xf0, 0x0, 0x6a, 0x0, 0x0, 0x1f, 0x0,
-    0x6, 0xa0, 0x0, 0x1, 0xf0,
-
-    /* U+040C "Ќ" */
-    0x0, 0x0, 0x27, 0x0, 0x0, 0x0, 0x2c, 0x30,
-    0x0, 0x0, 0x5, 0x20, 0x0, 0x5, 0xa0, 0x0,
-    0x2, 0xe1, 0x5a, 0x0, 0x0, 0xc5, 0x5, 0xa0,
-    0x0, 0x7a, 0x0, 0x5a, 0x0, 0x2d, 0x10, 0x5,
-    0xa0, 0xc, 0x50, 0x0, 0x5f, 0xff, 0xd0, 0x0,
-    0x5, 0xa0, 0xc, 0x70, 0x0, 0x5a, 0x0, 0x2e,
-    0x20, 0x5, 0xa0, 0x0, 0x5c, 0x0, 0x5a, 0x0,
-    0x0, 0xa8, 0x5, 0xa0, 0x0, 0x1, 0xe3,
-
-    /* U+040D "Ѝ" */
-    0x0, 0x27, 0x0, 0x0, 0x0, 0x0, 0x7a, 0x0,
-    0x0, 0x0, 0x0, 0x43, 0x0, 0x5, 0xa0, 0x0,
-    0x0, 0x6e, 0x5a, 0x0, 0x0, 0x2f, 0xe5, 0xa0,
-    0x0, 0xc, 0x9e, 0x5a, 0x0, 0x7, 0xc2, 0xe5,
-    0xa0, 0x2, 0xe2, 0x2e, 0x5a, 0x0, 0xd6, 0x2,
-    0xe5, 0xa0, 0x8b, 0x0, 0x2e, 0x5a, 0x3e, 0x10,
-    0x2, 0xe5, 0xbd, 0x50, 0x0, 0x2e, 0x5f, 0xa0,
-    0x0, 0x2, 0xe5, 0xe0, 0x0, 0x0, 0x2e,
-
-    /* U+040E "Ў" */
-    0x0, 0x41, 0x0, 0x60, 0x0, 0x0, 0x67, 0x2,
-    0xb0, 0x0, 0x0, 0x8, 0xaa, 0x20, 0x0, 0x7a,
-    0x0, 0x0, 0x0, 0xe2, 0xe, 0x20, 0x0, 0x6,
-    0xa0, 0x7, 0x90, 0x0, 0xd, 0x20, 0x0, 0xe1,
-    0x0, 0x5a, 0x0, 0x0, 0x88, 0x0, 0xd2, 0x0,
-    0x0, 0x1e, 0x14, 0xa0, 0x0, 0x0, 0x8, 0x8c,
-    0x30, 0x0, 0x0, 0x1, 0xeb, 0x0, 0x0, 0x0,
-    0x0, 0xd3, 0x0, 0x0, 0x1, 0x8, 0xa0, 0x0,
-    0x0, 0x9, 0xfb, 0x10, 0x0, 0x0,
-
-    /* U+040F "Џ" */
-    0x5a, 0x0, 0x0, 0x6, 0xa5, 0xa0, 0x0, 0x0,
-    0x6a, 0x5a, 0x0, 0x0, 0x6, 0xa5, 0xa0, 0x0,
-    0x0, 0x6a, 0x5a, 0x0, 0x0, 0x6, 0xa5, 0xa0,
-    0x0, 0x0, 0x6a, 0x5a, 0x0, 0x0, 0x6, 0xa5,
-    0xa0, 0x0, 0x0, 0x6a, 0x5a, 0x0, 0x0, 0x6,
-    0xa5, 0xa0, 0x0, 0x0, 0x6a, 0x5f, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0xd, 0x20, 0x0, 0x0, 0x0,
-    0xd2, 0x0, 0x0, 0x0, 0x6, 0x10, 0x0,
-
-    /* U+0410 "А" */
-    0x0, 0x0, 0x8e, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xc5, 0x0, 0x0, 0x0, 0x5, 0xa4, 0xb0, 0x0,
-    0x0, 0x0, 0xb4, 0xe, 0x20, 0x0, 0x0, 0x2d,
-    0x0, 0x78, 0x0, 0x0, 0x8, 0x70, 0x1, 0xe0,
-    0x0, 0x0, 0xe1, 0x0, 0xb, 0x50, 0x0, 0x5f,
-    0xee, 0xee, 0xfc, 0x0, 0xc, 0x40, 0x0, 0x0,
-    0xe2, 0x3, 0xd0, 0x0, 0x0, 0x8, 0x90, 0x97,
-    0x0, 0x0, 0x0, 0x1e, 0x0,
-
-    /* U+0411 "Б" */
-    0x5f, 0xff, 0xff, 0xfc, 0x5, 0xa0, 0x0, 0x0,
-    0x0, 0x5a, 0x0, 0x0, 0x0, 0x5, 0xa0, 0x0,
-    0x0, 0x0, 0x5a, 0x0, 0x0, 0x0, 0x5, 0xfe,
-    0xee, 0xeb, 0x30, 0x5a, 0x0, 0x0, 0x5e, 0x15,
-    0xa0, 0x0, 0x0, 0xb6, 0x5a, 0x0, 0x0, 0xb,
-    0x55, 0xa0, 0x0, 0x5, 0xe1, 0x5f, 0xee, 0xee,
-    0xb2, 0x0,
-
-    /* U+0412 "В" */
-    0x5f, 0xee, 0xee, 0xa1, 0x5, 0xa0, 0x0, 0x9,
-    0xb0, 0x5a, 0x0, 0x0, 0xf, 0x5, 0xa0, 0x0,
-    0x0, 0xf0, 0x5a, 0x0, 0x0, 0x99, 0x5, 0xfd,
-    0xdd, 0xfd, 0x20, 0x5a, 0x0, 0x0, 0x3d, 0x25,
-    0xa0, 0x0, 0x0, 0x87, 0x5a, 0x0, 0x0, 0x8,
-    0x85, 0xa0, 0x0, 0x3, 0xe3, 0x5f, 0xee, 0xee,
-    0xc5, 0x0,
-
-    /* U+0413 "Г" */
-    0x5f, 0xff, 0xff, 0xd5, 0xa0, 0x0, 0x0, 0x5a,
-    0x0, 0x0, 0x5, 0xa0, 0x0, 0x0, 0x5a, 0x0,
-    0x0, 0x5, 0xa0, 0x0, 0x0, 0x5a, 0x0, 0x0,
-    0x5, 0xa0, 0x0, 0x0, 0x5a, 0x0, 0x0, 0x5,
-    0xa0, 0x0, 0x0, 0x5a, 0x0, 0x0, 0x0,
-
-    /* U+0414 "Д" */
-    0x0, 0x7f, 0xff, 0xff, 0xf3, 0x0, 0x7, 0x70,
-    0x0, 0xd, 0x30, 0x0, 0x86, 0x0, 0x0, 0xd3,
-    0x0, 0x8, 0x60, 0x0, 0xd, 0x30, 0x0, 0x95,
-    0x0, 0x0, 0xd3, 0x0, 0xa, 0x40, 0x0, 0xd,
-    0x30, 0x0, 0xb3, 0x0, 0x0, 0xd3, 0x0, 0xd,
-    0x10, 0x0, 0xd, 0x30, 0x1, 0xd0, 0x0, 0x0,
-    0xd3, 0x0, 0x97, 0x0, 0x0, 0xd, 0x30, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xad, 0x20, 0x0, 0x0,
-    0x0, 0x5a, 0xd2, 0x0, 0x0, 0x0, 0x5, 0xa5,
-    0x0, 0x0, 0x0, 0x0, 0x13,
-
-    /* U+0415 "Е" */
-    0x5f, 0xff, 0xff, 0xf5, 0x5b, 0x0, 0x0, 0x0,
-    0x5b, 0x0, 0x0, 0x0, 0x5b, 0x0, 0x0, 0x0,
-    0x5b, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xb0,
-    0x5b, 0x0, 0x0, 0x0, 0x5b, 0x0, 0x0, 0x0,
-    0x5b, 0x0, 0x0, 0x0, 0x5b, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xf8,
-
-    /* U+0416 "Ж" */
-    0x2e, 0x10, 0x0, 0x69, 0x0, 0x0, 0xd4, 0x8,
-    0x80, 0x0, 0x69, 0x0, 0x6, 0xb0, 0x0, 0xe2,
-    0x0, 0x69, 0x0, 0xe, 0x20, 0x0, 0x6a, 0x0,
-    0x69, 0x0, 0x88, 0x0, 0x0, 0xc, 0x30, 0x69,
-    0x2, 0xe0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0xe, 0x30, 0x69, 0x1, 0xe2,
-    0x0, 0x0, 0x8a, 0x0, 0x69, 0x0, 0x7b, 0x0,
-    0x2, 0xe1, 0x0, 0x69, 0x0, 0xd, 0x50, 0xc,
-    0x70, 0x0, 0x69, 0x0, 0x4, 0xe0, 0x5d, 0x0,
-    0x0, 0x69, 0x0, 0x0, 0xb8,
-
-    /* U+0417 "З" */
-    0x0, 0x58, 0x74, 0x0, 0x1e, 0xb8, 0x8c, 0xb0,
-    0x1, 0x0, 0x0, 0xb6, 0x0, 0x0, 0x0, 0x88,
-    0x0, 0x0, 0x2, 0xd3, 0x0, 0xae, 0xef, 0x70,
-    0x0, 0x0, 0x1, 0xa8, 0x0, 0x0, 0x0, 0x1e,
-    0x0, 0x0, 0x0, 0x3e, 0x5b, 0x41, 0x15, 0xe6,
-    0x4, 0xbe, 0xfc, 0x50, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0418 "И" */
-    0x5a, 0x0, 0x0, 0x6, 0xe5, 0xa0, 0x0, 0x2,
-    0xfe, 0x5a, 0x0, 0x0, 0xc9, 0xe5, 0xa0, 0x0,
-    0x7c, 0x2e, 0x5a, 0x0, 0x2e, 0x22, 0xe5, 0xa0,
-    0xd, 0x60, 0x2e, 0x5a, 0x8, 0xb0, 0x2, 0xe5,
-    0xa3, 0xe1, 0x0, 0x2e, 0x5b, 0xd5, 0x0, 0x2,
-    0xe5, 0xfa, 0x0, 0x0, 0x2e, 0x5e, 0x0, 0x0,
-    0x2, 0xe0,
-
-    /* U+0419 "Й" */
-    0x0, 0x42, 0x0, 0x60, 0x0, 0x5, 0x80, 0x1c,
-    0x0, 0x0, 0x7, 0xaa, 0x20, 0x5, 0xa0, 0x0,
-    0x0, 0x6e, 0x5a, 0x0, 0x0, 0x2f, 0xe5, 0xa0,
-    0x0, 0xc, 0x9e, 0x5a, 0x0, 0x7, 0xc2, 0xe5,
-    0xa0, 0x2, 0xe2, 0x2e, 0x5a, 0x0, 0xd6, 0x2,
-    0xe5, 0xa0, 0x8b, 0x0, 0x2e, 0x5a, 0x3e, 0x10,
-    0x2, 0xe5, 0xbd, 0x50, 0x0, 0x2e, 0x5f, 0xa0,
-    0x0, 0x2, 0xe5, 0xe0, 0x0, 0x0, 0x2e,
-
-    /* U+041A "К" */
-    0x5a, 0x0, 0x0, 0x2e, 0x15, 0xa0, 0x0, 0xc,
-    0x50, 0x5a, 0x0, 0x7, 0xa0, 0x5, 0xa0, 0x2,
-    0xd1, 0x0, 0x5a, 0x0, 0xc5, 0x0, 0x5, 0xff,
-    0xfd, 0x0, 0x0, 0x5a, 0x0, 0xc7, 0x0, 0x5,
-    0xa0, 0x2, 0xe2, 0x0, 0x5a, 0x0, 0x5, 0xc0,
-    0x5, 0xa0, 0x0, 0xa, 0x80, 0x5a, 0x0, 0x0,
-    0x1e, 0x30,
-
-    /* U+041B "Л" */
-    0x0, 0x5f, 0xff, 0xff, 0xf5, 0x0, 0x59, 0x0,
-    0x0, 0xb5, 0x0, 0x68, 0x0, 0x0, 0xb5, 0x0,
-    0x68, 0x0, 0x0, 0xb5, 0x0, 0x77, 0x0, 0x0,
-    0xb5, 0x0, 0x76, 0x0, 0x0, 0xb5, 0x0, 0x95,
-    0x0, 0x0, 0xb5, 0x0, 0xb4, 0x0, 0x0, 0xb5,
-    0x0, 0xe1, 0x0, 0x0, 0xb5, 0x7, 0xc0, 0x0,
-    0x0, 0xb5, 0xce, 0x30, 0x0, 0x0, 0xb5,
-
-    /* U+041C "М" */
-    0x5c, 0x0, 0x0, 0x0, 0x4, 0xd5, 0xf4, 0x0,
-    0x0, 0x0, 0xcd, 0x5f, 0xc0, 0x0, 0x0, 0x5f,
-    0xd5, 0xad, 0x40, 0x0, 0xd, 0x7d, 0x5a, 0x5d,
-    0x0, 0x5, 0xc2, 0xd5, 0xa0, 0xc5, 0x0, 0xd3,
-    0x2d, 0x5a, 0x3, 0xd0, 0x5b, 0x2, 0xd5, 0xa0,
-    0xa, 0x6d, 0x20, 0x2d, 0x5a, 0x0, 0x2f, 0x90,
-    0x2, 0xd5, 0xa0, 0x0, 0x71, 0x0, 0x2d, 0x5a,
-    0x0, 0x0, 0x0, 0x2, 0xd0,
-
-    /* U+041D "Н" */
-    0x5b, 0x0, 0x0, 0x3, 0xd5, 0xb0, 0x0, 0x0,
-    0x3d, 0x5b, 0x0, 0x0, 0x3, 0xd5, 0xb0, 0x0,
-    0x0, 0x3d, 0x5b, 0x0, 0x0, 0x3, 0xd5, 0xff,
-    0xff, 0xff, 0xfd, 0x5b, 0x0, 0x0, 0x3, 0xd5,
-    0xb0, 0x0, 0x0, 0x3d, 0x5b, 0x0, 0x0, 0x3,
-    0xd5, 0xb0, 0x0, 0x0, 0x3d, 0x5b, 0x0, 0x0,
-    0x3, 0xd0,
-
-    /* U+041E "О" */
-    0x0, 0x6, 0xcf, 0xfc, 0x50, 0x0, 0x0, 0xac,
-    0x40, 0x5, 0xd8, 0x0, 0x6, 0xc0, 0x0, 0x0,
-    0x1e, 0x40, 0xe, 0x30, 0x0, 0x0, 0x5, 0xc0,
-    0x1e, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x3d, 0x0,
-    0x0, 0x0, 0x0, 0xf1, 0x1e, 0x0, 0x0, 0x0,
-    0x0, 0xf0, 0xe, 0x30, 0x0, 0x0, 0x5, 0xc0,
-    0x6, 0xc0, 0x0, 0x0, 0x1e, 0x40, 0x0, 0xac,
-    0x40, 0x5, 0xd8, 0x0, 0x0, 0x6, 0xcf, 0xfc,
-    0x50, 0x0,
-
-    /* U+041F "П" */
-    0x5f, 0xff, 0xff, 0xff, 0xe5, 0xa0, 0x0, 0x0,
-    0x2e, 0x5a, 0x0, 0x0, 0x2, 0xe5, 0xa0, 0x0,
-    0x0, 0x2e, 0x5a, 0x0, 0x0, 0x2, 0xe5, 0xa0,
-    0x0, 0x0, 0x2e, 0x5a, 0x0, 0x0, 0x2, 0xe5,
-    0xa0, 0x0, 0x0, 0x2e, 0x5a, 0x0, 0x0, 0x2,
-    0xe5, 0xa0, 0x0, 0x0, 0x2e, 0x5a, 0x0, 0x0,
-    0x2, 0xe0,
-
-    /* U+0420 "Р" */
-    0x5f, 0xff, 0xfd, 0x70, 0x5, 0xb0, 0x0, 0x2b,
-    0x90, 0x5b, 0x0, 0x0, 0x1f, 0x15, 0xb0, 0x0,
-    0x0, 0xc4, 0x5b, 0x0, 0x0, 0xc, 0x45, 0xb0,
-    0x0, 0x1, 0xf1, 0x5b, 0x0, 0x2, 0xc9, 0x5,
-    0xff, 0xff, 0xd7, 0x0, 0x5b, 0x0, 0x0, 0x0,
-    0x5, 0xb0, 0x0, 0x0, 0x0, 0x5b, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0421 "С" */
-    0x0, 0x6, 0xcf, 0xfc, 0x50, 0x0, 0xad, 0x40,
-    0x4, 0xd4, 0x6, 0xd0, 0x0, 0x0, 0x10, 0xd,
-    0x40, 0x0, 0x0, 0x0, 0x1e, 0x0, 0x0, 0x0,
-    0x0, 0x2d, 0x0, 0x0, 0x0, 0x0, 0x1e, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x40, 0x0, 0x0, 0x0,
-    0x6, 0xd0, 0x0, 0x0, 0x10, 0x0, 0xad, 0x40,
-    0x5, 0xd4, 0x0, 0x6, 0xcf, 0xfc, 0x40,
-
-    /* U+0422 "Т" */
-    0xdf, 0xff, 0xff, 0xff, 0x10, 0x0, 0x6a, 0x0,
-    0x0, 0x0, 0x6, 0xa0, 0x0, 0x0, 0x0, 0x6a,
-    0x0, 0x0, 0x0, 0x6, 0xa0, 0x0, 0x0, 0x0,
-    0x6a, 0x0, 0x0, 0x0, 0x6, 0xa0, 0x0, 0x0,
-    0x0, 0x6a, 0x0, 0x0, 0x0, 0x6, 0xa0, 0x0,
-    0x0, 0x0, 0x6a, 0x0, 0x0, 0x0, 0x6, 0xa0,
-    0x0, 0x0,
-
-    /* U+0423 "У" */
-    0x7a, 0x0, 0x0, 0x0, 0xe2, 0xe, 0x20, 0x0,
-    0x6, 0xa0, 0x7, 0x90, 0x0, 0xd, 0x20, 0x0,
-    0xe1, 0x0, 0x5a, 0x0, 0x0, 0x88, 0x0, 0xd2,
-    0x0, 0x0, 0x1e, 0x14, 0xa0, 0x0, 0x0, 0x8,
-    0x8c, 0x30, 0x0, 0x0, 0x1, 0xeb, 0x0, 0x0,
-    0x0, 0x0, 0xd3, 0x0, 0x0, 0x1, 0x8, 0xa0,
-    0x0, 0x0, 0x9, 0xfb, 0x10, 0x0, 0x0,
-
-    /* U+0424 "Ф" */
-    0x0, 0x0, 0x1, 0xe0, 0x0, 0x0, 0x0, 0x1,
-    0x7c, 0xef, 0xdb, 0x60, 0x0, 0x2, 0xe8, 0x21,
-    0xe0, 0x39, 0xd1, 0x0, 0xd5, 0x0, 0x1e, 0x0,
-    0x7, 0xa0, 0x3d, 0x0, 0x1, 0xe0, 0x0, 0xf,
-    0x4, 0xb0, 0x0, 0x1e, 0x0, 0x0, 0xe2, 0x3d,
-    0x0, 0x1, 0xe0, 0x0, 0xf, 0x0, 0xd5, 0x0,
-    0x1e, 0x0, 0x7, 0xa0, 0x2, 0xe8, 0x21, 0xe0,
-    0x39, 0xd1, 0x0, 0x1, 0x7c, 0xef, 0xdb, 0x60,
-    0x0, 0x0, 0x0, 0x1, 0xe0, 0x0, 0x0, 0x0,
-
-    /* U+0425 "Х" */
-    0x2e, 0x10, 0x0, 0x1e, 0x30, 0x8b, 0x0, 0xa,
-    0x90, 0x0, 0xd5, 0x4, 0xe0, 0x0, 0x3, 0xe1,
-    0xe5, 0x0, 0x0, 0x9, 0xea, 0x0, 0x0, 0x0,
-    0x4f, 0x60, 0x0, 0x0, 0xd, 0xae, 0x0, 0x0,
-    0x7, 0xb0, 0xa9, 0x0, 0x2, 0xe2, 0x1, 0xe3,
-    0x0, 0xb7, 0x0, 0x6, 0xd0, 0x6c, 0x0, 0x0,
-    0xb, 0x70,
-
-    /* U+0426 "Ц" */
-    0x5a, 0x0, 0x0, 0x6, 0xa0, 0x5, 0xa0, 0x0,
-    0x0, 0x6a, 0x0, 0x5a, 0x0, 0x0, 0x6, 0xa0,
-    0x5, 0xa0, 0x0, 0x0, 0x6a, 0x0, 0x5a, 0x0,
-    0x0, 0x6, 0xa0, 0x5, 0xa0, 0x0, 0x0, 0x6a,
-    0x0, 0x5a, 0x0, 0x0, 0x6, 0xa0, 0x5, 0xa0,
-    0x0, 0x0, 0x6a, 0x0, 0x5a, 0x0, 0x0, 0x6,
-    0xa0, 0x5, 0xa0, 0x0, 0x0, 0x6a, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0xc2, 0x0, 0x0, 0x0, 0x0, 0xc, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x61,
-
-    /* U+0427 "Ч" */
-    0x2d, 0x0, 0x0, 0x7, 0x92, 0xd0, 0x0, 0x0,
-    0x79, 0x2d, 0x0, 0x0, 0x7, 0x92, 0xd0, 0x0,
-    0x0, 0x79, 0x1f, 0x10, 0x0, 0x7, 0x90, 0xab,
-    0x20, 0x15, 0xc9, 0x0, 0x8e, 0xfe, 0xaa, 0x90,
-    0x0, 0x0, 0x0, 0x79, 0x0, 0x0, 0x0, 0x7,
-    0x90, 0x0, 0x0, 0x0, 0x79, 0x0, 0x0, 0x0,
-    0x7, 0x90,
-
-    /* U+0428 "Ш" */
-    0x5a, 0x0, 0x0, 0xd2, 0x0, 0x5, 0xa5, 0xa0,
-    0x0, 0xd, 0x20, 0x0, 0x5a, 0x5a, 0x0, 0x0,
-    0xd2, 0x0, 0x5, 0xa5, 0xa0, 0x0, 0xd, 0x20,
-    0x0, 0x5a, 0x5a, 0x0, 0x0, 0xd2, 0x0, 0x5,
-    0xa5, 0xa0, 0x0, 0xd, 0x20, 0x0, 0x5a, 0x5a,
-    0x0, 0x0, 0xd2, 0x0, 0x5, 0xa5, 0xa0, 0x0,
-    0xd, 0x20, 0x0, 0x5a, 0x5a, 0x0, 0x0, 0xd2,
-    0x0, 0x5, 0xa5, 0xa0, 0x0, 0xd, 0x20, 0x0,
-    0x5a, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-
-    /* U+0429 "Щ" */
-    0x5a, 0x0, 0x0, 0xd2, 0x0, 0x5, 0xa0, 0x5,
-    0xa0, 0x0, 0xd, 0x20, 0x0, 0x5a, 0x0, 0x5a,
-    0x0, 0x0, 0xd2, 0x0, 0x5, 0xa0, 0x5, 0xa0,
-    0x0, 0xd, 0x20, 0x0, 0x5a, 0x0, 0x5a, 0x0,
-    0x0, 0xd2, 0x0, 0x5, 0xa0, 0x5, 0xa0, 0x0,
-    0xd, 0x20, 0x0, 0x5a, 0x0, 0x5a, 0x0, 0x0,
-    0xd2, 0x0, 0x5, 0xa0, 0x5, 0xa0, 0x0, 0xd,
-    0x20, 0x0, 0x5a, 0x0, 0x5a, 0x0, 0x0, 0xd2,
-    0x0, 0x5, 0xa0, 0x5, 0xa0, 0x0, 0xd, 0x20,
-    0x0, 0x5a, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x61,
-
-    /* U+042A "Ъ" */
-    0xdf, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0xc3,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0xc3, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xee, 0xee, 0xc6, 0x0, 0x0, 0xc3, 0x0, 0x3,
-    0xd5, 0x0, 0xc, 0x30, 0x0, 0x5, 0xc0, 0x0,
-    0xc3, 0x0, 0x0, 0x2d, 0x0, 0xc, 0x30, 0x0,
-    0x5, 0xb0, 0x0, 0xc3, 0x0, 0x2, 0xd5, 0x0,
-    0xc, 0xee, 0xee, 0xc5, 0x0,
-
-    /* U+042B "Ы" */
-    0x5a, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x5a, 0x0,
-    0x0, 0x0, 0x0, 0xf0, 0x5a, 0x0, 0x0, 0x0,
-    0x0, 0xf0, 0x5a, 0x0, 0x0, 0x0, 0x0, 0xf0,
-    0x5f, 0xee, 0xee, 0xa1, 0x0, 0xf0, 0x5a, 0x0,
-    0x1, 0x8d, 0x0, 0xf0, 0x5a, 0x0, 0x0, 0xd,
-    0x30, 0xf0, 0x5a, 0x0, 0x0, 0xb, 0x40, 0xf0,
-    0x5a, 0x0, 0x0, 0xe, 0x30, 0xf0, 0x5a, 0x0,
-    0x0, 0x8c, 0x0, 0xf0, 0x5f, 0xee, 0xee, 0x91,
-    0x0, 0xf0,
-
-    /* U+042C "Ь" */
-    0x5a, 0x0, 0x0, 0x0, 0x5, 0xa0, 0x0, 0x0,
-    0x0, 0x5a, 0x0, 0x0, 0x0, 0x5, 0xa0, 0x0,
-    0x0, 0x0, 0x5f, 0xee, 0xee, 0xa1, 0x5, 0xa0,
-    0x0, 0x18, 0xd0, 0x5a, 0x0, 0x0, 0xd, 0x35,
-    0xa0, 0x0, 0x0, 0xb4, 0x5a, 0x0, 0x0, 0xe,
-    0x35, 0xa0, 0x0, 0x8, 0xc0, 0x5f, 0xee, 0xee,
-    0x91, 0x0,
-
-    /* U+042D "Э" */
-    0x4, 0xbf, 0xfc, 0x60, 0x0, 0x4e, 0x50, 0x4,
-    0xd9, 0x0, 0x1, 0x0, 0x0, 0x1e, 0x50, 0x0,
-    0x0, 0x0, 0x6, 0xc0, 0x0, 0x0, 0x0, 0x1,
-    0xf0, 0x0, 0xe, 0xee, 0xee, 0xf0, 0x0, 0x0,
-    0x0, 0x1, 0xf0, 0x0, 0x0, 0x0, 0x5, 0xc0,
-    0x1, 0x0, 0x0, 0x1e, 0x50, 0x4d, 0x50, 0x4,
-    0xd9, 0x0, 0x4, 0xbf, 0xfc, 0x60, 0x0,
-
-    /* U+042E "Ю" */
-    0x5a, 0x0, 0x0, 0x8d, 0xee, 0x91, 0x0, 0x5a,
-    0x0, 0xc, 0x91, 0x0, 0x7d, 0x10, 0x5a, 0x0,
-    0x99, 0x0, 0x0, 0x7, 0xb0, 0x5a, 0x0, 0xf1,
-    0x0, 0x0, 0x0, 0xe2, 0x5a, 0x3, 0xc0, 0x0,
-    0x0, 0x0, 0xa6, 0x5f, 0xef, 0xb0, 0x0, 0x0,
-    0x0, 0x97, 0x5b, 0x15, 0xc0, 0x0, 0x0, 0x0,
-    0xa6, 0x5a, 0x0, 0xf1, 0x0, 0x0, 0x0, 0xe2,
-    0x5a, 0x0, 0x99, 0x0, 0x0, 0x7, 0xb0, 0x5a,
-    0x0, 0xc, 0x91, 0x0, 0x7d, 0x10, 0x5a, 0x0,
-    0x0, 0x8d, 0xee, 0x91, 0x0,
-
-    /* U+042F "Я" */
-    0x0, 0x5d, 0xff, 0xff, 0x90, 0x5d, 0x30, 0x0,
-    0x69, 0xd, 0x40, 0x0, 0x6, 0x90, 0xf0, 0x0,
-    0x0, 0x69, 0xf, 0x0, 0x0, 0x6, 0x90, 0xd3,
-    0x0, 0x0, 0x69, 0x6, 0xd3, 0x0, 0x6, 0x90,
-    0x6, 0xff, 0xff, 0xf9, 0x0, 0x6b, 0x0, 0x6,
-    0x90, 0x1e, 0x10, 0x0, 0x69, 0xb, 0x50, 0x0,
-    0x6, 0x90,
-
-    /* U+0430 "а" */
-    0x5, 0xcf, 0xea, 0x10, 0x72, 0x0, 0x99, 0x0,
-    0x0, 0x1, 0xe0, 0x4b, 0xcc, 0xdf, 0x1e, 0x20,
-    0x1, 0xf3, 0xc0, 0x0, 0x2f, 0x1e, 0x10, 0xa,
-    0xf0, 0x4d, 0xcc, 0x4f,
-
-    /* U+0431 "б" */
-    0x0, 0x0, 0x4, 0x8c, 0x0, 0x1, 0x9e, 0xb7,
-    0x30, 0x0, 0xc8, 0x0, 0x0, 0x0, 0x79, 0x0,
-    0x0, 0x0, 0xc, 0x39, 0xee, 0x91, 0x0, 0xfb,
-    0x50, 0x19, 0xc0, 0xf, 0x70, 0x0, 0xd, 0x40,
-    0xf2, 0x0, 0x0, 0x87, 0xe, 0x30, 0x0, 0x8,
-    0x70, 0xa7, 0x0, 0x0, 0xd4, 0x2, 0xe4, 0x0,
-    0x9b, 0x0, 0x4, 0xce, 0xe9, 0x0,
-
-    /* U+0432 "в" */
-    0x9e, 0xdd, 0xd9, 0x9, 0x60, 0x0, 0xc4, 0x96,
-    0x0, 0xc, 0x29, 0xdc, 0xce, 0x90, 0x96, 0x0,
-    0xb, 0x59, 0x60, 0x0, 0x69, 0x96, 0x0, 0xa,
-    0x79, 0xed, 0xde, 0x90,
-
-    /* U+0433 "г" */
-    0x9f, 0xff, 0xf9, 0x96, 0x0, 0x0, 0x96, 0x0,
-    0x0, 0x96, 0x0, 0x0, 0x96, 0x0, 0x0, 0x96,
-    0x0, 0x0, 0x96, 0x0, 0x0, 0x96, 0x0, 0x0,
-
-    /* U+0434 "д" */
-    0x0, 0xff, 0xff, 0xf7, 0x0, 0xe, 0x0, 0x8,
-    0x70, 0x1, 0xd0, 0x0, 0x87, 0x0, 0x2c, 0x0,
-    0x8, 0x70, 0x3, 0xb0, 0x0, 0x87, 0x0, 0x69,
-    0x0, 0x8, 0x70, 0xb, 0x30, 0x0, 0x87, 0xd,
-    0xfe, 0xee, 0xef, 0xf8, 0xe1, 0x0, 0x0, 0x5,
-    0x9e, 0x10, 0x0, 0x0, 0x59,
-
-    /* U+0435 "е" */
-    0x0, 0x7e, 0xec, 0x40, 0x8, 0xa1, 0x3, 0xd3,
-    0x1e, 0x0, 0x0, 0x4b, 0x4f, 0xcc, 0xcc, 0xcc,
-    0x4b, 0x0, 0x0, 0x0, 0x1e, 0x10, 0x0, 0x0,
-    0x8, 0xc2, 0x1, 0xb3, 0x0, 0x6d, 0xfe, 0x70,
-
-    /* U+0436 "ж" */
-    0x4c, 0x0, 0xb, 0x40, 0x3, 0xd0, 0xb, 0x50,
-    0xb, 0x40, 0xc, 0x40, 0x2, 0xd0, 0xb, 0x40,
-    0x5b, 0x0, 0x0, 0x96, 0xb, 0x40, 0xd3, 0x0,
-    0x0, 0x5f, 0xef, 0xfe, 0xd0, 0x0, 0x1, 0xd4,
-    0xb, 0x40, 0xb8, 0x0, 0xa, 0x80, 0xb, 0x40,
-    0x1e, 0x30, 0x6c, 0x0, 0xb, 0x40, 0x3, 0xe1,
-
-    /* U+0437 "з" */
-    0x19, 0xef, 0xd7, 0x0, 0x40, 0x2, 0xd5, 0x0,
-    0x0, 0xc, 0x30, 0x8, 0xcf, 0x80, 0x0, 0x0,
-    0xb, 0x60, 0x0, 0x0, 0x69, 0x56, 0x0, 0x2d,
-    0x52, 0xae, 0xed, 0x60,
-
-    /* U+0438 "и" */
-    0x96, 0x0, 0x2, 0xe3, 0x96, 0x0, 0xc, 0xf3,
-    0x96, 0x0, 0x98, 0xc3, 0x96, 0x6, 0xc0, 0xc3,
-    0x96, 0x3d, 0x10, 0xc3, 0x97, 0xd3, 0x0, 0xc3,
-    0x9f, 0x70, 0x0, 0xc3, 0x9b, 0x0, 0x0, 0xc3,
-
-    /* U+0439 "й" */
-    0x3, 0x80, 0x1b, 0x0, 0x0, 0x7a, 0xa2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x96, 0x0, 0x2, 0xe3,
-    0x96, 0x0, 0xc, 0xf3, 0x96, 0x0, 0x98, 0xc3,
-    0x96, 0x6, 0xc0, 0xc3, 0x96, 0x3d, 0x10, 0xc3,
-    0x97, 0xd3, 0x0, 0xc3, 0x9f, 0x70, 0x0, 0xc3,
-    0x9b, 0x0, 0x0, 0xc3,
-
-    /* U+043A "к" */
-    0x96, 0x0, 0xa, 0x79, 0x60, 0x4, 0xc0, 0x96,
-    0x0, 0xd2, 0x9, 0x60, 0x97, 0x0, 0x9f, 0xef,
-    0x10, 0x9, 0x60, 0x6c, 0x0, 0x96, 0x0, 0x8b,
-    0x9, 0x60, 0x0, 0xa8,
-
-    /* U+043B "л" */
-    0x0, 0xff, 0xff, 0xf7, 0x0, 0xe0, 0x0, 0x97,
-    0x1, 0xd0, 0x0, 0x97, 0x1, 0xc0, 0x0, 0x97,
-    0x3, 0xb0, 0x0, 0x97, 0x5, 0x80, 0x0, 0x97,
-    0xa, 0x50, 0x0, 0x97, 0xcb, 0x0, 0x0, 0x97,
-
-    /* U+043C "м" */
-    0x9b, 0x0, 0x0, 0x8, 0xa9, 0xf3, 0x0, 0x2,
-    0xfa, 0x98, 0xc0, 0x0, 0xa8, 0xa9, 0x5a, 0x50,
-    0x3b, 0x4a, 0x95, 0x1d, 0xc, 0x24, 0xa9, 0x50,
-    0x8b, 0x90, 0x4a, 0x95, 0x0, 0xd1, 0x4, 0xa9,
-    0x50, 0x0, 0x0, 0x4a,
-
-    /* U+043D "н" */
-    0x96, 0x0, 0x0, 0xf0, 0x96, 0x0, 0x0, 0xf0,
-    0x96, 0x0, 0x0, 0xf0, 0x96, 0x0, 0x0, 0xf0,
-    0x9f, 0xee, 0xee, 0xf0, 0x96, 0x0, 0x0, 0xf0,
-    0x96, 0x0, 0x0, 0xf0, 0x96, 0x0, 0x0, 0xf0,
-
-    /* U+043E "о" */
-    0x0, 0x7e, 0xfd, 0x60, 0x0, 0x8b, 0x20, 0x2d,
-    0x60, 0x1e, 0x10, 0x0, 0x2e, 0x4, 0xb0, 0x0,
-    0x0, 0xd2, 0x4c, 0x0, 0x0, 0xd, 0x21, 0xe1,
-    0x0, 0x2, 0xe0, 0x8, 0xc2, 0x2, 0xd6, 0x0,
-    0x7, 0xdf, 0xd6, 0x0,
-
-    /* U+043F "п" */
-    0x9f, 0xff, 0xff, 0xf0, 0x96, 0x0, 0x0, 0xf0,
-    0x96, 0x0, 0x0, 0xf0, 0x96, 0x0, 0x0, 0xf0,
-    0x96, 0x0, 0x0, 0xf0, 0x96, 0x0, 0x0, 0xf0,
-    0x96, 0x0, 0x0, 0xf0, 0x96, 0x0, 0x0, 0xf0,
-
-    /* U+0440 "р" */
-    0x96, 0x8e, 0xfc, 0x30, 0x9d, 0x80, 0x5, 0xe2,
-    0x9b, 0x0, 0x0, 0x7a, 0x97, 0x0, 0x0, 0x2d,
-    0x97, 0x0, 0x0, 0x2d, 0x9b, 0x0, 0x0, 0x7a,
-    0x9e, 0x80, 0x5, 0xe2, 0x96, 0x8e, 0xfc, 0x30,
-    0x96, 0x0, 0x0, 0x0, 0x96, 0x0, 0x0, 0x0,
-    0x96, 0x0, 0x0, 0x0,
-
-    /* U+0441 "с" */
-    0x0, 0x7d, 0xfd, 0x60, 0x8, 0xc2, 0x2, 0xc2,
-    0x1e, 0x10, 0x0, 0x0, 0x4b, 0x0, 0x0, 0x0,
-    0x4b, 0x0, 0x0, 0x0, 0x1e, 0x10, 0x0, 0x0,
-    0x8, 0xc2, 0x2, 0xc2, 0x0, 0x6d, 0xfd, 0x60,
-
-    /* U+0442 "т" */
-    0xef, 0xff, 0xff, 0x80, 0x3, 0xd0, 0x0, 0x0,
-    0x3d, 0x0, 0x0, 0x3, 0xd0, 0x0, 0x0, 0x3d,
-    0x0, 0x0, 0x3, 0xd0, 0x0, 0x0, 0x3d, 0x0,
-    0x0, 0x3, 0xd0, 0x0,
-
-    /* U+0443 "у" */
-    0xa, 0x50, 0x0, 0x8, 0x70, 0x4c, 0x0, 0x0,
-    0xe1, 0x0, 0xd2, 0x0, 0x5a, 0x0, 0x6, 0x90,
-    0xb, 0x30, 0x0, 0xe, 0x2, 0xc0, 0x0, 0x0,
-    0x96, 0x86, 0x0, 0x0, 0x2, 0xdd, 0x0, 0x0,
-    0x0, 0xc, 0x90, 0x0, 0x0, 0x0, 0xd2, 0x0,
-    0x0, 0x40, 0x6b, 0x0, 0x0, 0x1c, 0xec, 0x10,
-    0x0, 0x0,
-
-    /* U+0444 "ф" */
-    0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x0, 0x0,
-    0x0, 0x5, 0xce, 0xfe, 0xc5, 0x0, 0x8, 0xc3,
-    0xf, 0x4, 0xd7, 0x1, 0xe1, 0x0, 0xf0, 0x1,
-    0xe1, 0x4b, 0x0, 0xf, 0x0, 0xb, 0x44, 0xb0,
-    0x0, 0xf0, 0x0, 0xb4, 0x1e, 0x10, 0xf, 0x0,
-    0x1e, 0x10, 0x8d, 0x40, 0xf0, 0x4d, 0x70, 0x0,
-    0x5c, 0xef, 0xeb, 0x50, 0x0, 0x0, 0x0, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf0, 0x0, 0x0,
-
-    /* U+0445 "х" */
-    0x4c, 0x0, 0x7, 0xa0, 0x9, 0x80, 0x3d, 0x0,
-    0x0, 0xd4, 0xd3, 0x0, 0x0, 0x3f, 0x80, 0x0,
-    0x0, 0x5e, 0xa0, 0x0, 0x1, 0xd2, 0xb5, 0x0,
-    0xb, 0x60, 0x1d, 0x20, 0x7a, 0x0, 0x5, 0xc0,
-
-    /* U+0446 "ц" */
-    0x96, 0x0, 0x1, 0xe0, 0x9, 0x60, 0x0, 0x1e,
-    0x0, 0x96, 0x0, 0x1, 0xe0, 0x9, 0x60, 0x0,
-    0x1e, 0x0, 0x96, 0x0, 0x1, 0xe0, 0x9, 0x60,
-    0x0, 0x1e, 0x0, 0x96, 0x0, 0x1, 0xe0, 0x9,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xd,
-    0x10, 0x0, 0x0, 0x0, 0xd1,
-
-    /* U+0447 "ч" */
-    0x5a, 0x0, 0x0, 0xf5, 0xa0, 0x0, 0xf, 0x5a,
-    0x0, 0x0, 0xf2, 0xe3, 0x0, 0x4f, 0x5, 0xde,
-    0xc8, 0xf0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0,
-    0xf0, 0x0, 0x0, 0xf,
-
-    /* U+0448 "ш" */
-    0x96, 0x0, 0xf, 0x0, 0x6, 0x99, 0x60, 0x0,
-    0xf0, 0x0, 0x69, 0x96, 0x0, 0xf, 0x0, 0x6,
-    0x99, 0x60, 0x0, 0xf0, 0x0, 0x69, 0x96, 0x0,
-    0xf, 0x0, 0x6, 0x99, 0x60, 0x0, 0xf0, 0x0,
-    0x69, 0x96, 0x0, 0xf, 0x0, 0x6, 0x99, 0xff,
-    0xff, 0xff, 0xff, 0xf9,
-
-    /* U+0449 "щ" */
-    0x96, 0x0, 0xf, 0x0, 0x6, 0x90, 0x96, 0x0,
-    0xf, 0x0, 0x6, 0x90, 0x96, 0x0, 0xf, 0x0,
-    0x6, 0x90, 0x96, 0x0, 0xf, 0x0, 0x6, 0x90,
-    0x96, 0x0, 0xf, 0x0, 0x6, 0x90, 0x96, 0x0,
-    0xf, 0x0, 0x6, 0x90, 0x96, 0x0, 0xf, 0x0,
-    0x6, 0x90, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3b, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x15,
-
-    /* U+044A "ъ" */
-    0xef, 0xf5, 0x0, 0x0, 0x0, 0xa, 0x50, 0x0,
-    0x0, 0x0, 0xa5, 0x0, 0x0, 0x0, 0xa, 0xed,
-    0xdc, 0x40, 0x0, 0xa5, 0x0, 0x3e, 0x10, 0xa,
-    0x50, 0x0, 0xd3, 0x0, 0xa5, 0x0, 0x2e, 0x10,
-    0xa, 0xed, 0xdc, 0x40,
-
-    /* U+044B "ы" */
-    0x96, 0x0, 0x0, 0x6, 0x99, 0x60, 0x0, 0x0,
-    0x69, 0x96, 0x0, 0x0, 0x6, 0x99, 0xdc, 0xcc,
-    0x50, 0x69, 0x96, 0x0, 0x2e, 0x26, 0x99, 0x60,
-    0x0, 0xa5, 0x69, 0x96, 0x0, 0x1e, 0x26, 0x99,
-    0xec, 0xcd, 0x50, 0x69,
-
-    /* U+044C "ь" */
-    0x96, 0x0, 0x0, 0x9, 0x60, 0x0, 0x0, 0x96,
-    0x0, 0x0, 0x9, 0xdc, 0xcc, 0x50, 0x96, 0x0,
-    0x1e, 0x39, 0x60, 0x0, 0xa6, 0x96, 0x0, 0x1e,
-    0x39, 0xed, 0xdd, 0x60,
-
-    /* U+044D "э" */
-    0x19, 0xde, 0xd6, 0x0, 0x35, 0x0, 0x1b, 0x80,
-    0x0, 0x0, 0x0, 0xe1, 0x0, 0x7d, 0xdd, 0xf4,
-    0x0, 0x0, 0x0, 0xa4, 0x0, 0x0, 0x0, 0xe1,
-    0x58, 0x0, 0x2b, 0x70, 0x8, 0xee, 0xd6, 0x0,
-
-    /* U+044E "ю" */
-    0x96, 0x0, 0x3c, 0xed, 0x80, 0x9, 0x60, 0x3e,
-    0x30, 0x9, 0xa0, 0x96, 0xa, 0x50, 0x0, 0xd,
-    0x29, 0xff, 0xf1, 0x0, 0x0, 0x95, 0x96, 0xe,
-    0x10, 0x0, 0x9, 0x59, 0x60, 0xa6, 0x0, 0x0,
-    0xd2, 0x96, 0x2, 0xe3, 0x0, 0x9a, 0x9, 0x60,
-    0x3, 0xce, 0xd8, 0x0,
-
-    /* U+044F "я" */
-    0x3, 0xcf, 0xff, 0xf1, 0xe, 0x50, 0x0, 0xd1,
-    0x2d, 0x0, 0x0, 0xd1, 0xe, 0x40, 0x0, 0xd1,
-    0x2, 0xce, 0xcc, 0xf1, 0x0, 0xc4, 0x0, 0xd1,
-    0x5, 0xb0, 0x0, 0xd1, 0xe, 0x20, 0x0, 0xd1,
-
-    /* U+0450 "ѐ" */
-    0x0, 0x7b, 0x0, 0x0, 0x0, 0x5, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7e, 0xec, 0x40,
-    0x8, 0xa1, 0x3, 0xd3, 0x1e, 0x0, 0x0, 0x4b,
-    0x4f, 0xcc, 0xcc, 0xcc, 0x4b, 0x0, 0x0, 0x0,
-    0x1e, 0x10, 0x0, 0x0, 0x8, 0xc2, 0x1, 0xb3,
-    0x0, 0x6d, 0xfe, 0x70,
-
-    /* U+0451 "ё" */
-    0x0, 0x78, 0xe, 0x10, 0x0, 0x12, 0x3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7e, 0xec, 0x40,
-    0x8, 0xa1, 0x3, 0xd3, 0x1e, 0x0, 0x0, 0x4b,
-    0x4f, 0xcc, 0xcc, 0xcc, 0x4b, 0x0, 0x0, 0x0,
-    0x1e, 0x10, 0x0, 0x0, 0x8, 0xc2, 0x1, 0xb3,
-    0x0, 0x6d, 0xfe, 0x70,
-
-    /* U+0452 "ђ" */
-    0x0, 0x96, 0x0, 0x0, 0x0, 0x1c, 0xee, 0xcc,
-    0xa0, 0x0, 0x0, 0x96, 0x0, 0x0, 0x0, 0x0,
-    0x96, 0x9e, 0xfb, 0x20, 0x0, 0x9e, 0x60, 0x8,
-    0xc0, 0x0, 0x9a, 0x0, 0x0, 0xe1, 0x0, 0x97,
-    0x0, 0x0, 0xc2, 0x0, 0x96, 0x0, 0x0, 0xc3,
-    0x0, 0x96, 0x0, 0x0, 0xc3, 0x0, 0x96, 0x0,
-    0x0, 0xc3, 0x0, 0x96, 0x0, 0x0, 0xc3, 0x0,
-    0x0, 0x0, 0x0, 0xc2, 0x0, 0x0, 0x1, 0x1,
-    0xe1, 0x0, 0x0, 0x4, 0xee, 0x60,
-
-    /* U+0453 "ѓ" */
-    0x0, 0x6, 0xc1, 0x0, 0x6a, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xf9, 0x96, 0x0, 0x0, 0x96,
-    0x0, 0x0, 0x96, 0x0, 0x0, 0x96, 0x0, 0x0,
-    0x96, 0x0, 0x0, 0x96, 0x0, 0x0, 0x96, 0x0,
-    0x0,
-
-    /* U+0454 "є" */
-    0x0, 0x6d, 0xee, 0x80, 0x7, 0xb1, 0x0, 0x85,
-    0x1e, 0x0, 0x0, 0x0, 0x4a, 0x0, 0x0, 0x0,
-    0x4f, 0xcc, 0xc7, 0x0, 0x1e, 0x0, 0x0, 0x0,
-    0x7, 0xb1, 0x0, 0x53, 0x0, 0x6d, 0xed, 0x91,
-
-    /* U+0455 "ѕ" */
-    0x3, 0xce, 0xeb, 0x20, 0xe4, 0x0, 0x51, 0xf,
-    0x0, 0x0, 0x0, 0x9d, 0x84, 0x0, 0x0, 0x37,
-    0xae, 0x30, 0x0, 0x0, 0x6a, 0x18, 0x20, 0x9,
-    0x80, 0x8d, 0xfe, 0x90,
-
-    /* U+0456 "і" */
-    0xa8, 0x43, 0x0, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96,
-
-    /* U+0457 "ї" */
-    0x87, 0xa4, 0x11, 0x20, 0x0, 0x0, 0x9, 0x60,
-    0x9, 0x60, 0x9, 0x60, 0x9, 0x60, 0x9, 0x60,
-    0x9, 0x60, 0x9, 0x60, 0x9, 0x60,
-
-    /* U+0458 "ј" */
-    0x0, 0xa, 0x80, 0x0, 0x43, 0x0, 0x0, 0x0,
-    0x0, 0x96, 0x0, 0x9, 0x60, 0x0, 0x96, 0x0,
-    0x9, 0x60, 0x0, 0x96, 0x0, 0x9, 0x60, 0x0,
-    0x96, 0x0, 0x9, 0x60, 0x0, 0x96, 0x1, 0xc,
-    0x41, 0xde, 0x90,
-
-    /* U+0459 "љ" */
-    0x0, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xe,
-    0x0, 0xa, 0x80, 0x0, 0x0, 0x1, 0xd0, 0x0,
-    0xa8, 0x0, 0x0, 0x0, 0x1c, 0x0, 0xa, 0xec,
-    0xcc, 0x50, 0x3, 0xb0, 0x0, 0xa8, 0x0, 0x1d,
-    0x30, 0x58, 0x0, 0xa, 0x80, 0x0, 0x96, 0xa,
-    0x50, 0x0, 0xa8, 0x0, 0x1e, 0x3c, 0xb0, 0x0,
-    0xa, 0xfe, 0xed, 0x60,
-
-    /* U+045A "њ" */
-    0x96, 0x0, 0x1, 0xe0, 0x0, 0x0, 0x96, 0x0,
-    0x1, 0xe0, 0x0, 0x0, 0x96, 0x0, 0x1, 0xe0,
-    0x0, 0x0, 0x9f, 0xee, 0xee, 0xfe, 0xee, 0xa1,
-    0x96, 0x0, 0x1, 0xe0, 0x0, 0x9a, 0x96, 0x0,
-    0x1, 0xe0, 0x0, 0x3c, 0x96, 0x0, 0x1, 0xe0,
-    0x0, 0x89, 0x96, 0x0, 0x1, 0xfd, 0xdd, 0xa1,
-
-    /* U+045B "ћ" */
-    0x0, 0x96, 0x0, 0x0, 0x0, 0x5b, 0xed, 0xbb,
-    0xa0, 0x0, 0x0, 0x96, 0x0, 0x0, 0x0, 0x0,
-    0x97, 0x9e, 0xfb, 0x20, 0x0, 0x9e, 0x60, 0x8,
-    0xc0, 0x0, 0x9a, 0x0, 0x0, 0xe1, 0x0, 0x97,
-    0x0, 0x0, 0xc2, 0x0, 0x96, 0x0, 0x0, 0xc3,
-    0x0, 0x96, 0x0, 0x0, 0xc3, 0x0, 0x96, 0x0,
-    0x0, 0xc3, 0x0, 0x96, 0x0, 0x0, 0xc3,
-
-    /* U+045C "ќ" */
-    0x0, 0x4, 0xd2, 0x0, 0x4, 0xb1, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0x60, 0x0, 0xa7, 0x96, 0x0,
-    0x4c, 0x9, 0x60, 0xd, 0x20, 0x96, 0x9, 0x70,
-    0x9, 0xfe, 0xf1, 0x0, 0x96, 0x6, 0xc0, 0x9,
-    0x60, 0x8, 0xb0, 0x96, 0x0, 0xa, 0x80,
-
-    /* U+045D "ѝ" */
-    0x2, 0xd4, 0x0, 0x0, 0x0, 0x1b, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x96, 0x0, 0x2, 0xe3,
-    0x96, 0x0, 0xc, 0xf3, 0x96, 0x0, 0x98, 0xc3,
-    0x96, 0x6, 0xc0, 0xc3, 0x96, 0x3d, 0x10, 0xc3,
-    0x97, 0xd3, 0x0, 0xc3, 0x9f, 0x70, 0x0, 0xc3,
-    0x9b, 0x0, 0x0, 0xc3,
-
-    /* U+045E "ў" */
-    0x0, 0x48, 0x1, 0xb0, 0x0, 0x0, 0x8a, 0xa2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa5, 0x0,
-    0x0, 0x87, 0x4, 0xc0, 0x0, 0xe, 0x10, 0xd,
-    0x20, 0x5, 0xa0, 0x0, 0x69, 0x0, 0xb3, 0x0,
-    0x0, 0xe0, 0x2c, 0x0, 0x0, 0x9, 0x68, 0x60,
-    0x0, 0x0, 0x2d, 0xd0, 0x0, 0x0, 0x0, 0xc9,
-    0x0, 0x0, 0x0, 0xd, 0x20, 0x0, 0x4, 0x6,
-    0xb0, 0x0, 0x1, 0xce, 0xc1, 0x0, 0x0,
-
-    /* U+045F "џ" */
-    0x96, 0x0, 0x7, 0x89, 0x60, 0x0, 0x78, 0x96,
-    0x0, 0x7, 0x89, 0x60, 0x0, 0x78, 0x96, 0x0,
-    0x7, 0x89, 0x60, 0x0, 0x78, 0x96, 0x0, 0x7,
-    0x89, 0xff, 0xff, 0xf8, 0x0, 0xf, 0x0, 0x0,
-    0x0, 0xf0, 0x0,
-
-    /* U+0462 "Ѣ" */
-    0x0, 0x1f, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf0,
-    0x0, 0x0, 0x0, 0x9d, 0xef, 0xdd, 0xd0, 0x0,
-    0x0, 0x1, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xee, 0xee, 0xb3, 0x0, 0x1, 0xf0, 0x0, 0x5,
-    0xf2, 0x0, 0x1f, 0x0, 0x0, 0x9, 0x80, 0x1,
-    0xf0, 0x0, 0x0, 0x79, 0x0, 0x1f, 0x0, 0x0,
-    0x9, 0x70, 0x1, 0xf0, 0x0, 0x4, 0xe2, 0x0,
-    0x1f, 0xee, 0xee, 0xb3, 0x0,
-
-    /* U+0463 "ѣ" */
-    0x1, 0xe0, 0x0, 0x0, 0x1, 0xe0, 0x0, 0x0,
-    0x1, 0xe0, 0x0, 0x0, 0xcd, 0xfd, 0xd8, 0x0,
-    0x1, 0xe0, 0x0, 0x0, 0x1, 0xe0, 0x0, 0x0,
-    0x1, 0xfc, 0xcd, 0xa1, 0x1, 0xe0, 0x0, 0x7a,
-    0x1, 0xe0, 0x0, 0x2d, 0x1, 0xe0, 0x0, 0x7a,
-    0x1, 0xfd, 0xdd, 0xa1,
-
-    /* U+046A "Ѫ" */
-    0x9, 0xfe, 0xee, 0xee, 0xee, 0xf0, 0x0, 0x1d,
-    0x20, 0x0, 0x0, 0xb4, 0x0, 0x0, 0x2d, 0x10,
-    0x0, 0x97, 0x0, 0x0, 0x0, 0x4c, 0x0, 0x79,
-    0x0, 0x0, 0x0, 0x0, 0x6b, 0x5b, 0x0, 0x0,
-    0x0, 0x0, 0x8d, 0xff, 0xeb, 0x20, 0x0, 0x0,
-    0xa9, 0x4, 0xa0, 0x5e, 0x20, 0x0, 0x4c, 0x0,
-    0x4a, 0x0, 0x6a, 0x0, 0xb, 0x50, 0x4, 0xa0,
-    0x0, 0xe1, 0x1, 0xe0, 0x0, 0x4a, 0x0, 0x9,
-    0x70, 0x79, 0x0, 0x4, 0xa0, 0x0, 0x3d, 0x0,
-
-    /* U+046B "ѫ" */
-    0xd, 0xdc, 0xcc, 0xcf, 0x50, 0x3, 0xb0, 0x0,
-    0x59, 0x0, 0x0, 0x39, 0x3, 0x90, 0x0, 0x0,
-    0x3c, 0xbe, 0x70, 0x0, 0x4, 0xd4, 0xb5, 0x7b,
-    0x0, 0xc, 0x30, 0xb3, 0xa, 0x50, 0x2c, 0x0,
-    0xb3, 0x4, 0xb0, 0x87, 0x0, 0xb3, 0x0, 0xe1,
-
-    /* U+0472 "Ѳ" */
-    0x0, 0x6, 0xcf, 0xfc, 0x50, 0x0, 0x0, 0xad,
-    0x40, 0x5, 0xd8, 0x0, 0x6, 0xd0, 0x0, 0x0,
-    0x1e, 0x50, 0xe, 0x40, 0x0, 0x0, 0x5, 0xc0,
-    0x1f, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x3f, 0xee,
-    0xee, 0xee, 0xee, 0xf1, 0x1f, 0x0, 0x0, 0x0,
-    0x0, 0xf0, 0xe, 0x40, 0x0, 0x0, 0x5, 0xc0,
-    0x6, 0xc0, 0x0, 0x0, 0x1e, 0x50, 0x0, 0xad,
-    0x40, 0x5, 0xd8, 0x0, 0x0, 0x6, 0xcf, 0xfc,
-    0x50, 0x0,
-
-    /* U+0473 "ѳ" */
-    0x0, 0x6d, 0xdd, 0x70, 0x0, 0x89, 0x0, 0x9,
-    0x80, 0x1d, 0x0, 0x0, 0xc, 0x14, 0xec, 0xcc,
-    0xcc, 0xe4, 0x4c, 0x0, 0x0, 0xb, 0x41, 0xf1,
-    0x0, 0x1, 0xf1, 0x8, 0xc1, 0x1, 0xc8, 0x0,
-    0x6, 0xde, 0xd7, 0x0,
-
-    /* U+0474 "Ѵ" */
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x8, 0x90, 0x0,
-    0x0, 0x1c, 0xf4, 0x3e, 0x0, 0x0, 0x9, 0xb2,
-    0x0, 0xd4, 0x0, 0x0, 0xe1, 0x0, 0x7, 0xa0,
-    0x0, 0x4b, 0x0, 0x0, 0x1f, 0x10, 0x9, 0x60,
-    0x0, 0x0, 0xb6, 0x0, 0xe1, 0x0, 0x0, 0x5,
-    0xc0, 0x4c, 0x0, 0x0, 0x0, 0xf, 0x29, 0x70,
-    0x0, 0x0, 0x0, 0x98, 0xe1, 0x0, 0x0, 0x0,
-    0x4, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xe, 0x70,
-    0x0, 0x0,
-
-    /* U+0475 "ѵ" */
-    0x0, 0x0, 0x0, 0x1, 0xa, 0x60, 0x0, 0xc,
-    0xf0, 0x4d, 0x0, 0x5, 0xc0, 0x0, 0xd3, 0x0,
-    0xb5, 0x0, 0x7, 0xa0, 0x1e, 0x0, 0x0, 0x1e,
-    0x6, 0x90, 0x0, 0x0, 0xa6, 0xc3, 0x0, 0x0,
-    0x3, 0xde, 0x0, 0x0, 0x0, 0xd, 0x80, 0x0,
-    0x0,
-
-    /* U+048A "Ҋ" */
-    0x0, 0x42, 0x0, 0x60, 0x0, 0x0, 0x5, 0x80,
-    0x1c, 0x0, 0x0, 0x0, 0x7, 0xaa, 0x20, 0x0,
-    0x5, 0xa0, 0x0, 0x0, 0x6e, 0x0, 0x5a, 0x0,
-    0x0, 0x2f, 0xe0, 0x5, 0xa0, 0x0, 0xc, 0x9e,
-    0x0, 0x5a, 0x0, 0x7, 0xc2, 0xe0, 0x5, 0xa0,
-    0x2, 0xe2, 0x2e, 0x0, 0x5a, 0x0, 0xc6, 0x2,
-    0xe0, 0x5, 0xa0, 0x8b, 0x0, 0x2e, 0x0, 0x5a,
-    0x3e, 0x10, 0x2, 0xe0, 0x5, 0xbd, 0x50, 0x0,
-    0x2e, 0x0, 0x5f, 0xa0, 0x0, 0x2, 0xe0, 0x5,
-    0xe0, 0x0, 0x0, 0x4f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0x0, 0x0, 0x0, 0x0, 0x4, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x33, 0x0,
-
-    /* U+048B "ҋ" */
-    0x4, 0x80, 0x1b, 0x0, 0x0, 0x7, 0xaa, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x60, 0x0,
-    0x2e, 0x30, 0x96, 0x0, 0xc, 0xf3, 0x9, 0x60,
-    0x9, 0x8c, 0x30, 0x96, 0x6, 0xc0, 0xc3, 0x9,
-    0x63, 0xd1, 0xc, 0x30, 0x97, 0xd3, 0x0, 0xc3,
-    0x9, 0xf7, 0x0, 0xc, 0x30, 0x9b, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0,
-    0x0, 0x5, 0x0,
-
-    /* U+048C "Ҍ" */
-    0x0, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x0, 0x7d, 0xfd, 0xdd, 0x10, 0x0, 0x0,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0xee, 0xeb,
-    0x40, 0x0, 0xf0, 0x0, 0x4, 0xe3, 0x0, 0xf0,
-    0x0, 0x0, 0x89, 0x0, 0xf0, 0x0, 0x0, 0x6a,
-    0x0, 0xf0, 0x0, 0x0, 0x88, 0x0, 0xf0, 0x0,
-    0x4, 0xe2, 0x0, 0xfe, 0xee, 0xec, 0x30,
-
-    /* U+048D "ҍ" */
-    0x2, 0xd0, 0x0, 0x0, 0x8d, 0xfc, 0xc7, 0x0,
-    0x2, 0xd0, 0x0, 0x0, 0x2, 0xfd, 0xdd, 0xa1,
-    0x2, 0xd0, 0x0, 0x8a, 0x2, 0xd0, 0x0, 0x3d,
-    0x2, 0xd0, 0x0, 0x8a, 0x2, 0xfd, 0xdd, 0xa1,
-
-    /* U+048E "Ҏ" */
-    0x5f, 0xff, 0xfd, 0x70, 0x5, 0xb0, 0x0, 0x2b,
-    0x90, 0x5b, 0x0, 0x0, 0x1f, 0x15, 0xb0, 0x0,
-    0x0, 0xc4, 0x5b, 0x0, 0xc1, 0xc, 0x45, 0xb0,
-    0x5, 0xa1, 0xf1, 0x5b, 0x0, 0xb, 0xd9, 0x5,
-    0xff, 0xff, 0xde, 0x10, 0x5b, 0x0, 0x0, 0x4b,
-    0x5, 0xb0, 0x0, 0x0, 0x60, 0x5b, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+048F "ҏ" */
-    0x96, 0x6d, 0xfc, 0x40, 0x9b, 0x80, 0x4, 0xe3,
-    0x9b, 0x0, 0x0, 0x6a, 0x97, 0x0, 0x0, 0x1e,
-    0x97, 0x0, 0x0, 0x1e, 0x9b, 0x0, 0x49, 0x6a,
-    0x9c, 0x80, 0xb, 0xe3, 0x96, 0x6d, 0xfc, 0xc1,
-    0x96, 0x0, 0x0, 0x36, 0x96, 0x0, 0x0, 0x0,
-    0x96, 0x0, 0x0, 0x0,
-
-    /* U+0490 "Ґ" */
-    0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x1e, 0x5f,
-    0xff, 0xff, 0xd5, 0xa0, 0x0, 0x0, 0x5a, 0x0,
-    0x0, 0x5, 0xa0, 0x0, 0x0, 0x5a, 0x0, 0x0,
-    0x5, 0xa0, 0x0, 0x0, 0x5a, 0x0, 0x0, 0x5,
-    0xa0, 0x0, 0x0, 0x5a, 0x0, 0x0, 0x5, 0xa0,
-    0x0, 0x0, 0x5a, 0x0, 0x0, 0x0,
-
-    /* U+0491 "ґ" */
-    0x0, 0x0, 0x52, 0x0, 0x0, 0xb4, 0x9f, 0xff,
-    0xf3, 0x96, 0x0, 0x0, 0x96, 0x0, 0x0, 0x96,
-    0x0, 0x0, 0x96, 0x0, 0x0, 0x96, 0x0, 0x0,
-    0x96, 0x0, 0x0, 0x96, 0x0, 0x0,
-
-    /* U+0492 "Ғ" */
-    0x0, 0xff, 0xff, 0xff, 0x30, 0xf, 0x0, 0x0,
-    0x0, 0x0, 0xf0, 0x0, 0x0, 0x0, 0xf, 0x0,
-    0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x0, 0xf,
-    0x0, 0x0, 0x0, 0x7d, 0xfd, 0xdd, 0xd3, 0x0,
-    0xf, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x0,
-    0x0, 0xf, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x0,
-
-    /* U+0493 "ғ" */
-    0x6, 0xff, 0xff, 0xc0, 0x6a, 0x0, 0x0, 0x6,
-    0xa0, 0x0, 0x0, 0x6a, 0x0, 0x0, 0x4e, 0xfc,
-    0xca, 0x0, 0x6a, 0x0, 0x0, 0x6, 0xa0, 0x0,
-    0x0, 0x6a, 0x0, 0x0,
-
-    /* U+0494 "Ҕ" */
-    0x5f, 0xff, 0xff, 0xf2, 0x5, 0xa0, 0x0, 0x0,
-    0x0, 0x5a, 0x0, 0x0, 0x0, 0x5, 0xa0, 0x0,
-    0x0, 0x0, 0x5a, 0x1, 0x31, 0x0, 0x5, 0xdc,
-    0xdc, 0xfa, 0x0, 0x5d, 0x20, 0x1, 0xc8, 0x5,
-    0xa0, 0x0, 0x2, 0xe0, 0x5a, 0x0, 0x0, 0xf,
-    0x15, 0xa0, 0x0, 0x0, 0xf0, 0x5a, 0x0, 0x0,
-    0x4c, 0x0, 0x0, 0x0, 0x2d, 0x50, 0x0, 0x6,
-    0xee, 0x60, 0x0, 0x0, 0x1, 0x0, 0x0,
-
-    /* U+0495 "ҕ" */
-    0x9f, 0xff, 0xf6, 0x9, 0x60, 0x0, 0x0, 0x96,
-    0x0, 0x0, 0x9, 0x61, 0x42, 0x0, 0x9e, 0xda,
-    0xdb, 0x9, 0x80, 0x0, 0xa8, 0x96, 0x0, 0x3,
-    0xd9, 0x60, 0x0, 0x2e, 0x0, 0x0, 0x5, 0xb0,
-    0x0, 0x3, 0xe4, 0x0, 0x6f, 0xd5, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0496 "Җ" */
-    0x2e, 0x10, 0x0, 0x69, 0x0, 0x0, 0xd4, 0x0,
-    0x88, 0x0, 0x6, 0x90, 0x0, 0x6b, 0x0, 0x0,
-    0xe2, 0x0, 0x69, 0x0, 0xe, 0x20, 0x0, 0x6,
-    0xa0, 0x6, 0x90, 0x8, 0x80, 0x0, 0x0, 0xc,
-    0x30, 0x69, 0x2, 0xe0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xe, 0x30,
-    0x69, 0x1, 0xe2, 0x0, 0x0, 0x8, 0xa0, 0x6,
-    0x90, 0x7, 0xb0, 0x0, 0x2, 0xe1, 0x0, 0x69,
-    0x0, 0xd, 0x50, 0x0, 0xc7, 0x0, 0x6, 0x90,
-    0x0, 0x4e, 0x0, 0x5d, 0x0, 0x0, 0x69, 0x0,
-    0x0, 0xbf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x68, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x34,
-
-    /* U+0497 "җ" */
-    0x4c, 0x0, 0xb, 0x40, 0x3, 0xd0, 0xb, 0x50,
-    0xb, 0x40, 0xc, 0x40, 0x2, 0xd0, 0xb, 0x40,
-    0x5b, 0x0, 0x0, 0x96, 0xb, 0x40, 0xd3, 0x0,
-    0x0, 0x5f, 0xef, 0xfe, 0xd0, 0x0, 0x1, 0xd4,
-    0xb, 0x40, 0xb8, 0x0, 0xa, 0x80, 0xb, 0x40,
-    0x1e, 0x30, 0x6c, 0x0, 0xb, 0x40, 0x3, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7,
-
-    /* U+0498 "Ҙ" */
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xcf, 0xfb, 0x30,
-    0xb, 0x40, 0x6, 0xf2, 0x0, 0x0, 0x0, 0x98,
-    0x0, 0x0, 0x0, 0x87, 0x0, 0x0, 0x3, 0xd2,
-    0x0, 0xae, 0xef, 0x70, 0x0, 0x0, 0x1, 0xa8,
-    0x0, 0x0, 0x0, 0x1f, 0x10, 0x0, 0x0, 0x4e,
-    0x4d, 0x74, 0x48, 0xf5, 0x2, 0x8d, 0xf9, 0x30,
-    0x0, 0x4, 0xb0, 0x0, 0x0, 0x4, 0xb0, 0x0,
-
-    /* U+0499 "ҙ" */
-    0x19, 0xef, 0xd7, 0x0, 0x40, 0x2, 0xd5, 0x0,
-    0x0, 0xc, 0x30, 0x8, 0xcf, 0x80, 0x0, 0x0,
-    0xb, 0x60, 0x0, 0x0, 0x69, 0x56, 0x0, 0x2d,
-    0x52, 0xae, 0xfd, 0x60, 0x0, 0xe, 0x0, 0x0,
-    0x0, 0x70, 0x0,
-
-    /* U+049A "Қ" */
-    0x5a, 0x0, 0x0, 0x2e, 0x10, 0x5a, 0x0, 0x0,
-    0xc5, 0x0, 0x5a, 0x0, 0x7, 0xa0, 0x0, 0x5a,
-    0x0, 0x2d, 0x10, 0x0, 0x5a, 0x0, 0xc5, 0x0,
-    0x0, 0x5f, 0xff, 0xd0, 0x0, 0x0, 0x5a, 0x0,
-    0xc7, 0x0, 0x0, 0x5a, 0x0, 0x2e, 0x20, 0x0,
-    0x5a, 0x0, 0x5, 0xc0, 0x0, 0x5a, 0x0, 0x0,
-    0xa8, 0x0, 0x5a, 0x0, 0x0, 0x1e, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0xa4, 0x0, 0x0, 0x0, 0x0,
-    0xa4, 0x0, 0x0, 0x0, 0x0, 0x52,
-
-    /* U+049B "қ" */
-    0x96, 0x0, 0xa, 0x70, 0x96, 0x0, 0x4c, 0x0,
-    0x96, 0x0, 0xd2, 0x0, 0x96, 0x9, 0x70, 0x0,
-    0x9f, 0xef, 0x10, 0x0, 0x96, 0x6, 0xc0, 0x0,
-    0x96, 0x0, 0x8b, 0x0, 0x96, 0x0, 0xa, 0xf9,
-    0x0, 0x0, 0x0, 0x4a, 0x0, 0x0, 0x0, 0x25,
-
-    /* U+049C "Ҝ" */
-    0x5a, 0x0, 0x0, 0xc, 0x45, 0xa0, 0x0, 0x6,
-    0xb0, 0x5a, 0x0, 0x1, 0xe1, 0x5, 0xa2, 0xa0,
-    0x97, 0x0, 0x5a, 0x2a, 0x3d, 0x0, 0x5, 0xff,
-    0xff, 0x70, 0x0, 0x5a, 0x2a, 0x3e, 0x10, 0x5,
-    0xa2, 0xa0, 0x9a, 0x0, 0x5a, 0x3, 0x0, 0xe4,
-    0x5, 0xa0, 0x0, 0x4, 0xd0, 0x5a, 0x0, 0x0,
-    0xa, 0x80,
-
-    /* U+049D "ҝ" */
-    0x96, 0x0, 0x6, 0xa0, 0x96, 0x0, 0x1e, 0x10,
-    0x96, 0x90, 0x97, 0x0, 0x96, 0xb2, 0xd0, 0x0,
-    0x9f, 0xff, 0x90, 0x0, 0x96, 0xb1, 0xd3, 0x0,
-    0x96, 0x30, 0x3d, 0x10, 0x96, 0x0, 0x6, 0xb0,
-
-    /* U+049E "Ҟ" */
-    0x0, 0xf0, 0x0, 0x0, 0xc5, 0x0, 0xf0, 0x0,
-    0x7, 0xa0, 0x6d, 0xfd, 0xd6, 0x2d, 0x10, 0x0,
-    0xf0, 0x0, 0xc4, 0x0, 0x0, 0xf0, 0x7, 0xa0,
-    0x0, 0x0, 0xff, 0xff, 0x20, 0x0, 0x0, 0xf0,
-    0x7, 0xb0, 0x0, 0x0, 0xf0, 0x0, 0xb7, 0x0,
-    0x0, 0xf0, 0x0, 0x1e, 0x20, 0x0, 0xf0, 0x0,
-    0x5, 0xc0, 0x0, 0xf0, 0x0, 0x0, 0xa8,
-
-    /* U+049F "ҟ" */
-    0x9, 0x60, 0x0, 0x0, 0xce, 0xec, 0x80, 0x0,
-    0x9, 0x60, 0x0, 0x0, 0x9, 0x60, 0x0, 0xa7,
-    0x9, 0x60, 0x4, 0xc0, 0x9, 0x60, 0xd, 0x20,
-    0x9, 0x60, 0x97, 0x0, 0x9, 0xfe, 0xf1, 0x0,
-    0x9, 0x60, 0x6c, 0x0, 0x9, 0x60, 0x8, 0xb0,
-    0x9, 0x60, 0x0, 0xa8,
-
-    /* U+04A0 "Ҡ" */
-    0xdf, 0xff, 0x40, 0x0, 0x9, 0x90, 0x0, 0xc,
-    0x30, 0x0, 0x3d, 0x0, 0x0, 0xc, 0x30, 0x0,
-    0xd3, 0x0, 0x0, 0xc, 0x30, 0x8, 0x80, 0x0,
-    0x0, 0xc, 0x30, 0x3d, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0xc, 0x30, 0x3e,
-    0x10, 0x0, 0x0, 0xc, 0x30, 0x8, 0xb0, 0x0,
-    0x0, 0xc, 0x30, 0x0, 0xc6, 0x0, 0x0, 0xc,
-    0x30, 0x0, 0x2e, 0x20, 0x0, 0xc, 0x30, 0x0,
-    0x6, 0xc0,
-
-    /* U+04A1 "ҡ" */
-    0xee, 0xf5, 0x0, 0xb, 0x50, 0xa, 0x50, 0x5,
-    0xb0, 0x0, 0xa5, 0x1, 0xd1, 0x0, 0xa, 0x50,
-    0xa5, 0x0, 0x0, 0xaf, 0xef, 0x10, 0x0, 0xa,
-    0x50, 0x7b, 0x0, 0x0, 0xa5, 0x0, 0x99, 0x0,
-    0xa, 0x50, 0x0, 0xb7,
-
-    /* U+04A2 "Ң" */
-    0x5b, 0x0, 0x0, 0x3, 0xd0, 0x5, 0xb0, 0x0,
-    0x0, 0x3d, 0x0, 0x5b, 0x0, 0x0, 0x3, 0xd0,
-    0x5, 0xb0, 0x0, 0x0, 0x3d, 0x0, 0x5b, 0x0,
-    0x0, 0x3, 0xd0, 0x5, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x5b, 0x0, 0x0, 0x3, 0xd0, 0x5, 0xb0,
-    0x0, 0x0, 0x3d, 0x0, 0x5b, 0x0, 0x0, 0x3,
-    0xd0, 0x5, 0xb0, 0x0, 0x0, 0x3d, 0x0, 0x5b,
-    0x0, 0x0, 0x4, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x96, 0x0, 0x0, 0x0, 0x0, 0x9, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x43,
-
-    /* U+04A3 "ң" */
-    0x96, 0x0, 0x0, 0xf0, 0x9, 0x60, 0x0, 0xf,
-    0x0, 0x96, 0x0, 0x0, 0xf0, 0x9, 0x60, 0x0,
-    0xf, 0x0, 0x9f, 0xee, 0xee, 0xf0, 0x9, 0x60,
-    0x0, 0xf, 0x0, 0x96, 0x0, 0x0, 0xf0, 0x9,
-    0x60, 0x0, 0xf, 0xf3, 0x0, 0x0, 0x0, 0xb,
-    0x30, 0x0, 0x0, 0x0, 0x51,
-
-    /* U+04A4 "Ҥ" */
-    0x5b, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x15,
-    0xb0, 0x0, 0x0, 0x4f, 0x0, 0x0, 0x0, 0x5b,
-    0x0, 0x0, 0x4, 0xf0, 0x0, 0x0, 0x5, 0xb0,
-    0x0, 0x0, 0x4f, 0x0, 0x0, 0x0, 0x5b, 0x0,
-    0x0, 0x4, 0xf0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x5b, 0x0, 0x0,
-    0x4, 0xf0, 0x0, 0x0, 0x5, 0xb0, 0x0, 0x0,
-    0x4f, 0x0, 0x0, 0x0, 0x5b, 0x0, 0x0, 0x4,
-    0xf0, 0x0, 0x0, 0x5, 0xb0, 0x0, 0x0, 0x4f,
-    0x0, 0x0, 0x0, 0x5b, 0x0, 0x0, 0x4, 0xf0,
-    0x0, 0x0, 0x0,
-
-    /* U+04A5 "ҥ" */
-    0x96, 0x0, 0x0, 0xff, 0xff, 0xf3, 0x96, 0x0,
-    0x0, 0xf1, 0x0, 0x0, 0x96, 0x0, 0x0, 0xf1,
-    0x0, 0x0, 0x96, 0x0, 0x0, 0xf1, 0x0, 0x0,
-    0x9f, 0xee, 0xee, 0xf1, 0x0, 0x0, 0x96, 0x0,
-    0x0, 0xf1, 0x0, 0x0, 0x96, 0x0, 0x0, 0xf1,
-    0x0, 0x0, 0x96, 0x0, 0x0, 0xf1, 0x0, 0x0,
-
-    /* U+04A6 "Ҧ" */
-    0x5f, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x5a, 0x0, 0x0, 0x2, 0xe0, 0x0, 0x0, 0x0,
-    0x5a, 0x0, 0x0, 0x2, 0xe0, 0x0, 0x0, 0x0,
-    0x5a, 0x0, 0x0, 0x2, 0xe0, 0x0, 0x0, 0x0,
-    0x5a, 0x0, 0x0, 0x2, 0xe0, 0x13, 0x20, 0x0,
-    0x5a, 0x0, 0x0, 0x2, 0xfb, 0xdb, 0xeb, 0x10,
-    0x5a, 0x0, 0x0, 0x2, 0xf4, 0x0, 0xa, 0xb0,
-    0x5a, 0x0, 0x0, 0x2, 0xe0, 0x0, 0x0, 0xf1,
-    0x5a, 0x0, 0x0, 0x2, 0xe0, 0x0, 0x0, 0xc3,
-    0x5a, 0x0, 0x0, 0x2, 0xe0, 0x0, 0x0, 0xd3,
-    0x5a, 0x0, 0x0, 0x2, 0xe0, 0x0, 0x2, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xe8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
-
-    /* U+04A7 "ҧ" */
-    0x9f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x9, 0x60,
-    0x0, 0x3c, 0x0, 0x0, 0x0, 0x96, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x9, 0x60, 0x0, 0x3c, 0x3,
-    0x30, 0x0, 0x96, 0x0, 0x3, 0xfd, 0xbb, 0xe3,
-    0x9, 0x60, 0x0, 0x3d, 0x0, 0x5, 0xd0, 0x96,
-    0x0, 0x3, 0xc0, 0x0, 0xd, 0x29, 0x60, 0x0,
-    0x3c, 0x0, 0x0, 0xc3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1b,
-    0x90, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+04A8 "Ҩ" */
-    0x0, 0x3c, 0x0, 0x3c, 0xfe, 0x70, 0x0, 0x1e,
-    0x40, 0x2e, 0x50, 0x2c, 0x80, 0x8, 0x90, 0xa,
-    0x70, 0x0, 0x1f, 0x10, 0xe2, 0x0, 0xf1, 0x0,
-    0x0, 0xb5, 0x1f, 0x0, 0x1f, 0x0, 0x0, 0xa,
-    0x61, 0xe0, 0x0, 0xf0, 0x0, 0x0, 0xb5, 0xf,
-    0x0, 0xe, 0x20, 0x0, 0xe, 0x20, 0xb5, 0x0,
-    0x88, 0x0, 0x4, 0xb0, 0x4, 0xd1, 0x1, 0xe3,
-    0x1, 0xd2, 0x0, 0x8, 0xd4, 0x3, 0xe8, 0xc4,
-    0x0, 0x0, 0x4, 0xbe, 0xdd, 0xad, 0xde, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+04A9 "ҩ" */
-    0x1, 0xc2, 0x8, 0xee, 0xa0, 0x0, 0xa7, 0x7,
-    0xb0, 0x9, 0xa0, 0x1e, 0x0, 0xe1, 0x0, 0xf,
-    0x3, 0xb0, 0xf, 0x0, 0x0, 0xe1, 0x3c, 0x0,
-    0xe1, 0x0, 0x1e, 0x0, 0xe2, 0x8, 0x80, 0x8,
-    0x80, 0x5, 0xd3, 0x1d, 0x88, 0xb0, 0x0, 0x4,
-    0xbd, 0xdd, 0xed, 0xc1,
-
-    /* U+04AA "Ҫ" */
-    0x0, 0x6, 0xcf, 0xfc, 0x50, 0x0, 0xad, 0x40,
-    0x4, 0xd4, 0x6, 0xd0, 0x0, 0x0, 0x10, 0xd,
-    0x40, 0x0, 0x0, 0x0, 0x1e, 0x0, 0x0, 0x0,
-    0x0, 0x2d, 0x0, 0x0, 0x0, 0x0, 0x1e, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x40, 0x0, 0x0, 0x0,
-    0x6, 0xd0, 0x0, 0x0, 0x10, 0x0, 0xad, 0x40,
-    0x5, 0xd4, 0x0, 0x6, 0xcf, 0xfc, 0x40, 0x0,
-    0x0, 0xb, 0x30, 0x0, 0x0, 0x0, 0xb, 0x30,
-    0x0, 0x0, 0x0, 0x5, 0x10, 0x0,
-
-    /* U+04AB "ҫ" */
-    0x0, 0x7d, 0xfd, 0x60, 0x8, 0xc2, 0x2, 0xc2,
-    0x1e, 0x10, 0x0, 0x0, 0x4b, 0x0, 0x0, 0x0,
-    0x4b, 0x0, 0x0, 0x0, 0x1e, 0x10, 0x0, 0x0,
-    0x8, 0xc2, 0x2, 0xc2, 0x0, 0x6e, 0xfd, 0x60,
-    0x0, 0x0, 0xe0, 0x0, 0x0, 0x0, 0x70, 0x0,
-
-    /* U+04AC "Ҭ" */
-    0xdf, 0xff, 0xff, 0xff, 0x10, 0x0, 0x6a, 0x0,
-    0x0, 0x0, 0x6, 0xa0, 0x0, 0x0, 0x0, 0x6a,
-    0x0, 0x0, 0x0, 0x6, 0xa0, 0x0, 0x0, 0x0,
-    0x6a, 0x0, 0x0, 0x0, 0x6, 0xa0, 0x0, 0x0,
-    0x0, 0x6a, 0x0, 0x0, 0x0, 0x6, 0xa0, 0x0,
-    0x0, 0x0, 0x6a, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0xd2, 0x0, 0x0, 0x0,
-    0xd, 0x20, 0x0, 0x0, 0x0, 0x61, 0x0,
-
-    /* U+04AD "ҭ" */
-    0xef, 0xff, 0xff, 0x80, 0x3, 0xd0, 0x0, 0x0,
-    0x3d, 0x0, 0x0, 0x3, 0xd0, 0x0, 0x0, 0x3d,
-    0x0, 0x0, 0x3, 0xd0, 0x0, 0x0, 0x3d, 0x0,
-    0x0, 0x4, 0xfe, 0x0, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x7, 0x0,
-
-    /* U+04AE "Ү" */
-    0x98, 0x0, 0x0, 0x5, 0xb1, 0xe1, 0x0, 0x0,
-    0xd2, 0x8, 0x90, 0x0, 0x6a, 0x0, 0xe, 0x20,
-    0xe, 0x10, 0x0, 0x6b, 0x8, 0x80, 0x0, 0x0,
-    0xd5, 0xe1, 0x0, 0x0, 0x5, 0xf7, 0x0, 0x0,
-    0x0, 0xf, 0x10, 0x0, 0x0, 0x0, 0xf1, 0x0,
-    0x0, 0x0, 0xf, 0x10, 0x0, 0x0, 0x0, 0xf1,
-    0x0, 0x0,
-
-    /* U+04AF "ү" */
-    0xa6, 0x0, 0x0, 0x77, 0x3d, 0x0, 0x0, 0xe1,
-    0xc, 0x40, 0x5, 0xa0, 0x5, 0xa0, 0xc, 0x30,
-    0x0, 0xe1, 0x3c, 0x0, 0x0, 0x88, 0xa5, 0x0,
-    0x0, 0x1e, 0xe0, 0x0, 0x0, 0xb, 0x80, 0x0,
-    0x0, 0x9, 0x60, 0x0, 0x0, 0x9, 0x60, 0x0,
-    0x0, 0x9, 0x60, 0x0,
-
-    /* U+04B0 "Ұ" */
-    0x97, 0x0, 0x0, 0x4, 0xb1, 0xe1, 0x0, 0x0,
-    0xc3, 0x9, 0x80, 0x0, 0x5b, 0x0, 0x1e, 0x10,
-    0xd, 0x20, 0x0, 0x88, 0x5, 0xa0, 0x0, 0x1,
-    0xe1, 0xd2, 0x0, 0x0, 0x7, 0xd9, 0x0, 0x0,
-    0x5c, 0xcf, 0xdc, 0x60, 0x0, 0x0, 0xf1, 0x0,
-    0x0, 0x0, 0xf, 0x10, 0x0, 0x0, 0x0, 0xf1,
-    0x0, 0x0,
-
-    /* U+04B1 "ұ" */
-    0xa6, 0x0, 0x0, 0x77, 0x3d, 0x0, 0x0, 0xd1,
-    0xc, 0x30, 0x5, 0xa0, 0x6, 0xa0, 0xc, 0x30,
-    0x0, 0xe1, 0x3c, 0x0, 0x0, 0x87, 0x96, 0x0,
-    0x0, 0x2e, 0xe0, 0x0, 0xc, 0xcf, 0xec, 0x90,
-    0x0, 0x9, 0x60, 0x0, 0x0, 0x9, 0x60, 0x0,
-    0x0, 0x9, 0x60, 0x0,
-
-    /* U+04B2 "Ҳ" */
-    0x2e, 0x10, 0x0, 0x1e, 0x30, 0x8, 0xb0, 0x0,
-    0xa9, 0x0, 0x0, 0xd5, 0x4, 0xe0, 0x0, 0x0,
-    0x4e, 0x1d, 0x50, 0x0, 0x0, 0xa, 0xeb, 0x0,
-    0x0, 0x0, 0x4, 0xf6, 0x0, 0x0, 0x0, 0xd,
-    0xae, 0x0, 0x0, 0x0, 0x7c, 0xb, 0x90, 0x0,
-    0x2, 0xe2, 0x1, 0xe3, 0x0, 0xb, 0x70, 0x0,
-    0x6d, 0x0, 0x5c, 0x0, 0x0, 0xb, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x77, 0x0, 0x0, 0x0, 0x0,
-    0x77, 0x0, 0x0, 0x0, 0x0, 0x33,
-
-    /* U+04B3 "ҳ" */
-    0x4c, 0x0, 0x7, 0xa0, 0x9, 0x80, 0x3d, 0x0,
-    0x0, 0xd4, 0xd3, 0x0, 0x0, 0x3f, 0x80, 0x0,
-    0x0, 0x5e, 0xa0, 0x0, 0x1, 0xd2, 0xb5, 0x0,
-    0xb, 0x60, 0x1d, 0x20, 0x7a, 0x0, 0x5, 0xfc,
-    0x0, 0x0, 0x0, 0x1d, 0x0, 0x0, 0x0, 0x6,
-
-    /* U+04B4 "Ҵ" */
-    0xcf, 0xff, 0xff, 0xfb, 0x0, 0x79, 0x0, 0x0,
-    0x8, 0xc0, 0x0, 0x0, 0x79, 0x0, 0x0, 0x8,
-    0xc0, 0x0, 0x0, 0x79, 0x0, 0x0, 0x8, 0xc0,
-    0x0, 0x0, 0x79, 0x0, 0x0, 0x8, 0xc0, 0x0,
-    0x0, 0x79, 0x0, 0x0, 0x8, 0xc0, 0x0, 0x0,
-    0x79, 0x0, 0x0, 0x8, 0xc0, 0x0, 0x0, 0x79,
-    0x0, 0x0, 0x8, 0xc0, 0x0, 0x0, 0x79, 0x0,
-    0x0, 0x8, 0xc0, 0x0, 0x0, 0x79, 0x0, 0x0,
-    0x8, 0xc0, 0x0, 0x0, 0x79, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x61,
-
-    /* U+04B5 "ҵ" */
-    0xef, 0xff, 0xff, 0x20, 0xf0, 0x0, 0x3, 0xd0,
-    0x0, 0xf, 0x0, 0x0, 0x3d, 0x0, 0x0, 0xf0,
-    0x0, 0x3, 0xd0, 0x0, 0xf, 0x0, 0x0, 0x3d,
-    0x0, 0x0, 0xf0, 0x0, 0x3, 0xd0, 0x0, 0xf,
-    0x0, 0x0, 0x3d, 0x0, 0x0, 0xf0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x70,
-
-    /* U+04B6 "Ҷ" */
-    0x2d, 0x0, 0x0, 0x7, 0x90, 0x2, 0xd0, 0x0,
-    0x0, 0x79, 0x0, 0x2d, 0x0, 0x0, 0x7, 0x90,
-    0x2, 0xd0, 0x0, 0x0, 0x79, 0x0, 0x1f, 0x10,
-    0x0, 0x7, 0x90, 0x0, 0xab, 0x20, 0x15, 0xc9,
-    0x0, 0x0, 0x8e, 0xfe, 0xaa, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x79, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x79, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xd2, 0x0, 0x0, 0x0, 0x0, 0xd, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x61,
-
-    /* U+04B7 "ҷ" */
-    0x5a, 0x0, 0x0, 0xf0, 0x5, 0xa0, 0x0, 0xf,
-    0x0, 0x5a, 0x0, 0x0, 0xf0, 0x2, 0xe3, 0x0,
-    0x4f, 0x0, 0x5, 0xde, 0xc8, 0xf0, 0x0, 0x0,
-    0x0, 0xf, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0xc,
-    0x20, 0x0, 0x0, 0x0, 0x61,
-
-    /* U+04B8 "Ҹ" */
-    0x2d, 0x0, 0x0, 0x7, 0x92, 0xd0, 0x0, 0x0,
-    0x79, 0x2d, 0x0, 0x0, 0x7, 0x92, 0xd0, 0x3,
-    0x0, 0x79, 0x1f, 0x10, 0xc0, 0x7, 0x90, 0xab,
-    0x2c, 0x15, 0xc9, 0x0, 0x8e, 0xfe, 0xaa, 0x90,
-    0x0, 0xc, 0x0, 0x79, 0x0, 0x0, 0xc0, 0x7,
-    0x90, 0x0, 0x5, 0x0, 0x79, 0x0, 0x0, 0x0,
-    0x7, 0x90,
-
-    /* U+04B9 "ҹ" */
-    0x5a, 0x0, 0x0, 0xf5, 0xa0, 0x0, 0xf, 0x5a,
-    0x5, 0x10, 0xf2, 0xe3, 0x93, 0x5f, 0x5, 0xdf,
-    0xd8, 0xf0, 0x0, 0x92, 0xf, 0x0, 0x6, 0x10,
-    0xf0, 0x0, 0x0, 0xf,
-
-    /* U+04BA "Һ" */
-    0x5a, 0x0, 0x0, 0x0, 0x5, 0xa0, 0x0, 0x0,
-    0x0, 0x5a, 0x0, 0x0, 0x0, 0x5, 0xa0, 0x0,
-    0x0, 0x0, 0x5c, 0x9d, 0xfe, 0xa1, 0x5, 0xe6,
-    0x20, 0x19, 0xd0, 0x5a, 0x0, 0x0, 0xd, 0x45,
-    0xa0, 0x0, 0x0, 0x96, 0x5a, 0x0, 0x0, 0x9,
-    0x65, 0xa0, 0x0, 0x0, 0x96, 0x5a, 0x0, 0x0,
-    0x9, 0x60,
-
-    /* U+04BB "һ" */
-    0x96, 0x0, 0x0, 0x0, 0x96, 0x0, 0x0, 0x0,
-    0x96, 0x0, 0x0, 0x0, 0x97, 0x9e, 0xfb, 0x10,
-    0x9e, 0x60, 0x8, 0xc0, 0x9a, 0x0, 0x0, 0xe1,
-    0x96, 0x0, 0x0, 0xc2, 0x96, 0x0, 0x0, 0xc3,
-    0x96, 0x0, 0x0, 0xc3, 0x96, 0x0, 0x0, 0xc3,
-    0x96, 0x0, 0x0, 0xc3,
-
-    /* U+04BC "Ҽ" */
-    0x0, 0x0, 0x3, 0xbf, 0xfc, 0x50, 0x0, 0x0,
-    0x0, 0x6e, 0x50, 0x4, 0xd9, 0x0, 0x48, 0x2,
-    0xe2, 0x0, 0x0, 0x1e, 0x50, 0x87, 0x9, 0x80,
-    0x0, 0x0, 0x6, 0xc0, 0x6c, 0xc, 0x30, 0x0,
-    0x0, 0x1, 0xf0, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0xd, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf2, 0x0, 0x0, 0x2, 0x0, 0x0,
-    0x0, 0x6e, 0x61, 0x4, 0xbb, 0x0, 0x0, 0x0,
-    0x3, 0xbf, 0xfc, 0x70, 0x0,
-
-    /* U+04BD "ҽ" */
-    0x0, 0x0, 0x9e, 0xec, 0x40, 0x43, 0xb, 0x80,
-    0x3, 0xd3, 0xa4, 0x4c, 0x0, 0x0, 0x4b, 0x3c,
-    0xee, 0xcc, 0xcc, 0xcc, 0x0, 0x78, 0x0, 0x0,
-    0x0, 0x0, 0x3d, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xa1, 0x2, 0xb3, 0x0, 0x0, 0x8e, 0xfd, 0x70,
-
-    /* U+04BE "Ҿ" */
-    0x0, 0x0, 0x3, 0xbf, 0xfc, 0x50, 0x0, 0x0,
-    0x0, 0x6e, 0x50, 0x4, 0xd9, 0x0, 0x48, 0x2,
-    0xe2, 0x0, 0x0, 0x1e, 0x50, 0x87, 0x9, 0x80,
-    0x0, 0x0, 0x6, 0xc0, 0x6c, 0xc, 0x30, 0x0,
-    0x0, 0x1, 0xf0, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0xd, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf2, 0x0, 0x0, 0x2, 0x0, 0x0,
-    0x0, 0x6e, 0x61, 0x4, 0xbb, 0x0, 0x0, 0x0,
-    0x3, 0xbf, 0xfc, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x50,
-    0x0, 0x0,
-
-    /* U+04BF "ҿ" */
-    0x0, 0x0, 0x9e, 0xec, 0x40, 0x43, 0xb, 0x80,
-    0x3, 0xd3, 0xa4, 0x4c, 0x0, 0x0, 0x4b, 0x3c,
-    0xee, 0xcc, 0xcc, 0xcc, 0x0, 0x78, 0x0, 0x0,
-    0x0, 0x0, 0x3d, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xa1, 0x2, 0xb3, 0x0, 0x0, 0x8e, 0xfd, 0x70,
-    0x0, 0x0, 0x2, 0xc0, 0x0, 0x0, 0x0, 0x1,
-    0x60, 0x0,
-
-    /* U+04C0 "Ӏ" */
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x5b,
-
-    /* U+04C1 "Ӂ" */
-    0x0, 0x0, 0x14, 0x0, 0x32, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0x0, 0xb2, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xab, 0x60, 0x0, 0x0, 0x2e, 0x10, 0x0,
-    0x69, 0x0, 0x0, 0xd4, 0x8, 0x80, 0x0, 0x69,
-    0x0, 0x6, 0xb0, 0x0, 0xe2, 0x0, 0x69, 0x0,
-    0xe, 0x20, 0x0, 0x6a, 0x0, 0x69, 0x0, 0x88,
-    0x0, 0x0, 0xc, 0x30, 0x69, 0x2, 0xe0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0xe, 0x30, 0x69, 0x1, 0xe2, 0x0, 0x0, 0x8a,
-    0x0, 0x69, 0x0, 0x7b, 0x0, 0x2, 0xe1, 0x0,
-    0x69, 0x0, 0xd, 0x50, 0xc, 0x70, 0x0, 0x69,
-    0x0, 0x4, 0xe0, 0x5d, 0x0, 0x0, 0x69, 0x0,
-    0x0, 0xb8,
-
-    /* U+04C2 "ӂ" */
-    0x0, 0x3, 0x90, 0x1b, 0x0, 0x0, 0x0, 0x0,
-    0x7a, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4c, 0x0, 0xb, 0x40, 0x3, 0xd0,
-    0xb, 0x50, 0xb, 0x40, 0xc, 0x40, 0x2, 0xd0,
-    0xb, 0x40, 0x5b, 0x0, 0x0, 0x96, 0xb, 0x40,
-    0xd3, 0x0, 0x0, 0x5f, 0xef, 0xfe, 0xd0, 0x0,
-    0x1, 0xd4, 0xb, 0x40, 0xb8, 0x0, 0xa, 0x80,
-    0xb, 0x40, 0x1e, 0x30, 0x6c, 0x0, 0xb, 0x40,
-    0x3, 0xe1,
-
-    /* U+04C3 "Ӄ" */
-    0x5a, 0x0, 0x0, 0x2e, 0x15, 0xa0, 0x0, 0xc,
-    0x50, 0x5a, 0x0, 0x7, 0xa0, 0x5, 0xa0, 0x2,
-    0xd1, 0x0, 0x5a, 0x0, 0xc5, 0x0, 0x5, 0xff,
-    0xfe, 0x0, 0x0, 0x5a, 0x0, 0x9b, 0x0, 0x5,
-    0xa0, 0x0, 0xb8, 0x0, 0x5a, 0x0, 0x1, 0xe4,
-    0x5, 0xa0, 0x0, 0x5, 0xd0, 0x5a, 0x0, 0x0,
-    0xe, 0x30, 0x0, 0x0, 0x0, 0xb6, 0x0, 0x0,
-    0x1, 0x1e, 0x40, 0x0, 0x1, 0xdf, 0x90,
-
-    /* U+04C4 "ӄ" */
-    0x96, 0x0, 0xa, 0x79, 0x60, 0x4, 0xc0, 0x96,
-    0x0, 0xd2, 0x9, 0x60, 0x97, 0x0, 0x9f, 0xef,
-    0x30, 0x9, 0x60, 0x3e, 0x30, 0x96, 0x0, 0x4d,
-    0x9, 0x60, 0x0, 0x97, 0x0, 0x0, 0x4, 0xb0,
-    0x0, 0x10, 0x7a, 0x0, 0x9, 0xed, 0x20,
-
-    /* U+04C6 "ӆ" */
-    0x0, 0xff, 0xff, 0xf7, 0x0, 0xe, 0x0, 0x9,
-    0x70, 0x1, 0xd0, 0x0, 0x97, 0x0, 0x1c, 0x0,
-    0x9, 0x70, 0x3, 0xb0, 0x0, 0x97, 0x0, 0x58,
-    0x0, 0x9, 0x70, 0xa, 0x50, 0x0, 0x97, 0xc,
-    0xb0, 0x0, 0x9, 0xf7, 0x0, 0x0, 0x0, 0xa,
-    0x30, 0x0, 0x0, 0x0, 0x60,
-
-    /* U+04C7 "Ӈ" */
-    0x5a, 0x0, 0x0, 0x4, 0xc5, 0xa0, 0x0, 0x0,
-    0x4c, 0x5a, 0x0, 0x0, 0x4, 0xc5, 0xa0, 0x0,
-    0x0, 0x4c, 0x5a, 0x0, 0x0, 0x4, 0xc5, 0xff,
-    0xff, 0xff, 0xfc, 0x5a, 0x0, 0x0, 0x4, 0xc5,
-    0xa0, 0x0, 0x0, 0x4c, 0x5a, 0x0, 0x0, 0x4,
-    0xc5, 0xa0, 0x0, 0x0, 0x4c, 0x5a, 0x0, 0x0,
-    0x4, 0xc0, 0x0, 0x0, 0x0, 0x4c, 0x0, 0x0,
-    0x1, 0x8, 0xa0, 0x0, 0x0, 0xaf, 0xd2, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+04C8 "ӈ" */
-    0x96, 0x0, 0x0, 0xd2, 0x96, 0x0, 0x0, 0xd2,
-    0x96, 0x0, 0x0, 0xd2, 0x96, 0x0, 0x0, 0xd2,
-    0x9f, 0xee, 0xee, 0xf2, 0x96, 0x0, 0x0, 0xd2,
-    0x96, 0x0, 0x0, 0xd2, 0x96, 0x0, 0x0, 0xd2,
-    0x0, 0x0, 0x0, 0xd2, 0x0, 0x1, 0x1, 0xe0,
-    0x0, 0x5, 0xee, 0x60,
-
-    /* U+04C9 "Ӊ" */
-    0x5b, 0x0, 0x0, 0x3, 0xd0, 0x5, 0xb0, 0x0,
-    0x0, 0x3d, 0x0, 0x5b, 0x0, 0x0, 0x3, 0xd0,
-    0x5, 0xb0, 0x0, 0x0, 0x3d, 0x0, 0x5b, 0x0,
-    0x0, 0x3, 0xd0, 0x5, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x5b, 0x0, 0x0, 0x3, 0xd0, 0x5, 0xb0,
-    0x0, 0x0, 0x3d, 0x0, 0x5b, 0x0, 0x0, 0x3,
-    0xd0, 0x5, 0xb0, 0x0, 0x0, 0x3d, 0x0, 0x5b,
-    0x0, 0x0, 0x4, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x30,
-
-    /* U+04CA "ӊ" */
-    0x96, 0x0, 0x0, 0xf0, 0x9, 0x60, 0x0, 0xf,
-    0x0, 0x96, 0x0, 0x0, 0xf0, 0x9, 0x60, 0x0,
-    0xf, 0x0, 0x9f, 0xee, 0xee, 0xf0, 0x9, 0x60,
-    0x0, 0xf, 0x0, 0x96, 0x0, 0x0, 0xf0, 0x9,
-    0x60, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x1c,
-    0x0, 0x0, 0x0, 0x2, 0x40,
-
-    /* U+04CB "Ӌ" */
-    0x3d, 0x0, 0x0, 0x7, 0x83, 0xd0, 0x0, 0x0,
-    0x78, 0x3d, 0x0, 0x0, 0x7, 0x82, 0xd0, 0x0,
-    0x0, 0x78, 0x1f, 0x10, 0x0, 0x7, 0x80, 0xab,
-    0x20, 0x15, 0xd8, 0x0, 0x8e, 0xfe, 0xaa, 0x80,
-    0x0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0x7,
-    0x80, 0x0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x2,
-    0xff, 0x90, 0x0, 0x0, 0x2c, 0x0, 0x0, 0x0,
-    0x2, 0xc0, 0x0, 0x0, 0x0, 0x16, 0x0,
-
-    /* U+04CC "ӌ" */
-    0x69, 0x0, 0x0, 0xf6, 0x90, 0x0, 0xf, 0x6a,
-    0x0, 0x0, 0xf2, 0xe3, 0x0, 0x5f, 0x5, 0xde,
-    0xc8, 0xf0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0,
-    0xf0, 0x0, 0x4, 0xef, 0x0, 0x0, 0x59, 0x0,
-    0x0, 0x2, 0x40,
-
-    /* U+04CD "Ӎ" */
-    0x5c, 0x0, 0x0, 0x0, 0x4, 0xd0, 0x5, 0xf4,
-    0x0, 0x0, 0x0, 0xcd, 0x0, 0x5f, 0xc0, 0x0,
-    0x0, 0x5f, 0xd0, 0x5, 0xad, 0x40, 0x0, 0xd,
-    0x7d, 0x0, 0x5a, 0x5d, 0x0, 0x5, 0xc2, 0xd0,
-    0x5, 0xa0, 0xc5, 0x0, 0xd3, 0x2d, 0x0, 0x5a,
-    0x3, 0xd0, 0x5b, 0x2, 0xd0, 0x5, 0xa0, 0xa,
-    0x6d, 0x20, 0x2d, 0x0, 0x5a, 0x0, 0x2f, 0x90,
-    0x2, 0xd0, 0x5, 0xa0, 0x0, 0x71, 0x0, 0x2d,
-    0x0, 0x5a, 0x0, 0x0, 0x0, 0x3, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3a, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x30,
-
-    /* U+04CE "ӎ" */
-    0x9b, 0x0, 0x0, 0x8, 0xa0, 0x9f, 0x30, 0x0,
-    0x2f, 0xa0, 0x98, 0xc0, 0x0, 0xa8, 0xa0, 0x95,
-    0xa5, 0x3, 0xb4, 0xa0, 0x95, 0x2d, 0xc, 0x24,
-    0xa0, 0x95, 0x8, 0xb9, 0x4, 0xa0, 0x95, 0x0,
-    0xe1, 0x4, 0xa0, 0x95, 0x0, 0x0, 0x4, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x57, 0x0, 0x0, 0x0,
-    0x0, 0x41,
-
-    /* U+04CF "ӏ" */
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96,
-
-    /* U+04D0 "Ӑ" */
-    0x0, 0x5, 0x0, 0x23, 0x0, 0x0, 0x0, 0xc1,
-    0x9, 0x40, 0x0, 0x0, 0x3, 0xaa, 0x70, 0x0,
-    0x0, 0x0, 0x8, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xec, 0x50, 0x0, 0x0, 0x0, 0x5a, 0x4b, 0x0,
-    0x0, 0x0, 0xb, 0x40, 0xe2, 0x0, 0x0, 0x2,
-    0xd0, 0x7, 0x80, 0x0, 0x0, 0x87, 0x0, 0x1e,
-    0x0, 0x0, 0xe, 0x10, 0x0, 0xb5, 0x0, 0x5,
-    0xfe, 0xee, 0xef, 0xc0, 0x0, 0xc4, 0x0, 0x0,
-    0xe, 0x20, 0x3d, 0x0, 0x0, 0x0, 0x89, 0x9,
-    0x70, 0x0, 0x0, 0x1, 0xe0,
-
-    /* U+04D1 "ӑ" */
-    0x0, 0xb0, 0xc, 0x0, 0x5, 0xaa, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x5c, 0xfe, 0xa1, 0x7, 0x20,
-    0x9, 0x90, 0x0, 0x0, 0x1e, 0x4, 0xbc, 0xcd,
-    0xf1, 0xe2, 0x0, 0x1f, 0x3c, 0x0, 0x2, 0xf1,
-    0xe1, 0x0, 0xaf, 0x4, 0xdc, 0xc4, 0xf0,
-
-    /* U+04D2 "Ӓ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x87,
-    0x1f, 0x0, 0x0, 0x0, 0x1, 0x10, 0x20, 0x0,
-    0x0, 0x0, 0x8, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xec, 0x50, 0x0, 0x0, 0x0, 0x5a, 0x4b, 0x0,
-    0x0, 0x0, 0xb, 0x40, 0xe2, 0x0, 0x0, 0x2,
-    0xd0, 0x7, 0x80, 0x0, 0x0, 0x87, 0x0, 0x1e,
-    0x0, 0x0, 0xe, 0x10, 0x0, 0xb5, 0x0, 0x5,
-    0xfe, 0xee, 0xef, 0xc0, 0x0, 0xc4, 0x0, 0x0,
-    0xe, 0x20, 0x3d, 0x0, 0x0, 0x0, 0x89, 0x9,
-    0x70, 0x0, 0x0, 0x1, 0xe0,
-
-    /* U+04D3 "ӓ" */
-    0x0, 0xc3, 0x4b, 0x0, 0x3, 0x0, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x5c, 0xfe, 0xa1, 0x7, 0x20,
-    0x9, 0x90, 0x0, 0x0, 0x1e, 0x4, 0xbc, 0xcd,
-    0xf1, 0xe2, 0x0, 0x1f, 0x3c, 0x0, 0x2, 0xf1,
-    0xe1, 0x0, 0xaf, 0x4, 0xdc, 0xc4, 0xf0,
-
-    /* U+04D4 "Ӕ" */
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0xb, 0x8d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4c, 0x3d, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc3,
-    0x3d, 0x0, 0x0, 0x0, 0x0, 0x5, 0xb0, 0x3d,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0x20, 0x3f, 0xff,
-    0xff, 0xd0, 0x0, 0x6a, 0x0, 0x3d, 0x0, 0x0,
-    0x0, 0x0, 0xee, 0xee, 0xed, 0x0, 0x0, 0x0,
-    0x8, 0x80, 0x0, 0x3d, 0x0, 0x0, 0x0, 0x1e,
-    0x10, 0x0, 0x3d, 0x0, 0x0, 0x0, 0x97, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xfb,
-
-    /* U+04D5 "ӕ" */
-    0x5, 0xcf, 0xfa, 0x15, 0xdf, 0xd6, 0x0, 0x7,
-    0x20, 0x9, 0xdd, 0x20, 0x1b, 0x70, 0x0, 0x0,
-    0x2, 0xf3, 0x0, 0x0, 0xe0, 0x4, 0xbc, 0xcd,
-    0xfc, 0xcc, 0xcc, 0xe1, 0x1e, 0x20, 0x1, 0xf0,
-    0x0, 0x0, 0x0, 0x3c, 0x0, 0x2, 0xf3, 0x0,
-    0x0, 0x0, 0x1e, 0x20, 0xa, 0x7d, 0x20, 0x7,
-    0x70, 0x4, 0xdd, 0xd6, 0x3, 0xcd, 0xd9, 0x0,
-
-    /* U+04D6 "Ӗ" */
-    0x1, 0x40, 0x3, 0x20, 0x1, 0xc0, 0xb, 0x10,
-    0x0, 0x4a, 0xa5, 0x0, 0x5f, 0xff, 0xff, 0xf5,
-    0x5b, 0x0, 0x0, 0x0, 0x5b, 0x0, 0x0, 0x0,
-    0x5b, 0x0, 0x0, 0x0, 0x5b, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xb0, 0x5b, 0x0, 0x0, 0x0,
-    0x5b, 0x0, 0x0, 0x0, 0x5b, 0x0, 0x0, 0x0,
-    0x5b, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf8,
-
-    /* U+04D7 "ӗ" */
-    0x0, 0xa1, 0x8, 0x40, 0x0, 0x2a, 0xa8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7e, 0xec, 0x40,
-    0x8, 0xa1, 0x3, 0xd3, 0x1e, 0x0, 0x0, 0x4b,
-    0x4f, 0xcc, 0xcc, 0xcc, 0x4b, 0x0, 0x0, 0x0,
-    0x1e, 0x10, 0x0, 0x0, 0x8, 0xc2, 0x1, 0xb3,
-    0x0, 0x6d, 0xfe, 0x70,
-
-    /* U+04D8 "Ә" */
-    0x0, 0x19, 0xef, 0xea, 0x20, 0x0, 0x2e, 0x82,
-    0x1, 0x8e, 0x40, 0x0, 0x20, 0x0, 0x0, 0x5e,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb6, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xa5, 0xed, 0xdd, 0xdd, 0xdd,
-    0xeb, 0x5b, 0x0, 0x0, 0x0, 0x6, 0xa1, 0xf1,
-    0x0, 0x0, 0x0, 0xb6, 0xa, 0x90, 0x0, 0x0,
-    0x4e, 0x0, 0x1d, 0xa2, 0x1, 0x7e, 0x30, 0x0,
-    0x8, 0xdf, 0xea, 0x20, 0x0,
-
-    /* U+04D9 "ә" */
-    0x1, 0xae, 0xfb, 0x30, 0x8, 0x60, 0x4, 0xe2,
-    0x0, 0x0, 0x0, 0x6a, 0x0, 0x0, 0x0, 0x1e,
-    0x3d, 0xcc, 0xcc, 0xce, 0x1d, 0x0, 0x0, 0x5b,
-    0x9, 0x91, 0x3, 0xe3, 0x0, 0x8e, 0xec, 0x40,
-
-    /* U+04DA "Ӛ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x17, 0x80, 0x0, 0x0, 0x0, 0x20, 0x11, 0x0,
-    0x0, 0x1, 0x9e, 0xfe, 0xa2, 0x0, 0x2, 0xe8,
-    0x20, 0x18, 0xe4, 0x0, 0x2, 0x0, 0x0, 0x5,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x6a, 0x5e, 0xdd, 0xdd, 0xdd,
-    0xde, 0xb5, 0xb0, 0x0, 0x0, 0x0, 0x6a, 0x1f,
-    0x10, 0x0, 0x0, 0xb, 0x60, 0xa9, 0x0, 0x0,
-    0x4, 0xe0, 0x1, 0xda, 0x20, 0x17, 0xe3, 0x0,
-    0x0, 0x8d, 0xfe, 0xa2, 0x0,
-
-    /* U+04DB "ӛ" */
-    0x0, 0x69, 0xe, 0x20, 0x0, 0x12, 0x3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xae, 0xfb, 0x30,
-    0x8, 0x60, 0x4, 0xe2, 0x0, 0x0, 0x0, 0x6a,
-    0x0, 0x0, 0x0, 0x1e, 0x3d, 0xcc, 0xcc, 0xce,
-    0x1d, 0x0, 0x0, 0x5b, 0x9, 0x91, 0x3, 0xe3,
-    0x0, 0x8e, 0xec, 0x40,
-
-    /* U+04DC "Ӝ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0x52, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x0, 0x20, 0x0, 0x0, 0x2e, 0x10, 0x0,
-    0x69, 0x0, 0x0, 0xd4, 0x8, 0x80, 0x0, 0x69,
-    0x0, 0x6, 0xb0, 0x0, 0xe2, 0x0, 0x69, 0x0,
-    0xe, 0x20, 0x0, 0x6a, 0x0, 0x69, 0x0, 0x88,
-    0x0, 0x0, 0xc, 0x30, 0x69, 0x2, 0xe0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0xe, 0x30, 0x69, 0x1, 0xe2, 0x0, 0x0, 0x8a,
-    0x0, 0x69, 0x0, 0x7b, 0x0, 0x2, 0xe1, 0x0,
-    0x69, 0x0, 0xd, 0x50, 0xc, 0x70, 0x0, 0x69,
-    0x0, 0x4, 0xe0, 0x5d, 0x0, 0x0, 0x69, 0x0,
-    0x0, 0xb8,
-
-    /* U+04DD "ӝ" */
-    0x0, 0x0, 0xe1, 0x78, 0x0, 0x0, 0x0, 0x0,
-    0x30, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4c, 0x0, 0xb, 0x40, 0x3, 0xd0,
-    0xb, 0x50, 0xb, 0x40, 0xc, 0x40, 0x2, 0xd0,
-    0xb, 0x40, 0x5b, 0x0, 0x0, 0x96, 0xb, 0x40,
-    0xd3, 0x0, 0x0, 0x5f, 0xef, 0xfe, 0xd0, 0x0,
-    0x1, 0xd4, 0xb, 0x40, 0xb8, 0x0, 0xa, 0x80,
-    0xb, 0x40, 0x1e, 0x30, 0x6c, 0x0, 0xb, 0x40,
-    0x3, 0xe1,
-
-    /* U+04DE "Ӟ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5b, 0xd, 0x30,
-    0x0, 0x1, 0x2, 0x0, 0x1, 0x7a, 0x96, 0x0,
-    0x1e, 0x96, 0x6b, 0xd1, 0x0, 0x0, 0x0, 0xa7,
-    0x0, 0x0, 0x0, 0x88, 0x0, 0x0, 0x3, 0xd2,
-    0x0, 0xae, 0xef, 0x70, 0x0, 0x0, 0x1, 0xa8,
-    0x0, 0x0, 0x0, 0x1e, 0x0, 0x0, 0x0, 0x3e,
-    0x5b, 0x41, 0x15, 0xe6, 0x4, 0xbe, 0xfc, 0x50,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+04DF "ӟ" */
-    0x2, 0xd0, 0xa5, 0x0, 0x5, 0x4, 0x10, 0x0,
-    0x0, 0x0, 0x1, 0x9e, 0xfd, 0x70, 0x4, 0x0,
-    0x2d, 0x50, 0x0, 0x0, 0xc3, 0x0, 0x8c, 0xf8,
-    0x0, 0x0, 0x0, 0xb6, 0x0, 0x0, 0x6, 0x95,
-    0x60, 0x2, 0xd5, 0x2a, 0xee, 0xd6, 0x0,
-
-    /* U+04E0 "Ӡ" */
-    0x2f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x2, 0xd0,
-    0x0, 0x0, 0xc, 0x30, 0x0, 0x0, 0x97, 0x0,
-    0x0, 0x4, 0xc0, 0x0, 0x0, 0xb, 0xec, 0x60,
-    0x0, 0x0, 0x2, 0xd6, 0x0, 0x0, 0x0, 0x4c,
-    0x0, 0x0, 0x0, 0x4c, 0x6a, 0x30, 0x3, 0xd6,
-    0x6, 0xcf, 0xfd, 0x60,
-
-    /* U+04E1 "ӡ" */
-    0xe, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x3, 0xc0,
-    0x0, 0x0, 0xd, 0x20, 0x0, 0x0, 0x97, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x9, 0xec, 0x50,
-    0x0, 0x0, 0x3, 0xd4, 0x0, 0x0, 0x0, 0x6a,
-    0x0, 0x0, 0x0, 0x6a, 0x2c, 0x40, 0x4, 0xe4,
-    0x4, 0xbf, 0xfd, 0x50,
-
-    /* U+04E2 "Ӣ" */
-    0x0, 0x4b, 0xbb, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5a, 0x0, 0x0, 0x6, 0xe5, 0xa0, 0x0,
-    0x2, 0xfe, 0x5a, 0x0, 0x0, 0xc9, 0xe5, 0xa0,
-    0x0, 0x7c, 0x2e, 0x5a, 0x0, 0x2e, 0x22, 0xe5,
-    0xa0, 0xd, 0x60, 0x2e, 0x5a, 0x8, 0xb0, 0x2,
-    0xe5, 0xa3, 0xe1, 0x0, 0x2e, 0x5b, 0xd5, 0x0,
-    0x2, 0xe5, 0xfa, 0x0, 0x0, 0x2e, 0x5e, 0x0,
-    0x0, 0x2, 0xe0,
-
-    /* U+04E3 "ӣ" */
-    0x4, 0xbb, 0xba, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x96, 0x0, 0x2, 0xe3,
-    0x96, 0x0, 0xc, 0xf3, 0x96, 0x0, 0x98, 0xc3,
-    0x96, 0x6, 0xc0, 0xc3, 0x96, 0x3d, 0x10, 0xc3,
-    0x97, 0xd3, 0x0, 0xc3, 0x9f, 0x70, 0x0, 0xc3,
-    0x9b, 0x0, 0x0, 0xc3,
-
-    /* U+04E4 "Ӥ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x88,
-    0x0, 0x0, 0x2, 0x1, 0x10, 0x5, 0xa0, 0x0,
-    0x0, 0x6e, 0x5a, 0x0, 0x0, 0x2f, 0xe5, 0xa0,
-    0x0, 0xc, 0x9e, 0x5a, 0x0, 0x7, 0xc2, 0xe5,
-    0xa0, 0x2, 0xe2, 0x2e, 0x5a, 0x0, 0xd6, 0x2,
-    0xe5, 0xa0, 0x8b, 0x0, 0x2e, 0x5a, 0x3e, 0x10,
-    0x2, 0xe5, 0xbd, 0x50, 0x0, 0x2e, 0x5f, 0xa0,
-    0x0, 0x2, 0xe5, 0xe0, 0x0, 0x0, 0x2e,
-
-    /* U+04E5 "ӥ" */
-    0x0, 0xe0, 0x78, 0x0, 0x0, 0x30, 0x11, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x96, 0x0, 0x2, 0xe3,
-    0x96, 0x0, 0xc, 0xf3, 0x96, 0x0, 0x98, 0xc3,
-    0x96, 0x6, 0xc0, 0xc3, 0x96, 0x3d, 0x10, 0xc3,
-    0x97, 0xd3, 0x0, 0xc3, 0x9f, 0x70, 0x0, 0xc3,
-    0x9b, 0x0, 0x0, 0xc3,
-
-    /* U+04E6 "Ӧ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc3, 0x5b, 0x0, 0x0, 0x0, 0x0, 0x20, 0x1,
-    0x0, 0x0, 0x0, 0x6, 0xcf, 0xfc, 0x50, 0x0,
-    0x0, 0xac, 0x40, 0x5, 0xd8, 0x0, 0x6, 0xc0,
-    0x0, 0x0, 0x1e, 0x40, 0xe, 0x30, 0x0, 0x0,
-    0x5, 0xc0, 0x1e, 0x0, 0x0, 0x0, 0x0, 0xf0,
-    0x3d, 0x0, 0x0, 0x0, 0x0, 0xf1, 0x1e, 0x0,
-    0x0, 0x0, 0x0, 0xf0, 0xe, 0x30, 0x0, 0x0,
-    0x5, 0xc0, 0x6, 0xc0, 0x0, 0x0, 0x1e, 0x40,
-    0x0, 0xac, 0x40, 0x5, 0xd8, 0x0, 0x0, 0x6,
-    0xcf, 0xfc, 0x50, 0x0,
-
-    /* U+04E7 "ӧ" */
-    0x0, 0x4a, 0xc, 0x30, 0x0, 0x0, 0x20, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xef,
-    0xd6, 0x0, 0x8, 0xb2, 0x2, 0xd6, 0x1, 0xe1,
-    0x0, 0x2, 0xe0, 0x4b, 0x0, 0x0, 0xd, 0x24,
-    0xc0, 0x0, 0x0, 0xd2, 0x1e, 0x10, 0x0, 0x2e,
-    0x0, 0x8c, 0x20, 0x2d, 0x60, 0x0, 0x7d, 0xfd,
-    0x60, 0x0,
-
-    /* U+04E8 "Ө" */
-    0x0, 0x6, 0xcf, 0xfc, 0x50, 0x0, 0x0, 0xad,
-    0x40, 0x5, 0xd8, 0x0, 0x6, 0xd0, 0x0, 0x0,
-    0x1e, 0x50, 0xe, 0x40, 0x0, 0x0, 0x5, 0xc0,
-    0x1f, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x3f, 0xee,
-    0xee, 0xee, 0xee, 0xf1, 0x1f, 0x0, 0x0, 0x0,
-    0x0, 0xf0, 0xe, 0x40, 0x0, 0x0, 0x5, 0xc0,
-    0x6, 0xc0, 0x0, 0x0, 0x1e, 0x50, 0x0, 0xad,
-    0x40, 0x5, 0xd8, 0x0, 0x0, 0x6, 0xcf, 0xfc,
-    0x50, 0x0,
-
-    /* U+04E9 "ө" */
-    0x0, 0x6d, 0xdd, 0x70, 0x0, 0x89, 0x0, 0x9,
-    0x80, 0x1d, 0x0, 0x0, 0xc, 0x14, 0xec, 0xcc,
-    0xcc, 0xe4, 0x4c, 0x0, 0x0, 0xb, 0x41, 0xf1,
-    0x0, 0x1, 0xf1, 0x8, 0xc1, 0x1, 0xc8, 0x0,
-    0x6, 0xde, 0xd7, 0x0,
-
-    /* U+04EA "Ӫ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc3, 0x5b, 0x0, 0x0, 0x0, 0x0, 0x20, 0x1,
-    0x0, 0x0, 0x0, 0x6, 0xcf, 0xfc, 0x50, 0x0,
-    0x0, 0xad, 0x40, 0x5, 0xd8, 0x0, 0x6, 0xd0,
-    0x0, 0x0, 0x1e, 0x50, 0xe, 0x40, 0x0, 0x0,
-    0x5, 0xc0, 0x1f, 0x0, 0x0, 0x0, 0x0, 0xf0,
-    0x3f, 0xee, 0xee, 0xee, 0xee, 0xf1, 0x1f, 0x0,
-    0x0, 0x0, 0x0, 0xf0, 0xe, 0x40, 0x0, 0x0,
-    0x5, 0xc0, 0x6, 0xc0, 0x0, 0x0, 0x1e, 0x50,
-    0x0, 0xad, 0x40, 0x5, 0xd8, 0x0, 0x0, 0x6,
-    0xcf, 0xfc, 0x50, 0x0,
-
-    /* U+04EB "ӫ" */
-    0x0, 0x3c, 0xb, 0x40, 0x0, 0x0, 0x30, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xdd,
-    0xd7, 0x0, 0x8, 0x90, 0x0, 0x98, 0x1, 0xd0,
-    0x0, 0x0, 0xc1, 0x4e, 0xcc, 0xcc, 0xce, 0x44,
-    0xc0, 0x0, 0x0, 0xb4, 0x1f, 0x10, 0x0, 0x1f,
-    0x10, 0x8c, 0x10, 0x1c, 0x80, 0x0, 0x6d, 0xed,
-    0x70, 0x0,
-
-    /* U+04EC "Ӭ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5b, 0xd,
-    0x30, 0x0, 0x0, 0x1, 0x2, 0x0, 0x0, 0x4,
-    0xbf, 0xfc, 0x60, 0x0, 0x4e, 0x50, 0x4, 0xd9,
-    0x0, 0x1, 0x0, 0x0, 0x1e, 0x50, 0x0, 0x0,
-    0x0, 0x6, 0xc0, 0x0, 0x0, 0x0, 0x1, 0xf0,
-    0x0, 0xe, 0xee, 0xee, 0xf0, 0x0, 0x0, 0x0,
-    0x1, 0xf0, 0x0, 0x0, 0x0, 0x5, 0xc0, 0x1,
-    0x0, 0x0, 0x1e, 0x50, 0x4d, 0x50, 0x4, 0xd9,
-    0x0, 0x4, 0xbf, 0xfc, 0x60, 0x0,
-
-    /* U+04ED "ӭ" */
-    0x2, 0xd0, 0x95, 0x0, 0x0, 0x30, 0x21, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x19, 0xde, 0xd6, 0x0,
-    0x35, 0x0, 0x1b, 0x80, 0x0, 0x0, 0x0, 0xe1,
-    0x0, 0x7d, 0xdd, 0xf4, 0x0, 0x0, 0x0, 0xa4,
-    0x0, 0x0, 0x0, 0xe1, 0x58, 0x0, 0x2b, 0x70,
-    0x8, 0xee, 0xd6, 0x0,
-
-    /* U+04EE "Ӯ" */
-    0x0, 0x5b, 0xbb, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7a, 0x0, 0x0, 0x0, 0xe2, 0xe,
-    0x20, 0x0, 0x6, 0xa0, 0x7, 0x90, 0x0, 0xd,
-    0x20, 0x0, 0xe1, 0x0, 0x5a, 0x0, 0x0, 0x88,
-    0x0, 0xd2, 0x0, 0x0, 0x1e, 0x14, 0xa0, 0x0,
-    0x0, 0x8, 0x8c, 0x30, 0x0, 0x0, 0x1, 0xeb,
-    0x0, 0x0, 0x0, 0x0, 0xd3, 0x0, 0x0, 0x1,
-    0x8, 0xa0, 0x0, 0x0, 0x9, 0xfb, 0x10, 0x0,
-    0x0,
-
-    /* U+04EF "ӯ" */
-    0x0, 0x5b, 0xbb, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa5, 0x0,
-    0x0, 0x87, 0x4, 0xc0, 0x0, 0xe, 0x10, 0xd,
-    0x20, 0x5, 0xa0, 0x0, 0x69, 0x0, 0xb3, 0x0,
-    0x0, 0xe0, 0x2c, 0x0, 0x0, 0x9, 0x68, 0x60,
-    0x0, 0x0, 0x2d, 0xd0, 0x0, 0x0, 0x0, 0xc9,
-    0x0, 0x0, 0x0, 0xd, 0x20, 0x0, 0x4, 0x6,
-    0xb0, 0x0, 0x1, 0xce, 0xc1, 0x0, 0x0,
-
-    /* U+04F0 "Ӱ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0x9,
-    0x60, 0x0, 0x0, 0x2, 0x1, 0x0, 0x0, 0x7a,
-    0x0, 0x0, 0x0, 0xe2, 0xe, 0x20, 0x0, 0x6,
-    0xa0, 0x7, 0x90, 0x0, 0xd, 0x20, 0x0, 0xe1,
-    0x0, 0x5a, 0x0, 0x0, 0x88, 0x0, 0xd2, 0x0,
-    0x0, 0x1e, 0x14, 0xa0, 0x0, 0x0, 0x8, 0x8c,
-    0x30, 0x0, 0x0, 0x1, 0xeb, 0x0, 0x0, 0x0,
-    0x0, 0xd3, 0x0, 0x0, 0x1, 0x8, 0xa0, 0x0,
-    0x0, 0x9, 0xfb, 0x10, 0x0, 0x0,
-
-    /* U+04F1 "ӱ" */
-    0x0, 0x1e, 0x8, 0x70, 0x0, 0x0, 0x30, 0x21,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa5, 0x0,
-    0x0, 0x87, 0x4, 0xc0, 0x0, 0xe, 0x10, 0xd,
-    0x20, 0x5, 0xa0, 0x0, 0x69, 0x0, 0xb3, 0x0,
-    0x0, 0xe0, 0x2c, 0x0, 0x0, 0x9, 0x68, 0x60,
-    0x0, 0x0, 0x2d, 0xd0, 0x0, 0x0, 0x0, 0xc9,
-    0x0, 0x0, 0x0, 0xd, 0x20, 0x0, 0x4, 0x6,
-    0xb0, 0x0, 0x1, 0xce, 0xc1, 0x0, 0x0,
-
-    /* U+04F2 "Ӳ" */
-    0x0, 0x0, 0xd2, 0xa6, 0x0, 0x0, 0x8, 0x44,
-    0x80, 0x0, 0x7a, 0x0, 0x0, 0x0, 0xe2, 0xe,
-    0x20, 0x0, 0x6, 0xa0, 0x7, 0x90, 0x0, 0xd,
-    0x20, 0x0, 0xe1, 0x0, 0x5a, 0x0, 0x0, 0x88,
-    0x0, 0xd2, 0x0, 0x0, 0x1e, 0x14, 0xa0, 0x0,
-    0x0, 0x8, 0x8c, 0x30, 0x0, 0x0, 0x1, 0xeb,
-    0x0, 0x0, 0x0, 0x0, 0xd3, 0x0, 0x0, 0x1,
-    0x8, 0xa0, 0x0, 0x0, 0x9, 0xfb, 0x10, 0x0,
-    0x0,
-
-    /* U+04F3 "ӳ" */
-    0x0, 0x0, 0xd3, 0xa6, 0x0, 0x0, 0x75, 0x49,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa5, 0x0,
-    0x0, 0x87, 0x4, 0xc0, 0x0, 0xe, 0x10, 0xd,
-    0x20, 0x5, 0xa0, 0x0, 0x69, 0x0, 0xb3, 0x0,
-    0x0, 0xe0, 0x2c, 0x0, 0x0, 0x9, 0x68, 0x60,
-    0x0, 0x0, 0x2d, 0xd0, 0x0, 0x0, 0x0, 0xc9,
-    0x0, 0x0, 0x0, 0xd, 0x20, 0x0, 0x4, 0x6,
-    0xb0, 0x0, 0x1, 0xce, 0xc1, 0x0, 0x0,
-
-    /* U+04F4 "Ӵ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf0, 0x87,
-    0x0, 0x0, 0x2, 0x1, 0x10, 0x2, 0xd0, 0x0,
-    0x0, 0x79, 0x2d, 0x0, 0x0, 0x7, 0x92, 0xd0,
-    0x0, 0x0, 0x79, 0x2d, 0x0, 0x0, 0x7, 0x91,
-    0xf1, 0x0, 0x0, 0x79, 0xa, 0xb2, 0x1, 0x5c,
-    0x90, 0x8, 0xef, 0xea, 0xa9, 0x0, 0x0, 0x0,
-    0x7, 0x90, 0x0, 0x0, 0x0, 0x79, 0x0, 0x0,
-    0x0, 0x7, 0x90, 0x0, 0x0, 0x0, 0x79,
-
-    /* U+04F5 "ӵ" */
-    0x0, 0xe1, 0x78, 0x0, 0x3, 0x1, 0x10, 0x0,
-    0x0, 0x0, 0x5, 0xa0, 0x0, 0xf, 0x5a, 0x0,
-    0x0, 0xf5, 0xa0, 0x0, 0xf, 0x2e, 0x30, 0x4,
-    0xf0, 0x5d, 0xec, 0x8f, 0x0, 0x0, 0x0, 0xf0,
-    0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0xf0,
-
-    /* U+04F6 "Ӷ" */
-    0x5f, 0xff, 0xff, 0xd5, 0xa0, 0x0, 0x0, 0x5a,
-    0x0, 0x0, 0x5, 0xa0, 0x0, 0x0, 0x5a, 0x0,
-    0x0, 0x5, 0xa0, 0x0, 0x0, 0x5a, 0x0, 0x0,
-    0x5, 0xa0, 0x0, 0x0, 0x5a, 0x0, 0x0, 0x5,
-    0xa0, 0x0, 0x0, 0x6f, 0xf3, 0x0, 0x0, 0xc,
-    0x30, 0x0, 0x0, 0xc3, 0x0, 0x0, 0x6, 0x10,
-    0x0,
-
-    /* U+04F7 "ӷ" */
-    0x9f, 0xff, 0xf9, 0x96, 0x0, 0x0, 0x96, 0x0,
-    0x0, 0x96, 0x0, 0x0, 0x96, 0x0, 0x0, 0x96,
-    0x0, 0x0, 0x96, 0x0, 0x0, 0xaf, 0x80, 0x0,
-    0x5, 0x90, 0x0, 0x2, 0x40, 0x0,
-
-    /* U+04F8 "Ӹ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe2, 0x69, 0x0, 0x0, 0x0, 0x0, 0x20, 0x1,
-    0x0, 0x0, 0x5a, 0x0, 0x0, 0x0, 0x0, 0xf0,
-    0x5a, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x5a, 0x0,
-    0x0, 0x0, 0x0, 0xf0, 0x5a, 0x0, 0x0, 0x0,
-    0x0, 0xf0, 0x5f, 0xee, 0xee, 0xa1, 0x0, 0xf0,
-    0x5a, 0x0, 0x1, 0x8d, 0x0, 0xf0, 0x5a, 0x0,
-    0x0, 0xd, 0x30, 0xf0, 0x5a, 0x0, 0x0, 0xb,
-    0x40, 0xf0, 0x5a, 0x0, 0x0, 0xe, 0x30, 0xf0,
-    0x5a, 0x0, 0x0, 0x8c, 0x0, 0xf0, 0x5f, 0xee,
-    0xee, 0x91, 0x0, 0xf0,
-
-    /* U+04F9 "ӹ" */
-    0x0, 0x1e, 0x8, 0x70, 0x0, 0x0, 0x30, 0x11,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x60, 0x0,
-    0x0, 0x69, 0x96, 0x0, 0x0, 0x6, 0x99, 0x60,
-    0x0, 0x0, 0x69, 0x9d, 0xcc, 0xc5, 0x6, 0x99,
-    0x60, 0x2, 0xe2, 0x69, 0x96, 0x0, 0xa, 0x56,
-    0x99, 0x60, 0x1, 0xe2, 0x69, 0x9e, 0xcc, 0xd5,
-    0x6, 0x90,
-
-    /* U+04FA "Ӻ" */
-    0x0, 0xff, 0xff, 0xff, 0x30, 0xf, 0x0, 0x0,
-    0x0, 0x0, 0xf0, 0x0, 0x0, 0x0, 0xf, 0x0,
-    0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x0, 0xf,
-    0x0, 0x0, 0x0, 0x7d, 0xfd, 0xdd, 0xd3, 0x0,
-    0xf, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x0,
-    0x0, 0xf, 0x0, 0x0, 0x0, 0x0, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x87, 0x0, 0x0, 0x1, 0xc,
-    0x50, 0x0, 0x1, 0xdf, 0xa0, 0x0, 0x0,
-
-    /* U+04FB "ӻ" */
-    0x5, 0xff, 0xff, 0x50, 0x5b, 0x0, 0x0, 0x5,
-    0xb0, 0x0, 0x0, 0x5b, 0x0, 0x0, 0x5d, 0xfc,
-    0xc9, 0x0, 0x5b, 0x0, 0x0, 0x5, 0xb0, 0x0,
-    0x0, 0x5f, 0xc0, 0x0, 0x0, 0x2d, 0x0, 0x1,
-    0x5, 0xb0, 0x0, 0x8e, 0xd3, 0x0, 0x0,
-
-    /* U+04FC "Ӽ" */
-    0x2e, 0x10, 0x0, 0xd, 0x40, 0x8a, 0x0, 0x7,
-    0xa0, 0x0, 0xd5, 0x2, 0xe1, 0x0, 0x3, 0xe1,
-    0xc5, 0x0, 0x0, 0x9, 0xdb, 0x0, 0x0, 0x0,
-    0x3f, 0x60, 0x0, 0x0, 0xc, 0x8e, 0x10, 0x0,
-    0x7, 0xb0, 0x7b, 0x0, 0x2, 0xe1, 0x0, 0xc6,
-    0x0, 0xb7, 0x0, 0x2, 0xe1, 0x6c, 0x0, 0x0,
-    0xb, 0x70, 0x0, 0x0, 0x0, 0x7a, 0x0, 0x0,
-    0x1, 0xa, 0x80, 0x0, 0x0, 0xbe, 0xc1,
-
-    /* U+04FD "ӽ" */
-    0x4d, 0x0, 0x7, 0x90, 0x8, 0x90, 0x3d, 0x0,
-    0x0, 0xd5, 0xd3, 0x0, 0x0, 0x3f, 0x80, 0x0,
-    0x0, 0x5e, 0xc0, 0x0, 0x1, 0xe2, 0xa8, 0x0,
-    0xb, 0x60, 0xd, 0x30, 0x6b, 0x0, 0x4, 0xc0,
-    0x0, 0x0, 0x0, 0xe1, 0x0, 0x0, 0x2, 0xf1,
-    0x0, 0x4, 0xee, 0x60,
-
-    /* U+04FE "Ӿ" */
-    0x1e, 0x30, 0x0, 0xd, 0x50, 0x6c, 0x0, 0x7,
-    0xb0, 0x0, 0xc7, 0x2, 0xe2, 0x0, 0x2, 0xe1,
-    0xb8, 0x0, 0x0, 0x8, 0xdd, 0x0, 0x0, 0x8d,
-    0xef, 0xfd, 0xb0, 0x0, 0x9, 0xce, 0x10, 0x0,
-    0x4, 0xe0, 0x9a, 0x0, 0x0, 0xd4, 0x0, 0xe5,
-    0x0, 0x9a, 0x0, 0x4, 0xe1, 0x3e, 0x10, 0x0,
-    0x9, 0x90,
-
-    /* U+04FF "ӿ" */
-    0x1e, 0x20, 0x4, 0xc0, 0x4, 0xd1, 0x2d, 0x10,
-    0x0, 0x7b, 0xd3, 0x0, 0x8, 0xcf, 0xfc, 0x60,
-    0x0, 0x5c, 0xe2, 0x0, 0x1, 0xe2, 0x5c, 0x0,
-    0xa, 0x70, 0xb, 0x60, 0x4d, 0x0, 0x2, 0xe1,
-
     /* U+2022 "•" */
     0x12, 0xe, 0xf0, 0xbd, 0x0
 };
@@ -4079,228 +2095,7 @@ static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 10238, .adv_w = 146, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
     {.bitmap_index = 10301, .adv_w = 114, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
     {.bitmap_index = 10340, .adv_w = 66, .box_w = 6, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10373, .adv_w = 148, .box_w = 8, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10429, .adv_w = 148, .box_w = 8, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10485, .adv_w = 185, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 10551, .adv_w = 128, .box_w = 7, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10600, .adv_w = 158, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10655, .adv_w = 140, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10705, .adv_w = 69, .box_w = 2, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10716, .adv_w = 68, .box_w = 4, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10744, .adv_w = 118, .box_w = 6, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10777, .adv_w = 266, .box_w = 16, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10865, .adv_w = 265, .box_w = 16, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10953, .adv_w = 187, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11014, .adv_w = 157, .box_w = 9, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11077, .adv_w = 185, .box_w = 9, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11140, .adv_w = 152, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11210, .adv_w = 181, .box_w = 9, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 11273, .adv_w = 167, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11334, .adv_w = 163, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11384, .adv_w = 168, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11434, .adv_w = 128, .box_w = 7, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11473, .adv_w = 178, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 11550, .adv_w = 148, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11594, .adv_w = 226, .box_w = 14, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11671, .adv_w = 142, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 11719, .adv_w = 185, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11769, .adv_w = 185, .box_w = 9, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11832, .adv_w = 157, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11882, .adv_w = 176, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11937, .adv_w = 216, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11998, .adv_w = 184, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12048, .adv_w = 191, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12114, .adv_w = 185, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12164, .adv_w = 159, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12214, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12269, .adv_w = 132, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12319, .adv_w = 152, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12374, .adv_w = 205, .box_w = 13, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12446, .adv_w = 146, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12496, .adv_w = 185, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 12573, .adv_w = 164, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12623, .adv_w = 245, .box_w = 13, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12695, .adv_w = 250, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 12800, .adv_w = 184, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12861, .adv_w = 219, .box_w = 12, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12927, .adv_w = 159, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12977, .adv_w = 158, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13032, .adv_w = 245, .box_w = 14, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13109, .adv_w = 164, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13159, .adv_w = 131, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13187, .adv_w = 148, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13241, .adv_w = 136, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13269, .adv_w = 106, .box_w = 6, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13293, .adv_w = 146, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 13338, .adv_w = 138, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13370, .adv_w = 185, .box_w = 12, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13418, .adv_w = 120, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13446, .adv_w = 154, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13478, .adv_w = 154, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13522, .adv_w = 130, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13550, .adv_w = 142, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13582, .adv_w = 177, .box_w = 9, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13618, .adv_w = 151, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13650, .adv_w = 142, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13686, .adv_w = 151, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13718, .adv_w = 154, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 13762, .adv_w = 126, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13794, .adv_w = 106, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13822, .adv_w = 125, .box_w = 9, .box_h = 11, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 13872, .adv_w = 176, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 13949, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13981, .adv_w = 153, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 14026, .adv_w = 134, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14054, .adv_w = 208, .box_w = 11, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14098, .adv_w = 208, .box_w = 12, .box_h = 10, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 14158, .adv_w = 139, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14194, .adv_w = 176, .box_w = 9, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14230, .adv_w = 126, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14258, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14290, .adv_w = 194, .box_w = 11, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14334, .adv_w = 136, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14366, .adv_w = 140, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14410, .adv_w = 138, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14454, .adv_w = 150, .box_w = 10, .box_h = 14, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 14524, .adv_w = 106, .box_w = 6, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14557, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14589, .adv_w = 118, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14617, .adv_w = 61, .box_w = 2, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14628, .adv_w = 60, .box_w = 4, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14650, .adv_w = 61, .box_w = 5, .box_h = 14, .ofs_x = -2, .ofs_y = -3},
-    {.bitmap_index = 14685, .adv_w = 206, .box_w = 13, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14737, .adv_w = 211, .box_w = 12, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14785, .adv_w = 150, .box_w = 10, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 14840, .adv_w = 130, .box_w = 7, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14879, .adv_w = 154, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14923, .adv_w = 125, .box_w = 9, .box_h = 14, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 14986, .adv_w = 143, .box_w = 7, .box_h = 10, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 15021, .adv_w = 180, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15082, .adv_w = 134, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15126, .adv_w = 198, .box_w = 13, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15198, .adv_w = 152, .box_w = 10, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15238, .adv_w = 191, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15304, .adv_w = 145, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15340, .adv_w = 168, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15406, .adv_w = 129, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15447, .adv_w = 190, .box_w = 11, .box_h = 17, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 15541, .adv_w = 158, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 15600, .adv_w = 165, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15655, .adv_w = 133, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15687, .adv_w = 164, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15737, .adv_w = 156, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 15781, .adv_w = 129, .box_w = 7, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15827, .adv_w = 101, .box_w = 6, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15857, .adv_w = 136, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15907, .adv_w = 112, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15935, .adv_w = 157, .box_w = 9, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 15998, .adv_w = 133, .box_w = 7, .box_h = 12, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 16040, .adv_w = 236, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 16145, .adv_w = 193, .box_w = 12, .box_h = 10, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 16205, .adv_w = 142, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 16261, .adv_w = 120, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 16296, .adv_w = 168, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 16366, .adv_w = 130, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 16406, .adv_w = 163, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16456, .adv_w = 134, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16488, .adv_w = 162, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16543, .adv_w = 130, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16587, .adv_w = 182, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16653, .adv_w = 145, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16689, .adv_w = 189, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 16766, .adv_w = 155, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 16811, .adv_w = 244, .box_w = 15, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16894, .adv_w = 196, .box_w = 12, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16942, .adv_w = 270, .box_w = 16, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 17054, .adv_w = 217, .box_w = 13, .box_h = 12, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 17132, .adv_w = 218, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 17210, .adv_w = 178, .box_w = 11, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17254, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 17324, .adv_w = 126, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 17364, .adv_w = 132, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 17427, .adv_w = 106, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 17462, .adv_w = 146, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17512, .adv_w = 125, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 17556, .adv_w = 146, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17606, .adv_w = 125, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 17650, .adv_w = 155, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 17720, .adv_w = 118, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 17760, .adv_w = 217, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 17858, .adv_w = 170, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 17913, .adv_w = 169, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 17990, .adv_w = 139, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 18035, .adv_w = 164, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18085, .adv_w = 134, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18113, .adv_w = 164, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18163, .adv_w = 150, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18207, .adv_w = 218, .box_w = 14, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18284, .adv_w = 168, .box_w = 10, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18324, .adv_w = 218, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 18422, .adv_w = 168, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 18472, .adv_w = 69, .box_w = 2, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18483, .adv_w = 226, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18581, .adv_w = 185, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18647, .adv_w = 157, .box_w = 9, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 18710, .adv_w = 130, .box_w = 7, .box_h = 11, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 18749, .adv_w = 146, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 18794, .adv_w = 183, .box_w = 9, .box_h = 15, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 18862, .adv_w = 153, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 18906, .adv_w = 189, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 18983, .adv_w = 155, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 19028, .adv_w = 163, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 19091, .adv_w = 134, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 19126, .adv_w = 222, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 19217, .adv_w = 183, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 19267, .adv_w = 61, .box_w = 2, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 19278, .adv_w = 167, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19355, .adv_w = 131, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19394, .adv_w = 167, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19471, .adv_w = 131, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19510, .adv_w = 230, .box_w = 14, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19587, .adv_w = 222, .box_w = 14, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19643, .adv_w = 148, .box_w = 8, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 19699, .adv_w = 140, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19743, .adv_w = 185, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19804, .adv_w = 138, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19836, .adv_w = 185, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19913, .adv_w = 138, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19957, .adv_w = 226, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 20055, .adv_w = 185, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 20121, .adv_w = 142, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 20181, .adv_w = 120, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 20220, .adv_w = 138, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 20264, .adv_w = 115, .box_w = 8, .box_h = 11, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 20308, .adv_w = 185, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20367, .adv_w = 154, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20411, .adv_w = 185, .box_w = 9, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20474, .adv_w = 154, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20518, .adv_w = 191, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 20602, .adv_w = 142, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 20652, .adv_w = 191, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 20718, .adv_w = 145, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 20754, .adv_w = 191, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 20838, .adv_w = 145, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 20888, .adv_w = 158, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 20958, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21002, .adv_w = 152, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21067, .adv_w = 125, .box_w = 9, .box_h = 14, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 21130, .adv_w = 152, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21200, .adv_w = 125, .box_w = 9, .box_h = 14, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 21263, .adv_w = 152, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21328, .adv_w = 125, .box_w = 9, .box_h = 14, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 21391, .adv_w = 164, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21454, .adv_w = 134, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21493, .adv_w = 128, .box_w = 7, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 21542, .adv_w = 106, .box_w = 6, .box_h = 10, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 21572, .adv_w = 219, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 21656, .adv_w = 176, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 21706, .adv_w = 136, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 21769, .adv_w = 107, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 21808, .adv_w = 146, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 21871, .adv_w = 117, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 21915, .adv_w = 150, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21965, .adv_w = 124, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21997, .adv_w = 66, .box_w = 3, .box_h = 3, .ofs_x = 1, .ofs_y = 3}
+    {.bitmap_index = 10373, .adv_w = 66, .box_w = 3, .box_h = 3, .ofs_x = 1, .ofs_y = 3}
 };
 
 /*---------------------
@@ -4311,10 +2106,6 @@ static const uint16_t unicode_list_1[] = {
     0x0, 0x23, 0x43
 };
 
-static const uint16_t unicode_list_4[] = {
-    0x0, 0x1, 0x8, 0x9, 0x10, 0x11, 0x12, 0x13
-};
-
 /*Collect the unicode lists and glyph_id offsets*/
 static const lv_font_fmt_txt_cmap_t cmaps[] =
 {
@@ -4331,23 +2122,7 @@ static const lv_font_fmt_txt_cmap_t cmaps[] =
         .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
     },
     {
-        .range_start = 1024, .range_length = 96, .glyph_id_start = 227,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 1122, .range_length = 20, .glyph_id_start = 323,
-        .unicode_list = unicode_list_4, .glyph_id_ofs_list = NULL, .list_length = 8, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    },
-    {
-        .range_start = 1162, .range_length = 59, .glyph_id_start = 331,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 1222, .range_length = 58, .glyph_id_start = 390,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 8226, .range_length = 1, .glyph_id_start = 448,
+        .range_start = 8226, .range_length = 1, .glyph_id_start = 227,
         .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
     }
 };
@@ -4373,7 +2148,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmaps = cmaps,
     .kern_dsc = NULL,
     .kern_scale = 0,
-    .cmap_num = 8,
+    .cmap_num = 4,
     .bpp = 4,
     .kern_classes = 0,
     .bitmap_format = 0,
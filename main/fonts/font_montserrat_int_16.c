@@ -1,7 +1,7 @@
 /*******************************************************************************
  * Size: 16 px
  * Bpp: 4
- * Opts: --no-compress --bpp 4 --size 16 --font Montserrat-Medium-static.ttf --range 0x20-0x7F,0x100-0x17F,0x400-0x4FF --symbols °•ąćęłńóśźżĄĆĘŁŃÓŚŹŻ --format lvgl -o font_montserrat_int_16.c
+ * Opts: --no-compress --bpp 4 --size 16 --font Montserrat-Medium-static.ttf --range 0x20-0x7F,0x100-0x17F --symbols °•ąćęłńóśźżĄĆĘŁŃÓŚŹŻ --format lvgl -o font_montserrat_int_16.c
  ******************************************************************************/
 
 #ifdef LV_LVGL_H_INCLUDE_SIMPLE
@@ -2203,2372 +2203,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0xf, 0x10, 0x0, 0x0, 0xf1, 0x0, 0x0, 0xf,
     0x10, 0x0, 0x0, 0xf1, 0x0, 0x0,
 
-    /* U+0400 "Ѐ" */
-    0x0, 0x5e, 0x30, 0x0, 0x0, 0x0, 0x2c, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf9, 0x1f, 0x21, 0x11, 0x11, 0x1, 0xf1,
-    0x0, 0x0, 0x0, 0x1f, 0x10, 0x0, 0x0, 0x1,
-    0xf1, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfc,
-    0x1, 0xf3, 0x22, 0x22, 0x10, 0x1f, 0x10, 0x0,
-    0x0, 0x1, 0xf1, 0x0, 0x0, 0x0, 0x1f, 0x10,
-    0x0, 0x0, 0x1, 0xf2, 0x11, 0x11, 0x11, 0x1f,
-    0xff, 0xff, 0xff, 0xd0,
-
-    /* U+0401 "Ё" */
-    0x0, 0x1, 0x0, 0x0, 0x0, 0x4, 0xf0, 0x7c,
-    0x0, 0x0, 0x3, 0x1, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x91, 0xf2,
-    0x11, 0x11, 0x10, 0x1f, 0x10, 0x0, 0x0, 0x1,
-    0xf1, 0x0, 0x0, 0x0, 0x1f, 0x10, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xc0, 0x1f, 0x32, 0x22,
-    0x21, 0x1, 0xf1, 0x0, 0x0, 0x0, 0x1f, 0x10,
-    0x0, 0x0, 0x1, 0xf1, 0x0, 0x0, 0x0, 0x1f,
-    0x21, 0x11, 0x11, 0x11, 0xff, 0xff, 0xff, 0xfd,
-
-    /* U+0402 "Ђ" */
-    0xdf, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x1, 0x11,
-    0x1e, 0x51, 0x11, 0x0, 0x0, 0x0, 0x0, 0xd4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd4, 0x1, 0x32, 0x0,
-    0x0, 0x0, 0xd, 0xbe, 0xfd, 0xfe, 0x40, 0x0,
-    0x0, 0xda, 0x30, 0x0, 0x7f, 0x20, 0x0, 0xd,
-    0x40, 0x0, 0x0, 0xc7, 0x0, 0x0, 0xd4, 0x0,
-    0x0, 0xa, 0x80, 0x0, 0xd, 0x40, 0x0, 0x0,
-    0xd6, 0x0, 0x0, 0xd4, 0x0, 0x1, 0x9e, 0x10,
-    0x0, 0xd, 0x40, 0x6f, 0xfc, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0403 "Ѓ" */
-    0x0, 0x0, 0x2d, 0x60, 0x0, 0x0, 0x3c, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf0, 0x1f, 0x21, 0x11, 0x11, 0x1, 0xf0,
-    0x0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x0, 0x1,
-    0xf0, 0x0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x0,
-    0x1, 0xf0, 0x0, 0x0, 0x0, 0x1f, 0x10, 0x0,
-    0x0, 0x1, 0xf1, 0x0, 0x0, 0x0, 0x1f, 0x10,
-    0x0, 0x0, 0x1, 0xf1, 0x0, 0x0, 0x0, 0x1f,
-    0x10, 0x0, 0x0, 0x0,
-
-    /* U+0404 "Є" */
-    0x0, 0x2, 0x9e, 0xfe, 0xb4, 0x0, 0x4, 0xfa,
-    0x42, 0x37, 0xe7, 0x1, 0xf7, 0x0, 0x0, 0x1,
-    0x10, 0x9b, 0x0, 0x0, 0x0, 0x0, 0xe, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xee, 0xee, 0xd0,
-    0x0, 0xf, 0x41, 0x11, 0x11, 0x0, 0x0, 0xe5,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x70, 0x0, 0x0, 0x33, 0x0,
-    0x4f, 0xa4, 0x23, 0x8f, 0x60, 0x0, 0x29, 0xef,
-    0xea, 0x30,
-
-    /* U+0405 "Ѕ" */
-    0x0, 0x4c, 0xff, 0xd9, 0x20, 0x4, 0xf6, 0x21,
-    0x39, 0x80, 0xc, 0x70, 0x0, 0x0, 0x0, 0xd,
-    0x50, 0x0, 0x0, 0x0, 0x9, 0xd2, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xb7, 0x20, 0x0, 0x0, 0x2,
-    0x6b, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x1a, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xf2, 0x3, 0x0, 0x0,
-    0x1, 0xf1, 0xe, 0xb4, 0x11, 0x4d, 0xa0, 0x1,
-    0x8d, 0xff, 0xd7, 0x0,
-
-    /* U+0406 "І" */
-    0x1f, 0x11, 0xf1, 0x1f, 0x11, 0xf1, 0x1f, 0x11,
-    0xf1, 0x1f, 0x11, 0xf1, 0x1f, 0x11, 0xf1, 0x1f,
-    0x11, 0xf1,
-
-    /* U+0407 "Ї" */
-    0x0, 0x0, 0xa, 0x90, 0xc7, 0x22, 0x2, 0x10,
-    0x0, 0x0, 0x2, 0xf0, 0x0, 0x2f, 0x0, 0x2,
-    0xf0, 0x0, 0x2f, 0x0, 0x2, 0xf0, 0x0, 0x2f,
-    0x0, 0x2, 0xf0, 0x0, 0x2f, 0x0, 0x2, 0xf0,
-    0x0, 0x2f, 0x0, 0x2, 0xf0, 0x0, 0x2f, 0x0,
-
-    /* U+0408 "Ј" */
-    0x9, 0xff, 0xff, 0xb0, 0x1, 0x11, 0x8b, 0x0,
-    0x0, 0x7, 0xb0, 0x0, 0x0, 0x7b, 0x0, 0x0,
-    0x7, 0xb0, 0x0, 0x0, 0x7b, 0x0, 0x0, 0x7,
-    0xb0, 0x0, 0x0, 0x7b, 0x0, 0x0, 0x7, 0xb1,
-    0x20, 0x0, 0xa9, 0x6e, 0x41, 0x5f, 0x30, 0x6d,
-    0xfd, 0x50,
-
-    /* U+0409 "Љ" */
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf2, 0x11, 0x11, 0x8c, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x8,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x8c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x0, 0x0, 0x8, 0xfe, 0xee, 0xec, 0x60, 0x0,
-    0x1, 0xf0, 0x0, 0x0, 0x8c, 0x11, 0x12, 0x5e,
-    0x90, 0x0, 0x2e, 0x0, 0x0, 0x8, 0xc0, 0x0,
-    0x0, 0x3f, 0x10, 0x4, 0xc0, 0x0, 0x0, 0x8c,
-    0x0, 0x0, 0x0, 0xf3, 0x0, 0x6a, 0x0, 0x0,
-    0x8, 0xc0, 0x0, 0x0, 0xf, 0x30, 0xb, 0x70,
-    0x0, 0x0, 0x8c, 0x0, 0x0, 0x4, 0xf1, 0x26,
-    0xf2, 0x0, 0x0, 0x8, 0xc2, 0x22, 0x37, 0xf8,
-    0xc, 0xf6, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xd6, 0x0,
-
-    /* U+040A "Њ" */
-    0x1f, 0x10, 0x0, 0x0, 0x4f, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x10, 0x0, 0x0, 0x4f, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x10, 0x0, 0x0, 0x4f, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x10, 0x0, 0x0, 0x4f,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x10, 0x0, 0x0,
-    0x4f, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd8, 0x0, 0x1f, 0x32,
-    0x22, 0x22, 0x5f, 0x22, 0x22, 0x5d, 0xb0, 0x1f,
-    0x10, 0x0, 0x0, 0x4f, 0x0, 0x0, 0x1, 0xf2,
-    0x1f, 0x10, 0x0, 0x0, 0x4f, 0x0, 0x0, 0x0,
-    0xe4, 0x1f, 0x10, 0x0, 0x0, 0x4f, 0x0, 0x0,
-    0x1, 0xf2, 0x1f, 0x10, 0x0, 0x0, 0x4f, 0x0,
-    0x0, 0x3c, 0xb0, 0x1f, 0x10, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xd8, 0x0,
-
-    /* U+040B "Ћ" */
-    0xdf, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x1, 0x11,
-    0x1e, 0x51, 0x11, 0x0, 0x0, 0x0, 0x0, 0xe4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0x89, 0xdf, 0xe9, 0x10, 0x0,
-    0x0, 0xed, 0x73, 0x24, 0xcd, 0x0, 0x0, 0xe,
-    0x40, 0x0, 0x0, 0xe5, 0x0, 0x0, 0xe4, 0x0,
-    0x0, 0xb, 0x80, 0x0, 0xe, 0x40, 0x0, 0x0,
-    0xa8, 0x0, 0x0, 0xe4, 0x0, 0x0, 0xa, 0x80,
-    0x0, 0xe, 0x40, 0x0, 0x0, 0xa8,
-
-    /* U+040C "Ќ" */
-    0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x1, 0xc6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x0, 0x0, 0x1, 0xe4, 0x1f, 0x0, 0x0, 0xb,
-    0x80, 0x1f, 0x0, 0x0, 0x7c, 0x0, 0x1f, 0x0,
-    0x3, 0xe1, 0x0, 0x1f, 0x0, 0x1e, 0x40, 0x0,
-    0x1f, 0xff, 0xfb, 0x0, 0x0, 0x1f, 0x32, 0x4f,
-    0x30, 0x0, 0x1f, 0x0, 0x8, 0xd0, 0x0, 0x1f,
-    0x0, 0x0, 0xc8, 0x0, 0x1f, 0x0, 0x0, 0x2f,
-    0x30, 0x1f, 0x0, 0x0, 0x7, 0xd0, 0x1f, 0x0,
-    0x0, 0x0, 0xc9,
-
-    /* U+040D "Ѝ" */
-    0x0, 0x7, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xc2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf1, 0x0, 0x0, 0x2, 0xf4, 0x1f, 0x10,
-    0x0, 0x0, 0xdf, 0x41, 0xf1, 0x0, 0x0, 0x9c,
-    0xe4, 0x1f, 0x10, 0x0, 0x4f, 0x2e, 0x41, 0xf1,
-    0x0, 0x1e, 0x60, 0xe4, 0x1f, 0x10, 0xb, 0xa0,
-    0xe, 0x41, 0xf1, 0x7, 0xd0, 0x0, 0xe4, 0x1f,
-    0x13, 0xf3, 0x0, 0xe, 0x41, 0xf1, 0xd7, 0x0,
-    0x0, 0xe4, 0x1f, 0xab, 0x0, 0x0, 0xe, 0x41,
-    0xfe, 0x10, 0x0, 0x0, 0xe4, 0x1f, 0x50, 0x0,
-    0x0, 0xe, 0x40,
-
-    /* U+040E "Ў" */
-    0x0, 0x2c, 0x0, 0x3d, 0x0, 0x0, 0x0, 0x6b,
-    0xba, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xd0, 0x0, 0x0, 0x0, 0xc6, 0xe, 0x50,
-    0x0, 0x0, 0x4e, 0x0, 0x6c, 0x0, 0x0, 0xc,
-    0x60, 0x0, 0xe4, 0x0, 0x4, 0xd0, 0x0, 0x6,
-    0xc0, 0x0, 0xc6, 0x0, 0x0, 0xe, 0x40, 0x4d,
-    0x0, 0x0, 0x0, 0x6c, 0xc, 0x50, 0x0, 0x0,
-    0x0, 0xe7, 0xd0, 0x0, 0x0, 0x0, 0x6, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x0,
-    0x11, 0x4e, 0x40, 0x0, 0x0, 0x6, 0xfe, 0x50,
-    0x0, 0x0, 0x0,
-
-    /* U+040F "Џ" */
-    0x1f, 0x10, 0x0, 0x0, 0x2f, 0x1f, 0x10, 0x0,
-    0x0, 0x2f, 0x1f, 0x10, 0x0, 0x0, 0x2f, 0x1f,
-    0x10, 0x0, 0x0, 0x2f, 0x1f, 0x10, 0x0, 0x0,
-    0x2f, 0x1f, 0x10, 0x0, 0x0, 0x2f, 0x1f, 0x10,
-    0x0, 0x0, 0x2f, 0x1f, 0x10, 0x0, 0x0, 0x2f,
-    0x1f, 0x10, 0x0, 0x0, 0x2f, 0x1f, 0x10, 0x0,
-    0x0, 0x2f, 0x1f, 0x21, 0x11, 0x11, 0x4f, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x1f, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x0, 0x0,
-
-    /* U+0410 "А" */
-    0x0, 0x0, 0xd, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x4d, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xb7, 0x99,
-    0x0, 0x0, 0x0, 0x2, 0xf1, 0x2f, 0x10, 0x0,
-    0x0, 0x8, 0x90, 0xb, 0x70, 0x0, 0x0, 0xf,
-    0x30, 0x4, 0xd0, 0x0, 0x0, 0x6c, 0x0, 0x0,
-    0xe4, 0x0, 0x0, 0xd5, 0x0, 0x0, 0x7b, 0x0,
-    0x4, 0xfe, 0xee, 0xee, 0xef, 0x20, 0xb, 0x81,
-    0x11, 0x11, 0x1a, 0x90, 0x2f, 0x10, 0x0, 0x0,
-    0x3, 0xf0, 0x8a, 0x0, 0x0, 0x0, 0x0, 0xc6,
-
-    /* U+0411 "Б" */
-    0x1f, 0xff, 0xff, 0xff, 0xf1, 0x1f, 0x11, 0x11,
-    0x11, 0x10, 0x1f, 0x10, 0x0, 0x0, 0x0, 0x1f,
-    0x10, 0x0, 0x0, 0x0, 0x1f, 0x10, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xfb, 0x40, 0x1f, 0x10,
-    0x0, 0x17, 0xf4, 0x1f, 0x10, 0x0, 0x0, 0x9a,
-    0x1f, 0x10, 0x0, 0x0, 0x7c, 0x1f, 0x10, 0x0,
-    0x0, 0xa9, 0x1f, 0x10, 0x0, 0x17, 0xf3, 0x1f,
-    0xff, 0xff, 0xea, 0x30,
-
-    /* U+0412 "В" */
-    0x1f, 0xff, 0xff, 0xea, 0x20, 0x1f, 0x10, 0x0,
-    0x19, 0xe1, 0x1f, 0x10, 0x0, 0x0, 0xe5, 0x1f,
-    0x10, 0x0, 0x0, 0xe4, 0x1f, 0x10, 0x0, 0x19,
-    0xc0, 0x1f, 0xff, 0xff, 0xfe, 0x30, 0x1f, 0x10,
-    0x0, 0x4, 0xe4, 0x1f, 0x10, 0x0, 0x0, 0x6c,
-    0x1f, 0x10, 0x0, 0x0, 0x4e, 0x1f, 0x10, 0x0,
-    0x0, 0x6c, 0x1f, 0x10, 0x0, 0x5, 0xe6, 0x1f,
-    0xff, 0xff, 0xfc, 0x50,
-
-    /* U+0413 "Г" */
-    0x1f, 0xff, 0xff, 0xff, 0x1, 0xf2, 0x11, 0x11,
-    0x10, 0x1f, 0x0, 0x0, 0x0, 0x1, 0xf0, 0x0,
-    0x0, 0x0, 0x1f, 0x0, 0x0, 0x0, 0x1, 0xf0,
-    0x0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x0, 0x1,
-    0xf1, 0x0, 0x0, 0x0, 0x1f, 0x10, 0x0, 0x0,
-    0x1, 0xf1, 0x0, 0x0, 0x0, 0x1f, 0x10, 0x0,
-    0x0, 0x1, 0xf1, 0x0, 0x0, 0x0,
-
-    /* U+0414 "Д" */
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1,
-    0xf1, 0x11, 0x11, 0xb8, 0x0, 0x0, 0x2e, 0x0,
-    0x0, 0xa, 0x80, 0x0, 0x2, 0xe0, 0x0, 0x0,
-    0xa8, 0x0, 0x0, 0x3d, 0x0, 0x0, 0xa, 0x80,
-    0x0, 0x4, 0xc0, 0x0, 0x0, 0xa8, 0x0, 0x0,
-    0x5b, 0x0, 0x0, 0xa, 0x80, 0x0, 0x7, 0x90,
-    0x0, 0x0, 0xa8, 0x0, 0x0, 0x97, 0x0, 0x0,
-    0xa, 0x80, 0x0, 0xe, 0x30, 0x0, 0x0, 0xa8,
-    0x0, 0x18, 0xc1, 0x11, 0x11, 0x1b, 0x81, 0xd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xd4, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0x2d, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xe2, 0x83, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0x10,
-
-    /* U+0415 "Е" */
-    0x1f, 0xff, 0xff, 0xff, 0x91, 0xf2, 0x11, 0x11,
-    0x10, 0x1f, 0x10, 0x0, 0x0, 0x1, 0xf1, 0x0,
-    0x0, 0x0, 0x1f, 0x10, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xc0, 0x1f, 0x32, 0x22, 0x21, 0x1,
-    0xf1, 0x0, 0x0, 0x0, 0x1f, 0x10, 0x0, 0x0,
-    0x1, 0xf1, 0x0, 0x0, 0x0, 0x1f, 0x21, 0x11,
-    0x11, 0x11, 0xff, 0xff, 0xff, 0xfd,
-
-    /* U+0416 "Ж" */
-    0x1e, 0x40, 0x0, 0x7, 0xa0, 0x0, 0x2, 0xf3,
-    0x5, 0xd0, 0x0, 0x7, 0xa0, 0x0, 0xb, 0x80,
-    0x0, 0xb8, 0x0, 0x7, 0xa0, 0x0, 0x6d, 0x0,
-    0x0, 0x1e, 0x30, 0x7, 0xa0, 0x1, 0xe3, 0x0,
-    0x0, 0x6, 0xc0, 0x7, 0xa0, 0xa, 0x90, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x5, 0xe3, 0x28, 0xb2, 0x2d, 0x80, 0x0,
-    0x0, 0xe, 0x60, 0x7, 0xa0, 0x3, 0xf2, 0x0,
-    0x0, 0x8d, 0x0, 0x7, 0xa0, 0x0, 0xab, 0x0,
-    0x2, 0xf3, 0x0, 0x7, 0xa0, 0x0, 0x1f, 0x50,
-    0xb, 0xa0, 0x0, 0x7, 0xa0, 0x0, 0x7, 0xe0,
-    0x5f, 0x10, 0x0, 0x7, 0xa0, 0x0, 0x0, 0xd8,
-
-    /* U+0417 "З" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xbe, 0xfe,
-    0xa2, 0x0, 0xc, 0x73, 0x13, 0x9f, 0x20, 0x0,
-    0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x0, 0x9,
-    0x90, 0x0, 0x0, 0x0, 0x4e, 0x30, 0x0, 0x5e,
-    0xef, 0xf6, 0x0, 0x0, 0x1, 0x12, 0x5d, 0x60,
-    0x0, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x0,
-    0x1, 0xf1, 0x25, 0x0, 0x0, 0x9, 0xd0, 0x2d,
-    0xc8, 0x68, 0xde, 0x30, 0x0, 0x59, 0xba, 0x71,
-    0x0,
-
-    /* U+0418 "И" */
-    0x1f, 0x10, 0x0, 0x0, 0x2f, 0x41, 0xf1, 0x0,
-    0x0, 0xd, 0xf4, 0x1f, 0x10, 0x0, 0x9, 0xce,
-    0x41, 0xf1, 0x0, 0x4, 0xf2, 0xe4, 0x1f, 0x10,
-    0x1, 0xe6, 0xe, 0x41, 0xf1, 0x0, 0xba, 0x0,
-    0xe4, 0x1f, 0x10, 0x7d, 0x0, 0xe, 0x41, 0xf1,
-    0x3f, 0x30, 0x0, 0xe4, 0x1f, 0x1d, 0x70, 0x0,
-    0xe, 0x41, 0xfa, 0xb0, 0x0, 0x0, 0xe4, 0x1f,
-    0xe1, 0x0, 0x0, 0xe, 0x41, 0xf5, 0x0, 0x0,
-    0x0, 0xe4,
-
-    /* U+0419 "Й" */
-    0x0, 0xd, 0x10, 0x1d, 0x10, 0x0, 0x0, 0x3b,
-    0xbb, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf1, 0x0, 0x0, 0x2, 0xf4, 0x1f, 0x10,
-    0x0, 0x0, 0xdf, 0x41, 0xf1, 0x0, 0x0, 0x9c,
-    0xe4, 0x1f, 0x10, 0x0, 0x4f, 0x2e, 0x41, 0xf1,
-    0x0, 0x1e, 0x60, 0xe4, 0x1f, 0x10, 0xb, 0xa0,
-    0xe, 0x41, 0xf1, 0x7, 0xd0, 0x0, 0xe4, 0x1f,
-    0x13, 0xf3, 0x0, 0xe, 0x41, 0xf1, 0xd7, 0x0,
-    0x0, 0xe4, 0x1f, 0xab, 0x0, 0x0, 0xe, 0x41,
-    0xfe, 0x10, 0x0, 0x0, 0xe4, 0x1f, 0x50, 0x0,
-    0x0, 0xe, 0x40,
-
-    /* U+041A "К" */
-    0x1f, 0x0, 0x0, 0x1, 0xe4, 0x1f, 0x0, 0x0,
-    0xb, 0x80, 0x1f, 0x0, 0x0, 0x7c, 0x0, 0x1f,
-    0x0, 0x3, 0xe1, 0x0, 0x1f, 0x0, 0x1e, 0x40,
-    0x0, 0x1f, 0xff, 0xfb, 0x0, 0x0, 0x1f, 0x32,
-    0x4f, 0x30, 0x0, 0x1f, 0x0, 0x8, 0xd0, 0x0,
-    0x1f, 0x0, 0x0, 0xc8, 0x0, 0x1f, 0x0, 0x0,
-    0x2f, 0x30, 0x1f, 0x0, 0x0, 0x7, 0xd0, 0x1f,
-    0x0, 0x0, 0x0, 0xc9,
-
-    /* U+041B "Л" */
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xa0, 0x0, 0xf2,
-    0x11, 0x11, 0x8a, 0x0, 0xf, 0x0, 0x0, 0x8,
-    0xa0, 0x0, 0xf0, 0x0, 0x0, 0x8a, 0x0, 0x1f,
-    0x0, 0x0, 0x8, 0xa0, 0x1, 0xf0, 0x0, 0x0,
-    0x8a, 0x0, 0x2e, 0x0, 0x0, 0x8, 0xa0, 0x4,
-    0xc0, 0x0, 0x0, 0x8a, 0x0, 0x6a, 0x0, 0x0,
-    0x8, 0xa0, 0xb, 0x70, 0x0, 0x0, 0x8a, 0x26,
-    0xf2, 0x0, 0x0, 0x8, 0xac, 0xf6, 0x0, 0x0,
-    0x0, 0x8a,
-
-    /* U+041C "М" */
-    0x1f, 0x20, 0x0, 0x0, 0x0, 0xb, 0x81, 0xfa,
-    0x0, 0x0, 0x0, 0x4, 0xf8, 0x1f, 0xf3, 0x0,
-    0x0, 0x0, 0xce, 0x81, 0xf7, 0xc0, 0x0, 0x0,
-    0x5d, 0x98, 0x1f, 0xd, 0x50, 0x0, 0xd, 0x49,
-    0x81, 0xf0, 0x5d, 0x0, 0x6, 0xb0, 0x98, 0x1f,
-    0x0, 0xc6, 0x0, 0xe3, 0x9, 0x81, 0xf0, 0x3,
-    0xe0, 0x8a, 0x0, 0x98, 0x1f, 0x0, 0xa, 0x9e,
-    0x10, 0x9, 0x81, 0xf0, 0x0, 0x2f, 0x80, 0x0,
-    0x98, 0x1f, 0x0, 0x0, 0x50, 0x0, 0x9, 0x81,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x98,
-
-    /* U+041D "Н" */
-    0x1f, 0x10, 0x0, 0x0, 0xe, 0x41, 0xf1, 0x0,
-    0x0, 0x0, 0xe4, 0x1f, 0x10, 0x0, 0x0, 0xe,
-    0x41, 0xf1, 0x0, 0x0, 0x0, 0xe4, 0x1f, 0x10,
-    0x0, 0x0, 0xe, 0x41, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x1f, 0x32, 0x22, 0x22, 0x2f, 0x41, 0xf1,
-    0x0, 0x0, 0x0, 0xe4, 0x1f, 0x10, 0x0, 0x0,
-    0xe, 0x41, 0xf1, 0x0, 0x0, 0x0, 0xe4, 0x1f,
-    0x10, 0x0, 0x0, 0xe, 0x41, 0xf1, 0x0, 0x0,
-    0x0, 0xe4,
-
-    /* U+041E "О" */
-    0x0, 0x1, 0x8d, 0xff, 0xc5, 0x0, 0x0, 0x3,
-    0xeb, 0x42, 0x27, 0xeb, 0x0, 0x1, 0xe7, 0x0,
-    0x0, 0x1, 0xda, 0x0, 0x9b, 0x0, 0x0, 0x0,
-    0x2, 0xf2, 0xe, 0x40, 0x0, 0x0, 0x0, 0xb,
-    0x71, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8a, 0x1f,
-    0x10, 0x0, 0x0, 0x0, 0x8, 0xa0, 0xe4, 0x0,
-    0x0, 0x0, 0x0, 0xb7, 0x9, 0xb0, 0x0, 0x0,
-    0x0, 0x2f, 0x20, 0x1e, 0x70, 0x0, 0x0, 0x1d,
-    0xa0, 0x0, 0x3e, 0xb4, 0x22, 0x7e, 0xb0, 0x0,
-    0x0, 0x18, 0xdf, 0xfc, 0x50, 0x0,
-
-    /* U+041F "П" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0x51, 0xf2, 0x11,
-    0x11, 0x11, 0xe5, 0x1f, 0x10, 0x0, 0x0, 0xd,
-    0x51, 0xf1, 0x0, 0x0, 0x0, 0xd5, 0x1f, 0x10,
-    0x0, 0x0, 0xd, 0x51, 0xf1, 0x0, 0x0, 0x0,
-    0xd5, 0x1f, 0x10, 0x0, 0x0, 0xd, 0x51, 0xf1,
-    0x0, 0x0, 0x0, 0xd5, 0x1f, 0x10, 0x0, 0x0,
-    0xd, 0x51, 0xf1, 0x0, 0x0, 0x0, 0xd5, 0x1f,
-    0x10, 0x0, 0x0, 0xd, 0x51, 0xf1, 0x0, 0x0,
-    0x0, 0xd5,
-
-    /* U+0420 "Р" */
-    0x1f, 0xff, 0xff, 0xd8, 0x0, 0x1f, 0x21, 0x11,
-    0x4c, 0xc0, 0x1f, 0x10, 0x0, 0x0, 0xe6, 0x1f,
-    0x10, 0x0, 0x0, 0x99, 0x1f, 0x10, 0x0, 0x0,
-    0x9a, 0x1f, 0x10, 0x0, 0x0, 0xd6, 0x1f, 0x10,
-    0x0, 0x2b, 0xd0, 0x1f, 0xff, 0xff, 0xfa, 0x10,
-    0x1f, 0x32, 0x21, 0x0, 0x0, 0x1f, 0x10, 0x0,
-    0x0, 0x0, 0x1f, 0x10, 0x0, 0x0, 0x0, 0x1f,
-    0x10, 0x0, 0x0, 0x0,
-
-    /* U+0421 "С" */
-    0x0, 0x1, 0x8d, 0xff, 0xc5, 0x0, 0x3, 0xeb,
-    0x52, 0x26, 0xe9, 0x1, 0xe8, 0x0, 0x0, 0x1,
-    0x30, 0x9b, 0x0, 0x0, 0x0, 0x0, 0xe, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x20, 0x0, 0x0, 0x0, 0x0, 0xe5,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0x80, 0x0, 0x0, 0x13, 0x0,
-    0x3e, 0xb5, 0x22, 0x6e, 0x90, 0x0, 0x18, 0xdf,
-    0xfc, 0x50,
-
-    /* U+0422 "Т" */
-    0xdf, 0xff, 0xff, 0xff, 0xf3, 0x11, 0x11, 0xe5,
-    0x11, 0x10, 0x0, 0x0, 0xe4, 0x0, 0x0, 0x0,
-    0x0, 0xe4, 0x0, 0x0, 0x0, 0x0, 0xe4, 0x0,
-    0x0, 0x0, 0x0, 0xe4, 0x0, 0x0, 0x0, 0x0,
-    0xe4, 0x0, 0x0, 0x0, 0x0, 0xe4, 0x0, 0x0,
-    0x0, 0x0, 0xe4, 0x0, 0x0, 0x0, 0x0, 0xe4,
-    0x0, 0x0, 0x0, 0x0, 0xe4, 0x0, 0x0, 0x0,
-    0x0, 0xe4, 0x0, 0x0,
-
-    /* U+0423 "У" */
-    0x6d, 0x0, 0x0, 0x0, 0xc, 0x60, 0xe5, 0x0,
-    0x0, 0x4, 0xe0, 0x6, 0xc0, 0x0, 0x0, 0xc6,
-    0x0, 0xe, 0x40, 0x0, 0x4d, 0x0, 0x0, 0x6c,
-    0x0, 0xc, 0x60, 0x0, 0x0, 0xe4, 0x4, 0xd0,
-    0x0, 0x0, 0x6, 0xc0, 0xc5, 0x0, 0x0, 0x0,
-    0xe, 0x7d, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x50,
-    0x0, 0x0, 0x0, 0x6, 0xc0, 0x0, 0x0, 0x1,
-    0x14, 0xe4, 0x0, 0x0, 0x0, 0x6f, 0xe5, 0x0,
-    0x0, 0x0,
-
-    /* U+0424 "Ф" */
-    0x0, 0x3, 0x9d, 0xff, 0xfc, 0x81, 0x0, 0x0,
-    0x8e, 0x83, 0x4e, 0x14, 0xae, 0x40, 0x6, 0xe2,
-    0x0, 0x3e, 0x0, 0x5, 0xf2, 0xe, 0x50, 0x0,
-    0x3e, 0x0, 0x0, 0xa8, 0x2f, 0x0, 0x0, 0x3e,
-    0x0, 0x0, 0x5c, 0x3f, 0x0, 0x0, 0x3e, 0x0,
-    0x0, 0x4d, 0x1f, 0x0, 0x0, 0x3e, 0x0, 0x0,
-    0x5c, 0xd, 0x50, 0x0, 0x3e, 0x0, 0x0, 0xa8,
-    0x6, 0xe2, 0x0, 0x3e, 0x0, 0x5, 0xf2, 0x0,
-    0x8e, 0x72, 0x3e, 0x3, 0x9e, 0x40, 0x0, 0x3,
-    0x9d, 0xff, 0xec, 0x81, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0x0, 0x0, 0x0,
-
-    /* U+0425 "Х" */
-    0x1f, 0x50, 0x0, 0x1, 0xe6, 0x0, 0x6e, 0x10,
-    0x0, 0xac, 0x0, 0x0, 0xba, 0x0, 0x5f, 0x20,
-    0x0, 0x1, 0xf5, 0x1e, 0x60, 0x0, 0x0, 0x6,
-    0xeb, 0xc0, 0x0, 0x0, 0x0, 0xc, 0xf2, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0x60, 0x0, 0x0, 0x0,
-    0xab, 0x6f, 0x10, 0x0, 0x0, 0x5f, 0x20, 0xbb,
-    0x0, 0x0, 0x1e, 0x60, 0x1, 0xe6, 0x0, 0xa,
-    0xb0, 0x0, 0x5, 0xf1, 0x5, 0xf1, 0x0, 0x0,
-    0xa, 0xb0,
-
-    /* U+0426 "Ц" */
-    0x1f, 0x10, 0x0, 0x0, 0x2f, 0x0, 0x1f, 0x10,
-    0x0, 0x0, 0x2f, 0x0, 0x1f, 0x10, 0x0, 0x0,
-    0x2f, 0x0, 0x1f, 0x10, 0x0, 0x0, 0x2f, 0x0,
-    0x1f, 0x10, 0x0, 0x0, 0x2f, 0x0, 0x1f, 0x10,
-    0x0, 0x0, 0x2f, 0x0, 0x1f, 0x10, 0x0, 0x0,
-    0x2f, 0x0, 0x1f, 0x10, 0x0, 0x0, 0x2f, 0x0,
-    0x1f, 0x10, 0x0, 0x0, 0x2f, 0x0, 0x1f, 0x10,
-    0x0, 0x0, 0x2f, 0x0, 0x1f, 0x21, 0x11, 0x11,
-    0x4f, 0x11, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5c, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5c,
-
-    /* U+0427 "Ч" */
-    0x1f, 0x10, 0x0, 0x0, 0x5c, 0x1f, 0x10, 0x0,
-    0x0, 0x5c, 0x1f, 0x10, 0x0, 0x0, 0x5c, 0x1f,
-    0x10, 0x0, 0x0, 0x5c, 0xf, 0x20, 0x0, 0x0,
-    0x5c, 0xd, 0x70, 0x0, 0x0, 0x5c, 0x6, 0xf6,
-    0x0, 0x16, 0xdc, 0x0, 0x6e, 0xff, 0xfb, 0xac,
-    0x0, 0x0, 0x11, 0x0, 0x5c, 0x0, 0x0, 0x0,
-    0x0, 0x5c, 0x0, 0x0, 0x0, 0x0, 0x5c, 0x0,
-    0x0, 0x0, 0x0, 0x5c,
-
-    /* U+0428 "Ш" */
-    0x1f, 0x10, 0x0, 0xd, 0x50, 0x0, 0x8, 0x91,
-    0xf1, 0x0, 0x0, 0xd5, 0x0, 0x0, 0x89, 0x1f,
-    0x10, 0x0, 0xd, 0x50, 0x0, 0x8, 0x91, 0xf1,
-    0x0, 0x0, 0xd5, 0x0, 0x0, 0x89, 0x1f, 0x10,
-    0x0, 0xd, 0x50, 0x0, 0x8, 0x91, 0xf1, 0x0,
-    0x0, 0xd5, 0x0, 0x0, 0x89, 0x1f, 0x10, 0x0,
-    0xd, 0x50, 0x0, 0x8, 0x91, 0xf1, 0x0, 0x0,
-    0xd5, 0x0, 0x0, 0x89, 0x1f, 0x10, 0x0, 0xd,
-    0x50, 0x0, 0x8, 0x91, 0xf1, 0x0, 0x0, 0xd5,
-    0x0, 0x0, 0x89, 0x1f, 0x21, 0x11, 0x1d, 0x61,
-    0x11, 0x19, 0x91, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9,
-
-    /* U+0429 "Щ" */
-    0x1f, 0x10, 0x0, 0xd, 0x50, 0x0, 0x8, 0x90,
-    0x1, 0xf1, 0x0, 0x0, 0xd5, 0x0, 0x0, 0x89,
-    0x0, 0x1f, 0x10, 0x0, 0xd, 0x50, 0x0, 0x8,
-    0x90, 0x1, 0xf1, 0x0, 0x0, 0xd5, 0x0, 0x0,
-    0x89, 0x0, 0x1f, 0x10, 0x0, 0xd, 0x50, 0x0,
-    0x8, 0x90, 0x1, 0xf1, 0x0, 0x0, 0xd5, 0x0,
-    0x0, 0x89, 0x0, 0x1f, 0x10, 0x0, 0xd, 0x50,
-    0x0, 0x8, 0x90, 0x1, 0xf1, 0x0, 0x0, 0xd5,
-    0x0, 0x0, 0x89, 0x0, 0x1f, 0x10, 0x0, 0xd,
-    0x50, 0x0, 0x8, 0x90, 0x1, 0xf1, 0x0, 0x0,
-    0xd5, 0x0, 0x0, 0x89, 0x0, 0x1f, 0x21, 0x11,
-    0x1d, 0x61, 0x11, 0x19, 0xa1, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x20,
-
-    /* U+042A "Ъ" */
-    0xdf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x1, 0x11,
-    0x6d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfe, 0xee, 0xec, 0x70,
-    0x0, 0x0, 0x5d, 0x11, 0x11, 0x5d, 0xb0, 0x0,
-    0x5, 0xd0, 0x0, 0x0, 0x1f, 0x30, 0x0, 0x5d,
-    0x0, 0x0, 0x0, 0xc6, 0x0, 0x5, 0xd0, 0x0,
-    0x0, 0xc, 0x60, 0x0, 0x5d, 0x0, 0x0, 0x1,
-    0xf3, 0x0, 0x5, 0xd0, 0x0, 0x3, 0xcb, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xd8, 0x0,
-
-    /* U+042B "Ы" */
-    0x1f, 0x10, 0x0, 0x0, 0x0, 0x6, 0xc1, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x6c, 0x1f, 0x10, 0x0,
-    0x0, 0x0, 0x6, 0xc1, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x6c, 0x1f, 0xee, 0xee, 0xd9, 0x10, 0x6,
-    0xc1, 0xf2, 0x11, 0x13, 0xbe, 0x10, 0x6c, 0x1f,
-    0x10, 0x0, 0x0, 0xd7, 0x6, 0xc1, 0xf1, 0x0,
-    0x0, 0x9, 0xa0, 0x6c, 0x1f, 0x10, 0x0, 0x0,
-    0x99, 0x6, 0xc1, 0xf1, 0x0, 0x0, 0xd, 0x60,
-    0x6c, 0x1f, 0x10, 0x0, 0x2a, 0xe0, 0x6, 0xc1,
-    0xff, 0xff, 0xfe, 0x91, 0x0, 0x6c,
-
-    /* U+042C "Ь" */
-    0x1f, 0x10, 0x0, 0x0, 0x0, 0x1f, 0x10, 0x0,
-    0x0, 0x0, 0x1f, 0x10, 0x0, 0x0, 0x0, 0x1f,
-    0x10, 0x0, 0x0, 0x0, 0x1f, 0xee, 0xee, 0xd9,
-    0x10, 0x1f, 0x21, 0x11, 0x3b, 0xe1, 0x1f, 0x10,
-    0x0, 0x0, 0xd7, 0x1f, 0x10, 0x0, 0x0, 0x9a,
-    0x1f, 0x10, 0x0, 0x0, 0x99, 0x1f, 0x10, 0x0,
-    0x0, 0xd6, 0x1f, 0x10, 0x0, 0x2a, 0xe0, 0x1f,
-    0xff, 0xff, 0xe9, 0x10,
-
-    /* U+042D "Э" */
-    0x2, 0x9e, 0xff, 0xb4, 0x0, 0x2, 0xf9, 0x42,
-    0x38, 0xf8, 0x0, 0x3, 0x0, 0x0, 0x3, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x30, 0x0, 0x9e, 0xee, 0xee,
-    0xf5, 0x0, 0x1, 0x11, 0x11, 0x1e, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x7d, 0x0, 0x50, 0x0, 0x0, 0x3f, 0x50, 0x2e,
-    0xa4, 0x23, 0x8f, 0x80, 0x0, 0x19, 0xdf, 0xfb,
-    0x40, 0x0,
-
-    /* U+042E "Ю" */
-    0x1f, 0x10, 0x0, 0x6, 0xcf, 0xfc, 0x50, 0x0,
-    0x1f, 0x10, 0x0, 0xcc, 0x40, 0x15, 0xda, 0x0,
-    0x1f, 0x10, 0xa, 0xb0, 0x0, 0x0, 0x1d, 0x80,
-    0x1f, 0x10, 0x3f, 0x10, 0x0, 0x0, 0x3, 0xf1,
-    0x1f, 0x10, 0x7b, 0x0, 0x0, 0x0, 0x0, 0xd5,
-    0x1f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xa8,
-    0x1f, 0x32, 0xb8, 0x0, 0x0, 0x0, 0x0, 0xa8,
-    0x1f, 0x10, 0x7b, 0x0, 0x0, 0x0, 0x0, 0xd5,
-    0x1f, 0x10, 0x2f, 0x10, 0x0, 0x0, 0x3, 0xf1,
-    0x1f, 0x10, 0xa, 0xb0, 0x0, 0x0, 0x1d, 0x80,
-    0x1f, 0x10, 0x0, 0xcc, 0x40, 0x15, 0xda, 0x0,
-    0x1f, 0x10, 0x0, 0x6, 0xcf, 0xfc, 0x50, 0x0,
-
-    /* U+042F "Я" */
-    0x2, 0xae, 0xff, 0xff, 0xd2, 0xf9, 0x31, 0x11,
-    0x6d, 0xaa, 0x0, 0x0, 0x5, 0xde, 0x40, 0x0,
-    0x0, 0x5d, 0xe4, 0x0, 0x0, 0x5, 0xdb, 0x80,
-    0x0, 0x0, 0x5d, 0x4f, 0x60, 0x0, 0x5, 0xd0,
-    0x4d, 0xff, 0xff, 0xfd, 0x0, 0xc8, 0x22, 0x27,
-    0xd0, 0x6d, 0x0, 0x0, 0x5d, 0x1e, 0x30, 0x0,
-    0x5, 0xda, 0x90, 0x0, 0x0, 0x5d,
-
-    /* U+0430 "а" */
-    0x2, 0x9e, 0xfe, 0x80, 0xb, 0x82, 0x14, 0xe7,
-    0x0, 0x0, 0x0, 0x5d, 0x0, 0x0, 0x0, 0x3e,
-    0x2, 0xbe, 0xee, 0xee, 0xe, 0x70, 0x0, 0x3e,
-    0x2f, 0x0, 0x0, 0x4e, 0xe, 0x60, 0x3, 0xde,
-    0x2, 0xce, 0xdb, 0x4e,
-
-    /* U+0431 "б" */
-    0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x27, 0xbf,
-    0xe3, 0x0, 0xaf, 0xa6, 0x30, 0x0, 0xab, 0x10,
-    0x0, 0x0, 0x4d, 0x0, 0x0, 0x0, 0x9, 0x73,
-    0xbe, 0xd8, 0x0, 0xd8, 0xd4, 0x24, 0xdb, 0xe,
-    0xe1, 0x0, 0x1, 0xe5, 0xe9, 0x0, 0x0, 0x8,
-    0xad, 0x70, 0x0, 0x0, 0x6b, 0xa9, 0x0, 0x0,
-    0x8, 0xa5, 0xe1, 0x0, 0x0, 0xe5, 0xc, 0xc3,
-    0x3, 0xcb, 0x0, 0x9, 0xef, 0xd8, 0x0,
-
-    /* U+0432 "в" */
-    0x6f, 0xee, 0xed, 0x60, 0x6b, 0x0, 0x3, 0xf3,
-    0x6b, 0x0, 0x0, 0xc6, 0x6b, 0x0, 0x3, 0xe1,
-    0x6f, 0xee, 0xef, 0x80, 0x6b, 0x0, 0x1, 0xc6,
-    0x6b, 0x0, 0x0, 0x7a, 0x6b, 0x0, 0x1, 0xc8,
-    0x6f, 0xff, 0xfe, 0x90,
-
-    /* U+0433 "г" */
-    0x6f, 0xff, 0xff, 0x96, 0xc0, 0x0, 0x0, 0x6c,
-    0x0, 0x0, 0x6, 0xc0, 0x0, 0x0, 0x6c, 0x0,
-    0x0, 0x6, 0xc0, 0x0, 0x0, 0x6c, 0x0, 0x0,
-    0x6, 0xc0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x0,
-
-    /* U+0434 "д" */
-    0x0, 0xbf, 0xff, 0xff, 0x80, 0x0, 0xc5, 0x0,
-    0xa, 0x80, 0x0, 0xc4, 0x0, 0xa, 0x80, 0x0,
-    0xd3, 0x0, 0xa, 0x80, 0x0, 0xe2, 0x0, 0xa,
-    0x80, 0x0, 0xf0, 0x0, 0xa, 0x80, 0x3, 0xd0,
-    0x0, 0xa, 0x80, 0x1b, 0x80, 0x0, 0xa, 0x80,
-    0xdf, 0xff, 0xff, 0xff, 0xfd, 0xd3, 0x0, 0x0,
-    0x0, 0x4d, 0xd3, 0x0, 0x0, 0x0, 0x4d,
-
-    /* U+0435 "е" */
-    0x0, 0x3b, 0xff, 0xa1, 0x0, 0x3e, 0x61, 0x18,
-    0xe1, 0xc, 0x60, 0x0, 0x9, 0x91, 0xf0, 0x0,
-    0x0, 0x3d, 0x3f, 0xdd, 0xdd, 0xdd, 0xe1, 0xf0,
-    0x0, 0x0, 0x0, 0xc, 0x70, 0x0, 0x0, 0x0,
-    0x3f, 0x82, 0x14, 0xd4, 0x0, 0x2a, 0xff, 0xd6,
-    0x0,
-
-    /* U+0436 "ж" */
-    0x3e, 0x10, 0x0, 0xf2, 0x0, 0xd, 0x60, 0x8a,
-    0x0, 0xf, 0x20, 0x7, 0xc0, 0x0, 0xe4, 0x0,
-    0xf2, 0x1, 0xe2, 0x0, 0x5, 0xd0, 0xf, 0x20,
-    0xa8, 0x0, 0x0, 0xd, 0xfe, 0xff, 0xef, 0x10,
-    0x0, 0x6, 0xe2, 0x1f, 0x41, 0xc9, 0x0, 0x1,
-    0xf4, 0x0, 0xf2, 0x2, 0xf4, 0x0, 0xba, 0x0,
-    0xf, 0x20, 0x6, 0xe0, 0x6e, 0x10, 0x0, 0xf2,
-    0x0, 0xc, 0x90,
-
-    /* U+0437 "з" */
-    0x7, 0xdf, 0xfb, 0x30, 0x9, 0x41, 0x28, 0xf1,
-    0x0, 0x0, 0x0, 0xd5, 0x0, 0x0, 0x4, 0xe1,
-    0x0, 0x4e, 0xef, 0x50, 0x0, 0x0, 0x3, 0xe4,
-    0x0, 0x0, 0x0, 0xa8, 0x59, 0x31, 0x16, 0xf4,
-    0x8, 0xdf, 0xfb, 0x40,
-
-    /* U+0438 "и" */
-    0x6c, 0x0, 0x0, 0x1e, 0x66, 0xc0, 0x0, 0xc,
-    0xf6, 0x6c, 0x0, 0x9, 0xbc, 0x66, 0xc0, 0x6,
-    0xd1, 0xc6, 0x6c, 0x3, 0xe2, 0xc, 0x66, 0xc1,
-    0xe5, 0x0, 0xc6, 0x6c, 0xb9, 0x0, 0xc, 0x66,
-    0xfc, 0x0, 0x0, 0xc6, 0x6e, 0x10, 0x0, 0xc,
-    0x60,
-
-    /* U+0439 "й" */
-    0x0, 0x60, 0x0, 0x60, 0x0, 0xb, 0x30, 0x5a,
-    0x0, 0x0, 0x2b, 0xca, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6c, 0x0, 0x0, 0x1e, 0x66, 0xc0,
-    0x0, 0xc, 0xf6, 0x6c, 0x0, 0x9, 0xbc, 0x66,
-    0xc0, 0x6, 0xd1, 0xc6, 0x6c, 0x3, 0xe2, 0xc,
-    0x66, 0xc1, 0xe5, 0x0, 0xc6, 0x6c, 0xb9, 0x0,
-    0xc, 0x66, 0xfc, 0x0, 0x0, 0xc6, 0x6e, 0x10,
-    0x0, 0xc, 0x60,
-
-    /* U+043A "к" */
-    0x6c, 0x0, 0x0, 0xb8, 0x6, 0xc0, 0x0, 0x7c,
-    0x0, 0x6c, 0x0, 0x3e, 0x10, 0x6, 0xc0, 0xd,
-    0x40, 0x0, 0x6f, 0xef, 0xc0, 0x0, 0x6, 0xc1,
-    0x3e, 0x60, 0x0, 0x6c, 0x0, 0x3f, 0x30, 0x6,
-    0xc0, 0x0, 0x6e, 0x10, 0x6c, 0x0, 0x0, 0x9b,
-    0x0,
-
-    /* U+043B "л" */
-    0x0, 0xaf, 0xff, 0xff, 0x80, 0xb, 0x50, 0x0,
-    0xa8, 0x0, 0xc4, 0x0, 0xa, 0x80, 0xd, 0x30,
-    0x0, 0xa8, 0x0, 0xe2, 0x0, 0xa, 0x80, 0xf,
-    0x0, 0x0, 0xa8, 0x2, 0xd0, 0x0, 0xa, 0x80,
-    0x99, 0x0, 0x0, 0xa8, 0xdd, 0x10, 0x0, 0xa,
-    0x80,
-
-    /* U+043C "м" */
-    0x6f, 0x10, 0x0, 0x0, 0x5f, 0x6, 0xf9, 0x0,
-    0x0, 0xd, 0xf0, 0x6b, 0xe2, 0x0, 0x7, 0xaf,
-    0x6, 0xa6, 0xb0, 0x1, 0xe1, 0xf0, 0x6a, 0xd,
-    0x40, 0x97, 0xf, 0x6, 0xa0, 0x4c, 0x2d, 0x0,
-    0xf0, 0x6a, 0x0, 0xbe, 0x50, 0xf, 0x6, 0xa0,
-    0x2, 0xb0, 0x0, 0xf0, 0x6a, 0x0, 0x0, 0x0,
-    0xf, 0x0,
-
-    /* U+043D "н" */
-    0x6c, 0x0, 0x0, 0xf, 0x36, 0xc0, 0x0, 0x0,
-    0xf3, 0x6c, 0x0, 0x0, 0xf, 0x36, 0xc0, 0x0,
-    0x0, 0xf3, 0x6f, 0xee, 0xee, 0xef, 0x36, 0xc1,
-    0x11, 0x11, 0xf3, 0x6c, 0x0, 0x0, 0xf, 0x36,
-    0xc0, 0x0, 0x0, 0xf3, 0x6c, 0x0, 0x0, 0xf,
-    0x30,
-
-    /* U+043E "о" */
-    0x0, 0x3b, 0xff, 0xc4, 0x0, 0x3, 0xf8, 0x21,
-    0x6f, 0x50, 0xc, 0x80, 0x0, 0x5, 0xe0, 0x1f,
-    0x10, 0x0, 0x0, 0xe4, 0x3f, 0x0, 0x0, 0x0,
-    0xc5, 0x1f, 0x10, 0x0, 0x0, 0xe4, 0xc, 0x80,
-    0x0, 0x5, 0xe0, 0x3, 0xf8, 0x21, 0x6f, 0x50,
-    0x0, 0x2b, 0xff, 0xc4, 0x0,
-
-    /* U+043F "п" */
-    0x6f, 0xff, 0xff, 0xff, 0x26, 0xc0, 0x0, 0x0,
-    0xf2, 0x6c, 0x0, 0x0, 0xf, 0x26, 0xc0, 0x0,
-    0x0, 0xf2, 0x6c, 0x0, 0x0, 0xf, 0x26, 0xc0,
-    0x0, 0x0, 0xf2, 0x6c, 0x0, 0x0, 0xf, 0x26,
-    0xc0, 0x0, 0x0, 0xf2, 0x6c, 0x0, 0x0, 0xf,
-    0x20,
-
-    /* U+0440 "р" */
-    0x6b, 0x2b, 0xff, 0xb3, 0x0, 0x6d, 0xe6, 0x12,
-    0x8f, 0x30, 0x6f, 0x40, 0x0, 0x8, 0xb0, 0x6d,
-    0x0, 0x0, 0x1, 0xf0, 0x6c, 0x0, 0x0, 0x0,
-    0xf2, 0x6d, 0x0, 0x0, 0x1, 0xf0, 0x6f, 0x40,
-    0x0, 0x8, 0xc0, 0x6d, 0xd6, 0x12, 0x8f, 0x30,
-    0x6c, 0x2b, 0xff, 0xb3, 0x0, 0x6c, 0x0, 0x0,
-    0x0, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x0, 0x6c,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0441 "с" */
-    0x0, 0x2b, 0xff, 0xc4, 0x0, 0x3f, 0x82, 0x16,
-    0xf3, 0xc, 0x80, 0x0, 0x2, 0x1, 0xf1, 0x0,
-    0x0, 0x0, 0x3f, 0x0, 0x0, 0x0, 0x1, 0xf1,
-    0x0, 0x0, 0x0, 0xc, 0x80, 0x0, 0x2, 0x0,
-    0x3f, 0x82, 0x16, 0xf3, 0x0, 0x2b, 0xff, 0xc4,
-    0x0,
-
-    /* U+0442 "т" */
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0xc, 0x60, 0x0,
-    0x0, 0xc, 0x50, 0x0, 0x0, 0xc, 0x50, 0x0,
-    0x0, 0xc, 0x50, 0x0, 0x0, 0xc, 0x50, 0x0,
-    0x0, 0xc, 0x50, 0x0, 0x0, 0xc, 0x50, 0x0,
-    0x0, 0xc, 0x50, 0x0,
-
-    /* U+0443 "у" */
-    0xa, 0x80, 0x0, 0x0, 0x98, 0x3, 0xe0, 0x0,
-    0x0, 0xf2, 0x0, 0xd5, 0x0, 0x6, 0xb0, 0x0,
-    0x6c, 0x0, 0xd, 0x40, 0x0, 0xe, 0x30, 0x4d,
-    0x0, 0x0, 0x8, 0x90, 0xb6, 0x0, 0x0, 0x2,
-    0xf3, 0xe0, 0x0, 0x0, 0x0, 0xbe, 0x80, 0x0,
-    0x0, 0x0, 0x5f, 0x10, 0x0, 0x0, 0x0, 0x7a,
-    0x0, 0x0, 0x6, 0x13, 0xe3, 0x0, 0x0, 0x1b,
-    0xfe, 0x50, 0x0, 0x0,
-
-    /* U+0444 "ф" */
-    0x0, 0x0, 0x4, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xd0, 0x0, 0x0,
-    0x0, 0x19, 0xdf, 0xfe, 0xb5, 0x0, 0x3, 0xfa,
-    0x45, 0xd2, 0x6e, 0xa0, 0xc, 0x80, 0x4, 0xd0,
-    0x1, 0xe5, 0x2f, 0x0, 0x4, 0xd0, 0x0, 0x7b,
-    0x3e, 0x0, 0x4, 0xd0, 0x0, 0x5c, 0x2f, 0x10,
-    0x4, 0xd0, 0x0, 0x7a, 0xc, 0x80, 0x4, 0xd0,
-    0x1, 0xe5, 0x3, 0xfa, 0x45, 0xd2, 0x6e, 0xa0,
-    0x0, 0x19, 0xdf, 0xfe, 0xb5, 0x0, 0x0, 0x0,
-    0x4, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xd0, 0x0, 0x0,
-
-    /* U+0445 "х" */
-    0x3e, 0x10, 0x0, 0xaa, 0x0, 0x8c, 0x0, 0x5d,
-    0x0, 0x0, 0xc7, 0x1e, 0x30, 0x0, 0x2, 0xed,
-    0x70, 0x0, 0x0, 0xa, 0xf0, 0x0, 0x0, 0x4,
-    0xea, 0xa0, 0x0, 0x1, 0xe4, 0xd, 0x50, 0x0,
-    0xa9, 0x0, 0x3e, 0x20, 0x6d, 0x0, 0x0, 0x7c,
-    0x0,
-
-    /* U+0446 "ц" */
-    0x6c, 0x0, 0x0, 0x1f, 0x0, 0x6c, 0x0, 0x0,
-    0x1f, 0x0, 0x6c, 0x0, 0x0, 0x1f, 0x0, 0x6c,
-    0x0, 0x0, 0x1f, 0x0, 0x6c, 0x0, 0x0, 0x1f,
-    0x0, 0x6c, 0x0, 0x0, 0x1f, 0x0, 0x6c, 0x0,
-    0x0, 0x1f, 0x0, 0x6c, 0x0, 0x0, 0x2f, 0x10,
-    0x6f, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0xb6, 0x0, 0x0, 0x0, 0x0, 0xb6,
-
-    /* U+0447 "ч" */
-    0x4e, 0x0, 0x0, 0x2f, 0x4e, 0x0, 0x0, 0x2f,
-    0x4e, 0x0, 0x0, 0x2f, 0x3f, 0x0, 0x0, 0x2f,
-    0xe, 0x91, 0x2, 0x9f, 0x2, 0xbf, 0xfc, 0x9f,
-    0x0, 0x0, 0x0, 0x2f, 0x0, 0x0, 0x0, 0x2f,
-    0x0, 0x0, 0x0, 0x2f,
-
-    /* U+0448 "ш" */
-    0x6c, 0x0, 0x2, 0xf0, 0x0, 0xe, 0x36, 0xc0,
-    0x0, 0x2f, 0x0, 0x0, 0xe3, 0x6c, 0x0, 0x2,
-    0xf0, 0x0, 0xe, 0x36, 0xc0, 0x0, 0x2f, 0x0,
-    0x0, 0xe3, 0x6c, 0x0, 0x2, 0xf0, 0x0, 0xe,
-    0x36, 0xc0, 0x0, 0x2f, 0x0, 0x0, 0xe3, 0x6c,
-    0x0, 0x2, 0xf0, 0x0, 0xe, 0x36, 0xc0, 0x0,
-    0x2f, 0x10, 0x0, 0xe3, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x30,
-
-    /* U+0449 "щ" */
-    0x6c, 0x0, 0x2, 0xf0, 0x0, 0xe, 0x30, 0x6c,
-    0x0, 0x2, 0xf0, 0x0, 0xe, 0x30, 0x6c, 0x0,
-    0x2, 0xf0, 0x0, 0xe, 0x30, 0x6c, 0x0, 0x2,
-    0xf0, 0x0, 0xe, 0x30, 0x6c, 0x0, 0x2, 0xf0,
-    0x0, 0xe, 0x30, 0x6c, 0x0, 0x2, 0xf0, 0x0,
-    0xe, 0x30, 0x6c, 0x0, 0x2, 0xf0, 0x0, 0xe,
-    0x30, 0x6c, 0x0, 0x2, 0xf1, 0x0, 0xe, 0x40,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x88, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x88,
-
-    /* U+044A "ъ" */
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x6c, 0x0,
-    0x0, 0x0, 0x0, 0x5c, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xee, 0xec, 0x40, 0x0, 0x5c, 0x0, 0x6,
-    0xf1, 0x0, 0x5c, 0x0, 0x0, 0xd5, 0x0, 0x5c,
-    0x0, 0x0, 0xd5, 0x0, 0x5c, 0x0, 0x6, 0xf1,
-    0x0, 0x5f, 0xff, 0xfc, 0x30,
-
-    /* U+044B "ы" */
-    0x6c, 0x0, 0x0, 0x0, 0x3f, 0x6c, 0x0, 0x0,
-    0x0, 0x3f, 0x6c, 0x0, 0x0, 0x0, 0x3f, 0x6f,
-    0xee, 0xeb, 0x30, 0x3f, 0x6c, 0x0, 0x5, 0xf1,
-    0x3f, 0x6c, 0x0, 0x0, 0xc5, 0x3f, 0x6c, 0x0,
-    0x0, 0xd5, 0x3f, 0x6c, 0x0, 0x6, 0xf1, 0x3f,
-    0x6f, 0xee, 0xec, 0x30, 0x3f,
-
-    /* U+044C "ь" */
-    0x6c, 0x0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x0,
-    0x6c, 0x0, 0x0, 0x0, 0x6f, 0xee, 0xec, 0x40,
-    0x6c, 0x0, 0x5, 0xf2, 0x6c, 0x0, 0x0, 0xb6,
-    0x6c, 0x0, 0x0, 0xc6, 0x6c, 0x0, 0x5, 0xf2,
-    0x6f, 0xee, 0xfc, 0x40,
-
-    /* U+044D "э" */
-    0x6, 0xcf, 0xfb, 0x30, 0x4, 0xc3, 0x0, 0x6e,
-    0x40, 0x0, 0x0, 0x0, 0x4e, 0x0, 0x0, 0x0,
-    0x0, 0xd4, 0x0, 0x3e, 0xee, 0xef, 0x50, 0x0,
-    0x0, 0x0, 0xd4, 0x0, 0x0, 0x0, 0x4e, 0x4,
-    0xb4, 0x1, 0x6e, 0x40, 0x6, 0xcf, 0xfb, 0x30,
-    0x0,
-
-    /* U+044E "ю" */
-    0x6c, 0x0, 0x4, 0xcf, 0xea, 0x20, 0x6, 0xc0,
-    0x5, 0xe4, 0x0, 0x7e, 0x10, 0x6c, 0x0, 0xe4,
-    0x0, 0x0, 0x9a, 0x6, 0xc0, 0x3e, 0x0, 0x0,
-    0x3, 0xe0, 0x6f, 0xff, 0xc0, 0x0, 0x0, 0x1f,
-    0x6, 0xc2, 0x5e, 0x0, 0x0, 0x3, 0xe0, 0x6c,
-    0x0, 0xe4, 0x0, 0x0, 0x9a, 0x6, 0xc0, 0x5,
-    0xe5, 0x0, 0x7e, 0x10, 0x6c, 0x0, 0x4, 0xcf,
-    0xea, 0x10, 0x0,
-
-    /* U+044F "я" */
-    0x0, 0x9e, 0xff, 0xff, 0x10, 0xac, 0x30, 0x0,
-    0xf1, 0xf, 0x30, 0x0, 0xf, 0x10, 0xf2, 0x0,
-    0x0, 0xf1, 0xa, 0xa1, 0x0, 0xf, 0x10, 0x9,
-    0xfe, 0xee, 0xf1, 0x0, 0x7b, 0x0, 0xf, 0x10,
-    0x2e, 0x20, 0x0, 0xf1, 0xc, 0x70, 0x0, 0xf,
-    0x10,
-
-    /* U+0450 "ѐ" */
-    0x0, 0x37, 0x0, 0x0, 0x0, 0x0, 0x7c, 0x10,
-    0x0, 0x0, 0x0, 0x45, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3b, 0xff, 0xa1, 0x0, 0x3e,
-    0x61, 0x18, 0xe1, 0xc, 0x60, 0x0, 0x9, 0x91,
-    0xf0, 0x0, 0x0, 0x3d, 0x3f, 0xdd, 0xdd, 0xdd,
-    0xe1, 0xf0, 0x0, 0x0, 0x0, 0xc, 0x70, 0x0,
-    0x0, 0x0, 0x3f, 0x82, 0x14, 0xd4, 0x0, 0x2a,
-    0xff, 0xd6, 0x0,
-
-    /* U+0451 "ё" */
-    0x0, 0x1e, 0x14, 0xe0, 0x0, 0x0, 0x60, 0x15,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xbf,
-    0xfa, 0x10, 0x3, 0xe6, 0x11, 0x8e, 0x10, 0xc6,
-    0x0, 0x0, 0x99, 0x1f, 0x0, 0x0, 0x3, 0xd3,
-    0xfd, 0xdd, 0xdd, 0xde, 0x1f, 0x0, 0x0, 0x0,
-    0x0, 0xc7, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x21,
-    0x4d, 0x40, 0x2, 0xaf, 0xfd, 0x60,
-
-    /* U+0452 "ђ" */
-    0x0, 0x6b, 0x0, 0x0, 0x0, 0x1, 0xef, 0xfe,
-    0xee, 0x90, 0x0, 0x0, 0x6b, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x6b,
-    0x3c, 0xff, 0xa1, 0x0, 0x6, 0xdd, 0x51, 0x3b,
-    0xd0, 0x0, 0x6f, 0x30, 0x0, 0x1f, 0x30, 0x6,
-    0xd0, 0x0, 0x0, 0xc5, 0x0, 0x6c, 0x0, 0x0,
-    0xc, 0x50, 0x6, 0xc0, 0x0, 0x0, 0xc5, 0x0,
-    0x6c, 0x0, 0x0, 0xc, 0x50, 0x6, 0xc0, 0x0,
-    0x0, 0xc5, 0x0, 0x6c, 0x0, 0x0, 0xc, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0xc5, 0x0, 0x0, 0x0,
-    0x21, 0x3f, 0x20, 0x0, 0x0, 0x9, 0xfe, 0x70,
-
-    /* U+0453 "ѓ" */
-    0x0, 0x0, 0x37, 0x0, 0x0, 0x5d, 0x20, 0x0,
-    0x17, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0x96, 0xc0, 0x0, 0x0, 0x6c, 0x0, 0x0,
-    0x6, 0xc0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x6,
-    0xc0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x6, 0xc0,
-    0x0, 0x0, 0x6c, 0x0, 0x0, 0x0,
-
-    /* U+0454 "є" */
-    0x0, 0x2a, 0xef, 0xd8, 0x0, 0x2e, 0x71, 0x3,
-    0xa6, 0xc, 0x70, 0x0, 0x0, 0x1, 0xf0, 0x0,
-    0x0, 0x0, 0x3f, 0xee, 0xee, 0x50, 0x1, 0xf0,
-    0x0, 0x0, 0x0, 0xc, 0x60, 0x0, 0x0, 0x0,
-    0x2e, 0x71, 0x2, 0xa6, 0x0, 0x2a, 0xef, 0xd7,
-    0x0,
-
-    /* U+0455 "ѕ" */
-    0x1, 0x9e, 0xfe, 0x91, 0xa, 0xa2, 0x13, 0x91,
-    0xe, 0x30, 0x0, 0x0, 0xb, 0xb3, 0x0, 0x0,
-    0x1, 0x9e, 0xfb, 0x60, 0x0, 0x0, 0x15, 0xe6,
-    0x0, 0x0, 0x0, 0x89, 0x1c, 0x61, 0x3, 0xd6,
-    0x6, 0xcf, 0xfd, 0x70,
-
-    /* U+0456 "і" */
-    0x49, 0x7, 0xd0, 0x0, 0x0, 0x0, 0x6c, 0x6,
-    0xc0, 0x6c, 0x6, 0xc0, 0x6c, 0x6, 0xc0, 0x6c,
-    0x6, 0xc0, 0x6c, 0x0,
-
-    /* U+0457 "ї" */
-    0x7a, 0x5c, 0x23, 0x14, 0x0, 0x0, 0x6, 0xb0,
-    0x6, 0xb0, 0x6, 0xb0, 0x6, 0xb0, 0x6, 0xb0,
-    0x6, 0xb0, 0x6, 0xb0, 0x6, 0xb0, 0x6, 0xb0,
-
-    /* U+0458 "ј" */
-    0x0, 0x7, 0xd0, 0x0, 0x4, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xc0, 0x0,
-    0x6, 0xc0, 0x0, 0x6, 0xc0, 0x0, 0x6, 0xc0,
-    0x0, 0x6, 0xc0, 0x0, 0x6, 0xc0, 0x0, 0x6,
-    0xc0, 0x0, 0x6, 0xc0, 0x0, 0x6, 0xc0, 0x0,
-    0x6, 0xc0, 0x12, 0x1b, 0x80, 0x3e, 0xfb, 0x10,
-
-    /* U+0459 "љ" */
-    0x0, 0xaf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0xb, 0x50, 0x0, 0xc8, 0x0, 0x0, 0x0, 0x0,
-    0xc4, 0x0, 0xc, 0x80, 0x0, 0x0, 0x0, 0xd,
-    0x30, 0x0, 0xcf, 0xee, 0xea, 0x20, 0x0, 0xe2,
-    0x0, 0xc, 0x80, 0x0, 0x8d, 0x0, 0xf, 0x0,
-    0x0, 0xc8, 0x0, 0x0, 0xf2, 0x2, 0xd0, 0x0,
-    0xc, 0x80, 0x0, 0xf, 0x20, 0x99, 0x0, 0x0,
-    0xc8, 0x0, 0x1a, 0xd0, 0xdd, 0x10, 0x0, 0xc,
-    0xff, 0xff, 0xa1, 0x0,
-
-    /* U+045A "њ" */
-    0x6c, 0x0, 0x0, 0x2f, 0x0, 0x0, 0x0, 0x6c,
-    0x0, 0x0, 0x2f, 0x0, 0x0, 0x0, 0x6c, 0x0,
-    0x0, 0x2f, 0x0, 0x0, 0x0, 0x6c, 0x0, 0x0,
-    0x2f, 0x0, 0x0, 0x0, 0x6f, 0xee, 0xee, 0xef,
-    0xee, 0xed, 0x70, 0x6c, 0x11, 0x11, 0x3f, 0x21,
-    0x14, 0xe6, 0x6c, 0x0, 0x0, 0x2f, 0x0, 0x0,
-    0x89, 0x6c, 0x0, 0x0, 0x2f, 0x0, 0x2, 0xd6,
-    0x6c, 0x0, 0x0, 0x2f, 0xee, 0xee, 0x70,
-
-    /* U+045B "ћ" */
-    0x0, 0x36, 0x0, 0x0, 0x0, 0x0, 0x6, 0xc0,
-    0x0, 0x0, 0x0, 0x6c, 0xef, 0xcc, 0xc9, 0x0,
-    0x0, 0x6, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x6c,
-    0x3c, 0xff, 0xa1, 0x0, 0x6, 0xed, 0x51, 0x3c,
-    0xc0, 0x0, 0x6f, 0x30, 0x0, 0x1f, 0x30, 0x6,
-    0xd0, 0x0, 0x0, 0xd5, 0x0, 0x6c, 0x0, 0x0,
-    0xc, 0x50, 0x6, 0xc0, 0x0, 0x0, 0xc5, 0x0,
-    0x6c, 0x0, 0x0, 0xc, 0x50, 0x6, 0xc0, 0x0,
-    0x0, 0xc5, 0x0, 0x6c, 0x0, 0x0, 0xc, 0x50,
-
-    /* U+045C "ќ" */
-    0x0, 0x0, 0x27, 0x10, 0x0, 0x0, 0x3d, 0x30,
-    0x0, 0x0, 0x7, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6c, 0x0, 0x0, 0xb8, 0x6, 0xc0,
-    0x0, 0x7c, 0x0, 0x6c, 0x0, 0x3e, 0x10, 0x6,
-    0xc0, 0xd, 0x40, 0x0, 0x6f, 0xef, 0xc0, 0x0,
-    0x6, 0xc1, 0x3e, 0x60, 0x0, 0x6c, 0x0, 0x3f,
-    0x30, 0x6, 0xc0, 0x0, 0x6e, 0x10, 0x6c, 0x0,
-    0x0, 0x9b, 0x0,
-
-    /* U+045D "ѝ" */
-    0x0, 0x64, 0x0, 0x0, 0x0, 0x2, 0xc6, 0x0,
-    0x0, 0x0, 0x0, 0x71, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6c, 0x0, 0x0, 0x1e, 0x66, 0xc0,
-    0x0, 0xc, 0xf6, 0x6c, 0x0, 0x9, 0xbc, 0x66,
-    0xc0, 0x6, 0xd1, 0xc6, 0x6c, 0x3, 0xe2, 0xc,
-    0x66, 0xc1, 0xe5, 0x0, 0xc6, 0x6c, 0xb9, 0x0,
-    0xc, 0x66, 0xfc, 0x0, 0x0, 0xc6, 0x6e, 0x10,
-    0x0, 0xc, 0x60,
-
-    /* U+045E "ў" */
-    0x0, 0x1b, 0x0, 0x49, 0x0, 0x0, 0xc, 0x20,
-    0xa5, 0x0, 0x0, 0x2, 0xbc, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0x80, 0x0, 0x0,
-    0x98, 0x3, 0xe0, 0x0, 0x0, 0xf2, 0x0, 0xd5,
-    0x0, 0x6, 0xb0, 0x0, 0x6c, 0x0, 0xd, 0x40,
-    0x0, 0xe, 0x30, 0x4d, 0x0, 0x0, 0x8, 0x90,
-    0xb6, 0x0, 0x0, 0x2, 0xf3, 0xe0, 0x0, 0x0,
-    0x0, 0xbe, 0x80, 0x0, 0x0, 0x0, 0x5f, 0x10,
-    0x0, 0x0, 0x0, 0x7a, 0x0, 0x0, 0x6, 0x13,
-    0xe3, 0x0, 0x0, 0x1b, 0xfe, 0x50, 0x0, 0x0,
-
-    /* U+045F "џ" */
-    0x6c, 0x0, 0x0, 0x89, 0x6c, 0x0, 0x0, 0x89,
-    0x6c, 0x0, 0x0, 0x89, 0x6c, 0x0, 0x0, 0x89,
-    0x6c, 0x0, 0x0, 0x89, 0x6c, 0x0, 0x0, 0x89,
-    0x6c, 0x0, 0x0, 0x89, 0x6c, 0x0, 0x0, 0x89,
-    0x6f, 0xff, 0xff, 0xf9, 0x0, 0x6, 0xa0, 0x0,
-    0x0, 0x6, 0xa0, 0x0,
-
-    /* U+0462 "Ѣ" */
-    0x0, 0x5, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa8, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xa8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xee, 0xee, 0xb5, 0x0, 0x0,
-    0xa, 0x91, 0x11, 0x26, 0xf6, 0x0, 0x0, 0xa8,
-    0x0, 0x0, 0x6, 0xe0, 0x0, 0xa, 0x80, 0x0,
-    0x0, 0x2f, 0x10, 0x0, 0xa8, 0x0, 0x0, 0x2,
-    0xf1, 0x0, 0xa, 0x80, 0x0, 0x0, 0x6e, 0x0,
-    0x0, 0xa8, 0x0, 0x0, 0x5e, 0x60, 0x0, 0xa,
-    0xff, 0xff, 0xfc, 0x50, 0x0,
-
-    /* U+0463 "ѣ" */
-    0x0, 0x62, 0x0, 0x0, 0x0, 0x0, 0xd4, 0x0,
-    0x0, 0x0, 0x0, 0xd4, 0x0, 0x0, 0x0, 0x0,
-    0xd4, 0x0, 0x0, 0x0, 0xee, 0xff, 0xee, 0x60,
-    0x0, 0x0, 0xd4, 0x0, 0x0, 0x0, 0x0, 0xd4,
-    0x0, 0x0, 0x0, 0x0, 0xde, 0xee, 0xd9, 0x0,
-    0x0, 0xd4, 0x0, 0x1a, 0xa0, 0x0, 0xd4, 0x0,
-    0x3, 0xf0, 0x0, 0xd4, 0x0, 0x3, 0xf0, 0x0,
-    0xd4, 0x0, 0x1b, 0xa0, 0x0, 0xdf, 0xee, 0xe9,
-    0x0,
-
-    /* U+046A "Ѫ" */
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0xd6, 0x0, 0x0, 0x0, 0x3d, 0x10, 0x0, 0x2e,
-    0x30, 0x0, 0x1, 0xe3, 0x0, 0x0, 0x4, 0xe1,
-    0x0, 0xd, 0x50, 0x0, 0x0, 0x0, 0x6c, 0x0,
-    0xa8, 0x0, 0x0, 0x0, 0x0, 0x9, 0xa7, 0xb0,
-    0x0, 0x0, 0x0, 0x4, 0xcf, 0xff, 0xfd, 0x60,
-    0x0, 0x0, 0x5e, 0x50, 0x7a, 0x4, 0xd8, 0x0,
-    0x1, 0xf3, 0x0, 0x7a, 0x0, 0x2f, 0x30, 0x8,
-    0xa0, 0x0, 0x7a, 0x0, 0x8, 0xb0, 0xe, 0x30,
-    0x0, 0x7a, 0x0, 0x1, 0xf2, 0x6c, 0x0, 0x0,
-    0x7a, 0x0, 0x0, 0xa9,
-
-    /* U+046B "ѫ" */
-    0xb, 0xed, 0xdd, 0xdd, 0xf9, 0x0, 0x3d, 0x20,
-    0x0, 0x3d, 0x10, 0x0, 0x4d, 0x10, 0x2e, 0x30,
-    0x0, 0x0, 0x7c, 0x2d, 0x50, 0x0, 0x0, 0x17,
-    0xff, 0xe7, 0x10, 0x0, 0x1e, 0x85, 0xf4, 0x9d,
-    0x0, 0x9, 0x80, 0x1e, 0x0, 0xa8, 0x1, 0xf1,
-    0x1, 0xe0, 0x3, 0xe0, 0x7a, 0x0, 0x1e, 0x0,
-    0xc, 0x50,
-
-    /* U+0472 "Ѳ" */
-    0x0, 0x1, 0x8d, 0xff, 0xc5, 0x0, 0x0, 0x3,
-    0xea, 0x42, 0x26, 0xdb, 0x0, 0x1, 0xe5, 0x0,
-    0x0, 0x0, 0xba, 0x0, 0x99, 0x0, 0x0, 0x0,
-    0x1, 0xe3, 0xe, 0x30, 0x0, 0x0, 0x0, 0x9,
-    0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x1f,
-    0x30, 0x0, 0x0, 0x0, 0x9, 0xa0, 0xe6, 0x0,
-    0x0, 0x0, 0x0, 0xd8, 0x9, 0xd0, 0x0, 0x0,
-    0x0, 0x4f, 0x30, 0x1e, 0x90, 0x0, 0x0, 0x2e,
-    0xa0, 0x0, 0x3e, 0xc5, 0x23, 0x7e, 0xb0, 0x0,
-    0x0, 0x18, 0xdf, 0xfc, 0x50, 0x0,
-
-    /* U+0473 "ѳ" */
-    0x0, 0x2a, 0xef, 0xc5, 0x0, 0x3, 0xe6, 0x0,
-    0x4d, 0x70, 0xc, 0x60, 0x0, 0x2, 0xf2, 0x1f,
-    0x0, 0x0, 0x0, 0xa6, 0x3f, 0xdd, 0xdd, 0xdd,
-    0xf8, 0x1f, 0x0, 0x0, 0x0, 0xa6, 0xc, 0x60,
-    0x0, 0x2, 0xf2, 0x3, 0xe6, 0x10, 0x4d, 0x70,
-    0x0, 0x2a, 0xff, 0xc5, 0x0,
-
-    /* U+0474 "Ѵ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x8c, 0x0,
-    0x0, 0x0, 0xa, 0xfb, 0x2f, 0x20, 0x0, 0x0,
-    0x7e, 0x42, 0xb, 0x80, 0x0, 0x0, 0xe5, 0x0,
-    0x5, 0xe0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0xf5,
-    0x0, 0x9, 0xa0, 0x0, 0x0, 0x9b, 0x0, 0xe,
-    0x40, 0x0, 0x0, 0x3f, 0x10, 0x4e, 0x0, 0x0,
-    0x0, 0xd, 0x70, 0x99, 0x0, 0x0, 0x0, 0x7,
-    0xd0, 0xe4, 0x0, 0x0, 0x0, 0x1, 0xf8, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x40, 0x0, 0x0,
-
-    /* U+0475 "ѵ" */
-    0x0, 0x0, 0x0, 0x0, 0x10, 0xa9, 0x0, 0x0,
-    0xd, 0xf1, 0x3f, 0x0, 0x0, 0x7d, 0x20, 0xd,
-    0x60, 0x0, 0xd5, 0x0, 0x6, 0xd0, 0x3, 0xe0,
-    0x0, 0x0, 0xf3, 0x8, 0x90, 0x0, 0x0, 0x99,
-    0xe, 0x30, 0x0, 0x0, 0x2f, 0x5d, 0x0, 0x0,
-    0x0, 0xc, 0xe8, 0x0, 0x0, 0x0, 0x5, 0xf2,
-    0x0, 0x0,
-
-    /* U+048A "Ҋ" */
-    0x0, 0xd, 0x10, 0x1d, 0x10, 0x0, 0x0, 0x3,
-    0xbb, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x10, 0x0, 0x0, 0x2f, 0x40,
-    0x1f, 0x10, 0x0, 0x0, 0xdf, 0x40, 0x1f, 0x10,
-    0x0, 0x9, 0xce, 0x40, 0x1f, 0x10, 0x0, 0x4f,
-    0x2e, 0x40, 0x1f, 0x10, 0x1, 0xe6, 0xe, 0x40,
-    0x1f, 0x10, 0xb, 0xa0, 0xe, 0x40, 0x1f, 0x10,
-    0x7d, 0x0, 0xe, 0x40, 0x1f, 0x13, 0xf3, 0x0,
-    0xe, 0x40, 0x1f, 0x1d, 0x70, 0x0, 0xe, 0x40,
-    0x1f, 0xab, 0x0, 0x0, 0xe, 0x40, 0x1f, 0xe1,
-    0x0, 0x0, 0xe, 0x51, 0x1f, 0x50, 0x0, 0x0,
-    0xf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x70,
-
-    /* U+048B "ҋ" */
-    0x0, 0x60, 0x0, 0x60, 0x0, 0x0, 0xb3, 0x5,
-    0xa0, 0x0, 0x0, 0x1a, 0xca, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x1e,
-    0x60, 0x6c, 0x0, 0x0, 0xcf, 0x60, 0x6c, 0x0,
-    0x9, 0xbc, 0x60, 0x6c, 0x0, 0x6d, 0x1c, 0x60,
-    0x6c, 0x3, 0xe3, 0xc, 0x60, 0x6c, 0x1e, 0x60,
-    0xc, 0x60, 0x6c, 0xb9, 0x0, 0xc, 0x60, 0x6f,
-    0xc0, 0x0, 0xc, 0x60, 0x6e, 0x10, 0x0, 0xc,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0xa5, 0x0, 0x0,
-    0x0, 0x0, 0xe0,
-
-    /* U+048C "Ҍ" */
-    0x0, 0x53, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb7,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xb7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xee, 0xed, 0xb4, 0x0, 0x0, 0xb8, 0x11, 0x12,
-    0x7f, 0x50, 0x0, 0xb7, 0x0, 0x0, 0x7, 0xd0,
-    0x0, 0xb7, 0x0, 0x0, 0x2, 0xf0, 0x0, 0xb7,
-    0x0, 0x0, 0x2, 0xf0, 0x0, 0xb7, 0x0, 0x0,
-    0x6, 0xd0, 0x0, 0xb7, 0x0, 0x1, 0x6f, 0x50,
-    0x0, 0xbf, 0xff, 0xff, 0xc4, 0x0,
-
-    /* U+048D "ҍ" */
-    0x0, 0xe4, 0x0, 0x0, 0x8, 0xef, 0xee, 0xe5,
-    0x0, 0x0, 0xe4, 0x0, 0x0, 0x0, 0xe, 0xee,
-    0xee, 0x90, 0x0, 0xe4, 0x0, 0x1b, 0xa0, 0xe,
-    0x40, 0x0, 0x3e, 0x0, 0xe4, 0x0, 0x4, 0xe0,
-    0xe, 0x40, 0x1, 0xc9, 0x0, 0xef, 0xee, 0xe9,
-    0x0,
-
-    /* U+048E "Ҏ" */
-    0x1f, 0xff, 0xff, 0xd8, 0x0, 0x1f, 0x21, 0x11,
-    0x4c, 0xc0, 0x1f, 0x10, 0x0, 0x0, 0xe6, 0x1f,
-    0x10, 0x0, 0x0, 0x99, 0x1f, 0x10, 0x3b, 0x0,
-    0x9a, 0x1f, 0x10, 0xa, 0x60, 0xd6, 0x1f, 0x10,
-    0x0, 0xeb, 0xd0, 0x1f, 0xff, 0xff, 0xff, 0x20,
-    0x1f, 0x32, 0x21, 0x8, 0x90, 0x1f, 0x10, 0x0,
-    0x0, 0xc3, 0x1f, 0x10, 0x0, 0x0, 0x10, 0x1f,
-    0x10, 0x0, 0x0, 0x0,
-
-    /* U+048F "ҏ" */
-    0x6b, 0x1a, 0xff, 0xb3, 0x0, 0x6c, 0xc6, 0x12,
-    0x8f, 0x30, 0x6f, 0x40, 0x0, 0x8, 0xc0, 0x6e,
-    0x0, 0x0, 0x1, 0xf1, 0x6c, 0x0, 0x0, 0x0,
-    0xf2, 0x6d, 0x0, 0x4, 0x11, 0xf1, 0x6f, 0x40,
-    0x5, 0xc7, 0xc0, 0x6c, 0xc6, 0x11, 0xcf, 0x30,
-    0x6c, 0x1a, 0xff, 0xcc, 0x40, 0x6c, 0x0, 0x0,
-    0x1, 0x90, 0x6c, 0x0, 0x0, 0x0, 0x0, 0x6c,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0490 "Ґ" */
-    0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x1,
-    0xf0, 0x0, 0x0, 0x0, 0x1f, 0x1, 0xff, 0xff,
-    0xff, 0xf0, 0x1f, 0x21, 0x11, 0x11, 0x1, 0xf1,
-    0x0, 0x0, 0x0, 0x1f, 0x10, 0x0, 0x0, 0x1,
-    0xf1, 0x0, 0x0, 0x0, 0x1f, 0x10, 0x0, 0x0,
-    0x1, 0xf1, 0x0, 0x0, 0x0, 0x1f, 0x10, 0x0,
-    0x0, 0x1, 0xf1, 0x0, 0x0, 0x0, 0x1f, 0x10,
-    0x0, 0x0, 0x1, 0xf1, 0x0, 0x0, 0x0, 0x1f,
-    0x10, 0x0, 0x0, 0x0,
-
-    /* U+0491 "ґ" */
-    0x0, 0x0, 0xe, 0x20, 0x0, 0x0, 0xe2, 0x6f,
-    0xff, 0xff, 0x26, 0xc0, 0x0, 0x0, 0x6c, 0x0,
-    0x0, 0x6, 0xc0, 0x0, 0x0, 0x6c, 0x0, 0x0,
-    0x6, 0xc0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x6,
-    0xc0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x0,
-
-    /* U+0492 "Ғ" */
-    0x0, 0xbf, 0xff, 0xff, 0xf6, 0x0, 0xb7, 0x11,
-    0x11, 0x10, 0x0, 0xb7, 0x0, 0x0, 0x0, 0x0,
-    0xb7, 0x0, 0x0, 0x0, 0x0, 0xb7, 0x0, 0x0,
-    0x0, 0x0, 0xb7, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0xb7, 0x0, 0x0, 0x0,
-    0x0, 0xb7, 0x0, 0x0, 0x0, 0x0, 0xb7, 0x0,
-    0x0, 0x0, 0x0, 0xb7, 0x0, 0x0, 0x0, 0x0,
-    0xb7, 0x0, 0x0, 0x0,
-
-    /* U+0493 "ғ" */
-    0x2, 0xff, 0xff, 0xfd, 0x2, 0xf0, 0x0, 0x0,
-    0x2, 0xf0, 0x0, 0x0, 0x2, 0xf0, 0x0, 0x0,
-    0x2, 0xf0, 0x0, 0x0, 0x3e, 0xfe, 0xee, 0x90,
-    0x2, 0xf0, 0x0, 0x0, 0x2, 0xf0, 0x0, 0x0,
-    0x2, 0xf0, 0x0, 0x0,
-
-    /* U+0494 "Ҕ" */
-    0x1f, 0xff, 0xff, 0xff, 0x50, 0x1f, 0x21, 0x11,
-    0x11, 0x0, 0x1f, 0x10, 0x0, 0x0, 0x0, 0x1f,
-    0x10, 0x0, 0x0, 0x0, 0x1f, 0x10, 0x0, 0x0,
-    0x0, 0x1f, 0x28, 0xcc, 0xa3, 0x0, 0x1f, 0xe8,
-    0x44, 0x9f, 0x50, 0x1f, 0x20, 0x0, 0x6, 0xe0,
-    0x1f, 0x10, 0x0, 0x0, 0xe4, 0x1f, 0x10, 0x0,
-    0x0, 0xc5, 0x1f, 0x10, 0x0, 0x0, 0xd4, 0x1f,
-    0x10, 0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x1d,
-    0x90, 0x0, 0x0, 0x8c, 0xfa, 0x0, 0x0, 0x0,
-    0x45, 0x20, 0x0,
-
-    /* U+0495 "ҕ" */
-    0x6f, 0xff, 0xff, 0x50, 0x6, 0xc0, 0x0, 0x0,
-    0x0, 0x6c, 0x0, 0x0, 0x0, 0x6, 0xc0, 0x0,
-    0x0, 0x0, 0x6c, 0x7b, 0xca, 0x30, 0x6, 0xf9,
-    0x53, 0x8f, 0x30, 0x6c, 0x0, 0x0, 0x8c, 0x6,
-    0xc0, 0x0, 0x3, 0xf0, 0x6c, 0x0, 0x0, 0x2f,
-    0x0, 0x0, 0x0, 0x5, 0xd0, 0x0, 0x0, 0x2,
-    0xe6, 0x0, 0x0, 0xbc, 0xf9, 0x0, 0x0, 0x5,
-    0x52, 0x0, 0x0,
-
-    /* U+0496 "Җ" */
-    0x1e, 0x40, 0x0, 0x7, 0xa0, 0x0, 0x2, 0xf3,
-    0x0, 0x5d, 0x0, 0x0, 0x7a, 0x0, 0x0, 0xb8,
-    0x0, 0x0, 0xb8, 0x0, 0x7, 0xa0, 0x0, 0x6d,
-    0x0, 0x0, 0x1, 0xe3, 0x0, 0x7a, 0x0, 0x1e,
-    0x30, 0x0, 0x0, 0x6, 0xc0, 0x7, 0xa0, 0xa,
-    0x90, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x5, 0xe3, 0x28, 0xb2,
-    0x2d, 0x80, 0x0, 0x0, 0x0, 0xe6, 0x0, 0x7a,
-    0x0, 0x3f, 0x20, 0x0, 0x0, 0x8d, 0x0, 0x7,
-    0xa0, 0x0, 0xab, 0x0, 0x0, 0x2f, 0x30, 0x0,
-    0x7a, 0x0, 0x1, 0xf5, 0x0, 0xb, 0xa0, 0x0,
-    0x7, 0xa0, 0x0, 0x7, 0xe2, 0x5, 0xf1, 0x0,
-    0x0, 0x7a, 0x0, 0x0, 0xd, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7a, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x50,
-
-    /* U+0497 "җ" */
-    0x3e, 0x10, 0x0, 0xf2, 0x0, 0xd, 0x60, 0x8,
-    0xa0, 0x0, 0xf2, 0x0, 0x7c, 0x0, 0x0, 0xe4,
-    0x0, 0xf2, 0x1, 0xe2, 0x0, 0x0, 0x5d, 0x0,
-    0xf2, 0xa, 0x80, 0x0, 0x0, 0xd, 0xfe, 0xff,
-    0xef, 0x10, 0x0, 0x0, 0x6e, 0x21, 0xf4, 0x1c,
-    0x90, 0x0, 0x1, 0xf4, 0x0, 0xf2, 0x2, 0xf4,
-    0x0, 0xb, 0xa0, 0x0, 0xf2, 0x0, 0x6e, 0x10,
-    0x6e, 0x10, 0x0, 0xf2, 0x0, 0xc, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5b, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5b,
-
-    /* U+0498 "Ҙ" */
-    0x0, 0x48, 0x98, 0x30, 0x0, 0xd, 0xea, 0x89,
-    0xfa, 0x0, 0x4, 0x0, 0x0, 0x1e, 0x60, 0x0,
-    0x0, 0x0, 0x9, 0x90, 0x0, 0x0, 0x0, 0xa,
-    0x80, 0x0, 0x0, 0x0, 0x5e, 0x20, 0x0, 0x5e,
-    0xef, 0xf5, 0x0, 0x0, 0x1, 0x11, 0x5d, 0x70,
-    0x0, 0x0, 0x0, 0x2, 0xf0, 0x0, 0x0, 0x0,
-    0x2, 0xf1, 0x38, 0x0, 0x0, 0x1b, 0xc0, 0x1b,
-    0xfb, 0xab, 0xfc, 0x10, 0x0, 0x27, 0xea, 0x40,
-    0x0, 0x0, 0x0, 0xb5, 0x0, 0x0, 0x0, 0x0,
-    0xb5, 0x0, 0x0,
-
-    /* U+0499 "ҙ" */
-    0x7, 0xdf, 0xfb, 0x30, 0x9, 0x41, 0x28, 0xf1,
-    0x0, 0x0, 0x0, 0xd5, 0x0, 0x0, 0x4, 0xe1,
-    0x0, 0x4e, 0xef, 0x50, 0x0, 0x0, 0x3, 0xe4,
-    0x0, 0x0, 0x0, 0xa8, 0x59, 0x31, 0x16, 0xf4,
-    0x8, 0xdf, 0xfb, 0x40, 0x0, 0x9, 0x70, 0x0,
-    0x0, 0x9, 0x70, 0x0,
-
-    /* U+049A "Қ" */
-    0x1f, 0x0, 0x0, 0x1, 0xe4, 0x1, 0xf0, 0x0,
-    0x0, 0xb8, 0x0, 0x1f, 0x0, 0x0, 0x7c, 0x0,
-    0x1, 0xf0, 0x0, 0x3e, 0x10, 0x0, 0x1f, 0x0,
-    0x1e, 0x40, 0x0, 0x1, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x1f, 0x32, 0x4f, 0x30, 0x0, 0x1, 0xf0,
-    0x0, 0x8d, 0x0, 0x0, 0x1f, 0x0, 0x0, 0xc8,
-    0x0, 0x1, 0xf0, 0x0, 0x2, 0xf3, 0x0, 0x1f,
-    0x0, 0x0, 0x7, 0xd2, 0x11, 0xf0, 0x0, 0x0,
-    0xc, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x5, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x5c, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x60,
-
-    /* U+049B "қ" */
-    0x6c, 0x0, 0x0, 0xb8, 0x6, 0xc0, 0x0, 0x7c,
-    0x0, 0x6c, 0x0, 0x3e, 0x10, 0x6, 0xc0, 0xd,
-    0x40, 0x0, 0x6f, 0xef, 0xc0, 0x0, 0x6, 0xc1,
-    0x3e, 0x60, 0x0, 0x6c, 0x0, 0x3f, 0x30, 0x6,
-    0xc0, 0x0, 0x6e, 0x10, 0x6c, 0x0, 0x0, 0x9f,
-    0xe0, 0x0, 0x0, 0x0, 0x2e, 0x0, 0x0, 0x0,
-    0x2, 0xe0,
-
-    /* U+049C "Ҝ" */
-    0x1f, 0x0, 0x0, 0x0, 0xaa, 0x1, 0xf0, 0x0,
-    0x0, 0x5e, 0x10, 0x1f, 0x0, 0x0, 0x1e, 0x40,
-    0x1, 0xf0, 0x95, 0xa, 0x90, 0x0, 0x1f, 0x9,
-    0x55, 0xd0, 0x0, 0x1, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x1f, 0x3a, 0x69, 0xc0, 0x0, 0x1, 0xf0,
-    0x95, 0xd, 0x70, 0x0, 0x1f, 0x8, 0x40, 0x4f,
-    0x10, 0x1, 0xf0, 0x0, 0x0, 0xab, 0x0, 0x1f,
-    0x0, 0x0, 0x1, 0xf5, 0x1, 0xf0, 0x0, 0x0,
-    0x6, 0xe1,
-
-    /* U+049D "ҝ" */
-    0x6b, 0x0, 0x0, 0x7b, 0x6, 0xb0, 0x0, 0x2e,
-    0x20, 0x6b, 0x37, 0xc, 0x60, 0x6, 0xb4, 0x96,
-    0xc0, 0x0, 0x6f, 0xff, 0xf5, 0x0, 0x6, 0xc5,
-    0xa8, 0xd0, 0x0, 0x6b, 0x38, 0xc, 0x80, 0x6,
-    0xb0, 0x0, 0x2f, 0x40, 0x6b, 0x0, 0x0, 0x6e,
-    0x10,
-
-    /* U+049E "Ҟ" */
-    0x0, 0xc6, 0x0, 0x0, 0xa, 0xa0, 0x0, 0xc6,
-    0x0, 0x0, 0x6d, 0x0, 0x5e, 0xff, 0xee, 0x42,
-    0xe2, 0x0, 0x0, 0xc6, 0x0, 0xd, 0x60, 0x0,
-    0x0, 0xc6, 0x0, 0xaa, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0xc7, 0x22, 0xd8,
-    0x0, 0x0, 0x0, 0xc6, 0x0, 0x3f, 0x30, 0x0,
-    0x0, 0xc6, 0x0, 0x7, 0xd0, 0x0, 0x0, 0xc6,
-    0x0, 0x0, 0xc9, 0x0, 0x0, 0xc6, 0x0, 0x0,
-    0x2f, 0x40, 0x0, 0xc6, 0x0, 0x0, 0x6, 0xe0,
-
-    /* U+049F "ҟ" */
-    0x3, 0x60, 0x0, 0x0, 0x0, 0x6, 0xc0, 0x0,
-    0x0, 0x0, 0xdf, 0xfe, 0xe4, 0x0, 0x0, 0x6,
-    0xc0, 0x0, 0x0, 0x0, 0x6, 0xc0, 0x0, 0xb,
-    0x80, 0x6, 0xc0, 0x0, 0x7c, 0x0, 0x6, 0xc0,
-    0x3, 0xe1, 0x0, 0x6, 0xc0, 0xd, 0x40, 0x0,
-    0x6, 0xfe, 0xfc, 0x0, 0x0, 0x6, 0xc1, 0x3e,
-    0x60, 0x0, 0x6, 0xc0, 0x3, 0xf3, 0x0, 0x6,
-    0xc0, 0x0, 0x6e, 0x10, 0x6, 0xc0, 0x0, 0x9,
-    0xb0,
-
-    /* U+04A0 "Ҡ" */
-    0xdf, 0xff, 0xe0, 0x0, 0x0, 0x3e, 0x21, 0x11,
-    0x5d, 0x0, 0x0, 0x1e, 0x50, 0x0, 0x5, 0xd0,
-    0x0, 0xa, 0x90, 0x0, 0x0, 0x5d, 0x0, 0x7,
-    0xc0, 0x0, 0x0, 0x5, 0xd0, 0x3, 0xe2, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x5, 0xd2, 0x27, 0xe1, 0x0, 0x0, 0x0, 0x5d,
-    0x0, 0xb, 0xa0, 0x0, 0x0, 0x5, 0xd0, 0x0,
-    0x1f, 0x50, 0x0, 0x0, 0x5d, 0x0, 0x0, 0x5e,
-    0x10, 0x0, 0x5, 0xd0, 0x0, 0x0, 0xaa, 0x0,
-    0x0, 0x5d, 0x0, 0x0, 0x1, 0xe5,
-
-    /* U+04A1 "ҡ" */
-    0xff, 0xfd, 0x0, 0x0, 0xa8, 0x0, 0x5, 0xc0,
-    0x0, 0x6c, 0x0, 0x0, 0x5c, 0x0, 0x2e, 0x20,
-    0x0, 0x5, 0xc0, 0xd, 0x50, 0x0, 0x0, 0x5f,
-    0xef, 0xd0, 0x0, 0x0, 0x5, 0xd1, 0x2e, 0x60,
-    0x0, 0x0, 0x5c, 0x0, 0x3f, 0x30, 0x0, 0x5,
-    0xc0, 0x0, 0x6e, 0x10, 0x0, 0x5c, 0x0, 0x0,
-    0x9c, 0x0,
-
-    /* U+04A2 "Ң" */
-    0x1f, 0x10, 0x0, 0x0, 0xe, 0x40, 0x1, 0xf1,
-    0x0, 0x0, 0x0, 0xe4, 0x0, 0x1f, 0x10, 0x0,
-    0x0, 0xe, 0x40, 0x1, 0xf1, 0x0, 0x0, 0x0,
-    0xe4, 0x0, 0x1f, 0x10, 0x0, 0x0, 0xe, 0x40,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x1f,
-    0x32, 0x22, 0x22, 0x2f, 0x40, 0x1, 0xf1, 0x0,
-    0x0, 0x0, 0xe4, 0x0, 0x1f, 0x10, 0x0, 0x0,
-    0xe, 0x40, 0x1, 0xf1, 0x0, 0x0, 0x0, 0xe4,
-    0x0, 0x1f, 0x10, 0x0, 0x0, 0xe, 0x51, 0x1,
-    0xf1, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0x0,
-
-    /* U+04A3 "ң" */
-    0x6c, 0x0, 0x0, 0xf, 0x30, 0x6c, 0x0, 0x0,
-    0xf, 0x30, 0x6c, 0x0, 0x0, 0xf, 0x30, 0x6c,
-    0x0, 0x0, 0xf, 0x30, 0x6f, 0xee, 0xee, 0xef,
-    0x30, 0x6c, 0x11, 0x11, 0x1f, 0x30, 0x6c, 0x0,
-    0x0, 0xf, 0x30, 0x6c, 0x0, 0x0, 0xf, 0x30,
-    0x6c, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x88, 0x0, 0x0, 0x0, 0x0, 0x88,
-
-    /* U+04A4 "Ҥ" */
-    0x1f, 0x10, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x31, 0xf1, 0x0, 0x0, 0x0, 0xf5, 0x11, 0x11,
-    0x10, 0x1f, 0x10, 0x0, 0x0, 0xf, 0x40, 0x0,
-    0x0, 0x1, 0xf1, 0x0, 0x0, 0x0, 0xf4, 0x0,
-    0x0, 0x0, 0x1f, 0x10, 0x0, 0x0, 0xf, 0x40,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x1f, 0x32, 0x22, 0x22, 0x2f,
-    0x40, 0x0, 0x0, 0x1, 0xf1, 0x0, 0x0, 0x0,
-    0xf4, 0x0, 0x0, 0x0, 0x1f, 0x10, 0x0, 0x0,
-    0xf, 0x40, 0x0, 0x0, 0x1, 0xf1, 0x0, 0x0,
-    0x0, 0xf4, 0x0, 0x0, 0x0, 0x1f, 0x10, 0x0,
-    0x0, 0xf, 0x40, 0x0, 0x0, 0x1, 0xf1, 0x0,
-    0x0, 0x0, 0xf4, 0x0, 0x0, 0x0,
-
-    /* U+04A5 "ҥ" */
-    0x6c, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf6, 0xc0,
-    0x0, 0x0, 0xf4, 0x0, 0x0, 0x6c, 0x0, 0x0,
-    0xf, 0x40, 0x0, 0x6, 0xc0, 0x0, 0x0, 0xf4,
-    0x0, 0x0, 0x6f, 0xee, 0xee, 0xef, 0x40, 0x0,
-    0x6, 0xc1, 0x11, 0x11, 0xf4, 0x0, 0x0, 0x6c,
-    0x0, 0x0, 0xf, 0x40, 0x0, 0x6, 0xc0, 0x0,
-    0x0, 0xf4, 0x0, 0x0, 0x6c, 0x0, 0x0, 0xf,
-    0x40, 0x0, 0x0,
-
-    /* U+04A6 "Ҧ" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x1f, 0x21, 0x11, 0x11, 0x1e, 0x50, 0x0,
-    0x0, 0x0, 0x1f, 0x10, 0x0, 0x0, 0xd, 0x50,
-    0x0, 0x0, 0x0, 0x1f, 0x10, 0x0, 0x0, 0xd,
-    0x50, 0x0, 0x0, 0x0, 0x1f, 0x10, 0x0, 0x0,
-    0xd, 0x50, 0x0, 0x0, 0x0, 0x1f, 0x10, 0x0,
-    0x0, 0xd, 0x67, 0xbc, 0xb4, 0x0, 0x1f, 0x10,
-    0x0, 0x0, 0xd, 0xf9, 0x44, 0x7f, 0x80, 0x1f,
-    0x10, 0x0, 0x0, 0xd, 0x50, 0x0, 0x3, 0xf2,
-    0x1f, 0x10, 0x0, 0x0, 0xd, 0x50, 0x0, 0x0,
-    0xc7, 0x1f, 0x10, 0x0, 0x0, 0xd, 0x50, 0x0,
-    0x0, 0x99, 0x1f, 0x10, 0x0, 0x0, 0xd, 0x50,
-    0x0, 0x0, 0xb7, 0x1f, 0x10, 0x0, 0x0, 0xd,
-    0x50, 0x0, 0x1, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6b, 0xec, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x35, 0x30, 0x0,
-
-    /* U+04A7 "ҧ" */
-    0x6f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x6,
-    0xc0, 0x0, 0x4, 0xe0, 0x0, 0x0, 0x0, 0x6c,
-    0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x6, 0xc0,
-    0x0, 0x3, 0xe0, 0x0, 0x0, 0x0, 0x6c, 0x0,
-    0x0, 0x3e, 0x6b, 0xca, 0x30, 0x6, 0xc0, 0x0,
-    0x3, 0xfa, 0x53, 0x7f, 0x40, 0x6c, 0x0, 0x0,
-    0x3e, 0x0, 0x0, 0x6d, 0x6, 0xc0, 0x0, 0x3,
-    0xe0, 0x0, 0x1, 0xf1, 0x6c, 0x0, 0x0, 0x3e,
-    0x0, 0x0, 0xf, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xac,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x52,
-    0x0, 0x0,
-
-    /* U+04A8 "Ҩ" */
-    0x0, 0x97, 0x0, 0x3b, 0xff, 0xb2, 0x0, 0x9,
-    0xc0, 0x3, 0xf8, 0x23, 0x9f, 0x20, 0x3f, 0x10,
-    0xd, 0x80, 0x0, 0xa, 0xb0, 0xa9, 0x0, 0x3f,
-    0x0, 0x0, 0x3, 0xf0, 0xe4, 0x0, 0x5d, 0x0,
-    0x0, 0x0, 0xf2, 0xf2, 0x0, 0x6c, 0x0, 0x0,
-    0x0, 0xf2, 0xe3, 0x0, 0x4e, 0x0, 0x0, 0x2,
-    0xf0, 0xc6, 0x0, 0x1f, 0x20, 0x0, 0x6, 0xb0,
-    0x6d, 0x0, 0x9, 0xa0, 0x0, 0xe, 0x30, 0xd,
-    0x80, 0x1, 0xe7, 0x0, 0xb8, 0x0, 0x2, 0xdb,
-    0x40, 0x2d, 0xbd, 0x80, 0x10, 0x0, 0x7, 0xcf,
-    0xfd, 0xac, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+04A9 "ҩ" */
-    0x0, 0x8a, 0x0, 0x9f, 0xfb, 0x20, 0x5, 0xe1,
-    0xb, 0xa1, 0x18, 0xe0, 0xd, 0x50, 0x3e, 0x0,
-    0x0, 0xd5, 0x1f, 0x0, 0x6b, 0x0, 0x0, 0x98,
-    0x2f, 0x0, 0x6b, 0x0, 0x0, 0xa7, 0xf, 0x20,
-    0x3f, 0x0, 0x0, 0xe3, 0xa, 0xa0, 0xc, 0x90,
-    0x8, 0xa0, 0x1, 0xda, 0x22, 0xea, 0xac, 0x0,
-    0x0, 0x8, 0xde, 0xec, 0xef, 0xe7,
-
-    /* U+04AA "Ҫ" */
-    0x0, 0x1, 0x8d, 0xff, 0xc5, 0x0, 0x3, 0xeb,
-    0x52, 0x26, 0xe9, 0x1, 0xe8, 0x0, 0x0, 0x1,
-    0x30, 0x9b, 0x0, 0x0, 0x0, 0x0, 0xe, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x20, 0x0, 0x0, 0x0, 0x0, 0xe5,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0x80, 0x0, 0x0, 0x13, 0x0,
-    0x3e, 0xb5, 0x22, 0x6e, 0x90, 0x0, 0x18, 0xdf,
-    0xfc, 0x50, 0x0, 0x0, 0x0, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x71, 0x0, 0x0,
-
-    /* U+04AB "ҫ" */
-    0x0, 0x2b, 0xff, 0xc4, 0x0, 0x3f, 0x82, 0x16,
-    0xf3, 0xc, 0x80, 0x0, 0x2, 0x1, 0xf1, 0x0,
-    0x0, 0x0, 0x3f, 0x0, 0x0, 0x0, 0x1, 0xf1,
-    0x0, 0x0, 0x0, 0xc, 0x80, 0x0, 0x2, 0x0,
-    0x3f, 0x82, 0x16, 0xf3, 0x0, 0x2b, 0xff, 0xc4,
-    0x0, 0x0, 0x7, 0x90, 0x0, 0x0, 0x0, 0x79,
-    0x0, 0x0,
-
-    /* U+04AC "Ҭ" */
-    0xdf, 0xff, 0xff, 0xff, 0xf3, 0x11, 0x11, 0xe5,
-    0x11, 0x10, 0x0, 0x0, 0xe4, 0x0, 0x0, 0x0,
-    0x0, 0xe4, 0x0, 0x0, 0x0, 0x0, 0xe4, 0x0,
-    0x0, 0x0, 0x0, 0xe4, 0x0, 0x0, 0x0, 0x0,
-    0xe4, 0x0, 0x0, 0x0, 0x0, 0xe4, 0x0, 0x0,
-    0x0, 0x0, 0xe4, 0x0, 0x0, 0x0, 0x0, 0xe4,
-    0x0, 0x0, 0x0, 0x0, 0xe5, 0x10, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x80, 0x0,
-
-    /* U+04AD "ҭ" */
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0xc, 0x60, 0x0,
-    0x0, 0xc, 0x50, 0x0, 0x0, 0xc, 0x50, 0x0,
-    0x0, 0xc, 0x50, 0x0, 0x0, 0xc, 0x50, 0x0,
-    0x0, 0xc, 0x50, 0x0, 0x0, 0xc, 0x60, 0x0,
-    0x0, 0xd, 0xfb, 0x0, 0x0, 0x0, 0x6b, 0x0,
-    0x0, 0x0, 0x6b, 0x0,
-
-    /* U+04AE "Ү" */
-    0x9b, 0x0, 0x0, 0x0, 0x3e, 0x1, 0xe4, 0x0,
-    0x0, 0xc, 0x60, 0x6, 0xd0, 0x0, 0x5, 0xd0,
-    0x0, 0xd, 0x60, 0x0, 0xe4, 0x0, 0x0, 0x4e,
-    0x0, 0x7b, 0x0, 0x0, 0x0, 0xb8, 0x1e, 0x20,
-    0x0, 0x0, 0x2, 0xfb, 0x90, 0x0, 0x0, 0x0,
-    0x9, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x6c, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x6c, 0x0, 0x0, 0x0, 0x0, 0x6, 0xc0,
-    0x0, 0x0,
-
-    /* U+04AF "ү" */
-    0xa9, 0x0, 0x0, 0x8, 0x93, 0xf0, 0x0, 0x0,
-    0xe2, 0xc, 0x60, 0x0, 0x6b, 0x0, 0x5d, 0x0,
-    0xd, 0x40, 0x0, 0xe4, 0x4, 0xd0, 0x0, 0x7,
-    0xb0, 0xb6, 0x0, 0x0, 0x1f, 0x5e, 0x0, 0x0,
-    0x0, 0x9f, 0x80, 0x0, 0x0, 0x3, 0xf2, 0x0,
-    0x0, 0x0, 0x1f, 0x0, 0x0, 0x0, 0x1, 0xf0,
-    0x0, 0x0, 0x0, 0x1f, 0x0, 0x0,
-
-    /* U+04B0 "Ұ" */
-    0x9b, 0x0, 0x0, 0x0, 0x3e, 0x1, 0xe4, 0x0,
-    0x0, 0xc, 0x60, 0x6, 0xd0, 0x0, 0x6, 0xc0,
-    0x0, 0xc, 0x70, 0x1, 0xe3, 0x0, 0x0, 0x3f,
-    0x10, 0x99, 0x0, 0x0, 0x0, 0x9a, 0x2e, 0x10,
-    0x0, 0x0, 0x1, 0xfd, 0x70, 0x0, 0x0, 0x2e,
-    0xef, 0xfe, 0xe7, 0x0, 0x0, 0x0, 0x6c, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x6c, 0x0, 0x0, 0x0, 0x0, 0x6, 0xc0,
-    0x0, 0x0,
-
-    /* U+04B1 "ұ" */
-    0xa9, 0x0, 0x0, 0x8, 0x93, 0xf0, 0x0, 0x0,
-    0xe2, 0xc, 0x60, 0x0, 0x6b, 0x0, 0x5d, 0x0,
-    0xd, 0x40, 0x0, 0xe4, 0x4, 0xd0, 0x0, 0x7,
-    0xb0, 0xb6, 0x0, 0x0, 0x1f, 0x4e, 0x0, 0x0,
-    0x0, 0xaf, 0x90, 0x0, 0xb, 0xee, 0xfe, 0xea,
-    0x0, 0x0, 0x1f, 0x0, 0x0, 0x0, 0x1, 0xf0,
-    0x0, 0x0, 0x0, 0x1f, 0x0, 0x0,
-
-    /* U+04B2 "Ҳ" */
-    0x1f, 0x50, 0x0, 0x1, 0xe6, 0x0, 0x6e, 0x10,
-    0x0, 0xac, 0x0, 0x0, 0xba, 0x0, 0x5f, 0x20,
-    0x0, 0x1, 0xf5, 0x1e, 0x60, 0x0, 0x0, 0x6,
-    0xeb, 0xc0, 0x0, 0x0, 0x0, 0xc, 0xf2, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0x60, 0x0, 0x0, 0x0,
-    0xab, 0x6f, 0x10, 0x0, 0x0, 0x5f, 0x20, 0xbb,
-    0x0, 0x0, 0x1e, 0x60, 0x1, 0xe6, 0x0, 0xa,
-    0xb0, 0x0, 0x5, 0xf3, 0x15, 0xf1, 0x0, 0x0,
-    0xb, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x4, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x4d, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x60,
-
-    /* U+04B3 "ҳ" */
-    0x3e, 0x10, 0x0, 0xaa, 0x0, 0x8c, 0x0, 0x5d,
-    0x0, 0x0, 0xc7, 0x1e, 0x30, 0x0, 0x2, 0xed,
-    0x70, 0x0, 0x0, 0xa, 0xf0, 0x0, 0x0, 0x4,
-    0xea, 0xa0, 0x0, 0x1, 0xe4, 0xd, 0x50, 0x0,
-    0xa9, 0x0, 0x3e, 0x20, 0x6d, 0x0, 0x0, 0x7f,
-    0xf0, 0x0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x0,
-    0x1, 0xf0,
-
-    /* U+04B4 "Ҵ" */
-    0xdf, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xf3, 0x0,
-    0x11, 0x11, 0xf6, 0x11, 0x10, 0x0, 0xf3, 0x0,
-    0x0, 0x0, 0xf5, 0x0, 0x0, 0x0, 0xf3, 0x0,
-    0x0, 0x0, 0xf5, 0x0, 0x0, 0x0, 0xf3, 0x0,
-    0x0, 0x0, 0xf5, 0x0, 0x0, 0x0, 0xf3, 0x0,
-    0x0, 0x0, 0xf5, 0x0, 0x0, 0x0, 0xf3, 0x0,
-    0x0, 0x0, 0xf5, 0x0, 0x0, 0x0, 0xf3, 0x0,
-    0x0, 0x0, 0xf5, 0x0, 0x0, 0x0, 0xf3, 0x0,
-    0x0, 0x0, 0xf5, 0x0, 0x0, 0x0, 0xf3, 0x0,
-    0x0, 0x0, 0xf5, 0x0, 0x0, 0x0, 0xf3, 0x0,
-    0x0, 0x0, 0xf6, 0x11, 0x11, 0x11, 0xf4, 0x10,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf0,
-
-    /* U+04B5 "ҵ" */
-    0xff, 0xff, 0xff, 0xf1, 0xe, 0x30, 0x0, 0xc,
-    0x60, 0x0, 0xe, 0x30, 0x0, 0xc, 0x50, 0x0,
-    0xe, 0x30, 0x0, 0xc, 0x50, 0x0, 0xe, 0x30,
-    0x0, 0xc, 0x50, 0x0, 0xe, 0x30, 0x0, 0xc,
-    0x50, 0x0, 0xe, 0x30, 0x0, 0xc, 0x50, 0x0,
-    0xe, 0x30, 0x0, 0xc, 0x60, 0x0, 0xe, 0x40,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x97, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x97,
-
-    /* U+04B6 "Ҷ" */
-    0x1f, 0x10, 0x0, 0x0, 0x5c, 0x0, 0x1f, 0x10,
-    0x0, 0x0, 0x5c, 0x0, 0x1f, 0x10, 0x0, 0x0,
-    0x5c, 0x0, 0x1f, 0x10, 0x0, 0x0, 0x5c, 0x0,
-    0xf, 0x20, 0x0, 0x0, 0x5c, 0x0, 0xd, 0x70,
-    0x0, 0x0, 0x5c, 0x0, 0x6, 0xf6, 0x0, 0x16,
-    0xdc, 0x0, 0x0, 0x6e, 0xff, 0xfb, 0xac, 0x0,
-    0x0, 0x0, 0x11, 0x0, 0x5c, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5d, 0x10, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x89, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x89, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x44,
-
-    /* U+04B7 "ҷ" */
-    0x4e, 0x0, 0x0, 0x2f, 0x0, 0x4e, 0x0, 0x0,
-    0x2f, 0x0, 0x4e, 0x0, 0x0, 0x2f, 0x0, 0x3f,
-    0x0, 0x0, 0x2f, 0x0, 0xe, 0x91, 0x2, 0x9f,
-    0x0, 0x2, 0xbf, 0xfc, 0x9f, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0xc5, 0x0, 0x0, 0x0, 0x0, 0xc5,
-
-    /* U+04B8 "Ҹ" */
-    0x1f, 0x10, 0x0, 0x0, 0x6c, 0x1f, 0x10, 0x0,
-    0x0, 0x6c, 0x1f, 0x10, 0x0, 0x0, 0x6c, 0x1f,
-    0x10, 0x0, 0x0, 0x6c, 0xf, 0x20, 0x17, 0x0,
-    0x6c, 0xd, 0x60, 0x2b, 0x0, 0x6c, 0x6, 0xf5,
-    0x3b, 0x16, 0xdc, 0x0, 0x6e, 0xff, 0xfb, 0xac,
-    0x0, 0x0, 0x4c, 0x0, 0x6c, 0x0, 0x0, 0x2b,
-    0x0, 0x6c, 0x0, 0x0, 0x16, 0x0, 0x6c, 0x0,
-    0x0, 0x0, 0x0, 0x6c,
-
-    /* U+04B9 "ҹ" */
-    0x4e, 0x0, 0x0, 0x2f, 0x4e, 0x0, 0x0, 0x2f,
-    0x4e, 0x0, 0x0, 0x2f, 0x3f, 0x1, 0xb0, 0x2f,
-    0xe, 0x92, 0xc3, 0x9f, 0x2, 0xbf, 0xfc, 0x9f,
-    0x0, 0x1, 0xc0, 0x2f, 0x0, 0x0, 0x90, 0x2f,
-    0x0, 0x0, 0x0, 0x2f,
-
-    /* U+04BA "Һ" */
-    0x1f, 0x10, 0x0, 0x0, 0x0, 0x1f, 0x10, 0x0,
-    0x0, 0x0, 0x1f, 0x10, 0x0, 0x0, 0x0, 0x1f,
-    0x10, 0x0, 0x0, 0x0, 0x1f, 0x5a, 0xdf, 0xe9,
-    0x10, 0x1f, 0xd7, 0x32, 0x4b, 0xe1, 0x1f, 0x10,
-    0x0, 0x0, 0xd8, 0x1f, 0x10, 0x0, 0x0, 0x7b,
-    0x1f, 0x10, 0x0, 0x0, 0x6c, 0x1f, 0x10, 0x0,
-    0x0, 0x6c, 0x1f, 0x10, 0x0, 0x0, 0x6c, 0x1f,
-    0x10, 0x0, 0x0, 0x6c,
-
-    /* U+04BB "һ" */
-    0x36, 0x0, 0x0, 0x0, 0x6, 0xc0, 0x0, 0x0,
-    0x0, 0x6c, 0x0, 0x0, 0x0, 0x6, 0xc0, 0x0,
-    0x0, 0x0, 0x6c, 0x3c, 0xff, 0xa1, 0x6, 0xed,
-    0x51, 0x3c, 0xc0, 0x6f, 0x20, 0x0, 0x1f, 0x36,
-    0xd0, 0x0, 0x0, 0xd5, 0x6c, 0x0, 0x0, 0xc,
-    0x56, 0xc0, 0x0, 0x0, 0xc5, 0x6c, 0x0, 0x0,
-    0xc, 0x56, 0xc0, 0x0, 0x0, 0xc5, 0x6c, 0x0,
-    0x0, 0xc, 0x50,
-
-    /* U+04BC "Ҽ" */
-    0x0, 0x0, 0x0, 0x4b, 0xff, 0xd9, 0x10, 0x0,
-    0x0, 0x0, 0x8f, 0x72, 0x24, 0xaf, 0x40, 0x2a,
-    0x0, 0x6e, 0x20, 0x0, 0x0, 0x6e, 0x16, 0xb0,
-    0xe, 0x50, 0x0, 0x0, 0x0, 0xb8, 0x5e, 0x24,
-    0xe0, 0x0, 0x0, 0x0, 0x6, 0xc0, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x18, 0xc2,
-    0x22, 0x22, 0x22, 0x22, 0x10, 0x0, 0x4e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xe2, 0x0,
-    0x0, 0x6, 0x30, 0x0, 0x0, 0x9, 0xf8, 0x32,
-    0x4b, 0xf5, 0x0, 0x0, 0x0, 0x4, 0xbe, 0xfd,
-    0x92, 0x0,
-
-    /* U+04BD "ҽ" */
-    0x0, 0x0, 0x2b, 0xff, 0xc3, 0x0, 0x11, 0x3,
-    0xe7, 0x11, 0x6e, 0x40, 0x87, 0xc, 0x70, 0x0,
-    0x5, 0xd0, 0x99, 0x1f, 0x10, 0x0, 0x0, 0xe3,
-    0x1c, 0xef, 0xee, 0xee, 0xee, 0xf4, 0x0, 0x1f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xb, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xe9, 0x21, 0x3a, 0x80,
-    0x0, 0x0, 0x2a, 0xef, 0xe8, 0x0,
-
-    /* U+04BE "Ҿ" */
-    0x0, 0x0, 0x0, 0x4b, 0xff, 0xd9, 0x10, 0x0,
-    0x0, 0x0, 0x8f, 0x72, 0x24, 0xaf, 0x40, 0x2a,
-    0x0, 0x6e, 0x20, 0x0, 0x0, 0x6e, 0x16, 0xb0,
-    0xe, 0x50, 0x0, 0x0, 0x0, 0xb8, 0x5e, 0x24,
-    0xe0, 0x0, 0x0, 0x0, 0x6, 0xc0, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x18, 0xc2,
-    0x22, 0x22, 0x22, 0x22, 0x10, 0x0, 0x4e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xe2, 0x0,
-    0x0, 0x6, 0x30, 0x0, 0x0, 0x9, 0xf8, 0x32,
-    0x4b, 0xf5, 0x0, 0x0, 0x0, 0x4, 0xbf, 0xfd,
-    0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0x0, 0x0,
-    0x0,
-
-    /* U+04BF "ҿ" */
-    0x0, 0x0, 0x2b, 0xff, 0xc3, 0x0, 0x11, 0x3,
-    0xe7, 0x11, 0x6e, 0x40, 0x87, 0xc, 0x70, 0x0,
-    0x5, 0xd0, 0x99, 0x1f, 0x10, 0x0, 0x0, 0xe3,
-    0x1c, 0xef, 0xee, 0xee, 0xee, 0xf4, 0x0, 0x1f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xb, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xe9, 0x21, 0x3a, 0x80,
-    0x0, 0x0, 0x2a, 0xff, 0xe8, 0x0, 0x0, 0x0,
-    0x0, 0x5b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5b,
-    0x0, 0x0,
-
-    /* U+04C0 "Ӏ" */
-    0x1f, 0x11, 0xf1, 0x1f, 0x11, 0xf1, 0x1f, 0x11,
-    0xf1, 0x1f, 0x11, 0xf1, 0x1f, 0x11, 0xf1, 0x1f,
-    0x11, 0xf1,
-
-    /* U+04C1 "Ӂ" */
-    0x0, 0x0, 0x6, 0x90, 0x6, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8b, 0xb9, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0x40, 0x0, 0x7, 0xa0, 0x0, 0x2, 0xf3,
-    0x5, 0xd0, 0x0, 0x7, 0xa0, 0x0, 0xb, 0x80,
-    0x0, 0xb8, 0x0, 0x7, 0xa0, 0x0, 0x6d, 0x0,
-    0x0, 0x1e, 0x30, 0x7, 0xa0, 0x1, 0xe3, 0x0,
-    0x0, 0x6, 0xc0, 0x7, 0xa0, 0xa, 0x90, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x5, 0xe3, 0x28, 0xb2, 0x2d, 0x80, 0x0,
-    0x0, 0xe, 0x60, 0x7, 0xa0, 0x3, 0xf2, 0x0,
-    0x0, 0x8d, 0x0, 0x7, 0xa0, 0x0, 0xab, 0x0,
-    0x2, 0xf3, 0x0, 0x7, 0xa0, 0x0, 0x1f, 0x50,
-    0xb, 0xa0, 0x0, 0x7, 0xa0, 0x0, 0x7, 0xe0,
-    0x5f, 0x10, 0x0, 0x7, 0xa0, 0x0, 0x0, 0xd8,
-
-    /* U+04C2 "ӂ" */
-    0x0, 0x0, 0x60, 0x0, 0x60, 0x0, 0x0, 0x0,
-    0x9, 0x60, 0x3c, 0x0, 0x0, 0x0, 0x0, 0x1a,
-    0xcb, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0x10, 0x0, 0xf2, 0x0, 0xd,
-    0x60, 0x8a, 0x0, 0xf, 0x20, 0x7, 0xc0, 0x0,
-    0xe4, 0x0, 0xf2, 0x1, 0xe2, 0x0, 0x5, 0xd0,
-    0xf, 0x20, 0xa8, 0x0, 0x0, 0xd, 0xfe, 0xff,
-    0xef, 0x10, 0x0, 0x6, 0xe2, 0x1f, 0x41, 0xc9,
-    0x0, 0x1, 0xf4, 0x0, 0xf2, 0x2, 0xf4, 0x0,
-    0xba, 0x0, 0xf, 0x20, 0x6, 0xe0, 0x6e, 0x10,
-    0x0, 0xf2, 0x0, 0xc, 0x90,
-
-    /* U+04C3 "Ӄ" */
-    0x1f, 0x0, 0x0, 0x1, 0xe4, 0x1f, 0x0, 0x0,
-    0xb, 0x80, 0x1f, 0x0, 0x0, 0x7c, 0x0, 0x1f,
-    0x0, 0x3, 0xe1, 0x0, 0x1f, 0x0, 0x1e, 0x40,
-    0x0, 0x1f, 0xff, 0xfb, 0x0, 0x0, 0x1f, 0x32,
-    0x4e, 0x70, 0x0, 0x1f, 0x0, 0x2, 0xe5, 0x0,
-    0x1f, 0x0, 0x0, 0x4f, 0x20, 0x1f, 0x0, 0x0,
-    0x9, 0xc0, 0x1f, 0x0, 0x0, 0x1, 0xf4, 0x1f,
-    0x0, 0x0, 0x0, 0xaa, 0x0, 0x0, 0x0, 0x0,
-    0x8c, 0x0, 0x0, 0x1, 0x22, 0xd9, 0x0, 0x0,
-    0x3, 0xef, 0xb1,
-
-    /* U+04C4 "ӄ" */
-    0x6c, 0x0, 0x0, 0xb8, 0x6c, 0x0, 0x7, 0xc0,
-    0x6c, 0x0, 0x3e, 0x10, 0x6c, 0x0, 0xd4, 0x0,
-    0x6f, 0xef, 0xe0, 0x0, 0x6c, 0x12, 0xac, 0x0,
-    0x6c, 0x0, 0xb, 0xa0, 0x6c, 0x0, 0x1, 0xe4,
-    0x6c, 0x0, 0x0, 0x7a, 0x0, 0x0, 0x0, 0x4d,
-    0x0, 0x0, 0x20, 0xab, 0x0, 0x2, 0xdf, 0xc2,
-
-    /* U+04C6 "ӆ" */
-    0x0, 0xaf, 0xff, 0xff, 0x80, 0x0, 0xb5, 0x0,
-    0xa, 0x80, 0x0, 0xc4, 0x0, 0xa, 0x80, 0x0,
-    0xd3, 0x0, 0xa, 0x80, 0x0, 0xe2, 0x0, 0xa,
-    0x80, 0x0, 0xf0, 0x0, 0xa, 0x80, 0x2, 0xd0,
-    0x0, 0xa, 0x80, 0x9, 0x90, 0x0, 0xa, 0x80,
-    0xdd, 0x10, 0x0, 0xc, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x86, 0x0, 0x0, 0x0, 0x0, 0xd2,
-
-    /* U+04C7 "Ӈ" */
-    0x1f, 0x10, 0x0, 0x0, 0xf, 0x21, 0xf1, 0x0,
-    0x0, 0x0, 0xf2, 0x1f, 0x10, 0x0, 0x0, 0xf,
-    0x21, 0xf1, 0x0, 0x0, 0x0, 0xf2, 0x1f, 0x10,
-    0x0, 0x0, 0xf, 0x21, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x1f, 0x32, 0x22, 0x22, 0x2f, 0x21, 0xf1,
-    0x0, 0x0, 0x0, 0xf2, 0x1f, 0x10, 0x0, 0x0,
-    0xf, 0x21, 0xf1, 0x0, 0x0, 0x0, 0xf2, 0x1f,
-    0x10, 0x0, 0x0, 0xf, 0x21, 0xf1, 0x0, 0x0,
-    0x0, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xf, 0x20,
-    0x0, 0x0, 0x0, 0x2, 0xf1, 0x0, 0x0, 0x0,
-    0xdb, 0xe9, 0x0, 0x0, 0x0, 0x2, 0x54, 0x0,
-
-    /* U+04C8 "ӈ" */
-    0x6c, 0x0, 0x0, 0xd, 0x46, 0xc0, 0x0, 0x0,
-    0xd4, 0x6c, 0x0, 0x0, 0xd, 0x46, 0xc0, 0x0,
-    0x0, 0xd4, 0x6f, 0xee, 0xee, 0xef, 0x46, 0xc1,
-    0x11, 0x11, 0xd4, 0x6c, 0x0, 0x0, 0xd, 0x46,
-    0xc0, 0x0, 0x0, 0xd4, 0x6c, 0x0, 0x0, 0xd,
-    0x40, 0x0, 0x0, 0x0, 0xd4, 0x0, 0x0, 0x21,
-    0x4f, 0x10, 0x0, 0x9, 0xfe, 0x60,
-
-    /* U+04C9 "Ӊ" */
-    0x1f, 0x10, 0x0, 0x0, 0xe, 0x40, 0x1f, 0x10,
-    0x0, 0x0, 0xe, 0x40, 0x1f, 0x10, 0x0, 0x0,
-    0xe, 0x40, 0x1f, 0x10, 0x0, 0x0, 0xe, 0x40,
-    0x1f, 0x10, 0x0, 0x0, 0xe, 0x40, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x1f, 0x32, 0x22, 0x22,
-    0x2f, 0x40, 0x1f, 0x10, 0x0, 0x0, 0xe, 0x40,
-    0x1f, 0x10, 0x0, 0x0, 0xe, 0x40, 0x1f, 0x10,
-    0x0, 0x0, 0xe, 0x40, 0x1f, 0x10, 0x0, 0x0,
-    0xe, 0x51, 0x1f, 0x10, 0x0, 0x0, 0xf, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x60,
-
-    /* U+04CA "ӊ" */
-    0x6c, 0x0, 0x0, 0xf, 0x30, 0x6c, 0x0, 0x0,
-    0xf, 0x30, 0x6c, 0x0, 0x0, 0xf, 0x30, 0x6c,
-    0x0, 0x0, 0xf, 0x30, 0x6f, 0xee, 0xee, 0xef,
-    0x30, 0x6c, 0x11, 0x11, 0x1f, 0x30, 0x6c, 0x0,
-    0x0, 0xf, 0x30, 0x6c, 0x0, 0x0, 0xf, 0x30,
-    0x6c, 0x0, 0x0, 0xf, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0xd1, 0x0, 0x0, 0x0, 0x2, 0xd0,
-
-    /* U+04CB "Ӌ" */
-    0x1f, 0x10, 0x0, 0x0, 0x6c, 0x1f, 0x10, 0x0,
-    0x0, 0x6c, 0x1f, 0x10, 0x0, 0x0, 0x6c, 0x1f,
-    0x10, 0x0, 0x0, 0x6c, 0xf, 0x20, 0x0, 0x0,
-    0x6c, 0xe, 0x60, 0x0, 0x0, 0x6c, 0x6, 0xf5,
-    0x0, 0x16, 0xdc, 0x0, 0x7e, 0xff, 0xfb, 0xac,
-    0x0, 0x0, 0x11, 0x0, 0x6c, 0x0, 0x0, 0x0,
-    0x0, 0x6c, 0x0, 0x0, 0x0, 0x1, 0x7c, 0x0,
-    0x0, 0x0, 0x5f, 0xfc, 0x0, 0x0, 0x0, 0x5c,
-    0x0, 0x0, 0x0, 0x0, 0x5c, 0x0, 0x0, 0x0,
-    0x0, 0x26, 0x0,
-
-    /* U+04CC "ӌ" */
-    0x4d, 0x0, 0x0, 0x3f, 0x4d, 0x0, 0x0, 0x3f,
-    0x4d, 0x0, 0x0, 0x3f, 0x3e, 0x0, 0x0, 0x3f,
-    0xe, 0x91, 0x3, 0x9f, 0x2, 0xbf, 0xfc, 0x9f,
-    0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x0, 0x3f,
-    0x0, 0x0, 0xa, 0xff, 0x0, 0x0, 0xa, 0x60,
-    0x0, 0x0, 0xa, 0x60,
-
-    /* U+04CD "Ӎ" */
-    0x1f, 0x20, 0x0, 0x0, 0x0, 0xb, 0x80, 0x1,
-    0xfa, 0x0, 0x0, 0x0, 0x4, 0xf8, 0x0, 0x1f,
-    0xf3, 0x0, 0x0, 0x0, 0xce, 0x80, 0x1, 0xf7,
-    0xc0, 0x0, 0x0, 0x5d, 0x98, 0x0, 0x1f, 0xd,
-    0x50, 0x0, 0xd, 0x49, 0x80, 0x1, 0xf0, 0x5d,
-    0x0, 0x6, 0xb0, 0x98, 0x0, 0x1f, 0x0, 0xc6,
-    0x0, 0xe3, 0x9, 0x80, 0x1, 0xf0, 0x3, 0xe0,
-    0x8a, 0x0, 0x98, 0x0, 0x1f, 0x0, 0xa, 0x9e,
-    0x10, 0x9, 0x80, 0x1, 0xf0, 0x0, 0x2f, 0x80,
-    0x0, 0x98, 0x0, 0x1f, 0x0, 0x0, 0x50, 0x0,
-    0x9, 0x91, 0x1, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x51,
-    0x0,
-
-    /* U+04CE "ӎ" */
-    0x6f, 0x10, 0x0, 0x0, 0x5f, 0x0, 0x6f, 0x90,
-    0x0, 0x0, 0xdf, 0x0, 0x6b, 0xe2, 0x0, 0x6,
-    0xaf, 0x0, 0x6a, 0x6b, 0x0, 0x1e, 0x1f, 0x0,
-    0x6a, 0xd, 0x40, 0x87, 0xf, 0x0, 0x6a, 0x4,
-    0xc2, 0xd0, 0xf, 0x0, 0x6a, 0x0, 0xbe, 0x50,
-    0xf, 0x0, 0x6a, 0x0, 0x2b, 0x0, 0xf, 0x10,
-    0x6a, 0x0, 0x0, 0x0, 0xf, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xc0,
-
-    /* U+04CF "ӏ" */
-    0x36, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-
-    /* U+04D0 "Ӑ" */
-    0x0, 0x8, 0x70, 0x8, 0x70, 0x0, 0x0, 0x0,
-    0x9b, 0xb8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x4d, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0xb7, 0x99, 0x0, 0x0, 0x0, 0x2, 0xf1, 0x2f,
-    0x10, 0x0, 0x0, 0x8, 0x90, 0xb, 0x70, 0x0,
-    0x0, 0xf, 0x30, 0x4, 0xd0, 0x0, 0x0, 0x6c,
-    0x0, 0x0, 0xe4, 0x0, 0x0, 0xd5, 0x0, 0x0,
-    0x7b, 0x0, 0x4, 0xfe, 0xee, 0xee, 0xef, 0x20,
-    0xb, 0x81, 0x11, 0x11, 0x1a, 0x90, 0x2f, 0x10,
-    0x0, 0x0, 0x3, 0xf0, 0x8a, 0x0, 0x0, 0x0,
-    0x0, 0xc6,
-
-    /* U+04D1 "ӑ" */
-    0x0, 0x60, 0x0, 0x60, 0x0, 0xa5, 0x4, 0xb0,
-    0x0, 0x1a, 0xcb, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x9e, 0xfe, 0x80, 0xb, 0x82, 0x14, 0xe7,
-    0x0, 0x0, 0x0, 0x5d, 0x0, 0x0, 0x0, 0x3e,
-    0x2, 0xbe, 0xee, 0xee, 0xe, 0x70, 0x0, 0x3e,
-    0x2f, 0x0, 0x0, 0x4e, 0xe, 0x60, 0x3, 0xde,
-    0x2, 0xce, 0xdb, 0x4e,
-
-    /* U+04D2 "Ӓ" */
-    0x0, 0x0, 0x10, 0x1, 0x0, 0x0, 0x0, 0x1,
-    0xf2, 0x3f, 0x0, 0x0, 0x0, 0x0, 0x40, 0x3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x4d, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xb7, 0x99,
-    0x0, 0x0, 0x0, 0x2, 0xf1, 0x2f, 0x10, 0x0,
-    0x0, 0x8, 0x90, 0xb, 0x70, 0x0, 0x0, 0xf,
-    0x30, 0x4, 0xd0, 0x0, 0x0, 0x6c, 0x0, 0x0,
-    0xe4, 0x0, 0x0, 0xd5, 0x0, 0x0, 0x7b, 0x0,
-    0x4, 0xfe, 0xee, 0xee, 0xef, 0x20, 0xb, 0x81,
-    0x11, 0x11, 0x1a, 0x90, 0x2f, 0x10, 0x0, 0x0,
-    0x3, 0xf0, 0x8a, 0x0, 0x0, 0x0, 0x0, 0xc6,
-
-    /* U+04D3 "ӓ" */
-    0x0, 0x7a, 0x9, 0x80, 0x0, 0x24, 0x3, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x9e, 0xfe, 0x80,
-    0xb, 0x82, 0x14, 0xe7, 0x0, 0x0, 0x0, 0x5d,
-    0x0, 0x0, 0x0, 0x3e, 0x2, 0xbe, 0xee, 0xee,
-    0xe, 0x70, 0x0, 0x3e, 0x2f, 0x0, 0x0, 0x4e,
-    0xe, 0x60, 0x3, 0xde, 0x2, 0xce, 0xdb, 0x4e,
-
-    /* U+04D4 "Ӕ" */
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0xd9, 0xf1, 0x11, 0x11, 0x10,
-    0x0, 0x0, 0x7, 0xb3, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0x33, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x99, 0x3, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf1, 0x3, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0xb, 0x70, 0x3, 0xf2, 0x22, 0x22, 0x10,
-    0x0, 0x4e, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xee, 0xee, 0xf0, 0x0, 0x0, 0x0,
-    0x6, 0xc1, 0x11, 0x14, 0xf0, 0x0, 0x0, 0x0,
-    0x1e, 0x30, 0x0, 0x3, 0xf1, 0x11, 0x11, 0x11,
-    0x9a, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xfb,
-
-    /* U+04D5 "ӕ" */
-    0x2, 0x9e, 0xfe, 0x70, 0x3b, 0xff, 0xa1, 0x0,
-    0xb, 0x82, 0x14, 0xe9, 0xe7, 0x12, 0x8e, 0x10,
-    0x0, 0x0, 0x0, 0x5f, 0x60, 0x0, 0x9, 0x90,
-    0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x3, 0xe0,
-    0x2, 0xbe, 0xee, 0xef, 0xee, 0xee, 0xee, 0xf0,
-    0xe, 0x60, 0x0, 0x3f, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x0, 0x0, 0x6f, 0x60, 0x0, 0x0, 0x0,
-    0xe, 0x70, 0x4, 0xe6, 0xe6, 0x0, 0x2c, 0x30,
-    0x2, 0xbe, 0xec, 0x40, 0x3b, 0xef, 0xd6, 0x0,
-
-    /* U+04D6 "Ӗ" */
-    0x0, 0xc3, 0x0, 0xb3, 0x0, 0x2, 0xab, 0xb6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf9, 0x1f, 0x21, 0x11, 0x11, 0x1, 0xf1,
-    0x0, 0x0, 0x0, 0x1f, 0x10, 0x0, 0x0, 0x1,
-    0xf1, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfc,
-    0x1, 0xf3, 0x22, 0x22, 0x10, 0x1f, 0x10, 0x0,
-    0x0, 0x1, 0xf1, 0x0, 0x0, 0x0, 0x1f, 0x10,
-    0x0, 0x0, 0x1, 0xf2, 0x11, 0x11, 0x11, 0x1f,
-    0xff, 0xff, 0xff, 0xd0,
-
-    /* U+04D7 "ӗ" */
-    0x0, 0x32, 0x0, 0x42, 0x0, 0x4, 0xa0, 0xc,
-    0x10, 0x0, 0x7, 0xcc, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3b, 0xff, 0xa1, 0x0, 0x3e,
-    0x61, 0x18, 0xe1, 0xc, 0x60, 0x0, 0x9, 0x91,
-    0xf0, 0x0, 0x0, 0x3d, 0x3f, 0xdd, 0xdd, 0xdd,
-    0xe1, 0xf0, 0x0, 0x0, 0x0, 0xc, 0x70, 0x0,
-    0x0, 0x0, 0x3f, 0x82, 0x14, 0xd4, 0x0, 0x2a,
-    0xff, 0xd6, 0x0,
-
-    /* U+04D8 "Ә" */
-    0x0, 0x5, 0xbe, 0xfe, 0x92, 0x0, 0x0, 0xb,
-    0xe7, 0x32, 0x4a, 0xf6, 0x0, 0x0, 0x30, 0x0,
-    0x0, 0x5, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x4f,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x31, 0xf2, 0x0,
-    0x0, 0x0, 0x2, 0xf1, 0xc, 0x90, 0x0, 0x0,
-    0x0, 0x8c, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x4f,
-    0x30, 0x0, 0x5f, 0x93, 0x13, 0x9f, 0x50, 0x0,
-    0x0, 0x2a, 0xef, 0xe9, 0x20, 0x0,
-
-    /* U+04D9 "ә" */
-    0x0, 0x7d, 0xfe, 0xa1, 0x0, 0x5, 0xc3, 0x12,
-    0x9e, 0x10, 0x0, 0x0, 0x0, 0x9, 0xa0, 0x0,
-    0x0, 0x0, 0x2, 0xf0, 0x1e, 0xdd, 0xdd, 0xde,
-    0xf1, 0xf, 0x10, 0x0, 0x2, 0xf0, 0xb, 0x70,
-    0x0, 0x8, 0xa0, 0x2, 0xe6, 0x11, 0x7e, 0x20,
-    0x0, 0x2b, 0xff, 0xb2, 0x0,
-
-    /* U+04DA "Ӛ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xc0, 0x9a, 0x0, 0x0, 0x0, 0x0, 0x12,
-    0x1, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xbe, 0xfe, 0x92, 0x0,
-    0x0, 0xb, 0xe7, 0x32, 0x4a, 0xf6, 0x0, 0x0,
-    0x30, 0x0, 0x0, 0x5, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x4f, 0x0, 0x0, 0x0, 0x0, 0xf, 0x31,
-    0xf2, 0x0, 0x0, 0x0, 0x2, 0xf1, 0xc, 0x90,
-    0x0, 0x0, 0x0, 0x8c, 0x0, 0x3f, 0x50, 0x0,
-    0x0, 0x4f, 0x30, 0x0, 0x5f, 0x93, 0x13, 0x9f,
-    0x50, 0x0, 0x0, 0x2a, 0xef, 0xe9, 0x20, 0x0,
-
-    /* U+04DB "ӛ" */
-    0x0, 0x1e, 0x23, 0xe0, 0x0, 0x0, 0x6, 0x0,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7d, 0xfe, 0xa1, 0x0, 0x5, 0xc3, 0x12, 0x9e,
-    0x10, 0x0, 0x0, 0x0, 0x9, 0xa0, 0x0, 0x0,
-    0x0, 0x2, 0xf0, 0x1e, 0xdd, 0xdd, 0xde, 0xf1,
-    0xf, 0x10, 0x0, 0x2, 0xf0, 0xb, 0x70, 0x0,
-    0x8, 0xa0, 0x2, 0xe6, 0x11, 0x7e, 0x20, 0x0,
-    0x2b, 0xff, 0xb2, 0x0,
-
-    /* U+04DC "Ӝ" */
-    0x0, 0x0, 0x0, 0x10, 0x1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe4, 0x1f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x30, 0x4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0x40, 0x0, 0x7, 0xa0, 0x0, 0x2, 0xf3,
-    0x5, 0xd0, 0x0, 0x7, 0xa0, 0x0, 0xb, 0x80,
-    0x0, 0xb8, 0x0, 0x7, 0xa0, 0x0, 0x6d, 0x0,
-    0x0, 0x1e, 0x30, 0x7, 0xa0, 0x1, 0xe3, 0x0,
-    0x0, 0x6, 0xc0, 0x7, 0xa0, 0xa, 0x90, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x5, 0xe3, 0x28, 0xb2, 0x2d, 0x80, 0x0,
-    0x0, 0xe, 0x60, 0x7, 0xa0, 0x3, 0xf2, 0x0,
-    0x0, 0x8d, 0x0, 0x7, 0xa0, 0x0, 0xab, 0x0,
-    0x2, 0xf3, 0x0, 0x7, 0xa0, 0x0, 0x1f, 0x50,
-    0xb, 0xa0, 0x0, 0x7, 0xa0, 0x0, 0x7, 0xe0,
-    0x5f, 0x10, 0x0, 0x7, 0xa0, 0x0, 0x0, 0xd8,
-
-    /* U+04DD "ӝ" */
-    0x0, 0x0, 0x6b, 0x8, 0x90, 0x0, 0x0, 0x0,
-    0x2, 0x40, 0x33, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xe1, 0x0, 0xf, 0x20,
-    0x0, 0xd6, 0x8, 0xa0, 0x0, 0xf2, 0x0, 0x7c,
-    0x0, 0xe, 0x40, 0xf, 0x20, 0x1e, 0x20, 0x0,
-    0x5d, 0x0, 0xf2, 0xa, 0x80, 0x0, 0x0, 0xdf,
-    0xef, 0xfe, 0xf1, 0x0, 0x0, 0x6e, 0x21, 0xf4,
-    0x1c, 0x90, 0x0, 0x1f, 0x40, 0xf, 0x20, 0x2f,
-    0x40, 0xb, 0xa0, 0x0, 0xf2, 0x0, 0x6e, 0x6,
-    0xe1, 0x0, 0xf, 0x20, 0x0, 0xc9,
-
-    /* U+04DE "Ӟ" */
-    0x0, 0x1, 0x0, 0x10, 0x0, 0x0, 0xf, 0x32,
-    0xf1, 0x0, 0x0, 0x3, 0x0, 0x40, 0x0, 0x0,
-    0x4, 0x54, 0x0, 0x0, 0x9, 0xfe, 0xcd, 0xf6,
-    0x0, 0x7, 0x20, 0x0, 0x4f, 0x40, 0x0, 0x0,
-    0x0, 0xa, 0x90, 0x0, 0x0, 0x0, 0xa, 0x80,
-    0x0, 0x0, 0x0, 0x4e, 0x20, 0x0, 0x5e, 0xef,
-    0xf5, 0x0, 0x0, 0x1, 0x12, 0x5d, 0x60, 0x0,
-    0x0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x0, 0x1,
-    0xf1, 0x25, 0x0, 0x0, 0x9, 0xd0, 0x2d, 0xc8,
-    0x68, 0xde, 0x30, 0x0, 0x59, 0xba, 0x71, 0x0,
-
-    /* U+04DF "ӟ" */
-    0x0, 0x61, 0x6, 0x0, 0x0, 0xe4, 0x1e, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xdf, 0xfb, 0x30, 0x9, 0x41, 0x28, 0xf1,
-    0x0, 0x0, 0x0, 0xd5, 0x0, 0x0, 0x4, 0xe1,
-    0x0, 0x4e, 0xef, 0x50, 0x0, 0x0, 0x3, 0xe4,
-    0x0, 0x0, 0x0, 0xa8, 0x59, 0x31, 0x16, 0xf4,
-    0x8, 0xdf, 0xfb, 0x40,
-
-    /* U+04E0 "Ӡ" */
-    0x1f, 0xff, 0xff, 0xff, 0x70, 0x11, 0x11, 0x15,
-    0xd1, 0x0, 0x0, 0x2, 0xe2, 0x0, 0x0, 0x1,
-    0xd4, 0x0, 0x0, 0x0, 0xc7, 0x0, 0x0, 0x0,
-    0x4f, 0xfc, 0x50, 0x0, 0x0, 0x1, 0x6f, 0x50,
-    0x0, 0x0, 0x0, 0x6d, 0x0, 0x0, 0x0, 0x3,
-    0xf1, 0x20, 0x0, 0x0, 0x7c, 0x4f, 0x83, 0x12,
-    0x7f, 0x40, 0x3a, 0xef, 0xfb, 0x40,
-
-    /* U+04E1 "ӡ" */
-    0xf, 0xff, 0xff, 0xff, 0x20, 0x11, 0x11, 0x19,
-    0xb0, 0x0, 0x0, 0x4, 0xd1, 0x0, 0x0, 0x2,
-    0xe3, 0x0, 0x0, 0x0, 0xd6, 0x0, 0x0, 0x0,
-    0x5f, 0xeb, 0x20, 0x0, 0x0, 0x1, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0xb8, 0x0, 0x0, 0x0, 0x8,
-    0x90, 0x20, 0x0, 0x0, 0xc7, 0x2f, 0x83, 0x13,
-    0xae, 0x10, 0x2a, 0xef, 0xea, 0x20,
-
-    /* U+04E2 "Ӣ" */
-    0x0, 0xb, 0xcc, 0xcc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x10, 0x0, 0x0, 0x2f,
-    0x41, 0xf1, 0x0, 0x0, 0xd, 0xf4, 0x1f, 0x10,
-    0x0, 0x9, 0xce, 0x41, 0xf1, 0x0, 0x4, 0xf2,
-    0xe4, 0x1f, 0x10, 0x1, 0xe6, 0xe, 0x41, 0xf1,
-    0x0, 0xba, 0x0, 0xe4, 0x1f, 0x10, 0x7d, 0x0,
-    0xe, 0x41, 0xf1, 0x3f, 0x30, 0x0, 0xe4, 0x1f,
-    0x1d, 0x70, 0x0, 0xe, 0x41, 0xfa, 0xb0, 0x0,
-    0x0, 0xe4, 0x1f, 0xe1, 0x0, 0x0, 0xe, 0x41,
-    0xf5, 0x0, 0x0, 0x0, 0xe4,
-
-    /* U+04E3 "ӣ" */
-    0x0, 0xcc, 0xcc, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xc0, 0x0,
-    0x1, 0xe6, 0x6c, 0x0, 0x0, 0xcf, 0x66, 0xc0,
-    0x0, 0x9b, 0xc6, 0x6c, 0x0, 0x6d, 0x1c, 0x66,
-    0xc0, 0x3e, 0x20, 0xc6, 0x6c, 0x1e, 0x50, 0xc,
-    0x66, 0xcb, 0x90, 0x0, 0xc6, 0x6f, 0xc0, 0x0,
-    0xc, 0x66, 0xe1, 0x0, 0x0, 0xc6,
-
-    /* U+04E4 "Ӥ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7c,
-    0xa, 0x90, 0x0, 0x0, 0x1, 0x20, 0x21, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x10,
-    0x0, 0x0, 0x2f, 0x41, 0xf1, 0x0, 0x0, 0xd,
-    0xf4, 0x1f, 0x10, 0x0, 0x9, 0xce, 0x41, 0xf1,
-    0x0, 0x4, 0xf2, 0xe4, 0x1f, 0x10, 0x1, 0xe6,
-    0xe, 0x41, 0xf1, 0x0, 0xba, 0x0, 0xe4, 0x1f,
-    0x10, 0x7d, 0x0, 0xe, 0x41, 0xf1, 0x3f, 0x30,
-    0x0, 0xe4, 0x1f, 0x1d, 0x70, 0x0, 0xe, 0x41,
-    0xfa, 0xb0, 0x0, 0x0, 0xe4, 0x1f, 0xe1, 0x0,
-    0x0, 0xe, 0x41, 0xf5, 0x0, 0x0, 0x0, 0xe4,
-
-    /* U+04E5 "ӥ" */
-    0x0, 0x89, 0xb, 0x60, 0x0, 0x3, 0x30, 0x42,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xc0, 0x0,
-    0x1, 0xe6, 0x6c, 0x0, 0x0, 0xcf, 0x66, 0xc0,
-    0x0, 0x9b, 0xc6, 0x6c, 0x0, 0x6d, 0x1c, 0x66,
-    0xc0, 0x3e, 0x20, 0xc6, 0x6c, 0x1e, 0x50, 0xc,
-    0x66, 0xcb, 0x90, 0x0, 0xc6, 0x6f, 0xc0, 0x0,
-    0xc, 0x66, 0xe1, 0x0, 0x0, 0xc6,
-
-    /* U+04E6 "Ӧ" */
-    0x0, 0x0, 0x1, 0x0, 0x10, 0x0, 0x0, 0x0,
-    0x3, 0xf0, 0x6d, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x8d, 0xff, 0xc5, 0x0,
-    0x0, 0x3, 0xeb, 0x42, 0x27, 0xeb, 0x0, 0x1,
-    0xe7, 0x0, 0x0, 0x1, 0xda, 0x0, 0x9b, 0x0,
-    0x0, 0x0, 0x2, 0xf2, 0xe, 0x40, 0x0, 0x0,
-    0x0, 0xb, 0x71, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x8a, 0x1f, 0x10, 0x0, 0x0, 0x0, 0x8, 0xa0,
-    0xe4, 0x0, 0x0, 0x0, 0x0, 0xb7, 0x9, 0xb0,
-    0x0, 0x0, 0x0, 0x2f, 0x20, 0x1e, 0x70, 0x0,
-    0x0, 0x1d, 0xa0, 0x0, 0x3e, 0xb4, 0x22, 0x7e,
-    0xb0, 0x0, 0x0, 0x18, 0xdf, 0xfc, 0x50, 0x0,
-
-    /* U+04E7 "ӧ" */
-    0x0, 0xe, 0x31, 0xe1, 0x0, 0x0, 0x5, 0x10,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3b, 0xff, 0xc4, 0x0, 0x3, 0xf8, 0x21, 0x6f,
-    0x50, 0xc, 0x80, 0x0, 0x5, 0xe0, 0x1f, 0x10,
-    0x0, 0x0, 0xe4, 0x3f, 0x0, 0x0, 0x0, 0xc5,
-    0x1f, 0x10, 0x0, 0x0, 0xe4, 0xc, 0x80, 0x0,
-    0x5, 0xe0, 0x3, 0xf8, 0x21, 0x6f, 0x50, 0x0,
-    0x2b, 0xff, 0xc4, 0x0,
-
-    /* U+04E8 "Ө" */
-    0x0, 0x1, 0x8d, 0xff, 0xc5, 0x0, 0x0, 0x3,
-    0xea, 0x42, 0x26, 0xdb, 0x0, 0x1, 0xe5, 0x0,
-    0x0, 0x0, 0xba, 0x0, 0x99, 0x0, 0x0, 0x0,
-    0x1, 0xe3, 0xe, 0x30, 0x0, 0x0, 0x0, 0x9,
-    0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x1f,
-    0x30, 0x0, 0x0, 0x0, 0x9, 0xa0, 0xe6, 0x0,
-    0x0, 0x0, 0x0, 0xd8, 0x9, 0xd0, 0x0, 0x0,
-    0x0, 0x4f, 0x30, 0x1e, 0x90, 0x0, 0x0, 0x2e,
-    0xa0, 0x0, 0x3e, 0xc5, 0x23, 0x7e, 0xb0, 0x0,
-    0x0, 0x18, 0xdf, 0xfc, 0x50, 0x0,
-
-    /* U+04E9 "ө" */
-    0x0, 0x2a, 0xef, 0xc5, 0x0, 0x3, 0xe6, 0x0,
-    0x4d, 0x70, 0xc, 0x60, 0x0, 0x2, 0xf2, 0x1f,
-    0x0, 0x0, 0x0, 0xa6, 0x3f, 0xdd, 0xdd, 0xdd,
-    0xf8, 0x1f, 0x0, 0x0, 0x0, 0xa6, 0xc, 0x60,
-    0x0, 0x2, 0xf2, 0x3, 0xe6, 0x10, 0x4d, 0x70,
-    0x0, 0x2a, 0xff, 0xc5, 0x0,
-
-    /* U+04EA "Ӫ" */
-    0x0, 0x0, 0x1, 0x0, 0x10, 0x0, 0x0, 0x0,
-    0x3, 0xf0, 0x6d, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x8d, 0xff, 0xc5, 0x0,
-    0x0, 0x3, 0xea, 0x42, 0x26, 0xdb, 0x0, 0x1,
-    0xe5, 0x0, 0x0, 0x0, 0xba, 0x0, 0x99, 0x0,
-    0x0, 0x0, 0x1, 0xe3, 0xe, 0x30, 0x0, 0x0,
-    0x0, 0x9, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x1f, 0x30, 0x0, 0x0, 0x0, 0x9, 0xa0,
-    0xe6, 0x0, 0x0, 0x0, 0x0, 0xd8, 0x9, 0xd0,
-    0x0, 0x0, 0x0, 0x4f, 0x30, 0x1e, 0x90, 0x0,
-    0x0, 0x2e, 0xa0, 0x0, 0x3e, 0xc5, 0x23, 0x7e,
-    0xb0, 0x0, 0x0, 0x18, 0xdf, 0xfc, 0x50, 0x0,
-
-    /* U+04EB "ӫ" */
-    0x0, 0xd, 0x50, 0xe3, 0x0, 0x0, 0x5, 0x10,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2a, 0xef, 0xc5, 0x0, 0x3, 0xe6, 0x0, 0x4d,
-    0x70, 0xc, 0x60, 0x0, 0x2, 0xf2, 0x1f, 0x0,
-    0x0, 0x0, 0xa6, 0x3f, 0xdd, 0xdd, 0xdd, 0xf8,
-    0x1f, 0x0, 0x0, 0x0, 0xa6, 0xc, 0x60, 0x0,
-    0x2, 0xf2, 0x3, 0xe6, 0x10, 0x4d, 0x70, 0x0,
-    0x2a, 0xff, 0xc5, 0x0,
-
-    /* U+04EC "Ӭ" */
-    0x0, 0x1, 0x0, 0x10, 0x0, 0x0, 0x0, 0xf4,
-    0x1f, 0x10, 0x0, 0x0, 0x3, 0x0, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x9e,
-    0xff, 0xb4, 0x0, 0x2, 0xf9, 0x42, 0x38, 0xf8,
-    0x0, 0x3, 0x0, 0x0, 0x3, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x30, 0x0, 0x9e, 0xee, 0xee, 0xf5, 0x0,
-    0x1, 0x11, 0x11, 0x1e, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x7d, 0x0,
-    0x50, 0x0, 0x0, 0x3f, 0x50, 0x2e, 0xa4, 0x23,
-    0x8f, 0x80, 0x0, 0x19, 0xdf, 0xfb, 0x40, 0x0,
-
-    /* U+04ED "ӭ" */
-    0x0, 0xd4, 0xe, 0x20, 0x0, 0x5, 0x10, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0xff,
-    0xb3, 0x0, 0x4c, 0x30, 0x6, 0xe4, 0x0, 0x0,
-    0x0, 0x4, 0xe0, 0x0, 0x0, 0x0, 0xd, 0x40,
-    0x3, 0xee, 0xee, 0xf5, 0x0, 0x0, 0x0, 0xd,
-    0x40, 0x0, 0x0, 0x4, 0xe0, 0x4b, 0x40, 0x16,
-    0xe4, 0x0, 0x6c, 0xff, 0xb3, 0x0,
-
-    /* U+04EE "Ӯ" */
-    0x0, 0x1c, 0xcc, 0xca, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xd0, 0x0, 0x0, 0x0, 0xc6, 0xe, 0x50,
-    0x0, 0x0, 0x4e, 0x0, 0x6c, 0x0, 0x0, 0xc,
-    0x60, 0x0, 0xe4, 0x0, 0x4, 0xd0, 0x0, 0x6,
-    0xc0, 0x0, 0xc6, 0x0, 0x0, 0xe, 0x40, 0x4d,
-    0x0, 0x0, 0x0, 0x6c, 0xc, 0x50, 0x0, 0x0,
-    0x0, 0xe7, 0xd0, 0x0, 0x0, 0x0, 0x6, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x0,
-    0x11, 0x4e, 0x40, 0x0, 0x0, 0x6, 0xfe, 0x50,
-    0x0, 0x0, 0x0,
-
-    /* U+04EF "ӯ" */
-    0x0, 0x3c, 0xcc, 0xc8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0x80, 0x0, 0x0, 0x98, 0x3, 0xe0, 0x0, 0x0,
-    0xf2, 0x0, 0xd5, 0x0, 0x6, 0xb0, 0x0, 0x6c,
-    0x0, 0xd, 0x40, 0x0, 0xe, 0x30, 0x4d, 0x0,
-    0x0, 0x8, 0x90, 0xb6, 0x0, 0x0, 0x2, 0xf3,
-    0xe0, 0x0, 0x0, 0x0, 0xbe, 0x80, 0x0, 0x0,
-    0x0, 0x5f, 0x10, 0x0, 0x0, 0x0, 0x7a, 0x0,
-    0x0, 0x6, 0x13, 0xe3, 0x0, 0x0, 0x1b, 0xfe,
-    0x50, 0x0, 0x0,
-
-    /* U+04F0 "Ӱ" */
-    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0xb8,
-    0xd, 0x50, 0x0, 0x0, 0x2, 0x10, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0x0,
-    0x0, 0x0, 0xc, 0x60, 0xe5, 0x0, 0x0, 0x4,
-    0xe0, 0x6, 0xc0, 0x0, 0x0, 0xc6, 0x0, 0xe,
-    0x40, 0x0, 0x4d, 0x0, 0x0, 0x6c, 0x0, 0xc,
-    0x60, 0x0, 0x0, 0xe4, 0x4, 0xd0, 0x0, 0x0,
-    0x6, 0xc0, 0xc5, 0x0, 0x0, 0x0, 0xe, 0x7d,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x50, 0x0, 0x0,
-    0x0, 0x6, 0xc0, 0x0, 0x0, 0x1, 0x14, 0xe4,
-    0x0, 0x0, 0x0, 0x6f, 0xe5, 0x0, 0x0, 0x0,
-
-    /* U+04F1 "ӱ" */
-    0x0, 0xc, 0x50, 0xe3, 0x0, 0x0, 0x4, 0x20,
-    0x51, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0x80, 0x0, 0x0, 0x98, 0x3, 0xe0, 0x0, 0x0,
-    0xf2, 0x0, 0xd5, 0x0, 0x6, 0xb0, 0x0, 0x6c,
-    0x0, 0xd, 0x40, 0x0, 0xe, 0x30, 0x4d, 0x0,
-    0x0, 0x8, 0x90, 0xb6, 0x0, 0x0, 0x2, 0xf3,
-    0xe0, 0x0, 0x0, 0x0, 0xbe, 0x80, 0x0, 0x0,
-    0x0, 0x5f, 0x10, 0x0, 0x0, 0x0, 0x7a, 0x0,
-    0x0, 0x6, 0x13, 0xe3, 0x0, 0x0, 0x1b, 0xfe,
-    0x50, 0x0, 0x0,
-
-    /* U+04F2 "Ӳ" */
-    0x0, 0x0, 0x1, 0x0, 0x10, 0x0, 0x0, 0x6,
-    0xc0, 0xc6, 0x0, 0x0, 0x2, 0xd1, 0x89, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0x0,
-    0x0, 0x0, 0xc, 0x60, 0xe5, 0x0, 0x0, 0x4,
-    0xe0, 0x6, 0xc0, 0x0, 0x0, 0xc6, 0x0, 0xe,
-    0x40, 0x0, 0x4d, 0x0, 0x0, 0x6c, 0x0, 0xc,
-    0x60, 0x0, 0x0, 0xe4, 0x4, 0xd0, 0x0, 0x0,
-    0x6, 0xc0, 0xc5, 0x0, 0x0, 0x0, 0xe, 0x7d,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x50, 0x0, 0x0,
-    0x0, 0x6, 0xc0, 0x0, 0x0, 0x1, 0x14, 0xe4,
-    0x0, 0x0, 0x0, 0x6f, 0xe5, 0x0, 0x0, 0x0,
-
-    /* U+04F3 "ӳ" */
-    0x0, 0x0, 0x6c, 0xc, 0x60, 0x0, 0x2, 0xd1,
-    0x88, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0x80, 0x0, 0x0,
-    0x98, 0x3, 0xe0, 0x0, 0x0, 0xf2, 0x0, 0xd5,
-    0x0, 0x6, 0xb0, 0x0, 0x6c, 0x0, 0xd, 0x40,
-    0x0, 0xe, 0x30, 0x4d, 0x0, 0x0, 0x8, 0x90,
-    0xb6, 0x0, 0x0, 0x2, 0xf3, 0xe0, 0x0, 0x0,
-    0x0, 0xbe, 0x80, 0x0, 0x0, 0x0, 0x5f, 0x10,
-    0x0, 0x0, 0x0, 0x7a, 0x0, 0x0, 0x6, 0x13,
-    0xe3, 0x0, 0x0, 0x1b, 0xfe, 0x50, 0x0, 0x0,
-
-    /* U+04F4 "Ӵ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x90,
-    0xc6, 0x0, 0x0, 0x2, 0x10, 0x21, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x10, 0x0, 0x0,
-    0x5c, 0x1f, 0x10, 0x0, 0x0, 0x5c, 0x1f, 0x10,
-    0x0, 0x0, 0x5c, 0x1f, 0x10, 0x0, 0x0, 0x5c,
-    0xf, 0x20, 0x0, 0x0, 0x5c, 0xd, 0x70, 0x0,
-    0x0, 0x5c, 0x6, 0xf6, 0x0, 0x16, 0xdc, 0x0,
-    0x6e, 0xff, 0xfb, 0xac, 0x0, 0x0, 0x11, 0x0,
-    0x5c, 0x0, 0x0, 0x0, 0x0, 0x5c, 0x0, 0x0,
-    0x0, 0x0, 0x5c, 0x0, 0x0, 0x0, 0x0, 0x5c,
-
-    /* U+04F5 "ӵ" */
-    0x0, 0xa7, 0xd, 0x50, 0x0, 0x42, 0x5, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x4e, 0x0, 0x0, 0x2f,
-    0x4e, 0x0, 0x0, 0x2f, 0x4e, 0x0, 0x0, 0x2f,
-    0x3f, 0x0, 0x0, 0x2f, 0xe, 0x91, 0x2, 0x9f,
-    0x2, 0xbf, 0xfc, 0x9f, 0x0, 0x0, 0x0, 0x2f,
-    0x0, 0x0, 0x0, 0x2f, 0x0, 0x0, 0x0, 0x2f,
-
-    /* U+04F6 "Ӷ" */
-    0x1f, 0xff, 0xff, 0xff, 0x1, 0xf2, 0x11, 0x11,
-    0x10, 0x1f, 0x0, 0x0, 0x0, 0x1, 0xf0, 0x0,
-    0x0, 0x0, 0x1f, 0x0, 0x0, 0x0, 0x1, 0xf0,
-    0x0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x0, 0x1,
-    0xf1, 0x0, 0x0, 0x0, 0x1f, 0x10, 0x0, 0x0,
-    0x1, 0xf1, 0x0, 0x0, 0x0, 0x1f, 0x21, 0x0,
-    0x0, 0x3, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x4d,
-    0x0, 0x0, 0x0, 0x4, 0xd0, 0x0, 0x0, 0x0,
-    0x26, 0x0, 0x0, 0x0,
-
-    /* U+04F7 "ӷ" */
-    0x6f, 0xff, 0xff, 0x96, 0xc0, 0x0, 0x0, 0x6c,
-    0x0, 0x0, 0x6, 0xc0, 0x0, 0x0, 0x6c, 0x0,
-    0x0, 0x6, 0xc0, 0x0, 0x0, 0x6c, 0x0, 0x0,
-    0x6, 0xc0, 0x0, 0x0, 0x8f, 0xf1, 0x0, 0x0,
-    0xf, 0x10, 0x0, 0x0, 0xf1, 0x0, 0x0,
-
-    /* U+04F8 "Ӹ" */
-    0x0, 0x0, 0x1, 0x0, 0x10, 0x0, 0x0, 0x0,
-    0x3, 0xf0, 0x5e, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x10, 0x0, 0x0, 0x0, 0x6,
-    0xc1, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x6c, 0x1f,
-    0x10, 0x0, 0x0, 0x0, 0x6, 0xc1, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x6c, 0x1f, 0xee, 0xee, 0xd9,
-    0x10, 0x6, 0xc1, 0xf2, 0x11, 0x13, 0xbe, 0x10,
-    0x6c, 0x1f, 0x10, 0x0, 0x0, 0xd7, 0x6, 0xc1,
-    0xf1, 0x0, 0x0, 0x9, 0xa0, 0x6c, 0x1f, 0x10,
-    0x0, 0x0, 0x99, 0x6, 0xc1, 0xf1, 0x0, 0x0,
-    0xd, 0x60, 0x6c, 0x1f, 0x10, 0x0, 0x2a, 0xe0,
-    0x6, 0xc1, 0xff, 0xff, 0xfe, 0x91, 0x0, 0x6c,
-
-    /* U+04F9 "ӹ" */
-    0x0, 0x7, 0xa0, 0x98, 0x0, 0x0, 0x2, 0x40,
-    0x33, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c,
-    0x0, 0x0, 0x0, 0x3f, 0x6c, 0x0, 0x0, 0x0,
-    0x3f, 0x6c, 0x0, 0x0, 0x0, 0x3f, 0x6f, 0xee,
-    0xeb, 0x30, 0x3f, 0x6c, 0x0, 0x5, 0xf1, 0x3f,
-    0x6c, 0x0, 0x0, 0xc5, 0x3f, 0x6c, 0x0, 0x0,
-    0xd5, 0x3f, 0x6c, 0x0, 0x6, 0xf1, 0x3f, 0x6f,
-    0xee, 0xec, 0x30, 0x3f,
-
-    /* U+04FA "Ӻ" */
-    0x0, 0xbf, 0xff, 0xff, 0xf6, 0x0, 0xb7, 0x11,
-    0x11, 0x10, 0x0, 0xb7, 0x0, 0x0, 0x0, 0x0,
-    0xb7, 0x0, 0x0, 0x0, 0x0, 0xb7, 0x0, 0x0,
-    0x0, 0x0, 0xb7, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0xb7, 0x0, 0x0, 0x0,
-    0x0, 0xb7, 0x0, 0x0, 0x0, 0x0, 0xb7, 0x0,
-    0x0, 0x0, 0x0, 0xb8, 0x10, 0x0, 0x0, 0x0,
-    0xcf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xf1, 0x0,
-    0x0, 0x3, 0x6, 0xf0, 0x0, 0x0, 0xb, 0xfe,
-    0x40, 0x0, 0x0,
-
-    /* U+04FB "ӻ" */
-    0x1, 0xff, 0xff, 0xf4, 0x1, 0xf1, 0x0, 0x0,
-    0x1, 0xf1, 0x0, 0x0, 0x1, 0xf1, 0x0, 0x0,
-    0x5e, 0xfe, 0xee, 0x80, 0x1, 0xf1, 0x0, 0x0,
-    0x1, 0xf1, 0x0, 0x0, 0x1, 0xf2, 0x0, 0x0,
-    0x2, 0xff, 0x60, 0x0, 0x0, 0xb, 0x60, 0x0,
-    0x20, 0x2e, 0x40, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-
-    /* U+04FC "Ӽ" */
-    0x2f, 0x40, 0x0, 0x0, 0xc7, 0x6, 0xe1, 0x0,
-    0x7, 0xc0, 0x0, 0xba, 0x0, 0x2f, 0x20, 0x0,
-    0x1f, 0x50, 0xc7, 0x0, 0x0, 0x6, 0xe8, 0xc0,
-    0x0, 0x0, 0x0, 0xbf, 0x20, 0x0, 0x0, 0x0,
-    0xef, 0x70, 0x0, 0x0, 0xa, 0xb3, 0xf4, 0x0,
-    0x0, 0x4f, 0x10, 0x6e, 0x10, 0x1, 0xe5, 0x0,
-    0xa, 0xb0, 0xa, 0xb0, 0x0, 0x1, 0xf4, 0x5f,
-    0x10, 0x0, 0x0, 0x8b, 0x0, 0x0, 0x0, 0x0,
-    0x5e, 0x0, 0x0, 0x0, 0x21, 0xbb, 0x0, 0x0,
-    0x1, 0xdf, 0xc2,
-
-    /* U+04FD "ӽ" */
-    0x3f, 0x20, 0x0, 0xa9, 0x0, 0x7c, 0x0, 0x5d,
-    0x0, 0x0, 0xc8, 0x2e, 0x30, 0x0, 0x2, 0xed,
-    0x70, 0x0, 0x0, 0xa, 0xf2, 0x0, 0x0, 0x4,
-    0xe9, 0xc0, 0x0, 0x1, 0xe5, 0xa, 0x90, 0x0,
-    0xaa, 0x0, 0xd, 0x50, 0x6d, 0x0, 0x0, 0x4d,
-    0x0, 0x0, 0x0, 0x0, 0xf1, 0x0, 0x0, 0x20,
-    0x5f, 0x0, 0x0, 0xa, 0xfe, 0x50,
-
-    /* U+04FE "Ӿ" */
-    0xd, 0x80, 0x0, 0x0, 0xc8, 0x0, 0x2f, 0x30,
-    0x0, 0x8d, 0x0, 0x0, 0x7e, 0x10, 0x4f, 0x20,
-    0x0, 0x0, 0xba, 0x1e, 0x60, 0x0, 0x0, 0x1,
-    0xed, 0xb0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x1, 0xed, 0xb0, 0x0, 0x0, 0x0,
-    0xab, 0x1f, 0x60, 0x0, 0x0, 0x4f, 0x20, 0x6e,
-    0x10, 0x0, 0xd, 0x70, 0x0, 0xca, 0x0, 0x8,
-    0xd0, 0x0, 0x2, 0xf4, 0x3, 0xf3, 0x0, 0x0,
-    0x8, 0xd0,
-
-    /* U+04FF "ӿ" */
-    0x1e, 0x40, 0x0, 0x5d, 0x0, 0x4e, 0x10, 0x2e,
-    0x20, 0x0, 0x9b, 0xc, 0x60, 0x0, 0x0, 0xdc,
-    0xb0, 0x0, 0x7, 0xef, 0xfe, 0xe5, 0x0, 0x1,
-    0xea, 0xd0, 0x0, 0x0, 0xb9, 0xb, 0x90, 0x0,
-    0x7c, 0x0, 0x1e, 0x50, 0x3e, 0x20, 0x0, 0x4e,
-    0x20,
-
     /* U+2022 "•" */
     0x38, 0x1c, 0xf8, 0x8f, 0x40
 };
@@ -4806,228 +2440,7 @@ static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 12876, .adv_w = 167, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
     {.bitmap_index = 12951, .adv_w = 131, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
     {.bitmap_index = 13003, .adv_w = 76, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13049, .adv_w = 169, .box_w = 9, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13117, .adv_w = 169, .box_w = 9, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13189, .adv_w = 211, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 13274, .adv_w = 146, .box_w = 9, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13342, .adv_w = 181, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13408, .adv_w = 161, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13468, .adv_w = 79, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13486, .adv_w = 77, .box_w = 5, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13526, .adv_w = 135, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13568, .adv_w = 304, .box_w = 19, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13682, .adv_w = 303, .box_w = 18, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13790, .adv_w = 214, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13868, .adv_w = 180, .box_w = 10, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13943, .adv_w = 211, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14026, .adv_w = 174, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14109, .adv_w = 206, .box_w = 10, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 14184, .adv_w = 190, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14256, .adv_w = 186, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14316, .adv_w = 192, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14376, .adv_w = 146, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14430, .adv_w = 203, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 14528, .adv_w = 169, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14582, .adv_w = 259, .box_w = 16, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14678, .adv_w = 163, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14743, .adv_w = 211, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14809, .adv_w = 211, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14892, .adv_w = 180, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14952, .adv_w = 201, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15018, .adv_w = 247, .box_w = 13, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15096, .adv_w = 210, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15162, .adv_w = 218, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15240, .adv_w = 211, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15306, .adv_w = 182, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15366, .adv_w = 183, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15432, .adv_w = 151, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15492, .adv_w = 174, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15558, .adv_w = 235, .box_w = 14, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15642, .adv_w = 166, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15708, .adv_w = 212, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 15798, .adv_w = 187, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15858, .adv_w = 280, .box_w = 15, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15948, .adv_w = 286, .box_w = 17, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 16076, .adv_w = 210, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16154, .adv_w = 250, .box_w = 13, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16232, .adv_w = 182, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16292, .adv_w = 181, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16358, .adv_w = 280, .box_w = 16, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16454, .adv_w = 187, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16508, .adv_w = 149, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16544, .adv_w = 169, .box_w = 9, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16607, .adv_w = 156, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16643, .adv_w = 122, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16675, .adv_w = 167, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 16730, .adv_w = 158, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16771, .adv_w = 211, .box_w = 13, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16830, .adv_w = 137, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16866, .adv_w = 176, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16907, .adv_w = 176, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16966, .adv_w = 149, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17007, .adv_w = 162, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17048, .adv_w = 202, .box_w = 11, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17098, .adv_w = 173, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17139, .adv_w = 163, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17184, .adv_w = 173, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17225, .adv_w = 176, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 17285, .adv_w = 144, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17326, .adv_w = 121, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17362, .adv_w = 143, .box_w = 10, .box_h = 12, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 17422, .adv_w = 201, .box_w = 12, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 17518, .adv_w = 135, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17559, .adv_w = 175, .box_w = 10, .box_h = 11, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 17614, .adv_w = 153, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17650, .adv_w = 238, .box_w = 13, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17709, .adv_w = 238, .box_w = 14, .box_h = 11, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 17786, .adv_w = 159, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17831, .adv_w = 201, .box_w = 10, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17876, .adv_w = 144, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17912, .adv_w = 146, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17953, .adv_w = 221, .box_w = 13, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18012, .adv_w = 155, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18053, .adv_w = 160, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18112, .adv_w = 158, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18166, .adv_w = 172, .box_w = 11, .box_h = 16, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 18254, .adv_w = 122, .box_w = 7, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18300, .adv_w = 146, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18341, .adv_w = 135, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18377, .adv_w = 70, .box_w = 3, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18397, .adv_w = 69, .box_w = 4, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18421, .adv_w = 70, .box_w = 6, .box_h = 16, .ofs_x = -2, .ofs_y = -3},
-    {.bitmap_index = 18469, .adv_w = 236, .box_w = 15, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18537, .adv_w = 242, .box_w = 14, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18600, .adv_w = 172, .box_w = 11, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 18672, .adv_w = 149, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18731, .adv_w = 176, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18790, .adv_w = 143, .box_w = 10, .box_h = 16, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 18870, .adv_w = 164, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 18914, .adv_w = 205, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18999, .adv_w = 153, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19064, .adv_w = 226, .box_w = 14, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19148, .adv_w = 174, .box_w = 11, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19198, .adv_w = 218, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19276, .adv_w = 165, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19321, .adv_w = 191, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19399, .adv_w = 147, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19449, .adv_w = 217, .box_w = 12, .box_h = 18, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 19557, .adv_w = 181, .box_w = 10, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 19632, .adv_w = 188, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19710, .adv_w = 152, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19751, .adv_w = 187, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 19811, .adv_w = 178, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 19871, .adv_w = 147, .box_w = 9, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 19939, .adv_w = 115, .box_w = 7, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 19978, .adv_w = 156, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 20038, .adv_w = 129, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 20074, .adv_w = 179, .box_w = 10, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 20149, .adv_w = 152, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 20208, .adv_w = 269, .box_w = 17, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 20336, .adv_w = 221, .box_w = 14, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 20413, .adv_w = 163, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 20488, .adv_w = 137, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 20532, .adv_w = 191, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 20615, .adv_w = 149, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 20665, .adv_w = 186, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20731, .adv_w = 153, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20772, .adv_w = 185, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 20844, .adv_w = 149, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 20909, .adv_w = 208, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 20987, .adv_w = 165, .box_w = 11, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21037, .adv_w = 216, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 21135, .adv_w = 177, .box_w = 10, .box_h = 11, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 21190, .adv_w = 279, .box_w = 17, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 21292, .adv_w = 225, .box_w = 13, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 21351, .adv_w = 308, .box_w = 18, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 21486, .adv_w = 248, .box_w = 15, .box_h = 13, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 21584, .adv_w = 249, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 21675, .adv_w = 203, .box_w = 12, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21729, .adv_w = 183, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 21812, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 21862, .adv_w = 151, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 21937, .adv_w = 121, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 21981, .adv_w = 167, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 22047, .adv_w = 143, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 22101, .adv_w = 167, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 22167, .adv_w = 143, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 22221, .adv_w = 177, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 22304, .adv_w = 135, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 22354, .adv_w = 248, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 22474, .adv_w = 194, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 22540, .adv_w = 193, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 22630, .adv_w = 159, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 22685, .adv_w = 187, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 22745, .adv_w = 153, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 22781, .adv_w = 187, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 22841, .adv_w = 172, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 22900, .adv_w = 249, .box_w = 15, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 22990, .adv_w = 193, .box_w = 12, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 23044, .adv_w = 249, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 23157, .adv_w = 193, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 23223, .adv_w = 79, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 23241, .adv_w = 259, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 23361, .adv_w = 211, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 23446, .adv_w = 180, .box_w = 10, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 23521, .adv_w = 149, .box_w = 8, .box_h = 12, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 23569, .adv_w = 167, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 23624, .adv_w = 209, .box_w = 11, .box_h = 16, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 23712, .adv_w = 175, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 23766, .adv_w = 216, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 23856, .adv_w = 178, .box_w = 10, .box_h = 11, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 23911, .adv_w = 186, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 23986, .adv_w = 153, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 24030, .adv_w = 254, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 24143, .adv_w = 209, .box_w = 12, .box_h = 11, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 24209, .adv_w = 70, .box_w = 2, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 24222, .adv_w = 190, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 24312, .adv_w = 149, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 24364, .adv_w = 190, .box_w = 12, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 24460, .adv_w = 149, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 24508, .adv_w = 262, .box_w = 16, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 24604, .adv_w = 253, .box_w = 16, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 24676, .adv_w = 169, .box_w = 9, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 24744, .adv_w = 160, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 24803, .adv_w = 211, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 24881, .adv_w = 158, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 24926, .adv_w = 211, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 25030, .adv_w = 158, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 25090, .adv_w = 259, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 25218, .adv_w = 211, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 25296, .adv_w = 163, .box_w = 10, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 25376, .adv_w = 137, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 25428, .adv_w = 157, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 25482, .adv_w = 132, .box_w = 9, .box_h = 12, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 25536, .adv_w = 211, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 25613, .adv_w = 176, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 25667, .adv_w = 211, .box_w = 11, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 25755, .adv_w = 176, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 25809, .adv_w = 218, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 25913, .adv_w = 163, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 25973, .adv_w = 218, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 26051, .adv_w = 165, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 26096, .adv_w = 218, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 26200, .adv_w = 165, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 26260, .adv_w = 181, .box_w = 11, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 26348, .adv_w = 146, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 26402, .adv_w = 174, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 26485, .adv_w = 143, .box_w = 10, .box_h = 15, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 26560, .adv_w = 174, .box_w = 11, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 26648, .adv_w = 143, .box_w = 10, .box_h = 15, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 26723, .adv_w = 174, .box_w = 11, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 26811, .adv_w = 143, .box_w = 10, .box_h = 16, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 26891, .adv_w = 187, .box_w = 10, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 26971, .adv_w = 153, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 27019, .adv_w = 146, .box_w = 9, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 27087, .adv_w = 122, .box_w = 7, .box_h = 11, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 27126, .adv_w = 250, .box_w = 13, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 27230, .adv_w = 201, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 27290, .adv_w = 156, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 27365, .adv_w = 122, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 27413, .adv_w = 167, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 27488, .adv_w = 134, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 27542, .adv_w = 171, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 27608, .adv_w = 142, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 27649, .adv_w = 76, .box_w = 3, .box_h = 3, .ofs_x = 1, .ofs_y = 3}
+    {.bitmap_index = 13049, .adv_w = 76, .box_w = 3, .box_h = 3, .ofs_x = 1, .ofs_y = 3}
 };
 
 /*---------------------
@@ -5038,10 +2451,6 @@ static const uint16_t unicode_list_1[] = {
     0x0, 0x23, 0x43
 };
 
-static const uint16_t unicode_list_4[] = {
-    0x0, 0x1, 0x8, 0x9, 0x10, 0x11, 0x12, 0x13
-};
-
 /*Collect the unicode lists and glyph_id offsets*/
 static const lv_font_fmt_txt_cmap_t cmaps[] =
 {
@@ -5058,23 +2467,7 @@ static const lv_font_fmt_txt_cmap_t cmaps[] =
         .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
     },
     {
-        .range_start = 1024, .range_length = 96, .glyph_id_start = 227,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 1122, .range_length = 20, .glyph_id_start = 323,
-        .unicode_list = unicode_list_4, .glyph_id_ofs_list = NULL, .list_length = 8, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    },
-    {
-        .range_start = 1162, .range_length = 59, .glyph_id_start = 331,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 1222, .range_length = 58, .glyph_id_start = 390,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 8226, .range_length = 1, .glyph_id_start = 448,
+        .range_start = 8226, .range_length = 1, .glyph_id_start = 227,
         .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
     }
 };
@@ -5100,7 +2493,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmaps = cmaps,
     .kern_dsc = NULL,
     .kern_scale = 0,
-    .cmap_num = 8,
+    .cmap_num = 4,
     .bpp = 4,
     .kern_classes = 0,
     .bitmap_format = 0,
@@ -1,7 +1,7 @@
 /*******************************************************************************
  * Size: 24 px
  * Bpp: 4
- * Opts: --no-compress --bpp 4 --size 24 --font Montserrat-Medium-static.ttf --range 0x20-0x7F,0x100-0x17F,0x400-0x4FF --symbols °•ąćęłńóśźżĄĆĘŁŃÓŚŹŻ --format lvgl -o font_montserrat_int_24.c
+ * Opts: --no-compress --bpp 4 --size 24 --font Montserrat-Medium-static.ttf --range 0x20-0x7F,0x100-0x17F --symbols °•ąćęłńóśźżĄĆĘŁŃÓŚŹŻ --format lvgl -o font_montserrat_int_24.c
  ******************************************************************************/
 
 #ifdef LV_LVGL_H_INCLUDE_SIMPLE
@@ -3857,4269 +3857,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x1f, 0xa0,
     0x0, 0x0,
 
-    /* U+0400 "Ѐ" */
-    0x0, 0x7, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x2f,
-    0xd9, 0x99, 0x99, 0x99, 0x99, 0x32, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd8,
-    0x88, 0x88, 0x88, 0x82, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xd9, 0x99, 0x99, 0x99, 0x99,
-    0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-
-    /* U+0401 "Ё" */
-    0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x50, 0x2f, 0xa0, 0x0, 0x0, 0x5, 0xf5,
-    0x2, 0xe9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x2f,
-    0xd9, 0x99, 0x99, 0x99, 0x99, 0x32, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd8,
-    0x88, 0x88, 0x88, 0x82, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xd9, 0x99, 0x99, 0x99, 0x99,
-    0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-
-    /* U+0402 "Ђ" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x6, 0x99, 0x99, 0x9e, 0xf9, 0x99, 0x99,
-    0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x0, 0x2, 0x33,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf5, 0xbf,
-    0xff, 0xff, 0xd6, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xfd, 0x85, 0x45, 0x8e, 0xf9, 0x0, 0x0, 0x0,
-    0xc, 0xf3, 0x0, 0x0, 0x0, 0x1c, 0xf4, 0x0,
-    0x0, 0x0, 0xcf, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xa0, 0x0, 0x0, 0xc, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0x0, 0x0, 0x0, 0xcf, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0xc, 0xf0,
-    0x0, 0x0, 0x0, 0x3, 0xf9, 0x0, 0x0, 0x0,
-    0xcf, 0x0, 0x0, 0x0, 0x1, 0xdf, 0x30, 0x0,
-    0x0, 0xc, 0xf0, 0x0, 0x57, 0x79, 0xef, 0x80,
-    0x0, 0x0, 0x0, 0xcf, 0x0, 0xa, 0xff, 0xfc,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x10, 0x0, 0x0,
-
-    /* U+0403 "Ѓ" */
-    0x0, 0x0, 0x0, 0x4, 0x85, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x7, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x28, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x2f, 0xd9, 0x99, 0x99,
-    0x99, 0x94, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0404 "Є" */
-    0x0, 0x0, 0x5, 0xbe, 0xff, 0xda, 0x50, 0x0,
-    0x0, 0x3, 0xdf, 0xfc, 0xaa, 0xcf, 0xfd, 0x30,
-    0x0, 0x4f, 0xf8, 0x10, 0x0, 0x0, 0x6e, 0xd0,
-    0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x1, 0x20,
-    0xa, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xa8, 0x88, 0x88, 0x88, 0x70, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x8f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x4, 0x40,
-    0x0, 0x4f, 0xf8, 0x10, 0x0, 0x1, 0x8f, 0xd0,
-    0x0, 0x3, 0xdf, 0xfc, 0xaa, 0xcf, 0xfc, 0x20,
-    0x0, 0x0, 0x5, 0xbe, 0xff, 0xda, 0x40, 0x0,
-
-    /* U+0405 "Ѕ" */
-    0x0, 0x6, 0xbe, 0xff, 0xda, 0x50, 0x0, 0x1c,
-    0xfe, 0xa9, 0x9b, 0xff, 0xd0, 0xb, 0xf7, 0x0,
-    0x0, 0x0, 0x59, 0x2, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xfe,
-    0x95, 0x10, 0x0, 0x0, 0x0, 0x6, 0xbf, 0xff,
-    0xd8, 0x10, 0x0, 0x0, 0x0, 0x4, 0x8d, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xc1, 0x20, 0x0, 0x0,
-    0x0, 0x2, 0xfa, 0x8f, 0x81, 0x0, 0x0, 0x2,
-    0xdf, 0x31, 0xbf, 0xfc, 0x98, 0x9b, 0xff, 0x60,
-    0x0, 0x38, 0xcf, 0xff, 0xd9, 0x20, 0x0,
-
-    /* U+0406 "І" */
-    0x2f, 0x92, 0xf9, 0x2f, 0x92, 0xf9, 0x2f, 0x92,
-    0xf9, 0x2f, 0x92, 0xf9, 0x2f, 0x92, 0xf9, 0x2f,
-    0x92, 0xf9, 0x2f, 0x92, 0xf9, 0x2f, 0x92, 0xf9,
-    0x2f, 0x90,
-
-    /* U+0407 "Ї" */
-    0x1, 0x0, 0x0, 0x6, 0xf5, 0x2, 0xfa, 0x5f,
-    0x50, 0x1e, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf8, 0x0, 0x0, 0x4f, 0x80,
-    0x0, 0x4, 0xf8, 0x0, 0x0, 0x4f, 0x80, 0x0,
-    0x4, 0xf8, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x4,
-    0xf8, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x4, 0xf8,
-    0x0, 0x0, 0x4f, 0x80, 0x0, 0x4, 0xf8, 0x0,
-    0x0, 0x4f, 0x80, 0x0, 0x4, 0xf8, 0x0, 0x0,
-    0x4f, 0x80, 0x0, 0x4, 0xf8, 0x0, 0x0, 0x4f,
-    0x80, 0x0, 0x4, 0xf8, 0x0,
-
-    /* U+0408 "Ј" */
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0x10, 0x7, 0x99,
-    0x99, 0x9e, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x10, 0x0, 0x0, 0x0, 0xb, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x10, 0x0, 0x0, 0x0, 0xb,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x10, 0x0,
-    0x0, 0x0, 0xb, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x10, 0x0, 0x0, 0x0, 0xb, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x10, 0x0, 0x0, 0x0,
-    0xb, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x0,
-    0x40, 0x0, 0x0, 0xf, 0xe0, 0x4f, 0x90, 0x0,
-    0x8, 0xf9, 0x0, 0xaf, 0xea, 0x9c, 0xfd, 0x10,
-    0x0, 0x5c, 0xff, 0xe9, 0x10, 0x0,
-
-    /* U+0409 "Љ" */
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa9, 0x99, 0x99, 0x99, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x10,
-    0x0, 0x0, 0x0, 0xcf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0xcf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x22, 0x22,
-    0x22, 0x10, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xfe,
-    0x91, 0x0, 0x0, 0x0, 0xaf, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x55, 0x55, 0x55, 0x7c, 0xfe, 0x20,
-    0x0, 0x0, 0xbe, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xc0, 0x0, 0x0,
-    0xcd, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf2, 0x0, 0x0, 0xeb, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf5, 0x0, 0x0, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf6,
-    0x0, 0x3, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf4, 0x0, 0x8,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf1, 0x0, 0x2f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x0, 0x0, 0x0, 0x2,
-    0xcf, 0x90, 0x7b, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xbb, 0xbb, 0xbb, 0xdf, 0xfb, 0x0,
-    0xaf, 0xd6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xea, 0x50, 0x0,
-
-    /* U+040A "Њ" */
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x81, 0x0,
-    0x2f, 0xd9, 0x99, 0x99, 0x99, 0x99, 0xbf, 0xc9,
-    0x99, 0x99, 0xae, 0xfe, 0x30, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x0, 0x0,
-    0x7f, 0xe0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x80, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x80, 0x0,
-    0x0, 0x0, 0x5, 0xf6, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x80, 0x0, 0x0, 0x0, 0x5,
-    0xf6, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x80, 0x0, 0x0, 0x0, 0xa, 0xf3, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x0,
-    0x0, 0x6f, 0xc0, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xb7, 0x77, 0x77, 0x9d, 0xfd, 0x10,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xec, 0x70, 0x0,
-
-    /* U+040B "Ћ" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x6, 0x99, 0x99, 0x9e, 0xf9, 0x99, 0x99,
-    0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xe1, 0x6b,
-    0xef, 0xfd, 0x92, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xeb, 0x9a, 0xef, 0xf5, 0x0, 0x0, 0x0,
-    0xd, 0xf8, 0x20, 0x0, 0x0, 0x6f, 0xf2, 0x0,
-    0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x80, 0x0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0,
-    0x1, 0xfb, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0xd, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0xf, 0xc0, 0x0,
-    0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xc0,
-
-    /* U+040C "Ќ" */
-    0x0, 0x0, 0x0, 0x1, 0x77, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xde, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xdc, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x66, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xa0, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x2e, 0xd0, 0x2, 0xf9, 0x0, 0x0,
-    0x0, 0xc, 0xf2, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x9, 0xf5, 0x0, 0x2, 0xf9, 0x0, 0x0, 0x5,
-    0xf8, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x2, 0xfc,
-    0x0, 0x0, 0x2, 0xf9, 0x0, 0x0, 0xde, 0x10,
-    0x0, 0x0, 0x2f, 0xd9, 0x99, 0xcf, 0x30, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x2f, 0x90, 0x0, 0x4f, 0xc0, 0x0, 0x0,
-    0x2, 0xf9, 0x0, 0x0, 0x8f, 0x90, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x2,
-    0xf9, 0x0, 0x0, 0x1, 0xee, 0x10, 0x0, 0x2f,
-    0x90, 0x0, 0x0, 0x4, 0xfc, 0x0, 0x2, 0xf9,
-    0x0, 0x0, 0x0, 0x8, 0xf8, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0xc, 0xf4, 0x2, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xe1,
-
-    /* U+040D "Ѝ" */
-    0x0, 0x0, 0x68, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xcf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x47, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf2, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x5f, 0xbd, 0xf2, 0xf9, 0x0, 0x0, 0x0,
-    0x2f, 0xe1, 0xdf, 0x2f, 0x90, 0x0, 0x0, 0xd,
-    0xf3, 0xd, 0xf2, 0xf9, 0x0, 0x0, 0xa, 0xf7,
-    0x0, 0xdf, 0x2f, 0x90, 0x0, 0x6, 0xfb, 0x0,
-    0xd, 0xf2, 0xf9, 0x0, 0x3, 0xfd, 0x10, 0x0,
-    0xdf, 0x2f, 0x90, 0x0, 0xdf, 0x30, 0x0, 0xd,
-    0xf2, 0xf9, 0x0, 0xaf, 0x60, 0x0, 0x0, 0xdf,
-    0x2f, 0x90, 0x7f, 0xa0, 0x0, 0x0, 0xd, 0xf2,
-    0xf9, 0x3f, 0xd0, 0x0, 0x0, 0x0, 0xdf, 0x2f,
-    0xae, 0xf2, 0x0, 0x0, 0x0, 0xd, 0xf2, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x2f, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf2, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf,
-
-    /* U+040E "Ў" */
-    0x0, 0x0, 0xd8, 0x0, 0x0, 0x8d, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xe4, 0x0, 0x4e, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xef, 0xfe, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xc0, 0xb, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf3, 0x0, 0x3f, 0xa0, 0x0, 0x0,
-    0x0, 0x1, 0xfa, 0x0, 0x0, 0xbf, 0x20, 0x0,
-    0x0, 0x0, 0x9f, 0x20, 0x0, 0x2, 0xfa, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0xa, 0xf2,
-    0x0, 0x0, 0xa, 0xf1, 0x0, 0x0, 0x0, 0x2f,
-    0xa0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x30, 0x0, 0xbe, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfb, 0x0, 0x3f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf3, 0xc, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xb4, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xec, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8a, 0x9e, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xef, 0xc5, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+040F "Џ" */
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x72,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf7, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x72, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf7, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x72, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf7, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x72, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf7, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x72, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf7, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x72, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf7, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x72, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf7, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x72, 0xfd, 0x99, 0x99, 0x99, 0x99, 0x9a, 0xf7,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x2, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x70, 0x0, 0x0, 0x0,
-
-    /* U+0410 "А" */
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x9c, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x25,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfb,
-    0x0, 0xed, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf4, 0x0, 0x7f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xd0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x60, 0x0, 0x9, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0xce, 0x0, 0x0, 0x2, 0xfa, 0x0,
-    0x0, 0x0, 0x4, 0xf8, 0x0, 0x0, 0x0, 0xbf,
-    0x10, 0x0, 0x0, 0xb, 0xf3, 0x22, 0x22, 0x22,
-    0x6f, 0x80, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x9f, 0x65, 0x55,
-    0x55, 0x55, 0x58, 0xf7, 0x0, 0x1, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xed, 0x0, 0x8, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x50, 0xe,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xc0,
-    0x6f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf3,
-
-    /* U+0411 "Б" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x2,
-    0xfc, 0x88, 0x88, 0x88, 0x88, 0x88, 0x10, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xa2, 0x22,
-    0x22, 0x10, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x81, 0x0, 0x2f, 0xb5, 0x55, 0x55,
-    0x57, 0xdf, 0xd1, 0x2, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xa0, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x2, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf2, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x12, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xe0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0xa, 0xf7,
-    0x2, 0xfc, 0x77, 0x77, 0x77, 0xae, 0xf9, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xfd, 0xa4, 0x0, 0x0,
-
-    /* U+0412 "В" */
-    0x2f, 0xff, 0xff, 0xff, 0xfd, 0x93, 0x0, 0x2,
-    0xfc, 0x77, 0x77, 0x78, 0xbf, 0xf6, 0x0, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x2e, 0xf2, 0x2, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x70, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x4, 0xf8, 0x2, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x60, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0xc, 0xf1, 0x2, 0xf9, 0x11, 0x11,
-    0x12, 0x5c, 0xf5, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x2, 0xfb, 0x44, 0x44, 0x44,
-    0x59, 0xfe, 0x30, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x1, 0xee, 0x2, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf4, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x52, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf4, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x4, 0xfe,
-    0x2, 0xfc, 0x77, 0x77, 0x77, 0x8c, 0xff, 0x40,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x10, 0x0,
-
-    /* U+0413 "Г" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x2f, 0xd9,
-    0x99, 0x99, 0x99, 0x94, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0414 "Д" */
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0xa, 0xf9, 0x99, 0x99, 0x99,
-    0x9f, 0xc0, 0x0, 0x0, 0x0, 0xae, 0x0, 0x0,
-    0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0xb, 0xe0,
-    0x0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0,
-    0xbd, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0,
-    0x0, 0xc, 0xd0, 0x0, 0x0, 0x0, 0xf, 0xc0,
-    0x0, 0x0, 0x0, 0xdc, 0x0, 0x0, 0x0, 0x0,
-    0xfc, 0x0, 0x0, 0x0, 0xd, 0xb0, 0x0, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0xf,
-    0x90, 0x0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0,
-    0x2, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0,
-    0x0, 0x0, 0x4f, 0x40, 0x0, 0x0, 0x0, 0xf,
-    0xc0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0x0, 0x0, 0x0, 0xdd, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x6f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x6, 0xbf,
-    0xf8, 0x88, 0x88, 0x88, 0x88, 0x8f, 0xe8, 0x82,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x4b, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf4, 0xbe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x4b, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf4, 0x9c, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0x30,
-
-    /* U+0415 "Е" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0xfd,
-    0x99, 0x99, 0x99, 0x99, 0x93, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfd, 0x88,
-    0x88, 0x88, 0x88, 0x20, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x2, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfd, 0x99, 0x99, 0x99, 0x99, 0x96,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-
-    /* U+0416 "Ж" */
-    0xa, 0xf4, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x0, 0x1e, 0xd0, 0x1, 0xed, 0x0, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0xaf, 0x40,
-    0x0, 0x5f, 0x80, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x4, 0xf9, 0x0, 0x0, 0xa, 0xf3, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x1e, 0xe0, 0x0,
-    0x0, 0x1, 0xed, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x9f, 0x40, 0x0, 0x0, 0x0, 0x5f, 0x80,
-    0x0, 0xb, 0xf0, 0x0, 0x4, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf2, 0x0, 0xb, 0xf0, 0x0,
-    0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xed,
-    0x99, 0x9e, 0xf9, 0x99, 0xcf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7,
-    0x0, 0xb, 0xf0, 0x0, 0x3f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xc0, 0x0, 0xb, 0xf0, 0x0,
-    0x9, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x30,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0xef, 0x20, 0x0,
-    0x0, 0x8, 0xf8, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x4f, 0xc0, 0x0, 0x0, 0x3f, 0xd0, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0xa, 0xf7, 0x0,
-    0x0, 0xcf, 0x40, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x1, 0xef, 0x20, 0x7, 0xf9, 0x0, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x5f, 0xb0,
-    0x2f, 0xe1, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x0, 0xb, 0xf5,
-
-    /* U+0417 "З" */
-    0x0, 0x3, 0x8b, 0xcc, 0x95, 0x0, 0x0, 0x4,
-    0xdf, 0xff, 0xdd, 0xff, 0xe4, 0x0, 0x5, 0xe7,
-    0x20, 0x0, 0x6, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x80, 0x0, 0x0, 0x22, 0x22, 0x38, 0xfc, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x55, 0x55, 0x69, 0xfe, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1d, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfa, 0x5, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf5, 0xe, 0xe6, 0x0, 0x0, 0x3, 0xcf, 0xb0,
-    0x2, 0xbf, 0xfc, 0xab, 0xef, 0xf9, 0x0, 0x0,
-    0x2, 0x7a, 0xcc, 0xb7, 0x20, 0x0,
-
-    /* U+0418 "И" */
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf2,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf2, 0xf9,
-    0x0, 0x0, 0x0, 0x5, 0xfb, 0xdf, 0x2f, 0x90,
-    0x0, 0x0, 0x2, 0xfe, 0x1d, 0xf2, 0xf9, 0x0,
-    0x0, 0x0, 0xdf, 0x30, 0xdf, 0x2f, 0x90, 0x0,
-    0x0, 0xaf, 0x70, 0xd, 0xf2, 0xf9, 0x0, 0x0,
-    0x6f, 0xb0, 0x0, 0xdf, 0x2f, 0x90, 0x0, 0x3f,
-    0xd1, 0x0, 0xd, 0xf2, 0xf9, 0x0, 0xd, 0xf3,
-    0x0, 0x0, 0xdf, 0x2f, 0x90, 0xa, 0xf6, 0x0,
-    0x0, 0xd, 0xf2, 0xf9, 0x7, 0xfa, 0x0, 0x0,
-    0x0, 0xdf, 0x2f, 0x93, 0xfd, 0x0, 0x0, 0x0,
-    0xd, 0xf2, 0xfa, 0xef, 0x20, 0x0, 0x0, 0x0,
-    0xdf, 0x2f, 0xff, 0x50, 0x0, 0x0, 0x0, 0xd,
-    0xf2, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf0,
-
-    /* U+0419 "Й" */
-    0x0, 0x0, 0x82, 0x0, 0x0, 0x45, 0x0, 0x0,
-    0x0, 0xd, 0xb2, 0x0, 0x4e, 0x70, 0x0, 0x0,
-    0x0, 0x1a, 0xff, 0xfe, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf2, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x5f, 0xbd, 0xf2, 0xf9, 0x0, 0x0, 0x0,
-    0x2f, 0xe1, 0xdf, 0x2f, 0x90, 0x0, 0x0, 0xd,
-    0xf3, 0xd, 0xf2, 0xf9, 0x0, 0x0, 0xa, 0xf7,
-    0x0, 0xdf, 0x2f, 0x90, 0x0, 0x6, 0xfb, 0x0,
-    0xd, 0xf2, 0xf9, 0x0, 0x3, 0xfd, 0x10, 0x0,
-    0xdf, 0x2f, 0x90, 0x0, 0xdf, 0x30, 0x0, 0xd,
-    0xf2, 0xf9, 0x0, 0xaf, 0x60, 0x0, 0x0, 0xdf,
-    0x2f, 0x90, 0x7f, 0xa0, 0x0, 0x0, 0xd, 0xf2,
-    0xf9, 0x3f, 0xd0, 0x0, 0x0, 0x0, 0xdf, 0x2f,
-    0xae, 0xf2, 0x0, 0x0, 0x0, 0xd, 0xf2, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x2f, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf2, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf,
-
-    /* U+041A "К" */
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x2,
-    0xf9, 0x0, 0x0, 0x0, 0x2, 0xed, 0x0, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0xcf, 0x20, 0x2, 0xf9,
-    0x0, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x5f, 0x80, 0x0, 0x2, 0xf9, 0x0,
-    0x0, 0x2f, 0xc0, 0x0, 0x0, 0x2f, 0x90, 0x0,
-    0xd, 0xe1, 0x0, 0x0, 0x2, 0xfd, 0x99, 0x9c,
-    0xf3, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x2, 0xf9, 0x0, 0x4, 0xfc,
-    0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x8, 0xf9,
-    0x0, 0x0, 0x2, 0xf9, 0x0, 0x0, 0xb, 0xf5,
-    0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x1e, 0xe1,
-    0x0, 0x2, 0xf9, 0x0, 0x0, 0x0, 0x4f, 0xc0,
-    0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x8f, 0x80,
-    0x2, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x40,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x1, 0xee, 0x10,
-
-    /* U+041B "Л" */
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x7, 0xfa, 0x99, 0x99, 0x99, 0x9e,
-    0xf0, 0x0, 0x0, 0x7f, 0x10, 0x0, 0x0, 0x0,
-    0xcf, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0xc, 0xf0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0,
-    0x0, 0xc, 0xf0, 0x0, 0x0, 0x9f, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x0, 0x0, 0xa, 0xf0, 0x0,
-    0x0, 0x0, 0xc, 0xf0, 0x0, 0x0, 0xbe, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x0, 0x0, 0xc, 0xd0,
-    0x0, 0x0, 0x0, 0xc, 0xf0, 0x0, 0x0, 0xeb,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x0, 0x0, 0xf,
-    0x90, 0x0, 0x0, 0x0, 0xc, 0xf0, 0x0, 0x3,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x0, 0x0,
-    0x8f, 0x30, 0x0, 0x0, 0x0, 0xc, 0xf0, 0x0,
-    0x2f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x7,
-    0xbf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf0,
-    0xaf, 0xd6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x0,
-
-    /* U+041C "М" */
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x42, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf4, 0x2f, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0x42, 0xfd, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfd, 0xf4, 0x2f, 0x8c,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0x7f, 0x42,
-    0xf8, 0x3f, 0x70, 0x0, 0x0, 0x0, 0x5f, 0x46,
-    0xf4, 0x2f, 0x80, 0xaf, 0x10, 0x0, 0x0, 0xe,
-    0xb0, 0x6f, 0x42, 0xf8, 0x1, 0xfa, 0x0, 0x0,
-    0x8, 0xf2, 0x6, 0xf4, 0x2f, 0x80, 0x7, 0xf3,
-    0x0, 0x1, 0xf9, 0x0, 0x6f, 0x42, 0xf8, 0x0,
-    0xe, 0xc0, 0x0, 0xae, 0x10, 0x6, 0xf4, 0x2f,
-    0x80, 0x0, 0x5f, 0x60, 0x3f, 0x60, 0x0, 0x6f,
-    0x42, 0xf8, 0x0, 0x0, 0xce, 0x1c, 0xd0, 0x0,
-    0x6, 0xf4, 0x2f, 0x80, 0x0, 0x3, 0xfd, 0xf4,
-    0x0, 0x0, 0x6f, 0x42, 0xf8, 0x0, 0x0, 0x9,
-    0xfb, 0x0, 0x0, 0x6, 0xf4, 0x2f, 0x80, 0x0,
-    0x0, 0x1c, 0x20, 0x0, 0x0, 0x6f, 0x42, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf4,
-    0x2f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x40,
-
-    /* U+041D "Н" */
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe2,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xee, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe2, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xee, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xe2, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xee, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xe2, 0xfd, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0xfe, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe2, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xee, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xe2, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xee, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xe2, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xee, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xe2, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xee,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe0,
-
-    /* U+041E "О" */
-    0x0, 0x0, 0x4, 0xad, 0xff, 0xeb, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x2c, 0xff, 0xca, 0xab, 0xef,
-    0xe6, 0x0, 0x0, 0x0, 0x3f, 0xf9, 0x10, 0x0,
-    0x0, 0x5e, 0xf8, 0x0, 0x0, 0x1e, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x1c, 0xf6, 0x0, 0xa, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf1, 0x1,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x70, 0x6f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfc, 0x8, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf0, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x8, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf0, 0x6f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfc,
-    0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x70, 0xa, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xf1, 0x0, 0x1e, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x1c, 0xf6, 0x0, 0x0, 0x3f, 0xf9,
-    0x10, 0x0, 0x0, 0x5e, 0xf8, 0x0, 0x0, 0x0,
-    0x2c, 0xff, 0xca, 0x9b, 0xef, 0xe6, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xad, 0xff, 0xeb, 0x60, 0x0,
-    0x0, 0x0,
-
-    /* U+041F "П" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0xfd, 0x99, 0x99, 0x99, 0x99, 0x99, 0xef, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf2, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf2, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf2, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf2, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf2, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf2, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf2, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf0,
-
-    /* U+0420 "Р" */
-    0x2f, 0xff, 0xff, 0xff, 0xeb, 0x60, 0x0, 0x2f,
-    0xd9, 0x99, 0x99, 0xbe, 0xfd, 0x30, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x6f, 0xe1, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x6, 0xf8, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xfd, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x1, 0xfc,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0xb, 0xf5, 0x2f,
-    0x90, 0x0, 0x0, 0x15, 0xcf, 0xa0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x2f, 0xd9, 0x99,
-    0x99, 0x85, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0421 "С" */
-    0x0, 0x0, 0x4, 0xad, 0xff, 0xeb, 0x60, 0x0,
-    0x0, 0x2, 0xcf, 0xfd, 0xa9, 0xbe, 0xfe, 0x50,
-    0x0, 0x3f, 0xf9, 0x20, 0x0, 0x0, 0x5e, 0xf1,
-    0x1, 0xef, 0x50, 0x0, 0x0, 0x0, 0x1, 0x40,
-    0xa, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0x50, 0x0, 0x0, 0x0, 0x1, 0x40,
-    0x0, 0x3f, 0xf9, 0x10, 0x0, 0x0, 0x5e, 0xf1,
-    0x0, 0x2, 0xcf, 0xfc, 0xa9, 0xbe, 0xfe, 0x40,
-    0x0, 0x0, 0x4, 0xad, 0xff, 0xeb, 0x60, 0x0,
-
-    /* U+0422 "Т" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x69,
-    0x99, 0x99, 0xef, 0x99, 0x99, 0x97, 0x0, 0x0,
-    0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0,
-
-    /* U+0423 "У" */
-    0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfc,
-    0x0, 0xbf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x30, 0x3, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xa0, 0x0, 0xb, 0xf2, 0x0, 0x0, 0x0, 0x9,
-    0xf2, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x2,
-    0xf9, 0x0, 0x0, 0x0, 0xaf, 0x20, 0x0, 0x0,
-    0xaf, 0x10, 0x0, 0x0, 0x2, 0xfa, 0x0, 0x0,
-    0x3f, 0x80, 0x0, 0x0, 0x0, 0x9, 0xf3, 0x0,
-    0xb, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xb0,
-    0x3, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x30, 0xcd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfb, 0x4f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfe, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xa9, 0xef, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xae, 0xfc, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0424 "Ф" */
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x38, 0xcf, 0xff, 0xff, 0xfc, 0x83, 0x0, 0x0,
-    0x0, 0x1b, 0xff, 0xb8, 0x6e, 0xe5, 0x7b, 0xff,
-    0xb1, 0x0, 0x2, 0xef, 0x81, 0x0, 0xd, 0xd0,
-    0x0, 0x8, 0xfe, 0x20, 0xd, 0xf4, 0x0, 0x0,
-    0xd, 0xd0, 0x0, 0x0, 0x4f, 0xd0, 0x5f, 0x80,
-    0x0, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x8, 0xf5,
-    0xaf, 0x20, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x0,
-    0x1, 0xfa, 0xcf, 0x0, 0x0, 0x0, 0xd, 0xd0,
-    0x0, 0x0, 0x0, 0xec, 0xce, 0x0, 0x0, 0x0,
-    0xd, 0xd0, 0x0, 0x0, 0x0, 0xec, 0xaf, 0x10,
-    0x0, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x1, 0xfa,
-    0x6f, 0x70, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x0,
-    0x6, 0xf6, 0xe, 0xf2, 0x0, 0x0, 0xd, 0xd0,
-    0x0, 0x0, 0x2e, 0xe0, 0x3, 0xfe, 0x50, 0x0,
-    0xd, 0xd0, 0x0, 0x5, 0xef, 0x40, 0x0, 0x3d,
-    0xfd, 0x85, 0x3d, 0xd3, 0x48, 0xdf, 0xd3, 0x0,
-    0x0, 0x0, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xb6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x3e, 0xe3,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x30, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0425 "Х" */
-    0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x40,
-    0x1, 0xef, 0x20, 0x0, 0x0, 0x8, 0xf8, 0x0,
-    0x0, 0x4f, 0xc0, 0x0, 0x0, 0x3f, 0xd0, 0x0,
-    0x0, 0x9, 0xf7, 0x0, 0x0, 0xef, 0x20, 0x0,
-    0x0, 0x0, 0xdf, 0x30, 0xa, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xd0, 0x5f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfa, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfe, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf3, 0xaf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x70, 0xd, 0xf3, 0x0, 0x0,
-    0x0, 0x4, 0xfc, 0x0, 0x3, 0xfd, 0x0, 0x0,
-    0x0, 0x1e, 0xf2, 0x0, 0x0, 0x8f, 0x90, 0x0,
-    0x0, 0xbf, 0x50, 0x0, 0x0, 0xc, 0xf5, 0x0,
-    0x6, 0xfa, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x10,
-    0x2f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0,
-
-    /* U+0426 "Ц" */
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x70,
-    0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x70, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x70, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x70, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x70, 0x0, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x70, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x70, 0x0, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x70, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x70,
-    0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x70, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x70, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x70, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x70, 0x0, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x70, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x70, 0x0, 0x2f,
-    0xd9, 0x99, 0x99, 0x99, 0x99, 0xaf, 0xc9, 0x91,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf2,
-
-    /* U+0427 "Ч" */
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0x0, 0xfb, 0x9f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0xfb, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xfb, 0x9f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xfb, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xfb, 0x9f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0xfb, 0x8f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0xfb, 0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xfb,
-    0xc, 0xf9, 0x10, 0x0, 0x0, 0x39, 0xfb, 0x2,
-    0xdf, 0xfb, 0x9a, 0xbe, 0xff, 0xfb, 0x0, 0x7,
-    0xce, 0xff, 0xda, 0x51, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfb,
-
-    /* U+0428 "Ш" */
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0,
-    0x0, 0x5, 0xf6, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0xbf, 0x0, 0x0, 0x0, 0x5, 0xf6, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x5,
-    0xf6, 0x2f, 0x90, 0x0, 0x0, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0x5, 0xf6, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0xbf, 0x0, 0x0, 0x0, 0x5, 0xf6, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0x5, 0xf6, 0x2f, 0x90, 0x0, 0x0, 0x0, 0xbf,
-    0x0, 0x0, 0x0, 0x5, 0xf6, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x5, 0xf6,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0,
-    0x0, 0x5, 0xf6, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0xbf, 0x0, 0x0, 0x0, 0x5, 0xf6, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x5,
-    0xf6, 0x2f, 0x90, 0x0, 0x0, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0x5, 0xf6, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0xbf, 0x0, 0x0, 0x0, 0x5, 0xf6, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0x5, 0xf6, 0x2f, 0x90, 0x0, 0x0, 0x0, 0xbf,
-    0x0, 0x0, 0x0, 0x5, 0xf6, 0x2f, 0xd9, 0x99,
-    0x99, 0x99, 0xef, 0x99, 0x99, 0x99, 0x9b, 0xf6,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6,
-
-    /* U+0429 "Щ" */
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0,
-    0x0, 0x5, 0xf6, 0x0, 0x2, 0xf9, 0x0, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x5f, 0x60,
-    0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0x5, 0xf6, 0x0, 0x2, 0xf9, 0x0,
-    0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x5f,
-    0x60, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0xbf,
-    0x0, 0x0, 0x0, 0x5, 0xf6, 0x0, 0x2, 0xf9,
-    0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0xbf, 0x0, 0x0, 0x0, 0x5, 0xf6, 0x0, 0x2,
-    0xf9, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0,
-    0x0, 0x5f, 0x60, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0xbf, 0x0, 0x0, 0x0, 0x5, 0xf6, 0x0,
-    0x2, 0xf9, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x0, 0x5f, 0x60, 0x0, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x5, 0xf6,
-    0x0, 0x2, 0xf9, 0x0, 0x0, 0x0, 0xb, 0xf0,
-    0x0, 0x0, 0x0, 0x5f, 0x60, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x5,
-    0xf6, 0x0, 0x2, 0xf9, 0x0, 0x0, 0x0, 0xb,
-    0xf0, 0x0, 0x0, 0x0, 0x5f, 0x60, 0x0, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0x5, 0xf6, 0x0, 0x2, 0xfd, 0x99, 0x99, 0x99,
-    0x9e, 0xf9, 0x99, 0x99, 0x99, 0xbf, 0xc9, 0x90,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x0,
-
-    /* U+042A "Ъ" */
-    0xbf, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0x99, 0x99, 0xcf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x52, 0x22, 0x22, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x20, 0x0, 0x0, 0x0, 0x8f, 0x75, 0x55,
-    0x55, 0x7b, 0xff, 0x50, 0x0, 0x0, 0x8, 0xf4,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x10, 0x0, 0x0,
-    0x8f, 0x40, 0x0, 0x0, 0x0, 0x7, 0xf6, 0x0,
-    0x0, 0x8, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x90, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x0,
-    0x2, 0xf9, 0x0, 0x0, 0x8, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x80, 0x0, 0x0, 0x8f, 0x40,
-    0x0, 0x0, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x8,
-    0xf4, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x0, 0x0,
-    0x0, 0x8f, 0x97, 0x77, 0x77, 0x9d, 0xfd, 0x10,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xfe, 0xb6,
-    0x0, 0x0,
-
-    /* U+042B "Ы" */
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xa2, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfa, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xa2, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfa, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xa2,
-    0xfa, 0x22, 0x22, 0x21, 0x0, 0x0, 0x0, 0x1,
-    0xfa, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xc5, 0x0,
-    0x0, 0x1f, 0xa2, 0xfb, 0x55, 0x55, 0x56, 0x9e,
-    0xfa, 0x0, 0x1, 0xfa, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x1c, 0xf6, 0x0, 0x1f, 0xa2, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xc0, 0x1, 0xfa, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x1f,
-    0xa2, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf0,
-    0x1, 0xfa, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xee, 0x0, 0x1f, 0xa2, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xa0, 0x1, 0xfa, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x3e, 0xf3, 0x0, 0x1f, 0xa2, 0xfc,
-    0x77, 0x77, 0x78, 0xbf, 0xf5, 0x0, 0x1, 0xfa,
-    0x2f, 0xff, 0xff, 0xff, 0xfd, 0x82, 0x0, 0x0,
-    0x1f, 0xa0,
-
-    /* U+042C "Ь" */
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xa2, 0x22, 0x22, 0x10,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xc5,
-    0x0, 0x2f, 0xb5, 0x55, 0x55, 0x69, 0xef, 0xa0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x1c, 0xf6, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x2, 0xfc, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xde, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xee, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x4, 0xfa, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x3e,
-    0xf3, 0x2f, 0xc7, 0x77, 0x77, 0x8b, 0xff, 0x50,
-    0x2f, 0xff, 0xff, 0xff, 0xfd, 0x82, 0x0,
-
-    /* U+042D "Э" */
-    0x0, 0x5, 0xad, 0xff, 0xea, 0x50, 0x0, 0x0,
-    0x3, 0xdf, 0xfc, 0xaa, 0xcf, 0xfd, 0x30, 0x0,
-    0xe, 0xf7, 0x0, 0x0, 0x1, 0x8f, 0xf3, 0x0,
-    0x3, 0x20, 0x0, 0x0, 0x0, 0x4, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf5,
-    0x0, 0x0, 0x7, 0x88, 0x88, 0x88, 0x8a, 0xf7,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x90,
-    0x3, 0x20, 0x0, 0x0, 0x0, 0x4, 0xfe, 0x10,
-    0xe, 0xf7, 0x0, 0x0, 0x1, 0x8f, 0xf3, 0x0,
-    0x2, 0xdf, 0xfc, 0xaa, 0xcf, 0xfd, 0x30, 0x0,
-    0x0, 0x5, 0xad, 0xff, 0xeb, 0x50, 0x0, 0x0,
-
-    /* U+042E "Ю" */
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x18, 0xcf, 0xfe,
-    0xc7, 0x10, 0x0, 0x2, 0xf9, 0x0, 0x0, 0x0,
-    0x7f, 0xfc, 0x87, 0x9c, 0xfe, 0x50, 0x0, 0x2f,
-    0x90, 0x0, 0x0, 0xaf, 0xb2, 0x0, 0x0, 0x3,
-    0xdf, 0x70, 0x2, 0xf9, 0x0, 0x0, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x40, 0x2f, 0x90,
-    0x0, 0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfd, 0x2, 0xf9, 0x0, 0x7, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf4, 0x2f, 0x90, 0x0,
-    0xcf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x92, 0xfd, 0xaa, 0xaf, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfb, 0x2f, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xc2,
-    0xf9, 0x0, 0xe, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfb, 0x2f, 0x90, 0x0, 0xcf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x92, 0xf9,
-    0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf4, 0x2f, 0x90, 0x0, 0x1f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfd, 0x2, 0xf9, 0x0,
-    0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x40, 0x2f, 0x90, 0x0, 0x0, 0xaf, 0xb2, 0x0,
-    0x0, 0x3, 0xdf, 0x70, 0x2, 0xf9, 0x0, 0x0,
-    0x0, 0x7f, 0xfb, 0x87, 0x9c, 0xfe, 0x50, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x18, 0xcf, 0xfe,
-    0xc7, 0x10, 0x0, 0x0,
-
-    /* U+042F "Я" */
-    0x0, 0x2, 0x9d, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x7f, 0xfc, 0x99, 0x99, 0x99, 0xfb, 0x6, 0xfd,
-    0x20, 0x0, 0x0, 0x0, 0xfb, 0xe, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0xfb, 0x4f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xfb, 0x6f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0xfb, 0x6f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0xfb, 0x4f, 0x80, 0x0, 0x0, 0x0, 0x0, 0xfb,
-    0xf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xfb, 0x7,
-    0xfb, 0x10, 0x0, 0x0, 0x0, 0xfb, 0x0, 0x9f,
-    0xfb, 0x98, 0x88, 0x88, 0xfb, 0x0, 0x4, 0xef,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x3, 0xf9, 0x0,
-    0x0, 0x0, 0xfb, 0x0, 0xe, 0xd0, 0x0, 0x0,
-    0x0, 0xfb, 0x0, 0xaf, 0x30, 0x0, 0x0, 0x0,
-    0xfb, 0x5, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xfb,
-    0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xfb,
-
-    /* U+0430 "а" */
-    0x0, 0x5b, 0xef, 0xfc, 0x70, 0x2, 0xdf, 0xea,
-    0x89, 0xef, 0xb0, 0xd, 0x50, 0x0, 0x0, 0xaf,
-    0x60, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x2, 0xae, 0xff, 0xff, 0xff, 0xe2, 0xfe,
-    0x74, 0x33, 0x33, 0xde, 0x9f, 0x30, 0x0, 0x0,
-    0xd, 0xeb, 0xf0, 0x0, 0x0, 0x0, 0xfe, 0x8f,
-    0x40, 0x0, 0x0, 0xaf, 0xe1, 0xdf, 0x84, 0x46,
-    0xdc, 0xce, 0x1, 0x8d, 0xff, 0xd7, 0xc, 0xe0,
-
-    /* U+0431 "б" */
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x7b, 0xb0, 0x0,
-    0x0, 0x2, 0x7b, 0xff, 0xff, 0xb0, 0x0, 0x1,
-    0xaf, 0xfe, 0xb7, 0x30, 0x0, 0x0, 0x2e, 0xfa,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xe0, 0x3, 0x78, 0x73, 0x0,
-    0x0, 0x1f, 0x91, 0xbf, 0xff, 0xff, 0xd3, 0x0,
-    0x4f, 0x7d, 0xd5, 0x10, 0x28, 0xff, 0x30, 0x5f,
-    0xec, 0x0, 0x0, 0x0, 0x5f, 0xd0, 0x5f, 0xf2,
-    0x0, 0x0, 0x0, 0xa, 0xf4, 0x5f, 0xc0, 0x0,
-    0x0, 0x0, 0x4, 0xf7, 0x4f, 0xb0, 0x0, 0x0,
-    0x0, 0x2, 0xf9, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x3, 0xf8, 0xd, 0xf0, 0x0, 0x0, 0x0, 0x7,
-    0xf5, 0x7, 0xf7, 0x0, 0x0, 0x0, 0xe, 0xf0,
-    0x0, 0xef, 0x60, 0x0, 0x1, 0xbf, 0x60, 0x0,
-    0x2e, 0xfc, 0x87, 0x9f, 0xf7, 0x0, 0x0, 0x1,
-    0x8d, 0xff, 0xd9, 0x30, 0x0,
-
-    /* U+0432 "в" */
-    0x9f, 0xff, 0xff, 0xfd, 0x91, 0x0, 0x9f, 0x65,
-    0x55, 0x69, 0xfe, 0x10, 0x9f, 0x10, 0x0, 0x0,
-    0x6f, 0x70, 0x9f, 0x10, 0x0, 0x0, 0x2f, 0x90,
-    0x9f, 0x10, 0x0, 0x0, 0x4f, 0x60, 0x9f, 0x10,
-    0x0, 0x15, 0xec, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xe3, 0x0, 0x9f, 0x43, 0x33, 0x35, 0xbf, 0x50,
-    0x9f, 0x10, 0x0, 0x0, 0xd, 0xe0, 0x9f, 0x10,
-    0x0, 0x0, 0xa, 0xf0, 0x9f, 0x10, 0x0, 0x0,
-    0xe, 0xe0, 0x9f, 0x66, 0x66, 0x68, 0xdf, 0x60,
-    0x9f, 0xff, 0xff, 0xfe, 0xb4, 0x0,
-
-    /* U+0433 "г" */
-    0x9f, 0xff, 0xff, 0xff, 0xf5, 0x9f, 0x98, 0x88,
-    0x88, 0x82, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x9f,
-    0x20, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0,
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0,
-    0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x9f,
-    0x20, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0,
-    0x0,
-
-    /* U+0434 "д" */
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x9f, 0x88, 0x88, 0x88, 0xfc, 0x0, 0x0,
-    0xa, 0xf0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0,
-    0xbe, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0xb,
-    0xd0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0xcc,
-    0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0xd, 0xb0,
-    0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0xfa, 0x0,
-    0x0, 0x0, 0xfc, 0x0, 0x0, 0x1f, 0x70, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x5, 0xf4, 0x0, 0x0,
-    0x0, 0xfc, 0x0, 0x0, 0xce, 0x0, 0x0, 0x0,
-    0xf, 0xc0, 0x6, 0xbf, 0xb8, 0x88, 0x88, 0x88,
-    0xfe, 0x85, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xbc, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xeb, 0xcd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xbc, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xeb,
-
-    /* U+0435 "е" */
-    0x0, 0x4, 0xbe, 0xfe, 0xa2, 0x0, 0x0, 0xa,
-    0xfe, 0x98, 0xaf, 0xf6, 0x0, 0x9, 0xf8, 0x0,
-    0x0, 0x1c, 0xf3, 0x2, 0xfa, 0x0, 0x0, 0x0,
-    0x1e, 0xc0, 0x8f, 0x20, 0x0, 0x0, 0x0, 0x7f,
-    0x2b, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xf6, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xf3, 0x33,
-    0x33, 0x33, 0x33, 0x31, 0x8f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfb, 0x10, 0x0, 0x2, 0xd5, 0x0,
-    0x8, 0xff, 0xb9, 0x9c, 0xfe, 0x30, 0x0, 0x3,
-    0xae, 0xff, 0xc7, 0x10, 0x0,
-
-    /* U+0436 "ж" */
-    0xe, 0xe0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0,
-    0x2f, 0xb0, 0x4, 0xf8, 0x0, 0x0, 0xf, 0xc0,
-    0x0, 0x0, 0xbf, 0x20, 0x0, 0xaf, 0x20, 0x0,
-    0xf, 0xc0, 0x0, 0x5, 0xf7, 0x0, 0x0, 0x1e,
-    0xc0, 0x0, 0xf, 0xc0, 0x0, 0x1e, 0xd0, 0x0,
-    0x0, 0x6, 0xf6, 0x0, 0xf, 0xc0, 0x0, 0x9f,
-    0x30, 0x0, 0x0, 0x0, 0xbf, 0x10, 0xf, 0xc0,
-    0x3, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x98, 0x8f, 0xe8, 0x8a, 0xf8, 0x0, 0x0,
-    0x0, 0x6, 0xf9, 0x0, 0xf, 0xc0, 0x0, 0xcf,
-    0x40, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0xf, 0xc0,
-    0x0, 0x2f, 0xe1, 0x0, 0x0, 0xcf, 0x30, 0x0,
-    0xf, 0xc0, 0x0, 0x6, 0xfa, 0x0, 0x8, 0xf8,
-    0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0xaf, 0x50,
-    0x4f, 0xc0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0,
-    0x1e, 0xf2,
-
-    /* U+0437 "з" */
-    0x0, 0x5b, 0xef, 0xfc, 0x81, 0x0, 0x9, 0xfe,
-    0xa8, 0x9d, 0xfe, 0x30, 0x3, 0x40, 0x0, 0x0,
-    0x5f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xd0, 0x0, 0x0,
-    0x0, 0x13, 0xbe, 0x30, 0x0, 0x0, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x33, 0x35, 0xaf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf5, 0x8, 0x20, 0x0, 0x0,
-    0x2d, 0xf1, 0x1e, 0xfc, 0x97, 0x8b, 0xff, 0x50,
-    0x0, 0x6b, 0xef, 0xfd, 0x92, 0x0,
-
-    /* U+0438 "и" */
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0xdf, 0x19, 0xf2,
-    0x0, 0x0, 0x0, 0xaf, 0xf1, 0x9f, 0x20, 0x0,
-    0x0, 0x7f, 0xff, 0x19, 0xf2, 0x0, 0x0, 0x5f,
-    0xaa, 0xf1, 0x9f, 0x20, 0x0, 0x2f, 0xd0, 0xaf,
-    0x19, 0xf2, 0x0, 0x1d, 0xe2, 0xa, 0xf1, 0x9f,
-    0x20, 0xb, 0xf4, 0x0, 0xaf, 0x19, 0xf2, 0x9,
-    0xf6, 0x0, 0xa, 0xf1, 0x9f, 0x26, 0xf9, 0x0,
-    0x0, 0xaf, 0x19, 0xf5, 0xfc, 0x0, 0x0, 0xa,
-    0xf1, 0x9f, 0xfe, 0x10, 0x0, 0x0, 0xaf, 0x19,
-    0xff, 0x30, 0x0, 0x0, 0xa, 0xf1, 0x9f, 0x50,
-    0x0, 0x0, 0x0, 0xaf, 0x10,
-
-    /* U+0439 "й" */
-    0x0, 0x5d, 0x0, 0x0, 0x9a, 0x0, 0x0, 0x1,
-    0xf8, 0x0, 0x4f, 0x50, 0x0, 0x0, 0x3, 0xdf,
-    0xfe, 0x70, 0x0, 0x0, 0x0, 0x0, 0x11, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf2, 0x0, 0x0, 0x0, 0xd, 0xf1, 0x9f,
-    0x20, 0x0, 0x0, 0xa, 0xff, 0x19, 0xf2, 0x0,
-    0x0, 0x7, 0xff, 0xf1, 0x9f, 0x20, 0x0, 0x5,
-    0xfa, 0xaf, 0x19, 0xf2, 0x0, 0x2, 0xfd, 0xa,
-    0xf1, 0x9f, 0x20, 0x1, 0xde, 0x20, 0xaf, 0x19,
-    0xf2, 0x0, 0xbf, 0x40, 0xa, 0xf1, 0x9f, 0x20,
-    0x9f, 0x60, 0x0, 0xaf, 0x19, 0xf2, 0x6f, 0x90,
-    0x0, 0xa, 0xf1, 0x9f, 0x5f, 0xc0, 0x0, 0x0,
-    0xaf, 0x19, 0xff, 0xe1, 0x0, 0x0, 0xa, 0xf1,
-    0x9f, 0xf3, 0x0, 0x0, 0x0, 0xaf, 0x19, 0xf5,
-    0x0, 0x0, 0x0, 0xa, 0xf1,
-
-    /* U+043A "к" */
-    0x9f, 0x20, 0x0, 0x0, 0xd, 0xd1, 0x9f, 0x20,
-    0x0, 0x0, 0xaf, 0x30, 0x9f, 0x20, 0x0, 0x6,
-    0xf6, 0x0, 0x9f, 0x20, 0x0, 0x2f, 0xa0, 0x0,
-    0x9f, 0x20, 0x0, 0xdd, 0x0, 0x0, 0x9f, 0x20,
-    0xa, 0xf3, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x9f, 0x98, 0x8e, 0xf2, 0x0, 0x0,
-    0x9f, 0x20, 0x2, 0xfe, 0x10, 0x0, 0x9f, 0x20,
-    0x0, 0x4f, 0xc0, 0x0, 0x9f, 0x20, 0x0, 0x7,
-    0xf9, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x9f, 0x70,
-    0x9f, 0x20, 0x0, 0x0, 0xb, 0xf4,
-
-    /* U+043B "л" */
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x9f, 0x88, 0x88, 0x88, 0xfc, 0x0, 0x9, 0xf0,
-    0x0, 0x0, 0xf, 0xc0, 0x0, 0xae, 0x0, 0x0,
-    0x0, 0xfc, 0x0, 0xb, 0xd0, 0x0, 0x0, 0xf,
-    0xc0, 0x0, 0xcc, 0x0, 0x0, 0x0, 0xfc, 0x0,
-    0xd, 0xb0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0xe9,
-    0x0, 0x0, 0x0, 0xfc, 0x0, 0xf, 0x70, 0x0,
-    0x0, 0xf, 0xc0, 0x4, 0xf4, 0x0, 0x0, 0x0,
-    0xfc, 0x0, 0xaf, 0x0, 0x0, 0x0, 0xf, 0xc5,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0xfc, 0xcf, 0xb0,
-    0x0, 0x0, 0x0, 0xf, 0xc0,
-
-    /* U+043C "м" */
-    0x9f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x89,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0xe, 0xf8, 0x9f,
-    0xf9, 0x0, 0x0, 0x0, 0x8, 0xff, 0x89, 0xf8,
-    0xf2, 0x0, 0x0, 0x2, 0xf8, 0xf8, 0x9f, 0xe,
-    0xb0, 0x0, 0x0, 0xad, 0x1f, 0x89, 0xf0, 0x5f,
-    0x40, 0x0, 0x4f, 0x50, 0xf8, 0x9f, 0x0, 0xcd,
-    0x0, 0xd, 0xb0, 0xf, 0x89, 0xf0, 0x3, 0xf7,
-    0x6, 0xf2, 0x0, 0xf8, 0x9f, 0x0, 0x9, 0xf2,
-    0xe9, 0x0, 0xf, 0x89, 0xf0, 0x0, 0x1f, 0xfe,
-    0x10, 0x0, 0xf8, 0x9f, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0xf, 0x89, 0xf0, 0x0, 0x0, 0x60, 0x0,
-    0x0, 0xf8, 0x9f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x80,
-
-    /* U+043D "н" */
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0xec, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0xec, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0xec, 0x9f, 0x20, 0x0, 0x0, 0x0, 0xec,
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0xec, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0xec, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x9f, 0x98, 0x88, 0x88, 0x88, 0xfc,
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0xec, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0xec, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0xec, 0x9f, 0x20, 0x0, 0x0, 0x0, 0xec,
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0xec,
-
-    /* U+043E "о" */
-    0x0, 0x4, 0xae, 0xfe, 0xc6, 0x0, 0x0, 0x0,
-    0x9f, 0xfa, 0x89, 0xef, 0xc1, 0x0, 0x8, 0xfa,
-    0x10, 0x0, 0x7, 0xfc, 0x0, 0x2f, 0xc0, 0x0,
-    0x0, 0x0, 0x8f, 0x60, 0x8f, 0x40, 0x0, 0x0,
-    0x0, 0xf, 0xc0, 0xbf, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf0, 0xce, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf0,
-    0x8f, 0x40, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x2f,
-    0xc0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x8, 0xfb,
-    0x10, 0x0, 0x8, 0xfc, 0x0, 0x0, 0x9f, 0xfb,
-    0x9a, 0xef, 0xc1, 0x0, 0x0, 0x3, 0xae, 0xfe,
-    0xb5, 0x0, 0x0,
-
-    /* U+043F "п" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x9f, 0x98,
-    0x88, 0x88, 0x88, 0xfc, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0xfc, 0x9f, 0x20, 0x0, 0x0, 0x0, 0xfc,
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0xfc, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0xfc, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0xfc, 0x9f, 0x20, 0x0, 0x0, 0x0, 0xfc,
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0xfc, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0xfc, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0xfc, 0x9f, 0x20, 0x0, 0x0, 0x0, 0xfc,
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0xfc,
-
-    /* U+0440 "р" */
-    0x9f, 0x11, 0x8d, 0xff, 0xd7, 0x10, 0x0, 0x9f,
-    0x3e, 0xfb, 0x89, 0xdf, 0xe3, 0x0, 0x9f, 0xec,
-    0x20, 0x0, 0x5, 0xfe, 0x10, 0x9f, 0xe1, 0x0,
-    0x0, 0x0, 0x6f, 0x90, 0x9f, 0x70, 0x0, 0x0,
-    0x0, 0xd, 0xf0, 0x9f, 0x30, 0x0, 0x0, 0x0,
-    0x9, 0xf2, 0x9f, 0x10, 0x0, 0x0, 0x0, 0x7,
-    0xf3, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x9, 0xf2,
-    0x9f, 0x70, 0x0, 0x0, 0x0, 0xd, 0xf0, 0x9f,
-    0xe1, 0x0, 0x0, 0x0, 0x6f, 0x90, 0x9f, 0xec,
-    0x20, 0x0, 0x5, 0xfe, 0x10, 0x9f, 0x3d, 0xfb,
-    0x99, 0xdf, 0xe2, 0x0, 0x9f, 0x20, 0x7d, 0xff,
-    0xd7, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0441 "с" */
-    0x0, 0x3, 0xae, 0xff, 0xc6, 0x0, 0x0, 0x9f,
-    0xfa, 0x89, 0xdf, 0xc0, 0x8, 0xfb, 0x10, 0x0,
-    0x7, 0xf6, 0x2f, 0xc0, 0x0, 0x0, 0x0, 0x20,
-    0x8f, 0x40, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xce, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0,
-    0x0, 0x0, 0x0, 0x20, 0x8, 0xfb, 0x10, 0x0,
-    0x7, 0xf6, 0x0, 0x9f, 0xfb, 0x99, 0xef, 0xb0,
-    0x0, 0x3, 0xae, 0xff, 0xc6, 0x0,
-
-    /* U+0442 "т" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x78, 0x88,
-    0x9f, 0xc8, 0x88, 0x82, 0x0, 0x0, 0x2f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x80, 0x0, 0x0,
-
-    /* U+0443 "у" */
-    0x9, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xbe, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0,
-    0xbf, 0x10, 0x0, 0x0, 0x9, 0xf1, 0x0, 0x4,
-    0xf7, 0x0, 0x0, 0x1, 0xfa, 0x0, 0x0, 0xd,
-    0xe0, 0x0, 0x0, 0x7f, 0x30, 0x0, 0x0, 0x6f,
-    0x50, 0x0, 0xd, 0xc0, 0x0, 0x0, 0x0, 0xec,
-    0x0, 0x4, 0xf5, 0x0, 0x0, 0x0, 0x8, 0xf3,
-    0x0, 0xbe, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0,
-    0x2f, 0x70, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x19,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf9, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x30, 0x0, 0x6f, 0x60, 0x0, 0x0, 0x0,
-    0x3f, 0xb8, 0xaf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x8d, 0xfe, 0x90, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0444 "ф" */
-    0x0, 0x0, 0x0, 0x7, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x17, 0xbe, 0xff, 0xfd,
-    0xa6, 0x0, 0x0, 0x0, 0x7f, 0xfd, 0xac, 0xfa,
-    0xbe, 0xfe, 0x50, 0x0, 0x8f, 0xc3, 0x0, 0x7f,
-    0x30, 0x5, 0xef, 0x50, 0x3f, 0xc0, 0x0, 0x7,
-    0xf3, 0x0, 0x1, 0xee, 0x9, 0xf3, 0x0, 0x0,
-    0x7f, 0x30, 0x0, 0x6, 0xf6, 0xcf, 0x0, 0x0,
-    0x7, 0xf3, 0x0, 0x0, 0x1f, 0x9d, 0xd0, 0x0,
-    0x0, 0x7f, 0x30, 0x0, 0x0, 0xfa, 0xcf, 0x0,
-    0x0, 0x7, 0xf3, 0x0, 0x0, 0x1f, 0x98, 0xf4,
-    0x0, 0x0, 0x7f, 0x30, 0x0, 0x6, 0xf6, 0x2f,
-    0xc0, 0x0, 0x7, 0xf3, 0x0, 0x1, 0xee, 0x0,
-    0x8f, 0xc3, 0x0, 0x7f, 0x30, 0x5, 0xef, 0x50,
-    0x0, 0x7f, 0xfd, 0xac, 0xfa, 0xbe, 0xfe, 0x40,
-    0x0, 0x0, 0x17, 0xbe, 0xff, 0xfd, 0xa6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf3,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0445 "х" */
-    0x1e, 0xd0, 0x0, 0x0, 0x4, 0xf9, 0x0, 0x4f,
-    0xa0, 0x0, 0x1, 0xec, 0x0, 0x0, 0x8f, 0x60,
-    0x0, 0xcf, 0x20, 0x0, 0x0, 0xcf, 0x20, 0x8f,
-    0x50, 0x0, 0x0, 0x1, 0xed, 0x4f, 0x90, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfd, 0xf2, 0x0, 0x0, 0x0, 0x4, 0xf9, 0x1e,
-    0xd0, 0x0, 0x0, 0x1, 0xed, 0x0, 0x4f, 0xa0,
-    0x0, 0x0, 0xcf, 0x20, 0x0, 0x8f, 0x60, 0x0,
-    0x8f, 0x60, 0x0, 0x0, 0xcf, 0x20, 0x4f, 0xa0,
-    0x0, 0x0, 0x2, 0xed, 0x0,
-
-    /* U+0446 "ц" */
-    0x9f, 0x20, 0x0, 0x0, 0x2, 0xf8, 0x0, 0x9f,
-    0x20, 0x0, 0x0, 0x2, 0xf8, 0x0, 0x9f, 0x20,
-    0x0, 0x0, 0x2, 0xf8, 0x0, 0x9f, 0x20, 0x0,
-    0x0, 0x2, 0xf8, 0x0, 0x9f, 0x20, 0x0, 0x0,
-    0x2, 0xf8, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x2,
-    0xf8, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x2, 0xf8,
-    0x0, 0x9f, 0x20, 0x0, 0x0, 0x2, 0xf8, 0x0,
-    0x9f, 0x20, 0x0, 0x0, 0x2, 0xf8, 0x0, 0x9f,
-    0x20, 0x0, 0x0, 0x2, 0xf8, 0x0, 0x9f, 0x20,
-    0x0, 0x0, 0x2, 0xf8, 0x0, 0x9f, 0x98, 0x88,
-    0x88, 0x89, 0xfc, 0x84, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf9,
-
-    /* U+0447 "ч" */
-    0xed, 0x0, 0x0, 0x0, 0xc, 0xfe, 0xd0, 0x0,
-    0x0, 0x0, 0xcf, 0xed, 0x0, 0x0, 0x0, 0xc,
-    0xfe, 0xd0, 0x0, 0x0, 0x0, 0xcf, 0xdd, 0x0,
-    0x0, 0x0, 0xc, 0xfb, 0xf3, 0x0, 0x0, 0x0,
-    0xcf, 0x4f, 0xe6, 0x22, 0x36, 0xbf, 0xf0, 0x5d,
-    0xff, 0xff, 0xe9, 0xdf, 0x0, 0x2, 0x44, 0x20,
-    0xc, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf0,
-
-    /* U+0448 "ш" */
-    0x9f, 0x20, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0xdd, 0x9f, 0x20, 0x0, 0x0, 0xbf, 0x0, 0x0,
-    0x0, 0xdd, 0x9f, 0x20, 0x0, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0xdd, 0x9f, 0x20, 0x0, 0x0, 0xbf,
-    0x0, 0x0, 0x0, 0xdd, 0x9f, 0x20, 0x0, 0x0,
-    0xbf, 0x0, 0x0, 0x0, 0xdd, 0x9f, 0x20, 0x0,
-    0x0, 0xbf, 0x0, 0x0, 0x0, 0xdd, 0x9f, 0x20,
-    0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0xdd, 0x9f,
-    0x20, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0xdd,
-    0x9f, 0x20, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0xdd, 0x9f, 0x20, 0x0, 0x0, 0xbf, 0x0, 0x0,
-    0x0, 0xdd, 0x9f, 0x20, 0x0, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0xdd, 0x9f, 0x98, 0x88, 0x88, 0xdf,
-    0x88, 0x88, 0x88, 0xed, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd,
-
-    /* U+0449 "щ" */
-    0x9f, 0x20, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0xdd, 0x0, 0x9f, 0x20, 0x0, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0xdd, 0x0, 0x9f, 0x20, 0x0, 0x0,
-    0xbf, 0x0, 0x0, 0x0, 0xdd, 0x0, 0x9f, 0x20,
-    0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0xdd, 0x0,
-    0x9f, 0x20, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0xdd, 0x0, 0x9f, 0x20, 0x0, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0xdd, 0x0, 0x9f, 0x20, 0x0, 0x0,
-    0xbf, 0x0, 0x0, 0x0, 0xdd, 0x0, 0x9f, 0x20,
-    0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0xdd, 0x0,
-    0x9f, 0x20, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0xdd, 0x0, 0x9f, 0x20, 0x0, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0xdd, 0x0, 0x9f, 0x20, 0x0, 0x0,
-    0xbf, 0x0, 0x0, 0x0, 0xdd, 0x0, 0x9f, 0x98,
-    0x88, 0x88, 0xdf, 0x88, 0x88, 0x88, 0xfe, 0x86,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc,
-
-    /* U+044A "ъ" */
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0x88, 0x8f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfb, 0x11, 0x10, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xc4, 0x0, 0x0, 0x0, 0xfc,
-    0x44, 0x44, 0x7e, 0xf5, 0x0, 0x0, 0xf, 0xb0,
-    0x0, 0x0, 0x1e, 0xe0, 0x0, 0x0, 0xfb, 0x0,
-    0x0, 0x0, 0xaf, 0x10, 0x0, 0xf, 0xb0, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0xfb, 0x0, 0x0,
-    0x2, 0xfc, 0x0, 0x0, 0xf, 0xc5, 0x55, 0x69,
-    0xff, 0x30, 0x0, 0x0, 0xff, 0xff, 0xff, 0xe9,
-    0x20, 0x0,
-
-    /* U+044B "ы" */
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x69,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6, 0x9f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x69, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf6, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x69, 0xff, 0xff,
-    0xff, 0xd8, 0x0, 0x4, 0xf6, 0x9f, 0x53, 0x33,
-    0x5a, 0xfc, 0x0, 0x4f, 0x69, 0xf2, 0x0, 0x0,
-    0x7, 0xf6, 0x4, 0xf6, 0x9f, 0x20, 0x0, 0x0,
-    0x2f, 0x90, 0x4f, 0x69, 0xf2, 0x0, 0x0, 0x3,
-    0xf8, 0x4, 0xf6, 0x9f, 0x20, 0x0, 0x0, 0x9f,
-    0x40, 0x4f, 0x69, 0xf6, 0x44, 0x46, 0xbf, 0xa0,
-    0x4, 0xf6, 0x9f, 0xff, 0xff, 0xec, 0x60, 0x0,
-    0x4f, 0x60,
-
-    /* U+044C "ь" */
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0x9, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0,
-    0x9, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xe9,
-    0x10, 0x9f, 0x53, 0x33, 0x59, 0xfe, 0x19, 0xf2,
-    0x0, 0x0, 0x6, 0xf7, 0x9f, 0x20, 0x0, 0x0,
-    0x1f, 0xa9, 0xf2, 0x0, 0x0, 0x1, 0xfa, 0x9f,
-    0x20, 0x0, 0x0, 0x8f, 0x69, 0xf6, 0x55, 0x56,
-    0xbf, 0xc0, 0x9f, 0xff, 0xff, 0xfc, 0x70, 0x0,
-
-    /* U+044D "э" */
-    0x0, 0x4a, 0xef, 0xfd, 0x81, 0x0, 0x0, 0xbf,
-    0xd8, 0x67, 0xbf, 0xf4, 0x0, 0xb, 0x60, 0x0,
-    0x0, 0x2d, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x40, 0x0, 0x0, 0x11, 0x11, 0x13, 0xf7, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0x80, 0x0, 0x3,
-    0x44, 0x44, 0x46, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xd0, 0x9, 0x50, 0x0, 0x0, 0x2d, 0xf3, 0x0,
-    0xbf, 0xd9, 0x77, 0xbf, 0xe4, 0x0, 0x0, 0x4a,
-    0xef, 0xfd, 0x81, 0x0, 0x0,
-
-    /* U+044E "ю" */
-    0x9f, 0x20, 0x0, 0x0, 0x6c, 0xff, 0xe9, 0x20,
-    0x0, 0x9f, 0x20, 0x0, 0x1c, 0xfc, 0x76, 0x8e,
-    0xf6, 0x0, 0x9f, 0x20, 0x0, 0xcf, 0x50, 0x0,
-    0x0, 0xbf, 0x40, 0x9f, 0x20, 0x6, 0xf7, 0x0,
-    0x0, 0x0, 0xe, 0xe0, 0x9f, 0x20, 0xc, 0xf0,
-    0x0, 0x0, 0x0, 0x7, 0xf4, 0x9f, 0xa9, 0x9f,
-    0xc0, 0x0, 0x0, 0x0, 0x3, 0xf7, 0x9f, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x2, 0xf8, 0x9f,
-    0x20, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xf7,
-    0x9f, 0x20, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x7,
-    0xf4, 0x9f, 0x20, 0x5, 0xf8, 0x0, 0x0, 0x0,
-    0xe, 0xd0, 0x9f, 0x20, 0x0, 0xcf, 0x60, 0x0,
-    0x1, 0xbf, 0x40, 0x9f, 0x20, 0x0, 0x1c, 0xfc,
-    0x76, 0x9e, 0xf6, 0x0, 0x9f, 0x20, 0x0, 0x0,
-    0x6c, 0xff, 0xe9, 0x20, 0x0,
-
-    /* U+044F "я" */
-    0x0, 0x4b, 0xef, 0xff, 0xff, 0xf2, 0x9, 0xfe,
-    0xa8, 0x88, 0x8b, 0xf2, 0x3f, 0xc0, 0x0, 0x0,
-    0x7, 0xf2, 0x8f, 0x40, 0x0, 0x0, 0x7, 0xf2,
-    0x8f, 0x30, 0x0, 0x0, 0x7, 0xf2, 0x5f, 0x70,
-    0x0, 0x0, 0x7, 0xf2, 0xd, 0xf7, 0x20, 0x0,
-    0x7, 0xf2, 0x1, 0x9f, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0xc, 0xe4, 0x33, 0x39, 0xf2, 0x0, 0x6f,
-    0x60, 0x0, 0x7, 0xf2, 0x1, 0xfb, 0x0, 0x0,
-    0x7, 0xf2, 0xb, 0xf2, 0x0, 0x0, 0x7, 0xf2,
-    0x5f, 0x80, 0x0, 0x0, 0x7, 0xf2,
-
-    /* U+0450 "ѐ" */
-    0x0, 0x2d, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4b, 0xef, 0xea, 0x20, 0x0, 0x0,
-    0xaf, 0xe9, 0x8a, 0xff, 0x60, 0x0, 0x9f, 0x80,
-    0x0, 0x1, 0xcf, 0x30, 0x2f, 0xa0, 0x0, 0x0,
-    0x1, 0xec, 0x8, 0xf2, 0x0, 0x0, 0x0, 0x7,
-    0xf2, 0xbe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x6c,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x18, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xb1, 0x0, 0x0, 0x2d, 0x50,
-    0x0, 0x8f, 0xfb, 0x99, 0xcf, 0xe3, 0x0, 0x0,
-    0x3a, 0xef, 0xfc, 0x71, 0x0,
-
-    /* U+0451 "ё" */
-    0x0, 0x9, 0xe1, 0x5, 0xf5, 0x0, 0x0, 0x0,
-    0xaf, 0x20, 0x6f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xbe, 0xfe, 0xa2, 0x0,
-    0x0, 0xa, 0xfe, 0x98, 0xaf, 0xf6, 0x0, 0x9,
-    0xf8, 0x0, 0x0, 0x1c, 0xf3, 0x2, 0xfa, 0x0,
-    0x0, 0x0, 0x1e, 0xc0, 0x8f, 0x20, 0x0, 0x0,
-    0x0, 0x7f, 0x2b, 0xe0, 0x0, 0x0, 0x0, 0x3,
-    0xf6, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b,
-    0xf3, 0x33, 0x33, 0x33, 0x33, 0x31, 0x8f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfb, 0x10, 0x0, 0x2,
-    0xd5, 0x0, 0x8, 0xff, 0xb9, 0x9c, 0xfe, 0x30,
-    0x0, 0x3, 0xae, 0xff, 0xc7, 0x10, 0x0,
-
-    /* U+0452 "ђ" */
-    0x0, 0x8, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x3, 0x3a, 0xf4, 0x33, 0x33, 0x30, 0x0, 0x0,
-    0x0, 0x8, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf1, 0x19, 0xdf, 0xfc, 0x60, 0x0,
-    0x0, 0x8, 0xf4, 0xef, 0xa9, 0xae, 0xfa, 0x0,
-    0x0, 0x8, 0xfe, 0xa0, 0x0, 0x1, 0xbf, 0x60,
-    0x0, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x1f, 0xc0,
-    0x0, 0x8, 0xf6, 0x0, 0x0, 0x0, 0xc, 0xf0,
-    0x0, 0x8, 0xf3, 0x0, 0x0, 0x0, 0xa, 0xf0,
-    0x0, 0x8, 0xf2, 0x0, 0x0, 0x0, 0xa, 0xf0,
-    0x0, 0x8, 0xf2, 0x0, 0x0, 0x0, 0xa, 0xf0,
-    0x0, 0x8, 0xf2, 0x0, 0x0, 0x0, 0xa, 0xf0,
-    0x0, 0x8, 0xf2, 0x0, 0x0, 0x0, 0xa, 0xf0,
-    0x0, 0x8, 0xf2, 0x0, 0x0, 0x0, 0xa, 0xf0,
-    0x0, 0x8, 0xf2, 0x0, 0x0, 0x0, 0xa, 0xf0,
-    0x0, 0x8, 0xf2, 0x0, 0x0, 0x0, 0xa, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0x98, 0xdf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x1a, 0xef, 0xd6, 0x0,
-
-    /* U+0453 "ѓ" */
-    0x0, 0x0, 0x1, 0xcf, 0x50, 0x0, 0x0, 0x1d,
-    0xd2, 0x0, 0x0, 0x2, 0xea, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xf5, 0x9f, 0x98,
-    0x88, 0x88, 0x82, 0x9f, 0x20, 0x0, 0x0, 0x0,
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0,
-    0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x9f,
-    0x20, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0,
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0,
-    0x0, 0x0,
-
-    /* U+0454 "є" */
-    0x0, 0x2, 0x9d, 0xff, 0xd9, 0x20, 0x0, 0x8f,
-    0xfa, 0x77, 0xae, 0xf7, 0x7, 0xfa, 0x10, 0x0,
-    0x0, 0x87, 0x2f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x20, 0x0, 0x0, 0x0, 0x0, 0xce, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0xce, 0x33, 0x33, 0x33, 0x20, 0x0,
-    0x8f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x10, 0x0,
-    0x0, 0x97, 0x0, 0x8f, 0xe9, 0x77, 0x9e, 0xf7,
-    0x0, 0x3, 0x9d, 0xff, 0xd9, 0x20,
-
-    /* U+0455 "ѕ" */
-    0x0, 0x5b, 0xef, 0xfc, 0x82, 0x0, 0x9f, 0xd9,
-    0x89, 0xcf, 0xd0, 0x3f, 0xa0, 0x0, 0x0, 0x23,
-    0x6, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xc7, 0x30, 0x0,
-    0x0, 0x1, 0x8e, 0xff, 0xfc, 0x70, 0x0, 0x0,
-    0x2, 0x58, 0xdf, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x50, 0x0, 0x0, 0x0, 0x4, 0xf7, 0x59,
-    0x10, 0x0, 0x0, 0xaf, 0x49, 0xff, 0xc9, 0x89,
-    0xdf, 0xa0, 0x3, 0x9d, 0xff, 0xeb, 0x50, 0x0,
-
-    /* U+0456 "і" */
-    0xaf, 0x4e, 0xf7, 0x36, 0x0, 0x0, 0x0, 0x9,
-    0xf2, 0x9f, 0x29, 0xf2, 0x9f, 0x29, 0xf2, 0x9f,
-    0x29, 0xf2, 0x9f, 0x29, 0xf2, 0x9f, 0x29, 0xf2,
-    0x9f, 0x29, 0xf2,
-
-    /* U+0457 "ї" */
-    0x2f, 0x70, 0xe9, 0x3f, 0x71, 0xea, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x10, 0x0,
-    0xaf, 0x10, 0x0, 0xaf, 0x10, 0x0, 0xaf, 0x10,
-    0x0, 0xaf, 0x10, 0x0, 0xaf, 0x10, 0x0, 0xaf,
-    0x10, 0x0, 0xaf, 0x10, 0x0, 0xaf, 0x10, 0x0,
-    0xaf, 0x10, 0x0, 0xaf, 0x10, 0x0, 0xaf, 0x10,
-    0x0, 0xaf, 0x10,
-
-    /* U+0458 "ј" */
-    0x0, 0x0, 0x9, 0xf4, 0x0, 0x0, 0xd, 0xf7,
-    0x0, 0x0, 0x2, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf2,
-    0x0, 0x0, 0x8, 0xf2, 0x0, 0x0, 0x8, 0xf2,
-    0x0, 0x0, 0x8, 0xf2, 0x0, 0x0, 0x8, 0xf2,
-    0x0, 0x0, 0x8, 0xf2, 0x0, 0x0, 0x8, 0xf2,
-    0x0, 0x0, 0x8, 0xf2, 0x0, 0x0, 0x8, 0xf2,
-    0x0, 0x0, 0x8, 0xf2, 0x0, 0x0, 0x8, 0xf2,
-    0x0, 0x0, 0x8, 0xf2, 0x0, 0x0, 0x8, 0xf2,
-    0x0, 0x0, 0x8, 0xf2, 0x0, 0x0, 0x9, 0xf1,
-    0x0, 0x0, 0xd, 0xe0, 0xd, 0x98, 0xcf, 0x70,
-    0x9, 0xef, 0xe7, 0x0,
-
-    /* U+0459 "љ" */
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf8, 0x88, 0x88,
-    0x8f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xe0, 0x0, 0x0, 0xf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xd0, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xc0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xc6, 0x0, 0x0, 0xd, 0xb0, 0x0, 0x0, 0xf,
-    0xc3, 0x33, 0x46, 0xcf, 0x80, 0x0, 0xe, 0x90,
-    0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0xc, 0xf1,
-    0x0, 0xf, 0x70, 0x0, 0x0, 0xf, 0xc0, 0x0,
-    0x0, 0x7, 0xf4, 0x0, 0x4f, 0x40, 0x0, 0x0,
-    0xf, 0xc0, 0x0, 0x0, 0x8, 0xf3, 0x0, 0xaf,
-    0x0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x1e,
-    0xf0, 0x59, 0xf9, 0x0, 0x0, 0x0, 0xf, 0xd6,
-    0x66, 0x79, 0xef, 0x60, 0xcf, 0xb0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xfe, 0xa3, 0x0,
-
-    /* U+045A "њ" */
-    0x9f, 0x20, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x3, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0,
-    0x3, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x20,
-    0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x20, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x98, 0x88, 0x88, 0x89, 0xfc,
-    0x88, 0x87, 0x62, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x9f, 0x20,
-    0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x3b, 0xf9,
-    0x9f, 0x20, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0,
-    0x0, 0xee, 0x9f, 0x20, 0x0, 0x0, 0x3, 0xf8,
-    0x0, 0x0, 0x0, 0xce, 0x9f, 0x20, 0x0, 0x0,
-    0x3, 0xf8, 0x0, 0x0, 0x2, 0xfb, 0x9f, 0x20,
-    0x0, 0x0, 0x3, 0xfa, 0x55, 0x55, 0x8f, 0xf2,
-    0x9f, 0x20, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xe9, 0x20,
-
-    /* U+045B "ћ" */
-    0x0, 0x8, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x12, 0x29, 0xf4, 0x22, 0x22, 0x20, 0x0, 0x0,
-    0x0, 0x8, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf2, 0x19, 0xdf, 0xfc, 0x60, 0x0,
-    0x0, 0x8, 0xf5, 0xef, 0xa9, 0xae, 0xfa, 0x0,
-    0x0, 0x8, 0xff, 0xa0, 0x0, 0x0, 0xbf, 0x60,
-    0x0, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x1f, 0xc0,
-    0x0, 0x8, 0xf6, 0x0, 0x0, 0x0, 0xc, 0xf0,
-    0x0, 0x8, 0xf3, 0x0, 0x0, 0x0, 0xa, 0xf0,
-    0x0, 0x8, 0xf2, 0x0, 0x0, 0x0, 0xa, 0xf0,
-    0x0, 0x8, 0xf2, 0x0, 0x0, 0x0, 0xa, 0xf0,
-    0x0, 0x8, 0xf2, 0x0, 0x0, 0x0, 0xa, 0xf0,
-    0x0, 0x8, 0xf2, 0x0, 0x0, 0x0, 0xa, 0xf0,
-    0x0, 0x8, 0xf2, 0x0, 0x0, 0x0, 0xa, 0xf0,
-    0x0, 0x8, 0xf2, 0x0, 0x0, 0x0, 0xa, 0xf0,
-    0x0, 0x8, 0xf2, 0x0, 0x0, 0x0, 0xa, 0xf0,
-
-    /* U+045C "ќ" */
-    0x0, 0x0, 0x0, 0xaf, 0x80, 0x0, 0x0, 0x0,
-    0xb, 0xf4, 0x0, 0x0, 0x0, 0x1, 0xcc, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x20,
-    0x0, 0x0, 0xd, 0xd1, 0x9f, 0x20, 0x0, 0x0,
-    0xaf, 0x30, 0x9f, 0x20, 0x0, 0x6, 0xf6, 0x0,
-    0x9f, 0x20, 0x0, 0x2f, 0xa0, 0x0, 0x9f, 0x20,
-    0x0, 0xdd, 0x0, 0x0, 0x9f, 0x20, 0xa, 0xf3,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x9f, 0x98, 0x8e, 0xf2, 0x0, 0x0, 0x9f, 0x20,
-    0x2, 0xfe, 0x10, 0x0, 0x9f, 0x20, 0x0, 0x4f,
-    0xc0, 0x0, 0x9f, 0x20, 0x0, 0x7, 0xf9, 0x0,
-    0x9f, 0x20, 0x0, 0x0, 0x9f, 0x70, 0x9f, 0x20,
-    0x0, 0x0, 0xb, 0xf4,
-
-    /* U+045D "ѝ" */
-    0x0, 0x4e, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1c, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf2, 0x0, 0x0, 0x0, 0xd, 0xf1, 0x9f,
-    0x20, 0x0, 0x0, 0xa, 0xff, 0x19, 0xf2, 0x0,
-    0x0, 0x7, 0xff, 0xf1, 0x9f, 0x20, 0x0, 0x5,
-    0xfa, 0xaf, 0x19, 0xf2, 0x0, 0x2, 0xfd, 0xa,
-    0xf1, 0x9f, 0x20, 0x1, 0xde, 0x20, 0xaf, 0x19,
-    0xf2, 0x0, 0xbf, 0x40, 0xa, 0xf1, 0x9f, 0x20,
-    0x9f, 0x60, 0x0, 0xaf, 0x19, 0xf2, 0x6f, 0x90,
-    0x0, 0xa, 0xf1, 0x9f, 0x5f, 0xc0, 0x0, 0x0,
-    0xaf, 0x19, 0xff, 0xe1, 0x0, 0x0, 0xa, 0xf1,
-    0x9f, 0xf3, 0x0, 0x0, 0x0, 0xaf, 0x19, 0xf5,
-    0x0, 0x0, 0x0, 0xa, 0xf1,
-
-    /* U+045E "ў" */
-    0x0, 0x2, 0xf1, 0x0, 0x6, 0xe0, 0x0, 0x0,
-    0x0, 0xd, 0xa1, 0x2, 0xd8, 0x0, 0x0, 0x0,
-    0x0, 0x2b, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0xb, 0xe0, 0x2, 0xf9, 0x0,
-    0x0, 0x0, 0x2, 0xf8, 0x0, 0xb, 0xf1, 0x0,
-    0x0, 0x0, 0x9f, 0x10, 0x0, 0x4f, 0x70, 0x0,
-    0x0, 0x1f, 0xa0, 0x0, 0x0, 0xde, 0x0, 0x0,
-    0x7, 0xf3, 0x0, 0x0, 0x6, 0xf5, 0x0, 0x0,
-    0xdc, 0x0, 0x0, 0x0, 0xe, 0xc0, 0x0, 0x4f,
-    0x50, 0x0, 0x0, 0x0, 0x8f, 0x30, 0xb, 0xe0,
-    0x0, 0x0, 0x0, 0x1, 0xfa, 0x2, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf1, 0x9f, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x3, 0x0,
-    0x6, 0xf6, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x8a,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x8, 0xdf, 0xe9,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+045F "џ" */
-    0x9f, 0x20, 0x0, 0x0, 0xc, 0xe9, 0xf2, 0x0,
-    0x0, 0x0, 0xce, 0x9f, 0x20, 0x0, 0x0, 0xc,
-    0xe9, 0xf2, 0x0, 0x0, 0x0, 0xce, 0x9f, 0x20,
-    0x0, 0x0, 0xc, 0xe9, 0xf2, 0x0, 0x0, 0x0,
-    0xce, 0x9f, 0x20, 0x0, 0x0, 0xc, 0xe9, 0xf2,
-    0x0, 0x0, 0x0, 0xce, 0x9f, 0x20, 0x0, 0x0,
-    0xc, 0xe9, 0xf2, 0x0, 0x0, 0x0, 0xce, 0x9f,
-    0x20, 0x0, 0x0, 0xc, 0xe9, 0xf9, 0x88, 0x88,
-    0x88, 0xee, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x2, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x80, 0x0, 0x0, 0x0, 0x2, 0xf8, 0x0, 0x0,
-
-    /* U+0462 "Ѣ" */
-    0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x11, 0x1f, 0xc1, 0x11,
-    0x11, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x24, 0x44,
-    0x4f, 0xd4, 0x44, 0x44, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xc2, 0x22, 0x22, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x70, 0x0, 0x0, 0x0, 0xf, 0xd5,
-    0x55, 0x55, 0x58, 0xdf, 0xc0, 0x0, 0x0, 0x0,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x90, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf2, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf1, 0x0, 0x0, 0xf,
-    0xc0, 0x0, 0x0, 0x0, 0x1, 0xfd, 0x0, 0x0,
-    0x0, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xcf, 0x60,
-    0x0, 0x0, 0xf, 0xd7, 0x77, 0x77, 0x7a, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xda, 0x30, 0x0,
-
-    /* U+0463 "ѣ" */
-    0x0, 0xc, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x55, 0x5d, 0xf5, 0x55, 0x53, 0x0,
-    0x0, 0x0, 0xc, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xd7, 0x0, 0x0, 0xc, 0xf3,
-    0x33, 0x35, 0xaf, 0xb0, 0x0, 0xc, 0xf0, 0x0,
-    0x0, 0x9, 0xf4, 0x0, 0xc, 0xf0, 0x0, 0x0,
-    0x4, 0xf7, 0x0, 0xc, 0xf0, 0x0, 0x0, 0x4,
-    0xf7, 0x0, 0xc, 0xf0, 0x0, 0x0, 0xb, 0xf3,
-    0x0, 0xc, 0xf5, 0x55, 0x57, 0xcf, 0x90, 0x0,
-    0xc, 0xff, 0xff, 0xfe, 0xb5, 0x0,
-
-    /* U+046A "Ѫ" */
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x5, 0xfd, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x6b, 0xf7, 0x0, 0x0, 0x6, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf8, 0x0, 0x0,
-    0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x3, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf5, 0x0, 0x0,
-    0x3, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf5, 0x0, 0x2, 0xeb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf4, 0x2, 0xeb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf5, 0xed,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xbf,
-    0xff, 0xff, 0xff, 0xd6, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfe, 0x85, 0x6f, 0x94, 0x7d, 0xfb, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x10, 0x3, 0xf7, 0x0,
-    0x9, 0xf9, 0x0, 0x0, 0x0, 0xed, 0x0, 0x0,
-    0x3f, 0x70, 0x0, 0xb, 0xf3, 0x0, 0x0, 0x7f,
-    0x50, 0x0, 0x3, 0xf7, 0x0, 0x0, 0x2f, 0xb0,
-    0x0, 0xe, 0xd0, 0x0, 0x0, 0x3f, 0x70, 0x0,
-    0x0, 0xaf, 0x20, 0x5, 0xf7, 0x0, 0x0, 0x3,
-    0xf7, 0x0, 0x0, 0x3, 0xf9, 0x0, 0xcf, 0x0,
-    0x0, 0x0, 0x3f, 0x70, 0x0, 0x0, 0xc, 0xf1,
-    0x3f, 0x90, 0x0, 0x0, 0x3, 0xf7, 0x0, 0x0,
-    0x0, 0x5f, 0x70,
-
-    /* U+046B "ѫ" */
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0xcf, 0x53, 0x33, 0x33, 0x33, 0xce, 0x20,
-    0x0, 0x1d, 0xd1, 0x0, 0x0, 0x9, 0xf3, 0x0,
-    0x0, 0x2, 0xec, 0x0, 0x0, 0x8f, 0x50, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x7, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfa, 0x6f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x39, 0xef, 0xff, 0x96, 0x0, 0x0,
-    0x0, 0x8, 0xfd, 0x9d, 0xf9, 0xbf, 0xd1, 0x0,
-    0x0, 0x6f, 0x80, 0x9, 0xe0, 0x3, 0xfb, 0x0,
-    0x0, 0xeb, 0x0, 0x9, 0xe0, 0x0, 0x6f, 0x50,
-    0x6, 0xf3, 0x0, 0x9, 0xe0, 0x0, 0xe, 0xc0,
-    0xd, 0xd0, 0x0, 0x9, 0xe0, 0x0, 0x7, 0xf3,
-    0x4f, 0x60, 0x0, 0x9, 0xe0, 0x0, 0x1, 0xfa,
-
-    /* U+0472 "Ѳ" */
-    0x0, 0x0, 0x4, 0xad, 0xff, 0xeb, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x2c, 0xff, 0xca, 0xab, 0xff,
-    0xe6, 0x0, 0x0, 0x0, 0x3f, 0xf9, 0x10, 0x0,
-    0x0, 0x5e, 0xf9, 0x0, 0x0, 0x1e, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x1c, 0xf7, 0x0, 0xa, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf1, 0x1,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x80, 0x6f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfc, 0x8, 0xf5, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x2e, 0xf0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x8, 0xf7, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x5e, 0xf0, 0x6f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x80, 0xa, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xf1, 0x0, 0x1e, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x1c, 0xf7, 0x0, 0x0, 0x3f, 0xf8,
-    0x10, 0x0, 0x0, 0x5e, 0xf9, 0x0, 0x0, 0x0,
-    0x2c, 0xff, 0xca, 0x9b, 0xef, 0xe6, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xad, 0xff, 0xeb, 0x60, 0x0,
-    0x0, 0x0,
-
-    /* U+0473 "ѳ" */
-    0x0, 0x3, 0xae, 0xff, 0xc7, 0x0, 0x0, 0x0,
-    0x8f, 0xe8, 0x67, 0xbf, 0xe2, 0x0, 0x8, 0xf9,
-    0x0, 0x0, 0x3, 0xee, 0x10, 0x2f, 0xb0, 0x0,
-    0x0, 0x0, 0x3f, 0xa0, 0x8f, 0x30, 0x0, 0x0,
-    0x0, 0xb, 0xf0, 0xbf, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf3, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0xbf, 0x33, 0x33, 0x33, 0x33, 0x39, 0xf3,
-    0x8f, 0x20, 0x0, 0x0, 0x0, 0xa, 0xf0, 0x2f,
-    0xa0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x7, 0xf8,
-    0x0, 0x0, 0x3, 0xee, 0x10, 0x0, 0x8f, 0xe9,
-    0x67, 0xbf, 0xd2, 0x0, 0x0, 0x3, 0xae, 0xff,
-    0xc7, 0x0, 0x0,
-
-    /* U+0474 "Ѵ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x20, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xbf, 0xf9, 0xe, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfe, 0xb6, 0x8, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xb0, 0x0, 0x2, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x10, 0x0, 0x0, 0xbf, 0x30,
-    0x0, 0x0, 0x3, 0xf9, 0x0, 0x0, 0x0, 0x4f,
-    0x90, 0x0, 0x0, 0x8, 0xf4, 0x0, 0x0, 0x0,
-    0xe, 0xf1, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x0,
-    0x0, 0x7, 0xf6, 0x0, 0x0, 0x4f, 0x80, 0x0,
-    0x0, 0x0, 0x1, 0xfd, 0x0, 0x0, 0xaf, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x30, 0x0, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xa0, 0x5,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf1,
-    0xb, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf7, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfd, 0x6f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0475 "ѵ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x8f,
-    0x50, 0x0, 0x0, 0x0, 0x3e, 0xfb, 0x2f, 0xb0,
-    0x0, 0x0, 0x0, 0xdf, 0xa6, 0xb, 0xf2, 0x0,
-    0x0, 0x5, 0xf8, 0x0, 0x4, 0xf9, 0x0, 0x0,
-    0xb, 0xf1, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x1f,
-    0xa0, 0x0, 0x0, 0x6f, 0x60, 0x0, 0x7f, 0x40,
-    0x0, 0x0, 0xf, 0xd0, 0x0, 0xde, 0x0, 0x0,
-    0x0, 0x9, 0xf4, 0x3, 0xf8, 0x0, 0x0, 0x0,
-    0x2, 0xfa, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x2e, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xcf, 0x60, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x0,
-    0x0, 0x0,
-
-    /* U+048A "Ҋ" */
-    0x0, 0x0, 0x82, 0x0, 0x0, 0x45, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdb, 0x20, 0x4, 0xe7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xfe, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xf0, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf0, 0x0, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x5f, 0xbd, 0xf0,
-    0x0, 0x2f, 0x90, 0x0, 0x0, 0x2, 0xfe, 0x1d,
-    0xf0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0xd, 0xf3,
-    0xd, 0xf0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0xaf,
-    0x70, 0xd, 0xf0, 0x0, 0x2f, 0x90, 0x0, 0x6,
-    0xfb, 0x0, 0xd, 0xf0, 0x0, 0x2f, 0x90, 0x0,
-    0x3f, 0xd1, 0x0, 0xd, 0xf0, 0x0, 0x2f, 0x90,
-    0x0, 0xdf, 0x30, 0x0, 0xd, 0xf0, 0x0, 0x2f,
-    0x90, 0xa, 0xf6, 0x0, 0x0, 0xd, 0xf0, 0x0,
-    0x2f, 0x90, 0x7f, 0xa0, 0x0, 0x0, 0xd, 0xf0,
-    0x0, 0x2f, 0x93, 0xfd, 0x0, 0x0, 0x0, 0xd,
-    0xf0, 0x0, 0x2f, 0xae, 0xf2, 0x0, 0x0, 0x0,
-    0xd, 0xf0, 0x0, 0x2f, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0xd, 0xf0, 0x0, 0x2f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf9, 0x92, 0x2f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9d, 0x0,
-
-    /* U+048B "ҋ" */
-    0x0, 0x6d, 0x0, 0x0, 0x7b, 0x0, 0x0, 0x0,
-    0x1, 0xf8, 0x0, 0x4e, 0x60, 0x0, 0x0, 0x0,
-    0x3, 0xcf, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf2, 0x0,
-    0x0, 0x0, 0xd, 0xf1, 0x0, 0x9f, 0x20, 0x0,
-    0x0, 0xa, 0xff, 0x10, 0x9, 0xf2, 0x0, 0x0,
-    0x7, 0xff, 0xf1, 0x0, 0x9f, 0x20, 0x0, 0x4,
-    0xfa, 0xaf, 0x10, 0x9, 0xf2, 0x0, 0x2, 0xfd,
-    0xa, 0xf1, 0x0, 0x9f, 0x20, 0x1, 0xde, 0x20,
-    0xaf, 0x10, 0x9, 0xf2, 0x0, 0xbf, 0x40, 0xa,
-    0xf1, 0x0, 0x9f, 0x20, 0x9f, 0x60, 0x0, 0xaf,
-    0x10, 0x9, 0xf2, 0x5f, 0x90, 0x0, 0xa, 0xf1,
-    0x0, 0x9f, 0x5f, 0xc0, 0x0, 0x0, 0xaf, 0x10,
-    0x9, 0xff, 0xe1, 0x0, 0x0, 0xa, 0xf1, 0x0,
-    0x9f, 0xf3, 0x0, 0x0, 0x0, 0xbf, 0x88, 0x9,
-    0xf5, 0x0, 0x0, 0x0, 0xc, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf0, 0x0,
-
-    /* U+048C "Ҍ" */
-    0x0, 0x9, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x19, 0xf4, 0x11, 0x11, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x4, 0x4b, 0xf6, 0x44, 0x44, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf4, 0x22, 0x22,
-    0x11, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xfe, 0xa2, 0x0, 0x0, 0x9, 0xf7, 0x55,
-    0x55, 0x56, 0xbf, 0xf4, 0x0, 0x0, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x4f, 0xe0, 0x0, 0x9, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x50, 0x0, 0x9f,
-    0x30, 0x0, 0x0, 0x0, 0x4, 0xf8, 0x0, 0x9,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x90, 0x0,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x4, 0xf7, 0x0,
-    0x9, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x30,
-    0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x6f, 0xc0,
-    0x0, 0x9, 0xf8, 0x77, 0x77, 0x79, 0xdf, 0xd1,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xeb, 0x60,
-    0x0,
-
-    /* U+048D "ҍ" */
-    0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x13, 0x3d, 0xe3,
-    0x33, 0x32, 0x0, 0x0, 0x0, 0xd, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff,
-    0xd7, 0x0, 0x0, 0xd, 0xe3, 0x33, 0x45, 0xaf,
-    0xb0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0xa, 0xf3,
-    0x0, 0xd, 0xe0, 0x0, 0x0, 0x5, 0xf6, 0x0,
-    0xd, 0xe0, 0x0, 0x0, 0x5, 0xf6, 0x0, 0xd,
-    0xe0, 0x0, 0x0, 0xc, 0xf2, 0x0, 0xd, 0xe5,
-    0x55, 0x57, 0xdf, 0x80, 0x0, 0xd, 0xff, 0xff,
-    0xfe, 0xb5, 0x0,
-
-    /* U+048E "Ҏ" */
-    0x2f, 0xff, 0xff, 0xff, 0xeb, 0x60, 0x0, 0x2f,
-    0xd9, 0x99, 0x99, 0xbe, 0xfd, 0x30, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x6f, 0xe1, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x6, 0xf9, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xfd, 0x2f, 0x90, 0x0, 0x4, 0x0,
-    0x0, 0xdf, 0x2f, 0x90, 0x0, 0x6f, 0x20, 0x0,
-    0xdf, 0x2f, 0x90, 0x0, 0xb, 0xd0, 0x1, 0xfc,
-    0x2f, 0x90, 0x0, 0x1, 0xda, 0xb, 0xf5, 0x2f,
-    0x90, 0x0, 0x0, 0x5f, 0xef, 0xa0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x2f, 0xd9, 0x99,
-    0x99, 0x75, 0xbe, 0x10, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0xd, 0xb0, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x3, 0xf6, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x51, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+048F "ҏ" */
-    0x8f, 0x10, 0x6c, 0xff, 0xd8, 0x10, 0x0, 0x8f,
-    0x1b, 0xfb, 0x89, 0xcf, 0xe3, 0x0, 0x8f, 0xad,
-    0x20, 0x0, 0x5, 0xff, 0x20, 0x8f, 0xe1, 0x0,
-    0x0, 0x0, 0x4f, 0xa0, 0x8f, 0x70, 0x0, 0x0,
-    0x0, 0xc, 0xf0, 0x8f, 0x30, 0x0, 0x0, 0x0,
-    0x8, 0xf3, 0x8f, 0x20, 0x0, 0x0, 0x0, 0x6,
-    0xf4, 0x8f, 0x30, 0x0, 0x0, 0x10, 0x8, 0xf3,
-    0x8f, 0x70, 0x0, 0x6, 0xe1, 0xc, 0xf0, 0x8f,
-    0xe1, 0x0, 0x0, 0xdb, 0x4f, 0xa0, 0x8f, 0xad,
-    0x20, 0x0, 0x2f, 0xff, 0x20, 0x8f, 0x2b, 0xfb,
-    0x89, 0xcf, 0xf7, 0x0, 0x8f, 0x20, 0x6c, 0xff,
-    0xd8, 0xae, 0x10, 0x8f, 0x20, 0x0, 0x0, 0x0,
-    0xc, 0xa0, 0x8f, 0x20, 0x0, 0x0, 0x0, 0x2,
-    0x20, 0x8f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0490 "Ґ" */
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x84, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf8,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x2f, 0xd9,
-    0x99, 0x99, 0x99, 0x94, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0491 "ґ" */
-    0x0, 0x0, 0x0, 0x7, 0x50, 0x0, 0x0, 0x0,
-    0xeb, 0x0, 0x0, 0x0, 0xe, 0xb9, 0xff, 0xff,
-    0xff, 0xfb, 0x9f, 0x98, 0x88, 0x88, 0x59, 0xf2,
-    0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x9,
-    0xf2, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0,
-    0x9, 0xf2, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0,
-    0x0, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x9f, 0x20,
-    0x0, 0x0, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x9f,
-    0x20, 0x0, 0x0, 0x9, 0xf2, 0x0, 0x0, 0x0,
-
-    /* U+0492 "Ғ" */
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x9f, 0xa9, 0x99, 0x99, 0x99, 0x90, 0x0,
-    0x9, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0xaf, 0x41,
-    0x11, 0x11, 0x10, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x44, 0xbf, 0x64, 0x44,
-    0x44, 0x41, 0x0, 0x0, 0x9, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0493 "ғ" */
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x3f, 0xc8,
-    0x88, 0x88, 0x85, 0x3, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x70, 0x0, 0x0, 0x0, 0x3, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x70, 0x0, 0x0,
-    0x0, 0x4, 0xf8, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x36, 0xf9, 0x33, 0x33,
-    0x30, 0x0, 0x3f, 0x70, 0x0, 0x0, 0x0, 0x3,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x70, 0x0,
-    0x0, 0x0, 0x3, 0xf7, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0494 "Ҕ" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x2f,
-    0xd9, 0x99, 0x99, 0x99, 0x99, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x90, 0x27, 0x9a, 0x95, 0x0, 0x0,
-    0x2f, 0xbc, 0xff, 0xdd, 0xff, 0xe4, 0x0, 0x2f,
-    0xfc, 0x50, 0x0, 0x6, 0xff, 0x30, 0x2f, 0xa0,
-    0x0, 0x0, 0x0, 0x3f, 0xd0, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x9, 0xf4, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x4, 0xf7, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x3, 0xf8, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x3,
-    0xf7, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x7, 0xf5,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0xd, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x0,
-    0x0, 0x32, 0x5c, 0xfb, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1, 0x66,
-    0x50, 0x0, 0x0,
-
-    /* U+0495 "ҕ" */
-    0x9f, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x9f, 0x98,
-    0x88, 0x88, 0x80, 0x0, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x38, 0xce, 0xec,
-    0x70, 0x0, 0x9f, 0xff, 0xb9, 0x9d, 0xfd, 0x10,
-    0x9f, 0x80, 0x0, 0x0, 0x7f, 0xb0, 0x9f, 0x20,
-    0x0, 0x0, 0xb, 0xf2, 0x9f, 0x20, 0x0, 0x0,
-    0x5, 0xf6, 0x9f, 0x20, 0x0, 0x0, 0x3, 0xf8,
-    0x9f, 0x20, 0x0, 0x0, 0x3, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf0, 0x0, 0x0, 0x0, 0x2, 0xbf, 0x70,
-    0x0, 0x0, 0xab, 0xcf, 0xf8, 0x0, 0x0, 0x0,
-    0xcd, 0xd9, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0496 "Җ" */
-    0xa, 0xf4, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x0, 0x1e, 0xd0, 0x0, 0x1e, 0xd0, 0x0,
-    0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0xa, 0xf4,
-    0x0, 0x0, 0x5f, 0x80, 0x0, 0x0, 0xb, 0xf0,
-    0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0, 0xaf,
-    0x30, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x1, 0xee,
-    0x0, 0x0, 0x0, 0x1, 0xed, 0x0, 0x0, 0xb,
-    0xf0, 0x0, 0x0, 0x9f, 0x40, 0x0, 0x0, 0x0,
-    0x5, 0xf8, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x4f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2, 0x0,
-    0xb, 0xf0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xd9, 0x99, 0xef, 0x99, 0x9c,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x70, 0x0, 0xbf, 0x0,
-    0x3, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xc0, 0x0, 0xb, 0xf0, 0x0, 0x9, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x0, 0xbf,
-    0x0, 0x0, 0xe, 0xf2, 0x0, 0x0, 0x0, 0x8,
-    0xf8, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x4f,
-    0xc0, 0x0, 0x0, 0x3, 0xfd, 0x0, 0x0, 0x0,
-    0xbf, 0x0, 0x0, 0x0, 0xaf, 0x70, 0x0, 0x0,
-    0xcf, 0x40, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0,
-    0x1, 0xef, 0x20, 0x0, 0x7f, 0x90, 0x0, 0x0,
-    0x0, 0xbf, 0x0, 0x0, 0x0, 0x5, 0xfd, 0x98,
-    0x2f, 0xe1, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf0,
-
-    /* U+0497 "җ" */
-    0xe, 0xe0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0,
-    0x2f, 0xb0, 0x0, 0x4f, 0x80, 0x0, 0x0, 0xfc,
-    0x0, 0x0, 0xb, 0xf2, 0x0, 0x0, 0xaf, 0x20,
-    0x0, 0xf, 0xc0, 0x0, 0x5, 0xf7, 0x0, 0x0,
-    0x1, 0xec, 0x0, 0x0, 0xfc, 0x0, 0x1, 0xed,
-    0x0, 0x0, 0x0, 0x6, 0xf6, 0x0, 0xf, 0xc0,
-    0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0xb, 0xf1,
-    0x0, 0xfc, 0x0, 0x3f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf9, 0x88, 0xfe, 0x88,
-    0xaf, 0x80, 0x0, 0x0, 0x0, 0x6, 0xf9, 0x0,
-    0xf, 0xc0, 0x0, 0xcf, 0x40, 0x0, 0x0, 0x2,
-    0xfd, 0x0, 0x0, 0xfc, 0x0, 0x2, 0xfe, 0x10,
-    0x0, 0x0, 0xcf, 0x30, 0x0, 0xf, 0xc0, 0x0,
-    0x6, 0xfa, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0,
-    0xfc, 0x0, 0x0, 0xa, 0xf9, 0x84, 0x4f, 0xc0,
-    0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x1e, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf8,
-
-    /* U+0498 "Ҙ" */
-    0x0, 0x0, 0x0, 0x11, 0x0, 0x0, 0x0, 0x0,
-    0x29, 0xdf, 0xff, 0xfa, 0x40, 0x0, 0x6, 0xff,
-    0xd9, 0x88, 0xbf, 0xf9, 0x0, 0x3, 0xa2, 0x0,
-    0x0, 0x2, 0xdf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x80,
-    0x0, 0x0, 0x22, 0x22, 0x38, 0xfb, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x0,
-    0x55, 0x55, 0x69, 0xee, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1c, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf8, 0xc, 0x60, 0x0, 0x0, 0x0, 0x4e, 0xf2,
-    0xb, 0xfd, 0x85, 0x34, 0x6b, 0xff, 0x60, 0x0,
-    0x5c, 0xff, 0xff, 0xff, 0xb3, 0x0, 0x0, 0x0,
-    0x14, 0xcf, 0x51, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x0,
-    0x0, 0x0,
-
-    /* U+0499 "ҙ" */
-    0x0, 0x5b, 0xef, 0xfc, 0x81, 0x0, 0x9, 0xfe,
-    0xa8, 0x9d, 0xfe, 0x30, 0x3, 0x40, 0x0, 0x0,
-    0x5f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xd0, 0x0, 0x0,
-    0x0, 0x13, 0xbe, 0x30, 0x0, 0x0, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x33, 0x35, 0xaf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf5, 0x8, 0x20, 0x0, 0x0,
-    0x2d, 0xf1, 0x1e, 0xfc, 0x97, 0x8b, 0xff, 0x50,
-    0x0, 0x6b, 0xef, 0xfd, 0x92, 0x0, 0x0, 0x0,
-    0xe, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0x50, 0x0, 0x0,
-
-    /* U+049A "Қ" */
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x2e, 0xd0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0xcf, 0x20, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x9, 0xf5, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x5f, 0x80, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x2, 0xfc, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0xd, 0xe1, 0x0, 0x0, 0x0,
-    0x2f, 0xd9, 0x99, 0xcf, 0x30, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x4f, 0xc0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x8, 0xf9, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x1e, 0xe1, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x4, 0xfc, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x95,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x1, 0xef, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa,
-
-    /* U+049B "қ" */
-    0x9f, 0x20, 0x0, 0x0, 0xd, 0xd1, 0x9, 0xf2,
-    0x0, 0x0, 0xa, 0xf3, 0x0, 0x9f, 0x20, 0x0,
-    0x6, 0xf6, 0x0, 0x9, 0xf2, 0x0, 0x2, 0xfa,
-    0x0, 0x0, 0x9f, 0x20, 0x0, 0xdd, 0x0, 0x0,
-    0x9, 0xf2, 0x0, 0xaf, 0x30, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x9, 0xf9, 0x88,
-    0xef, 0x20, 0x0, 0x0, 0x9f, 0x20, 0x2, 0xfe,
-    0x10, 0x0, 0x9, 0xf2, 0x0, 0x4, 0xfc, 0x0,
-    0x0, 0x9f, 0x20, 0x0, 0x7, 0xf9, 0x0, 0x9,
-    0xf2, 0x0, 0x0, 0x9, 0xf9, 0x86, 0x9f, 0x20,
-    0x0, 0x0, 0xc, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbd,
-
-    /* U+049C "Ҝ" */
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x22,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x2, 0xf9,
-    0x0, 0x0, 0x0, 0xd, 0xe1, 0x0, 0x2f, 0x90,
-    0x6f, 0x0, 0x9, 0xf5, 0x0, 0x2, 0xf9, 0x6,
-    0xf0, 0x4, 0xf9, 0x0, 0x0, 0x2f, 0x90, 0x6f,
-    0x1, 0xed, 0x0, 0x0, 0x2, 0xfd, 0x9c, 0xf9,
-    0xcf, 0x30, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x2, 0xf9, 0x6, 0xf0, 0x4f,
-    0xc0, 0x0, 0x0, 0x2f, 0x90, 0x6f, 0x0, 0x9f,
-    0x70, 0x0, 0x2, 0xf9, 0x6, 0xf0, 0x0, 0xdf,
-    0x20, 0x0, 0x2f, 0x90, 0x4b, 0x0, 0x3, 0xfd,
-    0x0, 0x2, 0xf9, 0x0, 0x0, 0x0, 0x8, 0xf8,
-    0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0xd, 0xf3,
-    0x2, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x90,
-
-    /* U+049D "ҝ" */
-    0xaf, 0x10, 0x0, 0x0, 0x9, 0xf4, 0xaf, 0x10,
-    0x0, 0x0, 0x3f, 0x90, 0xaf, 0x10, 0x0, 0x0,
-    0xdd, 0x0, 0xaf, 0x15, 0xb0, 0x8, 0xf4, 0x0,
-    0xaf, 0x16, 0xd0, 0x3f, 0x90, 0x0, 0xaf, 0x16,
-    0xd0, 0xcd, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0xaf, 0x8b, 0xe8, 0xfd, 0x0, 0x0,
-    0xaf, 0x16, 0xd0, 0x5f, 0x90, 0x0, 0xaf, 0x16,
-    0xd0, 0xa, 0xf5, 0x0, 0xaf, 0x10, 0x0, 0x0,
-    0xdf, 0x20, 0xaf, 0x10, 0x0, 0x0, 0x2f, 0xc0,
-    0xaf, 0x10, 0x0, 0x0, 0x6, 0xf9,
-
-    /* U+049E "Ҟ" */
-    0x0, 0xa, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x20, 0x11, 0xaf, 0x21, 0x11, 0x0, 0x0, 0x8f,
-    0x50, 0x1f, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x4f,
-    0x90, 0x0, 0x44, 0xbf, 0x54, 0x44, 0x10, 0x2e,
-    0xc0, 0x0, 0x0, 0xa, 0xf1, 0x0, 0x0, 0xc,
-    0xe2, 0x0, 0x0, 0x0, 0xaf, 0x10, 0x0, 0x9,
-    0xf4, 0x0, 0x0, 0x0, 0xa, 0xf1, 0x0, 0x5,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xa9, 0x99,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x10,
-    0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0xa, 0xf1,
-    0x0, 0x1, 0xef, 0x20, 0x0, 0x0, 0x0, 0xaf,
-    0x10, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0xa,
-    0xf1, 0x0, 0x0, 0x7, 0xf9, 0x0, 0x0, 0x0,
-    0xaf, 0x10, 0x0, 0x0, 0xb, 0xf5, 0x0, 0x0,
-    0xa, 0xf1, 0x0, 0x0, 0x0, 0x1e, 0xe1, 0x0,
-    0x0, 0xaf, 0x10, 0x0, 0x0, 0x0, 0x4f, 0xc0,
-    0x0, 0xa, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x80,
-
-    /* U+049F "ҟ" */
-    0x0, 0x8f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x33, 0xaf, 0x53,
-    0x33, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x20, 0x0, 0x0,
-    0xd, 0xd1, 0x0, 0x8f, 0x20, 0x0, 0x0, 0xaf,
-    0x30, 0x0, 0x8f, 0x20, 0x0, 0x6, 0xf6, 0x0,
-    0x0, 0x8f, 0x20, 0x0, 0x2f, 0xa0, 0x0, 0x0,
-    0x8f, 0x20, 0x0, 0xdd, 0x0, 0x0, 0x0, 0x8f,
-    0x20, 0xa, 0xf3, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x8f, 0x98, 0x8e,
-    0xf2, 0x0, 0x0, 0x0, 0x8f, 0x20, 0x2, 0xfe,
-    0x10, 0x0, 0x0, 0x8f, 0x20, 0x0, 0x4f, 0xc0,
-    0x0, 0x0, 0x8f, 0x20, 0x0, 0x7, 0xf9, 0x0,
-    0x0, 0x8f, 0x20, 0x0, 0x0, 0x9f, 0x70, 0x0,
-    0x8f, 0x20, 0x0, 0x0, 0xb, 0xf4,
-
-    /* U+04A0 "Ҡ" */
-    0xbf, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x40, 0x69, 0x99, 0x9c, 0xf4, 0x0, 0x0,
-    0x0, 0x6, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xf4,
-    0x0, 0x0, 0x0, 0x2f, 0xb0, 0x0, 0x0, 0x0,
-    0x7, 0xf4, 0x0, 0x0, 0x0, 0xde, 0x10, 0x0,
-    0x0, 0x0, 0x7, 0xf4, 0x0, 0x0, 0xa, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf4, 0x0, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf4,
-    0x0, 0x3, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfb, 0x99, 0x9e, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf4, 0x0, 0x9,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf4,
-    0x0, 0x0, 0xcf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf4, 0x0, 0x0, 0x2f, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf4, 0x0, 0x0, 0x5, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf4, 0x0, 0x0,
-    0x0, 0x9f, 0x70, 0x0, 0x0, 0x0, 0x7, 0xf4,
-    0x0, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x0, 0x0,
-    0x7, 0xf4, 0x0, 0x0, 0x0, 0x2, 0xfd, 0x0,
-    0x0, 0x0, 0x7, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xa0,
-
-    /* U+04A1 "ҡ" */
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x5f, 0x80,
-    0x78, 0x88, 0xfb, 0x0, 0x0, 0x2, 0xfb, 0x0,
-    0x0, 0x0, 0xfb, 0x0, 0x0, 0xc, 0xe1, 0x0,
-    0x0, 0x0, 0xfb, 0x0, 0x0, 0x9f, 0x30, 0x0,
-    0x0, 0x0, 0xfb, 0x0, 0x5, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0xfb, 0x0, 0x2e, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xfd, 0x88, 0x9f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xfb, 0x0, 0x9, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xfb, 0x0, 0x0, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0xfb, 0x0, 0x0, 0xd, 0xf3, 0x0,
-    0x0, 0x0, 0xfb, 0x0, 0x0, 0x2, 0xee, 0x10,
-    0x0, 0x0, 0xfb, 0x0, 0x0, 0x0, 0x3f, 0xc0,
-
-    /* U+04A2 "Ң" */
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe0,
-    0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xe0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xe0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xe0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xe0, 0x0, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x2f,
-    0xd9, 0x99, 0x99, 0x99, 0x99, 0x9f, 0xe0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xe0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xe0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xe0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xe0, 0x0, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf9, 0x95,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf9,
-
-    /* U+04A3 "ң" */
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0xec, 0x0, 0x9f,
-    0x20, 0x0, 0x0, 0x0, 0xec, 0x0, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0xec, 0x0, 0x9f, 0x20, 0x0,
-    0x0, 0x0, 0xec, 0x0, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0xec, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0,
-    0xec, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x9f, 0x98, 0x88, 0x88, 0x88, 0xfc, 0x0,
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0xec, 0x0, 0x9f,
-    0x20, 0x0, 0x0, 0x0, 0xec, 0x0, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0xec, 0x0, 0x9f, 0x20, 0x0,
-    0x0, 0x0, 0xfe, 0x86, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc,
-
-    /* U+04A4 "Ҥ" */
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf9, 0x99, 0x99, 0x99, 0x97,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xd9, 0x99, 0x99,
-    0x99, 0x99, 0x9f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+04A5 "ҥ" */
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0xf2, 0x0, 0x0, 0x0, 0xf, 0xe8,
-    0x88, 0x88, 0x88, 0x9f, 0x20, 0x0, 0x0, 0x0,
-    0xfd, 0x0, 0x0, 0x0, 0x9, 0xf2, 0x0, 0x0,
-    0x0, 0xf, 0xd0, 0x0, 0x0, 0x0, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0xfd, 0x0, 0x0, 0x0, 0x9,
-    0xf2, 0x0, 0x0, 0x0, 0xf, 0xd0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x9, 0xf9, 0x88, 0x88, 0x88, 0x8f,
-    0xd0, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0xfd, 0x0, 0x0, 0x0, 0x9, 0xf2, 0x0,
-    0x0, 0x0, 0xf, 0xd0, 0x0, 0x0, 0x0, 0x9f,
-    0x20, 0x0, 0x0, 0x0, 0xfd, 0x0, 0x0, 0x0,
-    0x9, 0xf2, 0x0, 0x0, 0x0, 0xf, 0xd0, 0x0,
-    0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0xfd,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+04A6 "Ҧ" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd9, 0x99,
-    0x99, 0x99, 0x99, 0x9e, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf0, 0x16, 0x9a, 0x96, 0x10, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9,
-    0xff, 0xed, 0xff, 0xf7, 0x0, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xfe, 0x71, 0x0, 0x4,
-    0xdf, 0x80, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf0, 0x0, 0x0, 0x0, 0x1d, 0xf2, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf0, 0x0,
-    0x0, 0x0, 0x5, 0xf9, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xfc, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xed, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xfc, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf0, 0x0, 0x0, 0x0, 0x2, 0xfa,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf0,
-    0x0, 0x0, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x22, 0x39, 0xfe, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x56, 0x52, 0x0,
-    0x0,
-
-    /* U+04A7 "ҧ" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf9, 0x88, 0x88, 0x88, 0xaf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0,
-    0x0, 0x5, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf2, 0x0, 0x0, 0x0, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x5, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf2, 0x0, 0x0,
-    0x0, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x20, 0x0, 0x0, 0x5, 0xf7, 0x7b, 0xef, 0xd8,
-    0x10, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xc9, 0x9c, 0xfe, 0x20, 0x9f, 0x20, 0x0, 0x0,
-    0x5, 0xfa, 0x10, 0x0, 0x5, 0xfd, 0x9, 0xf2,
-    0x0, 0x0, 0x0, 0x5f, 0x60, 0x0, 0x0, 0x8,
-    0xf5, 0x9f, 0x20, 0x0, 0x0, 0x5, 0xf6, 0x0,
-    0x0, 0x0, 0x3f, 0x99, 0xf2, 0x0, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x1, 0xfb, 0x9f, 0x20,
-    0x0, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x0, 0x1f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xbc,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbd, 0xda, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+04A8 "Ҩ" */
-    0x0, 0x0, 0xa9, 0x0, 0x0, 0x18, 0xdf, 0xfd,
-    0x70, 0x0, 0x0, 0x0, 0xcf, 0x70, 0x0, 0x3e,
-    0xfd, 0xaa, 0xef, 0xe2, 0x0, 0x0, 0xbf, 0x60,
-    0x0, 0x2f, 0xf5, 0x0, 0x0, 0x7f, 0xe1, 0x0,
-    0x5f, 0xa0, 0x0, 0xb, 0xf4, 0x0, 0x0, 0x0,
-    0x8f, 0x80, 0xc, 0xf1, 0x0, 0x2, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x2, 0xfa, 0x0, 0x0,
-    0x6f, 0x60, 0x0, 0x0, 0x0, 0xa, 0xf2, 0x5f,
-    0x60, 0x0, 0x8, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x47, 0xf4, 0x0, 0x0, 0x9f, 0x30, 0x0,
-    0x0, 0x0, 0x7, 0xf4, 0x7f, 0x40, 0x0, 0x8,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x26, 0xf5,
-    0x0, 0x0, 0x5f, 0x60, 0x0, 0x0, 0x0, 0xc,
-    0xf0, 0x3f, 0x90, 0x0, 0x1, 0xfb, 0x0, 0x0,
-    0x0, 0x1, 0xfa, 0x0, 0xee, 0x0, 0x0, 0xb,
-    0xf2, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x6, 0xf8,
-    0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x4f, 0x90,
-    0x0, 0xc, 0xf6, 0x0, 0x0, 0x7f, 0xb0, 0x0,
-    0x3e, 0xc0, 0x0, 0x0, 0x1d, 0xf9, 0x10, 0x0,
-    0x7f, 0xd5, 0x8f, 0xb0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xb7, 0x66, 0xbf, 0xff, 0xe6, 0x56, 0x94,
-    0x0, 0x0, 0x2, 0x8c, 0xef, 0xfd, 0xa7, 0xad,
-    0xff, 0xfd, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+04A9 "ҩ" */
-    0x0, 0x2c, 0x70, 0x0, 0x5c, 0xff, 0xd7, 0x0,
-    0x0, 0x2e, 0xe3, 0x0, 0x9f, 0xd9, 0x8c, 0xfc,
-    0x10, 0xc, 0xf3, 0x0, 0x5f, 0xa0, 0x0, 0x7,
-    0xf9, 0x3, 0xf9, 0x0, 0xc, 0xe0, 0x0, 0x0,
-    0xc, 0xf0, 0x8f, 0x30, 0x0, 0xfa, 0x0, 0x0,
-    0x0, 0x7f, 0x3b, 0xf0, 0x0, 0x2f, 0x80, 0x0,
-    0x0, 0x6, 0xf4, 0xbf, 0x0, 0x1, 0xf9, 0x0,
-    0x0, 0x0, 0x7f, 0x39, 0xf1, 0x0, 0xe, 0xc0,
-    0x0, 0x0, 0xb, 0xe0, 0x5f, 0x60, 0x0, 0x9f,
-    0x30, 0x0, 0x2, 0xf8, 0x0, 0xee, 0x10, 0x2,
-    0xfd, 0x0, 0x0, 0xde, 0x10, 0x4, 0xfd, 0x30,
-    0x5, 0xfd, 0x33, 0xde, 0x20, 0x0, 0x4, 0xef,
-    0xb7, 0x5a, 0xff, 0xff, 0x75, 0x73, 0x0, 0x0,
-    0x7b, 0xef, 0xfd, 0xac, 0xff, 0xfd, 0x40,
-
-    /* U+04AA "Ҫ" */
-    0x0, 0x0, 0x4, 0xad, 0xff, 0xeb, 0x60, 0x0,
-    0x0, 0x2, 0xcf, 0xfd, 0xa9, 0xbe, 0xfe, 0x50,
-    0x0, 0x3f, 0xf9, 0x20, 0x0, 0x0, 0x5e, 0xf1,
-    0x1, 0xef, 0x50, 0x0, 0x0, 0x0, 0x1, 0x40,
-    0xa, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0x50, 0x0, 0x0, 0x0, 0x1, 0x40,
-    0x0, 0x3f, 0xf9, 0x10, 0x0, 0x0, 0x5e, 0xf1,
-    0x0, 0x2, 0xcf, 0xfc, 0xa9, 0xbe, 0xfe, 0x40,
-    0x0, 0x0, 0x4, 0xad, 0xff, 0xeb, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x75, 0x0, 0x0, 0x0,
-
-    /* U+04AB "ҫ" */
-    0x0, 0x3, 0xae, 0xff, 0xc6, 0x0, 0x0, 0x9f,
-    0xfa, 0x89, 0xdf, 0xc0, 0x8, 0xfb, 0x10, 0x0,
-    0x7, 0xf6, 0x2f, 0xc0, 0x0, 0x0, 0x0, 0x20,
-    0x8f, 0x40, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xce, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0,
-    0x0, 0x0, 0x0, 0x20, 0x8, 0xfb, 0x10, 0x0,
-    0x7, 0xf6, 0x0, 0x9f, 0xfb, 0x99, 0xef, 0xb0,
-    0x0, 0x3, 0xae, 0xff, 0xc6, 0x0, 0x0, 0x0,
-    0x3, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x83, 0x0, 0x0,
-
-    /* U+04AC "Ҭ" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x69,
-    0x99, 0x99, 0xef, 0x99, 0x99, 0x97, 0x0, 0x0,
-    0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x99, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x90, 0x0,
-
-    /* U+04AD "ҭ" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x78, 0x88,
-    0x9f, 0xc8, 0x88, 0x82, 0x0, 0x0, 0x2f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xc8, 0x40, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0,
-
-    /* U+04AE "Ү" */
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2,
-    0xd, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x80,
-    0x4, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xdd, 0x0,
-    0x0, 0xaf, 0x30, 0x0, 0x0, 0x7, 0xf4, 0x0,
-    0x0, 0x1f, 0xd0, 0x0, 0x0, 0x2f, 0xb0, 0x0,
-    0x0, 0x7, 0xf6, 0x0, 0x0, 0xbf, 0x20, 0x0,
-    0x0, 0x0, 0xdf, 0x10, 0x4, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xa0, 0xd, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf4, 0x8f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfd, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-
-    /* U+04AF "ү" */
-    0x8f, 0x40, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x2f,
-    0xa0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0xb, 0xf1,
-    0x0, 0x0, 0x0, 0x8f, 0x20, 0x4, 0xf8, 0x0,
-    0x0, 0x0, 0xfb, 0x0, 0x0, 0xde, 0x0, 0x0,
-    0x6, 0xf4, 0x0, 0x0, 0x6f, 0x50, 0x0, 0xd,
-    0xd0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x4f, 0x60,
-    0x0, 0x0, 0x8, 0xf3, 0x0, 0xbf, 0x0, 0x0,
-    0x0, 0x2, 0xf9, 0x2, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x18, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x8e, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf9, 0x0, 0x0, 0x0,
-
-    /* U+04B0 "Ұ" */
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2,
-    0xd, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x70,
-    0x3, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xed, 0x0,
-    0x0, 0x9f, 0x50, 0x0, 0x0, 0x9, 0xf3, 0x0,
-    0x0, 0x1e, 0xe0, 0x0, 0x0, 0x3f, 0x90, 0x0,
-    0x0, 0x5, 0xf9, 0x0, 0x0, 0xde, 0x10, 0x0,
-    0x0, 0x0, 0xbf, 0x30, 0x7, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xd0, 0x2f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf7, 0xbf, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xdf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x13, 0x33, 0x4f, 0xc3, 0x33, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-
-    /* U+04B1 "ұ" */
-    0x8f, 0x40, 0x0, 0x0, 0x0, 0xb, 0xe0, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0xa, 0xf2,
-    0x0, 0x0, 0x0, 0x9f, 0x10, 0x3, 0xf9, 0x0,
-    0x0, 0x1, 0xfa, 0x0, 0x0, 0xcf, 0x10, 0x0,
-    0x8, 0xf3, 0x0, 0x0, 0x4f, 0x70, 0x0, 0xe,
-    0xb0, 0x0, 0x0, 0xd, 0xe0, 0x0, 0x6f, 0x40,
-    0x0, 0x0, 0x6, 0xf5, 0x0, 0xdd, 0x0, 0x0,
-    0x0, 0x0, 0xec, 0x4, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x3c, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xdf, 0x80, 0x0, 0x0, 0x1, 0x44, 0x4c,
-    0xff, 0x54, 0x42, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf9, 0x0, 0x0, 0x0,
-
-    /* U+04B2 "Ҳ" */
-    0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x40,
-    0x0, 0x1e, 0xf2, 0x0, 0x0, 0x0, 0x8f, 0x80,
-    0x0, 0x0, 0x4f, 0xc0, 0x0, 0x0, 0x3f, 0xd0,
-    0x0, 0x0, 0x0, 0x9f, 0x70, 0x0, 0x1e, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x30, 0xa, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfd, 0x5, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfb, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xef, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf3, 0xaf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf7, 0x0, 0xdf, 0x30, 0x0, 0x0, 0x0, 0x4,
-    0xfc, 0x0, 0x3, 0xfd, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0x20, 0x0, 0x8, 0xf9, 0x0, 0x0, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0xc, 0xf5, 0x0, 0x0,
-    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x2f, 0xf9, 0x92,
-    0x2f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x40,
-
-    /* U+04B3 "ҳ" */
-    0x1e, 0xd0, 0x0, 0x0, 0x4, 0xf9, 0x0, 0x4,
-    0xfa, 0x0, 0x0, 0x1e, 0xc0, 0x0, 0x0, 0x8f,
-    0x60, 0x0, 0xbf, 0x20, 0x0, 0x0, 0xc, 0xf2,
-    0x8, 0xf5, 0x0, 0x0, 0x0, 0x1, 0xed, 0x4f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xdf, 0x20, 0x0, 0x0,
-    0x0, 0x4, 0xf9, 0x1e, 0xd0, 0x0, 0x0, 0x0,
-    0x1e, 0xd0, 0x4, 0xfa, 0x0, 0x0, 0x0, 0xcf,
-    0x20, 0x0, 0x8f, 0x60, 0x0, 0x8, 0xf6, 0x0,
-    0x0, 0xc, 0xf8, 0x83, 0x4f, 0xa0, 0x0, 0x0,
-    0x2, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf7,
-
-    /* U+04B4 "Ҵ" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0xed, 0x0, 0x6, 0x99, 0x99, 0x9f, 0xf9,
-    0x99, 0x99, 0x20, 0x0, 0xe, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xed, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0xed,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0xed, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xed, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xed, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xed, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xed, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf9, 0x99, 0x99, 0x99, 0x99, 0x9f, 0xf9, 0x94,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x80,
-
-    /* U+04B5 "ҵ" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x6, 0xf5,
-    0x0, 0x78, 0x88, 0x9f, 0xc8, 0x88, 0x50, 0x6,
-    0xf5, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x0,
-    0x6, 0xf5, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0,
-    0x0, 0x6, 0xf5, 0x0, 0x0, 0x0, 0x2f, 0x80,
-    0x0, 0x0, 0x6, 0xf5, 0x0, 0x0, 0x0, 0x2f,
-    0x80, 0x0, 0x0, 0x6, 0xf5, 0x0, 0x0, 0x0,
-    0x2f, 0x80, 0x0, 0x0, 0x6, 0xf5, 0x0, 0x0,
-    0x0, 0x2f, 0x80, 0x0, 0x0, 0x6, 0xf5, 0x0,
-    0x0, 0x0, 0x2f, 0x80, 0x0, 0x0, 0x6, 0xf5,
-    0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x0, 0x6,
-    0xf5, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x0,
-    0x6, 0xf5, 0x0, 0x0, 0x0, 0x2f, 0xc8, 0x88,
-    0x88, 0x8b, 0xfa, 0x81, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf3,
-
-    /* U+04B6 "Ҷ" */
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0x0, 0xfb, 0x0,
-    0x9, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xf, 0xb0,
-    0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x0, 0xfb,
-    0x0, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xb0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xfb, 0x0, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xb0, 0x0, 0x8f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xfb, 0x0, 0x4, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xb0, 0x0, 0xc, 0xf9, 0x10, 0x0,
-    0x0, 0x39, 0xfb, 0x0, 0x0, 0x2d, 0xff, 0xb9,
-    0xab, 0xef, 0xff, 0xb0, 0x0, 0x0, 0x7, 0xce,
-    0xff, 0xda, 0x51, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xe9, 0x93,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x50,
-
-    /* U+04B7 "ҷ" */
-    0xed, 0x0, 0x0, 0x0, 0xc, 0xf0, 0xe, 0xd0,
-    0x0, 0x0, 0x0, 0xcf, 0x0, 0xed, 0x0, 0x0,
-    0x0, 0xc, 0xf0, 0xe, 0xd0, 0x0, 0x0, 0x0,
-    0xcf, 0x0, 0xdd, 0x0, 0x0, 0x0, 0xc, 0xf0,
-    0xb, 0xf3, 0x0, 0x0, 0x0, 0xcf, 0x0, 0x4f,
-    0xe6, 0x22, 0x36, 0xbf, 0xf0, 0x0, 0x5d, 0xff,
-    0xff, 0xe9, 0xdf, 0x0, 0x0, 0x2, 0x44, 0x20,
-    0xc, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x88, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-
-    /* U+04B8 "Ҹ" */
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x9f,
-    0x20, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0x1, 0xfb, 0x9f, 0x20, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0x1, 0xfb, 0x9f, 0x20, 0x0, 0x22, 0x0,
-    0x1, 0xfb, 0x8f, 0x40, 0x0, 0xc9, 0x0, 0x1,
-    0xfb, 0x4f, 0xb0, 0x0, 0xc9, 0x0, 0x1, 0xfb,
-    0xc, 0xf9, 0x0, 0xc9, 0x0, 0x39, 0xfb, 0x2,
-    0xdf, 0xfb, 0xed, 0xbe, 0xff, 0xfb, 0x0, 0x7,
-    0xce, 0xff, 0xda, 0x51, 0xfb, 0x0, 0x0, 0x0,
-    0xc9, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x0, 0xc9,
-    0x0, 0x1, 0xfb, 0x0, 0x0, 0x0, 0xc9, 0x0,
-    0x1, 0xfb, 0x0, 0x0, 0x0, 0x86, 0x0, 0x1,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-
-    /* U+04B9 "ҹ" */
-    0xed, 0x0, 0x0, 0x0, 0xc, 0xfe, 0xd0, 0x0,
-    0x0, 0x0, 0xcf, 0xed, 0x0, 0x0, 0x0, 0xc,
-    0xfe, 0xd0, 0x0, 0x0, 0x0, 0xcf, 0xdd, 0x0,
-    0x1e, 0x10, 0xc, 0xfb, 0xf3, 0x2, 0xf2, 0x0,
-    0xcf, 0x4f, 0xe6, 0x4f, 0x56, 0xbf, 0xf0, 0x5e,
-    0xff, 0xff, 0xe9, 0xdf, 0x0, 0x2, 0x5f, 0x40,
-    0xc, 0xf0, 0x0, 0x2, 0xf2, 0x0, 0xcf, 0x0,
-    0x0, 0x2f, 0x20, 0xc, 0xf0, 0x0, 0x0, 0x10,
-    0x0, 0xcf, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf0,
-
-    /* U+04BA "Һ" */
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x92, 0x7b,
-    0xef, 0xfd, 0xa3, 0x0, 0x2, 0xff, 0xff, 0xda,
-    0x9a, 0xdf, 0xf8, 0x0, 0x2f, 0xe6, 0x10, 0x0,
-    0x0, 0x3e, 0xf5, 0x2, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xd0, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x2, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf1, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x22, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf2, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x22, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x20,
-
-    /* U+04BB "һ" */
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf2, 0x19, 0xdf, 0xfc, 0x60, 0x0, 0x9f,
-    0x5e, 0xfa, 0x9a, 0xff, 0xa0, 0x9, 0xff, 0xa0,
-    0x0, 0x1, 0xcf, 0x60, 0x9f, 0xc0, 0x0, 0x0,
-    0x1, 0xfc, 0x9, 0xf5, 0x0, 0x0, 0x0, 0xc,
-    0xf0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0xaf, 0x9,
-    0xf2, 0x0, 0x0, 0x0, 0xa, 0xf0, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0xaf, 0x9, 0xf2, 0x0, 0x0,
-    0x0, 0xa, 0xf0, 0x9f, 0x20, 0x0, 0x0, 0x0,
-    0xaf, 0x9, 0xf2, 0x0, 0x0, 0x0, 0xa, 0xf0,
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0xaf, 0x9, 0xf2,
-    0x0, 0x0, 0x0, 0xa, 0xf0,
-
-    /* U+04BC "Ҽ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5a, 0xef, 0xfd,
-    0xa4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xdf, 0xfb, 0x9a, 0xcf, 0xfc, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x70, 0x0, 0x0, 0x19,
-    0xfe, 0x30, 0x0, 0x89, 0x0, 0x2, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x4, 0xfe, 0x10, 0xf, 0xa0,
-    0x0, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf8, 0x2, 0xf8, 0x0, 0x2f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xe0, 0x1f, 0xd0, 0x7,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x30, 0x9f, 0xd9, 0xdf, 0xa8, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x8c, 0xf5, 0x0, 0x7d, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x2, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x81, 0x0,
-    0x0, 0x18, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xdf, 0xfc, 0xaa, 0xcf, 0xfd, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5a, 0xef, 0xfd,
-    0xa5, 0x0, 0x0, 0x0,
-
-    /* U+04BD "ҽ" */
-    0x0, 0x0, 0x0, 0x3, 0xae, 0xfe, 0xb5, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfe, 0xa8, 0x9d, 0xfb,
-    0x0, 0x6, 0x10, 0x7, 0xfa, 0x0, 0x0, 0x7,
-    0xfa, 0x4, 0xf4, 0x1, 0xfc, 0x0, 0x0, 0x0,
-    0x8, 0xf3, 0x6f, 0x20, 0x7f, 0x40, 0x0, 0x0,
-    0x0, 0x1f, 0xa4, 0xfa, 0x1b, 0xf1, 0x11, 0x11,
-    0x11, 0x11, 0xcd, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x1, 0x3b, 0xf4, 0x44,
-    0x44, 0x44, 0x44, 0x43, 0x0, 0x0, 0x7f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfc, 0x20, 0x0, 0x0, 0x9b, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xc9, 0x9b, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x2, 0x9d, 0xff, 0xea, 0x30, 0x0,
-
-    /* U+04BE "Ҿ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5a, 0xef, 0xfd,
-    0xa4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xdf, 0xfb, 0x9a, 0xcf, 0xfc, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x70, 0x0, 0x0, 0x19,
-    0xfe, 0x30, 0x0, 0x89, 0x0, 0x2, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x4, 0xfe, 0x10, 0xf, 0xa0,
-    0x0, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf8, 0x2, 0xf8, 0x0, 0x2f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xe0, 0x1f, 0xd0, 0x7,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x30, 0x9f, 0xd9, 0xdf, 0xa8, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x8c, 0xf5, 0x0, 0x7d, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x2, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x81, 0x0,
-    0x0, 0x18, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xdf, 0xfc, 0xaa, 0xcf, 0xfd, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5a, 0xef, 0xfd,
-    0xa5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0x60, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+04BF "ҿ" */
-    0x0, 0x0, 0x0, 0x3, 0xae, 0xfe, 0xb5, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfe, 0xa8, 0x9d, 0xfb,
-    0x0, 0x6, 0x10, 0x7, 0xfa, 0x0, 0x0, 0x7,
-    0xfa, 0x4, 0xf4, 0x1, 0xfc, 0x0, 0x0, 0x0,
-    0x8, 0xf3, 0x6f, 0x20, 0x7f, 0x40, 0x0, 0x0,
-    0x0, 0x1f, 0xa4, 0xfa, 0x1b, 0xf1, 0x11, 0x11,
-    0x11, 0x11, 0xcd, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x1, 0x3b, 0xf4, 0x44,
-    0x44, 0x44, 0x44, 0x43, 0x0, 0x0, 0x7f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfc, 0x20, 0x0, 0x0, 0x9b, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xc9, 0x9b, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x2, 0x9d, 0xff, 0xea, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0x40, 0x0, 0x0,
-
-    /* U+04C0 "Ӏ" */
-    0x2f, 0x92, 0xf9, 0x2f, 0x92, 0xf9, 0x2f, 0x92,
-    0xf9, 0x2f, 0x92, 0xf9, 0x2f, 0x92, 0xf9, 0x2f,
-    0x92, 0xf9, 0x2f, 0x92, 0xf9, 0x2f, 0x92, 0xf9,
-    0x2f, 0x90,
-
-    /* U+04C1 "Ӂ" */
-    0x0, 0x0, 0x0, 0x0, 0x54, 0x0, 0x0, 0x28,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7e, 0x40, 0x2, 0xbd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xef, 0xff, 0xa1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x0, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x1e, 0xd0,
-    0x1, 0xed, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x0, 0xaf, 0x40, 0x0, 0x5f, 0x80, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x4, 0xf9, 0x0,
-    0x0, 0xa, 0xf3, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x1e, 0xe0, 0x0, 0x0, 0x1, 0xed, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x9f, 0x40, 0x0,
-    0x0, 0x0, 0x5f, 0x80, 0x0, 0xb, 0xf0, 0x0,
-    0x4, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2,
-    0x0, 0xb, 0xf0, 0x0, 0xd, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xed, 0x99, 0x9e, 0xf9, 0x99,
-    0xcf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf7, 0x0, 0xb, 0xf0, 0x0,
-    0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xc0,
-    0x0, 0xb, 0xf0, 0x0, 0x9, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x30, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0xef, 0x20, 0x0, 0x0, 0x8, 0xf8, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x4f, 0xc0, 0x0,
-    0x0, 0x3f, 0xd0, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0xa, 0xf7, 0x0, 0x0, 0xcf, 0x40, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x1, 0xef, 0x20,
-    0x7, 0xf9, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x0, 0x5f, 0xb0, 0x2f, 0xe1, 0x0, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0xb, 0xf5,
-
-    /* U+04C2 "ӂ" */
-    0x0, 0x0, 0x0, 0x99, 0x0, 0x0, 0xd6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x50, 0x7,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xef, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xe0, 0x0, 0x0, 0xf, 0xc0,
-    0x0, 0x0, 0x2f, 0xb0, 0x4, 0xf8, 0x0, 0x0,
-    0xf, 0xc0, 0x0, 0x0, 0xbf, 0x20, 0x0, 0xaf,
-    0x20, 0x0, 0xf, 0xc0, 0x0, 0x5, 0xf7, 0x0,
-    0x0, 0x1e, 0xc0, 0x0, 0xf, 0xc0, 0x0, 0x1e,
-    0xd0, 0x0, 0x0, 0x6, 0xf6, 0x0, 0xf, 0xc0,
-    0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0xbf, 0x10,
-    0xf, 0xc0, 0x3, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x98, 0x8f, 0xe8, 0x8a, 0xf8,
-    0x0, 0x0, 0x0, 0x6, 0xf9, 0x0, 0xf, 0xc0,
-    0x0, 0xcf, 0x40, 0x0, 0x0, 0x2f, 0xd0, 0x0,
-    0xf, 0xc0, 0x0, 0x2f, 0xe1, 0x0, 0x0, 0xcf,
-    0x30, 0x0, 0xf, 0xc0, 0x0, 0x6, 0xfa, 0x0,
-    0x8, 0xf8, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0,
-    0xaf, 0x50, 0x4f, 0xc0, 0x0, 0x0, 0xf, 0xc0,
-    0x0, 0x0, 0x1e, 0xf2,
-
-    /* U+04C3 "Ӄ" */
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x2,
-    0xf9, 0x0, 0x0, 0x0, 0x2, 0xfc, 0x0, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0xce, 0x20, 0x2, 0xf9,
-    0x0, 0x0, 0x0, 0x9f, 0x40, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x5f, 0x80, 0x0, 0x2, 0xf9, 0x0,
-    0x0, 0x2f, 0xb0, 0x0, 0x0, 0x2f, 0x90, 0x0,
-    0xd, 0xe1, 0x0, 0x0, 0x2, 0xfd, 0x99, 0x9c,
-    0xf3, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x2, 0xf9, 0x0, 0x3, 0xef,
-    0x40, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x2, 0xef,
-    0x30, 0x0, 0x2, 0xf9, 0x0, 0x0, 0x3, 0xfe,
-    0x10, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x5, 0xfc,
-    0x0, 0x2, 0xf9, 0x0, 0x0, 0x0, 0xa, 0xf7,
-    0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x1e, 0xf1,
-    0x2, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x80,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xda, 0x9e, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xef, 0xe7, 0x0,
-
-    /* U+04C4 "ӄ" */
-    0x9f, 0x20, 0x0, 0x0, 0xd, 0xd1, 0x9f, 0x20,
-    0x0, 0x0, 0xaf, 0x30, 0x9f, 0x20, 0x0, 0x6,
-    0xf6, 0x0, 0x9f, 0x20, 0x0, 0x2f, 0xa0, 0x0,
-    0x9f, 0x20, 0x0, 0xdd, 0x0, 0x0, 0x9f, 0x20,
-    0xa, 0xf3, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x9f, 0x98, 0x8b, 0xfa, 0x0, 0x0,
-    0x9f, 0x20, 0x0, 0x9f, 0x90, 0x0, 0x9f, 0x20,
-    0x0, 0xa, 0xf5, 0x0, 0x9f, 0x20, 0x0, 0x0,
-    0xdf, 0x10, 0x9f, 0x20, 0x0, 0x0, 0x4f, 0x80,
-    0x9f, 0x20, 0x0, 0x0, 0xc, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2,
-    0x0, 0x0, 0xa, 0xa7, 0xbf, 0xb0, 0x0, 0x0,
-    0x7, 0xdf, 0xe9, 0x0,
-
-    /* U+04C6 "ӆ" */
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x9f, 0x88, 0x88, 0x88, 0xfc, 0x0, 0x0,
-    0x9, 0xf0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0,
-    0xae, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0xb,
-    0xd0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0xcc,
-    0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0xd, 0xb0,
-    0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0xe9, 0x0,
-    0x0, 0x0, 0xfc, 0x0, 0x0, 0xf, 0x70, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x4, 0xf4, 0x0, 0x0,
-    0x0, 0xfc, 0x0, 0x0, 0xaf, 0x0, 0x0, 0x0,
-    0xf, 0xc0, 0x5, 0x9f, 0x90, 0x0, 0x0, 0x0,
-    0xfd, 0x65, 0xcf, 0xb0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8e,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xa0,
-
-    /* U+04C7 "Ӈ" */
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xf, 0xc2,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0xf, 0xc2, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xc2, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfc, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xc2, 0xfd, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0xfc, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc2, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfc, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xc2, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xc2, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfc, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xc2, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x6e, 0xab, 0xfe, 0x20, 0x0, 0x0,
-    0x0, 0x2, 0x9d, 0xda, 0x20,
-
-    /* U+04C8 "ӈ" */
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0xcf, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0xcf, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0xcf, 0x9f, 0x20, 0x0, 0x0, 0x0, 0xcf,
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0xcf, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0xcf, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x9f, 0x98, 0x88, 0x88, 0x88, 0xef,
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0xcf, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0xcf, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0xcf, 0x9f, 0x20, 0x0, 0x0, 0x0, 0xcf,
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0xcf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xce, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x0, 0x0, 0x1, 0xe8, 0x8e, 0xf4, 0x0, 0x0,
-    0x1, 0xae, 0xfd, 0x50,
-
-    /* U+04C9 "Ӊ" */
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe0,
-    0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xe0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xe0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xe0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xe0, 0x0, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x2f,
-    0xd9, 0x99, 0x99, 0x99, 0x99, 0x9f, 0xe0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xe0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xe0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xe0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xe0, 0x0, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf9, 0x91,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9d, 0x0,
-
-    /* U+04CA "ӊ" */
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0xec, 0x0, 0x9f,
-    0x20, 0x0, 0x0, 0x0, 0xec, 0x0, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0xec, 0x0, 0x9f, 0x20, 0x0,
-    0x0, 0x0, 0xec, 0x0, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0xec, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0,
-    0xec, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x9f, 0x98, 0x88, 0x88, 0x88, 0xfc, 0x0,
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0xec, 0x0, 0x9f,
-    0x20, 0x0, 0x0, 0x0, 0xec, 0x0, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0xec, 0x0, 0x9f, 0x20, 0x0,
-    0x0, 0x0, 0xfe, 0x86, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xa0,
-
-    /* U+04CB "Ӌ" */
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0x1, 0xfa, 0x9f,
-    0x20, 0x0, 0x0, 0x0, 0x1, 0xfa, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0x1, 0xfa, 0x9f, 0x20, 0x0,
-    0x0, 0x0, 0x1, 0xfa, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0x1, 0xfa, 0x9f, 0x20, 0x0, 0x0, 0x0,
-    0x1, 0xfa, 0x7f, 0x50, 0x0, 0x0, 0x0, 0x1,
-    0xfa, 0x3f, 0xd1, 0x0, 0x0, 0x0, 0x2, 0xfa,
-    0xa, 0xfd, 0x61, 0x0, 0x25, 0xaf, 0xfa, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xea, 0xfa, 0x0, 0x1,
-    0x58, 0x98, 0x63, 0x1, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x8, 0x99, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xa0, 0x0,
-
-    /* U+04CC "ӌ" */
-    0xfc, 0x0, 0x0, 0x0, 0xc, 0xef, 0xc0, 0x0,
-    0x0, 0x0, 0xce, 0xfc, 0x0, 0x0, 0x0, 0xc,
-    0xef, 0xc0, 0x0, 0x0, 0x0, 0xce, 0xed, 0x0,
-    0x0, 0x0, 0xc, 0xeb, 0xf3, 0x0, 0x0, 0x0,
-    0xce, 0x4f, 0xe6, 0x22, 0x37, 0xcf, 0xe0, 0x5e,
-    0xff, 0xff, 0xe9, 0xde, 0x0, 0x3, 0x44, 0x20,
-    0xc, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xce, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xe0, 0x0, 0x0, 0x0,
-    0x77, 0xee, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0,
-
-    /* U+04CD "Ӎ" */
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x40, 0x2, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf4, 0x0, 0x2f, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x40, 0x2,
-    0xfd, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfd,
-    0xf4, 0x0, 0x2f, 0x8c, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0xcd, 0x7f, 0x40, 0x2, 0xf8, 0x3f, 0x70,
-    0x0, 0x0, 0x0, 0x5f, 0x46, 0xf4, 0x0, 0x2f,
-    0x80, 0xaf, 0x10, 0x0, 0x0, 0xe, 0xb0, 0x6f,
-    0x40, 0x2, 0xf8, 0x1, 0xfa, 0x0, 0x0, 0x8,
-    0xf2, 0x6, 0xf4, 0x0, 0x2f, 0x80, 0x7, 0xf3,
-    0x0, 0x1, 0xf9, 0x0, 0x6f, 0x40, 0x2, 0xf8,
-    0x0, 0xe, 0xc0, 0x0, 0xae, 0x10, 0x6, 0xf4,
-    0x0, 0x2f, 0x80, 0x0, 0x5f, 0x60, 0x3f, 0x60,
-    0x0, 0x6f, 0x40, 0x2, 0xf8, 0x0, 0x0, 0xce,
-    0x1c, 0xd0, 0x0, 0x6, 0xf4, 0x0, 0x2f, 0x80,
-    0x0, 0x3, 0xfd, 0xf4, 0x0, 0x0, 0x6f, 0x40,
-    0x2, 0xf8, 0x0, 0x0, 0x9, 0xfb, 0x0, 0x0,
-    0x6, 0xf4, 0x0, 0x2f, 0x80, 0x0, 0x0, 0x1c,
-    0x20, 0x0, 0x0, 0x6f, 0x40, 0x2, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x96,
-    0x2f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf5, 0x0,
-
-    /* U+04CE "ӎ" */
-    0x9f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x80,
-    0x9, 0xfe, 0x10, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0x0, 0x9f, 0xf9, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0x80, 0x9, 0xf8, 0xf2, 0x0, 0x0, 0x1, 0xf8,
-    0xf8, 0x0, 0x9f, 0xe, 0xb0, 0x0, 0x0, 0xad,
-    0x1f, 0x80, 0x9, 0xf0, 0x5f, 0x40, 0x0, 0x4f,
-    0x50, 0xf8, 0x0, 0x9f, 0x0, 0xcd, 0x0, 0xd,
-    0xb0, 0xf, 0x80, 0x9, 0xf0, 0x3, 0xf7, 0x6,
-    0xf2, 0x0, 0xf8, 0x0, 0x9f, 0x0, 0x9, 0xe2,
-    0xe9, 0x0, 0xf, 0x80, 0x9, 0xf0, 0x0, 0x1f,
-    0xee, 0x10, 0x0, 0xf8, 0x0, 0x9f, 0x0, 0x0,
-    0x7f, 0x60, 0x0, 0xf, 0x80, 0x9, 0xf0, 0x0,
-    0x0, 0x60, 0x0, 0x0, 0xfc, 0x85, 0x9f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x90,
-
-    /* U+04CF "ӏ" */
-    0x8f, 0x28, 0xf2, 0x8f, 0x28, 0xf2, 0x8f, 0x28,
-    0xf2, 0x8f, 0x28, 0xf2, 0x8f, 0x28, 0xf2, 0x8f,
-    0x28, 0xf2, 0x8f, 0x28, 0xf2, 0x8f, 0x28, 0xf2,
-    0x8f, 0x28, 0xf2,
-
-    /* U+04D0 "Ӑ" */
-    0x0, 0x0, 0x7, 0x30, 0x0, 0x4, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xc2, 0x0, 0x3e, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x9c, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x25, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfb, 0x0, 0xed, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf4, 0x0, 0x7f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0xe, 0xd0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x60,
-    0x0, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xce,
-    0x0, 0x0, 0x2, 0xfa, 0x0, 0x0, 0x0, 0x4,
-    0xf8, 0x0, 0x0, 0x0, 0xbf, 0x10, 0x0, 0x0,
-    0xb, 0xf3, 0x22, 0x22, 0x22, 0x6f, 0x80, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x9f, 0x65, 0x55, 0x55, 0x55, 0x58,
-    0xf7, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xed, 0x0, 0x8, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x50, 0xe, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xc0, 0x6f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf3,
-
-    /* U+04D1 "ӑ" */
-    0x0, 0xb8, 0x0, 0x0, 0xe5, 0x0, 0x6, 0xe4,
-    0x0, 0x8f, 0x10, 0x0, 0x7, 0xef, 0xfd, 0x30,
-    0x0, 0x0, 0x0, 0x11, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xbe, 0xff, 0xc7,
-    0x0, 0x2d, 0xfe, 0xa8, 0x9e, 0xfb, 0x0, 0xd5,
-    0x0, 0x0, 0xa, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xdd, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xe0, 0x2a, 0xef, 0xff,
-    0xff, 0xfe, 0x2f, 0xe7, 0x43, 0x33, 0x3d, 0xe9,
-    0xf3, 0x0, 0x0, 0x0, 0xde, 0xbf, 0x0, 0x0,
-    0x0, 0xf, 0xe8, 0xf4, 0x0, 0x0, 0xa, 0xfe,
-    0x1d, 0xf8, 0x44, 0x6d, 0xcc, 0xe0, 0x18, 0xdf,
-    0xfd, 0x70, 0xce,
-
-    /* U+04D2 "Ӓ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfa, 0x0, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xe9, 0x0, 0xbd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x9c, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x25, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfb, 0x0, 0xed, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf4, 0x0, 0x7f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0xe, 0xd0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x60,
-    0x0, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xce,
-    0x0, 0x0, 0x2, 0xfa, 0x0, 0x0, 0x0, 0x4,
-    0xf8, 0x0, 0x0, 0x0, 0xbf, 0x10, 0x0, 0x0,
-    0xb, 0xf3, 0x22, 0x22, 0x22, 0x6f, 0x80, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x9f, 0x65, 0x55, 0x55, 0x55, 0x58,
-    0xf7, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xed, 0x0, 0x8, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x50, 0xe, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xc0, 0x6f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf3,
-
-    /* U+04D3 "ӓ" */
-    0x0, 0x3f, 0x70, 0xd, 0xc0, 0x0, 0x3, 0xf9,
-    0x0, 0xed, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5b,
-    0xef, 0xfc, 0x70, 0x2, 0xdf, 0xea, 0x89, 0xef,
-    0xb0, 0xd, 0x50, 0x0, 0x0, 0xaf, 0x60, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x2,
-    0xae, 0xff, 0xff, 0xff, 0xe2, 0xfe, 0x74, 0x33,
-    0x33, 0xde, 0x9f, 0x30, 0x0, 0x0, 0xd, 0xeb,
-    0xf0, 0x0, 0x0, 0x0, 0xfe, 0x8f, 0x40, 0x0,
-    0x0, 0xaf, 0xe1, 0xdf, 0x84, 0x46, 0xdc, 0xce,
-    0x1, 0x8d, 0xff, 0xd7, 0xc, 0xe0,
-
-    /* U+04D4 "Ӕ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfd, 0xfc, 0x99, 0x99, 0x99, 0x99, 0x91,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xb5, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x25, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf8, 0x5, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xe0, 0x5, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x50, 0x5, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x0, 0x5, 0xfb, 0x88, 0x88, 0x88, 0x88, 0x10,
-    0x0, 0x0, 0xa, 0xf2, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x4f, 0x80,
-    0x0, 0x5, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x32, 0x22, 0x27, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xc5, 0x55, 0x55, 0x59, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x20, 0x0,
-    0x0, 0x5, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf9, 0x0, 0x0, 0x0, 0x5, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xe0, 0x0, 0x0,
-    0x0, 0x5, 0xfb, 0x99, 0x99, 0x99, 0x99, 0x94,
-    0x7f, 0x50, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8,
-
-    /* U+04D5 "ӕ" */
-    0x0, 0x5b, 0xef, 0xfc, 0x60, 0x0, 0x4b, 0xef,
-    0xe9, 0x20, 0x0, 0x2d, 0xfe, 0x98, 0x9e, 0xfa,
-    0x8, 0xfe, 0x98, 0xaf, 0xf5, 0x0, 0xd, 0x50,
-    0x0, 0x0, 0xaf, 0xaf, 0x90, 0x0, 0x1, 0xcf,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfa, 0x0,
-    0x0, 0x0, 0x1e, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf3, 0x0, 0x0, 0x0, 0x7, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf0, 0x0, 0x0, 0x0,
-    0x4, 0xf6, 0x2, 0xae, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x2e, 0xe7, 0x43,
-    0x33, 0x3d, 0xf3, 0x33, 0x33, 0x33, 0x33, 0x31,
-    0x9f, 0x30, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x1f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x50,
-    0x0, 0x0, 0xbf, 0xaf, 0x90, 0x0, 0x0, 0x1c,
-    0x40, 0x1d, 0xfa, 0x66, 0x8e, 0xf4, 0x9, 0xfe,
-    0x86, 0x6a, 0xfe, 0x30, 0x0, 0x8d, 0xff, 0xd9,
-    0x20, 0x0, 0x3a, 0xef, 0xfd, 0x81, 0x0,
-
-    /* U+04D6 "Ӗ" */
-    0x0, 0x28, 0x0, 0x0, 0x6, 0x40, 0x0, 0x1,
-    0xf9, 0x10, 0x6, 0xf4, 0x0, 0x0, 0x3, 0xcf,
-    0xff, 0xd5, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x2f,
-    0xd9, 0x99, 0x99, 0x99, 0x99, 0x32, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd8,
-    0x88, 0x88, 0x88, 0x82, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xd9, 0x99, 0x99, 0x99, 0x99,
-    0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-
-    /* U+04D7 "ӗ" */
-    0x0, 0x2f, 0x10, 0x0, 0x5e, 0x0, 0x0, 0x0,
-    0xda, 0x10, 0x2d, 0x90, 0x0, 0x0, 0x2, 0xbf,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4b, 0xef, 0xea, 0x20, 0x0, 0x0,
-    0xaf, 0xe9, 0x8a, 0xff, 0x60, 0x0, 0x9f, 0x80,
-    0x0, 0x1, 0xcf, 0x30, 0x2f, 0xa0, 0x0, 0x0,
-    0x1, 0xec, 0x8, 0xf2, 0x0, 0x0, 0x0, 0x7,
-    0xf2, 0xbe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x6c,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x18, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xb1, 0x0, 0x0, 0x2d, 0x50,
-    0x0, 0x8f, 0xfb, 0x99, 0xcf, 0xe3, 0x0, 0x0,
-    0x3a, 0xef, 0xfc, 0x71, 0x0,
-
-    /* U+04D8 "Ә" */
-    0x0, 0x0, 0x28, 0xce, 0xff, 0xc8, 0x30, 0x0,
-    0x0, 0x0, 0x1a, 0xff, 0xeb, 0x9a, 0xdf, 0xfa,
-    0x10, 0x0, 0x0, 0xdf, 0xb3, 0x0, 0x0, 0x3,
-    0xbf, 0xe2, 0x0, 0x0, 0x46, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0xf5,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0xee, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x4a, 0xf5, 0xcf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf2, 0x8f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xd0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x60, 0x7, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfc, 0x0, 0x0, 0xaf,
-    0xd4, 0x0, 0x0, 0x2, 0xbf, 0xd1, 0x0, 0x0,
-    0x7, 0xff, 0xea, 0x9a, 0xdf, 0xfa, 0x10, 0x0,
-    0x0, 0x0, 0x17, 0xce, 0xff, 0xd9, 0x20, 0x0,
-    0x0,
-
-    /* U+04D9 "ә" */
-    0x0, 0x29, 0xdf, 0xfd, 0x92, 0x0, 0x0, 0x5f,
-    0xfb, 0x88, 0xbf, 0xf6, 0x0, 0x8, 0xb1, 0x0,
-    0x0, 0x2d, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf8, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0xf3, 0x33,
-    0x33, 0x33, 0x35, 0xf8, 0x6f, 0x30, 0x0, 0x0,
-    0x0, 0x5f, 0x51, 0xfb, 0x0, 0x0, 0x0, 0xd,
-    0xe0, 0x7, 0xf9, 0x0, 0x0, 0x1b, 0xf6, 0x0,
-    0x8, 0xfe, 0x98, 0xae, 0xf7, 0x0, 0x0, 0x4,
-    0xbe, 0xfe, 0xa3, 0x0, 0x0,
-
-    /* U+04DA "Ӛ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfa, 0x0, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xe9, 0x0, 0xcd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28,
-    0xce, 0xff, 0xc8, 0x30, 0x0, 0x0, 0x0, 0x1a,
-    0xff, 0xeb, 0x9a, 0xdf, 0xfa, 0x10, 0x0, 0x0,
-    0xdf, 0xb3, 0x0, 0x0, 0x3, 0xbf, 0xe2, 0x0,
-    0x0, 0x46, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf2, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x18, 0xf5, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xee, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x4a, 0xf5, 0xcf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2,
-    0x8f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xd0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x60, 0x7, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfc, 0x0, 0x0, 0xaf, 0xd4, 0x0, 0x0,
-    0x2, 0xbf, 0xd1, 0x0, 0x0, 0x7, 0xff, 0xea,
-    0x9a, 0xdf, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x17,
-    0xce, 0xff, 0xd9, 0x20, 0x0, 0x0,
-
-    /* U+04DB "ӛ" */
-    0x0, 0x7, 0xf2, 0x3, 0xf6, 0x0, 0x0, 0x0,
-    0x8f, 0x30, 0x4f, 0x70, 0x0, 0x0, 0x0, 0x10,
-    0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x29, 0xdf, 0xfd, 0x92, 0x0,
-    0x0, 0x5f, 0xfb, 0x88, 0xbf, 0xf6, 0x0, 0x8,
-    0xb1, 0x0, 0x0, 0x2d, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf8, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99,
-    0xf3, 0x33, 0x33, 0x33, 0x35, 0xf8, 0x6f, 0x30,
-    0x0, 0x0, 0x0, 0x5f, 0x51, 0xfb, 0x0, 0x0,
-    0x0, 0xd, 0xe0, 0x7, 0xf9, 0x0, 0x0, 0x1b,
-    0xf6, 0x0, 0x8, 0xfe, 0x98, 0xae, 0xf7, 0x0,
-    0x0, 0x4, 0xbe, 0xfe, 0xa3, 0x0, 0x0,
-
-    /* U+04DC "Ӝ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xe0, 0x9, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xd0, 0x8, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x0, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x1e, 0xd0,
-    0x1, 0xed, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x0, 0xaf, 0x40, 0x0, 0x5f, 0x80, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x4, 0xf9, 0x0,
-    0x0, 0xa, 0xf3, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x1e, 0xe0, 0x0, 0x0, 0x1, 0xed, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x9f, 0x40, 0x0,
-    0x0, 0x0, 0x5f, 0x80, 0x0, 0xb, 0xf0, 0x0,
-    0x4, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2,
-    0x0, 0xb, 0xf0, 0x0, 0xd, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xed, 0x99, 0x9e, 0xf9, 0x99,
-    0xcf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf7, 0x0, 0xb, 0xf0, 0x0,
-    0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xc0,
-    0x0, 0xb, 0xf0, 0x0, 0x9, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x30, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0xef, 0x20, 0x0, 0x0, 0x8, 0xf8, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x4f, 0xc0, 0x0,
-    0x0, 0x3f, 0xd0, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0xa, 0xf7, 0x0, 0x0, 0xcf, 0x40, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x1, 0xef, 0x20,
-    0x7, 0xf9, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x0, 0x5f, 0xb0, 0x2f, 0xe1, 0x0, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0xb, 0xf5,
-
-    /* U+04DD "ӝ" */
-    0x0, 0x0, 0x0, 0x1e, 0x90, 0xc, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xa0, 0xd,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xe0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0,
-    0x2f, 0xb0, 0x4, 0xf8, 0x0, 0x0, 0xf, 0xc0,
-    0x0, 0x0, 0xbf, 0x20, 0x0, 0xaf, 0x20, 0x0,
-    0xf, 0xc0, 0x0, 0x5, 0xf7, 0x0, 0x0, 0x1e,
-    0xc0, 0x0, 0xf, 0xc0, 0x0, 0x1e, 0xd0, 0x0,
-    0x0, 0x6, 0xf6, 0x0, 0xf, 0xc0, 0x0, 0x9f,
-    0x30, 0x0, 0x0, 0x0, 0xbf, 0x10, 0xf, 0xc0,
-    0x3, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x98, 0x8f, 0xe8, 0x8a, 0xf8, 0x0, 0x0,
-    0x0, 0x6, 0xf9, 0x0, 0xf, 0xc0, 0x0, 0xcf,
-    0x40, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0xf, 0xc0,
-    0x0, 0x2f, 0xe1, 0x0, 0x0, 0xcf, 0x30, 0x0,
-    0xf, 0xc0, 0x0, 0x6, 0xfa, 0x0, 0x8, 0xf8,
-    0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0xaf, 0x50,
-    0x4f, 0xc0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0,
-    0x1e, 0xf2,
-
-    /* U+04DE "Ӟ" */
-    0x0, 0x0, 0x5f, 0x40, 0x2e, 0x80, 0x0, 0x0,
-    0x0, 0x6f, 0x50, 0x3f, 0x90, 0x0, 0x0, 0x0,
-    0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xbe, 0xff,
-    0xd8, 0x20, 0x0, 0x5, 0xff, 0xfb, 0xaa, 0xdf,
-    0xf7, 0x0, 0x4, 0xc4, 0x0, 0x0, 0x3, 0xdf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x80, 0x0, 0x0, 0x22,
-    0x22, 0x38, 0xfc, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x55, 0x55, 0x69,
-    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfa, 0x5, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf5, 0xe, 0xe6, 0x0,
-    0x0, 0x3, 0xcf, 0xb0, 0x2, 0xbf, 0xfc, 0xab,
-    0xef, 0xf9, 0x0, 0x0, 0x2, 0x7a, 0xcc, 0xb7,
-    0x20, 0x0,
-
-    /* U+04DF "ӟ" */
-    0x0, 0x5, 0x50, 0x2, 0x60, 0x0, 0x0, 0xf,
-    0xf0, 0xb, 0xf4, 0x0, 0x0, 0x5, 0x50, 0x2,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5b,
-    0xef, 0xfc, 0x81, 0x0, 0x9, 0xfe, 0xa8, 0x9d,
-    0xfe, 0x30, 0x3, 0x40, 0x0, 0x0, 0x5f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xd0, 0x0, 0x0, 0x0, 0x13,
-    0xbe, 0x30, 0x0, 0x0, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x33, 0x35, 0xaf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf5, 0x8, 0x20, 0x0, 0x0, 0x2d, 0xf1,
-    0x1e, 0xfc, 0x97, 0x8b, 0xff, 0x50, 0x0, 0x6b,
-    0xef, 0xfd, 0x92, 0x0,
-
-    /* U+04E0 "Ӡ" */
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x5,
-    0x88, 0x88, 0x88, 0x88, 0xdf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xde, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xfd, 0x81, 0x0,
-    0x0, 0x0, 0x2, 0x55, 0x7b, 0xfe, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf6, 0x4, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf2, 0x1f, 0xc4, 0x0, 0x0, 0x0, 0x9f,
-    0xb0, 0x6, 0xff, 0xeb, 0x99, 0xbf, 0xfc, 0x10,
-    0x0, 0x6, 0xbe, 0xff, 0xeb, 0x50, 0x0,
-
-    /* U+04E1 "ӡ" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x88,
-    0x88, 0x88, 0x88, 0xbf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xde, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xea, 0x20, 0x0, 0x0, 0x0, 0x55, 0x6a, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf6, 0x4, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x35, 0xf9, 0x20, 0x0, 0x0, 0x8f, 0xb0,
-    0x9, 0xff, 0xda, 0xab, 0xff, 0xd1, 0x0, 0x2,
-    0x8c, 0xff, 0xec, 0x60, 0x0,
-
-    /* U+04E2 "Ӣ" */
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x2, 0x22, 0x22, 0x22, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xf2, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xf2, 0xf9, 0x0, 0x0,
-    0x0, 0x5, 0xfb, 0xdf, 0x2f, 0x90, 0x0, 0x0,
-    0x2, 0xfe, 0x1d, 0xf2, 0xf9, 0x0, 0x0, 0x0,
-    0xdf, 0x30, 0xdf, 0x2f, 0x90, 0x0, 0x0, 0xaf,
-    0x70, 0xd, 0xf2, 0xf9, 0x0, 0x0, 0x6f, 0xb0,
-    0x0, 0xdf, 0x2f, 0x90, 0x0, 0x3f, 0xd1, 0x0,
-    0xd, 0xf2, 0xf9, 0x0, 0xd, 0xf3, 0x0, 0x0,
-    0xdf, 0x2f, 0x90, 0xa, 0xf6, 0x0, 0x0, 0xd,
-    0xf2, 0xf9, 0x7, 0xfa, 0x0, 0x0, 0x0, 0xdf,
-    0x2f, 0x93, 0xfd, 0x0, 0x0, 0x0, 0xd, 0xf2,
-    0xfa, 0xef, 0x20, 0x0, 0x0, 0x0, 0xdf, 0x2f,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0xd, 0xf2, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x2f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf0,
-
-    /* U+04E3 "ӣ" */
-    0x0, 0x8f, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x1,
-    0x22, 0x22, 0x22, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0xdf,
-    0x19, 0xf2, 0x0, 0x0, 0x0, 0xaf, 0xf1, 0x9f,
-    0x20, 0x0, 0x0, 0x7f, 0xff, 0x19, 0xf2, 0x0,
-    0x0, 0x5f, 0xaa, 0xf1, 0x9f, 0x20, 0x0, 0x2f,
-    0xd0, 0xaf, 0x19, 0xf2, 0x0, 0x1d, 0xe2, 0xa,
-    0xf1, 0x9f, 0x20, 0xb, 0xf4, 0x0, 0xaf, 0x19,
-    0xf2, 0x9, 0xf6, 0x0, 0xa, 0xf1, 0x9f, 0x26,
-    0xf9, 0x0, 0x0, 0xaf, 0x19, 0xf5, 0xfc, 0x0,
-    0x0, 0xa, 0xf1, 0x9f, 0xfe, 0x10, 0x0, 0x0,
-    0xaf, 0x19, 0xff, 0x30, 0x0, 0x0, 0xa, 0xf1,
-    0x9f, 0x50, 0x0, 0x0, 0x0, 0xaf, 0x10,
-
-    /* U+04E4 "Ӥ" */
-    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf9, 0x0, 0xed, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x80, 0xd, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf2, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x5f, 0xbd, 0xf2, 0xf9, 0x0, 0x0, 0x0,
-    0x2f, 0xe1, 0xdf, 0x2f, 0x90, 0x0, 0x0, 0xd,
-    0xf3, 0xd, 0xf2, 0xf9, 0x0, 0x0, 0xa, 0xf7,
-    0x0, 0xdf, 0x2f, 0x90, 0x0, 0x6, 0xfb, 0x0,
-    0xd, 0xf2, 0xf9, 0x0, 0x3, 0xfd, 0x10, 0x0,
-    0xdf, 0x2f, 0x90, 0x0, 0xdf, 0x30, 0x0, 0xd,
-    0xf2, 0xf9, 0x0, 0xaf, 0x60, 0x0, 0x0, 0xdf,
-    0x2f, 0x90, 0x7f, 0xa0, 0x0, 0x0, 0xd, 0xf2,
-    0xf9, 0x3f, 0xd0, 0x0, 0x0, 0x0, 0xdf, 0x2f,
-    0xae, 0xf2, 0x0, 0x0, 0x0, 0xd, 0xf2, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x2f, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf2, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf,
-
-    /* U+04E5 "ӥ" */
-    0x0, 0xc, 0xd0, 0x8, 0xf2, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0xdf,
-    0x19, 0xf2, 0x0, 0x0, 0x0, 0xaf, 0xf1, 0x9f,
-    0x20, 0x0, 0x0, 0x7f, 0xff, 0x19, 0xf2, 0x0,
-    0x0, 0x5f, 0xaa, 0xf1, 0x9f, 0x20, 0x0, 0x2f,
-    0xd0, 0xaf, 0x19, 0xf2, 0x0, 0x1d, 0xe2, 0xa,
-    0xf1, 0x9f, 0x20, 0xb, 0xf4, 0x0, 0xaf, 0x19,
-    0xf2, 0x9, 0xf6, 0x0, 0xa, 0xf1, 0x9f, 0x26,
-    0xf9, 0x0, 0x0, 0xaf, 0x19, 0xf5, 0xfc, 0x0,
-    0x0, 0xa, 0xf1, 0x9f, 0xfe, 0x10, 0x0, 0x0,
-    0xaf, 0x19, 0xff, 0x30, 0x0, 0x0, 0xa, 0xf1,
-    0x9f, 0x50, 0x0, 0x0, 0x0, 0xaf, 0x10,
-
-    /* U+04E6 "Ӧ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xe0, 0x8, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0x0,
-    0x7f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xfe, 0xb6, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xcf, 0xfc, 0xaa, 0xbe, 0xfe,
-    0x60, 0x0, 0x0, 0x3, 0xff, 0x91, 0x0, 0x0,
-    0x5, 0xef, 0x80, 0x0, 0x1, 0xef, 0x40, 0x0,
-    0x0, 0x0, 0x1, 0xcf, 0x60, 0x0, 0xaf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x10, 0x1f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf7,
-    0x6, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xc0, 0x8f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x9, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf0, 0x8f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x6, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xc0,
-    0x1f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf7, 0x0, 0xaf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0x10, 0x1, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x1, 0xcf, 0x60, 0x0, 0x3, 0xff, 0x91,
-    0x0, 0x0, 0x5, 0xef, 0x80, 0x0, 0x0, 0x2,
-    0xcf, 0xfc, 0xa9, 0xbe, 0xfe, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xfe, 0xb6, 0x0, 0x0,
-    0x0,
-
-    /* U+04E7 "ӧ" */
-    0x0, 0x5, 0xf4, 0x2, 0xe8, 0x0, 0x0, 0x0,
-    0x6, 0xf5, 0x2, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xae, 0xfe,
-    0xc6, 0x0, 0x0, 0x0, 0x9f, 0xfa, 0x89, 0xef,
-    0xc1, 0x0, 0x8, 0xfa, 0x10, 0x0, 0x7, 0xfc,
-    0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0, 0x8f, 0x60,
-    0x8f, 0x40, 0x0, 0x0, 0x0, 0xf, 0xc0, 0xbf,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf0, 0xce, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf0, 0xbf, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf0, 0x8f, 0x40, 0x0, 0x0,
-    0x0, 0x1f, 0xc0, 0x2f, 0xc0, 0x0, 0x0, 0x0,
-    0x9f, 0x60, 0x8, 0xfb, 0x10, 0x0, 0x8, 0xfc,
-    0x0, 0x0, 0x9f, 0xfb, 0x9a, 0xef, 0xc1, 0x0,
-    0x0, 0x3, 0xae, 0xfe, 0xb5, 0x0, 0x0,
-
-    /* U+04E8 "Ө" */
-    0x0, 0x0, 0x4, 0xad, 0xff, 0xeb, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x2c, 0xff, 0xca, 0xab, 0xff,
-    0xe6, 0x0, 0x0, 0x0, 0x3f, 0xf9, 0x10, 0x0,
-    0x0, 0x5e, 0xf9, 0x0, 0x0, 0x1e, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x1c, 0xf7, 0x0, 0xa, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf1, 0x1,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x80, 0x6f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfc, 0x8, 0xf5, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x2e, 0xf0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x8, 0xf7, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x5e, 0xf0, 0x6f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x80, 0xa, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xf1, 0x0, 0x1e, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x1c, 0xf7, 0x0, 0x0, 0x3f, 0xf8,
-    0x10, 0x0, 0x0, 0x5e, 0xf9, 0x0, 0x0, 0x0,
-    0x2c, 0xff, 0xca, 0x9b, 0xef, 0xe6, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xad, 0xff, 0xeb, 0x60, 0x0,
-    0x0, 0x0,
-
-    /* U+04E9 "ө" */
-    0x0, 0x3, 0xae, 0xff, 0xc7, 0x0, 0x0, 0x0,
-    0x8f, 0xe8, 0x67, 0xbf, 0xe2, 0x0, 0x8, 0xf9,
-    0x0, 0x0, 0x3, 0xee, 0x10, 0x2f, 0xb0, 0x0,
-    0x0, 0x0, 0x3f, 0xa0, 0x8f, 0x30, 0x0, 0x0,
-    0x0, 0xb, 0xf0, 0xbf, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf3, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0xbf, 0x33, 0x33, 0x33, 0x33, 0x39, 0xf3,
-    0x8f, 0x20, 0x0, 0x0, 0x0, 0xa, 0xf0, 0x2f,
-    0xa0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x7, 0xf8,
-    0x0, 0x0, 0x3, 0xee, 0x10, 0x0, 0x8f, 0xe9,
-    0x67, 0xbf, 0xd2, 0x0, 0x0, 0x3, 0xae, 0xff,
-    0xc7, 0x0, 0x0,
-
-    /* U+04EA "Ӫ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xe0, 0x8, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0x0,
-    0x7f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xfe, 0xb6, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xcf, 0xfc, 0xaa, 0xbf, 0xfe,
-    0x60, 0x0, 0x0, 0x3, 0xff, 0x91, 0x0, 0x0,
-    0x5, 0xef, 0x90, 0x0, 0x1, 0xef, 0x40, 0x0,
-    0x0, 0x0, 0x1, 0xcf, 0x70, 0x0, 0xaf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x10, 0x1f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf8,
-    0x6, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xc0, 0x8f, 0x52, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0xef, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x8f, 0x75, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0xef, 0x6, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xc0,
-    0x1f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf8, 0x0, 0xaf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0x10, 0x1, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x1, 0xcf, 0x70, 0x0, 0x3, 0xff, 0x81,
-    0x0, 0x0, 0x5, 0xef, 0x90, 0x0, 0x0, 0x2,
-    0xcf, 0xfc, 0xa9, 0xbe, 0xfe, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xfe, 0xb6, 0x0, 0x0,
-    0x0,
-
-    /* U+04EB "ӫ" */
-    0x0, 0x3, 0xf6, 0x0, 0xdb, 0x0, 0x0, 0x0,
-    0x4, 0xf7, 0x1, 0xec, 0x0, 0x0, 0x0, 0x0,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xae, 0xff,
-    0xc7, 0x0, 0x0, 0x0, 0x8f, 0xe8, 0x67, 0xbf,
-    0xe2, 0x0, 0x8, 0xf9, 0x0, 0x0, 0x3, 0xee,
-    0x10, 0x2f, 0xb0, 0x0, 0x0, 0x0, 0x3f, 0xa0,
-    0x8f, 0x30, 0x0, 0x0, 0x0, 0xb, 0xf0, 0xbf,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf3, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0xbf, 0x33, 0x33,
-    0x33, 0x33, 0x39, 0xf3, 0x8f, 0x20, 0x0, 0x0,
-    0x0, 0xa, 0xf0, 0x2f, 0xa0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x7, 0xf8, 0x0, 0x0, 0x3, 0xee,
-    0x10, 0x0, 0x8f, 0xe9, 0x67, 0xbf, 0xd2, 0x0,
-    0x0, 0x3, 0xae, 0xff, 0xc7, 0x0, 0x0,
-
-    /* U+04EC "Ӭ" */
-    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x50, 0x2f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x40, 0x2e, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xad, 0xff, 0xea, 0x50, 0x0, 0x0,
-    0x3, 0xdf, 0xfc, 0xaa, 0xcf, 0xfd, 0x30, 0x0,
-    0xe, 0xf7, 0x0, 0x0, 0x1, 0x8f, 0xf3, 0x0,
-    0x3, 0x20, 0x0, 0x0, 0x0, 0x4, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf5,
-    0x0, 0x0, 0x7, 0x88, 0x88, 0x88, 0x8a, 0xf7,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x90,
-    0x3, 0x20, 0x0, 0x0, 0x0, 0x4, 0xfe, 0x10,
-    0xe, 0xf7, 0x0, 0x0, 0x1, 0x8f, 0xf3, 0x0,
-    0x2, 0xdf, 0xfc, 0xaa, 0xcf, 0xfd, 0x30, 0x0,
-    0x0, 0x5, 0xad, 0xff, 0xeb, 0x50, 0x0, 0x0,
-
-    /* U+04ED "ӭ" */
-    0x0, 0xb, 0xd0, 0x7, 0xf3, 0x0, 0x0, 0x0,
-    0xce, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4a, 0xef, 0xfd, 0x81, 0x0,
-    0x0, 0xbf, 0xd8, 0x67, 0xbf, 0xf4, 0x0, 0xb,
-    0x60, 0x0, 0x0, 0x2d, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x40, 0x0, 0x0, 0x11, 0x11, 0x13,
-    0xf7, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x3, 0x44, 0x44, 0x46, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xd0, 0x9, 0x50, 0x0, 0x0, 0x2d,
-    0xf3, 0x0, 0xbf, 0xd9, 0x77, 0xbf, 0xe4, 0x0,
-    0x0, 0x4a, 0xef, 0xfd, 0x81, 0x0, 0x0,
-
-    /* U+04EE "Ӯ" */
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x22, 0x22, 0x22, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfc, 0x0, 0xbf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x30, 0x3, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xa0, 0x0, 0xb, 0xf2, 0x0, 0x0,
-    0x0, 0x9, 0xf2, 0x0, 0x0, 0x2f, 0xa0, 0x0,
-    0x0, 0x2, 0xf9, 0x0, 0x0, 0x0, 0xaf, 0x20,
-    0x0, 0x0, 0xaf, 0x10, 0x0, 0x0, 0x2, 0xfa,
-    0x0, 0x0, 0x3f, 0x80, 0x0, 0x0, 0x0, 0x9,
-    0xf3, 0x0, 0xb, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xb0, 0x3, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x30, 0xcd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfb, 0x4f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfe, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xa9, 0xef, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xae, 0xfc, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+04EF "ӯ" */
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x2, 0x22, 0x22, 0x22, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0xbe, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0xbf, 0x10,
-    0x0, 0x0, 0x9, 0xf1, 0x0, 0x4, 0xf7, 0x0,
-    0x0, 0x1, 0xfa, 0x0, 0x0, 0xd, 0xe0, 0x0,
-    0x0, 0x7f, 0x30, 0x0, 0x0, 0x6f, 0x50, 0x0,
-    0xd, 0xc0, 0x0, 0x0, 0x0, 0xec, 0x0, 0x4,
-    0xf5, 0x0, 0x0, 0x0, 0x8, 0xf3, 0x0, 0xbe,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x2f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x19, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf9, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x30,
-    0x0, 0x6f, 0x60, 0x0, 0x0, 0x0, 0x3f, 0xb8,
-    0xaf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x8d, 0xfe,
-    0x90, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+04F0 "Ӱ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0x0, 0xcf, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xa0, 0xa, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xc0, 0xb, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf3, 0x0, 0x3f, 0xa0, 0x0, 0x0,
-    0x0, 0x1, 0xfa, 0x0, 0x0, 0xbf, 0x20, 0x0,
-    0x0, 0x0, 0x9f, 0x20, 0x0, 0x2, 0xfa, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0xa, 0xf2,
-    0x0, 0x0, 0xa, 0xf1, 0x0, 0x0, 0x0, 0x2f,
-    0xa0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x30, 0x0, 0xbe, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfb, 0x0, 0x3f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf3, 0xc, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xb4, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xec, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8a, 0x9e, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xef, 0xc5, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+04F1 "ӱ" */
-    0x0, 0x0, 0x9e, 0x10, 0x5f, 0x40, 0x0, 0x0,
-    0x0, 0xa, 0xf1, 0x6, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0xbe, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0xbf, 0x10,
-    0x0, 0x0, 0x9, 0xf1, 0x0, 0x4, 0xf7, 0x0,
-    0x0, 0x1, 0xfa, 0x0, 0x0, 0xd, 0xe0, 0x0,
-    0x0, 0x7f, 0x30, 0x0, 0x0, 0x6f, 0x50, 0x0,
-    0xd, 0xc0, 0x0, 0x0, 0x0, 0xec, 0x0, 0x4,
-    0xf5, 0x0, 0x0, 0x0, 0x8, 0xf3, 0x0, 0xbe,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x2f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x19, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf9, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x30,
-    0x0, 0x6f, 0x60, 0x0, 0x0, 0x0, 0x3f, 0xb8,
-    0xaf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x8d, 0xfe,
-    0x90, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+04F2 "Ӳ" */
-    0x0, 0x0, 0x0, 0xc, 0xe2, 0xd, 0xd1, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf3, 0xa, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf4, 0x6, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xc0, 0xb, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf3, 0x0, 0x3f, 0xa0, 0x0, 0x0,
-    0x0, 0x1, 0xfa, 0x0, 0x0, 0xbf, 0x20, 0x0,
-    0x0, 0x0, 0x9f, 0x20, 0x0, 0x2, 0xfa, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0xa, 0xf2,
-    0x0, 0x0, 0xa, 0xf1, 0x0, 0x0, 0x0, 0x2f,
-    0xa0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x30, 0x0, 0xbe, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfb, 0x0, 0x3f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf3, 0xc, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xb4, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xec, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8a, 0x9e, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xef, 0xc5, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+04F3 "ӳ" */
-    0x0, 0x0, 0x0, 0x6f, 0x60, 0x8f, 0x40, 0x0,
-    0x0, 0x0, 0x3f, 0x80, 0x4f, 0x60, 0x0, 0x0,
-    0x0, 0x1e, 0x90, 0x2e, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0xb, 0xe0, 0x2, 0xf9, 0x0,
-    0x0, 0x0, 0x2, 0xf8, 0x0, 0xb, 0xf1, 0x0,
-    0x0, 0x0, 0x9f, 0x10, 0x0, 0x4f, 0x70, 0x0,
-    0x0, 0x1f, 0xa0, 0x0, 0x0, 0xde, 0x0, 0x0,
-    0x7, 0xf3, 0x0, 0x0, 0x6, 0xf5, 0x0, 0x0,
-    0xdc, 0x0, 0x0, 0x0, 0xe, 0xc0, 0x0, 0x4f,
-    0x50, 0x0, 0x0, 0x0, 0x8f, 0x30, 0xb, 0xe0,
-    0x0, 0x0, 0x0, 0x1, 0xfa, 0x2, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf1, 0x9f, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x3, 0x0,
-    0x6, 0xf6, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x8a,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x8, 0xdf, 0xe9,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+04F4 "Ӵ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xed, 0x0, 0xaf, 0x20, 0x0, 0x0, 0x0,
-    0xdc, 0x0, 0x9e, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0xfb, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xfb, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x0, 0xfb,
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0x0, 0xfb, 0x9f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0xfb, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xfb, 0x8f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xfb, 0x4f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xfb, 0xc, 0xf9, 0x10, 0x0, 0x0,
-    0x39, 0xfb, 0x2, 0xdf, 0xfb, 0x9a, 0xbe, 0xff,
-    0xfb, 0x0, 0x7, 0xce, 0xff, 0xda, 0x51, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfb,
-
-    /* U+04F5 "ӵ" */
-    0x0, 0x7f, 0x30, 0x3f, 0x60, 0x0, 0x8, 0xf3,
-    0x4, 0xf7, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xed, 0x0,
-    0x0, 0x0, 0xc, 0xfe, 0xd0, 0x0, 0x0, 0x0,
-    0xcf, 0xed, 0x0, 0x0, 0x0, 0xc, 0xfe, 0xd0,
-    0x0, 0x0, 0x0, 0xcf, 0xdd, 0x0, 0x0, 0x0,
-    0xc, 0xfb, 0xf3, 0x0, 0x0, 0x0, 0xcf, 0x4f,
-    0xe6, 0x22, 0x36, 0xbf, 0xf0, 0x5d, 0xff, 0xff,
-    0xe9, 0xdf, 0x0, 0x2, 0x44, 0x20, 0xc, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf0,
-
-    /* U+04F6 "Ӷ" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x2f, 0xd9,
-    0x99, 0x99, 0x99, 0x94, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xd9, 0x92, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf3, 0x0, 0x0, 0x0,
-
-    /* U+04F7 "ӷ" */
-    0x9f, 0xff, 0xff, 0xff, 0xf5, 0x9f, 0x98, 0x88,
-    0x88, 0x82, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x9f,
-    0x20, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0,
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0,
-    0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x9f,
-    0x98, 0x10, 0x0, 0x0, 0xaf, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x7f, 0x20, 0x0, 0x0, 0x0, 0x7f,
-    0x20, 0x0, 0x0, 0x0, 0x7f, 0x20, 0x0, 0x0,
-
-    /* U+04F8 "Ӹ" */
-    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf8, 0x1, 0xec,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x70,
-    0xd, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfa, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xa2, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfa, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xa2, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfa, 0x2f,
-    0xa2, 0x22, 0x22, 0x10, 0x0, 0x0, 0x0, 0x1f,
-    0xa2, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x50, 0x0,
-    0x1, 0xfa, 0x2f, 0xb5, 0x55, 0x55, 0x69, 0xef,
-    0xa0, 0x0, 0x1f, 0xa2, 0xf9, 0x0, 0x0, 0x0,
-    0x1, 0xcf, 0x60, 0x1, 0xfa, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x2, 0xfc, 0x0, 0x1f, 0xa2, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xe0, 0x1, 0xfa,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x0,
-    0x1f, 0xa2, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xe0, 0x1, 0xfa, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x4, 0xfa, 0x0, 0x1f, 0xa2, 0xf9, 0x0, 0x0,
-    0x0, 0x3, 0xef, 0x30, 0x1, 0xfa, 0x2f, 0xc7,
-    0x77, 0x77, 0x8b, 0xff, 0x50, 0x0, 0x1f, 0xa2,
-    0xff, 0xff, 0xff, 0xff, 0xd8, 0x20, 0x0, 0x1,
-    0xfa,
-
-    /* U+04F9 "ӹ" */
-    0x0, 0x0, 0x3f, 0x70, 0xd, 0xb0, 0x0, 0x0,
-    0x0, 0x3, 0xf8, 0x0, 0xec, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x69, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf6, 0x9f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x69, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf6, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x69, 0xff, 0xff, 0xff, 0xd8,
-    0x0, 0x4, 0xf6, 0x9f, 0x53, 0x33, 0x5a, 0xfc,
-    0x0, 0x4f, 0x69, 0xf2, 0x0, 0x0, 0x7, 0xf6,
-    0x4, 0xf6, 0x9f, 0x20, 0x0, 0x0, 0x2f, 0x90,
-    0x4f, 0x69, 0xf2, 0x0, 0x0, 0x3, 0xf8, 0x4,
-    0xf6, 0x9f, 0x20, 0x0, 0x0, 0x9f, 0x40, 0x4f,
-    0x69, 0xf6, 0x44, 0x46, 0xbf, 0xa0, 0x4, 0xf6,
-    0x9f, 0xff, 0xff, 0xec, 0x60, 0x0, 0x4f, 0x60,
-
-    /* U+04FA "Ӻ" */
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x9f, 0xa9, 0x99, 0x99, 0x99, 0x91, 0x0,
-    0x9, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x1a, 0xf4, 0x11,
-    0x11, 0x11, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x4, 0x4b, 0xf6, 0x44, 0x44,
-    0x44, 0x10, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xa9, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x80, 0x0, 0x0, 0x0, 0x6, 0xc8,
-    0x9f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x3b, 0xff,
-    0xb3, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+04FB "ӻ" */
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xe0, 0x1, 0xfd,
-    0x88, 0x88, 0x87, 0x0, 0x1f, 0x90, 0x0, 0x0,
-    0x0, 0x1, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x90, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x34,
-    0xfb, 0x33, 0x33, 0x30, 0x0, 0x1f, 0x90, 0x0,
-    0x0, 0x0, 0x1, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x90, 0x0, 0x0, 0x0, 0x2, 0xfd, 0x85,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x90, 0x0, 0x0, 0x0, 0x6, 0xf7, 0x0, 0x0,
-    0x6c, 0x89, 0xfe, 0x10, 0x0, 0x4, 0xcf, 0xfb,
-    0x20, 0x0, 0x0,
-
-    /* U+04FC "Ӽ" */
-    0xb, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60,
-    0x1e, 0xe1, 0x0, 0x0, 0x0, 0x4f, 0xa0, 0x0,
-    0x5f, 0xb0, 0x0, 0x0, 0x1e, 0xe1, 0x0, 0x0,
-    0x9f, 0x60, 0x0, 0xb, 0xf4, 0x0, 0x0, 0x0,
-    0xdf, 0x20, 0x6, 0xf8, 0x0, 0x0, 0x0, 0x3,
-    0xfd, 0x2, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf9, 0xcf, 0x20, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xdf,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2, 0x7f,
-    0xa0, 0x0, 0x0, 0x0, 0x9, 0xf6, 0x0, 0xaf,
-    0x60, 0x0, 0x0, 0x4, 0xfb, 0x0, 0x0, 0xdf,
-    0x30, 0x0, 0x1, 0xee, 0x10, 0x0, 0x3, 0xfd,
-    0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x7, 0xf8,
-    0x0, 0x7f, 0x90, 0x0, 0x0, 0x0, 0xe, 0xf1,
-    0x2f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x2c, 0x89, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x2, 0xbe, 0xfc, 0x40,
-
-    /* U+04FD "ӽ" */
-    0xd, 0xe1, 0x0, 0x0, 0x5, 0xf9, 0x0, 0x3f,
-    0xb0, 0x0, 0x2, 0xed, 0x0, 0x0, 0x7f, 0x70,
-    0x0, 0xcf, 0x20, 0x0, 0x0, 0xbf, 0x30, 0x8f,
-    0x50, 0x0, 0x0, 0x1, 0xed, 0x5f, 0xa0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfe, 0xf5, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x1d,
-    0xf2, 0x0, 0x0, 0x1, 0xee, 0x10, 0x2f, 0xd0,
-    0x0, 0x0, 0xbf, 0x30, 0x0, 0x5f, 0x90, 0x0,
-    0x7f, 0x70, 0x0, 0x0, 0xaf, 0x30, 0x3f, 0xb0,
-    0x0, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x30, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf1,
-    0x0, 0x0, 0x0, 0xba, 0x7c, 0xfa, 0x0, 0x0,
-    0x0, 0x7, 0xdf, 0xe8, 0x0,
-
-    /* U+04FE "Ӿ" */
-    0x7, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80,
-    0x0, 0xcf, 0x40, 0x0, 0x0, 0x3, 0xfd, 0x0,
-    0x0, 0x2f, 0xe0, 0x0, 0x0, 0xd, 0xf3, 0x0,
-    0x0, 0x7, 0xfa, 0x0, 0x0, 0x9f, 0x70, 0x0,
-    0x0, 0x0, 0xcf, 0x50, 0x4, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe1, 0x1e, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfa, 0xaf, 0x70, 0x0, 0x0,
-    0x0, 0x1, 0x11, 0xcf, 0xfd, 0x11, 0x10, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x24, 0x44, 0xef, 0xff, 0x54, 0x42, 0x0,
-    0x0, 0x0, 0x7, 0xfa, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xd0, 0xd, 0xf5, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0x20, 0x2, 0xfe, 0x10, 0x0,
-    0x0, 0xa, 0xf6, 0x0, 0x0, 0x6f, 0xc0, 0x0,
-    0x0, 0x6f, 0xa0, 0x0, 0x0, 0xa, 0xf8, 0x0,
-    0x2, 0xfd, 0x10, 0x0, 0x0, 0x0, 0xdf, 0x30,
-    0xd, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe1,
-
-    /* U+04FF "ӿ" */
-    0xa, 0xf4, 0x0, 0x0, 0x0, 0xde, 0x10, 0x1e,
-    0xe1, 0x0, 0x0, 0x9f, 0x40, 0x0, 0x4f, 0xb0,
-    0x0, 0x5f, 0x80, 0x0, 0x0, 0x8f, 0x60, 0x1e,
-    0xc0, 0x0, 0x0, 0x0, 0xcf, 0x3c, 0xf2, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x2, 0x35,
-    0xff, 0xfa, 0x33, 0x0, 0x0, 0x0, 0xde, 0x2c,
-    0xf3, 0x0, 0x0, 0x0, 0x9f, 0x40, 0x1e, 0xe1,
-    0x0, 0x0, 0x6f, 0x80, 0x0, 0x4f, 0xb0, 0x0,
-    0x2f, 0xc0, 0x0, 0x0, 0x8f, 0x70, 0xd, 0xe1,
-    0x0, 0x0, 0x0, 0xcf, 0x40,
-
     /* U+2022 "•" */
     0x5, 0xb6, 0x2, 0xff, 0xf3, 0x3f, 0xff, 0x40,
     0x9f, 0xa0
@@ -8358,228 +4095,7 @@ static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 26029, .adv_w = 250, .box_w = 14, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
     {.bitmap_index = 26183, .adv_w = 196, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
     {.bitmap_index = 26282, .adv_w = 113, .box_w = 10, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 26372, .adv_w = 253, .box_w = 13, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 26515, .adv_w = 253, .box_w = 13, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 26658, .adv_w = 317, .box_w = 19, .box_h = 18, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 26829, .adv_w = 220, .box_w = 12, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 26961, .adv_w = 271, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 27097, .adv_w = 241, .box_w = 13, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 27208, .adv_w = 119, .box_w = 3, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 27234, .adv_w = 116, .box_w = 7, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 27311, .adv_w = 202, .box_w = 11, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 27405, .adv_w = 455, .box_w = 28, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 27643, .adv_w = 455, .box_w = 26, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 27864, .adv_w = 321, .box_w = 19, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 28026, .adv_w = 270, .box_w = 15, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 28191, .adv_w = 316, .box_w = 15, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 28356, .adv_w = 261, .box_w = 17, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 28543, .adv_w = 310, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 28701, .adv_w = 286, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 28854, .adv_w = 279, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 28982, .adv_w = 288, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 29110, .adv_w = 220, .box_w = 12, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 29212, .adv_w = 305, .box_w = 19, .box_h = 21, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 29412, .adv_w = 253, .box_w = 13, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 29523, .adv_w = 388, .box_w = 24, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 29727, .adv_w = 244, .box_w = 14, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 29853, .adv_w = 316, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 29981, .adv_w = 316, .box_w = 15, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 30146, .adv_w = 270, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 30274, .adv_w = 301, .box_w = 17, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 30419, .adv_w = 370, .box_w = 19, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 30581, .adv_w = 315, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 30709, .adv_w = 327, .box_w = 19, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 30871, .adv_w = 317, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 30999, .adv_w = 272, .box_w = 14, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 31118, .adv_w = 275, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 31254, .adv_w = 226, .box_w = 14, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 31373, .adv_w = 261, .box_w = 17, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 31518, .adv_w = 352, .box_w = 20, .box_h = 20, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 31718, .adv_w = 250, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 31854, .adv_w = 318, .box_w = 18, .box_h = 21, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 32043, .adv_w = 281, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 32162, .adv_w = 420, .box_w = 22, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 32349, .adv_w = 429, .box_w = 25, .box_h = 21, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 32612, .adv_w = 315, .box_w = 19, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 32774, .adv_w = 376, .box_w = 19, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 32936, .adv_w = 273, .box_w = 14, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 33055, .adv_w = 271, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 33191, .adv_w = 419, .box_w = 23, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 33387, .adv_w = 281, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 33506, .adv_w = 224, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 33578, .adv_w = 253, .box_w = 14, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 33711, .adv_w = 233, .box_w = 12, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 33789, .adv_w = 182, .box_w = 10, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 33854, .adv_w = 250, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 33974, .adv_w = 237, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 34059, .adv_w = 317, .box_w = 20, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 34189, .adv_w = 205, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 34267, .adv_w = 264, .box_w = 13, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 34352, .adv_w = 264, .box_w = 13, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 34469, .adv_w = 223, .box_w = 12, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 34547, .adv_w = 243, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 34632, .adv_w = 303, .box_w = 15, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 34730, .adv_w = 259, .box_w = 12, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 34808, .adv_w = 244, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 34899, .adv_w = 259, .box_w = 12, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 34977, .adv_w = 263, .box_w = 14, .box_h = 18, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 35103, .adv_w = 216, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 35181, .adv_w = 182, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 35259, .adv_w = 214, .box_w = 15, .box_h = 18, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 35394, .adv_w = 301, .box_w = 17, .box_h = 23, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 35590, .adv_w = 202, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 35675, .adv_w = 263, .box_w = 14, .box_h = 16, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 35787, .adv_w = 230, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 35859, .adv_w = 356, .box_w = 18, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 35976, .adv_w = 356, .box_w = 20, .box_h = 16, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 36136, .adv_w = 238, .box_w = 15, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 36234, .adv_w = 301, .box_w = 15, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 36332, .adv_w = 216, .box_w = 11, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 36404, .adv_w = 219, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 36489, .adv_w = 332, .box_w = 18, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 36606, .adv_w = 233, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 36684, .adv_w = 240, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 36801, .adv_w = 237, .box_w = 13, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 36912, .adv_w = 257, .box_w = 16, .box_h = 23, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 37096, .adv_w = 182, .box_w = 10, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 37186, .adv_w = 220, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 37264, .adv_w = 203, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 37336, .adv_w = 105, .box_w = 3, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 37363, .adv_w = 103, .box_w = 6, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 37414, .adv_w = 105, .box_w = 8, .box_h = 23, .ofs_x = -3, .ofs_y = -5},
-    {.bitmap_index = 37506, .adv_w = 354, .box_w = 22, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 37649, .adv_w = 362, .box_w = 20, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 37779, .adv_w = 257, .box_w = 16, .box_h = 18, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 37923, .adv_w = 223, .box_w = 12, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 38031, .adv_w = 264, .box_w = 13, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 38148, .adv_w = 214, .box_w = 15, .box_h = 23, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 38321, .adv_w = 245, .box_w = 11, .box_h = 16, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 38409, .adv_w = 308, .box_w = 19, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 38580, .adv_w = 229, .box_w = 14, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 38706, .adv_w = 339, .box_w = 21, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 38885, .adv_w = 261, .box_w = 16, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 38989, .adv_w = 327, .box_w = 19, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 39151, .adv_w = 248, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 39242, .adv_w = 287, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 39404, .adv_w = 221, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 39502, .adv_w = 326, .box_w = 18, .box_h = 26, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 39736, .adv_w = 271, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 39894, .adv_w = 282, .box_w = 17, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 40047, .adv_w = 228, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 40138, .adv_w = 281, .box_w = 14, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 40257, .adv_w = 268, .box_w = 14, .box_h = 18, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 40383, .adv_w = 221, .box_w = 12, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 40509, .adv_w = 172, .box_w = 9, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 40581, .adv_w = 233, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 40709, .adv_w = 193, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 40781, .adv_w = 269, .box_w = 14, .box_h = 21, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 40928, .adv_w = 227, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 41042, .adv_w = 404, .box_w = 25, .box_h = 21, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 41305, .adv_w = 331, .box_w = 21, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 41473, .adv_w = 244, .box_w = 14, .box_h = 22, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 41627, .adv_w = 205, .box_w = 12, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 41723, .adv_w = 287, .box_w = 16, .box_h = 21, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 41891, .adv_w = 223, .box_w = 13, .box_h = 16, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 41995, .adv_w = 279, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 42123, .adv_w = 229, .box_w = 12, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 42201, .adv_w = 278, .box_w = 17, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 42346, .adv_w = 223, .box_w = 14, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 42472, .adv_w = 312, .box_w = 20, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 42642, .adv_w = 248, .box_w = 16, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 42746, .adv_w = 324, .box_w = 18, .box_h = 21, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 42935, .adv_w = 266, .box_w = 14, .box_h = 16, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 43047, .adv_w = 418, .box_w = 24, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 43251, .adv_w = 337, .box_w = 19, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 43375, .adv_w = 462, .box_w = 26, .box_h = 21, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 43648, .adv_w = 372, .box_w = 21, .box_h = 19, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 43848, .adv_w = 373, .box_w = 21, .box_h = 18, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 44037, .adv_w = 305, .box_w = 17, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 44148, .adv_w = 275, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 44316, .adv_w = 216, .box_w = 12, .box_h = 16, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 44412, .adv_w = 226, .box_w = 14, .box_h = 21, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 44559, .adv_w = 182, .box_w = 12, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 44655, .adv_w = 250, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 44791, .adv_w = 215, .box_w = 14, .box_h = 18, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 44917, .adv_w = 250, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 45053, .adv_w = 215, .box_w = 14, .box_h = 18, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 45179, .adv_w = 265, .box_w = 17, .box_h = 21, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 45358, .adv_w = 202, .box_w = 14, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 45470, .adv_w = 371, .box_w = 23, .box_h = 21, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 45712, .adv_w = 291, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 45856, .adv_w = 290, .box_w = 17, .box_h = 21, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 46035, .adv_w = 238, .box_w = 13, .box_h = 16, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 46139, .adv_w = 281, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 46258, .adv_w = 230, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 46330, .adv_w = 281, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 46458, .adv_w = 257, .box_w = 13, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 46575, .adv_w = 374, .box_w = 23, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 46771, .adv_w = 289, .box_w = 17, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 46882, .adv_w = 374, .box_w = 23, .box_h = 21, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 47124, .adv_w = 289, .box_w = 17, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 47260, .adv_w = 119, .box_w = 3, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 47286, .adv_w = 388, .box_w = 24, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 47550, .adv_w = 317, .box_w = 20, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 47730, .adv_w = 270, .box_w = 15, .box_h = 22, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 47895, .adv_w = 223, .box_w = 12, .box_h = 18, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 48003, .adv_w = 250, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 48123, .adv_w = 313, .box_w = 15, .box_h = 22, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 48288, .adv_w = 262, .box_w = 12, .box_h = 18, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 48396, .adv_w = 324, .box_w = 18, .box_h = 21, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 48585, .adv_w = 266, .box_w = 14, .box_h = 16, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 48697, .adv_w = 280, .box_w = 14, .box_h = 21, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 48844, .adv_w = 229, .box_w = 11, .box_h = 16, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 48932, .adv_w = 381, .box_w = 21, .box_h = 21, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 49153, .adv_w = 313, .box_w = 17, .box_h = 16, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 49289, .adv_w = 105, .box_w = 3, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 49316, .adv_w = 286, .box_w = 18, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 49514, .adv_w = 224, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 49613, .adv_w = 286, .box_w = 18, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 49811, .adv_w = 224, .box_w = 11, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 49905, .adv_w = 394, .box_w = 24, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 50109, .adv_w = 380, .box_w = 22, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 50252, .adv_w = 253, .box_w = 13, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 50395, .adv_w = 240, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 50512, .adv_w = 316, .box_w = 18, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 50665, .adv_w = 237, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 50750, .adv_w = 316, .box_w = 18, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 50948, .adv_w = 237, .box_w = 13, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 51059, .adv_w = 388, .box_w = 24, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 51323, .adv_w = 317, .box_w = 20, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 51493, .adv_w = 244, .box_w = 14, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 51647, .adv_w = 205, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 51755, .adv_w = 236, .box_w = 14, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 51874, .adv_w = 197, .box_w = 13, .box_h = 18, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 51991, .adv_w = 316, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 52149, .adv_w = 264, .box_w = 13, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 52260, .adv_w = 316, .box_w = 15, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 52425, .adv_w = 264, .box_w = 13, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 52536, .adv_w = 327, .box_w = 19, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 52745, .adv_w = 244, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 52864, .adv_w = 327, .box_w = 19, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 53026, .adv_w = 248, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 53117, .adv_w = 327, .box_w = 19, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 53326, .adv_w = 248, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 53445, .adv_w = 271, .box_w = 16, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 53621, .adv_w = 219, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 53732, .adv_w = 261, .box_w = 17, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 53911, .adv_w = 214, .box_w = 15, .box_h = 22, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 54076, .adv_w = 261, .box_w = 17, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 54263, .adv_w = 214, .box_w = 15, .box_h = 22, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 54428, .adv_w = 261, .box_w = 17, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 54615, .adv_w = 214, .box_w = 15, .box_h = 23, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 54788, .adv_w = 281, .box_w = 14, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 54942, .adv_w = 230, .box_w = 11, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 55036, .adv_w = 220, .box_w = 12, .box_h = 21, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 55162, .adv_w = 182, .box_w = 10, .box_h = 16, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 55242, .adv_w = 376, .box_w = 19, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 55451, .adv_w = 301, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 55579, .adv_w = 234, .box_w = 15, .box_h = 22, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 55744, .adv_w = 184, .box_w = 11, .box_h = 18, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 55843, .adv_w = 250, .box_w = 15, .box_h = 22, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 56008, .adv_w = 201, .box_w = 13, .box_h = 18, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 56125, .adv_w = 257, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 56261, .adv_w = 213, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 56346, .adv_w = 113, .box_w = 5, .box_h = 4, .ofs_x = 1, .ofs_y = 5}
+    {.bitmap_index = 26372, .adv_w = 113, .box_w = 5, .box_h = 4, .ofs_x = 1, .ofs_y = 5}
 };
 
 /*---------------------
@@ -8590,10 +4106,6 @@ static const uint16_t unicode_list_1[] = {
     0x0, 0x23, 0x43
 };
 
-static const uint16_t unicode_list_4[] = {
-    0x0, 0x1, 0x8, 0x9, 0x10, 0x11, 0x12, 0x13
-};
-
 /*Collect the unicode lists and glyph_id offsets*/
 static const lv_font_fmt_txt_cmap_t cmaps[] =
 {
@@ -8610,23 +4122,7 @@ static const lv_font_fmt_txt_cmap_t cmaps[] =
         .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
     },
     {
-        .range_start = 1024, .range_length = 96, .glyph_id_start = 227,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 1122, .range_length = 20, .glyph_id_start = 323,
-        .unicode_list = unicode_list_4, .glyph_id_ofs_list = NULL, .list_length = 8, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    },
-    {
-        .range_start = 1162, .range_length = 59, .glyph_id_start = 331,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 1222, .range_length = 58, .glyph_id_start = 390,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 8226, .range_length = 1, .glyph_id_start = 448,
+        .range_start = 8226, .range_length = 1, .glyph_id_start = 227,
         .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
     }
 };
@@ -8652,7 +4148,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmaps = cmaps,
     .kern_dsc = NULL,
     .kern_scale = 0,
-    .cmap_num = 8,
+    .cmap_num = 4,
     .bpp = 4,
     .kern_classes = 0,
     .bitmap_format = 0,
@@ -1,7 +1,7 @@
 /*******************************************************************************
  * Size: 32 px
  * Bpp: 4
- * Opts: --no-compress --bpp 4 --size 32 --font Montserrat-Medium-static.ttf --range 0x20-0x7F,0x100-0x17F,0x400-0x4FF --symbols °•ąćęłńóśźżĄĆĘŁŃÓŚŹŻ --format lvgl -o font_montserrat_int_32.c
+ * Opts: --no-compress --bpp 4 --size 32 --font Montserrat-Medium-static.ttf --range 0x20-0x7F,0x100-0x17F --symbols °•ąćęłńóśźżĄĆĘŁŃÓŚŹŻ --format lvgl -o font_montserrat_int_32.c
  ******************************************************************************/
 
 #ifdef LV_LVGL_H_INCLUDE_SIMPLE
@@ -6232,6922 +6232,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0x1, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1f,
     0xf2, 0x0, 0x0, 0x0,
 
-    /* U+0400 "Ѐ" */
-    0x0, 0x4, 0x88, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x78, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0x31, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x3f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x3, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-
-    /* U+0401 "Ё" */
-    0x0, 0x0, 0x3b, 0x60, 0x0, 0x6b, 0x30, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0x0, 0xf, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0xaf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x3f, 0xf3, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x3, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-
-    /* U+0402 "Ђ" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x1, 0x11, 0x11, 0x11, 0xbf, 0xa1,
-    0x11, 0x11, 0x11, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x90, 0x0, 0x1,
-    0x33, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x92, 0x7b, 0xff, 0xff, 0xff, 0xd6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xfc, 0xbb, 0xdf, 0xff, 0xd2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xfd, 0x73, 0x0, 0x0,
-    0x1, 0x8f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x90, 0x0, 0x0, 0x0,
-    0x1, 0x7f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x90, 0x0, 0xb, 0xed, 0xef, 0xff, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x90, 0x0,
-    0xd, 0xff, 0xff, 0xc6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x23, 0x20,
-    0x0, 0x0, 0x0,
-
-    /* U+0403 "Ѓ" */
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x88, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x77, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x3f, 0xf2, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0404 "Є" */
-    0x0, 0x0, 0x0, 0x2, 0x7b, 0xef, 0xfe, 0xc9,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd5, 0x0, 0x0, 0x0, 0x4e,
-    0xff, 0xd8, 0x42, 0x23, 0x59, 0xef, 0xfa, 0x0,
-    0x0, 0x4f, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x2f, 0xfd, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x33, 0x0, 0xb, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xd2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0x40, 0x0, 0x4, 0xff,
-    0xe5, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x30,
-    0x0, 0x4, 0xef, 0xfd, 0x74, 0x22, 0x35, 0x9f,
-    0xff, 0xa0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x27, 0xbe, 0xff, 0xec, 0x94, 0x0, 0x0,
-
-    /* U+0405 "Ѕ" */
-    0x0, 0x0, 0x16, 0xbe, 0xff, 0xfd, 0xa6, 0x10,
-    0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x10, 0x0, 0x7f, 0xfd, 0x63, 0x0, 0x13,
-    0x6b, 0xff, 0x30, 0x2, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x28, 0x0, 0x8, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xc7, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xaf, 0xff, 0xfe, 0xb7,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x1, 0x5a, 0xef,
-    0xff, 0xfc, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x6a, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf6, 0x4, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf3, 0xe, 0xe5, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xdf, 0xc0, 0x1c, 0xff, 0xe8, 0x42, 0x0,
-    0x13, 0x8f, 0xff, 0x20, 0x0, 0x6e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x49,
-    0xce, 0xff, 0xfd, 0x94, 0x0, 0x0,
-
-    /* U+0406 "І" */
-    0x3f, 0xf1, 0x3f, 0xf1, 0x3f, 0xf1, 0x3f, 0xf1,
-    0x3f, 0xf1, 0x3f, 0xf1, 0x3f, 0xf1, 0x3f, 0xf1,
-    0x3f, 0xf1, 0x3f, 0xf1, 0x3f, 0xf1, 0x3f, 0xf1,
-    0x3f, 0xf1, 0x3f, 0xf1, 0x3f, 0xf1, 0x3f, 0xf1,
-    0x3f, 0xf1, 0x3f, 0xf1, 0x3f, 0xf1, 0x3f, 0xf1,
-    0x3f, 0xf1, 0x3f, 0xf1,
-
-    /* U+0407 "Ї" */
-    0xa, 0x90, 0x0, 0x3b, 0x60, 0x5f, 0xf5, 0x0,
-    0xaf, 0xf0, 0x2e, 0xd1, 0x0, 0x5f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x0, 0x0,
-
-    /* U+0408 "Ј" */
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x1,
-    0x11, 0x11, 0x11, 0x1e, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5, 0x2,
-    0x30, 0x0, 0x0, 0x0, 0x4f, 0xf2, 0x1e, 0xf3,
-    0x0, 0x0, 0x0, 0xcf, 0xd0, 0xc, 0xff, 0x93,
-    0x11, 0x4c, 0xff, 0x50, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x3, 0xae, 0xff, 0xda,
-    0x30, 0x0,
-
-    /* U+0409 "Љ" */
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x31, 0x11, 0x11, 0x11, 0x11, 0x1f, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xfe, 0xee, 0xee, 0xee,
-    0xec, 0x93, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x0, 0x0,
-    0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x15, 0xaf, 0xfe,
-    0x10, 0x0, 0x0, 0x3, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xfa, 0x0, 0x0, 0x0, 0x4f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf1, 0x0, 0x0,
-    0x5, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x50, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf8, 0x0, 0x0, 0x9, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x80, 0x0, 0x0,
-    0xcf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf7,
-    0x0, 0x0, 0x1f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x50, 0x0, 0x6, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xf1, 0x0, 0x1, 0xef,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf9, 0x2,
-    0x35, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x83, 0x33, 0x33, 0x33, 0x58, 0xef,
-    0xfc, 0x0, 0x8f, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x8, 0xff, 0xc5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xec, 0x82, 0x0, 0x0,
-
-    /* U+040A "Њ" */
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8,
-    0x10, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0, 0x0, 0x0,
-    0x3, 0x8e, 0xff, 0x60, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xdf, 0xf1, 0x3f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf6, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x3f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf8, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf4, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xdf, 0xd0, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0, 0x0, 0x0,
-    0x1, 0x6e, 0xff, 0x30, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe, 0xee, 0xee,
-    0xee, 0xff, 0xff, 0xd3, 0x0, 0x3f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xa5, 0x0, 0x0,
-
-    /* U+040B "Ћ" */
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x1, 0x11, 0x11, 0x11, 0xcf, 0x91,
-    0x11, 0x11, 0x11, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x0,
-    0x11, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x90, 0x59, 0xdf, 0xff, 0xfe, 0xa4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xc7, 0x41, 0x0,
-    0x26, 0xdf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xc2, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0,
-
-    /* U+040C "Ќ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x58, 0x82, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x48, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xe1, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf3, 0x3, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0, 0x3f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfa, 0x0,
-    0x3, 0xff, 0x10, 0x0, 0x0, 0x0, 0xa, 0xfd,
-    0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x20, 0x0, 0x3, 0xff, 0x10, 0x0, 0x0,
-    0x3, 0xff, 0x50, 0x0, 0x0, 0x3f, 0xf1, 0x0,
-    0x0, 0x1, 0xdf, 0x80, 0x0, 0x0, 0x3, 0xff,
-    0x10, 0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0x11, 0x11, 0x7f, 0xe1, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x10, 0x0,
-    0x6, 0xff, 0x60, 0x0, 0x0, 0x0, 0x3f, 0xf1,
-    0x0, 0x0, 0x9, 0xff, 0x30, 0x0, 0x0, 0x3,
-    0xff, 0x10, 0x0, 0x0, 0xc, 0xfe, 0x10, 0x0,
-    0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x1e, 0xfb,
-    0x0, 0x0, 0x3, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x4f, 0xf8, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf5, 0x0, 0x3, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf2, 0x0, 0x3f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xd0,
-    0x3, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xa0, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x70,
-
-    /* U+040D "Ѝ" */
-    0x0, 0x0, 0x6, 0x87, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xd1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xe3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x87, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xf9,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xf9, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xf9, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf9, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xbc, 0xf9,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfd,
-    0xc, 0xf9, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xf2, 0xc, 0xf9, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x50, 0xc, 0xf9, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x4f, 0xf8, 0x0, 0xc, 0xf9,
-    0x3f, 0xf1, 0x0, 0x0, 0x1, 0xef, 0xb0, 0x0,
-    0xc, 0xf9, 0x3f, 0xf1, 0x0, 0x0, 0xc, 0xfe,
-    0x10, 0x0, 0xc, 0xf9, 0x3f, 0xf1, 0x0, 0x0,
-    0x9f, 0xf3, 0x0, 0x0, 0xc, 0xf9, 0x3f, 0xf1,
-    0x0, 0x6, 0xff, 0x60, 0x0, 0x0, 0xc, 0xf9,
-    0x3f, 0xf1, 0x0, 0x3f, 0xf9, 0x0, 0x0, 0x0,
-    0xc, 0xf9, 0x3f, 0xf1, 0x1, 0xef, 0xc0, 0x0,
-    0x0, 0x0, 0xc, 0xf9, 0x3f, 0xf1, 0xb, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x3f, 0xf1,
-    0x8f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9,
-    0x3f, 0xf6, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf9, 0x3f, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf9, 0x3f, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x3f, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9,
-    0x3f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf9,
-
-    /* U+040E "Ў" */
-    0x0, 0x0, 0x4, 0x81, 0x0, 0x0, 0x0, 0x76,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf8, 0x0,
-    0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x93, 0x12, 0x6e, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xfc,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x43, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf2,
-    0x8, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x80, 0x1, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfe, 0x0, 0x0, 0x7f,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf6,
-    0x0, 0x0, 0xe, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xd0, 0x0, 0x0, 0x6, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0xef, 0x80, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1, 0x0, 0x0,
-    0x0, 0x1f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf8, 0x0, 0x0, 0x0, 0x9f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x10, 0x0, 0x2, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90,
-    0x0, 0xb, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf1, 0x0, 0x4f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf9, 0x0, 0xcf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x25, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xad, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x20, 0x29, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xef, 0xfb,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+040F "Џ" */
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf3, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf3, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf3,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf3, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf3, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x3f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf3, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf3, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x3f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf3, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf3, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf3, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x87, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0410 "А" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfd, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf6, 0xaf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xe0, 0x2f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x70, 0xb, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x0, 0x4, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf8, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x5f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xa0, 0x0, 0x0, 0xe, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x30, 0x0, 0x0, 0x7,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf5, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfe, 0xee, 0xee, 0xee, 0xee,
-    0xef, 0xfc, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0xe, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xb0, 0x0, 0x0, 0x6f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf3, 0x0,
-    0x0, 0xef, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfa, 0x0, 0x5, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x20,
-    0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x90, 0x4f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1,
-
-    /* U+0411 "Б" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x20, 0x3f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xb6, 0x0, 0x0, 0x3f,
-    0xfe, 0xee, 0xee, 0xee, 0xef, 0xff, 0xfe, 0x50,
-    0x3, 0xff, 0x10, 0x0, 0x0, 0x0, 0x2, 0x7e,
-    0xff, 0x50, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1d, 0xfe, 0x3, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf4, 0x3f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x73, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x73, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf3, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xfc, 0x3, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x2, 0x7e, 0xff, 0x20, 0x3f, 0xfe,
-    0xee, 0xee, 0xee, 0xef, 0xff, 0xfc, 0x20, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x94, 0x0,
-    0x0,
-
-    /* U+0412 "В" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc9, 0x30,
-    0x0, 0x3, 0xff, 0xee, 0xee, 0xee, 0xee, 0xff,
-    0xff, 0xb1, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x3a, 0xff, 0xc0, 0x3, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x50, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf9, 0x3,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xb0, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf9, 0x3, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x50, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xc0, 0x3, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x15, 0xcf, 0xa1, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x0,
-    0x3, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff,
-    0xfa, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x8f, 0xfc, 0x3, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf5, 0x3f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xa3, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xc3, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfa, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0x43, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x39, 0xff, 0xb0, 0x3f, 0xfe,
-    0xee, 0xee, 0xee, 0xee, 0xff, 0xff, 0x90, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc8, 0x20,
-    0x0,
-
-    /* U+0413 "Г" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x3f, 0xf2, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0414 "Д" */
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfe, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x6f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0xc, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x0,
-    0x0, 0x0, 0x5, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x15, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0xaf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x5a,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf5, 0xaf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x5a, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf5, 0xaf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0415 "Е" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x3f, 0xf3, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x3, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x3f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9,
-
-    /* U+0416 "Ж" */
-    0x5, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xa0,
-    0x0, 0xaf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0x10,
-    0x0, 0x1e, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf5, 0x0,
-    0x0, 0x5, 0xff, 0x30, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xb0, 0x0,
-    0x0, 0x0, 0xaf, 0xd0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x1e, 0xf7, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x2f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x20, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0xcf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x7, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xf6, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x2f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x31, 0x11, 0x1f,
-    0xf6, 0x11, 0x11, 0xcf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xfe, 0x10, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0xaf, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf5, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x1e, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xa0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x4, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfe, 0x10, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf4, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0xe, 0xfd, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x90, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x4, 0xff, 0x80, 0x0,
-    0x0, 0xd, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf3, 0x0,
-    0x0, 0x8f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfd, 0x0,
-    0x3, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x90,
-    0xd, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf3,
-
-    /* U+0417 "З" */
-    0x0, 0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xad, 0xff, 0xff, 0xd9, 0x30,
-    0x0, 0x0, 0x7, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x10, 0x0, 0xe, 0xfe, 0x95, 0x20, 0x1,
-    0x5a, 0xff, 0xd1, 0x0, 0x7, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x15,
-    0xdf, 0xc0, 0x0, 0x0, 0x0, 0xbe, 0xee, 0xef,
-    0xff, 0xe8, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xfb, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x14, 0xaf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf2, 0x13, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xd0, 0x9f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x1c, 0xff, 0x50, 0x5f, 0xfe, 0x94,
-    0x10, 0x1, 0x49, 0xff, 0xf7, 0x0, 0x1, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x40, 0x0, 0x0,
-    0x1, 0x6a, 0xdf, 0xff, 0xd9, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0418 "И" */
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0xf9, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xf9, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xf9, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf9,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xbc, 0xf9, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xfd, 0xc, 0xf9, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xf2, 0xc, 0xf9, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x50, 0xc, 0xf9,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x4f, 0xf8, 0x0,
-    0xc, 0xf9, 0x3f, 0xf1, 0x0, 0x0, 0x1, 0xef,
-    0xb0, 0x0, 0xc, 0xf9, 0x3f, 0xf1, 0x0, 0x0,
-    0xc, 0xfe, 0x10, 0x0, 0xc, 0xf9, 0x3f, 0xf1,
-    0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0, 0xc, 0xf9,
-    0x3f, 0xf1, 0x0, 0x6, 0xff, 0x60, 0x0, 0x0,
-    0xc, 0xf9, 0x3f, 0xf1, 0x0, 0x3f, 0xf9, 0x0,
-    0x0, 0x0, 0xc, 0xf9, 0x3f, 0xf1, 0x1, 0xef,
-    0xc0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x3f, 0xf1,
-    0xb, 0xfe, 0x10, 0x0, 0x0, 0x0, 0xc, 0xf9,
-    0x3f, 0xf1, 0x8f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf9, 0x3f, 0xf6, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf9, 0x3f, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x3f, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9,
-    0x3f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf9, 0x3f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf9,
-
-    /* U+0419 "Й" */
-    0x0, 0x0, 0xf, 0xb0, 0x0, 0x0, 0x7, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf2, 0x0, 0x0,
-    0xd, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfe,
-    0x62, 0x14, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4d, 0xff, 0xff, 0xe6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x14, 0x42, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xf9, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf9,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xf9, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf9, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xbc, 0xf9, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xfd, 0xc, 0xf9,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf2,
-    0xc, 0xf9, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x50, 0xc, 0xf9, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x4f, 0xf8, 0x0, 0xc, 0xf9, 0x3f, 0xf1,
-    0x0, 0x0, 0x1, 0xef, 0xb0, 0x0, 0xc, 0xf9,
-    0x3f, 0xf1, 0x0, 0x0, 0xc, 0xfe, 0x10, 0x0,
-    0xc, 0xf9, 0x3f, 0xf1, 0x0, 0x0, 0x9f, 0xf3,
-    0x0, 0x0, 0xc, 0xf9, 0x3f, 0xf1, 0x0, 0x6,
-    0xff, 0x60, 0x0, 0x0, 0xc, 0xf9, 0x3f, 0xf1,
-    0x0, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0xc, 0xf9,
-    0x3f, 0xf1, 0x1, 0xef, 0xc0, 0x0, 0x0, 0x0,
-    0xc, 0xf9, 0x3f, 0xf1, 0xb, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0xc, 0xf9, 0x3f, 0xf1, 0x8f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x3f, 0xf6,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9,
-    0x3f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf9, 0x3f, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf9, 0x3f, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x3f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9,
-
-    /* U+041A "К" */
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xfe, 0x13, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x30, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x60, 0x3, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xa0, 0x0, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xd0, 0x0, 0x3,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x6f, 0xf2, 0x0,
-    0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x3f, 0xf5,
-    0x0, 0x0, 0x3, 0xff, 0x10, 0x0, 0x0, 0x1d,
-    0xf8, 0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0,
-    0xb, 0xfc, 0x0, 0x0, 0x0, 0x3, 0xff, 0x21,
-    0x11, 0x17, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x6f, 0xf6,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x10, 0x0, 0x0,
-    0x9f, 0xf3, 0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0,
-    0x0, 0x0, 0xcf, 0xe1, 0x0, 0x0, 0x3, 0xff,
-    0x10, 0x0, 0x0, 0x1, 0xef, 0xb0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x4, 0xff, 0x80,
-    0x0, 0x3, 0xff, 0x10, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x50, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0x20, 0x3, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfd, 0x0, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfa, 0x3,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf7,
-
-    /* U+041B "Л" */
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0xff, 0x31, 0x11, 0x11, 0x11, 0x11, 0x1f,
-    0xf5, 0x0, 0x0, 0x0, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf5, 0x0, 0x0, 0x0, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf5, 0x0, 0x0, 0x1, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf5, 0x0, 0x0, 0x1,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0x0, 0x0, 0x2, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf5, 0x0, 0x0, 0x2, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf5, 0x0, 0x0,
-    0x3, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x4, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf5, 0x0, 0x0, 0x5, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5, 0x0,
-    0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf5, 0x0, 0x0, 0x9, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf5, 0x0, 0x0, 0xc,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0x0, 0x0, 0x1f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf5, 0x0, 0x0, 0x6f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf5, 0x0, 0x1,
-    0xef, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x23, 0x5d, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf5, 0x8f, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5, 0x8f,
-    0xfc, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf5,
-
-    /* U+041C "М" */
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x3, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf0, 0x3f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0x3, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xff, 0xf0, 0x3f, 0xfc, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xfb, 0xff, 0x3, 0xff,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfe, 0x4f, 0xf0, 0x3f, 0xf0, 0x9f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x53, 0xff, 0x3,
-    0xff, 0x1, 0xef, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xb0, 0x3f, 0xf0, 0x3f, 0xf0, 0x6, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0x3, 0xff,
-    0x3, 0xff, 0x0, 0xc, 0xf6, 0x0, 0x0, 0x0,
-    0x9, 0xf9, 0x0, 0x3f, 0xf0, 0x3f, 0xf0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x2, 0xfe, 0x10, 0x3,
-    0xff, 0x3, 0xff, 0x0, 0x0, 0xaf, 0xa0, 0x0,
-    0x0, 0xcf, 0x60, 0x0, 0x3f, 0xf0, 0x3f, 0xf0,
-    0x0, 0x1, 0xff, 0x30, 0x0, 0x5f, 0xd0, 0x0,
-    0x3, 0xff, 0x3, 0xff, 0x0, 0x0, 0x7, 0xfd,
-    0x0, 0xe, 0xf4, 0x0, 0x0, 0x3f, 0xf0, 0x3f,
-    0xf0, 0x0, 0x0, 0xd, 0xf6, 0x8, 0xfa, 0x0,
-    0x0, 0x3, 0xff, 0x3, 0xff, 0x0, 0x0, 0x0,
-    0x4f, 0xf3, 0xff, 0x20, 0x0, 0x0, 0x3f, 0xf0,
-    0x3f, 0xf0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x80,
-    0x0, 0x0, 0x3, 0xff, 0x3, 0xff, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3f,
-    0xf0, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0x8, 0xf5,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x3, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf0, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x3, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf0,
-
-    /* U+041D "Н" */
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf8, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf8, 0x3f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x3f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf8, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf8, 0x3f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x3f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf8, 0x3f, 0xf3, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x1d, 0xf8, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf8, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf8, 0x3f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x3f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf8, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf8, 0x3f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x3f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf8, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf8,
-
-    /* U+041E "О" */
-    0x0, 0x0, 0x0, 0x0, 0x6a, 0xdf, 0xff, 0xdb,
-    0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x3d, 0xff, 0xe9, 0x53, 0x22,
-    0x48, 0xdf, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff,
-    0x50, 0x0, 0x0, 0x1e, 0xfe, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1c, 0xff, 0x30, 0x0, 0xb,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0xfd, 0x0, 0x3, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf6, 0x0,
-    0x9f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xc0, 0xe, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0x11, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf3, 0x2f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x52, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf5, 0x1f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x30, 0xef, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1, 0x9,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xfc, 0x0, 0x3f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x60,
-    0x0, 0xbf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xd0, 0x0, 0x1, 0xef, 0xe2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xf3,
-    0x0, 0x0, 0x3, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xef, 0xf5, 0x0, 0x0, 0x0, 0x3,
-    0xdf, 0xfe, 0x95, 0x21, 0x24, 0x8d, 0xff, 0xe4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xad, 0xff, 0xfd, 0xb6, 0x10,
-    0x0, 0x0, 0x0,
-
-    /* U+041F "П" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x3f, 0xf2, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x1b, 0xfa, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfa,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xfa, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfa, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfa, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfa,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xfa, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfa, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfa, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfa,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xfa, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfa, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfa, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfa,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xfa, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfa, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfa, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfa,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xfa, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfa,
-
-    /* U+0420 "Р" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x95, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x40, 0x0, 0x3f, 0xf3, 0x11, 0x11, 0x11,
-    0x24, 0x9f, 0xff, 0x60, 0x3, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x1b, 0xff, 0x30, 0x3f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfb, 0x3,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf1, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x33, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf4, 0x3f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x43, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1, 0x3f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfb,
-    0x3, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1b,
-    0xff, 0x30, 0x3f, 0xf3, 0x11, 0x11, 0x11, 0x24,
-    0x9f, 0xff, 0x60, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x40, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x94, 0x0, 0x0, 0x3, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0421 "С" */
-    0x0, 0x0, 0x0, 0x0, 0x5a, 0xdf, 0xff, 0xda,
-    0x61, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x2d,
-    0xff, 0xe9, 0x53, 0x22, 0x48, 0xdf, 0xfd, 0x20,
-    0x0, 0x3f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x5e, 0xf7, 0x0, 0x1e, 0xfe, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x16, 0x0, 0xa, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xe3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x60, 0x0, 0x3, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0x70,
-    0x0, 0x3, 0xdf, 0xfe, 0x95, 0x21, 0x24, 0x7d,
-    0xff, 0xd2, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xad, 0xff, 0xfd, 0xa6, 0x10, 0x0,
-
-    /* U+0422 "Т" */
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x1, 0x11, 0x11, 0x11, 0xcf,
-    0x91, 0x11, 0x11, 0x11, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf9, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0423 "У" */
-    0x1f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf2, 0x8, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x1, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfe,
-    0x0, 0x0, 0x7f, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf6, 0x0, 0x0, 0xe, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0,
-    0x6, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x40, 0x0, 0x0, 0x0, 0xef, 0x80, 0x0, 0x0,
-    0x0, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf1, 0x0, 0x0, 0x0, 0x1f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf8, 0x0, 0x0, 0x0, 0x9f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x10,
-    0x0, 0x2, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x90, 0x0, 0xb, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf1, 0x0, 0x4f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf9, 0x0, 0xcf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x25, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xad,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x20, 0x29, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1a, 0xef, 0xfb, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0424 "Ф" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x37, 0xad, 0xef, 0xff,
-    0xfd, 0xb8, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x10, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xe9,
-    0x41, 0x7, 0xfc, 0x0, 0x37, 0xcf, 0xff, 0x50,
-    0x0, 0x0, 0x3e, 0xfe, 0x50, 0x0, 0x0, 0x7f,
-    0xc0, 0x0, 0x0, 0x3c, 0xff, 0x70, 0x0, 0x1e,
-    0xfd, 0x10, 0x0, 0x0, 0x7, 0xfc, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x40, 0x8, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x7f, 0xc0, 0x0, 0x0, 0x0, 0xb,
-    0xfd, 0x0, 0xef, 0x70, 0x0, 0x0, 0x0, 0x7,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x3f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x85, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xfb, 0x6f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xb5,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xfb, 0x3f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x80, 0xef, 0x70, 0x0, 0x0, 0x0,
-    0x7, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4,
-    0x8, 0xff, 0x10, 0x0, 0x0, 0x0, 0x7f, 0xc0,
-    0x0, 0x0, 0x0, 0xb, 0xfe, 0x0, 0x1e, 0xfd,
-    0x10, 0x0, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x50, 0x0, 0x3f, 0xfe, 0x50, 0x0,
-    0x0, 0x7f, 0xc0, 0x0, 0x0, 0x2b, 0xff, 0x80,
-    0x0, 0x0, 0x2d, 0xff, 0xe8, 0x41, 0x7, 0xfc,
-    0x0, 0x36, 0xbf, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x6, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
-    0xf9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37,
-    0xbd, 0xef, 0xff, 0xfe, 0xc9, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x38, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0425 "Х" */
-    0x5, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xf2, 0x0, 0xa, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0xd, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xfa, 0x0, 0x0,
-    0x0, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0xd, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x7f, 0xf4, 0x0, 0x0,
-    0x9, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xe1, 0x0, 0x4, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xc0, 0x1, 0xef, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x70, 0xbf,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xaf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xdf, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xa0, 0xdf, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xd1,
-    0x3, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xf3, 0x0, 0x7, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0xb, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x1e, 0xfb, 0x0, 0x0,
-    0x0, 0x1e, 0xfd, 0x0, 0x0, 0x0, 0xc, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0,
-    0x7, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf4, 0x0, 0x3, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xe1, 0x0, 0xdf, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xb0,
-
-    /* U+0426 "Ц" */
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf0, 0x0, 0x3, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x0, 0x0, 0x3f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf0, 0x0, 0x3, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x0, 0x0, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0,
-    0x0, 0x3, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x0, 0x0, 0x3f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0,
-    0x3, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0, 0x3,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0, 0x3, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf0, 0x0, 0x3, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x0,
-    0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf0, 0x0, 0x3, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf0, 0x0, 0x3, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x0, 0x0, 0x3f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf0, 0x0, 0x3, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0x84,
-
-    /* U+0427 "Ч" */
-    0x1f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x91, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf9, 0x1f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x91, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf9, 0x1f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x91,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf9, 0x1f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x91, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf9, 0xf, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x90, 0xcf, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9, 0x5,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf,
-    0x90, 0xa, 0xff, 0xe7, 0x20, 0x0, 0x25, 0x9d,
-    0xff, 0xf9, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xef, 0x90, 0x0, 0x2, 0x8d, 0xff,
-    0xff, 0xeb, 0x72, 0xb, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x0, 0x0, 0x0, 0xbf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf9,
-
-    /* U+0428 "Ш" */
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x33, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf3, 0x3f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x33, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf3, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x33, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3, 0x3f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x33, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf3, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x33, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf3, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x33,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x33, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf3, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x33, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x33, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf3, 0x3f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x33, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf3, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-
-    /* U+0429 "Щ" */
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x30, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x30, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x30, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x30, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x30, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x30, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x30, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x30, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x30, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x30, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x30, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x30, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x30, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x30, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x30, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x30, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x30, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x30, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x30, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x40, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfb,
-
-    /* U+042A "Ъ" */
-    0xaf, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x11, 0x11, 0x1b, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x71, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe, 0xee, 0xee,
-    0xee, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x26, 0xdf,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2, 0x0, 0x0,
-    0x0, 0xa, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x80, 0x0, 0x0, 0x0, 0xaf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb, 0x0,
-    0x0, 0x0, 0xa, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xd0, 0x0, 0x0, 0x0, 0xaf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0x0, 0x0, 0x0, 0xa, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xa0, 0x0, 0x0, 0x0,
-    0xaf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf6, 0x0, 0x0, 0x0, 0xa, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1c, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xa0, 0x0, 0x0, 0x0, 0x2, 0x6e,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0xa, 0xff, 0xee,
-    0xee, 0xee, 0xef, 0xff, 0xfd, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xa5, 0x0, 0x0,
-
-    /* U+042B "Ы" */
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x83, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf8, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x83, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf8, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x83, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf8, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x83,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf8, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd9, 0x40, 0x0, 0x0, 0x0, 0xdf,
-    0x83, 0xff, 0xee, 0xee, 0xee, 0xef, 0xff, 0xff,
-    0xc1, 0x0, 0x0, 0xd, 0xf8, 0x3f, 0xf1, 0x0,
-    0x0, 0x0, 0x1, 0x4a, 0xff, 0xe1, 0x0, 0x0,
-    0xdf, 0x83, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x90, 0x0, 0xd, 0xf8, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x0,
-    0x0, 0xdf, 0x83, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf3, 0x0, 0xd, 0xf8, 0x3f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x40, 0x0, 0xdf, 0x83, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf4, 0x0, 0xd, 0xf8,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x20, 0x0, 0xdf, 0x83, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xe0, 0x0, 0xd,
-    0xf8, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf7, 0x0, 0x0, 0xdf, 0x83, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x4, 0xbf, 0xfb, 0x0, 0x0,
-    0xd, 0xf8, 0x3f, 0xfe, 0xee, 0xee, 0xee, 0xef,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0xdf, 0x83, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xeb, 0x72, 0x0, 0x0,
-    0x0, 0xd, 0xf8,
-
-    /* U+042C "Ь" */
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd9, 0x40, 0x0, 0x3, 0xff, 0xee,
-    0xee, 0xee, 0xef, 0xff, 0xff, 0xc1, 0x0, 0x3f,
-    0xf1, 0x0, 0x0, 0x0, 0x1, 0x4a, 0xff, 0xe1,
-    0x3, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x90, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x3, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf3, 0x3f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x43, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf4,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x23, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xe0, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf7, 0x3, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x4, 0xbf, 0xfb, 0x0, 0x3f, 0xfe,
-    0xee, 0xee, 0xee, 0xef, 0xff, 0xf9, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x72, 0x0,
-    0x0,
-
-    /* U+042D "Э" */
-    0x0, 0x1, 0x6a, 0xdf, 0xff, 0xda, 0x50, 0x0,
-    0x0, 0x0, 0x1, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x60, 0x0, 0x0, 0x3e, 0xff, 0xc7, 0x42,
-    0x23, 0x5a, 0xff, 0xfb, 0x10, 0x0, 0x7f, 0xc2,
-    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xc0, 0x0,
-    0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf7, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x50, 0xa, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xfa, 0x0, 0x9f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x19, 0xff, 0xc0, 0x0, 0x2d, 0xff,
-    0xd8, 0x42, 0x12, 0x59, 0xff, 0xfb, 0x10, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x60,
-    0x0, 0x0, 0x0, 0x1, 0x6a, 0xdf, 0xff, 0xda,
-    0x50, 0x0, 0x0, 0x0,
-
-    /* U+042E "Ю" */
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x38,
-    0xce, 0xff, 0xeb, 0x71, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x3, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x3f,
-    0xf1, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf9, 0x40,
-    0x0, 0x15, 0xbf, 0xfe, 0x30, 0x0, 0x3, 0xff,
-    0x10, 0x0, 0x0, 0x7, 0xff, 0xb1, 0x0, 0x0,
-    0x0, 0x0, 0x3d, 0xff, 0x30, 0x0, 0x3f, 0xf1,
-    0x0, 0x0, 0x4, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1c, 0xfe, 0x10, 0x3, 0xff, 0x10,
-    0x0, 0x0, 0xef, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xfa, 0x0, 0x3f, 0xf1, 0x0,
-    0x0, 0x6f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf2, 0x3, 0xff, 0x10, 0x0,
-    0xc, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x80, 0x3f, 0xf1, 0x0, 0x0,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xfc, 0x3, 0xff, 0x42, 0x22, 0x5f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x3, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf0, 0x3f, 0xf1, 0x0, 0x3, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x3, 0xff, 0x10, 0x0, 0xf, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xc0, 0x3f, 0xf1, 0x0, 0x0, 0xcf, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0x3, 0xff, 0x10, 0x0, 0x6, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x20,
-    0x3f, 0xf1, 0x0, 0x0, 0xe, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xa0, 0x3,
-    0xff, 0x10, 0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xcf, 0xe1, 0x0, 0x3f,
-    0xf1, 0x0, 0x0, 0x0, 0x7f, 0xfb, 0x10, 0x0,
-    0x0, 0x0, 0x3, 0xdf, 0xf3, 0x0, 0x3, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x93, 0x0,
-    0x1, 0x4a, 0xff, 0xe3, 0x0, 0x0, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x91, 0x0, 0x0, 0x3, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x8c, 0xef, 0xfe,
-    0xb7, 0x10, 0x0, 0x0, 0x0,
-
-    /* U+042F "Я" */
-    0x0, 0x0, 0x38, 0xce, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x2, 0xef, 0xfb, 0x52, 0x11, 0x11,
-    0x11, 0x1b, 0xfa, 0xc, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfa, 0x5f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xfa, 0xaf, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfa, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfa, 0xef,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfa,
-    0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xfa, 0xbf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xfa, 0x6f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xfa, 0xe, 0xfd, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfa, 0x3, 0xff, 0xf9, 0x41,
-    0x0, 0x0, 0x0, 0xb, 0xfa, 0x0, 0x3d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x7f, 0xe1, 0x0, 0x0, 0x0, 0xb, 0xfa,
-    0x0, 0x2, 0xff, 0x50, 0x0, 0x0, 0x0, 0xb,
-    0xfa, 0x0, 0xc, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xfa, 0x0, 0x8f, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xfa, 0x3, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfa, 0xd, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xfa, 0x8f, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfa,
-
-    /* U+0430 "а" */
-    0x0, 0x2, 0x7b, 0xef, 0xfe, 0xb5, 0x0, 0x0,
-    0x1a, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x9,
-    0xff, 0x94, 0x10, 0x2, 0x8f, 0xfc, 0x0, 0x1a,
-    0x10, 0x0, 0x0, 0x0, 0x5f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x16, 0x9a,
-    0xbb, 0xbb, 0xbd, 0xfd, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0x8f, 0xf8, 0x20, 0x0,
-    0x0, 0x7, 0xfd, 0xf, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xd3, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfd, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xd1, 0xff, 0x40, 0x0, 0x0, 0x0, 0x6f,
-    0xfd, 0x9, 0xfe, 0x40, 0x0, 0x1, 0x9f, 0xdf,
-    0xd0, 0xb, 0xff, 0xda, 0xac, 0xff, 0x85, 0xfd,
-    0x0, 0x5, 0xae, 0xff, 0xd9, 0x30, 0x5f, 0xd0,
-
-    /* U+0431 "б" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x15, 0x9c,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x5, 0xae, 0xff,
-    0xff, 0xfe, 0x60, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xfd, 0x96, 0x20, 0x0, 0x0, 0x3, 0xdf, 0xfd,
-    0x94, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xfd,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf0, 0x1, 0x8d, 0xff, 0xfc, 0x71,
-    0x0, 0x0, 0x7f, 0xb0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0xaf, 0x88, 0xfe, 0x72, 0x0,
-    0x27, 0xef, 0xf7, 0x0, 0xcf, 0xbf, 0xb1, 0x0,
-    0x0, 0x0, 0x1b, 0xff, 0x30, 0xdf, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xc0, 0xdf, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2, 0xcf,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0xbf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf7, 0x8f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf6, 0x5f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf5, 0x1f, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf1, 0xa, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xa0, 0x2, 0xff, 0xc1,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0x20, 0x0, 0x5f,
-    0xfe, 0x61, 0x0, 0x16, 0xdf, 0xf5, 0x0, 0x0,
-    0x5, 0xef, 0xff, 0xee, 0xff, 0xfd, 0x30, 0x0,
-    0x0, 0x0, 0x17, 0xbe, 0xff, 0xda, 0x50, 0x0,
-    0x0,
-
-    /* U+0432 "в" */
-    0xcf, 0xff, 0xff, 0xff, 0xfd, 0xa3, 0x0, 0xc,
-    0xfd, 0xcc, 0xcc, 0xcd, 0xff, 0xf9, 0x0, 0xcf,
-    0x70, 0x0, 0x0, 0x0, 0x7f, 0xf5, 0xc, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0, 0xcf, 0x70,
-    0x0, 0x0, 0x0, 0x7, 0xfc, 0xc, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xa0, 0xcf, 0x70, 0x0,
-    0x0, 0x0, 0x7f, 0xf4, 0xc, 0xfd, 0xbb, 0xbb,
-    0xbc, 0xff, 0xf7, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x10, 0xc, 0xf7, 0x0, 0x0, 0x0,
-    0x16, 0xee, 0x30, 0xcf, 0x70, 0x0, 0x0, 0x0,
-    0x4, 0xfe, 0xc, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf4, 0xcf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x5c, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf4, 0xcf, 0x70, 0x0, 0x0, 0x0, 0x4d, 0xfe,
-    0xc, 0xfe, 0xcc, 0xcc, 0xcd, 0xff, 0xfe, 0x30,
-    0xcf, 0xff, 0xff, 0xff, 0xfe, 0xc7, 0x10, 0x0,
-
-    /* U+0433 "г" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2c, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0xcf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0434 "д" */
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0, 0x0, 0x0,
-    0x8f, 0x90, 0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0,
-    0x0, 0x0, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x4f,
-    0xf0, 0x0, 0x0, 0x0, 0x9f, 0x70, 0x0, 0x0,
-    0x0, 0x4f, 0xf0, 0x0, 0x0, 0x0, 0xaf, 0x60,
-    0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0, 0x0, 0x0,
-    0xbf, 0x60, 0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0,
-    0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x4f,
-    0xf0, 0x0, 0x0, 0x0, 0xef, 0x30, 0x0, 0x0,
-    0x0, 0x4f, 0xf0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0, 0x0, 0x3,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0,
-    0x0, 0x7, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf0, 0x0, 0x0, 0xd, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf0, 0x0, 0x0, 0x9f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfa, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfa, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfa,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfa,
-
-    /* U+0435 "е" */
-    0x0, 0x0, 0x5, 0xbe, 0xff, 0xd9, 0x30, 0x0,
-    0x0, 0x0, 0x2c, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x3e, 0xfd, 0x61, 0x0, 0x28, 0xff,
-    0xc0, 0x0, 0xe, 0xfb, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0x90, 0x8, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x20, 0xef, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf8, 0x3f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xc5, 0xff, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x9b, 0xfe, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xfd, 0x20, 0x0, 0x0, 0x0, 0x3e, 0x40, 0x0,
-    0x2e, 0xff, 0x94, 0x10, 0x14, 0xaf, 0xfa, 0x0,
-    0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x3, 0x9d, 0xff, 0xec, 0x82, 0x0,
-    0x0,
-
-    /* U+0436 "ж" */
-    0xa, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x6f, 0xf2, 0x1, 0xef, 0x60,
-    0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0x1,
-    0xef, 0x70, 0x0, 0x6f, 0xf1, 0x0, 0x0, 0x0,
-    0xff, 0x50, 0x0, 0x0, 0xa, 0xfc, 0x0, 0x0,
-    0xb, 0xfa, 0x0, 0x0, 0x0, 0xff, 0x50, 0x0,
-    0x0, 0x4f, 0xf3, 0x0, 0x0, 0x2, 0xff, 0x40,
-    0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0xdf, 0x80,
-    0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0xff,
-    0x50, 0x0, 0x8, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf8, 0x0, 0x0, 0xff, 0x50, 0x0, 0x2f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x20,
-    0x0, 0xff, 0x50, 0x0, 0xbf, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfe, 0x10, 0x0,
-    0xff, 0x50, 0x0, 0x9f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf4, 0x0, 0x0, 0xff, 0x50, 0x0,
-    0xd, 0xfd, 0x0, 0x0, 0x0, 0x2, 0xff, 0x80,
-    0x0, 0x0, 0xff, 0x50, 0x0, 0x2, 0xff, 0x90,
-    0x0, 0x0, 0xd, 0xfc, 0x0, 0x0, 0x0, 0xff,
-    0x50, 0x0, 0x0, 0x6f, 0xf5, 0x0, 0x0, 0x9f,
-    0xf2, 0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0,
-    0xa, 0xfe, 0x20, 0x5, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0xff, 0x50, 0x0, 0x0, 0x0, 0xdf, 0xc0,
-    0x2f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x3f, 0xf8,
-
-    /* U+0437 "з" */
-    0x0, 0x3, 0x8c, 0xff, 0xfd, 0xa4, 0x0, 0x0,
-    0x2, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0,
-    0x0, 0xfc, 0x73, 0x10, 0x13, 0x8f, 0xfe, 0x10,
-    0x0, 0x20, 0x0, 0x0, 0x0, 0x2, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0x20,
-    0x0, 0x0, 0x6, 0xaa, 0xac, 0xff, 0xe4, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xfe, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x4b, 0xfb, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf2,
-    0x5, 0x40, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xe0,
-    0xd, 0xfc, 0x62, 0x0, 0x2, 0x6e, 0xff, 0x50,
-    0x4, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0,
-    0x0, 0x4, 0x9c, 0xef, 0xfd, 0xa6, 0x0, 0x0,
-
-    /* U+0438 "и" */
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0x1, 0xef, 0xa8, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0xc, 0xfc, 0x8, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0xaf, 0xe1, 0x8, 0xfc,
-    0xcf, 0x80, 0x0, 0x8, 0xff, 0x30, 0x8, 0xfc,
-    0xcf, 0x80, 0x0, 0x5f, 0xf5, 0x0, 0x8, 0xfc,
-    0xcf, 0x80, 0x3, 0xff, 0x70, 0x0, 0x8, 0xfc,
-    0xcf, 0x80, 0x1e, 0xfa, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0x80, 0xcf, 0xc0, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0x8a, 0xfe, 0x10, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0xef, 0xf3, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc,
-
-    /* U+0439 "й" */
-    0x0, 0x7, 0x60, 0x0, 0x0, 0x8, 0x40, 0x0,
-    0x0, 0xc, 0xf1, 0x0, 0x0, 0x4f, 0x70, 0x0,
-    0x0, 0x4, 0xfd, 0x52, 0x26, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x5d, 0xff, 0xff, 0xc2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x24, 0x41, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0x1, 0xef, 0xa8, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0xc, 0xfc, 0x8, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0xaf, 0xe1, 0x8, 0xfc,
-    0xcf, 0x80, 0x0, 0x8, 0xff, 0x30, 0x8, 0xfc,
-    0xcf, 0x80, 0x0, 0x5f, 0xf5, 0x0, 0x8, 0xfc,
-    0xcf, 0x80, 0x3, 0xff, 0x70, 0x0, 0x8, 0xfc,
-    0xcf, 0x80, 0x1e, 0xfa, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0x80, 0xcf, 0xc0, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0x8a, 0xfe, 0x10, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0xef, 0xf3, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc,
-
-    /* U+043A "к" */
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x2, 0xff, 0x60,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0xc, 0xfa, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x9f, 0xd0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x5, 0xff, 0x20, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x2e, 0xf5, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x9, 0xfc, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x4f, 0xe2, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x3f, 0xfa, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x4, 0xff, 0x80, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x8, 0xff, 0x40, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0xaf, 0xf2, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0xb, 0xfd, 0x10,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xc0,
-
-    /* U+043B "л" */
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0,
-    0x4f, 0xf0, 0x0, 0x7, 0xf9, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0,
-    0x0, 0x4f, 0xf0, 0x0, 0x9, 0xf7, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x0, 0x0, 0xaf, 0x60, 0x0,
-    0x0, 0x0, 0x4f, 0xf0, 0x0, 0xb, 0xf5, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x0, 0x0, 0xcf, 0x40,
-    0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0, 0xd, 0xf2,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x0, 0x0, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0, 0x2f,
-    0xe0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x0, 0x5,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x4, 0xff, 0x0,
-    0x6f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfa,
-    0xef, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xbf, 0xe8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf0,
-
-    /* U+043C "м" */
-    0xcf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf0, 0xcf, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xf0, 0xcf, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xf0, 0xcf, 0xef,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xef, 0xf0,
-    0xcf, 0x7f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x6f, 0xf0, 0xcf, 0x57, 0xfb, 0x0, 0x0, 0x0,
-    0x5, 0xfc, 0xf, 0xf0, 0xcf, 0x50, 0xdf, 0x50,
-    0x0, 0x0, 0xe, 0xf3, 0xf, 0xf0, 0xcf, 0x50,
-    0x4f, 0xe0, 0x0, 0x0, 0x8f, 0x90, 0xf, 0xf0,
-    0xcf, 0x50, 0xb, 0xf8, 0x0, 0x2, 0xfe, 0x10,
-    0xf, 0xf0, 0xcf, 0x50, 0x2, 0xff, 0x10, 0xb,
-    0xf6, 0x0, 0xf, 0xf0, 0xcf, 0x50, 0x0, 0x8f,
-    0xa0, 0x4f, 0xc0, 0x0, 0xf, 0xf0, 0xcf, 0x50,
-    0x0, 0xe, 0xf4, 0xdf, 0x30, 0x0, 0xf, 0xf0,
-    0xcf, 0x50, 0x0, 0x5, 0xff, 0xf9, 0x0, 0x0,
-    0xf, 0xf0, 0xcf, 0x50, 0x0, 0x0, 0xbf, 0xe1,
-    0x0, 0x0, 0xf, 0xf0, 0xcf, 0x50, 0x0, 0x0,
-    0x2e, 0x60, 0x0, 0x0, 0xf, 0xf0, 0xcf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
-    0xcf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf0,
-
-    /* U+043D "н" */
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
-
-    /* U+043E "о" */
-    0x0, 0x0, 0x4, 0xad, 0xff, 0xeb, 0x60, 0x0,
-    0x0, 0x0, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xfe,
-    0x40, 0x0, 0x0, 0x2e, 0xff, 0x83, 0x0, 0x16,
-    0xdf, 0xf6, 0x0, 0x0, 0xdf, 0xe2, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0x30, 0x8, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xd0, 0xe, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf4, 0x3f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x5f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfa,
-    0x6f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xfb, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xfa, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf8, 0xe, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf3, 0x7, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xd0, 0x0, 0xdf, 0xe2,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0x30, 0x0, 0x2e,
-    0xff, 0x93, 0x0, 0x26, 0xef, 0xf6, 0x0, 0x0,
-    0x1, 0xbf, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0,
-    0x0, 0x0, 0x4, 0xad, 0xff, 0xeb, 0x60, 0x0,
-    0x0,
-
-    /* U+043F "п" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-
-    /* U+0440 "р" */
-    0xcf, 0x60, 0x4, 0xae, 0xff, 0xda, 0x40, 0x0,
-    0x0, 0xcf, 0x61, 0xbf, 0xff, 0xff, 0xff, 0xfb,
-    0x10, 0x0, 0xcf, 0x7d, 0xfd, 0x61, 0x0, 0x39,
-    0xff, 0xe2, 0x0, 0xcf, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x3e, 0xfd, 0x0, 0xcf, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x60, 0xcf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xd0, 0xcf, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf1, 0xcf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf3,
-    0xcf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf4, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf3, 0xcf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf1, 0xcf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xd0, 0xcf, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x60, 0xcf, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x3e, 0xfc, 0x0, 0xcf, 0x8c,
-    0xfd, 0x62, 0x1, 0x49, 0xff, 0xe1, 0x0, 0xcf,
-    0x81, 0xbf, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x0,
-    0xcf, 0x80, 0x4, 0xad, 0xff, 0xda, 0x40, 0x0,
-    0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0441 "с" */
-    0x0, 0x0, 0x4, 0x9d, 0xff, 0xeb, 0x60, 0x0,
-    0x0, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xfe, 0x40,
-    0x0, 0x2e, 0xff, 0x93, 0x0, 0x16, 0xdf, 0xf4,
-    0x0, 0xdf, 0xe2, 0x0, 0x0, 0x0, 0xa, 0xf7,
-    0x8, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x30,
-    0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x30,
-    0x0, 0xdf, 0xe3, 0x0, 0x0, 0x0, 0xa, 0xf7,
-    0x0, 0x2e, 0xff, 0x93, 0x10, 0x26, 0xdf, 0xf4,
-    0x0, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xfe, 0x40,
-    0x0, 0x0, 0x3, 0x9d, 0xff, 0xeb, 0x60, 0x0,
-
-    /* U+0442 "т" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-
-    /* U+0443 "у" */
-    0x8, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x40, 0x1f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xd0, 0x0, 0xaf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf6, 0x0, 0x3, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x4, 0xfe, 0x0, 0x0, 0xb,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x80, 0x0,
-    0x0, 0x4f, 0xf1, 0x0, 0x0, 0x0, 0x2f, 0xf1,
-    0x0, 0x0, 0x0, 0xdf, 0x80, 0x0, 0x0, 0x9,
-    0xf9, 0x0, 0x0, 0x0, 0x6, 0xfe, 0x0, 0x0,
-    0x1, 0xff, 0x20, 0x0, 0x0, 0x0, 0xe, 0xf6,
-    0x0, 0x0, 0x8f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xd0, 0x0, 0xe, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x40, 0x6, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xfb, 0x0, 0xdf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2, 0x4f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x9b, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0x81,
-    0x1, 0xaf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xae, 0xfe, 0xa3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0444 "ф" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xac, 0xef, 0xff, 0xec,
-    0xa6, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x1, 0xdf, 0xfd, 0x73, 0x19, 0xfa, 0x13, 0x7c,
-    0xff, 0xd2, 0x0, 0x0, 0xdf, 0xf5, 0x0, 0x0,
-    0x9f, 0xa0, 0x0, 0x4, 0xef, 0xe1, 0x0, 0x8f,
-    0xf3, 0x0, 0x0, 0x9, 0xfa, 0x0, 0x0, 0x2,
-    0xef, 0xa0, 0xf, 0xf7, 0x0, 0x0, 0x0, 0x9f,
-    0xa0, 0x0, 0x0, 0x6, 0xff, 0x13, 0xff, 0x10,
-    0x0, 0x0, 0x9, 0xfa, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x6f, 0xe0, 0x0, 0x0, 0x0, 0x9f, 0xa0,
-    0x0, 0x0, 0x0, 0xcf, 0x76, 0xfd, 0x0, 0x0,
-    0x0, 0x9, 0xfa, 0x0, 0x0, 0x0, 0xb, 0xf8,
-    0x6f, 0xe0, 0x0, 0x0, 0x0, 0x9f, 0xa0, 0x0,
-    0x0, 0x0, 0xcf, 0x73, 0xff, 0x10, 0x0, 0x0,
-    0x9, 0xfa, 0x0, 0x0, 0x0, 0xf, 0xf5, 0xe,
-    0xf8, 0x0, 0x0, 0x0, 0x9f, 0xa0, 0x0, 0x0,
-    0x6, 0xff, 0x10, 0x8f, 0xf3, 0x0, 0x0, 0x9,
-    0xfa, 0x0, 0x0, 0x2, 0xff, 0x90, 0x0, 0xdf,
-    0xf6, 0x0, 0x0, 0x9f, 0xa0, 0x0, 0x5, 0xef,
-    0xe1, 0x0, 0x1, 0xdf, 0xfd, 0x73, 0x19, 0xfa,
-    0x13, 0x7d, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x16, 0xad, 0xef, 0xff, 0xec,
-    0x95, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0445 "х" */
-    0xc, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9,
-    0x0, 0x2e, 0xf8, 0x0, 0x0, 0x0, 0xa, 0xfc,
-    0x0, 0x0, 0x4f, 0xf4, 0x0, 0x0, 0x6, 0xfe,
-    0x20, 0x0, 0x0, 0x8f, 0xe1, 0x0, 0x3, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0xbf, 0xc0, 0x1, 0xef,
-    0x80, 0x0, 0x0, 0x0, 0x1, 0xef, 0x80, 0xbf,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xbf,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xfd, 0x3f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x30, 0x6f, 0xf2, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x70, 0x0, 0xaf, 0xd0, 0x0, 0x0, 0x0,
-    0xdf, 0xa0, 0x0, 0x0, 0xdf, 0xa0, 0x0, 0x0,
-    0x9f, 0xd1, 0x0, 0x0, 0x2, 0xff, 0x70, 0x0,
-    0x6f, 0xf3, 0x0, 0x0, 0x0, 0x5, 0xff, 0x30,
-    0x2f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfe,
-    0x10,
-
-    /* U+0446 "ц" */
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0,
-    0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf0, 0x0, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf0, 0x0, 0xcf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0xcf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0,
-    0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf0, 0x0, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf0, 0x0, 0xcf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfc,
-
-    /* U+0447 "ч" */
-    0x8f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x8f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x8f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf7, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x6f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf3, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xc, 0xff, 0x81, 0x0,
-    0x1, 0x49, 0xff, 0xf0, 0x1d, 0xff, 0xfe, 0xde,
-    0xff, 0xfe, 0xff, 0x0, 0x6, 0xbe, 0xff, 0xeb,
-    0x72, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0,
-
-    /* U+0448 "ш" */
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0xd, 0xf7, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0xd, 0xf7,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0xd, 0xf7, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0xd, 0xf7,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0xd, 0xf7, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0xd, 0xf7,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0xd, 0xf7, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0xd, 0xf7,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0xd, 0xf7, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0xd, 0xf7,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0xd, 0xf7, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0xd, 0xf7,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0xd, 0xf7, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0xd, 0xf7,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0xd, 0xf7, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7,
-
-    /* U+0449 "щ" */
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0xd, 0xf7, 0x0, 0xc, 0xf8, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x70, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0,
-    0x3f, 0xf0, 0x0, 0x0, 0x0, 0xd, 0xf7, 0x0,
-    0xc, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x70, 0x0, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0,
-    0xd, 0xf7, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x70,
-    0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xf0,
-    0x0, 0x0, 0x0, 0xd, 0xf7, 0x0, 0xc, 0xf8,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x70, 0x0, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0xd, 0xf7,
-    0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x70, 0x0, 0xcf,
-    0x80, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0,
-    0x0, 0xd, 0xf7, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x70, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x3f,
-    0xf0, 0x0, 0x0, 0x0, 0xd, 0xf7, 0x0, 0xc,
-    0xf8, 0x0, 0x0, 0x0, 0x3, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x70, 0x0, 0xcf, 0x80, 0x0,
-    0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0xd,
-    0xf7, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x88, 0x0,
-
-    /* U+044A "ъ" */
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xc8, 0x10, 0x0, 0x0, 0x0, 0xbf, 0xeb, 0xbb,
-    0xbc, 0xef, 0xff, 0x40, 0x0, 0x0, 0xb, 0xf9,
-    0x0, 0x0, 0x0, 0x2c, 0xff, 0x10, 0x0, 0x0,
-    0xbf, 0x90, 0x0, 0x0, 0x0, 0xe, 0xf8, 0x0,
-    0x0, 0xb, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xb0, 0x0, 0x0, 0xbf, 0x90, 0x0, 0x0, 0x0,
-    0x8, 0xfc, 0x0, 0x0, 0xb, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xb0, 0x0, 0x0, 0xbf, 0x90,
-    0x0, 0x0, 0x0, 0x1f, 0xf7, 0x0, 0x0, 0xb,
-    0xf9, 0x0, 0x0, 0x0, 0x3d, 0xfe, 0x0, 0x0,
-    0x0, 0xbf, 0xec, 0xcc, 0xcc, 0xef, 0xfe, 0x20,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xfe, 0xb6,
-    0x0, 0x0,
-
-    /* U+044B "ы" */
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xec, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfe, 0xcf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xec, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfe, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xec,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfe, 0xcf, 0xff, 0xff, 0xff, 0xfc, 0x81, 0x0,
-    0x0, 0x6f, 0xec, 0xfd, 0xbb, 0xbb, 0xbd, 0xff,
-    0xf4, 0x0, 0x6, 0xfe, 0xcf, 0x80, 0x0, 0x0,
-    0x2, 0xcf, 0xf1, 0x0, 0x6f, 0xec, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x80, 0x6, 0xfe, 0xcf,
-    0x80, 0x0, 0x0, 0x0, 0x9, 0xfb, 0x0, 0x6f,
-    0xec, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xc0,
-    0x6, 0xfe, 0xcf, 0x80, 0x0, 0x0, 0x0, 0xa,
-    0xfb, 0x0, 0x6f, 0xec, 0xf8, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x70, 0x6, 0xfe, 0xcf, 0x80, 0x0,
-    0x0, 0x3, 0xdf, 0xe0, 0x0, 0x6f, 0xec, 0xfd,
-    0xbb, 0xbb, 0xbe, 0xff, 0xd2, 0x0, 0x6, 0xfe,
-    0xcf, 0xff, 0xff, 0xff, 0xeb, 0x60, 0x0, 0x0,
-    0x6f, 0xe0,
-
-    /* U+044C "ь" */
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xfd, 0x92,
-    0x0, 0xcf, 0xdb, 0xbb, 0xbb, 0xdf, 0xff, 0x60,
-    0xcf, 0x80, 0x0, 0x0, 0x1, 0xaf, 0xf3, 0xcf,
-    0x80, 0x0, 0x0, 0x0, 0xc, 0xfa, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x7, 0xfd, 0xcf, 0x80, 0x0,
-    0x0, 0x0, 0x6, 0xfe, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x8, 0xfd, 0xcf, 0x80, 0x0, 0x0, 0x0,
-    0xe, 0xf9, 0xcf, 0x80, 0x0, 0x0, 0x3, 0xcf,
-    0xf2, 0xcf, 0xdb, 0xbb, 0xbc, 0xef, 0xfe, 0x40,
-    0xcf, 0xff, 0xff, 0xff, 0xeb, 0x71, 0x0,
-
-    /* U+044D "э" */
-    0x0, 0x2, 0x8c, 0xef, 0xfd, 0xa5, 0x0, 0x0,
-    0x0, 0x1a, 0xff, 0xff, 0xde, 0xff, 0xfd, 0x30,
-    0x0, 0xc, 0xfe, 0x72, 0x0, 0x1, 0x6d, 0xff,
-    0x40, 0x0, 0x28, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x80, 0x0, 0x0, 0x5b, 0xbb,
-    0xbb, 0xbb, 0xbe, 0xfa, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfc, 0x0, 0x3b,
-    0x10, 0x0, 0x0, 0x0, 0xa, 0xff, 0x20, 0xc,
-    0xff, 0x82, 0x0, 0x1, 0x6e, 0xff, 0x40, 0x0,
-    0x1a, 0xff, 0xff, 0xef, 0xff, 0xfd, 0x30, 0x0,
-    0x0, 0x2, 0x8c, 0xef, 0xfd, 0xa5, 0x0, 0x0,
-    0x0,
-
-    /* U+044E "ю" */
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x6, 0xbe, 0xff,
-    0xd9, 0x20, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0,
-    0x5, 0xef, 0xff, 0xde, 0xff, 0xf9, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x6f, 0xfb, 0x30, 0x0,
-    0x17, 0xff, 0xb0, 0x0, 0xcf, 0x80, 0x0, 0x3,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x3e, 0xf9, 0x0,
-    0xcf, 0x80, 0x0, 0xd, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x30, 0xcf, 0x80, 0x0, 0x3f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90,
-    0xcf, 0x80, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xd0, 0xcf, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf0, 0xcf, 0x81, 0x11, 0xaf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf0,
-    0xcf, 0x80, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xd0, 0xcf, 0x80, 0x0, 0x3f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90,
-    0xcf, 0x80, 0x0, 0xc, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x20, 0xcf, 0x80, 0x0, 0x3,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xf9, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x6f, 0xfb, 0x30, 0x0,
-    0x18, 0xff, 0xb0, 0x0, 0xcf, 0x80, 0x0, 0x0,
-    0x4, 0xef, 0xff, 0xde, 0xff, 0xf9, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x6, 0xbe, 0xff,
-    0xd9, 0x20, 0x0, 0x0,
-
-    /* U+044F "я" */
-    0x0, 0x0, 0x6b, 0xef, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x2, 0xff, 0xe6, 0x20, 0x0, 0x0, 0xe, 0xf2,
-    0xa, 0xfe, 0x10, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0xe, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0xf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0xf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0xe, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0x9, 0xfe, 0x10, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0x1, 0xef, 0xd6, 0x10, 0x0, 0x0, 0xe, 0xf2,
-    0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x5f, 0xfb, 0xbb, 0xbb, 0xbf, 0xf2,
-    0x0, 0x0, 0xdf, 0x80, 0x0, 0x0, 0xe, 0xf2,
-    0x0, 0x9, 0xfc, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0x0, 0x5f, 0xf2, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0x2, 0xff, 0x50, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0xc, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-
-    /* U+0450 "ѐ" */
-    0x0, 0x1, 0x78, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xdf, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x58, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5b, 0xef,
-    0xfd, 0x93, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x3, 0xef, 0xd6,
-    0x10, 0x2, 0x8f, 0xfc, 0x0, 0x0, 0xef, 0xb0,
-    0x0, 0x0, 0x0, 0x2e, 0xf9, 0x0, 0x8f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2, 0xe, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x83, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc, 0x5f,
-    0xf9, 0x99, 0x99, 0x99, 0x99, 0x99, 0xbf, 0xe6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x5f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xd2, 0x0, 0x0, 0x0,
-    0x3, 0xe4, 0x0, 0x2, 0xef, 0xf9, 0x41, 0x1,
-    0x4a, 0xff, 0xa0, 0x0, 0x1, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x39, 0xdf,
-    0xfe, 0xc8, 0x20, 0x0,
-
-    /* U+0451 "ё" */
-    0x0, 0x0, 0x2e, 0xd1, 0x0, 0x5f, 0xa0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x50, 0xa, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0x90, 0x0, 0x3b, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5b, 0xef, 0xfd,
-    0x93, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x3, 0xef, 0xd6, 0x10,
-    0x2, 0x8f, 0xfc, 0x0, 0x0, 0xef, 0xb0, 0x0,
-    0x0, 0x0, 0x2e, 0xf9, 0x0, 0x8f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf2, 0xe, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x83, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfc, 0x5f, 0xf9,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0xbf, 0xe6, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xd2, 0x0, 0x0, 0x0, 0x3,
-    0xe4, 0x0, 0x2, 0xef, 0xf9, 0x41, 0x1, 0x4a,
-    0xff, 0xa0, 0x0, 0x1, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x39, 0xdf, 0xfe,
-    0xc8, 0x20, 0x0,
-
-    /* U+0452 "ђ" */
-    0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2a, 0xaa, 0xef, 0xda,
-    0xaa, 0xaa, 0xaa, 0x40, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x6, 0xbe, 0xff, 0xd9, 0x20, 0x0,
-    0x0, 0x0, 0xbf, 0x72, 0xdf, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0xbf, 0x8e, 0xfa, 0x41,
-    0x2, 0x6d, 0xff, 0x60, 0x0, 0x0, 0xbf, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0,
-    0xbf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf6,
-    0x0, 0x0, 0xbf, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf9, 0x0, 0x0, 0xbf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xfb, 0x0, 0x0, 0xbf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfb, 0x0, 0x0,
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfb,
-    0x0, 0x0, 0xbf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfb, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfb, 0x0, 0x0, 0xbf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfb, 0x0, 0x0,
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfb,
-    0x0, 0x0, 0xbf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfb, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfb, 0x0, 0x0, 0xbf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfb, 0x0, 0x0,
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x71, 0x1, 0x9f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x9e, 0xff, 0xc5, 0x0,
-
-    /* U+0453 "ѓ" */
-    0x0, 0x0, 0x0, 0x0, 0x58, 0x82, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xd2, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x48, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x2c, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0454 "є" */
-    0x0, 0x0, 0x3, 0x9d, 0xff, 0xfd, 0x94, 0x0,
-    0x0, 0x0, 0x1a, 0xff, 0xff, 0xef, 0xff, 0xfc,
-    0x20, 0x0, 0x1d, 0xff, 0x82, 0x0, 0x1, 0x6d,
-    0xff, 0x10, 0xd, 0xfd, 0x20, 0x0, 0x0, 0x0,
-    0x8, 0x60, 0x7, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x6, 0xff, 0xbb, 0xbb,
-    0xbb, 0xbb, 0x80, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xfd, 0x20, 0x0, 0x0, 0x0, 0x6, 0x50, 0x0,
-    0x1d, 0xff, 0x82, 0x0, 0x1, 0x5c, 0xff, 0x10,
-    0x0, 0x1a, 0xff, 0xff, 0xee, 0xff, 0xfc, 0x20,
-    0x0, 0x0, 0x3, 0x9d, 0xff, 0xfd, 0x94, 0x0,
-    0x0,
-
-    /* U+0455 "ѕ" */
-    0x0, 0x1, 0x8c, 0xef, 0xfd, 0xb6, 0x10, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x3,
-    0xff, 0xb3, 0x0, 0x1, 0x5b, 0xf3, 0x0, 0xbf,
-    0xb0, 0x0, 0x0, 0x0, 0x2, 0x0, 0xd, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xfb,
-    0x74, 0x10, 0x0, 0x0, 0x0, 0x8, 0xef, 0xff,
-    0xff, 0xd8, 0x10, 0x0, 0x0, 0x0, 0x25, 0x8b,
-    0xef, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4d, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x40, 0x84, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf1, 0x4f, 0xfc, 0x62, 0x0, 0x2, 0x7f, 0xfa,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x16, 0xbd, 0xff, 0xfd, 0x93, 0x0, 0x0,
-
-    /* U+0456 "і" */
-    0xb, 0xf8, 0x4, 0xff, 0xf0, 0x1e, 0xfb, 0x0,
-    0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x80, 0xc, 0xf8, 0x0, 0xcf,
-    0x80, 0xc, 0xf8, 0x0, 0xcf, 0x80, 0xc, 0xf8,
-    0x0, 0xcf, 0x80, 0xc, 0xf8, 0x0, 0xcf, 0x80,
-    0xc, 0xf8, 0x0, 0xcf, 0x80, 0xc, 0xf8, 0x0,
-    0xcf, 0x80, 0xc, 0xf8, 0x0, 0xcf, 0x80, 0xc,
-    0xf8, 0x0, 0xcf, 0x80,
-
-    /* U+0457 "ї" */
-    0xb, 0xe3, 0x8, 0xf6, 0x1f, 0xf7, 0xd, 0xfb,
-    0x7, 0xa1, 0x4, 0xa3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf7, 0x0,
-    0x0, 0xd, 0xf7, 0x0, 0x0, 0xd, 0xf7, 0x0,
-    0x0, 0xd, 0xf7, 0x0, 0x0, 0xd, 0xf7, 0x0,
-    0x0, 0xd, 0xf7, 0x0, 0x0, 0xd, 0xf7, 0x0,
-    0x0, 0xd, 0xf7, 0x0, 0x0, 0xd, 0xf7, 0x0,
-    0x0, 0xd, 0xf7, 0x0, 0x0, 0xd, 0xf7, 0x0,
-    0x0, 0xd, 0xf7, 0x0, 0x0, 0xd, 0xf7, 0x0,
-    0x0, 0xd, 0xf7, 0x0, 0x0, 0xd, 0xf7, 0x0,
-    0x0, 0xd, 0xf7, 0x0, 0x0, 0xd, 0xf7, 0x0,
-
-    /* U+0458 "ј" */
-    0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xc0, 0x0, 0x0, 0x3, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0xaf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0, 0x0,
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0xbf, 0x80, 0x0,
-    0x0, 0x0, 0xbf, 0x80, 0x0, 0x0, 0x0, 0xbf,
-    0x80, 0x0, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0,
-    0x0, 0xbf, 0x80, 0x0, 0x0, 0x0, 0xbf, 0x80,
-    0x0, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0, 0x0,
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0xbf, 0x80, 0x0,
-    0x0, 0x0, 0xbf, 0x80, 0x0, 0x0, 0x0, 0xbf,
-    0x80, 0x0, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0,
-    0x0, 0xbf, 0x80, 0x0, 0x0, 0x0, 0xbf, 0x80,
-    0x0, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0, 0x0,
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x0,
-    0x0, 0x1, 0xff, 0x50, 0x46, 0x10, 0x2b, 0xff,
-    0x0, 0xbf, 0xff, 0xff, 0xf5, 0x0, 0x3a, 0xef,
-    0xfb, 0x40, 0x0,
-
-    /* U+0459 "љ" */
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xa0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0,
-    0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf7, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x60, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0xfe, 0xb5, 0x0, 0x0, 0x0, 0xb,
-    0xf5, 0x0, 0x0, 0x0, 0x5, 0xff, 0xbb, 0xbb,
-    0xbc, 0xff, 0xfc, 0x10, 0x0, 0x0, 0xcf, 0x40,
-    0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0,
-    0x5f, 0xfa, 0x0, 0x0, 0xd, 0xf2, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf1, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x50,
-    0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf6, 0x0, 0x5,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x40, 0x0, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf1, 0x0, 0x6f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x2, 0x9f,
-    0xf8, 0xa, 0xef, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xdd, 0xdd, 0xde, 0xff, 0xf9, 0x0,
-    0xbf, 0xe8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0xfd, 0x93, 0x0, 0x0,
-
-    /* U+045A "њ" */
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xeb, 0x60, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd1, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x0, 0x0, 0x0, 0x28, 0xff, 0xb0, 0xcf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x1c, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf4, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x3c,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf0, 0xcf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0, 0x0, 0x0,
-    0x6f, 0xf8, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xbb, 0xbb, 0xbc, 0xff, 0xfa, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xfd, 0xa4, 0x0, 0x0,
-
-    /* U+045B "ћ" */
-    0x0, 0x0, 0xb, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x22, 0x2c,
-    0xf9, 0x22, 0x22, 0x22, 0x21, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x5, 0x55, 0x5d, 0xfa, 0x55, 0x55,
-    0x55, 0x52, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x80, 0x6, 0xbe,
-    0xff, 0xd9, 0x20, 0x0, 0x0, 0x0, 0xb, 0xf8,
-    0x2d, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0xbf, 0xae, 0xfa, 0x41, 0x2, 0x6d, 0xff,
-    0x60, 0x0, 0x0, 0xb, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0xc, 0xfe, 0x0, 0x0, 0x0, 0xbf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf5, 0x0, 0x0,
-    0xb, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x90, 0x0, 0x0, 0xbf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xfa, 0x0, 0x0, 0xb, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xb0, 0x0, 0x0,
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfb,
-    0x0, 0x0, 0xb, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xb0, 0x0, 0x0, 0xbf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfb, 0x0, 0x0, 0xb,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xb0,
-    0x0, 0x0, 0xbf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfb, 0x0, 0x0, 0xb, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xb0, 0x0, 0x0, 0xbf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfb, 0x0,
-    0x0, 0xb, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xb0, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfb,
-
-    /* U+045C "ќ" */
-    0x0, 0x0, 0x0, 0x0, 0x38, 0x84, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfd, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x18, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x2, 0xff, 0x60,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0xc, 0xfa, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x9f, 0xd0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x5, 0xff, 0x20, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x2e, 0xf5, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x9, 0xfc, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x4f, 0xe2, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x3f, 0xfa, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x4, 0xff, 0x80, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x8, 0xff, 0x40, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0xaf, 0xf2, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0xb, 0xfd, 0x10,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xc0,
-
-    /* U+045D "ѝ" */
-    0x0, 0x17, 0x86, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1c, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xc1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0x85, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0x1, 0xef, 0xa8, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0xc, 0xfc, 0x8, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0xaf, 0xe1, 0x8, 0xfc,
-    0xcf, 0x80, 0x0, 0x8, 0xff, 0x30, 0x8, 0xfc,
-    0xcf, 0x80, 0x0, 0x5f, 0xf5, 0x0, 0x8, 0xfc,
-    0xcf, 0x80, 0x3, 0xff, 0x70, 0x0, 0x8, 0xfc,
-    0xcf, 0x80, 0x1e, 0xfa, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0x80, 0xcf, 0xc0, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0x8a, 0xfe, 0x10, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0xef, 0xf3, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc,
-
-    /* U+045E "ў" */
-    0x0, 0x0, 0x4f, 0x60, 0x0, 0x0, 0x7f, 0x30,
-    0x0, 0x0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0xc,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfb, 0x32,
-    0x4b, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x34, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf4, 0x1, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfd, 0x0, 0xa, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x60, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0,
-    0x0, 0x0, 0xbf, 0x90, 0x0, 0x0, 0x0, 0xb,
-    0xf8, 0x0, 0x0, 0x4, 0xff, 0x10, 0x0, 0x0,
-    0x2, 0xff, 0x10, 0x0, 0x0, 0xd, 0xf8, 0x0,
-    0x0, 0x0, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x6f,
-    0xe0, 0x0, 0x0, 0x1f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x60, 0x0, 0x8, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfd, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf4, 0x0, 0x6f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xb0,
-    0xd, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x24, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf9, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xe8, 0x10, 0x1a, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4a, 0xef, 0xea, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+045F "џ" */
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x1, 0xff, 0x3c,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3, 0xcf,
-    0x80, 0x0, 0x0, 0x0, 0x1, 0xff, 0x3c, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x3c, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf3, 0xcf, 0x80, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x3c, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf3, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x3c, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf3, 0xcf, 0x80, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x3c, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf3, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x3c, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf3, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0xd, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x50, 0x0, 0x0, 0x0,
-
-    /* U+0462 "Ѣ" */
-    0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5c, 0xcc, 0xcc, 0xdf, 0xfc, 0xcc,
-    0xcc, 0xcc, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xee, 0xee,
-    0xee, 0xee, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x4a,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xfe, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf2,
-    0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x30, 0x0, 0x0, 0x5,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf3, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x10, 0x0, 0x0,
-    0x5, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xd0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfe,
-    0xee, 0xee, 0xee, 0xef, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xeb, 0x72, 0x0, 0x0,
-
-    /* U+0463 "ѣ" */
-    0x0, 0x0, 0xbf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbb, 0xbb, 0xef, 0xeb, 0xbb, 0xbb, 0xa0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xd9, 0x20, 0x0, 0x0, 0x0, 0xbf,
-    0xeb, 0xbb, 0xbb, 0xdf, 0xff, 0x70, 0x0, 0x0,
-    0xb, 0xf9, 0x0, 0x0, 0x0, 0x19, 0xff, 0x40,
-    0x0, 0x0, 0xbf, 0x90, 0x0, 0x0, 0x0, 0xb,
-    0xfb, 0x0, 0x0, 0xb, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf0, 0x0, 0x0, 0xbf, 0x90, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x0, 0x0, 0xb, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xe0, 0x0, 0x0,
-    0xbf, 0x90, 0x0, 0x0, 0x0, 0xc, 0xfa, 0x0,
-    0x0, 0xb, 0xf9, 0x0, 0x0, 0x0, 0x2b, 0xff,
-    0x20, 0x0, 0x0, 0xbf, 0xeb, 0xbb, 0xbc, 0xdf,
-    0xff, 0x40, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xfe, 0xc7, 0x10, 0x0,
-
-    /* U+046A "Ѫ" */
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0xb,
-    0xff, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xff, 0xe0, 0x0, 0x0, 0x1, 0xdf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfe,
-    0x30, 0x0, 0x0, 0x0, 0x1d, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xdf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0x70, 0x0, 0x0, 0x3, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xf7,
-    0x0, 0x0, 0x3f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0x70, 0x3,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2e, 0xf7, 0x3f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x49, 0xce, 0xff, 0xff, 0xfc, 0xa6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xe7, 0x20, 0xf, 0xf4,
-    0x1, 0x5c, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xfb, 0x10, 0x0, 0xf, 0xf4, 0x0, 0x0,
-    0x8f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xc0,
-    0x0, 0x0, 0xf, 0xf4, 0x0, 0x0, 0x8, 0xff,
-    0x20, 0x0, 0x0, 0x5, 0xff, 0x20, 0x0, 0x0,
-    0xf, 0xf4, 0x0, 0x0, 0x0, 0xdf, 0xa0, 0x0,
-    0x0, 0xc, 0xf9, 0x0, 0x0, 0x0, 0xf, 0xf4,
-    0x0, 0x0, 0x0, 0x4f, 0xf2, 0x0, 0x0, 0x4f,
-    0xf2, 0x0, 0x0, 0x0, 0xf, 0xf4, 0x0, 0x0,
-    0x0, 0xd, 0xf9, 0x0, 0x0, 0xbf, 0xb0, 0x0,
-    0x0, 0x0, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x10, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xef, 0x70,
-    0x9, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xe0, 0x1f, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf5,
-
-    /* U+046B "ѫ" */
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x6f, 0xfa, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0xcf, 0xf1, 0x0, 0x0, 0x9,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0xbf, 0xb0, 0x0, 0x0, 0x0,
-    0x1e, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfa,
-    0x0, 0x0, 0x1, 0xdf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0x90, 0x0, 0x1d, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf8, 0x0,
-    0xcf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x8c, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x59, 0xdf, 0xff, 0xfc, 0x94,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xfe,
-    0xff, 0xef, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0xb2, 0x2, 0xfd, 0x0, 0x4c, 0xfd, 0x0,
-    0x0, 0x0, 0xc, 0xf9, 0x0, 0x2, 0xfd, 0x0,
-    0x0, 0xcf, 0x90, 0x0, 0x0, 0x5f, 0xd0, 0x0,
-    0x2, 0xfd, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0,
-    0xcf, 0x60, 0x0, 0x2, 0xfd, 0x0, 0x0, 0xa,
-    0xf9, 0x0, 0x4, 0xfe, 0x0, 0x0, 0x2, 0xfd,
-    0x0, 0x0, 0x3, 0xff, 0x10, 0xb, 0xf8, 0x0,
-    0x0, 0x2, 0xfd, 0x0, 0x0, 0x0, 0xcf, 0x70,
-    0x2f, 0xf2, 0x0, 0x0, 0x2, 0xfd, 0x0, 0x0,
-    0x0, 0x5f, 0xe0,
-
-    /* U+0472 "Ѳ" */
-    0x0, 0x0, 0x0, 0x0, 0x5a, 0xdf, 0xff, 0xdb,
-    0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x2d, 0xff, 0xe9, 0x53, 0x22,
-    0x48, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff,
-    0x60, 0x0, 0x0, 0x1e, 0xfd, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1c, 0xff, 0x40, 0x0, 0xb,
-    0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xfd, 0x0, 0x3, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf6, 0x0,
-    0x9f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xd0, 0xe, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x11, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf4, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x52, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xef, 0xf5, 0x1f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x40, 0xef, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1, 0x9,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xfd, 0x0, 0x3f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x60,
-    0x0, 0xbf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xd0, 0x0, 0x1, 0xef, 0xe2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xf4,
-    0x0, 0x0, 0x3, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xef, 0xf6, 0x0, 0x0, 0x0, 0x2,
-    0xdf, 0xfe, 0x95, 0x21, 0x24, 0x8d, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xad, 0xff, 0xfd, 0xb6, 0x10,
-    0x0, 0x0, 0x0,
-
-    /* U+0473 "ѳ" */
-    0x0, 0x0, 0x3, 0x9d, 0xff, 0xec, 0x71, 0x0,
-    0x0, 0x0, 0x0, 0x1b, 0xff, 0xfe, 0xde, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x2e, 0xfd, 0x61, 0x0,
-    0x2, 0x8f, 0xfa, 0x0, 0x0, 0xd, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x2e, 0xf8, 0x0, 0x7, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2, 0x0,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x90, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfe, 0x5, 0xff, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xbf, 0xf0, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x3f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfd,
-    0x0, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x7, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf2, 0x0, 0xd, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0x5f, 0xf8, 0x0, 0x0, 0x1e, 0xfe,
-    0x71, 0x0, 0x3, 0xaf, 0xfa, 0x0, 0x0, 0x0,
-    0x1a, 0xff, 0xfe, 0xef, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x9d, 0xff, 0xec, 0x71, 0x0,
-    0x0, 0x0,
-
-    /* U+0474 "Ѵ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x13, 0x20, 0x2f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xf8,
-    0xc, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0xff, 0xf6, 0x5, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x83, 0x31,
-    0x0, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf6, 0x0, 0x0, 0x0, 0x8f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0,
-    0x0, 0x1f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0xa, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x50, 0x0, 0x0, 0x0, 0xd,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xb0,
-    0x0, 0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf2, 0x0, 0x0, 0x0, 0x9f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf9,
-    0x0, 0x0, 0x0, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0x0, 0x0, 0x5, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x60, 0x0, 0xb, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xd0, 0x0, 0x1f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf4, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xfa, 0x0, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x12, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x88, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xee, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0475 "ѵ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x32, 0x7, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xf4, 0x1f, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0x20, 0x9f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xd3, 0x20, 0x2, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0x0, 0x0,
-    0xb, 0xfb, 0x0, 0x0, 0x0, 0xa, 0xfc, 0x0,
-    0x0, 0x0, 0x4f, 0xf2, 0x0, 0x0, 0x0, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0,
-    0x5f, 0xf0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x0,
-    0x0, 0xb, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf7, 0x0, 0x1, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xd0, 0x0, 0x7f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x40, 0xd, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfb, 0x3, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf2,
-    0x9f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf2, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+048A "Ҋ" */
-    0x0, 0x0, 0xf, 0xb0, 0x0, 0x0, 0x7, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x20,
-    0x0, 0x0, 0xdf, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfe, 0x62, 0x14, 0xcf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xdf, 0xff,
-    0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x14, 0x42, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xf9, 0x0,
-    0x3, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0x90, 0x0, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xf9, 0x0, 0x3,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0x90, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xbc, 0xf9, 0x0, 0x3, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xd0, 0xcf,
-    0x90, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xf2, 0xc, 0xf9, 0x0, 0x3, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x7f, 0xf5, 0x0, 0xcf, 0x90,
-    0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x4f, 0xf8,
-    0x0, 0xc, 0xf9, 0x0, 0x3, 0xff, 0x10, 0x0,
-    0x0, 0x1e, 0xfb, 0x0, 0x0, 0xcf, 0x90, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0xc, 0xfe, 0x10, 0x0,
-    0xc, 0xf9, 0x0, 0x3, 0xff, 0x10, 0x0, 0x9,
-    0xff, 0x30, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x3f,
-    0xf1, 0x0, 0x6, 0xff, 0x60, 0x0, 0x0, 0xc,
-    0xf9, 0x0, 0x3, 0xff, 0x10, 0x3, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x3f, 0xf1,
-    0x1, 0xef, 0xc0, 0x0, 0x0, 0x0, 0xc, 0xf9,
-    0x0, 0x3, 0xff, 0x10, 0xbf, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x90, 0x0, 0x3f, 0xf1, 0x8f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x0,
-    0x3, 0xff, 0x7f, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x90, 0x0, 0x3f, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x0, 0x3,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x90, 0x0, 0x3f, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x93, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xc0, 0x0,
-
-    /* U+048B "ҋ" */
-    0x0, 0x7, 0x50, 0x0, 0x0, 0x7, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xce, 0x0, 0x0, 0x2, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfd, 0x52, 0x26,
-    0xee, 0x20, 0x0, 0x0, 0x0, 0x0, 0x4, 0xdf,
-    0xff, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x24, 0x41, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xc0, 0x0, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xfc, 0x0, 0xc, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xc0, 0x0, 0xcf,
-    0x80, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0xfc, 0x0,
-    0xc, 0xf8, 0x0, 0x0, 0x0, 0x1e, 0xfa, 0x8f,
-    0xc0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0xc, 0xfc,
-    0x8, 0xfc, 0x0, 0xc, 0xf8, 0x0, 0x0, 0xa,
-    0xfe, 0x10, 0x8f, 0xc0, 0x0, 0xcf, 0x80, 0x0,
-    0x7, 0xff, 0x30, 0x8, 0xfc, 0x0, 0xc, 0xf8,
-    0x0, 0x5, 0xff, 0x50, 0x0, 0x8f, 0xc0, 0x0,
-    0xcf, 0x80, 0x3, 0xff, 0x70, 0x0, 0x8, 0xfc,
-    0x0, 0xc, 0xf8, 0x1, 0xef, 0xa0, 0x0, 0x0,
-    0x8f, 0xc0, 0x0, 0xcf, 0x80, 0xcf, 0xc0, 0x0,
-    0x0, 0x8, 0xfc, 0x0, 0xc, 0xf8, 0xaf, 0xe1,
-    0x0, 0x0, 0x0, 0x8f, 0xc0, 0x0, 0xcf, 0xef,
-    0xf3, 0x0, 0x0, 0x0, 0x8, 0xfc, 0x0, 0xc,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xc0,
-    0x0, 0xcf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0x5c, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x76, 0x0,
-
-    /* U+048C "Ҍ" */
-    0x0, 0x6, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbc, 0xce, 0xff, 0xcc,
-    0xcc, 0xcc, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x83, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xee, 0xee, 0xee, 0xee,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x6, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xbf, 0xfc, 0x0, 0x0,
-    0x6, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x60, 0x0, 0x6, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xc0, 0x0, 0x6, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0,
-    0x0, 0x6, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf1, 0x0, 0x6, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf1, 0x0, 0x6,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf0, 0x0, 0x6, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xb0, 0x0, 0x6, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x40, 0x0,
-    0x6, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x14, 0xbf,
-    0xf9, 0x0, 0x0, 0x6, 0xff, 0xee, 0xee, 0xee,
-    0xee, 0xff, 0xff, 0x70, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xeb, 0x71, 0x0, 0x0,
-
-    /* U+048D "ҍ" */
-    0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3b, 0xbb, 0xff, 0xdb, 0xbb, 0xbb,
-    0x80, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xdb, 0xbb, 0xbb, 0xa8, 0x40, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x30,
-    0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x15, 0xdf,
-    0xf2, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0,
-    0xd, 0xf9, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x8, 0xfd, 0x0, 0x0, 0xcf, 0x80, 0x0,
-    0x0, 0x0, 0x6, 0xfe, 0x0, 0x0, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x8, 0xfd, 0x0, 0x0, 0xcf,
-    0x80, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x2, 0xcf, 0xf2, 0x0,
-    0x0, 0xcf, 0xdb, 0xbb, 0xbc, 0xef, 0xfe, 0x40,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xec, 0x71,
-    0x0,
-
-    /* U+048E "Ҏ" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xed, 0x94, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x40, 0x0, 0x3f, 0xf3, 0x11, 0x11, 0x11,
-    0x24, 0x9f, 0xff, 0x60, 0x3, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x1b, 0xff, 0x30, 0x3f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfc, 0x3,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf1, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x33, 0xff, 0x20, 0x0, 0x2, 0xa0,
-    0x0, 0x0, 0x1f, 0xf4, 0x3f, 0xf2, 0x0, 0x0,
-    0x8f, 0x90, 0x0, 0x2, 0xff, 0x43, 0xff, 0x20,
-    0x0, 0x0, 0xcf, 0x50, 0x0, 0x6f, 0xf1, 0x3f,
-    0xf2, 0x0, 0x0, 0x1, 0xef, 0x20, 0xd, 0xfc,
-    0x3, 0xff, 0x20, 0x0, 0x0, 0x3, 0xfd, 0x1b,
-    0xff, 0x40, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x19,
-    0xff, 0xff, 0x70, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xad, 0xf4, 0x0, 0x3, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe2, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xc0, 0x3, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x90, 0x3f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa3, 0x3, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+048F "ҏ" */
-    0xbf, 0x70, 0x2, 0x9d, 0xff, 0xeb, 0x50, 0x0,
-    0x0, 0xbf, 0x70, 0x7f, 0xff, 0xff, 0xff, 0xfd,
-    0x20, 0x0, 0xbf, 0x78, 0xfd, 0x61, 0x0, 0x39,
-    0xff, 0xf3, 0x0, 0xbf, 0xaf, 0x90, 0x0, 0x0,
-    0x0, 0x2e, 0xfe, 0x0, 0xbf, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x80, 0xbf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xe0, 0xbf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2, 0xbf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf4,
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf5, 0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf4, 0xbf, 0xc0, 0x0, 0x0, 0x0, 0x92,
-    0x0, 0x2f, 0xf2, 0xbf, 0xf2, 0x0, 0x0, 0x3,
-    0xfd, 0x10, 0x8f, 0xe0, 0xbf, 0xfb, 0x0, 0x0,
-    0x0, 0x6f, 0xb2, 0xff, 0x80, 0xbf, 0xbf, 0x90,
-    0x0, 0x0, 0xa, 0xff, 0xfe, 0x0, 0xbf, 0x87,
-    0xfd, 0x61, 0x0, 0x39, 0xff, 0xf3, 0x0, 0xbf,
-    0x80, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0xbf, 0x80, 0x2, 0x9d, 0xff, 0xeb, 0x54, 0xfd,
-    0x0, 0xbf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0xbf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0x20, 0xbf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0490 "Ґ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x3f, 0xf2, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0491 "ґ" */
-    0x0, 0x0, 0x0, 0x0, 0x6, 0x82, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0492 "Ғ" */
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x7, 0xfe, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x0, 0x7, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xbc, 0xce, 0xff, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xc6, 0x0, 0x0, 0x7, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0493 "ғ" */
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x4f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x5a, 0xcf, 0xfa, 0xaa, 0xaa,
-    0xaa, 0x30, 0x0, 0x4, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0494 "Ҕ" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x3f, 0xf2, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x10, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf1, 0x0, 0x15, 0x78, 0x75, 0x10,
-    0x0, 0x0, 0x3f, 0xf2, 0x6c, 0xff, 0xff, 0xff,
-    0xfa, 0x10, 0x0, 0x3f, 0xfe, 0xff, 0xc8, 0x66,
-    0x8c, 0xff, 0xf4, 0x0, 0x3f, 0xff, 0x81, 0x0,
-    0x0, 0x0, 0x4e, 0xff, 0x20, 0x3f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xef, 0xc0, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf3, 0x3f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfa, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xfb, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xfb, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf8, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf5, 0x3f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0x98, 0xae, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xe6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x77, 0x63,
-    0x0, 0x0, 0x0,
-
-    /* U+0495 "ҕ" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0,
-    0xcf, 0x83, 0x9d, 0xff, 0xfe, 0xa3, 0x0, 0x0,
-    0xcf, 0xef, 0xff, 0xfd, 0xef, 0xff, 0x80, 0x0,
-    0xcf, 0xfd, 0x62, 0x0, 0x3, 0xaf, 0xf8, 0x0,
-    0xcf, 0x90, 0x0, 0x0, 0x0, 0x8, 0xff, 0x20,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xd0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xaf, 0xf6, 0x0,
-    0x0, 0x0, 0x9, 0xbb, 0xdf, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xb3, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0x55, 0x41, 0x0, 0x0, 0x0,
-
-    /* U+0496 "Җ" */
-    0x5, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xa0,
-    0x0, 0x0, 0xaf, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe,
-    0x10, 0x0, 0x0, 0x1e, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf5, 0x0, 0x0, 0x0, 0x5, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0xf, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xd0,
-    0x0, 0x0, 0x0, 0xf, 0xf5, 0x0, 0x0, 0x0,
-    0x7, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xf7, 0x0, 0x0, 0x0, 0xf, 0xf5, 0x0, 0x0,
-    0x0, 0x2f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x20, 0x0, 0x0, 0xf, 0xf5, 0x0,
-    0x0, 0x0, 0xcf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0, 0xf, 0xf5,
-    0x0, 0x0, 0x7, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xf6, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x2f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x31, 0x11,
-    0x1f, 0xf6, 0x11, 0x11, 0xcf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xfe, 0x10, 0x0, 0xf, 0xf5, 0x0, 0x0, 0xaf,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf5, 0x0, 0x0, 0xf, 0xf5, 0x0, 0x0,
-    0x1e, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xa0, 0x0, 0x0, 0xf, 0xf5, 0x0,
-    0x0, 0x4, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfe, 0x10, 0x0, 0x0, 0xf, 0xf5,
-    0x0, 0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf4, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0xe, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0xf, 0xf5, 0x0, 0x0, 0x0, 0x4, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xd, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xf3, 0x0, 0x0, 0x0, 0x8f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xfd, 0x10, 0x0, 0x3, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf4, 0xd, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf4,
-
-    /* U+0497 "җ" */
-    0xa, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x6f, 0xf2, 0x0, 0x1, 0xef,
-    0x60, 0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0,
-    0x1, 0xef, 0x70, 0x0, 0x0, 0x6f, 0xf1, 0x0,
-    0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0xa, 0xfc,
-    0x0, 0x0, 0x0, 0xb, 0xfa, 0x0, 0x0, 0x0,
-    0xff, 0x50, 0x0, 0x0, 0x4f, 0xf3, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0xff, 0x50,
-    0x0, 0x0, 0xdf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xd0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x8,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8,
-    0x0, 0x0, 0xff, 0x50, 0x0, 0x2f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x20, 0x0,
-    0xff, 0x50, 0x0, 0xbf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfe,
-    0x10, 0x0, 0xff, 0x50, 0x0, 0x9f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf4, 0x0, 0x0,
-    0xff, 0x50, 0x0, 0xd, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x80, 0x0, 0x0, 0xff, 0x50,
-    0x0, 0x2, 0xff, 0x90, 0x0, 0x0, 0x0, 0xd,
-    0xfc, 0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0,
-    0x6f, 0xf5, 0x0, 0x0, 0x0, 0x9f, 0xf2, 0x0,
-    0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0xa, 0xfe,
-    0x20, 0x0, 0x5, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf5,
-    0x2f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x82,
-
-    /* U+0498 "Ҙ" */
-    0x0, 0x0, 0x25, 0x89, 0x98, 0x51, 0x0, 0x0,
-    0x0, 0x0, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xb3,
-    0x0, 0x0, 0xe, 0xff, 0xfc, 0xa8, 0x89, 0xcf,
-    0xff, 0x70, 0x0, 0xb, 0xc6, 0x10, 0x0, 0x0,
-    0x2, 0xbf, 0xf6, 0x0, 0x1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x15, 0xdf,
-    0xd1, 0x0, 0x0, 0x0, 0xbe, 0xee, 0xef, 0xff,
-    0xf9, 0x10, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0xfb, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x14, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf2, 0x12, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xe0, 0x8f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x1b, 0xff, 0x60, 0x6f, 0xfd, 0x73, 0x0,
-    0x0, 0x38, 0xef, 0xf8, 0x0, 0x2, 0xbf, 0xff,
-    0xfe, 0xef, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x2,
-    0x7b, 0xef, 0xff, 0xeb, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfb,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0499 "ҙ" */
-    0x0, 0x3, 0x8c, 0xff, 0xfd, 0xa4, 0x0, 0x0,
-    0x2, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0,
-    0x0, 0xfc, 0x73, 0x10, 0x13, 0x8f, 0xfe, 0x10,
-    0x0, 0x20, 0x0, 0x0, 0x0, 0x2, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0x20,
-    0x0, 0x0, 0x6, 0xaa, 0xac, 0xff, 0xe4, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xfe, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x4b, 0xfb, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf2,
-    0x5, 0x40, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xe0,
-    0xd, 0xfc, 0x62, 0x0, 0x2, 0x6e, 0xff, 0x50,
-    0x4, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0,
-    0x0, 0x4, 0x9c, 0xff, 0xfd, 0xa6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x18, 0x70, 0x0, 0x0, 0x0,
-
-    /* U+049A "Қ" */
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xfe, 0x10, 0x3, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x30, 0x0, 0x3f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x60, 0x0, 0x3,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xa0,
-    0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xd0, 0x0, 0x0, 0x3, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x6f, 0xf2, 0x0, 0x0, 0x0, 0x3f,
-    0xf1, 0x0, 0x0, 0x0, 0x3f, 0xf5, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x10, 0x0, 0x0, 0x1d, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0,
-    0xb, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x21, 0x11, 0x17, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1,
-    0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x10, 0x0, 0x0, 0x9f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0xcf, 0xe1, 0x0, 0x0, 0x0, 0x3, 0xff, 0x10,
-    0x0, 0x0, 0x1, 0xef, 0xb0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x4, 0xff, 0x80,
-    0x0, 0x0, 0x3, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x50, 0x0, 0x0, 0x3f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0x20, 0x0, 0x3,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfd,
-    0x10, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0x83, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x80,
-
-    /* U+049B "қ" */
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x2, 0xff, 0x60,
-    0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0,
-    0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x9f, 0xd0,
-    0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x5f, 0xf2,
-    0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x2e, 0xf5,
-    0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0xc, 0xf9,
-    0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x9, 0xfc,
-    0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x4, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x0,
-    0x3f, 0xfa, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0,
-    0x0, 0x4f, 0xf8, 0x0, 0x0, 0x0, 0xcf, 0x80,
-    0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0xc, 0xf8,
-    0x0, 0x0, 0x0, 0x8f, 0xf4, 0x0, 0x0, 0xcf,
-    0x80, 0x0, 0x0, 0x0, 0xaf, 0xf2, 0x0, 0xc,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfb,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x28, 0x60,
-
-    /* U+049C "Ҝ" */
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0x90, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xfd, 0x0, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf3, 0x0, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x80, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfc,
-    0x0, 0x0, 0x3f, 0xf1, 0x2, 0xfa, 0x0, 0x0,
-    0x6f, 0xf2, 0x0, 0x0, 0x3f, 0xf1, 0x2, 0xfa,
-    0x0, 0x2, 0xff, 0x60, 0x0, 0x0, 0x3f, 0xf1,
-    0x2, 0xfa, 0x0, 0xc, 0xfb, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x2, 0xfa, 0x0, 0x7f, 0xe1, 0x0,
-    0x0, 0x0, 0x3f, 0xf2, 0x14, 0xfb, 0x14, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x2, 0xfa, 0x2, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x3f, 0xf1, 0x2, 0xfa, 0x0, 0x5f,
-    0xf6, 0x0, 0x0, 0x0, 0x3f, 0xf1, 0x2, 0xfa,
-    0x0, 0xa, 0xff, 0x20, 0x0, 0x0, 0x3f, 0xf1,
-    0x2, 0xfa, 0x0, 0x0, 0xdf, 0xd0, 0x0, 0x0,
-    0x3f, 0xf1, 0x1, 0xa7, 0x0, 0x0, 0x3f, 0xf9,
-    0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x40, 0x0, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xe1, 0x0, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xfb, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x70, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf3,
-
-    /* U+049D "ҝ" */
-    0xdf, 0x70, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xc0,
-    0xdf, 0x70, 0x0, 0x0, 0x0, 0x4, 0xff, 0x20,
-    0xdf, 0x70, 0x0, 0x0, 0x0, 0xe, 0xf7, 0x0,
-    0xdf, 0x70, 0x0, 0x0, 0x0, 0x9f, 0xc0, 0x0,
-    0xdf, 0x70, 0x6c, 0x10, 0x4, 0xff, 0x20, 0x0,
-    0xdf, 0x70, 0x8f, 0x20, 0xd, 0xf6, 0x0, 0x0,
-    0xdf, 0x70, 0x8f, 0x20, 0x9f, 0xc0, 0x0, 0x0,
-    0xdf, 0x70, 0x8f, 0x23, 0xff, 0x20, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0xdf, 0x70, 0x8f, 0x22, 0xef, 0x90, 0x0, 0x0,
-    0xdf, 0x70, 0x8f, 0x20, 0x4f, 0xf6, 0x0, 0x0,
-    0xdf, 0x70, 0x8f, 0x20, 0x8, 0xff, 0x20, 0x0,
-    0xdf, 0x70, 0x12, 0x0, 0x0, 0xbf, 0xd0, 0x0,
-    0xdf, 0x70, 0x0, 0x0, 0x0, 0x1e, 0xfa, 0x0,
-    0xdf, 0x70, 0x0, 0x0, 0x0, 0x3, 0xff, 0x70,
-    0xdf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf3,
-
-    /* U+049E "Ҟ" */
-    0x0, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xa0, 0x0, 0x8, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xfd, 0x0, 0x9b, 0xbe,
-    0xff, 0xbb, 0xbb, 0xb7, 0x0, 0x0, 0x6f, 0xf2,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x3, 0xff, 0x50, 0x0, 0x0, 0x8, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xf9, 0x0, 0x0, 0x0,
-    0x8, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0,
-    0x0, 0x0, 0x0, 0x8, 0xfc, 0x0, 0x0, 0x0,
-    0x7, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0x0, 0x0, 0x0, 0x3f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfc, 0x0, 0x0, 0x1, 0xef, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfc, 0x11, 0x11,
-    0x1c, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc, 0x0,
-    0x0, 0xa, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfc, 0x0, 0x0, 0x0, 0xdf, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfc, 0x0, 0x0, 0x0,
-    0x2f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf4, 0x0, 0x0, 0x0, 0x8, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfe, 0x10, 0x0, 0x0, 0x8,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xc0,
-    0x0, 0x0, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf9, 0x0, 0x0, 0x8, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x50, 0x0,
-    0x8, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xf2,
-
-    /* U+049F "ҟ" */
-    0x0, 0xb, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xaa, 0xae,
-    0xfd, 0xaa, 0xaa, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x60, 0x0, 0xb, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0, 0xbf,
-    0x80, 0x0, 0x0, 0x0, 0x9f, 0xd0, 0x0, 0x0,
-    0xb, 0xf8, 0x0, 0x0, 0x0, 0x5f, 0xf2, 0x0,
-    0x0, 0x0, 0xbf, 0x80, 0x0, 0x0, 0x2e, 0xf5,
-    0x0, 0x0, 0x0, 0xb, 0xf8, 0x0, 0x0, 0xc,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x80, 0x0,
-    0x9, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf8,
-    0x0, 0x4, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x3f, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf8, 0x0, 0x0,
-    0x4f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x80,
-    0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x0, 0xb,
-    0xf8, 0x0, 0x0, 0x0, 0x8f, 0xf4, 0x0, 0x0,
-    0x0, 0xbf, 0x80, 0x0, 0x0, 0x0, 0xaf, 0xf2,
-    0x0, 0x0, 0xb, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xd1, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xc0,
-
-    /* U+04A0 "Ҡ" */
-    0xaf, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0x80, 0xaf, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xfb, 0x0, 0x1, 0x11, 0x11, 0x1a, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xfa, 0x0, 0x0, 0x0, 0x9, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfa,
-    0x0, 0x0, 0x0, 0x5f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xfa, 0x0, 0x0, 0x2,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xfb, 0x11, 0x11, 0x2d, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfa, 0x0, 0x0, 0xc, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xfa, 0x0, 0x0,
-    0x1, 0xef, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xfa, 0x0, 0x0, 0x0, 0x4f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfa,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0xa, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xe1,
-
-    /* U+04A1 "ҡ" */
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xf7, 0xe, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0xb, 0xfb, 0x0, 0x0, 0x0, 0xb,
-    0xf9, 0x0, 0x0, 0x0, 0x7, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0xbf, 0x90, 0x0, 0x0, 0x3, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0xb, 0xf9, 0x0, 0x0,
-    0x1, 0xef, 0x60, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x90, 0x0, 0x0, 0xbf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf9, 0x0, 0x0, 0x7f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x90, 0x0, 0x3f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf9, 0x0, 0x2, 0xef,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x90,
-    0x0, 0x3, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf9, 0x0, 0x0, 0x5, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x90, 0x0, 0x0, 0x7,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0xb, 0xf9, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0xbf, 0x90, 0x0, 0x0, 0x0, 0xa, 0xfe, 0x10,
-    0x0, 0x0, 0xb, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfd, 0x0,
-
-    /* U+04A2 "Ң" */
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf8, 0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf8, 0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf8, 0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf8, 0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf8, 0x0, 0x0, 0x3f, 0xf3, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x1d, 0xf8, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf8, 0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf8, 0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf8, 0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf8, 0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xf1, 0x3f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf1,
-
-    /* U+04A3 "ң" */
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
-    0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x60, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf6, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x60, 0x0, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf6, 0x0, 0xc,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x60,
-    0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf6, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x60, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0xcf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6, 0x0,
-    0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x60, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf6, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x60, 0x0, 0xcf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf6, 0x0, 0xc, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf1,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x88, 0x0,
-
-    /* U+04A4 "Ҥ" */
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf9, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf3, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x1e, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+04A5 "ҥ" */
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+04A6 "Ҧ" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf2, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x1b, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xa0,
-    0x0, 0x46, 0x88, 0x62, 0x0, 0x0, 0x0, 0x3f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xfa, 0x3a, 0xff, 0xff, 0xff, 0xfd, 0x40, 0x0,
-    0x3, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xfd, 0x97, 0x67, 0xaf, 0xff,
-    0x90, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xc4, 0x0, 0x0, 0x0,
-    0x1a, 0xff, 0x80, 0x3, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0x30, 0x3f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xfa, 0x3, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x13, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf2, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x13, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfb, 0x3,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xdf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa8, 0x9d, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x67, 0x74, 0x10, 0x0, 0x0,
-    0x0,
-
-    /* U+04A7 "ҧ" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xd0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xd1,
-    0x8c, 0xff, 0xff, 0xb4, 0x0, 0x0, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0xef, 0xff, 0xa0, 0x0, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xfe, 0x72, 0x0, 0x2, 0x9f,
-    0xfb, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xe0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x60,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xd0, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf1, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf3, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf4,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x9f, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xbb,
-    0xcf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xd5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x55, 0x42, 0x0, 0x0, 0x0,
-
-    /* U+04A8 "Ҩ" */
-    0x0, 0x0, 0x1a, 0x80, 0x0, 0x0, 0x0, 0x5b,
-    0xef, 0xfd, 0xa4, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xfe, 0x40, 0x0, 0x2, 0xdf, 0xff, 0xff, 0xff,
-    0xfb, 0x10, 0x0, 0x0, 0x1e, 0xfd, 0x10, 0x0,
-    0x3, 0xff, 0xf9, 0x42, 0x25, 0xbf, 0xfd, 0x10,
-    0x0, 0xc, 0xfe, 0x10, 0x0, 0x1, 0xef, 0xd2,
-    0x0, 0x0, 0x0, 0x5f, 0xfc, 0x0, 0x6, 0xff,
-    0x30, 0x0, 0x0, 0xaf, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf6, 0x0, 0xef, 0x90, 0x0, 0x0,
-    0x1f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xd0, 0x5f, 0xf2, 0x0, 0x0, 0x6, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x1a, 0xfc,
-    0x0, 0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf4, 0xdf, 0x80, 0x0, 0x0,
-    0xc, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x5f, 0xf6, 0x0, 0x0, 0x0, 0xcf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf6, 0xff,
-    0x50, 0x0, 0x0, 0xc, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x4f, 0xf6, 0x0, 0x0,
-    0x0, 0xaf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0xdf, 0x80, 0x0, 0x0, 0x7, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfe, 0xa,
-    0xfc, 0x0, 0x0, 0x0, 0x2f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x90, 0x5f, 0xf2, 0x0,
-    0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0xef, 0x90, 0x0, 0x0, 0x4,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x0,
-    0x6, 0xff, 0x40, 0x0, 0x0, 0xa, 0xfe, 0x10,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0xb, 0xff,
-    0x30, 0x0, 0x0, 0xd, 0xfd, 0x20, 0x0, 0x9,
-    0xfe, 0x20, 0x0, 0x0, 0xc, 0xff, 0x70, 0x0,
-    0x0, 0x1d, 0xff, 0x60, 0x3c, 0xfd, 0x20, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xe7, 0x20, 0x0, 0xa,
-    0xff, 0xef, 0xfa, 0x0, 0x0, 0x11, 0x0, 0x0,
-    0x4, 0xdf, 0xff, 0xfd, 0xcd, 0xef, 0xff, 0xff,
-    0xfc, 0xcc, 0xef, 0x80, 0x0, 0x0, 0x0, 0x38,
-    0xce, 0xff, 0xfd, 0xa6, 0x47, 0xbe, 0xff, 0xfe,
-    0xb5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+04A9 "ҩ" */
-    0x0, 0x0, 0x7d, 0x40, 0x0, 0x1, 0x8c, 0xff,
-    0xea, 0x40, 0x0, 0x0, 0x0, 0xaf, 0xf6, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x8f, 0xf4, 0x0, 0x4, 0xff, 0xc4, 0x0, 0x29,
-    0xff, 0xa0, 0x0, 0x2f, 0xf6, 0x0, 0x0, 0xef,
-    0xa0, 0x0, 0x0, 0x5, 0xff, 0x40, 0xa, 0xfc,
-    0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0, 0xb,
-    0xfb, 0x0, 0xff, 0x60, 0x0, 0xa, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf0, 0x3f, 0xf1, 0x0,
-    0x0, 0xcf, 0x60, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x5, 0xff, 0x0, 0x0, 0xd, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf0, 0x5f, 0xf0, 0x0, 0x0,
-    0xcf, 0x70, 0x0, 0x0, 0x0, 0x4, 0xff, 0x3,
-    0xff, 0x10, 0x0, 0xa, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xb0, 0xf, 0xf5, 0x0, 0x0, 0x5f,
-    0xf0, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x0, 0xbf,
-    0xc0, 0x0, 0x0, 0xef, 0x80, 0x0, 0x0, 0x6,
-    0xfd, 0x0, 0x3, 0xff, 0x60, 0x0, 0x6, 0xff,
-    0x40, 0x0, 0x4, 0xff, 0x30, 0x0, 0x8, 0xff,
-    0x70, 0x0, 0xa, 0xff, 0x60, 0x6, 0xff, 0x60,
-    0x0, 0x0, 0x9, 0xff, 0xc5, 0x0, 0xa, 0xff,
-    0xcc, 0xff, 0x50, 0x0, 0x0, 0x0, 0x5, 0xef,
-    0xff, 0xdc, 0xcf, 0xff, 0xff, 0xec, 0xcd, 0xf2,
-    0x0, 0x0, 0x0, 0x5a, 0xdf, 0xff, 0xdb, 0x8b,
-    0xef, 0xfe, 0xda, 0x20,
-
-    /* U+04AA "Ҫ" */
-    0x0, 0x0, 0x0, 0x0, 0x5a, 0xdf, 0xff, 0xda,
-    0x61, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x2d,
-    0xff, 0xe9, 0x53, 0x22, 0x48, 0xdf, 0xfd, 0x20,
-    0x0, 0x3f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x5e, 0xf7, 0x0, 0x1e, 0xfe, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x16, 0x0, 0xa, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xe3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x60, 0x0, 0x3, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0x70,
-    0x0, 0x3, 0xdf, 0xfe, 0x95, 0x21, 0x24, 0x7d,
-    0xff, 0xd2, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xad, 0xff, 0xfd, 0xa6, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf3,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+04AB "ҫ" */
-    0x0, 0x0, 0x4, 0x9d, 0xff, 0xeb, 0x60, 0x0,
-    0x0, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xfe, 0x40,
-    0x0, 0x2e, 0xff, 0x93, 0x0, 0x16, 0xdf, 0xf4,
-    0x0, 0xdf, 0xe2, 0x0, 0x0, 0x0, 0xa, 0xf7,
-    0x8, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x30,
-    0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x30,
-    0x0, 0xdf, 0xe3, 0x0, 0x0, 0x0, 0xa, 0xf7,
-    0x0, 0x2e, 0xff, 0x93, 0x10, 0x26, 0xdf, 0xf4,
-    0x0, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xfe, 0x40,
-    0x0, 0x0, 0x3, 0x9d, 0xff, 0xeb, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x78, 0x10, 0x0, 0x0,
-
-    /* U+04AC "Ҭ" */
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x1, 0x11, 0x11, 0x11, 0xcf,
-    0x91, 0x11, 0x11, 0x11, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x10, 0x0,
-    0x0,
-
-    /* U+04AD "ҭ" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0x83, 0x0, 0x0,
-
-    /* U+04AE "Ү" */
-    0x6f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x30, 0xcf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x90, 0x2, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xe1, 0x0,
-    0x8, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xf6, 0x0, 0x0, 0xe, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xfc, 0x0, 0x0, 0x0, 0x4f, 0xf3,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0xaf, 0xd0, 0x0, 0x0, 0x0, 0xdf, 0x80,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x70, 0x0, 0x0,
-    0x7f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0x20, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfb, 0x0, 0xb, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf5, 0x5, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xe2, 0xef, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xef, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+04AF "ү" */
-    0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf5, 0x1f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xe0, 0x9, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x70, 0x2, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x10, 0x0, 0xbf, 0xb0, 0x0,
-    0x0, 0x0, 0xa, 0xf9, 0x0, 0x0, 0x4f, 0xf2,
-    0x0, 0x0, 0x0, 0x1f, 0xf2, 0x0, 0x0, 0xc,
-    0xf8, 0x0, 0x0, 0x0, 0x8f, 0xb0, 0x0, 0x0,
-    0x5, 0xff, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0,
-    0x0, 0x0, 0xef, 0x60, 0x0, 0x6, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0xd, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf4, 0x0, 0x4f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfb, 0x0,
-    0xcf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x23, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x9a, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x10, 0x0, 0x0, 0x0,
-
-    /* U+04B0 "Ұ" */
-    0x6f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x30, 0xcf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x90, 0x2, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xe1, 0x0,
-    0x8, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xf5, 0x0, 0x0, 0xd, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xfb, 0x0, 0x0, 0x0, 0x4f, 0xf4,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0xaf, 0xd0, 0x0, 0x0, 0x0, 0xdf, 0x80,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x80, 0x0, 0x0,
-    0x8f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0x20, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfc, 0x0, 0xc, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6, 0x6, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xe3, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4a, 0xaa, 0xad, 0xff, 0xfc, 0xaa,
-    0xaa, 0x10, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+04B1 "ұ" */
-    0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf5, 0x1f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xe0, 0x9, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x70, 0x2, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x10, 0x0, 0xbf, 0xa0, 0x0,
-    0x0, 0x0, 0x9, 0xf9, 0x0, 0x0, 0x4f, 0xf1,
-    0x0, 0x0, 0x0, 0x1f, 0xf2, 0x0, 0x0, 0xd,
-    0xf8, 0x0, 0x0, 0x0, 0x7f, 0xb0, 0x0, 0x0,
-    0x6, 0xfe, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0,
-    0x0, 0x0, 0xef, 0x60, 0x0, 0x6, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xd0, 0x0, 0xd, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf4, 0x0, 0x4f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfa, 0x0,
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x22, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x89, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xef, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x7a, 0xaa, 0xab, 0xff, 0xaa, 0xaa,
-    0xa5, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x10, 0x0, 0x0, 0x0,
-
-    /* U+04B2 "Ҳ" */
-    0x5, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xf2, 0x0, 0x0, 0xaf, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0x60, 0x0, 0x0, 0xd,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfa, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0xdf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf4,
-    0x0, 0x0, 0x9, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfe, 0x10, 0x0, 0x4f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xc0, 0x1,
-    0xef, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf8, 0xc, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xaf, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xdf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xfa, 0xd, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xd0, 0x3,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0x30, 0x0, 0x7f, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0xb, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x1, 0xef, 0xb0, 0x0,
-    0x0, 0x1, 0xef, 0xd0, 0x0, 0x0, 0x0, 0xc,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0,
-    0x0, 0x0, 0x7f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x50, 0x0, 0x3, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0xd,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfb,
-
-    /* U+04B3 "ҳ" */
-    0xc, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9,
-    0x0, 0x2, 0xef, 0x80, 0x0, 0x0, 0x0, 0xaf,
-    0xc0, 0x0, 0x0, 0x4f, 0xf4, 0x0, 0x0, 0x6,
-    0xfe, 0x20, 0x0, 0x0, 0x8, 0xfe, 0x10, 0x0,
-    0x3f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xc0,
-    0x1, 0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xf8, 0xb, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xaf, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xfe, 0x4f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf3, 0x6,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x2, 0xff, 0x70,
-    0x0, 0xaf, 0xd0, 0x0, 0x0, 0x0, 0xd, 0xfa,
-    0x0, 0x0, 0xd, 0xfa, 0x0, 0x0, 0x0, 0x9f,
-    0xd1, 0x0, 0x0, 0x2, 0xff, 0x60, 0x0, 0x6,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfe,
-    0x2f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x87,
-
-    /* U+04B4 "Ҵ" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0xef, 0x70, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0xe, 0xf7, 0x0, 0x0, 0x1,
-    0x11, 0x11, 0x11, 0xcf, 0xb1, 0x11, 0x11, 0x10,
-    0x0, 0x0, 0x0, 0xef, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x18, 0x80,
-
-    /* U+04B5 "ҵ" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0xdf, 0x70, 0xe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf2, 0x0, 0xd, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x70, 0x0, 0x0, 0x0, 0x9, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x70, 0x0, 0x0, 0x0, 0x9, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x70,
-    0x0, 0x0, 0x0, 0x9, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x70, 0x0,
-    0x0, 0x0, 0x9, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x70, 0x0, 0x0,
-    0x0, 0x9, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x70, 0x0, 0x0, 0x0,
-    0x9, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x70, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x18, 0x70,
-
-    /* U+04B6 "Ҷ" */
-    0x1f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x90, 0x0, 0x1, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf9, 0x0, 0x0, 0x1f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x90, 0x0, 0x1, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf9, 0x0, 0x0, 0x1f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x90,
-    0x0, 0x1, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf9, 0x0, 0x0, 0x1f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x90, 0x0,
-    0x1, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf9, 0x0, 0x0, 0xf, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x90, 0x0, 0x0,
-    0xcf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf9, 0x0, 0x0, 0x5, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xdf, 0x90, 0x0, 0x0, 0xa,
-    0xff, 0xe7, 0x20, 0x0, 0x25, 0x9d, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xef, 0x90, 0x0, 0x0, 0x0, 0x2,
-    0x8d, 0xff, 0xff, 0xeb, 0x72, 0xb, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
-    0x0, 0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x20,
-
-    /* U+04B7 "ҷ" */
-    0x8f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0,
-    0x0, 0x8f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf0, 0x0, 0x8f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf0, 0x0, 0x8f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf0, 0x0, 0x8f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf0, 0x0, 0x7f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0, 0x6f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0, 0x3f,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0,
-    0xc, 0xff, 0x81, 0x0, 0x1, 0x49, 0xff, 0xf0,
-    0x0, 0x1, 0xdf, 0xff, 0xed, 0xef, 0xff, 0xef,
-    0xf0, 0x0, 0x0, 0x6, 0xbe, 0xff, 0xeb, 0x72,
-    0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x85,
-
-    /* U+04B8 "Ҹ" */
-    0x1f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x91, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf9, 0x1f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x91, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x1f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x91,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf9, 0x1f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x91, 0xff, 0x30, 0x0, 0x3, 0xa4,
-    0x0, 0x0, 0xc, 0xf9, 0xf, 0xf7, 0x0, 0x0,
-    0x5f, 0x70, 0x0, 0x0, 0xcf, 0x90, 0xcf, 0xd0,
-    0x0, 0x5, 0xf7, 0x0, 0x0, 0xc, 0xf9, 0x5,
-    0xff, 0xa0, 0x0, 0x5f, 0x70, 0x0, 0x3, 0xdf,
-    0x90, 0xa, 0xff, 0xe7, 0x26, 0xf7, 0x25, 0x9d,
-    0xff, 0xf9, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0xef, 0x90, 0x0, 0x2, 0x8d, 0xff,
-    0xff, 0xeb, 0x72, 0xc, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x70, 0x0, 0x0, 0xcf, 0x90, 0x0,
-    0x0, 0x0, 0x5, 0xf7, 0x0, 0x0, 0xc, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x70, 0x0, 0x0,
-    0xcf, 0x90, 0x0, 0x0, 0x0, 0x5, 0xf7, 0x0,
-    0x0, 0xc, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x70, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf9,
-
-    /* U+04B9 "ҹ" */
-    0x8f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x8f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x8f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0xfc, 0x0,
-    0x1, 0x84, 0x0, 0x5, 0xff, 0x7f, 0xe0, 0x0,
-    0x2f, 0x80, 0x0, 0x5f, 0xf3, 0xff, 0x50, 0x2,
-    0xf8, 0x0, 0x5, 0xff, 0xc, 0xff, 0x81, 0x2f,
-    0x81, 0x5a, 0xff, 0xf0, 0x1d, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0x0, 0x6, 0xbe, 0xff, 0xeb,
-    0x72, 0x5f, 0xf0, 0x0, 0x0, 0x2, 0xf8, 0x0,
-    0x5, 0xff, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0,
-    0x5f, 0xf0, 0x0, 0x0, 0x2, 0xf8, 0x0, 0x5,
-    0xff, 0x0, 0x0, 0x0, 0x18, 0x40, 0x0, 0x5f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0,
-
-    /* U+04BA "Һ" */
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x10, 0x48, 0xce, 0xff,
-    0xec, 0x83, 0x0, 0x0, 0x3f, 0xfa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x3, 0xff, 0xff,
-    0xd8, 0x52, 0x11, 0x37, 0xdf, 0xfc, 0x0, 0x3f,
-    0xf9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8,
-    0x3, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xf0, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x43, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf7, 0x3f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x73, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x83, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf8, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x83, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x83,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf8,
-
-    /* U+04BB "һ" */
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x6, 0xbe, 0xff, 0xd9, 0x20, 0x0,
-    0xcf, 0x82, 0xdf, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0xcf, 0xae, 0xfa, 0x41, 0x2, 0x6d, 0xff, 0x60,
-    0xcf, 0xff, 0x40, 0x0, 0x0, 0x0, 0xcf, 0xe0,
-    0xcf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf5,
-    0xcf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9,
-    0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfa,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfb,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfb,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfb,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfb,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfb,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfb,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfb,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfb,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfb,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfb,
-
-    /* U+04BC "Ҽ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5a,
-    0xdf, 0xff, 0xda, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1c, 0xff, 0xe9, 0x42, 0x12,
-    0x48, 0xef, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xd1, 0x0, 0x1, 0xa7, 0x0, 0x0,
-    0xc, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x8, 0xfc, 0x0, 0x0, 0x7f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x70, 0xd, 0xf6, 0x0, 0x0, 0xef, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xe0, 0xe, 0xf5, 0x0, 0x5, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf5,
-    0xc, 0xfa, 0x0, 0x9, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x6,
-    0xff, 0x92, 0xc, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfb, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x6, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xc,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xef, 0xf8, 0x10, 0x0, 0x0,
-    0x0, 0x4, 0xdf, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2d, 0xff, 0xf9, 0x52, 0x12, 0x48,
-    0xdf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x59, 0xdf, 0xff, 0xda, 0x61, 0x0,
-    0x0, 0x0,
-
-    /* U+04BD "ҽ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x39, 0xdf, 0xfe,
-    0xb6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xbf, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xf8, 0x20, 0x1, 0x5c,
-    0xff, 0x50, 0x0, 0x9a, 0x20, 0x0, 0xdf, 0xd2,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0x20, 0x1f, 0xe0,
-    0x0, 0x7f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfb, 0x3, 0xfd, 0x0, 0xd, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf2, 0x2f, 0xf3, 0x2,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x60, 0xaf, 0xfc, 0xcf, 0xfb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbe, 0xf9, 0x0, 0x7d, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x4f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x9c,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xfb, 0x52,
-    0x0, 0x27, 0xdf, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0xce, 0xff,
-    0xda, 0x50, 0x0, 0x0,
-
-    /* U+04BE "Ҿ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5a,
-    0xdf, 0xff, 0xda, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1c, 0xff, 0xe9, 0x42, 0x12,
-    0x48, 0xef, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xd1, 0x0, 0x1, 0xa7, 0x0, 0x0,
-    0xc, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x8, 0xfc, 0x0, 0x0, 0x7f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x70, 0xd, 0xf6, 0x0, 0x0, 0xef, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xe0, 0xe, 0xf5, 0x0, 0x5, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf5,
-    0xc, 0xfa, 0x0, 0x9, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x6,
-    0xff, 0x92, 0xc, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfb, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x6, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xc,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xef, 0xf8, 0x10, 0x0, 0x0,
-    0x0, 0x4, 0xdf, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2d, 0xff, 0xf9, 0x52, 0x12, 0x48,
-    0xdf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x59, 0xdf, 0xff, 0xda, 0x61, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+04BF "ҿ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x39, 0xdf, 0xfe,
-    0xb6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xbf, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xf8, 0x20, 0x1, 0x5c,
-    0xff, 0x50, 0x0, 0x9a, 0x20, 0x0, 0xdf, 0xd2,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0x20, 0x1f, 0xe0,
-    0x0, 0x7f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfb, 0x3, 0xfd, 0x0, 0xd, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf2, 0x2f, 0xf3, 0x2,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x60, 0xaf, 0xfc, 0xcf, 0xfb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbe, 0xf9, 0x0, 0x7d, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x4f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x9c,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xfb, 0x52,
-    0x0, 0x27, 0xdf, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0xcf, 0xff,
-    0xda, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x83, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+04C0 "Ӏ" */
-    0x3f, 0xf2, 0x3f, 0xf2, 0x3f, 0xf2, 0x3f, 0xf2,
-    0x3f, 0xf2, 0x3f, 0xf2, 0x3f, 0xf2, 0x3f, 0xf2,
-    0x3f, 0xf2, 0x3f, 0xf2, 0x3f, 0xf2, 0x3f, 0xf2,
-    0x3f, 0xf2, 0x3f, 0xf2, 0x3f, 0xf2, 0x3f, 0xf2,
-    0x3f, 0xf2, 0x3f, 0xf2, 0x3f, 0xf2, 0x3f, 0xf2,
-    0x3f, 0xf2, 0x3f, 0xf2,
-
-    /* U+04C1 "Ӂ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xd0, 0x0,
-    0x0, 0x6, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf3, 0x0,
-    0x0, 0xc, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x62,
-    0x14, 0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0xff,
-    0xff, 0xe7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x13,
-    0x42, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xa0,
-    0x0, 0xaf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0x10,
-    0x0, 0x1e, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf5, 0x0,
-    0x0, 0x5, 0xff, 0x30, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xb0, 0x0,
-    0x0, 0x0, 0xaf, 0xd0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x1e, 0xf7, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x2f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x20, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0xcf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x7, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xf6, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x2f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x31, 0x11, 0x1f,
-    0xf6, 0x11, 0x11, 0xcf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xfe, 0x10, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0xaf, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf5, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x1e, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xa0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x4, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfe, 0x10, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf4, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0xe, 0xfd, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x90, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x4, 0xff, 0x80, 0x0,
-    0x0, 0xd, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf3, 0x0,
-    0x0, 0x8f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfd, 0x0,
-    0x3, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x90,
-    0xd, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf3,
-
-    /* U+04C2 "ӂ" */
-    0x0, 0x0, 0x0, 0x0, 0x48, 0x0, 0x0, 0x0,
-    0x57, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x50, 0x0, 0x0, 0xed, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf7,
-    0x22, 0x5c, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xbf, 0xff, 0xfe, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x44, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x50, 0x0, 0x0, 0x0, 0x6f, 0xf2,
-    0x1, 0xef, 0x60, 0x0, 0x0, 0x0, 0xff, 0x50,
-    0x0, 0x0, 0x1, 0xef, 0x70, 0x0, 0x6f, 0xf1,
-    0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0xa,
-    0xfc, 0x0, 0x0, 0xb, 0xfa, 0x0, 0x0, 0x0,
-    0xff, 0x50, 0x0, 0x0, 0x4f, 0xf3, 0x0, 0x0,
-    0x2, 0xff, 0x40, 0x0, 0x0, 0xff, 0x50, 0x0,
-    0x0, 0xdf, 0x80, 0x0, 0x0, 0x0, 0x7f, 0xd0,
-    0x0, 0x0, 0xff, 0x50, 0x0, 0x8, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf8, 0x0, 0x0, 0xff,
-    0x50, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x20, 0x0, 0xff, 0x50, 0x0, 0xbf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xfe, 0x10, 0x0, 0xff, 0x50, 0x0, 0x9f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf4, 0x0, 0x0,
-    0xff, 0x50, 0x0, 0xd, 0xfd, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x80, 0x0, 0x0, 0xff, 0x50, 0x0,
-    0x2, 0xff, 0x90, 0x0, 0x0, 0xd, 0xfc, 0x0,
-    0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0x6f, 0xf5,
-    0x0, 0x0, 0x9f, 0xf2, 0x0, 0x0, 0x0, 0xff,
-    0x50, 0x0, 0x0, 0xa, 0xfe, 0x20, 0x5, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0xdf, 0xc0, 0x2f, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x50, 0x0, 0x0, 0x0, 0x3f, 0xf8,
-
-    /* U+04C3 "Ӄ" */
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfd, 0x13, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfe, 0x20, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x30, 0x3, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x60, 0x0, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0x80, 0x0, 0x3,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0xcf, 0xb0, 0x0,
-    0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x9f, 0xc0,
-    0x0, 0x0, 0x3, 0xff, 0x10, 0x0, 0x0, 0x7f,
-    0xe1, 0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0,
-    0x4f, 0xf3, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x21, 0x11, 0x17, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x5, 0xff,
-    0xa0, 0x0, 0x0, 0x3, 0xff, 0x10, 0x0, 0x0,
-    0x6, 0xff, 0x90, 0x0, 0x0, 0x3f, 0xf1, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x70, 0x0, 0x3, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x9, 0xff, 0x40, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfe,
-    0x10, 0x3, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xfa, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf3, 0x3, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xb0, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x13,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x62, 0x15, 0xef, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xae, 0xff,
-    0xb3, 0x0,
-
-    /* U+04C4 "ӄ" */
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x2, 0xff, 0x5c,
-    0xf8, 0x0, 0x0, 0x0, 0x1, 0xef, 0x70, 0xcf,
-    0x80, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0xc, 0xf8,
-    0x0, 0x0, 0x0, 0xaf, 0xc0, 0x0, 0xcf, 0x80,
-    0x0, 0x0, 0x7f, 0xd1, 0x0, 0xc, 0xf8, 0x0,
-    0x0, 0x4f, 0xf2, 0x0, 0x0, 0xcf, 0x80, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0xaf,
-    0xf4, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0xaf,
-    0xf3, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0xbf,
-    0xe1, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0xdf,
-    0xb0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x50, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x9, 0xfd,
-    0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf3,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x0, 0x0,
-    0x0, 0x6, 0x10, 0x1a, 0xff, 0x30, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x28, 0xdf, 0xfc, 0x50, 0x0,
-
-    /* U+04C6 "ӆ" */
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0, 0x0, 0x0,
-    0x7f, 0x90, 0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0,
-    0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x4f,
-    0xf0, 0x0, 0x0, 0x0, 0x9f, 0x70, 0x0, 0x0,
-    0x0, 0x4f, 0xf0, 0x0, 0x0, 0x0, 0xaf, 0x60,
-    0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0, 0x0, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0,
-    0x0, 0x0, 0xcf, 0x40, 0x0, 0x0, 0x0, 0x4f,
-    0xf0, 0x0, 0x0, 0x0, 0xdf, 0x20, 0x0, 0x0,
-    0x0, 0x4f, 0xf0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0, 0x0, 0x2,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0,
-    0x0, 0x5, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf0, 0x0, 0x0, 0x6f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0, 0xae, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfd, 0xd8,
-    0xbf, 0xe8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x68, 0x0,
-
-    /* U+04C7 "Ӈ" */
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf5, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf5, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf5, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf5, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf5, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf5, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf5, 0x3f, 0xf3, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x1f, 0xf5, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf5, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf5, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf5, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf5, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf5, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf5, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf5, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x0, 0x0, 0xaf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xea, 0x9d, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x15, 0x64,
-    0x0, 0x0,
-
-    /* U+04C8 "ӈ" */
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf6,
-    0x0, 0x0, 0x0, 0x2, 0x61, 0x2, 0xbf, 0xf1,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x2, 0xae, 0xff, 0xc4, 0x0,
-
-    /* U+04C9 "Ӊ" */
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf8, 0x0, 0x3, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x80, 0x0, 0x3f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf8, 0x0, 0x3, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x80, 0x0, 0x3f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8,
-    0x0, 0x3, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x80, 0x0, 0x3f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x0,
-    0x3, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x80, 0x0, 0x3f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x0, 0x3,
-    0xff, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0xdf, 0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf8, 0x0, 0x3, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x80,
-    0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf8, 0x0, 0x3, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x80, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf8, 0x0, 0x3, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x80, 0x0, 0x3f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf8, 0x0, 0x3, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x80, 0x0, 0x3f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0x93, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xb0, 0x0,
-
-    /* U+04CA "ӊ" */
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
-    0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x60, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf6, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x60, 0x0, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf6, 0x0, 0xc,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x60,
-    0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf6, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x60, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0xcf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6, 0x0,
-    0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x60, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf6, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x60, 0x0, 0xcf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf6, 0x0, 0xc, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0x30, 0x0,
-
-    /* U+04CB "Ӌ" */
-    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x82, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf8, 0x2f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x82, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x2f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x82,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf8, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x81, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf8, 0xf, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x80, 0xcf, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x5,
-    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef,
-    0x80, 0x9, 0xff, 0xe8, 0x41, 0x12, 0x47, 0xaf,
-    0xff, 0xf8, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0xef, 0x80, 0x0, 0x1, 0x7b, 0xef,
-    0xfe, 0xc9, 0x51, 0xd, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x80, 0x0,
-    0x0,
-
-    /* U+04CC "ӌ" */
-    0x9f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xe9,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfe, 0x9f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xe9, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfe, 0x9f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xe9, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfe, 0x7f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xe3, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x7, 0xfe, 0xb, 0xff, 0x93, 0x0,
-    0x13, 0x7d, 0xff, 0xe0, 0x1b, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xfe, 0x0, 0x4, 0x9c, 0xed, 0xc9,
-    0x51, 0x6f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xef, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x86, 0x0, 0x0,
-
-    /* U+04CD "Ӎ" */
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x0, 0x0, 0x3f, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0x0, 0x0, 0x3f, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0x0, 0x0, 0x3f, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0x0, 0x0,
-    0x3f, 0xfc, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xfb, 0xff, 0x0, 0x0, 0x3f, 0xf3,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xe4, 0xff, 0x0, 0x0, 0x3f, 0xf0, 0x9f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x53, 0xff,
-    0x0, 0x0, 0x3f, 0xf0, 0x1e, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x3, 0xff, 0x0, 0x0,
-    0x3f, 0xf0, 0x6, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf2, 0x3, 0xff, 0x0, 0x0, 0x3f, 0xf0,
-    0x0, 0xcf, 0x60, 0x0, 0x0, 0x0, 0x9f, 0x90,
-    0x3, 0xff, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x3f,
-    0xf1, 0x0, 0x0, 0x2, 0xfe, 0x10, 0x3, 0xff,
-    0x0, 0x0, 0x3f, 0xf0, 0x0, 0xa, 0xfa, 0x0,
-    0x0, 0xc, 0xf6, 0x0, 0x3, 0xff, 0x0, 0x0,
-    0x3f, 0xf0, 0x0, 0x1, 0xff, 0x30, 0x0, 0x5f,
-    0xd0, 0x0, 0x3, 0xff, 0x0, 0x0, 0x3f, 0xf0,
-    0x0, 0x0, 0x7f, 0xd0, 0x0, 0xef, 0x40, 0x0,
-    0x3, 0xff, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0,
-    0xd, 0xf6, 0x8, 0xfa, 0x0, 0x0, 0x3, 0xff,
-    0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0, 0x4, 0xff,
-    0x3f, 0xf2, 0x0, 0x0, 0x3, 0xff, 0x0, 0x0,
-    0x3f, 0xf0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x80,
-    0x0, 0x0, 0x3, 0xff, 0x0, 0x0, 0x3f, 0xf0,
-    0x0, 0x0, 0x0, 0x2f, 0xfe, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0,
-    0x0, 0x8, 0xf5, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x20, 0x0, 0x0, 0x0, 0x3, 0xff, 0x10, 0x0,
-    0x3f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf4, 0x3f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf6, 0x0,
-
-    /* U+04CE "ӎ" */
-    0xcf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf0, 0x0, 0xcf, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xf0, 0x0, 0xcf, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf0,
-    0x0, 0xcf, 0xef, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xef, 0xf0, 0x0, 0xcf, 0x7f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x6f, 0xf0, 0x0, 0xcf,
-    0x58, 0xfb, 0x0, 0x0, 0x0, 0x5, 0xfc, 0xf,
-    0xf0, 0x0, 0xcf, 0x50, 0xdf, 0x50, 0x0, 0x0,
-    0xe, 0xf3, 0xf, 0xf0, 0x0, 0xcf, 0x50, 0x5f,
-    0xe0, 0x0, 0x0, 0x8f, 0x90, 0xf, 0xf0, 0x0,
-    0xcf, 0x50, 0xb, 0xf7, 0x0, 0x2, 0xfe, 0x10,
-    0xf, 0xf0, 0x0, 0xcf, 0x50, 0x2, 0xff, 0x10,
-    0xb, 0xf6, 0x0, 0xf, 0xf0, 0x0, 0xcf, 0x50,
-    0x0, 0x8f, 0xa0, 0x4f, 0xc0, 0x0, 0xf, 0xf0,
-    0x0, 0xcf, 0x50, 0x0, 0xe, 0xf4, 0xdf, 0x30,
-    0x0, 0xf, 0xf0, 0x0, 0xcf, 0x50, 0x0, 0x5,
-    0xff, 0xf9, 0x0, 0x0, 0xf, 0xf0, 0x0, 0xcf,
-    0x50, 0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0xf,
-    0xf0, 0x0, 0xcf, 0x50, 0x0, 0x0, 0x2f, 0x60,
-    0x0, 0x0, 0xf, 0xf0, 0x0, 0xcf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfd,
-    0xcf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x48, 0x20,
-
-    /* U+04CF "ӏ" */
-    0xbf, 0x8b, 0xf8, 0xbf, 0x8b, 0xf8, 0xbf, 0x8b,
-    0xf8, 0xbf, 0x8b, 0xf8, 0xbf, 0x8b, 0xf8, 0xbf,
-    0x8b, 0xf8, 0xbf, 0x8b, 0xf8, 0xbf, 0x8b, 0xf8,
-    0xbf, 0x8b, 0xf8, 0xbf, 0x8b, 0xf8, 0xbf, 0x8b,
-    0xf8, 0xbf, 0x8b, 0xf8,
-
-    /* U+04D0 "Ӑ" */
-    0x0, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x0, 0xb,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xd0, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfc, 0x51, 0x26, 0xef,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6e, 0xff, 0xff, 0xd4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x41, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfd, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf6, 0xaf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xe0, 0x2f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x70, 0xb, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x0, 0x4, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf8, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x5f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xa0, 0x0, 0x0, 0xe, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x30, 0x0, 0x0, 0x7,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf5, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfe, 0xee, 0xee, 0xee, 0xee,
-    0xef, 0xfc, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0xe, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xb0, 0x0, 0x0, 0x6f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf3, 0x0,
-    0x0, 0xef, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfa, 0x0, 0x5, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x20,
-    0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x90, 0x4f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1,
-
-    /* U+04D1 "ӑ" */
-    0x0, 0x5, 0x70, 0x0, 0x0, 0x6, 0x60, 0x0,
-    0x0, 0x8f, 0x30, 0x0, 0x1, 0xfb, 0x0, 0x0,
-    0x2, 0xfe, 0x62, 0x25, 0xdf, 0x40, 0x0, 0x0,
-    0x3, 0xcf, 0xff, 0xfd, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x14, 0x42, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0xbe,
-    0xff, 0xeb, 0x50, 0x0, 0x1, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xc1, 0x0, 0x9f, 0xf9, 0x41, 0x0,
-    0x28, 0xff, 0xc0, 0x1, 0xa1, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfd, 0x0, 0x1, 0x69, 0xab, 0xbb, 0xbb, 0xdf,
-    0xd0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x8, 0xff, 0x82, 0x0, 0x0, 0x0, 0x7f, 0xd0,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x7, 0xfd, 0x3f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xd3, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfd, 0x1f, 0xf4,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xd0, 0x9f, 0xe4,
-    0x0, 0x0, 0x19, 0xfd, 0xfd, 0x0, 0xbf, 0xfd,
-    0xaa, 0xcf, 0xf8, 0x5f, 0xd0, 0x0, 0x5a, 0xef,
-    0xfd, 0x93, 0x5, 0xfd,
-
-    /* U+04D2 "Ӓ" */
-    0x0, 0x0, 0x0, 0x0, 0x9a, 0x0, 0x2, 0xb7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x60, 0x9, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xde, 0x20, 0x4, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfd, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf6, 0xaf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xe0, 0x2f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x70, 0xb, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x0, 0x4, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf8, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x5f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xa0, 0x0, 0x0, 0xe, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x30, 0x0, 0x0, 0x7,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf5, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfe, 0xee, 0xee, 0xee, 0xee,
-    0xef, 0xfc, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0xe, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xb0, 0x0, 0x0, 0x6f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf3, 0x0,
-    0x0, 0xef, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfa, 0x0, 0x5, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x20,
-    0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x90, 0x4f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1,
-
-    /* U+04D3 "ӓ" */
-    0x0, 0x0, 0xbf, 0x40, 0x2, 0xed, 0x10, 0x0,
-    0x0, 0x1f, 0xf9, 0x0, 0x6f, 0xf4, 0x0, 0x0,
-    0x0, 0x7b, 0x20, 0x1, 0xa9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27,
-    0xbe, 0xff, 0xeb, 0x50, 0x0, 0x1, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xc1, 0x0, 0x9f, 0xf9, 0x41,
-    0x0, 0x28, 0xff, 0xc0, 0x1, 0xa1, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfd, 0x0, 0x1, 0x69, 0xab, 0xbb, 0xbb,
-    0xdf, 0xd0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x8, 0xff, 0x82, 0x0, 0x0, 0x0, 0x7f,
-    0xd0, 0xff, 0x70, 0x0, 0x0, 0x0, 0x7, 0xfd,
-    0x3f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xd3,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfd, 0x1f,
-    0xf4, 0x0, 0x0, 0x0, 0x6, 0xff, 0xd0, 0x9f,
-    0xe4, 0x0, 0x0, 0x19, 0xfd, 0xfd, 0x0, 0xbf,
-    0xfd, 0xaa, 0xcf, 0xf8, 0x5f, 0xd0, 0x0, 0x5a,
-    0xef, 0xfd, 0x93, 0x5, 0xfd,
-
-    /* U+04D4 "Ӕ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xc8,
-    0xfe, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x27,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x7,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x7,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x50, 0x7,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfb, 0x0, 0x7,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1, 0x0, 0x7,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x70, 0x0, 0x7,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf3, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x0, 0x7,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfe, 0x10, 0x0, 0x0, 0x7,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xee, 0xee, 0xee, 0xef,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x20, 0x0, 0x0, 0x0, 0x7,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x6f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-
-    /* U+04D5 "ӕ" */
-    0x0, 0x2, 0x7b, 0xef, 0xfe, 0xb6, 0x0, 0x0,
-    0x5, 0xae, 0xff, 0xd9, 0x30, 0x0, 0x0, 0x1,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x2, 0xcf,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x9, 0xff,
-    0x94, 0x10, 0x2, 0x8f, 0xfb, 0x2e, 0xfe, 0x72,
-    0x0, 0x39, 0xff, 0xc0, 0x0, 0x1, 0xa1, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xef, 0xc1, 0x0, 0x0,
-    0x0, 0x3e, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xd0, 0x0, 0x1, 0x69, 0xab, 0xbb, 0xbb, 0xdf,
-    0xfb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xcf, 0xf0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x8,
-    0xff, 0x72, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf6, 0x0, 0x0, 0x0,
-    0x7, 0xfc, 0xcf, 0xc1, 0x0, 0x0, 0x0, 0x2,
-    0xe4, 0x0, 0x9, 0xff, 0x60, 0x0, 0x2, 0x9f,
-    0xe2, 0x1d, 0xfe, 0x61, 0x0, 0x1, 0x7f, 0xfa,
-    0x0, 0x0, 0xaf, 0xff, 0xdc, 0xef, 0xfd, 0x20,
-    0x1, 0xaf, 0xff, 0xdc, 0xdf, 0xff, 0x80, 0x0,
-    0x0, 0x4, 0xae, 0xff, 0xeb, 0x50, 0x0, 0x0,
-    0x3, 0x9d, 0xff, 0xfc, 0x82, 0x0, 0x0,
-
-    /* U+04D6 "Ӗ" */
-    0x0, 0xb, 0xf1, 0x0, 0x0, 0x2, 0xfa, 0x0,
-    0x0, 0x0, 0x7f, 0x70, 0x0, 0x0, 0x8f, 0x60,
-    0x0, 0x0, 0x0, 0xdf, 0x93, 0x13, 0x9f, 0xd0,
-    0x0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xff, 0xa1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x43, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x3f, 0xf3, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x3, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-
-    /* U+04D7 "ӗ" */
-    0x0, 0x0, 0x75, 0x0, 0x0, 0x0, 0x84, 0x0,
-    0x0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x5f, 0x70,
-    0x0, 0x0, 0x0, 0x5f, 0xc4, 0x22, 0x7f, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff, 0xb2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x44, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5b, 0xef,
-    0xfd, 0x93, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x3, 0xef, 0xd6,
-    0x10, 0x2, 0x8f, 0xfc, 0x0, 0x0, 0xef, 0xb0,
-    0x0, 0x0, 0x0, 0x2e, 0xf9, 0x0, 0x8f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2, 0xe, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x83, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc, 0x5f,
-    0xf9, 0x99, 0x99, 0x99, 0x99, 0x99, 0xbf, 0xe6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x5f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xd2, 0x0, 0x0, 0x0,
-    0x3, 0xe4, 0x0, 0x2, 0xef, 0xf9, 0x41, 0x1,
-    0x4a, 0xff, 0xa0, 0x0, 0x1, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x39, 0xdf,
-    0xfe, 0xc8, 0x20, 0x0,
-
-    /* U+04D8 "Ә" */
-    0x0, 0x0, 0x0, 0x5, 0x9c, 0xef, 0xfe, 0xb7,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x0, 0x0,
-    0x0, 0x5, 0xef, 0xfe, 0x95, 0x32, 0x24, 0x8d,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0xc, 0xfd, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf4, 0x7c, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xf6,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x9f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf7,
-    0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf6, 0x4f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3,
-    0xe, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf0, 0x8, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x90,
-    0x1, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0x10, 0x0, 0x6f, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf6, 0x0,
-    0x0, 0x8, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0,
-    0x3c, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xb6, 0x21, 0x13, 0x6c, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x8c, 0xef, 0xfe, 0xb7, 0x20, 0x0, 0x0, 0x0,
-
-    /* U+04D9 "ә" */
-    0x0, 0x0, 0x39, 0xdf, 0xfe, 0xc8, 0x20, 0x0,
-    0x0, 0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0xdf, 0xe7, 0x30, 0x1, 0x5b,
-    0xff, 0xb0, 0x0, 0x0, 0x8c, 0x10, 0x0, 0x0,
-    0x0, 0x5f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf1,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x3f, 0xf9, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0xbf, 0xf1, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf0, 0xc, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xa0, 0x6, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x40, 0x0, 0xcf, 0xc1,
-    0x0, 0x0, 0x0, 0x2e, 0xfa, 0x0, 0x0, 0x2e,
-    0xfe, 0x61, 0x0, 0x28, 0xff, 0xd1, 0x0, 0x0,
-    0x2, 0xcf, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xae, 0xff, 0xd9, 0x30, 0x0,
-    0x0,
-
-    /* U+04DA "Ӛ" */
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x60, 0x1, 0xde,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xb0, 0x4, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6b, 0x30, 0x0, 0x9a,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0x9c, 0xef, 0xfe, 0xb7,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x0, 0x0,
-    0x0, 0x5, 0xef, 0xfe, 0x95, 0x32, 0x24, 0x8d,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0xc, 0xfd, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf4, 0x7c, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xf6,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x9f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf7,
-    0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf6, 0x4f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3,
-    0xe, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf0, 0x8, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x90,
-    0x1, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0x10, 0x0, 0x6f, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf6, 0x0,
-    0x0, 0x8, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0,
-    0x3c, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xb6, 0x21, 0x13, 0x6c, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x8c, 0xef, 0xfe, 0xb7, 0x20, 0x0, 0x0, 0x0,
-
-    /* U+04DB "ӛ" */
-    0x0, 0x0, 0xd, 0xe2, 0x0, 0x3e, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf7, 0x0, 0x8f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xa1, 0x0, 0x2b,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x39,
-    0xdf, 0xfe, 0xc8, 0x20, 0x0, 0x0, 0x0, 0x1b,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0xdf, 0xe7, 0x30, 0x1, 0x5b, 0xff, 0xb0, 0x0,
-    0x0, 0x8c, 0x10, 0x0, 0x0, 0x0, 0x5f, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf1, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x3f, 0xf9,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0xbf, 0xf1, 0xf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf0,
-    0xc, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xa0, 0x6, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x40, 0x0, 0xcf, 0xc1, 0x0, 0x0, 0x0,
-    0x2e, 0xfa, 0x0, 0x0, 0x2e, 0xfe, 0x61, 0x0,
-    0x28, 0xff, 0xd1, 0x0, 0x0, 0x2, 0xcf, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xae, 0xff, 0xd9, 0x30, 0x0, 0x0,
-
-    /* U+04DC "Ӝ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6b, 0x30,
-    0x0, 0x9a, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xb0,
-    0x4, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x60,
-    0x1, 0xde, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xa0,
-    0x0, 0xaf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0x10,
-    0x0, 0x1e, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf5, 0x0,
-    0x0, 0x5, 0xff, 0x30, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xb0, 0x0,
-    0x0, 0x0, 0xaf, 0xd0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x1e, 0xf7, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x2f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x20, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0xcf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x7, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xf6, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x2f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x31, 0x11, 0x1f,
-    0xf6, 0x11, 0x11, 0xcf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xfe, 0x10, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0xaf, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf5, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x1e, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xa0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x4, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfe, 0x10, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf4, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0xe, 0xfd, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x90, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x4, 0xff, 0x80, 0x0,
-    0x0, 0xd, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf3, 0x0,
-    0x0, 0x8f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfd, 0x0,
-    0x3, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x90,
-    0xd, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf3,
-
-    /* U+04DD "ӝ" */
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf6, 0x0, 0x1d,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfb, 0x0, 0x4f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xb3,
-    0x0, 0x9, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x6f, 0xf2, 0x1, 0xef,
-    0x60, 0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0,
-    0x1, 0xef, 0x70, 0x0, 0x6f, 0xf1, 0x0, 0x0,
-    0x0, 0xff, 0x50, 0x0, 0x0, 0xa, 0xfc, 0x0,
-    0x0, 0xb, 0xfa, 0x0, 0x0, 0x0, 0xff, 0x50,
-    0x0, 0x0, 0x4f, 0xf3, 0x0, 0x0, 0x2, 0xff,
-    0x40, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0xdf,
-    0x80, 0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0,
-    0xff, 0x50, 0x0, 0x8, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf8, 0x0, 0x0, 0xff, 0x50, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x20, 0x0, 0xff, 0x50, 0x0, 0xbf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfe, 0x10,
-    0x0, 0xff, 0x50, 0x0, 0x9f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf4, 0x0, 0x0, 0xff, 0x50,
-    0x0, 0xd, 0xfd, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x80, 0x0, 0x0, 0xff, 0x50, 0x0, 0x2, 0xff,
-    0x90, 0x0, 0x0, 0xd, 0xfc, 0x0, 0x0, 0x0,
-    0xff, 0x50, 0x0, 0x0, 0x6f, 0xf5, 0x0, 0x0,
-    0x9f, 0xf2, 0x0, 0x0, 0x0, 0xff, 0x50, 0x0,
-    0x0, 0xa, 0xfe, 0x20, 0x5, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0x0, 0xdf,
-    0xc0, 0x2f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x3f, 0xf8,
-
-    /* U+04DE "Ӟ" */
-    0x0, 0x0, 0xb, 0xf4, 0x0, 0x2e, 0xd1, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf9, 0x0, 0x6f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xb2, 0x0, 0xa,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7a,
-    0xce, 0xed, 0xa6, 0x10, 0x0, 0x0, 0x4, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xf,
-    0xff, 0xc8, 0x53, 0x34, 0x7d, 0xff, 0xb0, 0x0,
-    0x9, 0x81, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x15, 0xdf, 0xd1, 0x0, 0x0,
-    0x0, 0xbe, 0xee, 0xef, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xfb, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x14, 0xaf,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2, 0x13,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xd0,
-    0x9f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff,
-    0x50, 0x5f, 0xfe, 0x94, 0x10, 0x1, 0x49, 0xff,
-    0xf7, 0x0, 0x1, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x40, 0x0, 0x0, 0x1, 0x6a, 0xdf, 0xff,
-    0xd9, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+04DF "ӟ" */
-    0x0, 0x0, 0xaf, 0x60, 0x1, 0xde, 0x20, 0x0,
-    0x0, 0x0, 0xff, 0xa0, 0x4, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x37, 0x10, 0x0, 0x56, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x8c, 0xff, 0xfd, 0xa4, 0x0, 0x0,
-    0x2, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0,
-    0x0, 0xfc, 0x73, 0x10, 0x13, 0x8f, 0xfe, 0x10,
-    0x0, 0x20, 0x0, 0x0, 0x0, 0x2, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0x20,
-    0x0, 0x0, 0x6, 0xaa, 0xac, 0xff, 0xe4, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xfe, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x4b, 0xfb, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf2,
-    0x5, 0x40, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xe0,
-    0xd, 0xfc, 0x62, 0x0, 0x2, 0x6e, 0xff, 0x50,
-    0x4, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0,
-    0x0, 0x4, 0x9c, 0xef, 0xfd, 0xa6, 0x0, 0x0,
-
-    /* U+04E0 "Ӡ" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xfd, 0xb6, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x8e, 0xef, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x5c, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xd2, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xf8, 0xaf, 0x81, 0x0, 0x0, 0x0, 0x0, 0x1b,
-    0xff, 0x29, 0xff, 0xfa, 0x53, 0x10, 0x13, 0x8e,
-    0xff, 0x60, 0x4, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x50, 0x0, 0x0, 0x38, 0xbe, 0xff, 0xfd,
-    0xa6, 0x0, 0x0,
-
-    /* U+04E1 "ӡ" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xda, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xee, 0xff, 0xff, 0xc2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x38, 0xff, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf3, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xfe, 0x6, 0xfa, 0x20, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x80, 0x4f, 0xff, 0xb6, 0x42, 0x23, 0x6c,
-    0xff, 0xc0, 0x0, 0x2a, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x2, 0x7b, 0xef, 0xfe,
-    0xc9, 0x30, 0x0, 0x0,
-
-    /* U+04E2 "Ӣ" */
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0x88, 0x88, 0x88,
-    0x88, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xf9, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf9, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf9,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xf9, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xbc, 0xf9, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xfd, 0xc, 0xf9, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf2, 0xc, 0xf9,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x7, 0xff, 0x50,
-    0xc, 0xf9, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x4f,
-    0xf8, 0x0, 0xc, 0xf9, 0x3f, 0xf1, 0x0, 0x0,
-    0x1, 0xef, 0xb0, 0x0, 0xc, 0xf9, 0x3f, 0xf1,
-    0x0, 0x0, 0xc, 0xfe, 0x10, 0x0, 0xc, 0xf9,
-    0x3f, 0xf1, 0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0,
-    0xc, 0xf9, 0x3f, 0xf1, 0x0, 0x6, 0xff, 0x60,
-    0x0, 0x0, 0xc, 0xf9, 0x3f, 0xf1, 0x0, 0x3f,
-    0xf9, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x3f, 0xf1,
-    0x1, 0xef, 0xc0, 0x0, 0x0, 0x0, 0xc, 0xf9,
-    0x3f, 0xf1, 0xb, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0xc, 0xf9, 0x3f, 0xf1, 0x8f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf9, 0x3f, 0xf6, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x3f, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9,
-    0x3f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf9, 0x3f, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf9, 0x3f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf9,
-
-    /* U+04E3 "ӣ" */
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x8, 0x88, 0x88, 0x88, 0x88, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0x1, 0xef, 0xa8, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0xc, 0xfc, 0x8, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0xaf, 0xe1, 0x8, 0xfc,
-    0xcf, 0x80, 0x0, 0x8, 0xff, 0x30, 0x8, 0xfc,
-    0xcf, 0x80, 0x0, 0x5f, 0xf5, 0x0, 0x8, 0xfc,
-    0xcf, 0x80, 0x3, 0xff, 0x70, 0x0, 0x8, 0xfc,
-    0xcf, 0x80, 0x1e, 0xfa, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0x80, 0xcf, 0xc0, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0x8a, 0xfe, 0x10, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0xef, 0xf3, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc,
-
-    /* U+04E4 "Ӥ" */
-    0x0, 0x0, 0x0, 0x7b, 0x20, 0x0, 0xa9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x90, 0x5,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x40, 0x2, 0xed, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xf9, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf9,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xf9, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf9, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xbc, 0xf9, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xfd, 0xc, 0xf9,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf2,
-    0xc, 0xf9, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x50, 0xc, 0xf9, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x4f, 0xf8, 0x0, 0xc, 0xf9, 0x3f, 0xf1,
-    0x0, 0x0, 0x1, 0xef, 0xb0, 0x0, 0xc, 0xf9,
-    0x3f, 0xf1, 0x0, 0x0, 0xc, 0xfe, 0x10, 0x0,
-    0xc, 0xf9, 0x3f, 0xf1, 0x0, 0x0, 0x9f, 0xf3,
-    0x0, 0x0, 0xc, 0xf9, 0x3f, 0xf1, 0x0, 0x6,
-    0xff, 0x60, 0x0, 0x0, 0xc, 0xf9, 0x3f, 0xf1,
-    0x0, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0xc, 0xf9,
-    0x3f, 0xf1, 0x1, 0xef, 0xc0, 0x0, 0x0, 0x0,
-    0xc, 0xf9, 0x3f, 0xf1, 0xb, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0xc, 0xf9, 0x3f, 0xf1, 0x8f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x3f, 0xf6,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9,
-    0x3f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf9, 0x3f, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf9, 0x3f, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x3f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9,
-
-    /* U+04E5 "ӥ" */
-    0x0, 0x1, 0xde, 0x20, 0x4, 0xfb, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x50, 0x9, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x9a, 0x0, 0x2, 0xb7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0x1, 0xef, 0xa8, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0xc, 0xfc, 0x8, 0xfc,
-    0xcf, 0x80, 0x0, 0x0, 0xaf, 0xe1, 0x8, 0xfc,
-    0xcf, 0x80, 0x0, 0x8, 0xff, 0x30, 0x8, 0xfc,
-    0xcf, 0x80, 0x0, 0x5f, 0xf5, 0x0, 0x8, 0xfc,
-    0xcf, 0x80, 0x3, 0xff, 0x70, 0x0, 0x8, 0xfc,
-    0xcf, 0x80, 0x1e, 0xfa, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0x80, 0xcf, 0xc0, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0x8a, 0xfe, 0x10, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0xef, 0xf3, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0xcf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc,
-
-    /* U+04E6 "Ӧ" */
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xb0, 0x0, 0x8f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x10, 0xe, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0x70, 0x0,
-    0x5b, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6a,
-    0xdf, 0xff, 0xdb, 0x61, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff,
-    0xe9, 0x53, 0x22, 0x48, 0xdf, 0xfe, 0x40, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x5e, 0xff, 0x50, 0x0, 0x0, 0x1e, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff,
-    0x30, 0x0, 0xb, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1d, 0xfd, 0x0, 0x3, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf6, 0x0, 0x9f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0, 0xe,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0x11, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf3,
-    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x52, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x1f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x30, 0xef, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf1, 0x9, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfc, 0x0, 0x3f,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x60, 0x0, 0xbf, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xd0, 0x0,
-    0x1, 0xef, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xcf, 0xf3, 0x0, 0x0, 0x3, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xf5, 0x0,
-    0x0, 0x0, 0x3, 0xdf, 0xfe, 0x95, 0x21, 0x24,
-    0x8d, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xad, 0xff,
-    0xfd, 0xb6, 0x10, 0x0, 0x0, 0x0,
-
-    /* U+04E7 "ӧ" */
-    0x0, 0x0, 0xb, 0xf5, 0x0, 0x1d, 0xd1, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xfa, 0x0, 0x5f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xb2, 0x0, 0x9,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xad, 0xff, 0xeb, 0x60, 0x0, 0x0, 0x0, 0x1,
-    0xbf, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x0,
-    0x2e, 0xff, 0x83, 0x0, 0x16, 0xdf, 0xf6, 0x0,
-    0x0, 0xdf, 0xe2, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0x30, 0x8, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xd0, 0xe, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf4, 0x3f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf8, 0x5f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xfa, 0x6f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xfb, 0x5f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfa, 0x3f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8,
-    0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf3, 0x7, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xd0, 0x0, 0xdf, 0xe2, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0x30, 0x0, 0x2e, 0xff, 0x93, 0x0,
-    0x26, 0xef, 0xf6, 0x0, 0x0, 0x1, 0xbf, 0xff,
-    0xff, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x4,
-    0xad, 0xff, 0xeb, 0x60, 0x0, 0x0,
-
-    /* U+04E8 "Ө" */
-    0x0, 0x0, 0x0, 0x0, 0x5a, 0xdf, 0xff, 0xdb,
-    0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x2d, 0xff, 0xe9, 0x53, 0x22,
-    0x48, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff,
-    0x60, 0x0, 0x0, 0x1e, 0xfd, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1c, 0xff, 0x40, 0x0, 0xb,
-    0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xfd, 0x0, 0x3, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf6, 0x0,
-    0x9f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xd0, 0xe, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x11, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf4, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x52, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xef, 0xf5, 0x1f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x40, 0xef, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1, 0x9,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xfd, 0x0, 0x3f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x60,
-    0x0, 0xbf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xd0, 0x0, 0x1, 0xef, 0xe2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xf4,
-    0x0, 0x0, 0x3, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xef, 0xf6, 0x0, 0x0, 0x0, 0x2,
-    0xdf, 0xfe, 0x95, 0x21, 0x24, 0x8d, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xad, 0xff, 0xfd, 0xb6, 0x10,
-    0x0, 0x0, 0x0,
-
-    /* U+04E9 "ө" */
-    0x0, 0x0, 0x3, 0x9d, 0xff, 0xec, 0x71, 0x0,
-    0x0, 0x0, 0x0, 0x1b, 0xff, 0xfe, 0xde, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x2e, 0xfd, 0x61, 0x0,
-    0x2, 0x8f, 0xfa, 0x0, 0x0, 0xd, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x2e, 0xf8, 0x0, 0x7, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2, 0x0,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x90, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfe, 0x5, 0xff, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xbf, 0xf0, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x3f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfd,
-    0x0, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x7, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf2, 0x0, 0xd, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0x5f, 0xf8, 0x0, 0x0, 0x1e, 0xfe,
-    0x71, 0x0, 0x3, 0xaf, 0xfa, 0x0, 0x0, 0x0,
-    0x1a, 0xff, 0xfe, 0xef, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x9d, 0xff, 0xec, 0x71, 0x0,
-    0x0, 0x0,
-
-    /* U+04EA "Ӫ" */
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xb0, 0x0, 0x8f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x10, 0xe, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0x70, 0x0,
-    0x5b, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5a,
-    0xdf, 0xff, 0xdb, 0x61, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
-    0xe9, 0x53, 0x22, 0x48, 0xdf, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x5e, 0xff, 0x60, 0x0, 0x0, 0x1e, 0xfd,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff,
-    0x40, 0x0, 0xb, 0xfe, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfd, 0x0, 0x3, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf6, 0x0, 0x9f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xd0, 0xe,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x11, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x52, 0xff, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef,
-    0xf5, 0x1f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x40, 0xef, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf1, 0x9, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfd, 0x0, 0x3f,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x60, 0x0, 0xbf, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xd0, 0x0,
-    0x1, 0xef, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xcf, 0xf4, 0x0, 0x0, 0x3, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xf6, 0x0,
-    0x0, 0x0, 0x2, 0xdf, 0xfe, 0x95, 0x21, 0x24,
-    0x8d, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xad, 0xff,
-    0xfd, 0xb6, 0x10, 0x0, 0x0, 0x0,
-
-    /* U+04EB "ӫ" */
-    0x0, 0x0, 0x8, 0xf7, 0x0, 0xc, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xd0, 0x2, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x5, 0xb4, 0x0,
-    0x8, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x39, 0xdf, 0xfe, 0xc7, 0x10, 0x0,
-    0x0, 0x0, 0x1, 0xbf, 0xff, 0xed, 0xef, 0xff,
-    0x70, 0x0, 0x0, 0x2, 0xef, 0xd6, 0x10, 0x0,
-    0x28, 0xff, 0xa0, 0x0, 0x0, 0xdf, 0xb0, 0x0,
-    0x0, 0x0, 0x2, 0xef, 0x80, 0x0, 0x7f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x20, 0xe,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf9,
-    0x3, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xe0, 0x5f, 0xfa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xab, 0xff, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x5f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x3, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xd0,
-    0xe, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf9, 0x0, 0x7f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0x20, 0x0, 0xdf, 0xd1, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x80, 0x0, 0x1, 0xef, 0xe7,
-    0x10, 0x0, 0x3a, 0xff, 0xa0, 0x0, 0x0, 0x1,
-    0xaf, 0xff, 0xee, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x39, 0xdf, 0xfe, 0xc7, 0x10, 0x0,
-    0x0,
-
-    /* U+04EC "Ӭ" */
-    0x0, 0x0, 0xb, 0xf5, 0x0, 0x1d, 0xd1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xfa, 0x0, 0x5f,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xb2,
-    0x0, 0x9, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x6a, 0xdf,
-    0xff, 0xda, 0x50, 0x0, 0x0, 0x0, 0x1, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x60, 0x0, 0x0,
-    0x3e, 0xff, 0xc7, 0x42, 0x23, 0x5a, 0xff, 0xfb,
-    0x10, 0x0, 0x7f, 0xc2, 0x0, 0x0, 0x0, 0x0,
-    0x1a, 0xff, 0xc0, 0x0, 0x3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf7, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x50, 0xa, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfa, 0x0,
-    0x9f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff,
-    0xc0, 0x0, 0x2d, 0xff, 0xd8, 0x42, 0x12, 0x59,
-    0xff, 0xfb, 0x10, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x1,
-    0x6a, 0xdf, 0xff, 0xda, 0x50, 0x0, 0x0, 0x0,
-
-    /* U+04ED "ӭ" */
-    0x0, 0x0, 0x9f, 0x70, 0x0, 0xce, 0x30, 0x0,
-    0x0, 0x0, 0xe, 0xfc, 0x0, 0x3f, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x5b, 0x40, 0x0, 0x8a, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xda,
-    0x50, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xfd, 0xef,
-    0xff, 0xd3, 0x0, 0x0, 0xcf, 0xe7, 0x20, 0x0,
-    0x16, 0xdf, 0xf4, 0x0, 0x2, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf8, 0x0, 0x0,
-    0x5, 0xbb, 0xbb, 0xbb, 0xbb, 0xef, 0xa0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xc0, 0x3, 0xb1, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xf2, 0x0, 0xcf, 0xf8, 0x20, 0x0, 0x16, 0xef,
-    0xf4, 0x0, 0x1, 0xaf, 0xff, 0xfe, 0xff, 0xff,
-    0xd3, 0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xda,
-    0x50, 0x0, 0x0,
-
-    /* U+04EE "Ӯ" */
-    0x0, 0x0, 0x2, 0x88, 0x88, 0x88, 0x88, 0x84,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf2, 0x8, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80,
-    0x1, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfe, 0x0, 0x0, 0x7f, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf6, 0x0, 0x0, 0xe,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xd0,
-    0x0, 0x0, 0x6, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0xef, 0x80,
-    0x0, 0x0, 0x0, 0x8, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf1, 0x0, 0x0, 0x0, 0x1f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x0, 0x0,
-    0x0, 0x9f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x10, 0x0, 0x2, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x90, 0x0, 0xb, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf1,
-    0x0, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf9, 0x0, 0xcf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x25, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xad, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x20, 0x29, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1a, 0xef, 0xfb, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+04EF "ӯ" */
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x3, 0x88, 0x88, 0x88, 0x88,
-    0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf4, 0x1, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfd, 0x0, 0xa, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x60, 0x0, 0x3f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xe0, 0x0, 0x0, 0xbf,
-    0x90, 0x0, 0x0, 0x0, 0xb, 0xf8, 0x0, 0x0,
-    0x4, 0xff, 0x10, 0x0, 0x0, 0x2, 0xff, 0x10,
-    0x0, 0x0, 0xd, 0xf8, 0x0, 0x0, 0x0, 0x9f,
-    0x90, 0x0, 0x0, 0x0, 0x6f, 0xe0, 0x0, 0x0,
-    0x1f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xef, 0x60,
-    0x0, 0x8, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfd, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf4, 0x0, 0x6f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0xd, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x24, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x1, 0xe8, 0x10,
-    0x1a, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4a, 0xef, 0xea, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+04F0 "Ӱ" */
-    0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x7f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf2,
-    0x0, 0xdf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2b, 0x80, 0x0, 0x4b, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf2, 0x8, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80,
-    0x1, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfe, 0x0, 0x0, 0x7f, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf6, 0x0, 0x0, 0xe,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xd0,
-    0x0, 0x0, 0x6, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0xef, 0x80,
-    0x0, 0x0, 0x0, 0x8, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf1, 0x0, 0x0, 0x0, 0x1f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x0, 0x0,
-    0x0, 0x9f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x10, 0x0, 0x2, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x90, 0x0, 0xb, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf1,
-    0x0, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf9, 0x0, 0xcf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x25, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xad, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x20, 0x29, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1a, 0xef, 0xfb, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+04F1 "ӱ" */
-    0x0, 0x0, 0x6, 0xf9, 0x0, 0xb, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xe0, 0x0, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xb5, 0x0,
-    0x7, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf4, 0x1, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfd, 0x0, 0xa, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x60, 0x0, 0x3f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xe0, 0x0, 0x0, 0xbf,
-    0x90, 0x0, 0x0, 0x0, 0xb, 0xf8, 0x0, 0x0,
-    0x4, 0xff, 0x10, 0x0, 0x0, 0x2, 0xff, 0x10,
-    0x0, 0x0, 0xd, 0xf8, 0x0, 0x0, 0x0, 0x9f,
-    0x90, 0x0, 0x0, 0x0, 0x6f, 0xe0, 0x0, 0x0,
-    0x1f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xef, 0x60,
-    0x0, 0x8, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfd, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf4, 0x0, 0x6f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0xd, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x24, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x1, 0xe8, 0x10,
-    0x1a, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4a, 0xef, 0xea, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+04F2 "Ӳ" */
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30, 0x1e,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xf5, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x60, 0x9, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf8, 0x0, 0x5f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf2,
-    0x8, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x80, 0x1, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfe, 0x0, 0x0, 0x7f,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf6,
-    0x0, 0x0, 0xe, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xd0, 0x0, 0x0, 0x6, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0xef, 0x80, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1, 0x0, 0x0,
-    0x0, 0x1f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf8, 0x0, 0x0, 0x0, 0x9f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x10, 0x0, 0x2, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90,
-    0x0, 0xb, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf1, 0x0, 0x4f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf9, 0x0, 0xcf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x25, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xad, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x20, 0x29, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xef, 0xfb,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+04F3 "ӳ" */
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xe1, 0x4, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0x1,
-    0xef, 0x50, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf3,
-    0x0, 0xcf, 0x60, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf5, 0x0, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf4, 0x1, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfd, 0x0, 0xa, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x60, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0,
-    0x0, 0x0, 0xbf, 0x90, 0x0, 0x0, 0x0, 0xb,
-    0xf8, 0x0, 0x0, 0x4, 0xff, 0x10, 0x0, 0x0,
-    0x2, 0xff, 0x10, 0x0, 0x0, 0xd, 0xf8, 0x0,
-    0x0, 0x0, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x6f,
-    0xe0, 0x0, 0x0, 0x1f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x60, 0x0, 0x8, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfd, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf4, 0x0, 0x6f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xb0,
-    0xd, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x24, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf9, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xe8, 0x10, 0x1a, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4a, 0xef, 0xea, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+04F4 "Ӵ" */
-    0x0, 0x0, 0x1, 0xa9, 0x0, 0x3, 0xb6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf4, 0x0, 0xbf,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xed, 0x10,
-    0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x91, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf9, 0x1f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x91, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9, 0x1f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x91, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf9, 0x1f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x91, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf9, 0xf, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x90, 0xcf,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9,
-    0x5, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xdf, 0x90, 0xa, 0xff, 0xe7, 0x20, 0x0, 0x25,
-    0x9d, 0xff, 0xf9, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xef, 0x90, 0x0, 0x2, 0x8d,
-    0xff, 0xff, 0xeb, 0x72, 0xb, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0xbf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf9,
-
-    /* U+04F5 "ӵ" */
-    0x0, 0x4, 0xec, 0x0, 0x8, 0xf7, 0x0, 0x0,
-    0x0, 0x8f, 0xf2, 0x0, 0xdf, 0xd0, 0x0, 0x0,
-    0x2, 0xb8, 0x0, 0x4, 0xb4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x8f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf8, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x8f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf8, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x7f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf6, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x3f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf0, 0xcf, 0xf8, 0x10, 0x0, 0x14, 0x9f,
-    0xff, 0x1, 0xdf, 0xff, 0xed, 0xef, 0xff, 0xef,
-    0xf0, 0x0, 0x6b, 0xef, 0xfe, 0xb7, 0x25, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff,
-
-    /* U+04F6 "Ӷ" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x3f, 0xf2, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+04F7 "ӷ" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2c, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0xcf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0x81, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+04F8 "Ӹ" */
-    0x0, 0x0, 0x0, 0x0, 0x1a, 0x80, 0x0, 0x4b,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x20, 0xc, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xc0, 0x0,
-    0x7f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x83,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf8, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x83, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf8, 0x3f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x83, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x83, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x40, 0x0,
-    0x0, 0x0, 0xdf, 0x83, 0xff, 0xee, 0xee, 0xee,
-    0xef, 0xff, 0xff, 0xc1, 0x0, 0x0, 0xd, 0xf8,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x1, 0x4a, 0xff,
-    0xe1, 0x0, 0x0, 0xdf, 0x83, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x90, 0x0, 0xd,
-    0xf8, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x0, 0x0, 0xdf, 0x83, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0x0,
-    0xd, 0xf8, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x40, 0x0, 0xdf, 0x83, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf4,
-    0x0, 0xd, 0xf8, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x20, 0x0, 0xdf, 0x83,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xe0, 0x0, 0xd, 0xf8, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf7, 0x0, 0x0, 0xdf,
-    0x83, 0xff, 0x10, 0x0, 0x0, 0x0, 0x4, 0xbf,
-    0xfb, 0x0, 0x0, 0xd, 0xf8, 0x3f, 0xfe, 0xee,
-    0xee, 0xee, 0xef, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0xdf, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb,
-    0x72, 0x0, 0x0, 0x0, 0xd, 0xf8,
-
-    /* U+04F9 "ӹ" */
-    0x0, 0x0, 0x0, 0xce, 0x30, 0x2, 0xed, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8, 0x0, 0x6f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8b, 0x20,
-    0x1, 0xa9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfe, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xec, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfe, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xec, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfe, 0xcf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xec, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x10, 0x0,
-    0x6, 0xfe, 0xcf, 0xdb, 0xbb, 0xbb, 0xdf, 0xff,
-    0x40, 0x0, 0x6f, 0xec, 0xf8, 0x0, 0x0, 0x0,
-    0x2c, 0xff, 0x10, 0x6, 0xfe, 0xcf, 0x80, 0x0,
-    0x0, 0x0, 0xe, 0xf8, 0x0, 0x6f, 0xec, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xb0, 0x6, 0xfe,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x8, 0xfc, 0x0,
-    0x6f, 0xec, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xb0, 0x6, 0xfe, 0xcf, 0x80, 0x0, 0x0, 0x0,
-    0x1f, 0xf7, 0x0, 0x6f, 0xec, 0xf8, 0x0, 0x0,
-    0x0, 0x3d, 0xfe, 0x0, 0x6, 0xfe, 0xcf, 0xdb,
-    0xbb, 0xbb, 0xef, 0xfd, 0x20, 0x0, 0x6f, 0xec,
-    0xff, 0xff, 0xff, 0xfe, 0xb6, 0x0, 0x0, 0x6,
-    0xfe,
-
-    /* U+04FA "Ӻ" */
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x7, 0xfe, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x0, 0x7, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbc, 0xce, 0xff, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xc6, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x7, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0x40, 0x4, 0xef, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xbe, 0xfe, 0xa2, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+04FB "ӻ" */
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x2, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x7a, 0xbf, 0xfb, 0xaa,
-    0xaa, 0xaa, 0x20, 0x0, 0x2, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xfb, 0x0, 0x0, 0x0, 0x7, 0x10,
-    0x7, 0xff, 0x60, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x18, 0xdf, 0xfd,
-    0x70, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+04FC "Ӽ" */
-    0x7, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf4, 0x0, 0xbf, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0x80, 0x0, 0x1e, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xfc, 0x0, 0x0, 0x4,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x8f, 0xf2, 0x0,
-    0x0, 0x0, 0x8f, 0xf3, 0x0, 0x0, 0x3, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0xc, 0xfe, 0x10, 0x0,
-    0x1e, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xb0, 0x0, 0xbf, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf6, 0x6, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0x6f, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xaf, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xf9, 0x9,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xd0, 0x0, 0xcf, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x20, 0x0, 0x1e, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf6, 0x0, 0x0, 0x3, 0xff,
-    0x90, 0x0, 0x0, 0x1, 0xef, 0xa0, 0x0, 0x0,
-    0x0, 0x6f, 0xf5, 0x0, 0x0, 0xc, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0xa, 0xfe, 0x10, 0x0, 0x8f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x90,
-    0x4, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf2, 0x1e, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x50, 0x1, 0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x8d, 0xff, 0xc6, 0x0,
-
-    /* U+04FD "ӽ" */
-    0xb, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf9,
-    0x0, 0x1e, 0xf9, 0x0, 0x0, 0x0, 0xb, 0xfc,
-    0x0, 0x0, 0x3f, 0xf5, 0x0, 0x0, 0x7, 0xfe,
-    0x20, 0x0, 0x0, 0x7f, 0xf2, 0x0, 0x4, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0xbf, 0xd0, 0x1, 0xef,
-    0x80, 0x0, 0x0, 0x0, 0x1, 0xef, 0x90, 0xcf,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xbf,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xfe, 0x3e, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x40, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x80, 0x0, 0x4f, 0xf5, 0x0, 0x0, 0x0,
-    0xcf, 0xc0, 0x0, 0x0, 0x7f, 0xf2, 0x0, 0x0,
-    0x9f, 0xe1, 0x0, 0x0, 0x0, 0xbf, 0xc0, 0x0,
-    0x5f, 0xf4, 0x0, 0x0, 0x0, 0x1, 0xef, 0x60,
-    0x2f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x44, 0x0,
-    0x3d, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x4a,
-    0xef, 0xea, 0x20, 0x0,
-
-    /* U+04FE "Ӿ" */
-    0x1e, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x60, 0x4, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xfa, 0x0, 0x0, 0x7f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xd0, 0x0, 0x0, 0xb,
-    0xfe, 0x20, 0x0, 0x0, 0xa, 0xff, 0x20, 0x0,
-    0x0, 0x1, 0xef, 0xc0, 0x0, 0x0, 0x7f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf9, 0x0, 0x4,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0x60, 0x1e, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf3, 0xcf, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xac, 0xcc, 0xce, 0xff, 0xff,
-    0xcc, 0xcc, 0xc0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf6, 0xef, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xa0, 0x4f,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfe,
-    0x10, 0x9, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf4, 0x0, 0x0, 0xdf, 0xe1, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x90, 0x0, 0x0, 0x3f, 0xfa,
-    0x0, 0x0, 0x0, 0xd, 0xfd, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x50, 0x0, 0x0, 0x8f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xe1, 0x0, 0x4, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfb, 0x0,
-    0xe, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x60, 0xaf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xf2,
-
-    /* U+04FF "ӿ" */
-    0x5, 0xff, 0x40, 0x0, 0x0, 0x0, 0x6, 0xfe,
-    0x20, 0x8, 0xfe, 0x20, 0x0, 0x0, 0x3, 0xff,
-    0x40, 0x0, 0xc, 0xfc, 0x0, 0x0, 0x1, 0xef,
-    0x70, 0x0, 0x0, 0x1e, 0xf9, 0x0, 0x0, 0xcf,
-    0xb0, 0x0, 0x0, 0x0, 0x4f, 0xf6, 0x0, 0x8f,
-    0xd1, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf3, 0x5f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xef,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0xaa, 0xab, 0xff,
-    0xff, 0xaa, 0xa8, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x48, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0x80, 0xc, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xc0, 0x0, 0x2f, 0xf8, 0x0, 0x0, 0x0,
-    0x7f, 0xf2, 0x0, 0x0, 0x6f, 0xf4, 0x0, 0x0,
-    0x3f, 0xf5, 0x0, 0x0, 0x0, 0xaf, 0xe1, 0x0,
-    0x1e, 0xf9, 0x0, 0x0, 0x0, 0x1, 0xef, 0xb0,
-    0xb, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x70,
-
     /* U+2022 "•" */
     0x7, 0xdb, 0x20, 0x6f, 0xff, 0xd0, 0xaf, 0xff,
     0xf1, 0x7f, 0xff, 0xe0, 0xa, 0xfd, 0x30
@@ -13386,228 +6470,7 @@ static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 44731, .adv_w = 333, .box_w = 19, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
     {.bitmap_index = 45007, .adv_w = 262, .box_w = 15, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
     {.bitmap_index = 45187, .adv_w = 151, .box_w = 13, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 45343, .adv_w = 337, .box_w = 17, .box_h = 29, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 45590, .adv_w = 337, .box_w = 17, .box_h = 28, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 45828, .adv_w = 422, .box_w = 26, .box_h = 23, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 46127, .adv_w = 293, .box_w = 16, .box_h = 29, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 46359, .adv_w = 362, .box_w = 21, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 46590, .adv_w = 321, .box_w = 18, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 46788, .adv_w = 158, .box_w = 4, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 46832, .adv_w = 155, .box_w = 10, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 46972, .adv_w = 270, .box_w = 14, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 47126, .adv_w = 607, .box_w = 37, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 47533, .adv_w = 606, .box_w = 34, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 47907, .adv_w = 428, .box_w = 26, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 48193, .adv_w = 359, .box_w = 19, .box_h = 29, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 48469, .adv_w = 422, .box_w = 20, .box_h = 29, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 48759, .adv_w = 348, .box_w = 22, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 49078, .adv_w = 413, .box_w = 19, .box_h = 28, .ofs_x = 3, .ofs_y = -6},
-    {.bitmap_index = 49344, .adv_w = 381, .box_w = 24, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 49608, .adv_w = 372, .box_w = 19, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 49817, .adv_w = 383, .box_w = 19, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 50026, .adv_w = 293, .box_w = 16, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 50202, .adv_w = 407, .box_w = 25, .box_h = 28, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 50552, .adv_w = 337, .box_w = 17, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 50739, .adv_w = 518, .box_w = 32, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 51091, .adv_w = 326, .box_w = 18, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 51316, .adv_w = 422, .box_w = 20, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 51536, .adv_w = 422, .box_w = 20, .box_h = 28, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 51816, .adv_w = 359, .box_w = 19, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 52025, .adv_w = 402, .box_w = 22, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 52267, .adv_w = 493, .box_w = 25, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 52542, .adv_w = 420, .box_w = 20, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 52762, .adv_w = 436, .box_w = 25, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 53037, .adv_w = 422, .box_w = 20, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 53257, .adv_w = 363, .box_w = 19, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 53466, .adv_w = 367, .box_w = 21, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 53697, .adv_w = 301, .box_w = 19, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 53906, .adv_w = 348, .box_w = 22, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 54148, .adv_w = 470, .box_w = 27, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 54486, .adv_w = 333, .box_w = 21, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 54717, .adv_w = 423, .box_w = 23, .box_h = 28, .ofs_x = 3, .ofs_y = -6},
-    {.bitmap_index = 55039, .adv_w = 374, .box_w = 19, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 55248, .adv_w = 560, .box_w = 29, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 55567, .adv_w = 572, .box_w = 32, .box_h = 27, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 55999, .adv_w = 420, .box_w = 25, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 56274, .adv_w = 501, .box_w = 25, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 56549, .adv_w = 364, .box_w = 19, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 56758, .adv_w = 361, .box_w = 20, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 56978, .adv_w = 559, .box_w = 31, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 57319, .adv_w = 375, .box_w = 18, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 57517, .adv_w = 298, .box_w = 15, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 57645, .adv_w = 337, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 57870, .adv_w = 311, .box_w = 15, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 57998, .adv_w = 243, .box_w = 13, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 58109, .adv_w = 333, .box_w = 20, .box_h = 21, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 58319, .adv_w = 316, .box_w = 17, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 58464, .adv_w = 423, .box_w = 26, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 58685, .adv_w = 273, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 58821, .adv_w = 352, .box_w = 16, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 58957, .adv_w = 352, .box_w = 16, .box_h = 24, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 59149, .adv_w = 297, .box_w = 16, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 59285, .adv_w = 324, .box_w = 17, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 59430, .adv_w = 404, .box_w = 20, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 59600, .adv_w = 346, .box_w = 16, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 59736, .adv_w = 326, .box_w = 18, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 59889, .adv_w = 345, .box_w = 16, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 60025, .adv_w = 351, .box_w = 18, .box_h = 23, .ofs_x = 3, .ofs_y = -6},
-    {.bitmap_index = 60232, .adv_w = 288, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 60368, .adv_w = 242, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 60504, .adv_w = 286, .box_w = 19, .box_h = 23, .ofs_x = -1, .ofs_y = -6},
-    {.bitmap_index = 60723, .adv_w = 402, .box_w = 23, .box_h = 30, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 61068, .adv_w = 269, .box_w = 17, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 61213, .adv_w = 350, .box_w = 18, .box_h = 21, .ofs_x = 3, .ofs_y = -4},
-    {.bitmap_index = 61402, .adv_w = 307, .box_w = 15, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 61530, .adv_w = 475, .box_w = 24, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 61734, .adv_w = 475, .box_w = 27, .box_h = 21, .ofs_x = 3, .ofs_y = -4},
-    {.bitmap_index = 62018, .adv_w = 318, .box_w = 19, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 62180, .adv_w = 402, .box_w = 19, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 62342, .adv_w = 288, .box_w = 14, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 62461, .adv_w = 292, .box_w = 17, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 62606, .adv_w = 443, .box_w = 24, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 62810, .adv_w = 310, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 62946, .adv_w = 320, .box_w = 17, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 63150, .adv_w = 316, .box_w = 17, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 63337, .adv_w = 343, .box_w = 20, .box_h = 30, .ofs_x = -1, .ofs_y = -6},
-    {.bitmap_index = 63637, .adv_w = 243, .box_w = 13, .box_h = 24, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 63793, .adv_w = 293, .box_w = 17, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 63938, .adv_w = 270, .box_w = 15, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 64066, .adv_w = 140, .box_w = 5, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 64126, .adv_w = 138, .box_w = 8, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 64214, .adv_w = 140, .box_w = 10, .box_h = 31, .ofs_x = -3, .ofs_y = -6},
-    {.bitmap_index = 64369, .adv_w = 472, .box_w = 29, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 64616, .adv_w = 483, .box_w = 27, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 64846, .adv_w = 343, .box_w = 21, .box_h = 24, .ofs_x = -2, .ofs_y = 0},
-    {.bitmap_index = 65098, .adv_w = 297, .box_w = 16, .box_h = 24, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 65290, .adv_w = 352, .box_w = 16, .box_h = 24, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 65482, .adv_w = 286, .box_w = 19, .box_h = 30, .ofs_x = -1, .ofs_y = -6},
-    {.bitmap_index = 65767, .adv_w = 327, .box_w = 15, .box_h = 21, .ofs_x = 3, .ofs_y = -4},
-    {.bitmap_index = 65925, .adv_w = 411, .box_w = 25, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 66225, .adv_w = 305, .box_w = 19, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 66453, .adv_w = 453, .box_w = 28, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 66761, .adv_w = 348, .box_w = 22, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 66948, .adv_w = 436, .box_w = 25, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 67223, .adv_w = 331, .box_w = 19, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 67385, .adv_w = 383, .box_w = 24, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 67661, .adv_w = 294, .box_w = 19, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 67832, .adv_w = 434, .box_w = 23, .box_h = 33, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 68212, .adv_w = 362, .box_w = 19, .box_h = 28, .ofs_x = 3, .ofs_y = -4},
-    {.bitmap_index = 68478, .adv_w = 376, .box_w = 22, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 68742, .adv_w = 304, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 68895, .adv_w = 375, .box_w = 19, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 69104, .adv_w = 357, .box_w = 18, .box_h = 23, .ofs_x = 3, .ofs_y = -6},
-    {.bitmap_index = 69311, .adv_w = 294, .box_w = 16, .box_h = 27, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 69527, .adv_w = 230, .box_w = 12, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 69653, .adv_w = 311, .box_w = 18, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 69851, .adv_w = 257, .box_w = 15, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 69979, .adv_w = 359, .box_w = 18, .box_h = 27, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 70222, .adv_w = 303, .box_w = 16, .box_h = 24, .ofs_x = 3, .ofs_y = -7},
-    {.bitmap_index = 70414, .adv_w = 539, .box_w = 34, .box_h = 27, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 70873, .adv_w = 441, .box_w = 28, .box_h = 21, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 71167, .adv_w = 326, .box_w = 18, .box_h = 28, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 71419, .adv_w = 273, .box_w = 16, .box_h = 21, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 71587, .adv_w = 383, .box_w = 21, .box_h = 27, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 71871, .adv_w = 297, .box_w = 17, .box_h = 21, .ofs_x = 3, .ofs_y = -4},
-    {.bitmap_index = 72050, .adv_w = 372, .box_w = 20, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 72270, .adv_w = 306, .box_w = 16, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 72406, .adv_w = 371, .box_w = 22, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 72648, .adv_w = 297, .box_w = 19, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 72876, .adv_w = 416, .box_w = 26, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 73162, .adv_w = 331, .box_w = 21, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 73341, .adv_w = 433, .box_w = 24, .box_h = 27, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 73665, .adv_w = 355, .box_w = 19, .box_h = 21, .ofs_x = 3, .ofs_y = -4},
-    {.bitmap_index = 73865, .adv_w = 557, .box_w = 32, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 74217, .adv_w = 449, .box_w = 25, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 74430, .adv_w = 616, .box_w = 35, .box_h = 27, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 74903, .adv_w = 496, .box_w = 28, .box_h = 24, .ofs_x = 3, .ofs_y = -7},
-    {.bitmap_index = 75239, .adv_w = 498, .box_w = 27, .box_h = 23, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 75550, .adv_w = 407, .box_w = 23, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 75746, .adv_w = 367, .box_w = 21, .box_h = 27, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 76030, .adv_w = 288, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 76198, .adv_w = 301, .box_w = 19, .box_h = 27, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 76455, .adv_w = 242, .box_w = 16, .box_h = 21, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 76623, .adv_w = 334, .box_w = 21, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 76854, .adv_w = 286, .box_w = 18, .box_h = 23, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 77061, .adv_w = 334, .box_w = 21, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 77292, .adv_w = 286, .box_w = 18, .box_h = 23, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 77499, .adv_w = 353, .box_w = 22, .box_h = 27, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 77796, .adv_w = 269, .box_w = 18, .box_h = 21, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 77985, .adv_w = 495, .box_w = 31, .box_h = 28, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 78419, .adv_w = 388, .box_w = 23, .box_h = 21, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 78661, .adv_w = 387, .box_w = 23, .box_h = 27, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 78972, .adv_w = 318, .box_w = 18, .box_h = 21, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 79161, .adv_w = 374, .box_w = 19, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 79370, .adv_w = 307, .box_w = 15, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 79498, .adv_w = 374, .box_w = 19, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 79707, .adv_w = 343, .box_w = 16, .box_h = 24, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 79899, .adv_w = 499, .box_w = 30, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 80229, .adv_w = 385, .box_w = 23, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 80425, .adv_w = 499, .box_w = 30, .box_h = 27, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 80830, .adv_w = 385, .box_w = 23, .box_h = 21, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 81072, .adv_w = 159, .box_w = 4, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 81116, .adv_w = 518, .box_w = 32, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 81564, .adv_w = 423, .box_w = 26, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 81876, .adv_w = 359, .box_w = 19, .box_h = 28, .ofs_x = 3, .ofs_y = -6},
-    {.bitmap_index = 82142, .adv_w = 297, .box_w = 15, .box_h = 23, .ofs_x = 3, .ofs_y = -6},
-    {.bitmap_index = 82315, .adv_w = 333, .box_w = 20, .box_h = 21, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 82525, .adv_w = 418, .box_w = 20, .box_h = 29, .ofs_x = 3, .ofs_y = -7},
-    {.bitmap_index = 82815, .adv_w = 349, .box_w = 16, .box_h = 23, .ofs_x = 3, .ofs_y = -6},
-    {.bitmap_index = 82999, .adv_w = 433, .box_w = 23, .box_h = 27, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 83310, .adv_w = 355, .box_w = 19, .box_h = 21, .ofs_x = 3, .ofs_y = -4},
-    {.bitmap_index = 83510, .adv_w = 373, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 83767, .adv_w = 306, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 83925, .adv_w = 508, .box_w = 28, .box_h = 27, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 84303, .adv_w = 418, .box_w = 22, .box_h = 21, .ofs_x = 3, .ofs_y = -4},
-    {.bitmap_index = 84534, .adv_w = 140, .box_w = 3, .box_h = 24, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 84570, .adv_w = 381, .box_w = 24, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 84906, .adv_w = 298, .box_w = 15, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 85086, .adv_w = 381, .box_w = 24, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 85422, .adv_w = 298, .box_w = 15, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 85587, .adv_w = 525, .box_w = 32, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 85939, .adv_w = 507, .box_w = 30, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 86194, .adv_w = 337, .box_w = 17, .box_h = 28, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 86432, .adv_w = 320, .box_w = 17, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 86636, .adv_w = 422, .box_w = 24, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 86900, .adv_w = 316, .box_w = 18, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 87053, .adv_w = 422, .box_w = 24, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 87389, .adv_w = 316, .box_w = 18, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 87587, .adv_w = 518, .box_w = 32, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 88035, .adv_w = 423, .box_w = 26, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 88321, .adv_w = 326, .box_w = 18, .box_h = 29, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 88582, .adv_w = 273, .box_w = 16, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 88766, .adv_w = 315, .box_w = 17, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 88953, .adv_w = 263, .box_w = 17, .box_h = 23, .ofs_x = -1, .ofs_y = -6},
-    {.bitmap_index = 89149, .adv_w = 422, .box_w = 20, .box_h = 27, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 89419, .adv_w = 352, .box_w = 16, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 89595, .adv_w = 422, .box_w = 20, .box_h = 28, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 89875, .adv_w = 352, .box_w = 16, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 90051, .adv_w = 436, .box_w = 25, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 90401, .adv_w = 326, .box_w = 18, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 90599, .adv_w = 436, .box_w = 25, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 90874, .adv_w = 331, .box_w = 19, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 91036, .adv_w = 436, .box_w = 25, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 91386, .adv_w = 331, .box_w = 19, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 91595, .adv_w = 361, .box_w = 20, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 91875, .adv_w = 292, .box_w = 17, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 92062, .adv_w = 348, .box_w = 22, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 92370, .adv_w = 286, .box_w = 19, .box_h = 28, .ofs_x = -1, .ofs_y = -6},
-    {.bitmap_index = 92636, .adv_w = 348, .box_w = 22, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 92944, .adv_w = 286, .box_w = 19, .box_h = 28, .ofs_x = -1, .ofs_y = -6},
-    {.bitmap_index = 93210, .adv_w = 348, .box_w = 22, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 93529, .adv_w = 286, .box_w = 19, .box_h = 30, .ofs_x = -1, .ofs_y = -6},
-    {.bitmap_index = 93814, .adv_w = 374, .box_w = 19, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 94080, .adv_w = 307, .box_w = 15, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 94245, .adv_w = 293, .box_w = 16, .box_h = 27, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 94461, .adv_w = 243, .box_w = 13, .box_h = 21, .ofs_x = 3, .ofs_y = -4},
-    {.bitmap_index = 94598, .adv_w = 501, .box_w = 25, .box_h = 28, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 94948, .adv_w = 402, .box_w = 19, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 95157, .adv_w = 312, .box_w = 18, .box_h = 28, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 95409, .adv_w = 245, .box_w = 15, .box_h = 23, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 95582, .adv_w = 333, .box_w = 20, .box_h = 28, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 95862, .adv_w = 268, .box_w = 17, .box_h = 23, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 96058, .adv_w = 342, .box_w = 20, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 96278, .adv_w = 284, .box_w = 17, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 96423, .adv_w = 151, .box_w = 6, .box_h = 5, .ofs_x = 2, .ofs_y = 6}
+    {.bitmap_index = 45343, .adv_w = 151, .box_w = 6, .box_h = 5, .ofs_x = 2, .ofs_y = 6}
 };
 
 /*---------------------
@@ -13618,10 +6481,6 @@ static const uint16_t unicode_list_1[] = {
     0x0, 0x23, 0x43
 };
 
-static const uint16_t unicode_list_4[] = {
-    0x0, 0x1, 0x8, 0x9, 0x10, 0x11, 0x12, 0x13
-};
-
 /*Collect the unicode lists and glyph_id offsets*/
 static const lv_font_fmt_txt_cmap_t cmaps[] =
 {
@@ -13638,23 +6497,7 @@ static const lv_font_fmt_txt_cmap_t cmaps[] =
         .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
     },
     {
-        .range_start = 1024, .range_length = 96, .glyph_id_start = 227,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 1122, .range_length = 20, .glyph_id_start = 323,
-        .unicode_list = unicode_list_4, .glyph_id_ofs_list = NULL, .list_length = 8, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    },
-    {
-        .range_start = 1162, .range_length = 59, .glyph_id_start = 331,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 1222, .range_length = 58, .glyph_id_start = 390,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 8226, .range_length = 1, .glyph_id_start = 448,
+        .range_start = 8226, .range_length = 1, .glyph_id_start = 227,
         .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
     }
 };
@@ -13680,7 +6523,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmaps = cmaps,
     .kern_dsc = NULL,
     .kern_scale = 0,
-    .cmap_num = 8,
+    .cmap_num = 4,
     .bpp = 4,
     .kern_classes = 0,
     .bitmap_format = 0,
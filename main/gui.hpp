@@ -36,12 +36,13 @@ SOFTWARE.
 #include "SettingsConfig.hpp"
 #include "BambuMonitor.hpp"
 #include <map>
+#include <set>
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
 #include <cJSON.h>  // For file-based weather polling
 #include <sys/stat.h>  // For stat() to check file metadata
 
-LV_IMG_DECLARE(dev_bg)
+LV_IMG_DECLARE(dev_bg_tlz)
 //LV_IMG_DECLARE(tux_logo)
 
 // Forward declarations
@@ -137,19 +138,13 @@ static std::string gui_get_printer_file_path(const std::string& serial) {
     return spiffs_path;
 }
 
-// UI IPC queue for marshaling data into the LVGL task context
-enum class ui_ipc_type : uint8_t {
-    TIME = 0,
-};
-
-struct ui_ipc_msg_t {
-    ui_ipc_type type;
-    struct tm time_payload;
-};
+// UI message bus (helper_ui_bus.hpp) is drained by this timer in the LVGL task
+#define UI_BUS_BUDGET_US        CONFIG_TUX_UI_IPC_BUDGET_US   // Max time draining the bus per LVGL tick
+#define PRINTER_POLL_MIN_MS     1000    // MQTT updates re-read the printer files at most this often
 
-static QueueHandle_t ui_ipc_queue = nullptr;
-static lv_timer_t *ui_ipc_timer = nullptr;
+static lv_timer_t *ui_bus_timer = nullptr;
 static lv_timer_t *weather_poll_timer = nullptr;  // File-based weather polling timer
+static lv_timer_t *printer_poll_timer = nullptr;  // File-based printer polling timer
 
 // Global buffers for datetime callback (avoid stack corruption)
 static char g_time_buf[32] = {0};
@@ -158,9 +153,8 @@ static char g_date_buf[128] = {0};
 static char g_current_time[128] = {0};
 static char g_subtitle_buf[300] = {0};  // 128 + 128 + separator + null
 
-// Forward declarations for UI IPC helpers
-bool ui_ipc_post_time(const struct tm &dtinfo);
-void ui_ipc_init();
+// Forward declaration for the UI bus drain
+void ui_bus_start();
 
 // Forward declaration for file-based weather polling
 static void weather_poll_timer_cb(lv_timer_t *timer);
@@ -303,11 +297,11 @@ static int current_page = 0;
 void lv_setup_styles()
 {
     // Use Polish fonts with Latin Extended characters for diacritics
-    font_symbol = &font_montserrat_int_14;
-    font_normal = &font_montserrat_int_14;
-    font_large = &font_montserrat_int_16;
-    font_xl = &font_montserrat_int_24;
-    font_xxl = &font_montserrat_int_32;
+    font_symbol = &font_ui_14;
+    font_normal = &font_ui_14;
+    font_large = &font_ui_16;
+    font_xl = &font_ui_24;
+    font_xxl = &font_ui_32;
     font_fa = &font_fa_14;
 
     screen_h = lv_obj_get_height(lv_scr_act());
@@ -323,14 +317,17 @@ void lv_setup_styles()
     // Image Background
     // CF_INDEXED_8_BIT for smaller size - resolution 480x480
     // NOTE: Dynamic loading bg from SPIFF makes screen perf bad
-    if (lv_fs_is_ready('F')) { // NO SD CARD load default
-        ESP_LOGW(TAG,"Loading - F:/bg/dev_bg9.bin");
-        lv_style_set_bg_img_src(&style_content_bg, "F:/bg/dev_bg9.bin");    
+    if (asset_find("bg/dev_bg9.tlz")) { // Mapped from flash, no file reads
+        ESP_LOGW(TAG,"Loading - asset bg/dev_bg9.tlz");
+        lv_style_set_bg_img_src(&style_content_bg, asset_img_src("bg/dev_bg9.tlz", NULL));
+    } else if (lv_fs_is_ready('F')) { // NO SD CARD load default
+        ESP_LOGW(TAG,"Loading - F:/bg/dev_bg9.tlz");
+        lv_style_set_bg_img_src(&style_content_bg, "F:/bg/dev_bg9.tlz");    
     } else {
         ESP_LOGW(TAG,"Loading - from firmware");
-        lv_style_set_bg_img_src(&style_content_bg, &dev_bg);
+        lv_style_set_bg_img_src(&style_content_bg, &dev_bg_tlz);
     }
-    //lv_style_set_bg_img_src(&style_content_bg, &dev_bg);
+    //lv_style_set_bg_img_src(&style_content_bg, &dev_bg_tlz);
     // lv_style_set_bg_img_opa(&style_content_bg,LV_OPA_50);
 #else
     ESP_LOGW(TAG,"Using Gradient (background image disabled to save memory)");
@@ -745,7 +742,7 @@ static void tux_panel_wifi(lv_obj_t *parent)
     lbl_webui_url = lv_label_create(cont_1);
     lv_obj_set_size(lbl_webui_url, LV_PCT(90), LV_SIZE_CONTENT);
     lv_label_set_long_mode(lbl_webui_url, LV_LABEL_LONG_WRAP);
-    lv_obj_set_style_text_font(lbl_webui_url, &font_montserrat_int_14, 0);
+    lv_obj_set_style_text_font(lbl_webui_url, &font_ui_14, 0);
     lv_label_set_text(lbl_webui_url, "For configuration go to:\nhttp://esp32-tux.local");
 
     // Check for Updates button
@@ -894,6 +891,7 @@ static void create_page_remote(lv_obj_t *parent)
 
 static void slideshow_timer_cb(lv_timer_t * timer)
 {
+    PROF_SCOPE("slideshow_timer");
     // Auto-advance carousel every 8 seconds
     if (!slideshow_enabled) return;
     
@@ -904,7 +902,8 @@ static void slideshow_timer_cb(lv_timer_t * timer)
 }
 
 // Forward declarations
-static void update_carousel_slides();
+static void update_carousel_slides(bool full_rebuild = false);
+static std::set<std::string> printer_online_serials;  // From the last printer file poll (I/O worker)
 static void update_time_ui_from_tm(const struct tm *dtinfo);
 
 // Global touch handler - called from touchpad_read in helper_display.hpp
@@ -945,17 +944,15 @@ static void create_page_home(lv_obj_t *parent)
             // Config is already updated in memory by the web POST handler
             // No need to reload from disk - just apply the current values
             if (cfg) {
-                // Apply theme from config
-                bool is_dark = (cfg->CurrentTheme == "dark");
-                switch_theme(is_dark);
-                ESP_LOGI("GUI", "Applied theme from config: %s", cfg->CurrentTheme.c_str());
-                
-                // Update carousel theme colors
-                if (carousel_widget) {
-                    carousel_widget->update_theme_colors();
+                // Apply theme from config (no-op when unchanged)
+                bool dark;
+                {
+                    std::lock_guard<std::recursive_mutex> lock(cfg->mutex);
+                    dark = cfg->CurrentTheme == "dark";
                 }
+                switch_theme(dark);
             }
-            update_carousel_slides();
+            update_carousel_slides(true);
             
             // Hide footer after carousel rebuild so touch can show it again
             if (panel_footer_global) {
@@ -975,18 +972,24 @@ static void create_page_home(lv_obj_t *parent)
     }
 }
 
-static void update_carousel_slides()
+// Builds the desired slide list from config and cache files. By default the carousel
+// is diffed by key (printer serial / weather location) so only changed panels are
+// touched; full_rebuild tears everything down when slide contents must be reset.
+static void update_carousel_slides(bool full_rebuild)
 {
     if (!carousel_widget) return;
     
-    ESP_LOGW(TAG, "update_carousel_slides() starting");
+    ESP_LOGW(TAG, "update_carousel_slides() starting (%s)", full_rebuild ? "full rebuild" : "diff");
     
-    // Clear existing slides
-    carousel_widget->slides.clear();
+    std::vector<carousel_slide_t> desired;
     
     // Add weather location slides with more descriptive info
     if (cfg) {
-        bool has_api_key = !cfg->WeatherAPIkey.empty();
+        bool has_api_key;
+        {
+            std::lock_guard<std::recursive_mutex> lock(cfg->mutex);
+            has_api_key = !cfg->WeatherAPIkey.empty();
+        }
         int weather_count = cfg->get_weather_location_count();
         for (int i = 0; i < weather_count; i++) {
             weather_location_t loc = cfg->get_weather_location(i);
@@ -1011,56 +1014,25 @@ static void update_carousel_slides()
                     slide.value3 = TR(STR_GO_TO_SETTINGS);
                     slide.value4 = TR(STR_ADD_API_KEY);
                 }
-                slide.bg_color = lv_color_hex(0x1e3a5f);  // Blue weather theme
+                slide.bg_color = lv_color_hex(CAROUSEL_WEATHER_BG);
+                slide.key = "weather:" + (loc.city.empty() ? loc.name : loc.city);
                 if (!slide_country_by_index_ptr) slide_country_by_index_ptr = new std::map<int, std::string>();
-                int slide_index = carousel_widget ? carousel_widget->slides.size() : 0;
+                int slide_index = desired.size();
                 (*slide_country_by_index_ptr)[slide_index] = loc.country;  // Store country by index
-                carousel_widget->add_slide(slide);
+                desired.push_back(slide);
             }
         }
     }
     
-    // Add printer status slides (only if online - check SPIFFS cache files)
+    // Add printer status slides (only if online as of the last printer file poll)
     if (cfg) {
         int printer_count = cfg->get_printer_count();
-        time_t now = time(NULL);
-        const time_t ONLINE_THRESHOLD = 60;  // Printer is "online" if updated within 60 seconds
         
         for (int i = 0; i < printer_count; i++) {
             printer_config_t printer = cfg->get_printer(i);
             if (!printer.enabled) continue;
             
-            // Check if printer has recent data (is online)
-            std::string filepath = gui_get_printer_file_path(printer.serial);
-            FILE *f = fopen(filepath.c_str(), "r");
-            bool is_online = false;
-            
-            if (f) {
-                fseek(f, 0, SEEK_END);
-                long fsize = ftell(f);
-                fseek(f, 0, SEEK_SET);
-                
-                if (fsize > 0 && fsize <= 20480) {
-                    char *json_buf = (char*)malloc(fsize + 1);
-                    if (json_buf) {
-                        size_t read_size = fread(json_buf, 1, fsize, f);
-                        json_buf[read_size] = '\0';
-                        
-                        cJSON *root = cJSON_Parse(json_buf);
-                        free(json_buf);
-                        
-                        if (root) {
-                            cJSON *last_update = cJSON_GetObjectItem(root, "last_update");
-                            if (last_update) {
-                                time_t update_time = (time_t)last_update->valuedouble;
-                                is_online = (now - update_time) < ONLINE_THRESHOLD;
-                            }
-                            cJSON_Delete(root);
-                        }
-                    }
-                }
-                fclose(f);
-            }
+            bool is_online = printer_online_serials.count(printer.serial) > 0;
             
             // Only add printer to carousel if it's online
             if (is_online) {
@@ -1071,10 +1043,11 @@ static void update_carousel_slides()
                 slide.value2 = "";  // Will be updated
                 slide.value3 = "";  // Layer info - will be updated
                 slide.value4 = "";  // File name - will be updated
-                slide.bg_color = lv_color_hex(0x3a1e2f);  // Purple printer theme
+                slide.bg_color = lv_color_hex(CAROUSEL_PRINTER_BG);
                 slide.icon_code = 0xf04d;  // FA_PRINTER_STOP (idle icon)
                 slide.type = SLIDE_TYPE_PRINTER;  // Mark as printer slide
-                carousel_widget->add_slide(slide);
+                slide.key = "printer:" + printer.serial;
+                desired.push_back(slide);
                 ESP_LOGI(TAG, "Added online printer %s to carousel", printer.name.c_str());
             } else {
                 ESP_LOGD(TAG, "Printer %s offline or no data, skipping carousel",
@@ -1084,17 +1057,23 @@ static void update_carousel_slides()
     }
     
     // If only the time slide exists, add a welcome message
-    if (carousel_widget->slides.size() == 1) {
+    if (desired.size() == 1) {
         carousel_slide_t placeholder;
         placeholder.title = TR(STR_WELCOME_TITLE);
         placeholder.subtitle = TR(STR_WELCOME_SUBTITLE);
         placeholder.value1 = TR(STR_WELCOME_MSG);
         placeholder.value2 = "";
         placeholder.bg_color = carousel_get_default_slide_bg();  // Theme-aware
-        carousel_widget->add_slide(placeholder);
+        placeholder.key = "welcome";
+        desired.push_back(placeholder);
     }
     
-    carousel_widget->update_slides();
+    if (full_rebuild) {
+        carousel_widget->slides = desired;
+        carousel_widget->update_slides();
+    } else {
+        carousel_widget->sync_slides(desired);
+    }
     
     // Force layout update to make carousel visible immediately
     lv_obj_update_layout(carousel_widget->container);
@@ -1137,13 +1116,13 @@ static void create_splash_screen()
     
     // Logo animation
     lv_obj_t * splash_img = lv_img_create(splash_container);
-    lv_img_set_src(splash_img, "F:/bg/tux-logo.bin");
+    lv_img_set_src(splash_img, asset_img_src("bg/tux-logo.tlz", "F:/bg/tux-logo.tlz"));
     lv_obj_set_style_pad_bottom(splash_img, 20, 0);
     
     // MyBestTools text
     lv_obj_t * splash_text = lv_label_create(splash_container);
     lv_label_set_text(splash_text, "MyBestTools");
-    lv_obj_set_style_text_font(splash_text, &font_montserrat_int_24, 0);
+    lv_obj_set_style_text_font(splash_text, &font_ui_24, 0);
     lv_obj_set_style_text_color(splash_text, lv_color_white(), 0);
 
     //lv_scr_load_anim(splash_screen, LV_SCR_LOAD_ANIM_FADE_IN, 5000, 10, true);
@@ -1339,40 +1318,33 @@ static void status_clicked_eventhandler(lv_event_t *e)
 
 void switch_theme(bool dark)
 {
-    if (dark)
-    {
-        theme_current = lv_theme_default_init(disp, lv_palette_main(LV_PALETTE_BLUE),
-                                              lv_palette_main(LV_PALETTE_GREEN),
-                                              1, /*Light or dark mode*/
-                                              &font_montserrat_int_14);
-        bg_theme_color = lv_palette_darken(LV_PALETTE_GREY, 5);
-        lv_disp_set_theme(disp, theme_current);
-        //bg_theme_color = theme_current->flags & LV_USE_THEME_DEFAULT ? lv_palette_darken(LV_PALETTE_GREY, 5) : lv_palette_lighten(LV_PALETTE_GREY, 2);
-        // lv_theme_set_apply_cb(theme_current, new_theme_apply_cb);
+    // Config saves re-apply the theme; skip the refresh when nothing changes
+    static int applied_dark = -1;
+    if (applied_dark == (int)dark) return;
+    applied_dark = dark;
 
-        lv_style_set_bg_color(&style_ui_island, bg_theme_color);
-        //lv_style_set_bg_opa(&style_ui_island, LV_OPA_80);
+    PROF_SCOPE("theme_switch");
+    int64_t t0 = esp_timer_get_time();
 
-        ESP_LOGI(TAG,"Dark theme set");
-    }
-    else
-    {
-        theme_current = lv_theme_default_init(disp,
-                                              lv_palette_main(LV_PALETTE_BLUE),
-                                              lv_palette_main(LV_PALETTE_RED),
-                                              0, /*Light or dark mode*/
-                                              &font_montserrat_int_14);
-        //bg_theme_color = lv_palette_lighten(LV_PALETTE_GREY, 5);    // #BFBFBD
-        // bg_theme_color = lv_color_make(0,0,255); 
-        bg_theme_color = lv_color_hex(0xBFBFBD); //383837
+    ui_palette_resolve(dark);
+    bg_theme_color = ui_palette.island_bg;
 
+    // Shared styles first, so the single refresh below picks them up
+    lv_style_set_bg_color(&style_ui_island, bg_theme_color);
+    lv_style_set_border_color(&style_ui_island, bg_theme_color);
+    if (carousel_styles_ready) carousel_styles_apply_theme();
 
+    // Re-initialises the default theme styles in place and refreshes every
+    // object once (lv_obj_report_style_change(NULL)); nothing is re-created
+    theme_current = lv_theme_default_init(disp, ui_palette.primary, ui_palette.secondary,
+                                          dark, &font_ui_14);
+    if (lv_disp_get_theme(disp) != theme_current) {
         lv_disp_set_theme(disp, theme_current);
-        // lv_theme_set_apply_cb(theme_current, new_theme_apply_cb);
-        lv_style_set_bg_color(&style_ui_island, bg_theme_color);
-        ESP_LOGI(TAG,"Light theme set");        
-
+        lv_obj_report_style_change(NULL);
     }
+
+    ESP_LOGI(TAG, "%s theme set in %lu us", dark ? "Dark" : "Light",
+             (unsigned long)(esp_timer_get_time() - t0));
 }
 
 // /*Will be called when the styles of the base theme are already added
@@ -1456,11 +1428,12 @@ static void update_time_ui_from_tm(const struct tm *dtinfo)
     ESP_LOGD(TAG, "update_time_ui_from_tm: %s (panels=%d)",
              g_subtitle_buf, carousel_widget->slide_panels.size());
 
-    // Update ONLY WEATHER slide panels (not printer slides)
-    for (size_t i = 0; i < carousel_widget->slide_panels.size(); i++) {
+    // Update ONLY WEATHER slide panels (not printer slides). The text only changes once
+    // a minute, so the dirty check skips the label write on every other tick.
+    for (size_t i = 0; i < carousel_widget->slide_panels.size() && i < carousel_widget->slides.size(); i++) {
         // Skip printer slides - they show status, not time
-        if (i < carousel_widget->slides.size() && 
-            carousel_widget->slides[i].type == SLIDE_TYPE_PRINTER) {
+        carousel_slide_t &slide = carousel_widget->slides[i];
+        if (slide.type == SLIDE_TYPE_PRINTER) {
             continue;
         }
         
@@ -1472,60 +1445,77 @@ static void update_time_ui_from_tm(const struct tm *dtinfo)
             continue;
         }
 
-        uint32_t child_cnt = lv_obj_get_child_cnt(panel);
-        if (child_cnt < 2) {
-            ESP_LOGE(TAG, "Panel %d has only %ld children!", (int)i, child_cnt);
-            continue;
-        }
-
-        lv_obj_t *subtitle_label = lv_obj_get_child(panel, 1);
-        if (!subtitle_label || !lv_obj_is_valid(subtitle_label)) {
-            ESP_LOGE(TAG, "Panel %d child(1) is NULL!", (int)i);
-            continue;
+        if (slide.subtitle.set(g_subtitle_buf)) {
+            ESP_LOGD(TAG, "Updating panel %d", (int)i);
+            carousel_widget->update_slide_labels(i);
         }
-
-        ESP_LOGD(TAG, "Updating panel %d", (int)i);
-
-        // Use set_text_static since buffer is global and persistent
-        lv_label_set_text_static(subtitle_label, g_subtitle_buf);
     }
 }
 
-static void ui_ipc_timer_cb(lv_timer_t *timer)
+static void ui_bus_dispatch(const ui_msg_t &msg)
 {
-    if (!ui_ipc_queue) return;
-
-    ui_ipc_msg_t msg = {};
-    while (xQueueReceive(ui_ipc_queue, &msg, 0) == pdTRUE) {
-        switch (msg.type) {
-            case ui_ipc_type::TIME:
-                update_time_ui_from_tm(&msg.time_payload);
-                break;
-            default:
-                break;
-        }
+    switch (msg.type) {
+        case ui_msg_type::TIME:
+            update_time_ui_from_tm(&msg.time);
+            break;
+        case ui_msg_type::IO_DONE:
+            io_complete(msg.io);
+            break;
+        case ui_msg_type::CALL:
+            if (msg.call.fn) msg.call.fn(msg.call.arg);
+            break;
+        case ui_msg_type::LV_MSG:
+            lv_msg_send(msg.lv_msg.id, msg.lv_msg.has_text ? msg.lv_msg.text : NULL);
+            break;
+        case ui_msg_type::TIMER:
+            if (msg.timer.op == ui_timer_op::READY) lv_timer_ready(msg.timer.timer);
+            else if (msg.timer.op == ui_timer_op::PAUSE) lv_timer_pause(msg.timer.timer);
+            else lv_timer_resume(msg.timer.timer);
+            break;
+        case ui_msg_type::PRINTER:
+            // New MQTT data was written to the cache file; re-read soon, but not on every message
+            if (printer_poll_timer && lv_tick_elaps(printer_poll_timer->last_run) >= PRINTER_POLL_MIN_MS) {
+                lv_timer_ready(printer_poll_timer);
+            }
+            break;
+        case ui_msg_type::WEATHER:
+            if (weather_poll_timer) lv_timer_ready(weather_poll_timer);
+            break;
+        default:
+            break;
     }
 }
 
-void ui_ipc_init()
+static void ui_bus_timer_cb(lv_timer_t *timer)
 {
-    if (!ui_ipc_queue) {
-        ui_ipc_queue = xQueueCreate(8, sizeof(ui_ipc_msg_t));
-    }
-
-    if (ui_ipc_queue && !ui_ipc_timer) {
-        ui_ipc_timer = lv_timer_create(ui_ipc_timer_cb, 30, NULL);
+    PROF_SCOPE("ui_bus_timer");
+
+    // Leave whatever does not fit into the budget for the next pass, which runs at once
+    int64_t deadline = esp_timer_get_time() + UI_BUS_BUDGET_US;
+    ui_msg_t msg;
+    while (ui_bus_take(msg)) {
+        ui_bus_dispatch(msg);
+        if (esp_timer_get_time() >= deadline) {
+            if (ui_bus_pending()) {
+                ui_bus_stats.deferred++;
+                lv_timer_ready(timer);
+            }
+            break;
+        }
     }
 }
 
-bool ui_ipc_post_time(const struct tm &dtinfo)
+void ui_bus_start()
 {
-    if (!ui_ipc_queue) return false;
-
-    ui_ipc_msg_t msg = {};
-    msg.type = ui_ipc_type::TIME;
-    msg.time_payload = dtinfo;
-    return xQueueSendToBack(ui_ipc_queue, &msg, 0) == pdPASS;
+    ui_bus_init();
+    io_worker_set_sink(ui_bus_post_io);
+    io_worker_init();
+
+    if (!ui_bus_timer) {
+        // Tickless: posts wake the GUI task and run this timer at once, the period is a fallback
+        ui_bus_timer = lv_timer_create(ui_bus_timer_cb, LV_TICK_CUSTOM ? 500 : 30, NULL);
+        gui_wake_timer = ui_bus_timer;
+    }
 }
 
 // ============= FILE-BASED WEATHER POLLING =============
@@ -1553,85 +1543,31 @@ static const char* get_weather_icon_string(const char* owm_icon)
     return FA_WEATHER_CLOUD;  // default
 }
 
-// Get weather icon color based on day/night
-static lv_color_t get_weather_icon_color(const char* owm_icon)
-{
-    if (!owm_icon) return lv_palette_main(LV_PALETTE_BLUE_GREY);
-
-    if (strchr(owm_icon, 'd')) {
-        return lv_color_make(241, 235, 156);  // Day: warm yellow
-    } else {
-        return lv_palette_main(LV_PALETTE_BLUE_GREY);  // Night: blue-grey
-    }
-}
+// One weather slide to refresh; filled in by the I/O worker
+struct weather_file_slot_t {
+    size_t panel_idx;
+    std::string key;                // Slide key, re-checked before applying
+    std::string names[2];           // Config city and location name, tried in order
+    bool loaded = false;
+    float temp = 0, temp_high = 0, temp_low = 0;
+    int humidity = 0, pressure = 0;
+    std::string city_name, description, icon;
+};
 
-static void poll_weather_files()
-{
-    if (!carousel_widget || carousel_widget->slide_panels.empty()) return;
-    if (!cfg) return;
+struct weather_files_job_t {
+    std::vector<weather_file_slot_t> slots;
+};
 
-    // Track API key status - rebuild carousel when it changes
-    static bool last_has_api_key = false;
-    bool has_api_key = !cfg->WeatherAPIkey.empty();
-    if (has_api_key != last_has_api_key) {
-        ESP_LOGI(TAG, "Weather API key status changed: %s -> %s, rebuilding carousel",
-                 last_has_api_key ? "set" : "not set", has_api_key ? "set" : "not set");
-        last_has_api_key = has_api_key;
-        update_carousel_slides();
-        return;  // Carousel rebuilt, let next poll update the data
-    }
+static volatile bool weather_files_pending = false;  // One job in flight at a time
 
-    // Track weather location count - rebuild carousel when locations added/removed
-    static int last_weather_location_count = -1;
-    int weather_count = cfg->get_weather_location_count();
-    int enabled_count = 0;
-    for (int i = 0; i < weather_count; i++) {
-        if (cfg->get_weather_location(i).enabled) enabled_count++;
-    }
-    if (last_weather_location_count != enabled_count) {
-        ESP_LOGI(TAG, "Weather location count changed: %d -> %d, rebuilding carousel",
-                 last_weather_location_count, enabled_count);
-        last_weather_location_count = enabled_count;
-        update_carousel_slides();
-        return;  // Carousel rebuilt, let next poll update the data
-    }
-
-    // Iterate over weather slides (type check) and try multiple filename patterns
-    int slide_idx = 0;
-    for (size_t panel_idx = 0; panel_idx < carousel_widget->slide_panels.size(); panel_idx++) {
-        // Check if this is a weather slide
-        if (panel_idx >= carousel_widget->slides.size()) continue;
-        if (carousel_widget->slides[panel_idx].type != SLIDE_TYPE_WEATHER) continue;
-        
-        // Get the weather location config for this weather slide
-        if (slide_idx >= weather_count) continue;
-        
-        // Find enabled location at this index
-        int enabled_idx = 0;
-        int config_idx = -1;
-        for (int i = 0; i < weather_count; i++) {
-            if (cfg->get_weather_location(i).enabled) {
-                if (enabled_idx == slide_idx) {
-                    config_idx = i;
-                    break;
-                }
-                enabled_idx++;
-            }
-        }
-        if (config_idx < 0) { slide_idx++; continue; }
-        
-        weather_location_t loc = cfg->get_weather_location(config_idx);
-        slide_idx++;  // Increment for next weather slide
-
-        // Try multiple filename patterns:
-        // 1. Based on config city name
-        // 2. Based on config location name  
-        // 3. Based on the API-returned name (might be different language)
-        std::vector<std::string> names_to_try = {loc.city, loc.name};
-        
+// Worker task: read and decode /spiffs/weather/<name>.json for every slide
+static void weather_files_work(void *ctx)
+{
+    weather_files_job_t *job = (weather_files_job_t *)ctx;
+    for (weather_file_slot_t &slot : job->slots) {
         FILE *f = nullptr;
         std::string filepath;
-        for (const auto& name : names_to_try) {
+        for (const auto &name : slot.names) {
             if (name.empty()) continue;
             std::string safe_name = name;
             for (char &c : safe_name) {
@@ -1642,9 +1578,9 @@ static void poll_weather_files()
             f = fopen(filepath.c_str(), "r");
             if (f) break;
         }
-        
+
         if (!f) {
-            ESP_LOGD(TAG, "Weather file not found for: %s / %s", loc.city.c_str(), loc.name.c_str());
+            ESP_LOGD(TAG, "Weather file not found for: %s / %s", slot.names[0].c_str(), slot.names[1].c_str());
             continue;
         }
 
@@ -1668,7 +1604,6 @@ static void poll_weather_files()
         fclose(f);
         json_buf[read_size] = '\0';
 
-        // Parse JSON
         cJSON *root = cJSON_Parse(json_buf);
         free(json_buf);
 
@@ -1677,87 +1612,172 @@ static void poll_weather_files()
             continue;
         }
 
-        // Extract weather data
         cJSON *name_item = cJSON_GetObjectItem(root, "name");
         cJSON *main_obj = cJSON_GetObjectItem(root, "main");
         cJSON *weather_arr = cJSON_GetObjectItem(root, "weather");
 
-        if (!name_item || !main_obj || !weather_arr) {
-            cJSON_Delete(root);
-            continue;
+        if (cJSON_IsString(name_item) && main_obj && weather_arr) {
+            auto num = [main_obj](const char *key) {
+                cJSON *item = cJSON_GetObjectItem(main_obj, key);
+                return cJSON_IsNumber(item) ? item->valuedouble : 0.0;
+            };
+            slot.city_name = name_item->valuestring;
+            slot.temp = num("temp");
+            slot.temp_high = num("temp_max");
+            slot.temp_low = num("temp_min");
+            slot.humidity = (int)num("humidity");
+            slot.pressure = (int)num("pressure");
+
+            cJSON *weather_item = cJSON_GetArrayItem(weather_arr, 0);
+            cJSON *desc_item = cJSON_GetObjectItem(weather_item, "description");
+            cJSON *icon_item = cJSON_GetObjectItem(weather_item, "icon");
+            slot.description = cJSON_IsString(desc_item) ? desc_item->valuestring : "N/A";
+            // Default to scattered clouds instead of clear sky
+            slot.icon = cJSON_IsString(icon_item) ? icon_item->valuestring : "03d";
+            slot.loaded = true;
         }
+        cJSON_Delete(root);
+    }
+}
 
-        const char *city_name = name_item->valuestring;
-        float temp = cJSON_GetObjectItem(main_obj, "temp")->valuedouble;
-        float temp_high = cJSON_GetObjectItem(main_obj, "temp_max")->valuedouble;
-        float temp_low = cJSON_GetObjectItem(main_obj, "temp_min")->valuedouble;
-        int humidity = cJSON_GetObjectItem(main_obj, "humidity")->valueint;
-        int pressure = cJSON_GetObjectItem(main_obj, "pressure")->valueint;
+// LVGL task: format the decoded data into the slides that still exist
+static void weather_files_done(void *ctx)
+{
+    weather_files_job_t *job = (weather_files_job_t *)ctx;
+    if (!carousel_widget) return;
 
-        cJSON *weather_item = cJSON_GetArrayItem(weather_arr, 0);
-        const char *description = weather_item ? cJSON_GetObjectItem(weather_item, "description")->valuestring : "N/A";
+    for (const weather_file_slot_t &slot : job->slots) {
+        if (!slot.loaded) continue;
 
-        // Update the carousel panel
-        lv_obj_t *panel = carousel_widget->slide_panels[panel_idx];
-        if (!panel || !lv_obj_is_valid(panel)) {
-            cJSON_Delete(root);
+        // The carousel may have been rebuilt while the files were read
+        size_t panel_idx = slot.panel_idx;
+        if (panel_idx >= carousel_widget->slides.size() ||
+            panel_idx >= carousel_widget->slide_panels.size() ||
+            !(carousel_widget->slides[panel_idx].key == slot.key)) {
             continue;
         }
 
-        uint32_t child_cnt = lv_obj_get_child_cnt(panel);
-        if (child_cnt < 7) {  // Need 7 children: title, subtitle, value1-4, icon
-            cJSON_Delete(root);
-            continue;
-        }
+        lv_obj_t *panel = carousel_widget->slide_panels[panel_idx];
+        if (!panel || !lv_obj_is_valid(panel)) continue;
+        if (lv_obj_get_child_cnt(panel) < 7) continue;  // Need 7 children: title, subtitle, value1-4, icon
 
-        // Update labels: children 2-5 are value labels, child 6 is icon
-        lv_obj_t *value1 = lv_obj_get_child(panel, 2);
-        lv_obj_t *value2 = lv_obj_get_child(panel, 3);
-        lv_obj_t *value3 = lv_obj_get_child(panel, 4);
-        lv_obj_t *value4 = lv_obj_get_child(panel, 5);
-        lv_obj_t *icon_lbl = lv_obj_get_child(panel, 6);
+        // Format into the slide fields; update_slide_labels() only touches labels that changed
+        carousel_slide_t &slide = carousel_widget->slides[panel_idx];
+        char text_buf[128];
 
-        static char temp_buf[32];
-        static char range_buf[128];
-        static char pressure_buf[64];
+        snprintf(text_buf, sizeof(text_buf), "%.1f°C", slot.temp);
+        slide.value1 = text_buf;
 
-        if (value1 && lv_obj_is_valid(value1)) {
-            snprintf(temp_buf, sizeof(temp_buf), "%.1f°C", temp);
-            lv_label_set_text(value1, temp_buf);
-        }
+        slide.value2 = slot.description;
 
-        if (value2 && lv_obj_is_valid(value2) && description) {
-            lv_label_set_text(value2, description);
-        }
+        snprintf(text_buf, sizeof(text_buf), "%s: %.1f° %s: %.1f° • %s: %d%%",
+                 TR(STR_HIGH), slot.temp_high, TR(STR_LOW), slot.temp_low, TR(STR_HUMIDITY), slot.humidity);
+        slide.value3 = text_buf;
 
-        if (value3 && lv_obj_is_valid(value3)) {
-            snprintf(range_buf, sizeof(range_buf), "%s: %.1f° %s: %.1f° • %s: %d%%",
-                     TR(STR_HIGH), temp_high, TR(STR_LOW), temp_low, TR(STR_HUMIDITY), humidity);
-            lv_label_set_text(value3, range_buf);
-        }
+        snprintf(text_buf, sizeof(text_buf), "%s: %d hPa", TR(STR_PRESSURE), slot.pressure);
+        slide.value4 = text_buf;
 
-        if (value4 && lv_obj_is_valid(value4)) {
-            snprintf(pressure_buf, sizeof(pressure_buf), "%s: %d hPa", TR(STR_PRESSURE), pressure);
-            lv_label_set_text(value4, pressure_buf);
-        }
+        carousel_widget->update_slide_labels(panel_idx);
 
-        // Update weather icon (child 6)
-        if (icon_lbl && lv_obj_is_valid(icon_lbl)) {
-            cJSON *icon_item = cJSON_GetObjectItem(weather_item, "icon");
-            const char *icon_code = icon_item ? icon_item->valuestring : "03d";  // Default to scattered clouds instead of clear sky
-            const char *icon_str = get_weather_icon_string(icon_code);
-            lv_color_t icon_color = get_weather_icon_color(icon_code);
-            lv_label_set_text(icon_lbl, icon_str);
-            lv_obj_set_style_text_color(icon_lbl, icon_color, 0);
+        // Update weather icon (child 6): day icons warm yellow, night icons blue-grey
+        const char *icon_code = slot.icon.c_str();
+        carousel_widget->set_weather_icon(panel_idx, get_weather_icon_string(icon_code),
+                                          strchr(icon_code, 'd') != nullptr);
+
+        ESP_LOGD(TAG, "Updated panel %d from file: %s (%.1f°C)", (int)panel_idx, slot.city_name.c_str(), slot.temp);
+    }
+}
+
+static void weather_files_release(void *ctx)
+{
+    delete (weather_files_job_t *)ctx;
+    weather_files_pending = false;
+}
+
+static void poll_weather_files()
+{
+    if (!carousel_widget || carousel_widget->slide_panels.empty()) return;
+    if (!cfg) return;
+    if (weather_files_pending) return;
+
+    // Track API key status - rebuild carousel when it changes
+    static bool last_has_api_key = false;
+    bool has_api_key;
+    {
+        std::lock_guard<std::recursive_mutex> lock(cfg->mutex);
+        has_api_key = !cfg->WeatherAPIkey.empty();
+    }
+    if (has_api_key != last_has_api_key) {
+        ESP_LOGI(TAG, "Weather API key status changed: %s -> %s, rebuilding carousel",
+                 last_has_api_key ? "set" : "not set", has_api_key ? "set" : "not set");
+        last_has_api_key = has_api_key;
+        update_carousel_slides(true);  // Placeholder texts differ, reset weather slides
+        return;  // Carousel rebuilt, let next poll update the data
+    }
+
+    // Track weather location count - rebuild carousel when locations added/removed
+    static int last_weather_location_count = -1;
+    int weather_count = cfg->get_weather_location_count();
+    int enabled_count = 0;
+    for (int i = 0; i < weather_count; i++) {
+        if (cfg->get_weather_location(i).enabled) enabled_count++;
+    }
+    if (last_weather_location_count != enabled_count) {
+        ESP_LOGI(TAG, "Weather location count changed: %d -> %d, rebuilding carousel",
+                 last_weather_location_count, enabled_count);
+        last_weather_location_count = enabled_count;
+        update_carousel_slides();
+        return;  // Carousel rebuilt, let next poll update the data
+    }
+
+    // Collect the weather slides and their locations; the files are read on the I/O worker
+    weather_files_job_t *job = new weather_files_job_t();
+    int slide_idx = 0;
+    for (size_t panel_idx = 0; panel_idx < carousel_widget->slide_panels.size(); panel_idx++) {
+        // Check if this is a weather slide
+        if (panel_idx >= carousel_widget->slides.size()) continue;
+        if (carousel_widget->slides[panel_idx].type != SLIDE_TYPE_WEATHER) continue;
+        
+        // Get the weather location config for this weather slide
+        if (slide_idx >= weather_count) continue;
+        
+        // Find enabled location at this index
+        int enabled_idx = 0;
+        int config_idx = -1;
+        for (int i = 0; i < weather_count; i++) {
+            if (cfg->get_weather_location(i).enabled) {
+                if (enabled_idx == slide_idx) {
+                    config_idx = i;
+                    break;
+                }
+                enabled_idx++;
+            }
         }
+        if (config_idx < 0) { slide_idx++; continue; }
+        
+        weather_location_t loc = cfg->get_weather_location(config_idx);
+        slide_idx++;  // Increment for next weather slide
 
-        ESP_LOGD(TAG, "Updated panel %d from file: %s (%.1f°C)", (int)panel_idx, city_name, temp);
-        cJSON_Delete(root);
+        // Try multiple filename patterns: config city name, then config location name
+        weather_file_slot_t slot;
+        slot.panel_idx = panel_idx;
+        slot.key = carousel_widget->slides[panel_idx].key.c_str();
+        slot.names[0] = loc.city;
+        slot.names[1] = loc.name;
+        job->slots.push_back(std::move(slot));
     }
+
+    if (job->slots.empty()) {
+        delete job;
+        return;
+    }
+    weather_files_pending = true;
+    io_submit("weather_files", weather_files_work, weather_files_done, weather_files_release, job);
 }
 
 static void weather_poll_timer_cb(lv_timer_t *timer)
 {
+    PROF_SCOPE("weather_poll_timer");
     poll_weather_files();
 }
 
@@ -1777,161 +1797,53 @@ void weather_poll_init()
 // ============= END FILE-BASED WEATHER POLLING =============
 
 // ============= PRINTER FILE-BASED POLLING =============
-static lv_timer_t *printer_poll_timer = nullptr;
 static int last_online_printer_count = -1;  // Track changes in online printer count
 
-static void poll_printer_files()
-{
-    ESP_LOGI(TAG, "poll_printer_files() called, carousel_widget=%p", carousel_widget);
-    
-    if (!carousel_widget) {
-        ESP_LOGW(TAG, "Carousel not initialized yet");
-        return;  // Carousel not initialized yet
-    }
+#define PRINTER_ONLINE_THRESHOLD    60      // Printer is "online" if its file was updated within 60 seconds
+#define PRINTER_FILE_MAX_BYTES      20480
+
+// One configured printer; the cache file fields are filled in by the I/O worker
+struct printer_file_t {
+    std::string serial;
+    std::string name;
+    bool loaded = false;
+    time_t update_time = 0;
+    int nozzle = 0, nozzle_tgt = 0, bed = 0, bed_tgt = 0;
+    int prog = 0, remain = 0, layer = 0, layers_total = 0;
+    std::string state = "IDLE";
+    std::string fname;
+};
 
-    if (!cfg) {
-        ESP_LOGW(TAG, "Settings config not initialized");
-        return;
-    }
+struct printer_files_job_t {
+    time_t now = 0;
+    std::vector<printer_file_t> printers;
+};
 
-    // Use global cfg pointer (already loaded)
-    int printer_count = cfg->get_printer_count();
-    ESP_LOGI(TAG, "Found %d configured printer(s)", printer_count);
-    
-    if (printer_count == 0) {
-        return;  // No printers configured
-    }
+static volatile bool printer_files_pending = false;    // One job in flight at a time
 
-    // Count how many printers are currently online
-    time_t now = time(NULL);
-    const time_t ONLINE_THRESHOLD = 60;
-    int online_count = 0;
-    
-    for (int i = 0; i < printer_count; i++) {
-        printer_config_t printer = cfg->get_printer(i);
-        std::string filepath = gui_get_printer_file_path(printer.serial);
-        ESP_LOGI(TAG, "Checking printer %d: %s (file: %s)", i, printer.serial.c_str(), filepath.c_str());
-        
-        // Open file directly - SPIFFS stat() doesn't reliably return file size
-        FILE *f = fopen(filepath.c_str(), "r");
-        if (!f) {
-            ESP_LOGI(TAG, "File not found: %s (errno=%d)", filepath.c_str(), errno);
-            continue;
-        }
-        
-        // Get file size using fseek/ftell (more reliable than stat on SPIFFS)
-        fseek(f, 0, SEEK_END);
-        long fsize = ftell(f);
-        fseek(f, 0, SEEK_SET);
-        
-        ESP_LOGI(TAG, "File %s size: %ld bytes", filepath.c_str(), fsize);
-        
-        if (fsize <= 0) {
-            ESP_LOGI(TAG, "File %s is empty (size=%ld), skipping", filepath.c_str(), fsize);
-            fclose(f);
-            continue;
-        }
-        
-        if (fsize > 20480) {
-            ESP_LOGW(TAG, "File %s too large: %ld bytes", filepath.c_str(), fsize);
-            fclose(f);
-            continue;
-        }
-        
-        char *json_buf = (char*)malloc(fsize + 1);
-        if (!json_buf) {
-            ESP_LOGW(TAG, "Failed to allocate %ld bytes for JSON", fsize);
-            fclose(f);
-            continue;
-        }
-        
-        size_t read_size = fread(json_buf, 1, fsize, f);
-        fclose(f);
-        
-        if (read_size == 0) {
-            ESP_LOGW(TAG, "Failed to read file: %s", filepath.c_str());
-            free(json_buf);
-            continue;
-        }
-        json_buf[read_size] = '\0';
-        
-        cJSON *root = cJSON_Parse(json_buf);
-        if (!root) {
-            ESP_LOGW(TAG, "Failed to parse JSON for %s", printer.serial.c_str());
-            free(json_buf);
-            continue;
-        }
-        free(json_buf);
-        
-        cJSON *last_update = cJSON_GetObjectItem(root, "last_update");
-        if (last_update) {
-            time_t update_time = (time_t)last_update->valuedouble;
-            time_t age = now - update_time;
-            ESP_LOGI(TAG, "Printer %s: last_update=%lld, age=%lld seconds, threshold=%lld",
-                     printer.serial.c_str(), (long long)update_time, (long long)age, (long long)ONLINE_THRESHOLD);
-            if (age < ONLINE_THRESHOLD) {
-                ESP_LOGI(TAG, "Printer %s is ONLINE", printer.serial.c_str());
-                online_count++;
-            } else {
-                ESP_LOGW(TAG, "Printer %s is OFFLINE (age=%lld > threshold=%lld)", 
-                         printer.serial.c_str(), (long long)age, (long long)ONLINE_THRESHOLD);
-            }
-        } else {
-            ESP_LOGW(TAG, "Printer %s: no last_update field found in JSON", printer.serial.c_str());
-        }
-        
-        cJSON_Delete(root);
-    }
-    
-    // Rebuild carousel if online printer count changed
-    if (online_count != last_online_printer_count) {
-        ESP_LOGI(TAG, "Printer online status changed: %d -> %d printers online, rebuilding carousel",
-                 last_online_printer_count, online_count);
-        last_online_printer_count = online_count;
-        update_carousel_slides();  // This rebuilds the entire carousel
-        return;  // Carousel rebuilt, slides will update on next poll
-    }
-    
-    // Online count unchanged - just update existing printer slide labels
-    for (size_t i = 1; i < carousel_widget->slides.size(); i++) {
-        carousel_slide_t &slide = carousel_widget->slides[i];
-        
-        // Check if this is a printer slide
-        if (slide.bg_color.full != lv_color_hex(0x3a1e2f).full) {
-            continue;  // Not a printer slide
-        }
+// Worker task: read and decode the BambuMonitor cache file of every configured printer
+static void printer_files_work(void *ctx)
+{
+    printer_files_job_t *job = (printer_files_job_t *)ctx;
+    job->now = time(NULL);
 
-        // Find matching printer config by comparing slide title to printer name
-        printer_config_t printer;
-        bool found = false;
-        for (int j = 0; j < printer_count; j++) {
-            printer_config_t p = cfg->get_printer(j);
-            if (p.name == slide.title) {
-                printer = p;
-                found = true;
-                break;
-            }
-        }
-        
-        if (!found) continue;
-        
+    for (printer_file_t &printer : job->printers) {
         std::string filepath = gui_get_printer_file_path(printer.serial);
-        ESP_LOGI(TAG, "Updating slide for printer: %s, file: %s", printer.name.c_str(), filepath.c_str());
-        
+
+        // Open file directly - SPIFFS stat() doesn't reliably return file size
         FILE *f = fopen(filepath.c_str(), "r");
         if (!f) {
-            ESP_LOGW(TAG, "Printer file not found: %s (errno=%d: %s)", filepath.c_str(), errno, strerror(errno));
+            ESP_LOGD(TAG, "File not found: %s (errno=%d)", filepath.c_str(), errno);
             continue;
         }
 
+        // Get file size using fseek/ftell (more reliable than stat on SPIFFS)
         fseek(f, 0, SEEK_END);
         long fsize = ftell(f);
         fseek(f, 0, SEEK_SET);
-        
-        ESP_LOGI(TAG, "Printer file %s size: %ld bytes", filepath.c_str(), fsize);
 
-        if (fsize <= 0 || fsize > 20480) {
-            ESP_LOGW(TAG, "Invalid file size: %ld (expected 1-20480)", fsize);
+        if (fsize <= 0 || fsize > PRINTER_FILE_MAX_BYTES) {
+            ESP_LOGW(TAG, "Invalid file size for %s: %ld (expected 1-%d)", filepath.c_str(), fsize, PRINTER_FILE_MAX_BYTES);
             fclose(f);
             continue;
         }
@@ -1946,9 +1858,6 @@ static void poll_printer_files()
         size_t read_size = fread(json_buf, 1, fsize, f);
         fclose(f);
         json_buf[read_size] = '\0';
-        
-        // Log first 200 chars of JSON for debugging
-        ESP_LOGI(TAG, "Printer JSON preview (first 200 chars): %.200s%s", json_buf, read_size > 200 ? "..." : "");
 
         cJSON *root = cJSON_Parse(json_buf);
         free(json_buf);
@@ -1971,30 +1880,83 @@ static void poll_printer_files()
         cJSON *total_layers = cJSON_GetObjectItem(root, "total_layers");
         cJSON *file_name = cJSON_GetObjectItem(root, "file_name");
 
-        int nozzle = nozzle_temp ? (int)nozzle_temp->valuedouble : 0;
-        int nozzle_tgt = nozzle_target ? (int)nozzle_target->valuedouble : 0;
-        int bed = bed_temp ? (int)bed_temp->valuedouble : 0;
-        int bed_tgt = bed_target ? (int)bed_target->valuedouble : 0;
-        int prog = progress ? (int)progress->valuedouble : 0;
-        int remain = remaining_min ? remaining_min->valueint : 0;
-        int layer = current_layer ? current_layer->valueint : 0;
-        int layers_total = total_layers ? total_layers->valueint : 0;
-        const char *state = (gcode_state && gcode_state->valuestring) ? gcode_state->valuestring : "IDLE";
-        const char *fname = (file_name && file_name->valuestring) ? file_name->valuestring : "";
+        printer.nozzle = nozzle_temp ? (int)nozzle_temp->valuedouble : 0;
+        printer.nozzle_tgt = nozzle_target ? (int)nozzle_target->valuedouble : 0;
+        printer.bed = bed_temp ? (int)bed_temp->valuedouble : 0;
+        printer.bed_tgt = bed_target ? (int)bed_target->valuedouble : 0;
+        printer.prog = progress ? (int)progress->valuedouble : 0;
+        printer.remain = remaining_min ? remaining_min->valueint : 0;
+        printer.layer = current_layer ? current_layer->valueint : 0;
+        printer.layers_total = total_layers ? total_layers->valueint : 0;
+        if (gcode_state && gcode_state->valuestring) printer.state = gcode_state->valuestring;
+        if (file_name && file_name->valuestring) printer.fname = file_name->valuestring;
+        printer.update_time = last_update ? (time_t)last_update->valuedouble : 0;
+        printer.loaded = true;
+
+        ESP_LOGD(TAG, "Printer %s: nozzle=%d/%d, bed=%d/%d, progress=%d%%, layer=%d/%d, state=%s, age=%lld s",
+                 printer.serial.c_str(), printer.nozzle, printer.nozzle_tgt, printer.bed, printer.bed_tgt,
+                 printer.prog, printer.layer, printer.layers_total, printer.state.c_str(),
+                 (long long)(job->now - printer.update_time));
+
+        cJSON_Delete(root);
+    }
+}
+
+// LVGL task: rebuild the carousel if the online count changed, then format the printer slides
+static void printer_files_done(void *ctx)
+{
+    printer_files_job_t *job = (printer_files_job_t *)ctx;
+    if (!carousel_widget) return;
+
+    // Collect the printers that are currently online
+    std::set<std::string> online;
+    for (const printer_file_t &printer : job->printers) {
+        if (printer.loaded && printer.update_time &&
+            job->now - printer.update_time < PRINTER_ONLINE_THRESHOLD) {
+            online.insert(printer.serial);
+        }
+    }
+
+    // Rebuild carousel if a printer came online or went offline
+    int online_count = (int)online.size();
+    if (online_count != last_online_printer_count || online != printer_online_serials) {
+        ESP_LOGI(TAG, "Printer online status changed: %d -> %d printers online, rebuilding carousel",
+                 last_online_printer_count, online_count);
+        last_online_printer_count = online_count;
+        printer_online_serials.swap(online);
+        update_carousel_slides();  // Keyed diff - only affected printer panels change
+    }
+    
+    // Update existing printer slide labels
+    for (size_t i = 0; i < carousel_widget->slides.size(); i++) {
+        carousel_slide_t &slide = carousel_widget->slides[i];
         
-        ESP_LOGI(TAG, "Parsed printer data: nozzle=%d/%d, bed=%d/%d, progress=%d%%, layer=%d/%d, state=%s", 
-                 nozzle, nozzle_tgt, bed, bed_tgt, prog, layer, layers_total, state);
+        if (slide.type != SLIDE_TYPE_PRINTER) {
+            continue;  // Not a printer slide
+        }
 
-        // Check if printer is online
-        time_t update_time = last_update ? (time_t)last_update->valuedouble : 0;
-        bool is_online = (now - update_time) < ONLINE_THRESHOLD;
+        // Find matching printer by slide key (serial survives renames)
+        const printer_file_t *found = nullptr;
+        for (const printer_file_t &p : job->printers) {
+            if (slide.key == "printer:" + p.serial) {
+                found = &p;
+                break;
+            }
+        }
+        if (!found || !found->loaded) continue;
+
+        const printer_file_t &printer = *found;
+        const char *state = printer.state.c_str();
+        int prog = printer.prog;
+        int remain = printer.remain;
+        bool is_online = (job->now - printer.update_time) < PRINTER_ONLINE_THRESHOLD;
 
         // Update carousel slide data with rich formatting
-        static char subtitle_buf[64];
-        static char value1_buf[48];
-        static char value2_buf[64];
-        static char value3_buf[64];
-        static char value4_buf[64];
+        char subtitle_buf[64];
+        char value1_buf[48];
+        char value2_buf[64];
+        char value3_buf[64];
+        char value4_buf[64];
 
         if (is_online) {
             // Subtitle: Translate state to current language
@@ -2032,34 +1994,34 @@ static void poll_printer_files()
             }
             
             // Value2: Just nozzle temp (icon is shown separately in printer layout)
-            if (nozzle_tgt > 0) {
-                snprintf(value2_buf, sizeof(value2_buf), "%d/%d°C", nozzle, nozzle_tgt);
+            if (printer.nozzle_tgt > 0) {
+                snprintf(value2_buf, sizeof(value2_buf), "%d/%d°C", printer.nozzle, printer.nozzle_tgt);
             } else {
-                snprintf(value2_buf, sizeof(value2_buf), "%d°C", nozzle);
+                snprintf(value2_buf, sizeof(value2_buf), "%d°C", printer.nozzle);
             }
             
             // Value3: Bed temp + Layer progress (localized)
-            if (layers_total > 0) {
-                if (bed_tgt > 0) {
+            if (printer.layers_total > 0) {
+                if (printer.bed_tgt > 0) {
                     snprintf(value3_buf, sizeof(value3_buf), "%s: %d/%d°C  |  %s %d/%d", 
-                             TR(STR_BED), bed, bed_tgt, TR(STR_LAYER), layer, layers_total);
+                             TR(STR_BED), printer.bed, printer.bed_tgt, TR(STR_LAYER), printer.layer, printer.layers_total);
                 } else {
                     snprintf(value3_buf, sizeof(value3_buf), "%s: %d°C  |  %s %d/%d", 
-                             TR(STR_BED), bed, TR(STR_LAYER), layer, layers_total);
+                             TR(STR_BED), printer.bed, TR(STR_LAYER), printer.layer, printer.layers_total);
                 }
             } else {
-                if (bed_tgt > 0) {
-                    snprintf(value3_buf, sizeof(value3_buf), "%s: %d/%d°C", TR(STR_BED), bed, bed_tgt);
+                if (printer.bed_tgt > 0) {
+                    snprintf(value3_buf, sizeof(value3_buf), "%s: %d/%d°C", TR(STR_BED), printer.bed, printer.bed_tgt);
                 } else {
-                    snprintf(value3_buf, sizeof(value3_buf), "%s: %d°C", TR(STR_BED), bed);
+                    snprintf(value3_buf, sizeof(value3_buf), "%s: %d°C", TR(STR_BED), printer.bed);
                 }
             }
             
             // Value4: File name (truncated if needed)
-            if (fname[0] != '\0') {
+            if (!printer.fname.empty()) {
                 // Remove .gcode extension if present
                 char clean_name[48];
-                strncpy(clean_name, fname, sizeof(clean_name) - 1);
+                strncpy(clean_name, printer.fname.c_str(), sizeof(clean_name) - 1);
                 clean_name[sizeof(clean_name) - 1] = '\0';
                 char *ext = strstr(clean_name, ".gcode");
                 if (ext) *ext = '\0';
@@ -2081,18 +2043,58 @@ static void poll_printer_files()
         slide.value3 = value3_buf;
         slide.value4 = value4_buf;
 
-        // Update the actual UI labels
+        // Update the actual UI labels (only fields whose text changed)
         carousel_widget->update_slide_labels(i);
 
-        ESP_LOGI(TAG, "Updated printer %s: %s, %d%%, nozzle=%d→%d°C, bed=%d→%d°C, layer=%d/%d",
-                 printer.name.c_str(), state, prog, nozzle, nozzle_tgt, bed, bed_tgt, layer, layers_total);
+        ESP_LOGD(TAG, "Updated printer %s: %s, %d%%", printer.name.c_str(), state, prog);
+    }
 
-        cJSON_Delete(root);
+    ESP_LOGD(TAG, "Carousel label writes: %lu, skipped unchanged: %lu",
+             (unsigned long)carousel_widget->label_writes, (unsigned long)carousel_widget->label_skips);
+}
+
+static void printer_files_release(void *ctx)
+{
+    delete (printer_files_job_t *)ctx;
+    printer_files_pending = false;
+}
+
+static void poll_printer_files()
+{
+    if (!carousel_widget) {
+        ESP_LOGW(TAG, "Carousel not initialized yet");
+        return;  // Carousel not initialized yet
+    }
+
+    if (!cfg) {
+        ESP_LOGW(TAG, "Settings config not initialized");
+        return;
+    }
+
+    if (printer_files_pending) return;  // Previous read still running
+
+    // Use global cfg pointer (already loaded)
+    int printer_count = cfg->get_printer_count();
+    if (printer_count == 0) {
+        return;  // No printers configured
     }
+
+    // Snapshot the configured printers; the files are read on the I/O worker
+    printer_files_job_t *job = new printer_files_job_t();
+    job->printers.resize(printer_count);
+    for (int i = 0; i < printer_count; i++) {
+        printer_config_t printer = cfg->get_printer(i);
+        job->printers[i].serial = printer.serial;
+        job->printers[i].name = printer.name;
+    }
+
+    printer_files_pending = true;
+    io_submit("printer_files", printer_files_work, printer_files_done, printer_files_release, job);
 }
 
 static void printer_poll_timer_cb(lv_timer_t *timer)
 {
+    PROF_SCOPE("printer_poll_timer");
     poll_printer_files();
 }
 
@@ -2121,8 +2123,8 @@ void datetime_event_cb(lv_event_t * e)
     struct tm *dtinfo = (struct tm*)lv_msg_get_payload(m);
     if (!dtinfo) return;
 
-    // Push into IPC queue so updates are serialized in LVGL timer
-    ui_ipc_post_time(*dtinfo);
+    // Push onto the UI bus so updates are serialized in the LVGL task
+    ui_bus_post_time(*dtinfo);
 }
 
 // weather_event_cb REMOVED - replaced by file-based polling via poll_weather_files()
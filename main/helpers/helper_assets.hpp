@@ -0,0 +1,303 @@
+/**
+ * @file helper_assets.hpp
+ * @brief Read-only asset partition mapped from flash
+ *
+ * The "assets" partition (partitions/partition-*.csv) holds images, fonts and other
+ * read-only files packed by scripts/assetpack.py from flash_assets/. At boot
+ * the used part of the partition is mapped into the data address space with
+ * esp_partition_mmap(); after that an asset is just a pointer into flash.
+ *
+ * - Images become lv_img_dsc_t variable sources whose data points at flash,
+ *   so LVGL (and the TLZ decoder) read pixels without opening a file or
+ *   copying them to RAM.
+ * - Fonts become lv_font_t objects whose glyph table and bitmaps stay in
+ *   flash, like the fonts compiled into the app.
+ * - Raw entries (GIFs) are handed out as pointer + size.
+ *
+ * Lookups fall back to the given SPIFFS path or compiled font when the
+ * partition is missing (old partition table) or the asset is not packed.
+ */
+
+#pragma once
+
+#include "lvgl/lvgl.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_partition.h"
+#include <string.h>
+
+static const char *TAG_ASSETS = "Assets";
+
+#define ASSETS_PARTITION        "assets"
+#define ASSETS_MAGIC            "TAP1"
+#define ASSETS_MAX_IMAGES       16      // Image descriptors handed out (RAM, 28 bytes each)
+#define ASSETS_MAX_FONTS        4
+
+#define ASSET_TYPE_RAW          0
+#define ASSET_TYPE_IMAGE        1
+#define ASSET_TYPE_FONT         2
+
+/* Partition layout, see scripts/assetpack.py */
+
+typedef struct {
+    char magic[4];              // "TAP1"
+    uint32_t count;
+    uint32_t size;              // Bytes used in the partition
+    uint32_t reserved;
+} asset_header_t;
+
+typedef struct {
+    char name[32];              // Path below flash_assets/, NUL padded
+    uint8_t type;
+    uint8_t reserved[3];
+    uint32_t offset;            // From the start of the partition, 4-byte aligned
+    uint32_t size;
+    uint32_t reserved2;
+} asset_entry_t;
+
+typedef struct {
+    uint8_t bpp;
+    uint8_t line_height;
+    int8_t base_line;
+    uint8_t reserved;
+    uint32_t glyph_count;
+    uint32_t glyph_offset;      // From the start of the entry
+    uint32_t bitmap_offset;
+} asset_font_header_t;
+
+// Same layout as the language pack glyphs (lang_glyph_t)
+typedef struct {
+    uint32_t codepoint;
+    uint32_t bitmap_offset;
+    uint16_t adv_w;             // 1/16 px
+    uint8_t box_w;
+    uint8_t box_h;
+    int8_t ofs_x;
+    int8_t ofs_y;
+    uint16_t reserved;
+} asset_glyph_t;
+
+static_assert(sizeof(asset_header_t) == 16, "asset header layout");
+static_assert(sizeof(asset_entry_t) == 48, "asset entry layout");
+static_assert(sizeof(asset_font_header_t) == 16, "asset font layout");
+static_assert(sizeof(asset_glyph_t) == 16, "asset glyph layout");
+
+/* Runtime state */
+
+typedef struct {
+    const asset_glyph_t *glyphs;    // Flash, sorted by code point
+    uint32_t count;
+    const uint8_t *bitmaps;         // Flash
+    uint8_t bpp;
+} asset_font_dsc_t;
+
+static const uint8_t *assets_base = NULL;
+static const asset_entry_t *assets_index = NULL;
+static uint32_t assets_count = 0;
+static esp_partition_mmap_handle_t assets_mmap_handle;
+
+static const asset_entry_t *assets_img_entry[ASSETS_MAX_IMAGES];
+static lv_img_dsc_t assets_img_dsc[ASSETS_MAX_IMAGES];
+static const asset_entry_t *assets_font_entry[ASSETS_MAX_FONTS];
+static asset_font_dsc_t assets_font_dsc[ASSETS_MAX_FONTS];
+static lv_font_t assets_font[ASSETS_MAX_FONTS];
+
+/**
+ * @brief Map the asset partition (call once, before the UI is built)
+ */
+static esp_err_t assets_init()
+{
+    if (assets_base) return ESP_OK;
+    int64_t t0 = esp_timer_get_time();
+
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                                           ESP_PARTITION_SUBTYPE_ANY, ASSETS_PARTITION);
+    if (!part) {
+        ESP_LOGW(TAG_ASSETS, "No '" ASSETS_PARTITION "' partition, using SPIFFS files");
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    asset_header_t hdr;
+    esp_err_t ret = esp_partition_read(part, 0, &hdr, sizeof(hdr));
+    if (ret != ESP_OK) return ret;
+    if (memcmp(hdr.magic, ASSETS_MAGIC, 4) != 0 || hdr.size > part->size ||
+        sizeof(hdr) + (uint64_t)hdr.count * sizeof(asset_entry_t) > hdr.size) {
+        ESP_LOGW(TAG_ASSETS, "Asset partition is empty or invalid (flash it with idf.py flash)");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // Only the used part takes MMU pages
+    const void *ptr = NULL;
+    ret = esp_partition_mmap(part, 0, hdr.size, ESP_PARTITION_MMAP_DATA, &ptr, &assets_mmap_handle);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG_ASSETS, "mmap of %lu bytes failed: %s", (unsigned long)hdr.size, esp_err_to_name(ret));
+        return ret;
+    }
+    assets_base = (const uint8_t *)ptr;
+    assets_index = (const asset_entry_t *)(assets_base + sizeof(asset_header_t));
+    assets_count = hdr.count;
+
+    // Reject entries that point outside the image, once, so lookups can trust them
+    for (uint32_t i = 0; i < assets_count; i++) {
+        const asset_entry_t &e = assets_index[i];
+        if (e.offset % 4 || e.offset > hdr.size || e.size > hdr.size - e.offset) {
+            ESP_LOGE(TAG_ASSETS, "Corrupt asset index (entry %lu)", (unsigned long)i);
+            esp_partition_munmap(assets_mmap_handle);
+            assets_base = NULL;
+            assets_index = NULL;
+            assets_count = 0;
+            return ESP_ERR_INVALID_SIZE;
+        }
+    }
+
+    ESP_LOGI(TAG_ASSETS, "%lu assets, %lu KB mapped at %p in %lld us", (unsigned long)assets_count,
+             (unsigned long)(hdr.size / 1024), ptr, (long long)(esp_timer_get_time() - t0));
+    return ESP_OK;
+}
+
+/**
+ * @brief Find an asset by name ("bg/tux-logo.tlz"); the index is sorted
+ */
+static const asset_entry_t *asset_find(const char *name)
+{
+    if (!assets_base || !name) return NULL;
+    uint32_t lo = 0, hi = assets_count;
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) / 2;
+        int cmp = strncmp(name, assets_index[mid].name, sizeof(assets_index[mid].name));
+        if (cmp == 0) return &assets_index[mid];
+        if (cmp > 0) lo = mid + 1;
+        else hi = mid;
+    }
+    return NULL;
+}
+
+static inline const uint8_t *asset_data(const asset_entry_t *e)
+{
+    return assets_base + e->offset;
+}
+
+/**
+ * @brief Image source for lv_img_set_src() / lv_style_set_bg_img_src()
+ *
+ * Returns the same descriptor for repeated lookups of one asset, so LVGL's
+ * image cache sees a stable source.
+ *
+ * @param fallback Source used when the asset is not available (e.g. "F:/bg/x.tlz")
+ */
+static const void *asset_img_src(const char *name, const void *fallback)
+{
+    const asset_entry_t *e = asset_find(name);
+    if (!e || e->type != ASSET_TYPE_IMAGE || e->size < sizeof(lv_img_header_t)) return fallback;
+
+    int slot = -1;
+    for (int i = 0; i < ASSETS_MAX_IMAGES; i++) {
+        if (assets_img_entry[i] == e) return &assets_img_dsc[i];
+        if (!assets_img_entry[i] && slot < 0) slot = i;
+    }
+    if (slot < 0) {
+        ESP_LOGW(TAG_ASSETS, "Too many images, %s served from fallback", name);
+        return fallback;
+    }
+
+    lv_img_dsc_t &dsc = assets_img_dsc[slot];
+    memcpy(&dsc.header, asset_data(e), sizeof(lv_img_header_t));
+    dsc.data_size = e->size - sizeof(lv_img_header_t);
+    dsc.data = asset_data(e) + sizeof(lv_img_header_t);
+    assets_img_entry[slot] = e;
+    return &dsc;
+}
+
+/* Font source: glyph table and bitmaps read in place */
+
+static const asset_glyph_t *asset_font_find(const asset_font_dsc_t *fd, uint32_t letter)
+{
+    uint32_t lo = 0, hi = fd->count;
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) / 2;
+        uint32_t cp = fd->glyphs[mid].codepoint;
+        if (cp == letter) return &fd->glyphs[mid];
+        if (cp < letter) lo = mid + 1;
+        else hi = mid;
+    }
+    return NULL;
+}
+
+static bool asset_font_get_glyph_dsc(const lv_font_t *font, lv_font_glyph_dsc_t *dsc,
+                                     uint32_t letter, uint32_t letter_next)
+{
+    (void)letter_next;
+    const asset_font_dsc_t *fd = (const asset_font_dsc_t *)font->dsc;
+    const asset_glyph_t *g = asset_font_find(fd, letter);
+    if (!g) return false;
+
+    dsc->adv_w = (g->adv_w + (1 << 3)) >> 4;
+    dsc->box_w = g->box_w;
+    dsc->box_h = g->box_h;
+    dsc->ofs_x = g->ofs_x;
+    dsc->ofs_y = g->ofs_y;
+    dsc->bpp = fd->bpp;
+    dsc->is_placeholder = false;
+    return true;
+}
+
+static const uint8_t *asset_font_get_glyph_bitmap(const lv_font_t *font, uint32_t letter)
+{
+    const asset_font_dsc_t *fd = (const asset_font_dsc_t *)font->dsc;
+    const asset_glyph_t *g = asset_font_find(fd, letter);
+    return g ? fd->bitmaps + g->bitmap_offset : NULL;
+}
+
+/**
+ * @brief Font packed from an lv_font_conv .c file ("fonts/clock_56")
+ *
+ * @param fallback Font used when the asset is not available
+ */
+static const lv_font_t *asset_font(const char *name, const lv_font_t *fallback)
+{
+    const asset_entry_t *e = asset_find(name);
+    if (!e || e->type != ASSET_TYPE_FONT || e->size < sizeof(asset_font_header_t)) return fallback;
+
+    int slot = -1;
+    for (int i = 0; i < ASSETS_MAX_FONTS; i++) {
+        if (assets_font_entry[i] == e) return &assets_font[i];
+        if (!assets_font_entry[i] && slot < 0) slot = i;
+    }
+    if (slot < 0) {
+        ESP_LOGW(TAG_ASSETS, "Too many fonts, %s served from fallback", name);
+        return fallback;
+    }
+
+    const uint8_t *base = asset_data(e);
+    const asset_font_header_t *fh = (const asset_font_header_t *)base;
+    if (fh->glyph_offset > e->size || fh->glyph_count > (e->size - fh->glyph_offset) / sizeof(asset_glyph_t) ||
+        fh->bitmap_offset > e->size) {
+        ESP_LOGE(TAG_ASSETS, "Corrupt font %s", name);
+        return fallback;
+    }
+
+    assets_font_dsc[slot] = { (const asset_glyph_t *)(base + fh->glyph_offset), fh->glyph_count,
+                              base + fh->bitmap_offset, fh->bpp };
+    lv_font_t &f = assets_font[slot];
+    f = {};
+    f.get_glyph_dsc = asset_font_get_glyph_dsc;
+    f.get_glyph_bitmap = asset_font_get_glyph_bitmap;
+    f.line_height = fh->line_height;
+    f.base_line = fh->base_line;
+    f.dsc = &assets_font_dsc[slot];
+    f.fallback = fallback;      // Characters missing from the packed subset
+    assets_font_entry[slot] = e;
+    return &f;
+}
+
+/**
+ * @brief Raw asset data (entries that are neither images nor fonts)
+ * @return Pointer into flash, or NULL
+ */
+static inline const uint8_t *asset_raw(const char *name, uint32_t *size)
+{
+    const asset_entry_t *e = asset_find(name);
+    if (!e) return NULL;
+    if (size) *size = e->size;
+    return asset_data(e);
+}
@@ -3,6 +3,7 @@
 #include "BambuMonitor.hpp"
 #include "esp_log.h"
 #include "SettingsConfig.hpp"
+#include "helper_ui_bus.hpp"
 
 // Forward declaration
 extern SettingsConfig *cfg;
@@ -32,6 +33,15 @@ static const char* bambu_get_gif_path(bambu_printer_state_t state)
     }
 }
 
+// Called from the MQTT task after a printer's cache file was written
+static void bambu_ui_event_handler(void *arg, esp_event_base_t base, int32_t id, void *data)
+{
+    LV_UNUSED(arg);
+    LV_UNUSED(base);
+    LV_UNUSED(id);
+    ui_bus_post_printer(((const bambu_event_data_t *)data)->index);   // Coalesced per printer
+}
+
 /**
  * @brief Get state description string
  * 
@@ -75,6 +85,7 @@ static esp_err_t bambu_helper_init()
         ESP_LOGE(TAG_BAMBU, "Failed to initialize Bambu Monitor system");
         return ret;
     }
+    bambu_register_event_handler(bambu_ui_event_handler);
     
     // Check if we have any printers configured
     if (!cfg || cfg->get_printer_count() == 0) {
@@ -25,9 +25,15 @@ SOFTWARE.
 
 #include "lv_conf.h"
 #include <lvgl.h>
+#include "helper_display_flush.hpp"   // Band flush pipeline (host tested)
 
 
-#define LV_TICK_PERIOD_MS 1
+#define LV_TICK_PERIOD_MS 1     // Periodic tick, only used when LV_TICK_CUSTOM is off
+
+// Longest the tickless GUI task sleeps without an LVGL timer or gui_wake().
+// While the display is active the refresh and touch read timers
+// (LV_DISP_DEF_REFR_PERIOD, LV_INDEV_DEF_READ_PERIOD) wake it every 30 ms.
+#define GUI_MAX_SLEEP_MS 500
     
 /*********************
  *  THEME DEFINES
@@ -58,12 +64,47 @@ SOFTWARE.
 static const uint16_t screenWidth = TFT_WIDTH;
 static const uint16_t screenHeight = TFT_HEIGHT;
 
+// Draw buffer band height in lines (menuconfig: Display Options)
+#if defined(CONFIG_TUX_LVGL_BUFF_LINES)
+#define BUFF_SIZE CONFIG_TUX_LVGL_BUFF_LINES
+#else
 #define BUFF_SIZE 40
+#endif
+
+#if !defined(CONFIG_TUX_LVGL_SINGLE_BUFFER)
 #define LVGL_DOUBLE_BUFFER
+#define LVGL_BUFF_COUNT 2
+#else
+#define LVGL_BUFF_COUNT 1
+#endif
+
+// Flush on a separate core so LVGL renders the next band while DMA sends this one
+#if defined(LVGL_DOUBLE_BUFFER) && CONFIG_FREERTOS_UNICORE == 0
+#define LVGL_ASYNC_FLUSH
+#endif
+
+#if defined(CONFIG_TUX_DISPLAY_STATS_PERIOD)
+#define DISPLAY_STATS_PERIOD_MS (CONFIG_TUX_DISPLAY_STATS_PERIOD * 1000)
+#else
+#define DISPLAY_STATS_PERIOD_MS 0
+#endif
+
+// Dim the backlight and stop rendering after this long without touch (0 = never)
+#if defined(CONFIG_TUX_DISPLAY_IDLE_TIMEOUT)
+#define DISPLAY_IDLE_TIMEOUT_MS (CONFIG_TUX_DISPLAY_IDLE_TIMEOUT * 1000)
+#define DISPLAY_IDLE_BRIGHTNESS CONFIG_TUX_DISPLAY_IDLE_BRIGHTNESS
+#else
+#define DISPLAY_IDLE_TIMEOUT_MS 0
+#define DISPLAY_IDLE_BRIGHTNESS 0
+#endif
+
+// Touch read period while idle: the panel only has to notice the wake-up touch
+#define DISPLAY_IDLE_READ_PERIOD_MS 200
 
 static lv_disp_draw_buf_t draw_buf;
 
 static lv_disp_t *disp;
+static lv_indev_t *touch_indev;
 static lv_theme_t *theme_current;
 static lv_color_t bg_theme_color;
 
@@ -77,10 +118,22 @@ static TaskHandle_t g_lvgl_task_handle;
 
 static void gui_task(void *args);
 
+// Idle mode: backlight dimmed and the display refresh timer paused
+static bool display_idle = false;
+static bool display_idle_swallow = false;   // Ignore the touch that woke the display
+static uint8_t display_saved_brightness = 0;
+
+// Timer made ready whenever gui_wake() wakes the GUI task (the UI bus drain)
+static lv_timer_t *gui_wake_timer = NULL;
+
 /*** Function declaration ***/
-void display_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p);
+static void display_push(const lv_area_t *area, lv_color_t *color_p);
+static void display_monitor(lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px);
 void touchpad_read(lv_indev_drv_t *indev_driver, lv_indev_data_t *data);
+#if !LV_TICK_CUSTOM
 static void lv_tick_task(void *arg);
+#endif
+static void display_idle_timer_cb(lv_timer_t *timer);
 
 
 esp_err_t lv_display_init()
@@ -118,6 +171,8 @@ esp_err_t lv_display_init()
     disp_drv.hor_res = screenWidth;
     disp_drv.ver_res = screenHeight;
     disp_drv.flush_cb = display_flush;
+    disp_drv.wait_cb = display_wait;
+    disp_drv.monitor_cb = display_monitor;
     disp_drv.draw_buf = &draw_buf;
     disp_drv.sw_rotate = 0;  // Disable software rotation (hardware handles it)
     disp = lv_disp_drv_register(&disp_drv);
@@ -127,8 +182,12 @@ esp_err_t lv_display_init()
     lv_indev_drv_init(&indev_drv);
     indev_drv.type = LV_INDEV_TYPE_POINTER;
     indev_drv.read_cb = touchpad_read;
-    lv_indev_drv_register(&indev_drv);
+    touch_indev = lv_indev_drv_register(&indev_drv);
 
+#if LV_TICK_CUSTOM
+    /* Tickless: lv_tick_get() reads esp_timer directly (see lv_conf.h) */
+    esp_timer_handle_t lv_periodic_timer = NULL;
+#else
     /* Create and start a periodic timer interrupt to call lv_tick_inc */
     const esp_timer_create_args_t lv_periodic_timer_args = {
         .callback = &lv_tick_task,
@@ -140,6 +199,16 @@ esp_err_t lv_display_init()
     esp_timer_handle_t lv_periodic_timer;
     ESP_ERROR_CHECK(esp_timer_create(&lv_periodic_timer_args, &lv_periodic_timer));
     ESP_ERROR_CHECK(esp_timer_start_periodic(lv_periodic_timer, LV_TICK_PERIOD_MS * 1000));
+#endif
+
+    if (DISPLAY_IDLE_TIMEOUT_MS > 0) {
+        lv_timer_create(display_idle_timer_cb, 1000, NULL);
+    }
+
+    prof_init();
+#if defined(CONFIG_TUX_PERF_HUD)
+    prof_hud_show(true);
+#endif
 
     // Setup theme
     theme_current = lv_theme_default_init(disp, lv_palette_main(LV_PALETTE_BLUE),
@@ -159,6 +228,14 @@ esp_err_t lv_display_init()
         return ESP_FAIL;
     }
 
+#if defined(LVGL_ASYNC_FLUSH)
+    display_flush_start(display_push, true, 0);     // LVGL runs on core 1
+#else
+    display_flush_start(display_push, false, 0);
+#endif
+    ESP_LOGI(TAG, "LVGL draw buffer: %d lines x %d, %s flush, %s tick", BUFF_SIZE, LVGL_BUFF_COUNT,
+             flush_queue ? "async" : "sync", LV_TICK_CUSTOM ? "tickless" : "periodic");
+
 #if CONFIG_FREERTOS_UNICORE == 0
     int err = xTaskCreatePinnedToCore(gui_task, "lv gui", 1024 * 8, NULL, 3, &g_lvgl_task_handle, 1);
 #else
@@ -174,8 +251,8 @@ esp_err_t lv_display_init()
     return ESP_OK;
 }
 
-// Display callback to flush the buffer to screen
-void display_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p)
+// Push one band to the panel; returns when the DMA transfer has completed
+static void display_push(const lv_area_t *area, lv_color_t *color_p)
 {
     uint32_t w = (area->x2 - area->x1 + 1);
     uint32_t h = (area->y2 - area->y1 + 1);
@@ -186,31 +263,152 @@ void display_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color
     // lcd.pushPixels((uint16_t *)&color_p->full, w * h, true);
     // lcd.endWrite();
 
-    /* With DMA */
-    // TODO: Yet to do performance test
+    /* With DMA - endWrite() waits for the transfer to finish */
+    int64_t t0 = esp_timer_get_time();
     lcd.startWrite();
     lcd.setAddrWindow(area->x1, area->y1, w, h);
-    lcd.pushImageDMA(area->x1, area->y1, area->x2 - area->x1 + 1, area->y2 - area->y1 + 1, (lgfx::swap565_t *)&color_p->full);
+    lcd.pushImageDMA(area->x1, area->y1, w, h, (lgfx::swap565_t *)&color_p->full);
     lcd.endWrite();
+    uint32_t dt = (uint32_t)(esp_timer_get_time() - t0);
+    display_stats.transfer_us += dt;
+    prof_flush(dt);
+}
+
+// Called by LVGL after every refresh
+static void display_monitor(lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px)
+{
+    LV_UNUSED(disp_drv);
+    display_stats.frames++;
+    display_stats.frame_ms += time;
+    prof_frame(time, px);
+}
 
-    lv_disp_flush_ready(disp);
+// Log GUI task CPU load and render vs. transfer time per frame
+static void display_log_stats(int64_t elapsed_us)
+{
+    display_stats_t &s = display_stats;
+    const char *mode = display_idle ? "idle" : (LV_TICK_CUSTOM ? "tickless" : "periodic");
+    uint32_t load_permille = elapsed_us > 0 ? (uint32_t)(s.busy_us * 1000 / elapsed_us) : 0;
+    ESP_LOGI(TAG, "GUI [%s]: load %lu.%lu%%, %lu wakeups/s",
+             mode, (unsigned long)(load_permille / 10), (unsigned long)(load_permille % 10),
+             (unsigned long)(s.wakeups * 1000000LL / (elapsed_us > 0 ? elapsed_us : 1)));
+    if (!s.frames) return;
+
+    uint32_t frame_us = s.frame_ms * 1000 / s.frames;
+    uint32_t wait_us = s.wait_us / s.frames;
+    uint32_t render_us = frame_us > wait_us ? frame_us - wait_us : 0;
+    ESP_LOGI(TAG, "Display: %lu frames, %lu flushes, %lu px/frame | frame %lu us, render %lu us, "
+             "wait %lu us, transfer %lu us",
+             (unsigned long)s.frames, (unsigned long)s.flushes, (unsigned long)(s.px / s.frames),
+             (unsigned long)frame_us, (unsigned long)render_us, (unsigned long)wait_us,
+             (unsigned long)(s.transfer_us / s.frames));
+}
+
+static void display_stats_poll()
+{
+    if (DISPLAY_STATS_PERIOD_MS == 0) return;
+    int64_t now = esp_timer_get_time();
+    if (display_stats.start_us == 0) {
+        display_stats.start_us = now;
+        return;
+    }
+    if (now - display_stats.start_us < DISPLAY_STATS_PERIOD_MS * 1000LL) return;
+    display_log_stats(now - display_stats.start_us);
+    memset(&display_stats, 0, sizeof(display_stats));
+    display_stats.start_us = now;
+}
+
+// Dim the backlight and stop rendering; data timers keep running and touch is
+// read at DISPLAY_IDLE_READ_PERIOD_MS, so the GUI task is no longer woken every 30 ms
+static void display_idle_enter()
+{
+    if (display_idle) return;
+    display_saved_brightness = lcd.getBrightness();
+    lcd.setBrightness(DISPLAY_IDLE_BRIGHTNESS);
+    if (disp && disp->refr_timer) lv_timer_pause(disp->refr_timer);
+    if (touch_indev && touch_indev->driver->read_timer) {
+        lv_timer_set_period(touch_indev->driver->read_timer, DISPLAY_IDLE_READ_PERIOD_MS);
+    }
+    display_idle = true;
+    ESP_LOGI(TAG, "Display idle, rendering suspended");
+}
+
+static void display_idle_exit()
+{
+    if (!display_idle) return;
+    display_idle = false;
+    if (disp && disp->refr_timer) lv_timer_resume(disp->refr_timer);
+    if (touch_indev && touch_indev->driver->read_timer) {
+        lv_timer_set_period(touch_indev->driver->read_timer, LV_INDEV_DEF_READ_PERIOD);
+    }
+    lv_obj_invalidate(lv_scr_act());  // Objects may have changed while suspended
+    lv_disp_trig_activity(disp);
+    lcd.setBrightness(display_saved_brightness);
+    ESP_LOGI(TAG, "Display awake");
 }
 
+static void display_idle_timer_cb(lv_timer_t *timer)
+{
+    LV_UNUSED(timer);
+    if (!display_idle && lv_disp_get_inactive_time(disp) >= DISPLAY_IDLE_TIMEOUT_MS) {
+        display_idle_enter();
+    }
+}
+
+#if !LV_TICK_CUSTOM
 /* Setting up tick task for lvgl */
 static void lv_tick_task(void *arg)
 {
     (void)arg;
     lv_tick_inc(LV_TICK_PERIOD_MS);
 }
+#endif
+
+// Wake the GUI task early, e.g. after another task changed the UI or posted to the UI bus
+static void gui_wake()
+{
+    if (!g_lvgl_task_handle) return;
+    if (xTaskGetCurrentTaskHandle() != g_lvgl_task_handle) {
+        xTaskNotifyGive(g_lvgl_task_handle);
+    } else if (gui_wake_timer) {
+        lv_timer_ready(gui_wake_timer);     // Posted from an LVGL callback: drain on this handler pass
+    }
+}
 
 static void gui_task(void *args)
 {
     ESP_LOGI(TAG, "Start to run LVGL");
+    uint32_t woken = 0;
     while (1) {
+#if LV_TICK_CUSTOM
+        /* Tickless: run due timers, then sleep until the next one or gui_wake() */
+        uint32_t delay_ms = GUI_MAX_SLEEP_MS;
+        if (pdTRUE == xSemaphoreTake(xGuiSemaphore, portMAX_DELAY)) {
+            int64_t t0 = esp_timer_get_time();
+            if (woken && gui_wake_timer) lv_timer_ready(gui_wake_timer);
+            delay_ms = lv_timer_handler();
+            uint32_t busy = (uint32_t)(esp_timer_get_time() - t0);
+            display_stats.busy_us += busy;
+            display_stats.wakeups++;
+            prof_handler(busy);
+            xSemaphoreGive(xGuiSemaphore);
+        }
+        display_stats_poll();
+
+        if (delay_ms > GUI_MAX_SLEEP_MS) delay_ms = GUI_MAX_SLEEP_MS;  // Also LV_NO_TIMER_READY
+        TickType_t ticks = (delay_ms + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS;
+        woken = ulTaskNotifyTake(pdTRUE, ticks ? ticks : 1);
+#else
         /* Try to take the semaphore, call lvgl related function on success */
         if (pdTRUE == xSemaphoreTake(xGuiSemaphore, pdMS_TO_TICKS(5))) {
+            int64_t t0 = esp_timer_get_time();
             uint32_t delay_ms = lv_timer_handler();
+            uint32_t busy = (uint32_t)(esp_timer_get_time() - t0);
+            display_stats.busy_us += busy;
+            display_stats.wakeups++;
+            prof_handler(busy);
             xSemaphoreGive(xGuiSemaphore);
+            display_stats_poll();
             
             /* Sleep only the remaining time to maintain consistent frame rate */
             if (delay_ms > 0 && delay_ms < 50) {
@@ -221,6 +419,7 @@ static void gui_task(void *args)
         } else {
             vTaskDelay(pdMS_TO_TICKS(1));  /* Small delay if semaphore not available */
         }
+#endif
     }
 }
 
@@ -237,6 +436,7 @@ void lvgl_release(void)
     TaskHandle_t task = xTaskGetCurrentTaskHandle();
     if (g_lvgl_task_handle != task) {
         xSemaphoreGive(xGuiSemaphore);
+        gui_wake();  // Let LVGL pick up the changes without waiting for its next timer
     }
 }
 
@@ -253,6 +453,17 @@ void touchpad_read(lv_indev_drv_t *indev_driver, lv_indev_data_t *data)
     uint16_t touchX, touchY;
     bool touched = lcd.getTouch(&touchX, &touchY);
 
+    // A touch while idle only wakes the display; it's not passed on to the UI
+    if (touched && display_idle) {
+        display_idle_exit();
+        display_idle_swallow = true;
+    }
+    if (display_idle_swallow) {
+        if (!touched) display_idle_swallow = false;
+        data->state = LV_INDEV_STATE_REL;
+        return;
+    }
+
     if (!touched)
     {
         data->state = LV_INDEV_STATE_REL;
@@ -0,0 +1,120 @@
+/**
+ * @file helper_display_flush.hpp
+ * @brief LVGL flush pipeline: render the next band while this one is sent
+ *
+ * display_flush() (LVGL's flush_cb) queues the band and returns. A flush task
+ * pushes it to the panel with the board's push function, which returns once
+ * the transfer has completed, and then calls lv_disp_flush_ready(). With two
+ * draw buffers LVGL renders the next band into the other buffer meanwhile;
+ * display_wait() (LVGL's wait_cb) blocks on a semaphore instead of spinning.
+ * Without the task (single buffer, single core, out of memory) bands are
+ * pushed synchronously from display_flush().
+ *
+ * Nothing here touches the display driver, so the pipeline is tested on the
+ * host against a simulated panel (host_test/test_display_flush.cpp).
+ */
+
+#pragma once
+
+#include "lvgl/lvgl.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+static const char *TAG_FLUSH = "DisplayFlush";
+
+// Push one band to the panel; returns when the transfer has completed
+typedef void (*display_push_cb_t)(const lv_area_t *area, lv_color_t *color_p);
+
+typedef struct {
+    lv_disp_drv_t *drv;
+    lv_area_t area;
+    lv_color_t *color_p;
+} flush_job_t;
+
+// Frame timing and GUI task load, reset every DISPLAY_STATS_PERIOD_MS
+typedef struct {
+    uint32_t frames;
+    uint32_t frame_ms;      // LVGL refresh time (render + waiting for the previous band)
+    uint32_t flushes;
+    uint32_t px;
+    uint64_t wait_us;       // Time LVGL spent blocked on a transfer
+    uint64_t transfer_us;   // Time the DMA transfers took
+    uint32_t wakeups;       // GUI task loop iterations
+    uint64_t busy_us;       // Time spent in lv_timer_handler()
+    int64_t start_us;
+} display_stats_t;
+
+static display_stats_t display_stats;
+
+static display_push_cb_t flush_push = NULL;
+static QueueHandle_t flush_queue = NULL;
+static SemaphoreHandle_t flush_done_sem = NULL;
+
+static void flush_task(void *args)
+{
+    LV_UNUSED(args);
+    flush_job_t job;
+    while (1) {
+        if (xQueueReceive(flush_queue, &job, portMAX_DELAY) != pdTRUE) continue;
+        flush_push(&job.area, job.color_p);
+        lv_disp_flush_ready(job.drv);
+        xSemaphoreGive(flush_done_sem);
+    }
+}
+
+/**
+ * @brief Set the push function and, if `async`, start the flush task
+ *
+ * @param core Core for the flush task; LovyanGFX waits for DMA by polling,
+ *             so it should not be the core LVGL renders on
+ * @return true if bands are flushed asynchronously
+ */
+static bool display_flush_start(display_push_cb_t push, bool async, BaseType_t core)
+{
+    flush_push = push;
+    if (!async) return false;
+
+    flush_queue = xQueueCreate(1, sizeof(flush_job_t));
+    flush_done_sem = xSemaphoreCreateBinary();
+    if (!flush_queue || !flush_done_sem ||
+        xTaskCreatePinnedToCore(flush_task, "lv flush", 1024 * 3, NULL, 4, NULL, core) != pdPASS) {
+        ESP_LOGW(TAG_FLUSH, "Async flush unavailable, flushing synchronously");
+        if (flush_queue) vQueueDelete(flush_queue);
+        if (flush_done_sem) vSemaphoreDelete(flush_done_sem);
+        flush_queue = NULL;
+        flush_done_sem = NULL;
+        return false;
+    }
+    return true;
+}
+
+// Display callback to flush the buffer to screen
+void display_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p)
+{
+    display_stats.flushes++;
+    display_stats.px += (area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1);
+
+    // LVGL only flushes again after flush_ready, so the queue always has room
+    if (flush_queue) {
+        flush_job_t job = { disp, *area, color_p };
+        if (xQueueSend(flush_queue, &job, 0) == pdTRUE) return;
+    }
+
+    flush_push(area, color_p);
+    lv_disp_flush_ready(disp);
+}
+
+// Called by LVGL while it waits for a band to be flushed
+static void display_wait(lv_disp_drv_t *disp_drv)
+{
+    LV_UNUSED(disp_drv);
+    int64_t t0 = esp_timer_get_time();
+    if (flush_done_sem) {
+        xSemaphoreTake(flush_done_sem, pdMS_TO_TICKS(10));
+    }
+    display_stats.wait_us += esp_timer_get_time() - t0;
+}
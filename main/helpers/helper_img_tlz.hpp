@@ -0,0 +1,395 @@
+/**
+ * @file helper_img_tlz.hpp
+ * @brief LVGL image decoder for TLZ compressed images (.tlz)
+ *
+ * TLZ images are split into bands of rows, each compressed as an LZ4 block
+ * (see scripts/img2tlz.py for the converter and the file layout). LVGL asks
+ * the decoder for one line at a time; the decoder inflates the band holding
+ * that line into a small buffer and converts the requested pixels straight
+ * into LVGL's draw line buffer. Only one band lives in RAM per open image,
+ * so a 480x480 background costs ~8 KB of RAM instead of 230 KB.
+ *
+ * Works for files ("F:/bg/dev_bg9.tlz") and for C arrays generated with
+ * `img2tlz.py --c-array` (lv_img_dsc_t with cf LV_IMG_CF_USER_ENCODED_0).
+ */
+
+#pragma once
+
+#include "lvgl/lvgl.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include <string.h>
+
+static const char *TAG_TLZ = "ImgTLZ";
+
+#define TLZ_MAGIC           "TLZ1"
+#define TLZ_HEADER_LEN      12      // Magic + format fields, after the lv_img_header_t
+#define TLZ_FMT_RGB565      0
+#define TLZ_FMT_INDEXED8    1
+#define TLZ_FILTER_DELTA    1       // RGB565 stored as difference to the left pixel
+#define TLZ_FLAG_ALPHA      0x01    // Palette has transparent entries
+
+typedef struct {
+    lv_fs_file_t file;
+    bool is_file;
+    const uint8_t *data;            // Payload of a variable source (starts at the magic)
+    uint8_t pix_fmt;
+    uint8_t filter;
+    uint8_t band_rows;
+    uint8_t flags;
+    uint16_t w;
+    uint16_t h;
+    uint16_t band_count;
+    uint32_t *band_offsets;         // band_count + 1 entries, relative to the magic
+    uint8_t *comp_buf;              // Compressed band read from file
+    uint8_t *band_buf;              // Decoded band, band_rows * w pixels
+    int32_t band_loaded;            // Band currently in band_buf, -1 if none
+    lv_color_t palette[256];
+    lv_opa_t palette_alpha[256];
+} img_tlz_ctx_t;
+
+typedef struct {
+    uint32_t opens;                 // One open/close per image redraw (LVGL image cache is off)
+    uint32_t bands_decoded;
+    uint32_t lines;
+    uint64_t decode_us;             // LZ4 inflate + file reads
+    uint64_t line_us;               // Pixel conversion into the draw buffer
+    uint64_t bytes_read;            // Compressed bytes read from file
+} img_tlz_stats_t;
+
+static img_tlz_stats_t img_tlz_stats;
+
+static inline uint16_t tlz_rd16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+static inline uint32_t tlz_rd32(const uint8_t *p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24); }
+
+static inline lv_color_t tlz_rgb565_to_color(uint16_t v)
+{
+#if LV_COLOR_DEPTH == 16
+    lv_color_t c;
+#if LV_COLOR_16_SWAP
+    c.full = (uint16_t)((v >> 8) | (v << 8));
+#else
+    c.full = v;
+#endif
+    return c;
+#else
+    return lv_color_make((v >> 8) & 0xF8, (v >> 3) & 0xFC, (v << 3) & 0xF8);
+#endif
+}
+
+/**
+ * @brief Decode one LZ4 block
+ * @return Number of bytes written, or -1 if the block is corrupt
+ */
+static int tlz_lz4_decode(const uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_len)
+{
+    const uint8_t *ip = src;
+    const uint8_t *ip_end = src + src_len;
+    uint8_t *op = dst;
+    uint8_t *op_end = dst + dst_len;
+
+    while (ip < ip_end) {
+        uint8_t token = *ip++;
+
+        size_t lit = token >> 4;
+        if (lit == 15) {
+            uint8_t b;
+            do {
+                if (ip >= ip_end) return -1;
+                b = *ip++;
+                lit += b;
+            } while (b == 255);
+        }
+        if (lit > (size_t)(ip_end - ip) || lit > (size_t)(op_end - op)) return -1;
+        memcpy(op, ip, lit);
+        op += lit;
+        ip += lit;
+        if (ip >= ip_end) break;  // Last sequence has no match
+
+        if (ip_end - ip < 2) return -1;
+        size_t offset = tlz_rd16(ip);
+        ip += 2;
+        if (offset == 0 || offset > (size_t)(op - dst)) return -1;
+
+        size_t len = token & 15;
+        if (len == 15) {
+            uint8_t b;
+            do {
+                if (ip >= ip_end) return -1;
+                b = *ip++;
+                len += b;
+            } while (b == 255);
+        }
+        len += 4;
+        if (len > (size_t)(op_end - op)) return -1;
+
+        const uint8_t *match = op - offset;
+        if (offset >= len) {
+            memcpy(op, match, len);
+            op += len;
+        } else {
+            while (len--) *op++ = *match++;  // Overlapping copy repeats the pattern
+        }
+    }
+    return op - dst;
+}
+
+static inline uint8_t tlz_px_size(const img_tlz_ctx_t *ctx)
+{
+    return ctx->pix_fmt == TLZ_FMT_INDEXED8 ? 1 : 2;
+}
+
+// Read the fixed TLZ header that follows the lv_img_header_t
+static bool tlz_parse_header(const uint8_t *hdr, uint8_t *pix_fmt, uint8_t *flags)
+{
+    if (memcmp(hdr, TLZ_MAGIC, 4) != 0) return false;
+    if (hdr[4] != TLZ_FMT_RGB565 && hdr[4] != TLZ_FMT_INDEXED8) return false;
+    if (hdr[6] == 0) return false;  // band rows
+    *pix_fmt = hdr[4];
+    *flags = hdr[7];
+    return true;
+}
+
+static lv_res_t tlz_decoder_info(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header)
+{
+    LV_UNUSED(decoder);
+    uint8_t pix_fmt, flags;
+    lv_img_src_t type = lv_img_src_get_type(src);
+
+    if (type == LV_IMG_SRC_VARIABLE) {
+        const lv_img_dsc_t *dsc = (const lv_img_dsc_t *)src;
+        if (dsc->header.cf != LV_IMG_CF_USER_ENCODED_0 || dsc->data_size < TLZ_HEADER_LEN) return LV_RES_INV;
+        if (!tlz_parse_header(dsc->data, &pix_fmt, &flags)) return LV_RES_INV;
+        *header = dsc->header;
+    } else if (type == LV_IMG_SRC_FILE) {
+        if (strcmp(lv_fs_get_ext((const char *)src), "tlz") != 0) return LV_RES_INV;
+
+        lv_fs_file_t f;
+        if (lv_fs_open(&f, (const char *)src, LV_FS_MODE_RD) != LV_FS_RES_OK) return LV_RES_INV;
+        uint8_t buf[sizeof(lv_img_header_t) + TLZ_HEADER_LEN];
+        uint32_t rn = 0;
+        lv_fs_res_t res = lv_fs_read(&f, buf, sizeof(buf), &rn);
+        lv_fs_close(&f);
+        if (res != LV_FS_RES_OK || rn != sizeof(buf)) return LV_RES_INV;
+
+        memcpy(header, buf, sizeof(lv_img_header_t));
+        if (header->cf != LV_IMG_CF_USER_ENCODED_0) return LV_RES_INV;
+        if (!tlz_parse_header(buf + sizeof(lv_img_header_t), &pix_fmt, &flags)) return LV_RES_INV;
+    } else {
+        return LV_RES_INV;
+    }
+
+    // Hand LVGL decoded pixels: plain colors, plus alpha if the palette needs it
+    header->cf = (pix_fmt == TLZ_FMT_INDEXED8 && (flags & TLZ_FLAG_ALPHA))
+                 ? LV_IMG_CF_TRUE_COLOR_ALPHA : LV_IMG_CF_TRUE_COLOR;
+    return LV_RES_OK;
+}
+
+// Read `len` bytes at payload offset `pos` (relative to the magic)
+static bool tlz_read(img_tlz_ctx_t *ctx, uint32_t pos, void *dst, uint32_t len)
+{
+    if (!ctx->is_file) {
+        memcpy(dst, ctx->data + pos, len);
+        return true;
+    }
+    uint32_t rn = 0;
+    if (lv_fs_seek(&ctx->file, sizeof(lv_img_header_t) + pos, LV_FS_SEEK_SET) != LV_FS_RES_OK) return false;
+    if (lv_fs_read(&ctx->file, dst, len, &rn) != LV_FS_RES_OK || rn != len) return false;
+    img_tlz_stats.bytes_read += len;
+    return true;
+}
+
+static void tlz_ctx_free(img_tlz_ctx_t *ctx)
+{
+    if (!ctx) return;
+    if (ctx->is_file) lv_fs_close(&ctx->file);
+    free(ctx->band_offsets);
+    free(ctx->comp_buf);
+    free(ctx->band_buf);
+    free(ctx);
+}
+
+static lv_res_t tlz_decoder_open(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc)
+{
+    LV_UNUSED(decoder);
+    img_tlz_ctx_t *ctx = (img_tlz_ctx_t *)calloc(1, sizeof(img_tlz_ctx_t));
+    if (!ctx) return LV_RES_INV;
+    ctx->band_loaded = -1;
+
+    if (dsc->src_type == LV_IMG_SRC_FILE) {
+        if (lv_fs_open(&ctx->file, (const char *)dsc->src, LV_FS_MODE_RD) != LV_FS_RES_OK) {
+            free(ctx);
+            return LV_RES_INV;
+        }
+        ctx->is_file = true;
+    } else {
+        ctx->data = ((const lv_img_dsc_t *)dsc->src)->data;
+    }
+
+    uint8_t hdr[TLZ_HEADER_LEN];
+    if (!tlz_read(ctx, 0, hdr, sizeof(hdr))) {
+        tlz_ctx_free(ctx);
+        return LV_RES_INV;
+    }
+    ctx->pix_fmt = hdr[4];
+    ctx->filter = hdr[5];
+    ctx->band_rows = hdr[6];
+    ctx->flags = hdr[7];
+    uint16_t palette_count = tlz_rd16(hdr + 8);
+    ctx->w = dsc->header.w;
+    ctx->h = dsc->header.h;
+    ctx->band_count = (ctx->h + ctx->band_rows - 1) / ctx->band_rows;
+
+    uint32_t pos = TLZ_HEADER_LEN;
+    if (palette_count > 256) {
+        tlz_ctx_free(ctx);
+        return LV_RES_INV;
+    }
+    if (palette_count) {
+        // LVGL palette entries are B, G, R, A
+        uint8_t pal[256 * 4];
+        if (!tlz_read(ctx, pos, pal, palette_count * 4)) {
+            tlz_ctx_free(ctx);
+            return LV_RES_INV;
+        }
+        for (uint16_t i = 0; i < palette_count; i++) {
+            ctx->palette[i] = lv_color_make(pal[i * 4 + 2], pal[i * 4 + 1], pal[i * 4]);
+            ctx->palette_alpha[i] = pal[i * 4 + 3];
+        }
+        pos += palette_count * 4;
+    }
+
+    const uint32_t offsets_len = (ctx->band_count + 1) * sizeof(uint32_t);
+    uint8_t *raw_offsets = (uint8_t *)malloc(offsets_len);
+    ctx->band_offsets = (uint32_t *)malloc(offsets_len);
+    if (!raw_offsets || !ctx->band_offsets || !tlz_read(ctx, pos, raw_offsets, offsets_len)) {
+        free(raw_offsets);
+        tlz_ctx_free(ctx);
+        return LV_RES_INV;
+    }
+    uint32_t max_band = 0;
+    for (uint16_t i = 0; i <= ctx->band_count; i++) {
+        ctx->band_offsets[i] = tlz_rd32(raw_offsets + i * 4);
+        if (i > 0 && ctx->band_offsets[i] - ctx->band_offsets[i - 1] > max_band) {
+            max_band = ctx->band_offsets[i] - ctx->band_offsets[i - 1];
+        }
+    }
+    free(raw_offsets);
+
+    ctx->band_buf = (uint8_t *)malloc((size_t)ctx->w * ctx->band_rows * tlz_px_size(ctx));
+    if (ctx->is_file) ctx->comp_buf = (uint8_t *)malloc(max_band);
+    if (!ctx->band_buf || (ctx->is_file && !ctx->comp_buf)) {
+        ESP_LOGE(TAG_TLZ, "Out of memory opening %dx%d image", ctx->w, ctx->h);
+        tlz_ctx_free(ctx);
+        return LV_RES_INV;
+    }
+
+    dsc->user_data = ctx;
+    dsc->img_data = NULL;  // Pixels are delivered line by line through read_line
+    img_tlz_stats.opens++;
+    return LV_RES_OK;
+}
+
+static bool tlz_load_band(img_tlz_ctx_t *ctx, uint16_t band)
+{
+    int64_t t0 = esp_timer_get_time();
+    const uint32_t start = ctx->band_offsets[band];
+    const uint32_t comp_len = ctx->band_offsets[band + 1] - start;
+    const uint16_t rows = LV_MIN(ctx->band_rows, ctx->h - band * ctx->band_rows);
+    const size_t raw_len = (size_t)ctx->w * rows * tlz_px_size(ctx);
+
+    const uint8_t *comp;
+    if (ctx->is_file) {
+        if (!tlz_read(ctx, start, ctx->comp_buf, comp_len)) return false;
+        comp = ctx->comp_buf;
+    } else {
+        comp = ctx->data + start;
+    }
+
+    if (tlz_lz4_decode(comp, comp_len, ctx->band_buf, raw_len) != (int)raw_len) {
+        ESP_LOGE(TAG_TLZ, "Corrupt band %d", band);
+        ctx->band_loaded = -1;
+        return false;
+    }
+
+    if (ctx->filter == TLZ_FILTER_DELTA && ctx->pix_fmt == TLZ_FMT_RGB565) {
+        uint16_t *px = (uint16_t *)ctx->band_buf;
+        for (uint16_t r = 0; r < rows; r++, px += ctx->w) {
+            for (uint16_t x = 1; x < ctx->w; x++) px[x] += px[x - 1];
+        }
+    }
+
+    ctx->band_loaded = band;
+    img_tlz_stats.bands_decoded++;
+    img_tlz_stats.decode_us += esp_timer_get_time() - t0;
+    return true;
+}
+
+static lv_res_t tlz_decoder_read_line(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc,
+                                      lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t *buf)
+{
+    LV_UNUSED(decoder);
+    img_tlz_ctx_t *ctx = (img_tlz_ctx_t *)dsc->user_data;
+    if (!ctx || y < 0 || y >= ctx->h || x < 0 || x + len > ctx->w) return LV_RES_INV;
+
+    uint16_t band = y / ctx->band_rows;
+    if (band != ctx->band_loaded && !tlz_load_band(ctx, band)) return LV_RES_INV;
+
+    int64_t t0 = esp_timer_get_time();
+    const size_t row = (size_t)(y - band * ctx->band_rows) * ctx->w;
+
+    if (ctx->pix_fmt == TLZ_FMT_INDEXED8) {
+        const uint8_t *src = ctx->band_buf + row + x;
+        if (dsc->header.cf == LV_IMG_CF_TRUE_COLOR_ALPHA) {
+            for (lv_coord_t i = 0; i < len; i++, buf += LV_IMG_PX_SIZE_ALPHA_BYTE) {
+                memcpy(buf, &ctx->palette[src[i]], sizeof(lv_color_t));
+                buf[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = ctx->palette_alpha[src[i]];
+            }
+        } else {
+            lv_color_t *dst = (lv_color_t *)buf;
+            for (lv_coord_t i = 0; i < len; i++) dst[i] = ctx->palette[src[i]];
+        }
+    } else {
+        const uint16_t *src = (const uint16_t *)ctx->band_buf + row + x;
+        lv_color_t *dst = (lv_color_t *)buf;
+        for (lv_coord_t i = 0; i < len; i++) dst[i] = tlz_rgb565_to_color(src[i]);
+    }
+
+    img_tlz_stats.lines++;
+    img_tlz_stats.line_us += esp_timer_get_time() - t0;
+    return LV_RES_OK;
+}
+
+static void tlz_decoder_close(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc)
+{
+    LV_UNUSED(decoder);
+    tlz_ctx_free((img_tlz_ctx_t *)dsc->user_data);
+    dsc->user_data = NULL;
+}
+
+/**
+ * @brief Register the TLZ decoder with LVGL (call once after lv_init)
+ */
+static void img_tlz_init()
+{
+    lv_img_decoder_t *dec = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(dec, tlz_decoder_info);
+    lv_img_decoder_set_open_cb(dec, tlz_decoder_open);
+    lv_img_decoder_set_read_line_cb(dec, tlz_decoder_read_line);
+    lv_img_decoder_set_close_cb(dec, tlz_decoder_close);
+}
+
+/**
+ * @brief Log decode cost; one "open" is one redraw of an image
+ */
+static void img_tlz_log_stats()
+{
+    const img_tlz_stats_t &s = img_tlz_stats;
+    ESP_LOGI(TAG_TLZ, "opens=%lu bands=%lu lines=%lu read=%llu KB",
+             (unsigned long)s.opens, (unsigned long)s.bands_decoded, (unsigned long)s.lines,
+             (unsigned long long)(s.bytes_read / 1024));
+    ESP_LOGI(TAG_TLZ, "inflate %llu us/band, convert %llu us/line, %llu us per redraw",
+             s.bands_decoded ? (unsigned long long)(s.decode_us / s.bands_decoded) : 0ULL,
+             s.lines ? (unsigned long long)(s.line_us / s.lines) : 0ULL,
+             s.opens ? (unsigned long long)((s.decode_us + s.line_us) / s.opens) : 0ULL);
+}
@@ -0,0 +1,149 @@
+/**
+ * @file helper_io_worker.hpp
+ * @brief Background worker for blocking I/O (files, HTTP, JSON decode)
+ *
+ * LVGL timer callbacks must not block: a single fopen() on SPIFFS or an HTTP
+ * request stalls rendering and touch for its whole duration. Callbacks submit
+ * a job instead; the worker task runs its work function, then the job is
+ * handed back to the LVGL task (through the UI IPC queue) where its done
+ * function applies the result to widgets.
+ *
+ * A job is a context pointer plus three functions:
+ *   work(ctx)     worker task, may block, must not touch LVGL
+ *   done(ctx)     LVGL task, keep it short (the IPC drain has a time budget)
+ *   release(ctx)  always called last, on whichever task finishes with the job
+ */
+
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "helper_profiler.hpp"
+
+static const char *TAG_IO = "IOWorker";
+
+#define IO_QUEUE_LEN        16
+#define IO_TASK_STACK       (1024 * 8)  // HTTP client + cJSON
+#define IO_TASK_PRIO        2           // Below the GUI task
+#define IO_TASK_CORE        0
+#define IO_DONE_WAIT_MS     1000        // How long a completion waits for room in the UI queue
+
+typedef void (*io_fn_t)(void *ctx);
+
+typedef struct {
+    io_fn_t work;
+    io_fn_t done;       // Optional
+    io_fn_t release;    // Optional
+    void *ctx;
+    const char *name;
+} io_job_t;
+
+// Hands a finished job to the LVGL task; set by the UI IPC
+typedef bool (*io_done_sink_t)(const io_job_t &job, TickType_t wait);
+
+typedef struct {
+    uint32_t submitted;
+    uint32_t rejected;      // Job queue full
+    uint32_t completed;
+    uint32_t dropped;       // Completion could not be delivered
+    uint32_t max_work_us;
+} io_stats_t;
+
+static QueueHandle_t io_queue = NULL;
+static TaskHandle_t io_task_handle = NULL;
+static io_done_sink_t io_done_sink = NULL;
+static io_stats_t io_stats = {};
+static prof_slot_t *prof_slot_io = nullptr;
+
+static void io_release(const io_job_t &job)
+{
+    if (job.release) job.release(job.ctx);
+}
+
+/**
+ * @brief Run done() and release(); called by the LVGL task for delivered jobs
+ */
+static void io_complete(const io_job_t &job)
+{
+    if (job.done) job.done(job.ctx);
+    io_release(job);
+    io_stats.completed++;
+}
+
+static void io_task(void *arg)
+{
+    (void)arg;
+    io_job_t job;
+    while (1) {
+        if (xQueueReceive(io_queue, &job, portMAX_DELAY) != pdTRUE) continue;
+
+        int64_t t0 = esp_timer_get_time();
+        job.work(job.ctx);
+        uint32_t us = (uint32_t)(esp_timer_get_time() - t0);
+        prof_record(prof_slot_io, us);
+        if (us > io_stats.max_work_us) io_stats.max_work_us = us;
+        ESP_LOGD(TAG_IO, "%s: %lu us", job.name ? job.name : "job", (unsigned long)us);
+
+        if (!job.done) {
+            io_release(job);
+            io_stats.completed++;
+        } else if (!io_done_sink || !io_done_sink(job, pdMS_TO_TICKS(IO_DONE_WAIT_MS))) {
+            ESP_LOGW(TAG_IO, "%s: UI queue full, result dropped", job.name ? job.name : "job");
+            io_release(job);
+            io_stats.dropped++;
+        }
+    }
+}
+
+static esp_err_t io_worker_init()
+{
+    if (io_queue) return ESP_OK;
+
+    io_queue = xQueueCreate(IO_QUEUE_LEN, sizeof(io_job_t));
+    if (!io_queue) return ESP_ERR_NO_MEM;
+
+    prof_slot_io = prof_slot("io_worker");
+    if (xTaskCreatePinnedToCore(io_task, "io worker", IO_TASK_STACK, NULL,
+                                IO_TASK_PRIO, &io_task_handle, IO_TASK_CORE) != pdPASS) {
+        vQueueDelete(io_queue);
+        io_queue = NULL;
+        ESP_LOGE(TAG_IO, "Failed to start worker task");
+        return ESP_FAIL;
+    }
+    ESP_LOGI(TAG_IO, "I/O worker started (queue %d)", IO_QUEUE_LEN);
+    return ESP_OK;
+}
+
+static void io_worker_set_sink(io_done_sink_t sink)
+{
+    io_done_sink = sink;
+}
+
+/**
+ * @brief Queue a job without blocking
+ *
+ * On failure release(ctx) has already been called, so callers can simply
+ * allocate, submit and forget.
+ */
+static bool io_submit(const char *name, io_fn_t work, io_fn_t done, io_fn_t release, void *ctx)
+{
+    io_job_t job = { work, done, release, ctx, name };
+    if (!io_queue || xQueueSendToBack(io_queue, &job, 0) != pdPASS) {
+        ESP_LOGW(TAG_IO, "%s: job queue full", name);
+        io_release(job);
+        io_stats.rejected++;
+        return false;
+    }
+    io_stats.submitted++;
+    return true;
+}
+
+// release() for contexts allocated with `new T`
+template <typename T>
+static void io_delete(void *ctx)
+{
+    delete static_cast<T *>(ctx);
+}
@@ -0,0 +1,411 @@
+/**
+ * @file helper_lv_fs_cache.hpp
+ * @brief Block cache with read-ahead for the LVGL filesystem drives
+ *
+ * LVGL registers F: (SPIFFS, lv_fs_posix) and S: (SD card, lv_fs_stdio) with
+ * their own cache disabled, so every lv_fs_read() of the image decoders and
+ * gifdec (often 1-16 bytes) turns into a VFS call. SPIFFS in particular is
+ * slow at small random reads.
+ *
+ * lv_fs_cache_init() wraps the callbacks of those drivers. Files opened for
+ * reading are served from fixed-size blocks kept in one LRU pool shared by
+ * all drives (PSRAM when available). A miss reads the block from the drive;
+ * when the file is being read sequentially the next blocks are read in the
+ * same pass (read-ahead). Reads of a whole block or more (TLZ bands) bypass the cache.
+ * Files opened for writing go straight to the drive and drop their cached
+ * blocks.
+ *
+ * Blocks are keyed by drive, path and file size. Code that rewrites a file
+ * with fopen() (same size) must call lv_fs_cache_invalidate().
+ *
+ * Like the rest of lv_fs, the wrapper runs under the LVGL lock.
+ * Set TUX_FS_CACHE_TRACE to log every access; scripts/fs_cache_bench.py
+ * replays such a log on the host to tune block size and read-ahead.
+ */
+
+#pragma once
+
+#include "lvgl/lvgl.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include <string.h>
+#include "helper_profiler.hpp"
+
+static const char *TAG_FSC = "LvFsCache";
+
+#ifdef CONFIG_TUX_FS_CACHE_BLOCK_SIZE
+#define FS_CACHE_BLOCK_SIZE     CONFIG_TUX_FS_CACHE_BLOCK_SIZE
+#define FS_CACHE_BLOCKS         CONFIG_TUX_FS_CACHE_BLOCKS
+#define FS_CACHE_READAHEAD      CONFIG_TUX_FS_CACHE_READAHEAD
+#else
+#define FS_CACHE_BLOCK_SIZE     4096
+#define FS_CACHE_BLOCKS         32
+#define FS_CACHE_READAHEAD      2
+#endif
+#define FS_CACHE_BLOCKS_NO_PSRAM 4      // Pool size when it has to come from internal RAM
+#define FS_CACHE_BYPASS_BLOCKS  1       // Reads at least this many blocks long skip the cache
+#define FS_CACHE_DRIVES         2
+
+typedef struct {
+    uint32_t file_key;              // Path and size
+    uint32_t path_hash;             // Path only, for invalidation
+    uint32_t block;
+    uint32_t last_use;
+    uint32_t len;                   // Valid bytes (short for the last block of a file)
+    uint8_t *data;
+    bool valid;
+    bool prefetched;                // Read ahead and not used yet
+} fs_cache_block_t;
+
+typedef struct {
+    void *inner;                    // File handle of the wrapped driver
+    lv_fs_drv_t *drv;               // Wrapped driver (copy of the original callbacks)
+    uint32_t path_hash;
+    uint32_t key;
+    uint32_t pos;
+    uint32_t size;
+    uint32_t last_block;            // Last block touched, for sequential detection
+    bool bypass;                    // Opened for writing
+} fs_cache_file_t;
+
+typedef struct {
+    uint32_t hits;                  // Block lookups served from the pool
+    uint32_t misses;
+    uint32_t readahead;             // Blocks read ahead of a sequential reader
+    uint32_t readahead_used;        // ... and later hit
+    uint32_t bypass_reads;          // Large reads passed through
+    uint32_t drive_reads;           // Read calls into the wrapped drivers
+    uint64_t drive_bytes;
+    uint32_t invalidations;
+} fs_cache_stats_t;
+
+static fs_cache_block_t *fs_cache_pool = NULL;
+static uint16_t fs_cache_block_count = 0;
+static bool fs_cache_in_psram = false;
+static uint32_t fs_cache_clock = 0;
+static fs_cache_stats_t fs_cache_stats;
+static lv_fs_drv_t fs_cache_inner[FS_CACHE_DRIVES];
+static uint8_t fs_cache_inner_count = 0;
+
+// FNV-1a over drive letter and path
+static uint32_t fs_cache_path_hash(char letter, const char *path)
+{
+    uint32_t h = 2166136261u ^ (uint8_t)letter;
+    h *= 16777619u;
+    for (; *path; path++) {
+        h ^= (uint8_t)*path;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static inline uint32_t fs_cache_file_key(uint32_t path_hash, uint32_t size)
+{
+    return path_hash ^ (size * 0x9E3779B1u);
+}
+
+static lv_fs_drv_t *fs_cache_inner_drv(const lv_fs_drv_t *drv)
+{
+    for (uint8_t i = 0; i < fs_cache_inner_count; i++) {
+        if (fs_cache_inner[i].letter == drv->letter) return &fs_cache_inner[i];
+    }
+    return NULL;
+}
+
+static fs_cache_block_t *fs_cache_find(uint32_t key, uint32_t block)
+{
+    for (uint16_t i = 0; i < fs_cache_block_count; i++) {
+        fs_cache_block_t &b = fs_cache_pool[i];
+        if (b.valid && b.file_key == key && b.block == block) return &b;
+    }
+    return NULL;
+}
+
+static fs_cache_block_t *fs_cache_victim()
+{
+    fs_cache_block_t *victim = &fs_cache_pool[0];
+    for (uint16_t i = 0; i < fs_cache_block_count; i++) {
+        fs_cache_block_t &b = fs_cache_pool[i];
+        if (!b.valid) return &b;
+        if (b.last_use < victim->last_use) victim = &b;
+    }
+    return victim;
+}
+
+static void lv_fs_cache_invalidate_hash(uint32_t path_hash)
+{
+    for (uint16_t i = 0; i < fs_cache_block_count; i++) {
+        fs_cache_block_t &b = fs_cache_pool[i];
+        if (b.valid && b.path_hash == path_hash) {
+            b.valid = false;
+            fs_cache_stats.invalidations++;
+        }
+    }
+}
+
+/**
+ * @brief Read `block` from the drive, plus read-ahead blocks if sequential
+ * @return Slot holding `block`, or NULL on a read error
+ */
+static fs_cache_block_t *fs_cache_fill(fs_cache_file_t *f, uint32_t block, bool sequential)
+{
+    const uint32_t blocks_in_file = (f->size + FS_CACHE_BLOCK_SIZE - 1) / FS_CACHE_BLOCK_SIZE;
+    uint32_t count = 1 + (sequential ? FS_CACHE_READAHEAD : 0);
+    if (count > fs_cache_block_count) count = fs_cache_block_count;
+    if (block + count > blocks_in_file) count = blocks_in_file - block;
+
+    if (f->drv->seek_cb(f->drv, f->inner, block * FS_CACHE_BLOCK_SIZE, LV_FS_SEEK_SET) != LV_FS_RES_OK) {
+        return NULL;
+    }
+
+    fs_cache_block_t *first = NULL;
+    for (uint32_t i = 0; i < count; i++) {
+        if (i > 0 && fs_cache_find(f->key, block + i)) break;    // Already cached, stop reading ahead
+
+        fs_cache_block_t *slot = fs_cache_victim();
+        slot->valid = false;
+        const uint32_t want = LV_MIN((uint32_t)FS_CACHE_BLOCK_SIZE, f->size - (block + i) * FS_CACHE_BLOCK_SIZE);
+        uint32_t got = 0;
+        lv_fs_res_t res = f->drv->read_cb(f->drv, f->inner, slot->data, want, &got);
+        fs_cache_stats.drive_reads++;
+        fs_cache_stats.drive_bytes += got;
+        if (res != LV_FS_RES_OK || got != want) {
+            ESP_LOGW(TAG_FSC, "Short read at block %lu (%lu of %lu bytes)",
+                     (unsigned long)(block + i), (unsigned long)got, (unsigned long)want);
+            break;
+        }
+
+        slot->file_key = f->key;
+        slot->path_hash = f->path_hash;
+        slot->block = block + i;
+        slot->len = got;
+        // Read-ahead blocks start older than the requested one, so unused ones go first
+        slot->last_use = i == 0 ? ++fs_cache_clock : fs_cache_clock - 1;
+        slot->valid = true;
+        slot->prefetched = i > 0;
+        if (i == 0) first = slot;
+        else fs_cache_stats.readahead++;
+    }
+    return first;
+}
+
+/* Wrapped driver callbacks */
+
+static void *fs_cache_open(lv_fs_drv_t *drv, const char *path, lv_fs_mode_t mode)
+{
+    lv_fs_drv_t *inner = fs_cache_inner_drv(drv);
+    if (!inner) return NULL;
+    void *fd = inner->open_cb(inner, path, mode);
+    if (fd == NULL || fd == (void *)(-1)) return NULL;
+
+    fs_cache_file_t *f = (fs_cache_file_t *)calloc(1, sizeof(fs_cache_file_t));
+    if (!f) {
+        inner->close_cb(inner, fd);
+        return NULL;
+    }
+    f->inner = fd;
+    f->drv = inner;
+    f->last_block = UINT32_MAX;     // Block 0 counts as sequential
+    f->path_hash = fs_cache_path_hash(drv->letter, path);
+
+    if (mode & LV_FS_MODE_WR) {
+        f->bypass = true;
+        lv_fs_cache_invalidate_hash(f->path_hash);
+    } else if (inner->seek_cb(inner, fd, 0, LV_FS_SEEK_END) != LV_FS_RES_OK ||
+               inner->tell_cb(inner, fd, &f->size) != LV_FS_RES_OK ||
+               inner->seek_cb(inner, fd, 0, LV_FS_SEEK_SET) != LV_FS_RES_OK) {
+        f->bypass = true;           // Size unknown: serve uncached
+    }
+    f->key = fs_cache_file_key(f->path_hash, f->size);
+
+#ifdef CONFIG_TUX_FS_CACHE_TRACE
+    ESP_LOGI(TAG_FSC, "FSTRACE open %p %c:%s %lu%s", f, drv->letter, path, (unsigned long)f->size,
+             f->bypass ? " bypass" : "");
+#endif
+    return f;
+}
+
+static lv_fs_res_t fs_cache_close(lv_fs_drv_t *drv, void *file_p)
+{
+    LV_UNUSED(drv);
+    fs_cache_file_t *f = (fs_cache_file_t *)file_p;
+#ifdef CONFIG_TUX_FS_CACHE_TRACE
+    ESP_LOGI(TAG_FSC, "FSTRACE close %p", f);
+#endif
+    lv_fs_res_t res = f->drv->close_cb(f->drv, f->inner);
+    free(f);
+    return res;
+}
+
+static lv_fs_res_t fs_cache_read(lv_fs_drv_t *drv, void *file_p, void *buf, uint32_t btr, uint32_t *br)
+{
+    LV_UNUSED(drv);
+    fs_cache_file_t *f = (fs_cache_file_t *)file_p;
+    if (f->bypass || !fs_cache_pool) return f->drv->read_cb(f->drv, f->inner, buf, btr, br);
+
+#ifdef CONFIG_TUX_FS_CACHE_TRACE
+    ESP_LOGI(TAG_FSC, "FSTRACE read %p %lu %lu", f, (unsigned long)f->pos, (unsigned long)btr);
+#endif
+    *br = 0;
+    if (f->pos >= f->size) return LV_FS_RES_OK;
+    btr = LV_MIN(btr, f->size - f->pos);
+
+    if (btr >= FS_CACHE_BYPASS_BLOCKS * FS_CACHE_BLOCK_SIZE) {
+        lv_fs_res_t res = f->drv->seek_cb(f->drv, f->inner, f->pos, LV_FS_SEEK_SET);
+        if (res == LV_FS_RES_OK) res = f->drv->read_cb(f->drv, f->inner, buf, btr, br);
+        fs_cache_stats.bypass_reads++;
+        fs_cache_stats.drive_reads++;
+        fs_cache_stats.drive_bytes += *br;
+        f->pos += *br;
+        if (*br) f->last_block = (f->pos - 1) / FS_CACHE_BLOCK_SIZE;
+        return res;
+    }
+
+    uint8_t *dst = (uint8_t *)buf;
+    while (btr) {
+        const uint32_t block = f->pos / FS_CACHE_BLOCK_SIZE;
+        const uint32_t ofs = f->pos % FS_CACHE_BLOCK_SIZE;
+        fs_cache_block_t *b = fs_cache_find(f->key, block);
+        if (b) {
+            if (b->prefetched) fs_cache_stats.readahead_used++;
+            b->prefetched = false;
+            b->last_use = ++fs_cache_clock;
+            fs_cache_stats.hits++;
+        } else {
+            fs_cache_stats.misses++;
+            b = fs_cache_fill(f, block, block == f->last_block + 1);
+            if (!b) return *br ? LV_FS_RES_OK : LV_FS_RES_HW_ERR;
+        }
+        f->last_block = block;
+
+        const uint32_t n = LV_MIN(btr, b->len - ofs);
+        if (n == 0) break;
+        memcpy(dst, b->data + ofs, n);
+        dst += n;
+        btr -= n;
+        *br += n;
+        f->pos += n;
+    }
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_cache_write(lv_fs_drv_t *drv, void *file_p, const void *buf, uint32_t btw, uint32_t *bw)
+{
+    LV_UNUSED(drv);
+    fs_cache_file_t *f = (fs_cache_file_t *)file_p;
+    if (!f->bypass || !f->drv->write_cb) return LV_FS_RES_DENIED;
+    return f->drv->write_cb(f->drv, f->inner, buf, btw, bw);
+}
+
+static lv_fs_res_t fs_cache_seek(lv_fs_drv_t *drv, void *file_p, uint32_t pos, lv_fs_whence_t whence)
+{
+    LV_UNUSED(drv);
+    fs_cache_file_t *f = (fs_cache_file_t *)file_p;
+    if (f->bypass || !fs_cache_pool) return f->drv->seek_cb(f->drv, f->inner, pos, whence);
+
+    // The drive position is only set when a block is read
+    switch (whence) {
+        case LV_FS_SEEK_SET: f->pos = pos; break;
+        case LV_FS_SEEK_CUR: f->pos += pos; break;
+        case LV_FS_SEEK_END: f->pos = f->size + pos; break;
+        default: return LV_FS_RES_INV_PARAM;
+    }
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_cache_tell(lv_fs_drv_t *drv, void *file_p, uint32_t *pos_p)
+{
+    LV_UNUSED(drv);
+    fs_cache_file_t *f = (fs_cache_file_t *)file_p;
+    if (f->bypass || !fs_cache_pool) return f->drv->tell_cb(f->drv, f->inner, pos_p);
+    *pos_p = f->pos;
+    return LV_FS_RES_OK;
+}
+
+/* Public API */
+
+/**
+ * @brief Drop cached blocks of one file ("F:/bg/dev_bg9.tlz")
+ */
+static void lv_fs_cache_invalidate(const char *lv_path)
+{
+    if (!lv_path || !lv_path[0] || lv_path[1] != ':') return;
+    lv_fs_cache_invalidate_hash(fs_cache_path_hash(lv_path[0], lv_path + 2));
+}
+
+// /api/perf: cache use
+static void lv_fs_cache_stats_json(cJSON *root)
+{
+    const fs_cache_stats_t &s = fs_cache_stats;
+    cJSON *fsc = cJSON_AddObjectToObject(root, "fs_cache");
+    cJSON_AddNumberToObject(fsc, "block_size", FS_CACHE_BLOCK_SIZE);
+    cJSON_AddNumberToObject(fsc, "blocks", fs_cache_block_count);
+    cJSON_AddNumberToObject(fsc, "hits", s.hits);
+    cJSON_AddNumberToObject(fsc, "misses", s.misses);
+    cJSON_AddNumberToObject(fsc, "readahead", s.readahead);
+    cJSON_AddNumberToObject(fsc, "readahead_used", s.readahead_used);
+    cJSON_AddNumberToObject(fsc, "bypass_reads", s.bypass_reads);
+    cJSON_AddNumberToObject(fsc, "drive_reads", s.drive_reads);
+    cJSON_AddNumberToObject(fsc, "drive_kb", (double)(s.drive_bytes / 1024));
+    cJSON_AddNumberToObject(fsc, "invalidations", s.invalidations);
+}
+
+static void lv_fs_cache_log_stats()
+{
+    const fs_cache_stats_t &s = fs_cache_stats;
+    const uint32_t lookups = s.hits + s.misses;
+    ESP_LOGI(TAG_FSC, "hits=%lu misses=%lu (%lu%%) readahead=%lu/%lu used, drive reads=%lu %llu KB, bypass=%lu",
+             (unsigned long)s.hits, (unsigned long)s.misses,
+             lookups ? (unsigned long)(s.hits * 100 / lookups) : 0UL,
+             (unsigned long)s.readahead_used, (unsigned long)s.readahead,
+             (unsigned long)s.drive_reads, (unsigned long long)(s.drive_bytes / 1024),
+             (unsigned long)s.bypass_reads);
+}
+
+/**
+ * @brief Put the block cache in front of the F: and S: drives
+ *
+ * Call once after lv_init(), before anything is opened through lv_fs.
+ */
+static esp_err_t lv_fs_cache_init()
+{
+    if (fs_cache_pool || FS_CACHE_BLOCKS == 0) return ESP_OK;
+
+    uint16_t count = FS_CACHE_BLOCKS;
+    uint8_t *data = (uint8_t *)heap_caps_malloc((size_t)count * FS_CACHE_BLOCK_SIZE,
+                                                MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    fs_cache_in_psram = data != NULL;
+    if (!data) {
+        count = LV_MIN(count, FS_CACHE_BLOCKS_NO_PSRAM);
+        data = (uint8_t *)heap_caps_malloc((size_t)count * FS_CACHE_BLOCK_SIZE, MALLOC_CAP_8BIT);
+    }
+    fs_cache_pool = (fs_cache_block_t *)calloc(count, sizeof(fs_cache_block_t));
+    if (!data || !fs_cache_pool) {
+        ESP_LOGE(TAG_FSC, "No memory for %u blocks, drives stay uncached", count);
+        free(data);
+        free(fs_cache_pool);
+        fs_cache_pool = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    for (uint16_t i = 0; i < count; i++) fs_cache_pool[i].data = data + (size_t)i * FS_CACHE_BLOCK_SIZE;
+    fs_cache_block_count = count;
+
+    const char letters[FS_CACHE_DRIVES] = { 'F', 'S' };
+    for (char letter : letters) {
+        lv_fs_drv_t *drv = lv_fs_get_drv(letter);
+        if (!drv || drv->open_cb == fs_cache_open) continue;
+        fs_cache_inner[fs_cache_inner_count++] = *drv;
+        drv->open_cb = fs_cache_open;
+        drv->close_cb = fs_cache_close;
+        drv->read_cb = fs_cache_read;
+        drv->write_cb = fs_cache_write;
+        drv->seek_cb = fs_cache_seek;
+        drv->tell_cb = fs_cache_tell;
+        drv->cache_size = 0;        // lv_fs's own per-file buffer would sit on top of ours
+    }
+
+    prof_add_json(lv_fs_cache_stats_json);
+    ESP_LOGI(TAG_FSC, "%u x %u byte blocks (%s), read-ahead %d, %u drives", count, FS_CACHE_BLOCK_SIZE,
+             fs_cache_in_psram ? "PSRAM" : "internal", FS_CACHE_READAHEAD, fs_cache_inner_count);
+    return ESP_OK;
+}
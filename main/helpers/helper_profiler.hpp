@@ -0,0 +1,290 @@
+/**
+ * @file helper_profiler.hpp
+ * @brief Render-time profiler and on-screen performance HUD
+ *
+ * Records a duration histogram per instrumented callback (lv_timer callbacks,
+ * lv_timer_handler(), frames and display flushes), frames rendered and the
+ * invalidated pixel area. The data is shown in an optional overlay on
+ * lv_layer_top() and exported as JSON (WebServer: GET /api/perf).
+ *
+ * Instrument a callback by putting PROF_SCOPE("name") at its top.
+ */
+
+#pragma once
+
+#include "lvgl/lvgl.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include <cJSON.h>
+#include <string>
+#include <string.h>
+
+#define PROF_MAX_SLOTS      16
+#define PROF_BUCKETS        8       // Upper bounds in prof_bucket_ms, last bucket is open ended
+#define PROF_WINDOW_US      1000000 // FPS / load window
+
+static const uint16_t prof_bucket_ms[PROF_BUCKETS - 1] = {1, 2, 5, 10, 20, 50, 100};
+
+typedef struct {
+    const char *name;
+    uint32_t count;
+    uint64_t total_us;
+    uint32_t max_us;
+    uint32_t hist[PROF_BUCKETS];
+} prof_slot_t;
+
+typedef struct {
+    prof_slot_t slots[PROF_MAX_SLOTS];
+    uint8_t slot_count;
+    uint64_t inv_px;            // Pixels refreshed by LVGL
+    int64_t since_us;           // Start of the current measurement
+    // Rolling one second window
+    int64_t win_start_us;
+    uint32_t win_frames;
+    uint64_t win_busy_us;
+    uint32_t win_worst_frame_ms;
+    // Results of the last complete window
+    uint16_t fps;
+    uint16_t gui_load_permille;
+    uint32_t worst_frame_ms;    // Worst frame in the last window
+} prof_state_t;
+
+static prof_state_t prof;
+static portMUX_TYPE prof_lock = portMUX_INITIALIZER_UNLOCKED;  // Flushes are recorded from another core
+
+// Extra sections appended to prof_to_json() by other helpers
+#define PROF_MAX_JSON_HOOKS 4
+typedef void (*prof_json_fn_t)(cJSON *root);
+static prof_json_fn_t prof_json_hooks[PROF_MAX_JSON_HOOKS];
+
+static prof_slot_t *prof_slot_frame = nullptr;
+static prof_slot_t *prof_slot_flush = nullptr;
+static prof_slot_t *prof_slot_handler = nullptr;
+
+/**
+ * @brief Find or register a slot; returns NULL once all slots are taken
+ */
+static prof_slot_t *prof_slot(const char *name)
+{
+    prof_slot_t *slot = nullptr;
+    portENTER_CRITICAL(&prof_lock);
+    for (uint8_t i = 0; i < prof.slot_count; i++) {
+        if (strcmp(prof.slots[i].name, name) == 0) {
+            slot = &prof.slots[i];
+            break;
+        }
+    }
+    if (!slot && prof.slot_count < PROF_MAX_SLOTS) {
+        slot = &prof.slots[prof.slot_count++];
+        slot->name = name;
+    }
+    portEXIT_CRITICAL(&prof_lock);
+    return slot;
+}
+
+static void prof_record(prof_slot_t *slot, uint32_t us)
+{
+    if (!slot) return;
+    uint8_t b = 0;
+    while (b < PROF_BUCKETS - 1 && us >= prof_bucket_ms[b] * 1000U) b++;
+
+    portENTER_CRITICAL(&prof_lock);
+    slot->count++;
+    slot->total_us += us;
+    if (us > slot->max_us) slot->max_us = us;
+    slot->hist[b]++;
+    portEXIT_CRITICAL(&prof_lock);
+}
+
+// Times the enclosing scope into a slot
+struct prof_scope_t {
+    prof_slot_t *slot;
+    int64_t t0;
+    explicit prof_scope_t(prof_slot_t *s) : slot(s), t0(esp_timer_get_time()) {}
+    ~prof_scope_t() { prof_record(slot, (uint32_t)(esp_timer_get_time() - t0)); }
+};
+
+#define PROF_SCOPE(name) \
+    static prof_slot_t *const prof_scope_slot_ = prof_slot(name); \
+    prof_scope_t prof_scope_(prof_scope_slot_)
+
+static void prof_init()
+{
+    prof.since_us = esp_timer_get_time();
+    prof.win_start_us = prof.since_us;
+    prof_slot_handler = prof_slot("lv_timer_handler");
+    prof_slot_frame = prof_slot("frame");
+    prof_slot_flush = prof_slot("flush");
+}
+
+// From the display monitor callback: one refresh of `px` pixels in `time_ms`
+static void prof_frame(uint32_t time_ms, uint32_t px)
+{
+    prof_record(prof_slot_frame, time_ms * 1000);
+    portENTER_CRITICAL(&prof_lock);
+    prof.inv_px += px;
+    prof.win_frames++;
+    if (time_ms > prof.win_worst_frame_ms) prof.win_worst_frame_ms = time_ms;
+    portEXIT_CRITICAL(&prof_lock);
+}
+
+static void prof_flush(uint32_t us)
+{
+    prof_record(prof_slot_flush, us);
+}
+
+// From the GUI task after every lv_timer_handler() call
+static void prof_handler(uint32_t us)
+{
+    prof_record(prof_slot_handler, us);
+
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&prof_lock);
+    prof.win_busy_us += us;
+    int64_t elapsed = now - prof.win_start_us;
+    if (elapsed >= PROF_WINDOW_US) {
+        prof.fps = (uint16_t)(prof.win_frames * 1000000LL / elapsed);
+        prof.gui_load_permille = (uint16_t)(prof.win_busy_us * 1000 / elapsed);
+        prof.worst_frame_ms = prof.win_worst_frame_ms;
+        prof.win_frames = 0;
+        prof.win_busy_us = 0;
+        prof.win_worst_frame_ms = 0;
+        prof.win_start_us = now;
+    }
+    portEXIT_CRITICAL(&prof_lock);
+}
+
+static void prof_add_json(prof_json_fn_t fn)
+{
+    for (uint8_t i = 0; i < PROF_MAX_JSON_HOOKS; i++) {
+        if (!prof_json_hooks[i]) {
+            prof_json_hooks[i] = fn;
+            return;
+        }
+    }
+}
+
+static void prof_reset()
+{
+    portENTER_CRITICAL(&prof_lock);
+    for (uint8_t i = 0; i < prof.slot_count; i++) {
+        const char *name = prof.slots[i].name;
+        memset(&prof.slots[i], 0, sizeof(prof_slot_t));
+        prof.slots[i].name = name;
+    }
+    prof.inv_px = 0;
+    prof.since_us = esp_timer_get_time();
+    portEXIT_CRITICAL(&prof_lock);
+}
+
+/**
+ * @brief Snapshot of all counters as JSON
+ */
+static std::string prof_to_json()
+{
+    prof_state_t snap;
+    portENTER_CRITICAL(&prof_lock);
+    snap = prof;
+    portEXIT_CRITICAL(&prof_lock);
+
+    const prof_slot_t *frame = prof_slot_frame ? &snap.slots[prof_slot_frame - prof.slots] : nullptr;
+
+    cJSON *root = cJSON_CreateObject();
+    cJSON_AddNumberToObject(root, "window_ms", (double)((esp_timer_get_time() - snap.since_us) / 1000));
+    cJSON_AddNumberToObject(root, "fps", snap.fps);
+    cJSON_AddNumberToObject(root, "gui_load_pct", snap.gui_load_permille / 10.0);
+    cJSON_AddNumberToObject(root, "worst_frame_ms_1s", snap.worst_frame_ms);
+    cJSON_AddNumberToObject(root, "frames", frame ? frame->count : 0);
+    cJSON_AddNumberToObject(root, "invalidated_px", (double)snap.inv_px);
+    cJSON_AddNumberToObject(root, "px_per_frame", frame && frame->count ? (double)(snap.inv_px / frame->count) : 0);
+
+    cJSON *heap = cJSON_AddObjectToObject(root, "heap");
+    cJSON_AddNumberToObject(heap, "free", esp_get_free_heap_size());
+    cJSON_AddNumberToObject(heap, "min_free", esp_get_minimum_free_heap_size());
+    cJSON_AddNumberToObject(heap, "internal", heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
+    cJSON_AddNumberToObject(heap, "psram", heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+
+    cJSON *buckets = cJSON_AddArrayToObject(root, "buckets_ms");
+    for (uint8_t b = 0; b < PROF_BUCKETS - 1; b++) {
+        cJSON_AddItemToArray(buckets, cJSON_CreateNumber(prof_bucket_ms[b]));
+    }
+
+    cJSON *slots = cJSON_AddArrayToObject(root, "callbacks");
+    for (uint8_t i = 0; i < snap.slot_count; i++) {
+        const prof_slot_t &s = snap.slots[i];
+        cJSON *o = cJSON_CreateObject();
+        cJSON_AddStringToObject(o, "name", s.name);
+        cJSON_AddNumberToObject(o, "count", s.count);
+        cJSON_AddNumberToObject(o, "avg_us", s.count ? (double)(s.total_us / s.count) : 0);
+        cJSON_AddNumberToObject(o, "max_us", s.max_us);
+        cJSON_AddNumberToObject(o, "total_ms", (double)(s.total_us / 1000));
+        cJSON *hist = cJSON_AddArrayToObject(o, "hist");
+        for (uint8_t b = 0; b < PROF_BUCKETS; b++) {
+            cJSON_AddItemToArray(hist, cJSON_CreateNumber(s.hist[b]));
+        }
+        cJSON_AddItemToArray(slots, o);
+    }
+
+    for (uint8_t i = 0; i < PROF_MAX_JSON_HOOKS && prof_json_hooks[i]; i++) {
+        prof_json_hooks[i](root);
+    }
+
+    char *str = cJSON_PrintUnformatted(root);
+    std::string out = str ? str : "{}";
+    free(str);
+    cJSON_Delete(root);
+    return out;
+}
+
+/*
+ * HUD: a small label on the top layer, refreshed twice a second.
+ * Call with the LVGL lock held.
+ */
+static lv_obj_t *prof_hud_label = nullptr;
+static lv_timer_t *prof_hud_timer = nullptr;
+
+static void prof_hud_timer_cb(lv_timer_t *timer)
+{
+    LV_UNUSED(timer);
+    if (!prof_hud_label) return;
+
+    uint32_t worst_ms = 0;
+    portENTER_CRITICAL(&prof_lock);
+    uint16_t fps = prof.fps;
+    uint16_t load = prof.gui_load_permille;
+    uint32_t worst_1s = prof.worst_frame_ms;
+    if (prof_slot_frame) worst_ms = prof_slot_frame->max_us / 1000;
+    portEXIT_CRITICAL(&prof_lock);
+
+    lv_label_set_text_fmt(prof_hud_label, "FPS %u  worst %lu/%lu ms\nGUI %u.%u%%  heap %uK  PSRAM %uK",
+                          fps, (unsigned long)worst_1s, (unsigned long)worst_ms,
+                          load / 10, load % 10,
+                          (unsigned)(heap_caps_get_free_size(MALLOC_CAP_INTERNAL) / 1024),
+                          (unsigned)(heap_caps_get_free_size(MALLOC_CAP_SPIRAM) / 1024));
+}
+
+static void prof_hud_show(bool show)
+{
+    if (show && !prof_hud_label) {
+        prof_hud_label = lv_label_create(lv_layer_top());
+        lv_obj_set_style_bg_color(prof_hud_label, lv_color_black(), 0);
+        lv_obj_set_style_bg_opa(prof_hud_label, LV_OPA_70, 0);
+        lv_obj_set_style_text_color(prof_hud_label, lv_color_hex(0x00ff66), 0);
+        lv_obj_set_style_pad_all(prof_hud_label, 4, 0);
+        lv_obj_align(prof_hud_label, LV_ALIGN_TOP_RIGHT, 0, 0);
+        lv_label_set_text(prof_hud_label, "FPS -");
+        prof_hud_timer = lv_timer_create(prof_hud_timer_cb, 500, NULL);
+    } else if (!show && prof_hud_label) {
+        lv_timer_del(prof_hud_timer);
+        lv_obj_del(prof_hud_label);
+        prof_hud_timer = nullptr;
+        prof_hud_label = nullptr;
+    }
+}
+
+static bool prof_hud_visible()
+{
+    return prof_hud_label != nullptr;
+}
@@ -0,0 +1,67 @@
+/**
+ * @file helper_theme.hpp
+ * @brief Theme palette resolved once per theme switch
+ *
+ * Every theme-dependent color lives here as a ready lv_color_t. Widgets read
+ * the cached palette instead of comparing cfg->CurrentTheme strings while
+ * they build objects. switch_theme() (gui.hpp) resolves the palette, writes it
+ * into the shared styles and lets LVGL refresh the objects that use them.
+ */
+
+#pragma once
+
+#include "lvgl/lvgl.h"
+#include "SettingsConfig.hpp"
+
+extern SettingsConfig *cfg;
+
+typedef struct {
+    bool dark;
+    lv_color_t primary;         // lv_theme_default accents
+    lv_color_t secondary;
+    lv_color_t island_bg;       // Tux panels (style_ui_island)
+    lv_color_t container_bg;    // Carousel container and scroll area
+    lv_color_t indicator_bg;    // Carousel page indicator
+    lv_color_t slide_bg;        // Placeholder/other slides
+    lv_color_t text;
+    lv_color_t subtitle;
+} ui_palette_t;
+
+static ui_palette_t ui_palette;
+static bool ui_palette_valid = false;
+
+static void ui_palette_resolve(bool dark)
+{
+    ui_palette.dark = dark;
+    ui_palette.primary = lv_palette_main(LV_PALETTE_BLUE);
+    if (dark) {
+        ui_palette.secondary = lv_palette_main(LV_PALETTE_GREEN);
+        ui_palette.island_bg = lv_palette_darken(LV_PALETTE_GREY, 5);
+        ui_palette.container_bg = lv_color_hex(0x1e1e1e);   // Dark gray
+        ui_palette.indicator_bg = lv_color_hex(0x2a2a2a);   // Slightly lighter dark gray
+        ui_palette.slide_bg = lv_color_hex(0x2a2a2a);
+        ui_palette.text = lv_color_white();
+        ui_palette.subtitle = lv_color_hex(0xaaaaaa);
+    } else {
+        ui_palette.secondary = lv_palette_main(LV_PALETTE_RED);
+        ui_palette.island_bg = lv_color_hex(0xBFBFBD);
+        ui_palette.container_bg = lv_color_hex(0xe0e0e0);   // Light gray
+        ui_palette.indicator_bg = lv_color_hex(0xd0d0d0);   // Slightly darker light gray
+        ui_palette.slide_bg = lv_color_hex(0xd0d0d0);
+        ui_palette.text = lv_color_hex(0x333333);           // Dark text
+        ui_palette.subtitle = lv_color_hex(0x666666);
+    }
+    ui_palette_valid = true;
+}
+
+/**
+ * @brief Current palette; resolved from the config on first use
+ *
+ * Objects created before the first switch_theme() (boot) still get the
+ * configured theme.
+ */
+static inline const ui_palette_t &ui_palette_get()
+{
+    if (!ui_palette_valid) ui_palette_resolve(!cfg || cfg->CurrentTheme == "dark");
+    return ui_palette;
+}
@@ -0,0 +1,366 @@
+/**
+ * @file helper_ui_bench.hpp
+ * @brief Scripted UI benchmark on the device (GET /api/perf/bench)
+ *
+ * Fills the home carousel with N synthetic printer and N weather slides and
+ * runs fixed scenarios: build, swipe through every slide, theme switch,
+ * full carousel rebuild and a pass over every language. Each step is forced
+ * through a full render with lv_refr_now(), so the times include drawing and
+ * the display flush. Per scenario it reports the time, LVGL heap use and the
+ * number of objects on the screen, and optionally writes a PNG screenshot.
+ *
+ * Runs on the LVGL task, posted over the UI bus by main.cpp. The real
+ * slides, theme and language are restored afterwards.
+ */
+
+#pragma once
+
+#include "lvgl/lvgl.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "esp_rom_crc.h"
+#include <cJSON.h>
+#include <string>
+#include <stdio.h>
+#include <sys/stat.h>
+
+static const char *TAG_BENCH = "UIBench";
+
+#define UI_BENCH_MAX_PER_TYPE   5       // Carousel holds 10 slides
+
+typedef struct {
+    const char *name;
+    uint32_t steps;
+    uint32_t total_us;
+    uint32_t max_us;
+    uint32_t mem_used;      // LVGL heap in use after the scenario
+    uint32_t mem_max;       // LVGL heap high-water mark so far
+    uint8_t frag_pct;
+    uint32_t objects;
+    bool png;
+} ui_bench_result_t;
+
+static uint32_t ui_bench_count_objs(lv_obj_t *obj)
+{
+    uint32_t n = 1;
+    uint32_t cnt = lv_obj_get_child_cnt(obj);
+    for (uint32_t i = 0; i < cnt; i++) {
+        n += ui_bench_count_objs(lv_obj_get_child(obj, i));
+    }
+    return n;
+}
+
+// Render everything that is invalid now and return how long it took
+static uint32_t ui_bench_render()
+{
+    int64_t t0 = esp_timer_get_time();
+    lv_refr_now(NULL);
+    return (uint32_t)(esp_timer_get_time() - t0);
+}
+
+static void ui_bench_step(ui_bench_result_t &r, uint32_t us)
+{
+    r.steps++;
+    r.total_us += us;
+    if (us > r.max_us) r.max_us = us;
+}
+
+static void ui_bench_finish(ui_bench_result_t &r)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    r.mem_used = mon.total_size - mon.free_size;
+    r.mem_max = mon.max_used;
+    r.frag_pct = mon.frag_pct;
+    r.objects = ui_bench_count_objs(lv_scr_act());
+}
+
+/*
+ * PNG writer: RGB888, deflate "stored" blocks (one per row), so no
+ * compressor is needed. Files are large but any viewer or diff tool reads them.
+ */
+static void ui_bench_put32(uint8_t *p, uint32_t v)
+{
+    p[0] = v >> 24; p[1] = v >> 16; p[2] = v >> 8; p[3] = v;
+}
+
+static void ui_bench_chunk(FILE *f, const char *type, const uint8_t *data, uint32_t len)
+{
+    uint8_t hdr[8];
+    ui_bench_put32(hdr, len);
+    memcpy(hdr + 4, type, 4);
+    fwrite(hdr, 1, 8, f);
+    if (len) fwrite(data, 1, len, f);
+    uint32_t crc = esp_rom_crc32_le(0, (const uint8_t *)type, 4);
+    if (len) crc = esp_rom_crc32_le(crc, data, len);
+    uint8_t tail[4];
+    ui_bench_put32(tail, crc);
+    fwrite(tail, 1, 4, f);
+}
+
+static bool ui_bench_write_png(const char *path, const lv_img_dsc_t *img)
+{
+    uint32_t w = img->header.w, h = img->header.h;
+    uint32_t row_len = 1 + w * 3;               // Filter byte + RGB
+    if (row_len > 0xFFFF) return false;
+
+    uint8_t *row = (uint8_t *)heap_caps_malloc(5 + row_len, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!row) return false;
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        free(row);
+        return false;
+    }
+
+    static const uint8_t sig[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    fwrite(sig, 1, 8, f);
+
+    uint8_t ihdr[13] = {0};
+    ui_bench_put32(ihdr, w);
+    ui_bench_put32(ihdr + 4, h);
+    ihdr[8] = 8;    // Bit depth
+    ihdr[9] = 2;    // Truecolour
+    ui_bench_chunk(f, "IHDR", ihdr, sizeof(ihdr));
+
+    // IDAT is streamed, so its CRC is accumulated by hand
+    uint32_t idat_len = 2 + h * (5 + row_len) + 4;
+    uint8_t hdr[8];
+    ui_bench_put32(hdr, idat_len);
+    memcpy(hdr + 4, "IDAT", 4);
+    fwrite(hdr, 1, 8, f);
+    uint32_t crc = esp_rom_crc32_le(0, hdr + 4, 4);
+
+    static const uint8_t zlib_hdr[2] = {0x78, 0x01};
+    fwrite(zlib_hdr, 1, 2, f);
+    crc = esp_rom_crc32_le(crc, zlib_hdr, 2);
+
+    uint32_t a1 = 1, a2 = 0;    // Adler-32 of the raw rows
+    const lv_color_t *px = (const lv_color_t *)img->data;
+    for (uint32_t y = 0; y < h; y++) {
+        row[0] = (y == h - 1) ? 1 : 0;          // BFINAL on the last block
+        row[1] = row_len & 0xFF;
+        row[2] = row_len >> 8;
+        row[3] = ~row_len & 0xFF;
+        row[4] = (~row_len >> 8) & 0xFF;
+        uint8_t *d = row + 5;
+        *d++ = 0;                               // Filter: none
+        for (uint32_t x = 0; x < w; x++) {
+            uint32_t c = lv_color_to32(px[y * w + x]);
+            *d++ = (c >> 16) & 0xFF;
+            *d++ = (c >> 8) & 0xFF;
+            *d++ = c & 0xFF;
+        }
+        for (uint32_t i = 0; i < row_len; i++) {
+            a1 = (a1 + row[5 + i]) % 65521;
+            a2 = (a2 + a1) % 65521;
+        }
+        fwrite(row, 1, 5 + row_len, f);
+        crc = esp_rom_crc32_le(crc, row, 5 + row_len);
+    }
+
+    uint8_t tail[4];
+    ui_bench_put32(tail, (a2 << 16) | a1);
+    fwrite(tail, 1, 4, f);
+    crc = esp_rom_crc32_le(crc, tail, 4);
+    ui_bench_put32(tail, crc);
+    fwrite(tail, 1, 4, f);
+
+    ui_bench_chunk(f, "IEND", NULL, 0);
+    bool ok = ferror(f) == 0;
+    fclose(f);
+    free(row);
+    return ok;
+}
+
+static bool ui_bench_screenshot(const char *dir, const char *name)
+{
+    if (!dir) return false;
+
+    lv_obj_t *scr = lv_scr_act();
+    uint32_t size = lv_snapshot_buf_size_needed(scr, LV_IMG_CF_TRUE_COLOR);
+    void *buf = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!buf) return false;
+
+    lv_img_dsc_t dsc;
+    bool ok = lv_snapshot_take_to_buf(scr, LV_IMG_CF_TRUE_COLOR, &dsc, buf, size) == LV_RES_OK;
+    if (ok) {
+        char path[96];
+        snprintf(path, sizeof(path), "%s/%s.png", dir, name);
+        ok = ui_bench_write_png(path, &dsc);
+        if (!ok) ESP_LOGW(TAG_BENCH, "Could not write %s", path);
+    }
+    free(buf);
+    return ok;
+}
+
+static std::vector<carousel_slide_t> ui_bench_slides(int count)
+{
+    std::vector<carousel_slide_t> slides;
+    char buf[64];
+    for (int i = 0; i < count; i++) {
+        carousel_slide_t s;
+        s.type = SLIDE_TYPE_WEATHER;
+        snprintf(buf, sizeof(buf), "Bench City %d", i + 1);
+        s.title = buf;
+        s.subtitle = "12:34 • NL";
+        s.value1 = "21.5°C";
+        s.value2 = TR(STR_LOADING_WEATHER);
+        snprintf(buf, sizeof(buf), "%s: 24.0° %s: 15.2° • %s: 64%%",
+                 TR(STR_HIGH), TR(STR_LOW), TR(STR_HUMIDITY));
+        s.value3 = buf;
+        snprintf(buf, sizeof(buf), "%s: 1013 hPa", TR(STR_PRESSURE));
+        s.value4 = buf;
+        s.bg_color = lv_color_hex(CAROUSEL_WEATHER_BG);
+        snprintf(buf, sizeof(buf), "bench:weather:%d", i);
+        s.key = buf;
+        slides.push_back(s);
+    }
+    for (int i = 0; i < count; i++) {
+        carousel_slide_t s;
+        s.type = SLIDE_TYPE_PRINTER;
+        snprintf(buf, sizeof(buf), "Bench Printer %d", i + 1);
+        s.title = buf;
+        s.subtitle = TR(STR_PRINTING);
+        snprintf(buf, sizeof(buf), "%d%% - 1%s %d%s", 10 + i * 15, TR(STR_HOURS_SHORT), 5 + i, TR(STR_MINUTES_SHORT));
+        s.value1 = buf;
+        s.value2 = "218/220°C";
+        snprintf(buf, sizeof(buf), "%s: 60/60°C  |  %s %d/250", TR(STR_BED), TR(STR_LAYER), 20 + i * 40);
+        s.value3 = buf;
+        s.value4 = "benchy_0.2mm_PLA";
+        s.bg_color = lv_color_hex(CAROUSEL_PRINTER_BG);
+        s.icon_code = 0xf04d;
+        snprintf(buf, sizeof(buf), "bench:printer:%d", i);
+        s.key = buf;
+        slides.push_back(s);
+    }
+    return slides;
+}
+
+/**
+ * @brief Run all scenarios; call on the LVGL task
+ *
+ * @param per_type Printer and weather slides each (1..UI_BENCH_MAX_PER_TYPE)
+ * @param png_dir Directory for screenshots, or NULL for none
+ * @return JSON report
+ */
+static std::string ui_bench_run(int per_type, const char *png_dir)
+{
+    if (!carousel_widget) return "{\"error\":\"carousel not shown\"}";
+    if (per_type < 1) per_type = 1;
+    if (per_type > UI_BENCH_MAX_PER_TYPE) per_type = UI_BENCH_MAX_PER_TYPE;
+    if (png_dir) mkdir(png_dir, 0755);
+
+    ESP_LOGI(TAG_BENCH, "Running with %d printer + %d weather slides", per_type, per_type);
+    bool was_dark = ui_palette_get().dark;
+    language_t lang = get_language();
+    std::vector<ui_bench_result_t> results;
+    ui_bench_result_t r;
+
+    // Build: keyed sync from the real slides to the synthetic set
+    r = {};
+    r.name = "build";
+    int64_t t0 = esp_timer_get_time();
+    carousel_widget->sync_slides(ui_bench_slides(per_type));
+    uint32_t build_us = (uint32_t)(esp_timer_get_time() - t0);
+    ui_bench_step(r, build_us + ui_bench_render());
+    ui_bench_finish(r);
+    r.png = ui_bench_screenshot(png_dir, r.name);
+    results.push_back(r);
+
+    // Swipe: scroll to every slide without animation and render each position
+    r = {};
+    r.name = "swipe";
+    int w = lv_obj_get_width(carousel_widget->scroll_container);
+    for (size_t i = 1; i <= carousel_widget->slides.size(); i++) {
+        size_t idx = i % carousel_widget->slides.size();
+        t0 = esp_timer_get_time();
+        lv_obj_scroll_to_x(carousel_widget->scroll_container, idx * w, LV_ANIM_OFF);
+        ui_bench_step(r, (uint32_t)(esp_timer_get_time() - t0) + ui_bench_render());
+    }
+    ui_bench_finish(r);
+    results.push_back(r);
+
+    // Theme: switch to the other theme and back
+    r = {};
+    r.name = "theme";
+    for (int pass = 0; pass < 2; pass++) {
+        bool dark = (pass == 0) ? !was_dark : was_dark;
+        t0 = esp_timer_get_time();
+        switch_theme(dark);
+        ui_bench_step(r, (uint32_t)(esp_timer_get_time() - t0) + ui_bench_render());
+        if (pass == 0) r.png = ui_bench_screenshot(png_dir, r.name);
+    }
+    ui_bench_finish(r);
+    results.push_back(r);
+
+    // Rebuild: delete and recreate every panel
+    r = {};
+    r.name = "rebuild";
+    t0 = esp_timer_get_time();
+    carousel_widget->update_slides();
+    ui_bench_step(r, (uint32_t)(esp_timer_get_time() - t0) + ui_bench_render());
+    ui_bench_finish(r);
+    results.push_back(r);
+
+    // Language: relabel all slides in every language
+    r = {};
+    r.name = "language";
+    for (int l = 0; l < lang_count(); l++) {
+        t0 = esp_timer_get_time();
+        set_language((language_t)l);
+        std::vector<carousel_slide_t> fresh = ui_bench_slides(per_type);
+        for (size_t i = 0; i < carousel_widget->slides.size() && i < fresh.size(); i++) {
+            carousel_slide_t &slide = carousel_widget->slides[i];
+            slide.subtitle = fresh[i].subtitle.c_str();
+            slide.value1 = fresh[i].value1.c_str();
+            slide.value2 = fresh[i].value2.c_str();
+            slide.value3 = fresh[i].value3.c_str();
+            slide.value4 = fresh[i].value4.c_str();
+            carousel_widget->update_slide_labels(i);
+        }
+        ui_bench_step(r, (uint32_t)(esp_timer_get_time() - t0) + ui_bench_render());
+        if (l == lang_count() - 1) r.png = ui_bench_screenshot(png_dir, r.name);
+    }
+    ui_bench_finish(r);
+    results.push_back(r);
+
+    // Restore the real UI
+    set_language(lang);
+    update_carousel_slides(true);
+    lv_obj_invalidate(lv_scr_act());
+
+    cJSON *root = cJSON_CreateObject();
+    cJSON_AddNumberToObject(root, "slides", per_type * 2);
+    cJSON_AddNumberToObject(root, "hor_res", lv_disp_get_hor_res(NULL));
+    cJSON_AddNumberToObject(root, "ver_res", lv_disp_get_ver_res(NULL));
+    cJSON *arr = cJSON_AddArrayToObject(root, "scenarios");
+    for (const ui_bench_result_t &res : results) {
+        cJSON *o = cJSON_CreateObject();
+        cJSON_AddStringToObject(o, "name", res.name);
+        cJSON_AddNumberToObject(o, "steps", res.steps);
+        cJSON_AddNumberToObject(o, "total_ms", res.total_us / 1000.0);
+        cJSON_AddNumberToObject(o, "avg_ms", res.steps ? res.total_us / 1000.0 / res.steps : 0);
+        cJSON_AddNumberToObject(o, "max_ms", res.max_us / 1000.0);
+        cJSON_AddNumberToObject(o, "lv_mem_used", res.mem_used);
+        cJSON_AddNumberToObject(o, "lv_mem_max", res.mem_max);
+        cJSON_AddNumberToObject(o, "lv_mem_frag_pct", res.frag_pct);
+        cJSON_AddNumberToObject(o, "objects", res.objects);
+        if (res.png) {
+            char path[96];
+            snprintf(path, sizeof(path), "%s/%s.png", png_dir, res.name);
+            cJSON_AddStringToObject(o, "png", path);
+        }
+        cJSON_AddItemToArray(arr, o);
+        ESP_LOGI(TAG_BENCH, "%-8s %2lu steps  avg %.1f ms  max %.1f ms  lv_mem %lu  objs %lu",
+                 res.name, (unsigned long)res.steps,
+                 res.steps ? res.total_us / 1000.0 / res.steps : 0.0, res.max_us / 1000.0,
+                 (unsigned long)res.mem_used, (unsigned long)res.objects);
+    }
+
+    char *str = cJSON_PrintUnformatted(root);
+    std::string out = str ? str : "{}";
+    free(str);
+    cJSON_Delete(root);
+    return out;
+}
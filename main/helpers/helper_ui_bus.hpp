@@ -0,0 +1,361 @@
+/**
+ * @file helper_ui_bus.hpp
+ * @brief Typed message bus from any task into the LVGL task
+ *
+ * Every message has a fixed size and goes into a lock-free multi-producer,
+ * single-consumer ring. The LVGL task drains the ring within a time budget
+ * (gui.hpp: ui_bus_timer_cb). Producers never block and never touch LVGL.
+ *
+ * Messages posted with a coalescing slot (the clock, each printer, each
+ * weather location, OTA status) keep only their latest payload: while a slot
+ * is pending in the ring, later posts overwrite its payload instead of adding
+ * another entry, so a burst costs one ring entry and one UI update. A slot
+ * post is never lost: if the ring is full its payload stays in the slot and
+ * the drain delivers it once the ring is empty (orphaned slot).
+ */
+
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include "esp_log.h"
+#include "lvgl/lvgl.h"
+#include "helper_io_worker.hpp"
+#include "helper_profiler.hpp"
+#include <atomic>
+#include <time.h>
+#include <stdio.h>
+#include <string.h>
+
+static const char *TAG_BUS = "UIBus";
+
+#define UI_BUS_RING_LEN         32      // Power of two
+#define UI_BUS_TEXT_LEN         96
+#define UI_BUS_MAX_PRINTERS     8
+#define UI_BUS_MAX_WEATHER      8
+
+enum class ui_msg_type : uint8_t {
+    NONE = 0,
+    TIME,           // Clock tick, payload tm
+    IO_DONE,        // Finished io_worker job, run its done() here
+    CALL,           // Run fn(arg) on the LVGL task (replaces lv_async_call from other tasks)
+    LV_MSG,         // Forward to lv_msg_send(id, text or NULL)
+    TIMER,          // lv_timer_ready/pause/resume
+    PRINTER,        // Printer `index` has new data
+    WEATHER,        // Weather location `index` has new data
+    SLOT,           // Ring token for a coalesced slot (index), never posted directly
+};
+
+enum class ui_timer_op : uint8_t {
+    READY = 0,
+    PAUSE,
+    RESUME,
+};
+
+// Coalescing slots: only the newest message per slot is delivered
+enum ui_bus_slot_t : int8_t {
+    UI_BUS_SLOT_NONE = -1,
+    UI_BUS_SLOT_TIME = 0,
+    UI_BUS_SLOT_OTA,
+    UI_BUS_SLOT_PRINTER,                                        // + printer index
+    UI_BUS_SLOT_WEATHER = UI_BUS_SLOT_PRINTER + UI_BUS_MAX_PRINTERS, // + location index
+    UI_BUS_SLOTS = UI_BUS_SLOT_WEATHER + UI_BUS_MAX_WEATHER,
+};
+
+typedef void (*ui_call_fn_t)(void *arg);
+
+typedef struct {
+    ui_msg_type type;
+    uint8_t index;
+    union {
+        struct tm time;
+        io_job_t io;
+        struct {
+            ui_call_fn_t fn;
+            void *arg;
+        } call;
+        struct {
+            uint32_t id;
+            bool has_text;
+            char text[UI_BUS_TEXT_LEN];
+        } lv_msg;
+        struct {
+            lv_timer_t *timer;
+            ui_timer_op op;
+        } timer;
+    };
+} ui_msg_t;
+
+// LVGL task side counters; posted/coalesced/dropped are atomics updated by producers
+typedef struct {
+    uint32_t dispatched;
+    uint32_t deferred;      // Drains that ran out of budget
+    uint32_t max_depth;
+} ui_bus_stats_t;
+
+// seq is stored minus the cell index, so the zero-initialised ring is valid before ui_bus_init()
+typedef struct {
+    std::atomic<uint32_t> seq;
+    ui_msg_t msg;
+} ui_bus_cell_t;
+
+static ui_bus_cell_t ui_bus_ring[UI_BUS_RING_LEN];
+static std::atomic<uint32_t> ui_bus_tail(0);    // Producers
+static uint32_t ui_bus_head = 0;                // LVGL task only
+
+static ui_msg_t ui_bus_slots[UI_BUS_SLOTS];
+static bool ui_bus_slot_pending[UI_BUS_SLOTS];
+static bool ui_bus_slot_orphan[UI_BUS_SLOTS];   // Pending without a ring token
+static portMUX_TYPE ui_bus_slot_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static std::atomic<uint32_t> ui_bus_posted(0);
+static std::atomic<uint32_t> ui_bus_coalesced(0);  // Overwrote a pending slot instead of using a ring entry
+static std::atomic<uint32_t> ui_bus_dropped(0);    // Ring full
+static std::atomic<uint32_t> ui_bus_orphans(0);    // Slots currently pending without a token
+static std::atomic<uint32_t> ui_bus_orphaned(0);   // Slot posts that found the ring full
+static ui_bus_stats_t ui_bus_stats = {};
+
+static void ui_bus_stats_json(cJSON *root);
+
+static void ui_bus_init()
+{
+    static bool done = false;
+    if (done) return;
+    prof_add_json(ui_bus_stats_json);
+    done = true;
+}
+
+// Bounded MPSC enqueue (sequence number per cell); false when the ring is full
+static bool ui_bus_push(const ui_msg_t &msg)
+{
+    uint32_t pos = ui_bus_tail.load(std::memory_order_relaxed);
+    ui_bus_cell_t *cell;
+    while (true) {
+        uint32_t i = pos & (UI_BUS_RING_LEN - 1);
+        cell = &ui_bus_ring[i];
+        uint32_t seq = cell->seq.load(std::memory_order_acquire) + i;
+        int32_t diff = (int32_t)(seq - pos);
+        if (diff == 0) {
+            if (ui_bus_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = ui_bus_tail.load(std::memory_order_relaxed);
+        }
+    }
+    cell->msg = msg;
+    cell->seq.store(pos + 1 - (pos & (UI_BUS_RING_LEN - 1)), std::memory_order_release);
+    return true;
+}
+
+// Single consumer; false when empty (or the next producer has not finished writing)
+static bool ui_bus_pop(ui_msg_t &msg)
+{
+    uint32_t i = ui_bus_head & (UI_BUS_RING_LEN - 1);
+    ui_bus_cell_t *cell = &ui_bus_ring[i];
+    uint32_t seq = cell->seq.load(std::memory_order_acquire) + i;
+    if ((int32_t)(seq - (ui_bus_head + 1)) < 0) return false;
+
+    msg = cell->msg;
+    cell->seq.store(ui_bus_head + UI_BUS_RING_LEN - i, std::memory_order_release);
+    ui_bus_head++;
+    return true;
+}
+
+static uint32_t ui_bus_depth()
+{
+    return ui_bus_tail.load(std::memory_order_relaxed) - ui_bus_head;
+}
+
+/**
+ * @brief Post a message from any task; never blocks
+ *
+ * @param slot Coalescing slot, or UI_BUS_SLOT_NONE to always deliver
+ * @return false if the message was dropped (ring full); slot posts are
+ *         always delivered
+ */
+static bool ui_bus_post(const ui_msg_t &msg, int slot = UI_BUS_SLOT_NONE)
+{
+    ui_bus_posted.fetch_add(1, std::memory_order_relaxed);
+
+    if (slot < 0 || slot >= UI_BUS_SLOTS) {
+        if (!ui_bus_push(msg)) {
+            ui_bus_dropped.fetch_add(1, std::memory_order_relaxed);
+            ESP_LOGD(TAG_BUS, "Ring full, dropped message type %d", (int)msg.type);
+            return false;
+        }
+        gui_wake();
+        return true;
+    }
+
+    portENTER_CRITICAL(&ui_bus_slot_lock);
+    bool pending = ui_bus_slot_pending[slot];
+    ui_bus_slots[slot] = msg;
+    ui_bus_slot_pending[slot] = true;
+    portEXIT_CRITICAL(&ui_bus_slot_lock);
+
+    if (pending) {
+        // A token (or the orphan sweep) will pick up the new payload
+        ui_bus_coalesced.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    ui_msg_t token = {};
+    token.type = ui_msg_type::SLOT;
+    token.index = (uint8_t)slot;
+    if (!ui_bus_push(token)) {
+        // Posts coalesced into this slot meanwhile were told they succeeded,
+        // so keep the payload; ui_bus_take() delivers it when the ring drains
+        portENTER_CRITICAL(&ui_bus_slot_lock);
+        ui_bus_slot_orphan[slot] = true;
+        ui_bus_orphans.fetch_add(1, std::memory_order_relaxed);
+        portEXIT_CRITICAL(&ui_bus_slot_lock);
+        ui_bus_orphaned.fetch_add(1, std::memory_order_relaxed);
+        ESP_LOGD(TAG_BUS, "Ring full, slot %d waits for the drain", slot);
+    }
+    gui_wake();
+    return true;
+}
+
+// Deliver one slot whose token did not fit in the ring
+static bool ui_bus_take_orphan(ui_msg_t &msg)
+{
+    if (ui_bus_orphans.load(std::memory_order_relaxed) == 0) return false;
+    bool found = false;
+    portENTER_CRITICAL(&ui_bus_slot_lock);
+    for (int slot = 0; slot < UI_BUS_SLOTS; slot++) {
+        if (ui_bus_slot_orphan[slot]) {
+            msg = ui_bus_slots[slot];
+            ui_bus_slot_orphan[slot] = false;
+            ui_bus_slot_pending[slot] = false;
+            ui_bus_orphans.fetch_sub(1, std::memory_order_relaxed);
+            found = true;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&ui_bus_slot_lock);
+    return found;
+}
+
+// Anything left for ui_bus_take(), ring entries or orphaned slots
+static bool ui_bus_pending()
+{
+    return ui_bus_depth() > 0 || ui_bus_orphans.load(std::memory_order_relaxed) > 0;
+}
+
+/**
+ * @brief Take the next message on the LVGL task, resolving coalesced slots
+ */
+static bool ui_bus_take(ui_msg_t &msg)
+{
+    uint32_t depth = ui_bus_depth();
+    if (depth > ui_bus_stats.max_depth) ui_bus_stats.max_depth = depth;
+
+    if (ui_bus_pop(msg)) {
+        if (msg.type == ui_msg_type::SLOT) {
+            uint8_t slot = msg.index;
+            portENTER_CRITICAL(&ui_bus_slot_lock);
+            msg = ui_bus_slots[slot];
+            ui_bus_slot_pending[slot] = false;
+            portEXIT_CRITICAL(&ui_bus_slot_lock);
+        }
+    } else if (!ui_bus_take_orphan(msg)) {
+        return false;
+    }
+    ui_bus_stats.dispatched++;
+    return true;
+}
+
+/* Typed producers */
+
+static bool ui_bus_post_time(const struct tm &dtinfo)
+{
+    ui_msg_t msg = {};
+    msg.type = ui_msg_type::TIME;
+    msg.time = dtinfo;
+    return ui_bus_post(msg, UI_BUS_SLOT_TIME);
+}
+
+static bool ui_bus_post_call(ui_call_fn_t fn, void *arg)
+{
+    ui_msg_t msg = {};
+    msg.type = ui_msg_type::CALL;
+    msg.call.fn = fn;
+    msg.call.arg = arg;
+    return ui_bus_post(msg);
+}
+
+// `text` is copied (truncated to UI_BUS_TEXT_LEN - 1); subscribers get NULL when it is NULL
+static bool ui_bus_post_lv_msg(uint32_t id, const char *text = NULL, int slot = UI_BUS_SLOT_NONE)
+{
+    ui_msg_t msg = {};
+    msg.type = ui_msg_type::LV_MSG;
+    msg.lv_msg.id = id;
+    msg.lv_msg.has_text = text != NULL;
+    if (text) snprintf(msg.lv_msg.text, sizeof(msg.lv_msg.text), "%s", text);
+    return ui_bus_post(msg, slot);
+}
+
+static bool ui_bus_post_timer(lv_timer_t *timer, ui_timer_op op)
+{
+    if (!timer) return false;
+    ui_msg_t msg = {};
+    msg.type = ui_msg_type::TIMER;
+    msg.timer.timer = timer;
+    msg.timer.op = op;
+    return ui_bus_post(msg);
+}
+
+static bool ui_bus_post_printer(int index)
+{
+    if (index < 0 || index >= UI_BUS_MAX_PRINTERS) return false;
+    ui_msg_t msg = {};
+    msg.type = ui_msg_type::PRINTER;
+    msg.index = (uint8_t)index;
+    return ui_bus_post(msg, UI_BUS_SLOT_PRINTER + index);
+}
+
+static bool ui_bus_post_weather(int index)
+{
+    if (index < 0 || index >= UI_BUS_MAX_WEATHER) return false;
+    ui_msg_t msg = {};
+    msg.type = ui_msg_type::WEATHER;
+    msg.index = (uint8_t)index;
+    return ui_bus_post(msg, UI_BUS_SLOT_WEATHER + index);
+}
+
+// io_worker completion sink, runs on the worker task
+static bool ui_bus_post_io(const io_job_t &job, TickType_t wait)
+{
+    ui_msg_t msg = {};
+    msg.type = ui_msg_type::IO_DONE;
+    msg.io = job;
+    // The ring never blocks; give the LVGL task a few chances to make room
+    TickType_t waited = 0;
+    while (!ui_bus_post(msg)) {
+        if (waited >= wait) return false;
+        vTaskDelay(pdMS_TO_TICKS(20));
+        waited += pdMS_TO_TICKS(20);
+    }
+    return true;
+}
+
+static void ui_bus_stats_json(cJSON *root)
+{
+    cJSON *bus = cJSON_AddObjectToObject(root, "ui_bus");
+    cJSON_AddNumberToObject(bus, "posted", ui_bus_posted.load(std::memory_order_relaxed));
+    cJSON_AddNumberToObject(bus, "coalesced", ui_bus_coalesced.load(std::memory_order_relaxed));
+    cJSON_AddNumberToObject(bus, "dropped", ui_bus_dropped.load(std::memory_order_relaxed));
+    cJSON_AddNumberToObject(bus, "orphaned", ui_bus_orphaned.load(std::memory_order_relaxed));
+    cJSON_AddNumberToObject(bus, "dispatched", ui_bus_stats.dispatched);
+    cJSON_AddNumberToObject(bus, "deferred", ui_bus_stats.deferred);
+    cJSON_AddNumberToObject(bus, "depth", ui_bus_depth());
+    cJSON_AddNumberToObject(bus, "max_depth", ui_bus_stats.max_depth);
+    cJSON_AddNumberToObject(bus, "capacity", UI_BUS_RING_LEN);
+
+    cJSON *io = cJSON_AddObjectToObject(root, "io_worker");
+    cJSON_AddNumberToObject(io, "submitted", io_stats.submitted);
+    cJSON_AddNumberToObject(io, "rejected", io_stats.rejected);
+    cJSON_AddNumberToObject(io, "completed", io_stats.completed);
+    cJSON_AddNumberToObject(io, "dropped", io_stats.dropped);
+    cJSON_AddNumberToObject(io, "max_work_us", io_stats.max_work_us);
+}
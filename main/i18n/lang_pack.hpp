@@ -0,0 +1,420 @@
+/**
+ * @file lang_pack.hpp
+ * @brief Language packs loaded from the storage partition
+ *
+ * English is compiled in (lang.hpp). Every other language is a .lpk file in
+ * LANG_PACK_DIR, built from main/i18n/packs/ by scripts/langpack.py, so adding
+ * a language does not touch the firmware. A pack holds the string table and,
+ * per UI font size, the glyphs the built-in fonts leave out (Cyrillic).
+ *
+ * The active pack is opened by set_language(); its strings and glyph tables
+ * are read into RAM, glyph bitmaps are read from the file on first use and
+ * kept in a small LRU cache. The UI fonts (font_ui_*) are RAM copies of the
+ * built-in Latin fonts with the pack font as LVGL fallback, so labels pick
+ * up pack glyphs without any change to the widgets.
+ *
+ * Loading and glyph reads happen on the LVGL task (or before LVGL starts).
+ */
+
+#pragma once
+
+#include "lvgl/lvgl.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <dirent.h>
+#include "helper_profiler.hpp"
+
+static const char *TAG_LANG = "LangPack";
+
+#ifndef LANG_PACK_DIR
+#define LANG_PACK_DIR           "/spiffs/lang"  // The host UI bench reads fatfs/lang
+#endif
+#define LANG_PACK_MAX           8       // Languages listed, English included
+#define LANG_PACK_SIZES         4       // UI font sizes, see lang_pack_sizes
+#ifdef CONFIG_TUX_LANG_GLYPH_CACHE_KB
+#define LANG_GLYPH_CACHE_BYTES  (CONFIG_TUX_LANG_GLYPH_CACHE_KB * 1024)
+#else
+#define LANG_GLYPH_CACHE_BYTES  (16 * 1024)
+#endif
+#define LANG_GLYPH_CACHE_SLOTS  96
+
+static const uint8_t lang_pack_sizes[LANG_PACK_SIZES] = { 14, 16, 24, 32 };
+
+/* File format, see scripts/langpack.py */
+
+typedef struct {
+    char magic[4];              // "TLP1"
+    char code[4];
+    char name[32];
+    uint16_t string_count;
+    uint8_t font_count;
+    uint8_t reserved;
+    uint32_t strings_offset;
+    uint32_t strings_size;
+} __attribute__((packed)) lang_pack_header_t;
+
+typedef struct {
+    uint8_t size;
+    uint8_t bpp;
+    uint8_t line_height;
+    int8_t base_line;
+    uint32_t glyph_count;
+    uint32_t glyph_offset;
+    uint32_t bitmap_offset;
+} __attribute__((packed)) lang_pack_font_entry_t;
+
+typedef struct {
+    uint32_t codepoint;
+    uint32_t bitmap_offset;
+    uint16_t adv_w;             // 1/16 px
+    uint8_t box_w;
+    uint8_t box_h;
+    int8_t ofs_x;
+    int8_t ofs_y;
+    uint16_t reserved;
+} lang_glyph_t;
+
+static_assert(sizeof(lang_pack_header_t) == 52, "pack header layout");
+static_assert(sizeof(lang_pack_font_entry_t) == 16, "pack font layout");
+static_assert(sizeof(lang_glyph_t) == 16, "pack glyph layout");
+
+/* Runtime state */
+
+typedef struct {
+    char code[5];
+    char name[32];
+    char file[16];              // Empty for built-in English
+} lang_info_t;
+
+typedef struct {
+    const lang_glyph_t *glyphs; // Sorted by code point
+    uint32_t count;
+    uint32_t bitmap_offset;
+    uint8_t bpp;
+} lang_pack_font_t;
+
+typedef struct {
+    const lv_font_t *font;
+    uint32_t letter;
+    uint32_t last_use;
+    uint16_t size;
+    uint8_t *data;
+} lang_glyph_slot_t;
+
+static lang_info_t lang_list[LANG_PACK_MAX];
+static uint8_t lang_list_count = 0;
+static bool lang_list_scanned = false;
+
+static FILE *lang_pack_file = NULL;
+static char *lang_pack_strings = NULL;          // Strings block as stored
+static const char **lang_pack_table = NULL;     // string_count pointers (NULL = English)
+static uint16_t lang_pack_string_count = 0;
+static lang_glyph_t *lang_pack_glyphs = NULL;   // All sizes, one allocation
+static lang_pack_font_t lang_pack_font_dsc[LANG_PACK_SIZES];
+
+static lang_glyph_slot_t lang_glyph_cache[LANG_GLYPH_CACHE_SLOTS];
+static uint32_t lang_glyph_cache_used = 0;
+static uint32_t lang_glyph_cache_clock = 0;
+static uint32_t lang_glyph_hits = 0;
+static uint32_t lang_glyph_misses = 0;
+
+static void *lang_pack_alloc(size_t size)
+{
+    void *p = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    return p ? p : heap_caps_malloc(size, MALLOC_CAP_8BIT);
+}
+
+/* Glyph source for the UI fonts */
+
+static const lang_glyph_t *lang_pack_find(const lang_pack_font_t *fd, uint32_t letter)
+{
+    uint32_t lo = 0, hi = fd->count;
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) / 2;
+        uint32_t cp = fd->glyphs[mid].codepoint;
+        if (cp == letter) return &fd->glyphs[mid];
+        if (cp < letter) lo = mid + 1;
+        else hi = mid;
+    }
+    return NULL;
+}
+
+static bool lang_pack_get_glyph_dsc(const lv_font_t *font, lv_font_glyph_dsc_t *dsc,
+                                    uint32_t letter, uint32_t letter_next)
+{
+    (void)letter_next;
+    const lang_pack_font_t *fd = (const lang_pack_font_t *)font->dsc;
+    const lang_glyph_t *g = lang_pack_find(fd, letter);
+    if (!g) return false;
+
+    dsc->adv_w = (g->adv_w + (1 << 3)) >> 4;
+    dsc->box_w = g->box_w;
+    dsc->box_h = g->box_h;
+    dsc->ofs_x = g->ofs_x;
+    dsc->ofs_y = g->ofs_y;
+    dsc->bpp = fd->bpp;
+    dsc->is_placeholder = false;
+    return true;
+}
+
+static void lang_glyph_cache_evict(int i)
+{
+    lang_glyph_cache_used -= lang_glyph_cache[i].size;
+    free(lang_glyph_cache[i].data);
+    lang_glyph_cache[i] = {};
+}
+
+static void lang_glyph_cache_clear()
+{
+    for (int i = 0; i < LANG_GLYPH_CACHE_SLOTS; i++) {
+        if (lang_glyph_cache[i].data) lang_glyph_cache_evict(i);
+    }
+}
+
+/**
+ * @brief Bitmap of a pack glyph, read from the pack on a cache miss
+ *
+ * LVGL draws the glyph before asking for the next one, so the returned
+ * buffer only has to survive until the next call.
+ */
+static const uint8_t *lang_pack_get_glyph_bitmap(const lv_font_t *font, uint32_t letter)
+{
+    int free_slot = -1, lru = -1;
+    for (int i = 0; i < LANG_GLYPH_CACHE_SLOTS; i++) {
+        lang_glyph_slot_t &s = lang_glyph_cache[i];
+        if (!s.data) {
+            if (free_slot < 0) free_slot = i;
+        } else if (s.font == font && s.letter == letter) {
+            s.last_use = ++lang_glyph_cache_clock;
+            lang_glyph_hits++;
+            return s.data;
+        } else if (lru < 0 || s.last_use < lang_glyph_cache[lru].last_use) {
+            lru = i;
+        }
+    }
+
+    const lang_pack_font_t *fd = (const lang_pack_font_t *)font->dsc;
+    const lang_glyph_t *g = lang_pack_find(fd, letter);
+    if (!g || !lang_pack_file) return NULL;
+    uint32_t size = ((uint32_t)g->box_w * g->box_h * fd->bpp + 7) / 8;
+    if (size == 0 || size > LANG_GLYPH_CACHE_BYTES) return NULL;
+    lang_glyph_misses++;
+
+    // Make room: least recently used first
+    while (lru >= 0 && (free_slot < 0 || lang_glyph_cache_used + size > LANG_GLYPH_CACHE_BYTES)) {
+        lang_glyph_cache_evict(lru);
+        if (free_slot < 0) free_slot = lru;
+        lru = -1;
+        for (int i = 0; i < LANG_GLYPH_CACHE_SLOTS; i++) {
+            if (lang_glyph_cache[i].data &&
+                (lru < 0 || lang_glyph_cache[i].last_use < lang_glyph_cache[lru].last_use)) {
+                lru = i;
+            }
+        }
+    }
+
+    uint8_t *data = (uint8_t *)lang_pack_alloc(size);
+    if (!data) return NULL;
+    if (fseek(lang_pack_file, fd->bitmap_offset + g->bitmap_offset, SEEK_SET) != 0 ||
+        fread(data, 1, size, lang_pack_file) != size) {
+        ESP_LOGW(TAG_LANG, "Failed to read glyph U+%04lX", (unsigned long)letter);
+        free(data);
+        return NULL;
+    }
+
+    lang_glyph_slot_t &s = lang_glyph_cache[free_slot];
+    s.font = font;
+    s.letter = letter;
+    s.last_use = ++lang_glyph_cache_clock;
+    s.size = (uint16_t)size;
+    s.data = data;
+    lang_glyph_cache_used += size;
+    return data;
+}
+
+static lv_font_t lang_pack_font_make(int idx)
+{
+    lv_font_t f = {};
+    f.get_glyph_dsc = lang_pack_get_glyph_dsc;
+    f.get_glyph_bitmap = lang_pack_get_glyph_bitmap;
+    f.line_height = lang_pack_sizes[idx];
+    f.dsc = &lang_pack_font_dsc[idx];
+    return f;
+}
+
+static lv_font_t lang_pack_font[LANG_PACK_SIZES] = {
+    lang_pack_font_make(0), lang_pack_font_make(1), lang_pack_font_make(2), lang_pack_font_make(3),
+};
+
+// Built-in font with the pack glyphs of the same size as fallback
+static lv_font_t lang_font_wrap(const lv_font_t &base, int idx)
+{
+    lv_font_t f = base;
+    f.fallback = &lang_pack_font[idx];
+    return f;
+}
+
+// UI fonts; use these instead of font_montserrat_int_* for translated text
+static lv_font_t font_ui_14 = lang_font_wrap(font_montserrat_int_14, 0);
+static lv_font_t font_ui_16 = lang_font_wrap(font_montserrat_int_16, 1);
+static lv_font_t font_ui_24 = lang_font_wrap(font_montserrat_int_24, 2);
+static lv_font_t font_ui_32 = lang_font_wrap(font_montserrat_int_32, 3);
+
+// /api/perf: glyph cache use
+static void lang_pack_stats_json(cJSON *root)
+{
+    cJSON *lang = cJSON_AddObjectToObject(root, "lang_glyphs");
+    cJSON_AddNumberToObject(lang, "hits", lang_glyph_hits);
+    cJSON_AddNumberToObject(lang, "misses", lang_glyph_misses);
+    cJSON_AddNumberToObject(lang, "cache_bytes", lang_glyph_cache_used);
+    cJSON_AddNumberToObject(lang, "cache_max", LANG_GLYPH_CACHE_BYTES);
+}
+
+/* Pack list and loading */
+
+static void lang_pack_scan()
+{
+    lang_list_scanned = true;
+    prof_add_json(lang_pack_stats_json);
+    lang_list_count = 0;
+    lang_info_t &en = lang_list[lang_list_count++];
+    en = {};
+    strcpy(en.code, "EN");
+    strcpy(en.name, "English");
+
+    DIR *dir = opendir(LANG_PACK_DIR);
+    if (!dir) {
+        ESP_LOGW(TAG_LANG, "No language packs in " LANG_PACK_DIR);
+        return;
+    }
+    struct dirent *ent;
+    while ((ent = readdir(dir)) != NULL && lang_list_count < LANG_PACK_MAX) {
+        char file[sizeof(lang_list[0].file)];
+        size_t len = strlen(ent->d_name);
+        if (len < 5 || len >= sizeof(file) || strcasecmp(ent->d_name + len - 4, ".lpk") != 0) continue;
+        memcpy(file, ent->d_name, len + 1);
+
+        char path[64];
+        snprintf(path, sizeof(path), LANG_PACK_DIR "/%s", file);
+        FILE *f = fopen(path, "rb");
+        if (!f) continue;
+        lang_pack_header_t hdr;
+        bool ok = fread(&hdr, 1, sizeof(hdr), f) == sizeof(hdr) && memcmp(hdr.magic, "TLP1", 4) == 0;
+        fclose(f);
+        if (!ok) {
+            ESP_LOGW(TAG_LANG, "%s: not a language pack", file);
+            continue;
+        }
+
+        lang_info_t &info = lang_list[lang_list_count++];
+        info = {};
+        memcpy(info.code, hdr.code, sizeof(hdr.code));
+        memcpy(info.name, hdr.name, sizeof(info.name) - 1);
+        strcpy(info.file, file);
+    }
+    closedir(dir);
+    ESP_LOGI(TAG_LANG, "%d languages available", lang_list_count);
+}
+
+static void lang_pack_unload()
+{
+    lang_glyph_cache_clear();
+    for (int i = 0; i < LANG_PACK_SIZES; i++) {
+        lang_pack_font_dsc[i] = {};
+        lang_pack_font[i].line_height = lang_pack_sizes[i];
+        lang_pack_font[i].base_line = 0;
+    }
+    free(lang_pack_glyphs);
+    free(lang_pack_table);
+    free(lang_pack_strings);
+    lang_pack_glyphs = NULL;
+    lang_pack_table = NULL;
+    lang_pack_strings = NULL;
+    lang_pack_string_count = 0;
+    if (lang_pack_file) {
+        fclose(lang_pack_file);
+        lang_pack_file = NULL;
+    }
+}
+
+/**
+ * @brief Open a pack and read its strings and glyph tables
+ *
+ * @param string_count Strings the firmware knows (STR_COUNT); extra pack
+ *                     strings are ignored, missing ones fall back to English
+ */
+static esp_err_t lang_pack_load(const lang_info_t &info, uint16_t string_count)
+{
+    lang_pack_unload();
+
+    char path[64];
+    snprintf(path, sizeof(path), LANG_PACK_DIR "/%s", info.file);
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        ESP_LOGE(TAG_LANG, "Cannot open %s", path);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    lang_pack_header_t hdr;
+    lang_pack_font_entry_t fonts[LANG_PACK_SIZES * 2];
+    uint32_t glyph_total = 0;
+    bool ok = fread(&hdr, 1, sizeof(hdr), f) == sizeof(hdr) && memcmp(hdr.magic, "TLP1", 4) == 0 &&
+              hdr.font_count <= sizeof(fonts) / sizeof(fonts[0]) &&
+              fread(fonts, sizeof(fonts[0]), hdr.font_count, f) == hdr.font_count &&
+              hdr.strings_size >= 4u * hdr.string_count;
+    for (int i = 0; ok && i < hdr.font_count; i++) glyph_total += fonts[i].glyph_count;
+
+    // Strings: offset table + text, terminated so a bad offset cannot run off the end
+    if (ok) {
+        lang_pack_strings = (char *)lang_pack_alloc(hdr.strings_size + 1);
+        lang_pack_table = (const char **)calloc(string_count, sizeof(char *));
+        ok = lang_pack_strings && lang_pack_table &&
+             fseek(f, hdr.strings_offset, SEEK_SET) == 0 &&
+             fread(lang_pack_strings, 1, hdr.strings_size, f) == hdr.strings_size;
+    }
+    if (ok) {
+        lang_pack_strings[hdr.strings_size] = '\0';
+        const uint32_t *offsets = (const uint32_t *)lang_pack_strings;
+        lang_pack_string_count = string_count;
+        for (uint16_t i = 0; i < hdr.string_count && i < string_count; i++) {
+            if (offsets[i] && offsets[i] < hdr.strings_size) lang_pack_table[i] = lang_pack_strings + offsets[i];
+        }
+    }
+
+    // Glyph tables for the sizes the UI uses
+    if (ok && glyph_total) {
+        lang_pack_glyphs = (lang_glyph_t *)lang_pack_alloc(glyph_total * sizeof(lang_glyph_t));
+        ok = lang_pack_glyphs != NULL;
+        lang_glyph_t *next = lang_pack_glyphs;
+        for (int i = 0; ok && i < hdr.font_count; i++) {
+            int idx = -1;
+            for (int s = 0; s < LANG_PACK_SIZES; s++) {
+                if (lang_pack_sizes[s] == fonts[i].size) idx = s;
+            }
+            if (idx < 0 || fonts[i].glyph_count == 0) continue;
+            ok = fseek(f, fonts[i].glyph_offset, SEEK_SET) == 0 &&
+                 fread(next, sizeof(lang_glyph_t), fonts[i].glyph_count, f) == fonts[i].glyph_count;
+            lang_pack_font_dsc[idx] = { next, fonts[i].glyph_count, fonts[i].bitmap_offset, fonts[i].bpp };
+            lang_pack_font[idx].line_height = fonts[i].line_height;
+            lang_pack_font[idx].base_line = fonts[i].base_line;
+            next += fonts[i].glyph_count;
+        }
+    }
+
+    if (!ok) {
+        ESP_LOGE(TAG_LANG, "%s: invalid or truncated pack", path);
+        fclose(f);
+        lang_pack_unload();
+        return ESP_ERR_INVALID_RESPONSE;
+    }
+
+    // Kept open for glyph bitmaps (uses one of the SPIFFS file handles)
+    if (glyph_total) lang_pack_file = f;
+    else fclose(f);
+    ESP_LOGI(TAG_LANG, "Loaded %s (%s): %u strings, %lu glyphs", info.code, info.name,
+             hdr.string_count, (unsigned long)glyph_total);
+    return ESP_OK;
+}
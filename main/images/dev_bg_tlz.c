@@ -0,0 +1,6565 @@
+/* Generated by scripts/img2tlz.py from dev_bg1.bin - do not edit */
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+#include "lvgl.h"
+#else
+#include "lvgl/lvgl.h"
+#endif
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMG_DEV_BG_TLZ
+#define LV_ATTRIBUTE_IMG_DEV_BG_TLZ
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DEV_BG_TLZ uint8_t dev_bg_tlz_map[] = {
+  0x54, 0x4c, 0x5a, 0x31, 0x01, 0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x64, 0x8a, 0xeb, 0xff, 0x58, 0x7f, 0xea, 0xff, 0x5d, 0x80, 0xdb, 0xff,
+  0x57, 0x71, 0xd4, 0xff, 0x44, 0x65, 0xca, 0xff, 0x38, 0x63, 0xcb, 0xff, 0x29, 0x5e, 0xdb, 0xff, 0x42, 0x62, 0xbf, 0xff, 0x35, 0x5e, 0xcb, 0xff,
+  0x3a, 0x5c, 0xc5, 0xff, 0x3a, 0x5e, 0xba, 0xff, 0x33, 0x59, 0xc1, 0xff, 0x39, 0x5b, 0xb3, 0xff, 0x3b, 0x5a, 0xab, 0xff, 0x33, 0x54, 0xbe, 0xff,
+  0x23, 0x4e, 0xd1, 0xff, 0x3e, 0x59, 0xa1, 0xff, 0x39, 0x53, 0xae, 0xff, 0x4d, 0x5c, 0x80, 0xff, 0x23, 0x4e, 0xbd, 0xff, 0x32, 0x50, 0xae, 0xff,
+  0x3a, 0x53, 0x9d, 0xff, 0x3b, 0x51, 0x94, 0xff, 0x32, 0x4d, 0xa3, 0xff, 0x2b, 0x4a, 0xaf, 0xff, 0x45, 0x52, 0x7e, 0xff, 0x1e, 0x3f, 0xc9, 0xff,
+  0x33, 0x4a, 0x9b, 0xff, 0x4c, 0x53, 0x6d, 0xff, 0x37, 0x4a, 0x8f, 0xff, 0x2b, 0x44, 0xa5, 0xff, 0x21, 0x3f, 0xb6, 0xff, 0x2d, 0x41, 0x9a, 0xff,
+  0x3b, 0x48, 0x7c, 0xff, 0x33, 0x43, 0x8d, 0xff, 0x43, 0x4a, 0x6d, 0xff, 0x48, 0x4c, 0x61, 0xff, 0x22, 0x3b, 0xa4, 0xff, 0x19, 0x31, 0xc4, 0xff,
+  0x1a, 0x33, 0xb5, 0xff, 0x32, 0x3f, 0x82, 0xff, 0x2b, 0x3b, 0x8d, 0xff, 0x3b, 0x42, 0x6e, 0xff, 0x40, 0x43, 0x60, 0xff, 0x1d, 0x33, 0x9e, 0xff,
+  0x18, 0x2d, 0xab, 0xff, 0x29, 0x36, 0x83, 0xff, 0x44, 0x42, 0x4f, 0xff, 0x35, 0x3b, 0x6b, 0xff, 0x15, 0x28, 0xb4, 0xff, 0x21, 0x32, 0x8d, 0xff,
+  0x39, 0x3c, 0x5f, 0xff, 0x2a, 0x34, 0x7a, 0xff, 0x18, 0x2a, 0x9f, 0xff, 0x3c, 0x3b, 0x4f, 0xff, 0x19, 0x2b, 0x90, 0xff, 0x32, 0x35, 0x60, 0xff,
+  0x13, 0x22, 0xa7, 0xff, 0x26, 0x2d, 0x70, 0xff, 0x14, 0x22, 0x9b, 0xff, 0x35, 0x33, 0x4f, 0xff, 0x39, 0x36, 0x43, 0xff, 0x16, 0x22, 0x92, 0xff,
+  0x19, 0x26, 0x81, 0xff, 0x2c, 0x2e, 0x5c, 0xff, 0x14, 0x1f, 0x8b, 0xff, 0x2a, 0x2a, 0x54, 0xff, 0x1e, 0x24, 0x6c, 0xff, 0x11, 0x1b, 0x81, 0xff,
+  0x13, 0x1a, 0x73, 0xff, 0x1d, 0x1f, 0x5e, 0xff, 0x24, 0x23, 0x4d, 0xff, 0x0f, 0x15, 0x68, 0xff, 0x22, 0x20, 0x37, 0xff, 0x19, 0x19, 0x4e, 0xff,
+  0x12, 0x12, 0x45, 0xff, 0x18, 0x15, 0x33, 0xff, 0x15, 0x13, 0x2a, 0xff, 0x0f, 0x0e, 0x3b, 0xff, 0x0e, 0x0d, 0x33, 0xff, 0x13, 0x11, 0x22, 0xff,
+  0x0c, 0x0a, 0x2b, 0xff, 0xef, 0xf8, 0xfe, 0xff, 0xd1, 0xf8, 0xfe, 0xff, 0xe1, 0xf2, 0xfb, 0xff, 0xb9, 0xf3, 0xfc, 0xff, 0xc9, 0xee, 0xfc, 0xff,
+  0xd4, 0xe9, 0xf9, 0xff, 0xb5, 0xeb, 0xfc, 0xff, 0x8e, 0xee, 0xf9, 0xff, 0xac, 0xe7, 0xfd, 0xff, 0xc7, 0xe0, 0xf7, 0xff, 0x9f, 0xe2, 0xfb, 0xff,
+  0x82, 0xe5, 0xf7, 0xff, 0xb5, 0xde, 0xf9, 0xff, 0xa8, 0xd9, 0xfb, 0xff, 0x99, 0xda, 0xfb, 0xff, 0xa4, 0xd5, 0xef, 0xff, 0x92, 0xd3, 0xfb, 0xff,
+  0x7d, 0xd7, 0xf3, 0xff, 0xb3, 0xd1, 0xf1, 0xff, 0x93, 0xd2, 0xed, 0xff, 0x8a, 0xcc, 0xf8, 0xff, 0x9c, 0xca, 0xf5, 0xff, 0xa0, 0xc6, 0xe9, 0xff,
+  0x7d, 0xc9, 0xe7, 0xff, 0x80, 0xc4, 0xf6, 0xff, 0x6c, 0xc5, 0xf6, 0xff, 0x8e, 0xbf, 0xf4, 0xff, 0x91, 0xbf, 0xe7, 0xff, 0x80, 0xbb, 0xf1, 0xff,
+  0x72, 0xb9, 0xf3, 0xff, 0x73, 0xbc, 0xe2, 0xff, 0x8b, 0xb4, 0xe8, 0xff, 0x6e, 0xb3, 0xf0, 0xff, 0x7f, 0xaf, 0xee, 0xff, 0x6d, 0xac, 0xed, 0xff,
+  0x80, 0xac, 0xe3, 0xff, 0x6c, 0xad, 0xde, 0xff, 0x65, 0xa9, 0xec, 0xff, 0x7c, 0xa5, 0xe5, 0xff, 0x71, 0xa2, 0xf0, 0xff, 0x5f, 0xa1, 0xeb, 0xff,
+  0x62, 0xa3, 0xe0, 0xff, 0x72, 0xa0, 0xe1, 0xff, 0x71, 0x9b, 0xe0, 0xff, 0x6e, 0x96, 0xef, 0xff, 0x5b, 0x97, 0xec, 0xff, 0x5d, 0x97, 0xe1, 0xff,
+  0x6b, 0x95, 0xdf, 0xff, 0x5c, 0x98, 0xd7, 0xff, 0x51, 0x93, 0xe6, 0xff, 0x79, 0x9d, 0xa6, 0xff, 0x55, 0x90, 0xd5, 0xff, 0x5f, 0x8b, 0xdc, 0xff,
+  0x4c, 0x8b, 0xe0, 0xff, 0x5a, 0x86, 0xea, 0xff, 0x4d, 0x86, 0xd3, 0xff, 0x43, 0x83, 0xdf, 0xff, 0x5b, 0x83, 0xcf, 0xff, 0x4f, 0x84, 0xc9, 0xff,
+  0x4e, 0x7f, 0xd9, 0xff, 0x40, 0x7a, 0xdd, 0xff, 0x50, 0x7a, 0xd2, 0xff, 0x65, 0x86, 0xa1, 0xff, 0x43, 0x7a, 0xcf, 0xff, 0x4b, 0x79, 0xc2, 0xff,
+  0x3b, 0x72, 0xd9, 0xff, 0x48, 0x72, 0xcf, 0xff, 0x43, 0x6e, 0xce, 0xff, 0x66, 0x7d, 0x8f, 0xff, 0x4a, 0x70, 0xc4, 0xff, 0x48, 0x71, 0xbb, 0xff,
+  0x3b, 0x6b, 0xd1, 0xff, 0x40, 0x6c, 0xc3, 0xff, 0x43, 0x69, 0xb7, 0xff, 0x58, 0x6c, 0x8e, 0xff, 0x41, 0x62, 0xad, 0xff, 0x62, 0x6e, 0x78, 0xff,
+  0x4d, 0x60, 0x8b, 0xff, 0x58, 0x60, 0x6f, 0xff, 0x58, 0x5b, 0x5e, 0xff, 0xf8, 0xfe, 0xfe, 0xff, 0xe0, 0xfe, 0xfe, 0xff, 0xc7, 0xfc, 0xfe, 0xff,
+  0x9e, 0xf4, 0xf9, 0xff, 0x95, 0xc0, 0xc4, 0xff, 0x8a, 0xaf, 0xad, 0xff, 0x88, 0xa4, 0x97, 0xff, 0x76, 0x90, 0x92, 0xff, 0xd5, 0xed, 0xdc, 0xff,
+  0xa4, 0xbf, 0xa9, 0xff, 0x7a, 0x88, 0x7c, 0xff, 0xd0, 0xe4, 0xc7, 0xff, 0xc6, 0xdb, 0xbc, 0xff, 0xbb, 0xcf, 0xad, 0xff, 0xae, 0xbe, 0x91, 0xff,
+  0xa0, 0xb6, 0x95, 0xff, 0x9f, 0xb0, 0x87, 0xff, 0x8b, 0x9e, 0x86, 0xff, 0x92, 0x9e, 0x77, 0xff, 0x75, 0x7d, 0x6f, 0xff, 0x68, 0x6e, 0x67, 0xff,
+  0xc4, 0xcd, 0x97, 0xff, 0xc4, 0xc8, 0x84, 0xff, 0xc9, 0xc5, 0x72, 0xff, 0xb2, 0xb8, 0x77, 0xff, 0xce, 0xbf, 0x53, 0xff, 0xb0, 0xb0, 0x66, 0xff,
+  0x9f, 0xab, 0x78, 0xff, 0xb9, 0xab, 0x4a, 0xff, 0xc7, 0xaf, 0x34, 0xff, 0x9d, 0xa1, 0x66, 0xff, 0x9f, 0x9c, 0x57, 0xff, 0x89, 0x90, 0x6b, 0xff,
+  0xb4, 0x9d, 0x2b, 0xff, 0xa1, 0x96, 0x46, 0xff, 0x90, 0x8d, 0x55, 0xff, 0x9e, 0x8e, 0x37, 0xff, 0xa6, 0x8e, 0x22, 0xff, 0x85, 0x80, 0x50, 0xff,
+  0x89, 0x7e, 0x3e, 0xff, 0x8e, 0x7f, 0x30, 0xff, 0x9a, 0x83, 0x1e, 0xff, 0x7c, 0x75, 0x46, 0xff, 0x72, 0x71, 0x56, 0xff, 0x8d, 0x77, 0x1a, 0xff,
+  0x70, 0x6a, 0x46, 0xff, 0x7e, 0x6f, 0x30, 0xff, 0x7e, 0x6b, 0x1e, 0xff, 0x64, 0x60, 0x4a, 0xff, 0x6f, 0x60, 0x27, 0xff, 0x76, 0x63, 0x1a, 0xff,
+  0x57, 0x55, 0x50, 0xff, 0x66, 0x5b, 0x35, 0xff, 0x5b, 0x53, 0x3b, 0xff, 0x6c, 0x5a, 0x18, 0xff, 0x61, 0x54, 0x2a, 0xff, 0x5a, 0x4e, 0x29, 0xff,
+  0x62, 0x52, 0x15, 0xff, 0x52, 0x47, 0x27, 0xff, 0x5a, 0x4a, 0x13, 0xff, 0x53, 0x44, 0x12, 0xff, 0x4b, 0x40, 0x1f, 0xff, 0x4a, 0x3d, 0x10, 0xff,
+  0x44, 0x39, 0x1d, 0xff, 0x42, 0x36, 0x0e, 0xff, 0x3b, 0x30, 0x0d, 0xff, 0x33, 0x29, 0x0d, 0xff, 0x2b, 0x23, 0x0d, 0xff, 0x2b, 0x22, 0x04, 0xff,
+  0x22, 0x1b, 0x07, 0xff, 0x18, 0x13, 0x04, 0xff, 0x02, 0x02, 0x01, 0xff, 0x51, 0x4b, 0x3d, 0xff, 0x4a, 0x43, 0x3c, 0xff, 0x45, 0x3d, 0x33, 0xff,
+  0x46, 0x3d, 0x2b, 0xff, 0x3c, 0x34, 0x2b, 0xff, 0x3c, 0x32, 0x1c, 0xff, 0x32, 0x2a, 0x21, 0xff, 0x29, 0x23, 0x1f, 0xff, 0x21, 0x1b, 0x11, 0xff,
+  0x18, 0x13, 0x0b, 0xff, 0x11, 0x0d, 0x0c, 0xff, 0x10, 0x0c, 0x03, 0xff, 0x0c, 0x09, 0x03, 0xff, 0x08, 0x06, 0x02, 0xff, 0x42, 0x3c, 0x3e, 0xff,
+  0x3c, 0x35, 0x37, 0xff, 0x18, 0x13, 0x13, 0xff, 0x0d, 0x09, 0x09, 0xff, 0x1f, 0x1a, 0x1d, 0xff, 0x4d, 0x4b, 0x4e, 0xff, 0x32, 0x2d, 0x36, 0xff,
+  0x14, 0x11, 0x1a, 0xff, 0x88, 0x04, 0x00, 0x00, 0x33, 0x1d, 0x00, 0x00, 0xf9, 0x35, 0x00, 0x00, 0x1c, 0x50, 0x00, 0x00, 0x97, 0x68, 0x00, 0x00,
+  0x38, 0x80, 0x00, 0x00, 0xa0, 0x97, 0x00, 0x00, 0xd6, 0xac, 0x00, 0x00, 0x3c, 0xc0, 0x00, 0x00, 0xc4, 0xd2, 0x00, 0x00, 0x9c, 0xe6, 0x00, 0x00,
+  0xf5, 0xfa, 0x00, 0x00, 0x08, 0x0e, 0x01, 0x00, 0x99, 0x20, 0x01, 0x00, 0x65, 0x30, 0x01, 0x00, 0xcd, 0x3f, 0x01, 0x00, 0x5f, 0x4f, 0x01, 0x00,
+  0x02, 0x61, 0x01, 0x00, 0x9d, 0x73, 0x01, 0x00, 0x90, 0x84, 0x01, 0x00, 0x99, 0x97, 0x01, 0x00, 0xc9, 0xab, 0x01, 0x00, 0x52, 0xc0, 0x01, 0x00,
+  0xb2, 0xd5, 0x01, 0x00, 0x93, 0xe9, 0x01, 0x00, 0x39, 0xff, 0x01, 0x00, 0x68, 0x14, 0x02, 0x00, 0x3d, 0x2b, 0x02, 0x00, 0x4d, 0x40, 0x02, 0x00,
+  0xe4, 0x53, 0x02, 0x00, 0xc7, 0x64, 0x02, 0x00, 0xf0, 0x21, 0x46, 0x43, 0x10, 0x20, 0x03, 0x8f, 0x07, 0x29, 0x09, 0x03, 0x18, 0x3f, 0x2e, 0x48,
+  0x48, 0x48, 0x48, 0x45, 0x45, 0x32, 0x07, 0x18, 0x3f, 0x3f, 0x44, 0x44, 0x44, 0x45, 0x44, 0x3f, 0x32, 0x48, 0x48, 0x3f, 0x14, 0x0c, 0x44, 0x48,
+  0x48, 0x48, 0x43, 0x3f, 0x48, 0x48, 0x45, 0x32, 0x43, 0x45, 0x23, 0x00, 0x00, 0x24, 0x00, 0xf0, 0x56, 0x3f, 0x17, 0x32, 0x45, 0x45, 0x45, 0x43,
+  0x32, 0x29, 0x07, 0x3f, 0x3f, 0x45, 0x45, 0x45, 0x45, 0x3f, 0x02, 0x97, 0x3f, 0x34, 0x1b, 0x2e, 0x03, 0x02, 0x88, 0x00, 0x00, 0x00, 0x03, 0x2e,
+  0x97, 0x7e, 0x03, 0x37, 0x3f, 0x04, 0x0c, 0x37, 0x3e, 0x37, 0x3e, 0x37, 0x2c, 0x07, 0x37, 0x41, 0x41, 0x41, 0x3e, 0x3e, 0x3e, 0x35, 0x37, 0x09,
+  0x14, 0x37, 0x3f, 0x1e, 0x02, 0x03, 0x37, 0x32, 0x2c, 0x20, 0x07, 0x20, 0x20, 0x04, 0x20, 0x37, 0x2c, 0x37, 0x37, 0x3e, 0x3e, 0x3b, 0x3e, 0x3b,
+  0x3e, 0x35, 0x35, 0x35, 0x35, 0x0e, 0x35, 0x37, 0x37, 0x18, 0x1e, 0x2c, 0x35, 0x35, 0x2d, 0x27, 0x0f, 0x1f, 0x31, 0x35, 0x3b, 0x3b, 0x19, 0x00,
+  0xf0, 0x03, 0x3e, 0x3e, 0x35, 0x35, 0x2c, 0x35, 0x1e, 0x0a, 0x0a, 0x1e, 0x25, 0x2c, 0x35, 0x2c, 0x2d, 0x2c, 0x2d, 0x2c, 0x05, 0x00, 0xf2, 0x66,
+  0x35, 0x2d, 0x1f, 0x27, 0x27, 0x25, 0x14, 0x14, 0x14, 0x97, 0x78, 0x8b, 0x02, 0x0e, 0x13, 0x13, 0x08, 0x94, 0x86, 0x6c, 0x78, 0x87, 0x93, 0x93,
+  0x8e, 0x8e, 0x8a, 0x7f, 0x85, 0x7d, 0x67, 0x54, 0x52, 0x54, 0x5b, 0x5e, 0x5c, 0x66, 0x66, 0x5c, 0x6f, 0x72, 0x80, 0x83, 0x91, 0x93, 0x93, 0x8a,
+  0x8a, 0x91, 0x91, 0x7b, 0x7b, 0x7b, 0x72, 0x66, 0x67, 0x7b, 0x7b, 0x77, 0x77, 0x7a, 0x83, 0x83, 0x85, 0x89, 0x7c, 0x78, 0x5b, 0x5b, 0x73, 0x78,
+  0x79, 0x6e, 0x6a, 0x5f, 0x58, 0x56, 0x5a, 0x60, 0x62, 0x62, 0x60, 0x5a, 0x5e, 0x58, 0x5f, 0x72, 0x89, 0x95, 0x05, 0x0e, 0x1f, 0x1f, 0x1f, 0x18,
+  0x1f, 0x18, 0x14, 0x71, 0x5e, 0x68, 0x5b, 0x68, 0x71, 0x64, 0x67, 0x8b, 0x97, 0x97, 0x98, 0x68, 0x5b, 0x5b, 0x57, 0x5b, 0x57, 0x01, 0x00, 0xb1,
+  0x5b, 0x5b, 0x5b, 0x5b, 0x64, 0x61, 0x64, 0x65, 0x68, 0x68, 0x6d, 0x02, 0x00, 0x60, 0x68, 0x68, 0x68, 0x64, 0x64, 0x64, 0x21, 0x00, 0x00, 0x01,
+  0x00, 0x01, 0x21, 0x00, 0x71, 0x57, 0x5b, 0x5b, 0x5e, 0x5e, 0x5e, 0x5b, 0x06, 0x00, 0x30, 0x5e, 0x5e, 0x5f, 0x02, 0x00, 0xe0, 0x64, 0x67, 0x67,
+  0x6d, 0x71, 0x71, 0x75, 0x75, 0x75, 0x71, 0x71, 0x71, 0x75, 0x78, 0x01, 0x00, 0xd0, 0x7c, 0x7d, 0x7d, 0x81, 0x81, 0x81, 0x86, 0x81, 0x86, 0x86,
+  0x86, 0x86, 0x8b, 0x02, 0x00, 0x11, 0x02, 0x04, 0x00, 0x01, 0x02, 0x00, 0x20, 0x02, 0x8f, 0x02, 0x00, 0x63, 0x8b, 0x8f, 0x8b, 0x8f, 0x02, 0x8f,
+  0x01, 0x00, 0x70, 0x03, 0x8f, 0x03, 0x8f, 0x94, 0x03, 0x97, 0x02, 0x00, 0xb1, 0x94, 0x03, 0x97, 0x04, 0x97, 0x04, 0x95, 0x04, 0x97, 0x04, 0x9a,
+  0x02, 0x00, 0x20, 0x04, 0x07, 0x03, 0x00, 0x34, 0x07, 0x04, 0x07, 0x01, 0x00, 0x16, 0x09, 0x02, 0x00, 0xc1, 0x46, 0x45, 0x29, 0x11, 0x20, 0x11,
+  0x3f, 0x1b, 0x03, 0x03, 0x04, 0x34, 0xbd, 0x01, 0x51, 0x45, 0x3f, 0x07, 0x04, 0x17, 0xe0, 0x01, 0xd0, 0x44, 0x45, 0x3f, 0x17, 0x45, 0x45, 0x22,
+  0x02, 0x07, 0x45, 0x45, 0x45, 0x48, 0x1c, 0x00, 0x20, 0x45, 0x1b, 0xcc, 0x01, 0x00, 0x25, 0x00, 0xf1, 0x0b, 0x43, 0x1e, 0x20, 0x37, 0x45, 0x3f,
+  0x43, 0x3f, 0x45, 0x3f, 0x3f, 0x97, 0x11, 0x3f, 0x45, 0x43, 0x3f, 0x43, 0x3f, 0x1b, 0x2e, 0x45, 0x3f, 0x3f, 0x15, 0x00, 0x01, 0x00, 0xf0, 0x03,
+  0x11, 0x32, 0x02, 0x00, 0x00, 0x32, 0x3f, 0x3f, 0x37, 0x37, 0x41, 0x37, 0x3e, 0x32, 0x1e, 0x03, 0x2c, 0x37, 0xdf, 0x01, 0xf2, 0x09, 0x37, 0x32,
+  0x2c, 0x32, 0x2c, 0x32, 0x37, 0x25, 0x03, 0x1e, 0x37, 0x2c, 0x29, 0x11, 0x02, 0x1e, 0x11, 0x03, 0x17, 0x32, 0x2c, 0x18, 0x1e, 0x35, 0xe0, 0x01,
+  0x00, 0x02, 0x00, 0x40, 0x37, 0x3e, 0x37, 0x25, 0xe0, 0x01, 0x60, 0x35, 0x2d, 0x2d, 0x27, 0x2d, 0x3b, 0xdc, 0x01, 0xc1, 0x3e, 0x3e, 0x41, 0x3b,
+  0x37, 0x1e, 0x2c, 0x2c, 0x2c, 0x02, 0x8f, 0x1e, 0xdf, 0x01, 0x20, 0x27, 0x25, 0xe3, 0x01, 0x10, 0x2d, 0x22, 0x00, 0xf1, 0x67, 0x25, 0x25, 0x7e,
+  0x00, 0x11, 0x10, 0x78, 0x86, 0x98, 0x14, 0x18, 0x13, 0x09, 0x99, 0x8f, 0x67, 0x86, 0x91, 0x99, 0x93, 0x8e, 0x8a, 0x8e, 0x8e, 0x91, 0x82, 0x5e,
+  0x54, 0x5b, 0x64, 0x6d, 0x68, 0x60, 0x6a, 0x6b, 0x6a, 0x6e, 0x77, 0x7a, 0x77, 0x7a, 0x8a, 0x8a, 0x83, 0x87, 0x87, 0x7a, 0x6a, 0x73, 0x72, 0x6a,
+  0x67, 0x6a, 0x6f, 0x77, 0x72, 0x72, 0x77, 0x7a, 0x77, 0x80, 0x74, 0x81, 0x8b, 0x7d, 0x81, 0x8b, 0x8b, 0x85, 0x7c, 0x79, 0x6c, 0x67, 0x62, 0x67,
+  0x6a, 0x72, 0x72, 0x76, 0x71, 0x64, 0x5e, 0x5f, 0x72, 0x89, 0x8e, 0x93, 0x0b, 0x13, 0x1f, 0x18, 0x0e, 0x14, 0x0e, 0x0c, 0x92, 0x64, 0x5b, 0x5e,
+  0x64, 0x64, 0x64, 0x81, 0x8b, 0x86, 0x86, 0x7d, 0x64, 0x57, 0x57, 0xaa, 0x57, 0xaa, 0x54, 0x52, 0x52, 0x54, 0x54, 0xe3, 0x01, 0x80, 0x57, 0x5b,
+  0x5e, 0x64, 0x65, 0x68, 0x69, 0x6d, 0x02, 0x00, 0x31, 0x68, 0x6d, 0x68, 0xdf, 0x01, 0x40, 0x57, 0x5b, 0x5b, 0x64, 0xe2, 0x01, 0x30, 0x5b, 0x5b,
+  0x64, 0x38, 0x00, 0x40, 0x64, 0x5b, 0x5b, 0x58, 0xe2, 0x01, 0xc3, 0x5b, 0x64, 0x64, 0x64, 0x67, 0x67, 0x64, 0x67, 0x68, 0x6c, 0x68, 0x71, 0x01,
+  0x00, 0x96, 0x75, 0x75, 0x78, 0x75, 0x75, 0x75, 0x78, 0x7c, 0x7d, 0xdf, 0x01, 0x30, 0x02, 0x86, 0x8b, 0x09, 0x00, 0x02, 0xe7, 0x01, 0x01, 0x02,
+  0x00, 0x02, 0x03, 0x00, 0x20, 0x8b, 0x8d, 0xe3, 0x01, 0x01, 0xe5, 0x01, 0x43, 0x03, 0x8f, 0x03, 0x94, 0xe1, 0x01, 0x91, 0x95, 0x97, 0x03, 0x95,
+  0x97, 0x95, 0x04, 0x97, 0x95, 0xde, 0x01, 0x15, 0x04, 0xde, 0x01, 0x01, 0x06, 0x00, 0x10, 0x04, 0xd7, 0x01, 0x05, 0x02, 0x00, 0xd0, 0x45, 0x3f,
+  0x20, 0x09, 0x1e, 0x45, 0x46, 0x1b, 0x15, 0x20, 0x2e, 0x3f, 0x3a, 0xbb, 0x01, 0x51, 0x45, 0x48, 0x34, 0x17, 0x0c, 0xe0, 0x01, 0xc1, 0x45, 0x44,
+  0x44, 0x3f, 0x44, 0x43, 0x1b, 0x11, 0x3f, 0x3f, 0x3f, 0x32, 0xd6, 0x01, 0x52, 0x48, 0x48, 0x32, 0x1b, 0x17, 0xe1, 0x01, 0xf1, 0x17, 0x45, 0x45,
+  0x3f, 0x3f, 0x2e, 0x37, 0x43, 0x3f, 0x43, 0x45, 0x3f, 0x29, 0x2e, 0x3f, 0x45, 0x3f, 0x45, 0x45, 0x3a, 0x44, 0x43, 0x45, 0x34, 0x04, 0x02, 0x02,
+  0x00, 0x00, 0x00, 0x02, 0x32, 0x3a, 0x02, 0x86, 0x02, 0x2c, 0x3f, 0x41, 0xd7, 0x01, 0xf1, 0x14, 0x32, 0x03, 0x7e, 0x0c, 0x37, 0x41, 0x3e, 0x37,
+  0x37, 0x35, 0x1e, 0x14, 0x1e, 0x20, 0x37, 0x37, 0x37, 0x2c, 0x32, 0x37, 0x29, 0x07, 0x97, 0x02, 0x17, 0x11, 0x11, 0x17, 0x04, 0x0c, 0x25, 0x25,
+  0x3b, 0x35, 0x35, 0xdd, 0x01, 0x00, 0x02, 0x00, 0x40, 0x37, 0x2c, 0x25, 0x25, 0xa0, 0x03, 0x41, 0x27, 0x2d, 0x35, 0x35, 0xdf, 0x01, 0xd0, 0x37,
+  0x3e, 0x41, 0x3e, 0x3b, 0x2c, 0x2c, 0x0a, 0x18, 0x11, 0x1e, 0x25, 0x35, 0xe1, 0x01, 0x24, 0x1e, 0x27, 0xdf, 0x01, 0xf0, 0x65, 0x1f, 0x25, 0x25,
+  0x00, 0x79, 0x15, 0x1b, 0x98, 0x81, 0x8b, 0x9a, 0x11, 0x0b, 0x9a, 0x05, 0x0b, 0x0a, 0x8f, 0x0b, 0x13, 0x0b, 0x93, 0x8a, 0x91, 0x05, 0x07, 0x8b,
+  0x5e, 0x5b, 0x76, 0x76, 0x70, 0x69, 0x6b, 0x66, 0x6b, 0x74, 0x6b, 0x72, 0x72, 0x77, 0x83, 0x8a, 0x83, 0x7a, 0x7b, 0x74, 0x72, 0x5f, 0x62, 0x6e,
+  0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x72, 0x77, 0x77, 0x7a, 0x72, 0x72, 0x7a, 0x81, 0x85, 0x81, 0x92, 0x81, 0x71, 0x7c, 0x81, 0x74, 0x7a, 0x7c, 0x7b,
+  0x7b, 0x72, 0x7b, 0x7b, 0x7c, 0x71, 0x5f, 0x67, 0x6c, 0x7f, 0x91, 0x93, 0x99, 0x0b, 0x13, 0x13, 0x0e, 0x9a, 0x97, 0x9a, 0x9a, 0x98, 0x82, 0x64,
+  0x64, 0x57, 0x68, 0x75, 0x7c, 0x75, 0x71, 0x6d, 0x68, 0x5b, 0x54, 0x54, 0x54, 0x54, 0x52, 0x52, 0xa2, 0xe1, 0x01, 0x77, 0x54, 0x52, 0x54, 0x52,
+  0x54, 0x57, 0x57, 0xc2, 0x03, 0x92, 0x6d, 0x64, 0x64, 0x5b, 0x54, 0x57, 0x57, 0x5b, 0x64, 0xe1, 0x01, 0xf0, 0x11, 0x64, 0x64, 0x68, 0x64, 0x68,
+  0x64, 0x64, 0x5f, 0x5b, 0x5b, 0x5b, 0x5f, 0x64, 0x64, 0x64, 0x68, 0x6c, 0x6d, 0x6d, 0x6d, 0x6c, 0x68, 0x6c, 0x68, 0x6c, 0x6c, 0x71, 0x6c, 0x71,
+  0x71, 0x6c, 0x6c, 0xe1, 0x01, 0x51, 0x71, 0x75, 0x71, 0x78, 0x78, 0xc1, 0x03, 0x01, 0xe1, 0x01, 0x31, 0x86, 0x86, 0x86, 0xec, 0x01, 0x04, 0x0d,
+  0x00, 0x00, 0xe9, 0x01, 0x11, 0x02, 0xeb, 0x01, 0x10, 0x02, 0xe6, 0x01, 0x06, 0xe1, 0x01, 0x01, 0x02, 0x00, 0x01, 0xe2, 0x01, 0x40, 0x04, 0x95,
+  0x95, 0x95, 0xc7, 0x03, 0x00, 0xe3, 0x01, 0x00, 0xd7, 0x01, 0x00, 0xdd, 0x01, 0x01, 0xed, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x10, 0x00, 0x01, 0xdf,
+  0x01, 0xe0, 0x07, 0x29, 0x14, 0x04, 0x04, 0x04, 0x3f, 0x43, 0x48, 0x46, 0x20, 0x43, 0x3f, 0x46, 0xb9, 0x01, 0x72, 0x48, 0x48, 0x48, 0x3f, 0x32,
+  0x43, 0x32, 0xe1, 0x01, 0x00, 0xb9, 0x03, 0x50, 0x45, 0x48, 0x29, 0x0c, 0x34, 0xd4, 0x01, 0x62, 0x48, 0x48, 0x45, 0x22, 0x20, 0x2e, 0xe0, 0x01,
+  0xf0, 0x18, 0x48, 0x45, 0x3f, 0x43, 0x45, 0x3a, 0x3f, 0x29, 0x3f, 0x48, 0x45, 0x48, 0x3f, 0x45, 0x43, 0x45, 0x43, 0x3f, 0x2e, 0x3f, 0x3f, 0x3f,
+  0x29, 0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x11, 0x3f, 0x3f, 0x1b, 0x20, 0x29, 0x32, 0x3f, 0x41, 0x3f, 0xdf, 0x01, 0x40, 0x2c, 0x02, 0x7e, 0x04,
+  0xa8, 0x05, 0x80, 0x2c, 0x20, 0x1e, 0x11, 0x04, 0x14, 0x25, 0x29, 0x94, 0x05, 0xe0, 0x20, 0x02, 0x81, 0x03, 0x11, 0x29, 0x11, 0x8f, 0x7e, 0x03,
+  0x2c, 0x3e, 0x35, 0x3b, 0xdb, 0x01, 0xf0, 0x07, 0x2c, 0x37, 0x2c, 0x35, 0x2c, 0x37, 0x25, 0x2c, 0x17, 0x1e, 0x25, 0x25, 0x2c, 0x1f, 0x2c, 0x2c,
+  0x3b, 0x3e, 0x3e, 0x35, 0x25, 0x2c, 0x38, 0x00, 0xb0, 0x41, 0x41, 0x35, 0x3e, 0x14, 0x11, 0x1e, 0x37, 0x3e, 0x35, 0x37, 0xaa, 0x05, 0x20, 0x2c,
+  0x2d, 0x03, 0x00, 0xf0, 0x2b, 0x2d, 0x27, 0x2c, 0x0e, 0x13, 0x25, 0x14, 0x79, 0x0a, 0x9b, 0x6c, 0x67, 0x86, 0x7c, 0x8b, 0x92, 0x79, 0x00, 0x9a,
+  0x94, 0x00, 0x99, 0x13, 0x0b, 0x08, 0x88, 0x8a, 0x08, 0x0b, 0x9b, 0x78, 0x5f, 0x82, 0x82, 0x72, 0x6b, 0x6f, 0x77, 0x7b, 0x77, 0x72, 0x6f, 0x72,
+  0x7a, 0x83, 0x82, 0x77, 0x72, 0x72, 0x6a, 0x6c, 0x6d, 0x71, 0x6d, 0x67, 0x67, 0x6a, 0x71, 0xa1, 0x05, 0xf0, 0x18, 0x72, 0x6e, 0x6a, 0x78, 0x7b,
+  0x7d, 0x6e, 0x78, 0x78, 0x71, 0x75, 0x89, 0x86, 0x89, 0x89, 0x83, 0x74, 0x6e, 0x83, 0x81, 0x71, 0x64, 0x64, 0x68, 0x78, 0x8c, 0x9a, 0x0b, 0x08,
+  0x05, 0x05, 0x07, 0x95, 0x6e, 0x79, 0x92, 0x89, 0x82, 0x75, 0xae, 0x01, 0x40, 0x64, 0x5f, 0x64, 0x5b, 0xdb, 0x01, 0x41, 0x52, 0x52, 0x52, 0xa2,
+  0x01, 0x00, 0x00, 0x0a, 0x00, 0x50, 0x54, 0x54, 0x54, 0x5b, 0x5b, 0x99, 0x05, 0x30, 0x6d, 0x6d, 0x6d, 0xe1, 0x01, 0x10, 0x68, 0xc0, 0x03, 0x00,
+  0xb4, 0x03, 0x01, 0x01, 0x00, 0x10, 0x67, 0xf3, 0x01, 0x00, 0xb4, 0x05, 0x41, 0x67, 0x68, 0x6d, 0x6d, 0xaf, 0x03, 0x60, 0x71, 0x75, 0x6c, 0x71,
+  0x6c, 0x6c, 0xda, 0x01, 0xd1, 0x71, 0x71, 0x6c, 0x6d, 0x71, 0x6e, 0x71, 0x6c, 0x71, 0x6e, 0x71, 0x71, 0x78, 0xe2, 0x01, 0x01, 0xe4, 0x01, 0x01,
+  0x01, 0x00, 0x11, 0x7d, 0x01, 0x00, 0x00, 0x09, 0x00, 0x01, 0x15, 0x00, 0x00, 0xe6, 0x01, 0x01, 0xd0, 0x03, 0x00, 0xc7, 0x03, 0x01, 0xb2, 0x05,
+  0x00, 0xe4, 0x01, 0x00, 0xe0, 0x01, 0x10, 0x94, 0xc0, 0x03, 0x01, 0xdd, 0x01, 0x00, 0xdf, 0x01, 0x04, 0x01, 0x00, 0x00, 0xe9, 0x01, 0x30, 0x97,
+  0x04, 0x97, 0xe8, 0x01, 0x00, 0xde, 0x01, 0x00, 0xe5, 0x01, 0xd3, 0x04, 0x07, 0x04, 0x03, 0x03, 0x04, 0x04, 0x07, 0x3f, 0x11, 0x43, 0x45, 0x34,
+  0xbf, 0x03, 0x91, 0x45, 0x48, 0x43, 0x17, 0x43, 0x45, 0x20, 0x3f, 0x45, 0xdf, 0x01, 0x00, 0xcd, 0x01, 0x30, 0x45, 0x43, 0x32, 0x1a, 0x00, 0x00,
+  0xfc, 0x01, 0x22, 0x3f, 0x2e, 0xaa, 0x05, 0x02, 0xc0, 0x03, 0x41, 0x3f, 0x3f, 0x3f, 0x43, 0x10, 0x00, 0xa0, 0x44, 0x43, 0x3f, 0x1b, 0x03, 0x20,
+  0x45, 0x29, 0x1b, 0x00, 0xc0, 0x03, 0xf0, 0x1f, 0x20, 0x3f, 0x3f, 0x3f, 0x20, 0x07, 0x03, 0x03, 0x37, 0x3f, 0x3e, 0x41, 0x3e, 0x3e, 0x37, 0x20,
+  0x00, 0x7e, 0x03, 0x37, 0x3e, 0x37, 0x35, 0x29, 0x07, 0x0a, 0x02, 0x00, 0x07, 0x20, 0x11, 0x11, 0x20, 0x2c, 0x29, 0x0a, 0x8b, 0x7e, 0x81, 0x02,
+  0x20, 0x97, 0x86, 0x14, 0x37, 0x3e, 0x7f, 0x07, 0x00, 0xb8, 0x03, 0xf0, 0x09, 0x18, 0x18, 0x1e, 0x25, 0x1e, 0x10, 0x9a, 0x07, 0x25, 0x2c, 0x2c,
+  0x2c, 0x2c, 0x1e, 0x18, 0x37, 0x3e, 0x3e, 0x2c, 0x18, 0x37, 0x37, 0x37, 0x3b, 0xba, 0x07, 0xc0, 0x41, 0x3e, 0x11, 0x04, 0x2c, 0x3e, 0x3b, 0x3b,
+  0x2c, 0x25, 0x2c, 0x35, 0x9f, 0x05, 0xf2, 0x5e, 0x3b, 0x35, 0x2d, 0x35, 0x27, 0x25, 0x0e, 0x11, 0x0e, 0x07, 0x14, 0x7d, 0x02, 0x8f, 0x97, 0x5f,
+  0x75, 0x7d, 0x5e, 0x73, 0x86, 0x97, 0x8b, 0x89, 0x0b, 0x18, 0x0b, 0x05, 0x05, 0x05, 0x05, 0x98, 0x8b, 0x67, 0x82, 0x91, 0x8a, 0x83, 0x87, 0x8c,
+  0x77, 0x74, 0x6e, 0x5c, 0x6b, 0x77, 0x77, 0x77, 0x66, 0x6f, 0x6a, 0x66, 0x6c, 0x71, 0x67, 0x5b, 0x56, 0x57, 0x67, 0x68, 0x68, 0x6e, 0x75, 0x74,
+  0x6c, 0x5f, 0x64, 0x6d, 0x68, 0x7d, 0x67, 0x71, 0x78, 0x64, 0x67, 0x82, 0x87, 0x89, 0x83, 0x7a, 0x83, 0x8d, 0x97, 0x78, 0x64, 0x57, 0x64, 0x5b,
+  0x6d, 0x78, 0x92, 0x0a, 0x08, 0x95, 0x8e, 0x91, 0x97, 0x81, 0x82, 0x7b, 0x6a, 0x60, 0x60, 0x64, 0x56, 0x54, 0x57, 0x5b, 0x5b, 0xdd, 0x01, 0x02,
+  0x01, 0x00, 0x10, 0xa2, 0xc3, 0x03, 0x00, 0xa5, 0x05, 0x45, 0x5b, 0x5b, 0x68, 0x61, 0xbf, 0x03, 0x01, 0xc1, 0x03, 0x20, 0x64, 0x64, 0xf1, 0x01,
+  0x00, 0x01, 0x00, 0x00, 0xc6, 0x01, 0x10, 0x6d, 0x4f, 0x02, 0x01, 0xdc, 0x01, 0x02, 0x6d, 0x07, 0x11, 0x78, 0x79, 0x07, 0x10, 0x73, 0x19, 0x00,
+  0xf0, 0x03, 0x6c, 0x6d, 0x6c, 0x67, 0x6c, 0x6e, 0x6d, 0x71, 0x71, 0x73, 0x75, 0x78, 0x78, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x03, 0x00, 0x40, 0x7d,
+  0x7c, 0x7c, 0x7c, 0x28, 0x00, 0x00, 0x2b, 0x00, 0x31, 0x78, 0x75, 0x73, 0xfb, 0x01, 0x02, 0xe3, 0x01, 0x00, 0x01, 0x00, 0x02, 0xcc, 0x03, 0x00,
+  0xe1, 0x01, 0x11, 0x8f, 0xe1, 0x01, 0x00, 0x9f, 0x05, 0x01, 0xc0, 0x03, 0x00, 0xd3, 0x01, 0x00, 0xd9, 0x01, 0x01, 0x02, 0x00, 0x30, 0x95, 0x97,
+  0x03, 0x0e, 0x00, 0x00, 0x8f, 0x07, 0x04, 0x01, 0x00, 0x90, 0x95, 0x04, 0x06, 0x09, 0x03, 0x18, 0x1e, 0x2e, 0x45, 0x8e, 0x03, 0x01, 0xba, 0x01,
+  0x71, 0x32, 0x3f, 0x17, 0x17, 0x3f, 0x45, 0x29, 0xc0, 0x03, 0x10, 0x45, 0x5a, 0x09, 0x20, 0x37, 0x3f, 0x17, 0x00, 0x00, 0xd4, 0x01, 0x40, 0x43,
+  0x48, 0x48, 0x17, 0x09, 0x00, 0x00, 0x0c, 0x00, 0x70, 0x45, 0x3f, 0x43, 0x17, 0x3a, 0x3f, 0x43, 0xe2, 0x03, 0x00, 0xf8, 0x01, 0xf0, 0x08, 0x3f,
+  0x10, 0x17, 0x32, 0x45, 0x32, 0x32, 0x03, 0x97, 0x02, 0x00, 0x03, 0x37, 0x3f, 0x3f, 0x11, 0x03, 0x00, 0x7e, 0x02, 0x2c, 0x41, 0x3f, 0xe0, 0x01,
+  0xf0, 0x10, 0x1e, 0x7e, 0x7e, 0x0c, 0x3e, 0x3f, 0x3e, 0x32, 0x11, 0x02, 0x81, 0x00, 0x81, 0x97, 0x32, 0x20, 0x11, 0x07, 0x1e, 0x29, 0x02, 0x81,
+  0x81, 0x7e, 0x97, 0x0a, 0x0a, 0x03, 0x2c, 0x37, 0x3e, 0x97, 0x05, 0xf0, 0x04, 0x3e, 0x2c, 0x17, 0x04, 0x81, 0x7e, 0x97, 0x03, 0x8b, 0x81, 0x6c,
+  0x07, 0x25, 0x2c, 0x35, 0x35, 0x14, 0x03, 0x18, 0xfa, 0x03, 0x50, 0x25, 0x2c, 0x1e, 0x18, 0x25, 0xe0, 0x01, 0xb0, 0x3e, 0x3e, 0x11, 0x00, 0x2c,
+  0x3e, 0x35, 0x35, 0x25, 0x1f, 0x35, 0xc3, 0x03, 0xf0, 0x27, 0x2d, 0x35, 0x3b, 0x3b, 0x35, 0x2c, 0x18, 0x1e, 0x09, 0x1b, 0x1e, 0x0d, 0x7e, 0x98,
+  0x11, 0x07, 0x67, 0x6d, 0x71, 0x7c, 0x9b, 0x98, 0x9b, 0x7d, 0x79, 0x0a, 0x25, 0x13, 0x18, 0x13, 0x13, 0x13, 0x07, 0x6c, 0x67, 0x97, 0x14, 0x0e,
+  0x0b, 0x99, 0x89, 0x81, 0x86, 0x78, 0x62, 0x6e, 0x77, 0x7a, 0x73, 0x67, 0x7f, 0x79, 0x6f, 0x6c, 0x89, 0x03, 0x00, 0x16, 0x07, 0xf2, 0x20, 0x5f,
+  0x78, 0x78, 0x7c, 0x6c, 0x64, 0x5b, 0x5b, 0x78, 0x6d, 0x6c, 0x68, 0x68, 0x75, 0x81, 0x7f, 0x87, 0x87, 0x88, 0x97, 0x05, 0x9b, 0x8b, 0x68, 0x64,
+  0x52, 0x54, 0x5b, 0x5b, 0x78, 0x99, 0x94, 0x87, 0x7d, 0x7d, 0x7b, 0x82, 0x76, 0x66, 0xa5, 0x55, 0x55, 0x56, 0x53, 0x54, 0x5b, 0x64, 0xbd, 0x03,
+  0x01, 0x95, 0x05, 0x03, 0x0b, 0x00, 0x00, 0x83, 0x07, 0x01, 0xcf, 0x01, 0x00, 0xbe, 0x03, 0x04, 0xc1, 0x03, 0x02, 0x0e, 0x00, 0x30, 0x68, 0x6d,
+  0x68, 0xd7, 0x01, 0x00, 0xda, 0x01, 0x02, 0x01, 0x00, 0x10, 0x73, 0xe0, 0x01, 0x10, 0x7c, 0x01, 0x00, 0x00, 0xba, 0x01, 0xa0, 0x78, 0x71, 0x71,
+  0x6c, 0x67, 0x67, 0x6c, 0x67, 0x6c, 0x6c, 0x22, 0x00, 0x10, 0x73, 0x83, 0x07, 0x03, 0x19, 0x00, 0x37, 0x78, 0x78, 0x73, 0x01, 0x00, 0x61, 0x71,
+  0x73, 0x71, 0x73, 0x78, 0x79, 0xcd, 0x03, 0x01, 0xb3, 0x05, 0x00, 0x04, 0x00, 0x10, 0x86, 0xc7, 0x03, 0x00, 0xe1, 0x01, 0x01, 0xa7, 0x05, 0x30,
+  0x97, 0x03, 0x94, 0xe1, 0x01, 0x00, 0xe3, 0x01, 0x00, 0x68, 0x09, 0x01, 0x02, 0x00, 0x10, 0x95, 0x14, 0x00, 0x31, 0x97, 0x95, 0x9a, 0x0d, 0x00,
+  0x11, 0x9a, 0xee, 0x01, 0xe0, 0x03, 0x97, 0x03, 0x0e, 0x0e, 0x03, 0x32, 0x07, 0x29, 0x32, 0x43, 0x43, 0x48, 0x43, 0xb8, 0x01, 0x91, 0x48, 0x2e,
+  0x29, 0x0d, 0x29, 0x45, 0x20, 0x04, 0x25, 0xe1, 0x01, 0x00, 0xc2, 0x03, 0x30, 0x11, 0x32, 0x45, 0xda, 0x01, 0x0a, 0x01, 0x00, 0x00, 0x32, 0x0b,
+  0x00, 0xc2, 0x03, 0x11, 0x1b, 0xdf, 0x01, 0x70, 0x45, 0x45, 0x3f, 0x32, 0x2e, 0x3f, 0x45, 0xa6, 0x05, 0xa0, 0x00, 0x86, 0x03, 0x3f, 0x44, 0x29,
+  0x11, 0x0d, 0x86, 0x00, 0x81, 0x07, 0xf1, 0x12, 0x3e, 0x41, 0x3e, 0x37, 0x11, 0x7e, 0x02, 0x20, 0x3e, 0x3f, 0x37, 0x1e, 0x86, 0x7e, 0x7e, 0x81,
+  0x07, 0x20, 0x11, 0x0d, 0x02, 0x86, 0x0a, 0x20, 0x03, 0x00, 0x97, 0x07, 0x04, 0x11, 0x32, 0x3e, 0x37, 0x65, 0x07, 0xf0, 0x01, 0x3e, 0x35, 0x32,
+  0x02, 0x79, 0x79, 0x7d, 0x7e, 0x73, 0x73, 0x6c, 0x6c, 0x0b, 0x25, 0x2c, 0x35, 0xa2, 0x07, 0xc0, 0x41, 0x41, 0x41, 0x2c, 0x37, 0x37, 0x25, 0x25,
+  0x35, 0x41, 0x41, 0x3e, 0xe5, 0x03, 0x40, 0x03, 0x2c, 0x35, 0x35, 0x82, 0x07, 0x20, 0x35, 0x3b, 0x03, 0x00, 0xf0, 0x59, 0x3b, 0x35, 0x2d, 0x2c,
+  0x2c, 0x2c, 0x1b, 0x0d, 0x9b, 0x7d, 0x73, 0x9a, 0x14, 0x04, 0x6c, 0x67, 0x7d, 0x0d, 0x14, 0x18, 0x1b, 0x07, 0x02, 0x1e, 0x25, 0x0e, 0x1f, 0x25,
+  0x27, 0x2c, 0x11, 0x00, 0x03, 0x0c, 0x0b, 0x13, 0x13, 0x09, 0x7e, 0x81, 0x9b, 0x7d, 0x6c, 0x7c, 0x04, 0x05, 0x02, 0x04, 0x14, 0x94, 0x79, 0x78,
+  0x79, 0x81, 0x64, 0x6d, 0x68, 0x5e, 0x54, 0x54, 0x67, 0x71, 0x6c, 0x8b, 0x8b, 0x78, 0x64, 0x6d, 0x81, 0x71, 0x71, 0x84, 0x81, 0x7c, 0x7c, 0x86,
+  0x99, 0x99, 0x99, 0x0a, 0x0a, 0x9a, 0x97, 0x8b, 0x68, 0x54, 0x52, 0x57, 0x64, 0x86, 0x0a, 0x04, 0x81, 0x6e, 0x71, 0x6c, 0x76, 0x6f, 0x60, 0x58,
+  0x5a, 0x5c, 0x58, 0x58, 0x0f, 0x0b, 0x50, 0x57, 0x54, 0x57, 0x54, 0x54, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x12, 0x57, 0x06, 0x00, 0x01, 0xdf, 0x01,
+  0x01, 0xd2, 0x01, 0x00, 0x01, 0x00, 0x00, 0xb5, 0x03, 0x00, 0x8b, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x07, 0x00, 0x20, 0x71, 0x6c, 0x07, 0x00, 0x00,
+  0x8c, 0x05, 0x01, 0x03, 0x00, 0x40, 0x71, 0x75, 0x78, 0x7c, 0xa9, 0x03, 0x50, 0x7d, 0x7d, 0x78, 0x78, 0x73, 0xa9, 0x05, 0x00, 0x16, 0x00, 0x10,
+  0x6e, 0xdc, 0x03, 0x04, 0xfb, 0x01, 0x30, 0x7c, 0x78, 0x78, 0xd4, 0x01, 0x00, 0xf4, 0x01, 0xb4, 0x71, 0x73, 0x71, 0x6e, 0x71, 0x6e, 0x6e, 0x71,
+  0x73, 0x75, 0x7c, 0x61, 0x0b, 0x00, 0xb1, 0x05, 0x01, 0xcc, 0x03, 0x00, 0xe2, 0x01, 0x01, 0xc5, 0x03, 0x14, 0x94, 0x69, 0x09, 0x00, 0x89, 0x07,
+  0x01, 0x02, 0x00, 0x41, 0x95, 0x95, 0x94, 0x03, 0x16, 0x00, 0x00, 0xe5, 0x01, 0x20, 0x97, 0x94, 0x0b, 0x00, 0x10, 0x95, 0xe7, 0x03, 0xa4, 0x03,
+  0x20, 0x25, 0x0c, 0x0e, 0x29, 0x1e, 0x11, 0x0c, 0x29, 0xfc, 0x0c, 0x91, 0x32, 0x20, 0x29, 0x11, 0x3f, 0x14, 0x03, 0x07, 0x41, 0x42, 0x0b, 0x84,
+  0x44, 0x45, 0x32, 0x11, 0x29, 0x43, 0x43, 0x32, 0xc4, 0x03, 0x02, 0x01, 0x00, 0x00, 0x95, 0x05, 0x51, 0x37, 0x22, 0x3f, 0x3a, 0x20, 0x81, 0x07,
+  0x00, 0xd9, 0x01, 0x01, 0x03, 0x00, 0x00, 0xf5, 0x01, 0xc1, 0x02, 0x00, 0x0c, 0x3f, 0x32, 0x97, 0x32, 0x3f, 0x07, 0x86, 0x02, 0x20, 0xc0, 0x03,
+  0x60, 0x32, 0x04, 0x7e, 0x02, 0x2c, 0x3f, 0xe7, 0x01, 0xf0, 0x01, 0x81, 0x7e, 0x7e, 0x8f, 0x8f, 0x7e, 0x81, 0x86, 0x7e, 0x7e, 0x0a, 0x07, 0x11,
+  0x20, 0x2c, 0x17, 0xb9, 0x03, 0x01, 0x3b, 0x0b, 0xf0, 0x06, 0x35, 0x37, 0x17, 0x7e, 0x7d, 0x79, 0x81, 0x7d, 0x79, 0x81, 0x6e, 0x73, 0x0c, 0x25,
+  0x35, 0x3e, 0x3e, 0x37, 0x37, 0x2c, 0x37, 0xd8, 0x01, 0x50, 0x37, 0x3e, 0x3e, 0x44, 0x41, 0x25, 0x02, 0x31, 0x3e, 0x41, 0x25, 0xc8, 0x05, 0x00,
+  0x8b, 0x09, 0x10, 0x3b, 0x91, 0x09, 0xf0, 0x5a, 0x35, 0x2c, 0x25, 0x25, 0x18, 0x86, 0x6c, 0x6c, 0x67, 0x00, 0x07, 0x13, 0x1e, 0x0c, 0x78, 0x81,
+  0x97, 0x14, 0x1e, 0x0d, 0x86, 0x02, 0x1e, 0x25, 0x1f, 0x25, 0x1f, 0x2d, 0x2c, 0x18, 0x11, 0x25, 0x0e, 0x04, 0x18, 0x1f, 0x1e, 0x73, 0x8b, 0x9b,
+  0x8b, 0x86, 0x07, 0x25, 0x1f, 0x13, 0x09, 0x1f, 0x04, 0x79, 0x9b, 0x04, 0x9d, 0x8b, 0x7d, 0x78, 0x64, 0x64, 0x68, 0x71, 0x67, 0x02, 0x94, 0x86,
+  0x79, 0x6c, 0x81, 0x85, 0x7c, 0x68, 0x67, 0x6c, 0x71, 0x7e, 0x97, 0x13, 0x0b, 0x0a, 0x97, 0x8f, 0x86, 0x81, 0x8b, 0x71, 0x5b, 0x64, 0x64, 0x71,
+  0x8b, 0x0e, 0x0b, 0x81, 0x6c, 0x64, 0x5f, 0x6e, 0x6a, 0x60, 0x5c, 0x67, 0x6d, 0x68, 0x67, 0x64, 0x57, 0xdc, 0x01, 0x00, 0x01, 0x00, 0x00, 0xb8,
+  0x03, 0x02, 0xdc, 0x01, 0x01, 0x08, 0x0d, 0x00, 0xe0, 0x01, 0x00, 0xdb, 0x01, 0x01, 0x01, 0x00, 0x00, 0x4f, 0x09, 0x00, 0x0f, 0x00, 0x01, 0xe7,
+  0x01, 0x00, 0xa6, 0x01, 0x11, 0x6d, 0x6c, 0x07, 0x00, 0xc0, 0x01, 0x22, 0x75, 0x78, 0xa0, 0x05, 0x10, 0x7c, 0x88, 0x05, 0x70, 0x7c, 0x7d, 0x7d,
+  0x78, 0x7c, 0x78, 0x75, 0xe7, 0x01, 0x60, 0x75, 0x73, 0x75, 0x73, 0x73, 0x73, 0x18, 0x00, 0x00, 0xdd, 0x01, 0x20, 0x78, 0x75, 0xd8, 0x01, 0x00,
+  0xd9, 0x01, 0x00, 0x02, 0x00, 0x70, 0x6e, 0x6c, 0x6e, 0x71, 0x6e, 0x73, 0x75, 0x1a, 0x00, 0x01, 0xe2, 0x01, 0x00, 0x99, 0x07, 0x01, 0xe0, 0x01,
+  0x03, 0xe3, 0x01, 0x00, 0xc4, 0x03, 0x21, 0x94, 0x97, 0xa7, 0x05, 0x00, 0xe7, 0x01, 0x00, 0x06, 0x00, 0x00, 0xd5, 0x03, 0x03, 0x16, 0x00, 0x10,
+  0x94, 0x01, 0x02, 0x10, 0x8d, 0x05, 0x02, 0x00, 0x1e, 0x00, 0xc1, 0x04, 0x2e, 0x32, 0x0d, 0x20, 0x0c, 0x20, 0x3f, 0x3f, 0x1b, 0x15, 0x43, 0xb7,
+  0x01, 0x90, 0x45, 0x45, 0x48, 0x2e, 0x0c, 0x17, 0x37, 0x03, 0x17, 0xdf, 0x01, 0x80, 0x44, 0x3f, 0x45, 0x44, 0x29, 0x07, 0x20, 0x3f, 0x19, 0x00,
+  0x03, 0x01, 0x00, 0x00, 0x6a, 0x09, 0x00, 0x0c, 0x0f, 0x30, 0x48, 0x45, 0x43, 0x17, 0x00, 0x01, 0x0b, 0x00, 0x01, 0xcf, 0x03, 0x01, 0xd1, 0x03,
+  0xf1, 0x1b, 0x43, 0x45, 0x0d, 0x03, 0x32, 0x2e, 0x04, 0x11, 0x3f, 0x3f, 0x17, 0x00, 0x03, 0x3f, 0x3f, 0x41, 0x41, 0x41, 0x37, 0x2c, 0x03, 0x86,
+  0x00, 0x20, 0x37, 0x3f, 0x32, 0x07, 0x7e, 0x81, 0x7e, 0x81, 0x7e, 0x7d, 0x7e, 0x79, 0x8b, 0x79, 0x78, 0x7e, 0x03, 0x1e, 0x2d, 0x09, 0x10, 0x2d,
+  0x5c, 0x09, 0xf0, 0x06, 0x3e, 0x37, 0x35, 0x37, 0x20, 0x02, 0x7e, 0x7d, 0x86, 0x79, 0x79, 0x7d, 0x7d, 0x8b, 0x01, 0x25, 0x35, 0x3b, 0x37, 0x35,
+  0x32, 0xdb, 0x01, 0x02, 0x5d, 0x09, 0x00, 0xa0, 0x05, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x80, 0x3b, 0x35, 0x2c, 0x2c, 0x35, 0x3b, 0x3e, 0x35,
+  0xa2, 0x07, 0xf2, 0x56, 0x99, 0x11, 0x8f, 0x6c, 0x6c, 0x71, 0x73, 0x0c, 0x1e, 0x0e, 0x0b, 0x29, 0x04, 0x73, 0x8f, 0x0c, 0x17, 0x8f, 0x73, 0x79,
+  0x14, 0x25, 0x1e, 0x1f, 0x25, 0x35, 0x2d, 0x2c, 0x25, 0x2c, 0x25, 0x18, 0x14, 0x1f, 0x25, 0x97, 0x81, 0x73, 0x92, 0x02, 0x1e, 0x27, 0x25, 0x04,
+  0x04, 0x0e, 0x1f, 0x09, 0x07, 0x03, 0x11, 0x81, 0x75, 0x6c, 0x67, 0x71, 0x92, 0x7d, 0x07, 0x18, 0x0b, 0x8d, 0x00, 0x7e, 0x75, 0x6c, 0x68, 0x71,
+  0x64, 0x6c, 0x79, 0x73, 0x95, 0x18, 0x14, 0x8b, 0x6c, 0x6e, 0x75, 0x78, 0x71, 0x5b, 0x68, 0x75, 0x6c, 0x73, 0x02, 0x18, 0x18, 0x0c, 0x00, 0x6c,
+  0x71, 0x7d, 0x7e, 0x74, 0x73, 0x7b, 0x76, 0x67, 0x5f, 0x2d, 0x0b, 0x00, 0xde, 0x01, 0x01, 0x99, 0x05, 0x04, 0xe3, 0x01, 0x12, 0x5b, 0xc1, 0x03,
+  0x00, 0xdc, 0x01, 0x00, 0x01, 0x00, 0x10, 0x64, 0x11, 0x0d, 0x20, 0x67, 0x68, 0x02, 0x0d, 0x01, 0xdf, 0x01, 0x02, 0x01, 0x00, 0x10, 0x78, 0xa0,
+  0x01, 0x00, 0xb6, 0x03, 0x09, 0x01, 0x00, 0x10, 0x7c, 0xf8, 0x0e, 0x07, 0x6d, 0x07, 0x00, 0x9a, 0x07, 0x00, 0x92, 0x05, 0x20, 0x6e, 0x6e, 0xe1,
+  0x01, 0x30, 0x6e, 0x6c, 0x6e, 0x88, 0x09, 0x21, 0x6e, 0x6c, 0xbe, 0x05, 0x01, 0x42, 0x0d, 0x00, 0xde, 0x01, 0x15, 0x79, 0xe0, 0x01, 0x20, 0x86,
+  0x02, 0x30, 0x0d, 0x00, 0xe2, 0x01, 0x00, 0xd1, 0x01, 0x00, 0x01, 0x00, 0x20, 0x8b, 0x8f, 0x46, 0x0d, 0x00, 0x0a, 0x00, 0x30, 0x8f, 0x94, 0x8f,
+  0xde, 0x01, 0x10, 0x02, 0x6a, 0x0d, 0x10, 0x02, 0xe5, 0x03, 0x00, 0xa0, 0x07, 0xa0, 0x45, 0x46, 0x3f, 0x43, 0x11, 0x07, 0x34, 0x48, 0x48, 0x34,
+  0x4a, 0x07, 0x01, 0x01, 0x00, 0x62, 0x43, 0x32, 0x11, 0x2e, 0x07, 0x17, 0xa0, 0x05, 0x70, 0x44, 0x3f, 0x3f, 0x29, 0x11, 0x3a, 0x45, 0x5a, 0x0b,
+  0x02, 0x01, 0x00, 0x13, 0x29, 0x26, 0x00, 0x10, 0x45, 0xb7, 0x03, 0x00, 0xca, 0x03, 0x00, 0x0c, 0x00, 0x02, 0xe0, 0x01, 0x10, 0x43, 0x1e, 0x0f,
+  0xd0, 0x3f, 0x34, 0x3f, 0x11, 0x00, 0x04, 0x3f, 0x3f, 0x0d, 0x02, 0x9d, 0x37, 0x3f, 0x98, 0x01, 0xf0, 0x00, 0x2c, 0x00, 0x02, 0x02, 0x37, 0x3e,
+  0x3f, 0x37, 0x97, 0x7e, 0x86, 0x86, 0x81, 0x7e, 0x7e, 0xc0, 0x03, 0xb0, 0x79, 0x02, 0x25, 0x3e, 0x37, 0x35, 0x2c, 0x27, 0x1f, 0x18, 0x27, 0x9d,
+  0x05, 0xf0, 0x02, 0x35, 0x2c, 0x32, 0x37, 0x97, 0x86, 0x86, 0x81, 0x02, 0x7c, 0x00, 0x7c, 0x02, 0x11, 0x25, 0x25, 0x37, 0x44, 0x0d, 0x00, 0x96,
+  0x05, 0x10, 0x37, 0xda, 0x01, 0x00, 0xc0, 0x03, 0x01, 0x05, 0x00, 0x10, 0x3b, 0x97, 0x05, 0xf1, 0x13, 0x35, 0x0e, 0x2c, 0x3b, 0x35, 0x3e, 0x2c,
+  0x2c, 0x25, 0x25, 0x25, 0x18, 0x1b, 0x8b, 0x7c, 0x9d, 0x98, 0x11, 0x25, 0x14, 0x09, 0x2c, 0x2c, 0x9b, 0x9b, 0x0a, 0x0a, 0x9b, 0x73, 0x7e, 0x11,
+  0x1e, 0x1f, 0x09, 0x20, 0x0f, 0xf0, 0x39, 0x2c, 0x0e, 0x18, 0x03, 0x14, 0x25, 0x20, 0x8b, 0x7d, 0x81, 0x04, 0x25, 0x1f, 0x25, 0x99, 0x04, 0x0e,
+  0x1f, 0x04, 0x00, 0x07, 0x14, 0x8b, 0x71, 0x03, 0x9d, 0x0d, 0x81, 0x86, 0x0c, 0x18, 0x18, 0x0e, 0x07, 0x91, 0x86, 0x78, 0x71, 0x68, 0x75, 0x92,
+  0x98, 0x04, 0x14, 0x1e, 0x07, 0x8b, 0x5f, 0x5e, 0x7c, 0x7c, 0x5b, 0x64, 0x03, 0x16, 0x11, 0x11, 0x1e, 0x1f, 0x1f, 0x1e, 0x11, 0x7d, 0x8b, 0x9b,
+  0x07, 0x9a, 0x8f, 0x86, 0x7d, 0x71, 0x64, 0xdb, 0x01, 0x01, 0x02, 0x00, 0x04, 0xda, 0x01, 0x05, 0x01, 0x00, 0x21, 0x5b, 0x5b, 0xb4, 0x03, 0x00,
+  0xb3, 0x03, 0x00, 0x3e, 0x0b, 0x34, 0x5f, 0x64, 0x68, 0xdd, 0x01, 0x01, 0x4a, 0x09, 0x01, 0x9d, 0x01, 0x01, 0x01, 0x00, 0x01, 0x0e, 0x0b, 0x02,
+  0x02, 0x00, 0x01, 0x05, 0x00, 0x00, 0x12, 0x00, 0x00, 0x01, 0x00, 0x01, 0x0e, 0x00, 0x02, 0x78, 0x07, 0x30, 0x6c, 0x6e, 0x6c, 0xdf, 0x01, 0x10,
+  0x73, 0xdb, 0x01, 0x04, 0x01, 0x00, 0x01, 0xa2, 0x05, 0x02, 0xdf, 0x01, 0x11, 0x7c, 0x08, 0x00, 0x01, 0x3e, 0x0d, 0x00, 0xe6, 0x01, 0x01, 0xc3,
+  0x03, 0x30, 0x02, 0x8f, 0x8f, 0x58, 0x0b, 0x00, 0xf2, 0x01, 0x00, 0x01, 0x00, 0x20, 0x02, 0x86, 0xe0, 0x01, 0x00, 0x01, 0x00, 0x00, 0x13, 0x00,
+  0x41, 0x81, 0x86, 0x86, 0x8d, 0xce, 0x03, 0xe0, 0x95, 0x9a, 0x04, 0x48, 0x45, 0x48, 0x43, 0x20, 0x34, 0x2e, 0x48, 0x48, 0x45, 0x3a, 0xac, 0x01,
+  0x00, 0x11, 0x0d, 0x01, 0x07, 0x00, 0x11, 0x3f, 0x22, 0x0d, 0x64, 0x44, 0x45, 0x44, 0x32, 0x17, 0x20, 0x35, 0x0b, 0x00, 0x01, 0x00, 0x11, 0x1b,
+  0x27, 0x00, 0x00, 0x23, 0x00, 0x22, 0x3f, 0x32, 0x16, 0x0f, 0x01, 0xe9, 0x01, 0x00, 0xe0, 0x01, 0x70, 0x44, 0x43, 0x32, 0x43, 0x45, 0x45, 0x44,
+  0x25, 0x0d, 0x71, 0x29, 0x20, 0x04, 0x32, 0x32, 0x32, 0x32, 0xc0, 0x03, 0x21, 0x02, 0x00, 0xe0, 0x01, 0xe1, 0x03, 0x81, 0x00, 0x86, 0x7e, 0x7e,
+  0x7e, 0x7e, 0x02, 0x03, 0x04, 0x11, 0x37, 0x37, 0x32, 0x0b, 0x30, 0x0e, 0x03, 0x25, 0xe3, 0x0e, 0xe0, 0x2c, 0x11, 0x2c, 0x29, 0x17, 0x97, 0x86,
+  0x0c, 0x17, 0x0d, 0x11, 0x0d, 0x8f, 0x0e, 0x80, 0x07, 0x20, 0x3e, 0x2c, 0xdc, 0x01, 0x00, 0xa7, 0x05, 0x00, 0xdb, 0x01, 0x02, 0x01, 0x00, 0x90,
+  0x3b, 0x3e, 0x3b, 0x3b, 0x3b, 0x3b, 0x2c, 0x1f, 0x2c, 0x2e, 0x0f, 0x10, 0x2c, 0xe2, 0x01, 0xf0, 0x45, 0x2c, 0x98, 0x8b, 0x98, 0x86, 0x14, 0x25,
+  0x2c, 0x25, 0x2c, 0x17, 0x7d, 0x78, 0x8b, 0x7c, 0x81, 0x78, 0x07, 0x18, 0x25, 0x25, 0x1f, 0x2c, 0x2d, 0x2c, 0x25, 0x1f, 0x1e, 0x18, 0x14, 0x0a,
+  0x04, 0x14, 0x20, 0x8f, 0x78, 0x79, 0x18, 0x25, 0x27, 0x18, 0x0b, 0x14, 0x1f, 0x25, 0x17, 0x07, 0x09, 0x9b, 0x7d, 0x78, 0x0a, 0x20, 0x07, 0x79,
+  0x73, 0x8f, 0x0c, 0x0c, 0x04, 0x07, 0x09, 0x11, 0x07, 0x78, 0x5f, 0x7c, 0x98, 0x8f, 0x0c, 0x1e, 0x11, 0x71, 0x75, 0x8c, 0x92, 0x98, 0x71, 0x71,
+  0x02, 0x0d, 0x1f, 0x1e, 0x1f, 0xe1, 0x05, 0xa2, 0x18, 0x92, 0x85, 0x0a, 0x0e, 0x13, 0x0b, 0x05, 0x98, 0x8b, 0x9f, 0x05, 0x00, 0x74, 0x07, 0x00,
+  0x93, 0x12, 0x05, 0x01, 0x00, 0x10, 0x64, 0x97, 0x07, 0x01, 0xa4, 0x05, 0x00, 0xe8, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x01, 0x38, 0x0b,
+  0x00, 0x31, 0x0b, 0x10, 0x75, 0xbc, 0x03, 0x00, 0x92, 0x05, 0x03, 0x01, 0x00, 0x02, 0xda, 0x01, 0x00, 0xab, 0x01, 0x02, 0x04, 0x00, 0x00, 0xe1,
+  0x01, 0x00, 0x0f, 0x00, 0x01, 0x0a, 0x00, 0x20, 0x7c, 0x7c, 0x7b, 0x07, 0x01, 0xac, 0x05, 0x31, 0x75, 0x73, 0x6e, 0xbe, 0x03, 0x01, 0x9e, 0x07,
+  0x00, 0xe1, 0x01, 0x00, 0x27, 0x00, 0x01, 0x41, 0x00, 0x00, 0x01, 0x00, 0x00, 0x88, 0x07, 0x00, 0xdf, 0x01, 0x01, 0x4a, 0x0b, 0x11, 0x86, 0xdb,
+  0x01, 0x02, 0x14, 0x00, 0x21, 0x81, 0x81, 0x46, 0x0d, 0x12, 0x86, 0x02, 0x00, 0x10, 0x89, 0x19, 0x00, 0x10, 0x86, 0xa7, 0x07, 0x01, 0x7f, 0x07,
+  0x61, 0x94, 0x48, 0x43, 0x48, 0x45, 0x46, 0x5b, 0x09, 0x02, 0x01, 0x00, 0xa0, 0x43, 0x45, 0x3f, 0x43, 0x48, 0x34, 0x43, 0x48, 0x45, 0x32, 0xdf,
+  0x01, 0x86, 0x44, 0x41, 0x44, 0x37, 0x29, 0x32, 0x1b, 0x3f, 0x20, 0x00, 0x21, 0x48, 0x20, 0x47, 0x0d, 0x60, 0x48, 0x48, 0x45, 0x20, 0x32, 0x29,
+  0xd6, 0x01, 0x21, 0x48, 0x44, 0xff, 0x01, 0x00, 0xa0, 0x05, 0x20, 0x20, 0x07, 0xcb, 0x12, 0xb0, 0x1b, 0x02, 0x03, 0x04, 0x0c, 0x03, 0x02, 0x32,
+  0x17, 0x11, 0x1e, 0x57, 0x05, 0x60, 0x20, 0x1e, 0x07, 0x11, 0x41, 0x3f, 0xe6, 0x10, 0x80, 0x02, 0x86, 0x00, 0x02, 0x03, 0x11, 0x29, 0x32, 0xa0,
+  0x03, 0x80, 0x37, 0x25, 0x18, 0x07, 0x8f, 0x0b, 0x11, 0x35, 0xc6, 0x01, 0xf1, 0x01, 0x25, 0x17, 0x2c, 0x20, 0x25, 0x29, 0x97, 0x17, 0x1e, 0x1e,
+  0x20, 0x14, 0x7e, 0x1e, 0x2c, 0x37, 0x0d, 0x11, 0x00, 0x8f, 0x05, 0x33, 0x37, 0x2c, 0x25, 0xa2, 0x05, 0x10, 0x41, 0xa9, 0x07, 0x01, 0x01, 0x00,
+  0x00, 0x82, 0x07, 0x10, 0x3e, 0x81, 0x05, 0xf0, 0x44, 0x25, 0x2c, 0x32, 0x07, 0x0d, 0x98, 0x8b, 0x11, 0x18, 0x25, 0x1e, 0x1e, 0x0c, 0x8b, 0x6e,
+  0x85, 0x78, 0x79, 0x97, 0x14, 0x25, 0x25, 0x2d, 0x1f, 0x25, 0x0e, 0x09, 0x13, 0x25, 0x25, 0x0e, 0x97, 0x02, 0x81, 0x03, 0x0d, 0x07, 0x73, 0x04,
+  0x1e, 0x27, 0x25, 0x1f, 0x07, 0x04, 0x18, 0x25, 0x17, 0x73, 0x04, 0x97, 0x86, 0x02, 0x1e, 0x27, 0x11, 0x07, 0x03, 0x0d, 0x02, 0x7e, 0x8f, 0x02,
+  0x03, 0x1e, 0x20, 0x7d, 0x64, 0x8c, 0x9b, 0x7e, 0x11, 0x9d, 0x92, 0x6c, 0x6c, 0x78, 0x78, 0x85, 0x81, 0x7d, 0x9a, 0x18, 0x98, 0x14, 0xd0, 0x1f,
+  0x1f, 0x1f, 0x07, 0x78, 0x78, 0x8f, 0x0c, 0x18, 0x13, 0x0e, 0x9d, 0x7c, 0x70, 0x14, 0x02, 0xda, 0x01, 0x00, 0xbb, 0x10, 0x00, 0x94, 0x12, 0x01,
+  0x13, 0x0f, 0x12, 0x64, 0xe1, 0x01, 0x00, 0x0f, 0x00, 0x01, 0xdf, 0x01, 0x51, 0x68, 0x64, 0x64, 0x67, 0x64, 0x49, 0x09, 0x03, 0x01, 0x00, 0x01,
+  0xdf, 0x01, 0x02, 0xe0, 0x01, 0x00, 0xa1, 0x01, 0x03, 0xd5, 0x01, 0x01, 0x02, 0x00, 0x00, 0x01, 0x00, 0x02, 0x06, 0x00, 0x03, 0x01, 0x00, 0x00,
+  0xb3, 0x05, 0x00, 0x68, 0x07, 0x00, 0xec, 0x01, 0x00, 0x96, 0x07, 0x00, 0xc9, 0x03, 0x02, 0x65, 0x09, 0x01, 0x9f, 0x05, 0x01, 0x44, 0x00, 0x04,
+  0x01, 0x00, 0x00, 0x9a, 0x03, 0x03, 0xe9, 0x12, 0x00, 0x01, 0x00, 0x02, 0xe0, 0x01, 0x01, 0x15, 0x00, 0x02, 0x0e, 0x00, 0x00, 0xca, 0x03, 0x10,
+  0x89, 0xde, 0x01, 0x01, 0xb0, 0x05, 0x01, 0x8a, 0x07, 0x30, 0x46, 0x45, 0x46, 0x67, 0x05, 0x00, 0x81, 0x05, 0x01, 0xa7, 0x01, 0x31, 0x3f, 0x29,
+  0x29, 0xb0, 0x10, 0x30, 0x48, 0x48, 0x45, 0xe0, 0x01, 0x60, 0x44, 0x3f, 0x1e, 0x20, 0x07, 0x20, 0x75, 0x07, 0x01, 0x1f, 0x0d, 0x00, 0x22, 0x00,
+  0x00, 0x0c, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x44, 0xfb, 0x03, 0x10, 0x3f, 0xdf, 0x10, 0x03, 0xc0, 0x03, 0x20, 0x2e, 0x03, 0xa4, 0x14, 0x40, 0x20,
+  0x07, 0x02, 0x03, 0xe6, 0x10, 0x40, 0x1e, 0x17, 0x07, 0x29, 0x24, 0x09, 0x30, 0x04, 0x02, 0x07, 0xca, 0x12, 0xa0, 0x32, 0x11, 0x0d, 0x11, 0x1e,
+  0x29, 0x3f, 0x3f, 0x3e, 0x3f, 0x98, 0x03, 0xf0, 0x0d, 0x35, 0x20, 0x03, 0x7e, 0x7e, 0x8f, 0x04, 0x25, 0x37, 0x3b, 0x3e, 0x37, 0x3e, 0x14, 0x0b,
+  0x29, 0x11, 0x11, 0x25, 0x32, 0x14, 0x17, 0x25, 0x2c, 0x20, 0x03, 0x32, 0x35, 0x3b, 0x0b, 0x01, 0x74, 0x07, 0x21, 0x41, 0x25, 0x67, 0x09, 0x00,
+  0xbb, 0x03, 0x00, 0x7c, 0x07, 0x50, 0x3b, 0x3b, 0x39, 0x3b, 0x39, 0x3e, 0x0b, 0xf0, 0x6b, 0x3e, 0x3b, 0x04, 0x09, 0x9a, 0x18, 0x25, 0x32, 0x25,
+  0x17, 0x17, 0x9d, 0x9d, 0x8f, 0x8b, 0x0a, 0x0a, 0x9d, 0x92, 0x78, 0x73, 0x85, 0x9b, 0x9d, 0x11, 0x14, 0x2c, 0x35, 0x35, 0x2c, 0x13, 0x04, 0x09,
+  0x2c, 0x2c, 0x35, 0x07, 0x8b, 0x78, 0x79, 0x86, 0x7d, 0x02, 0x07, 0x1e, 0x18, 0x1e, 0x13, 0x14, 0x04, 0x8b, 0x0c, 0x0d, 0x98, 0x79, 0x03, 0x25,
+  0x25, 0x25, 0x2d, 0x25, 0x1f, 0x25, 0x17, 0x04, 0x9b, 0x02, 0x9b, 0x7e, 0x0e, 0x25, 0x20, 0x86, 0x6d, 0x85, 0x8b, 0x98, 0x98, 0x78, 0x67, 0x6d,
+  0x75, 0x6d, 0x71, 0x7d, 0x82, 0x07, 0x11, 0x1f, 0x1e, 0x18, 0x0e, 0x0a, 0x0e, 0x18, 0x14, 0x7e, 0x71, 0x6c, 0x6c, 0x8f, 0x09, 0x0e, 0x11, 0x8f,
+  0x68, 0x61, 0x61, 0x5b, 0x61, 0x5b, 0x5e, 0x5b, 0x61, 0x61, 0x61, 0x61, 0x65, 0x61, 0x65, 0x61, 0x61, 0xca, 0x01, 0x00, 0xaa, 0x03, 0x01, 0x07,
+  0x00, 0x01, 0xde, 0x01, 0x01, 0x85, 0x07, 0x00, 0x05, 0x00, 0x04, 0xde, 0x01, 0x00, 0x51, 0x07, 0x00, 0x56, 0x07, 0x03, 0x7e, 0x07, 0x03, 0xe6,
+  0x01, 0x06, 0x01, 0x00, 0x01, 0xb1, 0x01, 0x06, 0xb2, 0x01, 0x00, 0x01, 0x00, 0x06, 0x0e, 0x00, 0x00, 0x1b, 0x00, 0x04, 0x70, 0x09, 0x41, 0x6e,
+  0x6c, 0x73, 0x78, 0xe0, 0x01, 0x00, 0x45, 0x00, 0x30, 0x7c, 0x78, 0x79, 0xed, 0x01, 0x01, 0xab, 0x03, 0x21, 0x86, 0x8b, 0xd7, 0x01, 0x00, 0xcf,
+  0x01, 0x00, 0x07, 0x00, 0x03, 0x09, 0x00, 0x02, 0x55, 0x00, 0x00, 0xe1, 0x01, 0x10, 0x86, 0xd4, 0x14, 0x01, 0x01, 0x00, 0xb3, 0x8d, 0x02, 0x02,
+  0x86, 0x48, 0x48, 0x22, 0x45, 0x46, 0x48, 0x46, 0x03, 0x0d, 0xa0, 0x45, 0x45, 0x45, 0x07, 0x97, 0x37, 0x43, 0x43, 0x43, 0x3f, 0x01, 0x00, 0x00,
+  0xe0, 0x01, 0x52, 0x3e, 0x04, 0x18, 0x20, 0x1e, 0xe0, 0x10, 0x04, 0xda, 0x01, 0x01, 0x93, 0x05, 0x01, 0x0f, 0x00, 0x02, 0xd8, 0x01, 0x03, 0x01,
+  0x00, 0xf0, 0x03, 0x44, 0x45, 0x32, 0x3f, 0x3f, 0x45, 0x3f, 0x15, 0x07, 0x03, 0x02, 0x11, 0x00, 0x88, 0x00, 0x04, 0x0c, 0x18, 0xcc, 0x01, 0xf0,
+  0x0f, 0x32, 0x03, 0x00, 0x00, 0x11, 0x3e, 0x3f, 0x37, 0x20, 0x02, 0x03, 0x02, 0x11, 0x41, 0x41, 0x41, 0x3f, 0x37, 0x37, 0x32, 0x2c, 0x18, 0x11,
+  0x03, 0x02, 0x86, 0x86, 0x00, 0x0c, 0x2c, 0x74, 0x18, 0xb0, 0x37, 0x04, 0x0c, 0x25, 0x20, 0x0a, 0x0c, 0x18, 0x0a, 0x1e, 0x2c, 0xdb, 0x12, 0x12,
+  0x2c, 0xb3, 0x03, 0x42, 0x41, 0x41, 0x3e, 0x2c, 0xde, 0x01, 0x00, 0x8a, 0x07, 0x32, 0x3e, 0x3e, 0x35, 0xdf, 0x01, 0x10, 0x39, 0x71, 0x0b, 0xf0,
+  0x0a, 0x3b, 0x37, 0x25, 0x02, 0x0e, 0x29, 0x25, 0x07, 0x92, 0x8f, 0x78, 0x81, 0x86, 0x86, 0x8b, 0x97, 0x73, 0x73, 0x73, 0x85, 0x8c, 0x98, 0x11,
+  0x14, 0x18, 0xbb, 0x16, 0xf0, 0x0a, 0x09, 0x04, 0x25, 0x25, 0x25, 0x2c, 0x14, 0x7e, 0x86, 0x0c, 0x9d, 0x02, 0x11, 0x25, 0x1e, 0x03, 0x09, 0x1f,
+  0x18, 0x11, 0x92, 0x78, 0x78, 0x6c, 0x86, 0xda, 0x14, 0xf3, 0x25, 0x2d, 0x27, 0x0e, 0x27, 0x25, 0x04, 0x0a, 0x07, 0x02, 0x07, 0x1e, 0x2c, 0x07,
+  0x7e, 0x67, 0x71, 0x98, 0x81, 0x6d, 0x67, 0x67, 0x65, 0x67, 0x67, 0x68, 0x66, 0x73, 0x9b, 0x0c, 0x11, 0x0c, 0x9b, 0x86, 0x7d, 0x04, 0x0e, 0x1e,
+  0x11, 0x7d, 0x6c, 0x78, 0x8f, 0x0a, 0x0a, 0x11, 0x8b, 0x67, 0x61, 0x61, 0x5c, 0x61, 0x5c, 0xde, 0x01, 0x30, 0x65, 0x65, 0x68, 0x02, 0x00, 0x00,
+  0x76, 0x07, 0x02, 0x01, 0x00, 0x00, 0xb9, 0x03, 0x01, 0x0e, 0x0d, 0x01, 0x01, 0x00, 0x11, 0x75, 0xdf, 0x01, 0x04, 0xdc, 0x01, 0x01, 0x08, 0x00,
+  0x20, 0x7d, 0x78, 0x60, 0x07, 0x00, 0xe6, 0x01, 0x00, 0x44, 0x07, 0x00, 0x15, 0x00, 0x00, 0xd5, 0x03, 0x00, 0x0e, 0x00, 0x04, 0x01, 0x00, 0x00,
+  0x9e, 0x01, 0x01, 0xd7, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01, 0x00, 0x01, 0xd0, 0x01, 0x00, 0xb6, 0x05, 0x01, 0xd7, 0x03, 0x30, 0x7d, 0x78, 0x79,
+  0x02, 0x00, 0x02, 0x3a, 0x00, 0x01, 0xc3, 0x01, 0x23, 0x81, 0x86, 0x3b, 0x00, 0x40, 0x7d, 0x7d, 0x7d, 0x7e, 0xf9, 0x03, 0x00, 0x01, 0x00, 0x30,
+  0x7e, 0x7d, 0x7e, 0x1c, 0x00, 0x00, 0xfe, 0x01, 0x11, 0x02, 0x9d, 0x07, 0xb0, 0x02, 0x02, 0x89, 0x02, 0x89, 0x86, 0x02, 0x48, 0x48, 0x43, 0x3a,
+  0x9c, 0x03, 0x21, 0x20, 0x1e, 0xb0, 0x01, 0xf2, 0x06, 0x44, 0x43, 0x29, 0x29, 0x44, 0x43, 0x45, 0x43, 0x45, 0x29, 0x0c, 0x11, 0x44, 0x41, 0x44,
+  0x44, 0x41, 0x3f, 0x04, 0x03, 0x0e, 0x59, 0x1a, 0x07, 0x01, 0x00, 0x22, 0x45, 0x3f, 0x37, 0x0b, 0x00, 0xe1, 0x01, 0x00, 0xbf, 0x03, 0x00, 0x01,
+  0x00, 0x10, 0x44, 0xec, 0x10, 0x00, 0xe1, 0x01, 0xa0, 0x29, 0x97, 0x07, 0x11, 0x00, 0x02, 0x00, 0x02, 0x07, 0x1e, 0x60, 0x09, 0xd2, 0x2c, 0x02,
+  0x02, 0x02, 0x1e, 0x37, 0x41, 0x3f, 0x17, 0x00, 0x02, 0x00, 0x32, 0xde, 0x01, 0x50, 0x1e, 0x04, 0x03, 0x07, 0x17, 0xff, 0x09, 0x01, 0xde, 0x10,
+  0xc0, 0x2c, 0x2c, 0x11, 0x1e, 0x29, 0x37, 0x07, 0x02, 0x0c, 0x18, 0x18, 0x2c, 0xb9, 0x05, 0x21, 0x37, 0x2c, 0xbc, 0x03, 0x30, 0x41, 0x41, 0x3e,
+  0x9d, 0x07, 0x01, 0x09, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x18, 0x0d, 0x10, 0x3b, 0xb8, 0x12, 0x00, 0x07, 0x00, 0xf0, 0x09, 0x37, 0x3e, 0x02, 0x02,
+  0x25, 0x1b, 0x97, 0x73, 0x81, 0x81, 0x7d, 0x73, 0x86, 0x0a, 0x9d, 0x81, 0x6e, 0x73, 0x92, 0x82, 0x7c, 0x0c, 0x18, 0x1e, 0x9d, 0x07, 0xf0, 0x0d,
+  0x04, 0x1f, 0x25, 0x25, 0x18, 0x0e, 0x25, 0x25, 0x14, 0x18, 0x1e, 0x0e, 0x2c, 0x25, 0x03, 0x8f, 0x0e, 0x1e, 0x1e, 0x97, 0x6c, 0x71, 0x6e, 0x66,
+  0x8b, 0x1f, 0x2c, 0x2d, 0xb6, 0x16, 0xf0, 0x1e, 0x2c, 0x25, 0x03, 0x7e, 0x04, 0x0a, 0x18, 0x14, 0x18, 0x03, 0x07, 0x0a, 0x10, 0x82, 0x67, 0x62,
+  0x65, 0x65, 0x67, 0x65, 0x65, 0x65, 0x67, 0x6a, 0x7c, 0x8c, 0x82, 0x75, 0x6c, 0x67, 0x6c, 0x8f, 0x09, 0x1f, 0x1e, 0x11, 0x0c, 0x11, 0x0a, 0x11,
+  0x11, 0x9d, 0x98, 0x6d, 0x65, 0xdc, 0x01, 0x00, 0xdf, 0x01, 0x00, 0x01, 0x00, 0x01, 0xdf, 0x01, 0x30, 0x65, 0x68, 0x69, 0xb2, 0x03, 0x00, 0x01,
+  0x00, 0x03, 0xb6, 0x03, 0x01, 0x01, 0x00, 0x06, 0xdc, 0x01, 0x00, 0xc8, 0x01, 0x00, 0x04, 0x00, 0x00, 0x06, 0x00, 0x01, 0x08, 0x00, 0x02, 0x91,
+  0x03, 0x00, 0x49, 0x09, 0x20, 0x71, 0x73, 0x14, 0x0b, 0x00, 0x1a, 0x00, 0x01, 0xb3, 0x12, 0x00, 0x06, 0x00, 0x00, 0x9a, 0x01, 0x00, 0xe9, 0x01,
+  0x02, 0x0a, 0x00, 0x00, 0x88, 0x03, 0x01, 0x11, 0x00, 0x00, 0xe1, 0x01, 0x00, 0xc4, 0x12, 0x01, 0x0c, 0x02, 0x00, 0x43, 0x0d, 0x00, 0x2a, 0x0d,
+  0x20, 0x7d, 0x79, 0x0f, 0x00, 0x01, 0x25, 0x00, 0x21, 0x7d, 0x7c, 0x26, 0x00, 0x17, 0x79, 0x59, 0x0b, 0x00, 0x47, 0x00, 0x00, 0xa1, 0x05, 0x20,
+  0x8b, 0x8d, 0x41, 0x0d, 0x10, 0x02, 0xbb, 0x03, 0x01, 0xa6, 0x05, 0xa1, 0x48, 0x4a, 0x48, 0x48, 0x46, 0x48, 0x46, 0x3f, 0x0a, 0x11, 0x9f, 0x03,
+  0x40, 0x3f, 0x43, 0x1e, 0x07, 0x75, 0x14, 0x41, 0x43, 0x14, 0x97, 0x14, 0xc0, 0x03, 0x62, 0x41, 0x0e, 0x03, 0x03, 0x3f, 0x1b, 0xc1, 0x03, 0x00,
+  0x7e, 0x09, 0x00, 0xb7, 0x03, 0x01, 0x05, 0x00, 0x00, 0x08, 0x00, 0x00, 0xdf, 0x01, 0x20, 0x29, 0x37, 0x7b, 0x07, 0x00, 0xcf, 0x14, 0x00, 0xf3,
+  0x03, 0x00, 0x6b, 0x18, 0x90, 0x3f, 0x29, 0x8f, 0x02, 0x02, 0x11, 0x03, 0x03, 0x1e, 0xb9, 0x0e, 0xf0, 0x0e, 0x20, 0x03, 0x03, 0x00, 0x17, 0x37,
+  0x3f, 0x37, 0x1e, 0x00, 0x03, 0x1b, 0x41, 0x3f, 0x37, 0x32, 0x25, 0x11, 0x0a, 0x04, 0x81, 0x04, 0x9d, 0x25, 0x10, 0x20, 0x8b, 0x02, 0x32, 0x1d,
+  0x0d, 0xf0, 0x01, 0x2c, 0x25, 0x11, 0x1e, 0x2c, 0x32, 0x02, 0x04, 0x18, 0x1e, 0x25, 0x37, 0x37, 0x3e, 0x37, 0x37, 0x06, 0x00, 0x00, 0x92, 0x14,
+  0x14, 0x41, 0x40, 0x0b, 0x40, 0x3e, 0x41, 0x0e, 0x2c, 0x4e, 0x0d, 0x00, 0xe2, 0x01, 0x50, 0x2d, 0x25, 0x2c, 0x2c, 0x35, 0x15, 0x11, 0xf1, 0x08,
+  0x0e, 0x11, 0x11, 0x9d, 0x86, 0x78, 0x78, 0x8b, 0x0d, 0x81, 0x98, 0x17, 0x0d, 0x8c, 0x73, 0x86, 0x9d, 0x73, 0x78, 0x0c, 0x0e, 0x14, 0x18, 0x3d,
+  0x1c, 0xf0, 0x0e, 0x2c, 0x14, 0x00, 0x02, 0x18, 0x25, 0x1f, 0x25, 0x2c, 0x25, 0x1e, 0x11, 0x07, 0x07, 0x07, 0x0c, 0x18, 0x8c, 0x71, 0x75, 0x6c,
+  0x6e, 0x8f, 0x25, 0x1f, 0x1f, 0x25, 0x2d, 0x27, 0xfa, 0x1b, 0xe1, 0x18, 0x1e, 0x18, 0x13, 0x03, 0x09, 0x18, 0x1e, 0x17, 0x7d, 0x67, 0x67, 0x65,
+  0x65, 0xe2, 0x01, 0xf2, 0x0a, 0x67, 0x71, 0x70, 0x67, 0x67, 0x66, 0x65, 0x66, 0x73, 0x07, 0x1e, 0x1f, 0x18, 0x18, 0x14, 0x14, 0x0e, 0x9d, 0x8f,
+  0x81, 0x75, 0x65, 0x61, 0x61, 0x60, 0xbc, 0x03, 0x00, 0xda, 0x01, 0x21, 0x69, 0x68, 0x02, 0x00, 0x00, 0xdb, 0x01, 0x20, 0x6d, 0x70, 0x05, 0x00,
+  0x00, 0xd9, 0x01, 0x00, 0x01, 0x00, 0x05, 0xbb, 0x03, 0x04, 0xbe, 0x01, 0x00, 0x9f, 0x01, 0x00, 0x9d, 0x01, 0x02, 0x0e, 0x00, 0x00, 0xa1, 0x01,
+  0x10, 0x79, 0x91, 0x03, 0x04, 0xf6, 0x0e, 0x00, 0xb9, 0x01, 0x00, 0x02, 0x00, 0x01, 0x92, 0x03, 0x00, 0x7e, 0x07, 0x00, 0xd7, 0x03, 0x00, 0xba,
+  0x01, 0x03, 0x01, 0x00, 0x03, 0xd5, 0x01, 0x32, 0x78, 0x78, 0x7b, 0x24, 0x00, 0x00, 0x02, 0x00, 0x00, 0x9f, 0x07, 0x01, 0x01, 0x00, 0x02, 0x21,
+  0x00, 0x00, 0x11, 0x00, 0x10, 0x79, 0x5e, 0x00, 0x54, 0x7e, 0x81, 0x86, 0x8b, 0x8b, 0xb4, 0x05, 0x00, 0xbe, 0x03, 0x00, 0x56, 0x1c, 0xc0, 0x8f,
+  0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8b, 0x8d, 0x8b, 0x8d, 0x8f, 0xc0, 0x46, 0x48, 0x48, 0x45, 0x3a, 0x45, 0x48, 0x48, 0x3f, 0x48, 0x48, 0x45,
+  0x02, 0x00, 0xf1, 0x07, 0x45, 0x29, 0x1b, 0x29, 0x37, 0x43, 0x3f, 0x45, 0x20, 0x20, 0x32, 0x3f, 0x44, 0x44, 0x44, 0x41, 0x41, 0x25, 0x11, 0x0c,
+  0x2e, 0x29, 0x1e, 0x00, 0x60, 0x48, 0x45, 0x29, 0x2e, 0x48, 0x48, 0x0a, 0x00, 0x03, 0x02, 0x00, 0x80, 0x45, 0x45, 0x44, 0x48, 0x32, 0x3f, 0x32,
+  0x45, 0x01, 0x00, 0x10, 0x44, 0x05, 0x00, 0xf0, 0x39, 0x3f, 0x3f, 0x44, 0x3f, 0x3f, 0x3f, 0x3f, 0x20, 0x02, 0x0c, 0x29, 0x29, 0x20, 0x17, 0x2c,
+  0x41, 0x3e, 0x41, 0x37, 0x2c, 0x0d, 0x00, 0x02, 0x1e, 0x32, 0x41, 0x3f, 0x0c, 0x8f, 0x11, 0x3f, 0x3f, 0x37, 0x2c, 0x11, 0x02, 0x7e, 0x00, 0x02,
+  0x02, 0x97, 0x11, 0x11, 0x0c, 0x11, 0x8f, 0x04, 0x37, 0x37, 0x3e, 0x35, 0x25, 0x25, 0x32, 0x20, 0x25, 0x20, 0x37, 0x37, 0x20, 0x1e, 0x1e, 0x20,
+  0x2c, 0x37, 0x3e, 0x37, 0x2c, 0x32, 0x2c, 0x37, 0x3e, 0x01, 0x00, 0xf0, 0x77, 0x41, 0x3e, 0x37, 0x3e, 0x37, 0x3e, 0x3e, 0x41, 0x41, 0x41, 0x41,
+  0x25, 0x3b, 0x37, 0x3b, 0x3e, 0x3b, 0x2c, 0x3b, 0x3e, 0x35, 0x2c, 0x14, 0x9a, 0x9a, 0x14, 0x35, 0x3b, 0x35, 0x3e, 0x2c, 0x20, 0x03, 0x8b, 0x7d,
+  0x73, 0x73, 0x8d, 0x1b, 0x94, 0x9b, 0x9a, 0x92, 0x78, 0x75, 0x92, 0x0d, 0x86, 0x92, 0x94, 0x04, 0x2c, 0x2d, 0x2c, 0x35, 0x2d, 0x2c, 0x2c, 0x18,
+  0x02, 0x7c, 0x86, 0x0e, 0x18, 0x1f, 0x2c, 0x2d, 0x25, 0x18, 0x14, 0x11, 0x9b, 0x8d, 0x0d, 0x98, 0x7d, 0x78, 0x71, 0x73, 0x86, 0x14, 0x1e, 0x07,
+  0x03, 0x1f, 0x35, 0x27, 0x18, 0x14, 0x8f, 0x0a, 0x25, 0x1f, 0x18, 0x1f, 0x09, 0x0e, 0x25, 0x25, 0x03, 0x6c, 0x67, 0x65, 0x61, 0x65, 0x65, 0x62,
+  0x65, 0x65, 0x67, 0x67, 0x75, 0x75, 0x67, 0x67, 0x69, 0x67, 0x67, 0x8c, 0x0c, 0x14, 0x14, 0x0a, 0x07, 0x0c, 0x0c, 0x92, 0x78, 0x68, 0x67, 0x67,
+  0x65, 0x65, 0x61, 0x20, 0x00, 0xf2, 0x06, 0x65, 0x65, 0x65, 0x68, 0x65, 0x65, 0x69, 0x67, 0x69, 0x68, 0x68, 0x6d, 0x69, 0x6d, 0x69, 0x6d, 0x6d,
+  0x6d, 0x71, 0x6d, 0x71, 0x01, 0x00, 0x12, 0x75, 0x02, 0x00, 0x60, 0x75, 0x75, 0x75, 0x78, 0x75, 0x78, 0x01, 0x00, 0xc0, 0x7c, 0x7c, 0x7c, 0x78,
+  0x7c, 0x7c, 0x7d, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x0b, 0x00, 0x00, 0x08, 0x00, 0x04, 0x01, 0x00, 0x11, 0x7c, 0x12, 0x00, 0x63, 0x78, 0x73, 0x73,
+  0x73, 0x78, 0x78, 0x2f, 0x00, 0x60, 0x78, 0x7c, 0x78, 0x78, 0x75, 0x75, 0x10, 0x00, 0x30, 0x7c, 0x7c, 0x7c, 0x2d, 0x00, 0x02, 0x3b, 0x00, 0x92,
+  0x7c, 0x7d, 0x7c, 0x78, 0x78, 0x74, 0x75, 0x73, 0x75, 0x18, 0x00, 0x10, 0x79, 0x3e, 0x00, 0x20, 0x82, 0x81, 0x06, 0x00, 0x80, 0x7d, 0x7d, 0x81,
+  0x81, 0x81, 0x7d, 0x7d, 0x79, 0x4b, 0x00, 0x50, 0x78, 0x7c, 0x79, 0x7d, 0x86, 0x01, 0x00, 0x10, 0x81, 0x02, 0x00, 0xf0, 0x0a, 0x81, 0x81, 0x81,
+  0x86, 0x86, 0x8b, 0x8d, 0x8b, 0x8f, 0x8f, 0x8f, 0x8f, 0x8d, 0x02, 0x02, 0x8f, 0x8d, 0x02, 0x89, 0x02, 0x86, 0x02, 0x86, 0x32, 0x43, 0xb3, 0x01,
+  0x00, 0x01, 0x00, 0x03, 0xb3, 0x01, 0xf0, 0x05, 0x43, 0x37, 0x17, 0x32, 0x45, 0x29, 0x20, 0x29, 0x20, 0x2e, 0x3f, 0x3f, 0x44, 0x44, 0x41, 0x44,
+  0x3f, 0x45, 0x3f, 0x43, 0xdc, 0x01, 0x71, 0x3f, 0x45, 0x32, 0x29, 0x17, 0x3f, 0x45, 0x26, 0x00, 0x00, 0x02, 0x00, 0xb2, 0x45, 0x45, 0x48, 0x44,
+  0x43, 0x3f, 0x3f, 0x45, 0x45, 0x44, 0x3f, 0xdc, 0x01, 0xf5, 0x3a, 0x45, 0x44, 0x44, 0x3f, 0x3f, 0x32, 0x20, 0x1b, 0x17, 0x3f, 0x3f, 0x03, 0x32,
+  0x3f, 0x3f, 0x11, 0x11, 0x3e, 0x41, 0x3e, 0x41, 0x41, 0x3f, 0x0c, 0x00, 0x8f, 0x20, 0x3f, 0x37, 0x3f, 0x03, 0x14, 0x3f, 0x41, 0x37, 0x20, 0x0a,
+  0x7e, 0x00, 0x7e, 0x00, 0x97, 0x20, 0x32, 0x32, 0x0c, 0x0c, 0x32, 0x20, 0x37, 0x3e, 0x37, 0x35, 0x32, 0x03, 0x8f, 0x0a, 0x09, 0x17, 0x37, 0x37,
+  0x3f, 0x2c, 0x20, 0x14, 0x1e, 0x25, 0x25, 0x37, 0x37, 0x25, 0x32, 0x37, 0xe0, 0x01, 0x30, 0x37, 0x37, 0x37, 0x43, 0x00, 0x10, 0x41, 0x0f, 0x00,
+  0xf0, 0x48, 0x3e, 0x3e, 0x3b, 0x35, 0x3e, 0x35, 0x20, 0x02, 0x73, 0x73, 0x7e, 0x0c, 0x35, 0x37, 0x2c, 0x2c, 0x20, 0x9b, 0x81, 0x78, 0x75, 0x78,
+  0x92, 0x0c, 0x0c, 0x9d, 0x03, 0x9b, 0x7d, 0x73, 0x8f, 0x0d, 0x8f, 0x92, 0x0a, 0x25, 0x2c, 0x35, 0x35, 0x2d, 0x2c, 0x25, 0x18, 0x02, 0x78, 0x8b,
+  0x00, 0x0a, 0x1f, 0x25, 0x27, 0x2c, 0x25, 0x1e, 0x9b, 0x73, 0x73, 0x97, 0x92, 0x75, 0x71, 0x71, 0x7c, 0x86, 0x17, 0x14, 0x97, 0x7e, 0x7e, 0x18,
+  0x27, 0x2c, 0x0b, 0x04, 0x7e, 0x11, 0x08, 0x09, 0x13, 0x1f, 0x2c, 0x27, 0x25, 0x1f, 0x20, 0x8b, 0x67, 0xbd, 0x01, 0xf2, 0x08, 0x65, 0x65, 0x62,
+  0x71, 0x8c, 0x85, 0x71, 0x75, 0x6d, 0x7c, 0x69, 0x75, 0x8c, 0x9a, 0x0c, 0x07, 0x73, 0x86, 0x98, 0x98, 0x71, 0x67, 0x66, 0xde, 0x01, 0x00, 0x02,
+  0x00, 0x00, 0xe1, 0x01, 0x31, 0x69, 0x68, 0x65, 0xdd, 0x01, 0x89, 0x68, 0x6d, 0x6d, 0x6d, 0x70, 0x6d, 0x71, 0x70, 0xdd, 0x01, 0x05, 0xdf, 0x01,
+  0x00, 0xdc, 0x01, 0x04, 0x01, 0x00, 0x00, 0xcf, 0x01, 0x00, 0x08, 0x00, 0x14, 0x81, 0x02, 0x00, 0x10, 0x81, 0x06, 0x00, 0x10, 0x7d, 0xbb, 0x01,
+  0x60, 0x78, 0x75, 0x73, 0x73, 0x71, 0x73, 0x21, 0x02, 0xb1, 0x71, 0x71, 0x6e, 0x71, 0x6e, 0x71, 0x73, 0x75, 0x75, 0x75, 0x73, 0x02, 0x00, 0x01,
+  0xd6, 0x01, 0x01, 0x02, 0x00, 0x60, 0x71, 0x71, 0x6e, 0x6e, 0x71, 0x6e, 0x13, 0x00, 0x31, 0x73, 0x78, 0x73, 0x33, 0x02, 0x02, 0x02, 0x02, 0x00,
+  0x43, 0x00, 0x01, 0x07, 0x00, 0x00, 0x3e, 0x02, 0x31, 0x81, 0x86, 0x86, 0x56, 0x00, 0x01, 0x5c, 0x00, 0x40, 0x81, 0x86, 0x89, 0x02, 0xe1, 0x01,
+  0x20, 0x8b, 0x02, 0x02, 0x00, 0x20, 0x02, 0x89, 0xfb, 0x01, 0x30, 0x86, 0x03, 0x1e, 0xe1, 0x01, 0x01, 0xc2, 0x01, 0x01, 0x01, 0x00, 0xa1, 0x32,
+  0x17, 0x17, 0x07, 0x11, 0x3f, 0x3f, 0x97, 0x03, 0x1e, 0xc0, 0x03, 0x40, 0x44, 0x3e, 0x41, 0x32, 0xbb, 0x03, 0x80, 0x48, 0x3f, 0x17, 0x3f, 0x3f,
+  0x34, 0x3f, 0x20, 0xad, 0x03, 0x10, 0x3f, 0x28, 0x00, 0x10, 0x48, 0x03, 0x00, 0x80, 0x44, 0x3f, 0x32, 0x29, 0x45, 0x3f, 0x45, 0x3f, 0x0a, 0x02,
+  0x10, 0x44, 0xdf, 0x01, 0xe1, 0x37, 0x29, 0x32, 0x32, 0x0c, 0x29, 0x3f, 0x9b, 0x37, 0x32, 0x37, 0x17, 0x25, 0x41, 0x9d, 0x01, 0xf2, 0x22, 0x11,
+  0x07, 0x17, 0x37, 0x3e, 0x3f, 0x3e, 0x18, 0x37, 0x3f, 0x37, 0x29, 0x03, 0x86, 0x00, 0x81, 0x88, 0x86, 0x0a, 0x32, 0x32, 0x32, 0x17, 0x1e, 0x32,
+  0x25, 0x37, 0x3e, 0x3e, 0x37, 0x11, 0x00, 0x00, 0x02, 0x8f, 0x18, 0x32, 0x41, 0x37, 0x37, 0x1e, 0x18, 0x20, 0x04, 0x25, 0x3e, 0x37, 0x2c, 0x37,
+  0xe0, 0x01, 0x01, 0xd5, 0x01, 0x20, 0x1e, 0x25, 0x09, 0x00, 0x50, 0x41, 0x3e, 0x3e, 0x35, 0x3b, 0xe1, 0x01, 0xf0, 0x1b, 0x37, 0x2c, 0x07, 0x79,
+  0x73, 0x73, 0x73, 0x86, 0x0e, 0x2c, 0x04, 0x11, 0x0c, 0x78, 0x75, 0x73, 0x72, 0x73, 0x7c, 0x82, 0x9a, 0x9d, 0x14, 0x9d, 0x7d, 0x73, 0x81, 0x9b,
+  0x8f, 0x04, 0x18, 0x25, 0x2d, 0x2c, 0x2d, 0x35, 0x2c, 0x09, 0x8f, 0x8b, 0x8f, 0x8f, 0xdf, 0x01, 0xf0, 0x0e, 0x25, 0x27, 0x25, 0x0a, 0x78, 0x6e,
+  0x78, 0x82, 0x6e, 0x67, 0x66, 0x6c, 0x79, 0x0c, 0x1e, 0x79, 0x71, 0x75, 0x8f, 0x18, 0x2c, 0x27, 0x25, 0x07, 0x8f, 0x97, 0x07, 0x0e, 0x13, 0xc3,
+  0x03, 0x30, 0x25, 0x20, 0x7d, 0xe0, 0x01, 0xf0, 0x06, 0x62, 0x65, 0x66, 0x65, 0x7c, 0x8c, 0x07, 0x9d, 0x9b, 0x75, 0x76, 0x6d, 0x67, 0x6c, 0x79,
+  0x9b, 0x98, 0x6c, 0x6c, 0x6d, 0x6c, 0x19, 0x00, 0x01, 0xda, 0x01, 0x10, 0x61, 0x05, 0x00, 0x40, 0x68, 0x65, 0x69, 0x68, 0x02, 0x00, 0x01, 0xde,
+  0x01, 0x00, 0xc0, 0x03, 0x00, 0x01, 0x00, 0x01, 0xdd, 0x01, 0x00, 0x02, 0x00, 0x02, 0xdf, 0x01, 0x00, 0x6c, 0x03, 0x01, 0x6e, 0x03, 0x00, 0x8b,
+  0x01, 0x01, 0x01, 0x00, 0x03, 0x07, 0x00, 0x01, 0x8d, 0x01, 0x01, 0x80, 0x01, 0x02, 0x01, 0x00, 0xf0, 0x07, 0x7d, 0x7d, 0x7c, 0x75, 0x73, 0x6d,
+  0x6c, 0x6c, 0x71, 0x6c, 0x6c, 0x6c, 0x6c, 0x67, 0x62, 0x67, 0x67, 0x67, 0x6c, 0x6d, 0x6e, 0x6e, 0x0d, 0x00, 0x01, 0x01, 0x00, 0xa0, 0x6e, 0x67,
+  0x6c, 0x67, 0x6a, 0x6c, 0x6a, 0x6c, 0x66, 0x67, 0x1a, 0x00, 0xb0, 0x6c, 0x71, 0x6e, 0x6c, 0x6e, 0x6e, 0x73, 0x73, 0x75, 0x73, 0x73, 0x13, 0x02,
+  0x12, 0x74, 0x43, 0x02, 0x00, 0x5a, 0x00, 0x00, 0xc0, 0x03, 0x10, 0x7c, 0x58, 0x00, 0x30, 0x79, 0x7c, 0x79, 0x11, 0x00, 0x10, 0x7e, 0xed, 0x01,
+  0x32, 0x89, 0x02, 0x86, 0xd7, 0x01, 0x01, 0x01, 0x00, 0x60, 0x83, 0x86, 0x86, 0x86, 0x07, 0x04, 0xe0, 0x01, 0x23, 0x32, 0x3f, 0x94, 0x03, 0xd0,
+  0x32, 0x20, 0x20, 0x09, 0x07, 0x03, 0x20, 0x3f, 0x97, 0x20, 0x1b, 0x18, 0x37, 0xc0, 0x03, 0x40, 0x41, 0x3f, 0x3f, 0x44, 0xdd, 0x03, 0xf0, 0x00,
+  0x3f, 0x32, 0x45, 0x48, 0x3f, 0x2e, 0x03, 0x11, 0x45, 0x45, 0x29, 0x11, 0x32, 0x43, 0x3f, 0x2c, 0x00, 0x01, 0xe6, 0x01, 0x02, 0xbc, 0x03, 0xf0,
+  0x04, 0x44, 0x3f, 0x45, 0x44, 0x45, 0x3f, 0x32, 0x37, 0x3f, 0x3f, 0x44, 0x45, 0x3f, 0x29, 0x3f, 0x29, 0x32, 0x20, 0x32, 0x7b, 0x03, 0xf0, 0x0b,
+  0x3e, 0x41, 0x3e, 0x3f, 0x0c, 0x02, 0x0c, 0x3f, 0x3f, 0x3e, 0x37, 0x41, 0x41, 0x3e, 0x2c, 0x03, 0x8f, 0x00, 0x8b, 0x02, 0x86, 0x0c, 0x20, 0x37,
+  0x20, 0x32, 0x8c, 0x05, 0xf0, 0x03, 0x3e, 0x3e, 0x37, 0x2c, 0x03, 0x7e, 0x86, 0x81, 0x03, 0x29, 0x37, 0x41, 0x37, 0x3f, 0x25, 0x20, 0x2c, 0x20,
+  0xdc, 0x01, 0x40, 0x37, 0x3e, 0x37, 0x41, 0x1c, 0x00, 0x00, 0x1f, 0x00, 0x30, 0x09, 0x03, 0x35, 0xd8, 0x01, 0xf0, 0x06, 0x3b, 0x35, 0x3e, 0x3b,
+  0x3e, 0x3b, 0x3e, 0x35, 0x35, 0x20, 0x17, 0x81, 0x73, 0x73, 0x73, 0x7e, 0x18, 0x37, 0x1e, 0x20, 0x9d, 0xef, 0x00, 0xf0, 0x49, 0x6e, 0x73, 0x73,
+  0x8b, 0x81, 0x97, 0x8b, 0x85, 0x71, 0x7d, 0x97, 0x1e, 0x14, 0x1e, 0x13, 0x1e, 0x27, 0x2c, 0x27, 0x2c, 0x0b, 0x86, 0x97, 0x0c, 0x0e, 0x13, 0x25,
+  0x27, 0x1f, 0x1f, 0x25, 0x20, 0x86, 0x67, 0x6e, 0x7c, 0x6d, 0x6c, 0x67, 0x67, 0x73, 0x07, 0x25, 0x1e, 0x73, 0x6c, 0x67, 0x7d, 0x9a, 0x18, 0x1e,
+  0x18, 0x18, 0x81, 0x8f, 0x14, 0x0e, 0x18, 0x18, 0x04, 0x04, 0x09, 0x18, 0x1e, 0x73, 0x67, 0x61, 0x62, 0x65, 0x67, 0x62, 0x65, 0x62, 0x67, 0x73,
+  0x97, 0x14, 0x9d, 0x8b, 0x78, 0x6d, 0x6c, 0x82, 0x92, 0x98, 0x8c, 0x68, 0x66, 0xdd, 0x01, 0x01, 0x01, 0x00, 0x00, 0xdd, 0x01, 0x00, 0x01, 0x00,
+  0x11, 0x68, 0xdf, 0x01, 0x00, 0xc0, 0x03, 0x00, 0x01, 0x00, 0x0d, 0xbe, 0x03, 0x00, 0xde, 0x01, 0x00, 0xc1, 0x03, 0x00, 0xde, 0x01, 0x01, 0x7c,
+  0x01, 0x00, 0xd5, 0x01, 0x06, 0x01, 0x00, 0x06, 0xdc, 0x01, 0x00, 0xdd, 0x01, 0x40, 0x7c, 0x78, 0x75, 0x6e, 0xbb, 0x01, 0x90, 0x71, 0x6c, 0x6d,
+  0x67, 0x67, 0x62, 0x5f, 0x5f, 0x5f, 0xc9, 0x01, 0x08, 0x01, 0x00, 0x31, 0x62, 0x62, 0x67, 0x02, 0x00, 0x00, 0x01, 0x00, 0x11, 0x67, 0xf3, 0x01,
+  0xa0, 0x6c, 0x6e, 0x6e, 0x71, 0x6c, 0x6e, 0x6c, 0x6c, 0x6e, 0x73, 0xea, 0x01, 0x02, 0x68, 0x00, 0x00, 0x2e, 0x04, 0x23, 0x78, 0x79, 0x0a, 0x00,
+  0x50, 0x79, 0x7c, 0x7d, 0x7c, 0x7e, 0xa1, 0x05, 0x00, 0xad, 0x05, 0x00, 0x01, 0x00, 0x02, 0x06, 0x00, 0x40, 0x86, 0x86, 0x86, 0x11, 0xe0, 0x01,
+  0x20, 0x45, 0x43, 0xa6, 0x01, 0xf0, 0x09, 0x45, 0x45, 0x44, 0x29, 0x14, 0x11, 0x0e, 0x11, 0x04, 0x17, 0x20, 0x3f, 0x17, 0x20, 0x0a, 0x03, 0x14,
+  0x3e, 0x3e, 0x44, 0x41, 0x41, 0x44, 0x41, 0xbf, 0x03, 0x00, 0x02, 0x02, 0xa1, 0x3f, 0x3f, 0x1e, 0x1b, 0x44, 0x45, 0x45, 0x32, 0x07, 0x11, 0xd5,
+  0x01, 0x01, 0x01, 0x00, 0x00, 0xcc, 0x03, 0x12, 0x44, 0x9c, 0x05, 0x01, 0xbf, 0x03, 0x00, 0xea, 0x01, 0x70, 0x37, 0x29, 0x20, 0x32, 0x11, 0x25,
+  0x3f, 0xde, 0x01, 0x60, 0x3e, 0x37, 0x3e, 0x32, 0x02, 0x0a, 0xe9, 0x01, 0xf0, 0x03, 0x41, 0x41, 0x32, 0x07, 0x7e, 0x8f, 0x86, 0x8f, 0x9d, 0x03,
+  0x0c, 0x25, 0x0d, 0x9a, 0x07, 0x17, 0x0c, 0x32, 0xc5, 0x01, 0x70, 0x2c, 0x02, 0x86, 0x11, 0x86, 0x86, 0x1e, 0xd7, 0x01, 0x81, 0x32, 0x25, 0x32,
+  0x2c, 0x25, 0x95, 0x25, 0x3e, 0xdd, 0x01, 0x21, 0x37, 0x35, 0x06, 0x00, 0x40, 0x1e, 0x03, 0x37, 0x41, 0xd8, 0x01, 0x10, 0x35, 0xe1, 0x01, 0xf0,
+  0x1d, 0x35, 0x35, 0x1e, 0x01, 0x94, 0x0c, 0x86, 0x79, 0x78, 0x79, 0x14, 0x35, 0x3e, 0x2c, 0x17, 0x73, 0x73, 0x6f, 0x73, 0x73, 0x7c, 0x97, 0x9d,
+  0x81, 0x92, 0x8b, 0x81, 0x73, 0x86, 0x8f, 0x14, 0x25, 0x1f, 0x1e, 0x1f, 0x25, 0x25, 0x2d, 0x25, 0x04, 0x6e, 0x81, 0x09, 0x18, 0xbf, 0x03, 0xf0,
+  0x2d, 0x14, 0x14, 0x0c, 0x79, 0x6c, 0x6d, 0x78, 0x75, 0x6a, 0x67, 0x73, 0x9a, 0x25, 0x25, 0x35, 0x03, 0x73, 0x81, 0x8b, 0x8b, 0x92, 0x07, 0x92,
+  0x92, 0x86, 0x04, 0x1e, 0x1f, 0x18, 0x04, 0x79, 0x81, 0x07, 0x07, 0x9d, 0x98, 0x6e, 0x65, 0x67, 0x67, 0x78, 0x75, 0x67, 0x66, 0x67, 0x7d, 0x0d,
+  0x9a, 0x7d, 0x7c, 0x6d, 0x78, 0x84, 0x7c, 0x7b, 0x6d, 0x66, 0x67, 0x65, 0x67, 0x71, 0x07, 0x07, 0x01, 0x00, 0x10, 0x68, 0x03, 0x00, 0x13, 0x68,
+  0xbf, 0x03, 0x01, 0x7d, 0x07, 0x10, 0x75, 0x03, 0x00, 0x21, 0x75, 0x75, 0x04, 0x00, 0x00, 0xe0, 0x01, 0x01, 0x01, 0x00, 0x20, 0x7c, 0x78, 0x46,
+  0x05, 0x04, 0xde, 0x01, 0x00, 0xcf, 0x01, 0x00, 0x3c, 0x05, 0x06, 0x0b, 0x00, 0x00, 0xde, 0x01, 0x50, 0x78, 0x78, 0x75, 0x71, 0x6c, 0xc6, 0x01,
+  0xf1, 0x02, 0x6d, 0x6c, 0x6c, 0x6d, 0x6a, 0x64, 0x5f, 0x5a, 0x5e, 0x5f, 0x5f, 0x5f, 0x61, 0x5f, 0x5f, 0x5f, 0x5f, 0xcf, 0x01, 0x10, 0x67, 0xd9,
+  0x01, 0x12, 0x64, 0x08, 0x00, 0x01, 0x01, 0x00, 0x10, 0x6c, 0xe2, 0x01, 0x00, 0xe1, 0x01, 0x02, 0xe9, 0x01, 0x40, 0x71, 0x6e, 0x73, 0x71, 0xe3,
+  0x01, 0x33, 0x73, 0x78, 0x74, 0x02, 0x00, 0x00, 0x01, 0x00, 0x40, 0x7c, 0x78, 0x7c, 0x79, 0x76, 0x00, 0x00, 0x67, 0x00, 0x06, 0xdb, 0x01, 0x01,
+  0xca, 0x03, 0x21, 0x32, 0x29, 0xbf, 0x01, 0x00, 0xac, 0x01, 0xf0, 0x03, 0x45, 0x48, 0x45, 0x37, 0x04, 0x03, 0x03, 0x20, 0x29, 0x37, 0x2e, 0x3f,
+  0x32, 0x1b, 0x04, 0x02, 0x03, 0x37, 0xdd, 0x08, 0x20, 0x41, 0x44, 0x21, 0x00, 0xd0, 0x45, 0x45, 0x3f, 0x20, 0x29, 0x11, 0x07, 0x3f, 0x45, 0x45,
+  0x37, 0x3f, 0x45, 0xe6, 0x01, 0x02, 0x32, 0x00, 0x12, 0x3f, 0x02, 0x00, 0x00, 0xdc, 0x01, 0x01, 0xe1, 0x01, 0x10, 0x20, 0x06, 0x00, 0x60, 0x32,
+  0x02, 0x0c, 0x14, 0x0a, 0x0c, 0x5a, 0x05, 0x90, 0x3e, 0x37, 0x2c, 0x3f, 0x25, 0x00, 0x20, 0x3e, 0x3f, 0x8e, 0x03, 0xf0, 0x16, 0x25, 0x00, 0x00,
+  0x86, 0x0a, 0x02, 0x97, 0x14, 0x29, 0x25, 0x9d, 0x02, 0x02, 0x03, 0x00, 0x1e, 0x3e, 0x3e, 0x3e, 0x35, 0x2c, 0x03, 0x07, 0x20, 0x1b, 0x00, 0x07,
+  0x2c, 0x3e, 0x37, 0x37, 0x2c, 0x2c, 0x2c, 0x2c, 0x1e, 0x0e, 0xd7, 0x01, 0x01, 0x79, 0x07, 0x10, 0x3b, 0x07, 0x00, 0x30, 0x0e, 0x09, 0x37, 0xd8,
+  0x01, 0xf6, 0x5f, 0x35, 0x35, 0x35, 0x3b, 0x35, 0x35, 0x2c, 0x25, 0x25, 0x79, 0x73, 0x14, 0x9d, 0x8b, 0x02, 0x8f, 0x2c, 0x35, 0x35, 0x2c, 0x17,
+  0x78, 0x73, 0x71, 0x7c, 0x92, 0x14, 0x20, 0x1b, 0x73, 0x7e, 0x8b, 0x8b, 0x7c, 0x92, 0x8b, 0x18, 0x18, 0x1e, 0x25, 0x08, 0x18, 0x27, 0x25, 0x27,
+  0x1e, 0x95, 0x04, 0x1e, 0x1f, 0x0e, 0x0e, 0x1e, 0x25, 0x83, 0x79, 0x8f, 0x8b, 0x71, 0x82, 0x8c, 0x9d, 0x78, 0x78, 0x9b, 0x17, 0x14, 0x25, 0x2d,
+  0x2c, 0x04, 0x9d, 0x98, 0x6c, 0x73, 0x7d, 0x6c, 0x79, 0x86, 0x0a, 0x14, 0x07, 0x07, 0x86, 0x85, 0x81, 0x92, 0x86, 0x8b, 0x78, 0x71, 0x76, 0x75,
+  0x82, 0x9b, 0x98, 0x69, 0x67, 0x6e, 0x8c, 0x98, 0x78, 0x73, 0x92, 0x82, 0x75, 0x6c, 0x68, 0x67, 0x65, 0xbe, 0x03, 0x05, 0x01, 0x00, 0x01, 0xbd,
+  0x03, 0x00, 0x02, 0x00, 0x00, 0xe0, 0x01, 0x03, 0xe1, 0x01, 0x00, 0x01, 0x00, 0x02, 0x06, 0x00, 0x03, 0xbd, 0x03, 0x01, 0x56, 0x03, 0x07, 0xbc,
+  0x03, 0x00, 0xd1, 0x01, 0x00, 0xd3, 0x01, 0x02, 0x08, 0x00, 0x01, 0x01, 0x00, 0x00, 0xe0, 0x01, 0x21, 0x73, 0x73, 0x99, 0x05, 0x21, 0x6e, 0x6c,
+  0xe6, 0x01, 0x70, 0x5f, 0x5e, 0x5a, 0x5e, 0x5e, 0x5e, 0x5f, 0xe5, 0x01, 0x00, 0xca, 0x03, 0x11, 0x5f, 0xe3, 0x01, 0x02, 0xd3, 0x01, 0x01, 0x04,
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x6e, 0xa8, 0x05, 0x01, 0x02, 0x00, 0x00, 0xb1, 0x07, 0x00, 0xbc, 0x04, 0x10, 0x73, 0xe5, 0x01,
+  0x00, 0x9a, 0x09, 0x00, 0xdf, 0x01, 0x40, 0x79, 0x7c, 0x7c, 0x79, 0x02, 0x00, 0x22, 0x7d, 0x80, 0xc5, 0x03, 0x04, 0xc1, 0x03, 0x30, 0x02, 0x86,
+  0x45, 0xbe, 0x01, 0x32, 0x48, 0x48, 0x32, 0xc2, 0x03, 0xf0, 0x00, 0x48, 0x3f, 0x17, 0x04, 0x17, 0x3f, 0x32, 0x29, 0x29, 0x32, 0x29, 0x07, 0x0a,
+  0x03, 0x32, 0xdf, 0x01, 0x10, 0x41, 0xcd, 0x01, 0xf0, 0x00, 0x48, 0x45, 0x45, 0x20, 0x97, 0x04, 0x07, 0x29, 0x45, 0x44, 0x32, 0x32, 0x32, 0x45,
+  0x20, 0xb6, 0x03, 0x01, 0x2e, 0x0b, 0x00, 0x9f, 0x05, 0x10, 0x3f, 0x98, 0x05, 0x00, 0x38, 0x0b, 0x01, 0xc5, 0x03, 0xa0, 0x32, 0x3f, 0x3f, 0x29,
+  0x00, 0x03, 0x07, 0x02, 0x14, 0x37, 0xe0, 0x01, 0x60, 0x3e, 0x3e, 0x41, 0x32, 0x01, 0x32, 0x08, 0x00, 0xf0, 0x15, 0x3e, 0x37, 0x1e, 0x02, 0x00,
+  0x81, 0x00, 0x86, 0x04, 0x11, 0x2c, 0x32, 0x29, 0x04, 0x97, 0x00, 0x02, 0x2c, 0x3e, 0x3b, 0x3e, 0x2c, 0x25, 0x07, 0x11, 0x11, 0x9b, 0x9b, 0x04,
+  0x25, 0x37, 0x37, 0x37, 0x2c, 0x25, 0x25, 0x40, 0x0b, 0x00, 0x34, 0x0b, 0x00, 0xbf, 0x03, 0x00, 0x09, 0x00, 0x30, 0x25, 0x2c, 0x2c, 0x7b, 0x07,
+  0xf0, 0x1b, 0x2c, 0x2d, 0x35, 0x3b, 0x35, 0x2c, 0x18, 0x1f, 0x0e, 0x2c, 0x18, 0x0e, 0x25, 0x97, 0x02, 0x17, 0x1e, 0x37, 0x35, 0x2c, 0x37, 0x03,
+  0x73, 0x73, 0x73, 0x8f, 0x14, 0x1e, 0x25, 0x20, 0x79, 0x86, 0x98, 0x8b, 0x8b, 0x97, 0x98, 0x03, 0x0b, 0x18, 0x25, 0x04, 0x97, 0x05, 0xf4, 0x2d,
+  0x2d, 0x25, 0x25, 0x25, 0x11, 0x8f, 0x86, 0x9b, 0x9a, 0x6e, 0x81, 0x14, 0x1b, 0x85, 0x82, 0x9b, 0x18, 0x97, 0x14, 0x9d, 0x7d, 0x00, 0x07, 0x1f,
+  0x2d, 0x25, 0x11, 0x75, 0x67, 0x67, 0x78, 0x79, 0x9b, 0x11, 0x9b, 0x8b, 0x85, 0x9b, 0x6e, 0x67, 0x76, 0x75, 0x6c, 0x67, 0x67, 0x65, 0x68, 0x76,
+  0x78, 0x90, 0x98, 0x76, 0x76, 0x76, 0x82, 0x7d, 0x7d, 0x78, 0x90, 0x70, 0xdd, 0x01, 0x01, 0x7e, 0x07, 0x06, 0x01, 0x00, 0x00, 0xbc, 0x03, 0x21,
+  0x68, 0x68, 0xbd, 0x03, 0x03, 0xde, 0x01, 0x03, 0xbe, 0x03, 0x03, 0xdd, 0x01, 0x01, 0xc0, 0x03, 0x00, 0x1c, 0x0b, 0x05, 0xde, 0x01, 0x02, 0xd7,
+  0x01, 0x00, 0x07, 0x00, 0x03, 0x09, 0x00, 0x02, 0x01, 0x00, 0x00, 0xbb, 0x05, 0x00, 0x5c, 0x09, 0x50, 0x75, 0x73, 0x75, 0x75, 0x71, 0xbe, 0x01,
+  0x20, 0x67, 0x5f, 0xad, 0x03, 0x00, 0xa5, 0x05, 0x20, 0x5f, 0x5f, 0xb2, 0x03, 0x00, 0x13, 0x00, 0x00, 0x87, 0x05, 0x10, 0x75, 0xe7, 0x03, 0x50,
+  0x73, 0x71, 0x71, 0x6c, 0x6c, 0xd9, 0x01, 0x10, 0x6c, 0x87, 0x07, 0x01, 0x6f, 0x09, 0x20, 0x6e, 0x6e, 0x11, 0x00, 0x10, 0x6e, 0xde, 0x01, 0x01,
+  0xab, 0x05, 0x01, 0x8b, 0x0b, 0x60, 0x7c, 0x79, 0x7c, 0x78, 0x78, 0x79, 0x02, 0x00, 0x15, 0x7c, 0xc3, 0x03, 0x20, 0x81, 0x83, 0x08, 0x00, 0xb0,
+  0x85, 0x86, 0x86, 0x45, 0x46, 0x48, 0x48, 0x48, 0x46, 0x48, 0x2e, 0xb1, 0x01, 0x20, 0x45, 0x48, 0x79, 0x05, 0x00, 0x90, 0x03, 0x64, 0x1e, 0x07,
+  0x17, 0x1e, 0x29, 0x2c, 0xc0, 0x03, 0xf0, 0x01, 0x45, 0x45, 0x45, 0x37, 0x43, 0x37, 0x1b, 0x03, 0x07, 0x3f, 0x45, 0x20, 0x1e, 0x0c, 0x37, 0x34,
+  0x36, 0x0b, 0x40, 0x45, 0x45, 0x32, 0x32, 0x43, 0x0d, 0x00, 0x2e, 0x00, 0x20, 0x0d, 0x17, 0xe0, 0x01, 0x00, 0x7e, 0x07, 0x91, 0x3f, 0x37, 0x20,
+  0x37, 0x32, 0x1e, 0x02, 0x1b, 0x11, 0x9f, 0x03, 0x00, 0xc0, 0x03, 0x31, 0x37, 0x37, 0x04, 0xea, 0x01, 0xf0, 0x02, 0x2c, 0x25, 0x29, 0x11, 0x02,
+  0x02, 0x7e, 0x02, 0x8f, 0x0a, 0x20, 0x32, 0x25, 0x9d, 0x02, 0x7e, 0x0e, 0x59, 0x07, 0x90, 0x2c, 0x09, 0x29, 0x1e, 0x20, 0x8f, 0x86, 0x11, 0x0c,
+  0x56, 0x09, 0x80, 0x25, 0x2c, 0x37, 0x32, 0x2c, 0x37, 0x37, 0x3b, 0xf7, 0x03, 0x20, 0x37, 0x35, 0xea, 0x01, 0x30, 0x11, 0x25, 0x3e, 0x79, 0x07,
+  0x00, 0xbf, 0x03, 0x40, 0x3b, 0x2c, 0x1f, 0x0b, 0xb7, 0x03, 0x30, 0x20, 0x0a, 0x1e, 0x27, 0x0b, 0xf0, 0x06, 0x2c, 0x2c, 0x29, 0x02, 0x73, 0x73,
+  0x8b, 0x07, 0x0e, 0x1e, 0x20, 0x79, 0x03, 0x02, 0x97, 0x0a, 0x0d, 0x7e, 0x02, 0x02, 0x09, 0x53, 0x09, 0xf0, 0x30, 0x1f, 0x2d, 0x2d, 0x35, 0x2c,
+  0x14, 0x7e, 0x73, 0x7d, 0x82, 0x73, 0x6c, 0x92, 0x0c, 0x14, 0x7c, 0x73, 0x94, 0x18, 0x18, 0x14, 0x79, 0x7d, 0x73, 0x88, 0x1f, 0x2d, 0x2c, 0x0c,
+  0x71, 0x67, 0x67, 0x73, 0x97, 0x11, 0x8b, 0x6e, 0x67, 0x6e, 0x6d, 0x62, 0x62, 0x62, 0x6d, 0x66, 0x61, 0x60, 0x65, 0x62, 0x65, 0x6a, 0x73, 0x6e,
+  0x65, 0x62, 0x67, 0x71, 0x75, 0x71, 0x6c, 0x75, 0x68, 0x62, 0xce, 0x01, 0x01, 0x01, 0x00, 0x04, 0x79, 0x07, 0x00, 0xdd, 0x01, 0x12, 0x67, 0xc0,
+  0x03, 0x00, 0xdd, 0x01, 0x00, 0x01, 0x00, 0x01, 0xde, 0x01, 0x06, 0x01, 0x00, 0x00, 0xbc, 0x03, 0x01, 0xe0, 0x01, 0x00, 0x9d, 0x05, 0x0c, 0x01,
+  0x00, 0x14, 0x81, 0x14, 0x00, 0x01, 0xf1, 0x01, 0x00, 0x01, 0x00, 0x01, 0x2f, 0x07, 0x00, 0x01, 0x00, 0x60, 0x73, 0x75, 0x75, 0x73, 0x71, 0x6e,
+  0xc5, 0x03, 0x41, 0x6c, 0x68, 0x6c, 0x68, 0x08, 0x00, 0x50, 0x71, 0x71, 0x75, 0x78, 0x75, 0x80, 0x05, 0x10, 0x7c, 0x2d, 0x00, 0x00, 0x25, 0x00,
+  0x01, 0x5a, 0x00, 0x00, 0x52, 0x0d, 0x04, 0x01, 0x00, 0x01, 0xda, 0x01, 0x10, 0x71, 0xdb, 0x01, 0x00, 0xdd, 0x01, 0x01, 0xdf, 0x01, 0x01, 0xbd,
+  0x03, 0x00, 0xde, 0x01, 0x41, 0x78, 0x7c, 0x7c, 0x7e, 0xe0, 0x01, 0x20, 0x81, 0x80, 0x05, 0x00, 0x60, 0x83, 0x81, 0x80, 0x81, 0x83, 0x86, 0xbd,
+  0x03, 0x33, 0x48, 0x45, 0x29, 0x5f, 0x09, 0x30, 0x43, 0x45, 0x43, 0x4e, 0x07, 0xe0, 0x43, 0x37, 0x1b, 0x29, 0x32, 0x07, 0x20, 0x3f, 0x41, 0x44,
+  0x44, 0x41, 0x3f, 0x41, 0xcd, 0x01, 0x10, 0x20, 0xf9, 0x01, 0xa1, 0x32, 0x43, 0x44, 0x20, 0x20, 0x11, 0x17, 0x17, 0x1e, 0x29, 0x4f, 0x09, 0x40,
+  0x44, 0x29, 0x3f, 0x18, 0x9f, 0x05, 0xf1, 0x07, 0x45, 0x0c, 0x11, 0x3f, 0x45, 0x44, 0x3f, 0x07, 0x29, 0x0c, 0x32, 0x37, 0x32, 0x1e, 0x32, 0x20,
+  0x11, 0x17, 0x32, 0x11, 0x8f, 0x2c, 0x94, 0x05, 0x40, 0x44, 0x11, 0x2c, 0x44, 0x7c, 0x07, 0xf0, 0x04, 0x3e, 0x37, 0x11, 0x8f, 0x18, 0x32, 0x1b,
+  0x07, 0x81, 0x00, 0x7e, 0x02, 0x14, 0x11, 0x11, 0x11, 0x02, 0x03, 0x2c, 0x1f, 0x00, 0xc0, 0x2c, 0x14, 0x0e, 0x29, 0x2c, 0x0d, 0x8f, 0x95, 0x1e,
+  0x32, 0x37, 0x37, 0xbf, 0x03, 0x21, 0x2c, 0x2c, 0x77, 0x09, 0x00, 0x19, 0x02, 0x00, 0xe5, 0x01, 0x21, 0x09, 0x2c, 0x03, 0x04, 0x10, 0x3b, 0x01,
+  0x00, 0x60, 0x2c, 0x25, 0x18, 0x2c, 0x2c, 0x35, 0xc5, 0x05, 0x10, 0x25, 0x05, 0x00, 0xf0, 0x2d, 0x37, 0x2c, 0x04, 0x7e, 0x81, 0x02, 0x02, 0x0a,
+  0x14, 0x0e, 0x02, 0x14, 0x0e, 0x14, 0x18, 0x07, 0x00, 0x09, 0x1f, 0x1f, 0x27, 0x25, 0x2d, 0x2d, 0x2d, 0x2d, 0x35, 0x2d, 0x25, 0x02, 0x6c, 0x6c,
+  0x75, 0x71, 0x6a, 0x67, 0x76, 0x92, 0x8b, 0x73, 0x81, 0x0a, 0x0e, 0x0e, 0x04, 0x7e, 0x07, 0x04, 0x18, 0x27, 0x2d, 0x25, 0x0c, 0x86, 0x6c, 0x79,
+  0x9b, 0x17, 0x02, 0x6c, 0x51, 0x09, 0xf0, 0x07, 0x62, 0x61, 0x60, 0x65, 0x6d, 0x65, 0x65, 0x62, 0x61, 0x62, 0x61, 0x65, 0x69, 0x66, 0x65, 0x62,
+  0x67, 0x8b, 0x81, 0x6c, 0x68, 0x67, 0xf3, 0x0e, 0x08, 0xdc, 0x01, 0x01, 0x01, 0x00, 0x11, 0x69, 0x1e, 0x0d, 0x03, 0x7d, 0x07, 0x0c, 0xbf, 0x03,
+  0x00, 0xbb, 0x03, 0x01, 0x84, 0x01, 0x01, 0x3c, 0x0b, 0x04, 0xce, 0x01, 0x01, 0xaa, 0x05, 0x00, 0x0c, 0x00, 0x04, 0x08, 0x00, 0x06, 0x01, 0x00,
+  0x00, 0x02, 0x0f, 0x00, 0x20, 0x0d, 0x31, 0x71, 0x71, 0x73, 0x06, 0x00, 0x13, 0x6e, 0x82, 0x05, 0x00, 0xaa, 0x03, 0x00, 0xda, 0x01, 0x00, 0xc1,
+  0x05, 0x00, 0x10, 0x02, 0x10, 0x81, 0xe0, 0x01, 0x00, 0x21, 0x0b, 0x00, 0xeb, 0x01, 0x21, 0x7d, 0x7d, 0xbf, 0x01, 0x00, 0x68, 0x00, 0x01, 0x3d,
+  0x00, 0x00, 0xd7, 0x01, 0x40, 0x79, 0x78, 0x74, 0x78, 0x50, 0x0b, 0x00, 0x6c, 0x00, 0x00, 0x63, 0x00, 0x01, 0x05, 0x00, 0x10, 0x7d, 0xa1, 0x05,
+  0x00, 0x01, 0x00, 0x11, 0x80, 0x02, 0x00, 0x50, 0x86, 0x81, 0x86, 0x48, 0x4a, 0xe1, 0x01, 0x10, 0x34, 0x40, 0x0b, 0x00, 0x03, 0x00, 0xe0, 0x45,
+  0x3f, 0x32, 0x17, 0x20, 0x3f, 0x44, 0x3f, 0x20, 0x07, 0x32, 0x07, 0x07, 0x3f, 0xbf, 0x03, 0x80, 0x3e, 0x44, 0x45, 0x44, 0x48, 0x45, 0x32, 0x1b,
+  0xb4, 0x03, 0xd0, 0x32, 0x29, 0x14, 0x0c, 0x0c, 0x07, 0x07, 0x04, 0x11, 0x3f, 0x44, 0x45, 0x41, 0x92, 0x05, 0x00, 0x2f, 0x0b, 0x20, 0x3f, 0x45,
+  0xb9, 0x03, 0xf0, 0x02, 0x3f, 0x32, 0x07, 0x3f, 0x03, 0x20, 0x32, 0x20, 0x1e, 0x18, 0x04, 0x8f, 0x04, 0x07, 0x02, 0x04, 0x3f, 0x80, 0x07, 0x31,
+  0x37, 0x44, 0x1e, 0x04, 0x04, 0xf0, 0x04, 0x3e, 0x37, 0x25, 0x02, 0x03, 0x0a, 0x11, 0x17, 0x0c, 0x00, 0x07, 0x8f, 0x00, 0x07, 0x04, 0x11, 0x32,
+  0x11, 0x2c, 0x9a, 0x03, 0xf0, 0x04, 0x3e, 0x2c, 0x03, 0x00, 0x25, 0x20, 0x18, 0x97, 0x04, 0x29, 0x37, 0x1e, 0x25, 0x1e, 0x25, 0x1e, 0x2c, 0x25,
+  0x25, 0x59, 0x09, 0x01, 0x99, 0x09, 0x00, 0xd1, 0x05, 0x70, 0x04, 0x2c, 0x3e, 0x41, 0x3b, 0x41, 0x3b, 0xfb, 0x0e, 0xa0, 0x35, 0x35, 0x18, 0x25,
+  0x1f, 0x2c, 0x2c, 0x2c, 0x0e, 0x18, 0xde, 0x01, 0xf1, 0x02, 0x25, 0x35, 0x25, 0x35, 0x29, 0x2c, 0x29, 0x20, 0x1b, 0x14, 0x1e, 0x1e, 0x25, 0x2c,
+  0x25, 0x25, 0x14, 0x06, 0x00, 0xf1, 0x35, 0x1f, 0x27, 0x25, 0x27, 0x27, 0x2d, 0x35, 0x2d, 0x18, 0x98, 0x86, 0x71, 0x76, 0x6d, 0x6a, 0x67, 0x6e,
+  0x81, 0x6c, 0x8f, 0x1b, 0x11, 0x0b, 0x1e, 0x25, 0x07, 0x07, 0x09, 0x1f, 0x2d, 0x25, 0x1f, 0x03, 0x7d, 0x97, 0x10, 0x11, 0x11, 0x8b, 0x82, 0x82,
+  0x6d, 0x60, 0x61, 0x60, 0x60, 0x65, 0x60, 0x6d, 0x69, 0x65, 0x61, 0x63, 0x61, 0x60, 0x61, 0x60, 0x65, 0x65, 0x69, 0x7d, 0x9b, 0x98, 0x6d, 0x6d,
+  0x8c, 0x8c, 0x70, 0xe1, 0x01, 0x09, 0x01, 0x00, 0x10, 0x67, 0xde, 0x01, 0x00, 0x02, 0x00, 0x00, 0xde, 0x01, 0x2a, 0x6d, 0x6e, 0xdf, 0x01, 0x00,
+  0x9e, 0x05, 0x00, 0x73, 0x01, 0x05, 0xdf, 0x01, 0x00, 0x65, 0x01, 0x12, 0x7c, 0xb2, 0x05, 0x42, 0x7c, 0x7c, 0x78, 0x7d, 0x18, 0x00, 0x00, 0xe4,
+  0x0a, 0x10, 0x75, 0x09, 0x00, 0x01, 0x2a, 0x00, 0x10, 0x7c, 0x91, 0x03, 0x00, 0x73, 0x05, 0x10, 0x73, 0x09, 0x00, 0x20, 0x71, 0x73, 0x65, 0x07,
+  0x00, 0x23, 0x0d, 0x32, 0x6c, 0x6e, 0x6e, 0x99, 0x05, 0x00, 0xe8, 0x05, 0xa0, 0x7d, 0x81, 0x7d, 0x78, 0x77, 0x78, 0x7c, 0x81, 0x81, 0x85, 0x6d,
+  0x05, 0x20, 0x81, 0x81, 0xff, 0x0c, 0x01, 0xe9, 0x01, 0x00, 0x60, 0x00, 0x00, 0x6a, 0x07, 0x02, 0x28, 0x02, 0x00, 0xbc, 0x03, 0x00, 0x2c, 0x00,
+  0x00, 0xd3, 0x01, 0x42, 0x81, 0x7d, 0x7d, 0x7a, 0xba, 0x03, 0x00, 0x06, 0x00, 0x00, 0xdf, 0x01, 0x32, 0x83, 0x81, 0x86, 0xc0, 0x03, 0x13, 0x48,
+  0x85, 0x12, 0xf0, 0x03, 0x45, 0x3f, 0x32, 0x20, 0x3f, 0x14, 0x11, 0x11, 0x32, 0x45, 0x20, 0x02, 0x20, 0x3f, 0x32, 0x3f, 0x41, 0x44, 0xe0, 0x01,
+  0x00, 0xf7, 0x01, 0xf1, 0x22, 0x11, 0x14, 0x29, 0x45, 0x45, 0x37, 0x97, 0x03, 0x04, 0x11, 0x07, 0x04, 0x29, 0x97, 0x0e, 0x3f, 0x44, 0x3f, 0x1e,
+  0x11, 0x0c, 0x44, 0x45, 0x44, 0x3f, 0x45, 0x45, 0x32, 0x44, 0x45, 0x44, 0x3e, 0x32, 0x37, 0x32, 0x37, 0x3f, 0x07, 0x1e, 0x32, 0x04, 0x04, 0x14,
+  0x03, 0x02, 0x02, 0x02, 0x00, 0x1e, 0xa5, 0x01, 0x41, 0x37, 0x44, 0x35, 0x11, 0xbf, 0x03, 0xf0, 0x03, 0x2c, 0x07, 0x02, 0x9a, 0x02, 0x00, 0x02,
+  0x07, 0x8f, 0x20, 0x97, 0x7e, 0x07, 0x17, 0x17, 0x11, 0x03, 0x37, 0x79, 0x05, 0x90, 0x37, 0x2c, 0x29, 0x03, 0x29, 0x37, 0x1e, 0x9a, 0x17, 0x9e,
+  0x01, 0x20, 0x2c, 0x2c, 0x86, 0x07, 0x00, 0x22, 0x0d, 0x00, 0x01, 0x00, 0x00, 0xca, 0x12, 0x51, 0x07, 0x04, 0x14, 0x35, 0x3b, 0xe1, 0x01, 0xf0,
+  0x04, 0x3b, 0x2c, 0x2c, 0x35, 0x1f, 0x2c, 0x18, 0x1f, 0x1e, 0x0b, 0x03, 0x04, 0x25, 0x13, 0x2c, 0x09, 0x1f, 0x2c, 0x35, 0xc7, 0x03, 0xf0, 0x02,
+  0x1e, 0x11, 0x79, 0x02, 0x09, 0x35, 0x18, 0x04, 0x04, 0x00, 0x03, 0x18, 0x18, 0x18, 0x0e, 0x0e, 0x0e, 0xe2, 0x01, 0xf1, 0x21, 0x25, 0x2c, 0x02,
+  0x81, 0x82, 0x82, 0x85, 0x6d, 0x6c, 0x6c, 0x02, 0x11, 0x14, 0x1e, 0x0c, 0x7e, 0x91, 0x1f, 0x2d, 0x2d, 0x1f, 0x0e, 0x1f, 0x25, 0x1a, 0x04, 0x09,
+  0x14, 0x9d, 0x86, 0x82, 0x8c, 0x67, 0x74, 0x90, 0x76, 0x65, 0x5c, 0x65, 0x5c, 0x61, 0x60, 0x65, 0x68, 0x70, 0x65, 0x61, 0x60, 0x01, 0x00, 0xc1,
+  0x71, 0x85, 0x9d, 0x8b, 0x6e, 0x6d, 0x89, 0x9c, 0x82, 0x61, 0x65, 0x60, 0xd3, 0x10, 0x07, 0xc4, 0x03, 0x31, 0x68, 0x65, 0x67, 0xdf, 0x01, 0x01,
+  0xe1, 0x01, 0x10, 0x71, 0x02, 0x00, 0x05, 0xdf, 0x01, 0x00, 0xc7, 0x01, 0x05, 0x01, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x02, 0x00, 0x01, 0x21, 0x0b,
+  0x24, 0x6c, 0x71, 0x1b, 0x00, 0x00, 0xa0, 0x10, 0x10, 0x75, 0x63, 0x05, 0x01, 0x79, 0x03, 0x00, 0xdd, 0x0c, 0x00, 0x09, 0x00, 0x00, 0x65, 0x07,
+  0x60, 0x74, 0x75, 0x74, 0x78, 0x78, 0x74, 0xc6, 0x03, 0x00, 0x5f, 0x07, 0x01, 0xea, 0x0e, 0x30, 0x6c, 0x72, 0x71, 0xe5, 0x01, 0x90, 0x74, 0x73,
+  0x74, 0x7c, 0x77, 0x78, 0x73, 0x73, 0x78, 0xb5, 0x10, 0x05, 0x01, 0x00, 0x01, 0xe9, 0x01, 0x00, 0xe8, 0x01, 0x01, 0xcc, 0x01, 0x11, 0x7e, 0xe6,
+  0x01, 0x01, 0x0b, 0x02, 0x02, 0x01, 0x00, 0x20, 0x7d, 0x7f, 0xfd, 0x01, 0x00, 0xc3, 0x03, 0x20, 0x7d, 0x7e, 0xc7, 0x03, 0x11, 0x80, 0x3b, 0x00,
+  0x10, 0x48, 0x80, 0x07, 0x30, 0x3f, 0x22, 0x37, 0xde, 0x01, 0xf0, 0x01, 0x45, 0x20, 0x17, 0x0c, 0x3f, 0x3f, 0x32, 0x11, 0x03, 0x11, 0x37, 0x43,
+  0x11, 0x1e, 0x3f, 0x2e, 0xe0, 0x01, 0x12, 0x44, 0x80, 0x07, 0xf0, 0x00, 0x1e, 0x1b, 0x11, 0x3f, 0x45, 0x14, 0x02, 0x01, 0x03, 0x09, 0x03, 0x20,
+  0x11, 0x02, 0x18, 0xb8, 0x05, 0x20, 0x32, 0x20, 0x88, 0x07, 0x00, 0xdc, 0x10, 0xf1, 0x04, 0x3f, 0x37, 0x29, 0x2c, 0x3f, 0x32, 0x32, 0x32, 0x20,
+  0x20, 0x32, 0x97, 0x02, 0x0a, 0x02, 0x00, 0x00, 0x00, 0x02, 0x5a, 0x05, 0x50, 0x32, 0x2c, 0x3f, 0x18, 0x09, 0xe0, 0x01, 0xf0, 0x03, 0x37, 0x11,
+  0x03, 0x07, 0x97, 0x8f, 0x97, 0x07, 0x17, 0x9a, 0x1e, 0x1e, 0x02, 0x04, 0x11, 0x2c, 0x07, 0x09, 0x3d, 0x0b, 0xa0, 0x35, 0x2c, 0x18, 0x25, 0x14,
+  0x2c, 0x37, 0x29, 0x1e, 0x17, 0x1b, 0x0d, 0x00, 0x75, 0x05, 0x11, 0x35, 0x02, 0x00, 0x00, 0xb7, 0x07, 0x70, 0x2c, 0x37, 0x3b, 0x37, 0x07, 0x04,
+  0x03, 0x18, 0x0d, 0x00, 0x4a, 0x0b, 0x20, 0x04, 0x1e, 0xb6, 0x03, 0x90, 0x18, 0x18, 0x09, 0x25, 0x25, 0x25, 0x0e, 0x2c, 0x25, 0x81, 0x07, 0x70,
+  0x25, 0x0a, 0x0c, 0x14, 0x07, 0x73, 0x02, 0x1b, 0x02, 0xf0, 0x15, 0x20, 0x03, 0x04, 0x1e, 0x0b, 0x00, 0x8f, 0x05, 0x8f, 0x09, 0x25, 0x27, 0x14,
+  0x04, 0x0e, 0x03, 0x86, 0x7c, 0x71, 0x75, 0x78, 0x7d, 0x03, 0x1e, 0x25, 0x18, 0x03, 0x79, 0x81, 0x95, 0x11, 0x1f, 0x2d, 0x27, 0x1f, 0x27, 0x5a,
+  0x0b, 0xf0, 0x03, 0x0a, 0x79, 0x6c, 0x81, 0x6d, 0x66, 0x6c, 0x76, 0x65, 0x61, 0x60, 0x5c, 0x60, 0x5c, 0x61, 0x65, 0x61, 0x69, 0xe1, 0x01, 0x00,
+  0x02, 0x00, 0xa0, 0x66, 0x7c, 0x9b, 0x75, 0x67, 0x62, 0x75, 0x92, 0x70, 0x67, 0xdf, 0x01, 0x08, 0xe0, 0x01, 0x01, 0xde, 0x01, 0x06, 0xc0, 0x03,
+  0x00, 0xde, 0x01, 0x05, 0xc0, 0x03, 0x01, 0xbe, 0x03, 0x03, 0xc8, 0x01, 0x00, 0x7a, 0x03, 0x01, 0x01, 0x00, 0x72, 0x75, 0x75, 0x71, 0x67, 0x5f,
+  0x5b, 0x5f, 0xe1, 0x01, 0x01, 0x98, 0x12, 0x03, 0xa0, 0x12, 0x00, 0xc9, 0x01, 0x00, 0x81, 0x05, 0x00, 0x04, 0x02, 0x40, 0x75, 0x73, 0x75, 0x71,
+  0xc9, 0x0e, 0x00, 0x9d, 0x14, 0x30, 0x73, 0x71, 0x6e, 0xc7, 0x12, 0x01, 0x2b, 0x0b, 0x02, 0x4d, 0x09, 0x00, 0xd1, 0x10, 0x73, 0x73, 0x73, 0x74,
+  0x74, 0x73, 0x73, 0x73, 0x12, 0x0b, 0x11, 0x8b, 0x02, 0x00, 0x00, 0x01, 0x00, 0x30, 0x81, 0x81, 0x7e, 0xb8, 0x01, 0x20, 0x81, 0x7e, 0x8d, 0x0b,
+  0x00, 0xce, 0x01, 0x12, 0x7d, 0xf8, 0x0e, 0x03, 0xe2, 0x01, 0x00, 0x02, 0x00, 0x43, 0x7e, 0x7c, 0x7d, 0x7f, 0xdf, 0x01, 0x41, 0x83, 0x86, 0x48,
+  0x3f, 0x1e, 0x0b, 0x00, 0x01, 0x00, 0x40, 0x44, 0x45, 0x0a, 0x11, 0xa6, 0x01, 0x82, 0x29, 0x1b, 0x32, 0x20, 0x2c, 0x3f, 0x37, 0x43, 0xc1, 0x12,
+  0x10, 0x41, 0xc0, 0x03, 0x10, 0x44, 0x4a, 0x09, 0xb1, 0x32, 0x11, 0x1e, 0x97, 0x03, 0x03, 0x01, 0x03, 0x03, 0x02, 0x37, 0xa0, 0x05, 0x20, 0x20,
+  0x11, 0xa2, 0x05, 0x00, 0x55, 0x09, 0xc0, 0x14, 0x03, 0x18, 0x37, 0x20, 0x11, 0x20, 0x07, 0x0a, 0x11, 0x03, 0x00, 0xdf, 0x01, 0x20, 0x00, 0x03,
+  0x86, 0x03, 0x70, 0x37, 0x1e, 0x02, 0x2c, 0x11, 0x25, 0x3e, 0x9f, 0x05, 0xe0, 0x18, 0x97, 0x1e, 0x97, 0x02, 0x97, 0x07, 0x17, 0x8f, 0x07, 0x17,
+  0x07, 0x0c, 0x32, 0xa5, 0x03, 0x01, 0x4d, 0x16, 0x91, 0x04, 0x25, 0x37, 0x3f, 0x37, 0x25, 0x1e, 0x25, 0x2c, 0x1f, 0x0d, 0x10, 0x37, 0x02, 0x00,
+  0x00, 0xdb, 0x01, 0xd0, 0x37, 0x2c, 0x07, 0x03, 0x35, 0x37, 0x3e, 0x2c, 0x2c, 0x25, 0x3e, 0x35, 0x3b, 0xba, 0x12, 0x30, 0x25, 0x02, 0x07, 0x4e,
+  0x16, 0xf1, 0x55, 0x0b, 0x1e, 0x09, 0x25, 0x35, 0x2d, 0x35, 0x2c, 0x2d, 0x25, 0x2c, 0x35, 0x25, 0x07, 0x03, 0x03, 0x00, 0x97, 0x79, 0x07, 0x25,
+  0x39, 0x35, 0x35, 0x1f, 0x18, 0x25, 0x25, 0x97, 0x9a, 0x18, 0x18, 0x04, 0x1f, 0x27, 0x18, 0x03, 0x79, 0x0c, 0x2c, 0x97, 0x97, 0x7c, 0x6c, 0x6c,
+  0x86, 0x1e, 0x25, 0x0c, 0x00, 0x73, 0x95, 0x0c, 0x95, 0x02, 0x07, 0x13, 0x27, 0x27, 0x2d, 0x27, 0x1f, 0x1f, 0x18, 0x81, 0x78, 0x92, 0x86, 0x6e,
+  0x67, 0x6d, 0x65, 0x60, 0x60, 0x61, 0x5c, 0x5c, 0x5c, 0x5c, 0x61, 0x60, 0x61, 0x68, 0x69, 0x65, 0x61, 0x61, 0x60, 0x61, 0x65, 0x67, 0x70, 0x8c,
+  0x6c, 0x6c, 0x67, 0x70, 0x6c, 0x6d, 0x71, 0xd1, 0x12, 0x01, 0xe3, 0x01, 0x00, 0x03, 0x00, 0x01, 0xe1, 0x01, 0x02, 0x3f, 0x0b, 0x00, 0xde, 0x01,
+  0x0a, 0xdf, 0x01, 0x00, 0xdc, 0x01, 0x02, 0x02, 0x00, 0x01, 0xa9, 0x01, 0x00, 0x04, 0x00, 0x11, 0x71, 0xf6, 0x0a, 0x52, 0x71, 0x5f, 0x5e, 0x5f,
+  0x68, 0xe7, 0x03, 0x00, 0xba, 0x01, 0x03, 0x8f, 0x09, 0x00, 0x15, 0x09, 0x01, 0x7b, 0x05, 0x52, 0x7d, 0x7c, 0x7c, 0x75, 0x71, 0x0a, 0x0b, 0x15,
+  0x71, 0xd9, 0x0e, 0x30, 0x6c, 0x67, 0x6a, 0x3b, 0x0b, 0x02, 0x01, 0x00, 0x00, 0xac, 0x05, 0x00, 0x45, 0x09, 0x80, 0x6f, 0x73, 0x73, 0x74, 0x79,
+  0x78, 0x79, 0x81, 0x58, 0x16, 0x11, 0x8d, 0x75, 0x14, 0x01, 0x01, 0x00, 0x61, 0x86, 0x02, 0x02, 0x02, 0x8b, 0x02, 0xd4, 0x01, 0x10, 0x7e, 0xb9,
+  0x05, 0x00, 0xfb, 0x01, 0x00, 0x6c, 0x07, 0x00, 0xe4, 0x01, 0x00, 0x98, 0x05, 0x00, 0x13, 0x02, 0x00, 0xde, 0x01, 0x00, 0xd0, 0x12, 0x60, 0x45,
+  0x29, 0x1b, 0x45, 0x45, 0x43, 0x9f, 0x05, 0xf0, 0x05, 0x48, 0x44, 0x45, 0x20, 0x3f, 0x20, 0x20, 0x1e, 0x17, 0x37, 0x32, 0x29, 0x0c, 0x03, 0x22,
+  0x3f, 0x45, 0x17, 0x32, 0x3f, 0xc0, 0x03, 0x20, 0x41, 0x44, 0xc2, 0x03, 0xf0, 0x07, 0x44, 0x3f, 0x1e, 0x03, 0x20, 0x32, 0x32, 0x11, 0x01, 0x01,
+  0x01, 0x01, 0x03, 0x3f, 0x41, 0x45, 0x41, 0x3f, 0x29, 0x04, 0x02, 0x07, 0xf7, 0x01, 0x20, 0x41, 0x37, 0x40, 0x03, 0x80, 0x32, 0x25, 0x97, 0x03,
+  0x02, 0x02, 0x86, 0x88, 0xde, 0x01, 0x31, 0x00, 0x00, 0x09, 0xe0, 0x01, 0x30, 0x04, 0x7e, 0x1e, 0x9f, 0x05, 0xf1, 0x00, 0x3e, 0x37, 0x37, 0x04,
+  0x9b, 0x1e, 0x97, 0x02, 0x00, 0x81, 0x88, 0x9b, 0x02, 0x11, 0x0e, 0x25, 0x0b, 0xb0, 0x3e, 0x3b, 0x35, 0x2c, 0x1e, 0x03, 0x00, 0x1e, 0x2c, 0x37,
+  0x2c, 0xd9, 0x10, 0x30, 0x37, 0x37, 0x2c, 0xe6, 0x01, 0x00, 0x02, 0x00, 0x70, 0x18, 0x2c, 0x2c, 0x37, 0x04, 0x1e, 0x18, 0x01, 0x0f, 0x12, 0x3b,
+  0xbb, 0x12, 0xf0, 0x19, 0x41, 0x3b, 0x2c, 0x86, 0x03, 0x25, 0x2c, 0x2c, 0x01, 0x03, 0x2c, 0x04, 0x25, 0x35, 0x35, 0x3b, 0x2d, 0x2c, 0x27, 0x25,
+  0x25, 0x11, 0x02, 0x8f, 0x8b, 0x8b, 0x0d, 0x92, 0x86, 0x1e, 0x35, 0x39, 0x3b, 0x25, 0x25, 0x2c, 0x25, 0x8f, 0x04, 0x99, 0x54, 0x16, 0xf0, 0x1c,
+  0x0b, 0x8b, 0x79, 0x03, 0x18, 0x25, 0x07, 0x81, 0x79, 0x03, 0x1e, 0x27, 0x25, 0x03, 0x00, 0x03, 0x97, 0x0b, 0x11, 0x8f, 0x7e, 0x09, 0x27, 0x2d,
+  0x27, 0x27, 0x13, 0x13, 0x14, 0x7d, 0x7d, 0x97, 0x97, 0x8b, 0x9b, 0x76, 0x5f, 0x60, 0x61, 0x5d, 0x5c, 0x61, 0x5d, 0xe3, 0x01, 0x00, 0x65, 0x09,
+  0xf4, 0x04, 0x61, 0x65, 0x70, 0x71, 0x6d, 0x62, 0x67, 0x81, 0x92, 0x85, 0x67, 0x66, 0x78, 0x8c, 0x6d, 0x6d, 0x82, 0x7c, 0x69, 0xc1, 0x03, 0x00,
+  0xdc, 0x01, 0x11, 0x67, 0xdf, 0x01, 0x04, 0xa0, 0x05, 0x0a, 0x3f, 0x0b, 0x00, 0xdb, 0x01, 0x01, 0xde, 0x01, 0x00, 0x01, 0x00, 0x00, 0x10, 0x0f,
+  0xb0, 0x71, 0x6d, 0x6c, 0x6d, 0x6d, 0x6d, 0x68, 0x61, 0x5e, 0x5e, 0x5f, 0x26, 0x11, 0xa0, 0x67, 0x65, 0x67, 0x61, 0x60, 0x61, 0x62, 0x68, 0x6a,
+  0x6d, 0xa3, 0x03, 0x10, 0x75, 0x54, 0x09, 0x00, 0x44, 0x0d, 0x10, 0x7c, 0x9b, 0x0d, 0x20, 0x67, 0x62, 0x9f, 0x14, 0x01, 0xb6, 0x03, 0x21, 0x67,
+  0x6a, 0x06, 0x00, 0x32, 0x6c, 0x6a, 0x67, 0xed, 0x01, 0x40, 0x6e, 0x6e, 0x71, 0x72, 0xe5, 0x0e, 0x10, 0x73, 0xa1, 0x13, 0x70, 0x73, 0x74, 0x79,
+  0x79, 0x7d, 0x83, 0x8b, 0x5a, 0x16, 0x12, 0x02, 0x3e, 0x18, 0x01, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x80, 0x14, 0x10, 0x00, 0xe6, 0x0e, 0x72,
+  0x02, 0x8b, 0x02, 0x81, 0x00, 0x81, 0x83, 0x15, 0x0d, 0x02, 0xda, 0x01, 0x40, 0x86, 0x86, 0x89, 0x8d, 0x28, 0x00, 0x70, 0x45, 0x29, 0x07, 0x44,
+  0x48, 0x3f, 0x29, 0xc2, 0x01, 0xe0, 0x45, 0x3f, 0x0c, 0x11, 0x32, 0x04, 0x07, 0x14, 0x1b, 0x3f, 0x2e, 0x17, 0x11, 0x20, 0x98, 0x03, 0x01, 0xdf,
+  0x01, 0x01, 0xa1, 0x05, 0xf0, 0x0b, 0x44, 0x44, 0x32, 0x07, 0x02, 0x29, 0x11, 0x32, 0x1e, 0x02, 0x01, 0x01, 0x02, 0x09, 0x3f, 0x41, 0x3f, 0x44,
+  0x41, 0x11, 0x88, 0x02, 0x01, 0x0c, 0x37, 0x45, 0x2f, 0x1a, 0xc1, 0x00, 0x00, 0x0a, 0x32, 0x07, 0x02, 0x88, 0x88, 0x00, 0x01, 0x86, 0x03, 0xc0,
+  0x03, 0x01, 0x92, 0x12, 0x40, 0x2c, 0x02, 0x00, 0x0e, 0x5f, 0x09, 0xf0, 0x04, 0x3e, 0x3e, 0x37, 0x03, 0x00, 0x0a, 0x11, 0x07, 0x1b, 0x8f, 0x7e,
+  0x07, 0x20, 0x2c, 0x20, 0x2c, 0x29, 0x35, 0x37, 0xb9, 0x01, 0x50, 0x18, 0x02, 0x00, 0x02, 0x02, 0xe1, 0x01, 0x00, 0x1c, 0x0d, 0x40, 0x32, 0x0e,
+  0x7e, 0x1e, 0xba, 0x03, 0x50, 0x25, 0x2c, 0x14, 0x03, 0x11, 0x09, 0x0f, 0x00, 0xdd, 0x01, 0x01, 0x05, 0x00, 0x40, 0x3b, 0x3b, 0x3b, 0x35, 0x85,
+  0x05, 0x80, 0x35, 0x35, 0x14, 0x09, 0x25, 0x25, 0x2c, 0x2d, 0xee, 0x10, 0xf0, 0x29, 0x25, 0x2d, 0x18, 0x04, 0x79, 0x79, 0x0c, 0x17, 0x02, 0x71,
+  0x79, 0x14, 0x25, 0x35, 0x35, 0x39, 0x3b, 0x35, 0x25, 0x03, 0x0e, 0x13, 0x25, 0x2d, 0x25, 0x27, 0x1e, 0x02, 0x6c, 0x00, 0x1f, 0x2c, 0x27, 0x0e,
+  0x25, 0x25, 0x1e, 0x1f, 0x1f, 0x0e, 0x07, 0x07, 0x07, 0x04, 0x03, 0x03, 0x09, 0x13, 0x25, 0x2d, 0x0e, 0x0b, 0x0e, 0x09, 0x9b, 0x79, 0x4f, 0x0b,
+  0x61, 0x15, 0x92, 0x67, 0x60, 0x5c, 0x5c, 0xc1, 0x03, 0x00, 0xe1, 0x01, 0xf0, 0x06, 0x61, 0x69, 0x66, 0x67, 0x71, 0x6c, 0x71, 0x6c, 0x8c, 0x8c,
+  0x8b, 0x8c, 0x86, 0x8c, 0x92, 0x8c, 0x6e, 0x71, 0x92, 0x98, 0x71, 0xdf, 0x01, 0x01, 0xe1, 0x01, 0x01, 0xe3, 0x01, 0x02, 0xe2, 0x01, 0x00, 0x01,
+  0x00, 0x00, 0xe0, 0x01, 0x01, 0xe1, 0x01, 0x01, 0x9b, 0x03, 0x01, 0xe0, 0x01, 0x00, 0xe2, 0x01, 0x01, 0x03, 0x0f, 0x00, 0xde, 0x01, 0x40, 0x6e,
+  0x68, 0x67, 0x64, 0xb4, 0x10, 0xb1, 0x57, 0x58, 0x56, 0x56, 0x56, 0x58, 0x58, 0x58, 0x58, 0x56, 0x55, 0x09, 0x00, 0xb1, 0x5f, 0x61, 0x61, 0x5e,
+  0x61, 0x65, 0x68, 0x6a, 0x6d, 0x71, 0x71, 0x09, 0x02, 0x50, 0x6e, 0x62, 0x5f, 0x62, 0x5f, 0xef, 0x0e, 0x30, 0x67, 0x67, 0x6a, 0xdd, 0x01, 0x00,
+  0xf4, 0x0e, 0x00, 0xb3, 0x03, 0x10, 0x6e, 0xc3, 0x05, 0x00, 0x0a, 0x00, 0x01, 0x0d, 0x00, 0x00, 0x08, 0x0d, 0x70, 0x73, 0x75, 0x79, 0x78, 0x79,
+  0x79, 0x7e, 0x3b, 0x18, 0x00, 0xb9, 0x01, 0x90, 0x02, 0x02, 0x8f, 0x02, 0x8b, 0x02, 0x8f, 0x8f, 0x02, 0x25, 0x1a, 0x20, 0x8f, 0x86, 0x21, 0x1a,
+  0x10, 0x02, 0x0c, 0x00, 0x20, 0x8f, 0x02, 0xd2, 0x01, 0x00, 0xdc, 0x01, 0x01, 0xad, 0x05, 0x40, 0x86, 0x86, 0x02, 0x89, 0x17, 0x00, 0x60, 0x94,
+  0x8f, 0x94, 0x45, 0x45, 0x20, 0x5a, 0x16, 0x00, 0xfa, 0x0e, 0x10, 0x44, 0x7a, 0x07, 0xb0, 0x03, 0x04, 0x03, 0x25, 0x3f, 0x32, 0x32, 0x3f, 0x32,
+  0x1b, 0x1e, 0xc6, 0x01, 0x00, 0x7f, 0x03, 0x00, 0xc6, 0x10, 0xf1, 0x20, 0x41, 0x1e, 0x11, 0x04, 0x09, 0x32, 0x07, 0x1b, 0x0a, 0x88, 0x01, 0x01,
+  0x01, 0x20, 0x3f, 0x37, 0x44, 0x3f, 0x3f, 0x11, 0x88, 0x88, 0x01, 0x03, 0x3f, 0x3f, 0x3f, 0x25, 0x03, 0x02, 0x00, 0x04, 0x29, 0x1e, 0x02, 0x00,
+  0x88, 0x00, 0x88, 0x02, 0x02, 0x17, 0x94, 0x00, 0x00, 0x00, 0x88, 0x3c, 0x18, 0x41, 0x1e, 0x7e, 0x00, 0x04, 0xe0, 0x01, 0xf1, 0x01, 0x37, 0x2c,
+  0x94, 0x86, 0x8f, 0x02, 0x07, 0x14, 0x9b, 0x86, 0x02, 0x1e, 0x20, 0x0e, 0x32, 0x35, 0xbf, 0x03, 0x70, 0x35, 0x14, 0x04, 0x02, 0x02, 0x02, 0x8f,
+  0xbb, 0x03, 0x00, 0x9c, 0x05, 0x21, 0x0c, 0x00, 0x63, 0x07, 0x90, 0x1e, 0x32, 0x3e, 0x1e, 0x0a, 0x2c, 0x07, 0x1e, 0x35, 0x46, 0x0b, 0x10, 0x41,
+  0x1c, 0x0d, 0x20, 0x35, 0x3b, 0x20, 0x00, 0x90, 0x2c, 0x2d, 0x35, 0x25, 0x1f, 0x18, 0x1e, 0x0e, 0x25, 0x0a, 0x00, 0x10, 0x35, 0xad, 0x07, 0x20,
+  0x17, 0x07, 0x1e, 0x1a, 0xf3, 0x2a, 0x79, 0x81, 0x03, 0x1f, 0x39, 0x35, 0x35, 0x35, 0x09, 0x04, 0x18, 0x2d, 0x2d, 0x27, 0x27, 0x1f, 0x2c, 0x0c,
+  0x00, 0x09, 0x2c, 0x27, 0x2d, 0x2d, 0x2d, 0x0e, 0x01, 0x01, 0x13, 0x1f, 0x1f, 0x18, 0x01, 0x8f, 0x0e, 0x1e, 0x1f, 0x13, 0x27, 0x25, 0x00, 0x99,
+  0x0c, 0x97, 0x79, 0x92, 0x9b, 0x94, 0x0a, 0x14, 0x11, 0x9d, 0x6d, 0x60, 0x5c, 0x5c, 0x5d, 0x02, 0x00, 0xf0, 0x06, 0x5c, 0x5c, 0x61, 0x69, 0x82,
+  0x90, 0x85, 0x85, 0x85, 0x92, 0x6c, 0x73, 0x8b, 0x8c, 0x97, 0x97, 0x9a, 0x7d, 0x8c, 0x92, 0x82, 0x9b, 0x05, 0x00, 0x02, 0x00, 0x61, 0x64, 0x65,
+  0x68, 0x64, 0x68, 0x64, 0x01, 0x00, 0x12, 0x65, 0x09, 0x00, 0x02, 0xe4, 0x01, 0x01, 0x65, 0x09, 0x01, 0x07, 0x00, 0x01, 0xe6, 0x01, 0x00, 0xda,
+  0x01, 0x00, 0xf9, 0x01, 0xf0, 0x28, 0x68, 0x64, 0x61, 0x64, 0x61, 0x5f, 0x61, 0x5e, 0x5e, 0x5a, 0x58, 0x56, 0x56, 0x53, 0x55, 0x56, 0x53, 0x55,
+  0x53, 0xa4, 0x53, 0xa3, 0xa4, 0xa4, 0x53, 0x55, 0x58, 0x58, 0x55, 0x53, 0x55, 0x56, 0x58, 0x5e, 0x60, 0x67, 0x6a, 0x6d, 0x6e, 0x6e, 0x6e, 0x68,
+  0x62, 0x5e, 0x5f, 0x5e, 0x62, 0x68, 0x6e, 0x71, 0x6e, 0x6d, 0x6a, 0x67, 0x66, 0xb8, 0x03, 0x10, 0x66, 0x79, 0x14, 0x40, 0x75, 0x71, 0x73, 0x73,
+  0x6a, 0x0b, 0x10, 0x73, 0xc1, 0x03, 0x00, 0x8a, 0x09, 0x10, 0x78, 0x7f, 0x09, 0x10, 0x7c, 0x93, 0x03, 0x10, 0x89, 0x0e, 0x1a, 0x41, 0x81, 0x86,
+  0x86, 0x8d, 0x74, 0x14, 0x33, 0x86, 0x89, 0x86, 0xca, 0x03, 0x81, 0x03, 0x8f, 0x03, 0x94, 0x94, 0x03, 0x8f, 0x03, 0xef, 0x01, 0x10, 0x8d, 0xb3,
+  0x05, 0x00, 0x1f, 0x00, 0xc0, 0x86, 0x86, 0x02, 0x02, 0x02, 0x8f, 0x94, 0x94, 0x95, 0x95, 0x95, 0x94, 0xf0, 0x8b, 0x48, 0x45, 0x20, 0x0c, 0x45,
+  0x48, 0x45, 0x45, 0x45, 0x45, 0x44, 0x3f, 0x11, 0x07, 0x03, 0x04, 0x03, 0x03, 0x03, 0x07, 0x18, 0x11, 0x14, 0x14, 0x11, 0x04, 0x02, 0x1e, 0x37,
+  0x41, 0x41, 0x41, 0x41, 0x3e, 0x41, 0x44, 0x45, 0x44, 0x44, 0x20, 0x04, 0x18, 0x02, 0x95, 0x11, 0x04, 0x07, 0x02, 0x01, 0x01, 0x01, 0x03, 0x37,
+  0x1e, 0x20, 0x41, 0x41, 0x3f, 0x11, 0x00, 0x01, 0x02, 0x18, 0x32, 0x3f, 0x32, 0x07, 0x02, 0x02, 0x86, 0x0a, 0x37, 0x17, 0x02, 0x88, 0x00, 0x00,
+  0x88, 0x03, 0x8f, 0x07, 0x00, 0x00, 0x7e, 0x00, 0x02, 0x2c, 0x37, 0x37, 0x35, 0x37, 0x0e, 0x00, 0x7e, 0x04, 0x37, 0x3e, 0x41, 0x41, 0x3e, 0x3b,
+  0x32, 0x02, 0x03, 0x07, 0x02, 0x0d, 0x0c, 0x88, 0x86, 0x02, 0x1e, 0x32, 0x20, 0x2c, 0x14, 0x25, 0x3e, 0x3b, 0x3e, 0x35, 0x2c, 0x2c, 0x37, 0x11,
+  0x11, 0x17, 0x8f, 0x25, 0x37, 0x37, 0x2c, 0x2c, 0x2c, 0x2c, 0x37, 0x07, 0x86, 0x2c, 0x32, 0x2c, 0x2c, 0x32, 0x2c, 0x1e, 0x17, 0x07, 0x18, 0x20,
+  0x03, 0x03, 0x2c, 0x41, 0x3e, 0x02, 0x00, 0x51, 0x3b, 0x3b, 0x35, 0x3b, 0x35, 0x01, 0x00, 0xf1, 0x5e, 0x2c, 0x2d, 0x25, 0x0e, 0x1f, 0x1e, 0x18,
+  0x0e, 0x0a, 0x1f, 0x2c, 0x2d, 0x27, 0x0e, 0x1e, 0x1e, 0x14, 0x25, 0x97, 0x03, 0x1e, 0x09, 0x03, 0x86, 0x7e, 0x79, 0x04, 0x25, 0x35, 0x2c, 0x2c,
+  0x00, 0x04, 0x25, 0x27, 0x27, 0x27, 0x1f, 0x0e, 0x18, 0x1f, 0x25, 0x27, 0x27, 0x2d, 0x27, 0x27, 0x1f, 0x03, 0x04, 0x09, 0x1f, 0x27, 0x13, 0x1f,
+  0x1e, 0x18, 0x0a, 0x13, 0x1f, 0x27, 0x27, 0x27, 0x13, 0x14, 0x86, 0x8b, 0x79, 0x97, 0x0c, 0x07, 0x0a, 0x11, 0x98, 0x8c, 0x69, 0x61, 0x5c, 0x5d,
+  0x5e, 0x5d, 0x5e, 0x59, 0x5c, 0x59, 0x5c, 0x5a, 0x5c, 0x5c, 0x5c, 0x5e, 0x76, 0x85, 0x67, 0x68, 0x71, 0x81, 0x8b, 0x86, 0x92, 0x79, 0x8c, 0x9a,
+  0x07, 0x9b, 0x92, 0x82, 0x67, 0x61, 0x01, 0x00, 0x50, 0x65, 0x64, 0x65, 0x61, 0x64, 0x02, 0x00, 0x21, 0x64, 0x5b, 0x01, 0x00, 0x10, 0x57, 0x01,
+  0x00, 0xf0, 0x20, 0x5b, 0x5b, 0x61, 0x64, 0x68, 0x68, 0x68, 0x64, 0x64, 0x61, 0x5e, 0x61, 0x64, 0x67, 0x64, 0x67, 0x68, 0x6d, 0x6d, 0x6d, 0x6d,
+  0x68, 0x68, 0x64, 0x5e, 0x5e, 0x5e, 0x5e, 0x5a, 0x5b, 0x5a, 0x5e, 0x5a, 0x5b, 0x58, 0x5b, 0x58, 0x5b, 0x56, 0x56, 0x58, 0x56, 0x56, 0x55, 0x56,
+  0x56, 0x53, 0x01, 0x00, 0xf1, 0x13, 0x56, 0x53, 0x56, 0x58, 0x56, 0x53, 0xa4, 0x53, 0xa4, 0x55, 0x56, 0x5a, 0x5f, 0x5f, 0x67, 0x61, 0x67, 0x5f,
+  0x5f, 0x5a, 0x5e, 0x5a, 0x5f, 0x67, 0x71, 0x71, 0x6e, 0x6e, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e, 0x6d, 0x07, 0x00, 0xf5, 0x0e, 0x6c, 0x71, 0x6e, 0x6c,
+  0x6c, 0x6e, 0x71, 0x73, 0x73, 0x7c, 0x75, 0x73, 0x71, 0x73, 0x72, 0x73, 0x74, 0x78, 0x7c, 0x7d, 0x7d, 0x7d, 0x7c, 0x7d, 0x7d, 0x81, 0x81, 0x81,
+  0x86, 0x01, 0x00, 0x34, 0x02, 0x86, 0x86, 0x10, 0x00, 0xa0, 0x89, 0x02, 0x8f, 0x8f, 0x94, 0x03, 0x94, 0x8f, 0x94, 0x8f, 0x01, 0x00, 0xf1, 0x0d,
+  0x94, 0x94, 0x94, 0x8f, 0x94, 0x94, 0x8f, 0x02, 0x86, 0x02, 0x86, 0x02, 0x02, 0x02, 0x8f, 0x8f, 0x95, 0x95, 0x9a, 0x04, 0x07, 0x07, 0x05, 0x07,
+  0x45, 0x48, 0x3f, 0x0d, 0xe0, 0x01, 0xf1, 0x05, 0x44, 0x43, 0x32, 0x03, 0x25, 0x1e, 0x04, 0x09, 0x14, 0x03, 0x0e, 0x03, 0x03, 0x01, 0x11, 0x25,
+  0x32, 0x07, 0x03, 0x3e, 0xdf, 0x01, 0xf2, 0x19, 0x41, 0x44, 0x44, 0x44, 0x41, 0x1e, 0x25, 0x20, 0x09, 0x03, 0x02, 0x04, 0x8f, 0x01, 0x88, 0x88,
+  0x00, 0x18, 0x3f, 0x0c, 0x2c, 0x44, 0x3f, 0x41, 0x11, 0x02, 0x02, 0x03, 0x32, 0x41, 0x32, 0x11, 0x00, 0x02, 0x04, 0x11, 0x02, 0x20, 0x18, 0x00,
+  0x01, 0x00, 0xf0, 0x37, 0x02, 0x8d, 0x00, 0x00, 0x00, 0x8f, 0x2c, 0x3e, 0x37, 0x3e, 0x2c, 0x03, 0x00, 0x00, 0x14, 0x3e, 0x37, 0x3e, 0x3e, 0x3e,
+  0x37, 0x2c, 0x14, 0x17, 0x97, 0x03, 0x03, 0x0a, 0x8f, 0x00, 0x0c, 0x20, 0x25, 0x32, 0x2c, 0x2c, 0x3e, 0x3e, 0x3e, 0x35, 0x35, 0x25, 0x20, 0x37,
+  0x25, 0x20, 0x20, 0x25, 0x14, 0x2c, 0x3e, 0x37, 0x25, 0x2c, 0x37, 0x37, 0x97, 0x04, 0x32, 0x35, 0x32, 0x2c, 0x25, 0x32, 0x11, 0x07, 0x17, 0x0c,
+  0x09, 0x37, 0x23, 0x00, 0x30, 0x3e, 0x2c, 0x3b, 0xdc, 0x01, 0x40, 0x3b, 0x3b, 0x35, 0x25, 0xe0, 0x01, 0xf0, 0x21, 0x35, 0x35, 0x18, 0x18, 0x0e,
+  0x1e, 0x04, 0x00, 0x0a, 0x25, 0x2d, 0x2c, 0x2c, 0x04, 0x00, 0x7e, 0x18, 0x1e, 0x25, 0x2c, 0x25, 0x20, 0x07, 0x8b, 0x8f, 0x03, 0x1f, 0x1e, 0x0b,
+  0x1e, 0x08, 0x1f, 0x2d, 0x27, 0x2d, 0x2d, 0x1f, 0x04, 0x13, 0x27, 0x1f, 0x27, 0x2d, 0x27, 0x2d, 0x1f, 0x1f, 0x0e, 0xeb, 0x01, 0xf0, 0x0b, 0x2d,
+  0x27, 0x18, 0x03, 0x79, 0x03, 0x1e, 0x1f, 0x1e, 0x1f, 0x1e, 0x94, 0x6c, 0x86, 0x8b, 0x86, 0x8c, 0x92, 0x92, 0x8c, 0x76, 0x62, 0x5c, 0x5c, 0x5d,
+  0x5a, 0x02, 0x00, 0x10, 0x59, 0x02, 0x00, 0xf2, 0x08, 0x5c, 0x5a, 0x5c, 0x60, 0x76, 0x7c, 0x71, 0x60, 0x73, 0x92, 0x92, 0x71, 0x6c, 0x8b, 0x97,
+  0x8f, 0x81, 0x68, 0x64, 0x61, 0x5e, 0x5e, 0x61, 0x02, 0x00, 0x90, 0x64, 0x61, 0x64, 0x5b, 0x57, 0x54, 0x54, 0x54, 0x52, 0x01, 0x00, 0xf2, 0x0c,
+  0xa3, 0xa2, 0xa2, 0xa2, 0xa3, 0x52, 0xa3, 0x54, 0x57, 0x57, 0x5b, 0x57, 0x57, 0x56, 0x54, 0x56, 0x53, 0x56, 0x56, 0x57, 0x56, 0x57, 0x5e, 0x5b,
+  0x61, 0x5e, 0x5e, 0xca, 0x01, 0x10, 0x54, 0x05, 0x00, 0x01, 0x01, 0x00, 0x13, 0x56, 0x01, 0x00, 0xf1, 0x05, 0x58, 0x57, 0x56, 0x5b, 0x5b, 0x5b,
+  0x5a, 0x5b, 0x58, 0x58, 0x56, 0x55, 0x53, 0x56, 0x53, 0x55, 0x56, 0x5a, 0x5e, 0x5f, 0xde, 0x01, 0x90, 0x5e, 0x5a, 0x5f, 0x68, 0x71, 0x75, 0x71,
+  0x6e, 0x6d, 0xd9, 0x01, 0x10, 0x6e, 0xda, 0x01, 0x21, 0x6a, 0x6c, 0x04, 0x00, 0xb0, 0x6e, 0x73, 0x73, 0x75, 0x73, 0x73, 0x72, 0x71, 0x73, 0x78,
+  0x7c, 0xdf, 0x01, 0x40, 0x7d, 0x81, 0x81, 0x86, 0x03, 0x00, 0x60, 0x86, 0x81, 0x81, 0x7e, 0x81, 0x7e, 0xd9, 0x01, 0x40, 0x81, 0x7e, 0x7d, 0x7f,
+  0x11, 0x00, 0xa2, 0x80, 0x86, 0x86, 0x86, 0x8d, 0x8f, 0x8f, 0x03, 0x8f, 0x02, 0x01, 0x00, 0x00, 0xe3, 0x01, 0xf0, 0x05, 0x8f, 0x94, 0x03, 0x8f,
+  0x03, 0x8f, 0x95, 0x94, 0x95, 0x95, 0x04, 0x04, 0x04, 0x07, 0x04, 0x07, 0x09, 0x0a, 0x09, 0x0a, 0xdb, 0x01, 0x10, 0x48, 0x05, 0x00, 0xf1, 0x05,
+  0x45, 0x41, 0x17, 0x01, 0x09, 0x1e, 0x04, 0x03, 0x03, 0x04, 0x04, 0x03, 0x01, 0x01, 0x99, 0x20, 0x32, 0x32, 0x32, 0x3f, 0xdf, 0x01, 0xf1, 0x2d,
+  0x3e, 0x41, 0x44, 0x41, 0x41, 0x20, 0x3f, 0x29, 0x32, 0x32, 0x03, 0x03, 0x88, 0x88, 0x01, 0x88, 0x03, 0x32, 0x1e, 0x0a, 0x37, 0x41, 0x44, 0x41,
+  0x29, 0x0e, 0x11, 0x2c, 0x3f, 0x37, 0x20, 0x02, 0x00, 0x0c, 0x97, 0x97, 0x02, 0x32, 0x0a, 0x00, 0x88, 0x00, 0x00, 0x00, 0x88, 0x7e, 0x88, 0x7e,
+  0x00, 0x7e, 0x00, 0x95, 0x2c, 0x37, 0x3e, 0x37, 0x2c, 0x02, 0x00, 0x00, 0xa8, 0x01, 0xf3, 0x2e, 0x3e, 0x35, 0x29, 0x2c, 0x17, 0x8f, 0x97, 0x81,
+  0x00, 0x17, 0x17, 0x04, 0x1e, 0x2c, 0x37, 0x41, 0x37, 0x3e, 0x3e, 0x3b, 0x37, 0x25, 0x02, 0x04, 0x25, 0x29, 0x2c, 0x32, 0x37, 0x20, 0x37, 0x37,
+  0x3e, 0x2c, 0x2c, 0x37, 0x3e, 0x02, 0x07, 0x37, 0x37, 0x2c, 0x32, 0x2c, 0x32, 0x25, 0x0c, 0x1e, 0x0c, 0x0c, 0x2c, 0x37, 0x37, 0x3e, 0x3e, 0x32,
+  0x03, 0x1e, 0x35, 0x3b, 0x39, 0xc0, 0x03, 0xf0, 0x10, 0x2c, 0x2c, 0x35, 0x35, 0x2c, 0x1f, 0x25, 0x1e, 0x1e, 0x9a, 0x03, 0x0e, 0x2d, 0x35, 0x25,
+  0x7e, 0x79, 0x04, 0x18, 0x2c, 0x2c, 0x2d, 0x2c, 0x2c, 0x03, 0x79, 0x07, 0x1e, 0x0e, 0x03, 0x00, 0xd5, 0x01, 0x40, 0x27, 0x2d, 0x2d, 0x2d, 0xdc,
+  0x01, 0x10, 0x27, 0xc9, 0x03, 0xf0, 0x0e, 0x1f, 0x14, 0x0c, 0x14, 0x14, 0x18, 0x18, 0x27, 0x18, 0x04, 0x02, 0x79, 0x86, 0x92, 0x02, 0x97, 0x03,
+  0x11, 0x0b, 0x8f, 0x8b, 0x75, 0x6e, 0x6d, 0x66, 0x60, 0x5c, 0x5c, 0x5c, 0xd7, 0x01, 0x01, 0x06, 0x00, 0xf0, 0x05, 0x58, 0x5c, 0x58, 0x5a, 0x59,
+  0x5a, 0x5c, 0x76, 0x85, 0x82, 0x7d, 0x81, 0x8f, 0x7e, 0x73, 0x6c, 0x78, 0x7d, 0x71, 0x5e, 0xab, 0x03, 0x00, 0xae, 0x03, 0x00, 0x02, 0x00, 0x7a,
+  0x57, 0x57, 0x57, 0x54, 0x52, 0x52, 0xa2, 0x01, 0x00, 0x20, 0x52, 0xa3, 0x02, 0x00, 0x20, 0xa2, 0xa3, 0xed, 0x01, 0x82, 0x52, 0xa3, 0xa3, 0x53,
+  0x52, 0x53, 0xa3, 0x53, 0x0b, 0x00, 0x04, 0x01, 0x00, 0x30, 0x53, 0xa3, 0x53, 0x14, 0x00, 0x01, 0xbb, 0x03, 0x00, 0x06, 0x02, 0x11, 0x58, 0xce,
+  0x03, 0xa0, 0x53, 0x55, 0x56, 0x56, 0x58, 0x58, 0x5a, 0x5e, 0x58, 0x5a, 0x06, 0x00, 0x60, 0x5f, 0x67, 0x6d, 0x6c, 0x6d, 0x6e, 0x04, 0x00, 0x21,
+  0x71, 0x71, 0xe1, 0x01, 0xa0, 0x6c, 0x67, 0x6a, 0x67, 0x6a, 0x6c, 0x6e, 0x6e, 0x73, 0x6e, 0xc6, 0x03, 0x00, 0xdf, 0x01, 0x70, 0x7a, 0x78, 0x79,
+  0x81, 0x85, 0x81, 0x85, 0xb0, 0x03, 0x00, 0xb2, 0x03, 0x30, 0x81, 0x81, 0x7e, 0xbc, 0x03, 0x51, 0x7e, 0x81, 0x81, 0x81, 0x83, 0x02, 0x00, 0x20,
+  0x02, 0x8d, 0xcf, 0x01, 0xa1, 0x8f, 0x02, 0x8f, 0x02, 0x02, 0x8d, 0x8f, 0x94, 0x95, 0x95, 0xd7, 0x01, 0x40, 0x04, 0x07, 0x07, 0x09, 0x02, 0x00,
+  0x00, 0x01, 0x00, 0x63, 0x0a, 0x09, 0x0a, 0x09, 0x45, 0x48, 0xdf, 0x01, 0xf0, 0x05, 0x44, 0x3f, 0x07, 0x03, 0x01, 0x03, 0x01, 0x02, 0x0e, 0x11,
+  0x03, 0x03, 0x01, 0x01, 0x03, 0x9a, 0x04, 0x97, 0x2c, 0x37, 0xdf, 0x01, 0x20, 0x41, 0x41, 0xe0, 0x01, 0xf0, 0x00, 0x3f, 0x44, 0x32, 0x37, 0x32,
+  0x17, 0x0c, 0x88, 0x8f, 0x88, 0x02, 0x1e, 0x32, 0x04, 0x04, 0xba, 0x05, 0xf0, 0x00, 0x3f, 0x44, 0x44, 0x3f, 0x37, 0x1e, 0x03, 0x11, 0x04, 0x11,
+  0x0a, 0x02, 0x03, 0x32, 0x8f, 0xbd, 0x03, 0x00, 0x01, 0x00, 0xf1, 0x12, 0x7e, 0x00, 0x7f, 0x00, 0x04, 0x37, 0x35, 0x3e, 0x37, 0x1e, 0x02, 0x00,
+  0x03, 0x37, 0x3e, 0x3b, 0x3b, 0x3e, 0x3e, 0x37, 0x04, 0x1e, 0x17, 0x29, 0x97, 0x00, 0x00, 0x20, 0x25, 0x1b, 0x11, 0x0c, 0x2c, 0xdf, 0x01, 0xf0,
+  0x16, 0x35, 0x1e, 0x88, 0x00, 0x9a, 0x25, 0x25, 0x2c, 0x14, 0x04, 0x25, 0x37, 0x35, 0x37, 0x35, 0x37, 0x37, 0x1e, 0x2c, 0x37, 0x35, 0x37, 0x2c,
+  0x37, 0x25, 0x17, 0x03, 0x8b, 0x7e, 0x00, 0x17, 0x2c, 0x0e, 0x2c, 0x37, 0x0e, 0x00, 0xb8, 0x03, 0x11, 0x3b, 0xc5, 0x03, 0x30, 0x35, 0x2c, 0x2d,
+  0x05, 0x00, 0xf0, 0x0a, 0x1f, 0x07, 0x04, 0x86, 0x7e, 0x0b, 0x2c, 0x2d, 0x2c, 0x25, 0x1e, 0x25, 0x2c, 0x2d, 0x35, 0x2d, 0x35, 0x25, 0x0e, 0x02,
+  0x1e, 0x25, 0x0e, 0x00, 0x04, 0xd6, 0x01, 0x00, 0xc1, 0x03, 0x00, 0x9a, 0x05, 0x00, 0x0c, 0x00, 0xf1, 0x0b, 0x13, 0x0e, 0x00, 0x73, 0x7e, 0x81,
+  0x7e, 0x86, 0x03, 0x0e, 0x1e, 0x9b, 0x78, 0x67, 0x66, 0x67, 0x80, 0x86, 0x0a, 0x0a, 0x9b, 0x98, 0x7b, 0x61, 0x62, 0x5c, 0xb4, 0x03, 0x03, 0x04,
+  0x00, 0x01, 0x02, 0x00, 0xf0, 0x03, 0x5a, 0x59, 0x5c, 0x65, 0x75, 0x76, 0x6d, 0x8b, 0x98, 0x92, 0x92, 0x7d, 0x6d, 0x6d, 0x5e, 0x57, 0x57, 0x54,
+  0xd7, 0x01, 0x00, 0xda, 0x01, 0x00, 0xb8, 0x03, 0x12, 0xa2, 0x02, 0x00, 0x0e, 0x01, 0x00, 0x06, 0xe2, 0x01, 0x40, 0x52, 0x53, 0x54, 0x57, 0x12,
+  0x02, 0x91, 0x5b, 0x5b, 0x56, 0x54, 0x56, 0x57, 0x56, 0x56, 0x54, 0x02, 0x00, 0x00, 0xc7, 0x03, 0x02, 0x01, 0x00, 0x00, 0xa9, 0x05, 0x06, 0x01,
+  0x00, 0x60, 0x58, 0x56, 0x58, 0x57, 0x5a, 0x57, 0xcb, 0x05, 0x70, 0x5f, 0x62, 0x67, 0x62, 0x64, 0x62, 0x67, 0xce, 0x01, 0x80, 0x76, 0x75, 0x75,
+  0x74, 0x75, 0x73, 0x6e, 0x6e, 0xdb, 0x01, 0xf0, 0x02, 0x6e, 0x6e, 0x6e, 0x6e, 0x73, 0x73, 0x74, 0x78, 0x79, 0x7c, 0x79, 0x7c, 0x81, 0x81, 0x81,
+  0x81, 0x7d, 0x09, 0x00, 0x01, 0xbb, 0x03, 0x05, 0x01, 0x00, 0x30, 0x00, 0x86, 0x00, 0xab, 0x05, 0x00, 0x9f, 0x05, 0x00, 0xd5, 0x01, 0x72, 0x95,
+  0x04, 0x97, 0x95, 0x95, 0x9a, 0x95, 0xb3, 0x03, 0x04, 0x01, 0x00, 0x30, 0x0b, 0x09, 0x0b, 0x01, 0x00, 0x10, 0x0e, 0xdb, 0x01, 0x01, 0xa0, 0x05,
+  0x20, 0x3f, 0x32, 0xdf, 0x01, 0xd0, 0x03, 0x01, 0x03, 0x03, 0x99, 0x03, 0x02, 0x01, 0x04, 0x8f, 0x11, 0x11, 0x32, 0x3d, 0x07, 0x00, 0x01, 0x00,
+  0xf0, 0x05, 0x44, 0x41, 0x3f, 0x37, 0x3f, 0x45, 0x3f, 0x32, 0x25, 0x29, 0x04, 0x8f, 0x02, 0x07, 0x37, 0x1b, 0x00, 0x02, 0x2c, 0x3f, 0x17, 0x00,
+  0xd1, 0x3f, 0x3f, 0x20, 0x97, 0x02, 0x95, 0x02, 0x02, 0x8f, 0x9a, 0x11, 0x25, 0x02, 0xdb, 0x01, 0x00, 0x03, 0x00, 0xe0, 0x00, 0x7e, 0x00, 0x14,
+  0x35, 0x3e, 0x3b, 0x37, 0x0e, 0x02, 0x03, 0x14, 0x3e, 0x3e, 0xdf, 0x01, 0xf1, 0x10, 0x25, 0x0c, 0x20, 0x25, 0x0d, 0x03, 0x8b, 0x02, 0x97, 0x0c,
+  0x97, 0x04, 0x0a, 0x25, 0x35, 0x3b, 0x35, 0x3e, 0x35, 0x25, 0x1e, 0x03, 0x7e, 0x0c, 0x1e, 0x20, 0x2c, 0x2c, 0x1e, 0x37, 0x2c, 0xad, 0x07, 0xf0,
+  0x08, 0x35, 0x37, 0x3b, 0x37, 0x35, 0x32, 0x2c, 0x17, 0x11, 0x20, 0x02, 0x86, 0x03, 0x0c, 0x09, 0x11, 0x25, 0x25, 0x02, 0x09, 0x2c, 0x2d, 0x35,
+  0xc0, 0x03, 0x01, 0xe1, 0x01, 0xf0, 0x00, 0x2d, 0x2c, 0x35, 0x2c, 0x27, 0x1e, 0x1e, 0x7e, 0x79, 0x8f, 0x25, 0x35, 0x35, 0x25, 0x25, 0xd0, 0x03,
+  0xb0, 0x25, 0x2d, 0x35, 0x2d, 0x25, 0x25, 0x25, 0x2d, 0x0e, 0x09, 0x25, 0xd7, 0x01, 0xf2, 0x19, 0x27, 0x27, 0x2d, 0x31, 0x2d, 0x27, 0x1f, 0x0e,
+  0x0e, 0x1f, 0x25, 0x1f, 0x0e, 0x09, 0x79, 0x7e, 0x73, 0x67, 0x6a, 0x72, 0x7e, 0x9a, 0x0c, 0x92, 0x7c, 0x6c, 0x62, 0x62, 0x71, 0x85, 0x8c, 0x98,
+  0x92, 0x82, 0x8c, 0x67, 0x70, 0x61, 0x59, 0x58, 0xdb, 0x01, 0x80, 0x5a, 0x5a, 0x59, 0x58, 0x59, 0x58, 0x5a, 0x5a, 0x05, 0x00, 0xc0, 0x5c, 0x65,
+  0x61, 0x5f, 0x75, 0x8c, 0x85, 0x85, 0x6d, 0x61, 0x5e, 0x5e, 0xda, 0x01, 0x02, 0x01, 0x00, 0x00, 0xdf, 0x01, 0x00, 0x01, 0x00, 0x10, 0x54, 0xce,
+  0x03, 0x01, 0x0e, 0x00, 0x00, 0xd8, 0x01, 0x20, 0xa2, 0xa2, 0x14, 0x00, 0x53, 0x52, 0x57, 0x5b, 0x57, 0x56, 0xd6, 0x01, 0xf0, 0x02, 0x5b, 0x5e,
+  0x67, 0x64, 0x68, 0x68, 0x67, 0x68, 0x67, 0x68, 0x64, 0x67, 0x64, 0x68, 0x64, 0x68, 0x64, 0x01, 0x00, 0xf1, 0x0e, 0x5f, 0x64, 0x5f, 0x5e, 0x5f,
+  0x5e, 0x5b, 0x5e, 0x57, 0x5a, 0x57, 0x58, 0x5b, 0x5e, 0x5f, 0x5f, 0x64, 0x5f, 0x5f, 0x61, 0x64, 0x62, 0x64, 0x67, 0x5f, 0x64, 0x5f, 0x64, 0x62,
+  0x02, 0x00, 0x20, 0x5f, 0x5e, 0xac, 0x05, 0xf0, 0x06, 0x5e, 0x5f, 0x5f, 0x62, 0x68, 0x6a, 0x71, 0x6f, 0x71, 0x75, 0x73, 0x75, 0x71, 0x75, 0x73,
+  0x76, 0x73, 0x75, 0x74, 0x75, 0x78, 0x01, 0x00, 0xf0, 0x06, 0x7c, 0x7c, 0x7d, 0x80, 0x81, 0x80, 0x81, 0x86, 0x81, 0x7d, 0x78, 0x79, 0x73, 0x78,
+  0x79, 0x81, 0x00, 0x89, 0x02, 0x8d, 0x02, 0xac, 0x03, 0xb0, 0x8d, 0x02, 0x8f, 0x8b, 0x8d, 0x8f, 0x8d, 0x8f, 0x8f, 0x94, 0x9a, 0xae, 0x03, 0x03,
+  0x03, 0x00, 0x00, 0x05, 0x00, 0x11, 0x05, 0xde, 0x01, 0x15, 0x0b, 0x02, 0x00, 0x41, 0x0e, 0x0a, 0x0e, 0x0c, 0xe0, 0x01, 0x00, 0xdf, 0x01, 0x50,
+  0x45, 0x3f, 0x14, 0x01, 0x03, 0x3d, 0x09, 0xb0, 0x32, 0x95, 0x0c, 0x04, 0x01, 0x02, 0x11, 0x29, 0x20, 0x11, 0x11, 0xa6, 0x03, 0x10, 0x44, 0x7f,
+  0x07, 0xf1, 0x09, 0x44, 0x2c, 0x17, 0x44, 0x45, 0x3f, 0x32, 0x29, 0x29, 0x18, 0x86, 0x02, 0x32, 0x29, 0x03, 0x88, 0x03, 0x37, 0x41, 0x41, 0x3f,
+  0x41, 0x3f, 0x3e, 0xb6, 0x03, 0x82, 0x88, 0x88, 0x00, 0x7e, 0x03, 0x20, 0x88, 0x7e, 0xdb, 0x01, 0x00, 0xbf, 0x03, 0x90, 0x00, 0x1e, 0x37, 0x35,
+  0x3e, 0x35, 0x03, 0x02, 0x09, 0xab, 0x03, 0x00, 0xbf, 0x03, 0xf0, 0x0a, 0x97, 0x25, 0x20, 0x02, 0x17, 0x8f, 0x7e, 0x86, 0x00, 0x86, 0x07, 0x02,
+  0x1e, 0x35, 0x35, 0x3b, 0x35, 0x2c, 0x09, 0x9a, 0x94, 0x7e, 0x18, 0x2c, 0x37, 0x5d, 0x09, 0x10, 0x25, 0xba, 0x03, 0x20, 0x35, 0x2c, 0xc6, 0x01,
+  0xf0, 0x00, 0x37, 0x25, 0x03, 0x11, 0x8f, 0x0d, 0x20, 0x0a, 0x1e, 0x07, 0x25, 0x37, 0x0e, 0x1e, 0x2c, 0xa3, 0x03, 0x20, 0x2d, 0x27, 0xc4, 0x03,
+  0x00, 0x33, 0x00, 0xd0, 0x1f, 0x18, 0x18, 0x1e, 0x25, 0x81, 0x79, 0x04, 0x2c, 0x2c, 0x2c, 0x03, 0x1f, 0xd0, 0x03, 0xf0, 0x48, 0x08, 0x27, 0x35,
+  0x2c, 0x08, 0x0e, 0x2d, 0x2c, 0x13, 0x1a, 0x25, 0x27, 0x1f, 0x0f, 0x13, 0x27, 0x27, 0x31, 0x2d, 0x31, 0x27, 0x13, 0x03, 0x09, 0x13, 0x1f, 0x03,
+  0x95, 0x07, 0x02, 0x22, 0x15, 0x6e, 0x6a, 0x76, 0x8c, 0x92, 0x7d, 0x7d, 0x7c, 0x98, 0x69, 0x60, 0x60, 0x70, 0x71, 0x76, 0x6d, 0x67, 0x65, 0x65,
+  0x7b, 0x6d, 0x58, 0x58, 0x5a, 0x65, 0x61, 0x58, 0x5a, 0x65, 0x5d, 0x58, 0x5a, 0x5c, 0x5a, 0x5c, 0x58, 0x59, 0x5a, 0x58, 0x59, 0x5c, 0x5a, 0x5a,
+  0x5c, 0x5f, 0x65, 0x68, 0x5f, 0x65, 0x61, 0x61, 0x5e, 0x61, 0x5b, 0x5e, 0xa2, 0x05, 0x04, 0xbb, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x55, 0x09, 0x02,
+  0x01, 0x00, 0x40, 0x54, 0x52, 0x54, 0x57, 0xee, 0x01, 0x40, 0x5b, 0x64, 0x5b, 0x64, 0xc8, 0x01, 0x12, 0x68, 0x01, 0x00, 0x42, 0x6d, 0x68, 0x71,
+  0x6c, 0x02, 0x00, 0xa0, 0x6d, 0x6d, 0x6c, 0x6d, 0x68, 0x67, 0x64, 0x5f, 0x6d, 0x68, 0xf1, 0x01, 0x52, 0x64, 0x61, 0x5e, 0x64, 0x64, 0xa2, 0x09,
+  0x01, 0x27, 0x00, 0x00, 0x01, 0x00, 0x31, 0x71, 0x6d, 0x71, 0x06, 0x00, 0x00, 0x96, 0x09, 0x42, 0x67, 0x6d, 0x67, 0x5f, 0xe6, 0x01, 0x20, 0x62,
+  0x62, 0x9d, 0x05, 0x10, 0x67, 0x80, 0x07, 0x53, 0x6e, 0x73, 0x76, 0x74, 0x7c, 0xdd, 0x01, 0x00, 0x9a, 0x05, 0xf0, 0x02, 0x85, 0x81, 0x80, 0x7d,
+  0x80, 0x81, 0x86, 0x86, 0x8b, 0x02, 0x8f, 0x8f, 0x03, 0x94, 0x94, 0x94, 0x95, 0x04, 0x00, 0x00, 0x63, 0x07, 0x00, 0xde, 0x01, 0x31, 0x04, 0x04,
+  0x09, 0xd7, 0x01, 0x55, 0x07, 0x09, 0x05, 0x09, 0x04, 0x97, 0x05, 0x00, 0xba, 0x03, 0x11, 0x09, 0x03, 0x00, 0x20, 0x0e, 0x0e, 0xe0, 0x01, 0x10,
+  0x48, 0xa1, 0x05, 0xf0, 0x06, 0x3f, 0x3f, 0x03, 0x03, 0x01, 0x93, 0x01, 0x03, 0x20, 0x37, 0x17, 0x0b, 0x0c, 0x03, 0x04, 0x2c, 0x3f, 0x07, 0x20,
+  0x32, 0x3f, 0xc0, 0x03, 0x01, 0xe1, 0x01, 0xf0, 0x02, 0x37, 0x0c, 0x3f, 0x3f, 0x3f, 0x20, 0x37, 0x1e, 0x0c, 0x02, 0x1e, 0x32, 0x0c, 0x02, 0x01,
+  0x95, 0x3e, 0xde, 0x01, 0x70, 0x3f, 0x20, 0x0c, 0x00, 0x83, 0x00, 0x7f, 0xd5, 0x01, 0x20, 0x8f, 0x20, 0x06, 0x00, 0x10, 0x7e, 0xdf, 0x01, 0xc0,
+  0x7e, 0x00, 0x7e, 0x02, 0x2c, 0x35, 0x3e, 0x35, 0x2c, 0x07, 0x03, 0x32, 0x7d, 0x07, 0x01, 0x89, 0x07, 0xc0, 0x0a, 0x0c, 0x8f, 0x07, 0x81, 0x7e,
+  0x86, 0x02, 0x11, 0x2c, 0x0e, 0x2c, 0x8e, 0x03, 0x60, 0x2c, 0x95, 0x8f, 0x86, 0x00, 0x29, 0xd9, 0x01, 0xf1, 0x14, 0x2c, 0x25, 0x25, 0x2c, 0x37,
+  0x2c, 0x37, 0x18, 0x1f, 0x37, 0x3b, 0x35, 0x35, 0x2c, 0x25, 0x97, 0x07, 0x11, 0x1e, 0x18, 0x18, 0x35, 0x2c, 0x2c, 0x2c, 0x0e, 0x2c, 0x2c, 0x18,
+  0x1f, 0x2d, 0x35, 0x2d, 0x1f, 0x18, 0xa4, 0x05, 0xf0, 0x0b, 0x2d, 0x13, 0x03, 0x00, 0x79, 0x0a, 0x17, 0x11, 0x97, 0x18, 0x25, 0x2d, 0x2d, 0x1f,
+  0x25, 0x27, 0x2d, 0x35, 0x2d, 0x27, 0x2d, 0x35, 0x18, 0x7e, 0x04, 0x2c, 0x71, 0x07, 0xf0, 0x29, 0x1f, 0x0b, 0x0e, 0x1a, 0x27, 0x31, 0x31, 0x31,
+  0x31, 0x2d, 0x1f, 0x1f, 0x1f, 0x25, 0x1f, 0x09, 0x14, 0x97, 0x94, 0x0d, 0x1b, 0x73, 0x67, 0x76, 0x7c, 0x72, 0x7c, 0x8c, 0x8c, 0x90, 0x6d, 0x5c,
+  0x5c, 0x60, 0x5c, 0x5a, 0x5a, 0x58, 0x58, 0x61, 0x61, 0x61, 0x58, 0x56, 0x5e, 0xa7, 0x6d, 0x5c, 0x58, 0x61, 0x58, 0x59, 0x61, 0x70, 0x67, 0x5e,
+  0x0b, 0x07, 0x30, 0x58, 0x5a, 0x58, 0x46, 0x0b, 0x50, 0x5c, 0x5e, 0x60, 0x5e, 0x60, 0x55, 0x09, 0x40, 0x61, 0x61, 0x61, 0x5e, 0x94, 0x01, 0x03,
+  0x01, 0x00, 0x21, 0x5b, 0x54, 0x7f, 0x05, 0x00, 0x56, 0x09, 0x02, 0x09, 0x00, 0x00, 0xcd, 0x03, 0x20, 0x5b, 0x5b, 0xb0, 0x01, 0x00, 0xad, 0x01,
+  0x41, 0x6c, 0x6d, 0x6c, 0x71, 0x01, 0x00, 0x10, 0x73, 0x05, 0x00, 0x20, 0x71, 0x71, 0x49, 0x07, 0x30, 0x6c, 0x68, 0x6c, 0xd0, 0x03, 0x10, 0x64,
+  0x4b, 0x00, 0x20, 0x64, 0x61, 0xaf, 0x09, 0x40, 0x61, 0x64, 0x65, 0x61, 0x09, 0x02, 0x20, 0x67, 0x67, 0xf9, 0x01, 0x80, 0x65, 0x67, 0x67, 0x6d,
+  0x6d, 0x71, 0x71, 0x6d, 0xe0, 0x01, 0x40, 0x62, 0x5f, 0x62, 0x5f, 0xe2, 0x01, 0x80, 0x67, 0x67, 0x67, 0x66, 0x67, 0x62, 0x67, 0x66, 0x84, 0x07,
+  0x60, 0x6f, 0x75, 0x77, 0x78, 0x7c, 0x7c, 0xd8, 0x01, 0x12, 0x85, 0x97, 0x05, 0x34, 0x02, 0x89, 0x8f, 0xde, 0x01, 0x01, 0xdb, 0x01, 0x00, 0x94,
+  0x05, 0x00, 0x6d, 0x07, 0x21, 0x07, 0x04, 0xd7, 0x01, 0x37, 0x04, 0x09, 0x09, 0xdd, 0x01, 0x04, 0x02, 0x00, 0x61, 0x0b, 0x0e, 0x0b, 0x0e, 0x0e,
+  0x0b, 0xe0, 0x01, 0x00, 0xbf, 0x03, 0x10, 0x20, 0xbe, 0x03, 0xb0, 0x01, 0x04, 0x2c, 0x32, 0x29, 0x1e, 0x17, 0x0c, 0x07, 0x20, 0x3f, 0x92, 0x07,
+  0x31, 0x3e, 0x41, 0x44, 0xdf, 0x01, 0xf0, 0x02, 0x44, 0x3f, 0x18, 0x20, 0x20, 0x44, 0x3f, 0x3f, 0x3f, 0x11, 0x11, 0x32, 0x1b, 0x01, 0x88, 0x00,
+  0x0e, 0x7a, 0x09, 0x50, 0x3f, 0x25, 0x03, 0x88, 0x00, 0xae, 0x03, 0x52, 0x00, 0x00, 0x00, 0x97, 0x20, 0x0a, 0x00, 0x01, 0xdf, 0x01, 0x00, 0x7f,
+  0x07, 0x50, 0x35, 0x35, 0x25, 0x04, 0x18, 0x5b, 0x09, 0x40, 0x41, 0x3e, 0x37, 0x1e, 0xf9, 0x01, 0x90, 0x81, 0x0a, 0x86, 0x81, 0x8f, 0x17, 0x0b,
+  0x25, 0x25, 0xbf, 0x03, 0x70, 0x35, 0x2c, 0x1e, 0x14, 0x17, 0x02, 0x18, 0x19, 0x0d, 0x30, 0x2c, 0x2c, 0x25, 0xe5, 0x01, 0x20, 0x09, 0x2c, 0x17,
+  0x00, 0x90, 0x0e, 0x04, 0x11, 0x9a, 0x86, 0x17, 0x07, 0x18, 0x2c, 0x2f, 0x0b, 0xf0, 0x0f, 0x35, 0x2c, 0x09, 0x25, 0x2d, 0x2d, 0x2d, 0x1f, 0x09,
+  0x35, 0x3b, 0x3b, 0x39, 0x3b, 0x2c, 0x35, 0x37, 0x02, 0x81, 0x07, 0x7e, 0x8f, 0x8f, 0x09, 0x25, 0x2d, 0x2c, 0x1f, 0x27, 0x25, 0x90, 0x07, 0x40,
+  0x2d, 0x2d, 0x0e, 0x09, 0xfe, 0x0c, 0xf0, 0x2c, 0x1f, 0x1f, 0x03, 0x99, 0x13, 0x1f, 0x31, 0x2d, 0x31, 0x2d, 0x39, 0x2d, 0x27, 0x1f, 0x25, 0x18,
+  0x09, 0x11, 0x17, 0x79, 0x7e, 0x8b, 0x9d, 0x67, 0x6c, 0x76, 0x6d, 0x6e, 0x82, 0x67, 0x66, 0x62, 0x5c, 0x59, 0x5a, 0x5d, 0x58, 0xa5, 0x55, 0xa5,
+  0x55, 0x55, 0x58, 0x57, 0x5b, 0x64, 0x5b, 0x71, 0x84, 0x5a, 0x5e, 0x58, 0x58, 0x5a, 0x6d, 0x85, 0x90, 0x75, 0x58, 0x01, 0x00, 0xd2, 0x5a, 0x5a,
+  0x5a, 0x5e, 0x5a, 0x5c, 0x5a, 0x5e, 0x5c, 0x5e, 0x5c, 0x61, 0x5c, 0xe1, 0x01, 0x30, 0x61, 0x64, 0x65, 0x6b, 0x05, 0x00, 0x01, 0x00, 0x0b, 0x08,
+  0x00, 0x00, 0x0d, 0x0d, 0xa0, 0x5b, 0x56, 0xa3, 0x53, 0x57, 0x68, 0x71, 0x71, 0x71, 0x75, 0xd2, 0x01, 0x00, 0x01, 0x00, 0x41, 0x75, 0x75, 0x75,
+  0x75, 0xfa, 0x0a, 0x00, 0xe7, 0x01, 0x00, 0x14, 0x0b, 0x90, 0x6c, 0x67, 0x64, 0x5f, 0x5e, 0x58, 0x57, 0x58, 0x56, 0x3b, 0x0b, 0x20, 0x56, 0x56,
+  0x46, 0x02, 0x82, 0x5e, 0x60, 0x5f, 0x5c, 0x5f, 0x5f, 0x5f, 0x60, 0x96, 0x05, 0xc0, 0x5f, 0x67, 0x67, 0x6c, 0x6c, 0x6d, 0x6c, 0x67, 0x67, 0x68,
+  0x6a, 0x68, 0x0a, 0x00, 0x12, 0x6e, 0x65, 0x09, 0x50, 0x6e, 0x6c, 0x66, 0x66, 0x66, 0x47, 0x0b, 0x00, 0x21, 0x0d, 0x00, 0x23, 0x0d, 0x60, 0x80,
+  0x81, 0x85, 0x86, 0x86, 0x89, 0x8f, 0x05, 0x01, 0xde, 0x01, 0x20, 0x95, 0x9a, 0x48, 0x09, 0x21, 0x95, 0x9a, 0xdf, 0x01, 0x00, 0x01, 0x00, 0x60,
+  0x07, 0x04, 0x05, 0x07, 0x08, 0x07, 0x04, 0x00, 0x14, 0x08, 0xe2, 0x01, 0x20, 0x09, 0x0a, 0x05, 0x00, 0x00, 0xe2, 0x01, 0x60, 0x0b, 0x0b, 0x0b,
+  0x45, 0x45, 0x44, 0x9e, 0x05, 0x30, 0x44, 0x3f, 0x0c, 0xdf, 0x01, 0xe0, 0x01, 0x04, 0x29, 0x1e, 0x3f, 0x3f, 0x18, 0x14, 0x11, 0x14, 0x29, 0x11,
+  0x37, 0x3f, 0xc0, 0x03, 0x02, 0xe1, 0x01, 0xf0, 0x02, 0x41, 0x37, 0x32, 0x29, 0x3f, 0x20, 0x41, 0x3f, 0x37, 0x32, 0x20, 0x8f, 0x88, 0x88, 0x01,
+  0x1e, 0x44, 0x9d, 0x05, 0x41, 0x03, 0x00, 0x00, 0x83, 0x03, 0x00, 0x40, 0x00, 0x03, 0x18, 0x20, 0xe6, 0x01, 0x01, 0xdd, 0x01, 0xb0, 0x7e, 0x00,
+  0x00, 0x25, 0x3e, 0x3e, 0x35, 0x2c, 0x0e, 0x00, 0x1e, 0xbe, 0x03, 0xf1, 0x02, 0x3e, 0x3e, 0x37, 0x0e, 0x86, 0x86, 0x00, 0x81, 0x7e, 0x8f, 0x97,
+  0x02, 0x86, 0x18, 0x0a, 0x25, 0x37, 0x30, 0x09, 0xa1, 0x37, 0x2c, 0x25, 0x14, 0x94, 0x14, 0x1e, 0x2c, 0x2c, 0x1e, 0xc0, 0x03, 0x31, 0x09, 0x03,
+  0x14, 0xd1, 0x01, 0x81, 0x18, 0x8f, 0x8f, 0x86, 0x86, 0x97, 0x79, 0x09, 0xdf, 0x01, 0x20, 0x3b, 0x2d, 0xbf, 0x03, 0x30, 0x27, 0x27, 0x2d, 0xbf,
+  0x03, 0x00, 0x42, 0x0b, 0x70, 0x04, 0x86, 0x7e, 0x73, 0x79, 0x0a, 0x0e, 0x41, 0x09, 0xf0, 0x2a, 0x13, 0x2d, 0x39, 0x35, 0x39, 0x2d, 0x35, 0x27,
+  0x2c, 0x27, 0x0e, 0x0e, 0x27, 0x27, 0x1f, 0x99, 0x00, 0x08, 0x1a, 0x2d, 0x31, 0x26, 0x27, 0x31, 0x27, 0x27, 0x1f, 0x25, 0x14, 0x86, 0x78, 0x85,
+  0x9a, 0x6c, 0x74, 0x9b, 0x9b, 0x6c, 0x76, 0x65, 0x6e, 0x6c, 0x70, 0x60, 0x60, 0x5c, 0x59, 0x5a, 0xa5, 0x5a, 0x59, 0x55, 0x55, 0x53, 0x55, 0x55,
+  0x56, 0x6d, 0x05, 0x10, 0x68, 0x48, 0x09, 0x80, 0x61, 0x61, 0x70, 0x85, 0x90, 0x71, 0x5a, 0x57, 0xe0, 0x01, 0x21, 0x58, 0x5c, 0xb3, 0x0c, 0x10,
+  0x61, 0xdf, 0x01, 0x01, 0x01, 0x00, 0x82, 0x65, 0x61, 0x68, 0x64, 0x68, 0x65, 0x68, 0x67, 0xd1, 0x01, 0x11, 0x6d, 0x05, 0x00, 0x00, 0x52, 0x05,
+  0x00, 0x0f, 0x00, 0x00, 0x08, 0x00, 0x61, 0x64, 0x54, 0x52, 0x56, 0x64, 0x6d, 0xd6, 0x01, 0x20, 0x75, 0x75, 0x89, 0x03, 0x10, 0x6d, 0x0d, 0x00,
+  0x40, 0x71, 0x73, 0x78, 0x75, 0x02, 0x00, 0x40, 0x75, 0x75, 0x73, 0x71, 0xd9, 0x03, 0x00, 0x31, 0x00, 0x00, 0xc5, 0x03, 0x00, 0x19, 0x0f, 0x80,
+  0x56, 0x56, 0x56, 0x55, 0x58, 0x58, 0x5e, 0x5e, 0x96, 0x07, 0x00, 0xb5, 0x03, 0x61, 0x67, 0x62, 0x5f, 0x67, 0x6a, 0x67, 0x1c, 0x0d, 0x00, 0x02,
+  0x00, 0x00, 0xda, 0x01, 0x00, 0xe2, 0x01, 0x00, 0x63, 0x09, 0x40, 0x67, 0x6a, 0x66, 0x6a, 0xaa, 0x05, 0xf0, 0x01, 0x6c, 0x73, 0x6e, 0x73, 0x6e,
+  0x72, 0x73, 0x74, 0x79, 0x78, 0x80, 0x81, 0x86, 0x89, 0x8b, 0x8d, 0x00, 0x0d, 0x00, 0x01, 0x00, 0x00, 0xe6, 0x01, 0x01, 0x56, 0x09, 0x00, 0xa2,
+  0x05, 0x01, 0x78, 0x07, 0x02, 0xa6, 0x05, 0x00, 0xe4, 0x01, 0x51, 0x09, 0x09, 0x07, 0x05, 0x09, 0x08, 0x00, 0x01, 0xe2, 0x01, 0x43, 0x09, 0x0b,
+  0x09, 0x44, 0xe0, 0x01, 0x20, 0x32, 0x04, 0xdf, 0x01, 0xf1, 0x01, 0x01, 0x01, 0x09, 0x29, 0x37, 0x32, 0x32, 0x11, 0x03, 0x07, 0x17, 0x20, 0x32,
+  0x1e, 0x37, 0x37, 0x1c, 0x0d, 0x60, 0x44, 0x41, 0x44, 0x3f, 0x32, 0x3f, 0xc6, 0x03, 0xa0, 0x3f, 0x32, 0x1e, 0x03, 0x00, 0x88, 0x88, 0x03, 0x41,
+  0x44, 0x97, 0x03, 0x00, 0xd2, 0x01, 0x01, 0xa1, 0x05, 0x40, 0x00, 0x00, 0x14, 0x1e, 0xd8, 0x01, 0x01, 0x03, 0x00, 0x30, 0x7e, 0x00, 0x03, 0x6b,
+  0x05, 0x20, 0x35, 0x07, 0x1d, 0x0d, 0x10, 0x35, 0xe0, 0x01, 0xb1, 0x07, 0x7e, 0x86, 0x81, 0x7e, 0x81, 0x02, 0x9b, 0x7e, 0x00, 0x18, 0x12, 0x0b,
+  0x00, 0xdd, 0x03, 0xf1, 0x10, 0x2c, 0x20, 0x14, 0x00, 0x86, 0x04, 0x25, 0x1e, 0x88, 0x13, 0x2c, 0x18, 0x18, 0x14, 0x04, 0x03, 0x0e, 0x25, 0x35,
+  0x3b, 0x2d, 0x25, 0x0a, 0x7e, 0x8b, 0x79, 0x7c, 0x79, 0x79, 0x18, 0x35, 0x8f, 0x07, 0x00, 0x29, 0x00, 0x10, 0x31, 0x80, 0x07, 0xf0, 0x04, 0x35,
+  0x35, 0x2c, 0x13, 0x18, 0x09, 0x09, 0x18, 0x20, 0x02, 0x81, 0x92, 0x18, 0x25, 0x27, 0x35, 0x2d, 0x1f, 0x1f, 0xbf, 0x03, 0x11, 0x35, 0x31, 0x0b,
+  0xf0, 0x12, 0x2d, 0x2d, 0x27, 0x0e, 0x1f, 0x18, 0x1a, 0x1f, 0x26, 0x27, 0x26, 0x27, 0x1f, 0x27, 0x18, 0x0e, 0x18, 0x81, 0x6c, 0x66, 0x6f, 0x8c,
+  0x92, 0x8c, 0x92, 0x8c, 0x6d, 0x60, 0x60, 0x7b, 0x85, 0x76, 0x5f, 0x4f, 0x09, 0xf0, 0x0a, 0x59, 0x5a, 0x5c, 0x58, 0x58, 0x55, 0x55, 0x53, 0x58,
+  0x57, 0x56, 0x57, 0x57, 0x5e, 0x71, 0x76, 0xa7, 0x5e, 0x5e, 0x61, 0x68, 0x75, 0x68, 0x5b, 0x57, 0xbe, 0x0c, 0x01, 0x93, 0x10, 0x31, 0x5a, 0x5b,
+  0x5e, 0xf7, 0x0e, 0x10, 0x60, 0xe0, 0x01, 0x42, 0x61, 0x67, 0x61, 0x65, 0x35, 0x09, 0x04, 0xd2, 0x01, 0x01, 0x01, 0x00, 0x41, 0x64, 0x64, 0x64,
+  0x5e, 0xc5, 0x03, 0xf0, 0x06, 0x64, 0x5b, 0xa3, 0x54, 0x5b, 0x5e, 0x64, 0x68, 0x6d, 0x71, 0x71, 0x71, 0x6d, 0x68, 0x5e, 0x5b, 0x58, 0x56, 0x5a,
+  0x67, 0x6d, 0xd6, 0x0c, 0x05, 0x01, 0x00, 0x70, 0x75, 0x75, 0x6c, 0x6d, 0x71, 0x6d, 0x67, 0x9f, 0x05, 0x00, 0x01, 0x00, 0x40, 0x5e, 0x5e, 0x58,
+  0x56, 0x49, 0x0b, 0x90, 0x58, 0x58, 0x58, 0x5e, 0x5a, 0x5f, 0x61, 0x67, 0x68, 0xbe, 0x03, 0x00, 0xd4, 0x10, 0x70, 0x73, 0x71, 0x73, 0x73, 0x75,
+  0x78, 0x78, 0x57, 0x09, 0x11, 0x73, 0x01, 0x00, 0x30, 0x71, 0x72, 0x71, 0x06, 0x00, 0x70, 0x6f, 0x6c, 0x6f, 0x73, 0x74, 0x73, 0x72, 0xf1, 0x01,
+  0x00, 0xe3, 0x01, 0x40, 0x7c, 0x7f, 0x7d, 0x83, 0xa7, 0x05, 0x10, 0x02, 0xc9, 0x03, 0x00, 0xeb, 0x0e, 0x20, 0x94, 0x94, 0xa5, 0x05, 0x20, 0x07,
+  0x99, 0xc3, 0x03, 0x01, 0x01, 0x00, 0x04, 0xf1, 0x01, 0x01, 0x01, 0x00, 0x00, 0xf2, 0x01, 0x00, 0xb3, 0x05, 0x40, 0x09, 0x09, 0x0b, 0x3f, 0xe1,
+  0x01, 0x41, 0x44, 0x45, 0x44, 0x32, 0x9f, 0x05, 0xf0, 0x05, 0x88, 0x01, 0x88, 0x1e, 0x20, 0x25, 0x20, 0x07, 0x03, 0x0a, 0x14, 0x07, 0x0d, 0x03,
+  0x25, 0x37, 0x3e, 0x3b, 0x41, 0x3e, 0xe4, 0x01, 0xf0, 0x07, 0x2c, 0x04, 0x25, 0x3f, 0x3f, 0x41, 0x3f, 0x32, 0x25, 0x9a, 0x00, 0x00, 0x00, 0x01,
+  0x32, 0x44, 0x44, 0x41, 0x3e, 0x32, 0x95, 0x88, 0xde, 0x01, 0x00, 0xd1, 0x01, 0x40, 0x7e, 0x00, 0x07, 0x17, 0xdb, 0x01, 0x00, 0x82, 0x07, 0x41,
+  0x7e, 0x7e, 0x7e, 0x0e, 0x9b, 0x01, 0x30, 0x04, 0x11, 0x41, 0xbe, 0x03, 0xf0, 0x01, 0x3e, 0x37, 0x37, 0x97, 0x8f, 0x86, 0x02, 0x7e, 0x7e, 0x89,
+  0x07, 0x7e, 0x7e, 0x95, 0x2c, 0x37, 0x1b, 0x00, 0xe0, 0x35, 0x1e, 0x25, 0x20, 0x04, 0x20, 0x1e, 0x07, 0x0e, 0x2c, 0x2c, 0x0b, 0x25, 0x37, 0x9d,
+  0x00, 0x20, 0x1e, 0x25, 0xb2, 0x03, 0x80, 0x1e, 0x04, 0x8b, 0x79, 0x79, 0x79, 0x7e, 0x03, 0x0c, 0x00, 0x00, 0x44, 0x00, 0x30, 0x3b, 0x39, 0x35,
+  0x6c, 0x07, 0xf0, 0x02, 0x2d, 0x2c, 0x25, 0x1f, 0x99, 0x18, 0x01, 0x04, 0x2c, 0x2c, 0x03, 0x86, 0x02, 0x09, 0x13, 0x1f, 0x35, 0x87, 0x05, 0x30,
+  0x2d, 0x2c, 0x1f, 0xbe, 0x05, 0x00, 0xe1, 0x01, 0xf0, 0x1f, 0x1f, 0x7e, 0x0b, 0x1f, 0x27, 0x27, 0x1a, 0x26, 0x27, 0x1a, 0x99, 0x07, 0x8f, 0x8b,
+  0x9b, 0x76, 0x60, 0x66, 0x7b, 0x8c, 0x85, 0x8c, 0x70, 0x5c, 0x5c, 0x5c, 0x5c, 0x70, 0x9c, 0x85, 0x5f, 0x5a, 0x5a, 0x59, 0xa5, 0x58, 0xa5, 0x5c,
+  0x5a, 0x5c, 0x5e, 0x55, 0x58, 0xaa, 0x58, 0x56, 0xd9, 0x0e, 0x00, 0x26, 0x0b, 0x30, 0x54, 0x5b, 0x54, 0x15, 0x0b, 0x41, 0x54, 0x54, 0x57, 0x56,
+  0x54, 0x07, 0x00, 0xda, 0x03, 0x05, 0x9d, 0x05, 0x34, 0x61, 0x67, 0x61, 0xc0, 0x03, 0x00, 0x4d, 0x07, 0x00, 0x1a, 0x0b, 0x40, 0x64, 0x64, 0x5e,
+  0x57, 0xf6, 0x0c, 0xf0, 0x01, 0x57, 0x5f, 0x61, 0x68, 0x64, 0x64, 0x5e, 0x5b, 0x5b, 0x56, 0x55, 0x56, 0x65, 0x68, 0x68, 0x61, 0x15, 0x00, 0xb1,
+  0xa3, 0x53, 0x53, 0x5e, 0x61, 0x71, 0x75, 0x78, 0x7c, 0x78, 0x7c, 0x01, 0x00, 0xa0, 0x78, 0x78, 0x7c, 0x6c, 0x67, 0x5f, 0x6d, 0x64, 0x5a, 0x56,
+  0xd8, 0x10, 0x00, 0x14, 0x0d, 0x01, 0x02, 0x0f, 0x20, 0x58, 0x58, 0x0a, 0x00, 0x61, 0x5a, 0x5e, 0x5f, 0x65, 0x6d, 0x70, 0xdd, 0x05, 0x00, 0xff,
+  0x03, 0x00, 0xdb, 0x01, 0x50, 0x7b, 0x78, 0x7c, 0x78, 0x78, 0x74, 0x07, 0xa1, 0x7c, 0x77, 0x78, 0x73, 0x78, 0x74, 0x76, 0x78, 0x7b, 0x78, 0x9f,
+  0x05, 0x00, 0x0c, 0x0f, 0x11, 0x6c, 0xe2, 0x01, 0x80, 0x73, 0x73, 0x78, 0x79, 0x79, 0x7f, 0x7d, 0x80, 0xe7, 0x01, 0x20, 0x86, 0x87, 0xb1, 0x05,
+  0x00, 0xce, 0x03, 0x90, 0x95, 0x97, 0x99, 0x97, 0x99, 0x9a, 0x04, 0x99, 0x9a, 0x77, 0x09, 0x60, 0x8f, 0x03, 0x94, 0x95, 0x95, 0x99, 0xdb, 0x03,
+  0x00, 0xf6, 0x01, 0x01, 0x4d, 0x0b, 0x50, 0x0b, 0x09, 0x0b, 0x32, 0x44, 0xc0, 0x03, 0x30, 0x44, 0x3f, 0x37, 0xe0, 0x01, 0xf0, 0x00, 0x88, 0x01,
+  0x88, 0x04, 0x1e, 0x11, 0x1e, 0x20, 0x0a, 0x00, 0x97, 0x02, 0x7e, 0x00, 0x7e, 0xe7, 0x0c, 0xf0, 0x00, 0x3b, 0x35, 0x3b, 0x41, 0x41, 0x3e, 0x1e,
+  0x00, 0x03, 0x25, 0x37, 0x3f, 0x3f, 0x32, 0x04, 0x2f, 0x0b, 0xa0, 0x03, 0x37, 0x44, 0x41, 0x44, 0x37, 0x1e, 0x88, 0x00, 0x83, 0x2d, 0x0b, 0x10,
+  0x7f, 0xd8, 0x01, 0x20, 0x07, 0x14, 0x5c, 0x09, 0x03, 0x01, 0x00, 0x70, 0x0e, 0x2c, 0x3b, 0x2d, 0x35, 0x35, 0x0e, 0xdd, 0x01, 0x00, 0x01, 0x00,
+  0xc0, 0x2c, 0x07, 0x03, 0x92, 0x0c, 0x02, 0x86, 0x02, 0x9b, 0x00, 0x7e, 0x07, 0xb6, 0x01, 0xb0, 0x35, 0x35, 0x37, 0x35, 0x11, 0x04, 0x0a, 0x25,
+  0x0d, 0x14, 0x0b, 0x83, 0x12, 0xf1, 0x04, 0x2c, 0x25, 0x0a, 0x03, 0x14, 0x2c, 0x03, 0x99, 0x2d, 0x35, 0x2c, 0x03, 0x79, 0x81, 0x79, 0x79, 0x86,
+  0x20, 0x37, 0x26, 0x00, 0x30, 0x3b, 0x35, 0x39, 0x62, 0x07, 0xf0, 0x03, 0x27, 0x1f, 0x18, 0x03, 0x99, 0x01, 0x95, 0x0b, 0x25, 0x2d, 0x25, 0x35,
+  0x35, 0x0e, 0x03, 0x09, 0x18, 0x1f, 0xb6, 0x03, 0x70, 0x2d, 0x27, 0x1e, 0x0b, 0x01, 0x18, 0x2d, 0x11, 0x0d, 0xf0, 0x26, 0x2d, 0x27, 0x1f, 0x08,
+  0x99, 0x1f, 0x26, 0x1f, 0x1a, 0x1a, 0x1a, 0x1f, 0x0e, 0x79, 0x62, 0x73, 0x6e, 0x60, 0x60, 0x6a, 0x90, 0x85, 0x71, 0x75, 0x5c, 0x5a, 0xa5, 0xa5,
+  0x58, 0x5c, 0x6c, 0x90, 0x6d, 0x5b, 0x58, 0x58, 0xa5, 0xa5, 0x5a, 0x61, 0x65, 0xa7, 0x76, 0x58, 0x58, 0x55, 0x58, 0x56, 0x58, 0x5b, 0x58, 0x57,
+  0x56, 0xd9, 0x01, 0x11, 0x52, 0xe1, 0x0e, 0x00, 0xe1, 0x01, 0x00, 0xee, 0x01, 0x10, 0x54, 0x08, 0x00, 0x20, 0x5b, 0x5b, 0xc3, 0x03, 0x00, 0x15,
+  0x09, 0x01, 0x7c, 0x14, 0x02, 0xc1, 0x03, 0x00, 0xa1, 0x05, 0x00, 0xb9, 0x03, 0xf0, 0x01, 0x5b, 0x56, 0x56, 0x53, 0x52, 0xa3, 0x53, 0x56, 0x56,
+  0x5e, 0x58, 0x5b, 0x5e, 0x5b, 0x61, 0x5b, 0x68, 0x0b, 0x30, 0x5e, 0x5b, 0x53, 0xd0, 0x10, 0x00, 0x17, 0x00, 0x40, 0x64, 0x67, 0x71, 0x75, 0xdb,
+  0x01, 0x00, 0xe0, 0x01, 0x70, 0x7c, 0x78, 0x78, 0x75, 0x71, 0x6c, 0x5f, 0xb5, 0x03, 0x04, 0xcd, 0x12, 0x03, 0x05, 0x0f, 0x01, 0xf0, 0x07, 0x00,
+  0xa2, 0x05, 0x10, 0x67, 0x9f, 0x05, 0x60, 0x6a, 0x6c, 0x6c, 0x66, 0x6a, 0x67, 0xf1, 0x0e, 0xc0, 0x74, 0x74, 0x79, 0x78, 0x7f, 0x81, 0x80, 0x7d,
+  0x79, 0x74, 0x73, 0x73, 0xce, 0x01, 0x20, 0x73, 0x72, 0x82, 0x07, 0x10, 0x73, 0x14, 0x0f, 0x30, 0x6e, 0x73, 0x6f, 0x14, 0x00, 0x70, 0x74, 0x79,
+  0x79, 0x78, 0x79, 0x73, 0x79, 0xe6, 0x01, 0x93, 0x7e, 0x7a, 0x7e, 0x86, 0x87, 0x02, 0x87, 0x02, 0x8a, 0xb6, 0x12, 0x70, 0x8f, 0x94, 0x8d, 0x8d,
+  0x8d, 0x02, 0x8d, 0xe6, 0x10, 0x80, 0x94, 0x8f, 0x8e, 0x8f, 0x8e, 0x03, 0x94, 0x94, 0xe3, 0x01, 0x00, 0x5f, 0x0b, 0x20, 0x09, 0x37, 0xc1, 0x03,
+  0x23, 0x44, 0x44, 0xc0, 0x03, 0x00, 0x21, 0x0d, 0x90, 0x95, 0x11, 0x20, 0x86, 0x86, 0x97, 0x00, 0x81, 0x83, 0xa9, 0x01, 0x00, 0x9a, 0x0c, 0xf0,
+  0x08, 0x3b, 0x3e, 0x3e, 0x1e, 0x00, 0x02, 0x04, 0x07, 0x37, 0x41, 0x3f, 0x02, 0x00, 0x00, 0x88, 0x00, 0x01, 0x32, 0x41, 0x41, 0x3e, 0x37, 0x0a,
+  0x70, 0x07, 0x40, 0x83, 0x7e, 0x7f, 0x7e, 0x03, 0x00, 0x20, 0x95, 0x17, 0xd9, 0x01, 0x80, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x79, 0x7e, 0x18, 0x81,
+  0x01, 0x20, 0x35, 0x3e, 0xbf, 0x03, 0xe0, 0x41, 0x3e, 0x3e, 0x37, 0x20, 0x03, 0x94, 0x17, 0x0c, 0x86, 0x7e, 0x7e, 0x11, 0x1e, 0x85, 0x05, 0xf0,
+  0x08, 0x35, 0x39, 0x2c, 0x1f, 0x35, 0x32, 0x0b, 0x79, 0x8d, 0x11, 0x0b, 0x0a, 0x0b, 0x18, 0x25, 0x25, 0x0a, 0x18, 0x25, 0x0e, 0x18, 0x25, 0x2c,
+  0xba, 0x05, 0x61, 0x2c, 0x02, 0x79, 0x79, 0x79, 0x79, 0x8a, 0x07, 0x20, 0x35, 0x35, 0xfb, 0x0e, 0xc1, 0x35, 0x39, 0x35, 0x2d, 0x27, 0x1f, 0x00,
+  0x7e, 0x02, 0x88, 0x13, 0x1f, 0x54, 0x00, 0x00, 0xb5, 0x03, 0x01, 0x3c, 0x0b, 0x60, 0x27, 0x18, 0x01, 0x7e, 0x73, 0x0e, 0xcf, 0x10, 0x01, 0xf9,
+  0x0e, 0xf0, 0x20, 0x27, 0x27, 0x27, 0x1a, 0x06, 0x06, 0x13, 0x0f, 0x0e, 0x95, 0x73, 0x6e, 0x5e, 0x5c, 0x65, 0x76, 0x76, 0x8c, 0x7d, 0x6c, 0x62,
+  0x58, 0xa5, 0xa5, 0x55, 0x58, 0x56, 0x64, 0x64, 0x5b, 0x57, 0x55, 0x55, 0x58, 0xa5, 0x61, 0x69, 0x71, 0xa7, 0x5e, 0x58, 0x5b, 0x58, 0x58, 0x55,
+  0x61, 0x5b, 0xe0, 0x01, 0x00, 0xdb, 0x01, 0x01, 0x01, 0x00, 0x00, 0xd9, 0x01, 0x02, 0x0e, 0x00, 0x01, 0xe1, 0x01, 0x01, 0xb9, 0x01, 0x00, 0xd8,
+  0x0c, 0x00, 0xd1, 0x0e, 0x02, 0x01, 0x00, 0x00, 0xdf, 0x01, 0x30, 0x5f, 0x5b, 0x5e, 0xc0, 0x03, 0x30, 0xa3, 0x53, 0x54, 0xb0, 0x01, 0x00, 0x9b,
+  0x12, 0x50, 0x5b, 0x5e, 0x5b, 0x56, 0x54, 0xde, 0x01, 0x11, 0x54, 0x07, 0x00, 0x50, 0x53, 0x56, 0x5f, 0x67, 0x75, 0xdd, 0x01, 0x01, 0x35, 0x16,
+  0x40, 0x7c, 0x7d, 0x78, 0x78, 0x6a, 0x09, 0x01, 0x98, 0x16, 0x00, 0x95, 0x16, 0x00, 0xd6, 0x10, 0x10, 0x58, 0x0c, 0x00, 0x30, 0x5e, 0x5f, 0x5e,
+  0x7e, 0x07, 0x10, 0x67, 0x31, 0x0b, 0x00, 0x3c, 0x0b, 0xa0, 0x62, 0x5f, 0x62, 0x62, 0x66, 0x67, 0x6e, 0x73, 0x73, 0x7a, 0xaa, 0x12, 0x31, 0x7a,
+  0x7c, 0x7c, 0xc7, 0x01, 0x10, 0x6f, 0xb7, 0x03, 0x30, 0x6e, 0x6e, 0x6e, 0xda, 0x01, 0x61, 0x72, 0x73, 0x74, 0x74, 0x77, 0x79, 0x49, 0x0b, 0xf0,
+  0x0b, 0x81, 0x81, 0x79, 0x79, 0x7c, 0x7e, 0x7a, 0x7d, 0x79, 0x7f, 0x81, 0x86, 0x86, 0x00, 0x83, 0x86, 0x87, 0x86, 0x86, 0x86, 0x88, 0x86, 0x02,
+  0x02, 0x86, 0x83, 0x0d, 0x00, 0xb1, 0x81, 0x83, 0x86, 0x8d, 0x8d, 0x8d, 0x86, 0x8a, 0x02, 0x8d, 0x8d, 0xf9, 0x10, 0x60, 0x03, 0x95, 0x99, 0x04,
+  0x04, 0x3f, 0x59, 0x07, 0x40, 0x44, 0x41, 0x3f, 0x2c, 0x3a, 0x18, 0x02, 0x01, 0x00, 0xa0, 0x11, 0x32, 0x97, 0x97, 0x17, 0x86, 0x7e, 0x7e, 0x7e,
+  0x0a, 0x7b, 0x0e, 0xe0, 0x39, 0x35, 0x3b, 0x3b, 0x37, 0x18, 0x00, 0x03, 0x8f, 0x88, 0x29, 0x3f, 0x3f, 0x03, 0x73, 0x07, 0x41, 0x00, 0x1e, 0x41,
+  0x41, 0xfb, 0x0e, 0x00, 0xcf, 0x01, 0x00, 0x02, 0x00, 0x70, 0x00, 0x7e, 0x04, 0x17, 0x7e, 0x7e, 0x79, 0xe2, 0x01, 0x41, 0x7e, 0x79, 0x79, 0x00,
+  0x5b, 0x12, 0x40, 0x3e, 0x3b, 0x41, 0x3b, 0xbe, 0x03, 0xd0, 0x35, 0x2c, 0x95, 0x00, 0x7e, 0x00, 0x86, 0x7e, 0x00, 0x02, 0x1e, 0x1e, 0x25, 0x58,
+  0x0b, 0xf0, 0x03, 0x35, 0x1f, 0x25, 0x3e, 0x25, 0x03, 0x7e, 0x79, 0x7e, 0x0a, 0x0c, 0x14, 0x14, 0x0b, 0x1e, 0x0e, 0x14, 0x18, 0x2f, 0x0b, 0xa0,
+  0x04, 0x1f, 0x35, 0x35, 0x35, 0x8f, 0x79, 0x86, 0x79, 0x7e, 0xa3, 0x07, 0x02, 0x01, 0x00, 0x01, 0xc0, 0x03, 0xf0, 0x04, 0x1f, 0x1f, 0x09, 0x04,
+  0x11, 0x04, 0x18, 0x27, 0x35, 0x2d, 0x13, 0x0e, 0x27, 0x35, 0x31, 0x27, 0x1f, 0x27, 0x08, 0xc1, 0x03, 0x50, 0x1f, 0x1e, 0x95, 0x7e, 0x18, 0xae,
+  0x12, 0x11, 0x1f, 0xe0, 0x01, 0xf0, 0x06, 0x1f, 0x1f, 0x13, 0x1f, 0x08, 0x0f, 0x04, 0x93, 0x02, 0x97, 0x92, 0x82, 0x70, 0x68, 0x5c, 0x5c, 0x85,
+  0x98, 0x85, 0xa7, 0x59, 0x31, 0x0b, 0x01, 0xa9, 0x03, 0xa0, 0x53, 0x55, 0xa5, 0x58, 0x5c, 0x69, 0x61, 0x5a, 0x5e, 0x64, 0x69, 0x01, 0x20, 0x56,
+  0x5b, 0xad, 0x03, 0x00, 0xaf, 0x10, 0x00, 0xd5, 0x01, 0x00, 0xe0, 0x01, 0x12, 0x52, 0x0d, 0x00, 0x02, 0xe0, 0x01, 0x11, 0x5b, 0x4f, 0x18, 0x00,
+  0xe1, 0x01, 0x10, 0x64, 0xe5, 0x0c, 0x01, 0x02, 0x00, 0x00, 0x8f, 0x05, 0x70, 0x5e, 0x64, 0x64, 0x5b, 0x56, 0x52, 0xa3, 0xc6, 0x05, 0x20, 0x57,
+  0x53, 0xa0, 0x12, 0x40, 0x56, 0x53, 0xa3, 0xa3, 0x92, 0x16, 0x00, 0xf3, 0x01, 0x00, 0x90, 0x16, 0x90, 0x67, 0x6d, 0x71, 0x71, 0x76, 0x75, 0x7b,
+  0x7d, 0x82, 0xe1, 0x01, 0x21, 0x7d, 0x7d, 0xc5, 0x03, 0x03, 0x61, 0x0b, 0x20, 0x68, 0x68, 0xd7, 0x10, 0x00, 0xaf, 0x07, 0x00, 0x54, 0x0d, 0x00,
+  0x96, 0x05, 0x00, 0x9e, 0x05, 0x00, 0x99, 0x14, 0xf0, 0x07, 0x6c, 0x67, 0x66, 0x62, 0x62, 0x66, 0x6a, 0x6e, 0x72, 0x78, 0x7a, 0x81, 0x80, 0x81,
+  0x80, 0x7c, 0x7f, 0x7c, 0x80, 0x81, 0x80, 0x7d, 0x89, 0x07, 0x01, 0xc2, 0x03, 0x01, 0xb8, 0x03, 0x40, 0x77, 0x7c, 0x7d, 0x80, 0x5a, 0x18, 0xe0,
+  0x02, 0x86, 0x02, 0x81, 0x86, 0x81, 0x00, 0x81, 0x86, 0x81, 0x83, 0x81, 0x86, 0x8d, 0xf0, 0x01, 0x02, 0x01, 0x00, 0xf0, 0x01, 0x88, 0x89, 0x02,
+  0x86, 0x83, 0x81, 0x83, 0x86, 0x83, 0x00, 0x86, 0x02, 0x8d, 0x88, 0x87, 0x86, 0xd7, 0x03, 0xc0, 0x95, 0x04, 0x04, 0x99, 0x04, 0x99, 0x04, 0x09,
+  0x09, 0x11, 0x37, 0x3f, 0x44, 0x09, 0x24, 0x3e, 0x37, 0xe0, 0x01, 0xf0, 0x0f, 0x88, 0x01, 0x95, 0x18, 0x17, 0x07, 0x0c, 0x8d, 0x7a, 0x79, 0x79,
+  0x09, 0x2c, 0x35, 0x39, 0x39, 0x35, 0x31, 0x35, 0x3b, 0x35, 0x18, 0x00, 0x9a, 0x00, 0x81, 0x0e, 0x37, 0x41, 0x97, 0x07, 0x0d, 0x60, 0x7e, 0x14,
+  0x3e, 0x3f, 0x3e, 0x29, 0x6f, 0x16, 0x21, 0x7f, 0x7e, 0xa0, 0x05, 0x41, 0x7f, 0x00, 0x9a, 0x20, 0xdb, 0x01, 0x01, 0x01, 0x00, 0x11, 0x03, 0xbc,
+  0x0c, 0x10, 0x3b, 0x85, 0x14, 0x40, 0x3b, 0x3e, 0x3b, 0x32, 0x1e, 0x0d, 0x72, 0x7e, 0x7e, 0x7e, 0x02, 0x0c, 0x18, 0x1e, 0xbb, 0x01, 0xf0, 0x07,
+  0x1f, 0x2c, 0x35, 0x25, 0x0a, 0x7e, 0x79, 0x86, 0x89, 0x0a, 0x8f, 0x0b, 0x14, 0x18, 0x0a, 0x00, 0x04, 0x25, 0x25, 0x2c, 0x18, 0x0e, 0x1c, 0x00,
+  0x50, 0x17, 0x00, 0x7d, 0x79, 0x02, 0xbf, 0x03, 0x00, 0xc5, 0x05, 0x00, 0xdf, 0x01, 0xf0, 0x03, 0x39, 0x2c, 0x2d, 0x2d, 0x1f, 0x0e, 0x00, 0x1e,
+  0x01, 0x13, 0x27, 0x2d, 0x2d, 0x18, 0x01, 0x1f, 0x39, 0x39, 0xb1, 0x05, 0x00, 0x9f, 0x05, 0x40, 0x27, 0x25, 0x2d, 0x2c, 0x9b, 0x05, 0x30, 0x0e,
+  0x01, 0x0f, 0x9a, 0x14, 0xf0, 0x0b, 0x1f, 0x06, 0x03, 0x0b, 0x13, 0x0b, 0x87, 0x73, 0x87, 0x9a, 0x9b, 0x92, 0x67, 0x76, 0x75, 0x62, 0x6d, 0x61,
+  0x7c, 0x69, 0x61, 0x59, 0x55, 0x55, 0x54, 0xa3, 0xba, 0x01, 0xf1, 0x00, 0x53, 0x56, 0x56, 0x59, 0x61, 0x69, 0x7c, 0x5f, 0x57, 0x54, 0x54, 0x57,
+  0x55, 0x57, 0x58, 0x8e, 0x05, 0x00, 0x18, 0x00, 0x11, 0xa2, 0x7c, 0x14, 0x00, 0xe5, 0x01, 0x01, 0x01, 0x00, 0x00, 0xa8, 0x05, 0x11, 0x57, 0xe0,
+  0x01, 0x00, 0x06, 0x00, 0x20, 0x64, 0x64, 0xad, 0x0e, 0x00, 0x17, 0x0d, 0x01, 0x41, 0x1a, 0x50, 0x57, 0x5b, 0x64, 0x64, 0x5b, 0x95, 0x14, 0x00,
+  0xe1, 0x10, 0x00, 0xbd, 0x03, 0x40, 0x5e, 0x5e, 0x57, 0x52, 0xdf, 0x01, 0x00, 0x93, 0x14, 0x20, 0x57, 0x5f, 0x39, 0x02, 0x10, 0x5b, 0x7e, 0x0b,
+  0x40, 0x6d, 0x76, 0x76, 0x7b, 0x01, 0x00, 0x23, 0x7c, 0x7b, 0xe5, 0x01, 0x00, 0xae, 0x05, 0xf0, 0x07, 0x7c, 0x75, 0x75, 0x75, 0x7c, 0x75, 0x78,
+  0x76, 0x75, 0x76, 0x76, 0x6d, 0x76, 0x6d, 0x6a, 0x6c, 0x6a, 0x6e, 0x76, 0x71, 0x7c, 0x7b, 0x1e, 0x00, 0x20, 0x76, 0x71, 0xd9, 0x10, 0xf0, 0x04,
+  0x6e, 0x71, 0x73, 0x74, 0x77, 0x7d, 0x7a, 0x7d, 0x77, 0x79, 0x78, 0x7a, 0x7d, 0x83, 0x81, 0x81, 0x7e, 0x7d, 0x7a, 0xac, 0x05, 0xa1, 0x79, 0x79,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x79, 0x7d, 0x81, 0x83, 0x4c, 0x18, 0x40, 0x8f, 0x8f, 0x8f, 0x8d, 0x6b, 0x16, 0x11, 0x8d, 0x0c, 0x00, 0x30, 0x94, 0x94,
+  0x91, 0x9b, 0x05, 0x40, 0x8d, 0x02, 0x02, 0x02, 0x9e, 0x05, 0x10, 0x8a, 0xb4, 0x14, 0x11, 0x8d, 0x0f, 0x00, 0x30, 0x8f, 0x94, 0x94, 0x9b, 0x05,
+  0x00, 0x9e, 0x05, 0x40, 0x07, 0x09, 0x00, 0x1e, 0x4e, 0x07, 0x25, 0x41, 0x3f, 0xe0, 0x01, 0xe0, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x88, 0x86,
+  0x7e, 0x79, 0x79, 0x04, 0x2c, 0x35, 0xdf, 0x01, 0xf0, 0x06, 0x39, 0x3b, 0x35, 0x1e, 0x7e, 0x9a, 0x7e, 0x7e, 0x8d, 0x32, 0x37, 0x0c, 0x7e, 0x79,
+  0x7e, 0x7f, 0x7e, 0x0b, 0x37, 0x41, 0x37, 0x30, 0x1a, 0x00, 0x3a, 0x0b, 0x02, 0x01, 0x00, 0x23, 0x11, 0x29, 0x5d, 0x09, 0x50, 0x7f, 0x7e, 0x7e,
+  0x04, 0x2c, 0xde, 0x01, 0x00, 0xba, 0x03, 0x00, 0x01, 0x0f, 0x22, 0x37, 0x07, 0x16, 0x00, 0x60, 0x02, 0x18, 0x14, 0x35, 0x35, 0x3e, 0x8b, 0x12,
+  0x50, 0x35, 0x2c, 0x35, 0x37, 0x18, 0x0d, 0x02, 0xd0, 0x86, 0x95, 0x1e, 0x18, 0x18, 0x0a, 0x03, 0x1e, 0x2c, 0x1e, 0x2c, 0x8f, 0x03, 0xbb, 0x05,
+  0x70, 0x2c, 0x9a, 0x7e, 0x79, 0x04, 0x2c, 0x3e, 0xdf, 0x01, 0x30, 0x2c, 0x2d, 0x2c, 0x81, 0x07, 0x11, 0x18, 0x17, 0x1a, 0x50, 0x35, 0x2c, 0x1f,
+  0x1f, 0x27, 0x2f, 0x0b, 0x50, 0x3b, 0x39, 0x2d, 0x2d, 0x1f, 0x76, 0x07, 0x21, 0x2d, 0x1f, 0x8e, 0x14, 0x50, 0x2d, 0x0e, 0x03, 0x1f, 0x1f, 0xc6,
+  0x03, 0xf0, 0x0a, 0x13, 0x0e, 0x13, 0x13, 0x18, 0x0a, 0x73, 0x6e, 0x83, 0x9a, 0x99, 0x97, 0x7d, 0x92, 0x9c, 0x76, 0x5c, 0x5c, 0x61, 0x58, 0x65,
+  0x58, 0x55, 0x55, 0xa3, 0x54, 0x14, 0xf1, 0x01, 0x52, 0xa2, 0x56, 0x55, 0x58, 0x55, 0x5a, 0x68, 0x6d, 0x64, 0x54, 0x64, 0x64, 0x57, 0x58, 0xaa,
+  0xde, 0x01, 0x02, 0xe0, 0x01, 0x01, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0xdf, 0x01, 0x01, 0x89, 0x07, 0x00, 0xbc, 0x03, 0x00, 0x02, 0x00, 0x02,
+  0x74, 0x12, 0x00, 0x01, 0x00, 0x00, 0xe2, 0x05, 0x80, 0x5e, 0x5b, 0x57, 0x56, 0x5f, 0x64, 0x5b, 0x54, 0x43, 0x1a, 0x50, 0x53, 0x5b, 0x5b, 0x5b,
+  0x67, 0x7f, 0x12, 0x81, 0x64, 0x5b, 0x52, 0x52, 0x57, 0x64, 0x71, 0x6d, 0x28, 0x09, 0xf0, 0x06, 0x71, 0x71, 0x64, 0x55, 0x53, 0x53, 0x55, 0xa4,
+  0x55, 0x5f, 0x67, 0x67, 0x67, 0x65, 0x68, 0x69, 0x68, 0x6e, 0x71, 0x7b, 0x82, 0x02, 0x1a, 0x00, 0x01, 0x00, 0xd0, 0x7c, 0x7c, 0x75, 0x75, 0x7c,
+  0x7c, 0x78, 0x6d, 0x62, 0x67, 0x62, 0x66, 0x67, 0x02, 0x00, 0x61, 0x6c, 0x66, 0x6a, 0x6c, 0x73, 0x75, 0x60, 0x07, 0x50, 0x6c, 0x66, 0x67, 0x6c,
+  0x6f, 0x63, 0x07, 0xf0, 0x02, 0x77, 0x78, 0x77, 0x74, 0x74, 0x79, 0x7c, 0x80, 0x81, 0x83, 0x86, 0x81, 0x86, 0x8b, 0x8d, 0x8b, 0x8d, 0x56, 0x18,
+  0x80, 0x89, 0x86, 0x81, 0x86, 0x7e, 0x86, 0x02, 0x8d, 0x18, 0x0d, 0x40, 0x95, 0x95, 0x95, 0x97, 0x3d, 0x0b, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00,
+  0x10, 0x9a, 0x4d, 0x09, 0x10, 0x95, 0xe5, 0x01, 0x60, 0x94, 0x8f, 0x8f, 0x8d, 0x8d, 0x8a, 0x7f, 0x07, 0xf0, 0x02, 0x95, 0x94, 0x94, 0x9a, 0x99,
+  0x07, 0x05, 0x05, 0x09, 0x09, 0x05, 0x07, 0x08, 0x07, 0x05, 0x09, 0x07, 0xb1, 0x00, 0x20, 0x41, 0x41, 0x44, 0x41, 0x44, 0x41, 0x3f, 0x03, 0x01,
+  0x01, 0x00, 0xf0, 0x1a, 0x8f, 0x01, 0x01, 0x88, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7a, 0x7e, 0x79, 0x04, 0x2c, 0x35, 0x39, 0x39, 0x2d, 0x39, 0x39,
+  0x3b, 0x35, 0x25, 0x00, 0x97, 0x79, 0x79, 0x79, 0x14, 0x2c, 0x29, 0x7e, 0x79, 0x79, 0x79, 0x7e, 0x14, 0x3f, 0x3e, 0x37, 0x11, 0x25, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x2e, 0x00, 0x40, 0x88, 0x20, 0x2c, 0x02, 0x0c, 0x00, 0xf0, 0x12, 0x00, 0x00, 0x7e, 0x00, 0x7e, 0x18, 0x35, 0x3e, 0x3b, 0x3e,
+  0x3e, 0x3e, 0x3e, 0x35, 0x03, 0x09, 0x37, 0x3e, 0x37, 0x37, 0x02, 0x00, 0x7f, 0x00, 0x7f, 0x7e, 0x7f, 0x7e, 0x07, 0x1f, 0x37, 0x3e, 0x3b, 0x02,
+  0x00, 0xf0, 0x29, 0x35, 0x35, 0x35, 0x37, 0x2c, 0x14, 0x03, 0x79, 0x79, 0x8b, 0x9a, 0x18, 0x1e, 0x0e, 0x0c, 0x2c, 0x2c, 0x35, 0x25, 0x2c, 0x11,
+  0x03, 0x1e, 0x3b, 0x35, 0x35, 0x2c, 0x11, 0x0d, 0x00, 0x04, 0x35, 0x35, 0x3b, 0x37, 0x35, 0x18, 0x13, 0x25, 0x35, 0x35, 0x3b, 0x35, 0x39, 0x03,
+  0x0e, 0x35, 0x27, 0x2d, 0x35, 0x39, 0x35, 0x2d, 0x2d, 0x2d, 0x35, 0x08, 0x00, 0xf0, 0x23, 0x39, 0x39, 0x1f, 0x13, 0x1f, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x27, 0x1f, 0x27, 0x2d, 0x31, 0x2d, 0x2d, 0x01, 0x04, 0x27, 0x27, 0x27, 0x27, 0x1f, 0x1f, 0x1f, 0x1a, 0x13, 0x05, 0x91, 0x92, 0x69, 0x5c, 0x6e,
+  0x0a, 0x11, 0x9a, 0x72, 0x90, 0x82, 0x63, 0x58, 0xa5, 0xa5, 0x58, 0x5d, 0x61, 0x55, 0x56, 0x52, 0xa2, 0x01, 0x00, 0xf2, 0x02, 0x52, 0x52, 0x56,
+  0x55, 0x58, 0x58, 0x62, 0x84, 0x64, 0x64, 0xa6, 0x68, 0x57, 0x56, 0x54, 0x54, 0x52, 0x17, 0x00, 0x08, 0x01, 0x00, 0x41, 0x52, 0x52, 0x52, 0x54,
+  0x01, 0x00, 0x22, 0x57, 0x5b, 0x01, 0x00, 0xf0, 0x1f, 0x64, 0x5b, 0x64, 0x64, 0x64, 0x64, 0x68, 0x68, 0x68, 0x64, 0x64, 0x68, 0x5e, 0x64, 0x64,
+  0x64, 0x5e, 0x57, 0x68, 0x64, 0x64, 0x5b, 0x53, 0xa2, 0xa2, 0xa2, 0x53, 0x57, 0x5e, 0x64, 0x71, 0x71, 0x75, 0x71, 0x75, 0x75, 0x71, 0x67, 0x5f,
+  0x71, 0x75, 0x7c, 0x7c, 0x7d, 0x7c, 0x7d, 0x01, 0x00, 0xf0, 0x06, 0x75, 0x64, 0x5e, 0x5a, 0x56, 0x58, 0x56, 0x5a, 0x58, 0x58, 0x55, 0x53, 0x53,
+  0x55, 0x53, 0x55, 0x5c, 0x71, 0x7b, 0x7d, 0x82, 0x02, 0x00, 0xf0, 0x44, 0x78, 0x76, 0x71, 0x6a, 0x5f, 0x5f, 0x67, 0x6a, 0x6c, 0x62, 0x62, 0x62,
+  0x67, 0x67, 0x6c, 0x6c, 0x6e, 0x6e, 0x72, 0x6e, 0x6c, 0x6a, 0x67, 0x6a, 0x6c, 0x6e, 0x6e, 0x6c, 0x6e, 0x6c, 0x6a, 0x6c, 0x6c, 0x6e, 0x73, 0x73,
+  0x73, 0x73, 0x6f, 0x6e, 0x72, 0x6e, 0x73, 0x72, 0x73, 0x77, 0x80, 0x86, 0x86, 0x83, 0x86, 0x89, 0x8d, 0x8f, 0x8f, 0x8f, 0x8d, 0x8d, 0x8d, 0x8f,
+  0x8d, 0x8d, 0x8f, 0x89, 0x02, 0x8d, 0x8f, 0x94, 0x94, 0x95, 0x95, 0x9a, 0x95, 0x04, 0x95, 0x04, 0x94, 0x03, 0x8f, 0x03, 0x8d, 0x88, 0x02, 0x1a,
+  0x00, 0x90, 0x8f, 0x94, 0x94, 0x94, 0x94, 0x91, 0x8f, 0x8f, 0x8e, 0x08, 0x00, 0xc0, 0x93, 0x8f, 0x8f, 0x8f, 0x94, 0x94, 0x9a, 0x04, 0x9a, 0x04,
+  0x04, 0x04, 0x06, 0x00, 0xc2, 0x05, 0x04, 0x04, 0x99, 0x95, 0x04, 0x95, 0x95, 0x99, 0x18, 0x3f, 0x3e, 0xe0, 0x01, 0xa0, 0x09, 0x02, 0x01, 0x01,
+  0x01, 0x03, 0x07, 0x18, 0x03, 0x88, 0xb2, 0x01, 0x70, 0x83, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x35, 0x53, 0x01, 0xf0, 0x18, 0x2d, 0x3b, 0x39, 0x35,
+  0x25, 0x02, 0x8f, 0x79, 0x79, 0x79, 0x03, 0x37, 0x32, 0x02, 0x79, 0x79, 0x7e, 0x00, 0x25, 0x41, 0x3f, 0x3e, 0x07, 0x00, 0x00, 0x88, 0x88, 0x01,
+  0x88, 0x88, 0x8f, 0x88, 0x88, 0x88, 0x88, 0x00, 0x11, 0x32, 0x8f, 0xde, 0x01, 0x00, 0xed, 0x01, 0x30, 0x01, 0x2c, 0x37, 0xde, 0x01, 0xc0, 0x3e,
+  0x37, 0x18, 0x00, 0x18, 0x3e, 0x3e, 0x37, 0x2c, 0x00, 0x7e, 0x7e, 0xdf, 0x01, 0x61, 0x00, 0x7e, 0x1e, 0x3b, 0x3b, 0x41, 0x02, 0x00, 0xf0, 0x07,
+  0x1e, 0x2c, 0x2c, 0x2c, 0x25, 0x20, 0x8f, 0x02, 0x86, 0x04, 0x11, 0x9a, 0x02, 0x03, 0x14, 0x18, 0x35, 0x2c, 0x0b, 0x18, 0x0a, 0x0e, 0xd0, 0x01,
+  0x40, 0x0b, 0x03, 0x00, 0x18, 0x08, 0x00, 0x50, 0x3b, 0x2c, 0x2c, 0x35, 0x35, 0x7d, 0x00, 0x91, 0x35, 0x2d, 0x39, 0x2d, 0x31, 0x39, 0x3b, 0x2d,
+  0x39, 0x02, 0x00, 0xa0, 0x35, 0x31, 0x35, 0x2d, 0x2d, 0x08, 0x1f, 0x18, 0x27, 0x2d, 0x02, 0x00, 0xf2, 0x15, 0x31, 0x31, 0x2d, 0x1f, 0x09, 0x1f,
+  0x2d, 0x27, 0x2c, 0x0b, 0x04, 0x13, 0x13, 0x08, 0x05, 0x93, 0x6f, 0x6e, 0x60, 0x5a, 0x62, 0x92, 0x9b, 0x8c, 0x71, 0x63, 0x5a, 0x59, 0xa5, 0xa5,
+  0xa5, 0xa5, 0x58, 0x61, 0x58, 0x56, 0xca, 0x01, 0xd0, 0x52, 0x52, 0x54, 0x53, 0x55, 0x55, 0x5f, 0x82, 0xa6, 0x67, 0x57, 0x58, 0x54, 0xdf, 0x01,
+  0x20, 0x52, 0xa2, 0x02, 0x00, 0x09, 0x01, 0x00, 0x00, 0x11, 0x00, 0x11, 0x52, 0xe7, 0x01, 0x31, 0x57, 0x57, 0x5b, 0xe5, 0x01, 0x30, 0x64, 0x64,
+  0x5e, 0x05, 0x00, 0x22, 0x5b, 0x5e, 0xe6, 0x01, 0xf0, 0x05, 0x64, 0x68, 0x6d, 0x68, 0x64, 0x57, 0x52, 0xa3, 0x52, 0x5b, 0x64, 0x67, 0x6d, 0x71,
+  0x78, 0x78, 0x7c, 0x7d, 0x7d, 0x7c, 0x06, 0x00, 0xf0, 0x50, 0x81, 0x81, 0x81, 0x81, 0x86, 0x81, 0x86, 0x81, 0x85, 0x7d, 0x78, 0x75, 0x71, 0x64,
+  0x5e, 0x5f, 0x64, 0x61, 0x5e, 0x56, 0x53, 0xa4, 0xa3, 0xa4, 0x53, 0x58, 0x6c, 0x71, 0x6f, 0x73, 0x73, 0x6e, 0x73, 0x6c, 0x6c, 0x66, 0x67, 0x6c,
+  0x67, 0x62, 0x62, 0x6c, 0x6e, 0x6c, 0x6c, 0x6c, 0x73, 0x78, 0x78, 0x74, 0x71, 0x73, 0x73, 0x71, 0x6e, 0x6c, 0x6f, 0x73, 0x73, 0x79, 0x74, 0x79,
+  0x74, 0x79, 0x73, 0x78, 0x73, 0x79, 0x7c, 0x7f, 0x7d, 0x7d, 0x79, 0x73, 0x6e, 0x6f, 0x6e, 0x6f, 0x73, 0x73, 0x7d, 0x87, 0x8b, 0x02, 0x86, 0x00,
+  0x89, 0x8f, 0x8d, 0x02, 0x8d, 0x02, 0x89, 0x02, 0x89, 0xcb, 0x01, 0x00, 0xde, 0x01, 0xb0, 0x95, 0x95, 0x94, 0x95, 0x95, 0x94, 0x94, 0x8f, 0x8f,
+  0x94, 0x91, 0x1b, 0x00, 0x10, 0x8d, 0x04, 0x00, 0xf1, 0x03, 0x8f, 0x8d, 0x8d, 0x02, 0x8a, 0x88, 0x8d, 0x8f, 0x91, 0x94, 0x8f, 0x8f, 0x8f, 0x93,
+  0x94, 0x94, 0x95, 0x99, 0x27, 0x00, 0xf0, 0x10, 0x94, 0x93, 0x94, 0x93, 0x94, 0x91, 0x8e, 0x8f, 0x03, 0x8e, 0x8f, 0x8e, 0x8f, 0x3f, 0x37, 0x2c,
+  0x3e, 0x41, 0x41, 0x41, 0x41, 0x3f, 0x18, 0x01, 0x88, 0x01, 0x02, 0x25, 0x3f, 0x3f, 0x20, 0xe0, 0x01, 0x02, 0x03, 0x00, 0xc1, 0x04, 0x35, 0x2d,
+  0x35, 0x31, 0x2d, 0x35, 0x39, 0x3b, 0x2d, 0x2c, 0x07, 0xf0, 0x01, 0xf0, 0x06, 0x37, 0x3e, 0x29, 0x02, 0x02, 0x02, 0x02, 0x37, 0x3f, 0x41, 0x37,
+  0x04, 0x01, 0x88, 0x01, 0x8f, 0x02, 0x01, 0x02, 0x1e, 0x0c, 0x30, 0x00, 0x30, 0x03, 0x32, 0x03, 0x33, 0x00, 0x00, 0x1a, 0x02, 0x12, 0x04, 0xdf,
+  0x01, 0xa0, 0x3e, 0x2c, 0x02, 0x00, 0x2c, 0x3f, 0x3e, 0x37, 0x17, 0x00, 0xdf, 0x01, 0x50, 0x00, 0x7f, 0x00, 0x02, 0x2c, 0xbd, 0x03, 0xf0, 0x12,
+  0x41, 0x3e, 0x3e, 0x35, 0x35, 0x3e, 0x37, 0x35, 0x18, 0x37, 0x25, 0x1e, 0x02, 0x07, 0x94, 0x7e, 0x79, 0x00, 0x07, 0x13, 0x2c, 0x25, 0x09, 0x14,
+  0x35, 0x2c, 0x35, 0x3b, 0x3b, 0x35, 0x25, 0x01, 0x14, 0xd8, 0x01, 0x00, 0x01, 0x00, 0x31, 0x27, 0x2c, 0x2d, 0xea, 0x01, 0x20, 0x39, 0x2d, 0xc1,
+  0x03, 0x10, 0x2d, 0x68, 0x02, 0xa0, 0x2d, 0x1f, 0x25, 0x27, 0x1f, 0x2c, 0x0f, 0x7e, 0x7e, 0x0e, 0xb5, 0x03, 0xf1, 0x0e, 0x27, 0x2d, 0x27, 0x1f,
+  0x09, 0x0f, 0x25, 0x27, 0x27, 0x1e, 0x94, 0x98, 0x89, 0x7f, 0x8a, 0x08, 0x0c, 0x89, 0x5f, 0x5a, 0x5c, 0x65, 0x6d, 0x70, 0x60, 0x5a, 0x5a, 0x59,
+  0x58, 0xe1, 0x01, 0x34, 0xa5, 0x5e, 0x57, 0xcb, 0x01, 0xc1, 0x52, 0x52, 0x53, 0x56, 0x58, 0x61, 0x61, 0x5a, 0x58, 0x56, 0x56, 0x52, 0x01, 0x00,
+  0x01, 0x14, 0x00, 0x00, 0x01, 0x00, 0x00, 0xdc, 0x01, 0x00, 0x01, 0x00, 0x04, 0x09, 0x00, 0x12, 0xa3, 0x18, 0x00, 0x20, 0x54, 0x57, 0xbf, 0x03,
+  0xf1, 0x11, 0x5e, 0x5b, 0x64, 0x5b, 0x57, 0x57, 0x61, 0x64, 0x64, 0x64, 0x5b, 0x57, 0x5b, 0x64, 0x68, 0x6d, 0x64, 0x5b, 0x54, 0x5b, 0x5e, 0x68,
+  0x71, 0x75, 0x75, 0x78, 0x7c, 0x7c, 0x81, 0x7d, 0x7d, 0x81, 0xdd, 0x01, 0x01, 0xde, 0x01, 0x00, 0x02, 0x00, 0xf0, 0x04, 0x81, 0x82, 0x75, 0x6c,
+  0x5f, 0x62, 0x68, 0x6c, 0x67, 0x67, 0x5e, 0x56, 0x53, 0x53, 0x53, 0x58, 0x62, 0x6c, 0x67, 0x9b, 0x03, 0xf0, 0x31, 0x78, 0x79, 0x7d, 0x7d, 0x7c,
+  0x7c, 0x73, 0x73, 0x73, 0x78, 0x75, 0x73, 0x7d, 0x81, 0x85, 0x81, 0x86, 0x79, 0x78, 0x74, 0x73, 0x79, 0x7d, 0x81, 0x86, 0x86, 0x86, 0x8b, 0x86,
+  0x86, 0x86, 0x81, 0x81, 0x86, 0x86, 0x02, 0x89, 0x02, 0x86, 0x81, 0x7d, 0x79, 0x79, 0x79, 0x73, 0x73, 0x79, 0x7f, 0x86, 0x02, 0x89, 0x00, 0x86,
+  0x88, 0x8f, 0x8d, 0x86, 0x00, 0x86, 0x81, 0x88, 0x86, 0x88, 0x8f, 0xdc, 0x01, 0xd0, 0x04, 0x95, 0x95, 0x8f, 0x02, 0x8f, 0x8f, 0x02, 0x87, 0x02,
+  0x87, 0x02, 0x8a, 0xde, 0x01, 0x00, 0xde, 0x03, 0x11, 0x02, 0x02, 0x00, 0x30, 0x8d, 0x02, 0x8a, 0x02, 0x00, 0x20, 0x8d, 0x8f, 0x29, 0x00, 0x50,
+  0x8e, 0x8f, 0x8e, 0x03, 0x8f, 0xd7, 0x01, 0xd0, 0x8d, 0x8d, 0x02, 0x8e, 0x8f, 0x8e, 0x8d, 0x02, 0x8e, 0x3f, 0x37, 0x32, 0x37, 0xe0, 0x01, 0xf1,
+  0x00, 0x3e, 0x32, 0x01, 0x01, 0x88, 0x88, 0x11, 0x37, 0x32, 0x32, 0x97, 0x00, 0x00, 0x88, 0x02, 0x96, 0x03, 0x30, 0x0b, 0x35, 0x3b, 0x1b, 0x05,
+  0x00, 0x51, 0x05, 0x10, 0x25, 0x9d, 0x03, 0xf0, 0x0e, 0x01, 0x2c, 0x3f, 0x44, 0x32, 0x1b, 0x02, 0x8f, 0x3f, 0x44, 0x3f, 0x37, 0x03, 0x88, 0x02,
+  0x07, 0x14, 0x1e, 0x04, 0x04, 0x29, 0x1e, 0x8f, 0x88, 0x00, 0x88, 0x8f, 0x2c, 0x04, 0xbf, 0x03, 0x00, 0x25, 0x00, 0x11, 0x09, 0xe0, 0x01, 0xa0,
+  0x37, 0x37, 0x04, 0x00, 0x8f, 0x37, 0x41, 0x3e, 0x37, 0x0a, 0xdd, 0x01, 0x51, 0x7e, 0x00, 0x02, 0x02, 0x1e, 0x9f, 0x05, 0xf0, 0x0b, 0x3b, 0x3b,
+  0x3b, 0x35, 0x3e, 0x3e, 0x3b, 0x35, 0x3e, 0x35, 0x2c, 0x25, 0x25, 0x2c, 0x97, 0x8b, 0x79, 0x8b, 0x8f, 0x18, 0x25, 0x2c, 0x2c, 0x2c, 0x1e, 0x2c,
+  0x1b, 0x00, 0x00, 0xbc, 0x05, 0x20, 0x39, 0x35, 0x06, 0x00, 0xd0, 0x2c, 0x25, 0x2c, 0x2c, 0x2d, 0x35, 0x39, 0x39, 0x39, 0x39, 0x2d, 0x1f, 0x1f,
+  0x66, 0x02, 0xf0, 0x28, 0x31, 0x2d, 0x2d, 0x2d, 0x1f, 0x27, 0x13, 0x1a, 0x1f, 0x2d, 0x0b, 0x93, 0x1f, 0x27, 0x2d, 0x2d, 0x27, 0x27, 0x27, 0x31,
+  0x1f, 0x0f, 0x27, 0x27, 0x18, 0x09, 0x86, 0x74, 0x6e, 0x62, 0x72, 0x9a, 0x05, 0x05, 0x98, 0x73, 0x71, 0x6d, 0x58, 0x58, 0x58, 0x58, 0xa5, 0xa5,
+  0xa5, 0x59, 0xa5, 0x59, 0xa5, 0xa5, 0x55, 0x55, 0x55, 0x57, 0x57, 0xb7, 0x01, 0x02, 0xcd, 0x01, 0x70, 0x53, 0x56, 0x55, 0x58, 0x55, 0x58, 0x56,
+  0xbe, 0x03, 0x00, 0xdf, 0x01, 0x01, 0x05, 0x00, 0x02, 0x07, 0x00, 0x02, 0x01, 0x00, 0x04, 0x08, 0x00, 0x00, 0xe3, 0x01, 0x70, 0xa3, 0xa2, 0xa3,
+  0x57, 0x5b, 0x68, 0x64, 0x02, 0x00, 0xc0, 0x5b, 0x56, 0xa3, 0x56, 0x57, 0x5e, 0x57, 0x53, 0x53, 0x53, 0x56, 0x64, 0x11, 0x00, 0xb8, 0x68, 0x6d,
+  0x71, 0x75, 0x78, 0x78, 0x78, 0x7d, 0x7d, 0x7d, 0x81, 0xdf, 0x01, 0x20, 0x86, 0x85, 0x07, 0x00, 0x40, 0x81, 0x78, 0x73, 0x71, 0xfe, 0x01, 0x50,
+  0x71, 0x68, 0x67, 0x64, 0x67, 0xbb, 0x05, 0x00, 0x1f, 0x00, 0x01, 0x01, 0x00, 0x00, 0x29, 0x00, 0x20, 0x81, 0x7d, 0x0a, 0x00, 0x10, 0x8b, 0x0d,
+  0x00, 0x20, 0x86, 0x86, 0x76, 0x05, 0x01, 0xa7, 0x01, 0x10, 0x02, 0x8b, 0x05, 0x00, 0x8e, 0x05, 0x30, 0x02, 0x89, 0x86, 0x49, 0x00, 0x02, 0x0f,
+  0x00, 0x00, 0xaa, 0x03, 0x40, 0x86, 0x86, 0x88, 0x86, 0xb6, 0x01, 0xf0, 0x04, 0x04, 0x99, 0x04, 0x99, 0x04, 0x04, 0x03, 0x8e, 0x02, 0x88, 0x88,
+  0x86, 0x88, 0x86, 0x8a, 0x86, 0x88, 0x89, 0x88, 0xc0, 0x03, 0x50, 0x88, 0x8d, 0x8f, 0x02, 0x86, 0xec, 0x01, 0x20, 0x88, 0x8d, 0xf8, 0x01, 0x21,
+  0x8f, 0x8e, 0xe1, 0x03, 0x30, 0x03, 0x8e, 0x03, 0xee, 0x03, 0xc0, 0x94, 0x8d, 0x91, 0x94, 0x94, 0x94, 0x8e, 0x8f, 0x8e, 0x3f, 0x37, 0x25, 0x91,
+  0x01, 0xc0, 0x41, 0x41, 0x37, 0x8f, 0x88, 0x01, 0x00, 0x01, 0x17, 0x20, 0x17, 0x03, 0xe0, 0x01, 0x82, 0x95, 0x03, 0x02, 0x88, 0x01, 0x18, 0x3e,
+  0x3e, 0x4b, 0x07, 0x40, 0x41, 0x37, 0x2c, 0x02, 0xdf, 0x03, 0xf0, 0x0d, 0x1e, 0x3f, 0x3f, 0x3f, 0x32, 0x95, 0x04, 0x44, 0x3f, 0x44, 0x37, 0x03,
+  0x01, 0x95, 0x2c, 0x32, 0x1e, 0x97, 0x0a, 0x1e, 0x25, 0x11, 0x88, 0x94, 0x01, 0x02, 0x25, 0x04, 0xbc, 0x03, 0x00, 0x01, 0x00, 0x00, 0x35, 0x00,
+  0x70, 0x3e, 0x37, 0x35, 0x20, 0x88, 0x00, 0x14, 0xe7, 0x01, 0x80, 0x97, 0x00, 0x7e, 0x7f, 0x00, 0x7e, 0x8d, 0x1e, 0xa0, 0x03, 0x00, 0x7c, 0x07,
+  0xf0, 0x0a, 0x2c, 0x25, 0x2c, 0x3b, 0x3e, 0x3b, 0x37, 0x3b, 0x37, 0x35, 0x37, 0x37, 0x25, 0x2c, 0x17, 0x02, 0x00, 0x86, 0x0b, 0x1e, 0x18, 0x25,
+  0x37, 0x04, 0x1f, 0xdf, 0x01, 0x10, 0x39, 0x93, 0x05, 0x00, 0xb7, 0x03, 0x40, 0x2c, 0x25, 0x99, 0x1e, 0xc2, 0x03, 0x10, 0x2d, 0xb6, 0x03, 0x20,
+  0x18, 0x27, 0x07, 0x00, 0x00, 0x75, 0x07, 0x00, 0xd6, 0x01, 0x40, 0x2d, 0x2d, 0x1f, 0x1f, 0x07, 0x00, 0x00, 0x80, 0x07, 0xf0, 0x08, 0x27, 0x2c,
+  0x27, 0x8f, 0x73, 0x6c, 0x6d, 0x65, 0x60, 0x7b, 0x9a, 0x9a, 0x13, 0x0e, 0x0c, 0x9b, 0x71, 0x56, 0x55, 0x53, 0x55, 0x55, 0x55, 0xbc, 0x03, 0x00,
+  0x01, 0x00, 0x21, 0x55, 0x55, 0x8d, 0x05, 0x01, 0xc9, 0x01, 0x73, 0x54, 0x54, 0x56, 0x56, 0x56, 0x55, 0x56, 0xe0, 0x01, 0x03, 0x01, 0x00, 0x00,
+  0xba, 0x05, 0x00, 0x06, 0x00, 0x01, 0xe8, 0x01, 0x00, 0x08, 0x00, 0x04, 0x01, 0x00, 0x21, 0xa3, 0x54, 0x96, 0x05, 0xf1, 0x06, 0x68, 0x68, 0x68,
+  0x5e, 0x54, 0x52, 0xa3, 0x54, 0x56, 0x56, 0x52, 0xa3, 0xa2, 0x53, 0x5b, 0x5f, 0x64, 0x68, 0x6d, 0x71, 0x71, 0xe0, 0x01, 0x14, 0x7c, 0xbd, 0x03,
+  0x00, 0xdd, 0x01, 0x10, 0x81, 0x99, 0x01, 0x00, 0x02, 0x00, 0x20, 0x80, 0x81, 0xd6, 0x03, 0x00, 0xca, 0x01, 0x60, 0x7d, 0x7d, 0x81, 0x82, 0x86,
+  0x85, 0xce, 0x01, 0x02, 0x02, 0x00, 0xb0, 0x02, 0x86, 0x86, 0x86, 0x89, 0x86, 0x89, 0x02, 0x8b, 0x02, 0x02, 0x74, 0x05, 0x10, 0x8b, 0x40, 0x07,
+  0x40, 0x8f, 0x8f, 0x8f, 0x8e, 0x05, 0x00, 0x21, 0x8f, 0x94, 0x02, 0x00, 0x00, 0xe4, 0x01, 0x00, 0x16, 0x00, 0x00, 0x4f, 0x07, 0x01, 0x01, 0x00,
+  0x10, 0x8f, 0xb3, 0x03, 0x32, 0x95, 0x95, 0x04, 0x01, 0x00, 0x61, 0x95, 0x8f, 0x8d, 0x00, 0x02, 0x88, 0x16, 0x02, 0x20, 0x86, 0x8d, 0xe0, 0x01,
+  0x61, 0x02, 0x8f, 0x03, 0x8f, 0x02, 0x02, 0xac, 0x03, 0x20, 0x88, 0x86, 0xf2, 0x01, 0x00, 0xca, 0x05, 0x00, 0xe3, 0x01, 0x61, 0x94, 0x95, 0x94,
+  0x99, 0x94, 0x8e, 0xa6, 0x05, 0xf1, 0x10, 0x93, 0x95, 0x37, 0x3f, 0x25, 0x37, 0x3e, 0x41, 0x41, 0x3e, 0x41, 0x37, 0x03, 0x88, 0x00, 0x88, 0x00,
+  0x01, 0x14, 0x0a, 0x02, 0x88, 0x02, 0x03, 0x03, 0x1e, 0x04, 0x0c, 0x8e, 0x02, 0x1e, 0xba, 0x05, 0xf0, 0x18, 0x41, 0x44, 0x41, 0x41, 0x41, 0x37,
+  0x95, 0x03, 0x01, 0x01, 0x03, 0x25, 0x3f, 0x3f, 0x29, 0x14, 0x04, 0x11, 0x41, 0x3f, 0x44, 0x32, 0x03, 0x88, 0x04, 0x20, 0x32, 0x07, 0x04, 0x02,
+  0x02, 0x9a, 0x1e, 0x02, 0x02, 0x88, 0x00, 0x25, 0x0a, 0xdc, 0x01, 0x00, 0x01, 0x00, 0x01, 0x2f, 0x02, 0x50, 0x37, 0x2c, 0x03, 0x00, 0x02, 0x9f,
+  0x05, 0x03, 0x5f, 0x09, 0x30, 0x03, 0x2c, 0x37, 0x6d, 0x05, 0x82, 0x35, 0x2c, 0x1f, 0x0e, 0x09, 0x1f, 0x25, 0x2c, 0xe9, 0x01, 0xf0, 0x03, 0x35,
+  0x1e, 0x18, 0x32, 0x11, 0x81, 0x8f, 0x02, 0x09, 0x03, 0x0e, 0x25, 0x18, 0x25, 0x3b, 0x3b, 0x39, 0x3b, 0x88, 0x05, 0x00, 0x2f, 0x04, 0x90, 0x35,
+  0x25, 0x8f, 0x7e, 0x18, 0x2c, 0x27, 0x1f, 0x2d, 0xb7, 0x03, 0x40, 0x0e, 0x01, 0x03, 0x1f, 0xda, 0x01, 0x10, 0x1f, 0xe7, 0x01, 0x00, 0xc9, 0x03,
+  0x00, 0xde, 0x01, 0x20, 0x2d, 0x27, 0xe0, 0x01, 0xf1, 0x09, 0x31, 0x27, 0x1f, 0x00, 0x9b, 0x6e, 0x66, 0x5c, 0x5c, 0x82, 0x74, 0x93, 0x95, 0x8e,
+  0x94, 0x97, 0x7d, 0x58, 0x53, 0x53, 0x53, 0xa4, 0x55, 0xa5, 0xe2, 0x01, 0x10, 0x55, 0xe0, 0x01, 0x13, 0x57, 0xc0, 0x01, 0x00, 0xca, 0x01, 0x42,
+  0x53, 0x56, 0x56, 0x56, 0x7f, 0x07, 0x01, 0xd7, 0x01, 0x01, 0x01, 0x00, 0x10, 0x54, 0x0a, 0x00, 0x00, 0x58, 0x09, 0x02, 0x01, 0x00, 0x20, 0x52,
+  0x52, 0xbc, 0x03, 0x40, 0xa2, 0xa3, 0x54, 0x5b, 0xdf, 0x01, 0x10, 0x6c, 0x79, 0x07, 0xf2, 0x07, 0x5b, 0x53, 0xa3, 0x53, 0x57, 0x57, 0x56, 0x54,
+  0x53, 0xa3, 0x56, 0x57, 0x5f, 0x68, 0x6d, 0x71, 0x6d, 0x6c, 0x6d, 0x73, 0x73, 0x73, 0xc7, 0x01, 0x20, 0x81, 0x80, 0xd6, 0x01, 0x00, 0x02, 0x00,
+  0x02, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x85, 0x09, 0x00, 0x02, 0x01, 0x00, 0x61, 0x8b, 0x86, 0x8b, 0x88, 0x8b, 0x88, 0x47, 0x07, 0x33, 0x86,
+  0x8d, 0x8b, 0x4e, 0x05, 0x00, 0x37, 0x07, 0x00, 0xcc, 0x01, 0x00, 0x01, 0x00, 0x40, 0x8e, 0x8f, 0x8f, 0x93, 0xda, 0x01, 0x00, 0xce, 0x01, 0x00,
+  0xd1, 0x01, 0x10, 0x94, 0x6b, 0x07, 0x00, 0x7f, 0x03, 0x00, 0x47, 0x07, 0x00, 0xab, 0x01, 0x20, 0x03, 0x94, 0xbe, 0x03, 0x01, 0x01, 0x00, 0x31,
+  0x99, 0x95, 0x03, 0x29, 0x00, 0x00, 0x85, 0x07, 0x10, 0x94, 0x1a, 0x00, 0x30, 0x03, 0x95, 0x04, 0xcd, 0x01, 0x30, 0x94, 0x8f, 0x93, 0xc0, 0x03,
+  0x20, 0x8d, 0x8f, 0xa9, 0x05, 0x10, 0x93, 0x36, 0x00, 0x70, 0x93, 0x8f, 0x93, 0x9a, 0x99, 0x94, 0x93, 0xd1, 0x03, 0xf0, 0x10, 0x99, 0x95, 0x37,
+  0x44, 0x3f, 0x41, 0x3f, 0x3e, 0x41, 0x41, 0x3f, 0x3e, 0x0c, 0x00, 0x88, 0x88, 0x88, 0x01, 0x95, 0x1e, 0x14, 0x04, 0x01, 0x8d, 0x32, 0x32, 0x14,
+  0x11, 0x07, 0x03, 0x1e, 0x7a, 0x09, 0x11, 0x44, 0x7e, 0x09, 0xd2, 0x2c, 0x03, 0x93, 0x03, 0x01, 0x04, 0x32, 0x45, 0x3f, 0x3f, 0x07, 0x02, 0x1e,
+  0xa0, 0x05, 0xf0, 0x03, 0x01, 0x03, 0x0e, 0x0a, 0x02, 0x97, 0x03, 0x07, 0x1e, 0x03, 0x01, 0x97, 0x88, 0x20, 0x14, 0x00, 0x00, 0x88, 0x67, 0x07,
+  0x20, 0x01, 0x2c, 0xdf, 0x01, 0x00, 0x5f, 0x0b, 0x10, 0x02, 0xe9, 0x01, 0x91, 0x32, 0x00, 0x00, 0x7e, 0x7f, 0x7f, 0x7e, 0x99, 0x37, 0x75, 0x05,
+  0xb0, 0x2c, 0x18, 0x0a, 0x2c, 0x2c, 0x25, 0x09, 0x35, 0x2c, 0x35, 0x2c, 0x96, 0x05, 0xe0, 0x25, 0x18, 0x2c, 0x97, 0x02, 0x81, 0x94, 0x11, 0x18,
+  0x18, 0x2c, 0x25, 0x39, 0x3b, 0x8c, 0x05, 0x30, 0x35, 0x2d, 0x25, 0xe0, 0x01, 0x90, 0x2c, 0x04, 0x7e, 0x02, 0x25, 0x25, 0x2d, 0x09, 0x1f, 0xff,
+  0x07, 0x40, 0x0e, 0x02, 0x03, 0x13, 0x25, 0x0b, 0x91, 0x0f, 0x2d, 0x31, 0x39, 0x31, 0x31, 0x31, 0x27, 0x25, 0xee, 0x01, 0xf1, 0x0b, 0x27, 0x1f,
+  0x27, 0x27, 0x31, 0x27, 0x27, 0x13, 0x04, 0x9b, 0x89, 0x75, 0x7b, 0x6a, 0x70, 0x77, 0x83, 0x9a, 0x81, 0x8b, 0x7d, 0x82, 0x5f, 0x55, 0x53, 0x53,
+  0xc2, 0x03, 0x01, 0x02, 0x00, 0x22, 0x55, 0x56, 0xe1, 0x01, 0x00, 0xde, 0x01, 0x00, 0x01, 0x00, 0x31, 0x54, 0x54, 0x54, 0x3e, 0x0b, 0x00, 0x0a,
+  0x00, 0x01, 0xda, 0x01, 0x01, 0xd2, 0x01, 0x00, 0x0e, 0x00, 0x10, 0x57, 0x01, 0x00, 0x61, 0x5b, 0x57, 0x5b, 0x57, 0x54, 0x57, 0x17, 0x00, 0x10,
+  0x57, 0x3b, 0x0b, 0x13, 0x6c, 0xe1, 0x01, 0x20, 0x54, 0x57, 0x41, 0x0b, 0xe1, 0x5b, 0x56, 0x54, 0x56, 0x57, 0x5e, 0x67, 0x68, 0x64, 0x5a, 0x64,
+  0x71, 0x73, 0x73, 0x58, 0x09, 0x10, 0x80, 0xbe, 0x03, 0x80, 0x00, 0x81, 0x86, 0x83, 0x86, 0x80, 0x86, 0x83, 0xd1, 0x01, 0x03, 0x06, 0x00, 0x01,
+  0x01, 0x00, 0x40, 0x89, 0x86, 0x8b, 0x88, 0x20, 0x09, 0x10, 0x89, 0xd7, 0x01, 0x01, 0x02, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x66, 0x03, 0x03, 0xe0,
+  0x01, 0x13, 0x8e, 0xba, 0x03, 0x07, 0x01, 0x00, 0x00, 0xd8, 0x01, 0x00, 0xda, 0x01, 0x10, 0x04, 0xe3, 0x01, 0x00, 0xdb, 0x01, 0x50, 0x95, 0x99,
+  0x04, 0x04, 0x05, 0x0e, 0x0b, 0x00, 0x01, 0x00, 0x22, 0x95, 0x04, 0xed, 0x01, 0x00, 0xb0, 0x05, 0x02, 0xd7, 0x03, 0x00, 0x51, 0x09, 0x71, 0x95,
+  0x94, 0x8d, 0x02, 0x01, 0x8d, 0x8f, 0x84, 0x07, 0x40, 0x94, 0x99, 0x05, 0x04, 0x15, 0x02, 0x30, 0x95, 0x95, 0x93, 0x8f, 0x07, 0xf0, 0x11, 0x99,
+  0x95, 0x95, 0x44, 0x45, 0x3f, 0x44, 0x3f, 0x41, 0x44, 0x44, 0x41, 0x41, 0x1e, 0x02, 0x88, 0x01, 0x88, 0x01, 0x88, 0x07, 0x94, 0x03, 0x02, 0x14,
+  0x37, 0x3f, 0x32, 0x14, 0x9a, 0x03, 0x25, 0xbd, 0x03, 0x00, 0xdf, 0x01, 0xf0, 0x04, 0x41, 0x3e, 0x07, 0x03, 0x03, 0x99, 0x03, 0x04, 0x32, 0x3f,
+  0x3f, 0x44, 0x11, 0x02, 0x2c, 0x44, 0x41, 0x3f, 0x37, 0xae, 0x07, 0xd0, 0x03, 0x25, 0x11, 0x09, 0x29, 0x0e, 0x97, 0x02, 0x07, 0x03, 0x02, 0x25,
+  0x1e, 0xbc, 0x03, 0x40, 0x7f, 0x00, 0x00, 0x95, 0xd6, 0x01, 0x40, 0x35, 0x32, 0x01, 0x00, 0x8e, 0x09, 0xa0, 0x37, 0x37, 0x1e, 0x7e, 0x83, 0x7e,
+  0x00, 0x7e, 0x01, 0x1e, 0xbd, 0x03, 0xf1, 0x0e, 0x25, 0x18, 0x18, 0x02, 0x88, 0x25, 0x2c, 0x18, 0x18, 0x3b, 0x25, 0x2c, 0x25, 0x13, 0x1e, 0x09,
+  0x03, 0x18, 0x1e, 0x11, 0x97, 0x86, 0x79, 0x8b, 0x0c, 0x17, 0x95, 0x0e, 0x2c, 0xab, 0x03, 0x40, 0x2d, 0x1e, 0x09, 0x0e, 0x97, 0x05, 0x50, 0x27,
+  0x07, 0x09, 0x25, 0x2c, 0x92, 0x05, 0x80, 0x39, 0x2d, 0x39, 0x27, 0x04, 0x00, 0x05, 0x0e, 0x90, 0x05, 0x12, 0x27, 0xe0, 0x01, 0x30, 0x2d, 0x93,
+  0x06, 0x5e, 0x09, 0x10, 0x27, 0x7d, 0x07, 0xf0, 0x08, 0x31, 0x1a, 0x1f, 0x8d, 0x86, 0x00, 0x98, 0x82, 0x5e, 0x60, 0x82, 0x82, 0x98, 0x82, 0x6c,
+  0x60, 0x76, 0xa6, 0x56, 0x53, 0x55, 0xa4, 0x55, 0x01, 0x00, 0x11, 0xa5, 0x08, 0x00, 0x50, 0x56, 0x53, 0x56, 0x57, 0x54, 0xbf, 0x03, 0x00, 0x45,
+  0x0b, 0x00, 0xc9, 0x01, 0x03, 0x01, 0x00, 0x10, 0x57, 0xe1, 0x01, 0x01, 0xd6, 0x01, 0x60, 0x54, 0x54, 0x52, 0x57, 0x54, 0x57, 0x03, 0x00, 0x11,
+  0x57, 0x36, 0x0b, 0x10, 0x5b, 0x0c, 0x00, 0xf0, 0x02, 0x5b, 0x5b, 0x64, 0x67, 0x68, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6c, 0x6d, 0x68, 0x64, 0x5b,
+  0x5b, 0x5e, 0xaa, 0x05, 0xb0, 0x64, 0x64, 0x56, 0x53, 0x56, 0x64, 0x61, 0x5e, 0x58, 0x67, 0x75, 0x3d, 0x0b, 0x19, 0x80, 0xc0, 0x03, 0x04, 0xc2,
+  0x03, 0x20, 0x86, 0x87, 0xda, 0x01, 0x70, 0x86, 0x86, 0x02, 0x86, 0x89, 0x86, 0x8d, 0x38, 0x09, 0x04, 0x02, 0x00, 0x00, 0xba, 0x03, 0x00, 0x02,
+  0x00, 0x02, 0x84, 0x05, 0x03, 0x01, 0x00, 0x11, 0x8e, 0xe0, 0x01, 0x00, 0x02, 0x00, 0x02, 0xdb, 0x01, 0x05, 0x01, 0x00, 0x00, 0xdc, 0x0c, 0x00,
+  0xc8, 0x01, 0x01, 0x01, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x40, 0x07, 0x05, 0x07, 0x05, 0x03, 0x00, 0x00, 0x11, 0x00,
+  0x10, 0x07, 0xdf, 0x01, 0x60, 0x99, 0x95, 0x95, 0x94, 0x03, 0x8d, 0x4b, 0x09, 0x81, 0x8d, 0x8d, 0x8f, 0x93, 0x94, 0x99, 0x04, 0x05, 0xf4, 0x01,
+  0xf0, 0x00, 0x95, 0x95, 0x04, 0x05, 0x04, 0x99, 0x04, 0x93, 0x95, 0x3f, 0x20, 0x44, 0x3f, 0x3f, 0x44, 0x01, 0x00, 0x10, 0x2c, 0x21, 0x0d, 0xd2,
+  0x01, 0x02, 0x09, 0x07, 0x8f, 0x07, 0x20, 0x20, 0x32, 0x29, 0x1e, 0x29, 0x1e, 0x5a, 0x0b, 0x00, 0xc5, 0x03, 0xf1, 0x02, 0x3e, 0x04, 0x01, 0x03,
+  0x03, 0x01, 0x04, 0x0e, 0x32, 0x3f, 0x3f, 0x11, 0x03, 0x3f, 0x44, 0x44, 0x3f, 0x2d, 0x00, 0xd1, 0x11, 0x2c, 0x0c, 0x88, 0x04, 0x04, 0x03, 0x03,
+  0x0c, 0x0e, 0x20, 0x37, 0x20, 0x55, 0x0d, 0x40, 0x7f, 0x00, 0x09, 0x35, 0xc0, 0x03, 0x40, 0x25, 0x86, 0x00, 0x7e, 0xfe, 0x0e, 0x80, 0x3e, 0x0a,
+  0x00, 0x7e, 0x00, 0x7f, 0x03, 0x25, 0x34, 0x09, 0xf0, 0x10, 0x2c, 0x04, 0x00, 0x7e, 0x97, 0x88, 0x14, 0x25, 0x35, 0x2c, 0x3b, 0x27, 0x1f, 0x13,
+  0x25, 0x1f, 0x09, 0x05, 0x04, 0x0b, 0x0c, 0x81, 0x78, 0x74, 0x73, 0x77, 0x81, 0x81, 0x9b, 0x0b, 0x25, 0x94, 0x03, 0x62, 0x18, 0x03, 0x6e, 0x88,
+  0x18, 0x27, 0x60, 0x07, 0x20, 0x2d, 0x35, 0xb9, 0x0b, 0x20, 0x39, 0x39, 0x8b, 0x05, 0x00, 0x11, 0x00, 0x20, 0x31, 0x27, 0xde, 0x01, 0x40, 0x31,
+  0x31, 0x31, 0x1a, 0x0e, 0x00, 0x50, 0x27, 0x27, 0x0f, 0x99, 0x99, 0xe6, 0x01, 0xf0, 0x00, 0x73, 0x79, 0x08, 0x0c, 0x6a, 0x5c, 0x5a, 0x60, 0x76,
+  0x70, 0x60, 0x58, 0x55, 0x65, 0x61, 0xdb, 0x01, 0x03, 0x01, 0x00, 0x00, 0xe0, 0x01, 0x10, 0xa4, 0xe1, 0x01, 0x01, 0xc3, 0x03, 0x03, 0x01, 0x00,
+  0x00, 0xdd, 0x01, 0x02, 0xe0, 0x01, 0x00, 0xd1, 0x01, 0x01, 0xb3, 0x03, 0x10, 0x5b, 0x09, 0x00, 0x01, 0xf0, 0x01, 0x21, 0x54, 0x54, 0x1a, 0x0d,
+  0x00, 0xdf, 0x01, 0xf0, 0x00, 0x64, 0x68, 0x6c, 0x6d, 0x71, 0x6c, 0x71, 0x71, 0x71, 0x71, 0x6d, 0x6c, 0x64, 0x5f, 0x67, 0x15, 0x0b, 0xa0, 0x68,
+  0x68, 0x68, 0x5f, 0x64, 0x67, 0x5f, 0x5f, 0x67, 0x71, 0x5e, 0x09, 0x02, 0xc0, 0x03, 0x51, 0x7e, 0x81, 0x80, 0x86, 0x7f, 0xb6, 0x03, 0x00, 0x04,
+  0x00, 0x03, 0x01, 0x00, 0x11, 0x02, 0x6e, 0x07, 0x00, 0x09, 0x00, 0x50, 0x89, 0x02, 0x8a, 0x02, 0x02, 0xd6, 0x01, 0x02, 0xbe, 0x03, 0x04, 0xbd,
+  0x03, 0x20, 0x8e, 0x8f, 0xfa, 0x08, 0x00, 0x07, 0x00, 0x00, 0xd9, 0x01, 0x02, 0x01, 0x00, 0x20, 0x93, 0x03, 0x95, 0x01, 0x01, 0xdb, 0x01, 0x12,
+  0x99, 0xdb, 0x01, 0x03, 0xde, 0x01, 0x00, 0xd6, 0x01, 0x30, 0x09, 0x04, 0x05, 0xd9, 0x01, 0xf0, 0x01, 0x07, 0x05, 0x07, 0x08, 0x07, 0x05, 0x09,
+  0x04, 0x08, 0x04, 0x09, 0x04, 0x09, 0x07, 0x05, 0x04, 0xe0, 0x0e, 0x01, 0xeb, 0x03, 0x21, 0x99, 0x94, 0x36, 0x0b, 0x70, 0x94, 0x95, 0x95, 0x99,
+  0x99, 0x04, 0x99, 0xf4, 0x03, 0xe1, 0x04, 0x05, 0x05, 0x05, 0x05, 0x04, 0x99, 0x03, 0x99, 0x20, 0x32, 0x37, 0x3f, 0x3f, 0xa4, 0x03, 0x12, 0x37,
+  0xe2, 0x10, 0xe0, 0x03, 0x20, 0x2c, 0x20, 0x32, 0x29, 0x32, 0x32, 0x32, 0x32, 0x1e, 0x37, 0x3e, 0x41, 0x5d, 0x09, 0x00, 0x1d, 0x00, 0x10, 0x04,
+  0xbf, 0x03, 0x70, 0x95, 0x02, 0x18, 0x3f, 0x3f, 0x32, 0x07, 0xe0, 0x01, 0x30, 0x25, 0x01, 0x01, 0xbf, 0x03, 0x20, 0x1e, 0x07, 0xf5, 0x03, 0x50,
+  0x02, 0x09, 0x29, 0x37, 0x2c, 0xc0, 0x03, 0xf0, 0x0a, 0x00, 0x00, 0x00, 0x13, 0x37, 0x3e, 0x3e, 0x37, 0x3e, 0x20, 0x00, 0x7e, 0x00, 0x18, 0x3e,
+  0x37, 0x3e, 0x37, 0x03, 0x7e, 0x83, 0x7e, 0x95, 0x2c, 0x3e, 0x7b, 0x07, 0xf2, 0x1b, 0x18, 0x7e, 0x7e, 0x79, 0x88, 0x07, 0x04, 0x18, 0x25, 0x2c,
+  0x35, 0x35, 0x2d, 0x2c, 0x27, 0x25, 0x18, 0x18, 0x18, 0x11, 0x7a, 0x73, 0x6a, 0x72, 0x70, 0x72, 0x82, 0x76, 0x73, 0x73, 0x1a, 0x27, 0x26, 0x1f,
+  0x18, 0x00, 0x78, 0x79, 0x0b, 0x25, 0x27, 0x1f, 0xc2, 0x01, 0xf0, 0x07, 0x31, 0x31, 0x39, 0x39, 0x31, 0x39, 0x39, 0x39, 0x31, 0x27, 0x27, 0x27,
+  0x26, 0x1a, 0x26, 0x1a, 0x27, 0x31, 0x31, 0x26, 0x27, 0x26, 0x1a, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x09, 0x26, 0x27, 0x27, 0x1a, 0x27, 0x27, 0x27,
+  0x13, 0x86, 0x7f, 0x13, 0x14, 0x6f, 0x5c, 0x60, 0x76, 0x5c, 0x58, 0xa5, 0xa5, 0x59, 0x58, 0xa5, 0x58, 0x98, 0x05, 0x00, 0x01, 0x00, 0x00, 0xa7,
+  0x05, 0x71, 0x55, 0x55, 0x55, 0x58, 0x55, 0x56, 0x5b, 0xd4, 0x10, 0x06, 0x8c, 0x05, 0x03, 0xdc, 0x01, 0x03, 0xb0, 0x03, 0x02, 0x01, 0x00, 0x00,
+  0x04, 0x02, 0x30, 0xa3, 0x52, 0xa3, 0xbb, 0x03, 0x01, 0xdb, 0x10, 0x60, 0x68, 0x68, 0x6c, 0x6d, 0x6c, 0x71, 0xe3, 0x01, 0x10, 0x6e, 0x72, 0x07,
+  0x22, 0x71, 0x71, 0xed, 0x01, 0x40, 0x71, 0x67, 0x5f, 0x67, 0xbf, 0x03, 0x30, 0x7e, 0x7d, 0x7f, 0x9e, 0x05, 0x30, 0x7e, 0x7d, 0x83, 0xbb, 0x03,
+  0x05, 0xbd, 0x03, 0x08, 0x01, 0x00, 0x01, 0x15, 0x00, 0x40, 0x02, 0x86, 0x02, 0x87, 0xdd, 0x01, 0x03, 0x02, 0x00, 0x00, 0xde, 0x01, 0x10, 0x8d,
+  0x98, 0x05, 0x03, 0x01, 0x00, 0x10, 0x93, 0xda, 0x01, 0x01, 0x01, 0x00, 0x00, 0xda, 0x01, 0x00, 0xae, 0x01, 0x00, 0x9d, 0x01, 0x00, 0x02, 0x00,
+  0x05, 0x82, 0x05, 0xf0, 0x04, 0x04, 0x04, 0x04, 0x08, 0x07, 0x05, 0x04, 0x08, 0x04, 0x08, 0x05, 0x09, 0x05, 0x09, 0x08, 0x09, 0x09, 0x09, 0x07,
+  0x05, 0x00, 0x00, 0xf2, 0x01, 0x01, 0x29, 0x00, 0x01, 0xcc, 0x01, 0x22, 0x04, 0x99, 0xfd, 0x03, 0x00, 0x0f, 0x00, 0x01, 0x11, 0x00, 0x41, 0x09,
+  0x05, 0x09, 0x05, 0xe3, 0x10, 0x60, 0x99, 0x32, 0x20, 0x18, 0x1e, 0x41, 0xc1, 0x03, 0x03, 0xc2, 0x12, 0xe1, 0x8e, 0x18, 0x2c, 0x29, 0x32, 0x20,
+  0x25, 0x1e, 0x29, 0x25, 0x29, 0x32, 0x37, 0x3e, 0xe1, 0x01, 0x00, 0xa0, 0x05, 0x70, 0x04, 0x01, 0x8e, 0x03, 0x05, 0x03, 0x04, 0x7b, 0x07, 0xf0,
+  0x09, 0x41, 0x3f, 0x44, 0x3f, 0x3e, 0x17, 0x01, 0x88, 0x01, 0x01, 0x0e, 0x0e, 0x1e, 0x25, 0x0b, 0x8f, 0x03, 0x8f, 0x01, 0x01, 0x04, 0x25, 0x2c,
+  0x02, 0x32, 0x0f, 0x80, 0x00, 0x88, 0x25, 0x37, 0x3b, 0x3e, 0x35, 0x37, 0xfe, 0x10, 0x10, 0x25, 0x05, 0x0f, 0x50, 0x88, 0x7e, 0x00, 0x00, 0x25,
+  0xdf, 0x01, 0xf1, 0x19, 0x35, 0x25, 0x01, 0x7e, 0x7e, 0x8d, 0x86, 0x0e, 0x07, 0x0b, 0x3b, 0x35, 0x35, 0x39, 0x2d, 0x1f, 0x18, 0x99, 0x97, 0x05,
+  0x0a, 0x0a, 0x85, 0x8c, 0x69, 0x69, 0x5d, 0x5c, 0x5d, 0x60, 0x77, 0x02, 0x1f, 0x27, 0x26, 0x1f, 0x04, 0x6c, 0x6e, 0x9b, 0xc8, 0x03, 0x10, 0x2d,
+  0xc9, 0x01, 0x40, 0x31, 0x27, 0x31, 0x2d, 0x21, 0x0d, 0x10, 0x35, 0x0d, 0x00, 0x12, 0x1a, 0x01, 0x00, 0x40, 0x0f, 0x0f, 0x0f, 0x1a, 0x02, 0x00,
+  0xf0, 0x04, 0x1a, 0x1a, 0x1a, 0x26, 0x1f, 0x27, 0x1f, 0x0b, 0x09, 0x8d, 0x09, 0x05, 0x0b, 0x11, 0x75, 0x6d, 0x82, 0x90, 0x5c, 0xde, 0x01, 0x03,
+  0x56, 0x09, 0x34, 0xa4, 0x55, 0xa4, 0xdf, 0x01, 0x01, 0xe2, 0x01, 0x20, 0x5e, 0x5b, 0x3a, 0x0b, 0x00, 0x5c, 0x09, 0x02, 0xbb, 0x03, 0x60, 0x56,
+  0x57, 0x58, 0x57, 0x58, 0x5b, 0x02, 0x00, 0x21, 0x5b, 0x5e, 0x02, 0x00, 0x01, 0x96, 0x05, 0x01, 0xa7, 0x07, 0x01, 0xbc, 0x03, 0x40, 0x67, 0x68,
+  0x68, 0x67, 0xd5, 0x01, 0x10, 0x6e, 0xd2, 0x01, 0x00, 0x01, 0x00, 0x10, 0x75, 0x02, 0x00, 0xf0, 0x00, 0x73, 0x75, 0x73, 0x78, 0x71, 0x71, 0x6c,
+  0x6c, 0x73, 0x75, 0x79, 0x7d, 0x7c, 0x7e, 0x7d, 0xbf, 0x03, 0x00, 0x81, 0x07, 0x10, 0x83, 0xbb, 0x03, 0x10, 0x00, 0xcd, 0x01, 0x08, 0x01, 0x00,
+  0x92, 0x81, 0x7d, 0x79, 0x7c, 0x80, 0x85, 0x00, 0x89, 0x88, 0x7f, 0x07, 0x00, 0xa3, 0x0e, 0x03, 0xde, 0x01, 0x00, 0x9e, 0x05, 0x00, 0xbc, 0x03,
+  0x11, 0x93, 0x5b, 0x09, 0x20, 0x93, 0x03, 0xbc, 0x03, 0x40, 0x94, 0x94, 0x95, 0x03, 0xdc, 0x01, 0x00, 0x96, 0x05, 0x00, 0x02, 0x00, 0x00, 0xa4,
+  0x01, 0x00, 0x5e, 0x07, 0x00, 0x05, 0x00, 0x03, 0x8c, 0x05, 0x50, 0x08, 0x07, 0x09, 0x04, 0x08, 0x06, 0x00, 0x01, 0xde, 0x01, 0x01, 0x01, 0x00,
+  0x20, 0x05, 0x09, 0xdc, 0x03, 0x00, 0xdb, 0x03, 0x10, 0x09, 0xae, 0x03, 0x00, 0x28, 0x00, 0xb0, 0x08, 0x04, 0x08, 0x04, 0x05, 0x08, 0x05, 0x09,
+  0x08, 0x07, 0x08, 0xbd, 0x05, 0x60, 0x93, 0x03, 0x95, 0x32, 0x0c, 0x02, 0x71, 0x05, 0x50, 0x44, 0x41, 0x44, 0x37, 0x04, 0xe0, 0x01, 0xa0, 0x01,
+  0x03, 0x11, 0x18, 0x29, 0x0e, 0x07, 0x14, 0x1e, 0x07, 0x88, 0x12, 0x00, 0xdf, 0x01, 0x00, 0xa5, 0x05, 0x20, 0x3f, 0x0b, 0x1a, 0x00, 0xd0, 0x03,
+  0x20, 0x1e, 0x37, 0x3f, 0x3f, 0x3f, 0x41, 0x44, 0x3f, 0x3f, 0x0e, 0x01, 0xe1, 0x01, 0x50, 0x01, 0x03, 0x09, 0x95, 0x01, 0x97, 0x09, 0x40, 0x00,
+  0x18, 0x32, 0x01, 0x7e, 0x07, 0xf0, 0x01, 0x00, 0x04, 0x37, 0x3b, 0x3e, 0x37, 0x3e, 0x2c, 0x03, 0x00, 0x00, 0x01, 0x37, 0x3b, 0x3e, 0x3e, 0x37,
+  0x0f, 0x00, 0xb0, 0x14, 0xf0, 0x1b, 0x35, 0x35, 0x2c, 0x03, 0x04, 0x94, 0x00, 0x7e, 0x8f, 0x0e, 0x2c, 0x3e, 0x37, 0x3b, 0x2c, 0x35, 0x2d, 0x18,
+  0x04, 0x73, 0x6c, 0x94, 0x0a, 0x7f, 0x66, 0x69, 0x5c, 0x59, 0xa5, 0xa5, 0x59, 0x5c, 0x82, 0x97, 0x1a, 0x1a, 0x26, 0x18, 0x91, 0x66, 0x6c, 0x94,
+  0xbb, 0x03, 0x10, 0x2d, 0x87, 0x05, 0x60, 0x31, 0x31, 0x27, 0x1f, 0x27, 0x31, 0x74, 0x07, 0x20, 0x2d, 0x27, 0xdf, 0x01, 0x01, 0xd5, 0x01, 0x40,
+  0x0f, 0x06, 0x06, 0x0f, 0x01, 0x00, 0x20, 0x1a, 0x0f, 0x0f, 0x00, 0xf1, 0x00, 0x13, 0x79, 0x7e, 0x87, 0x0a, 0x05, 0x8f, 0x86, 0x76, 0x6d, 0x6a,
+  0x76, 0x5c, 0x59, 0x55, 0xf6, 0x0e, 0x00, 0x16, 0x0d, 0x02, 0xdd, 0x01, 0x01, 0x05, 0x00, 0x40, 0xa5, 0x58, 0xa5, 0x56, 0x15, 0x0f, 0x01, 0xe1,
+  0x01, 0x10, 0x56, 0x60, 0x09, 0x71, 0x56, 0x57, 0x56, 0x57, 0x58, 0x5b, 0x5a, 0x02, 0x00, 0x11, 0x5e, 0x01, 0x00, 0x32, 0x61, 0x5b, 0x64, 0xc3,
+  0x03, 0x00, 0xd2, 0x03, 0x11, 0x64, 0xdf, 0x01, 0x13, 0x6c, 0xbf, 0x03, 0x00, 0xe2, 0x01, 0x10, 0x73, 0x02, 0x00, 0x00, 0xdd, 0x01, 0x00, 0x18,
+  0x0d, 0x10, 0x75, 0x06, 0x00, 0x70, 0x7c, 0x7c, 0x7e, 0x7c, 0x7f, 0x7d, 0x7f, 0x81, 0x07, 0x12, 0x83, 0x22, 0x0d, 0x0b, 0x01, 0x00, 0xc0, 0x83,
+  0x81, 0x83, 0x7c, 0x79, 0x7d, 0x79, 0x79, 0x7d, 0x83, 0x02, 0x86, 0xdd, 0x01, 0x00, 0xe3, 0x01, 0x03, 0x9d, 0x05, 0x01, 0x9f, 0x05, 0x41, 0x8f,
+  0x8f, 0x8f, 0x91, 0x0d, 0x0b, 0x60, 0x94, 0x03, 0x94, 0x93, 0x03, 0x93, 0x14, 0x0b, 0x10, 0x93, 0xdf, 0x01, 0x00, 0xe4, 0x01, 0x02, 0x82, 0x03,
+  0x03, 0x04, 0x00, 0x00, 0xb4, 0x01, 0x00, 0xb6, 0x01, 0x90, 0x09, 0x05, 0x05, 0x08, 0x08, 0x09, 0x07, 0x09, 0x09, 0x05, 0x00, 0x10, 0x07, 0xdd,
+  0x01, 0x03, 0x06, 0x00, 0x00, 0x01, 0x00, 0x03, 0xf2, 0x01, 0x02, 0x07, 0x00, 0x80, 0x05, 0x09, 0x05, 0x07, 0x08, 0x05, 0x09, 0x09, 0xe0, 0x01,
+  0x00, 0x02, 0x00, 0x31, 0x45, 0x17, 0x03, 0x95, 0x03, 0x40, 0x44, 0x41, 0x3f, 0x0a, 0xdf, 0x01, 0xc0, 0x01, 0x01, 0x01, 0x09, 0x0c, 0x11, 0x03,
+  0x11, 0x0b, 0x11, 0x37, 0x3f, 0xdc, 0x01, 0x00, 0x04, 0x00, 0xf1, 0x03, 0x44, 0x41, 0x3e, 0x09, 0x02, 0x01, 0x03, 0x11, 0x04, 0x20, 0x2c, 0x32,
+  0x37, 0x3f, 0x37, 0x44, 0x44, 0x3e, 0xbf, 0x12, 0x02, 0x03, 0x00, 0x00, 0xde, 0x01, 0x32, 0x88, 0x00, 0x04, 0xc0, 0x03, 0x10, 0x03, 0x5e, 0x09,
+  0x70, 0x3b, 0x37, 0x2c, 0x88, 0x00, 0x7e, 0x04, 0x89, 0x07, 0x50, 0x25, 0x00, 0x88, 0x18, 0x37, 0xbf, 0x03, 0xf0, 0x0c, 0x2d, 0x25, 0x03, 0x95,
+  0x04, 0x00, 0x14, 0x18, 0x2c, 0x2c, 0x37, 0x3e, 0x2c, 0x0e, 0x1e, 0x25, 0x09, 0x04, 0x05, 0x01, 0x18, 0x95, 0x6c, 0x62, 0x5a, 0x59, 0x59, 0xe1,
+  0x01, 0x91, 0x60, 0x79, 0x13, 0x26, 0x1a, 0x1f, 0x86, 0x74, 0x87, 0x7e, 0x07, 0xa0, 0x2d, 0x2d, 0x39, 0x39, 0x31, 0x31, 0x27, 0x0f, 0x8e, 0x13,
+  0xe1, 0x01, 0x40, 0x2d, 0x1a, 0x1f, 0x1f, 0xb9, 0x03, 0x01, 0x01, 0x00, 0x20, 0x06, 0x0f, 0xe1, 0x01, 0x00, 0xea, 0x01, 0xf0, 0x00, 0x08, 0x1a,
+  0x1f, 0x0f, 0x7e, 0x62, 0x7e, 0x89, 0x86, 0x6c, 0x62, 0x5e, 0x69, 0x65, 0x61, 0xb9, 0x03, 0x00, 0xde, 0x01, 0x00, 0x08, 0x00, 0x00, 0x7a, 0x07,
+  0x09, 0x01, 0x00, 0x10, 0x58, 0x02, 0x00, 0x10, 0x56, 0x02, 0x00, 0x00, 0xba, 0x03, 0x03, 0xdf, 0x01, 0x10, 0x5c, 0xdc, 0x01, 0x60, 0x5e, 0x5e,
+  0x5b, 0x61, 0x5e, 0x61, 0x20, 0x0b, 0x12, 0x64, 0x98, 0x05, 0x00, 0x18, 0x0d, 0x03, 0xdf, 0x01, 0x00, 0x9c, 0x05, 0x00, 0x01, 0x00, 0x02, 0xe1,
+  0x01, 0x00, 0x81, 0x12, 0x81, 0x74, 0x78, 0x78, 0x78, 0x78, 0x79, 0x7d, 0x79, 0x80, 0x07, 0x11, 0x7d, 0xc0, 0x03, 0x10, 0x81, 0xc0, 0x03, 0x1d,
+  0x80, 0xc0, 0x03, 0x01, 0x0d, 0x0f, 0x40, 0x80, 0x7e, 0x81, 0x86, 0xe1, 0x01, 0x00, 0x5c, 0x09, 0x00, 0x01, 0x00, 0x01, 0xdf, 0x01, 0x00, 0xde,
+  0x01, 0x14, 0x94, 0xc2, 0x03, 0x11, 0x94, 0xc0, 0x03, 0x02, 0x34, 0x0b, 0x01, 0x8f, 0x01, 0x00, 0x96, 0x01, 0x01, 0xda, 0x01, 0x03, 0x01, 0x00,
+  0x00, 0xdd, 0x01, 0x00, 0x8d, 0x03, 0x52, 0x09, 0x05, 0x05, 0x09, 0x05, 0xc2, 0x01, 0x0f, 0x01, 0x00, 0x02, 0x11, 0x0b, 0x03, 0x00, 0x01, 0x04,
+  0x00, 0x01, 0xe9, 0x01, 0x30, 0x05, 0x09, 0x05, 0x29, 0x02, 0x60, 0x95, 0x99, 0x45, 0x32, 0x04, 0x25, 0x73, 0x05, 0xf0, 0x05, 0x41, 0x44, 0x3f,
+  0x14, 0x02, 0x01, 0x8e, 0x01, 0x01, 0x8e, 0x01, 0x02, 0x03, 0x37, 0x3f, 0x0e, 0x03, 0x04, 0x18, 0x41, 0xdb, 0x01, 0x00, 0xbe, 0x03, 0xf1, 0x03,
+  0x41, 0x41, 0x3f, 0x04, 0x03, 0x01, 0x1e, 0x37, 0x32, 0x0c, 0x03, 0x14, 0x2c, 0x29, 0x41, 0x3f, 0x41, 0x32, 0xac, 0x07, 0x01, 0x6f, 0x0b, 0x02,
+  0x01, 0x00, 0x80, 0x00, 0x09, 0x32, 0x02, 0x00, 0x00, 0x88, 0x03, 0x9e, 0x03, 0x30, 0x3e, 0x3e, 0x3e, 0x4d, 0x0b, 0x10, 0x04, 0x1c, 0x11, 0x40,
+  0x25, 0x03, 0x25, 0x3e, 0x3b, 0x0b, 0xf0, 0x1b, 0x2c, 0x1f, 0x04, 0x18, 0x0e, 0x32, 0x1e, 0x25, 0x25, 0x25, 0x35, 0x3e, 0x3e, 0x04, 0x00, 0x03,
+  0x0a, 0x04, 0x02, 0x1f, 0x25, 0x1f, 0x97, 0x8c, 0x7b, 0x5c, 0x59, 0x65, 0x59, 0x5a, 0x59, 0x5c, 0x60, 0x91, 0x1f, 0x1a, 0x27, 0x27, 0x7e, 0x86,
+  0x04, 0x13, 0x2d, 0x18, 0x10, 0x2d, 0xb6, 0x03, 0x50, 0x27, 0x1a, 0x04, 0x06, 0x13, 0xcc, 0x03, 0x41, 0x2d, 0x0f, 0x03, 0x01, 0xd2, 0x01, 0x03,
+  0x01, 0x00, 0x50, 0x1a, 0x1a, 0x1f, 0x26, 0x2d, 0x95, 0x07, 0xd1, 0x1f, 0x1f, 0x18, 0x9a, 0x8c, 0x86, 0x73, 0x67, 0x5e, 0x5c, 0x58, 0x59, 0x5c,
+  0x79, 0x07, 0x01, 0x02, 0x00, 0x10, 0x58, 0xc2, 0x03, 0x04, 0x01, 0x00, 0x12, 0x58, 0x05, 0x00, 0x01, 0x02, 0x00, 0x11, 0x58, 0xca, 0x03, 0x90,
+  0x58, 0x58, 0x5b, 0x58, 0x58, 0x5b, 0x5a, 0x5e, 0x5a, 0xdd, 0x01, 0x00, 0xbe, 0x03, 0x00, 0xdf, 0x01, 0x30, 0x5f, 0x64, 0x5f, 0xe3, 0x01, 0x00,
+  0x66, 0x16, 0x20, 0x67, 0x68, 0xc0, 0x03, 0x11, 0x6d, 0x02, 0x00, 0x10, 0x71, 0x02, 0x00, 0x04, 0xde, 0x01, 0x00, 0xdf, 0x01, 0x00, 0x02, 0x00,
+  0xa0, 0x78, 0x79, 0x7c, 0x79, 0x7d, 0x7a, 0x7d, 0x7f, 0x7d, 0x7e, 0xde, 0x01, 0x00, 0xc5, 0x03, 0x00, 0xd0, 0x01, 0x00, 0xe7, 0x01, 0x01, 0x64,
+  0x09, 0x10, 0x88, 0x05, 0x00, 0x20, 0x86, 0x89, 0x49, 0x0b, 0x00, 0xbd, 0x05, 0x01, 0xdf, 0x01, 0x00, 0x04, 0x00, 0x01, 0xdb, 0x01, 0x14, 0x8e,
+  0xc0, 0x03, 0x00, 0xcf, 0x10, 0x01, 0xbf, 0x03, 0x03, 0xc0, 0x03, 0x24, 0x95, 0x94, 0xbf, 0x03, 0x00, 0x97, 0x01, 0x02, 0x02, 0x00, 0x01, 0xbc,
+  0x03, 0x01, 0xe1, 0x01, 0x00, 0x02, 0x00, 0x14, 0x05, 0x7a, 0x07, 0x08, 0x01, 0x00, 0x01, 0xd7, 0x01, 0x12, 0x0b, 0x01, 0x00, 0x03, 0x0a, 0x00,
+  0x20, 0x09, 0x0b, 0xe5, 0x01, 0x10, 0x08, 0xaf, 0x05, 0xa0, 0x05, 0x04, 0x05, 0x95, 0x44, 0x43, 0x18, 0x20, 0x37, 0x37, 0x08, 0x0d, 0x40, 0x44,
+  0x20, 0x04, 0x03, 0xe1, 0x01, 0xa0, 0x01, 0x03, 0x8f, 0x37, 0x37, 0x11, 0x0a, 0x18, 0x32, 0x41, 0xd6, 0x03, 0x01, 0x40, 0x0b, 0xf9, 0x04, 0x41,
+  0x41, 0x25, 0x07, 0x14, 0x95, 0x0e, 0x07, 0x1e, 0x07, 0x1e, 0x32, 0x2c, 0x3f, 0x3e, 0x3f, 0x37, 0x37, 0x02, 0xdf, 0x01, 0x80, 0x88, 0x88, 0x0e,
+  0x37, 0x02, 0x01, 0x00, 0x03, 0xfc, 0x0e, 0x00, 0xc0, 0x03, 0x10, 0x09, 0x69, 0x09, 0x00, 0x0b, 0x00, 0x30, 0x2c, 0x35, 0x35, 0xbe, 0x03, 0xf0,
+  0x14, 0x25, 0x18, 0x18, 0x2c, 0x37, 0x37, 0x35, 0x37, 0x25, 0x2c, 0x35, 0x37, 0x3e, 0x3e, 0x03, 0x7e, 0x86, 0x1e, 0x8f, 0x02, 0x25, 0x2d, 0x25,
+  0x14, 0x8c, 0x8c, 0x72, 0x60, 0x65, 0x85, 0x70, 0x6a, 0x60, 0x6c, 0x0c, 0x31, 0x09, 0x40, 0x99, 0x14, 0x13, 0x2d, 0x2b, 0x1a, 0x01, 0x01, 0x00,
+  0x20, 0x13, 0x1a, 0xf6, 0x0e, 0x01, 0xb5, 0x12, 0x52, 0x1a, 0x08, 0x0f, 0x27, 0x27, 0x93, 0x05, 0x10, 0x1a, 0x8d, 0x07, 0x40, 0x26, 0x27, 0x31,
+  0x31, 0x55, 0x0b, 0xe2, 0x1f, 0x1f, 0x0c, 0x98, 0x79, 0x67, 0x62, 0x70, 0x5c, 0x5a, 0x5c, 0x70, 0x65, 0x5a, 0x8e, 0x05, 0x30, 0x60, 0x5c, 0x5c,
+  0xe5, 0x01, 0x00, 0x87, 0x07, 0x04, 0x01, 0x00, 0x01, 0x99, 0x14, 0x00, 0x02, 0x00, 0x04, 0x01, 0x00, 0x00, 0xbe, 0x03, 0x00, 0x02, 0x00, 0x11,
+  0x5e, 0xa1, 0x05, 0x10, 0x64, 0xe1, 0x01, 0x20, 0x61, 0x64, 0x66, 0x16, 0x00, 0xc0, 0x03, 0x00, 0xe0, 0x01, 0x00, 0x1d, 0x0d, 0x00, 0xdb, 0x01,
+  0x75, 0x6c, 0x71, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e, 0xe2, 0x01, 0x20, 0x73, 0x74, 0x05, 0x00, 0x30, 0x75, 0x79, 0x7c, 0x02, 0x00, 0x12, 0x7d, 0x24,
+  0x0d, 0x00, 0x3f, 0x0b, 0x31, 0x80, 0x00, 0x83, 0xa5, 0x05, 0x01, 0xe1, 0x01, 0x01, 0x01, 0x00, 0x01, 0x44, 0x0b, 0x10, 0x87, 0x09, 0x00, 0x13,
+  0x87, 0x9c, 0x05, 0x01, 0xe2, 0x01, 0x01, 0xe3, 0x01, 0x10, 0x94, 0xba, 0x03, 0x10, 0x8f, 0x80, 0x10, 0x03, 0xc0, 0x03, 0x00, 0xdf, 0x01, 0x00,
+  0xc1, 0x03, 0x20, 0x95, 0x99, 0xc1, 0x03, 0x00, 0xdb, 0x01, 0x00, 0x02, 0x00, 0x02, 0xc7, 0x03, 0x31, 0x05, 0x05, 0x05, 0x2f, 0x0b, 0x12, 0x04,
+  0x5e, 0x09, 0x10, 0x05, 0xd6, 0x01, 0x01, 0x01, 0x00, 0x00, 0xc6, 0x01, 0x00, 0xd3, 0x01, 0x23, 0x09, 0x0e, 0xd6, 0x01, 0x03, 0x01, 0x00, 0x00,
+  0x17, 0x00, 0x02, 0xc1, 0x03, 0xb0, 0x08, 0x04, 0x05, 0x99, 0x99, 0x3f, 0x20, 0x03, 0x03, 0x1e, 0x37, 0x04, 0x0d, 0xf0, 0x03, 0x3f, 0x3f, 0x37,
+  0x0a, 0x03, 0x01, 0x03, 0x08, 0x11, 0x18, 0x14, 0x18, 0x32, 0x37, 0x1e, 0x18, 0x2c, 0x37, 0x96, 0x07, 0x03, 0xe0, 0x01, 0xb0, 0x37, 0x25, 0x1e,
+  0x04, 0x02, 0x03, 0x1e, 0x37, 0x32, 0x3f, 0x32, 0x12, 0x11, 0x00, 0xaf, 0x14, 0x00, 0x3f, 0x1a, 0x00, 0x06, 0x00, 0x01, 0xa0, 0x05, 0x60, 0x0b,
+  0x32, 0x03, 0x00, 0x04, 0x2c, 0xce, 0x05, 0x00, 0x7e, 0x14, 0x50, 0x03, 0x00, 0x7e, 0x88, 0x25, 0x0a, 0x00, 0x00, 0x02, 0x00, 0x50, 0x3b, 0x35,
+  0x25, 0x04, 0x04, 0x33, 0x1a, 0x10, 0x1e, 0x3b, 0x0b, 0xf0, 0x08, 0x37, 0x3b, 0x37, 0x2c, 0x07, 0x07, 0x0a, 0x7e, 0x0e, 0x09, 0x2c, 0x25, 0x88,
+  0x79, 0x8f, 0x8c, 0x6f, 0x7b, 0x98, 0x8c, 0x85, 0x6e, 0x7e, 0xb4, 0x03, 0x00, 0x13, 0x0d, 0x12, 0x35, 0xe0, 0x01, 0x20, 0x27, 0x27, 0x44, 0x0b,
+  0x10, 0x35, 0xbe, 0x03, 0x00, 0x2d, 0x0b, 0x01, 0x4e, 0x0b, 0x40, 0x26, 0x26, 0x27, 0x26, 0x97, 0x07, 0x30, 0x31, 0x31, 0x2d, 0xdf, 0x01, 0xf0,
+  0x02, 0x0f, 0x13, 0x27, 0x18, 0x03, 0x7e, 0x6e, 0x85, 0x8c, 0x6d, 0x85, 0xa6, 0x5c, 0x60, 0x82, 0x70, 0x5a, 0xc3, 0x01, 0x50, 0x5c, 0x5a, 0x62,
+  0x76, 0x65, 0xc2, 0x03, 0x03, 0x02, 0x00, 0x11, 0x58, 0x03, 0x0f, 0x33, 0x55, 0x56, 0x55, 0xbb, 0x03, 0x02, 0x01, 0x00, 0x12, 0x5b, 0xa1, 0x05,
+  0x00, 0x1b, 0x0d, 0x00, 0xe3, 0x01, 0x07, 0xc0, 0x03, 0x30, 0x67, 0x64, 0x67, 0x06, 0x00, 0x22, 0x67, 0x6d, 0xa3, 0x05, 0x20, 0x6d, 0x6e, 0xe1,
+  0x01, 0x00, 0xa3, 0x05, 0x00, 0x01, 0x00, 0x30, 0x75, 0x74, 0x75, 0x07, 0x00, 0x00, 0x32, 0x18, 0x50, 0x7c, 0x79, 0x78, 0x79, 0x79, 0x19, 0x1c,
+  0x21, 0x80, 0x7d, 0x67, 0x09, 0x00, 0xbc, 0x03, 0x00, 0xe9, 0x01, 0x00, 0xe1, 0x01, 0x30, 0x00, 0x86, 0x87, 0x8b, 0x14, 0x20, 0x86, 0x88, 0xe5,
+  0x01, 0x10, 0x87, 0x20, 0x0d, 0x02, 0x01, 0x00, 0x01, 0xc1, 0x03, 0x00, 0x01, 0x00, 0x02, 0x06, 0x00, 0x22, 0x93, 0x8f, 0xdd, 0x01, 0x02, 0xbe,
+  0x03, 0x10, 0x95, 0x6c, 0x12, 0x00, 0xbe, 0x03, 0x21, 0x99, 0x04, 0xe5, 0x01, 0x00, 0xdc, 0x01, 0x00, 0xbd, 0x03, 0x00, 0x84, 0x03, 0x00, 0x80,
+  0x07, 0x10, 0x04, 0xb4, 0x01, 0x02, 0x7b, 0x05, 0x06, 0x01, 0x00, 0x00, 0xd6, 0x01, 0x02, 0xd9, 0x01, 0x02, 0xe5, 0x01, 0x00, 0x01, 0x00, 0x00,
+  0x18, 0x00, 0xc0, 0x09, 0x09, 0x09, 0x08, 0x09, 0x09, 0x09, 0x07, 0x08, 0x05, 0x04, 0x99, 0xf2, 0x2a, 0x20, 0x37, 0x14, 0x03, 0x02, 0x25, 0x41,
+  0x41, 0x44, 0x44, 0x44, 0x3f, 0x11, 0x20, 0x18, 0x18, 0x0e, 0x2c, 0x25, 0x32, 0x32, 0x1e, 0x3f, 0x3f, 0x2c, 0x32, 0x37, 0x44, 0x44, 0x44, 0x41,
+  0x44, 0x44, 0x41, 0x41, 0x41, 0x44, 0x41, 0x41, 0x2c, 0x04, 0x0b, 0x03, 0x01, 0x14, 0x32, 0x32, 0x32, 0x41, 0x3f, 0x44, 0x44, 0x41, 0x3f, 0x25,
+  0x01, 0x88, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0xf0, 0x04, 0x09, 0x37, 0x25, 0x25, 0x3e, 0x41, 0x3e, 0x3e, 0x3e, 0x3b, 0x41, 0x41,
+  0x3b, 0x37, 0x01, 0x00, 0x00, 0x88, 0x35, 0x0d, 0x00, 0xf0, 0x26, 0x3e, 0x3b, 0x3b, 0x3b, 0x35, 0x2c, 0x09, 0x00, 0x18, 0x25, 0x04, 0x02, 0x88,
+  0x18, 0x95, 0x09, 0x2c, 0x2c, 0x18, 0x35, 0x37, 0x2c, 0x07, 0x07, 0x14, 0x03, 0x2c, 0x03, 0x2c, 0x09, 0x00, 0x81, 0x11, 0x8f, 0x7d, 0x89, 0x9d,
+  0x92, 0x72, 0x73, 0x95, 0x35, 0x2d, 0x39, 0x2d, 0x2d, 0x35, 0x39, 0x3b, 0x2d, 0x39, 0x35, 0x2d, 0x0b, 0x00, 0x50, 0x2d, 0x1f, 0x27, 0x2d, 0x2d,
+  0x0a, 0x00, 0x81, 0x39, 0x31, 0x31, 0x2d, 0x27, 0x27, 0x2d, 0x31, 0x01, 0x00, 0x11, 0x39, 0x02, 0x00, 0xf2, 0x13, 0x31, 0x27, 0x2d, 0x27, 0x2d,
+  0x0f, 0x03, 0x1a, 0x08, 0x8d, 0x02, 0x7e, 0x86, 0x8c, 0x62, 0x63, 0x76, 0x69, 0x66, 0x72, 0x8c, 0x89, 0x81, 0x6c, 0x6e, 0x6d, 0x5a, 0x69, 0x71,
+  0x85, 0x8c, 0x5e, 0xa5, 0x55, 0x02, 0x00, 0xa4, 0x58, 0x55, 0x55, 0x55, 0x55, 0x56, 0x53, 0x56, 0x54, 0x56, 0x01, 0x00, 0x10, 0x58, 0x01, 0x00,
+  0x90, 0x5b, 0x58, 0x58, 0x5b, 0x5a, 0x5b, 0x58, 0x5b, 0x57, 0x01, 0x00, 0xe1, 0x5b, 0x5e, 0x5b, 0x5e, 0x5b, 0x64, 0x5e, 0x64, 0x61, 0x64, 0x61,
+  0x64, 0x64, 0x67, 0x03, 0x00, 0xf1, 0x13, 0x5f, 0x64, 0x64, 0x67, 0x68, 0x68, 0x68, 0x67, 0x68, 0x67, 0x6d, 0x6c, 0x71, 0x6c, 0x71, 0x71, 0x71,
+  0x6e, 0x71, 0x6e, 0x71, 0x73, 0x73, 0x73, 0x78, 0x73, 0x74, 0x73, 0x74, 0x78, 0x73, 0x78, 0x73, 0x78, 0x01, 0x00, 0x30, 0x74, 0x73, 0x78, 0x15,
+  0x00, 0x61, 0x7d, 0x7a, 0x7d, 0x7f, 0x81, 0x83, 0x02, 0x00, 0xa0, 0x80, 0x81, 0x81, 0x81, 0x80, 0x86, 0x80, 0x86, 0x83, 0x86, 0x01, 0x00, 0xe2,
+  0x02, 0x86, 0x02, 0x87, 0x02, 0x87, 0x02, 0x89, 0x02, 0x8a, 0x02, 0x8d, 0x02, 0x8d, 0x01, 0x00, 0xe0, 0x8f, 0x8d, 0x8f, 0x8e, 0x8f, 0x8e, 0x8f,
+  0x8f, 0x8e, 0x8f, 0x93, 0x8f, 0x8e, 0x94, 0x02, 0x00, 0x52, 0x93, 0x94, 0x94, 0x94, 0x95, 0x02, 0x00, 0xe0, 0x95, 0x95, 0x99, 0x99, 0x95, 0x99,
+  0x04, 0x99, 0x99, 0x04, 0x04, 0x99, 0x04, 0x04, 0x05, 0x00, 0xf8, 0x00, 0x05, 0x04, 0x04, 0x05, 0x04, 0x05, 0x04, 0x08, 0x07, 0x08, 0x09, 0x05,
+  0x09, 0x05, 0x09, 0x01, 0x00, 0x10, 0x0b, 0x05, 0x00, 0x70, 0x09, 0x0b, 0x09, 0x0b, 0x0b, 0x09, 0x0e, 0x07, 0x00, 0x00, 0x09, 0x00, 0x42, 0x0b,
+  0x09, 0x0e, 0x0b, 0x07, 0x00, 0x00, 0x09, 0x00, 0x00, 0x23, 0x00, 0xf0, 0x10, 0x08, 0x05, 0x04, 0x11, 0x1e, 0x03, 0x01, 0x01, 0x18, 0x41, 0x44,
+  0x44, 0x45, 0x44, 0x45, 0x1e, 0x3f, 0x37, 0x29, 0x95, 0x37, 0x32, 0x29, 0x44, 0x3f, 0x45, 0x3f, 0x20, 0x09, 0x3f, 0x44, 0x01, 0x00, 0x13, 0x41,
+  0xe4, 0x01, 0x91, 0x14, 0x09, 0x8f, 0x95, 0x20, 0x2c, 0x3f, 0x37, 0x3f, 0x0f, 0x00, 0x20, 0x25, 0x02, 0xd8, 0x01, 0x01, 0xe1, 0x01, 0x01, 0x01,
+  0x00, 0xf1, 0x05, 0x01, 0x09, 0x3e, 0x41, 0x41, 0x41, 0x3e, 0x41, 0x3e, 0x3b, 0x41, 0x3b, 0x3b, 0x3e, 0x35, 0x02, 0x00, 0x00, 0x03, 0x37, 0xdf,
+  0x01, 0xf1, 0x23, 0x3e, 0x3b, 0x35, 0x35, 0x2c, 0x25, 0x1e, 0x25, 0x03, 0x02, 0x02, 0x02, 0x1e, 0x8d, 0x09, 0x25, 0x09, 0x03, 0x25, 0x37, 0x25,
+  0x00, 0x02, 0x25, 0x2c, 0x2c, 0x2c, 0x37, 0x03, 0x02, 0x94, 0x04, 0x86, 0x86, 0x92, 0x89, 0x73, 0x79, 0x7e, 0x25, 0x35, 0x39, 0x35, 0x31, 0x35,
+  0x39, 0x35, 0x39, 0x35, 0x35, 0xd7, 0x01, 0x20, 0x39, 0x39, 0xd6, 0x01, 0x22, 0x27, 0x2d, 0xd0, 0x01, 0x10, 0x39, 0xdf, 0x01, 0x00, 0x08, 0x00,
+  0x00, 0x05, 0x00, 0xf0, 0x18, 0x31, 0x31, 0x31, 0x1f, 0x06, 0x27, 0x1f, 0x13, 0x13, 0x1f, 0x1e, 0x86, 0x86, 0x9d, 0x9b, 0x85, 0x7b, 0x69, 0x5c,
+  0x5c, 0x82, 0x97, 0x05, 0x0b, 0x0b, 0x0a, 0x98, 0x8c, 0x5c, 0x66, 0x8c, 0x92, 0x92, 0x60, 0xa5, 0x58, 0xa5, 0xa5, 0xa5, 0xe1, 0x01, 0xb0, 0x55,
+  0x55, 0x56, 0x55, 0x54, 0x53, 0x54, 0x54, 0x54, 0x54, 0x56, 0x02, 0x00, 0x90, 0x56, 0x56, 0x57, 0x56, 0x57, 0x58, 0x57, 0x58, 0x5b, 0x02, 0x00,
+  0x11, 0x57, 0xe0, 0x01, 0x44, 0x5b, 0x57, 0x5b, 0x5b, 0xe1, 0x01, 0x06, 0x01, 0x00, 0x10, 0x67, 0x05, 0x00, 0xc2, 0x64, 0x64, 0x5f, 0x67, 0x68,
+  0x6c, 0x6d, 0x71, 0x6e, 0x71, 0x71, 0x73, 0x02, 0x00, 0x41, 0x73, 0x73, 0x75, 0x73, 0x05, 0x00, 0x20, 0x71, 0x73, 0xe9, 0x01, 0xe2, 0x73, 0x73,
+  0x73, 0x6c, 0x6c, 0x79, 0x7c, 0x7d, 0x7a, 0x7d, 0x7a, 0x81, 0x80, 0x81, 0xe5, 0x01, 0x71, 0x7f, 0x81, 0x80, 0x81, 0x80, 0x81, 0x83, 0xe3, 0x01,
+  0x20, 0x87, 0x02, 0x03, 0x00, 0x60, 0x02, 0x89, 0x02, 0x8d, 0x8d, 0x8a, 0xe1, 0x01, 0x11, 0x8e, 0x02, 0x00, 0x01, 0xe1, 0x01, 0x12, 0x94, 0xe3,
+  0x01, 0x00, 0xdd, 0x01, 0x08, 0xdf, 0x01, 0x64, 0x95, 0x99, 0x99, 0x99, 0x99, 0x04, 0x02, 0x00, 0x00, 0xdb, 0x01, 0x20, 0x05, 0x05, 0x06, 0x00,
+  0x20, 0x08, 0x04, 0xcd, 0x01, 0x0d, 0xe2, 0x01, 0x01, 0xc4, 0x01, 0x03, 0x02, 0x00, 0x00, 0x01, 0x00, 0x20, 0x0e, 0x0b, 0xe0, 0x01, 0x00, 0x07,
+  0x00, 0x13, 0x0e, 0x0b, 0x00, 0x90, 0x09, 0x08, 0x09, 0x04, 0x07, 0x8e, 0x02, 0x03, 0x14, 0xbf, 0x03, 0xf0, 0x01, 0x45, 0x44, 0x29, 0x44, 0x3f,
+  0x14, 0x07, 0x3f, 0x32, 0x37, 0x3f, 0x3f, 0x3f, 0x44, 0x2c, 0x07, 0x12, 0x00, 0x00, 0x01, 0x00, 0x01, 0xc0, 0x03, 0xf0, 0x03, 0x3e, 0x1e, 0x04,
+  0x8f, 0x03, 0x11, 0x29, 0x3f, 0x3f, 0x32, 0x18, 0x41, 0x44, 0x41, 0x3e, 0x37, 0x03, 0x01, 0x01, 0x00, 0x00, 0xdb, 0x01, 0x01, 0x01, 0x00, 0x40,
+  0x00, 0x18, 0x37, 0x3e, 0xbf, 0x03, 0xc0, 0x3b, 0x41, 0x3b, 0x41, 0x3e, 0x3b, 0x37, 0x03, 0x00, 0x00, 0x0b, 0x35, 0xdd, 0x01, 0x00, 0xc0, 0x03,
+  0xf0, 0x24, 0x1f, 0x1e, 0x2c, 0x18, 0x02, 0x88, 0x8f, 0x9a, 0x0e, 0x1e, 0x14, 0x1e, 0x25, 0x18, 0x03, 0x20, 0x2c, 0x02, 0x7e, 0x02, 0x25, 0x25,
+  0x2c, 0x0b, 0x1e, 0x00, 0x0b, 0x29, 0x07, 0x07, 0x8b, 0x86, 0x79, 0x79, 0x74, 0x9a, 0x35, 0x35, 0x39, 0x2d, 0x2d, 0x25, 0x27, 0x2d, 0x35, 0x39,
+  0x39, 0x35, 0x2d, 0x35, 0x39, 0xe1, 0x01, 0x80, 0x1f, 0x39, 0x27, 0x2d, 0x2d, 0x39, 0x31, 0x39, 0xec, 0x01, 0x01, 0x01, 0x00, 0x03, 0x07, 0x00,
+  0xf1, 0x14, 0x31, 0x31, 0x2d, 0x1f, 0x0e, 0x0b, 0x99, 0x13, 0x27, 0x95, 0x02, 0x6a, 0x74, 0x8c, 0x8c, 0x8c, 0x76, 0x5c, 0x5d, 0x5c, 0x85, 0x0e,
+  0x0b, 0x08, 0x0b, 0x0b, 0x07, 0x98, 0x67, 0x60, 0x8c, 0x07, 0x92, 0x5c, 0x55, 0xdd, 0x01, 0x01, 0xdf, 0x01, 0x00, 0xdd, 0x01, 0x11, 0x52, 0x02,
+  0x00, 0x00, 0x08, 0x00, 0x70, 0x54, 0x54, 0x57, 0x57, 0x57, 0x56, 0x5b, 0xd7, 0x01, 0x50, 0x57, 0x57, 0x57, 0x54, 0x57, 0x0f, 0x00, 0x02, 0xe3,
+  0x01, 0x00, 0xe2, 0x01, 0x00, 0x02, 0x00, 0x02, 0x01, 0x00, 0xd1, 0x5b, 0x5a, 0x5b, 0x5e, 0x5e, 0x64, 0x5f, 0x5f, 0x64, 0x67, 0x67, 0x67, 0x6c,
+  0xbe, 0x03, 0x10, 0x6e, 0x02, 0x00, 0x00, 0xc9, 0x03, 0x50, 0x6e, 0x6e, 0x6e, 0x6c, 0x6c, 0x16, 0x00, 0x00, 0xdf, 0x01, 0x50, 0x74, 0x73, 0x74,
+  0x7c, 0x79, 0xe0, 0x01, 0x30, 0x7d, 0x7e, 0x80, 0xd8, 0x01, 0xc0, 0x81, 0x81, 0x79, 0x7c, 0x7e, 0x80, 0x7e, 0x80, 0x79, 0x80, 0x81, 0x00, 0xc3,
+  0x03, 0x60, 0x87, 0x86, 0x87, 0x86, 0x8a, 0x02, 0x02, 0x00, 0x00, 0xbd, 0x03, 0x00, 0x01, 0x00, 0x01, 0xc1, 0x03, 0x02, 0xdc, 0x01, 0x32, 0x8f,
+  0x93, 0x94, 0x02, 0x00, 0x30, 0x94, 0x94, 0x93, 0xde, 0x01, 0x00, 0xe1, 0x01, 0x00, 0xbe, 0x03, 0x00, 0xdb, 0x01, 0x02, 0x01, 0x00, 0x00, 0xdb,
+  0x01, 0x10, 0x05, 0xe2, 0x01, 0x52, 0x08, 0x07, 0x08, 0x04, 0x09, 0xe4, 0x01, 0x50, 0x08, 0x09, 0x09, 0x07, 0x08, 0x09, 0x00, 0x00, 0x9f, 0x03,
+  0x03, 0x06, 0x00, 0x00, 0xc1, 0x03, 0x23, 0x09, 0x09, 0xd9, 0x01, 0x00, 0xbd, 0x03, 0x05, 0x01, 0x00, 0x82, 0x09, 0x05, 0x08, 0x29, 0x25, 0x02,
+  0x04, 0x2c, 0xab, 0x03, 0x60, 0x44, 0x14, 0x20, 0x3f, 0x11, 0x02, 0xde, 0x01, 0x50, 0x3f, 0x32, 0x3f, 0x37, 0x32, 0x12, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0xc2, 0x03, 0xf4, 0x00, 0x41, 0x37, 0x04, 0x25, 0x32, 0x1e, 0x1e, 0x2c, 0x3f, 0x3e, 0x0a, 0x09, 0x3f, 0x41, 0x41, 0xc1, 0x03, 0x00, 0x01,
+  0x00, 0xf1, 0x09, 0x00, 0x88, 0x00, 0x88, 0x88, 0x88, 0x1f, 0x37, 0x41, 0x41, 0x41, 0x3b, 0x1e, 0x35, 0x3e, 0x3e, 0x41, 0x3b, 0x3e, 0x35, 0x0b,
+  0x00, 0x00, 0x18, 0xbf, 0x03, 0x00, 0x9f, 0x05, 0xf0, 0x15, 0x37, 0x2c, 0x18, 0x02, 0x00, 0x8f, 0x7e, 0x88, 0x7e, 0x18, 0x0b, 0x95, 0x1e, 0x0e,
+  0x97, 0x25, 0x20, 0x02, 0x95, 0x18, 0x0e, 0x0b, 0x18, 0x02, 0x0c, 0x02, 0x04, 0x25, 0x0c, 0x8b, 0x79, 0x79, 0x74, 0x73, 0x7e, 0x18, 0x9f, 0x05,
+  0xb0, 0x25, 0x01, 0x04, 0x27, 0x2d, 0x39, 0x35, 0x39, 0x39, 0x2d, 0x2d, 0xd6, 0x01, 0x10, 0x31, 0xdd, 0x01, 0x00, 0x02, 0x00, 0x00, 0x0c, 0x00,
+  0x00, 0xdc, 0x01, 0x00, 0xaa, 0x05, 0x00, 0xdf, 0x01, 0xf2, 0x12, 0x31, 0x27, 0x1f, 0x01, 0x79, 0x99, 0x27, 0x2c, 0x7e, 0x8c, 0x8c, 0x72, 0x6f,
+  0x82, 0x6a, 0x5c, 0x5d, 0x5c, 0x66, 0x92, 0x0b, 0x13, 0x0f, 0x0b, 0x05, 0x99, 0x91, 0x89, 0x62, 0x73, 0x89, 0x85, 0x5a, 0xc0, 0x03, 0x13, 0x58,
+  0xbe, 0x03, 0x10, 0x52, 0x01, 0x00, 0x03, 0x06, 0x00, 0x61, 0x54, 0x54, 0x57, 0x56, 0x57, 0x57, 0xcd, 0x03, 0x00, 0xd6, 0x03, 0x01, 0xe0, 0x01,
+  0x00, 0x01, 0x00, 0x00, 0xe2, 0x01, 0x10, 0x5b, 0xf5, 0x01, 0xd0, 0x5e, 0x64, 0x5f, 0x64, 0x5f, 0x64, 0x5e, 0x57, 0x5b, 0x58, 0x5b, 0x5e, 0x5e,
+  0xe0, 0x01, 0x10, 0x6c, 0xa3, 0x05, 0x10, 0x6e, 0xa4, 0x05, 0x10, 0x6c, 0x01, 0x00, 0xf3, 0x19, 0x67, 0x67, 0x67, 0x67, 0x62, 0x67, 0x62, 0x6c,
+  0x6c, 0x73, 0x6e, 0x71, 0x6f, 0x71, 0x74, 0x78, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7d, 0x7d, 0x80, 0x7c, 0x7a, 0x7d, 0x80, 0x7d, 0x80, 0x81, 0x80,
+  0x7d, 0x7a, 0x81, 0x7d, 0x80, 0x7d, 0x7f, 0x81, 0xdd, 0x01, 0x30, 0x86, 0x00, 0x89, 0xa5, 0x05, 0x20, 0x8d, 0x8a, 0xdc, 0x01, 0x03, 0xc3, 0x03,
+  0x00, 0xe1, 0x01, 0x00, 0xdf, 0x01, 0x04, 0x9e, 0x05, 0x88, 0x94, 0x94, 0x95, 0x03, 0x95, 0x95, 0x99, 0x03, 0xbe, 0x03, 0x13, 0x99, 0xdd, 0x01,
+  0x41, 0x04, 0x08, 0x04, 0x08, 0xe3, 0x01, 0x00, 0xbb, 0x03, 0x00, 0xa7, 0x05, 0x00, 0x07, 0x00, 0x01, 0x02, 0x00, 0x01, 0xd3, 0x01, 0x00, 0x06,
+  0x00, 0x00, 0xbc, 0x03, 0x10, 0x0e, 0xde, 0x01, 0x02, 0xdf, 0x01, 0x11, 0x0b, 0x03, 0x00, 0x02, 0x01, 0x00, 0xb0, 0x0b, 0x0b, 0x08, 0x04, 0x99,
+  0x45, 0x20, 0x03, 0x3f, 0x44, 0x45, 0x85, 0x05, 0xe4, 0x45, 0x3f, 0x32, 0x2c, 0x3f, 0x20, 0x03, 0x32, 0x32, 0x29, 0x1e, 0x0c, 0x37, 0x29, 0xf4,
+  0x01, 0x05, 0xc0, 0x03, 0xa0, 0x1e, 0x37, 0x14, 0x02, 0x18, 0x25, 0x20, 0x09, 0x03, 0x37, 0xaf, 0x05, 0x23, 0x44, 0x14, 0x9d, 0x05, 0x00, 0xdf,
+  0x01, 0x40, 0x00, 0x88, 0x88, 0x25, 0xd9, 0x01, 0xd0, 0x1e, 0x01, 0x2c, 0x3b, 0x3e, 0x3e, 0x3e, 0x3e, 0x41, 0x2c, 0x01, 0x00, 0x2c, 0xdc, 0x01,
+  0xf0, 0x21, 0x3b, 0x3b, 0x35, 0x35, 0x25, 0x14, 0x0c, 0x97, 0x8d, 0x86, 0x02, 0x7e, 0x0a, 0x09, 0x95, 0x04, 0x04, 0x18, 0x04, 0x03, 0x97, 0x1e,
+  0x14, 0x25, 0x25, 0x18, 0x03, 0x9a, 0x00, 0x0a, 0x03, 0x02, 0x1e, 0x9a, 0x79, 0x79, 0x74, 0x74, 0x74, 0x88, 0x2c, 0x35, 0x39, 0x2d, 0x35, 0x0f,
+  0x03, 0x1f, 0xc0, 0x03, 0x13, 0x39, 0xbf, 0x03, 0x11, 0x13, 0xbe, 0x03, 0x01, 0x02, 0x00, 0x03, 0x01, 0x00, 0x41, 0x27, 0x27, 0x26, 0x27, 0x07,
+  0x00, 0xf1, 0x17, 0x1f, 0x06, 0x0b, 0x1f, 0x25, 0x18, 0x82, 0x76, 0x8c, 0x79, 0x62, 0x82, 0x6f, 0x5d, 0x5a, 0x5d, 0x60, 0x92, 0x0a, 0x0b, 0x13,
+  0x05, 0x79, 0x02, 0x79, 0x97, 0x95, 0x89, 0x71, 0x76, 0x5c, 0x58, 0xa5, 0xa5, 0x58, 0xa5, 0x58, 0xa5, 0xe0, 0x01, 0x00, 0xbc, 0x03, 0x01, 0x01,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0xd3, 0x01, 0x01, 0x01, 0x00, 0x05, 0x15, 0x00, 0x00, 0xe4, 0x01, 0x20, 0x54, 0x57, 0xf0, 0x01, 0x71, 0x57, 0x5b,
+  0x57, 0x56, 0x56, 0x56, 0x5b, 0xc5, 0x03, 0xf0, 0x03, 0x5f, 0x5e, 0x5e, 0x5b, 0x5e, 0x5e, 0x5e, 0x64, 0x67, 0x67, 0x68, 0x6c, 0x68, 0x6c, 0x67,
+  0x6c, 0x6c, 0x6c, 0xb7, 0x03, 0x30, 0x67, 0x67, 0x6c, 0xdc, 0x01, 0x10, 0x5f, 0xd3, 0x03, 0xf0, 0x06, 0x73, 0x71, 0x73, 0x6e, 0x6c, 0x6c, 0x71,
+  0x74, 0x79, 0x7c, 0x79, 0x79, 0x79, 0x7c, 0x7a, 0x7c, 0x79, 0x7a, 0x78, 0x7a, 0x7c, 0xed, 0x01, 0x00, 0xe5, 0x01, 0x10, 0x81, 0x9e, 0x05, 0x00,
+  0xe1, 0x01, 0x00, 0xbf, 0x03, 0x02, 0xc1, 0x03, 0x00, 0xdd, 0x01, 0x00, 0x01, 0x00, 0x01, 0xc0, 0x03, 0x40, 0x8e, 0x8f, 0x8e, 0x03, 0x06, 0x00,
+  0x21, 0x93, 0x8f, 0xc0, 0x03, 0x31, 0x93, 0x95, 0x94, 0xde, 0x01, 0x21, 0x95, 0x04, 0xc1, 0x03, 0x05, 0x02, 0x00, 0x00, 0xe0, 0x01, 0x02, 0xc1,
+  0x03, 0x30, 0x05, 0x05, 0x09, 0xc4, 0x03, 0x01, 0xa1, 0x05, 0x00, 0x08, 0x00, 0x04, 0x01, 0x00, 0x01, 0xde, 0x01, 0x00, 0xdb, 0x01, 0x01, 0xdc,
+  0x01, 0x05, 0xd8, 0x01, 0x01, 0x01, 0x00, 0x01, 0x83, 0x07, 0x00, 0xe0, 0x01, 0x42, 0x32, 0x11, 0x44, 0x48, 0x89, 0x05, 0x10, 0x44, 0xb7, 0x03,
+  0xa1, 0x17, 0x1e, 0x18, 0x25, 0x25, 0x04, 0x11, 0x18, 0x11, 0x37, 0x6b, 0x07, 0x00, 0xcc, 0x01, 0x00, 0x01, 0x00, 0xb0, 0x37, 0x03, 0x03, 0x20,
+  0x18, 0x03, 0x13, 0x0c, 0x02, 0x04, 0x2c, 0xef, 0x01, 0x40, 0x41, 0x44, 0x37, 0x03, 0xde, 0x01, 0x00, 0xe1, 0x01, 0xd0, 0x00, 0x00, 0x00, 0x88,
+  0x88, 0x2c, 0x37, 0x41, 0x3e, 0x37, 0x01, 0x04, 0x35, 0x87, 0x07, 0x51, 0x41, 0x3e, 0x41, 0x25, 0x25, 0xbd, 0x03, 0xf0, 0x21, 0x35, 0x35, 0x2d,
+  0x25, 0x04, 0x7e, 0x7e, 0x83, 0x7e, 0x87, 0x7e, 0x00, 0x14, 0x14, 0x0a, 0x14, 0x14, 0x25, 0x2c, 0x2c, 0x25, 0x18, 0x03, 0x18, 0x1e, 0x14, 0x9a,
+  0x7e, 0x79, 0x0a, 0x02, 0x02, 0x17, 0x94, 0x79, 0x79, 0x86, 0x89, 0x7e, 0x07, 0x2d, 0x35, 0x2d, 0x39, 0x27, 0x2c, 0x39, 0x35, 0xdf, 0x01, 0xa0,
+  0x39, 0x39, 0x31, 0x35, 0x31, 0x39, 0x39, 0x2d, 0x0f, 0x2d, 0xaf, 0x03, 0x07, 0xdf, 0x01, 0x30, 0x31, 0x27, 0x27, 0xdf, 0x01, 0xf0, 0x12, 0x31,
+  0x27, 0x1f, 0x13, 0x1f, 0x13, 0x1f, 0x93, 0x7e, 0x66, 0x62, 0x72, 0x92, 0x92, 0x92, 0x82, 0x65, 0x5d, 0x5c, 0x6a, 0x8c, 0x80, 0x94, 0x05, 0x99,
+  0x7e, 0x91, 0x09, 0x09, 0x0b, 0x07, 0x6e, 0x61, 0xbc, 0x03, 0x00, 0x02, 0x00, 0x04, 0xa0, 0x05, 0x01, 0xd8, 0x01, 0x00, 0x04, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0xce, 0x01, 0x01, 0x0f, 0x00, 0x01, 0xe3, 0x01, 0x00, 0x0b, 0x00, 0x70, 0x54, 0x54, 0xa3, 0x52, 0xa3, 0xa3, 0xa3, 0xb7, 0x05, 0x00,
+  0xc0, 0x03, 0x01, 0x60, 0x09, 0x00, 0x05, 0x00, 0x30, 0x5f, 0x5f, 0x5f, 0xae, 0x03, 0x01, 0xb3, 0x03, 0x00, 0xbb, 0x03, 0x11, 0x6c, 0xe9, 0x01,
+  0x00, 0xec, 0x01, 0x00, 0x8a, 0x07, 0x10, 0x73, 0xd1, 0x03, 0xf1, 0x07, 0x6f, 0x73, 0x78, 0x74, 0x78, 0x74, 0x75, 0x77, 0x78, 0x79, 0x78, 0x77,
+  0x78, 0x73, 0x73, 0x72, 0x6c, 0x6f, 0x79, 0x7d, 0x80, 0x81, 0x7d, 0x07, 0x02, 0xde, 0x01, 0x20, 0x87, 0x86, 0x63, 0x09, 0x17, 0x8a, 0xe1, 0x01,
+  0x00, 0xc1, 0x03, 0x00, 0xe1, 0x01, 0x01, 0xc3, 0x03, 0x10, 0x93, 0x9b, 0x05, 0x31, 0x93, 0x94, 0x93, 0xde, 0x01, 0x00, 0x5d, 0x09, 0x00, 0xc3,
+  0x03, 0x00, 0xbe, 0x03, 0x00, 0xa2, 0x05, 0x42, 0x05, 0x04, 0x04, 0x99, 0xdf, 0x01, 0x00, 0xc3, 0x03, 0x24, 0x08, 0x04, 0xd7, 0x01, 0x11, 0x08,
+  0x03, 0x00, 0x01, 0xd9, 0x01, 0x00, 0x02, 0x00, 0x00, 0x55, 0x09, 0x01, 0x95, 0x05, 0x01, 0xe4, 0x01, 0x00, 0x06, 0x00, 0x01, 0x97, 0x07, 0x00,
+  0x24, 0x00, 0xa2, 0x09, 0x08, 0x05, 0x05, 0x04, 0x45, 0x29, 0x44, 0x45, 0x48, 0xe1, 0x01, 0x30, 0x3f, 0x44, 0x37, 0x9a, 0x05, 0x86, 0x1e, 0x03,
+  0x02, 0x04, 0x04, 0x20, 0x25, 0x20, 0xe0, 0x01, 0xe1, 0x44, 0x41, 0x41, 0x37, 0x07, 0x1e, 0x37, 0x1e, 0x18, 0x8f, 0x04, 0x03, 0x0a, 0x3e, 0xa0,
+  0x05, 0x30, 0x41, 0x41, 0x95, 0xdc, 0x01, 0x02, 0xe1, 0x01, 0xa1, 0x88, 0x00, 0x01, 0x2c, 0x41, 0x3e, 0x3e, 0x18, 0x00, 0x18, 0x81, 0x07, 0x21,
+  0x3b, 0x41, 0xdd, 0x01, 0x00, 0xdf, 0x01, 0xf0, 0x18, 0x25, 0x25, 0x03, 0x7e, 0x7e, 0x7f, 0x7e, 0x7f, 0x00, 0x7f, 0x00, 0x0a, 0x09, 0x1e, 0x04,
+  0x95, 0x04, 0x25, 0x25, 0x2c, 0x14, 0x00, 0x14, 0x94, 0x7e, 0x7e, 0x7e, 0x02, 0x1e, 0x18, 0x8f, 0x11, 0x14, 0x09, 0x09, 0x1e, 0x18, 0x95, 0x1f,
+  0x55, 0x09, 0x40, 0x27, 0x2d, 0x3b, 0x3b, 0x65, 0x09, 0x30, 0x31, 0x2d, 0x2d, 0x9b, 0x05, 0x30, 0x2d, 0x0f, 0x1a, 0x5e, 0x09, 0x07, 0x01, 0x00,
+  0x01, 0xdd, 0x01, 0x00, 0x08, 0x00, 0xf0, 0x1c, 0x1f, 0x1a, 0x13, 0x0f, 0x13, 0x08, 0x73, 0x8d, 0x98, 0x97, 0x7f, 0x92, 0x9b, 0x69, 0x63, 0x59,
+  0x70, 0x9a, 0x91, 0x77, 0x6a, 0x77, 0x0b, 0x0b, 0x0e, 0x08, 0x0b, 0x0b, 0x9d, 0x62, 0x59, 0x5a, 0x5a, 0x58, 0xa5, 0x58, 0x5a, 0x5c, 0x58, 0x58,
+  0x55, 0x56, 0x55, 0x35, 0x0b, 0x00, 0x9e, 0x03, 0x00, 0x02, 0x00, 0x00, 0xc0, 0x01, 0x09, 0x01, 0x00, 0x00, 0xdc, 0x01, 0x91, 0x54, 0x54, 0x52,
+  0x52, 0xa3, 0xa2, 0xa3, 0x52, 0xa3, 0x4b, 0x0b, 0x10, 0x64, 0xa0, 0x05, 0x01, 0x61, 0x09, 0x01, 0x02, 0x00, 0x08, 0x01, 0x00, 0x01, 0x9c, 0x05,
+  0x10, 0x6c, 0xac, 0x05, 0x30, 0x6f, 0x71, 0x72, 0xc0, 0x03, 0x01, 0x01, 0x00, 0xb0, 0x78, 0x74, 0x73, 0x73, 0x6f, 0x71, 0x72, 0x75, 0x77, 0x78,
+  0x72, 0xd1, 0x03, 0x50, 0x73, 0x7c, 0x79, 0x80, 0x81, 0x41, 0x0b, 0x13, 0x83, 0xde, 0x01, 0x00, 0x02, 0x00, 0x00, 0xe2, 0x01, 0x00, 0x02, 0x00,
+  0x00, 0xde, 0x01, 0x00, 0xc3, 0x03, 0x01, 0xa3, 0x05, 0x06, 0xdf, 0x01, 0x10, 0x95, 0x7e, 0x07, 0x23, 0x99, 0x03, 0x80, 0x07, 0x00, 0x04, 0x00,
+  0x01, 0x02, 0x00, 0x01, 0xbc, 0x03, 0x10, 0x04, 0x5f, 0x09, 0x00, 0x01, 0x00, 0x10, 0x09, 0xa2, 0x05, 0x00, 0xbf, 0x03, 0x07, 0x01, 0x00, 0x00,
+  0xc7, 0x01, 0x00, 0xdf, 0x01, 0x00, 0xaa, 0x03, 0x00, 0xdc, 0x01, 0x00, 0x05, 0x00, 0x01, 0xe3, 0x01, 0x00, 0xde, 0x01, 0xf0, 0x00, 0x04, 0x08,
+  0x09, 0x08, 0x08, 0x08, 0x05, 0x04, 0x05, 0x45, 0x3f, 0x45, 0x45, 0x48, 0x48, 0xdf, 0x01, 0x03, 0x01, 0x00, 0xb0, 0x32, 0x2c, 0x8f, 0x03, 0x2c,
+  0x3f, 0x3f, 0x07, 0x04, 0x32, 0x3e, 0x0f, 0x00, 0x21, 0x44, 0x3b, 0xe0, 0x01, 0xc0, 0x3e, 0x2c, 0x29, 0x37, 0x11, 0x07, 0x0a, 0x07, 0x88, 0x02,
+  0x2c, 0x37, 0x61, 0x09, 0x40, 0x41, 0x3f, 0x04, 0x01, 0xe0, 0x01, 0x12, 0x00, 0xc0, 0x03, 0x00, 0x2e, 0x0b, 0x30, 0x37, 0x04, 0x04, 0x54, 0x09,
+  0x00, 0xdf, 0x01, 0x10, 0x41, 0xde, 0x01, 0x80, 0x3b, 0x3b, 0x35, 0x25, 0x18, 0x03, 0x7e, 0x8d, 0xe0, 0x01, 0xf0, 0x0a, 0x86, 0x7e, 0x7e, 0x0b,
+  0x1e, 0x1e, 0x0e, 0x88, 0x00, 0x18, 0x25, 0x1f, 0x0c, 0x01, 0x02, 0x02, 0x7e, 0x7e, 0x7e, 0x8f, 0x14, 0x18, 0x79, 0x04, 0x25, 0x5e, 0x0b, 0x20,
+  0x01, 0x2c, 0x4a, 0x09, 0x00, 0x01, 0x00, 0x00, 0xb3, 0x03, 0x00, 0x40, 0x0b, 0x01, 0x06, 0x00, 0x01, 0xdd, 0x01, 0x02, 0x72, 0x07, 0x62, 0x31,
+  0x27, 0x31, 0x27, 0x31, 0x26, 0xe2, 0x01, 0xf0, 0x21, 0x27, 0x1a, 0x1a, 0x13, 0x1f, 0x1f, 0x13, 0x18, 0x0a, 0x91, 0x81, 0x8f, 0x8f, 0x89, 0x76,
+  0x60, 0x5c, 0x5c, 0x74, 0x07, 0x0b, 0x7d, 0x66, 0x79, 0x08, 0x13, 0x0e, 0x08, 0x88, 0x02, 0x89, 0x5a, 0x5a, 0x5c, 0x65, 0x5d, 0x5c, 0x65, 0x69,
+  0x84, 0x60, 0x58, 0x55, 0x58, 0x55, 0x58, 0x56, 0x58, 0xe3, 0x01, 0x10, 0x58, 0x37, 0x0b, 0x00, 0x02, 0x00, 0x10, 0x5b, 0x1b, 0x0d, 0x00, 0x53,
+  0x09, 0x01, 0x02, 0x00, 0x00, 0x01, 0x00, 0x01, 0x8a, 0x07, 0x51, 0xa3, 0x52, 0x53, 0x54, 0x56, 0x65, 0x09, 0x34, 0x5b, 0x5b, 0x5e, 0xe2, 0x01,
+  0x30, 0x67, 0x67, 0x68, 0xd9, 0x01, 0x21, 0x67, 0x67, 0xc8, 0x03, 0x13, 0x67, 0xbf, 0x03, 0x00, 0x62, 0x09, 0x00, 0x6d, 0x09, 0x04, 0xe2, 0x01,
+  0x80, 0x6c, 0x6e, 0x73, 0x6e, 0x6e, 0x73, 0x73, 0x71, 0xaf, 0x05, 0x50, 0x72, 0x73, 0x79, 0x7c, 0x7c, 0xa1, 0x05, 0x07, 0xe3, 0x01, 0x14, 0x8a,
+  0x02, 0x00, 0x03, 0x85, 0x07, 0x13, 0x8f, 0xc0, 0x03, 0x12, 0x8e, 0x81, 0x07, 0x31, 0x03, 0x95, 0x93, 0x02, 0x00, 0x02, 0xbe, 0x03, 0x00, 0xc0,
+  0x03, 0x04, 0xe2, 0x01, 0x02, 0xdf, 0x01, 0x00, 0xbf, 0x03, 0x00, 0xc1, 0x03, 0x00, 0x8c, 0x03, 0x01, 0x25, 0x0d, 0x00, 0x98, 0x03, 0x01, 0x01,
+  0x00, 0x01, 0xdf, 0x01, 0x20, 0x09, 0x0e, 0xe4, 0x01, 0x00, 0xe3, 0x01, 0x00, 0x94, 0x05, 0x00, 0xbd, 0x03, 0x00, 0x06, 0x00, 0x00, 0xc0, 0x03,
+  0x00, 0xe6, 0x01, 0x00, 0x2d, 0x00, 0x70, 0x44, 0x45, 0x45, 0x48, 0x45, 0x48, 0x45, 0xab, 0x03, 0x00, 0x01, 0x00, 0xc0, 0x3f, 0x3f, 0x41, 0x3f,
+  0x18, 0x07, 0x25, 0x44, 0x11, 0x04, 0x07, 0x03, 0x01, 0x0f, 0x03, 0xc2, 0x03, 0xc0, 0x3e, 0x2c, 0x01, 0x8f, 0x18, 0x17, 0x2c, 0x11, 0x1e, 0x18,
+  0x03, 0x1e, 0x4a, 0x09, 0x41, 0x3e, 0x41, 0x41, 0x18, 0xba, 0x03, 0x00, 0xe1, 0x01, 0x91, 0x88, 0x00, 0x88, 0x04, 0x3e, 0x3e, 0x3e, 0x35, 0x0e,
+  0x31, 0x0b, 0x00, 0xc3, 0x03, 0x01, 0x01, 0x00, 0xf1, 0x0c, 0x39, 0x35, 0x25, 0x09, 0x00, 0x7e, 0x7e, 0x8f, 0x7f, 0x7e, 0x7f, 0x7e, 0x00, 0x7e,
+  0x02, 0x25, 0x18, 0x01, 0x14, 0x03, 0x25, 0x27, 0x25, 0x25, 0x09, 0x04, 0x03, 0x01, 0x00, 0xf0, 0x01, 0x18, 0x1f, 0x0e, 0x13, 0x2c, 0x2d, 0x35,
+  0x35, 0x35, 0x2c, 0x27, 0x2d, 0x27, 0x39, 0x39, 0x3b, 0xe0, 0x01, 0x02, 0x01, 0x00, 0x01, 0xc3, 0x03, 0x00, 0xdb, 0x01, 0x00, 0xf8, 0x0e, 0x00,
+  0xd5, 0x01, 0xf0, 0x28, 0x27, 0x1f, 0x1f, 0x2d, 0x1a, 0x27, 0x26, 0x31, 0x31, 0x27, 0x26, 0x27, 0x1a, 0x1f, 0x13, 0x0f, 0x1f, 0x13, 0x93, 0x87,
+  0x80, 0x7f, 0x81, 0x86, 0x9b, 0x85, 0x62, 0x62, 0x85, 0x87, 0x00, 0x13, 0x13, 0x18, 0x01, 0x00, 0x0b, 0x0f, 0x0e, 0x8e, 0x6c, 0x6c, 0x6e, 0x5a,
+  0x5a, 0x70, 0x85, 0x6d, 0xa5, 0x76, 0x76, 0x76, 0x5c, 0x58, 0x55, 0xee, 0x0e, 0x00, 0x01, 0x00, 0x10, 0x57, 0x05, 0x00, 0x12, 0x5b, 0xdf, 0x01,
+  0x10, 0x58, 0x4a, 0x09, 0x05, 0x01, 0x00, 0x06, 0x5a, 0x09, 0x00, 0xc0, 0x03, 0xc2, 0x5e, 0x5b, 0x56, 0x56, 0x53, 0x56, 0x57, 0x5e, 0x5e, 0x5f,
+  0x5f, 0x61, 0xe2, 0x01, 0x00, 0x01, 0x00, 0x32, 0x66, 0x64, 0x62, 0xdf, 0x01, 0x00, 0xc0, 0x03, 0x02, 0xe2, 0x01, 0x00, 0x48, 0x0b, 0x00, 0x09,
+  0x00, 0x40, 0x73, 0x6f, 0x73, 0x72, 0xe5, 0x01, 0x60, 0x6e, 0x71, 0x6e, 0x66, 0x67, 0x66, 0xba, 0x05, 0x60, 0x74, 0x79, 0x73, 0x77, 0x78, 0x7f,
+  0x13, 0x0f, 0x02, 0xdf, 0x01, 0x00, 0x02, 0x00, 0x60, 0x8d, 0x87, 0x89, 0x8a, 0x02, 0x8a, 0x09, 0x0f, 0x00, 0xe3, 0x01, 0x10, 0x8e, 0xe6, 0x01,
+  0x10, 0x8d, 0xc2, 0x03, 0x31, 0x94, 0x8e, 0x03, 0x63, 0x09, 0x60, 0x95, 0x93, 0x95, 0x03, 0x95, 0x94, 0xdf, 0x01, 0x00, 0xe0, 0x01, 0x03, 0xa1,
+  0x05, 0x01, 0xe1, 0x01, 0x01, 0xe4, 0x01, 0x00, 0x65, 0x09, 0x31, 0x05, 0x08, 0x04, 0xdc, 0x01, 0x00, 0xc3, 0x03, 0x07, 0xe2, 0x01, 0x00, 0xe3,
+  0x01, 0x00, 0xd6, 0x01, 0x00, 0x95, 0x05, 0x05, 0x06, 0x00, 0x04, 0x01, 0x00, 0x00, 0xff, 0x01, 0x30, 0x09, 0x0b, 0x20, 0xc0, 0x03, 0x01, 0x9f,
+  0x05, 0x00, 0xde, 0x01, 0x20, 0x3e, 0x3f, 0xe2, 0x01, 0x10, 0x32, 0x43, 0x0b, 0x30, 0x25, 0x02, 0x2c, 0x13, 0x00, 0x01, 0xe1, 0x01, 0xe1, 0x3e,
+  0x3e, 0x1e, 0x01, 0x02, 0x0e, 0x11, 0x0a, 0x11, 0x0c, 0x04, 0x88, 0x0b, 0x3b, 0xd0, 0x03, 0x30, 0x41, 0x2c, 0x02, 0x9d, 0x05, 0x02, 0xbf, 0x03,
+  0x70, 0x00, 0x0e, 0x3e, 0x3e, 0x35, 0x18, 0x25, 0x3c, 0x0b, 0x03, 0x9b, 0x05, 0xf3, 0x08, 0x39, 0x3b, 0x39, 0x35, 0x2c, 0x01, 0x88, 0x02, 0x7e,
+  0x88, 0x8f, 0x7e, 0x00, 0x02, 0x0b, 0x1e, 0x0e, 0x18, 0x1f, 0x25, 0x18, 0x1f, 0x35, 0x01, 0x00, 0x11, 0x2c, 0x01, 0x00, 0x20, 0x35, 0x35, 0x0c,
+  0x0d, 0x21, 0x35, 0x27, 0xcb, 0x10, 0x00, 0xbf, 0x03, 0x10, 0x27, 0xca, 0x10, 0x10, 0x2d, 0x03, 0x00, 0x00, 0xc2, 0x10, 0x00, 0xb4, 0x03, 0x00,
+  0x02, 0x00, 0x80, 0x26, 0x31, 0x27, 0x0f, 0x01, 0x0f, 0x27, 0x06, 0xe1, 0x01, 0xf0, 0x1d, 0x26, 0x1f, 0x26, 0x27, 0x27, 0x0f, 0x08, 0x0e, 0x99,
+  0x88, 0x8d, 0x89, 0x92, 0x7a, 0x9d, 0x85, 0x62, 0x60, 0x8f, 0x0c, 0x18, 0x13, 0x0f, 0x0e, 0x0f, 0x04, 0x99, 0x08, 0x0e, 0x13, 0x05, 0x89, 0x92,
+  0x6a, 0x5c, 0x5a, 0x76, 0x85, 0x65, 0x5c, 0x5c, 0x70, 0x6d, 0x5a, 0xd5, 0x01, 0x00, 0x01, 0x00, 0x10, 0x57, 0x03, 0x00, 0x00, 0xe3, 0x01, 0x20,
+  0x5b, 0x58, 0x18, 0x0b, 0x00, 0x03, 0x00, 0x0f, 0x01, 0x00, 0x01, 0x00, 0xe9, 0x10, 0x90, 0x56, 0x54, 0xa3, 0xa3, 0x53, 0x53, 0x58, 0x5b, 0x5a,
+  0xe3, 0x01, 0x32, 0x5f, 0x5f, 0x5e, 0xba, 0x03, 0x30, 0x62, 0x67, 0x61, 0x07, 0x00, 0x01, 0x01, 0x00, 0x30, 0x6a, 0x6c, 0x6a, 0xd9, 0x01, 0x00,
+  0x6f, 0x09, 0x21, 0x5f, 0x6c, 0xc3, 0x03, 0xf0, 0x07, 0x78, 0x77, 0x75, 0x73, 0x6c, 0x6c, 0x68, 0x67, 0x62, 0x5f, 0x5f, 0x67, 0x6e, 0x73, 0x71,
+  0x72, 0x73, 0x73, 0x74, 0x79, 0x79, 0x7a, 0x0e, 0x0f, 0x01, 0xc5, 0x03, 0x02, 0xc2, 0x03, 0x02, 0x06, 0x00, 0x23, 0x8a, 0x02, 0xc5, 0x03, 0x00,
+  0xc6, 0x03, 0x00, 0xa6, 0x05, 0x00, 0xdf, 0x01, 0x01, 0x02, 0x00, 0x00, 0xc2, 0x03, 0x10, 0x93, 0xe1, 0x01, 0x01, 0x06, 0x0f, 0x01, 0x26, 0x0d,
+  0x11, 0x05, 0xe2, 0x01, 0x00, 0xc3, 0x03, 0x01, 0xe8, 0x01, 0x01, 0xa5, 0x05, 0x01, 0x5e, 0x09, 0x01, 0x81, 0x07, 0x03, 0x83, 0x07, 0x00, 0xd5,
+  0x01, 0x00, 0xbe, 0x03, 0x01, 0xb7, 0x03, 0x01, 0x05, 0x00, 0x02, 0x01, 0x00, 0x00, 0x08, 0x00, 0x01, 0x19, 0x00, 0x70, 0x0e, 0x03, 0x09, 0x2c,
+  0x45, 0x45, 0x48, 0x25, 0x0b, 0x00, 0xca, 0x01, 0xd1, 0x1e, 0x25, 0x44, 0x3f, 0x3f, 0x44, 0x44, 0x37, 0x37, 0x32, 0x37, 0x3e, 0x20, 0x13, 0x00,
+  0x00, 0x01, 0x00, 0xf0, 0x01, 0x41, 0x3e, 0x3e, 0x0e, 0x01, 0x93, 0x03, 0x88, 0x01, 0x01, 0x93, 0x02, 0x01, 0x99, 0x37, 0x3e, 0xf1, 0x01, 0x30,
+  0x41, 0x37, 0x04, 0xba, 0x03, 0x03, 0xc2, 0x03, 0x60, 0x25, 0x3e, 0x3e, 0x35, 0x04, 0x25, 0x99, 0x05, 0x01, 0xbd, 0x03, 0x00, 0x8d, 0x03, 0xa0,
+  0x35, 0x3b, 0x1f, 0x01, 0x01, 0x04, 0x1e, 0x25, 0x2c, 0x1f, 0xcb, 0x01, 0x50, 0x2c, 0x35, 0x2c, 0x2c, 0x2d, 0xd2, 0x01, 0xf2, 0x06, 0x2c, 0x2d,
+  0x2c, 0x2c, 0x25, 0x1e, 0x1e, 0x1e, 0x18, 0x1e, 0x1f, 0x2c, 0x2c, 0x1f, 0x25, 0x25, 0x2d, 0x2d, 0x1f, 0x1f, 0x1f, 0xe0, 0x01, 0xd0, 0x2d, 0x31,
+  0x2d, 0x27, 0x31, 0x2d, 0x27, 0x2d, 0x26, 0x2d, 0x1a, 0x27, 0x2d, 0x4e, 0x09, 0x00, 0xe7, 0x01, 0x01, 0xc0, 0x03, 0xf0, 0x2c, 0x08, 0x1a, 0x1f,
+  0x1f, 0x1a, 0x26, 0x26, 0x27, 0x26, 0x1a, 0x26, 0x27, 0x26, 0x27, 0x0f, 0x05, 0x91, 0x8d, 0x8a, 0x95, 0x8d, 0x8c, 0x82, 0x85, 0x6c, 0x6c, 0x74,
+  0x0a, 0x08, 0x0e, 0x13, 0x0e, 0x0f, 0x0e, 0x0f, 0x06, 0x99, 0x88, 0x0a, 0x93, 0x9a, 0x9b, 0x85, 0x80, 0x67, 0x6e, 0x66, 0x5c, 0x5a, 0x62, 0x82,
+  0x70, 0x5a, 0x58, 0x5a, 0x67, 0x62, 0x67, 0x5f, 0xdc, 0x01, 0x00, 0xdf, 0x01, 0x32, 0x57, 0x57, 0x5b, 0x43, 0x09, 0x00, 0x99, 0x05, 0x00, 0xd0,
+  0x01, 0x03, 0x01, 0x00, 0x12, 0x64, 0x02, 0x00, 0x10, 0x5e, 0x0c, 0x00, 0x51, 0x5b, 0x5b, 0x56, 0x56, 0x54, 0xc1, 0x03, 0xd0, 0x5e, 0x5e, 0x5e,
+  0x5f, 0x5e, 0x5a, 0x58, 0x5f, 0x5f, 0x62, 0x64, 0x62, 0x61, 0x36, 0x0b, 0x03, 0x02, 0x00, 0x43, 0x67, 0x67, 0x66, 0x67, 0xe2, 0x01, 0x40, 0x6c,
+  0x6a, 0x6c, 0x72, 0x81, 0x07, 0xf1, 0x08, 0x74, 0x75, 0x72, 0x71, 0x67, 0x5f, 0x5f, 0x5f, 0x5a, 0x5e, 0x62, 0x6e, 0x75, 0x74, 0x74, 0x78, 0x79,
+  0x78, 0x79, 0x7c, 0x7a, 0x81, 0x7f, 0xdd, 0x01, 0x00, 0xdf, 0x01, 0x02, 0x02, 0x00, 0xa3, 0x8a, 0x86, 0x8a, 0x89, 0x87, 0x86, 0x87, 0x87, 0x02,
+  0x89, 0xe3, 0x01, 0x12, 0x8e, 0xe2, 0x01, 0x02, 0x88, 0x07, 0x40, 0x93, 0x03, 0x93, 0x03, 0xe4, 0x01, 0x00, 0xdd, 0x01, 0x01, 0xa3, 0x05, 0x04,
+  0xc1, 0x03, 0x00, 0x05, 0x00, 0x00, 0x08, 0x00, 0x10, 0x08, 0xdf, 0x01, 0x00, 0xbf, 0x03, 0x10, 0x08, 0xdb, 0x01, 0x00, 0x02, 0x00, 0x01, 0xdf,
+  0x01, 0x00, 0x7e, 0x07, 0x00, 0x04, 0x00, 0x00, 0x75, 0x07, 0x00, 0xe1, 0x01, 0x00, 0xe8, 0x01, 0x0b, 0x01, 0x00, 0x60, 0x03, 0x03, 0x09, 0x45,
+  0x45, 0x45, 0x55, 0x07, 0x00, 0xc9, 0x01, 0x20, 0x04, 0x37, 0xc8, 0x12, 0x72, 0x44, 0x3f, 0x32, 0x25, 0x29, 0x0a, 0x20, 0x80, 0x07, 0x00, 0xfb,
+  0x01, 0x80, 0x41, 0x3e, 0x14, 0x03, 0x03, 0x05, 0x8d, 0x01, 0x14, 0x0d, 0x20, 0x03, 0x35, 0xff, 0x0e, 0x40, 0x25, 0x37, 0x41, 0x25, 0xbe, 0x03,
+  0x01, 0xc0, 0x03, 0xa5, 0x00, 0x01, 0x2c, 0x3e, 0x3b, 0x35, 0x03, 0x27, 0x3e, 0x3b, 0xdf, 0x01, 0x80, 0x3b, 0x39, 0x3b, 0x3b, 0x3e, 0x3e, 0x2c,
+  0x37, 0xac, 0x03, 0x10, 0x25, 0x01, 0x00, 0xf1, 0x09, 0x1e, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x2c, 0x1f, 0x1f, 0x18, 0x0e, 0x18, 0x8f, 0x88, 0x86,
+  0x88, 0x81, 0x00, 0x03, 0x18, 0x0e, 0x8f, 0x03, 0x08, 0x5c, 0x09, 0x00, 0xdb, 0x01, 0x01, 0x05, 0x00, 0x00, 0xd9, 0x01, 0x00, 0x02, 0x00, 0x00,
+  0xe8, 0x01, 0x81, 0x26, 0x27, 0x27, 0x27, 0x1a, 0x27, 0x27, 0x26, 0x18, 0x0d, 0x80, 0x26, 0x27, 0x1a, 0x27, 0x26, 0x26, 0x31, 0x27, 0xe1, 0x01,
+  0xf0, 0x1f, 0x13, 0x7e, 0x72, 0x81, 0x85, 0x8d, 0x9a, 0x72, 0x60, 0x6f, 0x91, 0x0a, 0x07, 0x05, 0x91, 0x00, 0x05, 0x05, 0x99, 0x06, 0x13, 0x0f,
+  0x13, 0x93, 0x93, 0x8e, 0x7f, 0x7f, 0x7f, 0x07, 0x89, 0x6c, 0x76, 0xa7, 0x5c, 0x66, 0x82, 0x6d, 0x5a, 0x58, 0x5f, 0x7c, 0x85, 0x85, 0x78, 0x5e,
+  0xf7, 0x0c, 0x24, 0x57, 0x56, 0x06, 0x00, 0x00, 0xe2, 0x01, 0x00, 0xe5, 0x01, 0x03, 0x01, 0x00, 0x00, 0xb5, 0x03, 0x00, 0x0c, 0x0d, 0x00, 0xbc,
+  0x03, 0x81, 0x57, 0x58, 0x57, 0x56, 0x56, 0x57, 0x58, 0x5b, 0xfa, 0x0e, 0x10, 0x5f, 0x03, 0x00, 0x90, 0x5e, 0x5f, 0x61, 0x5f, 0x62, 0x5f, 0x62,
+  0x5f, 0x61, 0x0d, 0x00, 0x10, 0x62, 0xec, 0x01, 0x30, 0x67, 0x62, 0x67, 0x89, 0x05, 0x02, 0xe2, 0x01, 0x02, 0xe2, 0x10, 0xf3, 0x00, 0x73, 0x73,
+  0x6e, 0x6e, 0x67, 0x5c, 0x5f, 0x67, 0x67, 0x6c, 0x71, 0x78, 0x7c, 0x7d, 0x7d, 0x09, 0x0f, 0x00, 0x02, 0x00, 0x50, 0x86, 0x80, 0x80, 0x80, 0x80,
+  0xe5, 0x01, 0x04, 0xe7, 0x01, 0x10, 0x83, 0x3b, 0x0d, 0x10, 0x83, 0xec, 0x01, 0x12, 0x86, 0xb3, 0x14, 0x00, 0x07, 0x0f, 0x00, 0xe1, 0x01, 0x00,
+  0xe3, 0x01, 0x00, 0x02, 0x00, 0x00, 0xe3, 0x01, 0x03, 0xe4, 0x01, 0x00, 0xe1, 0x01, 0x00, 0xde, 0x01, 0x03, 0x02, 0x00, 0x00, 0x87, 0x07, 0x00,
+  0x9e, 0x05, 0x00, 0xe6, 0x01, 0x0c, 0xdd, 0x01, 0x11, 0x0b, 0x0e, 0x0d, 0x01, 0xb2, 0x03, 0x00, 0x06, 0x00, 0x09, 0x01, 0x00, 0x82, 0x13, 0x0b,
+  0x0e, 0x03, 0x3f, 0x3f, 0x32, 0x03, 0xe0, 0x01, 0xb0, 0x45, 0x2c, 0x07, 0x44, 0x48, 0x3f, 0x44, 0x44, 0x3f, 0x20, 0x07, 0x6e, 0x12, 0x00, 0xdd,
+  0x01, 0x02, 0x7f, 0x07, 0x60, 0x3e, 0x09, 0x07, 0x0e, 0x03, 0x02, 0xdf, 0x01, 0x20, 0x88, 0x8e, 0x80, 0x07, 0x64, 0x1f, 0x03, 0x2c, 0x37, 0x3e,
+  0x0b, 0xdf, 0x01, 0x92, 0x00, 0x03, 0x37, 0x3b, 0x37, 0x3b, 0x0e, 0x37, 0x3b, 0x9d, 0x05, 0x00, 0xdd, 0x01, 0x00, 0x02, 0x00, 0x01, 0xad, 0x03,
+  0xf1, 0x05, 0x25, 0x25, 0x18, 0x18, 0x0b, 0x9a, 0x04, 0x8f, 0x00, 0x7e, 0x7e, 0x7e, 0x7e, 0x86, 0x04, 0x8f, 0x07, 0x88, 0x02, 0x09, 0xf5, 0x0e,
+  0x80, 0x72, 0x00, 0x05, 0x86, 0x79, 0x79, 0x03, 0x1f, 0xbb, 0x03, 0x00, 0x32, 0x0b, 0x31, 0x0f, 0x1a, 0x2d, 0xb6, 0x03, 0x00, 0x44, 0x09, 0x00,
+  0x76, 0x07, 0x10, 0x27, 0xe9, 0x0e, 0x20, 0x00, 0x99, 0xe1, 0x01, 0xa0, 0x1a, 0x1a, 0x1a, 0x31, 0x26, 0x31, 0x31, 0x26, 0x31, 0x26, 0xc4, 0x03,
+  0xf0, 0x24, 0x27, 0x1a, 0x0e, 0x7f, 0x60, 0x5c, 0x8a, 0x9a, 0x77, 0x62, 0x91, 0x9a, 0x0c, 0x95, 0x8c, 0x81, 0x77, 0x82, 0x7a, 0x73, 0x95, 0x0f,
+  0x13, 0x0f, 0x06, 0x99, 0x8e, 0x8e, 0x93, 0x8e, 0x08, 0x0a, 0x6e, 0x68, 0x62, 0x5c, 0x7b, 0x82, 0x73, 0x5f, 0x5e, 0x6d, 0x82, 0x86, 0x89, 0x8c,
+  0x7c, 0x5f, 0x57, 0x57, 0x56, 0x46, 0x09, 0x00, 0x4c, 0x09, 0x03, 0x02, 0x00, 0x01, 0xc2, 0x03, 0x01, 0x05, 0x00, 0x02, 0xe2, 0x01, 0x31, 0x64,
+  0x5b, 0x5e, 0xfe, 0x0e, 0x30, 0x54, 0x53, 0x56, 0xde, 0x01, 0x01, 0xcf, 0x01, 0x21, 0x5f, 0x61, 0x02, 0x00, 0x31, 0x64, 0x5f, 0x61, 0xab, 0x05,
+  0x03, 0x01, 0x00, 0x20, 0x62, 0x5f, 0xe1, 0x01, 0x04, 0xc3, 0x03, 0x00, 0x9f, 0x05, 0x20, 0x74, 0x73, 0x09, 0x00, 0xa0, 0x6e, 0x71, 0x73, 0x76,
+  0x78, 0x7c, 0x7b, 0x7d, 0x7a, 0x80, 0xdf, 0x01, 0x00, 0x01, 0x00, 0xf0, 0x11, 0x7a, 0x7d, 0x7a, 0x7c, 0x7a, 0x7c, 0x74, 0x74, 0x7c, 0x7b, 0x80,
+  0x80, 0x80, 0x7b, 0x80, 0x82, 0x80, 0x7b, 0x80, 0x80, 0x7c, 0x74, 0x74, 0x77, 0x77, 0x7c, 0x7a, 0x80, 0x80, 0x80, 0x87, 0x86, 0x35, 0x0d, 0x31,
+  0x02, 0x8e, 0x02, 0x69, 0x09, 0x00, 0xe1, 0x01, 0x00, 0xc0, 0x03, 0x00, 0x04, 0x00, 0x00, 0xdf, 0x01, 0x00, 0x02, 0x00, 0x01, 0xe1, 0x01, 0x00,
+  0xdb, 0x01, 0x00, 0xec, 0x10, 0x01, 0x01, 0x00, 0x30, 0x08, 0x08, 0x05, 0xdc, 0x01, 0x11, 0x08, 0xc3, 0x03, 0x00, 0x41, 0x09, 0x00, 0x5f, 0x07,
+  0x00, 0xd3, 0x01, 0x03, 0x02, 0x00, 0x00, 0x05, 0x00, 0x0a, 0x01, 0x00, 0xc1, 0x13, 0x0e, 0x0e, 0x0e, 0x3f, 0x3f, 0x0e, 0x14, 0x20, 0x32, 0x03,
+  0x3e, 0xe0, 0x01, 0x00, 0x60, 0x09, 0x20, 0x44, 0x45, 0xc0, 0x12, 0x32, 0x0a, 0x17, 0x25, 0x61, 0x09, 0x00, 0xdf, 0x01, 0x00, 0xe0, 0x01, 0xa0,
+  0x03, 0x03, 0x04, 0x0b, 0x03, 0x04, 0x0e, 0x02, 0x01, 0x03, 0xe0, 0x01, 0xf0, 0x06, 0x18, 0x00, 0x0e, 0x37, 0x3e, 0x37, 0x09, 0x88, 0x00, 0x88,
+  0x83, 0x00, 0x7f, 0x00, 0x00, 0x09, 0x3e, 0x3e, 0x3b, 0x3b, 0x35, 0xdc, 0x01, 0x10, 0x3b, 0x27, 0x09, 0x01, 0x01, 0x00, 0xf0, 0x18, 0x3b, 0x35,
+  0x27, 0x1e, 0x1f, 0x18, 0x0e, 0x04, 0x8d, 0x00, 0x7f, 0x79, 0x79, 0x79, 0x7e, 0x7a, 0x79, 0x77, 0x79, 0x79, 0x00, 0x8f, 0x94, 0x97, 0x07, 0x9a,
+  0x07, 0x0a, 0x7a, 0x74, 0x72, 0x72, 0x74, 0x87, 0x14, 0x7a, 0x7f, 0x0e, 0x1e, 0x4f, 0x09, 0x10, 0x35, 0xb4, 0x03, 0x30, 0x2d, 0x27, 0x27, 0x53,
+  0x09, 0x01, 0x90, 0x05, 0x00, 0x01, 0x00, 0xe1, 0x27, 0x26, 0x2d, 0x1a, 0x08, 0x73, 0x88, 0x1a, 0x26, 0x31, 0x26, 0x0f, 0x26, 0x26, 0xdd, 0x01,
+  0xf0, 0x27, 0x31, 0x26, 0x0f, 0x1a, 0x1a, 0x1a, 0x1a, 0x13, 0x11, 0x8c, 0x5c, 0x5d, 0x89, 0x9a, 0x8c, 0x6f, 0x8a, 0x93, 0x7f, 0x8d, 0x85, 0x62,
+  0x5f, 0x60, 0x75, 0x6f, 0x88, 0x0b, 0x06, 0x08, 0x06, 0x99, 0x93, 0x93, 0x05, 0x05, 0x99, 0x05, 0x74, 0x5a, 0x58, 0x5c, 0x80, 0x91, 0x9a, 0x89,
+  0x6c, 0x75, 0x6c, 0x74, 0x86, 0x86, 0x82, 0x68, 0xb0, 0x03, 0x01, 0x01, 0x00, 0x00, 0xe3, 0x01, 0x00, 0x01, 0x00, 0x03, 0xdc, 0x01, 0x01, 0xdf,
+  0x01, 0x02, 0xe1, 0x01, 0x01, 0xc1, 0x03, 0x71, 0x5b, 0x57, 0x58, 0x57, 0x5b, 0x5a, 0x5e, 0xba, 0x03, 0x08, 0x01, 0x00, 0x00, 0xad, 0x05, 0x11,
+  0x5a, 0x02, 0x00, 0x02, 0xea, 0x01, 0x21, 0x62, 0x62, 0xc2, 0x03, 0x00, 0xd7, 0x01, 0x00, 0x5f, 0x09, 0x00, 0x61, 0x09, 0x40, 0x75, 0x74, 0x78,
+  0x77, 0x02, 0x00, 0x01, 0x8e, 0x16, 0x40, 0x7f, 0x7d, 0x7f, 0x7c, 0x96, 0x13, 0xf3, 0x0e, 0x6f, 0x73, 0x6e, 0x6e, 0x6a, 0x6c, 0x6f, 0x73, 0x74,
+  0x73, 0x6f, 0x6e, 0x6f, 0x6e, 0x6e, 0x6a, 0x6f, 0x6f, 0x6e, 0x6f, 0x72, 0x6c, 0x6f, 0x72, 0x73, 0x74, 0x74, 0x7a, 0x7f, 0x37, 0x0d, 0x00, 0xc5,
+  0x03, 0x61, 0x8d, 0x8e, 0x8e, 0x94, 0x93, 0x91, 0xdd, 0x01, 0x20, 0x94, 0x93, 0x64, 0x09, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x06, 0xc2, 0x03,
+  0x00, 0x01, 0x00, 0x10, 0x08, 0xe2, 0x01, 0x00, 0x01, 0x00, 0x00, 0xe4, 0x01, 0x00, 0x5f, 0x09, 0x00, 0xde, 0x01, 0x01, 0xc3, 0x03, 0x03, 0x64,
+  0x09, 0x03, 0x01, 0x00, 0x05, 0x09, 0x00, 0x02, 0x01, 0x00, 0x70, 0x43, 0x44, 0x0a, 0x03, 0x03, 0x0a, 0x25, 0xc1, 0x12, 0x00, 0x01, 0x00, 0x10,
+  0x41, 0x7c, 0x16, 0x90, 0x44, 0x3f, 0x37, 0x32, 0x41, 0x29, 0x04, 0x01, 0x1e, 0x9b, 0x14, 0x00, 0x54, 0x07, 0xf0, 0x0a, 0x3e, 0x37, 0x0b, 0x88,
+  0x01, 0x02, 0x25, 0x0a, 0x37, 0x25, 0x0e, 0x03, 0x09, 0x41, 0x41, 0x44, 0x3e, 0x1e, 0x00, 0x02, 0x25, 0x37, 0x41, 0x3e, 0x14, 0xbd, 0x03, 0x17,
+  0x00, 0x8d, 0x14, 0x00, 0xe0, 0x01, 0x02, 0xa5, 0x10, 0x40, 0x35, 0x2d, 0x25, 0x03, 0x1f, 0x0f, 0x80, 0x79, 0x7e, 0x79, 0x79, 0x79, 0x7f, 0x00,
+  0x87, 0x07, 0x00, 0xf1, 0x09, 0x79, 0x0c, 0x8b, 0x80, 0x79, 0x7f, 0x81, 0x94, 0x97, 0x0a, 0x79, 0x72, 0x72, 0x72, 0x91, 0x0a, 0x7f, 0x9b, 0x18,
+  0x25, 0x2d, 0x27, 0x1a, 0x35, 0x78, 0x07, 0x20, 0x31, 0x27, 0x7a, 0x07, 0x00, 0xa2, 0x12, 0x10, 0x26, 0xdf, 0x01, 0x31, 0x31, 0x31, 0x31, 0xac,
+  0x03, 0x60, 0x27, 0x26, 0x26, 0x1a, 0x26, 0x1a, 0x0e, 0x00, 0x01, 0xe0, 0x01, 0xf2, 0x22, 0x26, 0x1a, 0x1a, 0x13, 0x93, 0x80, 0x60, 0x59, 0x63,
+  0x8c, 0x95, 0x83, 0x8e, 0x99, 0x9a, 0x72, 0x71, 0x89, 0x6c, 0x6e, 0x6e, 0x82, 0x67, 0x7f, 0x99, 0x99, 0x93, 0x8e, 0x93, 0x99, 0x99, 0x99, 0x93,
+  0x00, 0x91, 0x81, 0x6c, 0x5a, 0x62, 0x89, 0x93, 0x95, 0x91, 0x8b, 0x6c, 0x5f, 0x68, 0x75, 0x75, 0xdf, 0x01, 0x00, 0xe9, 0x0e, 0x00, 0x07, 0x00,
+  0x00, 0x0c, 0x00, 0x04, 0xd9, 0x01, 0x00, 0x01, 0x00, 0x00, 0xdb, 0x01, 0x00, 0xaa, 0x12, 0x11, 0x5e, 0xc6, 0x01, 0x01, 0x76, 0x07, 0x12, 0x5f,
+  0xc6, 0x01, 0x00, 0x01, 0x00, 0x00, 0x11, 0x00, 0x00, 0xd9, 0x01, 0x04, 0xab, 0x09, 0x40, 0x5a, 0x5a, 0x5e, 0x5a, 0x18, 0x00, 0x50, 0x67, 0x62,
+  0x67, 0x6a, 0x67, 0xc3, 0x03, 0x21, 0x73, 0x6e, 0xe1, 0x01, 0x20, 0x74, 0x74, 0x71, 0x18, 0x50, 0x74, 0x74, 0x73, 0x6c, 0x74, 0xb7, 0x03, 0xf0,
+  0x13, 0x7f, 0x7c, 0x79, 0x7a, 0x79, 0x79, 0x74, 0x6e, 0x6a, 0x66, 0x62, 0x62, 0x62, 0x62, 0x60, 0x62, 0x6a, 0x66, 0x60, 0x62, 0x66, 0x6a, 0x62,
+  0x66, 0x67, 0x66, 0x6a, 0x6a, 0x6a, 0x6c, 0x6c, 0x6f, 0x74, 0x79, 0xdf, 0x01, 0x01, 0x87, 0x07, 0x10, 0x8e, 0x4a, 0x0b, 0x00, 0x02, 0x00, 0x01,
+  0x9f, 0x05, 0x00, 0xe3, 0x01, 0x00, 0xc2, 0x03, 0x00, 0x01, 0x00, 0x01, 0xdd, 0x01, 0x00, 0x66, 0x09, 0x03, 0xdf, 0x01, 0x00, 0xe1, 0x01, 0x00,
+  0xd9, 0x01, 0x02, 0xe0, 0x01, 0x21, 0x0b, 0x08, 0xff, 0x0c, 0x00, 0xa5, 0x05, 0x01, 0xe4, 0x01, 0x01, 0xbd, 0x03, 0x01, 0x60, 0x09, 0x08, 0xdf,
+  0x01, 0x00, 0xc0, 0x03, 0x92, 0x44, 0x3f, 0x18, 0x03, 0x04, 0x25, 0x29, 0x41, 0x3f, 0xe2, 0x01, 0xe1, 0x41, 0x0c, 0x37, 0x37, 0x3f, 0x20, 0x25,
+  0x20, 0x0a, 0x29, 0x25, 0x04, 0x01, 0x18, 0x8e, 0x12, 0x00, 0xf2, 0x1b, 0xb0, 0x3e, 0x04, 0x01, 0x88, 0x01, 0x03, 0x09, 0x32, 0x32, 0x1e, 0x37,
+  0xbf, 0x03, 0xb0, 0x41, 0x18, 0x00, 0x00, 0x99, 0x2c, 0x3e, 0x3f, 0x3e, 0x94, 0x00, 0xbb, 0x10, 0x00, 0x0c, 0x1c, 0x00, 0xdb, 0x01, 0x01, 0x96,
+  0x05, 0x00, 0xdc, 0x01, 0xf0, 0x1c, 0x39, 0x35, 0x39, 0x2c, 0x09, 0x0e, 0x01, 0x88, 0x0c, 0x91, 0x7e, 0x87, 0x7f, 0x7a, 0x7a, 0x7a, 0x7f, 0x9b,
+  0x95, 0x97, 0x8d, 0x89, 0x79, 0x7e, 0x0a, 0x83, 0x7d, 0x74, 0x72, 0x83, 0x97, 0x0c, 0x17, 0x80, 0x6f, 0x72, 0x72, 0x00, 0x07, 0x72, 0x88, 0x14,
+  0x13, 0x5c, 0x09, 0x01, 0x30, 0x0b, 0x30, 0x31, 0x2d, 0x31, 0xdd, 0x01, 0x04, 0xc0, 0x03, 0x00, 0xe5, 0x01, 0x00, 0xdf, 0x01, 0x00, 0x71, 0x07,
+  0x01, 0xdb, 0x01, 0xf0, 0x28, 0x26, 0x26, 0x26, 0x1f, 0x0f, 0x0f, 0x1a, 0x27, 0x1a, 0x13, 0x02, 0x77, 0x60, 0x5a, 0x59, 0x6a, 0x91, 0x0a, 0x05,
+  0x9a, 0x91, 0x62, 0x5c, 0x82, 0x8c, 0x85, 0x89, 0x82, 0x79, 0x87, 0x88, 0x93, 0x93, 0x01, 0x93, 0x8e, 0x93, 0x8e, 0x8a, 0x72, 0x86, 0x89, 0x82,
+  0x5e, 0x66, 0x89, 0x8e, 0x8e, 0x8e, 0x80, 0x62, 0x67, 0x5e, 0x5e, 0x5b, 0x6f, 0x16, 0x02, 0x95, 0x05, 0x01, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00,
+  0xd9, 0x01, 0x01, 0x01, 0x00, 0x00, 0xb6, 0x03, 0x11, 0x64, 0xe2, 0x01, 0x11, 0x5f, 0xe3, 0x01, 0x0a, 0x02, 0x00, 0x01, 0xdc, 0x01, 0x31, 0x58,
+  0x5a, 0x58, 0x44, 0x0f, 0x31, 0x53, 0x56, 0x53, 0x49, 0x0f, 0x42, 0x58, 0x5a, 0x5e, 0x5c, 0xc3, 0x03, 0x01, 0xe1, 0x01, 0x10, 0x6e, 0xe1, 0x01,
+  0x00, 0x85, 0x07, 0x30, 0x74, 0x74, 0x74, 0x05, 0x00, 0x20, 0x79, 0x78, 0xdf, 0x01, 0x00, 0x02, 0x00, 0xb2, 0x7a, 0x78, 0x72, 0x6e, 0x6c, 0x66,
+  0x5f, 0x62, 0x62, 0x66, 0x6c, 0xc7, 0x03, 0x30, 0x72, 0x73, 0x74, 0xe4, 0x03, 0x74, 0x7a, 0x7d, 0x80, 0x81, 0x87, 0x86, 0x89, 0x0f, 0x0f, 0x02,
+  0xdf, 0x01, 0x00, 0xdd, 0x01, 0x11, 0x93, 0xe3, 0x01, 0x01, 0xdf, 0x01, 0x01, 0xc1, 0x03, 0x01, 0x45, 0x0b, 0x01, 0xc0, 0x03, 0x00, 0x03, 0x00,
+  0x00, 0x7f, 0x07, 0x04, 0xc2, 0x03, 0x00, 0xe1, 0x01, 0x30, 0x09, 0x08, 0x09, 0xe4, 0x01, 0x02, 0xa4, 0x05, 0x00, 0xdf, 0x01, 0x01, 0xdb, 0x01,
+  0x03, 0x07, 0x00, 0xc0, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x13, 0x0e, 0x13, 0xf0, 0x22, 0x20, 0x32, 0x2c, 0x04, 0x04, 0x2c,
+  0x37, 0x37, 0x3e, 0x44, 0x44, 0x41, 0x44, 0x44, 0x44, 0x44, 0x2c, 0x37, 0x3f, 0x32, 0x14, 0x11, 0x32, 0x03, 0x95, 0x14, 0x18, 0x04, 0x25, 0x3e,
+  0x41, 0x41, 0x41, 0x3b, 0x3b, 0x41, 0x3b, 0x3e, 0x35, 0x18, 0x88, 0x88, 0x88, 0x01, 0x02, 0x18, 0x25, 0x25, 0x37, 0x14, 0x00, 0xf0, 0x09, 0x3e,
+  0x1e, 0x00, 0x00, 0x00, 0x09, 0x37, 0x3e, 0x3e, 0x1e, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x04, 0x3e, 0x3e, 0x3e, 0x3b, 0x3b, 0x3b, 0x3b, 0x39, 0x02,
+  0x00, 0x20, 0x39, 0x2d, 0x06, 0x00, 0xf0, 0x09, 0x35, 0x27, 0x01, 0x95, 0x0a, 0x8d, 0x0c, 0x0a, 0x91, 0x9a, 0x9a, 0x7f, 0x79, 0x79, 0x7a, 0x0a,
+  0x07, 0x0a, 0x0a, 0x89, 0x79, 0x7f, 0x91, 0x74, 0x01, 0x00, 0xf1, 0x01, 0x85, 0x92, 0x89, 0x72, 0x72, 0x6f, 0x72, 0x83, 0x0b, 0x73, 0x77, 0x9a,
+  0x88, 0x99, 0x25, 0x27, 0x01, 0x00, 0x71, 0x2d, 0x31, 0x27, 0x27, 0x27, 0x26, 0x31, 0x01, 0x00, 0x11, 0x26, 0x03, 0x00, 0x80, 0x31, 0x31, 0x26,
+  0x26, 0x26, 0x26, 0x1a, 0x1a, 0x06, 0x00, 0xf1, 0x2e, 0x26, 0x26, 0x31, 0x26, 0x27, 0x1a, 0x13, 0x08, 0x0f, 0x0f, 0x1a, 0x1a, 0x0e, 0x05, 0x86,
+  0x7b, 0x66, 0x60, 0x5c, 0x72, 0x05, 0x8a, 0x87, 0x6c, 0x5c, 0x65, 0x76, 0x62, 0x66, 0x8c, 0x92, 0x7f, 0x87, 0x93, 0x93, 0x93, 0x8e, 0x8a, 0x8a,
+  0x7f, 0x6f, 0x8c, 0x80, 0x75, 0x7d, 0x75, 0x6c, 0x7b, 0x85, 0x83, 0x83, 0x7f, 0x80, 0x7a, 0x75, 0x5a, 0x5b, 0x5e, 0x57, 0x56, 0x57, 0x01, 0x00,
+  0x10, 0x54, 0x05, 0x00, 0x20, 0x57, 0x5b, 0x02, 0x00, 0x03, 0x01, 0x00, 0x10, 0x5e, 0x03, 0x00, 0x90, 0x5e, 0x5b, 0x5e, 0x5e, 0x5e, 0x5e, 0x5f,
+  0x5e, 0x5f, 0x07, 0x00, 0x09, 0x01, 0x00, 0xf0, 0x2c, 0x5a, 0x5e, 0x5a, 0x5a, 0x58, 0x5a, 0x56, 0x58, 0x56, 0x56, 0x56, 0x53, 0x53, 0xa3, 0x52,
+  0xa3, 0xa3, 0xa3, 0xa3, 0x53, 0x53, 0x53, 0x56, 0x58, 0x56, 0x5a, 0x5a, 0x5f, 0x5f, 0x5f, 0x62, 0x67, 0x66, 0x67, 0x6a, 0x6c, 0x6c, 0x6e, 0x6e,
+  0x6f, 0x71, 0x72, 0x73, 0x74, 0x73, 0x74, 0x74, 0x78, 0x74, 0x79, 0x77, 0x78, 0x7a, 0x78, 0x7a, 0x7d, 0x7a, 0x7c, 0x7f, 0x02, 0x00, 0xf0, 0x1d,
+  0x7b, 0x79, 0x74, 0x73, 0x72, 0x6c, 0x6a, 0x6c, 0x72, 0x78, 0x7b, 0x7d, 0x7b, 0x7d, 0x7d, 0x82, 0x80, 0x81, 0x80, 0x81, 0x85, 0x83, 0x86, 0x83,
+  0x85, 0x87, 0x86, 0x87, 0x86, 0x89, 0x8a, 0x89, 0x8a, 0x02, 0x8a, 0x8d, 0x8d, 0x8d, 0x8d, 0x8f, 0x8e, 0x8f, 0x8e, 0x8e, 0x05, 0x00, 0xf0, 0x02,
+  0x8f, 0x93, 0x94, 0x93, 0x94, 0x93, 0x95, 0x93, 0x95, 0x93, 0x99, 0x95, 0x99, 0x95, 0x99, 0x04, 0x99, 0x01, 0x00, 0x10, 0x04, 0x02, 0x00, 0xb2,
+  0x05, 0x04, 0x05, 0x99, 0x05, 0x05, 0x05, 0x04, 0x08, 0x05, 0x08, 0x01, 0x00, 0x30, 0x09, 0x08, 0x09, 0x01, 0x00, 0x00, 0x08, 0x00, 0x92, 0x08,
+  0x0b, 0x09, 0x0b, 0x0b, 0x0b, 0x09, 0x0e, 0x0b, 0x06, 0x00, 0x01, 0x02, 0x00, 0x06, 0x01, 0x00, 0xd2, 0x13, 0x0e, 0x0e, 0x0e, 0x09, 0x04, 0x0c,
+  0x11, 0x20, 0x1e, 0x09, 0x07, 0x37, 0xdf, 0x01, 0xf0, 0x0b, 0x44, 0x44, 0x20, 0x41, 0x1e, 0x1e, 0x2c, 0x37, 0x0a, 0x04, 0x0b, 0x37, 0x37, 0x37,
+  0x3e, 0x3e, 0x41, 0x3b, 0x3e, 0x3b, 0x41, 0x41, 0x3b, 0x37, 0x09, 0x88, 0xe1, 0x01, 0xf2, 0x09, 0x95, 0x04, 0x14, 0x2c, 0x37, 0x3e, 0x41, 0x3e,
+  0x3e, 0x0e, 0x00, 0x83, 0x00, 0x88, 0x1e, 0x35, 0x3e, 0x2c, 0x8f, 0x7e, 0x83, 0x00, 0x7f, 0x1f, 0xdf, 0x01, 0x20, 0x3b, 0x39, 0x01, 0x00, 0xf0,
+  0x12, 0x35, 0x39, 0x35, 0x3b, 0x3b, 0x3b, 0x35, 0x1e, 0x8e, 0x0e, 0x0a, 0x94, 0x8d, 0x95, 0x07, 0x0e, 0x17, 0x87, 0x7a, 0x7a, 0x7f, 0x0a, 0x13,
+  0x0a, 0x91, 0x81, 0x79, 0x91, 0x9a, 0x7f, 0x89, 0x77, 0x72, 0x01, 0x00, 0xf2, 0x09, 0x6f, 0x6f, 0x6f, 0x83, 0x0e, 0x17, 0x83, 0x7d, 0x74, 0x7a,
+  0x00, 0x08, 0x1f, 0x1a, 0x1f, 0x27, 0x27, 0x27, 0x31, 0x27, 0x27, 0x26, 0x26, 0x27, 0xd5, 0x01, 0x00, 0xdc, 0x01, 0x20, 0x31, 0x26, 0x02, 0x00,
+  0x44, 0x26, 0x26, 0x1a, 0x26, 0xe1, 0x01, 0xf0, 0x12, 0x0f, 0x01, 0x7e, 0x01, 0x06, 0x08, 0x06, 0x0b, 0x95, 0x86, 0x9a, 0x9a, 0x82, 0x6e, 0x85,
+  0x80, 0x91, 0x99, 0x89, 0x74, 0x60, 0x5c, 0x5c, 0x5c, 0x66, 0x89, 0x91, 0x79, 0x72, 0x8a, 0x8e, 0x8e, 0x8a, 0xf0, 0x01, 0xf0, 0x02, 0x71, 0x6d,
+  0x64, 0x5f, 0x5b, 0x58, 0x71, 0x77, 0x66, 0x7a, 0x7f, 0x87, 0x85, 0x82, 0x62, 0x64, 0x67, 0xd6, 0x01, 0x04, 0x01, 0x00, 0x03, 0xde, 0x01, 0x00,
+  0x04, 0x00, 0x01, 0x01, 0x00, 0x01, 0xdf, 0x01, 0x01, 0xe1, 0x01, 0x08, 0x01, 0x00, 0x20, 0x5a, 0x5b, 0x02, 0x00, 0x33, 0x58, 0x58, 0x58, 0xdc,
+  0x01, 0xb1, 0x53, 0x53, 0xa3, 0xa3, 0xa2, 0xa3, 0xa2, 0xa2, 0xa2, 0xa3, 0xa2, 0xe4, 0x01, 0xa2, 0x56, 0x58, 0x5e, 0x5c, 0x5f, 0x5f, 0x62, 0x62,
+  0x67, 0x66, 0xe1, 0x01, 0xf1, 0x03, 0x73, 0x6f, 0x73, 0x72, 0x73, 0x74, 0x74, 0x74, 0x77, 0x78, 0x77, 0x79, 0x7b, 0x79, 0x7a, 0x7c, 0x7a, 0x7d,
+  0x02, 0x00, 0xf0, 0x05, 0x78, 0x72, 0x73, 0x74, 0x78, 0x74, 0x78, 0x7c, 0x7a, 0x7d, 0x7f, 0x80, 0x80, 0x80, 0x83, 0x81, 0x83, 0x86, 0x83, 0x86,
+  0x03, 0x00, 0x70, 0x86, 0x87, 0x02, 0x87, 0x87, 0x86, 0x8a, 0x02, 0x00, 0x81, 0x02, 0x8a, 0x8a, 0x8a, 0x8d, 0x8d, 0x8e, 0x8d, 0xdf, 0x01, 0x50,
+  0x8e, 0x93, 0x94, 0x93, 0x03, 0xdf, 0x01, 0x11, 0x03, 0xe1, 0x01, 0x01, 0x01, 0x00, 0x80, 0x04, 0x99, 0x99, 0x05, 0x99, 0x05, 0x04, 0x05, 0x03,
+  0x00, 0x30, 0x05, 0x05, 0x08, 0x02, 0x00, 0x05, 0x01, 0x00, 0x20, 0x09, 0x09, 0x05, 0x00, 0x00, 0xe1, 0x01, 0x54, 0x09, 0x0b, 0x08, 0x0e, 0x09,
+  0x02, 0x00, 0x11, 0x0b, 0xe1, 0x01, 0x01, 0x05, 0x00, 0x01, 0x01, 0x00, 0x90, 0x25, 0x04, 0x32, 0x44, 0x44, 0x3f, 0x20, 0x03, 0x37, 0xdc, 0x01,
+  0x02, 0x01, 0x00, 0x60, 0x37, 0x2c, 0x20, 0x18, 0x01, 0x03, 0xd4, 0x03, 0x01, 0xdf, 0x01, 0x01, 0xc0, 0x03, 0x10, 0x04, 0xe0, 0x01, 0xf1, 0x0a,
+  0x88, 0x88, 0x00, 0x01, 0x03, 0x35, 0x3e, 0x41, 0x3e, 0x37, 0x05, 0x00, 0x7f, 0x7f, 0x00, 0x95, 0x25, 0x3e, 0x37, 0x0e, 0x00, 0x7e, 0x7f, 0x03,
+  0x35, 0xdf, 0x01, 0x10, 0x39, 0xbd, 0x03, 0x50, 0x39, 0x35, 0x1f, 0x1f, 0x39, 0xe0, 0x01, 0xf0, 0x09, 0x0b, 0x00, 0x14, 0x14, 0x97, 0x7f, 0x91,
+  0x0a, 0x0c, 0x05, 0x86, 0x83, 0x80, 0x91, 0x14, 0x25, 0x88, 0x86, 0x91, 0x79, 0x9a, 0x94, 0x80, 0x92, 0xe0, 0x01, 0xf1, 0x03, 0x6f, 0x6f, 0x6f,
+  0x6f, 0x72, 0x89, 0x09, 0x1e, 0x79, 0x72, 0x80, 0x74, 0x6f, 0x99, 0x27, 0x27, 0x27, 0x1a, 0xe1, 0x01, 0x79, 0x26, 0x27, 0x26, 0x31, 0x27, 0x31,
+  0x1a, 0xdf, 0x01, 0x03, 0xc0, 0x03, 0x10, 0x1a, 0xe7, 0x01, 0xf9, 0x26, 0x06, 0x93, 0x0f, 0x06, 0x0f, 0x08, 0x73, 0x72, 0x66, 0x83, 0x9b, 0x0b,
+  0x05, 0x0a, 0x95, 0x83, 0x9a, 0x7f, 0x6c, 0x81, 0x8c, 0x6e, 0x5a, 0x6f, 0x8d, 0x79, 0x79, 0x87, 0x8a, 0x87, 0x87, 0x77, 0x82, 0x7c, 0x5f, 0x5a,
+  0x5e, 0x5e, 0x56, 0x54, 0x56, 0x58, 0x6d, 0x6f, 0x6b, 0x7a, 0x77, 0x83, 0x83, 0x85, 0x79, 0x76, 0x75, 0xe1, 0x01, 0x05, 0xe3, 0x01, 0x04, 0x01,
+  0x00, 0x01, 0xe0, 0x01, 0x03, 0xe2, 0x01, 0x22, 0x5b, 0x5e, 0xd9, 0x01, 0x41, 0x5b, 0x58, 0x57, 0x58, 0xda, 0x01, 0x00, 0xdc, 0x01, 0x22, 0xa3,
+  0x52, 0xdc, 0x01, 0x05, 0x01, 0x00, 0xd2, 0xa3, 0xa3, 0xa3, 0x56, 0x58, 0x5a, 0x5e, 0x5f, 0x5f, 0x61, 0x62, 0x67, 0x67, 0xc3, 0x03, 0x53, 0x6e,
+  0x72, 0x73, 0x72, 0x73, 0xe2, 0x01, 0xf0, 0x09, 0x7b, 0x79, 0x7a, 0x79, 0x7a, 0x7a, 0x7a, 0x7d, 0x7a, 0x7a, 0x79, 0x79, 0x7a, 0x7c, 0x7b, 0x7c,
+  0x7a, 0x80, 0x7d, 0x80, 0x81, 0x7f, 0x81, 0x83, 0x02, 0x00, 0x60, 0x83, 0x86, 0x83, 0x87, 0x86, 0x87, 0xc0, 0x03, 0xf0, 0x01, 0x87, 0x89, 0x86,
+  0x87, 0x87, 0x88, 0x87, 0x87, 0x88, 0x89, 0x88, 0x8d, 0x8a, 0x8d, 0x8d, 0x8a, 0xe2, 0x01, 0x21, 0x94, 0x8e, 0xe3, 0x01, 0x30, 0x95, 0x93, 0x99,
+  0x04, 0x00, 0x01, 0xe1, 0x01, 0x01, 0xc5, 0x03, 0x30, 0x04, 0x99, 0x05, 0xc0, 0x03, 0x11, 0x04, 0xc1, 0x03, 0x00, 0xe0, 0x01, 0x00, 0x04, 0x00,
+  0x0b, 0x01, 0x00, 0x31, 0x09, 0x08, 0x0b, 0xce, 0x03, 0x00, 0x02, 0x00, 0x00, 0xd2, 0x03, 0x00, 0xe7, 0x01, 0x02, 0xe3, 0x01, 0xa3, 0x0b, 0x2c,
+  0x03, 0x1e, 0x32, 0x32, 0x3f, 0x37, 0x04, 0x3f, 0xbf, 0x03, 0xf0, 0x09, 0x44, 0x41, 0x44, 0x32, 0x1e, 0x04, 0x01, 0x8d, 0x0e, 0x09, 0x18, 0x1e,
+  0x37, 0x3e, 0x3b, 0x41, 0x3b, 0x3b, 0x3b, 0x3e, 0x41, 0x3b, 0x37, 0x99, 0xde, 0x01, 0x00, 0x01, 0x00, 0x10, 0x8e, 0xe0, 0x01, 0xf2, 0x00, 0x35,
+  0x94, 0x00, 0x7f, 0x7f, 0x83, 0x00, 0x09, 0x37, 0x37, 0x35, 0x02, 0x00, 0x7e, 0x08, 0xdf, 0x01, 0x00, 0xde, 0x01, 0x50, 0x39, 0x2d, 0x2d, 0x25,
+  0x35, 0x0b, 0x00, 0xf1, 0x0a, 0x35, 0x8f, 0x00, 0x8d, 0x14, 0x07, 0x7a, 0x8d, 0x0b, 0x91, 0x8a, 0x8d, 0x89, 0x79, 0x05, 0x18, 0x25, 0x9a, 0x9a,
+  0x98, 0x74, 0x8d, 0x14, 0x9b, 0x83, 0xdd, 0x01, 0xf1, 0x05, 0x6f, 0x6f, 0x89, 0x95, 0x0b, 0x1f, 0x1f, 0x72, 0x77, 0x7b, 0x6f, 0x00, 0x1f, 0x27,
+  0x27, 0x26, 0x2d, 0x26, 0x27, 0x26, 0xc0, 0x03, 0x00, 0xe3, 0x01, 0x02, 0x01, 0x00, 0x00, 0xd6, 0x01, 0x50, 0x26, 0x1a, 0x1a, 0x1a, 0x0f, 0xe1,
+  0x01, 0x20, 0x1a, 0x1a, 0xe1, 0x01, 0xf3, 0x2a, 0x1a, 0x1a, 0x13, 0x1a, 0x13, 0x0e, 0x6e, 0x67, 0x60, 0x62, 0x87, 0x08, 0x05, 0x91, 0x79, 0x6f,
+  0x91, 0x9a, 0x83, 0x7e, 0x92, 0x92, 0x6e, 0x00, 0x8a, 0x87, 0x88, 0x8a, 0x83, 0x6f, 0x6c, 0x66, 0x78, 0x6e, 0x67, 0x6d, 0x71, 0x68, 0x5e, 0x64,
+  0x5b, 0x56, 0x6c, 0x7b, 0x7a, 0x7b, 0x72, 0x7a, 0x80, 0x80, 0x77, 0x6e, 0x71, 0x71, 0x5e, 0x5b, 0x56, 0x9d, 0x05, 0x03, 0x01, 0x00, 0x10, 0x5b,
+  0x03, 0x00, 0x08, 0xe6, 0x01, 0x02, 0xda, 0x01, 0x20, 0x58, 0x57, 0xd5, 0x01, 0x30, 0x56, 0x56, 0x55, 0xd9, 0x01, 0x10, 0x54, 0xb5, 0x03, 0x01,
+  0xb7, 0x03, 0x09, 0xdd, 0x01, 0x01, 0x01, 0x00, 0x63, 0xa3, 0xa3, 0x56, 0x56, 0x5a, 0x5e, 0xe2, 0x01, 0x40, 0x66, 0x6c, 0x6a, 0x6e, 0xe3, 0x01,
+  0x20, 0x6e, 0x72, 0xa8, 0x05, 0x00, 0xe4, 0x01, 0x00, 0xe1, 0x01, 0x00, 0xc6, 0x03, 0xf2, 0x02, 0x7c, 0x7a, 0x78, 0x7a, 0x77, 0x7a, 0x7c, 0x7a,
+  0x7a, 0x7a, 0x80, 0x7a, 0x80, 0x80, 0x7f, 0x81, 0x83, 0xc3, 0x03, 0x10, 0x83, 0xdf, 0x01, 0x03, 0x02, 0x00, 0x20, 0x88, 0x87, 0xc0, 0x03, 0x01,
+  0x01, 0x00, 0x01, 0xe1, 0x01, 0x01, 0xe3, 0x01, 0x01, 0xe4, 0x01, 0x20, 0x95, 0x93, 0xdb, 0x01, 0x00, 0x01, 0x00, 0x30, 0x05, 0x99, 0x05, 0xe3,
+  0x01, 0x01, 0xe2, 0x01, 0x00, 0x01, 0x00, 0x00, 0xe1, 0x01, 0x00, 0xe8, 0x01, 0x01, 0x09, 0x00, 0x00, 0xdc, 0x01, 0x04, 0x19, 0x00, 0x00, 0x1c,
+  0x00, 0x00, 0x05, 0x00, 0x01, 0x15, 0x00, 0x00, 0xf4, 0x01, 0xf4, 0x00, 0x0b, 0x0b, 0x0e, 0x0b, 0x0b, 0x0e, 0x3f, 0x09, 0x03, 0x03, 0x09, 0x11,
+  0x0e, 0x18, 0x41, 0xe0, 0x01, 0xe0, 0x44, 0x44, 0x41, 0x1e, 0x8f, 0x01, 0x01, 0x8f, 0x08, 0x03, 0x03, 0x2c, 0x3b, 0x41, 0x9d, 0x05, 0x00, 0xc0,
+  0x03, 0x10, 0x03, 0xdc, 0x01, 0x00, 0x01, 0x00, 0x20, 0x02, 0x35, 0x0f, 0x00, 0xe5, 0x8a, 0x00, 0x83, 0x00, 0x7f, 0x7e, 0x02, 0x25, 0x3b, 0x37,
+  0x13, 0x7e, 0x00, 0x1e, 0xde, 0x01, 0x51, 0x39, 0x39, 0x35, 0x13, 0x0e, 0x80, 0x07, 0xf0, 0x1f, 0x25, 0x00, 0x79, 0x79, 0x9a, 0x87, 0x8d, 0x91,
+  0x97, 0x8a, 0x9a, 0x07, 0x8a, 0x79, 0x8c, 0x18, 0x14, 0x0e, 0x11, 0x87, 0x79, 0x89, 0x07, 0x85, 0x74, 0x6f, 0x72, 0x72, 0x6f, 0x6b, 0x6f, 0x7a,
+  0x07, 0x0a, 0x13, 0x13, 0x1f, 0x72, 0x6c, 0x73, 0x88, 0x13, 0x27, 0x27, 0x0f, 0x1a, 0xde, 0x01, 0x80, 0x27, 0x1a, 0x0f, 0x1a, 0x26, 0x27, 0x0f,
+  0x06, 0xdd, 0x01, 0x02, 0xdf, 0x01, 0x31, 0x27, 0x1a, 0x06, 0xe0, 0x01, 0x30, 0x1a, 0x0f, 0x1a, 0x78, 0x07, 0xf1, 0x2c, 0x0f, 0x1a, 0x13, 0x0f,
+  0x08, 0x0f, 0x0e, 0x0b, 0x02, 0x6c, 0x5f, 0x6f, 0x95, 0x02, 0x73, 0x6c, 0x6e, 0x91, 0x8f, 0x73, 0x6e, 0x89, 0x8c, 0x91, 0x91, 0x8e, 0x8e, 0x8e,
+  0x00, 0x83, 0x79, 0x79, 0x6f, 0x7c, 0x6c, 0x71, 0x5a, 0x6d, 0x76, 0x7c, 0x71, 0x5e, 0x5b, 0x72, 0x76, 0x77, 0x73, 0x72, 0x6c, 0x76, 0x7b, 0x6c,
+  0x58, 0x57, 0x5f, 0x68, 0x68, 0x5e, 0x54, 0x01, 0x00, 0x06, 0xe6, 0x01, 0x01, 0xdf, 0x01, 0x01, 0x02, 0x00, 0x12, 0x58, 0x02, 0x00, 0x04, 0xae,
+  0x03, 0x60, 0x53, 0x53, 0x53, 0xa4, 0xa3, 0xa4, 0xda, 0x01, 0x0e, 0xd7, 0x01, 0x06, 0x01, 0x00, 0x02, 0xa5, 0x05, 0x90, 0x57, 0x5a, 0x5e, 0x5e,
+  0x5e, 0x61, 0x61, 0x61, 0x65, 0x01, 0x00, 0x43, 0x67, 0x69, 0x67, 0x69, 0x8c, 0x07, 0x61, 0x74, 0x74, 0x77, 0x77, 0x77, 0x79, 0x02, 0x00, 0x40,
+  0x74, 0x74, 0x77, 0x74, 0xb3, 0x05, 0x00, 0x94, 0x07, 0x60, 0x80, 0x7f, 0x80, 0x83, 0x83, 0x7f, 0xe1, 0x01, 0x00, 0xc5, 0x03, 0x00, 0x02, 0x00,
+  0x50, 0x87, 0x87, 0x89, 0x87, 0x02, 0xa4, 0x05, 0x00, 0xdf, 0x01, 0x00, 0xe1, 0x01, 0x30, 0x8e, 0x8e, 0x8e, 0x84, 0x07, 0x03, 0xe1, 0x01, 0x11,
+  0x95, 0xc3, 0x03, 0x04, 0x01, 0x00, 0x20, 0x05, 0x04, 0xa8, 0x05, 0x04, 0xd3, 0x01, 0x01, 0xd5, 0x01, 0x11, 0x99, 0xcb, 0x01, 0x00, 0xdd, 0x03,
+  0x00, 0x21, 0x00, 0x00, 0x01, 0x00, 0x30, 0x05, 0x05, 0x99, 0x18, 0x02, 0x11, 0x05, 0x12, 0x02, 0xf0, 0x01, 0x05, 0x08, 0x09, 0x08, 0x08, 0x0b,
+  0x08, 0x37, 0x18, 0x03, 0x8e, 0x18, 0x18, 0x07, 0x44, 0x37, 0xe0, 0x01, 0x00, 0x04, 0x00, 0xc0, 0x44, 0x44, 0x32, 0x18, 0x04, 0x01, 0x8e, 0x03,
+  0x0e, 0x05, 0x01, 0x1f, 0x7c, 0x07, 0x01, 0x61, 0x09, 0x90, 0x37, 0x99, 0x88, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0x51, 0x3b, 0x3e,
+  0x2c, 0x88, 0x83, 0x59, 0x09, 0x40, 0x0b, 0x37, 0x3b, 0x2c, 0xb2, 0x05, 0x50, 0x3b, 0x3b, 0x35, 0x39, 0x35, 0xdf, 0x01, 0x50, 0x39, 0x2d, 0x1f,
+  0x04, 0x2d, 0xaa, 0x05, 0xf0, 0x09, 0x25, 0x99, 0x7f, 0x00, 0x07, 0x9a, 0x11, 0x14, 0x7f, 0x95, 0x94, 0x8e, 0x9a, 0x87, 0x05, 0x0c, 0x08, 0x0a,
+  0x8e, 0x81, 0x8a, 0x97, 0x9a, 0x80, 0xbf, 0x03, 0xf5, 0x0f, 0x6b, 0x6e, 0x6b, 0x8d, 0x9b, 0x13, 0x1f, 0x1f, 0x1f, 0x8e, 0x95, 0x05, 0x13, 0x1a,
+  0x1f, 0x1a, 0x1f, 0x0f, 0x1f, 0x26, 0x1f, 0x13, 0x09, 0x0b, 0x0f, 0x27, 0x26, 0x1a, 0x1a, 0x0f, 0x99, 0x05, 0xa0, 0x26, 0x1a, 0x0f, 0x00, 0x06,
+  0x1a, 0x1a, 0x1a, 0x99, 0x0f, 0xde, 0x01, 0x00, 0xe0, 0x01, 0xf0, 0x2b, 0x0f, 0x00, 0x79, 0x05, 0x95, 0x95, 0x98, 0x9a, 0x92, 0x8b, 0x95, 0x79,
+  0x5f, 0x60, 0x79, 0x91, 0x82, 0x73, 0x71, 0x67, 0x67, 0x80, 0x87, 0x8e, 0x93, 0x93, 0x8a, 0x8a, 0x87, 0x83, 0x75, 0x71, 0x67, 0x64, 0x58, 0x62,
+  0x7a, 0x7b, 0x64, 0x5e, 0x6d, 0x71, 0x72, 0x6f, 0x60, 0x62, 0x58, 0x64, 0x66, 0x6c, 0x64, 0x56, 0x5b, 0x5c, 0x67, 0x62, 0x57, 0x56, 0xe0, 0x01,
+  0x08, 0xe2, 0x01, 0x01, 0x01, 0x00, 0x40, 0x56, 0x56, 0x56, 0x54, 0xaa, 0x03, 0x00, 0x87, 0x05, 0x01, 0xaf, 0x03, 0x10, 0xa4, 0x42, 0x09, 0x00,
+  0xba, 0x03, 0x01, 0xc6, 0x01, 0x00, 0x05, 0x00, 0x0f, 0x01, 0x00, 0x04, 0x00, 0x2d, 0x00, 0xf0, 0x02, 0x53, 0xa3, 0x53, 0x53, 0x55, 0x55, 0x55,
+  0x58, 0x55, 0x58, 0x56, 0x55, 0x55, 0x5a, 0x5a, 0x5a, 0x5c, 0x74, 0x09, 0x32, 0x6a, 0x6a, 0x6e, 0x6f, 0x09, 0x31, 0x74, 0x77, 0x74, 0x07, 0x00,
+  0x02, 0x01, 0x00, 0x70, 0x77, 0x77, 0x7a, 0x77, 0x7d, 0x7f, 0x7d, 0xe5, 0x01, 0x50, 0x7f, 0x80, 0x81, 0x83, 0x83, 0xab, 0x05, 0x02, 0xe3, 0x01,
+  0x30, 0x87, 0x8a, 0x86, 0xa2, 0x05, 0x03, 0xe2, 0x01, 0x01, 0xc1, 0x03, 0x20, 0x94, 0x93, 0x01, 0x00, 0x06, 0xc2, 0x03, 0x00, 0x65, 0x09, 0x01,
+  0x86, 0x07, 0x10, 0x99, 0xd9, 0x01, 0x00, 0xe0, 0x01, 0x00, 0x01, 0x00, 0x00, 0xec, 0x01, 0x01, 0x0d, 0x00, 0x00, 0xb7, 0x05, 0x00, 0x10, 0x00,
+  0x00, 0xeb, 0x03, 0x01, 0x01, 0x00, 0x00, 0xf1, 0x01, 0x10, 0x05, 0x10, 0x02, 0x01, 0xcc, 0x03, 0xa0, 0x17, 0x3f, 0x41, 0x0c, 0x0b, 0x18, 0x32,
+  0x2c, 0x32, 0x3e, 0xde, 0x01, 0x10, 0x41, 0x02, 0x00, 0xa2, 0x0e, 0x14, 0x09, 0x01, 0x01, 0x93, 0x04, 0x0e, 0x04, 0x13, 0xa0, 0x05, 0x50, 0x3b,
+  0x3b, 0x3e, 0x35, 0x95, 0xdc, 0x01, 0xa0, 0x83, 0x00, 0x83, 0x00, 0x03, 0x37, 0x3b, 0x3e, 0x3e, 0x2c, 0xdd, 0x01, 0x90, 0x7f, 0x00, 0x7e, 0x88,
+  0x25, 0x3e, 0x3b, 0x18, 0x1f, 0xdf, 0x01, 0x10, 0x27, 0xdd, 0x01, 0x00, 0x01, 0x00, 0x20, 0x35, 0x2d, 0x06, 0x00, 0xf1, 0x1d, 0x2d, 0x0e, 0x95,
+  0x7a, 0x94, 0x0e, 0x0a, 0x95, 0x18, 0x8d, 0x7f, 0x05, 0x9a, 0x13, 0x08, 0x95, 0x99, 0x88, 0x99, 0x07, 0x0a, 0x89, 0x93, 0x9a, 0x91, 0x74, 0x7b,
+  0x6b, 0x6f, 0x6b, 0x6b, 0x72, 0x89, 0x83, 0x99, 0x1f, 0x0f, 0x1f, 0x27, 0x1f, 0x1f, 0x0e, 0x06, 0x27, 0x77, 0x05, 0x70, 0x0b, 0x79, 0x72, 0x87,
+  0x03, 0x0f, 0x27, 0x88, 0x05, 0x01, 0xde, 0x01, 0x00, 0xdf, 0x01, 0x00, 0xee, 0x01, 0x70, 0x0f, 0x1a, 0x13, 0x8e, 0x7f, 0x08, 0x0f, 0xdd, 0x01,
+  0xf0, 0x2d, 0x0f, 0x1a, 0x0f, 0x06, 0x01, 0x8a, 0x67, 0x6a, 0x6d, 0x7b, 0x85, 0x92, 0x91, 0x99, 0x8f, 0x8d, 0x8a, 0x8a, 0x67, 0x58, 0x5e, 0x5a,
+  0x5a, 0x67, 0x6e, 0x77, 0x8e, 0x8e, 0x83, 0x7f, 0x89, 0x81, 0x5e, 0x56, 0x56, 0x58, 0x5e, 0x72, 0x82, 0x7f, 0x5b, 0x57, 0x5e, 0x5f, 0x6f, 0x6f,
+  0x6f, 0x6e, 0x5f, 0x5f, 0x71, 0x71, 0x71, 0x5e, 0x57, 0x5a, 0x60, 0x65, 0x61, 0x5b, 0xde, 0x01, 0x02, 0x01, 0x00, 0x60, 0x56, 0x57, 0x56, 0x57,
+  0x56, 0x54, 0x89, 0x05, 0x10, 0x56, 0x85, 0x05, 0x02, 0x02, 0x00, 0x01, 0x01, 0x00, 0x00, 0xdb, 0x01, 0x02, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x02,
+  0xe5, 0x01, 0x0f, 0x01, 0x00, 0x06, 0x01, 0x6c, 0x09, 0xf0, 0x10, 0xa3, 0xa3, 0x53, 0xa4, 0xa4, 0xa4, 0x53, 0xa4, 0x53, 0x55, 0x53, 0x55, 0x55,
+  0x53, 0x55, 0x58, 0x58, 0x5a, 0x5f, 0x62, 0x67, 0x6e, 0x6e, 0x6e, 0x6f, 0x6e, 0x72, 0x6e, 0x6e, 0x6e, 0x6a, 0xd1, 0x03, 0x50, 0x6f, 0x73, 0x6f,
+  0x72, 0x6f, 0x11, 0x00, 0xf1, 0x00, 0x72, 0x74, 0x7a, 0x7a, 0x7b, 0x7a, 0x77, 0x79, 0x74, 0x77, 0x7a, 0x80, 0x80, 0x80, 0x80, 0xca, 0x03, 0x00,
+  0xe0, 0x01, 0x00, 0x88, 0x07, 0x20, 0x02, 0x8a, 0x83, 0x07, 0x00, 0x02, 0x00, 0x82, 0x8e, 0x8e, 0x94, 0x8e, 0x8e, 0x93, 0x94, 0x8e, 0xc6, 0x03,
+  0x05, 0x69, 0x09, 0x01, 0xe1, 0x01, 0x00, 0x01, 0x00, 0x02, 0xcc, 0x01, 0x03, 0x01, 0x00, 0x11, 0x09, 0x03, 0x00, 0x10, 0x05, 0x6b, 0x09, 0x10,
+  0x09, 0xd2, 0x03, 0x01, 0xdc, 0x01, 0x01, 0x2b, 0x00, 0x00, 0x1e, 0x00, 0x00, 0xad, 0x05, 0xd0, 0x08, 0x08, 0x05, 0x3f, 0x3f, 0x3f, 0x44, 0x20,
+  0x04, 0x0e, 0x1e, 0x04, 0x3e, 0xbb, 0x03, 0x00, 0xc4, 0x03, 0xc4, 0x41, 0x14, 0x18, 0x37, 0x04, 0x88, 0x04, 0x0a, 0x08, 0x95, 0x09, 0x35, 0xe1,
+  0x01, 0x60, 0x2c, 0x03, 0x88, 0x00, 0x7f, 0x88, 0xd4, 0x01, 0xf0, 0x03, 0x99, 0x3b, 0x3e, 0x3b, 0x3e, 0x25, 0x00, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f,
+  0x00, 0x7e, 0x0e, 0x35, 0x3e, 0x35, 0x22, 0x00, 0xb1, 0x27, 0x0e, 0x35, 0x39, 0x39, 0x31, 0x31, 0x31, 0x2d, 0x39, 0x3b, 0xc8, 0x03, 0xf0, 0x17,
+  0x2c, 0x88, 0x00, 0x05, 0x0a, 0x05, 0x8a, 0x95, 0x07, 0x83, 0x7e, 0x9a, 0x99, 0x9a, 0x13, 0x05, 0x18, 0x05, 0x07, 0x25, 0x89, 0x79, 0x8a, 0x9a,
+  0x83, 0x72, 0x72, 0x6b, 0x6a, 0x6b, 0x66, 0x6b, 0x6a, 0x72, 0x94, 0x0b, 0x06, 0x27, 0xc7, 0x01, 0xc1, 0x06, 0x26, 0x0f, 0x1a, 0x06, 0x93, 0x09,
+  0x83, 0x62, 0x74, 0x89, 0x01, 0x8f, 0x05, 0x00, 0xdd, 0x01, 0x00, 0x6c, 0x07, 0x00, 0xb2, 0x03, 0xa2, 0x0f, 0x05, 0x06, 0x08, 0x0b, 0x87, 0x72,
+  0x8e, 0x08, 0x0f, 0x01, 0x00, 0xf3, 0x29, 0x06, 0x05, 0x7f, 0x5a, 0x62, 0x58, 0x58, 0x5e, 0x66, 0x73, 0x8d, 0x91, 0x94, 0x8e, 0x91, 0x85, 0x67,
+  0x5f, 0x56, 0x5a, 0x67, 0x67, 0x6e, 0x89, 0x87, 0x7d, 0x85, 0x82, 0x7c, 0x57, 0x56, 0x54, 0x64, 0x7b, 0x7d, 0x83, 0x7b, 0x5e, 0x56, 0x5b, 0x62,
+  0x6e, 0x6f, 0x72, 0x72, 0x71, 0x6d, 0x5f, 0x5f, 0x6d, 0x5b, 0x5a, 0x5e, 0x60, 0x66, 0x5e, 0xc0, 0x03, 0x20, 0x54, 0x53, 0x05, 0x00, 0x00, 0x07,
+  0x00, 0x20, 0x53, 0x52, 0x7f, 0x03, 0x00, 0xdb, 0x01, 0x02, 0x02, 0x00, 0x00, 0xab, 0x01, 0x00, 0x9d, 0x05, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00,
+  0x02, 0x13, 0x00, 0x00, 0xc9, 0x01, 0x0f, 0x01, 0x00, 0x05, 0x01, 0x32, 0x00, 0x10, 0x55, 0x02, 0x00, 0x04, 0x05, 0x00, 0x60, 0xa4, 0x55, 0x55,
+  0x55, 0x5a, 0x5f, 0x37, 0x0d, 0xf0, 0x09, 0x6a, 0x6c, 0x6a, 0x67, 0x66, 0x62, 0x60, 0x62, 0x66, 0x66, 0x66, 0x6a, 0x6a, 0x6a, 0x6c, 0x6a, 0x6e,
+  0x6a, 0x6e, 0x6a, 0x6f, 0x73, 0x72, 0x74, 0x5a, 0x0a, 0xb0, 0x6e, 0x6f, 0x74, 0x77, 0x7a, 0x7a, 0x7a, 0x7f, 0x7a, 0x80, 0x7f, 0xc8, 0x03, 0x02,
+  0xe4, 0x01, 0x01, 0x4c, 0x0b, 0x01, 0xc6, 0x03, 0x20, 0x8e, 0x8e, 0xc3, 0x03, 0x10, 0x93, 0xdf, 0x01, 0x00, 0xc3, 0x03, 0x04, 0xc5, 0x03, 0x00,
+  0xdf, 0x01, 0x01, 0x05, 0x00, 0x00, 0xcf, 0x01, 0x02, 0x01, 0x00, 0x00, 0x4c, 0x09, 0x02, 0xe2, 0x01, 0x40, 0x09, 0x0b, 0x08, 0x0b, 0xd0, 0x01,
+  0x00, 0xd2, 0x01, 0x00, 0x21, 0x00, 0x01, 0xf2, 0x01, 0x00, 0x23, 0x00, 0x00, 0x2c, 0x00, 0x91, 0x44, 0x20, 0x25, 0x3f, 0x44, 0x3f, 0x32, 0x11,
+  0x0e, 0xa1, 0x05, 0x01, 0xc2, 0x03, 0xa4, 0x09, 0x37, 0x32, 0x25, 0x07, 0x1e, 0x88, 0x8e, 0x03, 0x0e, 0xdf, 0x01, 0x30, 0x3b, 0x2c, 0x01, 0x9d,
+  0x05, 0x00, 0x95, 0x05, 0x70, 0x0e, 0x3e, 0x3b, 0x3e, 0x3b, 0x1e, 0x00, 0xde, 0x01, 0x50, 0x7f, 0x00, 0x7e, 0x03, 0x2c, 0x0d, 0x0d, 0x40, 0x3b,
+  0x39, 0x09, 0x1f, 0xd6, 0x01, 0x51, 0x39, 0x2d, 0x2d, 0x2d, 0x2c, 0xca, 0x03, 0xf0, 0x16, 0x1f, 0x01, 0x05, 0x9a, 0x05, 0x0b, 0x8d, 0x05, 0x0b,
+  0x95, 0x93, 0x0b, 0x0a, 0x8e, 0x05, 0x0b, 0x1f, 0x25, 0x0e, 0x9a, 0x7f, 0x87, 0x79, 0x8c, 0x8f, 0x74, 0x6f, 0x6a, 0x63, 0x66, 0x63, 0x66, 0x6a,
+  0x6a, 0x80, 0x08, 0x0e, 0x4f, 0x09, 0x00, 0xd2, 0x01, 0xc3, 0x1a, 0x99, 0x99, 0x91, 0x60, 0x66, 0x66, 0x7a, 0x04, 0x06, 0x0f, 0x06, 0xdf, 0x01,
+  0xf0, 0x03, 0x06, 0x06, 0x06, 0x0f, 0x0f, 0x0f, 0x99, 0x01, 0x72, 0x79, 0x93, 0x99, 0x6a, 0x76, 0x89, 0x83, 0x05, 0x06, 0x01, 0x00, 0xf0, 0x1a,
+  0x99, 0x06, 0x93, 0x8a, 0x64, 0x70, 0x55, 0x55, 0x55, 0x56, 0x5a, 0x67, 0x6c, 0x7a, 0x91, 0x93, 0x91, 0x85, 0x85, 0x73, 0x6e, 0x7c, 0x7d, 0x85,
+  0x75, 0x6c, 0x5e, 0x67, 0x6d, 0x5f, 0x57, 0x56, 0x5b, 0x71, 0x7b, 0x7b, 0x83, 0x72, 0x5f, 0x71, 0x6f, 0x06, 0x06, 0xc0, 0x6f, 0x70, 0x6c, 0x58,
+  0x64, 0x67, 0x5e, 0x62, 0x60, 0x63, 0x60, 0x5a, 0xd8, 0x01, 0x20, 0x52, 0x54, 0xd6, 0x01, 0x30, 0x52, 0x53, 0x53, 0xdc, 0x01, 0x00, 0x9e, 0x01,
+  0x01, 0xd2, 0x01, 0x07, 0x01, 0x00, 0x03, 0x81, 0x07, 0x00, 0xe6, 0x01, 0x30, 0xa4, 0x53, 0xa4, 0xe2, 0x01, 0x0f, 0xa4, 0x05, 0x06, 0x01, 0x40,
+  0x00, 0x41, 0x53, 0x56, 0x56, 0x58, 0x01, 0x00, 0x40, 0x56, 0x55, 0x56, 0x55, 0x0b, 0x00, 0xf0, 0x00, 0x55, 0xa4, 0x55, 0x58, 0x5a, 0x61, 0x62,
+  0x65, 0x62, 0x67, 0x65, 0x5f, 0x5c, 0x5c, 0x5a, 0xb4, 0x05, 0x40, 0x5c, 0x5f, 0x60, 0x62, 0x01, 0x00, 0x61, 0x66, 0x66, 0x6a, 0x66, 0x6a, 0x66,
+  0x01, 0x00, 0x00, 0xc3, 0x05, 0x60, 0x74, 0x74, 0x79, 0x77, 0x80, 0x7a, 0xae, 0x05, 0x00, 0xe2, 0x01, 0x31, 0x86, 0x87, 0x88, 0xc5, 0x03, 0x01,
+  0xc6, 0x03, 0x01, 0x87, 0x07, 0x00, 0x2f, 0x0d, 0x00, 0xa7, 0x05, 0x01, 0x88, 0x07, 0x00, 0xe0, 0x01, 0x00, 0x01, 0x00, 0x00, 0xdf, 0x01, 0x02,
+  0x01, 0x00, 0x02, 0xc4, 0x01, 0x03, 0x01, 0x00, 0x00, 0xdd, 0x01, 0x40, 0x0b, 0x08, 0x0b, 0x09, 0x44, 0x0b, 0x00, 0x07, 0x0f, 0x01, 0x40, 0x0b,
+  0x00, 0x3d, 0x0b, 0x10, 0x09, 0x45, 0x0b, 0x95, 0x0b, 0x44, 0x32, 0x07, 0x44, 0x32, 0x14, 0x1e, 0x0e, 0xe0, 0x01, 0xd0, 0x41, 0x41, 0x18, 0x1e,
+  0x1e, 0x20, 0x02, 0x1e, 0x0a, 0x03, 0x18, 0x1f, 0x37, 0xbc, 0x01, 0x00, 0xc1, 0x01, 0x10, 0x2c, 0x7f, 0x07, 0x00, 0xdf, 0x01, 0x90, 0x00, 0x25,
+  0x3e, 0x3e, 0x3b, 0x37, 0x18, 0x7e, 0x83, 0xc1, 0x03, 0x40, 0x0e, 0x1e, 0x99, 0x0e, 0x7d, 0x07, 0x40, 0x39, 0x2c, 0x03, 0x27, 0xb7, 0x03, 0x60,
+  0x31, 0x2d, 0x27, 0x27, 0x03, 0x27, 0xe3, 0x10, 0xf0, 0x18, 0x1f, 0x13, 0x14, 0x99, 0x0a, 0x0b, 0x13, 0x14, 0x13, 0x13, 0x13, 0x18, 0x0b, 0x7a,
+  0x87, 0x08, 0x13, 0x1f, 0x87, 0x7f, 0x00, 0x9b, 0x77, 0x8d, 0x0a, 0x89, 0x74, 0x6b, 0x66, 0x63, 0x66, 0x63, 0x6b, 0x6f, 0x74, 0x93, 0x1f, 0x26,
+  0x1f, 0xa8, 0x03, 0x00, 0x86, 0x05, 0x70, 0x13, 0x82, 0x5d, 0x6f, 0x62, 0x7f, 0x1f, 0x0c, 0x00, 0x01, 0x04, 0x00, 0xf1, 0x03, 0x0f, 0x01, 0x93,
+  0x0f, 0x0f, 0x06, 0x8e, 0x0b, 0x7f, 0x6f, 0x83, 0x9a, 0x94, 0x60, 0x60, 0x6f, 0x72, 0x99, 0xd4, 0x02, 0x70, 0x06, 0x8e, 0x93, 0x8d, 0x6c, 0x61,
+  0x56, 0xf6, 0x06, 0xf0, 0x1f, 0x5a, 0x58, 0x72, 0x8a, 0x8a, 0x85, 0x73, 0x79, 0x85, 0x86, 0x85, 0x6c, 0x67, 0x67, 0x5e, 0x58, 0x56, 0x5e, 0x5e,
+  0x56, 0x5b, 0x5e, 0x5f, 0x74, 0x72, 0x7a, 0x74, 0x72, 0x6e, 0x72, 0x6f, 0x6b, 0x6b, 0x6b, 0x6b, 0x6a, 0x62, 0x56, 0x5b, 0x5f, 0x5e, 0x65, 0x67,
+  0x63, 0x60, 0x5a, 0xde, 0x01, 0x90, 0x53, 0x52, 0x53, 0x56, 0x56, 0x53, 0x54, 0xa3, 0x52, 0xba, 0x01, 0x01, 0xa0, 0x01, 0x01, 0x01, 0x00, 0x25,
+  0x54, 0x53, 0x5b, 0x09, 0x02, 0x01, 0x00, 0x02, 0xde, 0x01, 0x00, 0x02, 0x00, 0x01, 0xe1, 0x01, 0x0f, 0xe3, 0x01, 0x01, 0x01, 0x9d, 0x05, 0x20,
+  0xa4, 0x53, 0xb1, 0x03, 0x00, 0xdb, 0x01, 0x00, 0xbd, 0x03, 0x30, 0x55, 0x55, 0x56, 0x88, 0x07, 0xb0, 0x55, 0x5a, 0x5e, 0x5c, 0x5e, 0x5c, 0x5c,
+  0x5e, 0x5a, 0x58, 0x5a, 0xfa, 0x01, 0x20, 0x58, 0x58, 0xe3, 0x01, 0xa0, 0x5c, 0x60, 0x62, 0x62, 0x66, 0x6a, 0x6a, 0x62, 0x62, 0x60, 0xed, 0x01,
+  0xf0, 0x06, 0x66, 0x6a, 0x6a, 0x6f, 0x6e, 0x6f, 0x72, 0x74, 0x74, 0x77, 0x7a, 0x77, 0x7a, 0x7f, 0x7f, 0x80, 0x83, 0x80, 0x83, 0x87, 0x83, 0x2f,
+  0x0d, 0x20, 0x8a, 0x88, 0x0f, 0x0f, 0x11, 0x8a, 0xc4, 0x03, 0x01, 0x01, 0x00, 0x20, 0x93, 0x8f, 0xf5, 0x00, 0x01, 0xa7, 0x05, 0x01, 0xdf, 0x01,
+  0x01, 0x05, 0x00, 0x00, 0xe0, 0x01, 0x02, 0xe3, 0x01, 0x00, 0x01, 0x00, 0x00, 0xc3, 0x03, 0x01, 0xdf, 0x01, 0x00, 0x02, 0x00, 0x00, 0xd7, 0x01,
+  0x00, 0x02, 0x00, 0x08, 0xff, 0x0e, 0x10, 0x0e, 0xd4, 0x01, 0x62, 0x44, 0x44, 0x14, 0x04, 0x02, 0x2c, 0xe0, 0x01, 0xd0, 0x44, 0x41, 0x44, 0x25,
+  0x03, 0x0b, 0x32, 0x8f, 0x01, 0x8e, 0x8e, 0x0b, 0x18, 0xfe, 0x0e, 0x00, 0xa1, 0x03, 0x30, 0x35, 0x2c, 0x88, 0xdc, 0x01, 0x50, 0x7f, 0x00, 0x83,
+  0x01, 0x2c, 0xc0, 0x03, 0xf1, 0x03, 0x18, 0x7f, 0x7e, 0x7f, 0x7e, 0x88, 0x01, 0x1e, 0x2c, 0x18, 0x00, 0x27, 0x3b, 0x39, 0x3b, 0x35, 0x1f, 0x0f,
+  0xdf, 0x01, 0x50, 0x39, 0x31, 0x2d, 0x39, 0x08, 0x0a, 0x00, 0xf1, 0x1a, 0x2d, 0x0b, 0x8d, 0x87, 0x7a, 0x91, 0x05, 0x0b, 0x13, 0x1f, 0x13, 0x1f,
+  0x25, 0x0e, 0x8a, 0x8a, 0x0c, 0x13, 0x18, 0x9b, 0x79, 0x87, 0x13, 0x99, 0x9a, 0x13, 0x9a, 0x89, 0x76, 0x77, 0x72, 0x60, 0x63, 0x76, 0x91, 0x01,
+  0x05, 0x1f, 0x1f, 0x1f, 0x1f, 0x86, 0x05, 0x80, 0x1a, 0x1a, 0x0e, 0x6f, 0x5c, 0x6a, 0x8a, 0x0b, 0x0d, 0x00, 0x01, 0x0f, 0x00, 0x00, 0x8b, 0x05,
+  0xf0, 0x02, 0x0f, 0x0f, 0x0e, 0x99, 0x8a, 0x9a, 0x94, 0x9a, 0x9a, 0x83, 0x60, 0x62, 0x76, 0x85, 0x89, 0x6f, 0x74, 0x47, 0x09, 0xf5, 0x31, 0x93,
+  0x93, 0x89, 0x67, 0x56, 0x55, 0x53, 0x55, 0x5f, 0x6d, 0x6a, 0x73, 0x83, 0x72, 0x80, 0x73, 0x67, 0x5f, 0x71, 0x7c, 0x80, 0x5b, 0x5b, 0x54, 0x5e,
+  0x57, 0x5b, 0x67, 0x6c, 0x5e, 0x75, 0x67, 0x62, 0x77, 0x7a, 0x7a, 0x6f, 0x6f, 0x6b, 0x6f, 0x6b, 0x62, 0x5a, 0x60, 0x66, 0x6a, 0x62, 0x5e, 0x5b,
+  0x64, 0x5e, 0x5e, 0x5c, 0x60, 0x5a, 0x58, 0x56, 0x53, 0x52, 0x53, 0x54, 0x55, 0x56, 0x55, 0x7a, 0x05, 0x05, 0xdf, 0x01, 0x06, 0x01, 0x00, 0x00,
+  0x1d, 0x00, 0x01, 0xdc, 0x01, 0x00, 0xde, 0x01, 0x12, 0xa4, 0xe0, 0x01, 0x0f, 0xe2, 0x01, 0x05, 0x00, 0x1a, 0x00, 0x00, 0x25, 0x00, 0x01, 0x9a,
+  0x05, 0x00, 0x63, 0x09, 0x50, 0x58, 0x56, 0x58, 0x55, 0x56, 0x81, 0x07, 0x90, 0x5a, 0x5a, 0x5a, 0x58, 0x58, 0x5e, 0x5c, 0x5a, 0x58, 0xe3, 0x01,
+  0x01, 0x01, 0x00, 0x11, 0x5f, 0xbe, 0x03, 0x70, 0x6a, 0x6a, 0x67, 0x66, 0x5f, 0x5c, 0x60, 0xe2, 0x01, 0x30, 0x6a, 0x6a, 0x6a, 0xb2, 0x05, 0x30,
+  0x6f, 0x6f, 0x6f, 0xe4, 0x01, 0x10, 0x7a, 0xc7, 0x03, 0x01, 0x71, 0x09, 0x00, 0xa9, 0x05, 0x02, 0x31, 0x0d, 0x00, 0xf5, 0x10, 0x00, 0x01, 0x00,
+  0x00, 0xc5, 0x03, 0x10, 0x94, 0xa5, 0x05, 0x03, 0xa7, 0x05, 0x01, 0xa3, 0x05, 0x02, 0xe2, 0x01, 0x03, 0xe0, 0x01, 0x02, 0xe3, 0x01, 0x20, 0x09,
+  0x09, 0xe5, 0x10, 0x31, 0x0b, 0x0b, 0x08, 0xdf, 0x01, 0x00, 0x02, 0x00, 0x06, 0x01, 0x00, 0xa3, 0x44, 0x3f, 0x44, 0x45, 0x44, 0x3f, 0x0e, 0x07,
+  0x0e, 0x37, 0x22, 0x0d, 0xc0, 0x3e, 0x41, 0x3f, 0x09, 0x25, 0x25, 0x0a, 0x8d, 0x01, 0x01, 0x8d, 0x04, 0xdc, 0x01, 0x02, 0xc0, 0x03, 0x11, 0x01,
+  0xbe, 0x03, 0xf0, 0x04, 0x7f, 0x00, 0x99, 0x37, 0x3b, 0x3e, 0x3b, 0x37, 0x0e, 0x7e, 0x7f, 0x7f, 0x88, 0x11, 0x14, 0x09, 0x11, 0x0b, 0x7e, 0xaf,
+  0x03, 0xf1, 0x37, 0x3b, 0x04, 0x1f, 0x39, 0x2d, 0x39, 0x31, 0x39, 0x2d, 0x2d, 0x39, 0x35, 0x27, 0x35, 0x31, 0x39, 0x31, 0x27, 0x0b, 0x99, 0x87,
+  0x7f, 0x0c, 0x99, 0x95, 0x08, 0x0b, 0x13, 0x25, 0x0f, 0x9a, 0x8a, 0x79, 0x8e, 0x8e, 0x0e, 0x83, 0x79, 0x0e, 0x13, 0x0a, 0x93, 0x09, 0x05, 0x8c,
+  0x6f, 0x89, 0x82, 0x63, 0x66, 0x89, 0x7f, 0x05, 0x1f, 0x13, 0x0e, 0x13, 0x7e, 0x06, 0x1a, 0x26, 0x1a, 0x06, 0x0f, 0x1a, 0x13, 0x79, 0x7a, 0x91,
+  0x13, 0xed, 0x01, 0x01, 0x01, 0x00, 0xf0, 0x2b, 0x06, 0x93, 0x06, 0x13, 0x0f, 0x0f, 0x05, 0x79, 0x62, 0x77, 0x6f, 0x85, 0x89, 0x7b, 0x6a, 0x60,
+  0x6a, 0x66, 0x6e, 0x75, 0x6f, 0x6e, 0x85, 0x87, 0x83, 0x8e, 0x93, 0x7a, 0x58, 0x5b, 0x55, 0x56, 0x5a, 0x75, 0x6e, 0x71, 0x77, 0x80, 0x7c, 0x6c,
+  0x5f, 0x57, 0x53, 0x58, 0x6c, 0x7c, 0x6d, 0x5b, 0x5b, 0x57, 0x56, 0x68, 0x6d, 0x6d, 0x71, 0x76, 0x75, 0x6e, 0x9c, 0x0c, 0xf0, 0x05, 0x6f, 0x6f,
+  0x6b, 0x6c, 0x5c, 0x58, 0x60, 0x60, 0x60, 0x6a, 0x64, 0x5f, 0x5e, 0x57, 0x55, 0x57, 0x5c, 0x58, 0x56, 0x56, 0x99, 0x05, 0x00, 0x68, 0x03, 0x00,
+  0xb0, 0x10, 0x03, 0x6b, 0x14, 0x00, 0xaa, 0x05, 0x0a, 0x01, 0x00, 0x01, 0xdc, 0x01, 0x00, 0x02, 0x00, 0x00, 0xdc, 0x01, 0x02, 0xdf, 0x01, 0x02,
+  0xe2, 0x01, 0x0b, 0x01, 0x00, 0x00, 0x16, 0x00, 0x00, 0x21, 0x00, 0x02, 0xdf, 0x01, 0x00, 0xd7, 0x01, 0x00, 0x01, 0x00, 0x00, 0xcc, 0x01, 0x90,
+  0x5e, 0x5a, 0x5e, 0x58, 0x58, 0x55, 0x58, 0x5c, 0x5e, 0x9c, 0x05, 0x70, 0x5e, 0x5c, 0x5f, 0x61, 0x60, 0x5f, 0x60, 0xca, 0x14, 0x30, 0x66, 0x67,
+  0x66, 0xbe, 0x03, 0x10, 0x60, 0xca, 0x03, 0x10, 0x6a, 0xed, 0x01, 0x00, 0x04, 0x00, 0x00, 0xe3, 0x01, 0x10, 0x72, 0x30, 0x0f, 0x00, 0xe2, 0x01,
+  0x02, 0xab, 0x05, 0x53, 0x83, 0x87, 0x83, 0x02, 0x87, 0xc6, 0x03, 0x01, 0xe3, 0x01, 0x02, 0x8c, 0x07, 0x00, 0x8a, 0x07, 0x05, 0x01, 0x00, 0x00,
+  0xde, 0x01, 0x01, 0x01, 0x00, 0x02, 0xe3, 0x01, 0x00, 0x69, 0x07, 0x04, 0xc4, 0x03, 0x00, 0xf0, 0x0e, 0x00, 0xa6, 0x14, 0x00, 0x03, 0x00, 0x80,
+  0x0e, 0x0e, 0x0e, 0x0f, 0x0e, 0x0f, 0x0e, 0x13, 0xd3, 0x01, 0x65, 0x44, 0x44, 0x1e, 0x25, 0x37, 0x18, 0xa1, 0x05, 0xb0, 0x3e, 0x18, 0x94, 0x04,
+  0x0e, 0x05, 0x8a, 0x03, 0x8e, 0x01, 0x2c, 0xdf, 0x01, 0x00, 0xe1, 0x01, 0x20, 0x35, 0x01, 0xdd, 0x01, 0x02, 0x51, 0x09, 0xe0, 0x3b, 0x35, 0x2c,
+  0x95, 0x7f, 0x7f, 0x7f, 0x7f, 0x94, 0x0e, 0x1e, 0x03, 0x1e, 0x25, 0x02, 0x02, 0x20, 0x35, 0x1a, 0x35, 0x0b, 0xf0, 0x25, 0x31, 0x31, 0x31, 0x27,
+  0x39, 0x39, 0x3b, 0x31, 0x39, 0x31, 0x31, 0x1f, 0x8e, 0x9b, 0x05, 0x0a, 0x0a, 0x94, 0x93, 0x8a, 0x13, 0x13, 0x1f, 0x13, 0x0b, 0x0b, 0x91, 0x00,
+  0x8e, 0x0e, 0x94, 0x0a, 0x13, 0x93, 0x8a, 0x91, 0x9a, 0x91, 0x80, 0x72, 0x76, 0x6f, 0x6b, 0x7b, 0x05, 0x99, 0x1f, 0x18, 0x87, 0x72, 0x83, 0x00,
+  0xbc, 0x10, 0x80, 0x26, 0x1a, 0x1a, 0x13, 0x14, 0x0a, 0x13, 0x13, 0x9b, 0x05, 0x01, 0x9d, 0x05, 0xf0, 0x1a, 0x1a, 0x0f, 0x0f, 0x8e, 0x8e, 0x0b,
+  0x05, 0x93, 0x62, 0x72, 0x62, 0x58, 0x5c, 0x62, 0x85, 0x85, 0x6a, 0x58, 0x5a, 0x5c, 0x65, 0x5a, 0x60, 0x5c, 0x60, 0x74, 0x89, 0x91, 0x79, 0x56,
+  0x58, 0x58, 0x55, 0x5c, 0x76, 0x62, 0x74, 0x7a, 0x7a, 0x67, 0x5b, 0x37, 0x09, 0xf0, 0x01, 0x56, 0x6d, 0x7c, 0x75, 0x5b, 0x54, 0x54, 0x5b, 0x64,
+  0x56, 0x5e, 0x6d, 0x5e, 0x5f, 0x62, 0x6b, 0x9f, 0x0b, 0xb0, 0x62, 0x65, 0x5f, 0x5f, 0x5e, 0x5c, 0x60, 0x65, 0x5b, 0x56, 0x54, 0x2b, 0x0b, 0x00,
+  0xbc, 0x01, 0x00, 0x0d, 0x09, 0x10, 0x55, 0x0a, 0x00, 0x00, 0x78, 0x07, 0x01, 0xe0, 0x01, 0x09, 0x01, 0x00, 0x13, 0xa4, 0x09, 0x0b, 0x01, 0xb8,
+  0x03, 0x02, 0x02, 0x00, 0x01, 0x01, 0x00, 0x01, 0xbf, 0x03, 0x0d, 0xe1, 0x01, 0x02, 0xe2, 0x01, 0x00, 0x2e, 0x00, 0x01, 0xe2, 0x01, 0x00, 0xe4,
+  0x01, 0x01, 0xe5, 0x01, 0x01, 0xbd, 0x03, 0x00, 0x3d, 0x06, 0x00, 0x08, 0x00, 0x30, 0x58, 0x5c, 0x5e, 0xae, 0x03, 0x31, 0x62, 0x65, 0x62, 0xdc,
+  0x01, 0x50, 0x5c, 0x60, 0x5c, 0x60, 0x5f, 0x9f, 0x05, 0x00, 0x83, 0x07, 0x01, 0xdf, 0x01, 0x80, 0x6a, 0x6a, 0x6f, 0x6f, 0x72, 0x6f, 0x72, 0x72,
+  0x94, 0x02, 0x02, 0x33, 0x0f, 0x40, 0x7a, 0x7a, 0x7a, 0x7a, 0xe5, 0x01, 0x51, 0x87, 0x87, 0x8a, 0x8d, 0x8a, 0x50, 0x0b, 0x00, 0x90, 0x07, 0x02,
+  0xa6, 0x05, 0x1a, 0x93, 0xc6, 0x03, 0x01, 0x01, 0x00, 0x00, 0xe0, 0x01, 0x01, 0x01, 0x00, 0x02, 0xa7, 0x05, 0x11, 0x0e, 0xbc, 0x12, 0x01, 0xdf,
+  0x01, 0x00, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0xd2, 0x01, 0x60, 0x44, 0x37, 0x37, 0x0b, 0x18, 0x35, 0x20, 0x0d, 0xe0, 0x41, 0x44, 0x3e, 0x37,
+  0x37, 0x25, 0x00, 0x01, 0x8f, 0x01, 0x8f, 0x0e, 0x99, 0x88, 0x3e, 0x09, 0x00, 0xdf, 0x01, 0x31, 0x3b, 0x35, 0x95, 0xdf, 0x01, 0x30, 0x7f, 0x00,
+  0x25, 0xe0, 0x01, 0x10, 0x1e, 0x3f, 0x0b, 0x80, 0x7f, 0x7f, 0x83, 0x8f, 0x18, 0x3b, 0x35, 0x3e, 0xd9, 0x10, 0x00, 0x3d, 0x0b, 0x00, 0xc0, 0x03,
+  0x10, 0x31, 0x5c, 0x09, 0xf0, 0x1e, 0x31, 0x31, 0x2d, 0x27, 0x7e, 0x8e, 0x99, 0x9a, 0x99, 0x8a, 0x0b, 0x0b, 0x13, 0x13, 0x13, 0x1f, 0x0b, 0x91,
+  0x0c, 0x87, 0x8d, 0x0a, 0x87, 0x05, 0x18, 0x93, 0x83, 0x05, 0x9a, 0x6f, 0x87, 0x7b, 0x6b, 0x6f, 0x80, 0x87, 0x1f, 0x27, 0x18, 0x93, 0x6a, 0x6a,
+  0x62, 0x8a, 0x1f, 0x4d, 0x09, 0x60, 0x1a, 0x0b, 0x99, 0x91, 0x87, 0x8d, 0x9f, 0x05, 0x00, 0xdf, 0x01, 0x00, 0xe0, 0x01, 0xf1, 0x18, 0x0e, 0x79,
+  0x7f, 0x94, 0x8a, 0x97, 0x83, 0x8c, 0x6e, 0x5a, 0x60, 0x5c, 0x72, 0x82, 0x76, 0x5c, 0x58, 0x55, 0x5a, 0x5a, 0x5f, 0x5a, 0x5c, 0x66, 0x7f, 0x77,
+  0x85, 0x5f, 0x56, 0x61, 0x67, 0x6e, 0x7b, 0x75, 0x74, 0x7a, 0x77, 0x67, 0x56, 0x57, 0x07, 0x40, 0x5b, 0x67, 0x75, 0x6d, 0xdb, 0x0e, 0xf0, 0x05,
+  0x54, 0x56, 0x64, 0x5f, 0x58, 0x5f, 0x5c, 0x66, 0x66, 0x6b, 0x62, 0x58, 0x58, 0x5c, 0x5f, 0x5a, 0x5c, 0x60, 0x62, 0x58, 0x2c, 0x0b, 0x20, 0x56,
+  0x56, 0x48, 0x16, 0x00, 0xdf, 0x01, 0x00, 0xe0, 0x01, 0x13, 0x52, 0x3c, 0x0b, 0x0b, 0xe1, 0x01, 0x00, 0xd1, 0x01, 0x08, 0x02, 0x00, 0x03, 0x01,
+  0x00, 0x00, 0xc9, 0x01, 0x0f, 0xdf, 0x01, 0x01, 0x00, 0x18, 0x00, 0x02, 0xe1, 0x01, 0x01, 0x17, 0x02, 0x00, 0xe3, 0x01, 0x00, 0xa8, 0x05, 0x01,
+  0xa7, 0x05, 0x00, 0x09, 0x00, 0x01, 0x05, 0x00, 0x00, 0x12, 0x0f, 0x10, 0x61, 0x5d, 0x09, 0x00, 0xba, 0x03, 0x00, 0x01, 0x00, 0x43, 0x62, 0x66,
+  0x66, 0x67, 0x4f, 0x0b, 0x22, 0x6e, 0x6e, 0xdb, 0x01, 0x01, 0x1c, 0x0f, 0x00, 0xdb, 0x01, 0x01, 0x02, 0x00, 0x01, 0x0c, 0x00, 0x40, 0x7a, 0x7f,
+  0x7f, 0x83, 0xa8, 0x05, 0x00, 0xc7, 0x03, 0x02, 0xc5, 0x03, 0x12, 0x8e, 0xc5, 0x03, 0x00, 0x6c, 0x09, 0x03, 0xe3, 0x01, 0x02, 0xe5, 0x01, 0x02,
+  0x30, 0x0b, 0x05, 0x01, 0x00, 0x10, 0x09, 0xc0, 0x03, 0x00, 0x01, 0x00, 0x01, 0xde, 0x01, 0x10, 0x0b, 0xc0, 0x03, 0x02, 0xe0, 0x01, 0x00, 0xf9,
+  0x0e, 0x20, 0x44, 0x2c, 0x2d, 0x1a, 0x00, 0x5e, 0x09, 0xc0, 0x1e, 0x04, 0x37, 0x37, 0x03, 0x88, 0x01, 0x02, 0x99, 0x02, 0x04, 0x00, 0x6c, 0x14,
+  0x70, 0x35, 0x39, 0x3b, 0x3b, 0x35, 0x35, 0x08, 0xdd, 0x01, 0x40, 0x7f, 0x00, 0x8e, 0x2c, 0xbf, 0x03, 0xb0, 0x08, 0x7a, 0x7f, 0x7a, 0x7f, 0x7a,
+  0x7e, 0x7f, 0x7e, 0x94, 0x2c, 0xbf, 0x03, 0x02, 0x01, 0x00, 0x00, 0xbf, 0x03, 0x00, 0xc7, 0x03, 0x00, 0x0a, 0x00, 0xf0, 0x04, 0x27, 0x13, 0x08,
+  0x99, 0x0b, 0x8a, 0x8d, 0x13, 0x0b, 0x13, 0x1f, 0x1f, 0x25, 0x05, 0x77, 0x8e, 0x79, 0x87, 0x91, 0x26, 0x0d, 0xf0, 0x03, 0x7f, 0x9b, 0x99, 0x8a,
+  0x91, 0x8a, 0x91, 0x91, 0x91, 0x05, 0x1f, 0x18, 0x9a, 0x72, 0x66, 0x66, 0x79, 0x0e, 0x2d, 0x0b, 0x92, 0x26, 0x08, 0x77, 0x66, 0x5c, 0x59, 0x5c,
+  0x77, 0x0e, 0xe1, 0x01, 0xf0, 0x04, 0x0f, 0x0f, 0x0f, 0x0b, 0x99, 0x79, 0x72, 0x62, 0x6a, 0x8a, 0x91, 0x8d, 0x7f, 0x66, 0x7b, 0x74, 0x6a, 0x76,
+  0x5f, 0x32, 0x01, 0xf2, 0x0f, 0x6d, 0x70, 0x6e, 0x82, 0x89, 0x87, 0x87, 0x89, 0x6d, 0x58, 0x6d, 0x7b, 0x74, 0x6e, 0x62, 0x6a, 0x80, 0x80, 0x7d,
+  0x5f, 0x54, 0x52, 0x54, 0x52, 0x54, 0x56, 0x56, 0x68, 0x71, 0x62, 0x20, 0x0b, 0x30, 0x5f, 0x66, 0x66, 0x2c, 0x03, 0x60, 0x5f, 0x5a, 0x5c, 0x62,
+  0x66, 0x62, 0xc0, 0x03, 0x40, 0x53, 0x54, 0x53, 0x5b, 0x2d, 0x05, 0x01, 0xe3, 0x0a, 0x25, 0x55, 0x55, 0xd6, 0x01, 0x01, 0x08, 0x00, 0x05, 0xe5,
+  0x01, 0x02, 0xb9, 0x03, 0x02, 0x98, 0x05, 0x04, 0x02, 0x00, 0x03, 0x01, 0x00, 0x00, 0xcb, 0x01, 0x0f, 0xe1, 0x01, 0x07, 0x01, 0xa5, 0x05, 0x00,
+  0x88, 0x07, 0x31, 0xa4, 0xa4, 0xa4, 0x1f, 0x0d, 0x00, 0x01, 0x00, 0x20, 0xa4, 0x55, 0x0e, 0x00, 0x00, 0x91, 0x02, 0x31, 0x5f, 0x60, 0x5f, 0xb3,
+  0x03, 0x00, 0x01, 0x00, 0x40, 0x66, 0x66, 0x66, 0x67, 0x87, 0x07, 0x03, 0xde, 0x01, 0x01, 0x12, 0x0f, 0x14, 0x72, 0xe1, 0x01, 0x10, 0x7a, 0x87,
+  0x07, 0x00, 0x01, 0x00, 0x30, 0x77, 0x79, 0x72, 0x93, 0x07, 0x12, 0x7f, 0xc4, 0x03, 0x00, 0x8d, 0x07, 0x03, 0x6f, 0x09, 0x06, 0xa8, 0x05, 0x02,
+  0xe2, 0x01, 0x00, 0xdf, 0x01, 0x0d, 0xc6, 0x03, 0x00, 0xa3, 0x05, 0x01, 0x02, 0x00, 0x00, 0xc7, 0x03, 0x00, 0xe1, 0x01, 0x00, 0x01, 0x00, 0x02,
+  0xe0, 0x01, 0x40, 0x41, 0x41, 0x37, 0x2c, 0xe0, 0x01, 0xf0, 0x01, 0x44, 0x44, 0x3e, 0x18, 0x88, 0x25, 0x3e, 0x14, 0x01, 0x88, 0x04, 0x2c, 0x25,
+  0x25, 0x01, 0x25, 0xc0, 0x03, 0x00, 0x85, 0x07, 0x03, 0xb3, 0x03, 0x61, 0x7e, 0x13, 0x37, 0x3b, 0x3b, 0x35, 0xfe, 0x0e, 0x70, 0x7a, 0x7f, 0x7a,
+  0x7a, 0x7a, 0x7e, 0x1f, 0xdf, 0x01, 0x30, 0x2d, 0x39, 0x31, 0xbe, 0x03, 0x42, 0x31, 0x2d, 0x0f, 0x27, 0x09, 0x00, 0xf0, 0x1a, 0x31, 0x27, 0x25,
+  0x13, 0x13, 0x18, 0x99, 0x7f, 0x99, 0x13, 0x13, 0x27, 0x27, 0x1f, 0x83, 0x87, 0x9a, 0x8a, 0x7f, 0x8e, 0x99, 0x05, 0x05, 0x8a, 0x72, 0x93, 0x0c,
+  0x08, 0x9a, 0x91, 0x8a, 0x93, 0x93, 0x13, 0x1f, 0x95, 0x6f, 0x63, 0x63, 0x72, 0x13, 0x0e, 0x0d, 0x90, 0x1a, 0x13, 0x8d, 0x6f, 0x63, 0x5d, 0x59,
+  0x5d, 0x62, 0xac, 0x12, 0x00, 0x9c, 0x05, 0x00, 0x8d, 0x12, 0xf0, 0x17, 0x77, 0x6c, 0x62, 0x80, 0x7a, 0x8a, 0x93, 0x91, 0x7f, 0x7a, 0x91, 0x8c,
+  0x6e, 0x5e, 0x69, 0x56, 0x6d, 0x68, 0x71, 0x5e, 0x6c, 0x80, 0x85, 0x72, 0x74, 0x80, 0x67, 0x58, 0x6c, 0x7b, 0x7b, 0x66, 0x6e, 0x6e, 0x77, 0x7b,
+  0x71, 0x71, 0xd5, 0x01, 0x71, 0x52, 0x54, 0x54, 0x67, 0x76, 0x71, 0x64, 0x0a, 0x00, 0x80, 0x5f, 0x65, 0x6a, 0x6a, 0x67, 0x5c, 0x56, 0x5a, 0x4e,
+  0x01, 0x30, 0x66, 0x62, 0x62, 0xc0, 0x03, 0x31, 0x56, 0x5c, 0x60, 0xaa, 0x0c, 0x30, 0x58, 0x5a, 0x58, 0x7f, 0x07, 0x01, 0xbe, 0x03, 0x07, 0x7a,
+  0x07, 0x1e, 0xa3, 0xbb, 0x03, 0x05, 0xdc, 0x01, 0x00, 0xde, 0x01, 0x00, 0xdd, 0x01, 0x0e, 0xdf, 0x01, 0x07, 0xe1, 0x01, 0x00, 0x67, 0x09, 0x00,
+  0x1d, 0x02, 0x01, 0xd4, 0x01, 0x00, 0x01, 0x00, 0x01, 0xdf, 0x01, 0x20, 0xa4, 0xa4, 0x43, 0x04, 0x10, 0x5c, 0xe1, 0x01, 0x00, 0xdd, 0x01, 0x10,
+  0x62, 0xdc, 0x01, 0x06, 0x97, 0x05, 0x01, 0xe2, 0x01, 0x00, 0x63, 0x19, 0x23, 0x72, 0x74, 0xe1, 0x01, 0x20, 0x77, 0x79, 0xe2, 0x01, 0x30, 0x7f,
+  0x7a, 0x7d, 0xd3, 0x14, 0x01, 0x0b, 0x00, 0x00, 0x73, 0x09, 0x00, 0xe4, 0x01, 0x00, 0x70, 0x09, 0x03, 0xc6, 0x03, 0x10, 0x93, 0x02, 0x00, 0x00,
+  0x01, 0x00, 0x03, 0xe4, 0x01, 0x00, 0xe1, 0x01, 0x00, 0x02, 0x00, 0x06, 0xe2, 0x01, 0x01, 0x09, 0x0f, 0x00, 0xa8, 0x05, 0xb0, 0x0e, 0x08, 0x0e,
+  0x0b, 0x0f, 0x0b, 0x0f, 0x0b, 0x0e, 0x0e, 0x0b, 0x50, 0x3e, 0x41, 0x44, 0x44, 0x44, 0x04, 0x00, 0xf8, 0xd7, 0x44, 0x3e, 0x41, 0x41, 0x44, 0x41,
+  0x41, 0x41, 0x25, 0x88, 0x0b, 0x37, 0x3e, 0x18, 0x0b, 0x18, 0x3f, 0x25, 0x1e, 0x00, 0x1f, 0x3b, 0x3b, 0x39, 0x35, 0x39, 0x3b, 0x3b, 0x35, 0x3b,
+  0x35, 0x01, 0x7f, 0x7f, 0x7f, 0x7f, 0x01, 0x35, 0x35, 0x3b, 0x35, 0x35, 0x0b, 0x7f, 0x7f, 0x7a, 0x7f, 0x7a, 0x7a, 0x7a, 0x79, 0x7f, 0x7f, 0x2d,
+  0x3b, 0x39, 0x39, 0x35, 0x2d, 0x39, 0x39, 0x31, 0x39, 0x39, 0x31, 0x31, 0x2d, 0x0f, 0x27, 0x2d, 0x31, 0x39, 0x31, 0x31, 0x31, 0x31, 0x27, 0x1f,
+  0x00, 0x05, 0x13, 0x13, 0x1f, 0x0f, 0x13, 0x13, 0x1f, 0x27, 0x13, 0x99, 0x99, 0x0b, 0x08, 0x8a, 0x0a, 0x13, 0x05, 0x93, 0x83, 0x6f, 0x91, 0x9a,
+  0x99, 0x05, 0x99, 0x05, 0x8a, 0x05, 0x1f, 0x9a, 0x6a, 0x63, 0x60, 0x5d, 0x77, 0x18, 0x26, 0x26, 0x26, 0x1a, 0x1f, 0x7f, 0x60, 0x60, 0x6b, 0x76,
+  0x72, 0x77, 0x87, 0x0f, 0x0f, 0x1a, 0x0f, 0x1a, 0x0f, 0x0b, 0x00, 0x66, 0x6c, 0x6a, 0x72, 0x8e, 0x8e, 0x8a, 0x99, 0x8e, 0x93, 0x93, 0x93, 0x83,
+  0x87, 0x87, 0x77, 0x73, 0x76, 0x82, 0x65, 0x6d, 0x70, 0x71, 0x62, 0x62, 0x72, 0x87, 0x83, 0x7a, 0x74, 0x5b, 0x5e, 0x5f, 0x6d, 0x7b, 0x77, 0x75,
+  0x6a, 0x71, 0x6e, 0x5e, 0x5b, 0x54, 0x54, 0x52, 0x52, 0x54, 0x54, 0x54, 0x5b, 0x71, 0x69, 0x71, 0x62, 0x5e, 0x57, 0x5b, 0x5b, 0x64, 0x65, 0x5f,
+  0x61, 0x5f, 0x5e, 0x62, 0x66, 0x66, 0x62, 0x63, 0x66, 0x63, 0x62, 0x62, 0x5e, 0x56, 0x54, 0x53, 0x56, 0x5c, 0x5c, 0x60, 0x5a, 0x5c, 0x5a, 0x5c,
+  0x5a, 0x5a, 0x58, 0x58, 0x58, 0x55, 0x56, 0x53, 0x01, 0x00, 0x70, 0xa3, 0x53, 0xa4, 0x53, 0xa4, 0xa3, 0xa4, 0x06, 0x00, 0x64, 0x53, 0xa4, 0xa4,
+  0xa4, 0xa4, 0xa3, 0x02, 0x00, 0x02, 0x01, 0x00, 0x10, 0xa2, 0x03, 0x00, 0x3f, 0xa2, 0xa3, 0xa2, 0x01, 0x00, 0x03, 0x00, 0x1f, 0x00, 0x00, 0x01,
+  0x00, 0x50, 0xa4, 0xa3, 0x53, 0xa4, 0x55, 0x02, 0x00, 0x04, 0x01, 0x00, 0x00, 0x4a, 0x00, 0xf0, 0x04, 0xa4, 0xa4, 0x55, 0x5a, 0x5a, 0x5c, 0x5c,
+  0x5f, 0x5c, 0x60, 0x60, 0x61, 0x62, 0x62, 0x62, 0x65, 0x66, 0x62, 0x66, 0x01, 0x00, 0x33, 0x6a, 0x66, 0x6a, 0x01, 0x00, 0x71, 0x66, 0x66, 0x6a,
+  0x6e, 0x6f, 0x6f, 0x72, 0x01, 0x00, 0xa0, 0x74, 0x72, 0x74, 0x74, 0x77, 0x77, 0x77, 0x7a, 0x79, 0x7a, 0x54, 0x01, 0x51, 0x77, 0x77, 0x7a, 0x74,
+  0x7a, 0x0d, 0x00, 0x71, 0x7f, 0x7f, 0x7f, 0x87, 0x87, 0x87, 0x8a, 0x01, 0x00, 0x31, 0x8e, 0x8d, 0x8e, 0x01, 0x00, 0x11, 0x93, 0x01, 0x00, 0x32,
+  0x95, 0x93, 0x99, 0x01, 0x00, 0x32, 0x05, 0x99, 0x05, 0x01, 0x00, 0x35, 0x08, 0x05, 0x08, 0x01, 0x00, 0xf5, 0x00, 0x09, 0x08, 0x0e, 0x08, 0x0e,
+  0x09, 0x0b, 0x09, 0x0e, 0x0b, 0x0b, 0x0b, 0x0b, 0x0e, 0x37, 0xe1, 0x01, 0x10, 0x41, 0x01, 0x00, 0xf0, 0x00, 0x44, 0x41, 0x2c, 0x88, 0x03, 0x35,
+  0x41, 0x3e, 0x3e, 0x37, 0x2c, 0x1e, 0x8f, 0x00, 0x18, 0xe0, 0x01, 0xf2, 0x03, 0x2d, 0x3b, 0x3b, 0x3b, 0x3b, 0x35, 0x9a, 0x83, 0x7f, 0x7f, 0x00,
+  0x18, 0x3e, 0x3b, 0x3b, 0x35, 0x2c, 0x88, 0xdf, 0x01, 0x40, 0x7a, 0x7a, 0x79, 0x08, 0x1f, 0x00, 0x31, 0x1f, 0x0f, 0x2d, 0xdf, 0x01, 0x51, 0x31,
+  0x27, 0x27, 0x27, 0x27, 0x09, 0x00, 0xf0, 0x7f, 0x31, 0x2d, 0x25, 0x8e, 0x00, 0x13, 0x18, 0x1f, 0x13, 0x13, 0x0f, 0x13, 0x1f, 0x0f, 0x99, 0x99,
+  0x05, 0x08, 0x99, 0x99, 0x08, 0x08, 0x05, 0x9a, 0x7a, 0x9a, 0x93, 0x8e, 0x99, 0x8e, 0x8e, 0x7f, 0x1a, 0x1f, 0x93, 0x66, 0x5d, 0x63, 0x6b, 0x99,
+  0x27, 0x26, 0x31, 0x26, 0x1a, 0x0e, 0x6f, 0x60, 0x63, 0x74, 0x8c, 0x87, 0x93, 0x08, 0x1a, 0x1a, 0x1a, 0x1a, 0x0f, 0x0f, 0x8e, 0x8e, 0x74, 0x62,
+  0x72, 0x89, 0x05, 0x05, 0x99, 0x99, 0x8e, 0x8e, 0x8a, 0x8e, 0x83, 0x8e, 0x89, 0x89, 0x7b, 0x6c, 0x61, 0x62, 0x68, 0x6d, 0x6d, 0x75, 0x66, 0x77,
+  0x83, 0x83, 0x7a, 0x74, 0x57, 0x58, 0x57, 0x5a, 0x66, 0x82, 0x67, 0x56, 0x62, 0x68, 0x56, 0x54, 0x5b, 0x5b, 0x54, 0x54, 0x54, 0x57, 0x54, 0x56,
+  0x61, 0x5a, 0x66, 0x6c, 0x67, 0x67, 0x5b, 0x56, 0x54, 0x56, 0x5a, 0x5f, 0x62, 0x5f, 0x66, 0x66, 0x66, 0x60, 0x62, 0x63, 0x66, 0x62, 0x60, 0x5a,
+  0x56, 0x54, 0x54, 0x56, 0x5a, 0x5c, 0x01, 0x00, 0xe0, 0x5a, 0x5a, 0x5a, 0x5a, 0x55, 0x58, 0x55, 0x58, 0x53, 0x54, 0x53, 0x52, 0x53, 0x52, 0xdd,
+  0x01, 0x00, 0x01, 0x00, 0x00, 0xcc, 0x01, 0x07, 0xd7, 0x01, 0x02, 0x02, 0x00, 0x03, 0x01, 0x00, 0x0f, 0xde, 0x01, 0x0b, 0x07, 0xe1, 0x01, 0x00,
+  0x35, 0x00, 0x02, 0x01, 0x00, 0x40, 0x55, 0x55, 0x56, 0x55, 0xeb, 0x01, 0x00, 0x01, 0x00, 0x10, 0x55, 0x6e, 0x00, 0x73, 0x58, 0x5a, 0x5a, 0x5c,
+  0x60, 0x60, 0x62, 0x01, 0x00, 0x00, 0xdf, 0x01, 0x00, 0xe5, 0x01, 0x00, 0xde, 0x01, 0x81, 0x62, 0x66, 0x66, 0x6b, 0x6f, 0x6f, 0x6f, 0x72, 0x02,
+  0x00, 0xf0, 0x00, 0x6f, 0x6f, 0x72, 0x74, 0x74, 0x72, 0x74, 0x77, 0x79, 0x7a, 0x79, 0x77, 0x7a, 0x7a, 0x7a, 0x04, 0x00, 0x02, 0x01, 0x00, 0x80,
+  0x7f, 0x7f, 0x83, 0x87, 0x87, 0x87, 0x87, 0x88, 0xe2, 0x01, 0x21, 0x8a, 0x8d, 0xe5, 0x01, 0x13, 0x93, 0xe3, 0x01, 0x24, 0x93, 0x93, 0xe4, 0x01,
+  0x01, 0xe6, 0x01, 0x18, 0x99, 0xe1, 0x01, 0x13, 0x0b, 0x02, 0x00, 0xf0, 0x12, 0x0e, 0x0b, 0x0e, 0x0b, 0x0e, 0x41, 0x3e, 0x3b, 0x41, 0x44, 0x44,
+  0x41, 0x35, 0x2c, 0x41, 0x41, 0x3b, 0x44, 0x3b, 0x44, 0x41, 0x41, 0x37, 0x88, 0x0b, 0x37, 0x41, 0x3e, 0x41, 0x2c, 0x25, 0x18, 0x88, 0xc0, 0x03,
+  0x02, 0xc1, 0x03, 0x71, 0x3b, 0x37, 0x0b, 0x7e, 0x83, 0x7e, 0x99, 0xbf, 0x03, 0x21, 0x18, 0x7e, 0x7c, 0x00, 0xd0, 0x7a, 0x79, 0x79, 0x00, 0x2c,
+  0x3b, 0x39, 0x35, 0x1f, 0x88, 0x99, 0x2d, 0x39, 0xb7, 0x03, 0x50, 0x27, 0x2d, 0x0f, 0x0b, 0x2d, 0xde, 0x01, 0xf0, 0x1b, 0x31, 0x27, 0x31, 0x1f,
+  0x27, 0x18, 0x06, 0x05, 0x0f, 0x0b, 0x0f, 0x13, 0x0f, 0x13, 0x06, 0x99, 0x1f, 0x1f, 0x99, 0x8a, 0x05, 0x13, 0x05, 0x08, 0x0b, 0x05, 0x9a, 0x8e,
+  0x9a, 0x93, 0x93, 0x8e, 0x08, 0x27, 0x1f, 0x13, 0x87, 0x63, 0x60, 0x87, 0x1f, 0x26, 0xc0, 0x03, 0x80, 0x88, 0x6a, 0x66, 0x91, 0x0b, 0x99, 0x8e,
+  0x93, 0xbf, 0x03, 0xf0, 0x34, 0x0f, 0x0f, 0x0f, 0x01, 0x72, 0x73, 0x85, 0x8c, 0x91, 0x93, 0x99, 0x8a, 0x89, 0x89, 0x80, 0x87, 0x91, 0x89, 0x89,
+  0x87, 0x82, 0x67, 0x58, 0x56, 0x55, 0x58, 0x5a, 0x68, 0x67, 0x6e, 0x7b, 0x80, 0x74, 0x7a, 0x7d, 0x56, 0x54, 0x57, 0x56, 0x6c, 0x7b, 0x73, 0x5f,
+  0x57, 0x56, 0x57, 0x5b, 0x6d, 0x6d, 0x5b, 0x52, 0x57, 0x57, 0x54, 0x57, 0x66, 0x60, 0x66, 0x6a, 0x66, 0x65, 0x5e, 0x56, 0x54, 0x56, 0x5f, 0x65,
+  0x43, 0x01, 0xf1, 0x02, 0x5f, 0x5a, 0x62, 0x62, 0x62, 0x5c, 0x60, 0x60, 0x5b, 0x56, 0x53, 0x56, 0x58, 0x5c, 0x5c, 0x5c, 0x5d, 0xc0, 0x03, 0x40,
+  0x5a, 0xa5, 0x58, 0x55, 0xd6, 0x01, 0x04, 0x01, 0x00, 0x00, 0x7a, 0x03, 0x00, 0x02, 0x00, 0x0a, 0xba, 0x03, 0x00, 0x04, 0x00, 0x0f, 0xdf, 0x01,
+  0x1a, 0x00, 0x33, 0x00, 0x00, 0x44, 0x00, 0x00, 0x01, 0x00, 0x02, 0xde, 0x01, 0x04, 0xcd, 0x03, 0x40, 0x58, 0x55, 0x58, 0x55, 0xe1, 0x01, 0x40,
+  0x60, 0x60, 0x60, 0x62, 0xe7, 0x01, 0x00, 0xc3, 0x03, 0x02, 0xe5, 0x01, 0x01, 0xee, 0x01, 0x30, 0x6a, 0x6e, 0x6e, 0xc4, 0x03, 0x20, 0x6f, 0x6e,
+  0xe1, 0x01, 0x30, 0x72, 0x6f, 0x72, 0xc7, 0x03, 0x12, 0x79, 0xde, 0x01, 0x20, 0x80, 0x7a, 0x43, 0x03, 0x51, 0x7f, 0x7a, 0x7f, 0x83, 0x83, 0xe2,
+  0x01, 0x01, 0xc7, 0x03, 0x40, 0x8d, 0x8a, 0x8e, 0x8a, 0xc4, 0x03, 0x04, 0xc6, 0x03, 0x20, 0x93, 0x99, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0xe1,
+  0x01, 0x01, 0xcb, 0x03, 0x00, 0xde, 0x01, 0x03, 0x01, 0x00, 0x30, 0x0b, 0x08, 0x0e, 0xe5, 0x01, 0xa0, 0x0b, 0x37, 0x25, 0x09, 0x2c, 0x41, 0x41,
+  0x44, 0x3b, 0x2c, 0xbe, 0x03, 0xf0, 0x06, 0x41, 0x44, 0x41, 0x44, 0x3e, 0x04, 0x2c, 0x3e, 0x3e, 0x3e, 0x2c, 0x0e, 0x18, 0x0c, 0x88, 0x00, 0x1f,
+  0x3e, 0x3b, 0x3b, 0x39, 0xdf, 0x01, 0xe3, 0x3b, 0x35, 0x07, 0x7f, 0x7f, 0x00, 0x1f, 0x37, 0x39, 0x35, 0x35, 0x2c, 0x04, 0x79, 0xbe, 0x03, 0x90,
+  0x7e, 0x13, 0x3b, 0x39, 0x3b, 0x2d, 0x04, 0x7e, 0x1f, 0xa1, 0x05, 0x71, 0x31, 0x27, 0x31, 0x2d, 0x13, 0x13, 0x27, 0xe9, 0x01, 0x60, 0x31, 0x27,
+  0x13, 0x1f, 0x25, 0x1f, 0x9d, 0x05, 0xf1, 0x0e, 0x27, 0x27, 0x1f, 0x1a, 0x0e, 0x1f, 0x1f, 0x13, 0x08, 0x13, 0x13, 0x05, 0x13, 0x9a, 0x93, 0x91,
+  0x93, 0x8a, 0x85, 0x91, 0x8e, 0x1a, 0x1f, 0x1a, 0x0e, 0x05, 0x63, 0x66, 0x0e, 0xdf, 0x01, 0x73, 0x13, 0x79, 0x7f, 0x91, 0x13, 0x13, 0x93, 0xdf,
+  0x01, 0xf0, 0x31, 0x06, 0x06, 0x08, 0x05, 0x99, 0x79, 0x66, 0x87, 0x8a, 0x8e, 0x6f, 0x66, 0x66, 0x66, 0x6f, 0x7a, 0x74, 0x6f, 0x66, 0x71, 0x70,
+  0x58, 0x55, 0x56, 0x5e, 0x76, 0x6d, 0x5c, 0x7c, 0x77, 0x72, 0x6f, 0x80, 0x7b, 0x57, 0x54, 0x57, 0x58, 0x6c, 0x77, 0x74, 0x6c, 0x6d, 0x57, 0x56,
+  0x57, 0x5f, 0x68, 0x57, 0x54, 0x64, 0x57, 0x54, 0x5f, 0x68, 0x6a, 0x66, 0x65, 0x5f, 0x5e, 0x61, 0x5e, 0x57, 0x56, 0x9c, 0x05, 0xb0, 0x60, 0x62,
+  0x58, 0x5e, 0x62, 0x63, 0x60, 0x60, 0x5c, 0x5e, 0x58, 0xd2, 0x03, 0x30, 0x5a, 0x5c, 0x59, 0xbf, 0x03, 0x57, 0x55, 0x58, 0xa5, 0x58, 0x55, 0xa1,
+  0x05, 0x20, 0xa3, 0x53, 0x98, 0x01, 0x0b, 0x02, 0x00, 0x00, 0x03, 0x00, 0x01, 0x01, 0x00, 0x00, 0xbf, 0x01, 0x0f, 0xde, 0x01, 0x0b, 0x00, 0x20,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x37, 0x00, 0x00, 0xdb, 0x01, 0x00, 0x01, 0x00, 0x01, 0xdf, 0x01, 0x00, 0xde, 0x01, 0x10, 0x58, 0xbd, 0x03, 0x00,
+  0x11, 0x06, 0x00, 0x08, 0x00, 0x10, 0x5c, 0xde, 0x01, 0x61, 0x60, 0x60, 0x5c, 0x62, 0x60, 0x62, 0xe7, 0x01, 0x02, 0x01, 0x00, 0x00, 0xeb, 0x01,
+  0x10, 0x6a, 0xe4, 0x01, 0x32, 0x6f, 0x6a, 0x6f, 0x01, 0x00, 0x31, 0x72, 0x74, 0x77, 0xdd, 0x01, 0x00, 0xd8, 0x01, 0x30, 0x7a, 0x80, 0x7f, 0x02,
+  0x00, 0x00, 0xdf, 0x01, 0x07, 0xe2, 0x01, 0x34, 0x8a, 0x8a, 0x8d, 0xe3, 0x01, 0x03, 0xca, 0x03, 0x14, 0x95, 0xe3, 0x01, 0x10, 0x99, 0xdf, 0x01,
+  0x00, 0xe2, 0x01, 0x00, 0x03, 0x00, 0x00, 0xe0, 0x01, 0x01, 0xe3, 0x01, 0xf1, 0x00, 0x0b, 0x08, 0x0b, 0x25, 0x03, 0x03, 0x09, 0x3e, 0x41, 0x41,
+  0x3e, 0x3b, 0x3b, 0x41, 0x3b, 0xe1, 0x01, 0x10, 0x41, 0xe0, 0x01, 0x80, 0x41, 0x35, 0x37, 0x2c, 0x99, 0x00, 0x00, 0x25, 0xdb, 0x01, 0x10, 0x3b,
+  0xe1, 0x01, 0xc3, 0x37, 0x01, 0x7f, 0x7e, 0x09, 0x35, 0x3b, 0x3b, 0x35, 0x35, 0x25, 0x88, 0xdf, 0x01, 0x20, 0x79, 0x93, 0x10, 0x00, 0x40, 0x1f,
+  0x00, 0x88, 0x25, 0xb4, 0x03, 0x70, 0x31, 0x27, 0x1f, 0x1f, 0x0e, 0x0b, 0x27, 0x9d, 0x05, 0x40, 0x26, 0x25, 0x1a, 0x00, 0xdd, 0x01, 0xf0, 0x10,
+  0x1f, 0x1f, 0x27, 0x2d, 0x27, 0x2d, 0x1f, 0x0f, 0x1f, 0x1f, 0x06, 0x05, 0x13, 0x9a, 0x7f, 0x7f, 0x91, 0x8a, 0x91, 0x8c, 0x83, 0x63, 0x66, 0x88,
+  0x1f, 0x1a, 0x0f, 0x06, 0x99, 0x6f, 0x00, 0xbf, 0x03, 0xa0, 0x1a, 0x26, 0x0f, 0x08, 0x05, 0x05, 0x13, 0x08, 0x06, 0x13, 0xbc, 0x03, 0xf0, 0x40,
+  0x0f, 0x06, 0x06, 0x06, 0x93, 0x99, 0x05, 0x01, 0x00, 0x8e, 0x7f, 0x8e, 0x8d, 0x7f, 0x6c, 0x5c, 0x62, 0x87, 0x83, 0x80, 0x5e, 0x61, 0x61, 0x56,
+  0x53, 0xa4, 0x56, 0x68, 0x5e, 0x73, 0x85, 0x79, 0x77, 0x71, 0x76, 0x71, 0x57, 0x54, 0x54, 0x5e, 0x6a, 0x74, 0x74, 0x66, 0x62, 0x67, 0x57, 0x54,
+  0x57, 0x5e, 0x56, 0x57, 0x5b, 0x57, 0x54, 0x61, 0x6a, 0x69, 0x62, 0x5b, 0x56, 0x53, 0x57, 0x5e, 0x5f, 0x5a, 0x60, 0x62, 0x62, 0x5f, 0x5a, 0x5e,
+  0x5f, 0x60, 0x60, 0x62, 0x5a, 0x56, 0x5a, 0xb4, 0x03, 0x02, 0x7c, 0x07, 0x20, 0x59, 0x5a, 0x69, 0x01, 0x24, 0x55, 0x55, 0xc0, 0x03, 0x01, 0xba,
+  0x03, 0x00, 0x7a, 0x07, 0x01, 0x01, 0x00, 0x00, 0xa2, 0x01, 0x03, 0x02, 0x00, 0x02, 0x01, 0x00, 0x00, 0xbc, 0x01, 0x00, 0xc3, 0x01, 0x0e, 0x01,
+  0x00, 0x00, 0x17, 0x00, 0x05, 0x02, 0x00, 0x00, 0x01, 0x00, 0x06, 0xdd, 0x01, 0x00, 0x01, 0x00, 0x00, 0xbe, 0x03, 0x00, 0xbd, 0x03, 0x10, 0x58,
+  0x7b, 0x00, 0x20, 0x58, 0x5a, 0xe1, 0x01, 0x00, 0x83, 0x00, 0x00, 0x01, 0x00, 0x02, 0xda, 0x01, 0x01, 0x05, 0x00, 0x00, 0xdc, 0x01, 0x00, 0xdf,
+  0x01, 0x01, 0xe1, 0x01, 0x10, 0x6a, 0x89, 0x07, 0x01, 0xc8, 0x03, 0x00, 0xdf, 0x01, 0x05, 0xe1, 0x01, 0x00, 0x01, 0x00, 0x30, 0x83, 0x80, 0x83,
+  0xe1, 0x01, 0x01, 0x01, 0x00, 0x10, 0x8a, 0x03, 0x00, 0x00, 0xe1, 0x01, 0x20, 0x8a, 0x8d, 0xa7, 0x05, 0x01, 0x01, 0x00, 0x00, 0xc4, 0x03, 0x07,
+  0xc6, 0x03, 0x00, 0xc3, 0x03, 0x01, 0xe6, 0x01, 0x05, 0xe1, 0x01, 0x00, 0xe3, 0x01, 0x40, 0x14, 0x0b, 0x37, 0x14, 0xc1, 0x03, 0x24, 0x35, 0x2c,
+  0xe1, 0x01, 0xc3, 0x09, 0x0b, 0x37, 0x3e, 0x41, 0x35, 0x2c, 0x1e, 0x8e, 0x00, 0x88, 0x2c, 0xde, 0x01, 0x80, 0x3b, 0x3b, 0x2c, 0x00, 0x7f, 0x88,
+  0x2c, 0x35, 0x6f, 0x07, 0x11, 0x0e, 0x9f, 0x05, 0x50, 0x79, 0x7a, 0x7a, 0x00, 0x18, 0x5d, 0x09, 0x50, 0x09, 0x79, 0x08, 0x2d, 0x2d, 0xb5, 0x03,
+  0x40, 0x13, 0x93, 0x93, 0x99, 0xa0, 0x05, 0x80, 0x27, 0x27, 0x1f, 0x08, 0x0a, 0x13, 0x18, 0x13, 0x60, 0x09, 0xf1, 0x10, 0x1f, 0x26, 0x27, 0x26,
+  0x1f, 0x1a, 0x27, 0x13, 0x13, 0x8e, 0x0b, 0x89, 0x80, 0x7b, 0x72, 0x80, 0x85, 0x77, 0x72, 0x70, 0x63, 0x93, 0x1a, 0x27, 0x1a, 0x8e, 0x95, 0x93,
+  0x0e, 0x26, 0x26, 0x71, 0x07, 0x60, 0x99, 0x79, 0x8a, 0x05, 0x88, 0x01, 0xde, 0x01, 0xf0, 0x09, 0x0f, 0x06, 0x06, 0x93, 0x93, 0x01, 0x93, 0x8e,
+  0x95, 0x91, 0x91, 0x89, 0x89, 0x8d, 0x8c, 0x7c, 0x72, 0x85, 0x8c, 0x89, 0x6c, 0x5a, 0x5a, 0x57, 0x96, 0x01, 0xf0, 0x20, 0x58, 0x5c, 0x6f, 0x80,
+  0x74, 0x62, 0x5f, 0x5f, 0x64, 0x57, 0x54, 0x54, 0x67, 0x72, 0x6f, 0x6b, 0x6e, 0x6c, 0x68, 0x5b, 0x54, 0x57, 0x57, 0x5b, 0x64, 0x68, 0x5b, 0x56,
+  0x67, 0x67, 0x61, 0x57, 0x54, 0x56, 0x54, 0x53, 0x54, 0x5a, 0x61, 0x66, 0x62, 0x5a, 0x56, 0x56, 0x56, 0x58, 0x60, 0x7d, 0x07, 0x40, 0x56, 0x58,
+  0x5a, 0x5f, 0x5a, 0x01, 0x20, 0x5a, 0x59, 0xea, 0x01, 0x08, 0xdf, 0x01, 0x01, 0x9d, 0x05, 0x01, 0xe2, 0x01, 0x09, 0x02, 0x00, 0x04, 0x01, 0x00,
+  0x00, 0xbc, 0x01, 0x0f, 0xdf, 0x01, 0x01, 0x00, 0x15, 0x00, 0x07, 0x02, 0x00, 0x00, 0x01, 0x00, 0x0a, 0xdf, 0x01, 0x02, 0x01, 0x00, 0x00, 0xbf,
+  0x03, 0x02, 0xe1, 0x01, 0x03, 0xdf, 0x01, 0x00, 0x86, 0x00, 0x03, 0xd6, 0x01, 0x20, 0x62, 0x62, 0x03, 0x00, 0x04, 0xd9, 0x01, 0x00, 0x01, 0x00,
+  0x60, 0x6f, 0x6a, 0x6f, 0x6a, 0x6f, 0x6e, 0x67, 0x09, 0x21, 0x74, 0x77, 0x7f, 0x07, 0x01, 0xdf, 0x01, 0x22, 0x7a, 0x7f, 0xbe, 0x03, 0x01, 0x01,
+  0x00, 0x12, 0x87, 0x02, 0x00, 0x10, 0x8a, 0x02, 0x00, 0x01, 0x01, 0x00, 0x07, 0xc5, 0x03, 0x04, 0x01, 0x00, 0x00, 0xe0, 0x01, 0x04, 0xe3, 0x01,
+  0x18, 0x99, 0xc5, 0x03, 0xb2, 0x88, 0x0b, 0x3f, 0x18, 0x11, 0x35, 0x41, 0x41, 0x41, 0x3b, 0x35, 0xe1, 0x01, 0xe0, 0x41, 0x25, 0x2c, 0x3b, 0x3e,
+  0x3b, 0x3e, 0x25, 0x05, 0x00, 0x87, 0x01, 0x35, 0x41, 0xe1, 0x01, 0x00, 0xe2, 0x01, 0x41, 0x27, 0x7e, 0x00, 0x18, 0xdf, 0x01, 0x20, 0x1e, 0x88,
+  0x83, 0x00, 0x00, 0xe2, 0x09, 0x80, 0x93, 0x2c, 0x39, 0x39, 0x39, 0x2d, 0x00, 0x00, 0xb4, 0x03, 0x90, 0x31, 0x31, 0x25, 0x01, 0x73, 0x86, 0x8e,
+  0x0e, 0x27, 0xc8, 0x03, 0xf0, 0x1a, 0x01, 0x74, 0x77, 0x7a, 0x05, 0x0e, 0x13, 0x13, 0x13, 0x0f, 0x99, 0x06, 0x1a, 0x01, 0x0f, 0x27, 0x27, 0x06,
+  0x93, 0x05, 0x99, 0x6f, 0x7b, 0x6b, 0x62, 0x72, 0x92, 0x6f, 0x6b, 0x6b, 0x66, 0x08, 0x1f, 0x1a, 0x13, 0x9a, 0x93, 0x0e, 0x1a, 0x1a, 0x26, 0xdf,
+  0x01, 0x70, 0x04, 0x83, 0x5c, 0x7b, 0x7f, 0x7a, 0x8e, 0xdf, 0x01, 0xf1, 0x07, 0x0f, 0x06, 0x06, 0x01, 0x93, 0x93, 0x93, 0x73, 0x6f, 0x67, 0x70,
+  0x67, 0x66, 0x6c, 0x74, 0x7c, 0x62, 0x6e, 0x85, 0x89, 0x78, 0x5e, 0x53, 0x05, 0xf3, 0x25, 0x56, 0x56, 0x72, 0x80, 0x83, 0x79, 0x67, 0x57, 0x57,
+  0x57, 0x5b, 0x54, 0x56, 0x68, 0x6a, 0x6f, 0x62, 0x67, 0x62, 0x57, 0x57, 0x52, 0x52, 0x54, 0x57, 0x57, 0x57, 0x57, 0x5e, 0x64, 0x5e, 0x57, 0x53,
+  0x57, 0x5b, 0x52, 0x54, 0x53, 0x56, 0x5f, 0x62, 0x65, 0x5f, 0x5e, 0x56, 0x58, 0x5a, 0x60, 0x60, 0x60, 0x5e, 0x55, 0x5b, 0x09, 0x00, 0xde, 0x01,
+  0x20, 0x59, 0x58, 0xa1, 0x05, 0x06, 0xdf, 0x01, 0x01, 0xba, 0x03, 0x01, 0x9b, 0x01, 0x00, 0xa2, 0x01, 0x05, 0x02, 0x00, 0x03, 0x01, 0x00, 0x00,
+  0xbd, 0x01, 0x01, 0x02, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x12, 0x00, 0x05, 0x02, 0x00, 0x04, 0x01, 0x00, 0x02, 0x46, 0x00, 0x08, 0x01, 0x00, 0x01,
+  0x78, 0x07, 0x00, 0x50, 0x02, 0x00, 0x04, 0x00, 0xb0, 0x58, 0x5a, 0x5c, 0x5f, 0x60, 0x60, 0x60, 0x5f, 0x60, 0x62, 0x65, 0xdf, 0x01, 0x00, 0xb5,
+  0x03, 0x00, 0x05, 0x00, 0x20, 0x6a, 0x6e, 0x99, 0x05, 0x00, 0x79, 0x07, 0x02, 0x07, 0x00, 0x00, 0xde, 0x01, 0x06, 0x44, 0x0b, 0x00, 0x01, 0x00,
+  0x00, 0xe2, 0x01, 0x05, 0xe3, 0x01, 0x13, 0x87, 0xc5, 0x03, 0x03, 0xc4, 0x03, 0x02, 0xe2, 0x01, 0x03, 0xc6, 0x03, 0x10, 0x93, 0x02, 0x00, 0x00,
+  0x01, 0x00, 0x04, 0xc6, 0x03, 0x01, 0xe5, 0x01, 0x00, 0xe1, 0x01, 0x02, 0xe2, 0x01, 0x30, 0x99, 0x25, 0x3f, 0x60, 0x09, 0x60, 0x41, 0x41, 0x3e,
+  0x3e, 0x3b, 0x3e, 0xdf, 0x01, 0xc1, 0x41, 0x41, 0x3b, 0x13, 0x35, 0x41, 0x3b, 0x2c, 0x8d, 0x00, 0x83, 0x0b, 0xc0, 0x03, 0xf0, 0x00, 0x39, 0x39,
+  0x3b, 0x39, 0x3b, 0x1f, 0x7e, 0x0f, 0x2c, 0x39, 0x35, 0x39, 0x2d, 0x2c, 0x05, 0xdd, 0x01, 0x60, 0x79, 0x77, 0x77, 0x77, 0x79, 0x99, 0x77, 0x07,
+  0x40, 0x1f, 0x00, 0x13, 0x35, 0xdf, 0x01, 0xf2, 0x23, 0x27, 0x13, 0x7e, 0x72, 0x79, 0x93, 0x18, 0x31, 0x31, 0x26, 0x27, 0x13, 0x79, 0x6f, 0x6f,
+  0x6f, 0x9a, 0x13, 0x95, 0x0b, 0x8e, 0x13, 0x08, 0x0f, 0x1f, 0x0f, 0x1f, 0x1a, 0x27, 0x0e, 0x8e, 0x08, 0x93, 0x87, 0x7a, 0x82, 0x6b, 0x6a, 0x82,
+  0x7b, 0x63, 0x60, 0x72, 0x1a, 0x13, 0x0e, 0x79, 0x66, 0x66, 0x06, 0x2f, 0x0b, 0x84, 0x87, 0x7a, 0x6a, 0x66, 0x74, 0x83, 0x93, 0x06, 0x01, 0x00,
+  0xf1, 0x03, 0x99, 0x93, 0x91, 0x91, 0x66, 0x5a, 0x58, 0x5c, 0x5a, 0x5e, 0x7b, 0x82, 0x7d, 0x60, 0x76, 0x75, 0x6e, 0x76, 0xbf, 0x03, 0xf2, 0x08,
+  0x57, 0x62, 0x75, 0x7a, 0x80, 0x7b, 0x6d, 0x5b, 0x56, 0x57, 0x5b, 0x54, 0x5a, 0x70, 0x72, 0x72, 0x6c, 0x5e, 0x57, 0x64, 0x57, 0x52, 0x52, 0x1f,
+  0x0d, 0x20, 0x5e, 0x54, 0x06, 0x00, 0xb1, 0x54, 0x54, 0x56, 0x5e, 0x5f, 0x5e, 0x5a, 0x5e, 0x5e, 0x5f, 0x5e, 0xef, 0x06, 0x13, 0x5a, 0xe0, 0x01,
+  0x10, 0x5c, 0xde, 0x01, 0x00, 0x6d, 0x01, 0x09, 0xbf, 0x03, 0x00, 0xe1, 0x01, 0x07, 0x9c, 0x01, 0x00, 0xa8, 0x01, 0x00, 0xaf, 0x01, 0x00, 0x01,
+  0x00, 0x00, 0xbf, 0x01, 0x01, 0x02, 0x00, 0x09, 0x01, 0x00, 0x00, 0x11, 0x00, 0x05, 0x02, 0x00, 0x00, 0x25, 0x00, 0x01, 0x01, 0x00, 0x07, 0x43,
+  0x00, 0x05, 0x9e, 0x05, 0x02, 0x76, 0x07, 0x00, 0xc5, 0x03, 0x01, 0xe0, 0x01, 0x00, 0xde, 0x01, 0x02, 0x9e, 0x05, 0x00, 0x36, 0x0b, 0x01, 0xde,
+  0x01, 0x01, 0xbc, 0x03, 0x00, 0x73, 0x07, 0x11, 0x6e, 0x3d, 0x0b, 0x30, 0x72, 0x72, 0x73, 0xbe, 0x03, 0x10, 0x77, 0xc0, 0x03, 0x08, 0xc2, 0x03,
+  0x00, 0x01, 0x00, 0x12, 0x83, 0xe3, 0x01, 0x01, 0xc1, 0x03, 0x00, 0x01, 0x00, 0x0e, 0xc5, 0x03, 0x05, 0xe1, 0x01, 0x29, 0x93, 0x99, 0xc7, 0x03,
+  0x12, 0x08, 0xab, 0x05, 0x20, 0x0b, 0x0e, 0x5a, 0x09, 0x30, 0x44, 0x41, 0x41, 0xbe, 0x03, 0x00, 0x02, 0x00, 0x00, 0xe1, 0x01, 0xd1, 0x3e, 0x3b,
+  0x3e, 0x2c, 0x04, 0x7f, 0x7f, 0x8e, 0x18, 0x39, 0x3b, 0x3b, 0x31, 0xe1, 0x01, 0x20, 0x1f, 0x08, 0xdf, 0x01, 0x51, 0x35, 0x2d, 0x1f, 0x7f, 0x79,
+  0x86, 0x00, 0x40, 0x77, 0x77, 0x79, 0x18, 0x37, 0x0b, 0x23, 0x1a, 0x06, 0x33, 0x0b, 0xf1, 0x22, 0x0e, 0x72, 0x72, 0x6f, 0x74, 0x13, 0x27, 0x31,
+  0x27, 0x26, 0x1f, 0x0e, 0x77, 0x6a, 0x6b, 0x72, 0x89, 0x77, 0x94, 0x7f, 0x99, 0x08, 0x13, 0x1f, 0x1f, 0x1a, 0x1a, 0x13, 0x93, 0x8e, 0x13, 0x93,
+  0x9a, 0x13, 0x9a, 0x83, 0x6f, 0x82, 0x7b, 0x77, 0x87, 0x0b, 0x13, 0x13, 0x77, 0x5d, 0x5c, 0x6f, 0x0b, 0xe0, 0x01, 0x90, 0x9a, 0x66, 0x7b, 0x60,
+  0x66, 0x6a, 0x87, 0x08, 0x06, 0x7b, 0x07, 0x01, 0xdf, 0x01, 0xf0, 0x19, 0x77, 0x80, 0x8e, 0x83, 0x6e, 0x62, 0x5a, 0x58, 0x5f, 0x85, 0x8c, 0x82,
+  0x58, 0x5a, 0x5a, 0x6d, 0x64, 0x5e, 0x53, 0x54, 0x53, 0x57, 0x6d, 0x68, 0x6f, 0x7b, 0x7b, 0x6e, 0x5b, 0x57, 0x56, 0x64, 0x5b, 0x5b, 0x5f, 0x72,
+  0x72, 0x76, 0x6d, 0x5e, 0xfc, 0x0e, 0x12, 0x52, 0x04, 0x00, 0x10, 0x54, 0xe6, 0x01, 0x00, 0xe3, 0x01, 0x70, 0x65, 0x5f, 0x5c, 0x57, 0x53, 0x54,
+  0x58, 0xe0, 0x01, 0x21, 0x5c, 0x60, 0x15, 0x0d, 0x90, 0x5c, 0x5a, 0x5c, 0x59, 0x58, 0x5a, 0x59, 0x58, 0x59, 0x3d, 0x0b, 0x04, 0xe0, 0x01, 0x01,
+  0x36, 0x0b, 0x01, 0xe1, 0x01, 0x00, 0xd9, 0x01, 0x00, 0xda, 0x01, 0x02, 0x05, 0x00, 0x06, 0xe3, 0x01, 0x01, 0xc5, 0x01, 0x05, 0xe2, 0x01, 0x00,
+  0x0a, 0x00, 0x07, 0x02, 0x00, 0x07, 0x01, 0x00, 0x00, 0x3a, 0x00, 0x0b, 0x01, 0x00, 0x01, 0xe0, 0x01, 0x00, 0x0e, 0x06, 0x01, 0x07, 0x00, 0x50,
+  0x5a, 0x5c, 0x5e, 0x5c, 0x5f, 0x08, 0x0f, 0x00, 0x5a, 0x09, 0x00, 0xe4, 0x01, 0x00, 0xe3, 0x01, 0x00, 0xdf, 0x01, 0x10, 0x6a, 0xb8, 0x03, 0x00,
+  0x97, 0x05, 0x11, 0x73, 0x9b, 0x05, 0x02, 0xbf, 0x03, 0x07, 0xc0, 0x03, 0x03, 0x63, 0x09, 0x12, 0x7f, 0xdf, 0x01, 0x00, 0xde, 0x01, 0x00, 0x02,
+  0x00, 0x00, 0x01, 0x00, 0x05, 0xe2, 0x01, 0x10, 0x8e, 0x02, 0x00, 0x01, 0x01, 0x00, 0x10, 0x93, 0x04, 0x00, 0x05, 0x01, 0x00, 0x02, 0xc9, 0x03,
+  0x01, 0xc5, 0x03, 0xb0, 0x05, 0x05, 0x05, 0x09, 0x03, 0x01, 0x1e, 0x37, 0x37, 0x44, 0x44, 0xdb, 0x01, 0x00, 0x02, 0x00, 0x01, 0xed, 0x01, 0x00,
+  0x31, 0x0b, 0x20, 0x8d, 0x00, 0x11, 0x0d, 0x01, 0xbb, 0x10, 0x04, 0x01, 0x00, 0x40, 0x2d, 0x2d, 0x25, 0x95, 0xbb, 0x03, 0xd1, 0x77, 0x77, 0x74,
+  0x74, 0x77, 0x7f, 0x27, 0x2d, 0x39, 0x31, 0x2d, 0x06, 0x27, 0xe0, 0x01, 0xf0, 0x30, 0x26, 0x1f, 0x13, 0x72, 0x6f, 0x72, 0x7e, 0x1f, 0x27, 0x31,
+  0x26, 0x1f, 0x27, 0x13, 0x80, 0x6f, 0x6a, 0x6b, 0x6b, 0x85, 0x85, 0x9a, 0x8e, 0x8a, 0x08, 0x01, 0x1a, 0x1f, 0x1a, 0x99, 0x99, 0x8a, 0x05, 0x99,
+  0x87, 0x05, 0x9a, 0x8a, 0x87, 0x91, 0x89, 0x72, 0x08, 0x0f, 0x1f, 0x8e, 0x5c, 0x59, 0x5c, 0x8a, 0x0f, 0x0f, 0x1a, 0x1a, 0x0f, 0x05, 0x77, 0x60,
+  0x82, 0x66, 0x7b, 0x7a, 0x99, 0xdb, 0x01, 0xf0, 0x1f, 0x06, 0x06, 0x93, 0x06, 0x93, 0x93, 0x79, 0x66, 0x77, 0x8a, 0x93, 0x91, 0x73, 0x5a, 0x56,
+  0x5c, 0x73, 0x74, 0x67, 0x55, 0x53, 0x58, 0x64, 0x68, 0x5e, 0x57, 0x55, 0x56, 0x5e, 0x5e, 0x56, 0x58, 0x76, 0x6e, 0x58, 0x5b, 0x5f, 0x5e, 0x71,
+  0x5b, 0x5e, 0x62, 0x72, 0x72, 0x72, 0x60, 0xda, 0x01, 0x04, 0x01, 0x00, 0xc0, 0x54, 0x52, 0x54, 0x57, 0x5b, 0x57, 0x52, 0x53, 0x56, 0x62, 0x61,
+  0x5e, 0xf3, 0x0e, 0x00, 0xb9, 0x03, 0x00, 0xe3, 0x01, 0x01, 0x01, 0x00, 0x32, 0x5a, 0x5a, 0xa5, 0x7f, 0x07, 0x07, 0xe1, 0x01, 0x05, 0xde, 0x01,
+  0x05, 0x01, 0x00, 0x00, 0xaa, 0x01, 0x05, 0xdf, 0x01, 0x00, 0xc5, 0x01, 0x0f, 0x02, 0x00, 0x07, 0x09, 0x01, 0x00, 0x0e, 0xe1, 0x01, 0x02, 0xe0,
+  0x01, 0x00, 0x2f, 0x04, 0x10, 0x5a, 0x07, 0x00, 0x02, 0x8b, 0x00, 0x03, 0x01, 0x00, 0x00, 0xe2, 0x01, 0x01, 0xdf, 0x01, 0x04, 0xc0, 0x03, 0x00,
+  0xdf, 0x10, 0x01, 0xe0, 0x10, 0x01, 0xdf, 0x01, 0x00, 0xdc, 0x10, 0x00, 0x02, 0x00, 0x01, 0xde, 0x01, 0x01, 0x02, 0x00, 0x00, 0xe0, 0x01, 0x03,
+  0xe2, 0x01, 0x03, 0xe4, 0x01, 0x04, 0xe1, 0x01, 0x04, 0xe3, 0x01, 0x06, 0x6e, 0x09, 0x01, 0xc7, 0x03, 0x00, 0xe7, 0x01, 0x06, 0x54, 0x0b, 0x00,
+  0xe4, 0x01, 0xa0, 0x32, 0x25, 0x2c, 0x25, 0x2c, 0x25, 0x41, 0x41, 0x41, 0x35, 0x47, 0x09, 0x02, 0xe2, 0x01, 0x60, 0x3b, 0x13, 0x1f, 0x3e, 0x35,
+  0x03, 0xb0, 0x12, 0x00, 0x83, 0x05, 0x12, 0x31, 0xe2, 0x01, 0xb1, 0x31, 0x39, 0x31, 0x2d, 0x27, 0x18, 0x7e, 0x77, 0x77, 0x77, 0x72, 0xe1, 0x01,
+  0x20, 0x8e, 0x2c, 0xb7, 0x03, 0x11, 0x1a, 0xde, 0x01, 0x00, 0xe0, 0x01, 0x60, 0x6f, 0x6f, 0x6b, 0x88, 0x1f, 0x27, 0x91, 0x12, 0xf0, 0x16, 0x01,
+  0x73, 0x87, 0x91, 0x83, 0x66, 0x6b, 0x6b, 0x82, 0x13, 0x0b, 0x8a, 0x8e, 0x08, 0x1f, 0x1a, 0x93, 0x00, 0x8e, 0x99, 0x8a, 0x83, 0x87, 0x82, 0x83,
+  0x91, 0x99, 0x0b, 0x93, 0x0f, 0x1a, 0x13, 0x93, 0x5d, 0x5c, 0x74, 0x0b, 0x10, 0x0d, 0x80, 0x08, 0x87, 0x62, 0x76, 0x7b, 0x6a, 0x7f, 0x8a, 0xdd,
+  0x01, 0x01, 0xdf, 0x01, 0xf5, 0x1c, 0x06, 0x8e, 0x88, 0x8a, 0x8a, 0x8e, 0x93, 0x93, 0x89, 0x6c, 0x5f, 0x5a, 0x6e, 0x89, 0x6a, 0x56, 0x56, 0x53,
+  0x53, 0x56, 0x53, 0x5e, 0x64, 0x67, 0x67, 0x57, 0x5a, 0x5e, 0x67, 0x68, 0x56, 0x5e, 0x68, 0x5f, 0x71, 0x5e, 0x5e, 0x70, 0x72, 0x77, 0x72, 0x67,
+  0x5b, 0xe1, 0x01, 0x00, 0x09, 0x00, 0xa0, 0x54, 0x57, 0x61, 0x54, 0x53, 0x54, 0x56, 0x5f, 0x5a, 0x5b, 0x67, 0x09, 0x21, 0x56, 0x56, 0xe3, 0x01,
+  0x10, 0x5c, 0xc4, 0x03, 0x01, 0xe2, 0x01, 0x50, 0x59, 0x5a, 0x59, 0x5a, 0xa5, 0x81, 0x07, 0x01, 0x01, 0x00, 0x00, 0x48, 0x05, 0x06, 0xe2, 0x01,
+  0x00, 0xa3, 0x01, 0x01, 0xa5, 0x01, 0x00, 0x07, 0x00, 0x00, 0xb3, 0x01, 0x01, 0x01, 0x00, 0x00, 0xc9, 0x01, 0x01, 0x02, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x08, 0x00, 0x07, 0x02, 0x00, 0x05, 0x01, 0x00, 0x00, 0x31, 0x00, 0x00, 0x3a, 0x00, 0x03, 0x01, 0x00, 0x03, 0x9f, 0x05, 0x00, 0x5f, 0x09,
+  0x00, 0x50, 0x02, 0x00, 0xbd, 0x03, 0x10, 0x5a, 0xc0, 0x03, 0x02, 0xa0, 0x05, 0x00, 0xbd, 0x03, 0x03, 0xe1, 0x01, 0x01, 0xe3, 0x01, 0x00, 0xe1,
+  0x01, 0x20, 0x72, 0x6f, 0xbe, 0x03, 0x02, 0xe1, 0x01, 0x00, 0x36, 0x03, 0x28, 0x7a, 0x77, 0xc0, 0x03, 0x00, 0xde, 0x01, 0x00, 0xe1, 0x01, 0x04,
+  0x01, 0x00, 0x00, 0xde, 0x01, 0x01, 0xe1, 0x01, 0x00, 0x01, 0x00, 0x00, 0xde, 0x01, 0x00, 0x01, 0x00, 0x04, 0xc3, 0x03, 0x00, 0xdf, 0x01, 0x05,
+  0xe2, 0x01, 0x05, 0xe1, 0x01, 0xf1, 0x00, 0x99, 0x99, 0x99, 0x37, 0x3e, 0x3f, 0x2c, 0x04, 0x25, 0x44, 0x3e, 0x2c, 0x13, 0x2d, 0x3e, 0xe0, 0x01,
+  0xf0, 0x00, 0x44, 0x3b, 0x41, 0x35, 0x13, 0x1f, 0x3b, 0x3b, 0x09, 0x7e, 0x7f, 0x7e, 0x00, 0x27, 0x35, 0xe0, 0x01, 0x01, 0xe1, 0x01, 0x00, 0xfa,
+  0x0c, 0x40, 0x1f, 0x8f, 0x72, 0x77, 0x92, 0x00, 0x00, 0x95, 0x00, 0x10, 0x99, 0xb9, 0x03, 0x10, 0x26, 0x1e, 0x00, 0xf0, 0x1a, 0x31, 0x31, 0x26,
+  0x26, 0x27, 0x14, 0x6f, 0x6a, 0x6a, 0x93, 0x27, 0x26, 0x26, 0x1f, 0x13, 0x13, 0x05, 0x0b, 0x18, 0x14, 0x83, 0x76, 0x70, 0x63, 0x66, 0x91, 0x0b,
+  0x79, 0x93, 0x0b, 0x06, 0x0e, 0x0f, 0x8e, 0x99, 0x08, 0x8a, 0x83, 0x8a, 0x77, 0x63, 0x88, 0x05, 0x70, 0x0f, 0x0f, 0x0f, 0x8a, 0x62, 0x77, 0x08,
+  0x08, 0x00, 0x90, 0x0f, 0x94, 0x66, 0x5c, 0x6a, 0x6a, 0x6f, 0x8e, 0x05, 0xde, 0x01, 0x30, 0x06, 0x93, 0x93, 0x67, 0x04, 0x10, 0x8a, 0xa8, 0x00,
+  0xa0, 0x8e, 0x87, 0x6e, 0x78, 0x82, 0x89, 0x8a, 0x80, 0x6c, 0x5f, 0x5d, 0x09, 0xf0, 0x07, 0x5f, 0x76, 0x7b, 0x7b, 0x5f, 0x57, 0x55, 0x61, 0x71,
+  0x67, 0x6c, 0x62, 0x67, 0x62, 0x67, 0x5f, 0x66, 0x6a, 0x6f, 0x72, 0x71, 0x5b, 0xdb, 0x01, 0x00, 0xda, 0x01, 0x00, 0x03, 0x00, 0xc0, 0x54, 0x54,
+  0x5e, 0x5e, 0x57, 0x54, 0x53, 0x56, 0x5e, 0x5e, 0x5f, 0x54, 0x00, 0x11, 0x40, 0x54, 0x56, 0x54, 0x55, 0x39, 0x03, 0x30, 0x5c, 0x5c, 0x5d, 0xdf,
+  0x01, 0x00, 0x47, 0x03, 0x03, 0xc1, 0x03, 0x21, 0x55, 0x53, 0x02, 0x00, 0x00, 0x8a, 0x01, 0x09, 0x01, 0x00, 0x01, 0xaa, 0x01, 0x05, 0xe0, 0x01,
+  0x04, 0xdd, 0x10, 0x0f, 0x02, 0x00, 0x02, 0x09, 0x01, 0x00, 0x00, 0x37, 0x00, 0x02, 0x01, 0x00, 0x02, 0x54, 0x00, 0x01, 0xde, 0x01, 0x03, 0x01,
+  0x00, 0x00, 0x1e, 0x06, 0x02, 0x7f, 0x07, 0x00, 0x01, 0x00, 0x00, 0x7f, 0x07, 0x01, 0x06, 0x00, 0x01, 0x01, 0x00, 0x02, 0xe0, 0x01, 0x00, 0xbe,
+  0x12, 0x00, 0x01, 0x00, 0x03, 0xc0, 0x03, 0x01, 0xe2, 0x01, 0x00, 0xdc, 0x01, 0x00, 0xde, 0x01, 0x00, 0x04, 0x00, 0x01, 0xdf, 0x01, 0x06, 0xe1,
+  0x01, 0x00, 0xe4, 0x01, 0x03, 0x01, 0x00, 0x05, 0xc2, 0x03, 0x03, 0xe2, 0x01, 0x01, 0xc5, 0x03, 0x02, 0x8a, 0x07, 0x01, 0xe1, 0x01, 0x00, 0xe2,
+  0x01, 0x02, 0xe4, 0x01, 0xb0, 0x09, 0x0b, 0x18, 0x18, 0x1e, 0x3e, 0x41, 0x3e, 0x2d, 0x04, 0x18, 0xdf, 0x01, 0x80, 0x39, 0x44, 0x39, 0x44, 0x3b,
+  0x35, 0x27, 0x2d, 0x12, 0x0d, 0x32, 0x7e, 0x7f, 0x00, 0xdb, 0x0e, 0x00, 0xe0, 0x01, 0x01, 0xbf, 0x03, 0x40, 0x09, 0x79, 0x74, 0x72, 0x6b, 0x11,
+  0x62, 0x6f, 0x6f, 0x72, 0x73, 0x13, 0x27, 0xdf, 0x01, 0x10, 0x26, 0xdf, 0x01, 0xf0, 0x19, 0x26, 0x27, 0x13, 0x6f, 0x6a, 0x6b, 0x0e, 0x1a, 0x27,
+  0x26, 0x13, 0x7e, 0x77, 0x7a, 0x92, 0x0c, 0x0c, 0x83, 0x66, 0x63, 0x63, 0x6f, 0x83, 0x0a, 0x0e, 0x13, 0x99, 0x00, 0x88, 0x0b, 0x79, 0x83, 0x13,
+  0x08, 0x8e, 0x7a, 0x6b, 0x60, 0x6f, 0x05, 0xb6, 0x03, 0x40, 0x0f, 0x06, 0x93, 0x0b, 0xde, 0x01, 0x83, 0x0f, 0x08, 0x7a, 0x5a, 0x5a, 0x5c, 0x62,
+  0x7f, 0x9e, 0x05, 0x00, 0xe1, 0x01, 0x00, 0xe4, 0x01, 0xf0, 0x0d, 0x8a, 0x8a, 0x8e, 0x8e, 0x79, 0x62, 0x76, 0x80, 0x8a, 0x8a, 0x8a, 0x87, 0x7b,
+  0x6c, 0x58, 0x56, 0x56, 0x56, 0x68, 0x7b, 0x77, 0x64, 0x5a, 0x5e, 0x5f, 0x65, 0x5f, 0x6a, 0xd5, 0x13, 0x61, 0x6e, 0x62, 0x58, 0x62, 0x6e, 0x64,
+  0x7f, 0x07, 0x00, 0x01, 0x00, 0x01, 0x7f, 0x07, 0xe0, 0x52, 0x56, 0x5b, 0x5f, 0x58, 0x5b, 0x5f, 0x5f, 0x5e, 0x5b, 0x56, 0x57, 0x5a, 0x56, 0xe0,
+  0x01, 0x01, 0xc2, 0x03, 0x10, 0x5d, 0xbf, 0x03, 0x80, 0x5c, 0x59, 0x58, 0xa5, 0x58, 0xa5, 0x5a, 0xa5, 0x61, 0x09, 0x01, 0x01, 0x00, 0x03, 0x8b,
+  0x01, 0x03, 0x01, 0x00, 0x00, 0xa3, 0x01, 0x02, 0xa5, 0x01, 0x00, 0x08, 0x00, 0x00, 0xb4, 0x01, 0x00, 0x01, 0x00, 0x00, 0xc9, 0x01, 0x09, 0x02,
+  0x00, 0x01, 0x01, 0x00, 0x03, 0xde, 0x01, 0x04, 0x28, 0x00, 0x00, 0x08, 0x00, 0x00, 0x39, 0x00, 0x03, 0x01, 0x00, 0x00, 0xd9, 0x10, 0x01, 0x01,
+  0x00, 0x00, 0x7c, 0x07, 0x01, 0xf6, 0x0e, 0x00, 0x7a, 0x07, 0x00, 0x84, 0x16, 0x01, 0xdf, 0x01, 0x00, 0xc1, 0x03, 0x00, 0x01, 0x00, 0x00, 0xdf,
+  0x01, 0x00, 0xc1, 0x03, 0x00, 0xf9, 0x0e, 0x00, 0xe4, 0x01, 0x00, 0xe7, 0x01, 0x01, 0x5f, 0x09, 0x07, 0x9f, 0x05, 0x00, 0x01, 0x00, 0x02, 0xdf,
+  0x01, 0x0a, 0xe1, 0x01, 0x04, 0xa3, 0x05, 0x09, 0xe2, 0x01, 0x00, 0xf4, 0x10, 0x00, 0xe4, 0x01, 0x01, 0x01, 0x00, 0x02, 0xe4, 0x01, 0x01, 0x01,
+  0x00, 0x00, 0xe1, 0x01, 0xb0, 0x93, 0x99, 0x93, 0x01, 0x01, 0x25, 0x37, 0x41, 0x44, 0x41, 0x3e, 0xa0, 0x05, 0x20, 0x41, 0x39, 0xe1, 0x01, 0x10,
+  0x41, 0xf5, 0x0e, 0x60, 0x39, 0x3b, 0x18, 0x99, 0x01, 0x93, 0x5e, 0x07, 0x22, 0x26, 0x27, 0xe1, 0x01, 0x51, 0x2d, 0x27, 0x14, 0x7f, 0x72, 0xf1,
+  0x09, 0x00, 0x94, 0x00, 0x30, 0x79, 0x1f, 0x2d, 0x98, 0x05, 0x01, 0xdf, 0x01, 0x00, 0xc0, 0x03, 0xf1, 0x15, 0x18, 0x72, 0x6a, 0x72, 0x1f, 0x27,
+  0x26, 0x1a, 0x0b, 0x6b, 0x66, 0x63, 0x72, 0x87, 0x89, 0x98, 0x85, 0x63, 0x6b, 0x76, 0x6b, 0x7a, 0x0a, 0x0e, 0x0a, 0x87, 0x7a, 0x91, 0x05, 0x99,
+  0x13, 0x8e, 0x91, 0x8a, 0x83, 0x91, 0x06, 0x0d, 0x51, 0x1a, 0x06, 0x06, 0x06, 0x0f, 0x02, 0x00, 0x80, 0x05, 0x74, 0x72, 0x7b, 0x6f, 0x7a, 0x93,
+  0x99, 0x9a, 0x05, 0x05, 0x96, 0x00, 0x10, 0x93, 0xac, 0x00, 0x40, 0x83, 0x62, 0x67, 0x7a, 0xc9, 0x00, 0xf1, 0x0b, 0x83, 0x76, 0x64, 0x64, 0x5f,
+  0x5e, 0x6a, 0x7b, 0x7b, 0x5f, 0x5e, 0x6d, 0x62, 0x6d, 0x66, 0x75, 0x6f, 0x74, 0x74, 0x6f, 0x6e, 0x6d, 0x5f, 0x67, 0x6d, 0x67, 0xc0, 0x03, 0x00,
+  0xda, 0x01, 0x01, 0x05, 0x00, 0x50, 0x54, 0x56, 0x58, 0x67, 0x65, 0xb0, 0x12, 0x52, 0x56, 0x56, 0x5a, 0x5e, 0x5e, 0xc1, 0x03, 0x00, 0x99, 0x14,
+  0x40, 0x5c, 0x5d, 0x5a, 0x5d, 0xeb, 0x08, 0x01, 0x01, 0x00, 0x10, 0xa5, 0xdb, 0x01, 0x0b, 0xde, 0x01, 0x04, 0x01, 0x00, 0x03, 0xaa, 0x01, 0x00,
+  0xb6, 0x01, 0x00, 0x01, 0x00, 0x00, 0xca, 0x01, 0x0c, 0x02, 0x00, 0x00, 0x16, 0x00, 0x01, 0x01, 0x00, 0x01, 0x2d, 0x00, 0x04, 0x02, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x53, 0x00, 0x00, 0xd9, 0x01, 0x00, 0x02, 0x06, 0x00, 0x6a, 0x00, 0x02, 0xdd, 0x01, 0x03, 0xb9, 0x03, 0x00, 0x01, 0x00, 0x01,
+  0xc1, 0x12, 0x00, 0xdc, 0x01, 0x01, 0xde, 0x01, 0x00, 0xa3, 0x14, 0x21, 0x6a, 0x6a, 0xf8, 0x0e, 0x21, 0x6f, 0x6e, 0xc4, 0x03, 0x04, 0xc0, 0x03,
+  0x05, 0xde, 0x01, 0x01, 0x7e, 0x07, 0x11, 0x7a, 0xc4, 0x12, 0x09, 0xe2, 0x01, 0x05, 0xdf, 0x01, 0x02, 0xe2, 0x01, 0x01, 0x01, 0x00, 0x01, 0x2c,
+  0x0d, 0x01, 0xc1, 0x03, 0x01, 0x01, 0x00, 0x04, 0xe2, 0x01, 0x12, 0x95, 0xe2, 0x01, 0xe0, 0x04, 0x99, 0x95, 0x05, 0x37, 0x3e, 0x3e, 0x44, 0x44,
+  0x35, 0x35, 0x3b, 0x3b, 0x39, 0xe1, 0x01, 0x10, 0x41, 0xd3, 0x10, 0x10, 0x39, 0xf7, 0x0e, 0x20, 0x35, 0x39, 0x84, 0x05, 0x00, 0x01, 0x00, 0x00,
+  0x1e, 0x1a, 0x30, 0x27, 0x13, 0x7f, 0xbd, 0x03, 0x00, 0x01, 0x00, 0x50, 0x6b, 0x6b, 0x6f, 0x88, 0x27, 0xd8, 0x01, 0x00, 0x02, 0x00, 0x00, 0x01,
+  0x00, 0xf1, 0x18, 0x31, 0x27, 0x1f, 0x6f, 0x6a, 0x7a, 0x1f, 0x26, 0x26, 0x1f, 0x91, 0x66, 0x66, 0x63, 0x63, 0x63, 0x63, 0x6b, 0x70, 0x63, 0x63,
+  0x69, 0x76, 0x70, 0x77, 0x76, 0x85, 0x6b, 0x66, 0x77, 0x0a, 0x18, 0x93, 0x7e, 0x87, 0x93, 0x99, 0x99, 0x06, 0x22, 0x1a, 0x00, 0xdf, 0x01, 0x01,
+  0x01, 0x00, 0x60, 0x8e, 0x8a, 0x8c, 0x91, 0x8a, 0x93, 0x77, 0x07, 0x63, 0x93, 0x8e, 0x00, 0x72, 0x7f, 0x8a, 0x9c, 0x00, 0x00, 0xa0, 0x05, 0x40,
+  0x62, 0x56, 0x5c, 0x74, 0x60, 0x17, 0xf0, 0x0b, 0x66, 0x6a, 0x67, 0x6e, 0x64, 0x5f, 0x6c, 0x72, 0x5a, 0x62, 0x6e, 0x6e, 0x71, 0x70, 0x71, 0x70,
+  0x76, 0x6f, 0x72, 0x6d, 0x5f, 0x57, 0x5c, 0x68, 0x6d, 0x5b, 0xd7, 0x01, 0x03, 0xe3, 0x01, 0x30, 0x54, 0x52, 0x56, 0x35, 0x1a, 0x91, 0x60, 0x5c,
+  0x5f, 0x58, 0x54, 0x56, 0x56, 0x5e, 0x5a, 0xe0, 0x01, 0x00, 0xc1, 0x03, 0x00, 0x78, 0x16, 0x01, 0x7c, 0x07, 0x10, 0x58, 0xbe, 0x03, 0x01, 0xc0,
+  0x03, 0x1f, 0x53, 0xe1, 0x01, 0x04, 0x00, 0xdd, 0x01, 0x00, 0x02, 0x00, 0x03, 0x01, 0x00, 0x00, 0xd1, 0x01, 0x04, 0x02, 0x00, 0x0a, 0x01, 0x00,
+  0x04, 0xd4, 0x01, 0x04, 0x01, 0x00, 0x00, 0x50, 0x00, 0x00, 0x38, 0x02, 0x00, 0xde, 0x01, 0x01, 0x01, 0x00, 0x00, 0xdc, 0x01, 0x00, 0xfc, 0x07,
+  0x03, 0x01, 0x00, 0x02, 0x75, 0x07, 0x09, 0x9b, 0x05, 0x01, 0xdc, 0x01, 0x21, 0x6e, 0x6e, 0x45, 0x0b, 0x00, 0x9e, 0x05, 0x08, 0xdf, 0x01, 0x04,
+  0xe1, 0x01, 0x00, 0x01, 0x00, 0x03, 0xc2, 0x03, 0x07, 0xdf, 0x01, 0x01, 0xe1, 0x01, 0x01, 0xe3, 0x01, 0x01, 0xbf, 0x03, 0x06, 0xe1, 0x01, 0x05,
+  0xc0, 0x03, 0x01, 0x41, 0x01, 0x00, 0xdf, 0x01, 0x02, 0xc1, 0x03, 0xb1, 0x93, 0x93, 0x1e, 0x01, 0x05, 0x18, 0x25, 0x0e, 0x37, 0x41, 0x3b, 0xc1,
+  0x03, 0x00, 0xb8, 0x03, 0x00, 0x0f, 0x0d, 0x03, 0xf6, 0x0e, 0x20, 0x39, 0x31, 0x85, 0x05, 0x00, 0xc1, 0x10, 0x53, 0x39, 0x31, 0x27, 0x0e, 0x83,
+  0xdd, 0x01, 0x01, 0x02, 0x00, 0x28, 0x08, 0x27, 0xe1, 0x01, 0xf3, 0x01, 0x31, 0x26, 0x18, 0x6e, 0x66, 0x8e, 0x1f, 0x26, 0x1a, 0x13, 0x83, 0x63,
+  0x63, 0x5d, 0x63, 0x5d, 0x01, 0x00, 0xd0, 0x63, 0x5d, 0x63, 0x82, 0x5d, 0x5d, 0x63, 0x77, 0x13, 0x95, 0x79, 0x8e, 0x8e, 0x31, 0x0b, 0x10, 0x1a,
+  0xc3, 0x03, 0x00, 0xdc, 0x01, 0x00, 0x0b, 0x0d, 0x42, 0x8e, 0x6f, 0x7f, 0x8e, 0xdf, 0x01, 0x62, 0x93, 0x85, 0x62, 0x5a, 0x6e, 0x72, 0x7c, 0x07,
+  0x00, 0x01, 0x00, 0xf0, 0x11, 0x8a, 0x7c, 0x5a, 0x5e, 0x76, 0x78, 0x6a, 0x83, 0x7f, 0x6a, 0x7c, 0x71, 0x6c, 0x71, 0x6d, 0x75, 0x6e, 0x74, 0x76,
+  0x7b, 0x73, 0x67, 0x5e, 0x5f, 0x5a, 0x66, 0x60, 0x6d, 0x5f, 0x54, 0x56, 0x64, 0x3d, 0x1a, 0x03, 0xdd, 0x01, 0x02, 0x1c, 0x0d, 0x00, 0x9d, 0x19,
+  0x71, 0x66, 0x62, 0x61, 0x5f, 0x56, 0x58, 0x5e, 0x76, 0x16, 0x10, 0x54, 0x5a, 0x18, 0x00, 0x01, 0x07, 0x20, 0x59, 0x5a, 0x9f, 0x05, 0x01, 0x01,
+  0x00, 0x01, 0xde, 0x01, 0x10, 0x53, 0x44, 0x0b, 0x00, 0x98, 0x01, 0x0d, 0x01, 0x00, 0x0a, 0x81, 0x07, 0x00, 0x02, 0x00, 0x0f, 0x01, 0x00, 0x01,
+  0x00, 0x27, 0x00, 0x09, 0x01, 0x00, 0x03, 0xdc, 0x01, 0x01, 0x95, 0x05, 0x00, 0x66, 0x00, 0x01, 0x53, 0x09, 0x04, 0xba, 0x03, 0x01, 0xdd, 0x01,
+  0x01, 0x9c, 0x05, 0x05, 0xdf, 0x01, 0x00, 0xe0, 0x01, 0x12, 0x6e, 0xba, 0x03, 0x00, 0x9e, 0x05, 0x01, 0x7f, 0x07, 0x21, 0x72, 0x77, 0xe0, 0x01,
+  0x05, 0xdf, 0x01, 0x01, 0xbc, 0x03, 0x00, 0x02, 0x00, 0x01, 0xe4, 0x10, 0x17, 0x80, 0xe2, 0x01, 0x02, 0xdd, 0x01, 0x02, 0x01, 0x00, 0x06, 0xe1,
+  0x01, 0x00, 0xe0, 0x01, 0x0f, 0xe2, 0x01, 0x00, 0x50, 0x93, 0x93, 0x93, 0x93, 0x99, 0xf0, 0x0b, 0x2c, 0x18, 0x0e, 0x93, 0x0e, 0x1e, 0x2c, 0x2c,
+  0x35, 0x2c, 0x35, 0x35, 0x39, 0x3b, 0x3b, 0x39, 0x3b, 0x39, 0x41, 0x39, 0x3b, 0x39, 0x3b, 0x3b, 0x3b, 0x39, 0x01, 0x00, 0x50, 0x31, 0x31, 0x31,
+  0x31, 0x26, 0x05, 0x00, 0xf0, 0x05, 0x27, 0x25, 0x05, 0x79, 0x72, 0x6f, 0x72, 0x6f, 0x6f, 0x6f, 0x6b, 0x6f, 0x6b, 0x6b, 0x6b, 0x6b, 0x74, 0x13,
+  0x27, 0x26, 0x1a, 0x00, 0x30, 0x26, 0x31, 0x26, 0x01, 0x00, 0xf0, 0x06, 0x31, 0x27, 0x13, 0x6f, 0x6a, 0x05, 0x27, 0x26, 0x26, 0x13, 0x6f, 0x63,
+  0x5d, 0x63, 0x5d, 0x5d, 0x5d, 0x5d, 0x59, 0x5d, 0x59, 0x01, 0x00, 0xf0, 0x05, 0x70, 0x70, 0x63, 0x5d, 0x59, 0x62, 0x05, 0x18, 0x1a, 0x01, 0x7e,
+  0x0f, 0x1a, 0x1a, 0x0f, 0x0f, 0x88, 0x0f, 0x0f, 0x06, 0x01, 0x00, 0xf2, 0x36, 0x99, 0x06, 0x93, 0x91, 0x74, 0x5a, 0x66, 0x8e, 0x93, 0x06, 0x93,
+  0x06, 0x93, 0x8e, 0x7b, 0x6c, 0x58, 0x66, 0x78, 0x62, 0x85, 0x8e, 0x8a, 0x8e, 0x8a, 0x8a, 0x8e, 0x8a, 0x8e, 0x8e, 0x8a, 0x6f, 0x5e, 0x5f, 0x71,
+  0x5f, 0x66, 0x80, 0x7a, 0x74, 0x7b, 0x67, 0x58, 0x57, 0x5f, 0x5e, 0x6a, 0x7b, 0x7a, 0x7b, 0x67, 0x54, 0x54, 0x5b, 0x57, 0x67, 0x62, 0x56, 0x54,
+  0x52, 0x54, 0x61, 0x6d, 0x6d, 0x57, 0x54, 0x52, 0x54, 0x52, 0x03, 0x00, 0xf1, 0x03, 0x54, 0x54, 0x54, 0x56, 0x61, 0x66, 0x6a, 0x66, 0x66, 0x62,
+  0x62, 0x60, 0x5f, 0x5f, 0x62, 0x5c, 0x56, 0x54, 0x02, 0x00, 0xe1, 0x56, 0x58, 0x58, 0x5a, 0x5a, 0x5a, 0x5a, 0x58, 0x58, 0x5a, 0x58, 0x5a, 0xa5,
+  0x58, 0x01, 0x00, 0xaf, 0x55, 0x55, 0x53, 0x53, 0xa4, 0x53, 0x55, 0xa4, 0x53, 0xa4, 0x01, 0x00, 0x02, 0x3f, 0xa3, 0xa4, 0xa3, 0x01, 0x00, 0x02,
+  0x20, 0xa4, 0xa3, 0x1e, 0x00, 0x08, 0x01, 0x00, 0x30, 0x55, 0xa4, 0x55, 0x01, 0x00, 0x03, 0x08, 0x00, 0x00, 0x05, 0x00, 0x10, 0x58, 0x02, 0x00,
+  0x11, 0x58, 0x73, 0x00, 0x53, 0x5c, 0x5c, 0x60, 0x5c, 0x60, 0x01, 0x00, 0x10, 0x62, 0x03, 0x00, 0x01, 0x02, 0x00, 0x70, 0x62, 0x66, 0x66, 0x6a,
+  0x66, 0x6a, 0x6a, 0x04, 0x00, 0x70, 0x6e, 0x6a, 0x6e, 0x6e, 0x6f, 0x6e, 0x6f, 0x01, 0x00, 0xd0, 0x72, 0x72, 0x72, 0x74, 0x72, 0x74, 0x74, 0x74,
+  0x77, 0x74, 0x77, 0x77, 0x7a, 0x02, 0x00, 0x04, 0x01, 0x00, 0x10, 0x7f, 0x02, 0x00, 0x02, 0x01, 0x00, 0x17, 0x83, 0x01, 0x00, 0x10, 0x87, 0x02,
+  0x00, 0x01, 0x01, 0x00, 0x10, 0x8a, 0x03, 0x00, 0x12, 0x8a, 0x01, 0x00, 0x00, 0x33, 0x01, 0x04, 0x01, 0x00, 0x12, 0x93, 0x02, 0x00, 0x05, 0x01,
+  0x00, 0xc1, 0x18, 0x08, 0x05, 0x00, 0x93, 0x9a, 0x99, 0x8d, 0x04, 0x05, 0x0e, 0x35, 0xdf, 0x01, 0x00, 0xe1, 0x01, 0x10, 0x41, 0xdc, 0x01, 0x00,
+  0x01, 0x00, 0x00, 0xdb, 0x01, 0x00, 0xc7, 0x01, 0x40, 0x27, 0x27, 0x94, 0x77, 0x90, 0x00, 0x00, 0xde, 0x01, 0x00, 0xe0, 0x01, 0x30, 0x6f, 0x7f,
+  0x1f, 0xdf, 0x01, 0x01, 0x02, 0x00, 0xf1, 0x00, 0x26, 0x1a, 0x26, 0x26, 0x31, 0x26, 0x18, 0x6e, 0x73, 0x13, 0x27, 0x26, 0x1a, 0x13, 0x66, 0xde,
+  0x01, 0x04, 0xdf, 0x01, 0xf1, 0x03, 0x59, 0x59, 0x5d, 0x5d, 0x59, 0x59, 0x62, 0x08, 0x1a, 0x1a, 0x08, 0x06, 0x0f, 0x1a, 0x0f, 0x0f, 0x0f, 0x06,
+  0x04, 0x00, 0x00, 0xe2, 0x01, 0xf0, 0x06, 0x7f, 0x79, 0x6f, 0x62, 0x74, 0x93, 0x93, 0x06, 0x93, 0x93, 0x8a, 0x7b, 0x5c, 0x58, 0x5c, 0x71, 0x66,
+  0x62, 0x79, 0x7a, 0x77, 0xa9, 0x00, 0x00, 0xb2, 0x00, 0xf0, 0x0b, 0x89, 0x82, 0x5f, 0x67, 0x62, 0x75, 0x7b, 0x72, 0x6e, 0x74, 0x7c, 0x5e, 0x56,
+  0x54, 0x55, 0x64, 0x77, 0x72, 0x74, 0x5a, 0x54, 0x52, 0x56, 0x57, 0x71, 0x68, 0xd8, 0x01, 0x42, 0x5b, 0x68, 0x68, 0x57, 0xdb, 0x01, 0x00, 0x02,
+  0x00, 0x00, 0x01, 0x00, 0xe0, 0x58, 0x62, 0x62, 0x66, 0x5f, 0x5c, 0x5e, 0x5f, 0x5f, 0x60, 0x62, 0x5c, 0x58, 0x56, 0xde, 0x01, 0xe1, 0x56, 0x56,
+  0x56, 0x55, 0x5a, 0x58, 0x58, 0x55, 0x5a, 0x58, 0xa5, 0x5a, 0xa5, 0x5a, 0xdd, 0x01, 0x22, 0x55, 0x53, 0x02, 0x00, 0x0f, 0xe2, 0x01, 0x06, 0x0d,
+  0xe1, 0x01, 0x00, 0x12, 0x00, 0x00, 0x19, 0x00, 0x0a, 0x01, 0x00, 0x00, 0xd4, 0x01, 0x00, 0x01, 0x00, 0x02, 0xdf, 0x01, 0x00, 0x04, 0x00, 0x08,
+  0xe0, 0x01, 0x56, 0x5c, 0x5a, 0x5c, 0x5c, 0x5f, 0xe3, 0x01, 0x02, 0xdd, 0x01, 0x50, 0x62, 0x66, 0x62, 0x66, 0x66, 0xdf, 0x01, 0x02, 0xe2, 0x01,
+  0x12, 0x6a, 0xdf, 0x01, 0x11, 0x72, 0xe0, 0x01, 0x00, 0xdf, 0x01, 0x01, 0x01, 0x00, 0x05, 0xe1, 0x01, 0x01, 0xdd, 0x01, 0x20, 0x7a, 0x7f, 0x03,
+  0x00, 0x57, 0x7f, 0x80, 0x7f, 0x80, 0x83, 0xe3, 0x01, 0x04, 0xdf, 0x01, 0x01, 0xe2, 0x01, 0x06, 0xe1, 0x01, 0x08, 0x01, 0x00, 0x08, 0xe0, 0x01,
+  0xf0, 0x00, 0x99, 0x93, 0x99, 0x05, 0x25, 0x01, 0x93, 0x1e, 0x99, 0x01, 0x18, 0x0e, 0x1f, 0x35, 0x39, 0xdf, 0x01, 0x03, 0xe5, 0x01, 0x02, 0x01,
+  0x00, 0x00, 0xdf, 0x01, 0xa0, 0x31, 0x31, 0x31, 0x2d, 0x27, 0x99, 0x77, 0x6f, 0x72, 0x6b, 0x94, 0x00, 0x20, 0x6f, 0x6b, 0xe1, 0x01, 0x30, 0x6f,
+  0x91, 0x27, 0xb7, 0x03, 0x00, 0xde, 0x01, 0xf8, 0x01, 0x26, 0x26, 0x1a, 0x1a, 0x31, 0x26, 0x27, 0x13, 0x6e, 0x00, 0x1f, 0x26, 0x26, 0x26, 0x13,
+  0x66, 0xde, 0x01, 0x11, 0xa5, 0x05, 0x00, 0x30, 0x5d, 0x7f, 0x13, 0xdb, 0x01, 0x61, 0x0f, 0x0f, 0x0f, 0x01, 0x99, 0x06, 0xe1, 0x01, 0xa0, 0x06,
+  0x93, 0x93, 0x93, 0x8e, 0x62, 0x80, 0x91, 0x99, 0x8e, 0xdf, 0x01, 0xa0, 0x6e, 0x58, 0x5a, 0x69, 0x6d, 0x62, 0x80, 0x89, 0x6f, 0x7f, 0x9d, 0x00,
+  0xf0, 0x10, 0x8a, 0x7f, 0x83, 0x83, 0x87, 0x85, 0x82, 0x71, 0x75, 0x6d, 0x6e, 0x5f, 0x62, 0x5e, 0x6a, 0x67, 0x58, 0x67, 0x5f, 0x53, 0x5e, 0x71,
+  0x76, 0x6e, 0x64, 0x54, 0x54, 0x5b, 0x68, 0x6d, 0x6c, 0xb9, 0x03, 0x30, 0x54, 0x57, 0x57, 0xd9, 0x01, 0x02, 0xdb, 0x01, 0x01, 0x01, 0x00, 0xd0,
+  0x56, 0x57, 0x5a, 0x57, 0x58, 0x57, 0x58, 0x58, 0x58, 0x5c, 0x62, 0x5f, 0x58, 0xdc, 0x01, 0x10, 0x56, 0x06, 0x00, 0x00, 0x71, 0x01, 0x30, 0x58,
+  0x5a, 0x5a, 0xc2, 0x03, 0x00, 0xe0, 0x01, 0x10, 0x56, 0xdd, 0x01, 0x00, 0x8d, 0x01, 0x30, 0x53, 0xa4, 0x55, 0xa8, 0x01, 0x0c, 0x01, 0x00, 0x0a,
+  0xdf, 0x01, 0x00, 0xda, 0x01, 0x0f, 0xdd, 0x01, 0x00, 0x03, 0xdf, 0x01, 0x00, 0xd0, 0x01, 0x03, 0x01, 0x00, 0x02, 0xd9, 0x01, 0x40, 0x58, 0x58,
+  0x58, 0xa5, 0xbe, 0x03, 0x22, 0x5a, 0x5c, 0x01, 0x00, 0x00, 0xdc, 0x01, 0x01, 0x05, 0x00, 0x00, 0xdd, 0x01, 0x01, 0xde, 0x01, 0x02, 0xc0, 0x03,
+  0x02, 0x01, 0x00, 0x01, 0xe0, 0x01, 0x02, 0xdf, 0x01, 0x30, 0x72, 0x74, 0x72, 0xbe, 0x03, 0x24, 0x77, 0x79, 0xde, 0x01, 0x04, 0xe1, 0x01, 0x01,
+  0x01, 0x00, 0x10, 0x83, 0x02, 0x00, 0x00, 0x03, 0x00, 0x21, 0x83, 0x87, 0x04, 0x00, 0x00, 0xd9, 0x01, 0x02, 0x01, 0x00, 0x05, 0xdd, 0x01, 0x01,
+  0xc0, 0x03, 0x04, 0xe3, 0x01, 0x01, 0xdd, 0x01, 0x00, 0x02, 0x00, 0x03, 0x01, 0x00, 0xa1, 0x99, 0x88, 0x99, 0x18, 0x1e, 0x37, 0x25, 0x25, 0x0b,
+  0x2c, 0xa0, 0x05, 0x00, 0x02, 0x00, 0x01, 0xe1, 0x01, 0x03, 0x01, 0x00, 0x00, 0xdd, 0x01, 0x70, 0x26, 0x31, 0x26, 0x27, 0x27, 0x01, 0x72, 0x9c,
+  0x05, 0x00, 0xbd, 0x03, 0x00, 0x02, 0x00, 0x32, 0x6b, 0x6f, 0x0e, 0xe0, 0x01, 0x00, 0x01, 0x00, 0xb3, 0x1a, 0x0f, 0x0f, 0x26, 0x31, 0x26, 0x1e,
+  0x73, 0x06, 0x27, 0x26, 0xc0, 0x03, 0x04, 0xdf, 0x01, 0x21, 0x59, 0xa5, 0xe2, 0x01, 0x20, 0x6f, 0x08, 0xd4, 0x01, 0x51, 0x0f, 0x0f, 0x0f, 0x99,
+  0x8e, 0x07, 0x00, 0x01, 0xc0, 0x03, 0x50, 0x93, 0x8e, 0x6a, 0x8a, 0x99, 0xe8, 0x01, 0xb0, 0x93, 0x7b, 0x5a, 0x55, 0x55, 0x5f, 0x62, 0x6f, 0x89,
+  0x8e, 0x88, 0x9f, 0x00, 0xfb, 0x12, 0x8a, 0x8a, 0x72, 0x6f, 0x6a, 0x7a, 0x7b, 0x5f, 0x5e, 0x5f, 0x6d, 0x67, 0x64, 0x6d, 0x71, 0x76, 0x75, 0x6c,
+  0x75, 0x6d, 0x54, 0x53, 0x5e, 0x5f, 0x5f, 0x6d, 0x54, 0x56, 0x57, 0x56, 0x67, 0x5f, 0x64, 0xba, 0x03, 0x03, 0x01, 0x00, 0x00, 0xb3, 0x03, 0xf0,
+  0x02, 0x58, 0x5e, 0x5e, 0x5a, 0x62, 0x60, 0x62, 0x5f, 0x58, 0x57, 0x56, 0x5a, 0x5e, 0x5a, 0x57, 0x58, 0x56, 0xdc, 0x01, 0x00, 0xe2, 0x01, 0x42,
+  0x58, 0x5a, 0x58, 0x59, 0x90, 0x01, 0x00, 0xdf, 0x01, 0x0f, 0xde, 0x01, 0x04, 0x02, 0xe1, 0x01, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x0a, 0xdb,
+  0x01, 0x00, 0x3b, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0c, 0x00, 0x00, 0xdd, 0x01, 0x00, 0x02, 0x00, 0x04, 0xd9, 0x01, 0x00, 0x62, 0x00, 0x02, 0x09,
+  0x06, 0x02, 0xdf, 0x01, 0x10, 0x5f, 0xdb, 0x01, 0x01, 0xdd, 0x01, 0x00, 0xdf, 0x01, 0x00, 0xdb, 0x01, 0x00, 0x01, 0x00, 0x07, 0xdf, 0x01, 0x20,
+  0x6e, 0x6a, 0x4d, 0x01, 0x12, 0x72, 0xdf, 0x01, 0x04, 0xc0, 0x03, 0x05, 0xdf, 0x01, 0x02, 0xde, 0x01, 0x09, 0xe1, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x9c, 0x05, 0x05, 0xe1, 0x01, 0x0a, 0xdf, 0x01, 0x00, 0x01, 0x00, 0x02, 0x06, 0x00, 0x00, 0x44, 0x01, 0x00, 0x56, 0x01, 0x02, 0x01, 0x00, 0xd2,
+  0x99, 0x93, 0x88, 0x01, 0x05, 0x25, 0x2c, 0x2c, 0x18, 0x2c, 0x35, 0x25, 0x2d, 0xd7, 0x01, 0x50, 0x3b, 0x39, 0x08, 0x27, 0x2d, 0x09, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0xe0, 0x01, 0x71, 0x31, 0x26, 0x31, 0x27, 0x1f, 0x83, 0x72, 0xd9, 0x01, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x21, 0x79, 0x1f,
+  0xe0, 0x01, 0x00, 0xbf, 0x03, 0x80, 0x27, 0x1a, 0x01, 0x01, 0x27, 0x26, 0x27, 0x0f, 0xbf, 0x03, 0x46, 0x1a, 0x1a, 0x13, 0x77, 0xde, 0x01, 0x00,
+  0xdf, 0x01, 0xf1, 0x01, 0xa5, 0x59, 0x59, 0x6f, 0x93, 0x0e, 0x0f, 0x0f, 0x01, 0x93, 0x0f, 0x0f, 0x06, 0x01, 0x8e, 0x06, 0xdc, 0x01, 0x40, 0x06,
+  0x93, 0x06, 0x06, 0x89, 0x00, 0x00, 0x7c, 0x07, 0xa0, 0x93, 0x7f, 0x5f, 0x5a, 0x55, 0x58, 0x5a, 0x6c, 0x72, 0x8a, 0x9a, 0x00, 0xf0, 0x17, 0x8e,
+  0x8e, 0x8a, 0x83, 0x7a, 0x6c, 0x62, 0x5f, 0x67, 0x58, 0x58, 0x67, 0x64, 0x58, 0x5e, 0x5e, 0x69, 0x6d, 0x7b, 0x76, 0x75, 0x5b, 0x53, 0x52, 0x54,
+  0x53, 0x54, 0x5e, 0x58, 0x5f, 0x67, 0x60, 0x6e, 0x6a, 0x6c, 0x67, 0x57, 0x54, 0xdb, 0x01, 0x00, 0xde, 0x01, 0x10, 0x57, 0xda, 0x01, 0x02, 0x01,
+  0x00, 0x00, 0xe0, 0x01, 0xf0, 0x00, 0x61, 0x61, 0x60, 0x5a, 0x60, 0x62, 0x65, 0x60, 0x5b, 0x58, 0x58, 0x5e, 0x5f, 0x5e, 0x5a, 0xc0, 0x03, 0x40,
+  0x5e, 0x58, 0x58, 0x56, 0x60, 0x03, 0x01, 0xc0, 0x03, 0x01, 0xdf, 0x01, 0x10, 0x53, 0x52, 0x05, 0x0f, 0xe2, 0x01, 0x0c, 0x00, 0x08, 0x00, 0x04,
+  0x01, 0x00, 0x03, 0x80, 0x05, 0x01, 0xd6, 0x01, 0x03, 0x01, 0x00, 0x02, 0xd2, 0x01, 0x00, 0x0f, 0x00, 0x00, 0x09, 0x00, 0x04, 0x01, 0x00, 0x10,
+  0x5c, 0x03, 0x00, 0x03, 0xb9, 0x03, 0x06, 0x01, 0x00, 0x00, 0xbe, 0x03, 0x02, 0xe2, 0x01, 0x10, 0x6a, 0x02, 0x00, 0x02, 0x01, 0x00, 0x12, 0x6f,
+  0xdf, 0x01, 0x01, 0xe1, 0x01, 0x00, 0xe2, 0x01, 0x01, 0xc0, 0x03, 0x20, 0x7a, 0x79, 0xdc, 0x01, 0x03, 0x01, 0x00, 0x04, 0xde, 0x01, 0x05, 0xdd,
+  0x01, 0x0f, 0xe0, 0x01, 0x09, 0x01, 0xe2, 0x01, 0x03, 0xde, 0x01, 0x00, 0xbc, 0x03, 0x00, 0x05, 0x00, 0x01, 0x01, 0x00, 0xf0, 0x00, 0x99, 0x93,
+  0x93, 0x99, 0x14, 0x1e, 0x18, 0x13, 0x25, 0x2c, 0x18, 0x1f, 0x3e, 0x27, 0x1f, 0xdc, 0x01, 0x90, 0x39, 0x3b, 0x39, 0x35, 0x04, 0x13, 0x35, 0x27,
+  0x35, 0xde, 0x01, 0x01, 0xe0, 0x01, 0x00, 0xc3, 0x01, 0x40, 0x27, 0x1f, 0x7f, 0x72, 0xdb, 0x01, 0x02, 0xdd, 0x01, 0x40, 0x6b, 0x6b, 0x6b, 0x8e,
+  0x8c, 0x05, 0x02, 0x01, 0x00, 0x90, 0x1a, 0x13, 0x79, 0x8e, 0x26, 0x27, 0x26, 0x1a, 0x06, 0x0c, 0x00, 0x30, 0x1a, 0x13, 0x7b, 0x71, 0x07, 0x02,
+  0x01, 0x00, 0x02, 0xdf, 0x01, 0xf1, 0x05, 0x6a, 0x87, 0x0b, 0x0b, 0x08, 0x05, 0x99, 0x05, 0x08, 0x05, 0x99, 0x93, 0x79, 0x06, 0x0f, 0x06, 0x0f,
+  0x93, 0x93, 0x8e, 0xd9, 0x01, 0x10, 0x01, 0x65, 0x09, 0x92, 0x93, 0x8e, 0x73, 0x6a, 0x6c, 0x7b, 0x75, 0x72, 0x85, 0xdf, 0x01, 0xf0, 0x07, 0x8a,
+  0x8a, 0x8a, 0x83, 0x74, 0x67, 0x67, 0x71, 0x6d, 0x5e, 0x67, 0x76, 0x68, 0x53, 0x56, 0x58, 0x58, 0x60, 0x71, 0x66, 0x5e, 0x56, 0xac, 0x03, 0xc2,
+  0x53, 0x64, 0x68, 0x66, 0x71, 0x66, 0x72, 0x6a, 0x6e, 0x6d, 0x5f, 0x54, 0xde, 0x01, 0x50, 0x54, 0x57, 0x64, 0x57, 0x5b, 0xe3, 0x01, 0x30, 0x57,
+  0x54, 0x56, 0x04, 0x00, 0x30, 0x56, 0x5f, 0x62, 0x52, 0x01, 0xc0, 0x60, 0x5a, 0x58, 0x5b, 0x58, 0x58, 0x5c, 0x5e, 0x5a, 0x56, 0x58, 0x56, 0xbf,
+  0x03, 0x02, 0xa6, 0x05, 0x10, 0x59, 0x8f, 0x01, 0x02, 0x01, 0x00, 0x11, 0x53, 0xdf, 0x01, 0x02, 0x03, 0x00, 0x0f, 0x01, 0x00, 0x0c, 0x00, 0x2a,
+  0x00, 0x00, 0x33, 0x00, 0x00, 0xae, 0x03, 0x02, 0x01, 0x00, 0x02, 0x08, 0x00, 0x03, 0xf4, 0x05, 0x00, 0xb1, 0x03, 0x01, 0xd4, 0x01, 0x04, 0x01,
+  0x00, 0x04, 0xb5, 0x03, 0x03, 0x01, 0x00, 0x10, 0x62, 0x01, 0x00, 0x01, 0xdf, 0x01, 0x01, 0xdd, 0x01, 0x04, 0xdf, 0x01, 0x12, 0x6e, 0x9f, 0x05,
+  0x01, 0xdf, 0x01, 0x00, 0xc0, 0x03, 0x10, 0x77, 0xc1, 0x03, 0x07, 0x9f, 0x05, 0x02, 0xc0, 0x03, 0x01, 0x01, 0x00, 0x06, 0xbe, 0x03, 0x0a, 0xe1,
+  0x01, 0x07, 0x7c, 0x07, 0x09, 0xdf, 0x01, 0x00, 0x01, 0x00, 0x04, 0xde, 0x01, 0x00, 0x01, 0x00, 0xb3, 0x99, 0x93, 0x0c, 0x13, 0x88, 0x7e, 0x9a,
+  0x13, 0x35, 0x3e, 0x3b, 0xd2, 0x01, 0x80, 0x39, 0x3b, 0x35, 0x1a, 0x1f, 0x13, 0x27, 0x27, 0x0b, 0x00, 0x00, 0xe0, 0x01, 0x01, 0x43, 0x09, 0x50,
+  0x27, 0x1f, 0x79, 0x72, 0x6b, 0x02, 0x00, 0x03, 0xe1, 0x01, 0x31, 0x6f, 0x0b, 0x26, 0xc0, 0x03, 0x01, 0xd3, 0x01, 0x30, 0x05, 0x6a, 0x88, 0xbb,
+  0x03, 0x01, 0x0c, 0x00, 0x33, 0x0f, 0x0b, 0x6b, 0xdf, 0x01, 0x20, 0x69, 0x6b, 0xe0, 0x01, 0xf0, 0x01, 0x59, 0x59, 0x77, 0x0a, 0x0f, 0x0b, 0x91,
+  0x7a, 0x77, 0x7b, 0x74, 0x80, 0x8a, 0x88, 0x99, 0x99, 0x9e, 0x05, 0x30, 0x93, 0x7f, 0x8e, 0x57, 0x09, 0x00, 0xc5, 0x03, 0x00, 0x89, 0x07, 0x61,
+  0x8e, 0x91, 0x8f, 0x8c, 0x8d, 0x8d, 0xa7, 0x00, 0xf1, 0x07, 0x8e, 0x8a, 0x8a, 0x87, 0x7b, 0x74, 0x6c, 0x7b, 0x7c, 0x76, 0x75, 0x6a, 0x6c, 0x85,
+  0x75, 0x58, 0x54, 0x58, 0x6d, 0x72, 0x6d, 0x58, 0x8b, 0x05, 0xc0, 0x52, 0x56, 0x68, 0x6f, 0x6f, 0x72, 0x66, 0x70, 0x5a, 0x62, 0x6c, 0x5a, 0xd4,
+  0x01, 0x00, 0xe1, 0x01, 0x70, 0x5b, 0x5f, 0x5f, 0x5a, 0x68, 0x57, 0x56, 0xe1, 0x01, 0x00, 0xdf, 0x01, 0x20, 0x56, 0x58, 0x0d, 0x05, 0xa0, 0x62,
+  0x5f, 0x5a, 0x5b, 0x58, 0x58, 0x57, 0x58, 0x5e, 0x5a, 0xda, 0x01, 0x00, 0xe1, 0x01, 0x00, 0x87, 0x01, 0x00, 0x07, 0x00, 0x00, 0xda, 0x01, 0x02,
+  0x01, 0x00, 0x00, 0xb6, 0x01, 0x07, 0x02, 0x00, 0x0f, 0x01, 0x00, 0x04, 0x00, 0x1b, 0x00, 0x00, 0x2e, 0x00, 0x01, 0xa7, 0x03, 0x04, 0x01, 0x00,
+  0x00, 0x4c, 0x00, 0x02, 0xae, 0x03, 0x02, 0xb0, 0x03, 0x04, 0xde, 0x01, 0x01, 0x08, 0x00, 0x03, 0xdf, 0x01, 0x01, 0x51, 0x09, 0x04, 0x01, 0x00,
+  0x03, 0xdf, 0x01, 0x00, 0x04, 0x00, 0x00, 0xdc, 0x01, 0x04, 0xbd, 0x03, 0x03, 0xdf, 0x01, 0x03, 0xe2, 0x01, 0x56, 0x74, 0x77, 0x74, 0x7a, 0x77,
+  0xc0, 0x03, 0x00, 0xdf, 0x01, 0x13, 0x7a, 0xdd, 0x01, 0x06, 0xdf, 0x01, 0x01, 0xe1, 0x01, 0x02, 0x01, 0x00, 0x40, 0x8a, 0x87, 0x8a, 0x88, 0x32,
+  0x01, 0x04, 0x01, 0x00, 0x07, 0xe1, 0x01, 0x00, 0xc1, 0x03, 0x08, 0xe2, 0x01, 0xb3, 0x01, 0x00, 0x00, 0x7f, 0x88, 0x8d, 0x1e, 0x35, 0x3b, 0x35,
+  0x39, 0x96, 0x05, 0x70, 0x2d, 0x25, 0x35, 0x0e, 0x1f, 0x2d, 0x31, 0x0b, 0x00, 0x00, 0xc0, 0x03, 0x04, 0xe0, 0x01, 0x00, 0xbe, 0x03, 0x03, 0xdf,
+  0x01, 0x28, 0x6b, 0x7a, 0xbf, 0x03, 0x41, 0x89, 0x66, 0x00, 0x1f, 0xdf, 0x01, 0x00, 0xbf, 0x03, 0xb0, 0x79, 0x6b, 0x70, 0x63, 0x59, 0x59, 0x59,
+  0x63, 0x76, 0x8c, 0x82, 0xc1, 0x03, 0xf0, 0x00, 0x59, 0x6f, 0x08, 0x0b, 0x0f, 0x05, 0x6a, 0x5c, 0x59, 0x62, 0x69, 0x60, 0x72, 0x74, 0x93, 0xbf,
+  0x03, 0x42, 0x06, 0x06, 0x00, 0x83, 0x9b, 0x05, 0x00, 0x02, 0x00, 0xb0, 0x8e, 0x8a, 0x8a, 0x86, 0x83, 0x83, 0x7f, 0x87, 0x7f, 0x72, 0x72, 0x1d,
+  0x0d, 0xf0, 0x06, 0x8a, 0x6a, 0x5a, 0x5e, 0x62, 0x71, 0x66, 0x5f, 0x62, 0x5e, 0x6e, 0x7c, 0x5e, 0x58, 0x53, 0x56, 0x6a, 0x76, 0x5e, 0x56, 0x53,
+  0xdf, 0x01, 0xd1, 0x53, 0x5e, 0x6a, 0x72, 0x74, 0x74, 0x6b, 0x71, 0x60, 0x6c, 0x76, 0x71, 0x71, 0xb6, 0x03, 0x80, 0x54, 0x54, 0x5f, 0x61, 0x62,
+  0x5f, 0x68, 0x61, 0xa6, 0x05, 0x90, 0x56, 0x57, 0x56, 0x57, 0x56, 0x56, 0x57, 0x62, 0x65, 0x24, 0x0d, 0x20, 0x56, 0x5a, 0x69, 0x09, 0x33, 0x5a,
+  0x58, 0x5b, 0xc1, 0x03, 0x02, 0x01, 0x00, 0x06, 0x5f, 0x05, 0x02, 0xe6, 0x01, 0x10, 0xa4, 0x03, 0x00, 0x04, 0xdd, 0x01, 0x03, 0x07, 0x00, 0x06,
+  0x01, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x23, 0x00, 0x04, 0xba, 0x03, 0x00, 0xd3, 0x01, 0x07, 0x01, 0x00, 0x07, 0xd9, 0x01, 0x09, 0x01, 0x00, 0x01,
+  0xe1, 0x01, 0x05, 0xdf, 0x01, 0x00, 0x96, 0x05, 0x01, 0x01, 0x00, 0x01, 0xbc, 0x03, 0x00, 0x08, 0x00, 0x02, 0xbd, 0x03, 0x06, 0xbe, 0x03, 0x05,
+  0xde, 0x01, 0x00, 0xa0, 0x05, 0x0f, 0xbf, 0x03, 0x01, 0x08, 0x01, 0x00, 0x02, 0xde, 0x01, 0x00, 0x05, 0x00, 0x01, 0xbe, 0x03, 0x07, 0xe3, 0x01,
+  0x00, 0xd8, 0x01, 0x07, 0x01, 0x00, 0x08, 0xdf, 0x01, 0xb3, 0x99, 0x2c, 0x25, 0x18, 0x8d, 0x83, 0x7f, 0x93, 0x1e, 0x1e, 0x2c, 0xdf, 0x01, 0x71,
+  0x39, 0x09, 0x8e, 0x1f, 0x27, 0x2d, 0x39, 0xe0, 0x01, 0x03, 0xdf, 0x01, 0x00, 0xe0, 0x01, 0x01, 0x5c, 0x09, 0x04, 0x01, 0x00, 0x15, 0x93, 0xe0,
+  0x01, 0xf0, 0x0a, 0x1a, 0x1a, 0x13, 0x7a, 0x62, 0x8a, 0x1f, 0x1a, 0x1a, 0x1a, 0x26, 0x1a, 0x26, 0x1a, 0x1a, 0x01, 0x6f, 0x83, 0x9d, 0x76, 0x59,
+  0x59, 0x5d, 0x8c, 0x85, 0xe0, 0x01, 0xf2, 0x03, 0x59, 0x60, 0x87, 0x05, 0x0f, 0x0b, 0x05, 0x9a, 0x99, 0x72, 0x5a, 0x5d, 0x70, 0x5c, 0x60, 0x6f,
+  0x08, 0x06, 0x5d, 0x09, 0x20, 0x7f, 0x6f, 0x7b, 0x00, 0x00, 0x5d, 0x09, 0xf0, 0x28, 0x87, 0x74, 0x6f, 0x62, 0x60, 0x5c, 0x5f, 0x62, 0x80, 0x74,
+  0x73, 0x6a, 0x83, 0x8a, 0x8e, 0x8a, 0x85, 0x5f, 0x58, 0x5f, 0x71, 0x6c, 0x5f, 0x6d, 0x73, 0x6c, 0x73, 0x6c, 0x55, 0x5b, 0x5e, 0x65, 0x71, 0x6c,
+  0x58, 0x5e, 0x64, 0x5e, 0x53, 0x52, 0x54, 0x54, 0x61, 0x62, 0x6a, 0x6f, 0x72, 0x6a, 0x6c, 0x5f, 0x5f, 0x67, 0x70, 0x75, 0x5e, 0xb1, 0x03, 0xd0,
+  0x54, 0x54, 0x5b, 0x5b, 0x5a, 0x5e, 0x5e, 0x56, 0x57, 0x54, 0x56, 0x57, 0x54, 0xe0, 0x01, 0x40, 0x57, 0x58, 0x5e, 0x62, 0x03, 0x0f, 0x01, 0x4a,
+  0x0b, 0x10, 0x57, 0x7b, 0x07, 0x01, 0x01, 0x00, 0x01, 0xa0, 0x05, 0x00, 0xa7, 0x01, 0x06, 0xe2, 0x01, 0x0a, 0x01, 0x00, 0x0f, 0xde, 0x01, 0x04,
+  0x01, 0x01, 0x00, 0x00, 0x3a, 0x00, 0x03, 0xb2, 0x03, 0x05, 0xd7, 0x01, 0x0f, 0xda, 0x01, 0x02, 0x02, 0xdb, 0x01, 0x00, 0x01, 0x00, 0x06, 0xdf,
+  0x01, 0x04, 0xe1, 0x01, 0x00, 0xdd, 0x01, 0x16, 0x6a, 0xde, 0x01, 0x04, 0x01, 0x00, 0x00, 0xdf, 0x01, 0x04, 0xe1, 0x01, 0x33, 0x77, 0x79, 0x77,
+  0xdf, 0x01, 0x24, 0x7f, 0x7a, 0xdd, 0x01, 0x00, 0xbc, 0x03, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x99, 0x05, 0x00, 0xda, 0x01, 0x01, 0x01,
+  0x00, 0x01, 0xdd, 0x01, 0x02, 0x9f, 0x05, 0x01, 0xb9, 0x03, 0x00, 0x02, 0x00, 0x04, 0x01, 0x00, 0x00, 0xdc, 0x01, 0x05, 0xdf, 0x01, 0xe3, 0x99,
+  0x93, 0x99, 0x93, 0x3e, 0x35, 0x25, 0x8e, 0x7f, 0x7f, 0x7f, 0x00, 0x88, 0x08, 0xe0, 0x01, 0x72, 0x3b, 0x08, 0x7e, 0x13, 0x2c, 0x39, 0x2d, 0xc1,
+  0x03, 0x01, 0xdf, 0x01, 0x00, 0xc0, 0x03, 0x11, 0x7a, 0xdf, 0x01, 0x03, 0xe2, 0x01, 0x08, 0x3e, 0x0b, 0x54, 0x0f, 0x13, 0x6b, 0x62, 0x8e, 0xe0,
+  0x01, 0xf0, 0x10, 0x05, 0x8e, 0x0e, 0x87, 0x8c, 0x63, 0x59, 0x59, 0x5d, 0x85, 0x7b, 0x87, 0x76, 0x6b, 0x5d, 0x5c, 0x7a, 0x0b, 0x0e, 0x08, 0x8d,
+  0x6f, 0x83, 0x9a, 0x91, 0x6b, 0x66, 0x69, 0x59, 0x6a, 0x8d, 0xdc, 0x01, 0x00, 0x01, 0x00, 0x30, 0x99, 0x7f, 0x01, 0xbc, 0x03, 0xf0, 0x20, 0x93,
+  0x8e, 0x8e, 0x77, 0x72, 0x6e, 0x5f, 0x55, 0x58, 0x69, 0x71, 0x82, 0x6e, 0x7b, 0x5f, 0x6a, 0x87, 0x8e, 0x8a, 0x72, 0x5e, 0x6d, 0x68, 0x5f, 0x61,
+  0x5a, 0x6c, 0x7b, 0x71, 0x62, 0x6d, 0x68, 0x6d, 0x61, 0x67, 0x70, 0x5c, 0x5a, 0x6d, 0x68, 0x67, 0x54, 0x53, 0x58, 0x5e, 0x62, 0x76, 0xe3, 0x02,
+  0xa0, 0x77, 0x62, 0x5e, 0x58, 0x6a, 0x6a, 0x67, 0x64, 0x64, 0x5b, 0x54, 0x09, 0x30, 0x5f, 0x61, 0x56, 0xdc, 0x01, 0x02, 0xbf, 0x03, 0x00, 0xe1,
+  0x01, 0xa6, 0x5a, 0x60, 0x62, 0x60, 0x5f, 0x58, 0x5b, 0x56, 0x5a, 0x57, 0xb9, 0x03, 0x08, 0x01, 0x00, 0x0c, 0xe3, 0x01, 0x00, 0xc8, 0x01, 0x0f,
+  0x02, 0x00, 0x01, 0x03, 0x01, 0x00, 0x00, 0x31, 0x00, 0x03, 0xdd, 0x01, 0x01, 0xdb, 0x01, 0x00, 0x02, 0x00, 0x02, 0x01, 0x00, 0x03, 0xe1, 0x0e,
+  0x00, 0x06, 0x00, 0x00, 0x02, 0x00, 0x01, 0x0b, 0x00, 0x01, 0x01, 0x00, 0x02, 0xde, 0x01, 0x05, 0xdb, 0x01, 0x00, 0xda, 0x01, 0x00, 0x03, 0x00,
+  0x04, 0x01, 0x00, 0x10, 0x6f, 0x02, 0x00, 0x01, 0x01, 0x00, 0x00, 0xdc, 0x01, 0x06, 0xdf, 0x01, 0x00, 0xde, 0x01, 0x05, 0xe1, 0x01, 0x00, 0xbf,
+  0x03, 0x01, 0xda, 0x01, 0x02, 0xdc, 0x01, 0x03, 0xdf, 0x01, 0x00, 0xda, 0x01, 0x00, 0xd6, 0x10, 0x00, 0x05, 0x00, 0x00, 0xdb, 0x01, 0x00, 0x01,
+  0x00, 0x20, 0x8e, 0x88, 0xdb, 0x01, 0x0f, 0xde, 0x01, 0x04, 0x02, 0xe1, 0x01, 0x30, 0x3b, 0x35, 0x18, 0xe0, 0x01, 0x33, 0x7f, 0x7f, 0x01, 0xe0,
+  0x01, 0x80, 0x39, 0x08, 0x88, 0x08, 0x1f, 0x35, 0x27, 0x1a, 0x0b, 0x00, 0x00, 0xdc, 0x01, 0x01, 0x61, 0x09, 0x01, 0xc0, 0x03, 0x02, 0x01, 0x00,
+  0x10, 0x63, 0x9f, 0x05, 0x01, 0x8f, 0x05, 0x00, 0x01, 0x00, 0x90, 0x1a, 0x1a, 0x99, 0x63, 0x63, 0x91, 0x1a, 0x0f, 0x1a, 0x0b, 0x00, 0x60, 0x0b,
+  0x74, 0x6c, 0x13, 0x18, 0x8a, 0x81, 0x07, 0xf1, 0x06, 0x63, 0x6b, 0x82, 0x85, 0x92, 0x6e, 0x6f, 0x05, 0x0e, 0x08, 0x80, 0x5c, 0x59, 0x5c, 0x89,
+  0x89, 0x85, 0x6e, 0x5d, 0x5a, 0x7f, 0x27, 0x0d, 0x00, 0x01, 0x00, 0x10, 0x99, 0xde, 0x01, 0x10, 0x06, 0x2e, 0x0b, 0xf0, 0x1d, 0x7f, 0x67, 0x82,
+  0x6e, 0x55, 0x55, 0x61, 0x69, 0x76, 0x5c, 0x5e, 0x58, 0x66, 0x87, 0x8e, 0x8e, 0x66, 0x5e, 0x7b, 0x67, 0x68, 0x5e, 0x62, 0x64, 0x76, 0x6c, 0x68,
+  0x67, 0x58, 0x5b, 0x58, 0x56, 0x5a, 0x6d, 0x71, 0x76, 0x76, 0x71, 0x65, 0x5e, 0x66, 0x6f, 0x66, 0x6f, 0x00, 0x01, 0xd0, 0x77, 0x6f, 0x72, 0x6e,
+  0x66, 0x5e, 0x56, 0x64, 0x6d, 0x5e, 0x54, 0x54, 0x56, 0xe7, 0x10, 0x12, 0x56, 0xbb, 0x03, 0x01, 0x05, 0x00, 0x51, 0x58, 0x57, 0x5a, 0x5a, 0x60,
+  0x7f, 0x07, 0x20, 0x5b, 0x58, 0xe2, 0x01, 0x03, 0x02, 0x00, 0x00, 0xbb, 0x0c, 0x02, 0x82, 0x07, 0x00, 0xb0, 0x01, 0x0c, 0xe3, 0x01, 0x00, 0x01,
+  0x00, 0x00, 0xd1, 0x01, 0x01, 0xd7, 0x01, 0x01, 0x05, 0x00, 0x01, 0x01, 0x00, 0x00, 0xb8, 0x03, 0x01, 0x37, 0x00, 0x01, 0xdb, 0x01, 0x05, 0x01,
+  0x00, 0x11, 0x60, 0xdc, 0x01, 0x40, 0x5f, 0x5c, 0x60, 0x5f, 0xcd, 0x01, 0x09, 0x01, 0x00, 0x03, 0xc9, 0x10, 0x02, 0xde, 0x01, 0x03, 0xe0, 0x01,
+  0x09, 0xdc, 0x01, 0x00, 0xde, 0x01, 0x01, 0x9a, 0x05, 0x06, 0xde, 0x01, 0x04, 0xe0, 0x01, 0x11, 0x74, 0xdb, 0x10, 0x00, 0xe1, 0x00, 0x00, 0xdc,
+  0x01, 0x02, 0x01, 0x00, 0x05, 0xde, 0x01, 0x05, 0xdd, 0x01, 0x02, 0xdb, 0x01, 0x05, 0xdd, 0x01, 0x03, 0xbe, 0x03, 0x05, 0x01, 0x00, 0x00, 0x50,
+  0x01, 0x03, 0xde, 0x01, 0x11, 0x99, 0x04, 0x00, 0x01, 0x02, 0x00, 0x90, 0x3b, 0x35, 0x13, 0x8d, 0x00, 0x8e, 0x7f, 0x83, 0x00, 0xdf, 0x10, 0x01,
+  0x01, 0x00, 0x91, 0x18, 0x05, 0x0e, 0x1f, 0x25, 0x06, 0x99, 0x31, 0x31, 0x9f, 0x05, 0x00, 0xdf, 0x01, 0x44, 0x26, 0x26, 0x1f, 0x88, 0xdf, 0x01,
+  0x00, 0x01, 0x00, 0x06, 0x3e, 0x0b, 0x91, 0x1a, 0x1a, 0x0f, 0x87, 0x63, 0x63, 0x99, 0x1a, 0x0f, 0x0b, 0x00, 0xf0, 0x05, 0x91, 0x62, 0x88, 0x13,
+  0x13, 0x08, 0x62, 0x5d, 0x5d, 0x76, 0x69, 0x5d, 0x60, 0x6b, 0x7f, 0x88, 0x08, 0x13, 0x08, 0x7a, 0xee, 0x01, 0x73, 0x82, 0x85, 0x8c, 0x72, 0x5c,
+  0x60, 0x99, 0xbf, 0x03, 0x02, 0x58, 0x09, 0x00, 0xbf, 0x03, 0xf0, 0x0e, 0x8a, 0x87, 0x82, 0x62, 0x75, 0x70, 0x58, 0x55, 0x5a, 0x60, 0x67, 0x6a,
+  0x67, 0x5f, 0x66, 0x87, 0x8e, 0x8a, 0x66, 0x75, 0x70, 0x5a, 0x58, 0x5a, 0x75, 0x67, 0x6e, 0x5e, 0x60, 0xdd, 0x01, 0xd0, 0x56, 0x58, 0x68, 0x69,
+  0x62, 0x72, 0x66, 0x58, 0x66, 0x70, 0x76, 0x72, 0x6f, 0xbb, 0x04, 0xf3, 0x01, 0x72, 0x77, 0x72, 0x77, 0x75, 0x6c, 0x64, 0x5a, 0x67, 0x5f, 0x57,
+  0x56, 0x54, 0x61, 0x5f, 0x5e, 0xda, 0x01, 0x00, 0x01, 0x00, 0x80, 0x56, 0x57, 0x57, 0x58, 0x5b, 0x60, 0x65, 0x5f, 0x3f, 0x0b, 0x32, 0x5a, 0x58,
+  0x5b, 0xe3, 0x0a, 0x08, 0x01, 0x00, 0x04, 0xe4, 0x01, 0x01, 0x01, 0x00, 0x0f, 0xe7, 0x01, 0x01, 0x09, 0x01, 0x00, 0x00, 0x25, 0x00, 0x00, 0x36,
+  0x00, 0x05, 0xde, 0x01, 0x00, 0xa9, 0x03, 0x10, 0x5f, 0xa6, 0x03, 0x00, 0x04, 0x00, 0x08, 0x01, 0x00, 0x03, 0xd9, 0x01, 0x00, 0x04, 0x00, 0x00,
+  0x01, 0x00, 0x05, 0xde, 0x01, 0x00, 0xdc, 0x01, 0x05, 0xdf, 0x01, 0x01, 0x34, 0x0b, 0x05, 0x7b, 0x07, 0x00, 0x02, 0x00, 0x03, 0xdc, 0x01, 0x02,
+  0xbe, 0x03, 0x02, 0xdd, 0x01, 0x00, 0x01, 0x00, 0x03, 0xe1, 0x01, 0x00, 0xd9, 0x01, 0x04, 0x01, 0x00, 0x05, 0xdf, 0x01, 0x01, 0xde, 0x01, 0x00,
+  0x02, 0x00, 0x00, 0x01, 0x00, 0x01, 0xdd, 0x01, 0x07, 0xdf, 0x01, 0x05, 0xdd, 0x01, 0x01, 0x01, 0x00, 0x00, 0x1b, 0x0d, 0xf1, 0x02, 0x93, 0x99,
+  0x99, 0x99, 0x99, 0x3b, 0x25, 0x08, 0x7e, 0x83, 0x87, 0x7f, 0x7f, 0x93, 0x2c, 0x39, 0x31, 0x02, 0x00, 0x80, 0x39, 0x27, 0x0f, 0x08, 0x25, 0x27,
+  0x0e, 0x06, 0x0c, 0x00, 0x00, 0xdf, 0x01, 0x01, 0xe1, 0x01, 0x28, 0x1f, 0x06, 0xe0, 0x01, 0x15, 0x0e, 0xe0, 0x01, 0x40, 0x26, 0x1a, 0x13, 0x77,
+  0xe0, 0x01, 0x01, 0x0b, 0x00, 0xf0, 0x06, 0x0f, 0x6b, 0x66, 0x0b, 0x13, 0x1a, 0x0b, 0x87, 0x60, 0x72, 0x82, 0x76, 0x5d, 0x60, 0x87, 0x93, 0x0f,
+  0x0f, 0x0b, 0x7a, 0x5c, 0x66, 0x09, 0x71, 0x63, 0x70, 0x85, 0x6c, 0x6a, 0x87, 0x08, 0x7c, 0x07, 0x40, 0x99, 0x83, 0x7a, 0x88, 0xe3, 0x01, 0xf0,
+  0x37, 0x93, 0x06, 0x93, 0x8a, 0x7b, 0x74, 0x70, 0x82, 0x7b, 0x5f, 0x55, 0x58, 0x5c, 0x77, 0x8d, 0x89, 0x78, 0x5f, 0x6a, 0x87, 0x8a, 0x8e, 0x6c,
+  0x5e, 0x67, 0x67, 0x5f, 0x5e, 0x70, 0x73, 0x6a, 0x72, 0x78, 0x6e, 0x64, 0x5a, 0x68, 0x56, 0x5b, 0x58, 0x5f, 0x5e, 0x72, 0x6a, 0x66, 0x71, 0x72,
+  0x70, 0x67, 0x66, 0x7a, 0x7a, 0x83, 0x7a, 0x7a, 0x77, 0x77, 0x77, 0x71, 0x6e, 0x71, 0x6a, 0x71, 0x66, 0x56, 0x5f, 0x5b, 0x5b, 0x5f, 0x5e, 0xd6,
+  0x01, 0x03, 0x01, 0x00, 0xf0, 0x03, 0x5b, 0x57, 0x5a, 0x57, 0x5f, 0x62, 0x66, 0x62, 0x5e, 0x5e, 0x58, 0x5a, 0x5b, 0x5a, 0x5a, 0x5b, 0x5a, 0x5e,
+  0x9f, 0x01, 0x0b, 0x01, 0x00, 0x00, 0xb6, 0x01, 0x01, 0x01, 0x00, 0x00, 0xa1, 0x03, 0x0f, 0xe4, 0x01, 0x04, 0x07, 0xbb, 0x03, 0x03, 0xde, 0x01,
+  0x12, 0x60, 0xb2, 0x10, 0x09, 0x01, 0x00, 0x03, 0xd6, 0x01, 0x0b, 0x01, 0x00, 0x03, 0xdb, 0x01, 0x00, 0x01, 0x00, 0x08, 0xdc, 0x01, 0x00, 0xdb,
+  0x01, 0x01, 0xda, 0x01, 0x00, 0x01, 0x00, 0x01, 0xdc, 0x01, 0x02, 0xdf, 0x01, 0x04, 0xfb, 0x0e, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x02, 0x9c,
+  0x05, 0x01, 0xbc, 0x03, 0x03, 0xe2, 0x01, 0x0f, 0xbd, 0x03, 0x06, 0x0b, 0xdd, 0x01, 0x00, 0xdc, 0x01, 0x01, 0x05, 0x00, 0x01, 0x01, 0x00, 0x01,
+  0xba, 0x03, 0x02, 0x02, 0x00, 0xa4, 0x35, 0x1f, 0x8e, 0x88, 0x01, 0x0b, 0x83, 0x7e, 0x88, 0x35, 0xa0, 0x05, 0x80, 0x27, 0x18, 0x1a, 0x18, 0x27,
+  0x1f, 0x1f, 0x31, 0x7e, 0x07, 0x03, 0xbf, 0x03, 0x46, 0x26, 0x27, 0x13, 0x77, 0xe1, 0x01, 0x25, 0x77, 0x1a, 0x7f, 0x07, 0x70, 0x1a, 0x1a, 0x0b,
+  0x6f, 0x63, 0x63, 0x08, 0xe0, 0x01, 0xf0, 0x08, 0x1a, 0x0f, 0x9a, 0x5d, 0x6b, 0x0b, 0x0f, 0x0f, 0x13, 0x13, 0x8a, 0x6a, 0x91, 0x6b, 0x62, 0x83,
+  0x05, 0x13, 0x0f, 0x0f, 0x06, 0x87, 0x60, 0xc0, 0x03, 0x61, 0x5a, 0x63, 0x74, 0x8c, 0x8a, 0x05, 0xdf, 0x01, 0x40, 0x93, 0x83, 0x66, 0x88, 0xde,
+  0x01, 0xf0, 0x24, 0x93, 0x93, 0x8e, 0x87, 0x6e, 0x5c, 0x58, 0x58, 0x5c, 0x65, 0x5f, 0x66, 0x62, 0x6f, 0x85, 0x8a, 0x87, 0x7f, 0x73, 0x79, 0x87,
+  0x8a, 0x8e, 0x80, 0x6c, 0x80, 0x85, 0x85, 0x75, 0x6c, 0x74, 0x62, 0x74, 0x72, 0x60, 0x66, 0x67, 0x6d, 0x5e, 0x58, 0x56, 0x58, 0x64, 0x6a, 0x75,
+  0x6e, 0x67, 0x60, 0x5f, 0x62, 0x62, 0xff, 0x00, 0xf0, 0x02, 0x77, 0x77, 0x77, 0x74, 0x66, 0x5f, 0x66, 0x6c, 0x6f, 0x6c, 0x66, 0x6d, 0x5b, 0x56,
+  0x5e, 0x5e, 0x64, 0xda, 0x01, 0x00, 0x01, 0x00, 0xe0, 0x5b, 0x58, 0x57, 0x5a, 0x57, 0x5e, 0x5e, 0x65, 0x66, 0x67, 0x5c, 0x5e, 0x5a, 0x5b, 0xe1,
+  0x01, 0x14, 0x5e, 0xe1, 0x01, 0x01, 0x07, 0x00, 0x01, 0x3c, 0x07, 0x0b, 0xc4, 0x03, 0x01, 0xe6, 0x01, 0x0c, 0x01, 0x00, 0x00, 0x15, 0x00, 0x00,
+  0xb6, 0x16, 0x03, 0x35, 0x00, 0x00, 0x01, 0x00, 0x0e, 0x8c, 0x05, 0x01, 0xdf, 0x01, 0x0c, 0x01, 0x00, 0x00, 0x86, 0x14, 0x05, 0xdf, 0x01, 0x00,
+  0x52, 0x09, 0x00, 0xdc, 0x01, 0x00, 0x95, 0x05, 0x01, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0xdf, 0x01, 0x01, 0xbd, 0x03, 0x11, 0x77, 0xdf, 0x01,
+  0x09, 0xfb, 0x0e, 0x10, 0x83, 0xe0, 0x01, 0x03, 0xdd, 0x01, 0x08, 0xdf, 0x01, 0x01, 0xdd, 0x01, 0x04, 0xdf, 0x01, 0x04, 0xdd, 0x01, 0x01, 0x05,
+  0x00, 0x00, 0xd7, 0x01, 0x01, 0x05, 0x00, 0x05, 0x01, 0x00, 0x01, 0xd9, 0x01, 0x01, 0xbe, 0x03, 0xc0, 0x99, 0x99, 0x35, 0x2d, 0x04, 0x0b, 0x1f,
+  0x37, 0x1f, 0x0b, 0x13, 0x27, 0xbc, 0x03, 0x00, 0x01, 0x00, 0x81, 0x27, 0x1a, 0x2d, 0x1f, 0x13, 0x99, 0x0f, 0x2d, 0xa1, 0x05, 0x00, 0xc5, 0x01,
+  0x00, 0x01, 0x00, 0x20, 0x1f, 0x83, 0xda, 0x01, 0x02, 0x01, 0x00, 0x18, 0x8a, 0xbf, 0x03, 0x51, 0x08, 0x66, 0x63, 0x63, 0x0b, 0xe0, 0x01, 0xf0,
+  0x00, 0x13, 0x7a, 0x5d, 0x63, 0x9b, 0x05, 0x99, 0x0f, 0x13, 0x13, 0x0b, 0x99, 0x8a, 0x93, 0x0b, 0x70, 0x16, 0xc2, 0x08, 0x05, 0x9a, 0x7b, 0x5c,
+  0x74, 0x7b, 0x6f, 0x70, 0x6b, 0x6f, 0x95, 0xdf, 0x01, 0x32, 0x8e, 0x6a, 0x7f, 0x7f, 0x07, 0xf0, 0x04, 0x8e, 0x89, 0x66, 0x58, 0xa5, 0x55, 0xa5,
+  0x55, 0x5a, 0x6a, 0x6a, 0x82, 0x80, 0x82, 0x8a, 0x89, 0x7f, 0x66, 0x83, 0xba, 0x00, 0x80, 0x8a, 0x8d, 0x6c, 0x6c, 0x82, 0x7b, 0x7a, 0x72, 0x6f,
+  0x08, 0xf0, 0x16, 0x6f, 0x6e, 0x71, 0x64, 0x5f, 0x5f, 0x5f, 0x58, 0x68, 0x5a, 0x5e, 0x5b, 0x5a, 0x5b, 0x62, 0x72, 0x7a, 0x7a, 0x6f, 0x60, 0x72,
+  0x71, 0x5e, 0x5e, 0x5e, 0x5c, 0x6d, 0x72, 0x62, 0x60, 0x67, 0x58, 0x5b, 0x62, 0x67, 0x68, 0x5b, 0xdd, 0x01, 0x20, 0x57, 0x5b, 0x02, 0x00, 0x70,
+  0x5b, 0x5e, 0x5b, 0x5a, 0x5f, 0x65, 0x5f, 0xd8, 0x01, 0x72, 0x5e, 0x5a, 0x5e, 0x5e, 0x5c, 0x5e, 0x5a, 0x04, 0x00, 0x01, 0xa7, 0x01, 0x00, 0x05,
+  0x00, 0x00, 0xc0, 0x03, 0x01, 0x04, 0x00, 0x00, 0xdb, 0x01, 0x03, 0x01, 0x00, 0x01, 0xae, 0x03, 0x00, 0xd7, 0x01, 0x06, 0x02, 0x00, 0x00, 0x6a,
+  0x14, 0x00, 0x01, 0x00, 0x00, 0xdb, 0x01, 0x00, 0xbc, 0x03, 0x00, 0xcf, 0x01, 0x04, 0x01, 0x00, 0x00, 0x42, 0x11, 0x08, 0xba, 0x03, 0x00, 0xd1,
+  0x01, 0x01, 0x05, 0x00, 0x05, 0x07, 0x00, 0x09, 0xdc, 0x01, 0x00, 0xd9, 0x01, 0x07, 0xba, 0x03, 0x06, 0xde, 0x01, 0x03, 0xdf, 0x01, 0x00, 0xde,
+  0x01, 0x00, 0xdd, 0x01, 0x03, 0xdf, 0x01, 0x02, 0xbd, 0x03, 0x00, 0xbc, 0x03, 0x03, 0xe1, 0x01, 0x01, 0xdd, 0x01, 0x00, 0x04, 0x00, 0x07, 0xdc,
+  0x01, 0x00, 0xde, 0x01, 0x00, 0xdf, 0x01, 0x00, 0x02, 0x00, 0x03, 0x01, 0x00, 0x00, 0xe1, 0x01, 0x00, 0xd8, 0x01, 0x01, 0x01, 0x00, 0x01, 0xdb,
+  0x01, 0x00, 0xdd, 0x01, 0x02, 0x06, 0x00, 0x30, 0x3b, 0x3b, 0x35, 0x01, 0x00, 0x33, 0x25, 0x27, 0x25, 0xdf, 0x01, 0x70, 0x39, 0x39, 0x2d, 0x27,
+  0x1f, 0x08, 0x88, 0x02, 0x0f, 0x05, 0xbf, 0x03, 0x41, 0x26, 0x1a, 0x1f, 0x87, 0xc0, 0x03, 0x67, 0x63, 0x6b, 0x63, 0x6b, 0x6a, 0x05, 0xe0, 0x01,
+  0x51, 0x1a, 0x9a, 0x63, 0x63, 0x6b, 0xdf, 0x01, 0x72, 0x1a, 0x99, 0x62, 0x5d, 0x60, 0x8a, 0x00, 0xe3, 0x0e, 0x00, 0x67, 0x16, 0xe2, 0x0f, 0x0f,
+  0x06, 0x8e, 0x06, 0x93, 0x7b, 0x66, 0x8c, 0x85, 0x76, 0x6b, 0x5a, 0x6f, 0x9a, 0x14, 0x40, 0x8e, 0x79, 0x7f, 0x05, 0x9c, 0x05, 0xf2, 0x3a, 0x8e,
+  0x8e, 0x74, 0x60, 0x58, 0xa5, 0xa4, 0xa5, 0xa4, 0xa5, 0x55, 0x76, 0x82, 0x89, 0x6a, 0x74, 0x72, 0x7d, 0x85, 0x89, 0x8a, 0x8a, 0x6f, 0x83, 0x8e,
+  0x8e, 0x8a, 0x6e, 0x6a, 0x7a, 0x74, 0x6a, 0x7a, 0x7a, 0x83, 0x83, 0x83, 0x7f, 0x6f, 0x5f, 0x6f, 0x73, 0x67, 0x71, 0x66, 0x75, 0x5e, 0x56, 0x53,
+  0x56, 0x5f, 0x71, 0x7a, 0x77, 0x6f, 0x66, 0x6a, 0x71, 0x5e, 0x56, 0x56, 0x57, 0x5a, 0x6e, 0x70, 0x6c, 0x6a, 0x6d, 0x58, 0x5e, 0x6d, 0x6a, 0x5e,
+  0xde, 0x01, 0x00, 0x9d, 0x05, 0x20, 0x5b, 0x58, 0xb7, 0x03, 0x12, 0x5e, 0xdd, 0x01, 0x01, 0x06, 0x00, 0x10, 0x5c, 0x02, 0x00, 0x40, 0x5c, 0x5a,
+  0x5f, 0x5c, 0xe4, 0x01, 0x10, 0x5c, 0xdf, 0x01, 0x05, 0x01, 0x00, 0x00, 0x7e, 0x05, 0x00, 0xc9, 0x01, 0x01, 0x01, 0x00, 0x00, 0xd5, 0x01, 0x02,
+  0x94, 0x05, 0x04, 0x97, 0x05, 0x05, 0xbb, 0x03, 0x04, 0xde, 0x01, 0x01, 0xd4, 0x01, 0x12, 0x60, 0x65, 0x07, 0x00, 0x04, 0x00, 0x05, 0xdb, 0x01,
+  0x00, 0x03, 0x00, 0x08, 0x01, 0x00, 0x00, 0xdc, 0x01, 0x00, 0x05, 0x00, 0x02, 0x01, 0x00, 0x01, 0xdf, 0x01, 0x05, 0x01, 0x00, 0x04, 0xdc, 0x01,
+  0x00, 0xdb, 0x01, 0x04, 0xdd, 0x01, 0x00, 0x14, 0x0c, 0x00, 0xdb, 0x01, 0x00, 0x01, 0x00, 0x00, 0xdf, 0x01, 0x11, 0x7a, 0xdd, 0x01, 0x08, 0xdf,
+  0x01, 0x03, 0xdd, 0x01, 0x05, 0xdf, 0x01, 0x01, 0xd9, 0x01, 0x05, 0xdb, 0x01, 0x10, 0x8e, 0xd9, 0x01, 0x00, 0x04, 0x00, 0x06, 0x01, 0x00, 0x01,
+  0xd7, 0x01, 0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x06, 0x99, 0xd1, 0x39, 0x39, 0x3b, 0x3b, 0x3b, 0x35, 0x2c, 0x1f, 0x25, 0x1f, 0x39,
+  0x31, 0x39, 0x01, 0x00, 0xf2, 0x00, 0x31, 0x27, 0x1f, 0x13, 0x08, 0x0b, 0x1f, 0x27, 0x31, 0x31, 0x39, 0x31, 0x31, 0x31, 0x26, 0x01, 0x00, 0x41,
+  0x1f, 0x8e, 0x6f, 0x6b, 0x01, 0x00, 0x40, 0x63, 0x6b, 0x77, 0x18, 0x11, 0x00, 0x00, 0x01, 0x00, 0x90, 0x1a, 0x26, 0x1a, 0x13, 0x91, 0x62, 0x66,
+  0x87, 0x1f, 0x0c, 0x00, 0xfa, 0x7d, 0x1a, 0x7f, 0x62, 0x62, 0x6a, 0x93, 0x0f, 0x26, 0x1a, 0x1a, 0x1a, 0x1a, 0x0f, 0x1a, 0x0f, 0x1a, 0x1a, 0x0f,
+  0x06, 0x88, 0x88, 0x06, 0x9a, 0x72, 0x60, 0x6f, 0x98, 0x72, 0x60, 0x62, 0x94, 0x06, 0x0f, 0x06, 0x06, 0x06, 0x99, 0x79, 0x77, 0x05, 0x06, 0x06,
+  0x06, 0x06, 0x93, 0x8a, 0x6c, 0x59, 0x55, 0xa5, 0x55, 0xa5, 0xa4, 0xa5, 0x55, 0xa5, 0x61, 0x7b, 0x82, 0x58, 0x58, 0x55, 0x5c, 0x6f, 0x8c, 0x89,
+  0x72, 0x77, 0x87, 0x8e, 0x8e, 0x8e, 0x8e, 0x83, 0x79, 0x6a, 0x6f, 0x7a, 0x83, 0x83, 0x87, 0x8a, 0x7f, 0x7a, 0x7f, 0x80, 0x83, 0x7a, 0x80, 0x7b,
+  0x6c, 0x58, 0x56, 0x56, 0x53, 0x67, 0x76, 0x7b, 0x77, 0x6e, 0x75, 0x71, 0x64, 0x56, 0x57, 0x56, 0x57, 0x5a, 0x6d, 0x67, 0x62, 0x6e, 0x6e, 0x5e,
+  0x62, 0x6d, 0x5f, 0x58, 0x5b, 0x57, 0x57, 0x5b, 0x57, 0x5b, 0x57, 0x5a, 0x5b, 0x5b, 0x5b, 0x5e, 0x5b, 0x5e, 0x5e, 0x5e, 0x5a, 0x5e, 0x5e, 0x5e,
+  0x5e, 0x5c, 0x02, 0x00, 0x01, 0x01, 0x00, 0x12, 0x5a, 0x02, 0x00, 0x09, 0x01, 0x00, 0x10, 0x58, 0x02, 0x00, 0x02, 0x01, 0x00, 0x02, 0x08, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x19, 0x00, 0x83, 0x5c, 0x5c, 0x5a, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x01, 0x00, 0x37, 0x62, 0x60, 0x62, 0x01, 0x00, 0x11,
+  0x66, 0x04, 0x00, 0x38, 0x66, 0x62, 0x66, 0x01, 0x00, 0x13, 0x6a, 0x04, 0x00, 0x44, 0x66, 0x6a, 0x66, 0x6a, 0x01, 0x00, 0xb1, 0x6f, 0x6a, 0x6e,
+  0x6b, 0x6e, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x72, 0x02, 0x00, 0x20, 0x6f, 0x72, 0x01, 0x00, 0x10, 0x74, 0x02, 0x00, 0x41, 0x74, 0x74, 0x74, 0x77,
+  0x01, 0x00, 0x36, 0x7a, 0x77, 0x7a, 0x01, 0x00, 0x80, 0x7f, 0x7a, 0x7f, 0x7f, 0x7f, 0x83, 0x83, 0x83, 0x04, 0x00, 0x62, 0x83, 0x83, 0x83, 0x87,
+  0x83, 0x87, 0x01, 0x00, 0x41, 0x8a, 0x87, 0x8a, 0x8a, 0x04, 0x00, 0x20, 0x8a, 0x8e, 0x02, 0x00, 0x00, 0x01, 0x00, 0x02, 0x06, 0x00, 0x77, 0x8e,
+  0x93, 0x8e, 0x93, 0x8e, 0x8e, 0x93, 0x01, 0x00, 0x52, 0x99, 0x93, 0x99, 0x99, 0x99, 0x05, 0x00, 0xf0, 0x02, 0x99, 0x99, 0x06, 0x99, 0x99, 0x99,
+  0x39, 0x39, 0x3b, 0x2d, 0x35, 0x2c, 0x0e, 0x8e, 0x05, 0x0f, 0x35, 0xdd, 0x01, 0x00, 0x01, 0x00, 0x71, 0x27, 0x1f, 0x25, 0x0e, 0x93, 0x88, 0x1f,
+  0xe0, 0x01, 0x00, 0xc7, 0x01, 0x00, 0x01, 0x00, 0x20, 0x1f, 0x99, 0xe0, 0x01, 0x10, 0x63, 0x02, 0x00, 0x10, 0x00, 0xcf, 0x01, 0x02, 0x01, 0x00,
+  0x80, 0x1a, 0x1a, 0x1a, 0x91, 0x66, 0x72, 0x13, 0x1a, 0x09, 0x00, 0x71, 0x1a, 0x13, 0x08, 0x0b, 0x13, 0x13, 0x1a, 0x0c, 0x00, 0x10, 0x0f, 0x04,
+  0x00, 0xe1, 0x0f, 0x0f, 0x06, 0x0f, 0x99, 0x8a, 0x62, 0x60, 0x6b, 0x8c, 0x76, 0x6a, 0x83, 0x08, 0xe0, 0x01, 0x31, 0x01, 0x6f, 0x93, 0xdf, 0x01,
+  0x30, 0x93, 0x76, 0x59, 0xdd, 0x01, 0x02, 0x02, 0x00, 0xc0, 0x6a, 0x6d, 0x55, 0x55, 0x55, 0x55, 0x60, 0x74, 0x7b, 0x62, 0x60, 0x83, 0xb4, 0x00,
+  0x30, 0x8e, 0x8a, 0x7a, 0xf6, 0x00, 0x50, 0x83, 0x8a, 0x8a, 0x83, 0x87, 0xe7, 0x00, 0xf1, 0x0f, 0x80, 0x66, 0x5e, 0x5b, 0x56, 0x54, 0x5e, 0x6d,
+  0x6e, 0x6d, 0x5f, 0x5e, 0x5a, 0x56, 0x57, 0x54, 0x56, 0x56, 0x5a, 0x6a, 0x6d, 0x5c, 0x6a, 0x6f, 0x6a, 0x6d, 0x67, 0x61, 0x64, 0x5e, 0xdf, 0x01,
+  0x62, 0x5e, 0x57, 0x5e, 0x5b, 0x5a, 0x5b, 0xdd, 0x01, 0x00, 0x01, 0x00, 0x01, 0xd7, 0x01, 0x15, 0x5f, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x01, 0x01,
+  0x00, 0x0e, 0xe3, 0x01, 0x23, 0x5a, 0x5a, 0xd6, 0x01, 0x01, 0xd8, 0x01, 0x00, 0xdb, 0x01, 0x10, 0x5a, 0x29, 0x00, 0x0f, 0xdd, 0x01, 0x01, 0x00,
+  0xd4, 0x01, 0x02, 0x06, 0x00, 0x00, 0xc8, 0x01, 0x07, 0x01, 0x00, 0x00, 0xd3, 0x01, 0x00, 0x05, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x03,
+  0x01, 0x00, 0x10, 0x6f, 0x02, 0x00, 0x03, 0x01, 0x00, 0x12, 0x72, 0xdc, 0x01, 0x01, 0x01, 0x00, 0x00, 0xdc, 0x01, 0x00, 0x02, 0x00, 0x00, 0x01,
+  0x00, 0x11, 0x7a, 0xeb, 0x00, 0x01, 0x01, 0x00, 0x10, 0x7f, 0x02, 0x00, 0x00, 0xe0, 0x01, 0x03, 0xde, 0x01, 0x06, 0xdf, 0x01, 0x11, 0x87, 0xdb,
+  0x01, 0x02, 0x01, 0x00, 0x04, 0xd9, 0x01, 0x02, 0x01, 0x00, 0x00, 0xdf, 0x01, 0x00, 0xd6, 0x01, 0x01, 0x01, 0x00, 0x16, 0x99, 0x02, 0x00, 0x01,
+  0xdc, 0x01, 0x00, 0xde, 0x01, 0xd3, 0x06, 0x99, 0x39, 0x39, 0x2d, 0x1f, 0x18, 0x27, 0x0e, 0x99, 0x13, 0x2c, 0x31, 0xc1, 0x03, 0x80, 0x1f, 0x1f,
+  0x1f, 0x1f, 0x0e, 0x99, 0x7e, 0x0e, 0xdf, 0x01, 0x01, 0xc1, 0x03, 0x00, 0xe5, 0x01, 0x33, 0x1f, 0x0b, 0x6a, 0xdf, 0x01, 0x40, 0x6b, 0x93, 0x1f,
+  0x1a, 0xdc, 0x01, 0x00, 0xbf, 0x03, 0x70, 0x26, 0x26, 0x13, 0x8e, 0x6a, 0x06, 0x1f, 0xc9, 0x03, 0x50, 0x1a, 0x1a, 0x1f, 0x1a, 0x1f, 0xe7, 0x01,
+  0x00, 0xdb, 0x01, 0x00, 0x05, 0x00, 0xe1, 0x1a, 0x0f, 0x0f, 0x06, 0x08, 0x8a, 0x7a, 0x82, 0x6f, 0x5c, 0x70, 0x7b, 0x7a, 0x05, 0xdf, 0x01, 0x32,
+  0x06, 0x7f, 0x8e, 0xbf, 0x03, 0x26, 0x85, 0x5c, 0xdf, 0x01, 0xf0, 0x01, 0x55, 0x55, 0x58, 0xa5, 0xa4, 0x55, 0x5c, 0x70, 0x6e, 0x6a, 0x5f, 0x6a,
+  0x7b, 0x8a, 0x8e, 0x8e, 0xab, 0x02, 0x70, 0x6f, 0x72, 0x77, 0x7f, 0x83, 0x8a, 0x8a, 0xdf, 0x01, 0xf0, 0x00, 0x87, 0x83, 0x7b, 0x5f, 0x5e, 0x56,
+  0x56, 0x53, 0x56, 0x56, 0x57, 0x58, 0x56, 0x58, 0x5e, 0xc0, 0x03, 0xd4, 0x5b, 0x68, 0x6e, 0x6d, 0x66, 0x6a, 0x6e, 0x76, 0x66, 0x5f, 0x5e, 0x68,
+  0x5f, 0xdf, 0x01, 0x01, 0xbe, 0x03, 0x00, 0x01, 0x00, 0x50, 0x5f, 0x5e, 0x5c, 0x5e, 0x5f, 0x01, 0x00, 0x01, 0xdb, 0x01, 0x00, 0x02, 0x00, 0x00,
+  0x8b, 0x03, 0x10, 0x5f, 0xb5, 0x01, 0x05, 0x01, 0x00, 0x00, 0xc6, 0x01, 0x00, 0xcd, 0x01, 0x0b, 0x01, 0x00, 0x01, 0x16, 0x00, 0x00, 0x20, 0x00,
+  0x0e, 0xde, 0x01, 0x01, 0xd7, 0x01, 0x02, 0x02, 0x00, 0x07, 0x01, 0x00, 0x02, 0xd3, 0x01, 0x03, 0x06, 0x00, 0x0b, 0x01, 0x00, 0x21, 0x6e, 0x6a,
+  0xbb, 0x03, 0x08, 0xdc, 0x01, 0x02, 0xb9, 0x03, 0x04, 0xdc, 0x01, 0x01, 0xbc, 0x03, 0x03, 0xde, 0x01, 0x01, 0xdd, 0x01, 0x02, 0xdf, 0x01, 0x04,
+  0x01, 0x00, 0x06, 0xdf, 0x01, 0x03, 0xbc, 0x03, 0x00, 0x01, 0x00, 0x05, 0xc0, 0x03, 0x0c, 0xdd, 0x01, 0x00, 0xd6, 0x01, 0x00, 0x02, 0x00, 0x01,
+  0x01, 0x00, 0x02, 0xdc, 0x01, 0xf3, 0x02, 0x99, 0x99, 0x06, 0x05, 0x99, 0x05, 0x39, 0x39, 0x2d, 0x01, 0x13, 0x2c, 0x08, 0x0e, 0x2d, 0x35, 0x39,
+  0xe0, 0x01, 0x91, 0x1a, 0x1f, 0x2c, 0x08, 0x9a, 0x87, 0x88, 0x13, 0x2d, 0xe1, 0x01, 0x12, 0x26, 0x02, 0x00, 0x31, 0x27, 0x0b, 0x6f, 0xe0, 0x01,
+  0x50, 0x63, 0x6b, 0x6b, 0x13, 0x27, 0xb9, 0x03, 0x02, 0xe1, 0x01, 0x43, 0x1a, 0x1a, 0x93, 0x8e, 0xdf, 0x01, 0x70, 0x1a, 0x1a, 0x13, 0x1a, 0x0f,
+  0x13, 0x0f, 0xdc, 0x01, 0x00, 0x05, 0x00, 0x10, 0x0f, 0x01, 0x00, 0xb2, 0x13, 0x72, 0x72, 0x8c, 0x72, 0x5d, 0x5c, 0x74, 0x93, 0x06, 0x0f, 0xe1,
+  0x01, 0x00, 0x01, 0x00, 0x53, 0x99, 0x93, 0x89, 0x62, 0xa5, 0x01, 0x00, 0x00, 0xe7, 0x01, 0x01, 0x04, 0x00, 0xf3, 0x11, 0x65, 0x70, 0x5c, 0x65,
+  0x60, 0x71, 0x66, 0x72, 0x87, 0x87, 0x7f, 0x7f, 0x83, 0x89, 0x6f, 0x7a, 0x83, 0x7a, 0x87, 0x87, 0x87, 0x7a, 0x72, 0x83, 0x83, 0x8a, 0x7a, 0x66,
+  0x5f, 0x5e, 0x5e, 0x56, 0x01, 0x00, 0xf0, 0x05, 0x5e, 0x68, 0x5e, 0x5b, 0x56, 0x5f, 0x6e, 0x62, 0x62, 0x6c, 0x60, 0x6a, 0x6f, 0x62, 0x5e, 0x5e,
+  0x67, 0x5f, 0x5b, 0x5a, 0xba, 0x03, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x40, 0x5f, 0x5f, 0x5e, 0x5f, 0xde, 0x01, 0x60, 0x5e, 0x5f, 0x5c, 0x5f,
+  0x5f, 0x60, 0x02, 0x00, 0x20, 0x60, 0x5c, 0x07, 0x00, 0x01, 0xe2, 0x01, 0x07, 0xe4, 0x01, 0x01, 0xcb, 0x01, 0x02, 0x02, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x09, 0x00, 0x03, 0xba, 0x03, 0x07, 0xde, 0x01, 0x02, 0xdd, 0x01, 0x0c, 0xd5, 0x01, 0x04, 0x01, 0x00, 0x03, 0xd7, 0x01, 0x00, 0x04, 0x00,
+  0x0a, 0x01, 0x00, 0x10, 0x6e, 0xb9, 0x03, 0x05, 0xbb, 0x03, 0x06, 0xe1, 0x01, 0x00, 0xdf, 0x01, 0x13, 0x72, 0x99, 0x05, 0x12, 0x79, 0xdf, 0x01,
+  0x02, 0x01, 0x00, 0x10, 0x7f, 0x03, 0x00, 0x00, 0xdd, 0x01, 0x25, 0x7a, 0x83, 0xbf, 0x03, 0x05, 0xdf, 0x01, 0x0f, 0xdd, 0x01, 0x03, 0x22, 0x8e,
+  0x93, 0x99, 0x05, 0x00, 0x04, 0x00, 0x02, 0x01, 0x00, 0x04, 0xdd, 0x01, 0x03, 0x01, 0x00, 0x00, 0xe4, 0x01, 0xf2, 0x00, 0x05, 0x99, 0x06, 0x05,
+  0x31, 0x39, 0x31, 0x09, 0x1f, 0x18, 0x08, 0x8e, 0x25, 0x2d, 0x2d, 0xdf, 0x01, 0x90, 0x39, 0x0e, 0x27, 0x18, 0x88, 0x83, 0x7f, 0x7f, 0x13, 0xbd,
+  0x03, 0x01, 0x01, 0x00, 0x00, 0xcb, 0x01, 0x22, 0x1f, 0x0e, 0xe0, 0x01, 0x40, 0x6b, 0x63, 0x77, 0x13, 0xd0, 0x01, 0x10, 0x0f, 0x05, 0x00, 0x00,
+  0x02, 0x00, 0x01, 0xea, 0x01, 0x01, 0x96, 0x05, 0x61, 0x0b, 0x08, 0x99, 0x9b, 0x99, 0x7f, 0x0b, 0x00, 0x01, 0x01, 0x00, 0x00, 0xa1, 0x05, 0x85,
+  0x05, 0x8a, 0x85, 0x6f, 0x66, 0x62, 0x87, 0x08, 0xdd, 0x01, 0x53, 0x06, 0x06, 0x05, 0x93, 0x85, 0xdf, 0x01, 0x00, 0xbe, 0x03, 0x04, 0x02, 0x00,
+  0xf0, 0x16, 0x58, 0x65, 0x60, 0x62, 0x65, 0x5c, 0x60, 0x6a, 0x7a, 0x77, 0x7a, 0x62, 0x6f, 0x83, 0x8a, 0x83, 0x72, 0x6a, 0x7b, 0x80, 0x80, 0x6a,
+  0x5c, 0x72, 0x83, 0x87, 0x77, 0x66, 0x68, 0x58, 0x5a, 0x5f, 0x5f, 0x56, 0x64, 0x5f, 0x5b, 0xe1, 0x01, 0xc0, 0x64, 0x5f, 0x5a, 0x65, 0x73, 0x6e,
+  0x5f, 0x62, 0x66, 0x6a, 0x6a, 0x6e, 0xad, 0x03, 0x14, 0x5e, 0x7a, 0x07, 0x00, 0xde, 0x01, 0x02, 0x02, 0x00, 0x03, 0x01, 0x00, 0x00, 0xdd, 0x01,
+  0x01, 0xde, 0x01, 0x00, 0x01, 0x00, 0x30, 0x5f, 0x5c, 0x60, 0xe3, 0x01, 0x0d, 0x01, 0x00, 0x03, 0xd4, 0x01, 0x03, 0x07, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x2e, 0x00, 0x00, 0x01, 0x00, 0x00, 0xdb, 0x01, 0x01, 0xdd, 0x01, 0x0e, 0x01, 0x00, 0x03, 0xda, 0x01, 0x0b, 0x01, 0x00, 0x14, 0x6e, 0x94,
+  0x05, 0x00, 0xb9, 0x03, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x03, 0xdc, 0x01, 0x04, 0x75, 0x07, 0x02, 0xdd, 0x01, 0x31, 0x7a, 0x77, 0x7a, 0x05,
+  0x00, 0x05, 0x01, 0x00, 0x02, 0xde, 0x01, 0x18, 0x7f, 0x7a, 0x07, 0x00, 0x02, 0x00, 0x02, 0x01, 0x00, 0x03, 0xe1, 0x01, 0x10, 0x8e, 0x03, 0x00,
+  0x04, 0xe1, 0x01, 0x00, 0xdd, 0x01, 0x06, 0xdb, 0x01, 0x04, 0xdd, 0x01, 0x01, 0x05, 0x00, 0x03, 0xdc, 0x01, 0x11, 0x99, 0xde, 0x01, 0x10, 0x05,
+  0xc0, 0x03, 0x90, 0x2d, 0x18, 0x08, 0x1e, 0x13, 0x18, 0x09, 0x2d, 0x2d, 0xde, 0x01, 0x80, 0x39, 0x39, 0x39, 0x35, 0x18, 0x05, 0x87, 0x83, 0xc0,
+  0x03, 0x00, 0x01, 0x00, 0x01, 0xbe, 0x03, 0x53, 0x31, 0x26, 0x27, 0x13, 0x72, 0xe0, 0x01, 0x10, 0x8a, 0x7f, 0x07, 0x00, 0xd5, 0x01, 0x05, 0x05,
+  0x00, 0x01, 0xe8, 0x01, 0x94, 0x1f, 0x93, 0x77, 0x6b, 0x62, 0x77, 0x77, 0x72, 0x0f, 0xe0, 0x01, 0xc0, 0x0f, 0x1a, 0x13, 0x88, 0x99, 0x08, 0x8e,
+  0x7f, 0x83, 0x87, 0x8a, 0x08, 0xbe, 0x03, 0x00, 0x02, 0x00, 0x00, 0xbe, 0x03, 0x30, 0x8e, 0x77, 0x5c, 0xdd, 0x01, 0x06, 0x01, 0x00, 0x00, 0xc2,
+  0x03, 0xf0, 0x2b, 0x55, 0x55, 0xa5, 0x5c, 0x5a, 0x5c, 0x55, 0x69, 0x67, 0x72, 0x72, 0x7b, 0x66, 0x6a, 0x74, 0x8a, 0x89, 0x6a, 0x5a, 0x66, 0x72,
+  0x66, 0x67, 0x5c, 0x6a, 0x7f, 0x82, 0x7a, 0x71, 0x66, 0x5e, 0x6d, 0x76, 0x76, 0x5f, 0x6d, 0x76, 0x5e, 0x56, 0x56, 0x58, 0x6d, 0x68, 0x62, 0x68,
+  0x6e, 0x76, 0x72, 0x5f, 0x5f, 0x6e, 0x76, 0x72, 0x6e, 0x62, 0x5e, 0x64, 0x5f, 0xdb, 0x01, 0x00, 0x04, 0x00, 0x02, 0xdf, 0x01, 0x03, 0x01, 0x00,
+  0x31, 0x62, 0x5f, 0x62, 0xdf, 0x01, 0x02, 0xdc, 0x01, 0x05, 0x01, 0x00, 0x00, 0x9a, 0x03, 0x01, 0x02, 0x00, 0x0f, 0x01, 0x00, 0x06, 0x00, 0xbb,
+  0x03, 0x00, 0xe2, 0x01, 0x02, 0xba, 0x03, 0x07, 0xdf, 0x01, 0x03, 0xd3, 0x01, 0x00, 0x06, 0x00, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x11, 0x6e,
+  0x02, 0x00, 0x01, 0xd5, 0x01, 0x04, 0x02, 0x00, 0x00, 0xdb, 0x01, 0x02, 0xdd, 0x01, 0x01, 0xdf, 0x01, 0x03, 0xe1, 0x01, 0x00, 0x01, 0x00, 0x00,
+  0xdc, 0x01, 0x03, 0xdf, 0x01, 0x05, 0x9a, 0x05, 0x01, 0xdd, 0x01, 0x10, 0x7a, 0xba, 0x03, 0x05, 0xbb, 0x03, 0x00, 0x01, 0x00, 0x04, 0xde, 0x01,
+  0x03, 0xdd, 0x01, 0x01, 0x01, 0x00, 0x01, 0xdf, 0x01, 0x05, 0xe1, 0x01, 0x00, 0xd7, 0x01, 0x03, 0x01, 0x00, 0x24, 0x99, 0x93, 0xda, 0x01, 0x02,
+  0xdd, 0x01, 0x10, 0x95, 0x07, 0x00, 0x10, 0x05, 0xde, 0x01, 0x01, 0xc0, 0x03, 0x91, 0x2d, 0x1f, 0x25, 0x18, 0x8d, 0x88, 0x88, 0x1f, 0x35, 0xc1,
+  0x03, 0x90, 0x31, 0x39, 0x2d, 0x08, 0x79, 0x7f, 0x0c, 0x13, 0x1f, 0xde, 0x01, 0x04, 0xe1, 0x01, 0x50, 0x26, 0x1f, 0x13, 0x77, 0x66, 0xde, 0x01,
+  0x40, 0x6b, 0x6b, 0x05, 0x27, 0xd7, 0x01, 0x01, 0xda, 0x01, 0x01, 0xe1, 0x01, 0x01, 0x0a, 0x00, 0x50, 0x26, 0x27, 0x13, 0x66, 0x5d, 0x01, 0x00,
+  0x12, 0x7a, 0x84, 0x07, 0xd0, 0x0f, 0x0f, 0x1a, 0x0f, 0x0a, 0x93, 0x72, 0x05, 0x0b, 0x88, 0x99, 0x93, 0x05, 0xaa, 0x05, 0x00, 0xdb, 0x01, 0x00,
+  0x01, 0x00, 0x37, 0x93, 0x91, 0x7b, 0xdf, 0x01, 0x00, 0xba, 0x03, 0x01, 0xdf, 0x01, 0xf5, 0x2a, 0xa5, 0x55, 0x55, 0x5a, 0x5c, 0x55, 0x55, 0x5a,
+  0x6d, 0x66, 0x76, 0x77, 0x80, 0x8a, 0x87, 0x8a, 0x8e, 0x79, 0x66, 0x5e, 0x67, 0x6d, 0x67, 0x6c, 0x66, 0x80, 0x82, 0x62, 0x5c, 0x6d, 0x72, 0x7b,
+  0x7b, 0x7d, 0x72, 0x76, 0x78, 0x5e, 0x58, 0x56, 0x60, 0x71, 0x74, 0x67, 0x62, 0x5f, 0x6a, 0x6c, 0x6c, 0x60, 0x6f, 0x77, 0x77, 0x66, 0x6e, 0x6c,
+  0x5f, 0x9a, 0x05, 0x08, 0xdf, 0x01, 0x11, 0x60, 0xe1, 0x01, 0x10, 0x62, 0xa6, 0x01, 0x00, 0xd7, 0x01, 0x06, 0x01, 0x00, 0x00, 0xc0, 0x01, 0x03,
+  0xc7, 0x01, 0x01, 0x02, 0x00, 0x01, 0x01, 0x00, 0x00, 0xd8, 0x03, 0x00, 0xc1, 0x05, 0x01, 0xd9, 0x01, 0x07, 0xdc, 0x01, 0x14, 0x62, 0xdc, 0x01,
+  0x00, 0xd1, 0x01, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x09, 0x01, 0x00, 0x09, 0xdb, 0x01, 0x00, 0xd5, 0x01, 0x06, 0x02, 0x00, 0x01, 0x01, 0x00,
+  0x04, 0xde, 0x01, 0x08, 0xbc, 0x03, 0x04, 0xdf, 0x01, 0x02, 0x01, 0x00, 0x02, 0x9a, 0x05, 0x22, 0x7a, 0x83, 0x99, 0x05, 0x05, 0xe0, 0x01, 0x04,
+  0xde, 0x01, 0x00, 0xdf, 0x01, 0x00, 0xe1, 0x01, 0x04, 0xbc, 0x03, 0x03, 0xdd, 0x01, 0x00, 0x9d, 0x05, 0x00, 0xd8, 0x01, 0x02, 0x01, 0x00, 0x02,
+  0xde, 0x01, 0x00, 0x04, 0x00, 0x02, 0x01, 0x00, 0x10, 0x05, 0xe3, 0x01, 0x61, 0x99, 0x05, 0x99, 0x05, 0x05, 0x08, 0xc0, 0x03, 0xb1, 0x31, 0x31,
+  0x1f, 0x99, 0x93, 0x7e, 0x99, 0x95, 0x01, 0x27, 0x39, 0x63, 0x09, 0x82, 0x27, 0x13, 0x8e, 0x00, 0x91, 0x88, 0x93, 0x1f, 0xc0, 0x03, 0x00, 0x01,
+  0x00, 0x61, 0x26, 0x31, 0x26, 0x1f, 0x1f, 0x77, 0xdf, 0x01, 0x20, 0x66, 0x74, 0x7f, 0x07, 0x02, 0x01, 0x00, 0x03, 0xe1, 0x01, 0x02, 0xa2, 0x05,
+  0x93, 0x91, 0x77, 0x5d, 0x5d, 0x59, 0x5d, 0x5d, 0x7b, 0x13, 0xdf, 0x01, 0x90, 0x13, 0x01, 0x7f, 0x6b, 0x62, 0x91, 0x0b, 0x0f, 0x06, 0xde, 0x01,
+  0x00, 0x4b, 0x0b, 0x01, 0xbf, 0x03, 0x40, 0x99, 0x89, 0x6f, 0x59, 0xd9, 0x01, 0x0a, 0x01, 0x00, 0x10, 0x65, 0xc0, 0x03, 0xa0, 0x55, 0x59, 0x55,
+  0xa5, 0x58, 0x61, 0x55, 0x66, 0x66, 0x7a, 0xd2, 0x00, 0xf0, 0x08, 0x8a, 0x71, 0x5a, 0x58, 0x5e, 0x5c, 0x6c, 0x7b, 0x85, 0x6e, 0x5c, 0x62, 0x7b,
+  0x7b, 0x6a, 0x6f, 0x72, 0x77, 0x7c, 0x71, 0x5a, 0x57, 0x58, 0x26, 0x0d, 0xc0, 0x74, 0x6a, 0x6e, 0x72, 0x6a, 0x66, 0x6a, 0x77, 0x77, 0x74, 0x74,
+  0x6d, 0xd8, 0x01, 0x00, 0x01, 0x00, 0x00, 0xdc, 0x01, 0x03, 0xdf, 0x01, 0x00, 0x6f, 0x07, 0x01, 0xdf, 0x01, 0x02, 0xe1, 0x01, 0x01, 0x05, 0x00,
+  0x08, 0xe8, 0x01, 0x00, 0xc6, 0x01, 0x00, 0xcc, 0x01, 0x00, 0xdf, 0x01, 0x00, 0x05, 0x00, 0x00, 0xe6, 0x01, 0x00, 0x18, 0x00, 0x03, 0x01, 0x00,
+  0x00, 0x33, 0x00, 0x00, 0x01, 0x00, 0x0c, 0xba, 0x03, 0x08, 0x01, 0x00, 0x50, 0x6e, 0x6a, 0x6a, 0x6e, 0x6b, 0x07, 0x00, 0x01, 0x44, 0x09, 0x00,
+  0x04, 0x00, 0x02, 0x02, 0x00, 0x0a, 0x01, 0x00, 0x07, 0xde, 0x01, 0x04, 0x76, 0x07, 0x01, 0xda, 0x01, 0x01, 0x05, 0x00, 0x03, 0x01, 0x00, 0x00,
+  0xdd, 0x01, 0x01, 0x9a, 0x05, 0x00, 0x02, 0x00, 0x03, 0x01, 0x00, 0x01, 0x9b, 0x05, 0x02, 0xe1, 0x01, 0x01, 0xdd, 0x01, 0x01, 0x01, 0x00, 0x01,
+  0xdd, 0x01, 0x05, 0xdf, 0x01, 0x07, 0xde, 0x01, 0x00, 0xe1, 0x01, 0x03, 0xde, 0x01, 0x00, 0xd7, 0x01, 0x02, 0x02, 0x00, 0x00, 0xdd, 0x01, 0x00,
+  0xbd, 0x03, 0x30, 0x05, 0x08, 0x08, 0xd3, 0x01, 0x81, 0x31, 0x1f, 0x13, 0x7e, 0x94, 0x7e, 0x00, 0x25, 0x0c, 0x00, 0x75, 0x39, 0x31, 0x04, 0x01,
+  0x9a, 0x93, 0x8f, 0xc0, 0x03, 0x01, 0xdf, 0x01, 0x42, 0x26, 0x1f, 0x1f, 0x79, 0xa0, 0x05, 0x23, 0x7a, 0x1f, 0xe0, 0x01, 0x02, 0xde, 0x01, 0x00,
+  0x06, 0x00, 0x00, 0x02, 0x00, 0xa0, 0x13, 0x99, 0x7a, 0x77, 0x91, 0x91, 0x72, 0x63, 0x77, 0x1f, 0xa0, 0x05, 0xb2, 0x06, 0x01, 0x13, 0x13, 0x93,
+  0x62, 0x6f, 0x83, 0x7f, 0x08, 0x8e, 0xe0, 0x01, 0x01, 0xdd, 0x01, 0x00, 0x7b, 0x07, 0x1c, 0x60, 0xdf, 0x01, 0x50, 0xa4, 0xa5, 0x55, 0x59, 0x65,
+  0xc1, 0x03, 0xf0, 0x1d, 0xa5, 0x58, 0x55, 0x58, 0x65, 0x58, 0x55, 0x55, 0x58, 0x6a, 0x7b, 0x89, 0x8a, 0x8a, 0x87, 0x89, 0x5f, 0x58, 0x56, 0x58,
+  0x68, 0x7b, 0x85, 0x7b, 0x5f, 0x66, 0x76, 0x6f, 0x60, 0x6a, 0x76, 0x71, 0x76, 0x64, 0x5a, 0x57, 0x58, 0x60, 0x6e, 0x77, 0x6f, 0x7b, 0x7a, 0x72,
+  0xbe, 0x08, 0x50, 0x77, 0x77, 0x74, 0x71, 0x62, 0xdb, 0x01, 0x00, 0xda, 0x01, 0x00, 0x02, 0x00, 0x01, 0x01, 0x00, 0x40, 0x60, 0x61, 0x62, 0x5f,
+  0x9f, 0x01, 0x02, 0xd8, 0x01, 0x00, 0x06, 0x00, 0x01, 0x09, 0x00, 0x00, 0xba, 0x01, 0x0c, 0x01, 0x00, 0x02, 0xd6, 0x01, 0x02, 0x06, 0x00, 0x04,
+  0x01, 0x00, 0x00, 0x30, 0x00, 0x01, 0x01, 0x00, 0x06, 0xdf, 0x01, 0x0f, 0x01, 0x00, 0x02, 0x10, 0x6f, 0xdb, 0x01, 0x02, 0xd9, 0x01, 0x0d, 0x01,
+  0x00, 0x10, 0x72, 0x05, 0x00, 0x01, 0xda, 0x01, 0x01, 0x01, 0x00, 0x00, 0xdd, 0x01, 0x07, 0xdf, 0x01, 0x0e, 0xdc, 0x01, 0x00, 0x01, 0x00, 0x06,
+  0xde, 0x01, 0x03, 0xe0, 0x01, 0x01, 0x01, 0x00, 0x06, 0xdf, 0x01, 0x03, 0xe1, 0x01, 0x00, 0x01, 0x00, 0x03, 0x37, 0x0b, 0x00, 0x04, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0xd9, 0x01, 0x01, 0x05, 0x00, 0x01, 0x01, 0x00, 0x10, 0x05, 0x02, 0x00, 0x30, 0x05, 0x05, 0x99, 0xdc, 0x01, 0x10, 0x05, 0xc1,
+  0x03, 0x10, 0x08, 0x94, 0x05, 0x70, 0x31, 0x2d, 0x2c, 0x2c, 0x25, 0x8d, 0x01, 0xe2, 0x10, 0xc0, 0x31, 0x39, 0x31, 0x35, 0x0f, 0x94, 0x07, 0x91,
+  0x0e, 0x0e, 0x08, 0x27, 0xdc, 0x01, 0x01, 0x01, 0x00, 0x00, 0xc8, 0x01, 0x30, 0x1f, 0x7f, 0x6b, 0xa1, 0x05, 0x17, 0x66, 0xfe, 0x0e, 0x06, 0xde,
+  0x01, 0xf0, 0x0c, 0x1a, 0x0b, 0x93, 0x94, 0x7a, 0x0b, 0x0b, 0x13, 0x9a, 0x6b, 0x77, 0x08, 0x1a, 0x27, 0x1a, 0x1a, 0x0b, 0x93, 0x0b, 0x0b, 0x89,
+  0x5d, 0x6b, 0x92, 0x91, 0x13, 0x99, 0xaa, 0x05, 0x02, 0xe1, 0x01, 0x5c, 0x0f, 0x99, 0x93, 0x7b, 0x5c, 0xdf, 0x01, 0x71, 0xa5, 0xa5, 0xa5, 0x5c,
+  0x5c, 0x69, 0x58, 0xe1, 0x01, 0x30, 0x5a, 0x69, 0x65, 0x0a, 0x0f, 0xf0, 0x15, 0x5a, 0x6a, 0x76, 0x72, 0x7f, 0x7f, 0x89, 0x82, 0x5f, 0x58, 0x58,
+  0x5c, 0x67, 0x71, 0x6a, 0x76, 0x7b, 0x7a, 0x7b, 0x6c, 0x5c, 0x6c, 0x76, 0x5f, 0x5e, 0x5a, 0x57, 0x5e, 0x5f, 0x66, 0x7b, 0x77, 0x7f, 0x7a, 0x7a,
+  0x77, 0x39, 0x01, 0x22, 0x6f, 0x72, 0xda, 0x01, 0x20, 0x67, 0x67, 0xd9, 0x01, 0x00, 0x01, 0x00, 0x10, 0x61, 0xb5, 0x03, 0x03, 0xdf, 0x01, 0x0b,
+  0x01, 0x00, 0x00, 0xba, 0x01, 0x00, 0xc1, 0x01, 0x0f, 0x01, 0x00, 0x07, 0x0e, 0xdb, 0x01, 0x0a, 0xb9, 0x03, 0x01, 0xd1, 0x01, 0x0a, 0x02, 0x00,
+  0x09, 0xdd, 0x01, 0x02, 0xaf, 0x03, 0x00, 0x05, 0x00, 0x01, 0xdc, 0x01, 0x01, 0x05, 0x00, 0x00, 0xdd, 0x01, 0x00, 0xdf, 0x01, 0x03, 0x12, 0x0d,
+  0x0f, 0xdf, 0x01, 0x00, 0x1b, 0x80, 0x79, 0x07, 0x06, 0xdd, 0x01, 0x00, 0xde, 0x01, 0x04, 0xe0, 0x01, 0x05, 0xdd, 0x01, 0x01, 0x01, 0x00, 0x00,
+  0xd7, 0x01, 0x02, 0x01, 0x00, 0x01, 0x13, 0x0d, 0x03, 0xde, 0x01, 0x01, 0xdb, 0x01, 0x01, 0x53, 0x09, 0x20, 0x06, 0x99, 0x99, 0x05, 0x10, 0x06,
+  0x9f, 0x05, 0x20, 0x08, 0x05, 0xe0, 0x01, 0x90, 0x39, 0x39, 0x2d, 0x35, 0x25, 0x18, 0x04, 0x27, 0x2d, 0xdf, 0x01, 0x98, 0x39, 0x2d, 0x1f, 0x00,
+  0x94, 0x14, 0x9b, 0x9a, 0x7e, 0xa1, 0x05, 0x42, 0x26, 0x27, 0x1f, 0x88, 0xbe, 0x12, 0x19, 0x8a, 0xc0, 0x03, 0x00, 0xad, 0x03, 0x00, 0x05, 0x00,
+  0xf4, 0x09, 0x99, 0x83, 0x91, 0x08, 0x1f, 0x13, 0x1f, 0x08, 0x08, 0x93, 0x93, 0x13, 0x1a, 0x13, 0x13, 0x05, 0x05, 0x9a, 0x9a, 0x92, 0x63, 0x63,
+  0x6b, 0x7f, 0xdf, 0x01, 0x00, 0xe2, 0x01, 0x4f, 0x06, 0x99, 0x77, 0x59, 0xdf, 0x01, 0x00, 0xd0, 0x65, 0x70, 0x70, 0x76, 0x62, 0x5c, 0x5a, 0x5a,
+  0x55, 0x5c, 0x70, 0x6d, 0x76, 0xe0, 0x01, 0x80, 0x58, 0x5c, 0x5c, 0x66, 0x87, 0x8d, 0x7a, 0x85, 0xe1, 0x01, 0xf1, 0x04, 0x5e, 0x5c, 0x5c, 0x6e,
+  0x82, 0x7b, 0x72, 0x76, 0x6e, 0x6e, 0x7c, 0x66, 0x5e, 0x5e, 0x61, 0x6d, 0x62, 0x66, 0x7b, 0xe1, 0x04, 0xf1, 0x00, 0x77, 0x76, 0x74, 0x66, 0x66,
+  0x67, 0x5f, 0x60, 0x67, 0x66, 0x5f, 0x5f, 0x65, 0x6d, 0x68, 0xdc, 0x01, 0x00, 0xba, 0x03, 0x31, 0x61, 0x62, 0x62, 0x04, 0x00, 0x00, 0xa6, 0x01,
+  0x04, 0x01, 0x00, 0x04, 0xba, 0x01, 0x00, 0x08, 0x00, 0x00, 0xc9, 0x01, 0x0d, 0x01, 0x00, 0x00, 0x18, 0x00, 0x00, 0x21, 0x00, 0x02, 0x01, 0x00,
+  0x00, 0xd9, 0x01, 0x00, 0x01, 0x00, 0x07, 0x98, 0x05, 0x04, 0xdb, 0x01, 0x03, 0x8f, 0x05, 0x00, 0x06, 0x00, 0x06, 0xdb, 0x01, 0x01, 0xd1, 0x01,
+  0x02, 0xce, 0x01, 0x04, 0x07, 0x00, 0x02, 0x01, 0x00, 0x01, 0xdc, 0x01, 0x00, 0xde, 0x01, 0x03, 0xdf, 0x01, 0x07, 0xdc, 0x01, 0x20, 0x7a, 0x80,
+  0xdd, 0x01, 0x31, 0x7a, 0x7f, 0x80, 0xdc, 0x01, 0x05, 0xde, 0x01, 0x07, 0xdd, 0x01, 0x20, 0x87, 0x8a, 0x03, 0x00, 0x00, 0xdc, 0x01, 0x01, 0x01,
+  0x00, 0x07, 0xdf, 0x01, 0x00, 0xd8, 0x01, 0x04, 0x01, 0x00, 0x06, 0xde, 0x01, 0x00, 0xe0, 0x01, 0x12, 0x06, 0xde, 0x01, 0x00, 0xd6, 0x01, 0x51,
+  0x05, 0x08, 0x08, 0x05, 0x08, 0x01, 0x00, 0x01, 0xe0, 0x01, 0x70, 0x2d, 0x35, 0x1f, 0x99, 0x0b, 0x25, 0x1f, 0xcb, 0x03, 0xb8, 0x39, 0x31, 0x39,
+  0x1f, 0x79, 0x07, 0x91, 0x7a, 0x7f, 0x74, 0x1a, 0xe0, 0x01, 0x50, 0x26, 0x1f, 0x99, 0x89, 0x72, 0xc0, 0x03, 0x15, 0x8e, 0xc0, 0x03, 0x00, 0x9f,
+  0x05, 0x00, 0x05, 0x00, 0xf0, 0x0d, 0x1a, 0x26, 0x1f, 0x05, 0x87, 0x7a, 0x7a, 0x08, 0x13, 0x13, 0x0b, 0x0e, 0x13, 0x13, 0x01, 0x0f, 0x18, 0x00,
+  0x93, 0x93, 0x77, 0x63, 0x66, 0x6b, 0x63, 0x60, 0x6f, 0x87, 0xa9, 0x14, 0x00, 0xdd, 0x01, 0x00, 0xdf, 0x01, 0x2f, 0x9a, 0x7a, 0xde, 0x01, 0x00,
+  0xf0, 0x21, 0xa5, 0xa5, 0x63, 0x61, 0x63, 0x82, 0x82, 0x69, 0x70, 0x69, 0x5c, 0x76, 0x76, 0x6a, 0x76, 0x58, 0x5a, 0x5c, 0x55, 0x58, 0x70, 0x76,
+  0x62, 0x7a, 0x8d, 0x77, 0x67, 0x82, 0x7d, 0x5c, 0x58, 0x5f, 0x5c, 0x5e, 0x6f, 0x7b, 0x77, 0x66, 0x6e, 0x62, 0x6c, 0x76, 0x6e, 0x6c, 0x5c, 0x5f,
+  0x6a, 0x5e, 0xa3, 0x0b, 0xe1, 0x6f, 0x77, 0x77, 0x6f, 0x77, 0x76, 0x62, 0x5e, 0x5e, 0x66, 0x6c, 0x6a, 0x70, 0x66, 0xb3, 0x03, 0x24, 0x5f, 0x64,
+  0xdf, 0x01, 0x45, 0x61, 0x62, 0x62, 0x67, 0xdd, 0x01, 0x04, 0x08, 0x00, 0x04, 0x01, 0x00, 0x00, 0xc9, 0x01, 0x0f, 0x02, 0x00, 0x01, 0x01, 0x1b,
+  0x00, 0x00, 0x30, 0x00, 0x05, 0x01, 0x00, 0x00, 0xd7, 0x01, 0x04, 0x01, 0x00, 0x07, 0xd3, 0x01, 0x00, 0x04, 0x00, 0x06, 0x01, 0x00, 0x01, 0xd9,
+  0x01, 0x05, 0xd4, 0x01, 0x00, 0xce, 0x01, 0x01, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x02, 0x00, 0x3f, 0x77, 0x72, 0x77, 0x99, 0x05, 0x07, 0x00,
+  0xb8, 0x03, 0x0a, 0x99, 0x05, 0x08, 0xde, 0x01, 0x00, 0xdc, 0x01, 0x09, 0xde, 0x01, 0x30, 0x8d, 0x8e, 0x8d, 0xdd, 0x01, 0x00, 0xe0, 0x01, 0x05,
+  0xe2, 0x01, 0x19, 0x95, 0xde, 0x01, 0x00, 0x04, 0x00, 0x03, 0xde, 0x01, 0x10, 0x06, 0xde, 0x01, 0x00, 0xc1, 0x03, 0x04, 0xe0, 0x01, 0x72, 0x39,
+  0x35, 0x0f, 0x79, 0x95, 0x18, 0x08, 0xc0, 0x03, 0x80, 0x35, 0x27, 0x79, 0x74, 0x7a, 0x77, 0x77, 0x73, 0x21, 0x0d, 0x00, 0xe2, 0x10, 0x02, 0xa6,
+  0x14, 0xab, 0x27, 0x13, 0x0a, 0x89, 0x6b, 0x6b, 0x63, 0x6a, 0x99, 0x27, 0xc0, 0x03, 0x00, 0xfc, 0x01, 0x90, 0x88, 0x7b, 0x85, 0x9a, 0x0c, 0x0a,
+  0x8a, 0x91, 0x8e, 0xc5, 0x03, 0xc0, 0x1a, 0x05, 0x13, 0x89, 0x63, 0x59, 0x59, 0x59, 0x76, 0x91, 0x99, 0x0e, 0xdf, 0x01, 0x02, 0xe1, 0x01, 0x4f,
+  0x08, 0x99, 0x82, 0x5c, 0xbf, 0x03, 0x01, 0x00, 0xa1, 0x05, 0xf0, 0x1b, 0x76, 0x60, 0x58, 0x5c, 0x5c, 0x63, 0x76, 0x82, 0x7b, 0x72, 0x60, 0x5a,
+  0x65, 0x5a, 0x58, 0x65, 0x65, 0x5f, 0x74, 0x8c, 0x75, 0x5a, 0x60, 0x82, 0x82, 0x66, 0x79, 0x73, 0x72, 0x80, 0x62, 0x62, 0x66, 0x80, 0x78, 0x77,
+  0x62, 0x66, 0x7b, 0x6f, 0x6f, 0x6e, 0x23, 0x03, 0x10, 0x62, 0xe4, 0x01, 0xb0, 0x77, 0x6c, 0x6a, 0x60, 0x67, 0x70, 0x6e, 0x6a, 0x6c, 0x70, 0x6d,
+  0xdd, 0x01, 0x30, 0x64, 0x62, 0x61, 0xda, 0x01, 0x60, 0x62, 0x67, 0x62, 0x67, 0x62, 0x65, 0xd8, 0x01, 0x0a, 0x02, 0x00, 0x0b, 0x01, 0x00, 0x00,
+  0xd3, 0x01, 0x01, 0xd0, 0x01, 0x03, 0x06, 0x00, 0x00, 0x01, 0x00, 0x10, 0x66, 0x03, 0x00, 0x00, 0xda, 0x01, 0x00, 0xdd, 0x01, 0x00, 0x02, 0x00,
+  0x04, 0x01, 0x00, 0x61, 0x6f, 0x6a, 0x6a, 0x6e, 0x6e, 0x6e, 0xdb, 0x01, 0x07, 0xde, 0x01, 0x06, 0xd7, 0x01, 0x02, 0x01, 0x00, 0x00, 0xd0, 0x01,
+  0x00, 0x02, 0x00, 0x01, 0x05, 0x00, 0x00, 0xb4, 0x03, 0x01, 0xb6, 0x03, 0x02, 0xdf, 0x01, 0x01, 0xdd, 0x01, 0x08, 0xdf, 0x01, 0x10, 0x80, 0xba,
+  0x03, 0x50, 0x80, 0x7f, 0x80, 0x83, 0x80, 0xd8, 0x01, 0x02, 0x01, 0x00, 0x07, 0xde, 0x01, 0x01, 0xdc, 0x01, 0x05, 0xde, 0x01, 0x00, 0x9c, 0x05,
+  0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x03, 0x7c, 0x07, 0x02, 0x01, 0x00, 0x01, 0xbd, 0x03, 0x06, 0xe1, 0x01, 0x12, 0x05, 0xbf, 0x03, 0x00, 0x74,
+  0x07, 0x00, 0x02, 0x00, 0x04, 0x01, 0x00, 0x10, 0x31, 0xe1, 0x01, 0x82, 0x31, 0x35, 0x1f, 0x03, 0x93, 0x09, 0x0f, 0x2d, 0xc0, 0x03, 0x70, 0x2d,
+  0x14, 0x89, 0x72, 0x87, 0x8c, 0x7f, 0xe0, 0x01, 0x00, 0x0f, 0x00, 0x01, 0xc0, 0x03, 0xb2, 0x27, 0x1a, 0x1f, 0x0b, 0x83, 0x6b, 0x6b, 0x85, 0x77,
+  0x0b, 0x27, 0xb1, 0x14, 0x04, 0xdc, 0x01, 0x01, 0xfb, 0x01, 0xf0, 0x08, 0x77, 0x62, 0x63, 0x6f, 0x82, 0x76, 0x63, 0x62, 0x85, 0x05, 0x13, 0x99,
+  0x0b, 0x0b, 0x13, 0x9b, 0x6b, 0x59, 0x59, 0x59, 0x5d, 0x6a, 0x93, 0x4c, 0x0b, 0x01, 0xe1, 0x01, 0x6f, 0x1a, 0x0f, 0x0f, 0x99, 0x83, 0x5d, 0xde,
+  0x01, 0x03, 0x01, 0xe0, 0x01, 0xf0, 0x2e, 0x5a, 0x59, 0x5c, 0x5c, 0x66, 0x76, 0x85, 0x82, 0x76, 0x65, 0x65, 0x5a, 0xa5, 0x58, 0xa5, 0x58, 0x66,
+  0x7c, 0x82, 0x5a, 0x5a, 0x6a, 0x8c, 0x89, 0x8a, 0x8d, 0x8e, 0x8d, 0x7a, 0x7d, 0x83, 0x85, 0x85, 0x6a, 0x72, 0x7b, 0x83, 0x83, 0x80, 0x7a, 0x80,
+  0x72, 0x6f, 0x6e, 0x62, 0x6a, 0x76, 0x6f, 0x72, 0x7b, 0x66, 0x6c, 0x6e, 0x71, 0x72, 0x66, 0x6f, 0x6e, 0x6a, 0x6e, 0x5f, 0xdb, 0x01, 0x31, 0x64,
+  0x62, 0x64, 0xdd, 0x01, 0x03, 0x02, 0x00, 0x20, 0x66, 0x67, 0xa8, 0x01, 0x01, 0x01, 0x00, 0x00, 0xb7, 0x01, 0x03, 0x02, 0x00, 0x60, 0x62, 0x62,
+  0x62, 0x63, 0x62, 0x63, 0x07, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x01, 0x00, 0x08, 0xdd, 0x01, 0x03, 0x99, 0x05,
+  0x07, 0x01, 0x00, 0x01, 0xb1, 0x03, 0x04, 0x02, 0x00, 0x01, 0xd8, 0x01, 0x01, 0xd0, 0x01, 0x02, 0x03, 0x00, 0x03, 0x05, 0x00, 0x00, 0xd7, 0x01,
+  0x01, 0xd9, 0x01, 0x01, 0x01, 0x00, 0x02, 0xda, 0x01, 0x01, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0xde, 0x01, 0x11, 0x83, 0xdd, 0x01, 0x05, 0xce,
+  0x10, 0x09, 0xdd, 0x01, 0x0d, 0x99, 0x05, 0x04, 0xbc, 0x03, 0x10, 0x8d, 0xdf, 0x01, 0x00, 0x04, 0x00, 0x00, 0xdc, 0x01, 0x03, 0xde, 0x01, 0x05,
+  0x01, 0x00, 0x00, 0x7b, 0x07, 0x00, 0x57, 0x09, 0x01, 0xc0, 0x03, 0x09, 0x01, 0x00, 0x00, 0xbe, 0x03, 0x71, 0x31, 0x39, 0x31, 0x0e, 0x93, 0x0e,
+  0x2c, 0xc1, 0x12, 0xa3, 0x31, 0x39, 0x39, 0x35, 0x94, 0x91, 0x83, 0x0d, 0x0a, 0x94, 0x42, 0x1a, 0x00, 0xe0, 0x01, 0x10, 0x27, 0x01, 0x0f, 0x82,
+  0x91, 0x92, 0x83, 0x89, 0x9a, 0x05, 0x1f, 0x27, 0x11, 0x0f, 0x01, 0xe1, 0x01, 0x00, 0x03, 0x00, 0xf2, 0x0c, 0x26, 0x26, 0x27, 0x0b, 0x7a, 0x76,
+  0x85, 0x63, 0x5d, 0x5d, 0x5d, 0x63, 0x82, 0x82, 0x8c, 0x82, 0x72, 0x8a, 0x0d, 0x8c, 0x5d, 0x59, 0x59, 0x5d, 0x66, 0x8e, 0x13, 0xde, 0x01, 0x00,
+  0xe5, 0x01, 0x3d, 0x0f, 0x0b, 0x91, 0x3a, 0x0b, 0x05, 0x01, 0x00, 0xd1, 0x59, 0x76, 0x76, 0x69, 0x5c, 0x5c, 0x5c, 0x76, 0x5c, 0x69, 0x65, 0x69,
+  0x5c, 0x6b, 0x09, 0x81, 0x55, 0x5a, 0x5f, 0x69, 0x5a, 0x58, 0x66, 0x82, 0xb6, 0x02, 0x82, 0x8d, 0x8a, 0x85, 0x85, 0x77, 0x74, 0x7f, 0x7a, 0x6e,
+  0x18, 0xf5, 0x01, 0x77, 0x6e, 0x6f, 0x6e, 0x72, 0x6e, 0x6e, 0x72, 0x6c, 0x6f, 0x76, 0x72, 0x72, 0x6e, 0x72, 0x6a, 0xdc, 0x01, 0x10, 0x66, 0x04,
+  0x00, 0x17, 0x66, 0xd9, 0x01, 0x06, 0x01, 0x00, 0x01, 0xbe, 0x01, 0x00, 0x05, 0x00, 0x00, 0xca, 0x01, 0x07, 0x01, 0x00, 0x04, 0x1b, 0x00, 0x01,
+  0x04, 0x00, 0x01, 0x01, 0x00, 0x07, 0xdb, 0x01, 0x16, 0x6b, 0xdd, 0x01, 0x00, 0xb8, 0x03, 0x04, 0xd1, 0x01, 0x05, 0x08, 0x00, 0x01, 0xdd, 0x01,
+  0x01, 0xdf, 0x01, 0x13, 0x77, 0xd6, 0x01, 0x02, 0xd8, 0x01, 0x00, 0x02, 0x00, 0x04, 0x01, 0x00, 0x02, 0xd7, 0x01, 0x01, 0x05, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x98, 0x05, 0x10, 0x7f, 0xdd, 0x01, 0x27, 0x7f, 0x83, 0xbc, 0x03, 0x0f, 0xde, 0x01, 0x09, 0x10, 0x8d, 0xdf, 0x01, 0x03, 0x01, 0x00,
+  0x00, 0xb5, 0x12, 0x03, 0x01, 0x00, 0x00, 0xde, 0x01, 0x00, 0xdf, 0x01, 0x13, 0x93, 0xdb, 0x01, 0x00, 0x35, 0x0b, 0x01, 0x01, 0x00, 0x01, 0x7b,
+  0x07, 0x08, 0x01, 0x00, 0x01, 0xd2, 0x01, 0x80, 0x39, 0x2d, 0x2d, 0x13, 0x18, 0x2d, 0x27, 0x35, 0xea, 0x01, 0xb0, 0x39, 0x2d, 0x35, 0x7f, 0x74,
+  0x79, 0x89, 0x91, 0x0b, 0x08, 0x27, 0x0e, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x83, 0x05, 0x97, 0x1a, 0x05, 0x6f, 0x77, 0x92, 0x14, 0x13, 0x99, 0x1a,
+  0xc0, 0x03, 0x03, 0x01, 0x00, 0xf0, 0x08, 0x27, 0x0b, 0x74, 0x62, 0x63, 0x5d, 0x5d, 0x63, 0x5d, 0x63, 0x63, 0x70, 0x5d, 0x5d, 0x5d, 0x7b, 0x8c,
+  0x70, 0x59, 0x59, 0x5d, 0x6f, 0x91, 0xbe, 0x03, 0x03, 0x01, 0x00, 0x3f, 0x0f, 0x0f, 0x08, 0x5c, 0x09, 0x02, 0x02, 0x01, 0x00, 0xb0, 0x55, 0x5c,
+  0x70, 0x70, 0x5a, 0x59, 0x65, 0x85, 0x5c, 0x58, 0x58, 0x47, 0x0b, 0x02, 0x02, 0x00, 0x70, 0x58, 0x5c, 0x5c, 0x5a, 0x6f, 0x87, 0x91, 0xe5, 0x00,
+  0x61, 0x87, 0x74, 0x6f, 0x72, 0x7f, 0x85, 0xde, 0x01, 0x70, 0x87, 0x83, 0x7a, 0x77, 0x82, 0x74, 0x62, 0x9e, 0x14, 0x70, 0x74, 0x6a, 0x6c, 0x6e,
+  0x74, 0x72, 0x6e, 0xa8, 0x01, 0x02, 0x98, 0x05, 0x00, 0xb5, 0x03, 0x10, 0x67, 0xe1, 0x01, 0x0f, 0xe3, 0x01, 0x01, 0x01, 0xc9, 0x01, 0x04, 0xe6,
+  0x01, 0x07, 0x02, 0x00, 0x08, 0x01, 0x00, 0x06, 0xdd, 0x01, 0x03, 0xdf, 0x01, 0x00, 0xd8, 0x01, 0x02, 0x01, 0x00, 0x03, 0xd4, 0x01, 0x01, 0x21,
+  0x0b, 0x02, 0x01, 0x00, 0x00, 0xdc, 0x01, 0x00, 0xd7, 0x01, 0x03, 0xd4, 0x01, 0x0a, 0x01, 0x00, 0x30, 0x7a, 0x77, 0x79, 0xcf, 0x01, 0x07, 0xda,
+  0x01, 0x02, 0x53, 0x09, 0x00, 0x77, 0x07, 0x01, 0xbe, 0x03, 0x04, 0xdf, 0x01, 0x01, 0xdb, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x00, 0xd7,
+  0x01, 0x03, 0x01, 0x00, 0x01, 0xdc, 0x01, 0x01, 0xe3, 0x02, 0x00, 0x01, 0x00, 0x00, 0xde, 0x01, 0x41, 0x8e, 0x8e, 0x93, 0x94, 0x79, 0x07, 0x00,
+  0xe1, 0x01, 0x00, 0x03, 0x00, 0x01, 0x01, 0x00, 0x00, 0xd8, 0x01, 0x00, 0x15, 0x0d, 0x07, 0x96, 0x05, 0xa0, 0x08, 0x08, 0x08, 0x09, 0x08, 0x0b,
+  0x08, 0x0b, 0x08, 0x0b, 0xf0, 0x0d, 0x39, 0x39, 0x39, 0x31, 0x39, 0x39, 0x39, 0x2d, 0x8e, 0x0e, 0x25, 0x2d, 0x39, 0x2d, 0x39, 0x31, 0x39, 0x31,
+  0x39, 0x2d, 0x02, 0x72, 0x74, 0x8a, 0x97, 0x08, 0x03, 0x27, 0x0d, 0x00, 0xf0, 0x04, 0x31, 0x39, 0x31, 0x31, 0x31, 0x26, 0x27, 0x26, 0x1f, 0x06,
+  0x6a, 0x6f, 0x72, 0x91, 0x91, 0x1f, 0x27, 0x31, 0x26, 0x02, 0x00, 0x04, 0x01, 0x00, 0xf3, 0x01, 0x1a, 0x31, 0x26, 0x26, 0x27, 0x0e, 0x6f, 0x63,
+  0x63, 0x60, 0x6b, 0x63, 0x60, 0x5d, 0x63, 0x5d, 0x01, 0x00, 0x66, 0x66, 0x89, 0x05, 0x1a, 0x1f, 0x1a, 0x01, 0x00, 0x6f, 0x13, 0x91, 0x63, 0x59,
+  0x59, 0xa5, 0x01, 0x00, 0x06, 0xa6, 0x5c, 0x70, 0x69, 0x5a, 0x65, 0x70, 0x67, 0x59, 0x55, 0xa5, 0x02, 0x00, 0xf0, 0x2f, 0x58, 0x69, 0x6c, 0x62,
+  0x85, 0x89, 0x72, 0x74, 0x80, 0x8a, 0x8a, 0x74, 0x66, 0x6f, 0x83, 0x7a, 0x7a, 0x83, 0x8a, 0x87, 0x8a, 0x87, 0x7a, 0x74, 0x83, 0x83, 0x7a, 0x6c,
+  0x66, 0x66, 0x72, 0x7b, 0x77, 0x6e, 0x6f, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x62, 0x67, 0x61, 0x67, 0x65, 0x66, 0x65, 0x66, 0x67, 0x66, 0x66, 0x67,
+  0x66, 0x67, 0x6a, 0x67, 0x66, 0x66, 0x6a, 0x66, 0x6a, 0x6a, 0x05, 0x00, 0x21, 0x66, 0x6a, 0x0c, 0x00, 0x1b, 0x66, 0x01, 0x00, 0x10, 0x62, 0x05,
+  0x00, 0x05, 0x07, 0x00, 0x10, 0x66, 0x24, 0x00, 0x00, 0x04, 0x00, 0x14, 0x6a, 0x01, 0x00, 0xa3, 0x6b, 0x6e, 0x6a, 0x6e, 0x6f, 0x6a, 0x6e, 0x6f,
+  0x6e, 0x6f, 0x01, 0x00, 0x3d, 0x72, 0x6f, 0x72, 0x01, 0x00, 0x41, 0x74, 0x72, 0x74, 0x74, 0x04, 0x00, 0x53, 0x74, 0x77, 0x74, 0x74, 0x77, 0x01,
+  0x00, 0x12, 0x7a, 0x02, 0x00, 0x11, 0x7a, 0x06, 0x00, 0x10, 0x77, 0x07, 0x00, 0x04, 0x01, 0x00, 0xf1, 0x03, 0x80, 0x7a, 0x7f, 0x7a, 0x83, 0x7a,
+  0x7f, 0x7f, 0x7a, 0x7f, 0x80, 0x7f, 0x7f, 0x83, 0x7f, 0x83, 0x80, 0x83, 0x01, 0x00, 0x14, 0x87, 0x02, 0x00, 0x02, 0x01, 0x00, 0x35, 0x8a, 0x87,
+  0x8a, 0x01, 0x00, 0x30, 0x8d, 0x8a, 0x8e, 0x02, 0x00, 0x01, 0x01, 0x00, 0x70, 0x91, 0x8e, 0x8e, 0x8e, 0x93, 0x8e, 0x93, 0x03, 0x00, 0x00, 0x01,
+  0x00, 0x63, 0x99, 0x93, 0x93, 0x95, 0x93, 0x99, 0x01, 0x00, 0x10, 0x05, 0x02, 0x00, 0x06, 0x01, 0x00, 0x11, 0x08, 0x01, 0x00, 0x42, 0x09, 0x08,
+  0x08, 0x0b, 0x02, 0x00, 0x22, 0x0b, 0x39, 0x01, 0x00, 0x71, 0x35, 0x03, 0x05, 0x25, 0x1f, 0x2d, 0x2d, 0x0b, 0x00, 0xb1, 0x2d, 0x94, 0x72, 0x87,
+  0x80, 0x8a, 0x18, 0x13, 0x25, 0x2d, 0x31, 0xde, 0x01, 0x00, 0xdf, 0x01, 0x99, 0x27, 0x1f, 0x0e, 0x7a, 0x77, 0x6b, 0x72, 0x7f, 0x0b, 0xe0, 0x01,
+  0x40, 0x31, 0x26, 0x1a, 0x26, 0xfc, 0x01, 0xf0, 0x07, 0x0a, 0x6f, 0x62, 0x6b, 0x98, 0x92, 0x82, 0x7b, 0x63, 0x5d, 0x5d, 0x59, 0x5d, 0x59, 0x5d,
+  0x5d, 0x6a, 0x8a, 0x0e, 0x1f, 0x1a, 0x26, 0xd9, 0x01, 0x02, 0x01, 0x00, 0x30, 0x0f, 0x0a, 0x6f, 0xdf, 0x01, 0x03, 0xe2, 0x01, 0x03, 0x07, 0x00,
+  0x05, 0x01, 0x00, 0xa1, 0x59, 0x65, 0x5d, 0x60, 0x59, 0x5c, 0x76, 0x7b, 0x70, 0x5a, 0xd9, 0x01, 0x03, 0x02, 0x00, 0xf2, 0x01, 0x58, 0x5c, 0x7b,
+  0x76, 0x76, 0x85, 0x5f, 0x5c, 0x6f, 0x8a, 0x8a, 0x85, 0x85, 0x83, 0x85, 0x7f, 0xfc, 0x00, 0xf0, 0x06, 0x87, 0x7f, 0x83, 0x87, 0x80, 0x7b, 0x74,
+  0x74, 0x7b, 0x77, 0x80, 0x77, 0x6c, 0x62, 0x6e, 0x77, 0x7b, 0x76, 0x6e, 0x66, 0x62, 0xd9, 0x01, 0x00, 0x02, 0x00, 0x10, 0x6a, 0x02, 0x00, 0x11,
+  0x66, 0x04, 0x00, 0x00, 0xd8, 0x01, 0x0a, 0x02, 0x00, 0x0f, 0x01, 0x00, 0x03, 0x08, 0x2b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x35, 0x02, 0x10, 0x6f,
+  0x02, 0x00, 0x00, 0x03, 0x00, 0x09, 0xdc, 0x01, 0x31, 0x74, 0x72, 0x74, 0x06, 0x00, 0x00, 0x04, 0x00, 0x02, 0xda, 0x01, 0x00, 0x01, 0x00, 0x00,
+  0xd7, 0x01, 0x06, 0xda, 0x01, 0x20, 0x77, 0x7a, 0x0c, 0x00, 0x0e, 0x01, 0x00, 0x00, 0xdf, 0x01, 0x93, 0x7f, 0x80, 0x7f, 0x7a, 0x80, 0x7f, 0x80,
+  0x7f, 0x80, 0xdd, 0x01, 0x01, 0xd8, 0x01, 0x20, 0x83, 0x87, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0xbd, 0x02, 0x00, 0xe0, 0x00, 0x00, 0xe5, 0x00,
+  0x70, 0x8a, 0x8d, 0x8a, 0x8d, 0x8e, 0x8e, 0x8e, 0x04, 0x00, 0x24, 0x8e, 0x91, 0xde, 0x01, 0x00, 0x02, 0x00, 0x30, 0x93, 0x93, 0x94, 0xdb, 0x01,
+  0x05, 0xdd, 0x01, 0x03, 0xdf, 0x01, 0x80, 0x99, 0x05, 0x99, 0x08, 0x05, 0x08, 0x05, 0x08, 0x03, 0x00, 0x02, 0xde, 0x01, 0x20, 0x08, 0x09, 0xdd,
+  0x01, 0x23, 0x08, 0x0b, 0xe0, 0x01, 0x83, 0x3b, 0x39, 0x39, 0x08, 0x25, 0x1f, 0x7e, 0x18, 0xe1, 0x01, 0x90, 0x99, 0x79, 0x79, 0x7f, 0x79, 0x9a,
+  0x0c, 0x1f, 0x27, 0xbe, 0x03, 0x01, 0xe2, 0x01, 0x00, 0xe1, 0x01, 0x70, 0x18, 0x0c, 0x87, 0x87, 0x09, 0x0f, 0x27, 0x0f, 0x00, 0x05, 0xe1, 0x01,
+  0xf0, 0x01, 0x26, 0x27, 0x26, 0x31, 0x26, 0x1f, 0x0f, 0x0a, 0x9a, 0x6a, 0x7b, 0x9d, 0x98, 0x8c, 0x82, 0x82, 0xbc, 0x03, 0x70, 0x5d, 0x63, 0x77,
+  0x05, 0x18, 0x1a, 0x27, 0xd8, 0x01, 0x04, 0x01, 0x00, 0x41, 0x0e, 0x7a, 0x5d, 0x59, 0xd7, 0x01, 0x02, 0x06, 0x00, 0x0b, 0x01, 0x00, 0xb0, 0x5d,
+  0x84, 0x76, 0x59, 0x58, 0x5d, 0x84, 0x85, 0x66, 0x55, 0xa5, 0xd9, 0x01, 0x02, 0x05, 0x00, 0xf0, 0x00, 0x55, 0xa5, 0x58, 0x5c, 0x5c, 0x5c, 0x76,
+  0x82, 0x60, 0x77, 0x83, 0x7a, 0x7a, 0x72, 0x85, 0xf6, 0x00, 0x00, 0x03, 0x01, 0x00, 0x1a, 0x01, 0xf0, 0x00, 0x83, 0x77, 0x6a, 0x72, 0x77, 0x77,
+  0x7a, 0x6f, 0x77, 0x6e, 0x72, 0x76, 0x72, 0x74, 0x73, 0xda, 0x01, 0x03, 0xdc, 0x01, 0x10, 0x67, 0xa3, 0x01, 0x0b, 0x01, 0x00, 0x00, 0xba, 0x01,
+  0x09, 0x02, 0x00, 0x00, 0x03, 0x00, 0x02, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x03, 0xd8, 0x01, 0x00, 0x01, 0x00, 0x30, 0x6e, 0x6a, 0x6f, 0x02, 0x00,
+  0x07, 0x01, 0x00, 0x00, 0xd8, 0x01, 0x04, 0xd1, 0x01, 0x05, 0xd3, 0x01, 0x00, 0xd6, 0x01, 0x01, 0x02, 0x00, 0x02, 0xde, 0x01, 0x00, 0xd5, 0x01,
+  0x00, 0x02, 0x00, 0x00, 0xd8, 0x01, 0x10, 0x7b, 0xcd, 0x01, 0x03, 0x01, 0x00, 0x02, 0x0c, 0x00, 0x10, 0x80, 0x03, 0x00, 0x00, 0x02, 0x00, 0x11,
+  0x83, 0xdd, 0x01, 0x03, 0xdc, 0x01, 0x07, 0xdf, 0x01, 0x01, 0x01, 0x00, 0x00, 0xda, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x01, 0x00, 0x10, 0x8d, 0xbb,
+  0x03, 0x11, 0x8d, 0xdd, 0x01, 0x02, 0xdc, 0x01, 0x51, 0x8e, 0x93, 0x91, 0x93, 0x91, 0xdd, 0x01, 0x20, 0x93, 0x94, 0x05, 0x00, 0x00, 0xd7, 0x01,
+  0x02, 0x01, 0x00, 0x00, 0xd9, 0x01, 0x00, 0xb5, 0x03, 0x00, 0x05, 0x00, 0x10, 0x08, 0xde, 0x01, 0x10, 0x05, 0xd9, 0x01, 0x01, 0xdb, 0x01, 0x02,
+  0x01, 0x00, 0x06, 0xc0, 0x03, 0x70, 0x3b, 0x2d, 0x2c, 0x95, 0x79, 0x08, 0x35, 0x0b, 0x00, 0xb0, 0x39, 0x35, 0x2c, 0x1e, 0x9b, 0x87, 0x89, 0x91,
+  0x83, 0x8e, 0x2c, 0xcc, 0x01, 0x00, 0x01, 0x00, 0xc1, 0x26, 0x31, 0x26, 0x27, 0x1f, 0x99, 0x9a, 0x7f, 0x95, 0x18, 0x1a, 0x2d, 0x0e, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0xdb, 0x01, 0x10, 0x27, 0x02, 0x00, 0xc0, 0x27, 0x1f, 0x1e, 0x17, 0x7b, 0x66, 0x6b, 0x6f, 0x80, 0x89, 0x7b, 0x60, 0x9c, 0x05,
+  0x28, 0x83, 0x13, 0x9b, 0x05, 0x00, 0xbf, 0x03, 0x40, 0x0e, 0x6b, 0x59, 0x59, 0xdb, 0x01, 0x0f, 0xdd, 0x01, 0x00, 0x00, 0x01, 0x00, 0xc0, 0x5c,
+  0x63, 0xa5, 0xa5, 0x5c, 0x7b, 0x70, 0x60, 0x59, 0x58, 0x59, 0x58, 0xde, 0x01, 0x01, 0xdf, 0x01, 0xe0, 0x55, 0xa5, 0x58, 0xa5, 0x58, 0x5a, 0x7b,
+  0x82, 0x82, 0x87, 0x87, 0x82, 0x77, 0x77, 0x05, 0x01, 0x00, 0xe2, 0x01, 0xf0, 0x05, 0x87, 0x87, 0x87, 0x83, 0x83, 0x82, 0x77, 0x77, 0x6f, 0x7a,
+  0x77, 0x77, 0x74, 0x6e, 0x6a, 0x66, 0x66, 0x72, 0x72, 0x76, 0x93, 0x05, 0x02, 0xdc, 0x01, 0x10, 0x6c, 0xa7, 0x01, 0x0f, 0x01, 0x00, 0x05, 0x00,
+  0xcb, 0x01, 0x08, 0x02, 0x00, 0x00, 0x12, 0x00, 0x03, 0x01, 0x00, 0x71, 0x6b, 0x6a, 0x6a, 0x6e, 0x6b, 0x6e, 0x6b, 0xbb, 0x03, 0x00, 0x01, 0x00,
+  0x10, 0x72, 0x02, 0x00, 0x04, 0x01, 0x00, 0x03, 0xda, 0x01, 0x10, 0x77, 0xd3, 0x01, 0x13, 0x77, 0x07, 0x00, 0x04, 0x01, 0x00, 0x00, 0xd9, 0x01,
+  0x07, 0x87, 0x05, 0x0b, 0x01, 0x00, 0x00, 0xd8, 0x01, 0x30, 0x80, 0x7a, 0x80, 0xd9, 0x01, 0x01, 0x02, 0x00, 0x04, 0xde, 0x01, 0x00, 0xd8, 0x01,
+  0x01, 0x05, 0x00, 0x02, 0x01, 0x00, 0xa1, 0x8a, 0x87, 0x8a, 0x89, 0x8a, 0x8a, 0x8a, 0x89, 0x8a, 0x89, 0xdd, 0x01, 0x10, 0x91, 0x02, 0x00, 0x01,
+  0xde, 0x01, 0x00, 0x05, 0x00, 0x00, 0xdd, 0x01, 0x01, 0xdc, 0x01, 0x00, 0xde, 0x01, 0x55, 0x99, 0x93, 0x95, 0x99, 0x99, 0xbf, 0x03, 0x01, 0xd8,
+  0x01, 0x05, 0x01, 0x00, 0x00, 0xba, 0x03, 0x00, 0x01, 0x00, 0x01, 0xdf, 0x01, 0xd0, 0x08, 0x0e, 0x08, 0x0b, 0x09, 0x0b, 0x08, 0x0e, 0x0b, 0x0b,
+  0x3b, 0x3b, 0x39, 0x02, 0x00, 0x71, 0x39, 0x35, 0x1e, 0x8d, 0x79, 0x09, 0x35, 0xc0, 0x03, 0xb3, 0x3b, 0x1f, 0x0a, 0x14, 0x81, 0x7f, 0x7e, 0x83,
+  0x88, 0x1f, 0x2d, 0xbe, 0x03, 0x10, 0x2d, 0xc5, 0x01, 0x60, 0x05, 0x9b, 0x8d, 0x13, 0x1f, 0x2d, 0x10, 0x00, 0x10, 0x26, 0xd0, 0x03, 0x00, 0xa7,
+  0x05, 0x00, 0xeb, 0x01, 0xfa, 0x05, 0x2d, 0x26, 0x13, 0x91, 0x91, 0x9b, 0x6a, 0x63, 0x62, 0x7a, 0x9a, 0x0e, 0x14, 0x92, 0x66, 0x62, 0x6f, 0x99,
+  0x18, 0x1f, 0x7c, 0x07, 0x40, 0x0f, 0x13, 0x0a, 0x66, 0xdc, 0x01, 0x02, 0x02, 0x00, 0x0e, 0x01, 0x00, 0x01, 0x14, 0x00, 0x81, 0x5d, 0x76, 0x69,
+  0x65, 0x58, 0x63, 0x6d, 0x59, 0xde, 0x01, 0x20, 0xa5, 0xa5, 0xdd, 0x01, 0xf4, 0x01, 0xa5, 0x58, 0xa5, 0x5a, 0x5c, 0x7b, 0x89, 0x91, 0x8a, 0x8a,
+  0x6a, 0x66, 0x72, 0x7f, 0x83, 0x87, 0xdf, 0x01, 0xf4, 0x01, 0x83, 0x83, 0x77, 0x7a, 0x7b, 0x72, 0x7b, 0x7b, 0x74, 0x6e, 0x74, 0x6c, 0x6a, 0x6a,
+  0x70, 0x6c, 0xdd, 0x01, 0x20, 0x66, 0x6c, 0xe2, 0x01, 0x10, 0x6c, 0x89, 0x03, 0x10, 0x6e, 0xb6, 0x01, 0x0f, 0x01, 0x00, 0x03, 0x02, 0xdb, 0x01,
+  0x08, 0x01, 0x00, 0x00, 0x70, 0x07, 0x00, 0xdd, 0x01, 0x02, 0xdc, 0x01, 0x05, 0xb6, 0x03, 0x00, 0xd9, 0x01, 0x02, 0xdb, 0x01, 0x01, 0xb1, 0x03,
+  0x09, 0x01, 0x00, 0x01, 0xd6, 0x01, 0x02, 0x02, 0x00, 0x06, 0x01, 0x00, 0x13, 0x80, 0x05, 0x00, 0x01, 0xd5, 0x01, 0x04, 0x02, 0x00, 0x00, 0xd8,
+  0x01, 0x00, 0xe2, 0x01, 0x04, 0xdc, 0x01, 0x01, 0xde, 0x01, 0x00, 0x02, 0x00, 0x02, 0x01, 0x00, 0x00, 0xba, 0x03, 0x00, 0xdd, 0x01, 0x01, 0xe2,
+  0x01, 0x00, 0xbd, 0x03, 0x10, 0x91, 0xbd, 0x03, 0x00, 0xb9, 0x03, 0x13, 0x91, 0xdd, 0x01, 0x20, 0x93, 0x91, 0xda, 0x01, 0x00, 0x02, 0x00, 0x07,
+  0x9b, 0x05, 0x10, 0x05, 0x03, 0x00, 0x01, 0x02, 0x00, 0x00, 0xda, 0x01, 0x00, 0x03, 0x00, 0x00, 0xbf, 0x03, 0x03, 0x76, 0x07, 0x10, 0x09, 0xb8,
+  0x03, 0x04, 0x01, 0x00, 0x01, 0xdd, 0x01, 0x81, 0x39, 0x39, 0x3b, 0x27, 0x01, 0x00, 0x95, 0x2c, 0xdf, 0x01, 0xf1, 0x01, 0x39, 0x35, 0x2c, 0x09,
+  0x0c, 0x83, 0x0c, 0x15, 0x87, 0x91, 0x1f, 0x2d, 0x2d, 0x31, 0x31, 0x2d, 0x9e, 0x05, 0x91, 0x27, 0x27, 0x18, 0x7f, 0x74, 0x05, 0x14, 0x27, 0x2d,
+  0xf1, 0x01, 0x00, 0xd8, 0x01, 0x11, 0x26, 0x18, 0x00, 0xf3, 0x05, 0x31, 0x26, 0x27, 0x27, 0x08, 0x7f, 0x72, 0x85, 0x63, 0x63, 0x63, 0x6f, 0x0c,
+  0x1f, 0x1e, 0x18, 0x74, 0x7f, 0x0a, 0x1f, 0x9b, 0x05, 0x02, 0x80, 0x07, 0x71, 0x13, 0x0b, 0x99, 0x91, 0x99, 0x98, 0x5d, 0xc0, 0x03, 0x01, 0x05,
+  0x00, 0x00, 0xbd, 0x01, 0x0f, 0x01, 0x00, 0x02, 0x60, 0x5a, 0x59, 0x5c, 0x69, 0x84, 0x66, 0x0a, 0x00, 0x02, 0xbc, 0x03, 0x00, 0x02, 0x00, 0xe0,
+  0x58, 0x5c, 0x6c, 0x7f, 0x8e, 0x91, 0x8a, 0x87, 0x7a, 0x7b, 0x7f, 0x87, 0x8a, 0x8e, 0x02, 0x01, 0x80, 0x87, 0x8a, 0x83, 0x87, 0x87, 0x7a, 0x72,
+  0x7b, 0x63, 0x03, 0x30, 0x6e, 0x76, 0x76, 0xae, 0x01, 0x00, 0xdd, 0x01, 0x00, 0x04, 0x00, 0x40, 0x6e, 0x6a, 0x6e, 0x6c, 0xdb, 0x01, 0x40, 0x6e,
+  0x6a, 0x6e, 0x6e, 0x04, 0x00, 0x00, 0x94, 0x03, 0x0f, 0xea, 0x01, 0x09, 0x02, 0x33, 0x00, 0x11, 0x6a, 0xb6, 0x03, 0x05, 0xdc, 0x01, 0x00, 0xde,
+  0x01, 0x00, 0x04, 0x00, 0x00, 0xdf, 0x01, 0x00, 0x83, 0x05, 0x09, 0xd9, 0x01, 0x80, 0x7b, 0x77, 0x77, 0x7a, 0x7b, 0x77, 0x7a, 0x77, 0x04, 0x00,
+  0x04, 0x83, 0x05, 0x01, 0x05, 0x00, 0x01, 0xcb, 0x01, 0x06, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0xd7, 0x01, 0x00, 0x06, 0x00, 0x10, 0x7f, 0xd9,
+  0x01, 0x01, 0xdf, 0x01, 0x00, 0x09, 0x00, 0x60, 0x85, 0x87, 0x83, 0x83, 0x87, 0x85, 0xda, 0x01, 0x00, 0x01, 0x00, 0x12, 0x89, 0xbb, 0x03, 0x01,
+  0x05, 0x00, 0x82, 0x8a, 0x8d, 0x8d, 0x8d, 0x91, 0x8a, 0x8e, 0x8a, 0xda, 0x01, 0x01, 0x96, 0x05, 0x21, 0x8e, 0x94, 0xdf, 0x01, 0x12, 0x91, 0xd9,
+  0x01, 0x00, 0xbe, 0x03, 0x03, 0xdf, 0x01, 0x00, 0x01, 0x00, 0x06, 0xde, 0x01, 0x01, 0xda, 0x01, 0x02, 0x01, 0x00, 0x11, 0x09, 0xbe, 0x03, 0x03,
+  0x01, 0x00, 0x10, 0x0e, 0x03, 0x00, 0x01, 0xbe, 0x03, 0x80, 0x3b, 0x39, 0x35, 0x35, 0x04, 0x00, 0x88, 0x25, 0xa0, 0x05, 0xf0, 0x05, 0x2d, 0x39,
+  0x35, 0x13, 0x8d, 0x8f, 0x83, 0x72, 0x89, 0x8c, 0x87, 0x0a, 0x27, 0x35, 0x31, 0x39, 0x27, 0x31, 0x31, 0x27, 0x01, 0x00, 0x62, 0x18, 0x7a, 0x7a,
+  0x92, 0x87, 0x25, 0xd1, 0x03, 0x00, 0x9a, 0x05, 0x03, 0x08, 0x00, 0xf3, 0x06, 0x31, 0x31, 0x2d, 0x0b, 0x77, 0x66, 0x63, 0x62, 0x63, 0x76, 0x92,
+  0x8a, 0x18, 0x1a, 0x0e, 0x08, 0x1f, 0x1f, 0x27, 0x27, 0x26, 0xe2, 0x01, 0xa0, 0x1a, 0x13, 0x0f, 0x0e, 0x9a, 0x7a, 0x63, 0x60, 0x6b, 0x82, 0xd9,
+  0x01, 0x04, 0x04, 0x00, 0x0f, 0xe3, 0x01, 0x03, 0x80, 0x59, 0xa5, 0x59, 0x5a, 0x59, 0x69, 0x70, 0x69, 0x0c, 0x00, 0x00, 0x01, 0x00, 0x10, 0x5a,
+  0xdf, 0x01, 0xb1, 0x5a, 0x5c, 0x7b, 0x77, 0x72, 0x83, 0x8e, 0x8e, 0x8a, 0x7f, 0x7a, 0xde, 0x01, 0x10, 0x8e, 0xa7, 0x06, 0x50, 0x87, 0x87, 0x83,
+  0x85, 0x6a, 0x47, 0x07, 0xa1, 0x6f, 0x6f, 0x7b, 0x78, 0x6a, 0x73, 0x6f, 0x67, 0x6a, 0x68, 0xb7, 0x03, 0x21, 0x6e, 0x72, 0xad, 0x01, 0x01, 0xdc,
+  0x01, 0x00, 0xdb, 0x01, 0x08, 0x02, 0x00, 0x00, 0x12, 0x00, 0x0b, 0xeb, 0x01, 0x10, 0x6e, 0x03, 0x00, 0x02, 0x31, 0x00, 0x00, 0xc0, 0x03, 0x01,
+  0xe2, 0x01, 0x00, 0xd7, 0x01, 0x01, 0x05, 0x00, 0x00, 0xdf, 0x01, 0x05, 0x62, 0x07, 0x00, 0x01, 0x00, 0x31, 0x7a, 0x77, 0x7b, 0xae, 0x03, 0x01,
+  0x02, 0x00, 0x01, 0xd3, 0x01, 0x00, 0x01, 0x00, 0x11, 0x7b, 0xde, 0x01, 0x01, 0xd3, 0x01, 0x06, 0x02, 0x00, 0x00, 0x01, 0x00, 0x01, 0xdd, 0x01,
+  0x01, 0x05, 0x00, 0x00, 0xda, 0x01, 0x00, 0xd9, 0x01, 0x01, 0xb9, 0x03, 0x00, 0x01, 0x00, 0x00, 0x9b, 0x05, 0x05, 0x01, 0x00, 0x01, 0xd9, 0x01,
+  0x20, 0x8a, 0x8d, 0x03, 0x00, 0x10, 0x8d, 0x32, 0x0b, 0x16, 0x8d, 0xbc, 0x03, 0x05, 0xbe, 0x03, 0x00, 0xbb, 0x03, 0x10, 0x95, 0xdb, 0x01, 0x14,
+  0x95, 0xbe, 0x03, 0x00, 0xda, 0x01, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x03, 0xbd, 0x03, 0x01, 0x01, 0x00, 0x50, 0x09, 0x08, 0x09, 0x09, 0x0b,
+  0x02, 0x00, 0x01, 0x01, 0x00, 0x11, 0x0e, 0xe1, 0x01, 0x21, 0x35, 0x3b, 0x5f, 0x09, 0x60, 0x39, 0x35, 0x35, 0x0a, 0x95, 0x13, 0xe0, 0x01, 0x70,
+  0x39, 0x35, 0x35, 0x18, 0x7e, 0x9a, 0x85, 0xe1, 0x00, 0x20, 0x88, 0x25, 0xaf, 0x03, 0x10, 0x27, 0x02, 0x00, 0x91, 0x27, 0x1f, 0x05, 0x6f, 0x6f,
+  0x6f, 0x83, 0x27, 0x35, 0xe0, 0x01, 0x12, 0x31, 0x9e, 0x05, 0x00, 0x5a, 0x0b, 0xf0, 0x00, 0x31, 0x27, 0x2d, 0x05, 0x7a, 0x6b, 0x62, 0x63, 0x62,
+  0x6f, 0x80, 0x00, 0x1f, 0x1a, 0x1f, 0x90, 0x07, 0x14, 0x26, 0x9e, 0x05, 0xa2, 0x13, 0x0f, 0x0a, 0x89, 0x66, 0x5d, 0x59, 0x59, 0x70, 0x69, 0xbb,
+  0x03, 0x50, 0x59, 0x59, 0x70, 0x82, 0x63, 0xca, 0x01, 0x00, 0xc1, 0x01, 0x0c, 0x01, 0x00, 0x00, 0x46, 0x0b, 0x20, 0xa5, 0x5c, 0x0a, 0x00, 0x00,
+  0xcb, 0x03, 0xf1, 0x06, 0x5a, 0x69, 0x69, 0x61, 0x5a, 0x5a, 0x5c, 0x60, 0x76, 0x8c, 0x83, 0x83, 0x8a, 0x93, 0x91, 0x8a, 0x8a, 0x91, 0x87, 0x8a,
+  0x83, 0xe2, 0x01, 0x60, 0x8e, 0x8a, 0x87, 0x83, 0x80, 0x6e, 0xde, 0x0c, 0x62, 0x6f, 0x76, 0x77, 0x72, 0x6e, 0x77, 0xb6, 0x01, 0x50, 0x6c, 0x6a,
+  0x6e, 0x6f, 0x72, 0xac, 0x01, 0x02, 0x01, 0x00, 0x10, 0x6f, 0x05, 0x00, 0x00, 0xb9, 0x01, 0x01, 0x05, 0x00, 0x06, 0xee, 0x01, 0x01, 0x0c, 0x00,
+  0x01, 0xdd, 0x01, 0x01, 0x02, 0x00, 0x01, 0x01, 0x00, 0x00, 0xda, 0x01, 0x01, 0xdd, 0x01, 0x00, 0x02, 0x00, 0x01, 0x01, 0x00, 0x00, 0xb7, 0x03,
+  0x00, 0xdf, 0x01, 0x00, 0xd9, 0x01, 0x30, 0x78, 0x77, 0x7b, 0x02, 0x00, 0x01, 0xf5, 0x0c, 0x00, 0xcf, 0x01, 0x00, 0x02, 0x00, 0x02, 0x03, 0x00,
+  0x61, 0x7b, 0x7a, 0x7b, 0x7f, 0x7b, 0x7f, 0xd3, 0x01, 0x00, 0x02, 0x00, 0x0b, 0x01, 0x00, 0x01, 0xd7, 0x01, 0x04, 0x02, 0x00, 0x10, 0x85, 0x02,
+  0x00, 0x36, 0x87, 0x83, 0x85, 0xba, 0x03, 0x00, 0xbd, 0x03, 0x10, 0x87, 0x72, 0x07, 0x02, 0x77, 0x07, 0x00, 0xdf, 0x01, 0x20, 0x8e, 0x8d, 0xd9,
+  0x01, 0x04, 0x02, 0x00, 0x01, 0xdb, 0x01, 0x02, 0xdd, 0x01, 0x00, 0xdf, 0x01, 0x50, 0x99, 0x95, 0x99, 0x95, 0x99, 0x03, 0x00, 0x10, 0x05, 0xe0,
+  0x01, 0x04, 0xdd, 0x01, 0x01, 0xdc, 0x01, 0x00, 0x02, 0x00, 0x44, 0x08, 0x08, 0x09, 0x05, 0xbb, 0x03, 0x07, 0xdf, 0x01, 0x40, 0x0e, 0x0e, 0x0e,
+  0x35, 0xde, 0x01, 0x00, 0x80, 0x07, 0x50, 0x1f, 0x1e, 0x03, 0x0b, 0x2d, 0xea, 0x01, 0x60, 0x39, 0x35, 0x18, 0x79, 0x80, 0x83, 0xe8, 0x00, 0x80,
+  0x77, 0x1f, 0x2c, 0x39, 0x2d, 0x2d, 0x27, 0x2d, 0xbf, 0x03, 0x70, 0x27, 0x0b, 0x6f, 0x6b, 0x6f, 0x7f, 0x2c, 0x2e, 0x0f, 0x00, 0xe0, 0x01, 0x10,
+  0x31, 0xc0, 0x03, 0x10, 0x2d, 0x86, 0x07, 0xb0, 0x2d, 0x27, 0x88, 0x07, 0x6a, 0x66, 0x66, 0x6b, 0x74, 0x79, 0x1f, 0x27, 0x00, 0x16, 0x27, 0xdf,
+  0x01, 0x50, 0x1a, 0x13, 0x0a, 0x77, 0x60, 0x32, 0x0d, 0x20, 0x70, 0x63, 0xe0, 0x01, 0x70, 0x59, 0x59, 0x59, 0x5d, 0x8c, 0x90, 0x7b, 0xdf, 0x01,
+  0x0f, 0xe1, 0x01, 0x00, 0x54, 0x59, 0x63, 0x84, 0x69, 0x5a, 0x18, 0x00, 0xf0, 0x08, 0x5d, 0x5c, 0x5a, 0x70, 0x84, 0x70, 0x60, 0x67, 0x76, 0x5a,
+  0x70, 0x85, 0x6f, 0x83, 0x8a, 0x91, 0x8e, 0x89, 0x7f, 0x7a, 0x87, 0x7a, 0x7a, 0x83, 0x07, 0xb1, 0x8e, 0x8a, 0x8a, 0x83, 0x7a, 0x80, 0x6e, 0x66,
+  0x66, 0x66, 0x76, 0xec, 0x0a, 0x63, 0x77, 0x72, 0x72, 0x6e, 0x6a, 0x6d, 0xab, 0x01, 0x03, 0x01, 0x00, 0x03, 0x8e, 0x03, 0x60, 0x6f, 0x6f, 0x6f,
+  0x6a, 0x6f, 0x6b, 0x0c, 0x00, 0x02, 0xe5, 0x01, 0x01, 0x05, 0x00, 0x00, 0xe4, 0x01, 0x00, 0x04, 0x00, 0x02, 0x97, 0x05, 0x00, 0xda, 0x01, 0x00,
+  0x06, 0x00, 0x02, 0xdf, 0x01, 0x00, 0x01, 0x00, 0x04, 0x75, 0x07, 0x00, 0xdc, 0x01, 0x01, 0x88, 0x05, 0x01, 0xc9, 0x01, 0x01, 0xac, 0x03, 0x04,
+  0x01, 0x00, 0x00, 0x0a, 0x00, 0x01, 0xd3, 0x01, 0x02, 0x02, 0x00, 0x0f, 0x01, 0x00, 0x01, 0x01, 0xd6, 0x01, 0x02, 0x02, 0x00, 0x00, 0xdc, 0x01,
+  0x00, 0xb7, 0x03, 0x26, 0x83, 0x85, 0xba, 0x03, 0x12, 0x89, 0x79, 0x07, 0x00, 0xdf, 0x01, 0x01, 0xbf, 0x03, 0x00, 0x77, 0x07, 0x00, 0xd5, 0x01,
+  0x03, 0x02, 0x00, 0x03, 0xda, 0x01, 0x00, 0x04, 0x00, 0x05, 0xdc, 0x01, 0x00, 0x59, 0x09, 0x02, 0x01, 0x00, 0x05, 0xbb, 0x03, 0x00, 0x01, 0x00,
+  0x02, 0x77, 0x07, 0x20, 0x09, 0x05, 0x99, 0x05, 0x00, 0x04, 0x00, 0x03, 0x01, 0x00, 0x03, 0xdd, 0x01, 0x40, 0x0e, 0x0b, 0x0e, 0x35, 0xe1, 0x01,
+  0x00, 0xa0, 0x05, 0x34, 0x1f, 0x13, 0x1e, 0x0c, 0x00, 0x41, 0x18, 0x83, 0x79, 0x74, 0xe9, 0x0d, 0x40, 0x05, 0x2c, 0x31, 0x35, 0xdf, 0x01, 0xb2,
+  0x31, 0x27, 0x2d, 0x1f, 0x0b, 0x6f, 0x6f, 0x77, 0x8d, 0x2d, 0x31, 0xe1, 0x01, 0x00, 0xde, 0x01, 0x00, 0xb8, 0x05, 0xd0, 0x26, 0x27, 0x31, 0x2d,
+  0x1f, 0x18, 0x20, 0x87, 0x7b, 0x7b, 0x76, 0x6f, 0x09, 0x87, 0x09, 0x00, 0x9b, 0x05, 0x10, 0x0f, 0xdc, 0x01, 0x70, 0x1a, 0x1f, 0x1a, 0x0e, 0x9a,
+  0x6f, 0x5d, 0xdf, 0x01, 0x10, 0x59, 0x7e, 0x07, 0x00, 0x01, 0x00, 0x50, 0x5d, 0x76, 0x82, 0x6f, 0x76, 0xc9, 0x03, 0x07, 0x02, 0x00, 0x04, 0x01,
+  0x00, 0x41, 0x59, 0x59, 0x69, 0x63, 0x08, 0x00, 0xf1, 0x0b, 0xa5, 0x59, 0xa5, 0x5c, 0x5a, 0x70, 0x60, 0x60, 0x5c, 0x62, 0x82, 0x70, 0x82, 0x6a,
+  0x82, 0x89, 0x87, 0x93, 0x93, 0x91, 0x7a, 0x7f, 0x87, 0x80, 0x80, 0x7a, 0x42, 0x0b, 0x02, 0xc0, 0x03, 0xe0, 0x80, 0x72, 0x72, 0x72, 0x76, 0x6a,
+  0x6f, 0x76, 0x74, 0x76, 0x77, 0x7b, 0x77, 0x74, 0xde, 0x01, 0x20, 0x72, 0x72, 0xaa, 0x01, 0x06, 0x02, 0x00, 0x01, 0x05, 0x00, 0x00, 0x02, 0x00,
+  0x01, 0x05, 0x00, 0x01, 0x02, 0x00, 0x00, 0x43, 0x09, 0x00, 0xfe, 0x01, 0x10, 0x6a, 0x0d, 0x00, 0x05, 0x02, 0x00, 0x03, 0xdb, 0x01, 0x05, 0xde,
+  0x01, 0x01, 0x77, 0x07, 0x00, 0xdd, 0x01, 0x00, 0x95, 0x05, 0x00, 0xcc, 0x01, 0x01, 0xdf, 0x01, 0x00, 0xd4, 0x01, 0x00, 0x09, 0x00, 0x10, 0x7b,
+  0xd2, 0x01, 0x07, 0x45, 0x09, 0x0f, 0x01, 0x00, 0x00, 0x24, 0x83, 0x82, 0x91, 0x05, 0x00, 0xd9, 0x01, 0x01, 0x04, 0x00, 0x10, 0x87, 0x02, 0x00,
+  0x02, 0x78, 0x07, 0x31, 0x89, 0x87, 0x89, 0xda, 0x01, 0x02, 0xbd, 0x03, 0x03, 0xdb, 0x01, 0x00, 0x02, 0x00, 0x00, 0xd9, 0x01, 0x00, 0x02, 0x00,
+  0x01, 0xdd, 0x01, 0x00, 0x02, 0x00, 0x01, 0xdd, 0x01, 0x21, 0x95, 0x95, 0x33, 0x0b, 0x03, 0xdf, 0x01, 0x01, 0xdb, 0x01, 0x00, 0x02, 0x00, 0x03,
+  0x01, 0x00, 0x01, 0xdd, 0x01, 0x02, 0x98, 0x05, 0x01, 0x9a, 0x05, 0x04, 0x01, 0x00, 0x04, 0xdf, 0x01, 0x40, 0x0e, 0x0e, 0x0e, 0x2d, 0x94, 0x05,
+  0x91, 0x3b, 0x39, 0x35, 0x39, 0x35, 0x25, 0x1f, 0x3b, 0x35, 0xdf, 0x01, 0x60, 0x35, 0x25, 0x00, 0x7a, 0x91, 0x7a, 0xef, 0x00, 0x40, 0x91, 0x25,
+  0x35, 0x39, 0xc0, 0x03, 0x91, 0x2d, 0x2d, 0x2d, 0x25, 0x09, 0x6f, 0x6f, 0x72, 0x18, 0x81, 0x09, 0x00, 0xdb, 0x01, 0x20, 0x31, 0x2d, 0xc4, 0x03,
+  0x00, 0x86, 0x07, 0xa0, 0x27, 0x1f, 0x1f, 0x25, 0x1e, 0x97, 0x10, 0x86, 0x8d, 0x25, 0xc7, 0x05, 0x20, 0x27, 0x1f, 0xda, 0x01, 0x00, 0xc2, 0x03,
+  0x41, 0x13, 0x13, 0x91, 0x6f, 0xd1, 0x12, 0x00, 0xe1, 0x01, 0x02, 0xe2, 0x01, 0x44, 0x63, 0x85, 0x98, 0x8c, 0xcb, 0x03, 0x00, 0xe7, 0x01, 0x00,
+  0x04, 0x00, 0x00, 0xe3, 0x01, 0x00, 0xe6, 0x01, 0x00, 0x09, 0x00, 0x00, 0x08, 0x00, 0xf1, 0x0c, 0xa5, 0x59, 0xa5, 0x5a, 0x5d, 0x5c, 0x63, 0x65,
+  0x59, 0x5a, 0x65, 0x76, 0x5c, 0x76, 0x74, 0x7b, 0x91, 0x91, 0x99, 0x91, 0x89, 0x72, 0x7a, 0x80, 0x87, 0x83, 0x7a, 0x69, 0x0a, 0x40, 0x8e, 0x8a,
+  0x87, 0x7a, 0x14, 0x03, 0xc0, 0x7a, 0x7b, 0x7a, 0x6f, 0x77, 0x7b, 0x72, 0x6f, 0x77, 0x7a, 0x7b, 0x74, 0xb5, 0x01, 0x10, 0x71, 0xe0, 0x01, 0x02,
+  0x04, 0x00, 0x21, 0x72, 0x6e, 0x6b, 0x05, 0x00, 0xba, 0x01, 0x04, 0x01, 0x00, 0x01, 0xe7, 0x01, 0x00, 0xcf, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x28, 0x00, 0x00, 0xea, 0x00, 0x00, 0x01, 0x00, 0x00, 0xb7, 0x03, 0x20, 0x74, 0x76, 0xd9, 0x01, 0x01, 0x93, 0x05,
+  0x00, 0xdd, 0x01, 0x00, 0x02, 0x00, 0x01, 0xda, 0x01, 0x31, 0x80, 0x7a, 0x7b, 0xd0, 0x01, 0x04, 0x02, 0x00, 0x09, 0x01, 0x00, 0x01, 0xa8, 0x03,
+  0x01, 0x41, 0x09, 0x02, 0xaf, 0x03, 0x10, 0x80, 0x05, 0x00, 0x03, 0x02, 0x00, 0x00, 0xb8, 0x03, 0x05, 0x2f, 0x0b, 0x02, 0xdd, 0x01, 0x00, 0xda,
+  0x01, 0x00, 0xcb, 0x00, 0x00, 0xdf, 0x01, 0x20, 0x8a, 0x91, 0xeb, 0x0e, 0x01, 0xd9, 0x01, 0x20, 0x8e, 0x91, 0x01, 0x00, 0x14, 0x94, 0xdb, 0x01,
+  0x00, 0xba, 0x03, 0x00, 0xb7, 0x03, 0x00, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0xda, 0x01, 0x05, 0xdc, 0x01, 0x42, 0x05, 0x08, 0x05, 0x09, 0x9c,
+  0x05, 0x20, 0x09, 0x05, 0xbc, 0x03, 0x05, 0x79, 0x07, 0x07, 0xdd, 0x01, 0x50, 0x0e, 0x13, 0x0e, 0x35, 0x2d, 0xd3, 0x01, 0x00, 0xd6, 0x01, 0x41,
+  0x3b, 0x25, 0x1f, 0x35, 0x2e, 0x0d, 0x60, 0x35, 0x2c, 0x95, 0x7f, 0x89, 0x7b, 0x20, 0x01, 0x70, 0x7f, 0x25, 0x2d, 0x35, 0x2d, 0x2d, 0x2d, 0xcd,
+  0x01, 0x61, 0x25, 0x08, 0x6f, 0x6f, 0x79, 0x1e, 0xc1, 0x14, 0x31, 0x31, 0x39, 0x31, 0x13, 0x00, 0xf0, 0x00, 0x26, 0x27, 0x1f, 0x27, 0x31, 0x2d,
+  0x2d, 0x99, 0x18, 0x18, 0x0b, 0x8f, 0x83, 0x7e, 0x1e, 0xf0, 0x01, 0xf0, 0x00, 0x1f, 0x0f, 0x1a, 0x1f, 0x1f, 0x26, 0x1f, 0x26, 0x1f, 0x1a, 0x0e,
+  0x0b, 0x87, 0x6a, 0x5d, 0x0f, 0x0f, 0x02, 0xe1, 0x01, 0x01, 0xc4, 0x03, 0x50, 0x5d, 0x70, 0x92, 0x6b, 0x5c, 0x10, 0x00, 0x90, 0x63, 0x82, 0x70,
+  0x63, 0x59, 0x70, 0x76, 0x63, 0x5c, 0x16, 0x00, 0x01, 0xd9, 0x01, 0x02, 0x02, 0x00, 0x01, 0x05, 0x00, 0xf0, 0x08, 0x59, 0xa5, 0x60, 0x82, 0x84,
+  0x60, 0x58, 0x59, 0x5c, 0x69, 0x60, 0x66, 0x82, 0x91, 0x89, 0x87, 0x91, 0x91, 0x7b, 0x6a, 0x7b, 0x89, 0x91, 0x14, 0x01, 0x50, 0x83, 0x8a, 0x8e,
+  0x8e, 0x8a, 0xed, 0x04, 0xa0, 0x87, 0x83, 0x83, 0x85, 0x82, 0x74, 0x74, 0x7b, 0x6f, 0x72, 0xf8, 0x08, 0x01, 0x96, 0x03, 0x11, 0x6f, 0xd9, 0x01,
+  0x00, 0xdb, 0x01, 0x01, 0xb4, 0x01, 0x07, 0x02, 0x00, 0x04, 0x01, 0x00, 0x00, 0xd5, 0x01, 0x00, 0x02, 0x00, 0x04, 0x01, 0x00, 0x00, 0x1c, 0x00,
+  0x00, 0xd8, 0x01, 0x01, 0x01, 0x00, 0x12, 0x76, 0xdf, 0x01, 0x00, 0xde, 0x01, 0x08, 0xdd, 0x01, 0x00, 0x02, 0x00, 0x30, 0x80, 0x7b, 0x7f, 0xe1,
+  0x01, 0x21, 0x80, 0x7b, 0x02, 0x00, 0x10, 0x80, 0x04, 0x00, 0x08, 0xe1, 0x01, 0x01, 0xd7, 0x01, 0x10, 0x82, 0xcc, 0x01, 0x18, 0x80, 0xd9, 0x01,
+  0x01, 0x02, 0x00, 0x01, 0xb9, 0x03, 0x00, 0x02, 0x00, 0x01, 0x01, 0x00, 0x01, 0xb5, 0x03, 0x00, 0xc8, 0x00, 0x01, 0x02, 0x00, 0x00, 0x75, 0x07,
+  0x00, 0xb9, 0x03, 0x07, 0x77, 0x07, 0x01, 0xdd, 0x01, 0x20, 0x91, 0x94, 0xdd, 0x01, 0x01, 0xbc, 0x03, 0x34, 0x95, 0x93, 0x95, 0xdd, 0x01, 0x00,
+  0x79, 0x07, 0x00, 0xdf, 0x01, 0x10, 0x08, 0xdb, 0x01, 0x00, 0xdd, 0x01, 0x20, 0x05, 0x05, 0x96, 0x05, 0x00, 0xcf, 0x10, 0x20, 0x09, 0x0b, 0xbe,
+  0x03, 0x03, 0x01, 0x00, 0x00, 0xde, 0x01, 0x00, 0x05, 0x00, 0x01, 0x01, 0x00, 0x10, 0x13, 0xc0, 0x03, 0x40, 0x35, 0x39, 0x3b, 0x35, 0xc0, 0x03,
+  0x10, 0x3b, 0x01, 0x00, 0xf0, 0x0f, 0x39, 0x3b, 0x35, 0x3b, 0x3b, 0x37, 0x09, 0x86, 0x87, 0x80, 0x7a, 0x72, 0x72, 0x6f, 0x77, 0x18, 0x35, 0x2d,
+  0x39, 0x2d, 0x31, 0x2d, 0x2d, 0x2d, 0x27, 0x25, 0x05, 0x72, 0x6f, 0x7f, 0x41, 0x0d, 0x00, 0xe1, 0x01, 0x01, 0xdf, 0x01, 0x00, 0x01, 0x00, 0xf0,
+  0x03, 0x31, 0x2d, 0x31, 0x1f, 0x99, 0x1e, 0x0a, 0x94, 0x7e, 0x03, 0x18, 0x27, 0x2d, 0x27, 0x1a, 0x13, 0x1a, 0x27, 0xdc, 0x01, 0x80, 0x1f, 0x1a,
+  0x13, 0x13, 0x07, 0x7b, 0x62, 0x63, 0xbe, 0x03, 0x02, 0x01, 0x00, 0x01, 0xe1, 0x01, 0xf0, 0x08, 0x5d, 0x59, 0x63, 0x76, 0x6a, 0x63, 0x76, 0x69,
+  0x63, 0x70, 0x85, 0x98, 0x7b, 0x59, 0x69, 0x8c, 0x9d, 0x98, 0x85, 0x85, 0x5c, 0x70, 0x65, 0xd2, 0x01, 0x01, 0xdb, 0x01, 0x02, 0x03, 0x00, 0xf0,
+  0x13, 0x5a, 0x59, 0x5c, 0x60, 0x8c, 0x8c, 0x65, 0x59, 0x5a, 0x59, 0x5c, 0x76, 0x6e, 0x7b, 0x7b, 0x85, 0x85, 0x8c, 0x6a, 0x62, 0x60, 0x76, 0x89,
+  0x89, 0x8d, 0x85, 0x89, 0x72, 0x72, 0x8a, 0x8a, 0x8e, 0x7f, 0x83, 0xbf, 0x06, 0x40, 0x83, 0x83, 0x85, 0x7b, 0x51, 0x07, 0x51, 0x6e, 0x77, 0x7b,
+  0x7b, 0x7b, 0x97, 0x03, 0x10, 0x71, 0xa6, 0x01, 0x06, 0xb0, 0x01, 0x01, 0xe7, 0x01, 0x00, 0x01, 0x00, 0xa2, 0x6f, 0x72, 0x72, 0x70, 0x72, 0x6f,
+  0x6f, 0x70, 0x6f, 0x70, 0x08, 0x00, 0x40, 0x72, 0x6f, 0x72, 0x70, 0xd9, 0x01, 0x00, 0x02, 0x00, 0x02, 0x01, 0x00, 0x00, 0x95, 0x05, 0x01, 0x4f,
+  0x09, 0x01, 0xbc, 0x03, 0x01, 0xdf, 0x01, 0x01, 0xd8, 0x01, 0x14, 0x7b, 0xb4, 0x03, 0x00, 0x05, 0x00, 0x00, 0x0b, 0x00, 0x0a, 0x01, 0x00, 0x01,
+  0xd8, 0x01, 0x00, 0x02, 0x00, 0x00, 0xc9, 0x01, 0x05, 0x02, 0x00, 0x11, 0x87, 0x04, 0x00, 0x03, 0x02, 0x00, 0x02, 0x05, 0x00, 0x02, 0x01, 0x00,
+  0x00, 0xbc, 0x03, 0x10, 0x89, 0x73, 0x07, 0x02, 0x02, 0x00, 0x01, 0xdb, 0x01, 0x15, 0x8a, 0xbb, 0x03, 0x10, 0x8e, 0xba, 0x03, 0x11, 0x94, 0x05,
+  0x00, 0x02, 0xdf, 0x01, 0x01, 0xb8, 0x03, 0x02, 0x02, 0x00, 0x00, 0xd9, 0x01, 0x00, 0x04, 0x00, 0x06, 0xbc, 0x03, 0x10, 0x08, 0xdc, 0x01, 0x00,
+  0xda, 0x01, 0x10, 0x05, 0xdb, 0x01, 0x01, 0xbc, 0x03, 0x07, 0x01, 0x00, 0x00, 0x77, 0x07, 0x03, 0x01, 0x00, 0x13, 0x13, 0x80, 0x07, 0x20, 0x35,
+  0x3b, 0x08, 0x00, 0x00, 0xdc, 0x01, 0x00, 0x0d, 0x00, 0x60, 0x35, 0x1e, 0x8a, 0x8c, 0x91, 0x92, 0x1b, 0x01, 0x22, 0x0e, 0x2c, 0xc0, 0x03, 0x80,
+  0x2d, 0x27, 0x27, 0x0c, 0x72, 0x72, 0x99, 0x2c, 0x9f, 0x05, 0x00, 0xdd, 0x01, 0x01, 0xdf, 0x01, 0x30, 0x26, 0x1f, 0x27, 0x1b, 0x00, 0x70, 0x95,
+  0x8f, 0x91, 0x8f, 0x0e, 0x25, 0x2d, 0xdf, 0x01, 0x20, 0x1f, 0x27, 0xdd, 0x01, 0x60, 0x1f, 0x1f, 0x13, 0x0b, 0x89, 0x6f, 0xde, 0x01, 0x11, 0x63,
+  0xa1, 0x05, 0x04, 0x01, 0x00, 0xf0, 0x08, 0x59, 0x5d, 0x59, 0x70, 0x92, 0x92, 0x92, 0x82, 0x70, 0x5d, 0x85, 0x98, 0x85, 0x6f, 0x66, 0x7a, 0x9a,
+  0x9a, 0x9a, 0x8c, 0x7b, 0x82, 0x7b, 0xac, 0x05, 0x07, 0xc7, 0x03, 0xf0, 0x11, 0x63, 0x5d, 0x5c, 0x70, 0x85, 0xa6, 0x5c, 0x59, 0x59, 0x59, 0x5c,
+  0x85, 0x85, 0x8c, 0x74, 0x7b, 0x6a, 0x62, 0x62, 0x62, 0x60, 0x66, 0x6a, 0x82, 0x85, 0x7a, 0x7c, 0x72, 0x80, 0x89, 0x8e, 0x8d, 0xe5, 0x10, 0xf2,
+  0x02, 0x7a, 0x83, 0x87, 0x85, 0x83, 0x6e, 0x6a, 0x6d, 0x6f, 0x76, 0x76, 0x72, 0x76, 0x77, 0x73, 0x6f, 0x71, 0xde, 0x01, 0x0f, 0x01, 0x00, 0x04,
+  0x03, 0xc8, 0x01, 0x00, 0xca, 0x03, 0x01, 0x07, 0x00, 0x08, 0x01, 0x00, 0x02, 0xdc, 0x01, 0x00, 0x01, 0x00, 0x00, 0xda, 0x01, 0x00, 0xdb, 0x01,
+  0x08, 0xbc, 0x03, 0x01, 0xd6, 0x01, 0x00, 0xb3, 0x03, 0x05, 0x01, 0x00, 0x07, 0xe5, 0x01, 0x20, 0x82, 0x83, 0x02, 0x00, 0x00, 0xd5, 0x01, 0x00,
+  0x66, 0x07, 0x06, 0x02, 0x00, 0x0a, 0xe2, 0x01, 0x00, 0x8d, 0x02, 0x41, 0x87, 0x87, 0x89, 0x89, 0x03, 0x00, 0x00, 0xda, 0x01, 0x30, 0x8d, 0x89,
+  0x8d, 0x01, 0x00, 0x12, 0x91, 0x05, 0x00, 0x00, 0x93, 0x05, 0x00, 0x74, 0x07, 0x01, 0xb9, 0x03, 0x00, 0xd8, 0x01, 0x51, 0x95, 0x93, 0x94, 0x95,
+  0x94, 0xba, 0x03, 0x01, 0xdc, 0x01, 0x11, 0x9a, 0xda, 0x01, 0x05, 0xd9, 0x01, 0x04, 0x01, 0x00, 0x10, 0x09, 0x02, 0x00, 0x00, 0x01, 0x00, 0x05,
+  0x96, 0x05, 0x02, 0x01, 0x00, 0x00, 0xbe, 0x03, 0x00, 0xd8, 0x01, 0x00, 0x01, 0x00, 0x11, 0x13, 0x02, 0x00, 0x50, 0x35, 0x35, 0x35, 0x35, 0x3b,
+  0xe4, 0x01, 0x50, 0x35, 0x35, 0x2c, 0x1f, 0x3b, 0xe3, 0x01, 0x80, 0x35, 0x35, 0x35, 0x18, 0x97, 0x83, 0x77, 0x77, 0xff, 0x00, 0x11, 0x05, 0xe0,
+  0x01, 0x82, 0x2d, 0x31, 0x2d, 0x27, 0x2c, 0x13, 0x74, 0x73, 0x40, 0x0d, 0x00, 0xcf, 0x03, 0x12, 0x31, 0x54, 0x0b, 0x00, 0x1c, 0x00, 0xf0, 0x01,
+  0x13, 0x79, 0x8d, 0x86, 0x6e, 0x99, 0x25, 0x27, 0x27, 0x1f, 0x27, 0x1f, 0x27, 0x1a, 0x27, 0x27, 0xdf, 0x01, 0x43, 0x91, 0x72, 0x66, 0x63, 0x01,
+  0x00, 0x0a, 0xe4, 0x01, 0x40, 0x63, 0x76, 0x90, 0x82, 0x51, 0x0b, 0xf2, 0x03, 0x92, 0x05, 0x9b, 0x80, 0x9a, 0x05, 0x07, 0x93, 0x9a, 0x05, 0x0c,
+  0x98, 0x60, 0x5d, 0x5c, 0x63, 0x66, 0x5c, 0xe1, 0x01, 0x00, 0xa5, 0x07, 0xf0, 0x0e, 0x65, 0x63, 0x70, 0x70, 0x5c, 0x59, 0x5a, 0x59, 0x5a, 0x5d,
+  0x76, 0x76, 0x72, 0x82, 0x7b, 0x60, 0x69, 0x66, 0x70, 0x62, 0x60, 0x62, 0x6a, 0x6a, 0x78, 0x72, 0x73, 0x80, 0x83, 0xb3, 0x06, 0x52, 0x83, 0x80,
+  0x7a, 0x80, 0x85, 0xbf, 0x03, 0x12, 0x70, 0x9a, 0x05, 0x00, 0xb4, 0x01, 0x10, 0x73, 0xb0, 0x00, 0x00, 0x68, 0x05, 0x00, 0x03, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x22, 0x0a, 0x04, 0x06, 0x00, 0x0e, 0x01, 0x00, 0x01, 0x18, 0x00, 0x00, 0xd8, 0x01, 0x00, 0xdb, 0x01, 0x02, 0xdd, 0x01, 0x00, 0xdf,
+  0x01, 0x01, 0xd7, 0x01, 0x01, 0x8e, 0x05, 0x02, 0x02, 0x00, 0x09, 0xdd, 0x01, 0x00, 0x87, 0x05, 0x00, 0x04, 0x00, 0x02, 0x02, 0x00, 0x00, 0xcc,
+  0x01, 0x16, 0x85, 0x92, 0x05, 0x01, 0xcf, 0x01, 0x02, 0x02, 0x00, 0x00, 0xa9, 0x03, 0x02, 0xdb, 0x01, 0x07, 0x02, 0x00, 0x03, 0xdd, 0x01, 0x40,
+  0x8a, 0x89, 0x8a, 0x91, 0xe2, 0x01, 0x06, 0x51, 0x09, 0x01, 0x78, 0x07, 0x15, 0x93, 0xbb, 0x03, 0x10, 0x94, 0xde, 0x01, 0x00, 0xb5, 0x03, 0x00,
+  0x04, 0x00, 0x40, 0x9a, 0x99, 0x99, 0x9a, 0xb7, 0x03, 0x40, 0x04, 0x05, 0x99, 0x04, 0xd8, 0x01, 0x01, 0xdb, 0x01, 0x05, 0xbe, 0x03, 0x0c, 0xe0,
+  0x01, 0x06, 0xdc, 0x01, 0x00, 0x9a, 0x05, 0x02, 0x06, 0x00, 0x30, 0x35, 0x3b, 0x3b, 0xe1, 0x01, 0x00, 0x9c, 0x05, 0x40, 0x2c, 0x18, 0x35, 0x3e,
+  0x08, 0x00, 0xf1, 0x00, 0x35, 0x35, 0x18, 0x14, 0x9b, 0x87, 0x77, 0x74, 0x72, 0x72, 0x74, 0x8e, 0x25, 0x2d, 0x35, 0xc6, 0x01, 0x52, 0x2d, 0x27,
+  0x1e, 0x79, 0x7f, 0x00, 0x11, 0x00, 0xbe, 0x03, 0x02, 0xdf, 0x01, 0x01, 0xbf, 0x03, 0x80, 0x18, 0x03, 0x9b, 0x0a, 0x0b, 0x25, 0x27, 0x1f, 0xdf,
+  0x01, 0x03, 0xc0, 0x03, 0x58, 0x88, 0x6a, 0x66, 0x66, 0x63, 0xe2, 0x01, 0x05, 0x01, 0x00, 0x30, 0x60, 0x85, 0x70, 0xc8, 0x03, 0xf0, 0x04, 0x5d,
+  0x91, 0x0c, 0x0a, 0x8d, 0x0a, 0x9a, 0x93, 0x9a, 0x0b, 0x0e, 0x13, 0x0c, 0x72, 0x66, 0x70, 0x82, 0x98, 0x8c, 0x8a, 0x07, 0x00, 0x01, 0x00, 0x40,
+  0x5c, 0x63, 0x69, 0x69, 0xbd, 0x03, 0xf0, 0x21, 0x59, 0x59, 0x59, 0x5a, 0x5c, 0x76, 0x85, 0x7b, 0x69, 0x69, 0x62, 0x69, 0x7b, 0x65, 0x60, 0x63,
+  0x62, 0x7b, 0x85, 0x7c, 0x89, 0x89, 0x79, 0x87, 0x91, 0x8a, 0x8d, 0x83, 0x7a, 0x80, 0x7b, 0x6f, 0x80, 0x6f, 0x6c, 0x6a, 0x6d, 0x6e, 0x6e, 0x70,
+  0x6e, 0x70, 0x72, 0x71, 0x6f, 0x73, 0x72, 0x71, 0xd7, 0x01, 0x01, 0xd9, 0x01, 0x00, 0xb7, 0x1b, 0x00, 0x0b, 0x00, 0x10, 0x76, 0x9c, 0x03, 0x00,
+  0x02, 0x00, 0x01, 0x16, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x05, 0x00, 0x05, 0x07, 0x00, 0x00, 0xd9, 0x01, 0x07, 0xdc, 0x01, 0x10, 0x7b, 0xe9, 0x05,
+  0x03, 0x99, 0x05, 0x0f, 0xda, 0x01, 0x00, 0x10, 0x82, 0xde, 0x01, 0x01, 0x03, 0x00, 0x00, 0xe1, 0x01, 0x01, 0xd1, 0x01, 0x0f, 0xdb, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0xcd, 0x01, 0x02, 0xe3, 0x01, 0x09, 0x02, 0x00, 0x00, 0xd9, 0x01, 0x00, 0xe9, 0x0e, 0x00, 0xa5, 0x12, 0x01, 0x75, 0x07,
+  0x00, 0x02, 0x00, 0x03, 0x01, 0x00, 0x00, 0x73, 0x07, 0x00, 0x01, 0x00, 0x40, 0x95, 0x94, 0x95, 0x94, 0x63, 0x16, 0x21, 0x95, 0x99, 0xe1, 0x01,
+  0x00, 0xba, 0x03, 0x10, 0x9a, 0x96, 0x05, 0x03, 0xbf, 0x03, 0x40, 0x07, 0x05, 0x09, 0x04, 0xdb, 0x01, 0x00, 0x02, 0x00, 0x01, 0xdd, 0x01, 0x08,
+  0xdc, 0x01, 0x02, 0xdf, 0x01, 0x03, 0xe1, 0x01, 0xb0, 0x13, 0x0e, 0x0e, 0x0e, 0x0e, 0x13, 0x0e, 0x13, 0x0e, 0x13, 0x0e, 0xe0, 0x3b, 0x3b, 0x3b,
+  0x3b, 0x35, 0x3b, 0x35, 0x3b, 0x3b, 0x3b, 0x3e, 0x2c, 0x04, 0x37, 0x0e, 0x00, 0xf1, 0x01, 0x3b, 0x35, 0x3e, 0x18, 0x18, 0x17, 0x89, 0x7a, 0x77,
+  0x72, 0x72, 0x74, 0x83, 0x25, 0x35, 0x2d, 0x01, 0x00, 0xe0, 0x27, 0x2c, 0x13, 0x79, 0x87, 0x2c, 0x35, 0x3b, 0x39, 0x39, 0x35, 0x31, 0x35, 0x31,
+  0x11, 0x00, 0xf1, 0x13, 0x27, 0x27, 0x27, 0x2d, 0x39, 0x2d, 0x2d, 0x2d, 0x2c, 0x0b, 0x05, 0x1e, 0x1f, 0x13, 0x13, 0x1f, 0x27, 0x27, 0x27, 0x1f,
+  0x27, 0x27, 0x1a, 0x1f, 0x1a, 0x1f, 0x1f, 0x0b, 0x8f, 0x83, 0x6f, 0x66, 0x6b, 0x63, 0x01, 0x00, 0x13, 0x5d, 0x03, 0x00, 0x11, 0x5d, 0x01, 0x00,
+  0xf0, 0x16, 0x7b, 0x9b, 0x85, 0x66, 0x5d, 0x59, 0x5d, 0x66, 0x97, 0x13, 0x13, 0x8d, 0x8a, 0x6c, 0x7f, 0x13, 0x13, 0x0e, 0x13, 0x0c, 0x0c, 0x9b,
+  0x98, 0x9a, 0x9f, 0x92, 0x5c, 0x59, 0x59, 0x59, 0x5d, 0x59, 0x59, 0x59, 0x63, 0x76, 0x69, 0x0b, 0x00, 0xd0, 0x59, 0x59, 0x5a, 0x59, 0x5d, 0x5c,
+  0x70, 0x8c, 0x76, 0x66, 0x60, 0x5c, 0x60, 0x03, 0x00, 0xf0, 0x06, 0x76, 0x85, 0x7d, 0x7a, 0x91, 0x87, 0x7a, 0x89, 0x8a, 0x91, 0x8e, 0x89, 0x87,
+  0x72, 0x72, 0x82, 0x85, 0x74, 0x6e, 0x6e, 0x70, 0x02, 0x00, 0x30, 0x72, 0x70, 0x72, 0x01, 0x00, 0x81, 0x74, 0x74, 0x72, 0x74, 0x72, 0x74, 0x74,
+  0x76, 0x02, 0x00, 0x01, 0x01, 0x00, 0x02, 0x09, 0x00, 0x10, 0x76, 0x18, 0x00, 0x10, 0x76, 0x1c, 0x00, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x02,
+  0x18, 0x00, 0x10, 0x77, 0x23, 0x00, 0x60, 0x74, 0x77, 0x74, 0x77, 0x77, 0x7b, 0x03, 0x00, 0x21, 0x7b, 0x7a, 0x04, 0x00, 0xf3, 0x00, 0x7b, 0x7a,
+  0x7b, 0x7a, 0x80, 0x7b, 0x80, 0x7a, 0x80, 0x7a, 0x80, 0x80, 0x80, 0x7b, 0x80, 0x01, 0x00, 0x20, 0x82, 0x83, 0x02, 0x00, 0x69, 0x85, 0x80, 0x85,
+  0x80, 0x85, 0x83, 0x02, 0x00, 0x38, 0x85, 0x85, 0x87, 0x02, 0x00, 0x50, 0x87, 0x89, 0x87, 0x89, 0x85, 0x05, 0x00, 0x02, 0x02, 0x00, 0x37, 0x89,
+  0x89, 0x8a, 0x02, 0x00, 0xf2, 0x0c, 0x89, 0x8a, 0x89, 0x8d, 0x8d, 0x91, 0x89, 0x91, 0x8d, 0x8d, 0x8d, 0x91, 0x8d, 0x91, 0x8e, 0x91, 0x8e, 0x91,
+  0x91, 0x91, 0x8e, 0x91, 0x93, 0x91, 0x93, 0x91, 0x94, 0x02, 0x00, 0x91, 0x94, 0x94, 0x94, 0x95, 0x95, 0x95, 0x95, 0x99, 0x9a, 0x02, 0x00, 0xf4,
+  0x0f, 0x99, 0x99, 0x99, 0x05, 0x99, 0x9a, 0x05, 0x99, 0x05, 0x9a, 0x05, 0x05, 0x04, 0x05, 0x05, 0x05, 0x05, 0x07, 0x05, 0x09, 0x05, 0x05, 0x05,
+  0x09, 0x05, 0x09, 0x08, 0x09, 0x08, 0x09, 0x01, 0x00, 0x42, 0x0b, 0x09, 0x09, 0x0b, 0x01, 0x00, 0x12, 0x0e, 0x02, 0x00, 0x04, 0x01, 0x00, 0xc0,
+  0x13, 0x0e, 0x0e, 0x14, 0x0e, 0x11, 0x13, 0x11, 0x13, 0x3e, 0x3b, 0x3e, 0xd3, 0x01, 0x60, 0x3b, 0x3b, 0x3e, 0x3b, 0x14, 0x01, 0x0b, 0x00, 0xf0,
+  0x02, 0x3b, 0x3e, 0x3b, 0x37, 0x05, 0x86, 0x9b, 0x91, 0x74, 0x77, 0x72, 0x77, 0x72, 0x7e, 0x1e, 0x35, 0x2c, 0xdf, 0x01, 0x83, 0x2d, 0x2d, 0x27,
+  0x1e, 0x79, 0x8d, 0x35, 0x35, 0xdf, 0x01, 0x11, 0x31, 0xdf, 0x01, 0x10, 0x27, 0xdf, 0x01, 0x71, 0x2d, 0x1f, 0x2c, 0x25, 0x1f, 0x1f, 0x1f, 0xdd,
+  0x01, 0x00, 0x05, 0x00, 0xf0, 0x01, 0x13, 0x1f, 0x1f, 0x1f, 0x1f, 0x1e, 0x18, 0x17, 0x92, 0x85, 0x6f, 0x6a, 0x62, 0x66, 0x63, 0x66, 0xe4, 0x01,
+  0x01, 0xe0, 0x01, 0x01, 0x02, 0x00, 0xf0, 0x18, 0x8c, 0x98, 0x82, 0x70, 0x5d, 0x5d, 0x63, 0x7b, 0x9b, 0x13, 0x0c, 0x13, 0x9b, 0x9a, 0x05, 0x14,
+  0x0b, 0x95, 0x95, 0x05, 0x0a, 0x05, 0x83, 0x89, 0x87, 0x6a, 0x5d, 0x59, 0x59, 0x69, 0x70, 0x5d, 0x5c, 0x5d, 0x69, 0x5d, 0x76, 0x5d, 0x5a, 0xe0,
+  0x01, 0xf0, 0x07, 0x59, 0x59, 0x5c, 0x5d, 0x70, 0x7b, 0x76, 0x66, 0x60, 0x5d, 0x60, 0x5d, 0x65, 0x5d, 0x65, 0x70, 0x6e, 0x7b, 0x8c, 0x91, 0x94,
+  0x8e, 0x1a, 0x01, 0x81, 0x8a, 0x89, 0x89, 0x85, 0x85, 0x82, 0x72, 0x70, 0xe1, 0x01, 0x00, 0xdf, 0x01, 0x41, 0x71, 0x72, 0x75, 0x72, 0xcf, 0x01,
+  0x10, 0x76, 0xd0, 0x01, 0x01, 0xd5, 0x01, 0x01, 0x07, 0x00, 0x02, 0x01, 0x00, 0x01, 0x0d, 0x00, 0x11, 0x76, 0xd7, 0x01, 0x02, 0x06, 0x00, 0x00,
+  0x14, 0x00, 0x32, 0x77, 0x76, 0x77, 0x01, 0x00, 0x12, 0x7b, 0x02, 0x00, 0x11, 0x7a, 0x02, 0x00, 0x52, 0x7b, 0x7a, 0x82, 0x7a, 0x82, 0xdd, 0x01,
+  0x06, 0x01, 0x00, 0x80, 0x85, 0x80, 0x83, 0x82, 0x87, 0x82, 0x87, 0x82, 0xd1, 0x01, 0x00, 0x02, 0x00, 0x04, 0xe5, 0x01, 0x00, 0xd3, 0x01, 0x02,
+  0x06, 0x00, 0x41, 0x87, 0x86, 0x87, 0x85, 0xd2, 0x01, 0x06, 0x02, 0x00, 0x00, 0x01, 0x00, 0x41, 0x8a, 0x89, 0x89, 0x8d, 0xdb, 0x01, 0x30, 0x8a,
+  0x89, 0x8d, 0x02, 0x00, 0x01, 0xd9, 0x01, 0x21, 0x8d, 0x91, 0x01, 0x00, 0x03, 0x07, 0x00, 0x04, 0xd9, 0x01, 0x31, 0x94, 0x94, 0x95, 0xde, 0x01,
+  0x10, 0x99, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0xda, 0x01, 0x23, 0x99, 0x05, 0xdb, 0x01, 0x01, 0x01, 0x00, 0x10, 0x08, 0xdc, 0x01, 0x31, 0x05,
+  0x09, 0x09, 0x04, 0x00, 0x00, 0xda, 0x01, 0x00, 0xd6, 0x01, 0x05, 0x01, 0x00, 0x07, 0xdb, 0x01, 0x02, 0xde, 0x01, 0x21, 0x0e, 0x13, 0x02, 0x00,
+  0x10, 0x0e, 0xe0, 0x01, 0x11, 0x3e, 0xc1, 0x03, 0x41, 0x3e, 0x35, 0x1e, 0x37, 0xe1, 0x01, 0x60, 0x3b, 0x37, 0x04, 0x79, 0x77, 0x77, 0xdf, 0x01,
+  0x42, 0x77, 0x79, 0x1e, 0x2c, 0xc1, 0x03, 0x00, 0xc0, 0x03, 0x80, 0x97, 0x35, 0x3b, 0x3b, 0x35, 0x39, 0x2d, 0x2d, 0xbf, 0x03, 0x00, 0xc1, 0x03,
+  0xb2, 0x2d, 0x35, 0x2d, 0x35, 0x2d, 0x25, 0x13, 0x13, 0x18, 0x1f, 0x1f, 0xde, 0x01, 0xb0, 0x27, 0x27, 0x1f, 0x1f, 0x18, 0x18, 0x13, 0x18, 0x18,
+  0x1f, 0x1e, 0xe3, 0x01, 0x71, 0x0a, 0x92, 0x80, 0x79, 0x6a, 0x6a, 0x66, 0xe3, 0x01, 0x00, 0xdd, 0x01, 0x60, 0x5d, 0x63, 0x63, 0x63, 0x82, 0x70,
+  0xca, 0x03, 0xf0, 0x0c, 0x76, 0x9b, 0x99, 0x0a, 0x13, 0x18, 0x13, 0x13, 0x13, 0x0e, 0x8e, 0x79, 0x74, 0x7e, 0x0b, 0x0a, 0x0a, 0x6c, 0x60, 0x5a,
+  0x5d, 0x69, 0x8c, 0x98, 0x85, 0x62, 0x70, 0xe2, 0x01, 0x00, 0xdd, 0x01, 0xf0, 0x07, 0x59, 0x5c, 0x59, 0x5d, 0x5c, 0x65, 0x8c, 0x92, 0x85, 0x60,
+  0x60, 0x5d, 0x61, 0x5d, 0x61, 0x60, 0x65, 0x66, 0x62, 0x85, 0x94, 0x93, 0x14, 0x01, 0x61, 0x91, 0x89, 0x89, 0x82, 0x80, 0x7b, 0xdd, 0x01, 0x60,
+  0x6e, 0x70, 0x73, 0x70, 0x72, 0x71, 0x9f, 0x03, 0x40, 0x76, 0x74, 0x74, 0x77, 0x8d, 0x03, 0x10, 0x76, 0x03, 0x00, 0x02, 0xbc, 0x01, 0x00, 0x08,
+  0x00, 0x00, 0x02, 0x00, 0x00, 0x16, 0x00, 0x00, 0xaa, 0x03, 0x00, 0x03, 0x00, 0x13, 0x74, 0x18, 0x00, 0x06, 0xd9, 0x01, 0x20, 0x77, 0x7b, 0x01,
+  0x00, 0x00, 0xdd, 0x01, 0x40, 0x80, 0x7b, 0x7b, 0x80, 0x02, 0x00, 0x20, 0x7a, 0x82, 0xd6, 0x01, 0x40, 0x80, 0x82, 0x80, 0x82, 0xb1, 0x03, 0x04,
+  0xce, 0x01, 0x20, 0x83, 0x85, 0x03, 0x00, 0x04, 0x01, 0x00, 0x01, 0xd6, 0x01, 0x04, 0x02, 0x00, 0x10, 0x86, 0xd1, 0x01, 0x00, 0x02, 0x00, 0x07,
+  0x01, 0x00, 0x05, 0xd5, 0x01, 0x01, 0x02, 0x00, 0x20, 0x91, 0x8d, 0xdf, 0x01, 0x04, 0xd5, 0x01, 0x01, 0x01, 0x00, 0x10, 0x8e, 0xdb, 0x01, 0x31,
+  0x93, 0x91, 0x93, 0xdb, 0x01, 0x10, 0x95, 0xdc, 0x01, 0x05, 0xbb, 0x03, 0x60, 0x9a, 0x99, 0x9a, 0x05, 0x05, 0x99, 0xdb, 0x01, 0x06, 0xde, 0x01,
+  0x32, 0x07, 0x08, 0x07, 0xdf, 0x01, 0x02, 0xde, 0x01, 0x01, 0xdd, 0x01, 0x01, 0x05, 0x00, 0x20, 0x0b, 0x0e, 0x03, 0x00, 0x07, 0xdf, 0x01, 0x01,
+  0xd6, 0x01, 0x60, 0x0e, 0x18, 0x0e, 0x14, 0x13, 0x14, 0x04, 0x00, 0x40, 0x3e, 0x35, 0x41, 0x3e, 0xd6, 0x01, 0x72, 0x3e, 0x3b, 0x3e, 0x37, 0x35,
+  0x37, 0x3e, 0xef, 0x01, 0x20, 0x0e, 0x79, 0xe1, 0x01, 0x63, 0x74, 0x77, 0x77, 0x79, 0x14, 0x37, 0xe1, 0x01, 0x91, 0x25, 0x18, 0x73, 0x0b, 0x35,
+  0x3b, 0x39, 0x35, 0x35, 0x95, 0x05, 0x20, 0x2d, 0x35, 0xc2, 0x03, 0x65, 0x35, 0x2d, 0x2c, 0x03, 0x01, 0x25, 0xdd, 0x01, 0xc0, 0x27, 0x1f, 0x1f,
+  0x1f, 0x14, 0x93, 0x8f, 0x91, 0x9a, 0x0b, 0x14, 0x18, 0x01, 0x00, 0xa1, 0x1e, 0x18, 0x17, 0x17, 0x14, 0x9d, 0x9a, 0x8c, 0x77, 0x6a, 0xe3, 0x01,
+  0x00, 0xe5, 0x01, 0xc1, 0x62, 0x8c, 0x8c, 0x5d, 0x60, 0x5d, 0x5d, 0x63, 0x72, 0x98, 0x0a, 0x13, 0x01, 0x00, 0xf0, 0x01, 0x18, 0x14, 0x14, 0x0b,
+  0x14, 0x99, 0x0a, 0x9b, 0x82, 0x5d, 0x59, 0x72, 0x92, 0x8c, 0x8c, 0x8c, 0xdd, 0x01, 0x13, 0x5d, 0x02, 0x00, 0xf1, 0x0f, 0x5c, 0x5d, 0x60, 0x82,
+  0x92, 0x84, 0x66, 0x5c, 0x63, 0x5c, 0x63, 0x60, 0x63, 0x60, 0x63, 0x66, 0x85, 0x91, 0x99, 0x94, 0x93, 0x91, 0x8d, 0x89, 0x85, 0x87, 0x85, 0x82,
+  0x7b, 0x72, 0xe1, 0x01, 0x00, 0xbe, 0x03, 0x03, 0x95, 0x03, 0x00, 0xb7, 0x01, 0x40, 0x76, 0x77, 0x77, 0x7b, 0xc3, 0x01, 0x30, 0x7b, 0x74, 0x7b,
+  0xc3, 0x01, 0x02, 0x09, 0x00, 0x10, 0x76, 0xc5, 0x01, 0x01, 0x1d, 0x00, 0x01, 0x02, 0x00, 0x01, 0x1a, 0x00, 0x00, 0x12, 0x00, 0x01, 0x02, 0x00,
+  0x00, 0x01, 0x00, 0x02, 0xdd, 0x01, 0x01, 0x02, 0x00, 0x13, 0x82, 0x96, 0x05, 0x11, 0x82, 0x94, 0x05, 0x03, 0xdd, 0x01, 0x20, 0x80, 0x85, 0xdc,
+  0x01, 0x00, 0xde, 0x01, 0x00, 0xaf, 0x03, 0x00, 0x04, 0x00, 0x12, 0x87, 0x86, 0x05, 0x03, 0x08, 0x00, 0x06, 0x01, 0x00, 0x08, 0xd4, 0x01, 0x30,
+  0x8d, 0x89, 0x91, 0xb3, 0x03, 0x60, 0x8d, 0x89, 0x91, 0x8a, 0x91, 0x8a, 0x98, 0x05, 0x03, 0x02, 0x00, 0x03, 0x01, 0x00, 0x00, 0xdf, 0x01, 0x32,
+  0x94, 0x91, 0x95, 0xdf, 0x01, 0x22, 0x95, 0x95, 0x05, 0x00, 0x13, 0x99, 0xe3, 0x01, 0x02, 0x95, 0x05, 0x07, 0xde, 0x01, 0x10, 0x05, 0x97, 0x05,
+  0x02, 0x01, 0x00, 0x03, 0xd7, 0x01, 0x03, 0x01, 0x00, 0x09, 0xdb, 0x01, 0x02, 0x01, 0x00, 0x11, 0x14, 0x02, 0x00, 0x51, 0x18, 0x0e, 0x18, 0x0e,
+  0x13, 0xe0, 0x01, 0x40, 0x3e, 0x3e, 0x41, 0x3e, 0xd8, 0x01, 0x41, 0x3e, 0x35, 0x04, 0x3e, 0x09, 0x00, 0xf1, 0x01, 0x3b, 0x37, 0x18, 0x79, 0x7a,
+  0x77, 0x7a, 0x77, 0x77, 0x77, 0x79, 0x77, 0x14, 0x2c, 0x35, 0x2d, 0xa2, 0x05, 0x42, 0x2c, 0x1f, 0x79, 0x17, 0xc0, 0x03, 0x02, 0xf0, 0x01, 0x30,
+  0x2d, 0x27, 0x25, 0xe6, 0x01, 0x30, 0x03, 0x13, 0x2c, 0xda, 0x01, 0x00, 0x9a, 0x05, 0x00, 0xe0, 0x01, 0xe1, 0x0a, 0x79, 0x6f, 0x6c, 0x6a, 0x6a,
+  0x72, 0x85, 0x89, 0x89, 0x98, 0x0a, 0x0c, 0x14, 0xc9, 0x03, 0x90, 0x18, 0x18, 0x17, 0x14, 0x9b, 0x8c, 0x72, 0x66, 0x62, 0xe2, 0x01, 0x40, 0x63,
+  0x70, 0x90, 0x69, 0xca, 0x03, 0x80, 0x82, 0x98, 0x0c, 0x91, 0x09, 0x13, 0x13, 0x99, 0xc5, 0x03, 0xe1, 0x91, 0x05, 0x6e, 0x89, 0x0c, 0x98, 0x60,
+  0x5c, 0x7b, 0x9b, 0x82, 0x70, 0x82, 0x63, 0xda, 0x01, 0x01, 0x05, 0x00, 0x70, 0x5d, 0x5d, 0x5d, 0x5c, 0x63, 0x66, 0x63, 0xdf, 0x01, 0xf2, 0x0b,
+  0x5c, 0x63, 0x61, 0x63, 0x62, 0x6a, 0x8c, 0x94, 0x95, 0x94, 0x91, 0x91, 0x80, 0x6f, 0x82, 0x82, 0x85, 0x82, 0x82, 0x82, 0x7b, 0x72, 0x70, 0x72,
+  0x70, 0x6f, 0xdd, 0x01, 0x20, 0x76, 0x74, 0xda, 0x01, 0x00, 0x02, 0x00, 0x41, 0x76, 0x77, 0x7b, 0x76, 0x09, 0x00, 0x0b, 0x02, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x08, 0x00, 0x02, 0x6d, 0x07, 0x02, 0x02, 0x00, 0x03, 0xdb, 0x01, 0x23, 0x7a, 0x7b, 0xb9, 0x03, 0x00, 0xdc, 0x01, 0x00, 0x06, 0x00,
+  0x04, 0xb9, 0x03, 0x00, 0xde, 0x01, 0x00, 0x01, 0x00, 0x00, 0xc8, 0x01, 0x06, 0x07, 0x00, 0x10, 0x85, 0x60, 0x02, 0x06, 0xdc, 0x01, 0x01, 0x05,
+  0x00, 0x03, 0x01, 0x00, 0x00, 0xd5, 0x01, 0x09, 0x02, 0x00, 0x00, 0xb7, 0x03, 0x23, 0x91, 0x89, 0xdd, 0x01, 0x05, 0x01, 0x00, 0x00, 0xd9, 0x01,
+  0x01, 0x02, 0x00, 0x01, 0x01, 0x00, 0x01, 0xbe, 0x03, 0x10, 0x94, 0xd9, 0x01, 0x01, 0x04, 0x00, 0x10, 0x05, 0xdd, 0x01, 0x41, 0x9a, 0x05, 0x04,
+  0x9a, 0xe1, 0x01, 0x11, 0x07, 0x04, 0x00, 0x30, 0x07, 0x05, 0x09, 0xc0, 0x03, 0x02, 0x01, 0x00, 0x00, 0x73, 0x07, 0x00, 0xe3, 0x01, 0x10, 0x0e,
+  0x04, 0x00, 0x1a, 0x0e, 0xe0, 0x01, 0x01, 0xb3, 0x03, 0x01, 0xc2, 0x03, 0x00, 0xdb, 0x01, 0x01, 0x02, 0x00, 0x60, 0x35, 0x37, 0x3e, 0x41, 0x41,
+  0x41, 0xe2, 0x01, 0x42, 0x3e, 0x37, 0x18, 0x3e, 0xec, 0x01, 0x51, 0x37, 0x18, 0x7a, 0x79, 0x77, 0xe2, 0x01, 0x50, 0x79, 0x05, 0x32, 0x35, 0x2c,
+  0xd2, 0x01, 0x50, 0x2c, 0x2d, 0x1e, 0x7e, 0x18, 0xc8, 0x05, 0x10, 0x35, 0x95, 0x05, 0x00, 0x03, 0x00, 0x20, 0x27, 0x27, 0xc7, 0x03, 0x11, 0x27,
+  0xdf, 0x01, 0x01, 0xdd, 0x01, 0xf1, 0x37, 0x27, 0x25, 0x1f, 0x9a, 0x74, 0x9a, 0x10, 0x82, 0x6b, 0x6b, 0x6b, 0x6a, 0x6b, 0x6a, 0x6a, 0x6f, 0x7a,
+  0x86, 0x9a, 0x0a, 0x0e, 0x14, 0x1f, 0x18, 0x1f, 0x25, 0x18, 0x0a, 0x98, 0x10, 0x9b, 0x85, 0x76, 0x63, 0x62, 0x66, 0x62, 0x6b, 0x6b, 0x6b, 0x70,
+  0x66, 0x63, 0x60, 0x6f, 0x77, 0x89, 0x91, 0x0b, 0x18, 0x1f, 0x0b, 0x13, 0x1f, 0x18, 0x18, 0x0b, 0x14, 0x91, 0x0c, 0x14, 0x0c, 0x6f, 0x76, 0x98,
+  0x92, 0x70, 0x66, 0x5d, 0x5d, 0xda, 0x01, 0x00, 0x02, 0x00, 0x60, 0x5d, 0x5d, 0x5c, 0x5d, 0x5c, 0x5d, 0x9d, 0x05, 0xf0, 0x0a, 0x65, 0x5d, 0x65,
+  0x63, 0x63, 0x65, 0x63, 0x6c, 0x85, 0x92, 0x94, 0x91, 0x91, 0x92, 0x7a, 0x72, 0x76, 0x7a, 0x82, 0x72, 0x77, 0x85, 0x89, 0x82, 0x76, 0x9a, 0x05,
+  0x01, 0xe1, 0x01, 0x02, 0xa4, 0x03, 0x01, 0xb5, 0x01, 0x05, 0xc8, 0x01, 0x08, 0x02, 0x00, 0x01, 0x05, 0x00, 0x05, 0x07, 0x00, 0x00, 0xd9, 0x01,
+  0x01, 0x01, 0x00, 0x60, 0x7a, 0x7b, 0x7c, 0x7a, 0x7b, 0x7d, 0xd5, 0x01, 0x30, 0x7b, 0x80, 0x7d, 0xd7, 0x01, 0x01, 0x9a, 0x05, 0x01, 0x05, 0x00,
+  0x01, 0xdf, 0x01, 0x01, 0xd5, 0x01, 0x06, 0xe4, 0x01, 0x04, 0x02, 0x00, 0x10, 0x89, 0x02, 0x00, 0x12, 0x89, 0xdb, 0x01, 0x04, 0xdd, 0x01, 0x01,
+  0xcf, 0x01, 0x04, 0x02, 0x00, 0x12, 0x8c, 0xd5, 0x01, 0x02, 0xd7, 0x01, 0x04, 0x02, 0x00, 0x00, 0x03, 0x00, 0x03, 0x01, 0x00, 0x00, 0xdd, 0x01,
+  0x01, 0xba, 0x03, 0x02, 0xb6, 0x03, 0x00, 0x01, 0x00, 0x10, 0x9a, 0xdd, 0x01, 0x30, 0x9a, 0x99, 0x04, 0xdc, 0x01, 0x01, 0xde, 0x01, 0x01, 0xd7,
+  0x01, 0x02, 0x02, 0x00, 0x52, 0x09, 0x05, 0x07, 0x05, 0x0a, 0xc1, 0x03, 0x11, 0x0a, 0x97, 0x05, 0x00, 0xdf, 0x01, 0x00, 0x01, 0x00, 0x00, 0xdb,
+  0x01, 0x02, 0x06, 0x00, 0x00, 0xb6, 0x03, 0x40, 0x0e, 0x0e, 0x0e, 0x11, 0x9c, 0x05, 0x00, 0xbe, 0x03, 0x00, 0xda, 0x01, 0x20, 0x0e, 0x18, 0xe1,
+  0x01, 0x26, 0x37, 0x3e, 0xe1, 0x01, 0x21, 0x3e, 0x41, 0xdf, 0x01, 0xf0, 0x02, 0x3e, 0x37, 0x14, 0x79, 0x7a, 0x7a, 0x7a, 0x7a, 0x77, 0x7a, 0x7a,
+  0x79, 0x91, 0x2c, 0x2c, 0x35, 0x35, 0x64, 0x09, 0x50, 0x2c, 0x25, 0x7e, 0x1e, 0x37, 0x6a, 0x0b, 0x00, 0xdc, 0x01, 0xa1, 0x35, 0x2d, 0x2d, 0x25,
+  0x2d, 0x2c, 0x2d, 0x35, 0x35, 0x2d, 0xdf, 0x01, 0x02, 0x01, 0x00, 0xa3, 0x1f, 0x25, 0x07, 0x79, 0x6f, 0x7b, 0x9d, 0x85, 0x6b, 0x6a, 0xe2, 0x01,
+  0x00, 0xc9, 0x03, 0xfb, 0x1d, 0x91, 0x11, 0x13, 0x1e, 0x13, 0x14, 0x83, 0x6a, 0x85, 0x8c, 0x98, 0x9d, 0x9b, 0x92, 0x98, 0x92, 0x8c, 0x78, 0x72,
+  0x92, 0x7b, 0x66, 0x7b, 0x8c, 0x6f, 0x72, 0x98, 0x0e, 0x1f, 0x18, 0x13, 0x1f, 0x18, 0x1f, 0x18, 0x13, 0x13, 0x9d, 0x89, 0x91, 0x9b, 0x98, 0x85,
+  0x76, 0xdf, 0x01, 0x00, 0x01, 0x00, 0x00, 0x5d, 0x09, 0x01, 0x9d, 0x05, 0xf0, 0x08, 0x65, 0x63, 0x65, 0x66, 0x76, 0x8c, 0x85, 0x74, 0x82, 0x89,
+  0x82, 0x76, 0x74, 0x85, 0x85, 0x7c, 0x77, 0x85, 0x85, 0x85, 0x74, 0x76, 0x70, 0x79, 0x07, 0x20, 0x76, 0x74, 0xb6, 0x03, 0x10, 0x7b, 0xdf, 0x01,
+  0x0f, 0x01, 0x00, 0x06, 0x00, 0xd6, 0x01, 0x09, 0x1f, 0x00, 0x00, 0x4c, 0x09, 0x02, 0xdb, 0x01, 0x02, 0xdc, 0x01, 0x01, 0xdd, 0x01, 0x12, 0x82,
+  0x07, 0x00, 0x20, 0x85, 0x82, 0xd2, 0x01, 0x00, 0x8e, 0x05, 0x06, 0xdc, 0x01, 0x00, 0xd3, 0x01, 0x02, 0x02, 0x00, 0x10, 0x89, 0xe1, 0x01, 0x06,
+  0xd9, 0x01, 0x02, 0x01, 0x00, 0x01, 0xd7, 0x01, 0x00, 0xd9, 0x01, 0x00, 0x02, 0x00, 0x01, 0xcf, 0x01, 0x02, 0xdd, 0x01, 0x06, 0x4a, 0x09, 0x00,
+  0x01, 0x00, 0x11, 0x94, 0x04, 0x00, 0x10, 0x94, 0x03, 0x00, 0x00, 0xdf, 0x01, 0x00, 0xb7, 0x03, 0x70, 0x94, 0x95, 0x9a, 0x99, 0x9a, 0x95, 0x9a,
+  0x06, 0x00, 0x20, 0x99, 0x04, 0x2d, 0x0b, 0x00, 0x95, 0x05, 0x40, 0x07, 0x05, 0x05, 0x04, 0xd9, 0x01, 0x02, 0x02, 0x00, 0x12, 0x0a, 0x02, 0x00,
+  0x23, 0x0b, 0x07, 0xb9, 0x03, 0x03, 0x01, 0x00, 0x01, 0xba, 0x03, 0x01, 0xdb, 0x01, 0x03, 0xde, 0x01, 0x00, 0xd8, 0x01, 0x01, 0x05, 0x00, 0x07,
+  0xbe, 0x03, 0x40, 0x14, 0x18, 0x3e, 0x37, 0xd2, 0x01, 0x00, 0x01, 0x00, 0x20, 0x41, 0x37, 0xdf, 0x01, 0x70, 0x41, 0x3e, 0x3e, 0x37, 0x37, 0x0c,
+  0x7e, 0xe0, 0x01, 0x00, 0x01, 0x00, 0x11, 0x8f, 0xe0, 0x01, 0x00, 0xa4, 0x05, 0x31, 0x25, 0x00, 0x25, 0xbf, 0x03, 0x01, 0x0d, 0x00, 0x00, 0x02,
+  0x00, 0x11, 0x35, 0xc5, 0x03, 0x60, 0x27, 0x27, 0x25, 0x27, 0x25, 0x1f, 0x05, 0x00, 0x30, 0x25, 0x94, 0x85, 0x7e, 0x0c, 0x35, 0x72, 0x6e, 0x6b,
+  0x01, 0x00, 0xf0, 0x0f, 0x6a, 0x6b, 0x6a, 0x85, 0x97, 0x13, 0x18, 0x14, 0x9a, 0x77, 0x6f, 0x6a, 0x74, 0x92, 0x91, 0x9b, 0x14, 0x14, 0x0c, 0x0c,
+  0x9b, 0x0a, 0x9b, 0x91, 0x9b, 0x0d, 0x85, 0x74, 0x8c, 0x13, 0xdc, 0x01, 0xf1, 0x00, 0x18, 0x07, 0x0c, 0x0e, 0x14, 0x9a, 0x66, 0x79, 0x91, 0x89,
+  0x6f, 0x69, 0x69, 0x82, 0x63, 0xdb, 0x01, 0x03, 0xdd, 0x01, 0x00, 0xbf, 0x03, 0x06, 0xbe, 0x03, 0xf0, 0x02, 0x65, 0x69, 0x65, 0x66, 0x6e, 0x82,
+  0x7b, 0x73, 0x7b, 0x7b, 0x73, 0x76, 0x82, 0x77, 0x80, 0x85, 0x89, 0x84, 0x07, 0x15, 0x76, 0xbe, 0x03, 0x0f, 0x01, 0x00, 0x0d, 0x03, 0x22, 0x00,
+  0x00, 0x8c, 0x05, 0x03, 0x01, 0x00, 0x01, 0xb6, 0x03, 0x01, 0x8f, 0x05, 0x00, 0x77, 0x07, 0x00, 0x02, 0x00, 0x03, 0xb6, 0x03, 0x00, 0xd7, 0x01,
+  0x02, 0xd9, 0x01, 0x04, 0xdc, 0x01, 0x00, 0xd7, 0x01, 0x00, 0x02, 0x00, 0x00, 0xd6, 0x01, 0x00, 0xba, 0x03, 0x05, 0xdc, 0x01, 0x02, 0x09, 0x00,
+  0x00, 0xdb, 0x01, 0x10, 0x91, 0xdd, 0x01, 0x03, 0xd7, 0x01, 0x00, 0xd4, 0x01, 0x02, 0x02, 0x00, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x10, 0x94,
+  0x03, 0x00, 0x00, 0xdc, 0x01, 0x02, 0x01, 0x00, 0x02, 0xb6, 0x03, 0x01, 0x02, 0x00, 0x05, 0xbb, 0x03, 0x40, 0x04, 0x04, 0x05, 0x9a, 0xde, 0x01,
+  0x01, 0xd8, 0x01, 0x01, 0x02, 0x00, 0x00, 0xdb, 0x01, 0x70, 0x09, 0x07, 0x09, 0x07, 0x07, 0x09, 0x0a, 0xde, 0x01, 0x00, 0xc0, 0x03, 0x00, 0x9a,
+  0x05, 0x02, 0xdb, 0x01, 0x04, 0xde, 0x01, 0x00, 0x01, 0x00, 0x00, 0xe2, 0x01, 0x03, 0xdc, 0x01, 0x01, 0x7c, 0x07, 0x01, 0xbd, 0x03, 0x80, 0x13,
+  0x18, 0x0e, 0x37, 0x37, 0x37, 0x3e, 0x35, 0xd6, 0x01, 0x01, 0xc6, 0x03, 0x10, 0x41, 0xe1, 0x01, 0x32, 0x41, 0x37, 0x11, 0xc0, 0x03, 0x51, 0x79,
+  0x7a, 0x79, 0x87, 0x25, 0xe1, 0x01, 0x71, 0x2c, 0x2d, 0x2c, 0x2c, 0x8f, 0x25, 0x3e, 0xde, 0x01, 0x60, 0x35, 0x2d, 0x35, 0x2c, 0x35, 0x2d, 0x0a,
+  0x00, 0x22, 0x2d, 0x2c, 0x9f, 0x05, 0x00, 0x01, 0x00, 0xc1, 0x25, 0x25, 0x9a, 0x73, 0x98, 0x85, 0x76, 0x6f, 0x6f, 0x6f, 0x6b, 0x70, 0x02, 0x00,
+  0x40, 0x6b, 0x69, 0x6b, 0x69, 0xe1, 0x01, 0xf0, 0x1e, 0x72, 0x14, 0x1e, 0x0e, 0x0a, 0x9a, 0x79, 0x6f, 0x73, 0x74, 0x7e, 0x91, 0x18, 0x18, 0x0b,
+  0x0a, 0x0c, 0x18, 0x18, 0x14, 0x14, 0x0d, 0x91, 0x85, 0x9d, 0x18, 0x13, 0x1f, 0x1f, 0x1e, 0x0a, 0x6a, 0x82, 0x91, 0x98, 0x0a, 0x6c, 0x8a, 0x9a,
+  0x9a, 0x82, 0x66, 0x5d, 0x84, 0x69, 0xd8, 0x01, 0x01, 0xc5, 0x03, 0x01, 0x01, 0x00, 0x00, 0xaa, 0x07, 0x01, 0xdc, 0x01, 0x02, 0x02, 0x00, 0x90,
+  0x69, 0x66, 0x69, 0x71, 0x7b, 0x82, 0x7b, 0x6f, 0x76, 0x72, 0x01, 0x40, 0x8c, 0x80, 0x82, 0x74, 0xdf, 0x01, 0x20, 0x76, 0x7b, 0x02, 0x00, 0x03,
+  0xbf, 0x01, 0x0f, 0x01, 0x00, 0x10, 0x01, 0xd5, 0x01, 0x04, 0x02, 0x00, 0x11, 0x82, 0x06, 0x00, 0x01, 0xdd, 0x01, 0x00, 0x02, 0x00, 0x01, 0xdf,
+  0x01, 0x03, 0xbd, 0x03, 0x02, 0xdb, 0x01, 0x02, 0xb9, 0x03, 0x00, 0xd8, 0x01, 0x02, 0xcb, 0x01, 0x0e, 0x01, 0x00, 0x08, 0xb6, 0x03, 0x00, 0x93,
+  0x05, 0x0a, 0xd4, 0x01, 0x05, 0x01, 0x00, 0x02, 0xda, 0x01, 0x02, 0xdd, 0x01, 0x00, 0xb7, 0x03, 0x10, 0x9a, 0x9c, 0x05, 0x11, 0x97, 0xd9, 0x01,
+  0x02, 0x50, 0x09, 0x00, 0xba, 0x03, 0x10, 0x04, 0xd9, 0x01, 0x01, 0x05, 0x00, 0x00, 0x02, 0x00, 0x00, 0xdb, 0x01, 0x62, 0x0a, 0x05, 0x0a, 0x09,
+  0x09, 0x0a, 0x02, 0x00, 0x30, 0x0b, 0x0a, 0x09, 0xd6, 0x01, 0x00, 0x02, 0x00, 0x07, 0x01, 0x00, 0x01, 0xb4, 0x03, 0x22, 0x11, 0x13, 0x04, 0x00,
+  0x40, 0x0e, 0x0e, 0x14, 0x14, 0xd7, 0x01, 0x43, 0x14, 0x13, 0x18, 0x14, 0x02, 0x00, 0x50, 0x37, 0x37, 0x37, 0x35, 0x37, 0x64, 0x09, 0x01, 0xdc,
+  0x01, 0x01, 0x05, 0x00, 0x50, 0x3e, 0x37, 0x11, 0x7f, 0x7a, 0x02, 0x00, 0x60, 0x7a, 0x7a, 0x7a, 0x83, 0x25, 0x2c, 0xdd, 0x01, 0x00, 0x02, 0x00,
+  0x30, 0x99, 0x35, 0x37, 0xe0, 0x01, 0x01, 0xdb, 0x01, 0x01, 0x01, 0x00, 0x00, 0x65, 0x09, 0x00, 0xbf, 0x03, 0x11, 0x2c, 0xbe, 0x03, 0x92, 0x0a,
+  0x74, 0x72, 0x85, 0x98, 0x72, 0x6f, 0x6f, 0x6b, 0x02, 0x00, 0x00, 0xe2, 0x01, 0x00, 0xe4, 0x01, 0xf4, 0x1d, 0x6e, 0x72, 0x0d, 0x0a, 0x0d, 0x0c,
+  0x14, 0x14, 0x9d, 0x91, 0x17, 0x1e, 0x18, 0x94, 0x18, 0x14, 0x0c, 0x0e, 0x9a, 0x0b, 0x18, 0x13, 0x9a, 0x7a, 0x66, 0x91, 0x18, 0x1f, 0x18, 0x1f,
+  0x1e, 0x89, 0x66, 0x6a, 0x77, 0x0c, 0x0d, 0x99, 0x0c, 0x0a, 0x0d, 0x0d, 0x70, 0x69, 0xdf, 0x01, 0x01, 0x01, 0x00, 0x10, 0x5c, 0xdd, 0x01, 0x01,
+  0xbe, 0x03, 0x01, 0x02, 0x00, 0x10, 0x69, 0x02, 0x00, 0xe0, 0x6a, 0x70, 0x8c, 0x8c, 0x76, 0x6e, 0x7b, 0x85, 0x89, 0x89, 0x91, 0x85, 0x85, 0x7b,
+  0xde, 0x01, 0x00, 0x11, 0x0b, 0x10, 0x76, 0xb8, 0x01, 0x01, 0x01, 0x00, 0x12, 0x7d, 0x73, 0x05, 0x0f, 0x02, 0x00, 0x13, 0x01, 0xd3, 0x01, 0x06,
+  0x02, 0x00, 0x01, 0xdd, 0x01, 0x07, 0x01, 0x00, 0x01, 0xb2, 0x03, 0x04, 0x02, 0x00, 0x0f, 0x01, 0x00, 0x03, 0x00, 0xd8, 0x01, 0x10, 0x91, 0xdc,
+  0x01, 0x11, 0x8c, 0xd7, 0x01, 0x01, 0xd9, 0x01, 0x00, 0x0b, 0x00, 0x06, 0x01, 0x00, 0x00, 0x92, 0x05, 0x00, 0xda, 0x01, 0x00, 0x02, 0x00, 0x71,
+  0x94, 0x94, 0x91, 0x95, 0x91, 0x95, 0x97, 0x02, 0x00, 0x13, 0x9a, 0xbe, 0x03, 0x80, 0x99, 0x9a, 0x04, 0x9a, 0x9a, 0x9a, 0x04, 0x9a, 0x71, 0x07,
+  0x00, 0xe4, 0x01, 0x00, 0xd8, 0x01, 0x04, 0x02, 0x00, 0x00, 0xdc, 0x01, 0x43, 0x0a, 0x05, 0x0a, 0x08, 0xdd, 0x01, 0x22, 0x0b, 0x0a, 0xb9, 0x03,
+  0x00, 0x04, 0x00, 0x00, 0xd9, 0x01, 0x00, 0x01, 0x00, 0x00, 0xd2, 0x01, 0x00, 0x01, 0x00, 0x10, 0x13, 0x71, 0x07, 0x00, 0x04, 0x00, 0x01, 0x02,
+  0x00, 0x10, 0x18, 0x98, 0x05, 0x00, 0x06, 0x00, 0x51, 0x18, 0x14, 0x18, 0x18, 0x20, 0xe1, 0x01, 0x10, 0x37, 0xb7, 0x03, 0x01, 0xdf, 0x01, 0x00,
+  0x8a, 0x07, 0x31, 0x37, 0x0c, 0x7e, 0xdd, 0x01, 0xf2, 0x03, 0x7a, 0x7a, 0x7f, 0x7f, 0x29, 0x2c, 0x2c, 0x2d, 0x2c, 0x35, 0x2c, 0x35, 0x2c, 0x2c,
+  0x18, 0x37, 0x3e, 0x3b, 0xe2, 0x01, 0x10, 0x35, 0x49, 0x0b, 0x00, 0xc9, 0x03, 0x01, 0xc1, 0x03, 0x00, 0x02, 0x00, 0x40, 0x25, 0x25, 0x0c, 0x79,
+  0x46, 0x12, 0x51, 0x6f, 0x6f, 0x6f, 0x6f, 0x70, 0xc2, 0x03, 0x01, 0xe2, 0x01, 0x90, 0x70, 0x6b, 0x6b, 0x6f, 0x6b, 0x85, 0x92, 0x8c, 0x91, 0x4c,
+  0x0b, 0xf9, 0x11, 0x25, 0x25, 0x25, 0x0b, 0x0c, 0x9a, 0x9d, 0x91, 0x05, 0x18, 0x18, 0x14, 0x05, 0x73, 0x7f, 0x9b, 0x13, 0x18, 0x1f, 0x1e, 0x17,
+  0x74, 0x76, 0x6a, 0x85, 0x0c, 0x18, 0x18, 0x13, 0x14, 0x0d, 0x92, 0xde, 0x01, 0x03, 0xbd, 0x03, 0x00, 0x33, 0x0f, 0x02, 0xc2, 0x03, 0xb0, 0x69,
+  0x63, 0x69, 0x69, 0x69, 0x69, 0x70, 0x76, 0x76, 0x72, 0x70, 0x63, 0x03, 0x5a, 0x8d, 0x8c, 0x89, 0x7b, 0x74, 0xde, 0x01, 0x01, 0xb5, 0x01, 0x23,
+  0x7b, 0x82, 0x02, 0x00, 0x21, 0x7b, 0x82, 0x0d, 0x00, 0x02, 0x04, 0x00, 0x00, 0x06, 0x00, 0x00, 0x08, 0x00, 0x30, 0x82, 0x7b, 0x80, 0x07, 0x00,
+  0x01, 0xd0, 0x01, 0x02, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0x00, 0x25, 0x85, 0x82, 0xb8, 0x03, 0x01, 0x01, 0x00, 0x11, 0x89, 0x04, 0x00,
+  0x0f, 0xda, 0x01, 0x02, 0x03, 0x8d, 0x05, 0x20, 0x89, 0x91, 0xd9, 0x01, 0x00, 0x0d, 0x00, 0x01, 0x02, 0x00, 0x01, 0xdf, 0x01, 0x09, 0xdd, 0x01,
+  0x01, 0xd5, 0x01, 0x03, 0x02, 0x00, 0x10, 0x97, 0xdf, 0x01, 0x00, 0x01, 0x00, 0x02, 0xd8, 0x01, 0x00, 0xdb, 0x01, 0x00, 0xdd, 0x01, 0x11, 0x99,
+  0xdd, 0x01, 0x60, 0x05, 0x9a, 0x9a, 0x07, 0x05, 0x9a, 0xd3, 0x01, 0x02, 0x2d, 0x0b, 0x01, 0xb7, 0x03, 0x00, 0xdd, 0x01, 0x03, 0x02, 0x00, 0x11,
+  0x0b, 0xdd, 0x01, 0xa1, 0x0a, 0x0b, 0x0c, 0x0e, 0x0a, 0x0e, 0x0b, 0x0a, 0x0e, 0x0c, 0x02, 0x00, 0x00, 0x01, 0x00, 0x10, 0x11, 0xe2, 0x01, 0x10,
+  0x14, 0x73, 0x07, 0x01, 0xbf, 0x03, 0x03, 0x02, 0x00, 0x00, 0xdb, 0x01, 0x13, 0x18, 0x03, 0x00, 0x40, 0x18, 0x18, 0x0a, 0x37, 0xe1, 0x01, 0x40,
+  0x3e, 0x41, 0x41, 0x3e, 0x7f, 0x07, 0x00, 0x01, 0x00, 0x50, 0x3e, 0x37, 0x37, 0x14, 0x7f, 0x01, 0x00, 0x00, 0xc2, 0x03, 0x40, 0x7e, 0x25, 0x37,
+  0x2c, 0xdf, 0x01, 0x00, 0x03, 0x00, 0x61, 0x3e, 0x3b, 0x37, 0x3b, 0x35, 0x3e, 0xdc, 0x01, 0x00, 0x89, 0x07, 0x01, 0xbf, 0x03, 0x00, 0xda, 0x03,
+  0x00, 0xbe, 0x03, 0x30, 0x18, 0x83, 0x73, 0xe0, 0x01, 0x04, 0xe2, 0x01, 0x00, 0xa6, 0x05, 0x40, 0x6f, 0x6f, 0x70, 0x6b, 0xed, 0x01, 0x50, 0x6f,
+  0x6a, 0x6f, 0x6f, 0x8f, 0x2c, 0x0d, 0xf0, 0x10, 0x25, 0x25, 0x18, 0x89, 0x6f, 0x74, 0x7f, 0x94, 0x1e, 0x13, 0x0e, 0x0d, 0x95, 0x0c, 0x0c, 0x13,
+  0x1e, 0x1f, 0x18, 0x91, 0x74, 0x82, 0x8c, 0x9a, 0x0b, 0x0c, 0x13, 0x11, 0x9d, 0x8c, 0x66, 0xf9, 0x10, 0x05, 0x01, 0x00, 0x10, 0x63, 0x5c, 0x09,
+  0x00, 0xe1, 0x01, 0x00, 0xdc, 0x01, 0x40, 0x65, 0x63, 0x69, 0x65, 0xde, 0x01, 0xe1, 0x69, 0x69, 0x6a, 0x70, 0x70, 0x70, 0x72, 0x7b, 0x82, 0x7b,
+  0x8c, 0x8c, 0x89, 0x82, 0xcd, 0x0e, 0x04, 0x01, 0x00, 0x00, 0xc0, 0x01, 0x02, 0x02, 0x00, 0x00, 0xce, 0x01, 0x00, 0xc3, 0x01, 0x26, 0x7a, 0x82,
+  0x04, 0x00, 0x01, 0x67, 0x07, 0x00, 0xcb, 0x01, 0x0b, 0x02, 0x00, 0x00, 0xb4, 0x03, 0x11, 0x82, 0x94, 0x05, 0x06, 0xde, 0x01, 0x00, 0x95, 0x05,
+  0x01, 0xda, 0x01, 0x0f, 0xdc, 0x01, 0x01, 0x00, 0xd9, 0x01, 0x40, 0x8c, 0x8d, 0x89, 0x89, 0x06, 0x00, 0x01, 0xb7, 0x03, 0x13, 0x8c, 0x02, 0x00,
+  0x0a, 0x01, 0x00, 0x00, 0xd3, 0x01, 0x06, 0x02, 0x00, 0x51, 0x97, 0x94, 0x94, 0x94, 0x97, 0x02, 0x00, 0x50, 0x9a, 0x94, 0x9a, 0x95, 0x97, 0xde,
+  0x01, 0x02, 0xdf, 0x01, 0x22, 0x9a, 0x04, 0x05, 0x00, 0x90, 0x04, 0x9a, 0x05, 0x9b, 0x05, 0x07, 0x9a, 0x05, 0x07, 0xde, 0x01, 0x00, 0x05, 0x00,
+  0x21, 0x07, 0x0a, 0x71, 0x07, 0x01, 0x02, 0x00, 0x01, 0xdb, 0x01, 0x00, 0x02, 0x00, 0x41, 0x0c, 0x0b, 0x0c, 0x0b, 0xd9, 0x01, 0x01, 0xbf, 0x03,
+  0x13, 0x11, 0xde, 0x01, 0x00, 0x02, 0x00, 0x01, 0xd7, 0x01, 0x01, 0x02, 0x00, 0x01, 0xbb, 0x03, 0x02, 0x01, 0x00, 0x03, 0x08, 0x00, 0x20, 0x02,
+  0x2c, 0x82, 0x07, 0x40, 0x37, 0x3e, 0x3e, 0x3f, 0x61, 0x09, 0x00, 0xdf, 0x01, 0x70, 0x3f, 0x3e, 0x32, 0x1e, 0x7e, 0x7f, 0x7a, 0xe1, 0x01, 0x31,
+  0x7a, 0x7f, 0x83, 0xde, 0x01, 0x02, 0x02, 0x00, 0x00, 0x1d, 0x0f, 0x31, 0x37, 0x35, 0x37, 0xc5, 0x03, 0x10, 0x2d, 0x3b, 0x0b, 0x11, 0x2c, 0xdf,
+  0x01, 0x80, 0x2c, 0x27, 0x2c, 0x25, 0x1e, 0x8d, 0x74, 0x74, 0xde, 0x01, 0x20, 0x72, 0x6f, 0x02, 0x00, 0x00, 0xe3, 0x01, 0x01, 0x06, 0x00, 0x00,
+  0xea, 0x01, 0xf0, 0x20, 0x6e, 0x6f, 0x6f, 0x6f, 0x6e, 0x7a, 0x0c, 0x14, 0x18, 0x1e, 0x1f, 0x25, 0x1e, 0x14, 0x86, 0x86, 0x9a, 0x18, 0x25, 0x18,
+  0x0e, 0x0b, 0x18, 0x18, 0x0a, 0x13, 0x1e, 0x18, 0x07, 0x97, 0x79, 0x8c, 0x9a, 0x0a, 0x18, 0x9a, 0x92, 0x7b, 0x6f, 0x66, 0x63, 0x69, 0x65, 0x5d,
+  0x63, 0x5d, 0x69, 0xda, 0x01, 0x00, 0xd8, 0x01, 0x10, 0x63, 0x9c, 0x05, 0x00, 0xbd, 0x03, 0x01, 0xc0, 0x03, 0x02, 0xbe, 0x03, 0xb0, 0x69, 0x70,
+  0x69, 0x70, 0x70, 0x76, 0x82, 0x85, 0x72, 0x82, 0x89, 0x98, 0x01, 0x11, 0x7b, 0x7d, 0x07, 0x06, 0xdd, 0x01, 0x13, 0x80, 0x04, 0x00, 0x10, 0x7b,
+  0x92, 0x03, 0x03, 0x02, 0x00, 0x01, 0x05, 0x00, 0x01, 0x02, 0x00, 0x07, 0x15, 0x00, 0x04, 0x02, 0x00, 0x10, 0x85, 0x03, 0x00, 0x01, 0x02, 0x00,
+  0x02, 0x05, 0x00, 0x01, 0xb4, 0x03, 0x00, 0xd9, 0x01, 0x04, 0x02, 0x00, 0x08, 0x01, 0x00, 0x00, 0x46, 0x09, 0x13, 0x8d, 0xe1, 0x01, 0x01, 0x96,
+  0x05, 0x01, 0xd8, 0x01, 0x00, 0x02, 0x00, 0x07, 0x01, 0x00, 0x10, 0x92, 0xaa, 0x03, 0x00, 0x02, 0x00, 0x10, 0x92, 0x02, 0x00, 0x12, 0x95, 0x04,
+  0x00, 0x64, 0x97, 0x94, 0x97, 0x97, 0x95, 0x91, 0x93, 0x05, 0x20, 0x95, 0x9a, 0x03, 0x00, 0x00, 0x01, 0x00, 0x50, 0x05, 0x9a, 0x04, 0x9a, 0x07,
+  0x96, 0x05, 0x04, 0x98, 0x05, 0x41, 0x0a, 0x05, 0x07, 0x07, 0x52, 0x09, 0x23, 0x0a, 0x0a, 0xdf, 0x01, 0x05, 0xd9, 0x01, 0x02, 0x02, 0x00, 0x01,
+  0xba, 0x03, 0x12, 0x0c, 0xdc, 0x01, 0x00, 0xb4, 0x03, 0x03, 0x04, 0x00, 0x05, 0xe3, 0x01, 0x00, 0x3c, 0x14, 0x01, 0x41, 0x14, 0x00, 0x01, 0x00,
+  0x02, 0xe1, 0x01, 0x50, 0x00, 0x14, 0x37, 0x37, 0x41, 0xe1, 0x01, 0x51, 0x37, 0x3e, 0x37, 0x41, 0x3f, 0xe1, 0x01, 0x50, 0x37, 0x37, 0x29, 0x83,
+  0x81, 0xc1, 0x03, 0x73, 0x7f, 0x7f, 0x7f, 0x86, 0x2c, 0x37, 0x2c, 0xe3, 0x01, 0x23, 0x37, 0x3b, 0x02, 0x00, 0x00, 0xa1, 0x05, 0x04, 0x45, 0x0b,
+  0x92, 0x2c, 0x35, 0x25, 0x2c, 0x25, 0x25, 0x25, 0x97, 0x79, 0xbc, 0x17, 0x00, 0x01, 0x00, 0x11, 0x6f, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0xc8,
+  0x03, 0x10, 0x70, 0xc3, 0x03, 0xf0, 0x00, 0x72, 0x8c, 0x97, 0x9a, 0x18, 0x1f, 0x18, 0x0e, 0x17, 0x11, 0x9b, 0x14, 0x14, 0x18, 0x25, 0xc5, 0x14,
+  0xf1, 0x09, 0x0a, 0x18, 0x18, 0x18, 0x0b, 0x8d, 0x0a, 0x0c, 0x0a, 0x18, 0x18, 0x11, 0x91, 0x82, 0x92, 0x70, 0x63, 0x66, 0x76, 0x82, 0x84, 0x63,
+  0x69, 0x76, 0xff, 0x10, 0x40, 0x63, 0x5d, 0x70, 0x65, 0xd9, 0x01, 0x01, 0xdc, 0x01, 0x25, 0x65, 0x69, 0xbf, 0x03, 0x10, 0x69, 0xbf, 0x03, 0xa2,
+  0x82, 0x85, 0x72, 0x7b, 0x82, 0x82, 0x74, 0x82, 0x8c, 0x7b, 0xde, 0x01, 0x00, 0x8d, 0x05, 0x00, 0xd5, 0x01, 0x20, 0x80, 0x7b, 0xf6, 0x10, 0x10,
+  0x82, 0x01, 0x00, 0x01, 0xbe, 0x01, 0x0f, 0x02, 0x00, 0x04, 0x10, 0x82, 0x8d, 0x05, 0x03, 0x02, 0x00, 0x02, 0xdf, 0x01, 0x06, 0x01, 0x00, 0x00,
+  0xde, 0x01, 0x01, 0xd7, 0x01, 0x00, 0x04, 0x00, 0x03, 0x01, 0x00, 0x11, 0x8c, 0x03, 0x00, 0x00, 0xd5, 0x01, 0x00, 0xb6, 0x03, 0x01, 0x8c, 0x05,
+  0x11, 0x89, 0xd7, 0x01, 0x06, 0xd9, 0x01, 0x11, 0x92, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x67, 0x07, 0x10, 0x91, 0xd5, 0x01, 0x25, 0x95, 0x92,
+  0xb5, 0x03, 0x62, 0x97, 0x94, 0x97, 0x95, 0x94, 0x97, 0xd5, 0x01, 0x04, 0xdf, 0x01, 0x00, 0x14, 0x0d, 0x01, 0xb8, 0x03, 0x03, 0xdb, 0x01, 0x20,
+  0x9a, 0x07, 0xb7, 0x03, 0x00, 0xbc, 0x03, 0x60, 0x0a, 0x07, 0x0a, 0x07, 0x0a, 0x0a, 0x07, 0x00, 0x20, 0x09, 0x0a, 0xdd, 0x01, 0x00, 0xdf, 0x01,
+  0x00, 0x9b, 0x05, 0x00, 0xb9, 0x03, 0x12, 0x0c, 0xb7, 0x03, 0x25, 0x11, 0x0b, 0xd7, 0x01, 0x02, 0x02, 0x00, 0x74, 0x14, 0x13, 0x14, 0x14, 0x14,
+  0x18, 0x14, 0x93, 0x05, 0x09, 0x01, 0x00, 0x20, 0x88, 0x9a, 0xc0, 0x03, 0x40, 0x3f, 0x3e, 0x3f, 0x41, 0xe7, 0x01, 0xb0, 0x3f, 0x41, 0x41, 0x3f,
+  0x3e, 0x3f, 0x37, 0x32, 0x02, 0x83, 0x7f, 0x02, 0x00, 0x50, 0x7f, 0x7f, 0x87, 0x32, 0x37, 0xdc, 0x01, 0x00, 0x80, 0x07, 0x20, 0x35, 0x3e, 0x04,
+  0x02, 0x20, 0x3e, 0x35, 0x90, 0x09, 0x01, 0xb6, 0x03, 0x00, 0x69, 0x09, 0x90, 0x2c, 0x2c, 0x2c, 0x27, 0x25, 0x1e, 0x07, 0x79, 0x77, 0x8b, 0x19,
+  0x20, 0x72, 0x77, 0xe0, 0x01, 0x0a, 0x01, 0x00, 0x02, 0xc6, 0x03, 0xe0, 0x85, 0x80, 0x07, 0x1e, 0x25, 0x14, 0x86, 0x8c, 0x9d, 0x9a, 0x11, 0x1e,
+  0x18, 0x25, 0xe1, 0x01, 0xf1, 0x08, 0x0b, 0x18, 0x25, 0x18, 0x9a, 0x94, 0x04, 0x18, 0x1e, 0x14, 0x14, 0x92, 0x79, 0x69, 0x85, 0x76, 0x76, 0x82,
+  0x9b, 0x7b, 0x85, 0x6a, 0x70, 0xdf, 0x01, 0x60, 0x76, 0x62, 0x65, 0x70, 0x8c, 0x69, 0xde, 0x01, 0x02, 0xbb, 0x03, 0x06, 0xde, 0x01, 0x00, 0xc0,
+  0x03, 0x51, 0x85, 0x85, 0x76, 0x76, 0x77, 0x31, 0x07, 0x00, 0xd9, 0x01, 0x00, 0xdb, 0x01, 0x02, 0xd5, 0x01, 0x0a, 0x01, 0x00, 0x00, 0xcb, 0x01,
+  0x0e, 0x02, 0x00, 0x04, 0xd3, 0x01, 0x00, 0x02, 0x00, 0x08, 0x4e, 0x09, 0x01, 0xae, 0x03, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x09, 0x01, 0x00,
+  0x01, 0xcf, 0x01, 0x11, 0x89, 0xb0, 0x03, 0x00, 0xd7, 0x01, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x07, 0x01, 0x00, 0x00, 0xde, 0x01, 0x01, 0x07,
+  0x00, 0x00, 0xda, 0x01, 0x80, 0x94, 0x92, 0x94, 0x97, 0x91, 0x94, 0x97, 0x91, 0xb4, 0x03, 0x00, 0xd9, 0x01, 0x40, 0x97, 0x95, 0x97, 0x9a, 0x06,
+  0x00, 0x01, 0xda, 0x01, 0x00, 0xe3, 0x01, 0x00, 0x04, 0x00, 0x01, 0x01, 0x00, 0x30, 0x05, 0x9a, 0x07, 0x02, 0x00, 0x02, 0xd9, 0x01, 0x15, 0x0a,
+  0xda, 0x01, 0x00, 0x01, 0x00, 0x03, 0x07, 0x00, 0x00, 0xb2, 0x03, 0x03, 0x02, 0x00, 0x01, 0xb7, 0x03, 0x02, 0xdf, 0x01, 0x10, 0x0b, 0xdb, 0x01,
+  0x00, 0x04, 0x00, 0x12, 0x14, 0x7a, 0x07, 0x01, 0xdb, 0x01, 0x00, 0x9a, 0x05, 0x00, 0x2e, 0x0b, 0x0e, 0xe2, 0x01, 0xb3, 0x8d, 0x95, 0x37, 0x37,
+  0x3f, 0x3e, 0x37, 0x3e, 0x3f, 0x37, 0x3f, 0xc2, 0x03, 0x52, 0x3f, 0x3e, 0x3f, 0x32, 0x9b, 0xde, 0x01, 0x52, 0x83, 0x83, 0x02, 0x32, 0x37, 0xc1,
+  0x03, 0x20, 0x2c, 0x2c, 0x9e, 0x16, 0x03, 0xe1, 0x01, 0x01, 0x10, 0x00, 0x10, 0x2c, 0xea, 0x01, 0x70, 0x2c, 0x2c, 0x2c, 0x25, 0x25, 0x0c, 0x7f,
+  0xaf, 0x16, 0x00, 0xb1, 0x16, 0x30, 0x76, 0x74, 0x77, 0x53, 0x12, 0x06, 0x01, 0x00, 0x11, 0x6f, 0x46, 0x14, 0xf0, 0x04, 0x6f, 0x7b, 0x8c, 0x89,
+  0x0a, 0x25, 0x0c, 0x73, 0x89, 0x89, 0x86, 0x0d, 0x18, 0x1e, 0x1e, 0x1f, 0x1e, 0x1f, 0x25, 0x45, 0x04, 0xf0, 0x05, 0x0e, 0x17, 0x18, 0x1e, 0x14,
+  0x83, 0x9a, 0x98, 0x92, 0x6e, 0x69, 0x66, 0x92, 0x10, 0x0d, 0x98, 0x9d, 0x7b, 0x85, 0x66, 0x6e, 0x07, 0x61, 0x82, 0x90, 0x6b, 0x70, 0x96, 0x76,
+  0xde, 0x01, 0x00, 0xdf, 0x01, 0x02, 0x9c, 0x05, 0x02, 0x9e, 0x05, 0xc2, 0x6e, 0x76, 0x82, 0x8c, 0x85, 0x82, 0x7b, 0x82, 0x85, 0x8c, 0x85, 0x85,
+  0xe0, 0x01, 0x00, 0xb3, 0x03, 0x0b, 0xe1, 0x01, 0x02, 0x54, 0x07, 0x12, 0x82, 0x7f, 0x05, 0x10, 0x80, 0xcc, 0x01, 0x02, 0x02, 0x00, 0x01, 0x05,
+  0x00, 0x03, 0x07, 0x00, 0x0b, 0x01, 0x00, 0x02, 0xdd, 0x01, 0x08, 0xdf, 0x01, 0x11, 0x8c, 0x02, 0x00, 0x01, 0xdd, 0x01, 0x01, 0x51, 0x09, 0x05,
+  0xdb, 0x01, 0x01, 0xdd, 0x01, 0x00, 0x07, 0x00, 0x90, 0x8f, 0x91, 0x91, 0x91, 0x8f, 0x91, 0x8f, 0x91, 0x94, 0xbb, 0x03, 0x02, 0xdb, 0x01, 0x00,
+  0x43, 0x09, 0x00, 0xb1, 0x03, 0x12, 0x94, 0xdd, 0x01, 0x40, 0x9a, 0x97, 0x97, 0x97, 0xcc, 0x01, 0x09, 0x01, 0x00, 0x02, 0xb8, 0x03, 0x10, 0x07,
+  0x70, 0x07, 0x02, 0x02, 0x00, 0x10, 0x0a, 0x96, 0x05, 0x00, 0x06, 0x00, 0x00, 0xd5, 0x01, 0x08, 0x01, 0x00, 0x30, 0x0c, 0x0b, 0x0c, 0x04, 0x00,
+  0x02, 0xdb, 0x01, 0x00, 0x01, 0x00, 0x00, 0xbe, 0x03, 0x01, 0xd5, 0x01, 0x00, 0x02, 0x00, 0x30, 0x14, 0x0e, 0x11, 0xdd, 0x01, 0x00, 0xbc, 0x03,
+  0x02, 0xdc, 0x01, 0x01, 0x03, 0x00, 0x01, 0x05, 0x00, 0xb0, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1e, 0x18, 0x18, 0x18, 0xc0, 0x9a, 0x32,
+  0x37, 0x37, 0x37, 0x3e, 0x3f, 0x3e, 0x37, 0x3e, 0x37, 0x3f, 0x02, 0x00, 0xf1, 0x05, 0x41, 0x3f, 0x41, 0x3f, 0x3f, 0x37, 0x0d, 0x00, 0x83, 0x83,
+  0x83, 0x83, 0x7f, 0x83, 0x7f, 0x91, 0x32, 0x37, 0x2c, 0x35, 0x02, 0x00, 0x30, 0x2c, 0x35, 0x37, 0x25, 0x00, 0x80, 0x3e, 0x3e, 0x37, 0x35, 0x35,
+  0x2c, 0x2c, 0x25, 0x10, 0x00, 0xf0, 0x01, 0x3b, 0x2c, 0x35, 0x2c, 0x25, 0x2c, 0x1e, 0x18, 0x81, 0x7a, 0x7a, 0x77, 0x77, 0x77, 0x77, 0x74, 0x03,
+  0x00, 0x10, 0x74, 0x01, 0x00, 0x10, 0x76, 0x02, 0x00, 0x62, 0x72, 0x76, 0x72, 0x72, 0x74, 0x72, 0x01, 0x00, 0xf0, 0x2a, 0x74, 0x80, 0x80, 0x0a,
+  0x1e, 0x25, 0x83, 0x9d, 0x80, 0x73, 0x85, 0x89, 0x98, 0x1e, 0x14, 0x0b, 0x1e, 0x25, 0x18, 0x18, 0x1f, 0x1e, 0x18, 0x18, 0x18, 0x14, 0x9b, 0x6e,
+  0x8b, 0x89, 0x9d, 0x7b, 0x6a, 0x66, 0x6f, 0x9d, 0x17, 0x18, 0x17, 0x11, 0x10, 0x8c, 0x70, 0x69, 0x69, 0x69, 0x76, 0x82, 0x76, 0x7b, 0x76, 0x69,
+  0x65, 0x63, 0x65, 0x63, 0x69, 0x03, 0x00, 0x10, 0x69, 0x01, 0x00, 0x10, 0x70, 0x02, 0x00, 0xf0, 0x05, 0x70, 0x70, 0x70, 0x76, 0x7b, 0x82, 0x8c,
+  0x85, 0x82, 0x8c, 0x8c, 0x85, 0x82, 0x85, 0x7b, 0x82, 0x7b, 0x7b, 0x7b, 0x82, 0x02, 0x00, 0x03, 0x01, 0x00, 0x32, 0x85, 0x82, 0x85, 0x05, 0x00,
+  0x01, 0x02, 0x00, 0x21, 0x85, 0x85, 0x07, 0x00, 0x02, 0x02, 0x00, 0x00, 0x03, 0x00, 0x0f, 0x01, 0x00, 0x03, 0x12, 0x89, 0x02, 0x00, 0x01, 0x01,
+  0x00, 0x30, 0x85, 0x89, 0x8c, 0x07, 0x00, 0x50, 0x89, 0x8c, 0x89, 0x8c, 0x8d, 0x02, 0x00, 0x71, 0x89, 0x91, 0x89, 0x91, 0x8b, 0x91, 0x8c, 0x02,
+  0x00, 0x03, 0x03, 0x00, 0x01, 0x01, 0x00, 0x12, 0x92, 0x05, 0x00, 0x02, 0x02, 0x00, 0x10, 0x94, 0x03, 0x00, 0x01, 0x02, 0x00, 0xf6, 0x07, 0x94,
+  0x92, 0x94, 0x97, 0x97, 0x97, 0x97, 0x94, 0x97, 0x94, 0x97, 0x95, 0x97, 0x9a, 0x97, 0x9a, 0x95, 0x97, 0x9a, 0x9a, 0x95, 0x9a, 0x01, 0x00, 0x80,
+  0x99, 0x9a, 0x9a, 0x9a, 0x04, 0x9a, 0x9a, 0x07, 0x0c, 0x00, 0x83, 0x9a, 0x05, 0x07, 0x07, 0x9a, 0x07, 0x9a, 0x07, 0x01, 0x00, 0x38, 0x0a, 0x07,
+  0x0a, 0x01, 0x00, 0x11, 0x0c, 0x02, 0x00, 0xb2, 0x0e, 0x0c, 0x0b, 0x0c, 0x0e, 0x0c, 0x0e, 0x0c, 0x0b, 0x11, 0x0e, 0x02, 0x00, 0x12, 0x14, 0x06,
+  0x00, 0x02, 0x01, 0x00, 0x20, 0x0e, 0x14, 0x0a, 0x00, 0x10, 0x18, 0x02, 0x00, 0x01, 0x05, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x05, 0x01,
+  0x00, 0x10, 0x1e, 0x03, 0x00, 0x10, 0x17, 0xd5, 0x01, 0x30, 0x37, 0x3f, 0x3e, 0x04, 0x00, 0x22, 0x37, 0x37, 0xe0, 0x01, 0x60, 0x3e, 0x3f, 0x1e,
+  0x81, 0x87, 0x7f, 0xe2, 0x01, 0x10, 0x7e, 0xff, 0x01, 0x12, 0x2c, 0x01, 0x00, 0x30, 0x37, 0x37, 0x41, 0xe0, 0x01, 0x20, 0x37, 0x35, 0x0d, 0x00,
+  0x00, 0xdf, 0x01, 0x20, 0x35, 0x2c, 0x1b, 0x00, 0x40, 0x20, 0x18, 0x86, 0x7a, 0x01, 0x00, 0x00, 0xe2, 0x01, 0x05, 0x01, 0x00, 0x10, 0x74, 0xe9,
+  0x01, 0x50, 0x72, 0x74, 0x76, 0x74, 0x74, 0xe6, 0x01, 0xf0, 0x22, 0x70, 0x72, 0x74, 0x7d, 0x0c, 0x17, 0x25, 0x1e, 0x9b, 0x0a, 0x10, 0x92, 0x73,
+  0x6f, 0x73, 0x0a, 0x8d, 0x94, 0x25, 0x25, 0x1e, 0x1f, 0x1e, 0x0e, 0x05, 0x14, 0x18, 0x1e, 0x85, 0x6e, 0x82, 0x0d, 0x15, 0x85, 0x76, 0x70, 0x82,
+  0x9d, 0x14, 0x18, 0x18, 0x0a, 0x0c, 0x9d, 0x76, 0x65, 0x70, 0x70, 0x82, 0xdd, 0x01, 0x30, 0x63, 0x63, 0x69, 0x02, 0x00, 0x05, 0x01, 0x00, 0x02,
+  0xdf, 0x01, 0x60, 0x72, 0x70, 0x7b, 0x85, 0x8c, 0x76, 0xc6, 0x01, 0x00, 0xdb, 0x01, 0x07, 0xdc, 0x01, 0x00, 0xc5, 0x01, 0x00, 0x02, 0x00, 0x02,
+  0x05, 0x00, 0x01, 0x01, 0x00, 0x04, 0x08, 0x00, 0x0f, 0x01, 0x00, 0x06, 0x01, 0xd9, 0x01, 0x02, 0x02, 0x00, 0x07, 0x01, 0x00, 0x10, 0x8c, 0x02,
+  0x00, 0x01, 0xdf, 0x01, 0x31, 0x8c, 0x91, 0x89, 0xdb, 0x01, 0x51, 0x8f, 0x91, 0x8f, 0x91, 0x91, 0x04, 0x00, 0x01, 0xd7, 0x01, 0x02, 0x03, 0x00,
+  0x00, 0xe4, 0x01, 0x51, 0x94, 0x91, 0x94, 0x91, 0x97, 0xde, 0x01, 0x50, 0x95, 0x92, 0x97, 0x94, 0x92, 0xdb, 0x01, 0x50, 0x95, 0x97, 0x95, 0x97,
+  0x97, 0xdf, 0x01, 0x20, 0x9a, 0x9a, 0x04, 0x00, 0x0b, 0x01, 0x00, 0x01, 0xde, 0x01, 0x70, 0x07, 0x05, 0x07, 0x05, 0x9b, 0x05, 0x9b, 0xd7, 0x01,
+  0x02, 0xda, 0x01, 0x00, 0x06, 0x00, 0x10, 0x0a, 0x08, 0x00, 0x00, 0xdb, 0x01, 0x70, 0x0a, 0x0c, 0x0b, 0x0a, 0x0a, 0x0b, 0x0a, 0xda, 0x01, 0x01,
+  0xdd, 0x01, 0x10, 0x11, 0x0a, 0x00, 0x01, 0xd8, 0x01, 0x01, 0x02, 0x00, 0x00, 0xe5, 0x01, 0x00, 0xd9, 0x01, 0x00, 0xdc, 0x01, 0x04, 0xdf, 0x01,
+  0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x07, 0x01, 0x00, 0x14, 0x1e, 0x02, 0x00, 0x10, 0x3f, 0x01, 0x00, 0x30, 0x37, 0x3f, 0x37, 0xc0, 0x03, 0x01,
+  0x0a, 0x00, 0x00, 0x01, 0x00, 0x51, 0x37, 0x29, 0x86, 0x00, 0x83, 0xc3, 0x03, 0x62, 0x0a, 0x32, 0x32, 0x37, 0x2c, 0x2c, 0xd4, 0x01, 0x01, 0xe7,
+  0x03, 0x20, 0x37, 0x37, 0xd1, 0x03, 0x10, 0x25, 0x14, 0x00, 0x10, 0x32, 0x16, 0x00, 0x30, 0x25, 0x1e, 0x8b, 0xde, 0x01, 0x21, 0x7a, 0x7b, 0x05,
+  0x00, 0x12, 0x77, 0x02, 0x00, 0x00, 0x01, 0x00, 0x31, 0x74, 0x77, 0x76, 0xcd, 0x03, 0x00, 0xbe, 0x03, 0xf0, 0x1d, 0x74, 0x74, 0x8c, 0x17, 0x1e,
+  0x25, 0x25, 0x18, 0x14, 0x1e, 0x14, 0x0a, 0x0d, 0x07, 0x0a, 0x0a, 0x11, 0x1f, 0x1e, 0x25, 0x1e, 0x25, 0x25, 0x1e, 0x18, 0x18, 0x15, 0x85, 0x78,
+  0x7b, 0x92, 0x17, 0x10, 0x72, 0x69, 0x8c, 0x9d, 0x15, 0x0c, 0x9b, 0x89, 0x9b, 0x8c, 0x70, 0xd5, 0x01, 0x11, 0x65, 0xdb, 0x01, 0x02, 0x02, 0x00,
+  0x01, 0x01, 0x00, 0x05, 0xbe, 0x03, 0xa9, 0x70, 0x76, 0x76, 0x76, 0x7b, 0x76, 0x76, 0x7b, 0x7b, 0x82, 0xbd, 0x03, 0x06, 0xd6, 0x01, 0x03, 0x07,
+  0x00, 0x0f, 0x01, 0x00, 0x05, 0x11, 0x89, 0x03, 0x00, 0x02, 0x01, 0x00, 0x01, 0xd9, 0x01, 0x00, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0xd8, 0x01,
+  0x00, 0x02, 0x00, 0x01, 0xdf, 0x01, 0x01, 0xd9, 0x01, 0x40, 0x8c, 0x91, 0x8c, 0x8f, 0xb6, 0x03, 0x10, 0x8c, 0xcf, 0x01, 0x0b, 0x02, 0x00, 0x10,
+  0x94, 0x05, 0x00, 0x30, 0x92, 0x92, 0x97, 0xb9, 0x03, 0x41, 0x92, 0x95, 0x92, 0x9a, 0xde, 0x01, 0x00, 0xb6, 0x03, 0x13, 0x97, 0xb4, 0x03, 0x0b,
+  0xdf, 0x01, 0x30, 0x04, 0x9a, 0x04, 0xdc, 0x01, 0x21, 0x9a, 0x07, 0xdd, 0x01, 0x30, 0x05, 0x9b, 0x05, 0xd7, 0x01, 0x02, 0xdf, 0x01, 0x00, 0xdc,
+  0x01, 0x04, 0x01, 0x00, 0x10, 0x0b, 0xb9, 0x03, 0x12, 0x0c, 0x01, 0x00, 0x00, 0xda, 0x01, 0x15, 0x11, 0xbd, 0x03, 0x11, 0x0d, 0x06, 0x00, 0x40,
+  0x14, 0x11, 0x14, 0x11, 0xd9, 0x01, 0x02, 0x01, 0x00, 0x01, 0xdb, 0x01, 0x0a, 0xda, 0x01, 0x03, 0x01, 0x00, 0x31, 0x1e, 0x18, 0x1e, 0x01, 0x00,
+  0x01, 0xcf, 0x01, 0x20, 0x3f, 0x37, 0xc4, 0x03, 0x00, 0xbc, 0x01, 0x01, 0xa2, 0x05, 0xe1, 0x3e, 0x3f, 0x32, 0x86, 0x86, 0x83, 0x87, 0x83, 0x00,
+  0x83, 0x86, 0x1e, 0x32, 0x37, 0xa6, 0x03, 0x00, 0xe5, 0x01, 0x60, 0x2c, 0x41, 0x37, 0x41, 0x37, 0x35, 0x0e, 0x00, 0x00, 0x11, 0x00, 0xd0, 0x37,
+  0x32, 0x35, 0x32, 0x2c, 0x2c, 0x25, 0x20, 0x9a, 0x7f, 0x7d, 0x7a, 0x80, 0xdd, 0x01, 0x10, 0x7c, 0x05, 0x00, 0x00, 0x01, 0x00, 0x02, 0xe3, 0x01,
+  0x00, 0xe6, 0x01, 0x31, 0x76, 0x77, 0x76, 0x05, 0x00, 0x60, 0x74, 0x74, 0x9b, 0x17, 0x18, 0x25, 0xd3, 0x01, 0xa0, 0x20, 0x14, 0x9b, 0x0c, 0x0c,
+  0x1e, 0x25, 0x1e, 0x1e, 0x25, 0x0f, 0x00, 0xf1, 0x05, 0x14, 0x14, 0x0c, 0x92, 0x6e, 0x6f, 0x8b, 0x17, 0x14, 0x85, 0x6a, 0x74, 0x7b, 0x91, 0x8b,
+  0x98, 0x92, 0x8c, 0x82, 0x69, 0xd5, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x00, 0x04, 0xde, 0x01, 0x04, 0xe1, 0x01, 0x30, 0x76, 0x7b, 0x76, 0xdd,
+  0x01, 0x06, 0x01, 0x00, 0x02, 0xdf, 0x01, 0x0f, 0xdb, 0x01, 0x0c, 0x04, 0xd1, 0x01, 0x04, 0x08, 0x00, 0x0a, 0xd9, 0x01, 0x03, 0x05, 0x00, 0x21,
+  0x91, 0x89, 0xd6, 0x01, 0x00, 0x05, 0x00, 0x00, 0xd9, 0x01, 0x04, 0x05, 0x00, 0x01, 0x01, 0x00, 0x01, 0xd7, 0x01, 0x02, 0x02, 0x00, 0x00, 0xd4,
+  0x01, 0x20, 0x97, 0x91, 0x8a, 0x05, 0x00, 0xba, 0x03, 0x50, 0x97, 0x97, 0x92, 0x95, 0x98, 0xb7, 0x03, 0x2b, 0x97, 0x97, 0xd5, 0x01, 0x01, 0xaf,
+  0x03, 0x60, 0x9a, 0x9a, 0x9b, 0x9a, 0x9b, 0x04, 0xb0, 0x03, 0x01, 0x8f, 0x05, 0x31, 0x9a, 0x0a, 0x04, 0x0a, 0x00, 0x07, 0xda, 0x01, 0x01, 0x05,
+  0x00, 0x10, 0x0b, 0xbb, 0x03, 0x02, 0xde, 0x01, 0x11, 0x0b, 0xdb, 0x01, 0x20, 0x0e, 0x0d, 0xd4, 0x01, 0x00, 0x07, 0x00, 0x40, 0x11, 0x0c, 0x14,
+  0x11, 0xd8, 0x01, 0x33, 0x11, 0x11, 0x11, 0xbe, 0x03, 0x00, 0xd7, 0x01, 0x00, 0x01, 0x00, 0x00, 0xdd, 0x01, 0x0a, 0xe0, 0x01, 0x00, 0xb6, 0x03,
+  0x02, 0x03, 0x00, 0x01, 0xe3, 0x01, 0x41, 0x3f, 0x3f, 0x32, 0x37, 0xe2, 0x01, 0x01, 0xbb, 0x03, 0x00, 0xe2, 0x01, 0x00, 0x0b, 0x00, 0xe0, 0x32,
+  0x8f, 0x88, 0x87, 0x00, 0x87, 0x87, 0x86, 0x8d, 0x29, 0x37, 0x32, 0x2c, 0x32, 0xde, 0x01, 0x01, 0xd3, 0x01, 0x00, 0x01, 0x00, 0x00, 0xb4, 0x03,
+  0x02, 0x0c, 0x00, 0x00, 0xdf, 0x01, 0x81, 0x25, 0x0c, 0x83, 0x7d, 0x80, 0x80, 0x7a, 0x80, 0xe2, 0x01, 0x62, 0x80, 0x7d, 0x7a, 0x7d, 0x7a, 0x7c,
+  0xc6, 0x03, 0x01, 0x06, 0x00, 0x00, 0x01, 0x00, 0x90, 0x7b, 0x77, 0x74, 0x7b, 0x77, 0x77, 0x85, 0x9d, 0x11, 0xd2, 0x01, 0xb0, 0x1e, 0x1e, 0x07,
+  0x0c, 0x14, 0x14, 0x1e, 0x18, 0x18, 0x0e, 0x0c, 0x5d, 0x02, 0xf0, 0x05, 0x0b, 0x14, 0x18, 0x1e, 0x0a, 0x9a, 0x0d, 0x14, 0x98, 0x78, 0x6e, 0x85,
+  0x92, 0x8c, 0x77, 0x7c, 0x98, 0x10, 0x7c, 0x6a, 0xd1, 0x01, 0x08, 0x01, 0x00, 0x01, 0xdd, 0x01, 0x03, 0xdf, 0x01, 0x02, 0xde, 0x01, 0x02, 0xdf,
+  0x01, 0x63, 0x7b, 0x85, 0x8c, 0x8c, 0x85, 0x8c, 0xdd, 0x01, 0x0f, 0xde, 0x01, 0x03, 0x00, 0xcc, 0x01, 0x03, 0x01, 0x00, 0x01, 0xcf, 0x01, 0x00,
+  0x02, 0x00, 0x01, 0x05, 0x00, 0x00, 0x02, 0x00, 0x04, 0x01, 0x00, 0x01, 0xd9, 0x01, 0x02, 0x02, 0x00, 0x00, 0x01, 0x00, 0x01, 0xdc, 0x01, 0x00,
+  0xdf, 0x01, 0x10, 0x8c, 0x81, 0x05, 0x01, 0xcd, 0x01, 0x10, 0x8f, 0xa9, 0x03, 0x01, 0x03, 0x00, 0x02, 0xd9, 0x01, 0x20, 0x94, 0x98, 0x06, 0x00,
+  0xa0, 0x97, 0x91, 0x97, 0x92, 0x97, 0x91, 0x98, 0x94, 0x98, 0x94, 0xbb, 0x03, 0x3b, 0x97, 0x97, 0x98, 0xb1, 0x03, 0x10, 0x9b, 0xdc, 0x01, 0x03,
+  0x01, 0x00, 0x10, 0x07, 0x03, 0x00, 0x40, 0x07, 0x9a, 0x07, 0x04, 0xd8, 0x01, 0x03, 0xda, 0x01, 0x04, 0x02, 0x00, 0x05, 0x01, 0x00, 0x00, 0xd7,
+  0x01, 0x00, 0x06, 0x00, 0x10, 0x0e, 0xbb, 0x03, 0x40, 0x0c, 0x0c, 0x11, 0x0c, 0xda, 0x01, 0x10, 0x0c, 0xb4, 0x03, 0x30, 0x11, 0x0e, 0x14, 0xef,
+  0x01, 0x01, 0xbd, 0x03, 0x0d, 0x01, 0x00, 0x00, 0xdf, 0x01, 0x00, 0x05, 0x00, 0x13, 0x17, 0x02, 0x00, 0x00, 0xd7, 0x01, 0x00, 0xd9, 0x01, 0x00,
+  0x04, 0x00, 0x01, 0xe0, 0x01, 0x20, 0x17, 0x32, 0xbb, 0x03, 0x00, 0xd6, 0x01, 0x03, 0x02, 0x00, 0xe4, 0x3f, 0x3f, 0x37, 0x32, 0x97, 0x02, 0x87,
+  0x00, 0x87, 0x00, 0x87, 0x9a, 0x32, 0x32, 0xe1, 0x01, 0x20, 0x32, 0x2c, 0x8a, 0x09, 0x00, 0xce, 0x03, 0x20, 0x25, 0x25, 0xdf, 0x01, 0x00, 0x17,
+  0x00, 0x80, 0x25, 0x20, 0x11, 0x80, 0x81, 0x7f, 0x80, 0x80, 0xe2, 0x01, 0x01, 0xe7, 0x01, 0x01, 0x02, 0x00, 0x23, 0x7a, 0x7b, 0x02, 0x00, 0x41,
+  0x77, 0x7b, 0x7b, 0x7b, 0x04, 0x00, 0xc0, 0x77, 0x78, 0x7b, 0x7e, 0x14, 0x25, 0x25, 0x1e, 0x0a, 0x94, 0x94, 0x9b, 0x92, 0x00, 0x32, 0x1e, 0x1e,
+  0x14, 0x7f, 0x00, 0x01, 0x06, 0x00, 0xf0, 0x00, 0x17, 0x14, 0x11, 0x9b, 0x92, 0x8c, 0x10, 0x85, 0x8c, 0x92, 0x9d, 0x0d, 0x8c, 0x69, 0x70, 0xcf,
+  0x01, 0x03, 0x01, 0x00, 0x01, 0x0b, 0x00, 0x04, 0xdd, 0x01, 0x00, 0xde, 0x01, 0x02, 0xe0, 0x01, 0x01, 0xe1, 0x01, 0x30, 0x82, 0x82, 0x8c, 0xb9,
+  0x01, 0x01, 0xdf, 0x01, 0x00, 0x09, 0x00, 0x05, 0x01, 0x00, 0x01, 0xbe, 0x01, 0x01, 0x02, 0x00, 0x00, 0x01, 0x00, 0x01, 0x08, 0x00, 0x01, 0x0b,
+  0x00, 0x00, 0x0a, 0x00, 0x00, 0xd1, 0x01, 0x03, 0x44, 0x09, 0x00, 0x08, 0x00, 0x03, 0x02, 0x00, 0x03, 0x01, 0x00, 0x12, 0x8d, 0xd8, 0x01, 0x01,
+  0x02, 0x00, 0x23, 0x92, 0x8c, 0xdd, 0x01, 0x02, 0x02, 0x00, 0x13, 0x94, 0x06, 0x00, 0x00, 0x02, 0x00, 0x01, 0x92, 0x05, 0x00, 0xd2, 0x01, 0x00,
+  0x90, 0x05, 0x01, 0x09, 0x00, 0x11, 0x9a, 0x04, 0x00, 0x0c, 0x93, 0x05, 0x01, 0xb8, 0x03, 0x00, 0xd7, 0x01, 0x72, 0x9b, 0x07, 0x9a, 0x07, 0x9b,
+  0x07, 0x9a, 0x90, 0x05, 0x01, 0x01, 0x00, 0x01, 0xd9, 0x01, 0x07, 0xdb, 0x01, 0x00, 0x01, 0x00, 0x25, 0x0c, 0x0b, 0xdc, 0x01, 0x00, 0x77, 0x07,
+  0x00, 0xd0, 0x01, 0x30, 0x0c, 0x11, 0x11, 0xdd, 0x01, 0x10, 0x11, 0x07, 0x00, 0x16, 0x14, 0xdc, 0x01, 0x05, 0x09, 0x00, 0x00, 0xdb, 0x01, 0x00,
+  0xd3, 0x01, 0x15, 0x17, 0xdf, 0x01, 0x31, 0x1e, 0x18, 0x1e, 0x05, 0x00, 0x00, 0x03, 0x00, 0x02, 0x01, 0x00, 0x31, 0x45, 0x3f, 0x32, 0xb2, 0x03,
+  0x06, 0xe3, 0x01, 0x01, 0x01, 0x00, 0xc0, 0x9a, 0x89, 0x88, 0x87, 0x87, 0x87, 0x86, 0x07, 0x32, 0x37, 0x37, 0x32, 0xca, 0x01, 0x10, 0x32, 0xe1,
+  0x01, 0x00, 0xe0, 0x01, 0x13, 0x37, 0xbf, 0x03, 0xe0, 0x2c, 0x37, 0x32, 0x2c, 0x29, 0x25, 0x14, 0x86, 0x83, 0x83, 0x80, 0x80, 0x80, 0x7f, 0x03,
+  0x00, 0x00, 0xe8, 0x01, 0x00, 0xe0, 0x01, 0x80, 0x7c, 0x80, 0x7a, 0x7b, 0x7a, 0x80, 0x7a, 0x7c, 0xca, 0x03, 0xf0, 0x12, 0x7a, 0x7b, 0x7b, 0x77,
+  0x80, 0x80, 0x7c, 0x7b, 0x7b, 0x79, 0x92, 0x20, 0x20, 0x25, 0x1e, 0x0c, 0x0d, 0x8f, 0x0c, 0x14, 0x17, 0x17, 0x1e, 0x18, 0x14, 0x14, 0x18, 0x1e,
+  0x25, 0x1e, 0x18, 0x14, 0x17, 0x83, 0x00, 0xf0, 0x07, 0x14, 0x0d, 0x92, 0x92, 0x0d, 0x0d, 0x14, 0x15, 0x9d, 0x76, 0x9b, 0x10, 0x92, 0x75, 0x7b,
+  0x92, 0x70, 0x82, 0x70, 0x6a, 0x69, 0x6a, 0xd8, 0x01, 0x00, 0x02, 0x00, 0x04, 0x01, 0x00, 0x05, 0xde, 0x01, 0x00, 0xdd, 0x01, 0x02, 0x78, 0x07,
+  0x11, 0x85, 0xe2, 0x01, 0x08, 0x01, 0x00, 0x01, 0xc4, 0x01, 0x43, 0x85, 0x8c, 0x85, 0x8c, 0x08, 0x00, 0x02, 0x06, 0x00, 0x30, 0x8c, 0x85, 0x89,
+  0x0b, 0x00, 0x10, 0x8c, 0xdf, 0x01, 0x01, 0xd1, 0x01, 0x04, 0x02, 0x00, 0x00, 0x01, 0x00, 0x30, 0x8b, 0x8c, 0x8b, 0x07, 0x00, 0x00, 0xd5, 0x01,
+  0x03, 0x02, 0x00, 0x10, 0x92, 0x02, 0x00, 0x00, 0xd0, 0x01, 0x03, 0xe3, 0x01, 0x00, 0xd5, 0x01, 0x02, 0x02, 0x00, 0x00, 0xb0, 0x03, 0x00, 0x8e,
+  0x05, 0x13, 0x97, 0xe1, 0x01, 0x00, 0x01, 0x00, 0x01, 0xdd, 0x01, 0x09, 0xdb, 0x01, 0x11, 0x9b, 0x04, 0x00, 0x03, 0xdc, 0x01, 0x03, 0x08, 0x00,
+  0x00, 0xd6, 0x01, 0x03, 0x01, 0x00, 0x01, 0x90, 0x05, 0x01, 0x07, 0x00, 0x02, 0x01, 0x00, 0x02, 0x94, 0x05, 0x00, 0x02, 0x00, 0x11, 0x0b, 0x74,
+  0x07, 0x32, 0x0b, 0x11, 0x0c, 0x02, 0x00, 0x01, 0xe4, 0x01, 0x02, 0xdc, 0x01, 0x00, 0x9c, 0x05, 0x00, 0xd2, 0x01, 0x06, 0x01, 0x00, 0x00, 0xb4,
+  0x03, 0x30, 0x17, 0x18, 0x17, 0x08, 0x00, 0x08, 0xdf, 0x01, 0x13, 0x17, 0xbe, 0x03, 0x05, 0x01, 0x00, 0x40, 0x3f, 0x3f, 0x45, 0x32, 0x99, 0x03,
+  0x01, 0xdb, 0x01, 0x05, 0x02, 0x00, 0x91, 0x32, 0x0c, 0x02, 0x87, 0x02, 0x87, 0x88, 0x86, 0x11, 0xbf, 0x03, 0x00, 0xdf, 0x01, 0x03, 0xbf, 0x03,
+  0x00, 0x9f, 0x05, 0x01, 0x0a, 0x00, 0x00, 0x12, 0x00, 0x80, 0x25, 0x20, 0x89, 0x86, 0x80, 0x80, 0x83, 0x80, 0xe3, 0x01, 0x08, 0x01, 0x00, 0xf2,
+  0x14, 0x7d, 0x80, 0x80, 0x7b, 0x80, 0x7a, 0x80, 0x7b, 0x80, 0x80, 0x82, 0x80, 0x7b, 0x7d, 0x92, 0x10, 0x85, 0x7c, 0x7b, 0x89, 0x92, 0x1e, 0x25,
+  0x20, 0x17, 0x00, 0x11, 0x9b, 0x11, 0x14, 0x17, 0x14, 0x14, 0x18, 0x17, 0xda, 0x01, 0xf1, 0x0c, 0x25, 0x17, 0x07, 0x07, 0x17, 0x25, 0x1b, 0x17,
+  0x79, 0x74, 0x9d, 0x17, 0x0c, 0x9b, 0x82, 0x6f, 0x7b, 0x92, 0x7d, 0x7b, 0x92, 0x9c, 0x89, 0x82, 0x70, 0x6e, 0x82, 0xc7, 0x03, 0x00, 0xd8, 0x01,
+  0x02, 0x01, 0x00, 0x05, 0xde, 0x01, 0x00, 0xe1, 0x01, 0x00, 0x01, 0x00, 0x00, 0xdf, 0x01, 0x00, 0x97, 0x05, 0x04, 0xe4, 0x01, 0x00, 0xca, 0x01,
+  0x00, 0x02, 0x00, 0x01, 0xce, 0x01, 0x13, 0x89, 0x08, 0x00, 0x00, 0x06, 0x00, 0x02, 0x0d, 0x00, 0x00, 0xb0, 0x03, 0x00, 0xd2, 0x01, 0x02, 0x02,
+  0x00, 0x03, 0x03, 0x00, 0x06, 0x01, 0x00, 0x00, 0xd7, 0x01, 0x00, 0x02, 0x00, 0x01, 0xd0, 0x01, 0x02, 0x02, 0x00, 0x00, 0x90, 0x05, 0x07, 0xdd,
+  0x01, 0x00, 0xb6, 0x03, 0x00, 0xd9, 0x01, 0x00, 0xd3, 0x01, 0x05, 0x01, 0x00, 0x00, 0x4e, 0x09, 0x00, 0xde, 0x01, 0x05, 0xdd, 0x01, 0x11, 0x9b,
+  0x03, 0x00, 0x01, 0xd1, 0x01, 0x10, 0x9b, 0xb4, 0x03, 0x00, 0xd0, 0x01, 0x00, 0x09, 0x00, 0x00, 0x7d, 0x07, 0x00, 0xdb, 0x01, 0x01, 0x04, 0x00,
+  0x00, 0xba, 0x03, 0x06, 0xdf, 0x01, 0x00, 0x0d, 0x0d, 0x00, 0x97, 0x05, 0x00, 0xdd, 0x01, 0x06, 0xc0, 0x03, 0x12, 0x11, 0xbe, 0x03, 0x01, 0x70,
+  0x07, 0x1b, 0x11, 0xdb, 0x01, 0x03, 0x01, 0x00, 0x00, 0xd7, 0x01, 0x02, 0xc0, 0x03, 0x10, 0x1e, 0x06, 0x00, 0x00, 0xbb, 0x03, 0x12, 0x1e, 0x06,
+  0x00, 0x08, 0x01, 0x00, 0x52, 0x3f, 0x3f, 0x3f, 0x32, 0x20, 0x75, 0x07, 0x22, 0x3f, 0x32, 0xc5, 0x03, 0x00, 0x03, 0x00, 0x91, 0x0d, 0x8a, 0x02,
+  0x87, 0x88, 0x89, 0x88, 0x17, 0x32, 0xbf, 0x03, 0x31, 0x37, 0x32, 0x37, 0xe1, 0x01, 0x00, 0x07, 0x00, 0x20, 0x25, 0x29, 0x5c, 0x09, 0x01, 0x10,
+  0x00, 0xb1, 0x20, 0x9a, 0x00, 0x81, 0x83, 0x83, 0x86, 0x83, 0x86, 0x83, 0x81, 0x02, 0x00, 0x00, 0xdc, 0x01, 0x08, 0x01, 0x00, 0xf0, 0x03, 0x85,
+  0x9d, 0x9d, 0x92, 0x7c, 0x80, 0x92, 0x0d, 0x92, 0x80, 0x92, 0x0d, 0x8f, 0x1b, 0x25, 0x17, 0x9a, 0x0c, 0x7c, 0x00, 0xf0, 0x18, 0x14, 0x94, 0x11,
+  0x1e, 0x1e, 0x18, 0x0c, 0x1e, 0x14, 0x14, 0x1e, 0x20, 0x1e, 0x1e, 0x04, 0x0c, 0x20, 0x1e, 0x17, 0x92, 0x07, 0x14, 0x17, 0x91, 0x92, 0x8c, 0x78,
+  0x6e, 0x7c, 0x76, 0x75, 0x85, 0x98, 0x9d, 0x82, 0x82, 0x98, 0x98, 0x76, 0xd6, 0x01, 0x04, 0x01, 0x00, 0x06, 0xde, 0x01, 0x01, 0xbd, 0x03, 0x02,
+  0xde, 0x01, 0x00, 0x9c, 0x05, 0x32, 0x85, 0x8c, 0x8c, 0xe0, 0x01, 0x00, 0xdb, 0x01, 0x00, 0x02, 0x00, 0x00, 0xd7, 0x01, 0x00, 0xd5, 0x01, 0x03,
+  0x02, 0x00, 0x08, 0x0c, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x00, 0x12, 0x91, 0x05, 0x00, 0x60, 0x91, 0x8c, 0x8c, 0x8f, 0x8c, 0x8f, 0xb0, 0x03,
+  0x00, 0x2b, 0x0b, 0x02, 0xdf, 0x01, 0x03, 0x01, 0x00, 0x11, 0x91, 0xd3, 0x01, 0x03, 0xd5, 0x01, 0x00, 0x02, 0x00, 0x03, 0x01, 0x00, 0x41, 0x9a,
+  0x97, 0x97, 0x98, 0x07, 0x00, 0x03, 0x02, 0x00, 0x01, 0x01, 0x00, 0x04, 0xb3, 0x03, 0x20, 0x9b, 0x9a, 0xf9, 0x0c, 0x04, 0xdf, 0x01, 0x22, 0x9b,
+  0x0a, 0x06, 0x00, 0x00, 0x05, 0x00, 0x00, 0xdc, 0x01, 0x00, 0xd6, 0x01, 0x08, 0xd9, 0x01, 0x02, 0x01, 0x00, 0x21, 0x0c, 0x0c, 0x53, 0x09, 0x10,
+  0x0d, 0x53, 0x09, 0x02, 0x6f, 0x07, 0x01, 0xbe, 0x03, 0x00, 0xdd, 0x01, 0x20, 0x11, 0x0e, 0x54, 0x09, 0x0c, 0xbb, 0x03, 0x01, 0xbd, 0x03, 0x00,
+  0xd8, 0x01, 0x30, 0x17, 0x18, 0x17, 0x05, 0x00, 0x01, 0xd6, 0x01, 0x01, 0x94, 0x05, 0x09, 0xba, 0x03, 0x02, 0x01, 0x00, 0x00, 0x8d, 0x05, 0x00,
+  0xd9, 0x01, 0x01, 0x02, 0x00, 0x10, 0x32, 0x0b, 0x00, 0x01, 0x05, 0x00, 0x80, 0x0d, 0x02, 0x87, 0x8d, 0x8a, 0x02, 0x8d, 0x14, 0xe0, 0x01, 0x02,
+  0xe2, 0x01, 0x00, 0x04, 0x00, 0x00, 0xb7, 0x03, 0x00, 0x9d, 0x05, 0x00, 0xb5, 0x05, 0xe1, 0x32, 0x2c, 0x29, 0x18, 0x8b, 0x86, 0x87, 0x86, 0x85,
+  0x87, 0x85, 0x83, 0x85, 0x86, 0xe5, 0x01, 0x20, 0x85, 0x80, 0x02, 0x00, 0x00, 0x03, 0x00, 0x02, 0x01, 0x00, 0xf0, 0x0d, 0x8b, 0x0d, 0x17, 0x85,
+  0x81, 0x8c, 0x81, 0x85, 0x8c, 0x89, 0x92, 0x0d, 0x17, 0x1e, 0x20, 0x02, 0x81, 0x11, 0x1e, 0x20, 0x20, 0x1e, 0x17, 0x11, 0x11, 0x14, 0x17, 0x07,
+  0xea, 0x01, 0x40, 0x1e, 0x25, 0x20, 0x20, 0x65, 0x04, 0xf0, 0x05, 0x17, 0x17, 0x1e, 0x20, 0x1e, 0x0d, 0x9d, 0x9d, 0x8c, 0x8c, 0x82, 0x92, 0x92,
+  0x85, 0x8c, 0x85, 0x8b, 0x9b, 0x9b, 0x85, 0xd7, 0x01, 0x03, 0x01, 0x00, 0x04, 0xdc, 0x01, 0x00, 0x01, 0x00, 0x01, 0xe0, 0x01, 0x11, 0x82, 0x9e,
+  0x05, 0x01, 0xe3, 0x01, 0x00, 0xa7, 0x01, 0x00, 0xc5, 0x01, 0x06, 0x02, 0x00, 0x00, 0xc3, 0x01, 0x08, 0x02, 0x00, 0x01, 0x01, 0x00, 0x0b, 0xb0,
+  0x03, 0x03, 0xde, 0x01, 0x00, 0xd7, 0x01, 0x01, 0x02, 0x00, 0x04, 0xd7, 0x01, 0x01, 0x06, 0x00, 0x01, 0x05, 0x00, 0x02, 0x01, 0x00, 0x06, 0xd6,
+  0x01, 0x00, 0x01, 0x00, 0x1a, 0x98, 0xd9, 0x01, 0x02, 0x51, 0x09, 0x00, 0xda, 0x01, 0x00, 0x01, 0x00, 0x01, 0xba, 0x03, 0x00, 0xdb, 0x01, 0x12,
+  0x9b, 0xdc, 0x01, 0x01, 0xb9, 0x03, 0x00, 0x01, 0x00, 0x20, 0x0a, 0x07, 0xe2, 0x01, 0x00, 0xd9, 0x01, 0x06, 0xdb, 0x01, 0x01, 0xb2, 0x03, 0x00,
+  0x03, 0x00, 0x00, 0xae, 0x03, 0x00, 0xd7, 0x01, 0x02, 0x03, 0x00, 0x00, 0x05, 0x00, 0x01, 0xdb, 0x01, 0x00, 0x2f, 0x0b, 0x01, 0x9b, 0x05, 0x00,
+  0xdd, 0x01, 0x00, 0x05, 0x00, 0x08, 0x01, 0x00, 0x00, 0x9a, 0x05, 0x04, 0xe1, 0x01, 0x02, 0x07, 0x00, 0x01, 0xb5, 0x03, 0x01, 0x51, 0x01, 0x00,
+  0x01, 0x00, 0x07, 0xe5, 0x01, 0x13, 0x20, 0xe0, 0x01, 0x06, 0x01, 0x00, 0x03, 0x8d, 0x07, 0x90, 0x32, 0x17, 0x02, 0x8d, 0x8d, 0x8d, 0x8a, 0x02,
+  0x11, 0x60, 0x09, 0x00, 0xcc, 0x01, 0x01, 0xdf, 0x01, 0x01, 0xb6, 0x03, 0x11, 0x29, 0xe7, 0x01, 0x00, 0x12, 0x00, 0x90, 0x29, 0x07, 0x86, 0x86,
+  0x86, 0x86, 0x87, 0x86, 0x87, 0xdd, 0x01, 0x21, 0x86, 0x83, 0xe4, 0x01, 0x20, 0x85, 0x83, 0xde, 0x01, 0xf0, 0x15, 0x85, 0x82, 0x80, 0x82, 0x80,
+  0x80, 0x80, 0x89, 0x0d, 0x10, 0x97, 0x98, 0x8b, 0x82, 0x8b, 0x89, 0x85, 0x7d, 0x85, 0x92, 0x9d, 0x11, 0x0a, 0x0c, 0x11, 0x20, 0x25, 0x20, 0x1e,
+  0x17, 0x14, 0x9b, 0x0a, 0x0d, 0x14, 0x18, 0xd4, 0x01, 0xf2, 0x0c, 0x20, 0x1e, 0x20, 0x25, 0x1e, 0x11, 0x0a, 0x17, 0x17, 0x1e, 0x1e, 0x17, 0x17,
+  0x17, 0x15, 0x9b, 0x92, 0x8c, 0x92, 0x90, 0x7c, 0x82, 0x98, 0x98, 0x9b, 0x8c, 0x75, 0xc0, 0x03, 0x00, 0xdb, 0x01, 0x06, 0xde, 0x01, 0x01, 0xdd,
+  0x01, 0x00, 0x7b, 0x07, 0x05, 0xdf, 0x01, 0x10, 0x85, 0xd0, 0x01, 0x00, 0xb9, 0x03, 0x02, 0xcb, 0x01, 0x08, 0xc4, 0x01, 0x05, 0x01, 0x00, 0x13,
+  0x89, 0x61, 0x07, 0x02, 0x01, 0x00, 0x00, 0xa9, 0x03, 0x10, 0x92, 0x07, 0x00, 0x03, 0x02, 0x00, 0x02, 0xce, 0x01, 0x01, 0x8b, 0x05, 0x02, 0x0b,
+  0x00, 0x00, 0x01, 0x00, 0x01, 0xb0, 0x03, 0x10, 0x92, 0xd0, 0x01, 0x11, 0x9a, 0x0a, 0x00, 0x02, 0xdc, 0x01, 0x10, 0x9a, 0x03, 0x00, 0x03, 0x02,
+  0x00, 0x00, 0xce, 0x01, 0x01, 0x01, 0x00, 0x01, 0xb4, 0x03, 0x02, 0x02, 0x00, 0x11, 0x9b, 0x04, 0x00, 0x02, 0xb5, 0x03, 0x10, 0x0a, 0xd4, 0x01,
+  0x22, 0x9b, 0x07, 0x08, 0x00, 0x00, 0xd9, 0x01, 0x10, 0x9b, 0xd8, 0x01, 0x00, 0x01, 0x00, 0x06, 0xd8, 0x01, 0x00, 0x01, 0x00, 0x01, 0xb5, 0x03,
+  0x00, 0x01, 0x00, 0x00, 0x2c, 0x0b, 0x00, 0x08, 0x0d, 0x00, 0x73, 0x07, 0x03, 0xdb, 0x01, 0x00, 0xd9, 0x01, 0x10, 0x11, 0x7b, 0x07, 0x04, 0x01,
+  0x00, 0x00, 0x13, 0x0d, 0x10, 0x17, 0xe0, 0x06, 0x00, 0xd5, 0x01, 0x05, 0x02, 0x00, 0x01, 0xdc, 0x01, 0x04, 0xe4, 0x01, 0x00, 0x02, 0x00, 0x02,
+  0x01, 0x00, 0x10, 0x20, 0x05, 0x00, 0x02, 0xe0, 0x01, 0x10, 0x43, 0x05, 0x00, 0x00, 0x96, 0x05, 0x11, 0x32, 0xe2, 0x01, 0x00, 0x02, 0x00, 0x20,
+  0x20, 0x8d, 0x01, 0x00, 0x10, 0x02, 0x5c, 0x0b, 0x00, 0xe0, 0x01, 0x00, 0xbc, 0x03, 0x01, 0x02, 0x00, 0x21, 0x32, 0x25, 0xde, 0x01, 0x01, 0xdf,
+  0x01, 0x31, 0x25, 0x8f, 0x89, 0xde, 0x01, 0x00, 0x02, 0x00, 0x10, 0x89, 0xea, 0x01, 0xf0, 0x08, 0x89, 0x85, 0x86, 0x86, 0x85, 0x83, 0x85, 0x85,
+  0x85, 0x80, 0x85, 0x85, 0x80, 0x80, 0x82, 0x85, 0x81, 0x91, 0x10, 0x17, 0x10, 0x98, 0x8c, 0xee, 0x01, 0xf0, 0x0c, 0x81, 0x8f, 0x11, 0x17, 0x20,
+  0x10, 0x0d, 0x17, 0x1e, 0x1b, 0x1e, 0x15, 0x0c, 0x0c, 0x0d, 0x9a, 0x0d, 0x14, 0x17, 0x1e, 0x20, 0x18, 0x20, 0x1e, 0x1e, 0x20, 0x25, 0xc1, 0x03,
+  0xf6, 0x07, 0x14, 0x1e, 0x0c, 0x0a, 0x1b, 0x07, 0x9d, 0x92, 0x7c, 0x76, 0x74, 0x76, 0x78, 0x7b, 0x98, 0x10, 0x15, 0x92, 0x76, 0x70, 0x76, 0x72,
+  0x97, 0x05, 0x00, 0x01, 0x00, 0x00, 0xdc, 0x01, 0x00, 0x01, 0x00, 0x07, 0xde, 0x01, 0x00, 0x9c, 0x05, 0x01, 0xb3, 0x03, 0x01, 0xdf, 0x01, 0x0f,
+  0xde, 0x01, 0x02, 0x00, 0x01, 0x00, 0x00, 0xaf, 0x03, 0x11, 0x92, 0x89, 0x05, 0x00, 0x02, 0x00, 0x02, 0xe2, 0x01, 0x01, 0x02, 0x00, 0x03, 0xd2,
+  0x01, 0x12, 0x8c, 0xe2, 0x01, 0x00, 0x01, 0x00, 0x01, 0xce, 0x01, 0x00, 0x07, 0x00, 0x30, 0x98, 0x92, 0x98, 0x07, 0x00, 0x00, 0xb8, 0x03, 0x03,
+  0xac, 0x03, 0x40, 0x98, 0x9a, 0x97, 0x98, 0x6b, 0x07, 0x00, 0x0a, 0x00, 0x01, 0x01, 0x00, 0x02, 0xe2, 0x01, 0x01, 0xdb, 0x01, 0x42, 0x9a, 0x9b,
+  0x07, 0x9b, 0x03, 0x00, 0x01, 0x02, 0x00, 0x01, 0xb7, 0x03, 0x02, 0xd3, 0x01, 0x01, 0xba, 0x03, 0x04, 0x01, 0x00, 0x01, 0x46, 0x09, 0x01, 0xe2,
+  0x01, 0x08, 0x01, 0x00, 0x00, 0xb1, 0x03, 0x00, 0x02, 0x00, 0x01, 0x05, 0x00, 0x40, 0x11, 0x11, 0x11, 0x0c, 0xd7, 0x01, 0x01, 0xdd, 0x01, 0x01,
+  0x05, 0x00, 0x02, 0xe1, 0x01, 0x01, 0x05, 0x00, 0x00, 0x73, 0x07, 0x02, 0xb3, 0x03, 0x02, 0x02, 0x00, 0x01, 0xcf, 0x01, 0x00, 0x02, 0x00, 0x20,
+  0x1e, 0x1b, 0x05, 0x00, 0x0c, 0x01, 0x00, 0x40, 0x20, 0x25, 0x1e, 0x20, 0xda, 0x01, 0x00, 0xd5, 0x01, 0x03, 0x01, 0x00, 0x01, 0x9d, 0x05, 0x60,
+  0x32, 0x3f, 0x32, 0x32, 0x8f, 0x8f, 0xe0, 0x01, 0x14, 0x1e, 0xda, 0x01, 0x01, 0x65, 0x09, 0x00, 0xd9, 0x01, 0x00, 0x11, 0x00, 0x00, 0x0e, 0x00,
+  0xa0, 0x32, 0x2c, 0x29, 0x11, 0x89, 0x02, 0x86, 0x89, 0x89, 0x89, 0xdd, 0x01, 0x00, 0xe9, 0x01, 0x00, 0x04, 0x00, 0x40, 0x87, 0x85, 0x86, 0x85,
+  0xb4, 0x05, 0x10, 0x86, 0xe4, 0x01, 0x80, 0x83, 0x85, 0x86, 0x89, 0x9b, 0x10, 0x9d, 0x8c, 0xdf, 0x01, 0xf1, 0x07, 0x85, 0x0d, 0x1b, 0x20, 0x1e,
+  0x1b, 0x9b, 0x97, 0x17, 0x1e, 0x20, 0x0c, 0x11, 0x17, 0x0c, 0x97, 0x0c, 0x17, 0x17, 0x20, 0x1e, 0x17, 0xc2, 0x03, 0x21, 0x1e, 0x1e, 0x76, 0x09,
+  0xf0, 0x01, 0x17, 0x17, 0x9b, 0x9d, 0x0d, 0x92, 0x7c, 0x74, 0x75, 0x76, 0x75, 0x8c, 0x0d, 0x15, 0x9d, 0x75, 0xd3, 0x01, 0x06, 0x01, 0x00, 0x10,
+  0x7b, 0x02, 0x00, 0x07, 0xdd, 0x01, 0x00, 0x02, 0x00, 0x02, 0xdd, 0x01, 0x00, 0xdf, 0x01, 0x0b, 0xda, 0x01, 0x10, 0x92, 0x05, 0x00, 0x02, 0x01,
+  0x00, 0x12, 0x8f, 0x04, 0x00, 0x0c, 0xb2, 0x03, 0x40, 0x91, 0x92, 0x8c, 0x8f, 0xcf, 0x01, 0x0a, 0x01, 0x00, 0x00, 0xdb, 0x01, 0x00, 0xda, 0x01,
+  0x02, 0xbb, 0x03, 0x00, 0x02, 0x00, 0x01, 0x05, 0x00, 0x00, 0xb0, 0x03, 0x02, 0x06, 0x00, 0x20, 0x9a, 0x98, 0xcb, 0x01, 0x06, 0x02, 0x00, 0x20,
+  0x07, 0x9b, 0x8e, 0x05, 0x00, 0x08, 0x00, 0x00, 0x06, 0x0d, 0x03, 0x02, 0x00, 0x40, 0x0a, 0x9b, 0x07, 0x9d, 0xb5, 0x03, 0x00, 0xe3, 0x01, 0x20,
+  0x07, 0x9d, 0xd7, 0x01, 0x03, 0xda, 0x01, 0x02, 0x06, 0x00, 0x01, 0x6e, 0x07, 0x06, 0x01, 0x00, 0x01, 0xd4, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01,
+  0x00, 0x05, 0xd8, 0x01, 0x01, 0xd4, 0x01, 0x07, 0x01, 0x00, 0x00, 0xdc, 0x01, 0x06, 0xbc, 0x03, 0x01, 0xd9, 0x01, 0x04, 0x02, 0x00, 0x05, 0x01,
+  0x00, 0x04, 0x0b, 0x00, 0x00, 0x59, 0x01, 0x00, 0x02, 0x00, 0x00, 0xd5, 0x01, 0x01, 0xd8, 0x01, 0x04, 0x02, 0x00, 0x00, 0xc9, 0x03, 0xe0, 0x32,
+  0x3f, 0x32, 0x97, 0x8f, 0x8f, 0x8d, 0x8f, 0x8d, 0x20, 0x32, 0x37, 0x32, 0x3f, 0xd2, 0x01, 0x02, 0xd4, 0x01, 0x00, 0x01, 0x00, 0x02, 0xd0, 0x03,
+  0xf2, 0x02, 0x2c, 0x29, 0x29, 0x25, 0x97, 0x02, 0x89, 0x89, 0x02, 0x87, 0x02, 0x89, 0x02, 0x89, 0x02, 0x87, 0x8b, 0xdf, 0x01, 0x00, 0xaf, 0x05,
+  0x01, 0xee, 0x01, 0x00, 0xe2, 0x01, 0x10, 0x85, 0xed, 0x01, 0x10, 0x8c, 0x09, 0x00, 0xa0, 0x80, 0x80, 0x98, 0x0c, 0x1b, 0x1e, 0x1b, 0x9d, 0x86,
+  0x97, 0xd3, 0x01, 0x61, 0x17, 0x17, 0x17, 0x9a, 0x8b, 0x92, 0x89, 0x00, 0x00, 0xa1, 0x05, 0x60, 0x20, 0x1e, 0x1b, 0x14, 0x0c, 0x0c, 0xd1, 0x03,
+  0xf0, 0x01, 0x17, 0x92, 0x98, 0x9b, 0x85, 0x7b, 0x85, 0x8c, 0x92, 0x0d, 0x15, 0x0d, 0x8c, 0x8c, 0x98, 0x7b, 0xd9, 0x01, 0x02, 0x01, 0x00, 0x00,
+  0xdf, 0x01, 0x01, 0x98, 0x05, 0x0f, 0xdf, 0x01, 0x00, 0x0f, 0x01, 0x00, 0x01, 0x04, 0xe2, 0x01, 0x01, 0xd1, 0x01, 0x04, 0xb2, 0x03, 0x00, 0x82,
+  0x05, 0x00, 0xdd, 0x01, 0x02, 0x05, 0x00, 0x0a, 0x01, 0x00, 0x00, 0xd9, 0x01, 0x00, 0x02, 0x00, 0x20, 0x98, 0x92, 0xd1, 0x01, 0x12, 0x97, 0x06,
+  0x00, 0x02, 0xd5, 0x01, 0x02, 0x02, 0x00, 0x00, 0xdc, 0x01, 0x01, 0xde, 0x01, 0x12, 0x97, 0xda, 0x01, 0x01, 0x66, 0x07, 0x00, 0x03, 0x00, 0x00,
+  0xd9, 0x01, 0x01, 0xd8, 0x01, 0x00, 0x02, 0x00, 0x11, 0x0a, 0xdd, 0x01, 0x41, 0x9d, 0x07, 0x0a, 0x9d, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0xd8,
+  0x01, 0x03, 0x05, 0x00, 0x02, 0xdf, 0x01, 0x06, 0x01, 0x00, 0x12, 0x11, 0x05, 0x00, 0x02, 0x02, 0x00, 0x11, 0x14, 0x04, 0x00, 0x00, 0xd5, 0x01,
+  0x01, 0x02, 0x00, 0x03, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x93, 0x05, 0x04, 0x02, 0x00, 0x02, 0xd9, 0x01, 0x01, 0xbb, 0x03, 0x01, 0x33, 0x0b,
+  0x00, 0x02, 0x00, 0x0c, 0x01, 0x00, 0x00, 0xd7, 0x01, 0x01, 0x02, 0x00, 0x6a, 0x25, 0x20, 0x25, 0x20, 0x3f, 0x34, 0xdf, 0x01, 0x00, 0xe1, 0x01,
+  0x00, 0x06, 0x00, 0x40, 0x07, 0x8f, 0x8f, 0x8f, 0xe0, 0x01, 0x03, 0xcf, 0x01, 0x01, 0x02, 0x00, 0x30, 0x32, 0x2c, 0x29, 0x0d, 0x00, 0x80, 0x32,
+  0x32, 0x29, 0x32, 0x29, 0x32, 0x25, 0x1b, 0xda, 0x01, 0x51, 0x89, 0x8b, 0x89, 0x02, 0x8d, 0x09, 0x00, 0x00, 0xcb, 0x03, 0x01, 0x05, 0x00, 0x01,
+  0xe1, 0x01, 0x00, 0xdb, 0x01, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x0c, 0x8b, 0x8c, 0x8b, 0x89, 0x9b, 0x98, 0x17, 0x1b, 0x1b, 0x11, 0x92,
+  0x9a, 0x17, 0x17, 0x20, 0x17, 0x1e, 0x1b, 0x11, 0x0d, 0x97, 0x9b, 0x9b, 0x17, 0x20, 0x20, 0x20, 0x5a, 0x09, 0xf4, 0x09, 0x1e, 0x1e, 0x1b, 0x11,
+  0x0c, 0x14, 0x17, 0x0d, 0x17, 0x17, 0x94, 0x0d, 0x9d, 0x98, 0x78, 0x8c, 0x9b, 0x8c, 0x92, 0x9d, 0x85, 0x7c, 0x82, 0x90, 0xe0, 0x01, 0x00, 0xdd,
+  0x01, 0x03, 0xbc, 0x03, 0x01, 0xdf, 0x01, 0x02, 0xdc, 0x01, 0x00, 0xdb, 0x01, 0x0b, 0xdd, 0x01, 0x07, 0xa6, 0x03, 0x01, 0x05, 0x00, 0x00, 0xd8,
+  0x01, 0x00, 0xac, 0x10, 0x00, 0xd0, 0x01, 0x00, 0x04, 0x00, 0x0f, 0x01, 0x00, 0x07, 0x20, 0x97, 0x92, 0x91, 0x05, 0x20, 0x97, 0x98, 0x03, 0x00,
+  0x00, 0x01, 0x00, 0x03, 0xdb, 0x01, 0x11, 0x9b, 0xd9, 0x01, 0x05, 0x84, 0x05, 0x04, 0x02, 0x00, 0x16, 0x9b, 0xd1, 0x01, 0x01, 0x05, 0x00, 0x01,
+  0x02, 0x00, 0x20, 0x07, 0x9d, 0x02, 0x00, 0x00, 0xc8, 0x01, 0x35, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x1d, 0x0b, 0x10, 0x9d, 0xdf, 0x01, 0x00,
+  0xcb, 0x01, 0x01, 0x05, 0x00, 0x05, 0x01, 0x00, 0x17, 0x0d, 0xdd, 0x01, 0x09, 0xbe, 0x03, 0x00, 0x02, 0x00, 0x02, 0xda, 0x01, 0x01, 0xdd, 0x01,
+  0x01, 0x04, 0x00, 0x00, 0xd3, 0x01, 0x32, 0x17, 0x18, 0x14, 0xd6, 0x01, 0x00, 0x05, 0x00, 0x06, 0x02, 0x00, 0x06, 0xb4, 0x03, 0x02, 0xdb, 0x01,
+  0x02, 0x06, 0x00, 0x01, 0x02, 0x00, 0x52, 0x20, 0x1e, 0x20, 0x32, 0x3f, 0xe2, 0x01, 0x01, 0xd5, 0x01, 0x02, 0xdd, 0x01, 0x00, 0x04, 0x00, 0x80,
+  0x32, 0x14, 0x94, 0x8f, 0x94, 0x8f, 0x8f, 0x1e, 0xce, 0x01, 0x00, 0x01, 0x00, 0x10, 0x29, 0xdb, 0x01, 0x24, 0x29, 0x32, 0x10, 0x00, 0x51, 0x2c,
+  0x29, 0x29, 0x29, 0x07, 0xc3, 0x05, 0x20, 0x8d, 0x8d, 0x06, 0x00, 0x40, 0x89, 0x02, 0x89, 0x8d, 0xec, 0x01, 0x04, 0xdf, 0x01, 0x00, 0x09, 0x00,
+  0x01, 0x08, 0x00, 0xf0, 0x12, 0x85, 0x86, 0x89, 0x86, 0x98, 0x9d, 0x0d, 0x8c, 0x98, 0x8f, 0x9d, 0x17, 0x0d, 0x9d, 0x8b, 0x8b, 0x0c, 0x1b, 0x1e,
+  0x20, 0x17, 0x11, 0x17, 0x17, 0x9b, 0x8c, 0x86, 0x0a, 0x17, 0x1e, 0x20, 0x17, 0x97, 0xa8, 0x14, 0x50, 0x0c, 0x11, 0x17, 0x17, 0x17, 0xe0, 0x01,
+  0x60, 0x15, 0x15, 0x0d, 0x98, 0x7c, 0x81, 0x9f, 0x01, 0x61, 0x82, 0x7d, 0x92, 0x98, 0x7b, 0x78, 0x4b, 0x18, 0x09, 0xdc, 0x01, 0x00, 0xdf, 0x01,
+  0x01, 0x01, 0x00, 0x0c, 0xde, 0x01, 0x00, 0xce, 0x01, 0x0d, 0x02, 0x00, 0x0f, 0x01, 0x00, 0x0d, 0x00, 0x65, 0x07, 0x00, 0x8f, 0x05, 0x03, 0x91,
+  0x05, 0x21, 0x98, 0x97, 0xe5, 0x01, 0x01, 0xdb, 0x01, 0x00, 0x02, 0x00, 0x01, 0xcd, 0x01, 0x20, 0x9a, 0x98, 0x05, 0x00, 0x00, 0xd6, 0x01, 0x00,
+  0xd9, 0x01, 0x00, 0x04, 0x00, 0x02, 0xd5, 0x01, 0x01, 0x05, 0x00, 0x13, 0x07, 0x0e, 0x00, 0x10, 0x9d, 0x24, 0x0b, 0x00, 0xb9, 0x03, 0x00, 0xb6,
+  0x03, 0x03, 0x02, 0x00, 0x24, 0x0c, 0x9d, 0xd3, 0x01, 0x12, 0x0a, 0xcd, 0x01, 0x08, 0x01, 0x00, 0x15, 0x0d, 0xdc, 0x01, 0x60, 0x0d, 0x11, 0x11,
+  0x0d, 0x14, 0x0d, 0x07, 0x00, 0x00, 0xdd, 0x01, 0x11, 0x0d, 0xe1, 0x01, 0x24, 0x14, 0x17, 0x05, 0x00, 0x00, 0xb4, 0x03, 0x03, 0x02, 0x00, 0x00,
+  0xd7, 0x01, 0x09, 0xd9, 0x01, 0x04, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0xd7, 0x01, 0x01, 0x01, 0x00, 0x01, 0xd8, 0x01, 0xb0, 0x25, 0x20, 0x20,
+  0x25, 0x20, 0x1e, 0x20, 0x25, 0x20, 0x20, 0x20, 0xc8, 0x34, 0x3f, 0x32, 0x3f, 0x3f, 0x3a, 0x3f, 0x3f, 0x34, 0x3f, 0x3f, 0x32, 0x02, 0x00, 0xf0,
+  0x09, 0x20, 0x8f, 0x94, 0x94, 0x91, 0x03, 0x1b, 0x32, 0x32, 0x2e, 0x32, 0x29, 0x32, 0x29, 0x32, 0x2c, 0x32, 0x32, 0x2c, 0x32, 0x2c, 0x32, 0x11,
+  0x32, 0x01, 0x00, 0xf4, 0x07, 0x29, 0x29, 0x29, 0x2c, 0x29, 0x20, 0x97, 0x8f, 0x8b, 0x8f, 0x8d, 0x8f, 0x8b, 0x8f, 0x8f, 0x8f, 0x8f, 0x8d, 0x8f,
+  0x89, 0x8d, 0x8b, 0x02, 0x00, 0x12, 0x89, 0x02, 0x00, 0x22, 0x86, 0x89, 0x01, 0x00, 0xf0, 0x30, 0x86, 0x8f, 0x9d, 0x14, 0x10, 0x97, 0x92, 0x8b,
+  0x97, 0x1b, 0x07, 0x9d, 0x8b, 0x9b, 0x0d, 0x20, 0x1b, 0x20, 0x1b, 0x15, 0x15, 0x9d, 0x86, 0x86, 0x97, 0x10, 0x17, 0x1b, 0x1e, 0x1b, 0x11, 0x14,
+  0x1b, 0x20, 0x1e, 0x1b, 0x14, 0x17, 0x1e, 0x1b, 0x14, 0x15, 0x17, 0x10, 0x98, 0x0d, 0x15, 0x10, 0x81, 0x7d, 0x8c, 0x10, 0x8b, 0x82, 0x92, 0x9b,
+  0x10, 0x9d, 0x82, 0x7c, 0x7b, 0x76, 0x7b, 0x01, 0x00, 0x12, 0x82, 0x02, 0x00, 0x02, 0x01, 0x00, 0x52, 0x85, 0x82, 0x85, 0x85, 0x8c, 0x02, 0x00,
+  0x04, 0x01, 0x00, 0x14, 0x92, 0x02, 0x00, 0x02, 0x05, 0x00, 0x02, 0x01, 0x00, 0x0a, 0x0e, 0x00, 0x0c, 0x01, 0x00, 0x32, 0x98, 0x92, 0x98, 0x05,
+  0x00, 0x03, 0x07, 0x00, 0x30, 0x97, 0x92, 0x98, 0x01, 0x00, 0x10, 0x97, 0x05, 0x00, 0x85, 0x98, 0x98, 0x9b, 0x98, 0x9b, 0x97, 0x9b, 0x9a, 0x02,
+  0x00, 0x22, 0x9b, 0x9b, 0x05, 0x00, 0x03, 0x01, 0x00, 0x13, 0x07, 0x02, 0x00, 0x14, 0x0a, 0x02, 0x00, 0x71, 0x9d, 0x07, 0x9d, 0x07, 0x9d, 0x0a,
+  0x9d, 0x08, 0x00, 0x30, 0x0a, 0x0a, 0x0c, 0x03, 0x00, 0x30, 0x0c, 0x0c, 0x0c, 0x09, 0x00, 0x20, 0x0a, 0x0d, 0x0a, 0x00, 0x08, 0x01, 0x00, 0x13,
+  0x0d, 0x02, 0x00, 0x92, 0x11, 0x0c, 0x11, 0x0c, 0x0c, 0x0d, 0x11, 0x0d, 0x11, 0x01, 0x00, 0x40, 0x0d, 0x14, 0x11, 0x14, 0x08, 0x00, 0x01, 0x05,
+  0x00, 0x21, 0x17, 0x14, 0x03, 0x00, 0x35, 0x11, 0x17, 0x14, 0x02, 0x00, 0x1b, 0x18, 0x02, 0x00, 0x10, 0x1e, 0x02, 0x00, 0x11, 0x1e, 0x04, 0x00,
+  0x76, 0x1e, 0x1e, 0x1b, 0x1e, 0x1e, 0x1e, 0x20, 0x02, 0x00, 0x00, 0x03, 0x00, 0x11, 0x25, 0x02, 0x00, 0x60, 0x20, 0x25, 0x20, 0x32, 0x3f, 0x34,
+  0xdc, 0x01, 0x01, 0xe2, 0x01, 0x30, 0x2e, 0x3f, 0x2e, 0xdb, 0x01, 0xe0, 0x3f, 0x2e, 0x3f, 0x34, 0x37, 0x29, 0x97, 0x94, 0x94, 0x94, 0x94, 0x17,
+  0x32, 0x2e, 0xd1, 0x01, 0x00, 0xe3, 0x01, 0x51, 0x2c, 0x29, 0x29, 0x32, 0x20, 0xe0, 0x01, 0x10, 0x29, 0xe1, 0x01, 0x70, 0x20, 0x17, 0x8f, 0x8f,
+  0x91, 0x8f, 0x91, 0xde, 0x01, 0x00, 0x01, 0x00, 0x71, 0x8b, 0x8d, 0x8c, 0x8f, 0x91, 0x8b, 0x91, 0xe1, 0x01, 0x02, 0x02, 0x00, 0x41, 0x89, 0x8b,
+  0x89, 0x89, 0xe9, 0x01, 0xf1, 0x2d, 0x92, 0x15, 0x17, 0x0d, 0x98, 0x9b, 0x8f, 0x92, 0x1b, 0x17, 0x9b, 0x9b, 0x8b, 0x0a, 0x1b, 0x20, 0x1b, 0x0a,
+  0x89, 0x92, 0x89, 0x86, 0x8b, 0x10, 0x0a, 0x0d, 0x17, 0x15, 0x14, 0x17, 0x15, 0x17, 0x17, 0x1b, 0x1e, 0x17, 0x14, 0x1b, 0x17, 0x0d, 0x0d, 0x97,
+  0x81, 0x85, 0x9b, 0x10, 0x15, 0x10, 0x10, 0x10, 0x15, 0x98, 0x8c, 0x85, 0x9d, 0x15, 0x9b, 0x7d, 0x8c, 0x85, 0xd8, 0x01, 0x30, 0x7c, 0x82, 0x7c,
+  0xd9, 0x01, 0x00, 0x01, 0x00, 0x10, 0x85, 0x01, 0x00, 0x10, 0x8c, 0x03, 0x00, 0x00, 0xd8, 0x01, 0x01, 0x01, 0x00, 0x01, 0xc6, 0x01, 0x02, 0x02,
+  0x00, 0x01, 0x05, 0x00, 0x02, 0xd3, 0x01, 0x02, 0x06, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x03, 0xd0, 0x01, 0x07, 0x02, 0x00, 0x04, 0xd7, 0x01, 0x11,
+  0x97, 0x07, 0x00, 0x11, 0x9a, 0x02, 0x00, 0x10, 0x9b, 0x02, 0x00, 0x02, 0xd4, 0x01, 0x11, 0x9a, 0x03, 0x00, 0x0c, 0x01, 0x00, 0x35, 0x07, 0x9b,
+  0x9d, 0xe3, 0x01, 0x00, 0xd7, 0x01, 0x00, 0xe1, 0x01, 0x30, 0x07, 0x0c, 0x0a, 0xe5, 0x01, 0x40, 0x0a, 0x9d, 0x0c, 0x9d, 0xca, 0x01, 0x04, 0x01,
+  0x00, 0x13, 0x0d, 0x05, 0x00, 0x00, 0xd6, 0x01, 0x11, 0x0d, 0xd3, 0x01, 0x22, 0x0d, 0x11, 0xe1, 0x01, 0x05, 0x01, 0x00, 0x11, 0x0d, 0xd7, 0x01,
+  0x00, 0xe3, 0x01, 0x00, 0xd5, 0x01, 0x00, 0xd0, 0x01, 0x01, 0xdc, 0x01, 0x00, 0x09, 0x00, 0x42, 0x14, 0x17, 0x17, 0x17, 0x05, 0x00, 0x04, 0x01,
+  0x00, 0x20, 0x1e, 0x1b, 0xdd, 0x01, 0x01, 0x08, 0x00, 0x02, 0x02, 0x00, 0x10, 0x20, 0xe4, 0x01, 0x01, 0x01, 0x00, 0x22, 0x20, 0x25, 0xe1, 0x01,
+  0x30, 0x25, 0x20, 0x20, 0x05, 0x00, 0x60, 0x25, 0x20, 0x20, 0x29, 0x34, 0x32, 0xda, 0x01, 0x10, 0x3a, 0xe1, 0x01, 0x00, 0xdb, 0x01, 0x05, 0x02,
+  0x00, 0x20, 0x32, 0x07, 0xe1, 0x01, 0x30, 0x11, 0x2e, 0x32, 0x02, 0x00, 0x20, 0x29, 0x2c, 0xd4, 0x01, 0x43, 0x25, 0x29, 0x1b, 0x17, 0xdf, 0x01,
+  0x80, 0x25, 0x29, 0x20, 0x07, 0x8f, 0x92, 0x8f, 0x94, 0xdb, 0x01, 0x00, 0xe4, 0x01, 0x01, 0xea, 0x01, 0xf0, 0x04, 0x8d, 0x8f, 0x8f, 0x8f, 0x8c,
+  0x8f, 0x8b, 0x8f, 0x8b, 0x8d, 0x8b, 0x8f, 0x8c, 0x8d, 0x8b, 0x89, 0x8c, 0x8b, 0x8c, 0xe1, 0x01, 0xf0, 0x0b, 0x8b, 0x92, 0x98, 0x8c, 0x9b, 0x9b,
+  0x9b, 0x17, 0x1b, 0x17, 0x0d, 0x9b, 0x8b, 0x0d, 0x1e, 0x1b, 0x0d, 0x98, 0x8b, 0x86, 0x8b, 0x8b, 0x9d, 0x17, 0x9d, 0x07, 0xdf, 0x01, 0xf5, 0x13,
+  0x0d, 0x8c, 0x97, 0x17, 0x20, 0x17, 0x9b, 0x17, 0x98, 0x9d, 0x9b, 0x8b, 0x8c, 0x92, 0x9d, 0x9b, 0x9d, 0x9b, 0x98, 0x10, 0x9b, 0x98, 0x98, 0x86,
+  0x9d, 0x10, 0x85, 0x85, 0x8b, 0x8c, 0x7d, 0x82, 0x82, 0x8c, 0xdd, 0x01, 0x02, 0xbc, 0x03, 0x00, 0xe1, 0x01, 0x04, 0x01, 0x00, 0x01, 0xcf, 0x01,
+  0x00, 0xcb, 0x01, 0x00, 0x04, 0x00, 0x0f, 0x01, 0x00, 0x06, 0x00, 0xc6, 0x01, 0x03, 0x07, 0x00, 0x05, 0x02, 0x00, 0x0b, 0x01, 0x00, 0x30, 0x97,
+  0x98, 0x9a, 0xdb, 0x01, 0x21, 0x98, 0x9a, 0xd9, 0x01, 0x00, 0x02, 0x00, 0x0c, 0x01, 0x00, 0x00, 0xce, 0x01, 0x01, 0xd1, 0x01, 0x00, 0x09, 0x00,
+  0x01, 0x02, 0x00, 0x01, 0xd5, 0x01, 0x00, 0xb8, 0x03, 0x02, 0x06, 0x00, 0x03, 0x02, 0x00, 0x00, 0xcd, 0x01, 0x02, 0xc0, 0x03, 0x01, 0x01, 0x00,
+  0x00, 0xdd, 0x01, 0x40, 0x0d, 0x0c, 0x0d, 0x0d, 0xdb, 0x01, 0x01, 0xd6, 0x01, 0x01, 0x03, 0x00, 0x41, 0x0d, 0x0c, 0x11, 0x11, 0xea, 0x01, 0x00,
+  0x01, 0x00, 0x02, 0xd7, 0x01, 0x02, 0xb3, 0x03, 0x13, 0x14, 0xd4, 0x01, 0x04, 0x02, 0x00, 0x03, 0x01, 0x00, 0x00, 0xcf, 0x01, 0x11, 0x18, 0x08,
+  0x00, 0x07, 0x02, 0x00, 0x00, 0xdb, 0x01, 0x00, 0x02, 0x00, 0x01, 0xe2, 0x01, 0x00, 0xd6, 0x01, 0x00, 0xb9, 0x03, 0x00, 0xe3, 0x01, 0x00, 0xde,
+  0x01, 0x02, 0x06, 0x00, 0x00, 0xc0, 0x03, 0x11, 0x2e, 0xe1, 0x01, 0xc1, 0x34, 0x3f, 0x3a, 0x32, 0x3a, 0x37, 0x3a, 0x37, 0x3a, 0x32, 0x34, 0x37,
+  0x02, 0x00, 0x72, 0x32, 0x0d, 0x95, 0x04, 0x94, 0x97, 0x11, 0xc0, 0x03, 0x01, 0xbf, 0x03, 0x50, 0x25, 0x29, 0x29, 0x11, 0x20, 0x0d, 0x00, 0x00,
+  0x01, 0x00, 0xa1, 0x20, 0x20, 0x97, 0x94, 0x94, 0x91, 0x94, 0x91, 0x94, 0x8f, 0x02, 0x00, 0x61, 0x92, 0x8f, 0x92, 0x8f, 0x91, 0x92, 0xe7, 0x01,
+  0x10, 0x8c, 0xeb, 0x01, 0x00, 0x07, 0x00, 0xf0, 0x33, 0x8c, 0x8f, 0x8c, 0x8d, 0x8c, 0x8f, 0x8c, 0x8b, 0x8b, 0x8b, 0x8b, 0x8f, 0x8b, 0x9b, 0x10,
+  0x20, 0x1b, 0x1b, 0x1b, 0x15, 0x11, 0x17, 0x1b, 0x1b, 0x17, 0x15, 0x8b, 0x89, 0x86, 0x9b, 0x15, 0x15, 0x17, 0x15, 0x11, 0x10, 0x17, 0x17, 0x98,
+  0x8b, 0x97, 0x0d, 0x17, 0x1b, 0x07, 0x0d, 0x86, 0x86, 0x92, 0x81, 0x98, 0x92, 0x8c, 0x98, 0x85, 0x81, 0x85, 0x92, 0x98, 0x9d, 0x9b, 0x9b, 0x98,
+  0x8b, 0x8b, 0x9b, 0x6c, 0x03, 0x20, 0x8c, 0x8c, 0xd9, 0x01, 0x00, 0xdc, 0x01, 0x01, 0x01, 0x00, 0x01, 0x98, 0x05, 0x00, 0x02, 0x00, 0x04, 0x01,
+  0x00, 0x00, 0xba, 0x01, 0x0f, 0x01, 0x00, 0x0a, 0x01, 0xcf, 0x01, 0x08, 0x02, 0x00, 0x0f, 0x01, 0x00, 0x03, 0x14, 0x9b, 0xb6, 0x03, 0x00, 0x02,
+  0x00, 0x0b, 0x01, 0x00, 0x00, 0xcf, 0x01, 0x01, 0x07, 0x00, 0x40, 0x9d, 0x9b, 0x9b, 0x9b, 0x83, 0x02, 0x15, 0x9b, 0xd2, 0x01, 0x04, 0x08, 0x00,
+  0x00, 0xb6, 0x03, 0x00, 0xd5, 0x01, 0x41, 0x0a, 0x9d, 0x0c, 0x0c, 0xc0, 0x03, 0x10, 0x9d, 0xdb, 0x01, 0x00, 0xca, 0x01, 0x00, 0x07, 0x00, 0x00,
+  0x01, 0x00, 0x01, 0xd0, 0x01, 0x11, 0x0d, 0x05, 0x00, 0x01, 0x02, 0x00, 0x03, 0x01, 0x00, 0x01, 0xba, 0x03, 0x01, 0x01, 0x00, 0x11, 0x14, 0xe1,
+  0x01, 0x10, 0x17, 0xc3, 0x03, 0x00, 0x08, 0x00, 0x00, 0xdd, 0x01, 0x00, 0x04, 0x00, 0x03, 0x01, 0x00, 0x01, 0xd3, 0x01, 0x46, 0x17, 0x1b, 0x17,
+  0x1b, 0xd9, 0x01, 0x00, 0x02, 0x00, 0x01, 0xd3, 0x01, 0x00, 0xc2, 0x03, 0x00, 0x05, 0x00, 0x00, 0xd2, 0x01, 0x01, 0x01, 0x00, 0x03, 0xdc, 0x01,
+  0x00, 0xc0, 0x03, 0x41, 0x2e, 0x32, 0x34, 0x32, 0xdf, 0x01, 0x20, 0x3f, 0x3a, 0xd7, 0x01, 0x41, 0x37, 0x2e, 0x37, 0x2e, 0x06, 0x00, 0x71, 0x34,
+  0x17, 0x9a, 0x95, 0x97, 0x95, 0x1b, 0xbe, 0x03, 0x02, 0x02, 0x00, 0x31, 0x29, 0x25, 0x29, 0xcf, 0x03, 0x00, 0x0b, 0x00, 0xb1, 0x20, 0x29, 0x0c,
+  0x97, 0x91, 0x97, 0x94, 0x97, 0x94, 0x92, 0x94, 0x05, 0x00, 0x30, 0x8f, 0x92, 0x94, 0xce, 0x03, 0x00, 0xe7, 0x01, 0x41, 0x8f, 0x92, 0x8f, 0x8c,
+  0x09, 0x00, 0x02, 0x02, 0x00, 0x00, 0xd3, 0x03, 0x70, 0x98, 0x9d, 0x8f, 0x92, 0x9b, 0x17, 0x10, 0x7a, 0x07, 0x60, 0x1b, 0x1b, 0x17, 0x1b, 0x11,
+  0x8b, 0xd4, 0x03, 0xf0, 0x19, 0x92, 0x89, 0x0c, 0x15, 0x17, 0x15, 0x15, 0x15, 0x0d, 0x15, 0x0a, 0x9b, 0x1b, 0x1b, 0x15, 0x0d, 0x8b, 0x8b, 0x8c,
+  0x9d, 0x9d, 0x86, 0x85, 0x81, 0x82, 0x85, 0x81, 0x98, 0x15, 0x1b, 0x15, 0x8b, 0x85, 0x9b, 0x10, 0x98, 0x9b, 0x9d, 0x10, 0x8b, 0xb5, 0x03, 0x00,
+  0x02, 0x00, 0x01, 0x01, 0x00, 0x08, 0xdb, 0x01, 0x03, 0xbb, 0x03, 0x0c, 0x01, 0x00, 0x01, 0xac, 0x03, 0x03, 0x07, 0x00, 0x01, 0xd0, 0x01, 0x00,
+  0x02, 0x00, 0x00, 0x03, 0x00, 0x14, 0x98, 0x06, 0x00, 0x0c, 0x01, 0x00, 0x01, 0xd3, 0x01, 0x21, 0x98, 0x9b, 0x05, 0x00, 0x0f, 0xdc, 0x01, 0x02,
+  0x01, 0x02, 0x00, 0x21, 0x9d, 0x0a, 0xd6, 0x01, 0x01, 0xb8, 0x03, 0x00, 0xd8, 0x01, 0x00, 0x06, 0x00, 0x00, 0x8b, 0x05, 0x00, 0x06, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0xd3, 0x01, 0x02, 0x02, 0x00, 0x01, 0x01, 0x00, 0x00, 0xd9, 0x01, 0x03, 0x02, 0x00, 0x00, 0xd7, 0x01, 0x12, 0x0d, 0x06, 0x00,
+  0x02, 0xd8, 0x01, 0x00, 0x07, 0x00, 0x01, 0x09, 0x00, 0x00, 0x01, 0x00, 0x01, 0xcf, 0x01, 0x05, 0x08, 0x00, 0x01, 0xdb, 0x01, 0x02, 0x01, 0x00,
+  0x04, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0xc1, 0x03, 0x01, 0x07, 0x00, 0x07, 0xb8, 0x03, 0x02, 0xdd, 0x01, 0x00, 0x06, 0x00, 0x11, 0x1b, 0xbb,
+  0x03, 0x00, 0x04, 0x00, 0x00, 0x06, 0x00, 0x02, 0x01, 0x00, 0x01, 0xe3, 0x01, 0x81, 0x20, 0x2c, 0x20, 0x32, 0x2e, 0x37, 0x3a, 0x37, 0xe1, 0x01,
+  0x20, 0x37, 0x34, 0xbc, 0x03, 0x10, 0x32, 0xf1, 0x01, 0x01, 0x04, 0x00, 0x51, 0x04, 0x9a, 0x04, 0x9a, 0x29, 0xd0, 0x01, 0x00, 0x04, 0x00, 0x01,
+  0xb5, 0x03, 0x02, 0xe0, 0x01, 0x00, 0xdf, 0x01, 0x30, 0x20, 0x07, 0x97, 0xdf, 0x01, 0x22, 0x97, 0x95, 0x07, 0x00, 0x01, 0x02, 0x00, 0x10, 0x92,
+  0xee, 0x01, 0x02, 0xec, 0x01, 0x01, 0xd1, 0x03, 0x00, 0xdd, 0x01, 0x00, 0x07, 0x00, 0x30, 0x0d, 0x15, 0x17, 0x3d, 0x01, 0xc0, 0x9d, 0x1b, 0x1b,
+  0x22, 0x14, 0x1b, 0x17, 0x1b, 0x1b, 0x1b, 0x92, 0x8c, 0xb7, 0x05, 0xf0, 0x07, 0x8f, 0x92, 0x9d, 0x17, 0x15, 0x0c, 0x15, 0x1b, 0x17, 0x0d, 0x92,
+  0x0d, 0x1b, 0x1e, 0x17, 0x10, 0x9d, 0x86, 0x9b, 0x9d, 0x8b, 0x8b, 0xc9, 0x01, 0x10, 0x9b, 0xf9, 0x01, 0xa0, 0x98, 0x10, 0x9d, 0x86, 0x92, 0x10,
+  0x0d, 0x98, 0x8c, 0x8b, 0xd9, 0x01, 0x01, 0x01, 0x00, 0x30, 0x8c, 0x85, 0x8b, 0xde, 0x01, 0x00, 0x04, 0x00, 0x20, 0x8c, 0x92, 0x03, 0x00, 0x0b,
+  0x9a, 0x05, 0x01, 0xcb, 0x01, 0x01, 0x02, 0x00, 0x08, 0x0c, 0x00, 0x00, 0xc3, 0x01, 0x0a, 0x01, 0x00, 0x10, 0x9b, 0x05, 0x00, 0x06, 0x01, 0x00,
+  0x01, 0xd7, 0x01, 0x0d, 0xd9, 0x01, 0x01, 0x01, 0x00, 0x12, 0x07, 0xb0, 0x03, 0x01, 0xcf, 0x01, 0x00, 0x02, 0x00, 0x00, 0xd9, 0x01, 0x00, 0xcf,
+  0x01, 0x00, 0xd1, 0x01, 0x02, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0xb5, 0x03, 0x01, 0xca, 0x01, 0x00, 0xad, 0x03, 0x01, 0xae, 0x03, 0x01, 0x0b,
+  0x00, 0x00, 0x09, 0x00, 0x03, 0x01, 0x00, 0x00, 0xd1, 0x01, 0x00, 0x9a, 0x05, 0x0b, 0xdc, 0x01, 0x37, 0x15, 0x14, 0x15, 0xd9, 0x01, 0x40, 0x17,
+  0x11, 0x15, 0x14, 0xd7, 0x01, 0x00, 0xe3, 0x01, 0x08, 0xdd, 0x01, 0x26, 0x17, 0x1b, 0xdb, 0x01, 0x00, 0xc0, 0x03, 0x00, 0x08, 0x00, 0x00, 0x02,
+  0x00, 0x06, 0xd0, 0x01, 0x03, 0x07, 0x00, 0x09, 0x01, 0x00, 0x20, 0x29, 0x25, 0x46, 0x07, 0x10, 0x29, 0xbe, 0x01, 0x30, 0x34, 0x32, 0x2e, 0xe1,
+  0x01, 0x10, 0x3f, 0xdf, 0x01, 0x00, 0x31, 0x0b, 0x00, 0xe1, 0x01, 0x60, 0x2e, 0x2e, 0x1b, 0x07, 0x9b, 0x0a, 0xcf, 0x01, 0x03, 0x02, 0x00, 0x52,
+  0x32, 0x29, 0x29, 0x17, 0x15, 0x10, 0x00, 0xa1, 0x29, 0x29, 0x20, 0x1e, 0x9b, 0x95, 0x97, 0x9a, 0x97, 0x9a, 0xd8, 0x01, 0x13, 0x97, 0x01, 0x00,
+  0x01, 0x09, 0x00, 0x21, 0x94, 0x97, 0xdf, 0x01, 0x00, 0x02, 0x00, 0x10, 0x8f, 0x74, 0x01, 0xb1, 0x8f, 0x92, 0x9a, 0x15, 0x17, 0x15, 0x0d, 0x92,
+  0x9d, 0x15, 0x1b, 0x01, 0x00, 0x60, 0x9b, 0x9b, 0x14, 0x10, 0x8f, 0x8b, 0xb6, 0x05, 0xc1, 0x9d, 0x92, 0x97, 0x15, 0x11, 0x10, 0x0c, 0x15, 0x15,
+  0x0d, 0x8f, 0x0d, 0xb7, 0x05, 0xa0, 0x98, 0x98, 0x0d, 0x10, 0x8c, 0x86, 0x8c, 0x9d, 0x9d, 0x98, 0xbb, 0x03, 0x90, 0x10, 0x10, 0x92, 0x86, 0x92,
+  0x0d, 0x10, 0x98, 0x8c, 0xda, 0x01, 0x01, 0xdd, 0x01, 0x01, 0x02, 0x00, 0x00, 0x01, 0x00, 0x11, 0x92, 0x05, 0x00, 0x09, 0xdd, 0x01, 0x02, 0xc7,
+  0x01, 0x02, 0xa9, 0x03, 0x03, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x0e, 0x01, 0x00, 0x05, 0xdc, 0x01, 0x10, 0x9b, 0x03, 0x00, 0x00, 0x05, 0x00, 0x01,
+  0xdb, 0x01, 0x00, 0x04, 0x00, 0x08, 0x01, 0x00, 0x01, 0xd6, 0x01, 0x32, 0x9b, 0x9d, 0x9d, 0x71, 0x07, 0x01, 0x0c, 0x00, 0x10, 0x0a, 0x10, 0x00,
+  0x02, 0x01, 0x00, 0x00, 0xdb, 0x01, 0x02, 0xdd, 0x01, 0x04, 0x08, 0x00, 0x00, 0xd0, 0x01, 0x00, 0x93, 0x05, 0x03, 0xdc, 0x01, 0x00, 0x03, 0x00,
+  0x01, 0x04, 0x00, 0x00, 0xdc, 0x01, 0x01, 0xd2, 0x01, 0x00, 0xd4, 0x01, 0x00, 0x04, 0x00, 0x04, 0x01, 0x00, 0xa0, 0x15, 0x11, 0x10, 0x11, 0x15,
+  0x11, 0x11, 0x14, 0x14, 0x15, 0x7e, 0x07, 0x03, 0x02, 0x00, 0x01, 0xdf, 0x01, 0x0e, 0x01, 0x00, 0x20, 0x1b, 0x18, 0xcf, 0x01, 0x00, 0xdb, 0x01,
+  0x00, 0x5b, 0x09, 0x00, 0x0c, 0x00, 0x03, 0xdd, 0x01, 0x00, 0xd8, 0x01, 0x02, 0x06, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x81, 0x03, 0x91, 0x25, 0x22,
+  0x25, 0x22, 0x25, 0x29, 0x25, 0x20, 0x29, 0xa1, 0x05, 0x50, 0x2e, 0x34, 0x34, 0x3f, 0x34, 0x0a, 0x00, 0x00, 0xdb, 0x01, 0x00, 0xc8, 0x03, 0xa0,
+  0x2e, 0x2e, 0x32, 0x0d, 0x04, 0x15, 0x32, 0x29, 0x2e, 0x29, 0xd3, 0x01, 0x00, 0xde, 0x01, 0x40, 0x29, 0x29, 0x0a, 0x20, 0x1d, 0x00, 0x00, 0x0a,
+  0x00, 0x30, 0x20, 0x17, 0x9a, 0x01, 0x00, 0x00, 0xe3, 0x01, 0x01, 0x02, 0x00, 0x00, 0x03, 0x00, 0x09, 0x01, 0x00, 0x01, 0xe1, 0x01, 0xf0, 0x1d,
+  0x97, 0x91, 0x97, 0x8f, 0x97, 0x92, 0x97, 0x9b, 0x9a, 0x98, 0x97, 0x92, 0x0d, 0x17, 0x15, 0x0d, 0x9d, 0x97, 0x9d, 0x0d, 0x9b, 0x8f, 0x9b, 0x15,
+  0x92, 0x92, 0x8b, 0x8c, 0x8b, 0x92, 0x15, 0x17, 0x15, 0x17, 0x9b, 0x97, 0x8b, 0x9b, 0x9d, 0x0d, 0x9b, 0x15, 0x17, 0x17, 0x0e, 0x00, 0x60, 0x10,
+  0x0d, 0x9d, 0x9d, 0x9d, 0x92, 0x96, 0x05, 0xd1, 0x9b, 0x86, 0x85, 0x98, 0x10, 0x98, 0x8b, 0x98, 0x98, 0x8b, 0x85, 0x85, 0x8b, 0x02, 0x00, 0x02,
+  0xdd, 0x01, 0x10, 0x8b, 0xda, 0x01, 0x02, 0xdd, 0x01, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x01, 0xc8, 0x01, 0x01, 0xd6, 0x01, 0x00, 0xcf, 0x01,
+  0x00, 0x04, 0x00, 0x0f, 0x01, 0x00, 0x05, 0x00, 0xcf, 0x01, 0x03, 0xd1, 0x01, 0x04, 0x02, 0x00, 0x0f, 0xda, 0x01, 0x00, 0x01, 0xdd, 0x01, 0x01,
+  0x01, 0x00, 0x01, 0xd6, 0x01, 0x00, 0xd4, 0x01, 0x02, 0xc0, 0x03, 0x01, 0xcc, 0x01, 0x02, 0xc1, 0x03, 0x01, 0x01, 0x00, 0x00, 0xd9, 0x01, 0x11,
+  0x0d, 0xd9, 0x01, 0x00, 0x02, 0x00, 0x01, 0xdd, 0x01, 0x02, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0xcd, 0x01, 0x02, 0xb7, 0x03, 0x03, 0x02, 0x00,
+  0x11, 0x10, 0xde, 0x01, 0x30, 0x0d, 0x11, 0x15, 0xd6, 0x01, 0x00, 0xcd, 0x01, 0x00, 0x79, 0x07, 0x20, 0x15, 0x11, 0xd1, 0x01, 0x02, 0x02, 0x00,
+  0x10, 0x11, 0xca, 0x01, 0x21, 0x17, 0x17, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x6f, 0x07, 0x01, 0x02, 0x00, 0x40, 0x1e, 0x17,
+  0x17, 0x1b, 0xd6, 0x01, 0x00, 0x02, 0x00, 0x00, 0x90, 0x05, 0x00, 0xd5, 0x01, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x0b, 0x01, 0x00, 0x10, 0x29,
+  0xbb, 0x03, 0x20, 0x20, 0x20, 0x4f, 0x07, 0x00, 0x02, 0x00, 0x12, 0x0c, 0x82, 0x07, 0x00, 0x9d, 0x05, 0x01, 0xe1, 0x01, 0x00, 0xc2, 0x01, 0x00,
+  0xbe, 0x03, 0x70, 0x32, 0x34, 0x2e, 0x2e, 0x1b, 0x29, 0x2e, 0xdf, 0x01, 0x00, 0xe1, 0x01, 0x01, 0xb6, 0x03, 0x60, 0x0d, 0x29, 0x32, 0x2e, 0x29,
+  0x2e, 0xe0, 0x01, 0x60, 0x29, 0x0d, 0x07, 0x9a, 0x9a, 0x07, 0xe3, 0x01, 0x20, 0x9a, 0x04, 0x05, 0x00, 0x10, 0x97, 0x03, 0x00, 0x00, 0xe5, 0x01,
+  0x01, 0x05, 0x00, 0x00, 0x01, 0x00, 0x10, 0x98, 0x05, 0x00, 0x32, 0x97, 0x97, 0x92, 0x02, 0x00, 0x70, 0x9b, 0x10, 0x0d, 0x9d, 0x9b, 0x10, 0x9b,
+  0xcf, 0x03, 0x80, 0x92, 0x92, 0x9d, 0x9d, 0x92, 0x8b, 0x92, 0x8f, 0xe0, 0x01, 0xf0, 0x10, 0x9b, 0x0d, 0x98, 0x8b, 0x8b, 0x92, 0x92, 0x8b, 0x92,
+  0x9d, 0x0d, 0x98, 0x10, 0x15, 0x10, 0x98, 0x9b, 0x15, 0x15, 0x10, 0x9b, 0x92, 0x98, 0x10, 0x17, 0x16, 0x92, 0x92, 0x9d, 0x0d, 0x15, 0xe6, 0x03,
+  0x00, 0xaa, 0x07, 0x11, 0x8b, 0xdd, 0x01, 0x13, 0x8b, 0xde, 0x01, 0x01, 0x78, 0x07, 0x03, 0xde, 0x01, 0x02, 0xd6, 0x01, 0x02, 0x03, 0x00, 0x0f,
+  0x01, 0x00, 0x08, 0x01, 0xd6, 0x01, 0x09, 0xd1, 0x01, 0x03, 0x0c, 0x00, 0x0e, 0x01, 0x00, 0x00, 0xd3, 0x01, 0x01, 0x06, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0xc7, 0x01, 0x00, 0xda, 0x01, 0x00, 0x09, 0x00, 0x03, 0xd6, 0x01, 0x00, 0x01, 0x00, 0x00, 0xb1, 0x03, 0x00, 0x02, 0x00, 0x00, 0x8e, 0x05,
+  0x02, 0xd1, 0x01, 0x00, 0xb2, 0x03, 0x10, 0x9d, 0x05, 0x00, 0x00, 0xdc, 0x01, 0x00, 0xd8, 0x01, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x01, 0x05,
+  0x00, 0x01, 0x02, 0x00, 0x10, 0x15, 0xcf, 0x01, 0x10, 0x15, 0xbb, 0x03, 0x02, 0x01, 0x00, 0x30, 0x15, 0x14, 0x15, 0x91, 0x05, 0x00, 0x02, 0x00,
+  0x00, 0xcb, 0x01, 0x00, 0xe9, 0x01, 0x07, 0x01, 0x00, 0x00, 0xd6, 0x01, 0x00, 0x05, 0x00, 0x11, 0x1e, 0x03, 0x00, 0x02, 0xbb, 0x03, 0x02, 0x02,
+  0x00, 0x10, 0x17, 0x42, 0x10, 0x21, 0x20, 0x1b, 0xdb, 0x01, 0x04, 0xde, 0x01, 0x00, 0x81, 0x07, 0x01, 0x01, 0x00, 0x10, 0x29, 0x05, 0x00, 0x00,
+  0x07, 0x00, 0x01, 0x9c, 0x05, 0x10, 0x20, 0x94, 0x03, 0x00, 0xe3, 0x0e, 0x00, 0xd9, 0x01, 0x11, 0x3a, 0x06, 0x00, 0x40, 0x34, 0x32, 0x2e, 0x2e,
+  0xd2, 0x01, 0x00, 0xe9, 0x01, 0x00, 0x12, 0x00, 0x00, 0xcf, 0x01, 0x11, 0x2e, 0xdf, 0x01, 0x44, 0x32, 0x29, 0x1b, 0x1b, 0xde, 0x01, 0x55, 0x29,
+  0x20, 0x0c, 0x07, 0x9a, 0x02, 0x00, 0x10, 0x9b, 0x05, 0x00, 0x00, 0x08, 0x10, 0x01, 0xea, 0x01, 0x11, 0x9b, 0xeb, 0x01, 0x01, 0xdf, 0x01, 0x01,
+  0x05, 0x00, 0x01, 0x01, 0x00, 0x10, 0x0d, 0x69, 0x07, 0x30, 0x1b, 0x98, 0x97, 0x94, 0x01, 0xf0, 0x02, 0x8f, 0x92, 0x0d, 0x9d, 0x92, 0x8f, 0x98,
+  0x97, 0x15, 0x17, 0x15, 0x97, 0x10, 0x92, 0x8b, 0x8f, 0x8c, 0xcb, 0x01, 0x00, 0xfb, 0x10, 0x50, 0x15, 0x92, 0x8b, 0x9d, 0x10, 0xe2, 0x01, 0xf0,
+  0x01, 0x15, 0x15, 0x1b, 0x98, 0x9b, 0x10, 0x9b, 0x9d, 0x98, 0x8c, 0x8b, 0x8c, 0x98, 0x9b, 0x9d, 0x9d, 0xb8, 0x03, 0x01, 0xdc, 0x01, 0x26, 0x98,
+  0x98, 0xdb, 0x01, 0x00, 0x01, 0x00, 0x0f, 0xd7, 0x01, 0x06, 0x00, 0xc0, 0x01, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0xdd, 0x01, 0x02, 0x02,
+  0x00, 0x00, 0x01, 0x00, 0x02, 0x06, 0x00, 0x0a, 0x01, 0x00, 0x00, 0xd2, 0x01, 0x00, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x08,
+  0x00, 0x01, 0x02, 0x00, 0x0a, 0x01, 0x00, 0x12, 0x0a, 0xda, 0x01, 0x00, 0xd9, 0x01, 0x00, 0x02, 0x00, 0x00, 0xb5, 0x03, 0x02, 0xdb, 0x01, 0x09,
+  0x01, 0x00, 0x00, 0xcd, 0x01, 0x01, 0x05, 0x00, 0x01, 0xb5, 0x03, 0x00, 0x02, 0x00, 0x00, 0xcd, 0x01, 0x04, 0x09, 0x00, 0x02, 0xd2, 0x01, 0x02,
+  0xa0, 0x03, 0x26, 0x14, 0x15, 0xd4, 0x01, 0x05, 0x09, 0x00, 0x04, 0x01, 0x00, 0x01, 0xcb, 0x01, 0x20, 0x17, 0x1e, 0xb6, 0x03, 0x01, 0xde, 0x01,
+  0x50, 0x1b, 0x1b, 0x20, 0x1b, 0x1e, 0xd8, 0x01, 0x00, 0x10, 0x12, 0x06, 0xd1, 0x01, 0x0a, 0x01, 0x00, 0x00, 0xd8, 0x01, 0x00, 0x05, 0x00, 0x04,
+  0x02, 0x00, 0x52, 0x25, 0x29, 0x2c, 0x0e, 0x0c, 0x82, 0x07, 0x01, 0xc0, 0x03, 0x01, 0xdb, 0x01, 0x01, 0x02, 0x00, 0x40, 0x2e, 0x2e, 0x34, 0x34,
+  0xc3, 0x03, 0x01, 0xdf, 0x01, 0x02, 0xe1, 0x01, 0x20, 0x29, 0x17, 0x0c, 0x00, 0x00, 0x01, 0x00, 0x51, 0x20, 0x29, 0x20, 0x9d, 0x07, 0x55, 0x0a,
+  0x00, 0x81, 0x08, 0x00, 0x05, 0x00, 0x61, 0x07, 0x9b, 0x9b, 0x04, 0x9b, 0x04, 0x0e, 0x10, 0x04, 0x02, 0x00, 0x30, 0x97, 0x9b, 0x97, 0x2a, 0x10,
+  0x00, 0xde, 0x01, 0x91, 0x98, 0x9a, 0x15, 0x0d, 0x0d, 0x1b, 0x1b, 0x17, 0x9d, 0xcc, 0x03, 0x70, 0x97, 0x92, 0x98, 0x0d, 0x10, 0x0d, 0x15, 0x94,
+  0x05, 0xf0, 0x01, 0x9d, 0x15, 0x0d, 0x98, 0x98, 0x92, 0x8b, 0x92, 0x9b, 0x15, 0x9b, 0x92, 0x9d, 0x92, 0x98, 0x10, 0xe8, 0x03, 0xa0, 0x10, 0x9d,
+  0x9b, 0x0d, 0x15, 0x15, 0x9b, 0x9d, 0x9d, 0x10, 0xc6, 0x05, 0x61, 0x8b, 0x98, 0x9d, 0x9b, 0x10, 0x9d, 0xdd, 0x01, 0x70, 0x8c, 0x92, 0x98, 0x92,
+  0x9b, 0x9b, 0x8b, 0xd8, 0x01, 0x01, 0x01, 0x00, 0x0d, 0xdd, 0x01, 0x0d, 0xd3, 0x01, 0x00, 0x05, 0x00, 0x08, 0x01, 0x00, 0x0a, 0x0e, 0x00, 0x01,
+  0xd3, 0x01, 0x00, 0x04, 0x00, 0x00, 0xd5, 0x01, 0x00, 0x06, 0x00, 0x01, 0x02, 0x00, 0x0f, 0x01, 0x00, 0x04, 0x00, 0xd9, 0x01, 0x00, 0xd6, 0x01,
+  0x21, 0x9d, 0x9d, 0x07, 0x00, 0x30, 0x0d, 0x9d, 0x0d, 0x03, 0x00, 0x08, 0x01, 0x00, 0x00, 0xb4, 0x03, 0x00, 0x01, 0x00, 0x00, 0x89, 0x05, 0x02,
+  0x04, 0x00, 0x02, 0xd5, 0x01, 0x00, 0xb5, 0x03, 0x00, 0xb7, 0x03, 0x00, 0x06, 0x00, 0x01, 0x02, 0x00, 0x00, 0x68, 0x07, 0x01, 0xe6, 0x01, 0x00,
+  0xe1, 0x01, 0x0a, 0x01, 0x00, 0x00, 0x49, 0x09, 0x00, 0xae, 0x03, 0x00, 0x66, 0x0c, 0x08, 0x02, 0x00, 0x23, 0x1b, 0x1b, 0xad, 0x03, 0x00, 0x9e,
+  0x05, 0x00, 0x07, 0x00, 0x00, 0xcd, 0x01, 0x05, 0x01, 0x00, 0x03, 0xb5, 0x03, 0x00, 0x09, 0x00, 0x00, 0xb3, 0x03, 0x00, 0x05, 0x00, 0x04, 0xbe,
+  0x03, 0x51, 0x29, 0x29, 0x11, 0x0e, 0x17, 0x8e, 0x05, 0x00, 0x84, 0x07, 0x02, 0xd9, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x04, 0x00, 0x10, 0x34, 0x8e,
+  0x05, 0x03, 0xe1, 0x01, 0x02, 0x01, 0x00, 0x01, 0xcf, 0x03, 0x00, 0xe1, 0x01, 0x53, 0x20, 0x07, 0x0a, 0x9b, 0x07, 0x01, 0x00, 0x01, 0xdf, 0x01,
+  0x01, 0x07, 0x00, 0x00, 0x08, 0x00, 0x05, 0x02, 0x00, 0x00, 0xf8, 0x11, 0x21, 0x9a, 0x97, 0xe8, 0x01, 0x00, 0xdd, 0x10, 0x00, 0x01, 0x00, 0x10,
+  0x15, 0x23, 0x12, 0x71, 0x92, 0x97, 0x98, 0x9b, 0x97, 0x0d, 0x15, 0x52, 0x09, 0x00, 0xa3, 0x05, 0x00, 0xda, 0x01, 0x20, 0x92, 0x0d, 0x60, 0x0b,
+  0x00, 0xee, 0x01, 0xf0, 0x07, 0x9d, 0x9d, 0x9b, 0x92, 0x92, 0x92, 0x10, 0x10, 0x15, 0x0d, 0x92, 0x8b, 0x92, 0x8b, 0x8c, 0x92, 0x8c, 0x8b, 0x98,
+  0x98, 0x9d, 0x98, 0xdc, 0x01, 0x00, 0x25, 0x11, 0x80, 0x92, 0x9b, 0x9b, 0x98, 0x92, 0x9d, 0x9b, 0x98, 0x21, 0x0b, 0x1b, 0x92, 0xdf, 0x01, 0x02,
+  0xcf, 0x01, 0x07, 0x02, 0x00, 0x01, 0x10, 0x00, 0x00, 0x01, 0x00, 0x02, 0x06, 0x00, 0x00, 0xca, 0x01, 0x02, 0x04, 0x00, 0x03, 0x01, 0x00, 0x01,
+  0xcf, 0x01, 0x00, 0x09, 0x00, 0x01, 0x08, 0x00, 0x00, 0xba, 0x01, 0x02, 0x67, 0x07, 0x08, 0x01, 0x00, 0x00, 0xd7, 0x01, 0x10, 0x0c, 0x09, 0x00,
+  0x00, 0xd3, 0x01, 0x01, 0xe2, 0x01, 0x00, 0xd8, 0x01, 0x00, 0x06, 0x00, 0x00, 0x05, 0x00, 0x01, 0x08, 0x00, 0x06, 0x01, 0x00, 0x10, 0x11, 0xdd,
+  0x01, 0x00, 0x02, 0x00, 0x01, 0xc7, 0x01, 0x05, 0xc1, 0x03, 0x00, 0x0c, 0x00, 0x01, 0x02, 0x00, 0x00, 0xd4, 0x01, 0x00, 0x02, 0x00, 0x00, 0xb4,
+  0x13, 0x01, 0xda, 0x01, 0x07, 0x08, 0x00, 0x00, 0x01, 0x00, 0x02, 0x92, 0x05, 0x01, 0x07, 0x00, 0x00, 0xbe, 0x03, 0x03, 0x02, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x08, 0x00, 0x01, 0xd7, 0x01, 0x04, 0x02, 0x00, 0x0d, 0x01, 0x00, 0x01, 0xd0, 0x01, 0x02, 0x02, 0x00, 0x03, 0xdd, 0x01, 0x01, 0xea,
+  0x01, 0x51, 0x25, 0x29, 0x0e, 0x11, 0x11, 0x82, 0x07, 0x01, 0xb2, 0x03, 0x04, 0xc0, 0x03, 0x00, 0x0d, 0x00, 0x01, 0xbe, 0x03, 0x00, 0xdb, 0x01,
+  0x02, 0x02, 0x00, 0x02, 0x01, 0x00, 0x02, 0x08, 0x00, 0x62, 0x20, 0x29, 0x17, 0x9d, 0x0a, 0x07, 0x02, 0x00, 0x01, 0x10, 0x0e, 0x11, 0x07, 0xad,
+  0x13, 0x01, 0xe4, 0x01, 0x04, 0x02, 0x00, 0x00, 0xed, 0x01, 0x00, 0x01, 0x00, 0x00, 0xcb, 0x03, 0x60, 0x9b, 0x07, 0x10, 0x07, 0x15, 0x9d, 0xa7,
+  0x14, 0x20, 0x98, 0x97, 0x87, 0x01, 0xf0, 0x01, 0x15, 0x15, 0x0d, 0x9d, 0x9d, 0x10, 0x17, 0x15, 0x9b, 0x0c, 0x16, 0x1b, 0x0d, 0x92, 0x9d, 0x10,
+  0x8c, 0x05, 0x40, 0x15, 0x10, 0x9d, 0x10, 0x49, 0x01, 0x10, 0x9d, 0x74, 0x07, 0x60, 0x98, 0x98, 0x92, 0x9d, 0x10, 0x9d, 0x03, 0x0d, 0x00, 0x4e,
+  0x01, 0xa0, 0x9b, 0x92, 0x92, 0x8c, 0x98, 0x9d, 0x9d, 0x9d, 0x98, 0x9d, 0xb2, 0x01, 0x00, 0xf0, 0x08, 0x08, 0xbd, 0x03, 0x00, 0xcb, 0x01, 0x00,
+  0x02, 0x00, 0x01, 0x05, 0x00, 0x01, 0xcc, 0x01, 0x01, 0x06, 0x00, 0x00, 0x05, 0x00, 0x00, 0x0d, 0x00, 0x08, 0x01, 0x00, 0x01, 0xce, 0x01, 0x01,
+  0xcd, 0x01, 0x05, 0x02, 0x00, 0x01, 0x05, 0x00, 0x01, 0x02, 0x00, 0x0e, 0x01, 0x00, 0x00, 0xd9, 0x01, 0x01, 0xb2, 0x03, 0x00, 0x07, 0x00, 0x03,
+  0x02, 0x00, 0x00, 0x03, 0x00, 0x02, 0xdd, 0x01, 0x05, 0x01, 0x00, 0x11, 0x10, 0x03, 0x00, 0x12, 0x0d, 0xcd, 0x01, 0x06, 0x02, 0x00, 0x00, 0xcb,
+  0x01, 0x01, 0xdd, 0x01, 0x15, 0x14, 0x04, 0x00, 0x01, 0x45, 0x0a, 0x00, 0x9d, 0x05, 0x04, 0xa2, 0x05, 0x03, 0xd9, 0x01, 0x00, 0x01, 0x00, 0x02,
+  0xd8, 0x01, 0x00, 0x02, 0x00, 0x22, 0x1e, 0x1b, 0x90, 0x05, 0x04, 0x01, 0x00, 0x01, 0x8f, 0x05, 0x00, 0x02, 0x00, 0x01, 0x2d, 0x0b, 0x01, 0x01,
+  0x00, 0x01, 0x0c, 0x00, 0x03, 0x01, 0x00, 0x01, 0xbe, 0x03, 0x01, 0xd0, 0x01, 0x02, 0x02, 0x00, 0x10, 0x25, 0xa2, 0x01, 0x06, 0x01, 0x00, 0x40,
+  0x14, 0x11, 0x11, 0x20, 0xc1, 0x03, 0x01, 0xe4, 0x01, 0x01, 0xda, 0x01, 0x00, 0xc1, 0x03, 0x00, 0x0e, 0x00, 0x01, 0xf4, 0x01, 0x03, 0xe2, 0x01,
+  0x01, 0xa1, 0x05, 0x04, 0xbe, 0x03, 0x00, 0x09, 0x0f, 0x00, 0x84, 0x13, 0x11, 0x9d, 0x04, 0x00, 0x11, 0x9d, 0xe7, 0x01, 0x02, 0x5b, 0x0a, 0x20,
+  0x0c, 0x07, 0xc2, 0x13, 0x12, 0x0a, 0xf1, 0x01, 0x01, 0xe7, 0x01, 0x00, 0xe5, 0x01, 0x00, 0x04, 0x00, 0x00, 0xe9, 0x01, 0x00, 0x75, 0x01, 0x60,
+  0x9b, 0x15, 0x0d, 0x9b, 0x9b, 0x17, 0xa9, 0x03, 0x30, 0x0c, 0x10, 0x17, 0x6e, 0x07, 0xe0, 0x9b, 0x92, 0x0d, 0x1b, 0x15, 0x1b, 0x9d, 0x9d, 0x10,
+  0x98, 0x92, 0x98, 0x9b, 0x92, 0x40, 0x0b, 0x20, 0x8b, 0x92, 0x8a, 0x05, 0x10, 0x8b, 0x12, 0x00, 0x80, 0x8b, 0x92, 0x98, 0x10, 0x10, 0x15, 0x9d,
+  0x9d, 0xdf, 0x01, 0x11, 0x10, 0x5e, 0x0b, 0x01, 0x01, 0x00, 0x07, 0x4f, 0x09, 0x00, 0xd8, 0x01, 0x00, 0x58, 0x00, 0x08, 0x02, 0x00, 0x00, 0x01,
+  0x00, 0x04, 0x08, 0x00, 0x03, 0x01, 0x00, 0x01, 0xc2, 0x01, 0x0f, 0x02, 0x00, 0x07, 0x00, 0x01, 0x00, 0x02, 0x06, 0x00, 0x00, 0xd4, 0x01, 0x00,
+  0x04, 0x00, 0x01, 0x07, 0x00, 0x01, 0xb3, 0x03, 0x00, 0xcc, 0x01, 0x01, 0xda, 0x01, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x01, 0x01, 0x00, 0x01,
+  0xd2, 0x01, 0x03, 0x08, 0x00, 0x48, 0x10, 0x0d, 0x0d, 0x15, 0xde, 0x01, 0x01, 0xad, 0x03, 0x10, 0x11, 0xca, 0x01, 0x50, 0x15, 0x11, 0x10, 0x15,
+  0x15, 0xe9, 0x01, 0x01, 0xd9, 0x01, 0x00, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00, 0xcf, 0x01, 0x07, 0x01, 0x00, 0x00, 0xd5, 0x01, 0x01, 0x07, 0x00,
+  0x01, 0x0a, 0x00, 0x02, 0xd2, 0x01, 0x01, 0xb2, 0x03, 0x10, 0x1e, 0x72, 0x07, 0x03, 0xde, 0x01, 0x00, 0xda, 0x01, 0x01, 0x08, 0x00, 0x08, 0xdb,
+  0x01, 0x01, 0xd9, 0x01, 0x00, 0x01, 0x00, 0x00, 0x34, 0x0b, 0x00, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0xe2, 0x01, 0x01, 0x05, 0x00, 0x00, 0xe0,
+  0x01, 0x40, 0x14, 0x14, 0x17, 0x29, 0xd2, 0x01, 0x00, 0x32, 0x0b, 0x07, 0xe3, 0x01, 0x01, 0xbe, 0x03, 0x01, 0x01, 0x00, 0x02, 0xe1, 0x01, 0x02,
+  0x01, 0x00, 0x01, 0x09, 0x00, 0x60, 0x20, 0x29, 0x20, 0x0d, 0x0c, 0x0c, 0xde, 0x01, 0x00, 0x22, 0x19, 0x10, 0x0a, 0x0b, 0x00, 0x07, 0x02, 0x00,
+  0x00, 0xeb, 0x01, 0x04, 0xe8, 0x11, 0x01, 0xe1, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x00, 0x80, 0x0d, 0x17, 0x15, 0x9d, 0x9b, 0x10, 0x17, 0x16,
+  0xf0, 0x00, 0xa0, 0x1b, 0x1b, 0x15, 0x1b, 0x15, 0x0d, 0x9d, 0x15, 0x15, 0x0d, 0x5e, 0x0b, 0x11, 0x92, 0x5a, 0x07, 0x70, 0x98, 0x9d, 0x9d, 0x98,
+  0x8b, 0x92, 0x8b, 0x81, 0x05, 0x31, 0x9d, 0x9d, 0x98, 0x46, 0x0b, 0x30, 0x10, 0x10, 0x9d, 0xdb, 0x03, 0x21, 0x0d, 0x9d, 0x5f, 0x01, 0x00, 0x8a,
+  0x01, 0x00, 0xbe, 0x01, 0x01, 0x01, 0x00, 0x00, 0xde, 0x01, 0x00, 0x02, 0x00, 0x0f, 0x01, 0x00, 0x08, 0x01, 0xc0, 0x01, 0x0e, 0x02, 0x00, 0x04,
+  0xd0, 0x01, 0x02, 0x01, 0x00, 0x08, 0x0c, 0x00, 0x00, 0x62, 0x00, 0x00, 0xdb, 0x01, 0x01, 0x02, 0x00, 0x01, 0xd5, 0x01, 0x01, 0x78, 0x00, 0x01,
+  0x0a, 0x00, 0x04, 0x01, 0x00, 0x00, 0xd6, 0x01, 0x00, 0x01, 0x00, 0x01, 0xbb, 0x03, 0x01, 0x02, 0x00, 0x01, 0xd9, 0x01, 0x40, 0x0d, 0x15, 0x0d,
+  0x15, 0x08, 0x00, 0x40, 0x10, 0x11, 0x15, 0x0d, 0xdd, 0x01, 0x01, 0xdc, 0x01, 0x00, 0xa4, 0x13, 0x01, 0x08, 0x00, 0x00, 0xf3, 0x00, 0x01, 0x02,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0xd6, 0x01, 0x03, 0x02, 0x00, 0x02, 0x05, 0x00, 0x00, 0x01, 0x00, 0x07, 0xbc, 0x03, 0x01, 0xd3, 0x01, 0x00, 0x02,
+  0x00, 0x0f, 0x01, 0x00, 0x00, 0x02, 0xda, 0x01, 0x00, 0xd6, 0x01, 0x0c, 0x02, 0x00, 0x00, 0xa2, 0x01, 0x03, 0x01, 0x00, 0x61, 0x32, 0x29, 0x18,
+  0x14, 0x14, 0x17, 0xd7, 0x0e, 0x00, 0xe1, 0x01, 0x02, 0x94, 0x05, 0x01, 0x01, 0x00, 0x04, 0xe8, 0x01, 0x00, 0xdd, 0x01, 0x01, 0xd6, 0x01, 0x04,
+  0xde, 0x01, 0x50, 0x29, 0x29, 0x22, 0x29, 0x1b, 0x2b, 0x17, 0x01, 0x1b, 0x0c, 0x01, 0x14, 0x0c, 0x00, 0x27, 0x0c, 0x11, 0x0c, 0xa0, 0x13, 0x00,
+  0x14, 0x0e, 0x00, 0xe5, 0x01, 0x04, 0x02, 0x00, 0x00, 0xe5, 0x01, 0x00, 0x02, 0x00, 0x00, 0xb2, 0x15, 0x01, 0xe3, 0x01, 0x20, 0x0d, 0x15, 0x25,
+  0x05, 0x11, 0x0d, 0xe8, 0x00, 0x00, 0xc2, 0x00, 0x40, 0x15, 0x17, 0x16, 0x0c, 0x90, 0x03, 0x00, 0x76, 0x07, 0x00, 0x01, 0x00, 0x30, 0x98, 0x92,
+  0x98, 0xd7, 0x01, 0x00, 0x10, 0x00, 0x20, 0x98, 0x9d, 0xe5, 0x01, 0x90, 0x10, 0x10, 0x0d, 0x15, 0x10, 0x9d, 0x9d, 0x9b, 0x0d, 0xbe, 0x05, 0x06,
+  0xc3, 0x03, 0x00, 0xbb, 0x01, 0x01, 0xd9, 0x01, 0x07, 0xdf, 0x01, 0x37, 0x9d, 0x9b, 0x9d, 0x0c, 0x00, 0x02, 0x01, 0x00, 0x00, 0xcd, 0x01, 0x02,
+  0x06, 0x00, 0x03, 0xc5, 0x01, 0x02, 0x06, 0x00, 0x03, 0x07, 0x00, 0x02, 0x06, 0x00, 0x07, 0x01, 0x00, 0x01, 0xce, 0x01, 0x06, 0x02, 0x00, 0x00,
+  0x03, 0x00, 0x06, 0x01, 0x00, 0x01, 0xce, 0x01, 0x00, 0x01, 0x00, 0x01, 0xd2, 0x01, 0x00, 0x02, 0x00, 0x16, 0x11, 0x04, 0x00, 0x40, 0x15, 0x0d,
+  0x15, 0x15, 0xd4, 0x01, 0x00, 0xb1, 0x03, 0x01, 0x09, 0x00, 0x01, 0x06, 0x00, 0x20, 0x14, 0x15, 0x64, 0x08, 0x00, 0xe5, 0x01, 0x05, 0x02, 0x00,
+  0x06, 0x01, 0x00, 0x03, 0xd3, 0x01, 0x02, 0x06, 0x00, 0x00, 0x08, 0x00, 0x09, 0x01, 0x00, 0x00, 0xd6, 0x01, 0x00, 0x05, 0x00, 0x00, 0x02, 0x00,
+  0x04, 0x01, 0x00, 0x10, 0x22, 0x05, 0x00, 0x04, 0x01, 0x00, 0x10, 0x29, 0x10, 0x00, 0x10, 0x22, 0xd1, 0x01, 0x02, 0x02, 0x00, 0x00, 0x03, 0x00,
+  0x09, 0x01, 0x00, 0x50, 0x29, 0x29, 0x29, 0x29, 0x29, 0xf0, 0x00, 0x18, 0x17, 0x18, 0x14, 0x17, 0x29, 0x2e, 0x2e, 0x2e, 0x2e, 0x32, 0x34, 0x32,
+  0x34, 0x32, 0x09, 0x00, 0x0a, 0x01, 0x00, 0x12, 0x29, 0x02, 0x00, 0x02, 0x05, 0x00, 0x01, 0x01, 0x00, 0x80, 0x20, 0x20, 0x1b, 0x11, 0x0d, 0x11,
+  0x0d, 0x0c, 0x02, 0x00, 0x51, 0x11, 0x0c, 0x0d, 0x0c, 0x0c, 0x0a, 0x00, 0x12, 0x0d, 0x07, 0x00, 0x14, 0x9d, 0x02, 0x00, 0x11, 0x0a, 0x04, 0x00,
+  0x02, 0x02, 0x00, 0xe0, 0x07, 0x9d, 0x07, 0x9d, 0x9b, 0x9d, 0x9b, 0x9d, 0x9d, 0x9b, 0x0d, 0x10, 0x9d, 0x9d, 0x09, 0x00, 0xf0, 0x11, 0x0d, 0x15,
+  0x15, 0x15, 0x1b, 0x1b, 0x16, 0x1b, 0x1b, 0x1b, 0x15, 0x9b, 0x98, 0x98, 0x98, 0x9b, 0x9d, 0x98, 0x98, 0x98, 0x92, 0x98, 0x97, 0x92, 0x9b, 0x92,
+  0x92, 0x98, 0x9d, 0x98, 0x92, 0x92, 0x0e, 0x00, 0x81, 0x9b, 0x98, 0x92, 0x98, 0x0d, 0x10, 0x10, 0x10, 0x34, 0x00, 0x70, 0x0d, 0x10, 0x10, 0x0d,
+  0x9d, 0x9d, 0x10, 0x47, 0x00, 0x10, 0x9b, 0x10, 0x00, 0x69, 0x9b, 0x9b, 0x9d, 0x9d, 0x98, 0x9b, 0x01, 0x00, 0x00, 0x14, 0x00, 0x02, 0x08, 0x00,
+  0x00, 0x07, 0x00, 0x00, 0x06, 0x00, 0x03, 0x02, 0x00, 0x0f, 0x01, 0x00, 0x0d, 0x12, 0x0d, 0x02, 0x00, 0x21, 0x0d, 0x0d, 0x07, 0x00, 0x04, 0x02,
+  0x00, 0x03, 0x01, 0x00, 0x11, 0x10, 0x03, 0x00, 0x02, 0x09, 0x00, 0x01, 0x06, 0x00, 0x00, 0x02, 0x00, 0x10, 0x15, 0x06, 0x00, 0x10, 0x11, 0x9b,
+  0x00, 0x62, 0x11, 0x10, 0x0d, 0x17, 0x10, 0x11, 0x02, 0x00, 0x61, 0x15, 0x0d, 0x15, 0x10, 0x15, 0x11, 0x02, 0x00, 0x5c, 0x15, 0x15, 0x11, 0x15,
+  0x17, 0x02, 0x00, 0x01, 0x05, 0x00, 0x91, 0x15, 0x1b, 0x17, 0x1b, 0x15, 0x1b, 0x17, 0x17, 0x17, 0x04, 0x00, 0x36, 0x1b, 0x17, 0x1b, 0x04, 0x00,
+  0x06, 0x01, 0x00, 0x11, 0x20, 0x02, 0x00, 0x04, 0x08, 0x00, 0x35, 0x20, 0x1b, 0x20, 0x01, 0x00, 0x13, 0x22, 0x02, 0x00, 0x17, 0x29, 0x02, 0x00,
+  0x01, 0x05, 0x00, 0x01, 0x02, 0x00, 0x07, 0x01, 0x00, 0x12, 0x32, 0x02, 0x00, 0x9f, 0x17, 0x18, 0x17, 0x18, 0x17, 0x17, 0x32, 0x2e, 0x29, 0xdb,
+  0x01, 0x00, 0x05, 0xde, 0x01, 0x01, 0xda, 0x01, 0x00, 0x0a, 0x00, 0x90, 0x29, 0x29, 0x29, 0x22, 0x29, 0x22, 0x29, 0x17, 0x0d, 0xe1, 0x01, 0x06,
+  0x02, 0x00, 0x11, 0x0d, 0x04, 0x00, 0x01, 0x01, 0x00, 0x00, 0xe5, 0x01, 0x01, 0x05, 0x00, 0x00, 0x02, 0x00, 0x01, 0xe9, 0x01, 0x02, 0xe7, 0x01,
+  0x01, 0x05, 0x00, 0x10, 0x07, 0x4c, 0x01, 0x50, 0x9d, 0x15, 0x0d, 0x0d, 0x15, 0xea, 0x00, 0x00, 0xc9, 0x00, 0x90, 0x16, 0x17, 0x0d, 0x9b, 0x98,
+  0x98, 0x9b, 0x9b, 0x10, 0xe6, 0x01, 0x01, 0xd4, 0x01, 0x30, 0x98, 0x98, 0x98, 0x74, 0x01, 0x20, 0x9d, 0x9b, 0xf5, 0x01, 0x20, 0x9d, 0x10, 0x33,
+  0x01, 0x00, 0xd3, 0x01, 0x00, 0x4c, 0x01, 0x01, 0x02, 0x00, 0x01, 0x1f, 0x02, 0x00, 0xde, 0x01, 0x00, 0xc5, 0x01, 0x05, 0x01, 0x00, 0x00, 0xc8,
+  0x01, 0x01, 0x05, 0x00, 0x00, 0x18, 0x00, 0x0b, 0x02, 0x00, 0x00, 0x03, 0x00, 0x0d, 0x01, 0x00, 0x10, 0x0d, 0x05, 0x00, 0x04, 0x01, 0x00, 0x01,
+  0xd0, 0x01, 0x04, 0x02, 0x00, 0x06, 0x01, 0x00, 0x02, 0xdb, 0x01, 0x00, 0xd8, 0x01, 0x10, 0x10, 0x5f, 0x02, 0x00, 0x05, 0x00, 0x01, 0xd2, 0x01,
+  0x40, 0x10, 0x10, 0x10, 0x15, 0x05, 0x00, 0x71, 0x10, 0x11, 0x10, 0x15, 0x10, 0x15, 0x0d, 0xd1, 0x01, 0x00, 0xa8, 0x00, 0x00, 0xd5, 0x01, 0x03,
+  0x01, 0x00, 0x03, 0xcc, 0x01, 0x0b, 0x02, 0x00, 0x20, 0x17, 0x15, 0xdb, 0x01, 0x00, 0x02, 0x00, 0x11, 0x15, 0x03, 0x00, 0x0a, 0xd6, 0x01, 0x09,
+  0xd1, 0x01, 0x01, 0x02, 0x00, 0x10, 0x22, 0x06, 0x00, 0x10, 0x22, 0xdf, 0x01, 0x10, 0x22, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0xcf, 0x01, 0x01,
+  0x01, 0x00, 0x01, 0xd0, 0x01, 0x02, 0x02, 0x00, 0x00, 0x03, 0x00, 0x02, 0x01, 0x00, 0x20, 0x20, 0x32, 0x06, 0x00, 0x04, 0x01, 0x00, 0xc1, 0x32,
+  0x29, 0x29, 0x2e, 0x1e, 0x18, 0x1e, 0x17, 0x1e, 0x17, 0x29, 0x32, 0xc3, 0x03, 0x0f, 0x01, 0x00, 0x00, 0x00, 0xd5, 0x01, 0x00, 0x05, 0x00, 0x01,
+  0xdc, 0x01, 0x01, 0x01, 0x00, 0x57, 0x22, 0x29, 0x20, 0x15, 0x11, 0x01, 0x00, 0x01, 0xe2, 0x01, 0x06, 0x02, 0x00, 0x03, 0x01, 0x00, 0x00, 0xdf,
+  0x01, 0x00, 0x07, 0x00, 0x01, 0xe1, 0x01, 0x00, 0x02, 0x00, 0x04, 0x01, 0x00, 0x41, 0x9b, 0x9d, 0x15, 0x17, 0xdf, 0x01, 0x50, 0x15, 0x1b, 0x16,
+  0x17, 0x15, 0xaf, 0x01, 0x50, 0x9b, 0x9b, 0x9b, 0x10, 0x0d, 0x8d, 0x03, 0x00, 0xc8, 0x03, 0x20, 0x9b, 0x10, 0xe2, 0x01, 0x20, 0x98, 0x98, 0xa4,
+  0x03, 0x30, 0x10, 0x9d, 0x9d, 0x46, 0x01, 0x60, 0x15, 0x9b, 0x98, 0x9d, 0x0d, 0x15, 0x5b, 0x01, 0x13, 0x10, 0x16, 0x00, 0x02, 0xb2, 0x01, 0x00,
+  0x39, 0x00, 0x01, 0xc1, 0x01, 0x01, 0xc3, 0x01, 0x01, 0x0c, 0x00, 0x04, 0x01, 0x00, 0x02, 0x12, 0x00, 0x00, 0x0a, 0x00, 0x0f, 0x01, 0x00, 0x07,
+  0x01, 0xcd, 0x01, 0x03, 0x07, 0x00, 0x04, 0x08, 0x00, 0x70, 0x9d, 0x0d, 0x10, 0x9d, 0x0d, 0x9d, 0x10, 0x11, 0x00, 0x00, 0xd0, 0x01, 0x02, 0x03,
+  0x00, 0x05, 0x02, 0x00, 0x00, 0xb8, 0x03, 0x02, 0x02, 0x00, 0x00, 0xae, 0x03, 0x01, 0xde, 0x01, 0x00, 0xb6, 0x03, 0x02, 0xd5, 0x01, 0x06, 0x08,
+  0x00, 0x00, 0xdc, 0x00, 0x01, 0xcd, 0x01, 0x00, 0x02, 0x00, 0x11, 0x1b, 0x02, 0x00, 0x01, 0x08, 0x00, 0x00, 0xcf, 0x01, 0x00, 0xbc, 0x03, 0x0c,
+  0xad, 0x03, 0x07, 0x01, 0x00, 0x00, 0xe3, 0x01, 0x01, 0xd8, 0x01, 0x00, 0xd9, 0x01, 0x11, 0x1d, 0xdd, 0x01, 0x10, 0x22, 0xcd, 0x01, 0x00, 0xde,
+  0x01, 0x01, 0x01, 0x00, 0x00, 0x10, 0x00, 0x0a, 0xbd, 0x03, 0x00, 0x93, 0x01, 0x03, 0x06, 0x00, 0x05, 0x01, 0x00, 0x16, 0x32, 0x03, 0x00, 0xa0,
+  0x1e, 0x17, 0x1e, 0x18, 0x1b, 0x1e, 0x1b, 0x20, 0x2e, 0x32, 0xa8, 0x03, 0x0c, 0x01, 0x00, 0x01, 0xd9, 0x01, 0x00, 0x02, 0x00, 0x01, 0x01, 0x00,
+  0x02, 0x07, 0x00, 0x40, 0x22, 0x29, 0x1b, 0x17, 0xcd, 0x00, 0x30, 0x11, 0x15, 0x14, 0xe8, 0x01, 0x00, 0x0a, 0x00, 0x00, 0xd9, 0x01, 0x00, 0xeb,
+  0x00, 0x00, 0x02, 0x00, 0x06, 0xe3, 0x01, 0x04, 0x01, 0x00, 0x00, 0xeb, 0x01, 0x01, 0xe3, 0x01, 0x02, 0x02, 0x00, 0x01, 0x9c, 0x05, 0x20, 0x15,
+  0x1b, 0x05, 0x00, 0x51, 0x0d, 0x15, 0x10, 0x0d, 0x0d, 0x99, 0x01, 0x00, 0x7e, 0x05, 0x30, 0x98, 0x9b, 0x98, 0xb5, 0x01, 0x00, 0xde, 0x01, 0x00,
+  0xe0, 0x01, 0x00, 0xc8, 0x03, 0x82, 0x98, 0x10, 0x0d, 0x10, 0x15, 0x15, 0x9d, 0x9d, 0x2f, 0x03, 0x00, 0x3f, 0x03, 0x03, 0x99, 0x01, 0x00, 0xc4,
+  0x01, 0x00, 0x38, 0x00, 0x00, 0xc4, 0x01, 0x00, 0x04, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0f, 0x00, 0x0f, 0x01, 0x00, 0x12, 0x03, 0x44, 0x00, 0x01,
+  0x06, 0x00, 0x00, 0x0c, 0x00, 0x00, 0xd0, 0x01, 0x00, 0x01, 0x00, 0x01, 0xc8, 0x01, 0x04, 0x07, 0x00, 0x00, 0x53, 0x02, 0x01, 0x05, 0x00, 0x00,
+  0x86, 0x00, 0x00, 0x96, 0x05, 0x00, 0x82, 0x00, 0x00, 0xbc, 0x03, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x02, 0xb5, 0x03, 0x02, 0x94, 0x05, 0x06,
+  0x01, 0x00, 0x00, 0xd7, 0x01, 0x02, 0x02, 0x00, 0x00, 0xd1, 0x01, 0x11, 0x17, 0xb6, 0x03, 0x00, 0x09, 0x00, 0x32, 0x1b, 0x17, 0x16, 0xdf, 0x01,
+  0x0f, 0x01, 0x00, 0x03, 0x10, 0x20, 0x03, 0x00, 0x06, 0x02, 0x00, 0x00, 0xbc, 0x03, 0x30, 0x22, 0x1b, 0x1b, 0xcf, 0x01, 0x02, 0xdc, 0x01, 0x00,
+  0x08, 0x00, 0x00, 0x02, 0x00, 0x01, 0xbb, 0x03, 0x02, 0x03, 0x00, 0x0b, 0xd7, 0x01, 0x09, 0x01, 0x00, 0x01, 0xde, 0x01, 0x30, 0x29, 0x29, 0x1e,
+  0x01, 0x00, 0x40, 0x1b, 0x1e, 0x1b, 0x29, 0x86, 0x05, 0x00, 0xd3, 0x01, 0x08, 0x01, 0x00, 0x01, 0xdb, 0x01, 0x00, 0xd6, 0x01, 0x00, 0x04, 0x00,
+  0x03, 0x01, 0x00, 0x40, 0x22, 0x29, 0x29, 0x1b, 0xd0, 0x00, 0x60, 0x14, 0x17, 0x11, 0x17, 0x14, 0x15, 0x02, 0x00, 0x01, 0x0e, 0x00, 0x01, 0xeb,
+  0x01, 0x01, 0x0c, 0x00, 0x12, 0x10, 0xd5, 0x03, 0x01, 0xe9, 0x01, 0x10, 0x15, 0x34, 0x01, 0x03, 0x01, 0x00, 0x00, 0x46, 0x01, 0x01, 0x06, 0x00,
+  0x60, 0x15, 0x17, 0x16, 0x17, 0x16, 0x1b, 0xea, 0x02, 0x50, 0x0d, 0x0d, 0x15, 0x1b, 0x15, 0x99, 0x01, 0x00, 0xe1, 0x01, 0x73, 0x9b, 0x9d, 0x98,
+  0x9b, 0x10, 0x9d, 0x98, 0xa3, 0x01, 0x00, 0xbe, 0x01, 0x10, 0x98, 0x06, 0x00, 0x23, 0x10, 0x15, 0x57, 0x01, 0x01, 0x01, 0x00, 0x33, 0x9d, 0x10,
+  0x9b, 0xc2, 0x03, 0x0a, 0xcd, 0x01, 0x08, 0x0c, 0x00, 0x0f, 0x01, 0x00, 0x0b, 0x00, 0x9f, 0x03, 0x01, 0x07, 0x00, 0x00, 0x02, 0x00, 0x12, 0x10,
+  0x02, 0x00, 0x10, 0x0d, 0x04, 0x00, 0x00, 0x2c, 0x04, 0x00, 0xd0, 0x01, 0x04, 0x02, 0x00, 0x00, 0x03, 0x00, 0x03, 0x01, 0x00, 0x01, 0x6a, 0x07,
+  0x01, 0xbf, 0x03, 0x00, 0xdf, 0x01, 0x00, 0xd6, 0x01, 0x20, 0x10, 0x11, 0x05, 0x00, 0x00, 0xce, 0x01, 0x32, 0x15, 0x10, 0x17, 0x08, 0x00, 0x01,
+  0xd2, 0x01, 0x04, 0x02, 0x00, 0x01, 0xb3, 0x03, 0x60, 0x17, 0x1b, 0x1b, 0x15, 0x1b, 0x16, 0xb4, 0x03, 0x01, 0xf2, 0x00, 0x0f, 0x01, 0x00, 0x08,
+  0x00, 0xac, 0x03, 0x02, 0xe1, 0x01, 0x00, 0xd3, 0x01, 0x01, 0x02, 0x00, 0x00, 0xd1, 0x01, 0x01, 0xd0, 0x01, 0x00, 0xd2, 0x01, 0x01, 0x07, 0x00,
+  0x02, 0x02, 0x00, 0x41, 0x29, 0x22, 0x20, 0x22, 0xdb, 0x01, 0x00, 0x02, 0x00, 0x01, 0xbb, 0x03, 0x01, 0x07, 0x00, 0x09, 0x01, 0x00, 0x00, 0x7a,
+  0x07, 0x00, 0x93, 0x05, 0x74, 0x29, 0x2e, 0x29, 0x1e, 0x20, 0x1e, 0x20, 0xe0, 0x01, 0x0a, 0xe1, 0x01, 0x01, 0xf1, 0x01, 0x05, 0x02, 0x00, 0x07,
+  0xe5, 0x01, 0x20, 0x22, 0x1b, 0xc2, 0x00, 0x00, 0x99, 0x02, 0x01, 0xe1, 0x01, 0x11, 0x17, 0xe5, 0x01, 0x00, 0xdb, 0x01, 0x10, 0x17, 0xdf, 0x01,
+  0x00, 0x02, 0x00, 0x01, 0xb5, 0x04, 0x01, 0xce, 0x03, 0x03, 0x02, 0x00, 0x02, 0x14, 0x03, 0x01, 0xdf, 0x01, 0x10, 0x0d, 0x9f, 0x05, 0x00, 0xdf,
+  0x01, 0x70, 0x15, 0x15, 0x10, 0x0d, 0x15, 0x17, 0x16, 0x19, 0x00, 0x00, 0xac, 0x01, 0x40, 0x9b, 0x9d, 0x15, 0x9b, 0x40, 0x09, 0x01, 0x6c, 0x07,
+  0x00, 0x08, 0x00, 0x01, 0x82, 0x07, 0x00, 0xdf, 0x01, 0x01, 0xe1, 0x01, 0x05, 0xc3, 0x03, 0x00, 0x14, 0x00, 0x00, 0xa3, 0x01, 0x00, 0x32, 0x00,
+  0x00, 0x02, 0x00, 0x0f, 0x01, 0x00, 0x11, 0x01, 0xd2, 0x01, 0x00, 0x01, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x0d, 0x00, 0x00, 0xb7, 0x03, 0x00, 0xdf,
+  0x01, 0x00, 0x88, 0x05, 0x02, 0x02, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x5f, 0x00, 0x00, 0xab, 0x00, 0x02, 0x0a, 0x00, 0x01, 0x05, 0x00, 0x00, 0x07,
+  0x00, 0x01, 0xca, 0x01, 0x01, 0xe5, 0x01, 0x00, 0x84, 0x00, 0x04, 0xd6, 0x01, 0x01, 0x02, 0x00, 0x07, 0x01, 0x00, 0x01, 0x75, 0x06, 0x03, 0x01,
+  0x00, 0x02, 0xd1, 0x01, 0x00, 0xaf, 0x03, 0x00, 0x42, 0x09, 0x0f, 0xda, 0x01, 0x0b, 0x02, 0x04, 0x00, 0x50, 0x20, 0x1b, 0x22, 0x20, 0x1d, 0xe6,
+  0x01, 0x01, 0x02, 0x00, 0x00, 0x73, 0x07, 0x10, 0x22, 0x07, 0x00, 0x0f, 0x02, 0x00, 0x00, 0x18, 0x29, 0xe2, 0x01, 0x0f, 0x01, 0x00, 0x01, 0x01,
+  0xa7, 0x01, 0x10, 0x2e, 0xe2, 0x01, 0x00, 0xb9, 0x01, 0x00, 0xdf, 0x01, 0x10, 0x20, 0xc2, 0x07, 0x0f, 0x61, 0x09, 0x02, 0x00, 0x22, 0x00, 0x01,
+  0x02, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x01, 0x00, 0x00, 0x5e, 0x09, 0x10, 0x20, 0xda, 0x01, 0x08, 0x01, 0x00, 0x00, 0xee, 0x01, 0x01, 0xe3, 0x01,
+  0x02, 0xed, 0x01, 0x05, 0xc8, 0x03, 0x02, 0x7b, 0x08, 0x01, 0xe1, 0x01, 0x02, 0x02, 0x00, 0x00, 0xe2, 0x01, 0x00, 0xeb, 0x04, 0x01, 0xb8, 0x03,
+  0x20, 0x1b, 0x1b, 0x09, 0x01, 0x30, 0x15, 0x9d, 0x0d, 0x20, 0x0b, 0x31, 0x9b, 0x9d, 0x9b, 0xb7, 0x05, 0x00, 0xca, 0x01, 0x01, 0xb6, 0x01, 0x00,
+  0xb9, 0x01, 0x21, 0x9b, 0x9d, 0x48, 0x01, 0x00, 0x54, 0x01, 0x32, 0x9d, 0x9d, 0x15, 0x8d, 0x07, 0x00, 0x16, 0x00, 0x02, 0x02, 0x00, 0x0f, 0x01,
+  0x00, 0x15, 0x00, 0xd0, 0x01, 0x00, 0x53, 0x07, 0x00, 0x05, 0x00, 0x00, 0xca, 0x01, 0x00, 0xc9, 0x01, 0x00, 0x10, 0x00, 0x00, 0xbb, 0x01, 0x00,
+  0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0x00, 0x01, 0x05, 0x00, 0x02, 0x03, 0x00, 0x0b, 0x01, 0x00, 0x01, 0x85, 0x00, 0x00, 0x05, 0x00, 0x01,
+  0xa2, 0x00, 0x02, 0x07, 0x00, 0x05, 0x01, 0x00, 0x05, 0x0e, 0x00, 0x00, 0xa3, 0x03, 0x00, 0xda, 0x01, 0x11, 0x15, 0x85, 0x05, 0x01, 0xe1, 0x00,
+  0x01, 0x04, 0x00, 0x00, 0x46, 0x0a, 0x00, 0x05, 0x00, 0x07, 0x01, 0x00, 0x00, 0xd5, 0x01, 0x00, 0xa3, 0x03, 0x41, 0x1b, 0x1b, 0x1b, 0x1d, 0x0b,
+  0x00, 0x00, 0xce, 0x01, 0x01, 0xc5, 0x03, 0x00, 0xba, 0x03, 0x21, 0x22, 0x22, 0xed, 0x01, 0x00, 0x67, 0x07, 0x10, 0x22, 0xcc, 0x01, 0x02, 0x0a,
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x7d, 0x01, 0x00, 0x05, 0x00, 0x0f, 0x01, 0x00, 0x07, 0x00, 0xac, 0x01, 0x03, 0x32, 0x09, 0x00, 0xc5, 0x03, 0x14,
+  0x2e, 0x8e, 0x09, 0x29, 0x20, 0x1b, 0xbc, 0x03, 0x02, 0x01, 0x00, 0x03, 0xc2, 0x03, 0x00, 0x06, 0x00, 0x02, 0xde, 0x01, 0x02, 0x01, 0x00, 0x11,
+  0x1d, 0x72, 0x04, 0x00, 0xde, 0x0b, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0xd5, 0x00, 0x0f, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x87,
+  0x05, 0x06, 0xe5, 0x01, 0x00, 0x50, 0x01, 0x00, 0xb1, 0x03, 0x20, 0x10, 0x10, 0xf5, 0x00, 0x00, 0xe2, 0x02, 0x11, 0x10, 0x90, 0x07, 0x00, 0x83,
+  0x01, 0x00, 0x23, 0x01, 0x20, 0x15, 0x16, 0x0c, 0x00, 0x02, 0x41, 0x0b, 0x00, 0x01, 0x00, 0x00, 0x3d, 0x0b, 0x01, 0x9e, 0x07, 0x00, 0x9a, 0x01,
+  0x11, 0x9d, 0xe8, 0x01, 0x0f, 0xda, 0x01, 0x12, 0x00, 0x28, 0x00, 0x06, 0x07, 0x00, 0x05, 0x8b, 0x05, 0x01, 0x05, 0x00, 0x03, 0x02, 0x00, 0x01,
+  0xd8, 0x01, 0x00, 0x04, 0x00, 0x02, 0x02, 0x00, 0x0f, 0x01, 0x00, 0x01, 0x00, 0xcc, 0x01, 0x10, 0x10, 0x20, 0x06, 0x00, 0xc7, 0x00, 0x00, 0x0e,
+  0x00, 0x01, 0x07, 0x00, 0x0f, 0x01, 0x00, 0x03, 0x22, 0x17, 0x15, 0xdf, 0x01, 0x01, 0x92, 0x05, 0x00, 0xd8, 0x01, 0x00, 0x0a, 0x00, 0x07, 0x01,
+  0x00, 0x0c, 0xe3, 0x01, 0x01, 0xd8, 0x01, 0x02, 0xd5, 0x01, 0x10, 0x22, 0xd7, 0x01, 0x01, 0x08, 0x00, 0x20, 0x1d, 0x20, 0xdb, 0x01, 0x0c, 0x02,
+  0x00, 0x02, 0xd8, 0x01, 0x01, 0xea, 0x01, 0x00, 0xdc, 0x01, 0x10, 0x20, 0x66, 0x03, 0x00, 0x06, 0x00, 0x09, 0x01, 0x00, 0x01, 0xd5, 0x01, 0x01,
+  0x01, 0x00, 0x01, 0x0a, 0x00, 0x06, 0x02, 0x00, 0x00, 0xdd, 0x01, 0x01, 0x01, 0x00, 0x07, 0xc1, 0x03, 0x00, 0xd4, 0x01, 0x01, 0x01, 0x00, 0x01,
+  0x22, 0x00, 0x00, 0x30, 0x00, 0x02, 0x04, 0x00, 0x00, 0x69, 0x00, 0x20, 0x22, 0x29, 0x99, 0x00, 0x00, 0x79, 0x04, 0x00, 0x01, 0x00, 0x00, 0x07,
+  0x00, 0x00, 0x86, 0x04, 0x01, 0x02, 0x00, 0x01, 0xf5, 0x01, 0x00, 0xea, 0x00, 0x05, 0x02, 0x00, 0x00, 0xcb, 0x03, 0x04, 0xe3, 0x01, 0x11, 0x15,
+  0x6e, 0x0a, 0x00, 0x4b, 0x01, 0x00, 0xab, 0x08, 0x00, 0xdf, 0x01, 0x00, 0xaf, 0x03, 0x00, 0xb2, 0x05, 0x02, 0x36, 0x09, 0x61, 0x15, 0x16, 0x16,
+  0x15, 0x16, 0x16, 0x4f, 0x09, 0x03, 0xaa, 0x03, 0x01, 0x9d, 0x05, 0x01, 0x08, 0x00, 0x02, 0x11, 0x00, 0x00, 0x05, 0x00, 0x00, 0x0f, 0x00, 0x0d,
+  0x01, 0x00, 0x01, 0xb1, 0x01, 0x05, 0x02, 0x00, 0x00, 0x03, 0x00, 0x02, 0x09, 0x00, 0x01, 0x06, 0x00, 0x04, 0x02, 0x00, 0x02, 0xe3, 0x01, 0x00,
+  0x7d, 0x00, 0x07, 0x02, 0x00, 0x00, 0x8d, 0x00, 0x0f, 0x01, 0x00, 0x01, 0x01, 0xb1, 0x03, 0x00, 0xd3, 0x01, 0x03, 0x07, 0x00, 0x00, 0x89, 0x00,
+  0x02, 0x07, 0x00, 0x0e, 0x01, 0x00, 0x10, 0x16, 0x87, 0x04, 0x00, 0xae, 0x02, 0x02, 0xd5, 0x01, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x0f, 0x01,
+  0x00, 0x09, 0x12, 0x22, 0x05, 0x00, 0x02, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x00, 0xe5, 0x01, 0x00, 0xdf, 0x01, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x08, 0x00, 0x00, 0x02, 0x00, 0x01, 0x01, 0x00, 0x00, 0x8b, 0x05, 0x00, 0x79, 0x01, 0x11, 0x29, 0xc9, 0x03, 0x01, 0xdc, 0x01, 0x0a, 0xc4,
+  0x03, 0x00, 0x9c, 0x01, 0x00, 0x05, 0x00, 0x00, 0xae, 0x01, 0x03, 0x02, 0x00, 0x11, 0x2e, 0x31, 0x0b, 0x20, 0x32, 0x2e, 0x8e, 0x09, 0x00, 0xdd,
+  0x01, 0x21, 0x20, 0x20, 0x82, 0x07, 0x0e, 0x01, 0x00, 0x01, 0xbc, 0x03, 0x00, 0x33, 0x00, 0x04, 0x01, 0x00, 0x00, 0x56, 0x04, 0x0e, 0x01, 0x00,
+  0x00, 0xe9, 0x01, 0x00, 0x01, 0x00, 0x00, 0x56, 0x08, 0x00, 0x75, 0x06, 0x00, 0x09, 0x00, 0x00, 0x86, 0x06, 0x01, 0xe7, 0x01, 0x01, 0xcb, 0x03,
+  0x01, 0xe3, 0x01, 0x00, 0x55, 0x09, 0x00, 0x15, 0x03, 0x30, 0x1b, 0x16, 0x1b, 0xdd, 0x01, 0x01, 0xe2, 0x01, 0x00, 0x06, 0x07, 0x40, 0x0d, 0x9d,
+  0x15, 0x10, 0x12, 0x00, 0x50, 0x15, 0x10, 0x10, 0x16, 0x15, 0xd8, 0x01, 0x00, 0x8b, 0x07, 0x40, 0x9d, 0x10, 0x10, 0x16, 0xd7, 0x01, 0x02, 0xd9,
+  0x01, 0x02, 0x07, 0x00, 0x01, 0xb5, 0x01, 0x02, 0x04, 0x00, 0x04, 0x01, 0x00, 0x07, 0xd2, 0x01, 0x08, 0x02, 0x00, 0x01, 0x05, 0x00, 0x01, 0xa4,
+  0x03, 0x00, 0x02, 0x00, 0x00, 0xc7, 0x01, 0x00, 0x06, 0x00, 0x00, 0x0c, 0x00, 0x0f, 0x01, 0x00, 0x0a, 0x00, 0x9e, 0x00, 0x01, 0x01, 0x00, 0x01,
+  0xd1, 0x01, 0x00, 0x02, 0x00, 0x0f, 0x01, 0x00, 0x02, 0x01, 0x41, 0x08, 0x00, 0x01, 0x00, 0x00, 0x85, 0x04, 0x11, 0x16, 0x06, 0x00, 0x00, 0xb3,
+  0x02, 0x03, 0xd9, 0x01, 0x00, 0x0a, 0x00, 0x07, 0x01, 0x00, 0x11, 0x1d, 0x02, 0x00, 0x11, 0x22, 0x06, 0x00, 0x00, 0x02, 0x00, 0x01, 0x45, 0x09,
+  0x10, 0x1d, 0xbe, 0x03, 0x00, 0xbc, 0x03, 0x00, 0x9d, 0x05, 0x00, 0xcb, 0x01, 0x10, 0x1b, 0xcc, 0x01, 0x00, 0x0a, 0x00, 0x06, 0x02, 0x00, 0x04,
+  0x96, 0x05, 0x01, 0xe4, 0x01, 0x01, 0xd5, 0x01, 0x05, 0x09, 0x00, 0x03, 0x01, 0x00, 0x01, 0x9d, 0x01, 0x02, 0x08, 0x00, 0x01, 0xa6, 0x01, 0x04,
+  0x02, 0x00, 0x00, 0xad, 0x03, 0x10, 0x32, 0xbb, 0x01, 0x00, 0x1d, 0x02, 0x00, 0xde, 0x01, 0x20, 0x20, 0x20, 0xce, 0x01, 0x0c, 0x01, 0x00, 0x03,
+  0xde, 0x01, 0x01, 0x33, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x62, 0x00, 0x00, 0xb2, 0x00, 0x0f, 0x01, 0x00, 0x0c, 0x00, 0xc4, 0x02, 0x01, 0x14, 0x0c,
+  0x02, 0xd1, 0x03, 0x01, 0xe3, 0x01, 0x00, 0xad, 0x05, 0x00, 0xc5, 0x03, 0x00, 0x15, 0x01, 0x01, 0x01, 0x00, 0x01, 0x74, 0x01, 0x00, 0x08, 0x00,
+  0x00, 0x70, 0x0e, 0x10, 0x10, 0x9d, 0x05, 0x61, 0x9d, 0x10, 0x15, 0x16, 0x16, 0x16, 0x82, 0x01, 0x02, 0x71, 0x07, 0x01, 0xe3, 0x03, 0x10, 0x15,
+  0x11, 0x00, 0x00, 0x6a, 0x01, 0x00, 0x16, 0x00, 0x01, 0xb7, 0x01, 0x00, 0x01, 0x00, 0x01, 0x09, 0x00, 0x0f, 0x02, 0x00, 0x09, 0x00, 0xd0, 0x01,
+  0x00, 0x06, 0x00, 0x04, 0x01, 0x00, 0x08, 0x0c, 0x00, 0x0d, 0x01, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x01, 0x00, 0x02, 0x08, 0x00, 0x00, 0x6d, 0x00,
+  0x05, 0x02, 0x00, 0x0e, 0x01, 0x00, 0x20, 0x17, 0x16, 0xd8, 0x01, 0x00, 0x4c, 0x06, 0x00, 0x63, 0x06, 0x00, 0x0a, 0x00, 0x20, 0x17, 0x16, 0x91,
+  0x04, 0x01, 0xd7, 0x01, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0xcc, 0x01, 0x02, 0x02, 0x00, 0x02, 0xd3, 0x01, 0x00, 0x02,
+  0x00, 0x00, 0x46, 0x09, 0x02, 0x02, 0x00, 0x00, 0xbe, 0x01, 0x00, 0x91, 0x05, 0x00, 0xe2, 0x01, 0x08, 0x02, 0x00, 0x02, 0x01, 0x00, 0x00, 0x08,
+  0x00, 0x02, 0xda, 0x01, 0x06, 0x02, 0x00, 0x0d, 0x01, 0x00, 0x03, 0x93, 0x01, 0x01, 0x01, 0x00, 0x00, 0xa1, 0x01, 0x01, 0x02, 0x00, 0x03, 0x01,
+  0x00, 0x02, 0xe2, 0x01, 0x00, 0xdd, 0x01, 0x02, 0x02, 0x00, 0x15, 0x22, 0x1a, 0x00, 0x02, 0x01, 0x00, 0x01, 0x0f, 0x00, 0x00, 0x30, 0x00, 0x01,
+  0x02, 0x00, 0x00, 0x40, 0x00, 0x02, 0x01, 0x00, 0x00, 0x77, 0x02, 0x00, 0x02, 0x00, 0x11, 0x22, 0xf7, 0x09, 0x02, 0x02, 0x00, 0x0f, 0x01, 0x00,
+  0x08, 0x00, 0xac, 0x07, 0x01, 0xcc, 0x03, 0x01, 0xe1, 0x01, 0x01, 0xeb, 0x01, 0x01, 0xa4, 0x06, 0x00, 0xba, 0x01, 0x00, 0x4b, 0x01, 0x10, 0x16,
+  0xc4, 0x01, 0x02, 0xdf, 0x01, 0x00, 0x0c, 0x00, 0x00, 0x0e, 0x00, 0x31, 0x9d, 0x10, 0x15, 0x8d, 0x01, 0x11, 0x9d, 0xae, 0x05, 0x00, 0xa7, 0x01,
+  0x01, 0xb2, 0x05, 0x00, 0x09, 0x02, 0x01, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x15, 0x00, 0x00, 0x05, 0x00, 0x07, 0x02, 0x00, 0x01, 0x05, 0x00,
+  0x02, 0x02, 0x00, 0x01, 0x05, 0x00, 0x00, 0x02, 0x00, 0x02, 0x2a, 0x00, 0x02, 0x09, 0x00, 0x0f, 0x01, 0x00, 0x04, 0x01, 0x42, 0x02, 0x03, 0x01,
+  0x00, 0x01, 0x0c, 0x00, 0x01, 0x0e, 0x00, 0x32, 0x15, 0x10, 0x16, 0x02, 0x00, 0x00, 0xb4, 0x00, 0x07, 0x01, 0x00, 0x00, 0xa2, 0x00, 0x03, 0xd9,
+  0x01, 0x02, 0xdb, 0x01, 0x00, 0xcc, 0x00, 0x04, 0x02, 0x00, 0x20, 0x1b, 0x1d, 0x05, 0x00, 0x00, 0x07, 0x00, 0x04, 0x02, 0x00, 0x01, 0x05, 0x00,
+  0x00, 0x02, 0x00, 0x06, 0xd8, 0x01, 0x01, 0xd2, 0x01, 0x01, 0x02, 0x00, 0x01, 0xcd, 0x01, 0x00, 0x05, 0x00, 0x01, 0xba, 0x03, 0x05, 0x01, 0x00,
+  0x00, 0x12, 0x00, 0x0a, 0xd8, 0x01, 0x00, 0x02, 0x00, 0x00, 0xb6, 0x03, 0x00, 0xa3, 0x05, 0x00, 0x83, 0x01, 0x06, 0x01, 0x00, 0x00, 0x9b, 0x01,
+  0x01, 0x02, 0x00, 0x00, 0xab, 0x01, 0x02, 0x04, 0x00, 0x02, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0xe2, 0x01, 0x00, 0x25, 0x00, 0x04, 0x01, 0x00,
+  0x40, 0x2e, 0x2e, 0x2e, 0x34, 0x18, 0x00, 0x07, 0x01, 0x00, 0x03, 0xc0, 0x03, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x5a,
+  0x04, 0x01, 0x9e, 0x00, 0x01, 0x0e, 0x08, 0x01, 0x02, 0x00, 0x01, 0xb8, 0x00, 0x00, 0x26, 0x08, 0x01, 0x01, 0x00, 0x02, 0x3b, 0x08, 0x06, 0x01,
+  0x00, 0x00, 0xaf, 0x05, 0x00, 0xb7, 0x05, 0x00, 0xd3, 0x03, 0x00, 0xe5, 0x01, 0x01, 0xae, 0x06, 0x00, 0x25, 0x01, 0x00, 0x1c, 0x03, 0x01, 0xec,
+  0x01, 0x00, 0x51, 0x01, 0x61, 0x10, 0x16, 0x15, 0x1d, 0x15, 0x16, 0x5c, 0x01, 0x01, 0xd6, 0x01, 0x20, 0x15, 0x16, 0x5f, 0x09, 0x00, 0xbd, 0x03,
+  0x01, 0x01, 0x00, 0x00, 0x17, 0x00, 0x00, 0xf7, 0x01, 0x02, 0x09, 0x00, 0x00, 0x08, 0x00, 0x06, 0x02, 0x00, 0x05, 0x01, 0x00, 0x00, 0x0b, 0x00,
+  0x00, 0x04, 0x00, 0x0a, 0x16, 0x00, 0x0f, 0x01, 0x00, 0x0f, 0x00, 0xd4, 0x01, 0x01, 0x6c, 0x00, 0x00, 0x04, 0x00, 0x00, 0xc5, 0x01, 0x10, 0x10,
+  0x5a, 0x02, 0x00, 0x5b, 0x04, 0x01, 0x08, 0x00, 0x01, 0xe4, 0x01, 0x00, 0xcb, 0x01, 0x01, 0x07, 0x00, 0x01, 0xd3, 0x01, 0x00, 0x06, 0x00, 0x01,
+  0x02, 0x00, 0x10, 0x1b, 0x0e, 0x00, 0x07, 0x02, 0x00, 0x00, 0xcc, 0x01, 0x0a, 0x02, 0x00, 0x22, 0x22, 0x1d, 0x30, 0x01, 0x03, 0x02, 0x00, 0x00,
+  0x03, 0x00, 0x10, 0x22, 0x06, 0x00, 0x02, 0x08, 0x00, 0x00, 0xcd, 0x01, 0x0a, 0x02, 0x00, 0x00, 0xc4, 0x01, 0x0c, 0x02, 0x00, 0x00, 0x14, 0x00,
+  0x08, 0x01, 0x00, 0x10, 0x28, 0x05, 0x00, 0x01, 0x8f, 0x01, 0x00, 0x9a, 0x01, 0x01, 0x07, 0x00, 0x00, 0xbe, 0x01, 0x02, 0xb1, 0x01, 0x03, 0x01,
+  0x00, 0x00, 0xde, 0x01, 0x10, 0x32, 0xb1, 0x01, 0x04, 0x01, 0x00, 0x10, 0x22, 0x16, 0x00, 0x08, 0x01, 0x00, 0x05, 0x2c, 0x00, 0x01, 0x44, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x26, 0x00, 0x00, 0x84, 0x00, 0x01, 0xbf, 0x03, 0x00, 0xd4, 0x0b, 0x04, 0x5d, 0x04, 0x00, 0x09, 0x00, 0x04, 0x82, 0x04,
+  0x00, 0xf0, 0x01, 0x01, 0xeb, 0x01, 0x09, 0xe9, 0x01, 0x01, 0x99, 0x06, 0x00, 0xcf, 0x01, 0x00, 0x10, 0x0e, 0x01, 0xe8, 0x02, 0x01, 0xec, 0x01,
+  0x00, 0x14, 0x01, 0x03, 0xd6, 0x01, 0x10, 0x16, 0x0a, 0x00, 0x10, 0x16, 0x5d, 0x01, 0x51, 0x16, 0x15, 0x10, 0x16, 0x9d, 0xf3, 0x0e, 0x00, 0x78,
+  0x01, 0x04, 0xdf, 0x01, 0x02, 0x26, 0x00, 0x08, 0x01, 0x00, 0x00, 0x17, 0x00, 0x07, 0xad, 0x03, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x00, 0x04, 0x08,
+  0x00, 0x0f, 0x01, 0x00, 0x15, 0x00, 0x65, 0x00, 0x05, 0x02, 0x00, 0x00, 0x01, 0x00, 0x04, 0x08, 0x00, 0x01, 0x8f, 0x00, 0x08, 0x02, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x02, 0x00, 0x00, 0xb4, 0x00, 0x01, 0xd6, 0x01, 0x00, 0x04, 0x00, 0x00, 0xa6, 0x03, 0x0f,
+  0x02, 0x00, 0x00, 0x04, 0x11, 0x03, 0x02, 0xd2, 0x01, 0x01, 0xe2, 0x01, 0x40, 0x1b, 0x22, 0x22, 0x1d, 0x0d, 0x00, 0x00, 0x85, 0x05, 0x02, 0x05,
+  0x00, 0x02, 0x01, 0x00, 0x10, 0x29, 0x05, 0x00, 0x00, 0xd1, 0x01, 0x03, 0xe6, 0x01, 0x06, 0x06, 0x00, 0x04, 0x05, 0x00, 0x01, 0x01, 0x00, 0x01,
+  0x89, 0x01, 0x01, 0x90, 0x01, 0x00, 0x05, 0x00, 0x01, 0xa1, 0x01, 0x04, 0x05, 0x00, 0x0a, 0x01, 0x00, 0x10, 0x34, 0x16, 0x00, 0x00, 0x2d, 0x00,
+  0x01, 0x0f, 0x0f, 0x03, 0x21, 0x00, 0x10, 0x34, 0x17, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x00, 0x01, 0x41, 0x00, 0x20, 0x29, 0x28, 0x08, 0x00,
+  0x00, 0x03, 0x00, 0x01, 0x82, 0x00, 0x01, 0xd3, 0x01, 0x03, 0x02, 0x00, 0x01, 0xac, 0x0d, 0x00, 0xd1, 0x01, 0x04, 0x02, 0x00, 0x04, 0xcd, 0x00,
+  0x00, 0x08, 0x00, 0x00, 0xdf, 0x00, 0x06, 0xe6, 0x01, 0x10, 0x16, 0xed, 0x0f, 0x24, 0x17, 0x15, 0x06, 0x01, 0x00, 0xac, 0x05, 0x62, 0x15, 0x16,
+  0x1b, 0x1d, 0x16, 0x1b, 0xbb, 0x01, 0x02, 0x3f, 0x01, 0x02, 0x08, 0x00, 0x01, 0xa6, 0x05, 0x01, 0x1d, 0x05, 0x00, 0x1a, 0x00, 0x00, 0xfd, 0x01,
+  0x00, 0x74, 0x01, 0x00, 0x25, 0x00, 0x01, 0x02, 0x00, 0x08, 0x01, 0x00, 0x0f, 0xce, 0x01, 0x1c, 0x03, 0x3d, 0x00, 0x00, 0x46, 0x00, 0x03, 0x02,
+  0x00, 0x03, 0xd0, 0x01, 0x01, 0x05, 0x00, 0x01, 0x04, 0x00, 0x01, 0xda, 0x01, 0x00, 0xc6, 0x01, 0x06, 0x02, 0x00, 0x03, 0x01, 0x00, 0x02, 0x09,
+  0x00, 0x01, 0xd3, 0x01, 0x01, 0xdd, 0x01, 0x03, 0x0c, 0x00, 0x01, 0xcf, 0x00, 0x09, 0x02, 0x00, 0x00, 0x05, 0x00, 0x01, 0xb9, 0x03, 0x22, 0x1d,
+  0x1d, 0x07, 0x00, 0x00, 0x37, 0x01, 0x10, 0x22, 0x9c, 0x05, 0x03, 0x01, 0x00, 0x03, 0x09, 0x00, 0x00, 0x42, 0x01, 0x03, 0x07, 0x00, 0x01, 0x09,
+  0x00, 0x00, 0xcf, 0x01, 0x00, 0xc8, 0x01, 0x01, 0x06, 0x00, 0x01, 0x05, 0x00, 0x02, 0x01, 0x00, 0x05, 0x09, 0x00, 0x00, 0x01, 0x00, 0x40, 0x28,
+  0x29, 0x2e, 0x28, 0x97, 0x01, 0x00, 0x91, 0x01, 0x01, 0x02, 0x00, 0x00, 0xa6, 0x01, 0x01, 0x01, 0x00, 0x03, 0x07, 0x00, 0x02, 0x0c, 0x1c, 0x00,
+  0x02, 0x00, 0x02, 0x1f, 0x00, 0x23, 0x29, 0x2e, 0xdf, 0x01, 0x02, 0xdb, 0x01, 0x01, 0xde, 0x01, 0x03, 0x09, 0x00, 0x03, 0x01, 0x00, 0x00, 0x27,
+  0x00, 0x02, 0x4f, 0x00, 0x00, 0xc1, 0x03, 0x04, 0x04, 0x00, 0x02, 0x02, 0x00, 0x01, 0x05, 0x00, 0x0a, 0x02, 0x00, 0x01, 0xe1, 0x01, 0x02, 0x02,
+  0x00, 0x00, 0xd6, 0x03, 0x02, 0xeb, 0x01, 0x02, 0xe2, 0x01, 0x01, 0x91, 0x05, 0x00, 0xf0, 0x02, 0x00, 0x83, 0x07, 0x00, 0xc1, 0x01, 0x00, 0xb6,
+  0x03, 0x00, 0x76, 0x01, 0x10, 0x15, 0xd9, 0x01, 0x13, 0x1b, 0xe0, 0x01, 0x10, 0x16, 0x84, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x18, 0x00, 0x00, 0xc2,
+  0x01, 0x00, 0x75, 0x01, 0x01, 0x9b, 0x01, 0x01, 0x2c, 0x00, 0x0f, 0x01, 0x00, 0x2a, 0x02, 0x6c, 0x00, 0x01, 0x02, 0x00, 0x00, 0x36, 0x02, 0x08,
+  0x8d, 0x05, 0x01, 0x70, 0x07, 0x02, 0x06, 0x00, 0x01, 0xd7, 0x01, 0x04, 0x02, 0x00, 0x01, 0xdb, 0x01, 0x41, 0x15, 0x1d, 0x16, 0x1d, 0x09, 0x00,
+  0x11, 0x16, 0x95, 0x02, 0x00, 0x06, 0x00, 0x01, 0x08, 0x00, 0x20, 0x1b, 0x16, 0xce, 0x01, 0x08, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xd6, 0x01,
+  0x00, 0x07, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xd8, 0x01, 0x00, 0x7a, 0x07, 0x0f, 0x01, 0x00, 0x04, 0x01, 0x6d, 0x07, 0x00, 0x04, 0x00, 0x02, 0x02,
+  0x00, 0x01, 0x05, 0x00, 0x42, 0x29, 0x29, 0x28, 0x22, 0x87, 0x05, 0x01, 0x0d, 0x00, 0x07, 0x01, 0x00, 0x00, 0x85, 0x01, 0x00, 0x19, 0x00, 0x02,
+  0x97, 0x01, 0x05, 0x01, 0x00, 0x07, 0x0b, 0x00, 0xc0, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x34, 0x2e, 0x2e, 0x34, 0x2e, 0x80, 0x32, 0x2e,
+  0x32, 0x2e, 0x29, 0x2e, 0x29, 0x29, 0x05, 0x00, 0x11, 0x2e, 0x01, 0x00, 0x12, 0x34, 0x02, 0x00, 0x10, 0x3a, 0x0c, 0x00, 0x03, 0x01, 0x00, 0x30,
+  0x29, 0x2e, 0x28, 0x05, 0x00, 0x00, 0x28, 0x00, 0x21, 0x29, 0x22, 0x02, 0x00, 0x20, 0x29, 0x20, 0x06, 0x00, 0x7f, 0x22, 0x29, 0x22, 0x22, 0x22,
+  0x20, 0x22, 0x01, 0x00, 0x00, 0x10, 0x20, 0x17, 0x00, 0x44, 0x1b, 0x22, 0x20, 0x1d, 0x02, 0x00, 0xa0, 0x1b, 0x1b, 0x1b, 0x1d, 0x1b, 0x1d, 0x1b,
+  0x16, 0x1b, 0x16, 0x0a, 0x00, 0x00, 0x01, 0x00, 0xc0, 0x1b, 0x16, 0x17, 0x16, 0x17, 0x16, 0x1b, 0x16, 0x15, 0x16, 0x1b, 0x15, 0x01, 0x00, 0xf8,
+  0x00, 0x10, 0x10, 0x10, 0x15, 0x15, 0x16, 0x15, 0x10, 0x10, 0x15, 0x16, 0x16, 0x16, 0x16, 0x10, 0x01, 0x00, 0x12, 0x16, 0x19, 0x00, 0x10, 0x10,
+  0x04, 0x00, 0x31, 0x16, 0x10, 0x15, 0x08, 0x00, 0x06, 0x01, 0x00, 0x0a, 0x0e, 0x00, 0x09, 0x01, 0x00, 0x01, 0x2b, 0x00, 0x01, 0x20, 0x00, 0x04,
+  0x37, 0x00, 0x00, 0x06, 0x00, 0x20, 0x15, 0x10, 0x70, 0x00, 0x02, 0x01, 0x00, 0x41, 0x10, 0x16, 0x15, 0x16, 0x78, 0x00, 0x02, 0x04, 0x00, 0x41,
+  0x15, 0x16, 0x15, 0x16, 0x6e, 0x00, 0x30, 0x16, 0x16, 0x16, 0x06, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x8f, 0x00, 0x02, 0x01, 0x00, 0x10, 0x1b, 0x05,
+  0x00, 0x01, 0x07, 0x00, 0x61, 0x1b, 0x1d, 0x16, 0x1b, 0x16, 0x1d, 0x0c, 0x00, 0x00, 0xd7, 0x00, 0x01, 0x02, 0x00, 0x00, 0x01, 0x00, 0x40, 0x22,
+  0x1d, 0x1d, 0x22, 0x0a, 0x00, 0x61, 0x1b, 0x1d, 0x22, 0x1b, 0x22, 0x1d, 0x02, 0x00, 0x01, 0x01, 0x00, 0x03, 0x07, 0x00, 0x0f, 0x01, 0x00, 0x07,
+  0x02, 0x4c, 0x01, 0x01, 0x06, 0x00, 0x00, 0x05, 0x00, 0x40, 0x28, 0x29, 0x28, 0x29, 0x03, 0x00, 0x30, 0x22, 0x28, 0x29, 0x08, 0x00, 0x31, 0x28,
+  0x29, 0x2e, 0x06, 0x00, 0x00, 0x02, 0x00, 0x53, 0x29, 0x29, 0x28, 0x2e, 0x29, 0x90, 0x01, 0x0f, 0x01, 0x00, 0x07, 0x00, 0xc4, 0x01, 0x02, 0x05,
+  0x00, 0x08, 0x01, 0x00, 0x02, 0x11, 0x00, 0x00, 0x1a, 0x00, 0x30, 0x3f, 0x3a, 0x32, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x10, 0x28, 0x05, 0x00, 0x02,
+  0xe2, 0x01, 0x00, 0x82, 0x00, 0x03, 0x02, 0x00, 0x01, 0x0c, 0x00, 0x04, 0xe3, 0x01, 0x00, 0xd6, 0x01, 0x41, 0x20, 0x22, 0x20, 0x29, 0xa5, 0x00,
+  0x00, 0x08, 0x00, 0x10, 0x29, 0x1c, 0x00, 0x01, 0xe7, 0x01, 0x22, 0x22, 0x22, 0xe1, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x01, 0x10, 0x1d, 0x22,
+  0x01, 0x01, 0x02, 0x00, 0x02, 0x59, 0x01, 0x02, 0x01, 0x00, 0x01, 0x82, 0x01, 0x00, 0x44, 0x01, 0x00, 0x94, 0x01, 0x02, 0x01, 0x00, 0x01, 0x14,
+  0x00, 0x10, 0x16, 0x1b, 0x00, 0x00, 0x15, 0x00, 0x10, 0x15, 0x9f, 0x01, 0x09, 0x01, 0x00, 0x0d, 0x11, 0x00, 0x02, 0x01, 0x00, 0x02, 0xd1, 0x01,
+  0x00, 0x33, 0x00, 0x01, 0x09, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x00, 0xc3, 0x01, 0x01, 0xd4, 0x01, 0x00, 0x0b, 0x00, 0x00, 0xc1, 0x01,
+  0x02, 0x05, 0x00, 0x01, 0x06, 0x00, 0x05, 0x02, 0x00, 0x00, 0xd5, 0x01, 0x00, 0x06, 0x00, 0x06, 0x01, 0x00, 0x01, 0xa9, 0x00, 0x10, 0x16, 0xb3,
+  0x00, 0x10, 0x1d, 0xd7, 0x01, 0x30, 0x1b, 0x16, 0x16, 0xc1, 0x00, 0x10, 0x1d, 0x06, 0x00, 0x00, 0xcb, 0x00, 0x01, 0x07, 0x00, 0x02, 0x09, 0x00,
+  0x20, 0x22, 0x1b, 0xd5, 0x01, 0x02, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x00, 0x04, 0x04, 0x00, 0x0e, 0x01, 0x00, 0x00, 0xd5, 0x01, 0x00,
+  0x47, 0x01, 0x33, 0x22, 0x29, 0x28, 0x08, 0x00, 0x12, 0x22, 0xc5, 0x01, 0x10, 0x28, 0xdb, 0x01, 0x01, 0xcd, 0x01, 0x05, 0xdb, 0x01, 0x03, 0x85,
+  0x03, 0x13, 0x28, 0x04, 0x00, 0x0f, 0x01, 0x00, 0x06, 0x00, 0xc5, 0x01, 0x00, 0xbc, 0x01, 0x20, 0x34, 0x34, 0xa7, 0x03, 0x55, 0x3a, 0x3f, 0x34,
+  0x3a, 0x34, 0x01, 0x00, 0x04, 0x1b, 0x00, 0x30, 0x2e, 0x34, 0x3f, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x54, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08,
+  0x00, 0x01, 0x66, 0x00, 0x01, 0x05, 0x00, 0x01, 0x0b, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x01, 0x00, 0x10, 0x28, 0x08, 0x00, 0x00, 0x0d, 0x00, 0x01,
+  0x02, 0x00, 0x30, 0x2e, 0x3a, 0x34, 0x2e, 0x00, 0x01, 0x25, 0x02, 0x11, 0x2e, 0xc1, 0x00, 0x01, 0xfb, 0x01, 0x01, 0xe4, 0x00, 0x01, 0x02, 0x00,
+  0x04, 0x01, 0x00, 0x10, 0x1b, 0x03, 0x00, 0x05, 0x02, 0x00, 0x00, 0x47, 0x01, 0x04, 0x01, 0x00, 0x03, 0x5f, 0x01, 0x01, 0x87, 0x01, 0x00, 0x89,
+  0x01, 0x01, 0x9e, 0x01, 0x00, 0xc7, 0x01, 0x01, 0x8f, 0x03, 0x00, 0x10, 0x00, 0x03, 0xc2, 0x01, 0x0b, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x08,
+  0x00, 0x01, 0x1e, 0x00, 0x01, 0x01, 0x00, 0x01, 0x3a, 0x00, 0x05, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x04, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x64,
+  0x00, 0x03, 0x02, 0x00, 0x08, 0x0c, 0x00, 0x00, 0x78, 0x00, 0x00, 0x7a, 0x00, 0x0a, 0x01, 0x00, 0x01, 0xcc, 0x01, 0x01, 0xd7, 0x01, 0x02, 0x02,
+  0x00, 0x00, 0x9e, 0x02, 0x30, 0x1d, 0x1b, 0x1d, 0xbd, 0x03, 0x10, 0x16, 0xc6, 0x00, 0x00, 0xba, 0x03, 0x03, 0xd9, 0x00, 0x00, 0x09, 0x00, 0x20,
+  0x22, 0x1d, 0xbe, 0x03, 0x00, 0x03, 0x00, 0x0f, 0x01, 0x00, 0x08, 0x10, 0x28, 0x05, 0x00, 0x03, 0x08, 0x00, 0x10, 0x28, 0xd7, 0x01, 0x00, 0x3e,
+  0x01, 0x02, 0x06, 0x00, 0x40, 0x22, 0x28, 0x29, 0x22, 0x62, 0x01, 0x06, 0x02, 0x00, 0x00, 0xb3, 0x03, 0x11, 0x28, 0x04, 0x00, 0x00, 0x69, 0x03,
+  0x00, 0x5e, 0x01, 0x05, 0x73, 0x03, 0x06, 0x01, 0x00, 0x00, 0xb3, 0x01, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x05, 0x34, 0x2e, 0x34, 0x32,
+  0x34, 0x34, 0x34, 0x46, 0x46, 0x46, 0x46, 0x43, 0x3a, 0x43, 0x43, 0x46, 0x45, 0x46, 0x43, 0x3a, 0xe9, 0x01, 0x00, 0x1a, 0x00, 0x40, 0x34, 0x34,
+  0x3a, 0x43, 0x29, 0x00, 0x00, 0x04, 0x00, 0x07, 0x01, 0x00, 0x00, 0xe3, 0x01, 0x01, 0x01, 0x00, 0x00, 0x72, 0x00, 0x00, 0x27, 0x04, 0x01, 0xdc,
+  0x01, 0x01, 0x05, 0x00, 0x11, 0x28, 0x97, 0x00, 0x00, 0x09, 0x00, 0x80, 0x29, 0x2e, 0x3f, 0x3a, 0x3f, 0x3a, 0x34, 0x34, 0x06, 0x00, 0x21, 0x3f,
+  0x3a, 0xf8, 0x01, 0x00, 0xd6, 0x03, 0x01, 0x01, 0x00, 0x05, 0xb6, 0x04, 0x08, 0x01, 0x00, 0x00, 0x29, 0x01, 0x02, 0xe7, 0x04, 0x25, 0x16, 0x1d,
+  0x61, 0x01, 0x00, 0x63, 0x01, 0x06, 0x02, 0x00, 0x03, 0x72, 0x03, 0x02, 0x02, 0x00, 0x00, 0xc3, 0x01, 0x00, 0xa5, 0x01, 0x06, 0x04, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x03, 0x00, 0x01, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x23, 0x00, 0x00, 0x01, 0x00, 0x01, 0x17, 0x00, 0x03, 0x02, 0x00, 0x02,
+  0x42, 0x00, 0x00, 0x5f, 0x00, 0x03, 0xdd, 0x01, 0x02, 0x0d, 0x00, 0x00, 0x04, 0x00, 0x04, 0x05, 0x00, 0x01, 0x07, 0x00, 0x0c, 0x01, 0x00, 0x10,
+  0x1d, 0x03, 0x00, 0x00, 0xc7, 0x01, 0x02, 0x04, 0x00, 0x01, 0xb1, 0x00, 0x01, 0x01, 0x00, 0x00, 0xe6, 0x01, 0x03, 0x01, 0x00, 0x03, 0xd3, 0x00,
+  0x00, 0x07, 0x00, 0x00, 0xe7, 0x00, 0x05, 0x08, 0x00, 0x01, 0x09, 0x00, 0x03, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0xce, 0x01, 0x01, 0x07, 0x00,
+  0x00, 0x08, 0x00, 0x00, 0x21, 0x01, 0x00, 0x3a, 0x01, 0x01, 0xc0, 0x03, 0x00, 0x40, 0x01, 0x00, 0x02, 0x00, 0x01, 0x05, 0x00, 0x0a, 0x02, 0x00,
+  0x03, 0x45, 0x07, 0x11, 0x34, 0xe1, 0x01, 0x05, 0x01, 0x00, 0x03, 0xa2, 0x01, 0x00, 0x73, 0x05, 0x02, 0x08, 0x00, 0x01, 0xbe, 0x01, 0x06, 0x07,
+  0x00, 0x10, 0x4b, 0x01, 0x00, 0x11, 0x4a, 0x05, 0x00, 0x50, 0x4a, 0x4a, 0x48, 0x46, 0x3a, 0xd9, 0x01, 0x00, 0xe7, 0x01, 0x50, 0x43, 0x43, 0x43,
+  0x3a, 0x34, 0x33, 0x00, 0x00, 0x04, 0x00, 0x01, 0x01, 0x00, 0x14, 0x29, 0x0c, 0x00, 0x02, 0x06, 0x00, 0x00, 0xde, 0x01, 0x00, 0x09, 0x06, 0x0a,
+  0x8b, 0x00, 0x41, 0x22, 0x29, 0x28, 0x2e, 0x3c, 0x00, 0x20, 0x3f, 0x43, 0x01, 0x00, 0x20, 0x3a, 0x3f, 0x13, 0x00, 0x00, 0xd3, 0x00, 0x05, 0x01,
+  0x00, 0x00, 0xf0, 0x00, 0x02, 0x02, 0x00, 0x00, 0xac, 0x06, 0x01, 0x15, 0x01, 0x20, 0x1b, 0x22, 0x39, 0x01, 0x00, 0x17, 0x03, 0x01, 0x02, 0x00,
+  0x01, 0xff, 0x04, 0x01, 0x04, 0x00, 0x02, 0x01, 0x00, 0x00, 0x78, 0x01, 0x00, 0x02, 0x00, 0x01, 0x9f, 0x01, 0x00, 0x6c, 0x03, 0x12, 0x10, 0x0c,
+  0x00, 0x01, 0x02, 0x00, 0x00, 0xce, 0x01, 0x00, 0xd0, 0x01, 0x00, 0xc1, 0x05, 0x00, 0x08, 0x00, 0x00, 0x1e, 0x00, 0x00, 0xd8, 0x03, 0x00, 0x16,
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x06, 0x00, 0x00, 0x38, 0x00, 0x03, 0x40, 0x00, 0x02, 0x41, 0x00, 0x00, 0x03, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x5c,
+  0x00, 0x02, 0x04, 0x00, 0x04, 0x06, 0x00, 0x06, 0x01, 0x00, 0x00, 0x88, 0x00, 0x00, 0x06, 0x00, 0x01, 0x08, 0x00, 0x01, 0xda, 0x01, 0x01, 0x07,
+  0x00, 0x01, 0x99, 0x05, 0x00, 0xdc, 0x01, 0x02, 0x08, 0x00, 0x01, 0x01, 0x00, 0x00, 0xc6, 0x00, 0x04, 0x07, 0x00, 0x01, 0xda, 0x00, 0x06, 0x02,
+  0x00, 0x00, 0x03, 0x00, 0x06, 0x01, 0x00, 0x15, 0x28, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x30, 0x2e, 0x22, 0x28, 0xe9, 0x01, 0x00, 0x0f, 0x00, 0x00,
+  0x20, 0x03, 0x00, 0x3f, 0x01, 0x00, 0x02, 0x00, 0x01, 0x05, 0x00, 0x03, 0x02, 0x00, 0x14, 0x2e, 0x02, 0x00, 0x01, 0x94, 0x05, 0x02, 0x02, 0x00,
+  0x03, 0x05, 0x00, 0x32, 0x34, 0x2e, 0x28, 0x8a, 0x01, 0x01, 0xdb, 0x01, 0x05, 0x02, 0x00, 0x01, 0x05, 0x00, 0x10, 0x32, 0x09, 0x00, 0x02, 0x01,
+  0x00, 0x60, 0x4e, 0x4b, 0x4e, 0x4e, 0x4b, 0x4e, 0xe0, 0x01, 0x00, 0x01, 0x00, 0x40, 0x4a, 0x43, 0x3a, 0x43, 0xd0, 0x03, 0x71, 0x3a, 0x3a, 0x46,
+  0x4a, 0x48, 0x46, 0x3f, 0x02, 0x02, 0x00, 0x2b, 0x00, 0x00, 0xeb, 0x01, 0x01, 0xd4, 0x03, 0x00, 0x0c, 0x00, 0x00, 0xe7, 0x03, 0x00, 0x59, 0x00,
+  0x01, 0xf4, 0x01, 0x02, 0x78, 0x00, 0x11, 0x29, 0xd2, 0x03, 0x01, 0x91, 0x00, 0x40, 0x43, 0x43, 0x43, 0x46, 0xdb, 0x01, 0x02, 0x01, 0x00, 0x20,
+  0x3a, 0x2e, 0x96, 0x02, 0x00, 0x1a, 0x00, 0x00, 0xe0, 0x00, 0x05, 0xea, 0x01, 0x01, 0xf9, 0x00, 0x03, 0x02, 0x00, 0x00, 0x03, 0x00, 0x03, 0x01,
+  0x00, 0x00, 0xc6, 0x03, 0x01, 0xd9, 0x01, 0x01, 0x0b, 0x05, 0x09, 0x01, 0x00, 0x00, 0x92, 0x01, 0x06, 0x02, 0x00, 0x02, 0xb1, 0x01, 0x00, 0xcd,
+  0x01, 0x00, 0x0b, 0x00, 0x02, 0x9f, 0x07, 0x01, 0x0c, 0x00, 0x04, 0x02, 0x00, 0x01, 0x05, 0x00, 0x06, 0x02, 0x00, 0x00, 0x2e, 0x00, 0x02, 0x03,
+  0x00, 0x00, 0xc7, 0x01, 0x00, 0x04, 0x00, 0x01, 0x06, 0x00, 0x00, 0x09, 0x00, 0x03, 0x07, 0x00, 0x0f, 0x01, 0x00, 0x01, 0x00, 0xc6, 0x01, 0x03,
+  0x07, 0x00, 0x01, 0x02, 0x00, 0x0f, 0x01, 0x00, 0x08, 0x01, 0xc9, 0x00, 0x00, 0x06, 0x00, 0x06, 0xdd, 0x00, 0x00, 0x06, 0x00, 0x02, 0x01, 0x00,
+  0x00, 0xfc, 0x00, 0x00, 0x04, 0x00, 0x00, 0xc9, 0x01, 0x02, 0x06, 0x00, 0x00, 0x0f, 0x01, 0x00, 0x0d, 0x00, 0x10, 0x28, 0xde, 0x01, 0x00, 0x1e,
+  0x01, 0x00, 0xe0, 0x01, 0x06, 0xbe, 0x03, 0x04, 0x4e, 0x01, 0x11, 0x28, 0x52, 0x01, 0x03, 0x94, 0x05, 0x00, 0x61, 0x03, 0x02, 0x01, 0x00, 0x00,
+  0x0d, 0x00, 0x01, 0xd6, 0x01, 0x02, 0x01, 0x00, 0x00, 0x9c, 0x01, 0x01, 0x02, 0x00, 0x00, 0x05, 0x00, 0x06, 0x01, 0x00, 0x76, 0x2e, 0x3a, 0x2e,
+  0x3a, 0x2e, 0x34, 0x4e, 0x01, 0x00, 0x00, 0xe7, 0x01, 0x72, 0x46, 0x46, 0x4a, 0x4b, 0x4b, 0x4a, 0x46, 0x07, 0x00, 0x01, 0xa1, 0x01, 0x01, 0x01,
+  0x00, 0x01, 0x0a, 0x00, 0x00, 0xfa, 0x01, 0x05, 0x01, 0x00, 0x00, 0x16, 0x00, 0x00, 0x68, 0x07, 0x01, 0x6c, 0x00, 0x01, 0x6a, 0x00, 0x00, 0xd4,
+  0x09, 0x90, 0x34, 0x2e, 0x3a, 0x46, 0x48, 0x4a, 0x48, 0x46, 0x46, 0xe4, 0x01, 0x00, 0x2e, 0x00, 0x11, 0x3f, 0xa8, 0x00, 0x00, 0xba, 0x00, 0x00,
+  0x08, 0x00, 0x01, 0xc6, 0x00, 0x09, 0x01, 0x00, 0x00, 0x09, 0x01, 0x01, 0x1b, 0x01, 0x03, 0x01, 0x00, 0x00, 0x45, 0x01, 0x02, 0xde, 0x01, 0x01,
+  0x31, 0x03, 0x00, 0x01, 0x00, 0x03, 0x7e, 0x01, 0x02, 0x9b, 0x01, 0x04, 0x07, 0x00, 0x00, 0x09, 0x00, 0x01, 0x6a, 0x05, 0x02, 0xbc, 0x01, 0x00,
+  0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x01, 0xb1, 0x01, 0x00, 0x09, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x26, 0x00, 0x00, 0x0e, 0x00, 0x00,
+  0x02, 0x00, 0x01, 0x13, 0x00, 0x04, 0x01, 0x00, 0x00, 0x19, 0x00, 0x02, 0x01, 0x00, 0x06, 0x0a, 0x00, 0x07, 0xcc, 0x01, 0x05, 0x0a, 0x00, 0x01,
+  0x05, 0x00, 0x05, 0x07, 0x00, 0x00, 0x9f, 0x00, 0x08, 0xaf, 0x00, 0x00, 0x0d, 0x00, 0x01, 0xa2, 0x02, 0x09, 0x02, 0x00, 0x01, 0xd8, 0x00, 0x0a,
+  0x01, 0x00, 0x02, 0xf9, 0x00, 0x00, 0x06, 0x00, 0x00, 0xd2, 0x01, 0x00, 0x02, 0x00, 0x03, 0x0f, 0x01, 0x00, 0xc5, 0x01, 0x00, 0x13, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x04, 0x00, 0x02, 0x02, 0x00, 0x00, 0xd5, 0x01, 0x04, 0x02, 0x00, 0x01, 0x05, 0x00, 0x02, 0x69, 0x01, 0x00, 0x06, 0x00, 0x01,
+  0x08, 0x00, 0x01, 0x05, 0x00, 0x00, 0x78, 0x01, 0x20, 0x34, 0x28, 0xd9, 0x01, 0x03, 0x02, 0x00, 0x00, 0x10, 0x00, 0x0c, 0x01, 0x00, 0x00, 0xd9,
+  0x01, 0x04, 0x01, 0x00, 0x00, 0xe1, 0x01, 0x34, 0x4b, 0x4b, 0x4b, 0x08, 0x00, 0x20, 0x4b, 0x4b, 0xaa, 0x01, 0x10, 0x46, 0x04, 0x00, 0x80, 0x46,
+  0x4a, 0x46, 0x4b, 0x46, 0x4a, 0x48, 0x4a, 0xb9, 0x01, 0x01, 0x08, 0x00, 0x20, 0x4a, 0x43, 0x18, 0x00, 0x30, 0x3a, 0x3a, 0x34, 0xd1, 0x05, 0x40,
+  0x46, 0x46, 0x3a, 0x43, 0xdb, 0x03, 0x00, 0xc7, 0x07, 0x00, 0xdf, 0x01, 0x10, 0x4a, 0x35, 0x00, 0x00, 0x02, 0x00, 0x20, 0x45, 0x43, 0xed, 0x05,
+  0x00, 0x89, 0x00, 0x00, 0xce, 0x07, 0x00, 0x50, 0x04, 0x00, 0xbe, 0x00, 0x00, 0xf0, 0x00, 0x09, 0x01, 0x00, 0x00, 0x14, 0x01, 0x00, 0x27, 0x01,
+  0x00, 0x06, 0x00, 0x01, 0x42, 0x01, 0x00, 0xcb, 0x03, 0x01, 0x4c, 0x01, 0x00, 0x73, 0x01, 0x02, 0x01, 0x00, 0x03, 0x86, 0x01, 0x00, 0xa8, 0x01,
+  0x02, 0x02, 0x00, 0x04, 0x0c, 0x00, 0x00, 0xb5, 0x01, 0x00, 0xdb, 0x01, 0x00, 0x08, 0x00, 0x00, 0x01, 0x00, 0x02, 0xd4, 0x01, 0x00, 0x0f, 0x00,
+  0x02, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x28, 0x00, 0x01, 0x16, 0x00, 0x01, 0xfc, 0x01, 0x0f, 0x01, 0x00, 0x02, 0x00, 0x6b, 0x00, 0x00, 0x04,
+  0x00, 0x01, 0x06, 0x00, 0x01, 0xca, 0x01, 0x08, 0x02, 0x00, 0x0f, 0x01, 0x00, 0x02, 0x00, 0xb2, 0x00, 0x03, 0x01, 0x00, 0x00, 0xbf, 0x00, 0x01,
+  0x02, 0x00, 0x09, 0x01, 0x00, 0x11, 0x1d, 0xd5, 0x01, 0x00, 0xcd, 0x01, 0x02, 0x05, 0x00, 0x00, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0xc8, 0x01,
+  0x00, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x02, 0x02, 0x00, 0x01, 0x05, 0x00, 0x16, 0x29, 0xcf, 0x01, 0x08, 0x02, 0x00, 0x01, 0x90,
+  0x05, 0x01, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x48, 0x03, 0x00, 0x56, 0x01, 0x01, 0x03, 0x00, 0x00, 0x05, 0x00, 0x00, 0xc9, 0x01, 0x0f, 0xdd,
+  0x01, 0x01, 0x0b, 0xe0, 0x01, 0x00, 0xac, 0x05, 0x08, 0x01, 0x00, 0x00, 0x94, 0x07, 0x30, 0x46, 0x4a, 0x4a, 0x9f, 0x07, 0x10, 0x48, 0x9f, 0x07,
+  0x23, 0x4b, 0x4a, 0x06, 0x00, 0x30, 0x4b, 0x4a, 0x48, 0x07, 0x00, 0x00, 0xe8, 0x03, 0x00, 0xfc, 0x01, 0x00, 0xc1, 0x07, 0x10, 0x4a, 0x0d, 0x00,
+  0x30, 0x48, 0x4a, 0x48, 0x0b, 0x00, 0x02, 0x26, 0x00, 0x11, 0x4a, 0x13, 0x00, 0x00, 0xf3, 0x01, 0x02, 0xbe, 0x09, 0x00, 0x02, 0x04, 0x00, 0x05,
+  0x00, 0x11, 0x2e, 0x76, 0x06, 0x00, 0xe6, 0x01, 0x63, 0x28, 0x2e, 0x28, 0x22, 0x34, 0x2e, 0xf6, 0x00, 0x00, 0x1e, 0x01, 0x00, 0x02, 0x00, 0x00,
+  0x97, 0x07, 0x04, 0x01, 0x00, 0x00, 0x5b, 0x01, 0x02, 0x70, 0x01, 0x06, 0x01, 0x00, 0x04, 0xa0, 0x01, 0x03, 0xbb, 0x01, 0x07, 0x01, 0x00, 0x00,
+  0x12, 0x00, 0x03, 0x1e, 0x00, 0x0b, 0xad, 0x03, 0x0f, 0x01, 0x00, 0x0f, 0x00, 0x62, 0x00, 0x00, 0x6b, 0x00, 0x01, 0x02, 0x00, 0x02, 0x05, 0x00,
+  0x01, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x0b, 0x01, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x04, 0x00, 0x00, 0xb1, 0x00, 0x02, 0x02, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x05, 0x00, 0x01, 0x07, 0x00, 0x03, 0x0a, 0x00, 0x00, 0xdd, 0x00, 0x01, 0x03, 0x00, 0x01, 0xd4, 0x01,
+  0x01, 0xd2, 0x01, 0x05, 0x07, 0x00, 0x00, 0xcf, 0x01, 0x00, 0xb6, 0x03, 0x02, 0x01, 0x00, 0x12, 0x2e, 0x04, 0x00, 0x03, 0xbd, 0x03, 0x01, 0x05,
+  0x00, 0x02, 0x02, 0x00, 0x04, 0xd6, 0x01, 0x14, 0x28, 0xae, 0x03, 0x04, 0xd6, 0x01, 0x00, 0x02, 0x00, 0x02, 0xd8, 0x01, 0x03, 0x0a, 0x00, 0x0a,
+  0x01, 0x00, 0x10, 0x2e, 0x48, 0x09, 0x00, 0xc8, 0x01, 0x0f, 0x01, 0x00, 0x06, 0x00, 0xc4, 0x03, 0x0f, 0x01, 0x00, 0x09, 0x00, 0xc8, 0x01, 0x05,
+  0x01, 0x00, 0x01, 0xe7, 0x01, 0x00, 0xdd, 0x01, 0x01, 0x02, 0x00, 0x00, 0x01, 0x00, 0x20, 0x48, 0x4b, 0xcd, 0x03, 0x00, 0xc9, 0x03, 0x00, 0xf5,
+  0x03, 0x00, 0x05, 0x04, 0x50, 0x4a, 0x46, 0x4a, 0x48, 0x3a, 0xa9, 0x00, 0x00, 0x1e, 0x08, 0x10, 0x2e, 0xfd, 0x03, 0x00, 0xe6, 0x05, 0x10, 0x3a,
+  0xe4, 0x01, 0x01, 0x01, 0x00, 0x10, 0x29, 0xe7, 0x03, 0x01, 0x20, 0x01, 0x00, 0x3d, 0x01, 0x03, 0x01, 0x00, 0x02, 0x5e, 0x01, 0x00, 0x86, 0x01,
+  0x01, 0x87, 0x01, 0x0c, 0x01, 0x00, 0x03, 0x9b, 0x03, 0x00, 0xd0, 0x01, 0x00, 0x04, 0x00, 0x0f, 0x01, 0x00, 0x15, 0x06, 0x37, 0x02, 0x01, 0xc5,
+  0x01, 0x04, 0x02, 0x00, 0x00, 0x05, 0x00, 0x01, 0x08, 0x00, 0x05, 0x04, 0x00, 0x0e, 0x01, 0x00, 0x00, 0x9d, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x02,
+  0x00, 0x02, 0x01, 0x00, 0x00, 0xc9, 0x01, 0x01, 0x0f, 0x00, 0x00, 0x09, 0x00, 0x02, 0x01, 0x00, 0x00, 0xc7, 0x00, 0x02, 0x04, 0x00, 0x00, 0xdd,
+  0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0x00, 0x05, 0xd6, 0x01, 0x05, 0xd8, 0x01, 0x03, 0x0b, 0x00, 0x04, 0xda, 0x01, 0x01, 0xd2, 0x01, 0x05, 0x07,
+  0x00, 0x03, 0xd8, 0x01, 0x00, 0xa8, 0x03, 0x00, 0xdb, 0x01, 0x03, 0xc5, 0x03, 0x01, 0xcf, 0x01, 0x02, 0x02, 0x00, 0x01, 0xc4, 0x03, 0x00, 0x08,
+  0x00, 0x0b, 0x01, 0x00, 0x10, 0x3a, 0x03, 0x00, 0x0f, 0xe0, 0x01, 0x04, 0x10, 0x4f, 0x05, 0x00, 0x02, 0x01, 0x00, 0x01, 0xac, 0x05, 0x03, 0x09,
+  0x00, 0x12, 0x4b, 0x8a, 0x09, 0x02, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x05, 0x00, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x07, 0x0f, 0x00, 0x06,
+  0x01, 0x00, 0x00, 0xea, 0x01, 0x00, 0xc9, 0x03, 0x00, 0xe8, 0x01, 0x22, 0x4b, 0x48, 0x0a, 0x00, 0x00, 0x9c, 0x07, 0x11, 0x46, 0xc1, 0x07, 0x00,
+  0x05, 0x00, 0x00, 0xd3, 0x03, 0x01, 0xaa, 0x0b, 0x01, 0xb9, 0x09, 0x20, 0x3a, 0x43, 0xc4, 0x09, 0x00, 0xdd, 0x02, 0x00, 0x35, 0x01, 0x00, 0x3a,
+  0x01, 0x04, 0x01, 0x00, 0x00, 0x74, 0x01, 0x02, 0x8d, 0x01, 0x04, 0x05, 0x00, 0x0f, 0x01, 0x00, 0x29, 0x01, 0x41, 0x00, 0x02, 0xc9, 0x01, 0x02,
+  0x09, 0x00, 0x01, 0x06, 0x00, 0x00, 0xcf, 0x01, 0x00, 0xd2, 0x01, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x04, 0x08, 0x00, 0x06, 0x01, 0x00, 0x00,
+  0x93, 0x00, 0x03, 0x04, 0x00, 0x01, 0xce, 0x01, 0x07, 0xd0, 0x01, 0x06, 0x01, 0x00, 0x00, 0xd6, 0x01, 0x01, 0x01, 0x00, 0x01, 0xd2, 0x01, 0x02,
+  0x02, 0x00, 0x03, 0x01, 0x00, 0x05, 0x09, 0x00, 0x03, 0xd9, 0x01, 0x01, 0xd3, 0x01, 0x02, 0xde, 0x01, 0x04, 0x09, 0x00, 0x03, 0x02, 0x00, 0x01,
+  0x03, 0x00, 0x41, 0x28, 0x34, 0x28, 0x34, 0xb6, 0x03, 0x00, 0xdb, 0x06, 0x00, 0x08, 0x00, 0x02, 0xcb, 0x01, 0x02, 0x06, 0x00, 0x02, 0x05, 0x00,
+  0x0f, 0x01, 0x00, 0x05, 0x00, 0xdc, 0x01, 0x00, 0xe3, 0x01, 0x23, 0x4e, 0x4f, 0x02, 0x00, 0x00, 0xd8, 0x01, 0x04, 0x02, 0x00, 0x01, 0x0d, 0x00,
+  0x0f, 0x01, 0x00, 0x03, 0x01, 0xcd, 0x01, 0x04, 0x01, 0x00, 0x03, 0x0c, 0x00, 0x01, 0x07, 0x00, 0x00, 0x05, 0x00, 0x0f, 0xe5, 0x01, 0x03, 0x12,
+  0x4b, 0xe6, 0x03, 0x01, 0xbb, 0x05, 0x00, 0xe2, 0x01, 0x00, 0xd4, 0x05, 0x01, 0x01, 0x00, 0x00, 0xdb, 0x01, 0x01, 0xed, 0x01, 0x02, 0x0a, 0x00,
+  0x05, 0x01, 0x00, 0x00, 0xe4, 0x01, 0x00, 0x10, 0x03, 0x04, 0x15, 0x03, 0x02, 0x4d, 0x01, 0x01, 0x01, 0x00, 0x00, 0x84, 0x01, 0x01, 0x86, 0x01,
+  0x01, 0x02, 0x00, 0x06, 0x01, 0x00, 0x01, 0x0c, 0x00, 0x01, 0x05, 0x00, 0x06, 0x01, 0x00, 0x0b, 0x0f, 0x00, 0x00, 0x11, 0x00, 0x00, 0x02, 0x00,
+  0x01, 0x09, 0x00, 0x01, 0x0a, 0x00, 0x01, 0x0c, 0x00, 0x03, 0x4e, 0x00, 0x02, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x01, 0x01, 0x00,
+  0x05, 0x09, 0x00, 0x0d, 0x01, 0x00, 0x11, 0x21, 0x91, 0x00, 0x00, 0xa2, 0x00, 0x06, 0x05, 0x00, 0x03, 0x06, 0x00, 0x00, 0xcd, 0x01, 0x0a, 0x02,
+  0x00, 0x00, 0x03, 0x00, 0x0b, 0x01, 0x00, 0x09, 0xd9, 0x01, 0x03, 0x05, 0x00, 0x01, 0x11, 0x00, 0x04, 0x02, 0x00, 0x12, 0x34, 0x06, 0x00, 0x03,
+  0x9d, 0x03, 0x00, 0x02, 0x00, 0x01, 0xdc, 0x01, 0x00, 0x09, 0x00, 0x01, 0x0c, 0x00, 0x0f, 0x01, 0x00, 0x0a, 0x02, 0xb9, 0x03, 0x01, 0x05, 0x00,
+  0x26, 0x3a, 0x34, 0xc9, 0x01, 0x60, 0x4f, 0x4e, 0x51, 0x4e, 0x4f, 0x4f, 0xdf, 0x01, 0x13, 0x4f, 0x07, 0x00, 0x06, 0x1c, 0x00, 0x0f, 0x01, 0x00,
+  0x08, 0x00, 0xd6, 0x01, 0x02, 0x01, 0x00, 0x01, 0x08, 0x00, 0x04, 0xe3, 0x01, 0x03, 0x07, 0x00, 0x04, 0x01, 0x00, 0x03, 0xc9, 0x03, 0x01, 0x06,
+  0x00, 0x21, 0x48, 0x4a, 0x7d, 0x09, 0x03, 0xe8, 0x01, 0x11, 0x43, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x01, 0xe3,
+  0x01, 0x11, 0x34, 0x1c, 0x01, 0x00, 0x36, 0x01, 0x03, 0x3b, 0x01, 0x04, 0xe2, 0x01, 0x04, 0x79, 0x01, 0x06, 0x95, 0x01, 0x05, 0x0c, 0x00, 0x00,
+  0xab, 0x01, 0x02, 0xba, 0x01, 0x02, 0x05, 0x00, 0x01, 0x06, 0x00, 0x09, 0x02, 0x00, 0x02, 0x24, 0x00, 0x01, 0x05, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x06, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x01, 0x00, 0x08, 0x10, 0x21, 0x69, 0x02, 0x11, 0x21,
+  0xde, 0x01, 0x00, 0x0a, 0x00, 0x03, 0x02, 0x00, 0x00, 0xa6, 0x00, 0x23, 0x22, 0x21, 0x02, 0x00, 0x01, 0xb4, 0x00, 0x04, 0x05, 0x00, 0x00, 0x03,
+  0x00, 0x0f, 0x01, 0x00, 0x00, 0x00, 0xbb, 0x01, 0x03, 0xb1, 0x03, 0x01, 0x07, 0x00, 0x00, 0xa0, 0x03, 0x06, 0x02, 0x00, 0x00, 0x15, 0x00, 0x00,
+  0xbd, 0x03, 0x01, 0xc8, 0x01, 0x05, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xe2, 0x01, 0x00, 0xb9, 0x01, 0x02, 0x01, 0x00, 0x07, 0x0b, 0x00, 0x0d,
+  0x01, 0x00, 0x01, 0x9e, 0x05, 0x01, 0xe8, 0x01, 0x10, 0x3a, 0xd8, 0x01, 0x00, 0xd1, 0x01, 0x01, 0xce, 0x01, 0x00, 0x07, 0x00, 0x06, 0x0c, 0x00,
+  0x01, 0x06, 0x00, 0x00, 0xb4, 0x01, 0x03, 0x07, 0x00, 0x0f, 0x01, 0x00, 0x07, 0x00, 0xda, 0x01, 0x03, 0xc3, 0x03, 0x01, 0x05, 0x00, 0x01, 0x02,
+  0x00, 0x0b, 0x01, 0x00, 0x00, 0xbb, 0x03, 0x01, 0xc8, 0x03, 0x00, 0x08, 0x00, 0x01, 0x01, 0x00, 0x04, 0x9b, 0x07, 0x05, 0x01, 0x00, 0x01, 0xdd,
+  0x01, 0x02, 0x02, 0x00, 0x20, 0x43, 0x3a, 0x1e, 0x01, 0x00, 0xdc, 0x01, 0x00, 0x07, 0x00, 0x01, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x66, 0x01,
+  0x0f, 0x01, 0x00, 0x0f, 0x01, 0xa5, 0x01, 0x00, 0x05, 0x00, 0x02, 0xb6, 0x01, 0x00, 0x04, 0x00, 0x02, 0x05, 0x00, 0x01, 0x01, 0x00, 0x01, 0x0a,
+  0x00, 0x01, 0x05, 0x00, 0x0f, 0x01, 0x00, 0x10, 0x12, 0x21, 0x03, 0x00, 0x10, 0x22, 0x07, 0x00, 0x32, 0x22, 0x1d, 0x22, 0xdd, 0x01, 0x10, 0x22,
+  0xe9, 0x01, 0x00, 0xce, 0x01, 0x10, 0x21, 0x0c, 0x00, 0x02, 0xdd, 0x01, 0x01, 0xaa, 0x00, 0x01, 0xab, 0x00, 0x00, 0xb9, 0x00, 0x01, 0x01, 0x00,
+  0x03, 0x07, 0x00, 0x07, 0x01, 0x00, 0x01, 0xcf, 0x01, 0x04, 0x08, 0x00, 0x02, 0x02, 0x00, 0x00, 0xd1, 0x01, 0x00, 0x04, 0x00, 0x00, 0x06, 0x00,
+  0x03, 0x02, 0x00, 0x05, 0xdc, 0x01, 0x00, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x0f, 0x01, 0x00, 0x10, 0x02, 0xad, 0x03, 0x02, 0x01, 0x00, 0x01, 0xd8,
+  0x01, 0x04, 0x02, 0x00, 0x00, 0xbc, 0x01, 0x00, 0xbe, 0x01, 0x01, 0xd1, 0x01, 0x00, 0x0b, 0x00, 0x12, 0x51, 0x0a, 0x00, 0x04, 0x01, 0x00, 0x00,
+  0x1a, 0x00, 0x0c, 0x01, 0x00, 0x0b, 0x12, 0x00, 0x00, 0xde, 0x01, 0x05, 0x07, 0x00, 0x01, 0xdb, 0x01, 0x00, 0x02, 0x00, 0x02, 0x05, 0x00, 0x08,
+  0x01, 0x00, 0x03, 0xe0, 0x01, 0x01, 0x09, 0x00, 0x03, 0x8e, 0x07, 0x00, 0x62, 0x0b, 0x07, 0x01, 0x00, 0x01, 0x68, 0x0b, 0x02, 0x02, 0x00, 0x10,
+  0x3a, 0x82, 0x06, 0x00, 0x24, 0x01, 0x00, 0x37, 0x01, 0x03, 0x01, 0x00, 0x10, 0x28, 0x4e, 0x01, 0x03, 0x02, 0x00, 0x02, 0x7d, 0x01, 0x25, 0x21,
+  0x1d, 0x0b, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0a, 0x00, 0x05, 0x01, 0x00, 0x0a, 0x0e, 0x00, 0x0f, 0x01, 0x00, 0x09, 0x04, 0x2a, 0x00, 0x02, 0x42,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x62, 0x00, 0x00, 0x59, 0x00, 0x01, 0xa1, 0x03, 0x30, 0x21, 0x22, 0x22, 0xe2, 0x01, 0x32, 0x28, 0x1d, 0x28, 0x0e,
+  0x00, 0x30, 0x21, 0x1d, 0x28, 0x14, 0x00, 0x01, 0x01, 0x00, 0x00, 0x08, 0x00, 0x01, 0xd8, 0x01, 0x01, 0x31, 0x00, 0x00, 0xad, 0x00, 0x00, 0xd7,
+  0x01, 0x00, 0x05, 0x00, 0x0e, 0xde, 0x01, 0x00, 0x01, 0x00, 0x00, 0xd5, 0x00, 0x02, 0xda, 0x00, 0x07, 0xd1, 0x01, 0x0a, 0x02, 0x00, 0x01, 0xdc,
+  0x01, 0x00, 0xd7, 0x01, 0x00, 0xe1, 0x01, 0x00, 0x11, 0x00, 0x0f, 0x01, 0x00, 0x0c, 0x00, 0x27, 0x0b, 0x01, 0xcb, 0x01, 0x01, 0x02, 0x00, 0x00,
+  0x03, 0x00, 0x01, 0x09, 0x00, 0x03, 0x02, 0x00, 0x00, 0xd9, 0x01, 0x06, 0x02, 0x00, 0x0b, 0x01, 0x00, 0x10, 0x51, 0x05, 0x00, 0x00, 0x18, 0x00,
+  0x01, 0x02, 0x00, 0x07, 0x01, 0x00, 0x01, 0x0f, 0x00, 0x09, 0x12, 0x00, 0x00, 0x01, 0x00, 0x02, 0xe2, 0x01, 0x01, 0x09, 0x00, 0x00, 0xdc, 0x01,
+  0x0b, 0xdf, 0x01, 0x00, 0xd8, 0x01, 0x00, 0x06, 0x00, 0x00, 0x01, 0x00, 0x01, 0xa9, 0x05, 0x00, 0x11, 0x00, 0x00, 0xc4, 0x03, 0x09, 0x01, 0x00,
+  0x00, 0xa7, 0x05, 0x02, 0xe1, 0x01, 0x00, 0xaa, 0x00, 0x00, 0x13, 0x01, 0x01, 0x0a, 0x03, 0x00, 0x2e, 0x01, 0x00, 0x06, 0x00, 0x00, 0x64, 0x01,
+  0x02, 0x01, 0x00, 0x00, 0x51, 0x01, 0x00, 0x01, 0x00, 0x10, 0x1d, 0x7a, 0x01, 0x04, 0xf0, 0x08, 0x00, 0x15, 0x00, 0x02, 0xa6, 0x01, 0x00, 0x17,
+  0x07, 0x03, 0xf5, 0x01, 0x00, 0x07, 0x00, 0x01, 0xa2, 0x01, 0x00, 0x16, 0x00, 0x00, 0x05, 0x00, 0x00, 0x12, 0x00, 0x00, 0x18, 0x00, 0x00, 0x80,
+  0x03, 0x00, 0x83, 0x03, 0x00, 0x91, 0x03, 0x00, 0x02, 0x00, 0x01, 0x0a, 0x00, 0x00, 0x10, 0x00, 0x01, 0xa5, 0x03, 0x06, 0x24, 0x00, 0x00, 0x6a,
+  0x00, 0x00, 0x09, 0x00, 0x02, 0x02, 0x00, 0x02, 0x10, 0x00, 0x30, 0x28, 0x21, 0x28, 0xd1, 0x01, 0x41, 0x28, 0x22, 0x28, 0x21, 0x03, 0x00, 0x0f,
+  0x01, 0x00, 0x0b, 0x00, 0xd2, 0x01, 0x06, 0x02, 0x00, 0x02, 0xb0, 0x03, 0x00, 0x47, 0x0c, 0x00, 0x0c, 0x00, 0x0b, 0x02, 0x00, 0x0f, 0xb3, 0x03,
+  0x16, 0x00, 0x20, 0x01, 0x02, 0x01, 0x00, 0x01, 0x09, 0x00, 0x01, 0x30, 0x01, 0x01, 0x06, 0x00, 0x00, 0x92, 0x0c, 0x90, 0x34, 0x3a, 0x34, 0x3a,
+  0x34, 0x3a, 0x3a, 0x3a, 0x34, 0x71, 0x4f, 0x4e, 0x4f, 0x4f, 0x4f, 0x51, 0x4e, 0x07, 0x00, 0x61, 0x4e, 0x4e, 0x4e, 0x4f, 0x4f, 0x51, 0x03, 0x00,
+  0x04, 0x01, 0x00, 0x01, 0x1a, 0x00, 0x05, 0x02, 0x00, 0x00, 0x01, 0x00, 0x02, 0x06, 0x00, 0x05, 0x0f, 0x00, 0x05, 0x01, 0x00, 0x15, 0x4b, 0x05,
+  0x00, 0x02, 0x01, 0x00, 0x10, 0x4b, 0x02, 0x00, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x30, 0x4a, 0x4b, 0x4a, 0x07, 0x00, 0x05, 0x06, 0x00, 0x01,
+  0x08, 0x00, 0x2b, 0x4a, 0x46, 0x01, 0x00, 0x31, 0x43, 0x46, 0x43, 0x05, 0x00, 0xa0, 0x43, 0x43, 0x43, 0x3a, 0x3a, 0x34, 0x2e, 0x28, 0x28, 0x28,
+  0x04, 0x00, 0x30, 0x28, 0x28, 0x22, 0x05, 0x00, 0x04, 0x01, 0x00, 0xf0, 0x04, 0x22, 0x28, 0x28, 0x22, 0x22, 0x22, 0x22, 0x28, 0x28, 0x21, 0x28,
+  0x22, 0x28, 0x22, 0x21, 0x22, 0x21, 0x22, 0x28, 0x05, 0x00, 0x31, 0x21, 0x22, 0x22, 0x04, 0x00, 0x01, 0x0b, 0x00, 0xd0, 0x21, 0x28, 0x22, 0x22,
+  0x1d, 0x22, 0x1d, 0x22, 0x22, 0x22, 0x1d, 0x28, 0x1d, 0x17, 0x00, 0x01, 0x15, 0x00, 0x01, 0x02, 0x00, 0x30, 0x1d, 0x22, 0x21, 0x14, 0x00, 0x0b,
+  0x16, 0x00, 0x20, 0x21, 0x1d, 0x02, 0x00, 0x01, 0x05, 0x00, 0x00, 0x0e, 0x00, 0x01, 0x28, 0x00, 0x55, 0x22, 0x22, 0x28, 0x1d, 0x28, 0x26, 0x00,
+  0x00, 0x77, 0x00, 0x01, 0x73, 0x00, 0x02, 0x83, 0x00, 0x01, 0x04, 0x00, 0x0a, 0x01, 0x00, 0x02, 0xac, 0x00, 0x04, 0x01, 0x00, 0x40, 0x2e, 0x28,
+  0x28, 0x34, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x31, 0x34, 0x28, 0x2e, 0x06, 0x00, 0x03, 0x02, 0x00, 0x01, 0x1c,
+  0x00, 0x01, 0x08, 0x00, 0x03, 0x01, 0x00, 0x01, 0x0b, 0x00, 0x01, 0x05, 0x00, 0x0f, 0x01, 0x00, 0x08, 0x11, 0x3a, 0x03, 0x00, 0x2d, 0x34, 0x3a,
+  0x02, 0x00, 0x01, 0x05, 0x00, 0x10, 0x3a, 0x03, 0x00, 0x03, 0x01, 0x00, 0x33, 0x4e, 0x4f, 0x4e, 0xcf, 0x01, 0x00, 0xb3, 0x01, 0x00, 0xd1, 0x01,
+  0x03, 0x0f, 0x00, 0x00, 0xdb, 0x01, 0x0a, 0x01, 0x00, 0x00, 0x21, 0x00, 0x12, 0x4e, 0xf1, 0x01, 0x01, 0x05, 0x00, 0x0b, 0xe1, 0x01, 0x0a, 0xdd,
+  0x01, 0x01, 0x05, 0x00, 0x01, 0xdf, 0x01, 0x01, 0x06, 0x00, 0x00, 0x09, 0x00, 0x00, 0xce, 0x01, 0x00, 0x05, 0x00, 0x09, 0x01, 0x00, 0x30, 0x4a,
+  0x4a, 0x48, 0xd6, 0x01, 0x03, 0x01, 0x00, 0x02, 0x0c, 0x00, 0x00, 0xe3, 0x01, 0x00, 0xe2, 0x01, 0x60, 0x3a, 0x43, 0x3a, 0x34, 0x34, 0x2e, 0x11,
+  0x01, 0x02, 0x02, 0x00, 0x0e, 0x01, 0x00, 0x0d, 0x61, 0x01, 0x11, 0x21, 0x05, 0x00, 0x02, 0x90, 0x01, 0x01, 0xf6, 0x01, 0x04, 0x02, 0x00, 0x00,
+  0x0d, 0x00, 0x01, 0x12, 0x00, 0x00, 0xfe, 0x01, 0x14, 0x28, 0x1a, 0x00, 0x00, 0x17, 0x02, 0x00, 0x20, 0x02, 0x00, 0x04, 0x00, 0x0c, 0x02, 0x00,
+  0x10, 0x28, 0xdb, 0x01, 0x10, 0x1d, 0x40, 0x02, 0x00, 0x26, 0x00, 0x01, 0x10, 0x00, 0x0f, 0x01, 0x00, 0x0d, 0x10, 0x2e, 0x98, 0x01, 0x00, 0xc2,
+  0x01, 0x01, 0xa1, 0x01, 0x00, 0xb7, 0x01, 0x02, 0x02, 0x00, 0x0f, 0x01, 0x00, 0x14, 0x0f, 0x29, 0x00, 0x0a, 0x01, 0xbc, 0x01, 0x01, 0x01, 0x00,
+  0x00, 0xc3, 0x01, 0x03, 0x07, 0x00, 0x04, 0x02, 0x00, 0x04, 0x0f, 0x00, 0x02, 0xda, 0x01, 0x00, 0x04, 0x00, 0x02, 0x05, 0x00, 0x21, 0x3a, 0x3a,
+  0xd5, 0x01, 0x02, 0xb2, 0x03, 0x00, 0xb3, 0x01, 0x00, 0x0b, 0x00, 0x10, 0x51, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x15, 0x00, 0x09, 0x01, 0x00,
+  0x00, 0x22, 0x00, 0x00, 0xd7, 0x01, 0x01, 0x03, 0x00, 0x00, 0x2e, 0x00, 0x00, 0xc7, 0x01, 0x0f, 0x01, 0x00, 0x03, 0x00, 0xe2, 0x01, 0x00, 0xd6,
+  0x01, 0x05, 0x03, 0x00, 0x00, 0x01, 0x00, 0x0e, 0xdf, 0x01, 0x00, 0xe1, 0x01, 0x39, 0x4a, 0x4a, 0x46, 0xc6, 0x03, 0x01, 0xdd, 0x01, 0x04, 0xc1,
+  0x03, 0x03, 0xe1, 0x01, 0x01, 0xfd, 0x02, 0x01, 0xe4, 0x01, 0x01, 0x0c, 0x00, 0x0e, 0x01, 0x00, 0x01, 0xd9, 0x01, 0x02, 0xf2, 0x01, 0x00, 0xae,
+  0x01, 0x02, 0x68, 0x03, 0x00, 0x94, 0x01, 0x04, 0x02, 0x00, 0x00, 0x18, 0x00, 0x01, 0x28, 0x00, 0x00, 0x1c, 0x00, 0x00, 0xb2, 0x01, 0x00, 0xb9,
+  0x01, 0x15, 0x21, 0xd9, 0x01, 0x01, 0xc3, 0x01, 0x03, 0x02, 0x00, 0x00, 0x28, 0x00, 0x00, 0x40, 0x00, 0x02, 0x32, 0x00, 0x0e, 0x01, 0x00, 0x00,
+  0xc7, 0x01, 0x01, 0x87, 0x00, 0x01, 0xbd, 0x01, 0x04, 0x02, 0x00, 0x05, 0x01, 0x00, 0x07, 0x0b, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x83, 0x01, 0x0f,
+  0x01, 0x00, 0x00, 0x01, 0x15, 0x00, 0x01, 0x05, 0x00, 0x03, 0x06, 0x00, 0x00, 0x08, 0x00, 0x06, 0x02, 0x00, 0x00, 0xa9, 0x01, 0x01, 0x09, 0x00,
+  0x01, 0x02, 0x00, 0x01, 0x05, 0x00, 0x04, 0x02, 0x00, 0x06, 0x0e, 0x00, 0x05, 0x0b, 0x00, 0x00, 0x08, 0x00, 0x08, 0x01, 0x00, 0x01, 0xac, 0x01,
+  0x34, 0x4f, 0x4f, 0x51, 0xcd, 0x01, 0x00, 0xdf, 0x01, 0x01, 0x05, 0x00, 0x01, 0x07, 0x00, 0x01, 0x11, 0x00, 0x03, 0x01, 0x00, 0x00, 0x27, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0xd9, 0x01, 0x02, 0x02, 0x00, 0x00, 0x05, 0x00, 0x0f, 0x01, 0x00, 0x07, 0x10, 0x4b, 0x03, 0x00, 0x00, 0xc2, 0x01, 0x00,
+  0x06, 0x00, 0x00, 0x0b, 0x00, 0x02, 0x0d, 0x00, 0x0d, 0x01, 0x00, 0x39, 0x4a, 0x46, 0x46, 0xc4, 0x03, 0x0a, 0xe1, 0x01, 0x20, 0x3a, 0x34, 0xd8,
+  0x01, 0x00, 0x6a, 0x01, 0x10, 0x21, 0x6e, 0x01, 0x00, 0x99, 0x01, 0x21, 0x21, 0x1d, 0x86, 0x01, 0x00, 0x08, 0x00, 0x00, 0x0a, 0x00, 0x06, 0x04,
+  0x00, 0x00, 0x02, 0x00, 0x00, 0x18, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x02, 0x10, 0x00, 0x00, 0x06, 0x00, 0x11, 0x21, 0x14, 0x00, 0x02,
+  0xba, 0x01, 0x05, 0xd3, 0x01, 0x01, 0x94, 0x03, 0x00, 0x06, 0x00, 0x07, 0x02, 0x00, 0x02, 0x66, 0x00, 0x01, 0x01, 0x00, 0x04, 0x47, 0x05, 0x01,
+  0x08, 0x00, 0x00, 0x92, 0x03, 0x00, 0x02, 0x00, 0x00, 0xdb, 0x01, 0x0e, 0x01, 0x00, 0x30, 0x28, 0x3a, 0x2e, 0x07, 0x00, 0x05, 0x99, 0x01, 0x05,
+  0x09, 0x00, 0x00, 0x6e, 0x01, 0x02, 0x02, 0x00, 0x02, 0x0a, 0x00, 0x05, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x0d, 0x11, 0x00, 0x0f, 0x01, 0x00, 0x07,
+  0x00, 0x09, 0x01, 0x0f, 0x01, 0x00, 0x00, 0x01, 0x17, 0x00, 0x00, 0x47, 0x00, 0x04, 0x02, 0x00, 0x0e, 0x01, 0x00, 0x00, 0x8a, 0x01, 0x00, 0xd3,
+  0x01, 0x02, 0x01, 0x00, 0x11, 0x4e, 0xda, 0x01, 0x02, 0xe0, 0x01, 0x00, 0x06, 0x00, 0x00, 0x14, 0x00, 0x00, 0x17, 0x00, 0x00, 0xcd, 0x01, 0x05,
+  0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x04, 0x00, 0x01, 0x07, 0x00, 0x0f, 0xe3, 0x01, 0x08, 0x02, 0xc3, 0x03, 0x01, 0x05, 0x00, 0x00, 0x02, 0x00,
+  0x0f, 0xdf, 0x01, 0x05, 0x11, 0x4b, 0xc0, 0x03, 0x0e, 0xc2, 0x03, 0x00, 0x01, 0x00, 0x01, 0xa2, 0x05, 0x00, 0xdb, 0x01, 0x10, 0x21, 0x2f, 0x07,
+  0xb3, 0x28, 0x34, 0x28, 0x1d, 0x1d, 0x16, 0x1d, 0x16, 0x1d, 0x1d, 0x19, 0x02, 0x00, 0x31, 0x16, 0x1d, 0x19, 0x0e, 0x00, 0x13, 0x16, 0x04, 0x00,
+  0x31, 0x19, 0x1d, 0x21, 0x06, 0x00, 0x00, 0x02, 0x00, 0x80, 0x16, 0x16, 0x16, 0x16, 0x1d, 0x21, 0x16, 0x21, 0x18, 0x00, 0x00, 0x34, 0x00, 0x30,
+  0x21, 0x22, 0x1d, 0xb7, 0x01, 0x30, 0x28, 0x28, 0x28, 0x66, 0x07, 0x12, 0x1d, 0x69, 0x07, 0x00, 0x02, 0x00, 0x32, 0x1d, 0x16, 0x19, 0x02, 0x00,
+  0x00, 0x13, 0x00, 0x00, 0x20, 0x00, 0x10, 0x30, 0xca, 0x01, 0x01, 0xcf, 0x01, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x0f, 0x01, 0x00, 0x09, 0x01,
+  0x59, 0x01, 0x04, 0x02, 0x00, 0x0f, 0x01, 0x00, 0x0a, 0x01, 0x8f, 0x01, 0x0a, 0x01, 0x00, 0x00, 0xe2, 0x00, 0x04, 0x01, 0x00, 0x20, 0x43, 0x40,
+  0xf2, 0x00, 0x02, 0x01, 0x00, 0x05, 0x18, 0x00, 0x30, 0x43, 0x3a, 0x3a, 0x09, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x1f, 0x00, 0x02, 0x05, 0x00, 0x00,
+  0x0e, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x23, 0x00, 0x08, 0x01, 0x00, 0x22, 0x43, 0x46, 0x13, 0x00, 0x40, 0x43, 0x40, 0x3a, 0x40, 0x3d, 0x00, 0x10,
+  0x43, 0x79, 0x01, 0x00, 0xaa, 0x01, 0x04, 0xaa, 0x03, 0x04, 0xd9, 0x01, 0x00, 0xc1, 0x03, 0x01, 0x08, 0x00, 0x00, 0x15, 0x00, 0x00, 0x22, 0x00,
+  0x00, 0xcb, 0x01, 0x09, 0x01, 0x00, 0x05, 0x11, 0x00, 0x00, 0xc3, 0x01, 0x0f, 0x01, 0x00, 0x03, 0x00, 0xd7, 0x01, 0x05, 0x02, 0x00, 0x2f, 0x4b,
+  0x4e, 0xa0, 0x05, 0x02, 0x02, 0xdf, 0x01, 0x2f, 0x48, 0x46, 0xe2, 0x01, 0x03, 0x01, 0xe1, 0x01, 0x10, 0x21, 0x9e, 0x01, 0x71, 0x28, 0x21, 0x21,
+  0x28, 0x34, 0x30, 0x1d, 0x89, 0x01, 0x00, 0x02, 0x00, 0x06, 0x0a, 0x00, 0x07, 0x0c, 0x00, 0x31, 0x21, 0x16, 0x21, 0xd3, 0x01, 0x01, 0xb3, 0x03,
+  0x40, 0x21, 0x21, 0x21, 0x19, 0x05, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x6e, 0x05, 0x02, 0xbe, 0x03, 0x02, 0xeb, 0x08, 0x08, 0x11, 0x00, 0x00, 0x0c,
+  0x00, 0x00, 0x5f, 0x00, 0x03, 0xdf, 0x03, 0x01, 0x22, 0x00, 0x01, 0x03, 0x00, 0x03, 0x02, 0x00, 0x00, 0xa1, 0x03, 0x01, 0x28, 0x06, 0x02, 0x08,
+  0x00, 0x08, 0x01, 0x00, 0x00, 0xd4, 0x01, 0x01, 0x05, 0x00, 0x02, 0x47, 0x03, 0x0f, 0x01, 0x00, 0x05, 0x00, 0xc7, 0x00, 0x01, 0x03, 0x00, 0x01,
+  0xd1, 0x00, 0x03, 0x06, 0x00, 0x17, 0x40, 0x02, 0x00, 0x01, 0x05, 0x00, 0x10, 0x40, 0xf4, 0x00, 0x11, 0x40, 0xfa, 0x00, 0x12, 0x46, 0x07, 0x00,
+  0x01, 0x19, 0x00, 0x00, 0x09, 0x00, 0x02, 0x02, 0x00, 0x51, 0x43, 0x42, 0x43, 0x42, 0x43, 0x0a, 0x00, 0x02, 0x02, 0x00, 0x01, 0x05, 0x00, 0x05,
+  0x2e, 0x01, 0x11, 0x42, 0x98, 0x0a, 0x00, 0x04, 0x00, 0x30, 0x43, 0x42, 0x46, 0x2a, 0x00, 0x01, 0x13, 0x00, 0x00, 0x4a, 0x07, 0x01, 0x01, 0x00,
+  0x00, 0xaa, 0x01, 0x00, 0x01, 0x00, 0x00, 0xd8, 0x01, 0x02, 0xdf, 0x01, 0x02, 0xde, 0x01, 0x17, 0x51, 0xca, 0x01, 0x04, 0x01, 0x00, 0x15, 0x51,
+  0x13, 0x00, 0x00, 0x08, 0x00, 0x04, 0x42, 0x00, 0x00, 0x01, 0x00, 0x07, 0x0b, 0x00, 0x05, 0xe0, 0x01, 0x01, 0x08, 0x00, 0x00, 0x03, 0x00, 0x01,
+  0x04, 0x00, 0x03, 0x01, 0x00, 0x07, 0x0b, 0x00, 0x01, 0xe1, 0x01, 0x0f, 0xde, 0x01, 0x02, 0x20, 0x43, 0x40, 0x8e, 0x02, 0xe2, 0x34, 0x28, 0x19,
+  0x16, 0x9f, 0x16, 0x21, 0x28, 0x1d, 0x2a, 0x28, 0x2a, 0x10, 0x9f, 0x01, 0x00, 0x10, 0x16, 0x02, 0x00, 0x13, 0x12, 0x06, 0x00, 0x30, 0x12, 0x10,
+  0x19, 0x06, 0x00, 0x01, 0x02, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x16, 0x00, 0x61, 0x9f, 0x16, 0x9f, 0x10, 0x9f, 0x10, 0x1e, 0x00, 0x00, 0xfa, 0x01,
+  0x01, 0xd2, 0x03, 0x00, 0xad, 0x03, 0x01, 0xee, 0x01, 0x00, 0x01, 0x00, 0x00, 0xd3, 0x01, 0x81, 0x28, 0x2a, 0x28, 0x2a, 0x28, 0x30, 0x28, 0x28,
+  0x08, 0x00, 0x01, 0x05, 0x00, 0x00, 0x0f, 0x00, 0x04, 0x02, 0x00, 0x13, 0x34, 0x06, 0x00, 0x05, 0x02, 0x00, 0x00, 0x03, 0x00, 0x0e, 0x01, 0x00,
+  0x0f, 0xd8, 0x01, 0x05, 0x00, 0xd0, 0x01, 0x01, 0x02, 0x00, 0x10, 0x46, 0x06, 0x00, 0x03, 0x01, 0x00, 0x05, 0x09, 0x00, 0x04, 0x01, 0x00, 0x00,
+  0x90, 0x03, 0x00, 0xee, 0x00, 0x01, 0x02, 0x00, 0x00, 0x05, 0x00, 0x01, 0x08, 0x00, 0x04, 0x04, 0x01, 0x01, 0x02, 0x00, 0x01, 0x01, 0x00, 0x03,
+  0x07, 0x00, 0x0f, 0x01, 0x00, 0x1e, 0x02, 0x46, 0x07, 0x00, 0x99, 0x05, 0x03, 0xae, 0x01, 0x01, 0xdb, 0x01, 0x03, 0xde, 0x01, 0x01, 0x03, 0x00,
+  0x04, 0x18, 0x00, 0x00, 0x05, 0x00, 0x02, 0x02, 0x00, 0x02, 0x03, 0x00, 0x07, 0x02, 0x00, 0x07, 0x01, 0x00, 0x00, 0xcf, 0x07, 0x01, 0x03, 0x00,
+  0x03, 0x01, 0x00, 0x00, 0xca, 0x01, 0x03, 0xcc, 0x01, 0x00, 0x07, 0x00, 0x00, 0x04, 0x00, 0x0b, 0x01, 0x00, 0x2c, 0x4a, 0x4b, 0xdf, 0x01, 0x00,
+  0x01, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x18, 0x01, 0x51, 0x40, 0x3a, 0x3a, 0x21, 0x1d, 0xab, 0x01, 0x50, 0x10, 0x9f, 0x16, 0x19, 0x16, 0xdc, 0x01,
+  0x00, 0x01, 0x00, 0x50, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x06, 0x00, 0x00, 0x0d, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x10, 0x9c, 0x01,
+  0x00, 0x11, 0x9d, 0x0a, 0x00, 0x00, 0x13, 0x00, 0x01, 0x01, 0x00, 0x30, 0x9d, 0x9f, 0x9d, 0x07, 0x00, 0x02, 0x01, 0x00, 0x00, 0x05, 0x02, 0x02,
+  0x21, 0x02, 0x10, 0x16, 0x21, 0x02, 0x00, 0x01, 0x04, 0x13, 0x19, 0xfe, 0x01, 0x00, 0x01, 0x00, 0x17, 0x2a, 0x03, 0x02, 0x04, 0x02, 0x00, 0x00,
+  0xf1, 0x01, 0x30, 0x34, 0x34, 0x30, 0xd8, 0x01, 0x21, 0x34, 0x30, 0x02, 0x00, 0x13, 0x38, 0xc3, 0x03, 0x09, 0x01, 0x00, 0x00, 0xd7, 0x01, 0x04,
+  0xa2, 0x03, 0x00, 0xc5, 0x00, 0x00, 0xca, 0x01, 0x01, 0x01, 0x00, 0x01, 0xd8, 0x00, 0x06, 0x02, 0x00, 0x0f, 0x01, 0x00, 0x2f, 0x00, 0x3b, 0x01,
+  0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x01, 0x08, 0x00, 0x31, 0x47, 0x46, 0x47, 0x09, 0x00, 0x01, 0x13, 0x00, 0x30, 0x4a, 0x46, 0x4c, 0xc3, 0x01,
+  0x02, 0x8c, 0x03, 0x00, 0xaa, 0x01, 0x05, 0xdf, 0x01, 0x01, 0xdc, 0x01, 0x01, 0x06, 0x00, 0x00, 0xae, 0x03, 0x04, 0x01, 0x00, 0x00, 0x0a, 0x00,
+  0x00, 0x91, 0x03, 0x00, 0xef, 0x03, 0x00, 0x2e, 0x00, 0x00, 0x39, 0x00, 0x00, 0x06, 0x00, 0x00, 0x12, 0x00, 0x07, 0x01, 0x00, 0x04, 0x10, 0x00,
+  0x06, 0xdc, 0x01, 0x00, 0x67, 0x07, 0x14, 0x4b, 0x84, 0x07, 0x00, 0x16, 0x00, 0x03, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x41, 0x0b, 0x01, 0x91,
+  0x00, 0x01, 0x93, 0x00, 0x01, 0x01, 0x00, 0x00, 0xfa, 0x00, 0x94, 0x43, 0x43, 0x43, 0x38, 0x3a, 0x30, 0x34, 0x30, 0x21, 0xd5, 0x01, 0x10, 0x10,
+  0xaa, 0x03, 0x00, 0x09, 0x00, 0x02, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x70, 0x9d, 0x9c, 0x9b, 0x9c, 0x9c, 0x9c, 0x98, 0xc9, 0x01, 0x04, 0xcb, 0x01,
+  0x11, 0x9d, 0x08, 0x00, 0x00, 0x06, 0x00, 0x10, 0x9d, 0x15, 0x00, 0x01, 0x18, 0x00, 0x00, 0x0a, 0x00, 0x02, 0x1c, 0x00, 0x0f, 0x01, 0x00, 0x06,
+  0xd0, 0x96, 0x98, 0x96, 0x98, 0x96, 0x96, 0x90, 0x90, 0x90, 0x90, 0x96, 0x90, 0x96, 0x05, 0x00, 0x20, 0x90, 0x96, 0x17, 0x00, 0x50, 0x9f, 0x9f,
+  0x19, 0x12, 0x19, 0x01, 0x00, 0x00, 0xf1, 0x01, 0x35, 0x21, 0x21, 0x2a, 0xf0, 0x01, 0x50, 0x30, 0x30, 0x2e, 0x30, 0x2e, 0xe0, 0x01, 0x00, 0xe8,
+  0x01, 0x18, 0x38, 0xdf, 0x01, 0x00, 0x73, 0x04, 0x01, 0xdd, 0x01, 0x00, 0xe6, 0x01, 0x00, 0xa1, 0x03, 0x01, 0xde, 0x01, 0x39, 0x40, 0x43, 0x42,
+  0x6c, 0x05, 0x00, 0xe6, 0x00, 0x02, 0x01, 0x00, 0x07, 0x0b, 0x00, 0x0f, 0x01, 0x00, 0x05, 0x01, 0x20, 0x01, 0x05, 0x01, 0x00, 0x01, 0x0b, 0x00,
+  0x00, 0x2e, 0x01, 0x04, 0x02, 0x00, 0x0a, 0x0f, 0x00, 0x01, 0x05, 0x00, 0x00, 0x02, 0x00, 0x01, 0x05, 0x00, 0x01, 0xd1, 0x01, 0x00, 0xdd, 0x01,
+  0x00, 0xa6, 0x01, 0x01, 0xb0, 0x01, 0x00, 0xd6, 0x01, 0x07, 0x01, 0x00, 0x00, 0xa1, 0x05, 0x00, 0x1a, 0x00, 0x10, 0x4c, 0xb1, 0x01, 0x00, 0x01,
+  0x00, 0x02, 0x09, 0x00, 0x00, 0x13, 0x00, 0x01, 0x18, 0x00, 0x02, 0x02, 0x00, 0x05, 0x01, 0x00, 0x02, 0xfe, 0x01, 0x02, 0x12, 0x00, 0x06, 0xc5,
+  0x01, 0x00, 0xde, 0x01, 0x10, 0x4a, 0xd6, 0x01, 0x01, 0x02, 0x00, 0x00, 0xe2, 0x01, 0x08, 0x01, 0x00, 0x01, 0x89, 0x00, 0x00, 0xa6, 0x00, 0x07,
+  0x01, 0x00, 0x00, 0xcc, 0x04, 0x20, 0x30, 0x22, 0x57, 0x03, 0x00, 0xcc, 0x01, 0x00, 0x5a, 0x03, 0x01, 0x68, 0x03, 0x10, 0x12, 0x6f, 0x03, 0x01,
+  0x0b, 0x00, 0x00, 0x17, 0x00, 0x01, 0x01, 0x00, 0x00, 0x87, 0x01, 0x31, 0x9c, 0x9c, 0x96, 0xe6, 0x01, 0x00, 0x0d, 0x00, 0x00, 0xc9, 0x01, 0x00,
+  0x06, 0x00, 0x01, 0x05, 0x00, 0x01, 0x07, 0x00, 0x03, 0x01, 0x00, 0x07, 0x0e, 0x00, 0x61, 0x96, 0x98, 0x90, 0x90, 0x96, 0x98, 0xc2, 0x01, 0x00,
+  0xda, 0x01, 0x00, 0xd4, 0x01, 0x01, 0x05, 0x00, 0x00, 0xd8, 0x01, 0xf0, 0x04, 0x90, 0x90, 0x90, 0x84, 0x90, 0x84, 0x84, 0x84, 0x84, 0x76, 0x84,
+  0x76, 0xa7, 0x76, 0xa7, 0x7c, 0x84, 0x82, 0x84, 0x11, 0x00, 0x05, 0xf4, 0x01, 0x01, 0x0e, 0x04, 0x52, 0x12, 0x16, 0x19, 0x19, 0x16, 0xf6, 0x01,
+  0x01, 0xef, 0x01, 0x03, 0xcb, 0x03, 0x10, 0x38, 0xdb, 0x01, 0x20, 0x3a, 0x3a, 0xdd, 0x08, 0x20, 0x43, 0x3a, 0xda, 0x01, 0x01, 0xdc, 0x01, 0x00,
+  0x01, 0x00, 0x02, 0x79, 0x05, 0x0c, 0x02, 0x00, 0x0f, 0x01, 0x00, 0x09, 0x01, 0x12, 0x01, 0x00, 0x19, 0x01, 0x01, 0xde, 0x01, 0x03, 0x02, 0x00,
+  0x01, 0x05, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x21, 0x03, 0x01, 0x02, 0x00, 0x0a, 0x01, 0x00, 0x01, 0x10, 0x00, 0x00, 0xc1, 0x01, 0x04, 0xc6, 0x01,
+  0x01, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x08, 0x01, 0x00, 0x00, 0x14, 0x00, 0x06, 0x44, 0x09, 0x00, 0x09, 0x00, 0x10, 0x4c, 0xc4, 0x01, 0x00, 0xdc,
+  0x01, 0x00, 0x04, 0x00, 0x00, 0x06, 0x00, 0x00, 0x15, 0x00, 0x03, 0x01, 0x00, 0x00, 0x1b, 0x00, 0x0a, 0x01, 0x00, 0x00, 0xc1, 0x01, 0x00, 0xc4,
+  0x01, 0x05, 0xc0, 0x03, 0x03, 0xb3, 0x05, 0x00, 0x0b, 0x00, 0x02, 0x01, 0x00, 0x01, 0x8b, 0x00, 0x01, 0x02, 0x00, 0x05, 0x01, 0x00, 0x00, 0x1a,
+  0x01, 0x40, 0x34, 0x28, 0x21, 0x19, 0x69, 0x05, 0x00, 0x48, 0x05, 0x30, 0x19, 0x19, 0x19, 0x4a, 0x05, 0x01, 0xd9, 0x01, 0x01, 0xe1, 0x01, 0x14,
+  0x19, 0x0b, 0x00, 0x02, 0x00, 0x02, 0x06, 0x01, 0x00, 0x10, 0x9d, 0x31, 0x00, 0x10, 0x9f, 0x79, 0x03, 0x00, 0x07, 0x00, 0x0a, 0x02, 0x00, 0x02,
+  0x9d, 0x01, 0x00, 0x07, 0x00, 0x50, 0x9c, 0x96, 0x9c, 0x90, 0x96, 0xad, 0x01, 0x05, 0xde, 0x01, 0x00, 0x06, 0x00, 0x02, 0x01, 0x00, 0x02, 0xdd,
+  0x01, 0x60, 0xa7, 0x84, 0xa7, 0xa7, 0xa7, 0xa6, 0x01, 0x00, 0x10, 0x6d, 0x03, 0x00, 0x90, 0x6d, 0xa6, 0x71, 0xa6, 0x71, 0xa7, 0x76, 0x84, 0x76,
+  0x1c, 0x00, 0x00, 0xed, 0x01, 0x02, 0xef, 0x01, 0x00, 0x43, 0x00, 0x02, 0xa3, 0x00, 0x00, 0xf1, 0x01, 0x01, 0xdc, 0x05, 0x05, 0xef, 0x01, 0x00,
+  0xe9, 0x01, 0x00, 0x60, 0x06, 0x13, 0x40, 0xe9, 0x01, 0x00, 0xf3, 0x08, 0x00, 0xf5, 0x08, 0x03, 0x02, 0x00, 0x0f, 0x01, 0x00, 0x0c, 0x03, 0xd5,
+  0x01, 0x02, 0x03, 0x00, 0x01, 0x02, 0x00, 0x02, 0x26, 0x01, 0x01, 0x07, 0x00, 0x02, 0x04, 0x00, 0x0f, 0x01, 0x00, 0x12, 0x00, 0xdf, 0x01, 0x00,
+  0xd4, 0x01, 0x00, 0xe1, 0x01, 0x02, 0xcc, 0x01, 0x00, 0xd5, 0x01, 0x03, 0x01, 0x00, 0x01, 0x9d, 0x05, 0x00, 0xc0, 0x01, 0x03, 0xc3, 0x01, 0x01,
+  0x0b, 0x00, 0x00, 0xe2, 0x01, 0x00, 0x0a, 0x00, 0x03, 0x01, 0x00, 0x00, 0xe3, 0x01, 0x00, 0x1c, 0x00, 0x03, 0x06, 0x00, 0x07, 0xe1, 0x01, 0x02,
+  0xc8, 0x01, 0x03, 0x01, 0x00, 0x30, 0x4a, 0x4b, 0x4a, 0x0e, 0x00, 0x00, 0x02, 0x00, 0x01, 0xe4, 0x01, 0x01, 0x07, 0x00, 0x03, 0x01, 0x00, 0x00,
+  0x88, 0x00, 0x03, 0xdd, 0x01, 0x00, 0x04, 0x01, 0x80, 0x46, 0x46, 0x38, 0x28, 0x28, 0x21, 0x21, 0x1d, 0x8d, 0x05, 0x02, 0x3e, 0x01, 0x00, 0x3a,
+  0x01, 0x00, 0xd5, 0x01, 0x31, 0x16, 0x19, 0x9f, 0x06, 0x00, 0x00, 0x3c, 0x03, 0x00, 0xc3, 0x03, 0x10, 0x12, 0x06, 0x00, 0x01, 0x04, 0x00, 0x30,
+  0x9f, 0x12, 0x9f, 0xd2, 0x03, 0x00, 0x04, 0x00, 0x03, 0x01, 0x00, 0x01, 0x3a, 0x00, 0x03, 0xce, 0x01, 0x00, 0x0c, 0x00, 0x01, 0x02, 0x00, 0x00,
+  0x4d, 0x00, 0x00, 0x07, 0x00, 0x07, 0x01, 0x00, 0x01, 0xea, 0x01, 0x00, 0xe3, 0x01, 0x00, 0xb1, 0x01, 0x26, 0x90, 0xa9, 0xde, 0x01, 0xf0, 0x02,
+  0x76, 0xa7, 0x6d, 0xa6, 0xa6, 0xa6, 0x68, 0xa6, 0x61, 0xa6, 0x65, 0x61, 0x65, 0xa6, 0x65, 0xa6, 0x61, 0x0a, 0x00, 0x00, 0x11, 0x00, 0x50, 0xa6,
+  0xa6, 0xa7, 0xa7, 0xa7, 0x26, 0x00, 0x00, 0xe6, 0x01, 0x40, 0x90, 0x96, 0x90, 0x9c, 0xe6, 0x01, 0x01, 0x5b, 0x00, 0x00, 0x01, 0x00, 0x35, 0x16,
+  0x12, 0x1d, 0xcf, 0x05, 0x60, 0x21, 0x28, 0x2a, 0x2e, 0x30, 0x28, 0xc8, 0x05, 0x22, 0x38, 0x3a, 0xdb, 0x03, 0x21, 0x40, 0x3a, 0xdd, 0x01, 0x11,
+  0x42, 0xec, 0x00, 0x00, 0x05, 0x00, 0x0e, 0x01, 0x00, 0x00, 0x0a, 0x01, 0x01, 0xd6, 0x01, 0x00, 0xcf, 0x01, 0x00, 0xc8, 0x01, 0x02, 0x06, 0x00,
+  0x02, 0x05, 0x00, 0x02, 0x07, 0x00, 0x00, 0x04, 0x00, 0x01, 0x07, 0x00, 0x03, 0x09, 0x00, 0x0f, 0x01, 0x00, 0x02, 0x02, 0x57, 0x01, 0x00, 0xc5,
+  0x01, 0x08, 0x01, 0x00, 0x01, 0xef, 0x01, 0x02, 0x13, 0x00, 0x00, 0x08, 0x00, 0x05, 0xe0, 0x01, 0x05, 0x01, 0x00, 0x01, 0xec, 0x01, 0x00, 0x06,
+  0x00, 0x01, 0x04, 0x00, 0x03, 0x07, 0x00, 0x01, 0x12, 0x00, 0x03, 0xe2, 0x01, 0x04, 0x01, 0x00, 0x00, 0xc3, 0x01, 0x00, 0xe5, 0x01, 0x02, 0x01,
+  0x00, 0x02, 0xc0, 0x03, 0x07, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x15, 0x00, 0x03, 0x88, 0x00, 0x00, 0x7b, 0x04, 0x61, 0x47, 0x34, 0x30, 0x2a,
+  0x21, 0x21, 0x73, 0x07, 0x08, 0x97, 0x03, 0x80, 0x16, 0x19, 0x1d, 0x30, 0x38, 0x3a, 0x30, 0x28, 0xfb, 0x0c, 0x01, 0xdd, 0x01, 0x00, 0x0d, 0x0b,
+  0x00, 0x09, 0x00, 0x00, 0x0e, 0x00, 0x10, 0x12, 0x09, 0x00, 0x00, 0xd7, 0x01, 0x00, 0xe3, 0x01, 0x0b, 0x01, 0x00, 0x00, 0x73, 0x01, 0x00, 0x7a,
+  0x01, 0x05, 0x01, 0x00, 0x00, 0xdc, 0x01, 0x0a, 0x12, 0x00, 0x00, 0x9b, 0x01, 0x02, 0xdf, 0x01, 0x00, 0xde, 0x01, 0x23, 0x90, 0xa9, 0xbf, 0x03,
+  0x10, 0xa7, 0x01, 0x00, 0x00, 0xbd, 0x03, 0xb0, 0x65, 0xa6, 0x61, 0x65, 0x61, 0x65, 0xae, 0x61, 0x61, 0x65, 0x61, 0x04, 0x00, 0x40, 0xa6, 0x61,
+  0xa6, 0x69, 0xd3, 0x03, 0x20, 0xa7, 0x76, 0xe3, 0x01, 0x00, 0xe5, 0x01, 0x00, 0x36, 0x00, 0x00, 0xff, 0x03, 0x04, 0x5e, 0x00, 0x02, 0x01, 0x00,
+  0x01, 0x59, 0x04, 0x44, 0x19, 0x16, 0x21, 0x1d, 0xe9, 0x01, 0x01, 0xd9, 0x03, 0x01, 0xdb, 0x03, 0x10, 0x28, 0xed, 0x01, 0x01, 0xd5, 0x03, 0x01,
+  0xcf, 0x03, 0x0f, 0xe6, 0x01, 0x01, 0x05, 0xe2, 0x01, 0x03, 0x02, 0x00, 0x05, 0x01, 0x00, 0x02, 0x0b, 0x00, 0x02, 0x06, 0x00, 0x0f, 0x01, 0x00,
+  0x0b, 0x02, 0x55, 0x01, 0x01, 0xe0, 0x01, 0x03, 0x01, 0x00, 0x00, 0xd4, 0x01, 0x01, 0xce, 0x01, 0x01, 0xc9, 0x03, 0x01, 0x0c, 0x00, 0x01, 0x0a,
+  0x00, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x00, 0xc5, 0x01, 0x06, 0x03, 0x00, 0x01, 0x01, 0x00, 0x00, 0x13, 0x00, 0x00, 0x02, 0x00, 0x01, 0x0a,
+  0x00, 0x07, 0x01, 0x00, 0x00, 0xc3, 0x01, 0x00, 0x08, 0x00, 0x00, 0x09, 0x00, 0x11, 0x4c, 0x70, 0x00, 0x00, 0x11, 0x00, 0x00, 0x16, 0x00, 0x01,
+  0xc0, 0x03, 0x00, 0x01, 0x00, 0x01, 0xdd, 0x01, 0x02, 0x02, 0x00, 0x00, 0xb6, 0x00, 0x20, 0x46, 0x46, 0x08, 0x0d, 0x00, 0x1c, 0x01, 0x00, 0x23,
+  0x01, 0x00, 0x9c, 0x01, 0x80, 0x9f, 0x9f, 0x12, 0x12, 0x19, 0x12, 0x19, 0x9f, 0xf4, 0x01, 0x00, 0xfc, 0x0e, 0x00, 0x02, 0x00, 0x00, 0xcc, 0x03,
+  0x01, 0xda, 0x0e, 0x00, 0x0c, 0x00, 0x00, 0xec, 0x01, 0x20, 0x12, 0x19, 0x2c, 0x00, 0x11, 0x9f, 0x06, 0x00, 0x00, 0xc6, 0x03, 0x02, 0x10, 0x00,
+  0x14, 0x12, 0xee, 0x01, 0x00, 0xc6, 0x01, 0x04, 0xd5, 0x01, 0x05, 0x10, 0x00, 0x07, 0x01, 0x00, 0x10, 0x96, 0x02, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0xdf, 0x01, 0x42, 0x84, 0xa9, 0x84, 0xa9, 0xbf, 0x03, 0x02, 0xe0, 0x01, 0x00, 0xe1, 0x01, 0x60, 0xaf, 0x65, 0x65, 0x61, 0xae, 0x65, 0x02, 0x00,
+  0x10, 0xaf, 0xc6, 0x03, 0x10, 0x65, 0x17, 0x00, 0x00, 0x20, 0x00, 0x04, 0xc5, 0x03, 0x00, 0x3c, 0x00, 0x01, 0x29, 0x02, 0x00, 0xb1, 0x00, 0x00,
+  0x01, 0x00, 0x31, 0x12, 0x9f, 0x12, 0xb8, 0x00, 0x01, 0x9f, 0x00, 0x00, 0x02, 0x00, 0x00, 0xb1, 0x00, 0x02, 0x01, 0x00, 0x00, 0x74, 0x0f, 0x00,
+  0x05, 0x00, 0x04, 0xeb, 0x01, 0x00, 0xed, 0x01, 0x11, 0x38, 0xc1, 0x05, 0x50, 0x42, 0x43, 0x47, 0x43, 0x47, 0xde, 0x01, 0x01, 0xdd, 0x01, 0x00,
+  0x02, 0x00, 0x01, 0x05, 0x00, 0x00, 0xce, 0x01, 0x0f, 0xd1, 0x01, 0x11, 0x05, 0x01, 0x00, 0x11, 0x4b, 0x03, 0x00, 0x00, 0x05, 0x00, 0x01, 0x0a,
+  0x00, 0x00, 0xdb, 0x01, 0x06, 0x01, 0x00, 0x00, 0xe5, 0x01, 0x01, 0xd8, 0x01, 0x00, 0xd7, 0x01, 0x00, 0x0e, 0x00, 0x00, 0x08, 0x00, 0x00, 0x09,
+  0x00, 0x00, 0x12, 0x00, 0x00, 0xc2, 0x01, 0x01, 0x01, 0x00, 0x03, 0x07, 0x00, 0x00, 0x01, 0x00, 0x01, 0xe9, 0x01, 0x00, 0x02, 0x00, 0x00, 0x08,
+  0x00, 0x00, 0x09, 0x00, 0x02, 0xca, 0x03, 0x03, 0x01, 0x00, 0x01, 0xd0, 0x01, 0x30, 0x4e, 0x4b, 0x4e, 0x6b, 0x00, 0x17, 0x4a, 0xc0, 0x03, 0x03,
+  0x01, 0x00, 0x00, 0x17, 0x00, 0x01, 0x1a, 0x00, 0x20, 0x4a, 0x4a, 0xdc, 0x00, 0x33, 0x47, 0x3a, 0x19, 0xa7, 0x01, 0x01, 0xdb, 0x01, 0x01, 0x01,
+  0x00, 0x00, 0x7c, 0x05, 0x00, 0x17, 0x01, 0x20, 0x2a, 0x28, 0x1e, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x04, 0x00, 0x01, 0x01, 0x00, 0x20, 0x19, 0x19,
+  0xe5, 0x01, 0x00, 0x01, 0x00, 0x40, 0x12, 0x19, 0x12, 0x12, 0xd8, 0x01, 0x01, 0xda, 0x01, 0x00, 0x57, 0x01, 0x00, 0xb0, 0x07, 0x44, 0x19, 0x19,
+  0x12, 0x12, 0xd5, 0x03, 0x00, 0x7c, 0x01, 0x10, 0x9f, 0x83, 0x01, 0x01, 0x63, 0x03, 0x00, 0xee, 0x01, 0x00, 0x13, 0x00, 0x01, 0xdd, 0x01, 0x01,
+  0x01, 0x00, 0x00, 0xa2, 0x01, 0x00, 0x01, 0x00, 0x00, 0x8c, 0x03, 0x15, 0xa9, 0xc0, 0x03, 0x02, 0xe1, 0x01, 0x11, 0x68, 0xb2, 0x03, 0x44, 0x69,
+  0x68, 0x65, 0x68, 0xa5, 0x05, 0x01, 0x01, 0x00, 0x21, 0xa7, 0xa6, 0xdf, 0x01, 0x32, 0xa9, 0x84, 0xa9, 0xc0, 0x03, 0x00, 0x4a, 0x00, 0x01, 0xb6,
+  0x00, 0x00, 0x71, 0x00, 0x01, 0xbe, 0x03, 0x00, 0xc1, 0x03, 0x00, 0x87, 0x00, 0x01, 0x01, 0x00, 0x00, 0xa9, 0x00, 0x00, 0xb5, 0x00, 0x07, 0x01,
+  0x00, 0x11, 0x2a, 0xd2, 0x03, 0x02, 0x02, 0x00, 0x02, 0xeb, 0x01, 0x00, 0x02, 0x00, 0x02, 0xed, 0x01, 0x41, 0x40, 0x43, 0x42, 0x46, 0xed, 0x01,
+  0x00, 0xdc, 0x01, 0x01, 0x03, 0x00, 0x00, 0xe4, 0x01, 0x04, 0x04, 0x00, 0x0f, 0x01, 0x00, 0x08, 0x00, 0x54, 0x01, 0x02, 0x02, 0x00, 0x03, 0x05,
+  0x00, 0x00, 0xd1, 0x01, 0x01, 0xd3, 0x01, 0x02, 0xce, 0x01, 0x05, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x10, 0x00, 0x01, 0x19, 0x00, 0x04, 0xe0,
+  0x01, 0x07, 0x01, 0x00, 0x0b, 0x12, 0x00, 0x02, 0xe1, 0x01, 0x00, 0xd4, 0x01, 0x02, 0x01, 0x00, 0x01, 0xc7, 0x01, 0x05, 0x09, 0x00, 0x02, 0x63,
+  0x07, 0x01, 0xb8, 0x03, 0x00, 0x0d, 0x00, 0x00, 0x08, 0x00, 0x02, 0x01, 0x00, 0x01, 0x85, 0x00, 0x00, 0xe1, 0x10, 0x61, 0x38, 0x21, 0x21, 0x30,
+  0x30, 0x2a, 0xbd, 0x03, 0x00, 0x21, 0x01, 0x00, 0x01, 0x00, 0x01, 0x08, 0x00, 0x20, 0x12, 0x12, 0x18, 0x01, 0x00, 0x01, 0x01, 0x00, 0x62, 0x12,
+  0x00, 0xd6, 0x01, 0x01, 0x1a, 0x01, 0x00, 0x01, 0x00, 0x21, 0x19, 0x16, 0x36, 0x01, 0x00, 0xcf, 0x01, 0x01, 0xdf, 0x01, 0x01, 0x33, 0x03, 0x00,
+  0xe7, 0x01, 0x10, 0x19, 0x35, 0x00, 0x00, 0xf6, 0x01, 0x00, 0x54, 0x01, 0x11, 0x19, 0xa4, 0x09, 0x00, 0x7d, 0x01, 0x03, 0x01, 0x00, 0x00, 0xea,
+  0x01, 0x06, 0x02, 0x00, 0x01, 0xe3, 0x01, 0x02, 0xc1, 0x03, 0x00, 0x05, 0x00, 0x00, 0xdf, 0x01, 0x04, 0xe1, 0x01, 0x01, 0xc5, 0x01, 0x02, 0x01,
+  0x00, 0x01, 0xb3, 0x03, 0x07, 0x01, 0x00, 0x00, 0xdd, 0x01, 0x03, 0xa0, 0x05, 0x10, 0x84, 0xd4, 0x05, 0x00, 0x3d, 0x00, 0x00, 0x49, 0x00, 0x05,
+  0x65, 0x00, 0x04, 0x8e, 0x00, 0x00, 0x02, 0x00, 0x00, 0xe5, 0x01, 0x10, 0x21, 0xca, 0x03, 0x00, 0x8f, 0x02, 0x00, 0xc1, 0x00, 0x00, 0xc3, 0x00,
+  0x06, 0x01, 0x00, 0x00, 0xdf, 0x01, 0x04, 0x02, 0x00, 0x01, 0xe7, 0x01, 0x00, 0x01, 0x00, 0x00, 0xe9, 0x01, 0x70, 0x34, 0x40, 0x40, 0x40, 0x46,
+  0x42, 0x46, 0xe9, 0x01, 0x02, 0x02, 0x00, 0x02, 0xe6, 0x01, 0x01, 0x05, 0x00, 0x0f, 0x01, 0x00, 0x09, 0x00, 0x51, 0x01, 0xa0, 0x4b, 0x4a, 0x4b,
+  0x4a, 0x4b, 0x4a, 0x4a, 0x4b, 0x4b, 0x4a, 0x19, 0x51, 0x01, 0x00, 0xb0, 0x4f, 0x51, 0x51, 0x4f, 0x4f, 0x4f, 0x4e, 0x4f, 0x4f, 0x4f, 0x4f, 0x09,
+  0x00, 0x02, 0x05, 0x00, 0x04, 0x01, 0x00, 0x10, 0x4e, 0x19, 0x00, 0x00, 0x1c, 0x00, 0x09, 0x16, 0x00, 0x01, 0x0e, 0x00, 0x00, 0x16, 0x00, 0x00,
+  0x20, 0x00, 0x90, 0x4e, 0x4c, 0x4b, 0x4c, 0x4b, 0x4e, 0x4e, 0x4e, 0x4e, 0x07, 0x00, 0x07, 0x02, 0x00, 0x00, 0x01, 0x00, 0x22, 0x4a, 0x4b, 0x09,
+  0x00, 0x01, 0x05, 0x00, 0x02, 0x10, 0x00, 0xf4, 0x04, 0x4a, 0x4b, 0x4a, 0x4a, 0x4a, 0x4a, 0x46, 0x47, 0x3a, 0x2a, 0x1d, 0x12, 0x9f, 0x12, 0x19,
+  0x12, 0x9f, 0x12, 0x9f, 0x01, 0x00, 0xf0, 0x05, 0x19, 0x19, 0x21, 0x19, 0x19, 0x19, 0x12, 0x12, 0x16, 0x12, 0x19, 0x12, 0x19, 0x21, 0x2a, 0x28,
+  0x2a, 0x21, 0x2a, 0x21, 0x01, 0x00, 0x31, 0x19, 0x21, 0x19, 0x05, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x05, 0x00, 0x02, 0x33, 0x00, 0x10, 0x12, 0x06,
+  0x00, 0x30, 0x12, 0x12, 0x19, 0x04, 0x00, 0x01, 0x48, 0x00, 0x10, 0x19, 0x11, 0x00, 0x11, 0x9f, 0x22, 0x00, 0x10, 0x19, 0x0a, 0x00, 0x11, 0x9c,
+  0x02, 0x00, 0x22, 0x9f, 0x12, 0x2a, 0x00, 0x00, 0x01, 0x00, 0x12, 0x9c, 0x05, 0x00, 0x34, 0x9c, 0x9f, 0x9c, 0x01, 0x00, 0xfd, 0x05, 0x96, 0x96,
+  0x90, 0x96, 0x96, 0x90, 0xa9, 0x90, 0xa9, 0x84, 0x84, 0x84, 0x84, 0xa7, 0xa7, 0xa7, 0xa7, 0xa6, 0xa7, 0xa6, 0x01, 0x00, 0x20, 0xa7, 0xa6, 0x1a,
+  0x00, 0x10, 0x84, 0x02, 0x00, 0x00, 0x01, 0x00, 0x90, 0xa9, 0x84, 0xa9, 0x90, 0x90, 0x96, 0x96, 0x96, 0x96, 0x41, 0x00, 0x00, 0x4e, 0x00, 0x01,
+  0x01, 0x00, 0x21, 0x12, 0x9f, 0x8a, 0x00, 0x02, 0x01, 0x00, 0x04, 0x08, 0x00, 0x00, 0xba, 0x00, 0x00, 0x02, 0x00, 0x01, 0xbf, 0x00, 0x00, 0xcb,
+  0x00, 0x05, 0x01, 0x00, 0x01, 0xda, 0x00, 0x20, 0x2a, 0x21, 0xe6, 0x00, 0x01, 0x02, 0x00, 0x12, 0x30, 0x02, 0x00, 0xf0, 0x12, 0x30, 0x30, 0x34,
+  0x30, 0x34, 0x30, 0x3a, 0x38, 0x3a, 0x40, 0x3a, 0x40, 0x3a, 0x42, 0x3a, 0x42, 0x43, 0x47, 0x46, 0x47, 0x46, 0x46, 0x46, 0x47, 0x46, 0x4a, 0x46,
+  0x4a, 0x46, 0x47, 0x4a, 0x47, 0x4a, 0x03, 0x00, 0x0c, 0x01, 0x00, 0x11, 0x4b, 0x03, 0x00, 0x01, 0x09, 0x00, 0x01, 0x02, 0x00, 0x00, 0xd6, 0x01,
+  0x01, 0xd8, 0x01, 0x02, 0x01, 0x00, 0x01, 0xae, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0a, 0x00, 0x04, 0x0d, 0x00, 0x02, 0x0a, 0x00, 0x00, 0xb8, 0x01,
+  0x21, 0x4c, 0x4e, 0xe6, 0x01, 0x03, 0x12, 0x00, 0x09, 0x01, 0x00, 0x01, 0xdf, 0x01, 0x10, 0x4e, 0xce, 0x01, 0x01, 0xe5, 0x01, 0x00, 0xc3, 0x01,
+  0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x02, 0x13, 0x00, 0x01, 0x09, 0x00, 0x00, 0x0f, 0x00, 0x04, 0x01, 0x00, 0x01, 0x8a, 0x00, 0x40, 0x47, 0x34,
+  0x2a, 0x21, 0x94, 0x01, 0x03, 0xaa, 0x01, 0x02, 0x01, 0x00, 0x00, 0x0f, 0x01, 0x02, 0x01, 0x00, 0xa1, 0x12, 0x19, 0x9f, 0x19, 0x12, 0x21, 0x21,
+  0x30, 0x30, 0x28, 0x06, 0x01, 0x00, 0x1d, 0x01, 0x01, 0xdd, 0x01, 0x00, 0x1b, 0x00, 0x11, 0x16, 0x4b, 0x01, 0x02, 0x37, 0x00, 0x00, 0x06, 0x00,
+  0x10, 0x12, 0x60, 0x01, 0x10, 0x12, 0xe9, 0x01, 0x02, 0x50, 0x00, 0x00, 0x3e, 0x00, 0x04, 0xd0, 0x01, 0x01, 0x7a, 0x01, 0x01, 0x0c, 0x00, 0x20,
+  0x12, 0x12, 0xe6, 0x01, 0x03, 0x38, 0x00, 0x21, 0x9c, 0x12, 0x1b, 0x00, 0x00, 0x9d, 0x01, 0x20, 0x96, 0x9c, 0xa8, 0x01, 0x14, 0x90, 0xe1, 0x01,
+  0x01, 0xe2, 0x01, 0x0d, 0xe4, 0x01, 0x02, 0xdf, 0x01, 0x01, 0xe1, 0x01, 0x01, 0xde, 0x01, 0x81, 0x84, 0x90, 0x90, 0x90, 0x90, 0x96, 0x90, 0x9c,
+  0xe0, 0x01, 0x01, 0x4e, 0x00, 0x00, 0x01, 0x00, 0x00, 0x81, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x05, 0x00, 0x03, 0x01, 0x00, 0x01, 0xd5, 0x01, 0x04,
+  0x02, 0x00, 0x00, 0x03, 0x00, 0x07, 0x01, 0x00, 0x02, 0x0e, 0x00, 0x40, 0x2a, 0x21, 0x28, 0x21, 0xc6, 0x02, 0x03, 0x02, 0x00, 0x00, 0xea, 0x01,
+  0x61, 0x2a, 0x2a, 0x30, 0x30, 0x2a, 0x30, 0x01, 0x00, 0x01, 0xe9, 0x01, 0x30, 0x38, 0x3a, 0x40, 0xee, 0x01, 0x91, 0x38, 0x43, 0x40, 0x46, 0x42,
+  0x46, 0x42, 0x46, 0x47, 0x04, 0x00, 0x01, 0x02, 0x00, 0x00, 0xd2, 0x01, 0x08, 0x01, 0x00, 0x01, 0xe7, 0x01, 0x00, 0x02, 0x00, 0x00, 0xd5, 0x01,
+  0x05, 0x01, 0x00, 0x02, 0xbf, 0x03, 0x09, 0x01, 0x00, 0x17, 0x4e, 0xca, 0x01, 0x00, 0xbf, 0x01, 0x11, 0x4c, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x06,
+  0x18, 0x00, 0x03, 0x0a, 0x00, 0x00, 0xe1, 0x01, 0x00, 0x21, 0x00, 0x20, 0x4e, 0x4b, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x01, 0xd9, 0x01, 0x02, 0xd5,
+  0x01, 0x00, 0x05, 0x00, 0x04, 0x02, 0x00, 0x00, 0x14, 0x00, 0x00, 0x82, 0x00, 0x70, 0x4a, 0x46, 0x47, 0x46, 0x40, 0x30, 0x21, 0x06, 0x01, 0x00,
+  0x8f, 0x01, 0x05, 0x5c, 0x03, 0x00, 0x1e, 0x01, 0x00, 0x1a, 0x01, 0x00, 0xdc, 0x01, 0x00, 0xa6, 0x01, 0x60, 0x28, 0x38, 0x34, 0x38, 0x34, 0x30,
+  0xf6, 0x00, 0x01, 0x1e, 0x01, 0x02, 0xbe, 0x03, 0x00, 0x23, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x32, 0x00, 0x00, 0x3d, 0x00, 0x02, 0xb1, 0x01, 0x00,
+  0x01, 0x00, 0x01, 0xcc, 0x01, 0x00, 0x08, 0x00, 0x22, 0x9c, 0x9c, 0x17, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x08, 0x05,
+  0x00, 0x01, 0x95, 0x01, 0x00, 0x08, 0x00, 0x01, 0x0a, 0x00, 0x00, 0xe2, 0x01, 0x12, 0x90, 0xe1, 0x01, 0x03, 0xe2, 0x01, 0x06, 0xe4, 0x01, 0x05,
+  0xe6, 0x01, 0x04, 0xe1, 0x01, 0x03, 0xe0, 0x01, 0x30, 0xa9, 0x90, 0xa9, 0xe1, 0x01, 0x01, 0xdf, 0x01, 0x00, 0x4b, 0x00, 0x00, 0x66, 0x00, 0x21,
+  0x12, 0x9f, 0xd1, 0x00, 0x00, 0xc5, 0x00, 0x02, 0x01, 0x00, 0x00, 0xb2, 0x00, 0x05, 0x02, 0x00, 0x0b, 0x01, 0x00, 0x01, 0xb6, 0x02, 0x01, 0x05,
+  0x00, 0x04, 0xd5, 0x01, 0x02, 0x06, 0x00, 0x00, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0xd3, 0x03, 0x20, 0x2a, 0x2a, 0xf0, 0x01,
+  0x01, 0xd6, 0x03, 0x02, 0x01, 0x00, 0x81, 0x38, 0x30, 0x38, 0x38, 0x30, 0x40, 0x38, 0x40, 0x01, 0x00, 0x10, 0x42, 0x04, 0x00, 0x00, 0xee, 0x01,
+  0x0d, 0xd3, 0x03, 0x00, 0xd7, 0x01, 0x00, 0xd9, 0x01, 0x05, 0xdb, 0x01, 0x03, 0x07, 0x00, 0x04, 0x01, 0x00, 0x00, 0xcb, 0x01, 0x00, 0x1f, 0x00,
+  0x05, 0x01, 0x00, 0x00, 0xc6, 0x01, 0x12, 0x4f, 0xe2, 0x01, 0x03, 0xaf, 0x05, 0x02, 0x01, 0x00, 0x01, 0x0d, 0x00, 0x00, 0x1d, 0x00, 0x00, 0xe3,
+  0x01, 0x30, 0x4c, 0x4e, 0x4b, 0xc4, 0x03, 0x20, 0x4e, 0x4c, 0x07, 0x00, 0x06, 0x02, 0x00, 0x08, 0x01, 0x00, 0x80, 0x4a, 0x4a, 0x47, 0x3a, 0x38,
+  0x28, 0x2a, 0x21, 0x63, 0x05, 0x02, 0x4f, 0x03, 0x01, 0x76, 0x03, 0x00, 0x0c, 0x00, 0x01, 0x13, 0x01, 0x02, 0xdf, 0x01, 0x60, 0x12, 0x12, 0x9f,
+  0x19, 0x21, 0x38, 0xbc, 0x00, 0x20, 0x43, 0x30, 0x04, 0x01, 0x21, 0x21, 0x19, 0xfe, 0x02, 0x01, 0x1e, 0x00, 0x00, 0x7a, 0x05, 0x00, 0x4c, 0x01,
+  0x00, 0x01, 0x00, 0x00, 0x29, 0x00, 0x02, 0xb3, 0x01, 0x00, 0x02, 0x00, 0x01, 0x6b, 0x01, 0x02, 0x0d, 0x00, 0x02, 0x0b, 0x00, 0x01, 0xda, 0x03,
+  0x01, 0x0a, 0x00, 0x00, 0x01, 0x00, 0x00, 0x24, 0x00, 0x02, 0xdd, 0x01, 0x01, 0x74, 0x03, 0x00, 0x0f, 0x00, 0x00, 0x0b, 0x00, 0x02, 0xc1, 0x03,
+  0x00, 0xa6, 0x05, 0x23, 0xa9, 0xa9, 0xe2, 0x01, 0x00, 0xe5, 0x01, 0x04, 0x01, 0x00, 0x07, 0xdb, 0x01, 0x03, 0xde, 0x01, 0x00, 0xdd, 0x01, 0x10,
+  0xa9, 0x32, 0x00, 0x00, 0x3e, 0x00, 0x04, 0x69, 0x00, 0x01, 0x8d, 0x00, 0x01, 0x9e, 0x00, 0x01, 0x01, 0x00, 0x00, 0xd2, 0x01, 0x22, 0x19, 0x2a,
+  0xd7, 0x01, 0x40, 0x19, 0x21, 0x23, 0x21, 0x03, 0x00, 0x06, 0x01, 0x00, 0x10, 0x2a, 0xc4, 0x01, 0x00, 0xc7, 0x01, 0x03, 0x02, 0x00, 0x00, 0x12,
+  0x00, 0x04, 0x08, 0x00, 0x00, 0xd3, 0x01, 0x01, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x00, 0xe4, 0x01, 0x06, 0x02, 0x00, 0x03, 0xbf, 0x05, 0x06, 0x01,
+  0x00, 0x40, 0x38, 0x30, 0x38, 0x3a, 0xf1, 0x01, 0x11, 0x3a, 0xe8, 0x01, 0x35, 0x47, 0x47, 0x47, 0xe7, 0x01, 0x00, 0xbc, 0x01, 0x02, 0xe2, 0x01,
+  0x40, 0x51, 0x4d, 0x4f, 0x4d, 0x0d, 0x00, 0x00, 0xad, 0x01, 0x01, 0xd5, 0x01, 0x00, 0x01, 0x00, 0x00, 0xac, 0x03, 0x04, 0xc4, 0x01, 0x02, 0x12,
+  0x00, 0x01, 0x01, 0x00, 0x30, 0x4e, 0x4e, 0x4c, 0x04, 0x00, 0x01, 0xad, 0x05, 0x01, 0x1f, 0x00, 0x02, 0xde, 0x01, 0x00, 0x0d, 0x00, 0x00, 0xe1,
+  0x01, 0x00, 0xbf, 0x03, 0x20, 0x4c, 0x4b, 0xde, 0x01, 0x01, 0xd5, 0x01, 0x00, 0x04, 0x00, 0x02, 0x01, 0x00, 0x06, 0x9e, 0x05, 0x40, 0x4a, 0x4b,
+  0x40, 0x34, 0x9d, 0x02, 0x21, 0x21, 0x21, 0x87, 0x03, 0x00, 0x1b, 0x01, 0x02, 0x14, 0x01, 0x01, 0xa9, 0x01, 0x02, 0x20, 0x01, 0x00, 0x05, 0x00,
+  0x60, 0x12, 0x19, 0x12, 0x21, 0x30, 0x40, 0xb8, 0x00, 0x10, 0x2a, 0x13, 0x00, 0x00, 0x25, 0x01, 0x00, 0x02, 0x00, 0x04, 0xe2, 0x01, 0x00, 0x06,
+  0x00, 0x00, 0x02, 0x00, 0x00, 0x09, 0x00, 0x00, 0x39, 0x00, 0x02, 0xb7, 0x01, 0x01, 0x4f, 0x00, 0x01, 0x0b, 0x00, 0x00, 0xbb, 0x01, 0x01, 0x15,
+  0x00, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x10, 0x00, 0x01, 0xd3, 0x01, 0x11, 0x96, 0x58, 0x05, 0x01, 0x24, 0x00, 0x00,
+  0x37, 0x00, 0x05, 0xe1, 0x01, 0x00, 0xa3, 0x05, 0x05, 0xe1, 0x01, 0x01, 0x01, 0x00, 0x01, 0xd5, 0x01, 0x03, 0x01, 0x00, 0x02, 0x9c, 0x05, 0x30,
+  0x84, 0x90, 0x84, 0x28, 0x00, 0x00, 0xb4, 0x07, 0x00, 0x3c, 0x00, 0x00, 0x58, 0x00, 0x01, 0xdd, 0x01, 0x00, 0x01, 0x00, 0x02, 0x91, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x02, 0x00, 0x02, 0xd2, 0x01, 0x00, 0xa7, 0x01, 0x01, 0xde, 0x01, 0x31, 0x23, 0x21, 0x23, 0x0d, 0x00, 0x00, 0x02, 0x00, 0x01,
+  0x17, 0x00, 0x00, 0x09, 0x00, 0x01, 0xc7, 0x01, 0x00, 0x91, 0x05, 0x00, 0xb0, 0x03, 0x03, 0x0d, 0x00, 0x10, 0x30, 0x10, 0x00, 0x11, 0x30, 0x03,
+  0x00, 0x00, 0x0a, 0x00, 0x01, 0x01, 0x00, 0x01, 0xf5, 0x01, 0x01, 0xb4, 0x05, 0x20, 0x2a, 0x30, 0x16, 0x00, 0x00, 0xdd, 0x01, 0x01, 0x05, 0x00,
+  0x03, 0x06, 0x00, 0x01, 0xeb, 0x01, 0x11, 0x34, 0xe8, 0x01, 0x20, 0x40, 0x42, 0x17, 0x03, 0x00, 0xdc, 0x01, 0x03, 0x01, 0x00, 0x02, 0xdd, 0x01,
+  0x00, 0xea, 0x01, 0x00, 0xb2, 0x01, 0x02, 0x01, 0x00, 0x00, 0xad, 0x01, 0x02, 0xad, 0x03, 0x00, 0xc1, 0x01, 0x00, 0x03, 0x00, 0x00, 0x24, 0x00,
+  0x02, 0x01, 0x00, 0x01, 0xce, 0x01, 0x20, 0x4f, 0x4c, 0x0b, 0x00, 0x03, 0x0e, 0x00, 0x03, 0x07, 0x00, 0x02, 0x9c, 0x05, 0x12, 0x4f, 0x8a, 0x05,
+  0x00, 0xb8, 0x03, 0x04, 0x02, 0x00, 0x02, 0x01, 0x00, 0x00, 0x18, 0x06, 0x80, 0x4b, 0x4b, 0x4a, 0x42, 0x3a, 0x30, 0x3a, 0x30, 0x77, 0x05, 0x01,
+  0x01, 0x09, 0x00, 0x1f, 0x01, 0x01, 0x16, 0x01, 0x03, 0x20, 0x01, 0x00, 0x92, 0x03, 0x00, 0x0e, 0x00, 0x00, 0xfe, 0x01, 0x11, 0x12, 0xd8, 0x01,
+  0x12, 0x19, 0xf7, 0x01, 0x11, 0x23, 0x39, 0x01, 0x08, 0x01, 0x00, 0x00, 0xd9, 0x01, 0x00, 0x08, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x3f, 0x00, 0x05,
+  0x68, 0x01, 0x00, 0xc8, 0x01, 0x00, 0xbb, 0x01, 0x01, 0x02, 0x00, 0x10, 0x12, 0xc4, 0x03, 0x00, 0xc8, 0x01, 0x00, 0xcd, 0x03, 0x01, 0x0a, 0x00,
+  0x00, 0x02, 0x00, 0x0a, 0x01, 0x00, 0x00, 0xdd, 0x01, 0x08, 0xdf, 0x01, 0x01, 0xcc, 0x01, 0x03, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x05, 0x00,
+  0x00, 0x18, 0x00, 0x03, 0xbc, 0x03, 0x10, 0x96, 0x9a, 0x05, 0x13, 0x96, 0x25, 0x02, 0x00, 0x01, 0x00, 0x06, 0x89, 0x00, 0x00, 0x01, 0x00, 0x03,
+  0xdd, 0x01, 0x05, 0xce, 0x01, 0x00, 0x03, 0x00, 0x09, 0x01, 0x00, 0x03, 0x10, 0x00, 0x04, 0x7d, 0x05, 0x01, 0x24, 0x00, 0x02, 0x01, 0x00, 0x01,
+  0x0b, 0x00, 0x01, 0xb4, 0x01, 0x52, 0x2a, 0x30, 0x21, 0x2a, 0x21, 0xcd, 0x01, 0x11, 0x28, 0x0f, 0x00, 0x00, 0x2e, 0x00, 0x04, 0xcf, 0x01, 0x01,
+  0x05, 0x00, 0x08, 0x01, 0x00, 0x06, 0x11, 0x00, 0x10, 0x38, 0x03, 0x00, 0x30, 0x38, 0x30, 0x38, 0xd9, 0x01, 0x02, 0x01, 0x00, 0x00, 0xda, 0x01,
+  0x00, 0xbd, 0x01, 0x01, 0xdf, 0x01, 0x00, 0xa7, 0x01, 0x00, 0xa0, 0x03, 0x00, 0x6b, 0x05, 0x01, 0x97, 0x03, 0x02, 0xb0, 0x03, 0x01, 0xcd, 0x01,
+  0x00, 0x26, 0x00, 0x01, 0x25, 0x00, 0x01, 0x01, 0x00, 0x05, 0xd6, 0x01, 0x03, 0x07, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2a, 0x00, 0x02, 0x4b, 0x0b,
+  0x03, 0xd5, 0x01, 0x00, 0xd3, 0x01, 0x01, 0x72, 0x07, 0x00, 0x01, 0x00, 0x00, 0x25, 0x06, 0xc1, 0x47, 0x4a, 0x4a, 0x46, 0x42, 0x43, 0x40, 0x43,
+  0x40, 0x3a, 0x38, 0x30, 0xa2, 0x01, 0x00, 0xdf, 0x01, 0x00, 0xcb, 0x01, 0x03, 0xd6, 0x01, 0x04, 0x01, 0x00, 0x00, 0xb1, 0x01, 0x00, 0xd0, 0x03,
+  0x00, 0x2b, 0x01, 0x00, 0x0e, 0x00, 0x00, 0x01, 0x00, 0x00, 0x12, 0x00, 0x01, 0x9e, 0x07, 0x02, 0x2d, 0x00, 0x00, 0x12, 0x00, 0x03, 0x02, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0xde, 0x01, 0x00, 0x4e, 0x00, 0x00, 0xc6, 0x03, 0x00, 0x0b, 0x00, 0x00, 0x12, 0x00, 0x01, 0x2a, 0x02,
+  0x00, 0xd3, 0x01, 0x00, 0xd8, 0x01, 0x00, 0xda, 0x01, 0x01, 0x9a, 0x01, 0x10, 0x9e, 0xd8, 0x01, 0x00, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x00, 0xae,
+  0x01, 0x22, 0x90, 0x96, 0xdf, 0x01, 0x02, 0xe1, 0x01, 0x04, 0x02, 0x00, 0x02, 0x01, 0x00, 0x00, 0xe6, 0x01, 0x00, 0x01, 0x00, 0x02, 0x78, 0x07,
+  0x00, 0x2e, 0x00, 0x04, 0xdf, 0x01, 0x00, 0xe1, 0x01, 0x00, 0x97, 0x00, 0x00, 0x7d, 0x00, 0x01, 0xdb, 0x01, 0x00, 0x04, 0x00, 0x00, 0xae, 0x03,
+  0x01, 0xa2, 0x03, 0x00, 0x02, 0x00, 0x00, 0xb5, 0x01, 0x03, 0x01, 0x00, 0x00, 0x87, 0x01, 0x00, 0x07, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x02, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x10, 0x00, 0x01, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0c, 0x00, 0x02, 0x06, 0x00, 0x02, 0x01, 0x00,
+  0x03, 0x0e, 0x00, 0x0f, 0x01, 0x00, 0x15, 0x04, 0x2a, 0x00, 0x00, 0xda, 0x01, 0x0c, 0x01, 0x00, 0x00, 0xe6, 0x01, 0x10, 0x4f, 0xd2, 0x01, 0x10,
+  0x4c, 0xa0, 0x01, 0x01, 0xac, 0x01, 0x00, 0xb9, 0x01, 0x00, 0x15, 0x00, 0x04, 0xdf, 0x01, 0x02, 0x23, 0x00, 0x02, 0x01, 0x00, 0x00, 0xd1, 0x01,
+  0x00, 0x2c, 0x00, 0x00, 0x06, 0x00, 0x00, 0x2c, 0x00, 0x08, 0xda, 0x01, 0x01, 0xce, 0x01, 0x00, 0xcf, 0x01, 0x00, 0x07, 0x00, 0x12, 0x47, 0xef,
+  0x09, 0x50, 0x42, 0x42, 0x40, 0x42, 0x42, 0x12, 0x08, 0x00, 0xf8, 0x0b, 0x32, 0x38, 0x30, 0x2a, 0x8e, 0x01, 0x00, 0x1a, 0x01, 0x00, 0x82, 0x01,
+  0x01, 0x20, 0x01, 0x01, 0xa7, 0x01, 0x01, 0x26, 0x01, 0x00, 0xcf, 0x01, 0x31, 0x12, 0x12, 0x12, 0x06, 0x03, 0x03, 0x11, 0x00, 0x00, 0xe1, 0x01,
+  0x00, 0x16, 0x00, 0x01, 0x14, 0x02, 0x00, 0x36, 0x00, 0x00, 0x14, 0x00, 0x03, 0x06, 0x00, 0x10, 0x23, 0x1e, 0x00, 0x00, 0x14, 0x00, 0x02, 0x6e,
+  0x01, 0x00, 0x01, 0x00, 0x00, 0x17, 0x00, 0x03, 0x01, 0x00, 0x00, 0x35, 0x00, 0x00, 0x13, 0x00, 0x00, 0x1e, 0x00, 0x10, 0x9f, 0xe1, 0x01, 0x00,
+  0x9e, 0x01, 0x02, 0x04, 0x00, 0x01, 0x01, 0x00, 0x11, 0x90, 0x5d, 0x09, 0x00, 0xbf, 0x01, 0x02, 0xdf, 0x01, 0x02, 0x01, 0x00, 0x02, 0xd9, 0x01,
+  0x00, 0x04, 0x00, 0x00, 0xf1, 0x01, 0x00, 0x01, 0x00, 0x10, 0xa9, 0xc0, 0x03, 0x00, 0x9a, 0x05, 0x00, 0x3b, 0x00, 0x00, 0xdd, 0x01, 0x00, 0xbf,
+  0x03, 0x01, 0x5b, 0x00, 0x00, 0x66, 0x00, 0x44, 0x19, 0x21, 0x19, 0x23, 0xde, 0x01, 0x01, 0xdb, 0x01, 0x01, 0xbb, 0x03, 0x01, 0xde, 0x01, 0x02,
+  0xd8, 0x01, 0x01, 0x7c, 0x01, 0x03, 0x07, 0x00, 0x05, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x01, 0x00, 0x06, 0x15, 0x00, 0x04,
+  0x3a, 0x00, 0x04, 0x14, 0x00, 0x10, 0x38, 0x05, 0x00, 0x06, 0x06, 0x00, 0x01, 0xaf, 0x03, 0x00, 0x05, 0x00, 0x01, 0x0f, 0x00, 0x00, 0x02, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0xd0, 0x01, 0x0f, 0x01, 0x00, 0x03, 0x00, 0xbb, 0x01, 0x10, 0x4d, 0x05, 0x00, 0x01, 0x01, 0x00, 0x01, 0xba, 0x03, 0x02,
+  0xd8, 0x01, 0x00, 0x05, 0x00, 0x13, 0x51, 0x1a, 0x00, 0x01, 0x17, 0x00, 0x01, 0xd8, 0x01, 0x03, 0x0a, 0x02, 0x01, 0xd7, 0x01, 0x50, 0x4c, 0x4a,
+  0x4b, 0x49, 0x4b, 0xa4, 0x03, 0x00, 0xd4, 0x01, 0x40, 0x42, 0x46, 0x42, 0x42, 0x05, 0x00, 0x41, 0x46, 0x42, 0x3a, 0x38, 0xef, 0x09, 0x00, 0xe8,
+  0x0b, 0x01, 0x7f, 0x00, 0x01, 0x04, 0x00, 0x20, 0x30, 0x2a, 0x94, 0x01, 0x00, 0x17, 0x01, 0x08, 0x01, 0x00, 0x01, 0x71, 0x03, 0x02, 0x01, 0x00,
+  0x00, 0xc9, 0x01, 0x00, 0xa1, 0x05, 0x42, 0x23, 0x21, 0x23, 0x19, 0x02, 0x00, 0x00, 0x15, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0d,
+  0x00, 0x01, 0xd7, 0x01, 0x00, 0x13, 0x00, 0x00, 0x57, 0x01, 0x00, 0xdb, 0x01, 0x03, 0x1b, 0x00, 0x00, 0x02, 0x00, 0x50, 0x19, 0x19, 0x1c, 0x19,
+  0x1c, 0x23, 0x00, 0x30, 0x12, 0x19, 0x1c, 0x54, 0x00, 0x01, 0x1c, 0x00, 0x02, 0x06, 0x00, 0x00, 0x98, 0x01, 0x00, 0x01, 0x00, 0x00, 0x82, 0x03,
+  0x01, 0xde, 0x01, 0x00, 0x39, 0x0b, 0x04, 0x3c, 0x0b, 0x00, 0xd2, 0x01, 0x01, 0xd4, 0x01, 0x05, 0x56, 0x09, 0x01, 0x01, 0x00, 0x20, 0x84, 0xa8,
+  0xdd, 0x01, 0x21, 0x84, 0xa9, 0x57, 0x09, 0x01, 0x01, 0x00, 0x01, 0xbf, 0x03, 0x00, 0x00, 0x06, 0x02, 0x6d, 0x02, 0x21, 0x19, 0x12, 0x86, 0x00,
+  0x21, 0x21, 0x19, 0xd3, 0x01, 0x01, 0xd5, 0x01, 0x01, 0x98, 0x01, 0x04, 0x02, 0x00, 0x04, 0x9d, 0x01, 0x0f, 0x01, 0x00, 0x0a, 0x02, 0x9b, 0x01,
+  0x0f, 0x01, 0x00, 0x0a, 0x11, 0x38, 0xcb, 0x01, 0x02, 0x02, 0x00, 0x01, 0x01, 0x00, 0x00, 0x09, 0x00, 0x01, 0x38, 0x00, 0x03, 0xe6, 0x01, 0x00,
+  0x07, 0x00, 0x27, 0x38, 0x38, 0xa0, 0x05, 0x0f, 0x01, 0x00, 0x09, 0x01, 0xca, 0x01, 0x01, 0xcc, 0x01, 0x00, 0xdd, 0x01, 0x05, 0xf8, 0x01, 0x00,
+  0x92, 0x07, 0x01, 0xc5, 0x05, 0x01, 0x2b, 0x0b, 0x00, 0x02, 0x00, 0x50, 0x4a, 0x4c, 0x4a, 0x4a, 0x49, 0xad, 0x03, 0x01, 0xc5, 0x09, 0x11, 0x42,
+  0xb9, 0x0b, 0x01, 0xd5, 0x01, 0x00, 0x08, 0x00, 0x06, 0x01, 0x00, 0x00, 0x8a, 0x00, 0x04, 0xeb, 0x00, 0x15, 0x2a, 0xb8, 0x01, 0x01, 0x02, 0x00,
+  0x30, 0x21, 0x19, 0x19, 0xb4, 0x06, 0x01, 0x94, 0x01, 0x02, 0x01, 0x00, 0x02, 0xc5, 0x01, 0x00, 0xdf, 0x01, 0x00, 0x40, 0x01, 0x01, 0x25, 0x00,
+  0x02, 0xb6, 0x01, 0x00, 0xd6, 0x01, 0x01, 0x18, 0x00, 0x01, 0x09, 0x00, 0x00, 0x14, 0x00, 0x02, 0x0b, 0x00, 0x02, 0x31, 0x00, 0x00, 0xc3, 0x01,
+  0x04, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x01, 0x7c, 0x01, 0x04, 0xec, 0x01, 0x00, 0xe2, 0x03, 0x51, 0xa0, 0x9f, 0xa0, 0x9c, 0x9e, 0xa1, 0x05, 0x00,
+  0xa5, 0x01, 0x00, 0xac, 0x01, 0x01, 0xe2, 0x01, 0x01, 0xbb, 0x03, 0x10, 0xa8, 0xda, 0x01, 0x00, 0x01, 0x00, 0x01, 0x36, 0x0b, 0x00, 0x1f, 0x0d,
+  0x01, 0x0c, 0x00, 0x02, 0x01, 0x00, 0x00, 0xc2, 0x03, 0x00, 0x0a, 0x02, 0x00, 0x33, 0x00, 0x01, 0xe1, 0x01, 0x10, 0x96, 0xc1, 0x03, 0x01, 0x55,
+  0x00, 0x00, 0x5e, 0x00, 0x01, 0xdd, 0x01, 0x11, 0x23, 0xdc, 0x01, 0x02, 0x46, 0x07, 0x03, 0xe1, 0x01, 0x0e, 0x01, 0x00, 0x00, 0x08, 0x01, 0x09,
+  0x02, 0x00, 0x02, 0x1b, 0x01, 0x05, 0x07, 0x00, 0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x01, 0x01, 0x00, 0x02, 0x09, 0x00, 0x06, 0x1c, 0x00, 0x04,
+  0x2a, 0x00, 0x03, 0x01, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x06, 0x00, 0x00, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0xbe, 0x01, 0x20, 0x51, 0x50, 0x05,
+  0x00, 0x0e, 0x01, 0x00, 0x00, 0x59, 0x0b, 0x00, 0x04, 0x00, 0x01, 0x01, 0x00, 0x00, 0xd8, 0x01, 0x03, 0xe4, 0x01, 0x00, 0x01, 0x00, 0x00, 0xac,
+  0x03, 0x02, 0x02, 0x00, 0x00, 0xd8, 0x01, 0x00, 0xd7, 0x01, 0x02, 0x8b, 0x05, 0x00, 0x85, 0x05, 0x00, 0xb0, 0x03, 0x03, 0x82, 0x05, 0x26, 0x40,
+  0x38, 0xdf, 0x01, 0x10, 0x40, 0x5f, 0x02, 0x00, 0x01, 0x00, 0x01, 0xa4, 0x00, 0x05, 0x01, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x0b, 0x01, 0x00, 0xda,
+  0x01, 0x00, 0x14, 0x01, 0x21, 0x2a, 0x23, 0xe0, 0x04, 0x02, 0xab, 0x01, 0x01, 0x91, 0x01, 0x60, 0x23, 0x19, 0x23, 0x12, 0x19, 0x12, 0x11, 0x00,
+  0x02, 0x13, 0x00, 0x00, 0x12, 0x00, 0x00, 0x18, 0x00, 0x00, 0xdc, 0x01, 0x00, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x11, 0x00, 0x11, 0x23, 0x19,
+  0x00, 0x00, 0x11, 0x00, 0x00, 0x01, 0x00, 0x00, 0x21, 0x00, 0x00, 0xe1, 0x01, 0x01, 0xe7, 0x01, 0x00, 0x11, 0x00, 0x02, 0xc3, 0x03, 0x01, 0x12,
+  0x00, 0x00, 0xa0, 0x05, 0x11, 0x9e, 0x02, 0x00, 0x11, 0x9c, 0xe3, 0x01, 0x10, 0x9e, 0xa5, 0x01, 0x01, 0x01, 0x00, 0x00, 0xe2, 0x01, 0x02, 0xe3,
+  0x01, 0x01, 0xbd, 0x03, 0x00, 0x01, 0x00, 0x00, 0xe3, 0x01, 0x00, 0xfb, 0x0e, 0x00, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x14, 0x00, 0x00, 0xa4,
+  0x05, 0x00, 0x0e, 0x02, 0x00, 0x33, 0x00, 0x03, 0xa3, 0x05, 0x00, 0x58, 0x00, 0x00, 0x01, 0x00, 0x03, 0x98, 0x00, 0x00, 0xca, 0x00, 0x02, 0xda,
+  0x01, 0x04, 0x01, 0x00, 0x00, 0xf6, 0x00, 0x00, 0xfc, 0x00, 0x03, 0x02, 0x00, 0x02, 0x09, 0x01, 0x04, 0x09, 0x00, 0x0f, 0x01, 0x00, 0x0a, 0x01,
+  0x1b, 0x03, 0x01, 0xd4, 0x01, 0x00, 0x04, 0x00, 0x02, 0x02, 0x00, 0x00, 0x01, 0x00, 0x02, 0x06, 0x00, 0x05, 0x01, 0x00, 0x0f, 0x0f, 0x00, 0x01,
+  0x21, 0x51, 0x50, 0xde, 0x01, 0x00, 0x04, 0x00, 0x0f, 0x01, 0x00, 0x09, 0x07, 0x51, 0x09, 0x00, 0xe6, 0x01, 0x12, 0x4c, 0x65, 0x07, 0x14, 0x4c,
+  0x35, 0x09, 0x00, 0xd8, 0x01, 0x14, 0x47, 0xd3, 0x01, 0x03, 0x01, 0x00, 0x02, 0x96, 0x00, 0x02, 0x01, 0x00, 0x02, 0x0d, 0x00, 0x05, 0x97, 0x00,
+  0x01, 0xe8, 0x01, 0x00, 0x05, 0x00, 0x01, 0xdf, 0x01, 0x00, 0xf6, 0x00, 0x00, 0xe6, 0x02, 0x11, 0x23, 0x10, 0x01, 0x00, 0x12, 0x00, 0x00, 0xff,
+  0x02, 0x00, 0x0e, 0x00, 0x00, 0x15, 0x00, 0x20, 0x21, 0x23, 0xb1, 0x01, 0x02, 0xb3, 0x01, 0x32, 0x23, 0x19, 0x23, 0x09, 0x00, 0x00, 0xad, 0x01,
+  0x21, 0x12, 0x12, 0x48, 0x01, 0x00, 0x21, 0x00, 0x30, 0x19, 0x23, 0x23, 0x05, 0x00, 0x01, 0x26, 0x00, 0x01, 0x12, 0x00, 0x01, 0xdd, 0x01, 0x02,
+  0x05, 0x00, 0x01, 0xdd, 0x01, 0x00, 0x1b, 0x00, 0x00, 0x31, 0x00, 0x03, 0xde, 0x01, 0x02, 0xda, 0x01, 0x00, 0xa1, 0x05, 0x00, 0xdb, 0x01, 0x00,
+  0x01, 0x00, 0x01, 0xdf, 0x01, 0x10, 0xa9, 0x02, 0x00, 0x02, 0xdf, 0x01, 0x12, 0xa8, 0xc2, 0x03, 0x00, 0x04, 0x00, 0x01, 0x01, 0x00, 0x03, 0xe2,
+  0x01, 0x00, 0x08, 0x00, 0x01, 0xe1, 0x01, 0x00, 0xc2, 0x05, 0x01, 0xc3, 0x03, 0x00, 0x85, 0x07, 0x01, 0xc4, 0x03, 0x13, 0xa0, 0xa0, 0x05, 0x00,
+  0x04, 0x00, 0x00, 0x87, 0x04, 0x00, 0x31, 0x08, 0x01, 0xd1, 0x00, 0x00, 0xc6, 0x00, 0x00, 0xd7, 0x00, 0x03, 0xe8, 0x00, 0x02, 0x07, 0x01, 0x01,
+  0x01, 0x01, 0x00, 0x03, 0x00, 0x00, 0x09, 0x00, 0x02, 0x01, 0x00, 0x01, 0x0a, 0x00, 0x00, 0x27, 0x01, 0x00, 0x06, 0x00, 0x00, 0x08, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x02, 0x01, 0x00, 0x01, 0x0e, 0x00, 0x00, 0x01, 0x00, 0x08, 0x3c, 0x00, 0x00,
+  0x01, 0x00, 0x0a, 0x0e, 0x00, 0x00, 0x29, 0x00, 0x00, 0x01, 0x00, 0x00, 0xbd, 0x01, 0x20, 0x51, 0xff, 0x05, 0x00, 0x0f, 0x01, 0x00, 0x07, 0x01,
+  0x95, 0x05, 0x11, 0x51, 0x95, 0x05, 0x00, 0xc2, 0x03, 0x00, 0x93, 0x05, 0x10, 0x4f, 0xde, 0x01, 0x01, 0x8b, 0x05, 0x20, 0x47, 0x42, 0xd9, 0x01,
+  0x00, 0xdb, 0x01, 0x03, 0xde, 0x01, 0x01, 0x82, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x81, 0x00, 0x04, 0xd6, 0x00, 0x08, 0x01, 0x00, 0x01, 0xf3, 0x00,
+  0x02, 0xd8, 0x01, 0x10, 0x38, 0xfc, 0x00, 0x00, 0x0a, 0x00, 0x05, 0x01, 0x00, 0x50, 0x2a, 0x30, 0x30, 0x38, 0x33, 0xee, 0x01, 0x01, 0x16, 0x00,
+  0x00, 0x1e, 0x00, 0x01, 0xf9, 0x01, 0x03, 0xbf, 0x01, 0x00, 0x9f, 0x03, 0x00, 0xb7, 0x01, 0x00, 0x8a, 0x03, 0x00, 0x01, 0x00, 0x01, 0x10, 0x00,
+  0x00, 0xd6, 0x01, 0x01, 0x58, 0x01, 0x00, 0xc2, 0x03, 0x01, 0x59, 0x01, 0x00, 0xe2, 0x01, 0x02, 0x16, 0x00, 0x01, 0x2c, 0x00, 0x04, 0x01, 0x00,
+  0x00, 0xdc, 0x01, 0x81, 0x12, 0x12, 0x9f, 0xa0, 0x12, 0x9e, 0x9f, 0x9c, 0xe3, 0x01, 0x40, 0x9e, 0x9c, 0x9f, 0x9e, 0xe4, 0x01, 0x20, 0x96, 0x9e,
+  0xdf, 0x01, 0x00, 0xac, 0x01, 0x02, 0xbf, 0x03, 0x06, 0xbc, 0x03, 0x01, 0xda, 0x01, 0x00, 0x02, 0x00, 0x06, 0x01, 0x00, 0x01, 0xac, 0x05, 0x00,
+  0x00, 0x02, 0x00, 0xa5, 0x05, 0x05, 0x89, 0x07, 0x00, 0x2c, 0x02, 0x01, 0x84, 0x07, 0x00, 0x47, 0x02, 0x02, 0x88, 0x00, 0x00, 0xb8, 0x00, 0x01,
+  0xe0, 0x01, 0x03, 0x03, 0x00, 0x00, 0xd2, 0x02, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x11, 0x30, 0x27, 0x01, 0x00, 0x04, 0x00, 0x0e, 0x01, 0x00,
+  0x00, 0x43, 0x01, 0x07, 0x02, 0x00, 0x02, 0xe2, 0x01, 0x00, 0x0b, 0x00, 0x01, 0x0c, 0x00, 0x02, 0x01, 0x00, 0x02, 0x09, 0x00, 0x10, 0x40, 0x49,
+  0x00, 0x00, 0x01, 0x00, 0x02, 0x06, 0x00, 0x02, 0x01, 0x00, 0x01, 0x33, 0x00, 0x00, 0x02, 0x00, 0x22, 0x51, 0xff, 0xde, 0x01, 0x12, 0xff, 0xc3,
+  0x03, 0x11, 0x4d, 0x03, 0x00, 0x00, 0xce, 0x01, 0x00, 0x02, 0x00, 0x02, 0x9d, 0x05, 0x01, 0x0b, 0x00, 0x03, 0xbf, 0x03, 0x01, 0xbc, 0x12, 0x01,
+  0x02, 0x00, 0x05, 0xdf, 0x01, 0x01, 0xdc, 0x01, 0x01, 0x01, 0x00, 0x00, 0x6b, 0x00, 0x06, 0x01, 0x00, 0x00, 0xcb, 0x00, 0x00, 0xd4, 0x00, 0x00,
+  0xdc, 0x00, 0x03, 0x02, 0x00, 0x00, 0xee, 0x00, 0x00, 0x01, 0x00, 0x02, 0x06, 0x00, 0x00, 0xf6, 0x00, 0x02, 0x0b, 0x00, 0x02, 0xfe, 0x00, 0x00,
+  0xd7, 0x01, 0x00, 0x2f, 0x00, 0x01, 0x01, 0x00, 0x01, 0x14, 0x00, 0x01, 0x1d, 0x00, 0x04, 0x01, 0x00, 0x00, 0xba, 0x01, 0x00, 0xa8, 0x03, 0x00,
+  0xbd, 0x01, 0x10, 0x1c, 0xba, 0x01, 0x02, 0xb4, 0x03, 0x00, 0xb7, 0x01, 0x00, 0x8d, 0x07, 0x01, 0xf1, 0x01, 0x00, 0x61, 0x07, 0x01, 0x27, 0x00,
+  0x00, 0x1d, 0x00, 0x00, 0xec, 0x03, 0x00, 0x06, 0x00, 0x62, 0x23, 0x19, 0x1c, 0x12, 0x12, 0x9f, 0x22, 0x00, 0x01, 0xc1, 0x03, 0x10, 0x9f, 0x7c,
+  0x07, 0x01, 0xdf, 0x01, 0x11, 0x9c, 0x05, 0x00, 0x00, 0x7f, 0x03, 0x00, 0xa4, 0x01, 0x03, 0xc0, 0x03, 0x00, 0x7e, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0xdf, 0x01, 0x0e, 0x01, 0x00, 0x01, 0xc1, 0x03, 0x40, 0xa8, 0xa7, 0x84, 0xa8, 0xe9, 0x03, 0x05, 0xe1, 0x01, 0x03, 0xe2, 0x01, 0x00, 0x01, 0x00,
+  0x01, 0x87, 0x00, 0x00, 0x7b, 0x00, 0x11, 0x21, 0xe2, 0x01, 0x00, 0xe8, 0x00, 0x01, 0xd3, 0x00, 0x0d, 0xe1, 0x01, 0x00, 0x85, 0x01, 0x00, 0x06,
+  0x00, 0x04, 0x39, 0x01, 0x00, 0x09, 0x00, 0x00, 0x9a, 0x01, 0x02, 0x4c, 0x01, 0x00, 0x07, 0x00, 0x07, 0x0a, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x08,
+  0x00, 0x02, 0x01, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x1c, 0x00, 0x01, 0x02, 0x00, 0x00, 0x01, 0x00, 0x04, 0x08, 0x00, 0x02, 0x01, 0x00, 0x00, 0x0e,
+  0x00, 0x13, 0x40, 0xc0, 0x03, 0x04, 0x01, 0x00, 0x10, 0x50, 0x88, 0x05, 0x00, 0xcc, 0x01, 0x00, 0xcb, 0x12, 0x20, 0x4d, 0x4f, 0xea, 0x01, 0x00,
+  0x0f, 0x00, 0x02, 0x04, 0x00, 0x10, 0x4d, 0xda, 0x01, 0x00, 0xb7, 0x03, 0x00, 0x1f, 0x0b, 0x02, 0x6c, 0x07, 0x07, 0xeb, 0x0c, 0x00, 0x4c, 0x00,
+  0x01, 0x05, 0x00, 0x03, 0x06, 0x00, 0x00, 0x7c, 0x05, 0x01, 0xb3, 0x01, 0x01, 0xe2, 0x01, 0x00, 0xde, 0x00, 0x00, 0xcd, 0x01, 0x01, 0x06, 0x00,
+  0x00, 0xf2, 0x00, 0x00, 0x05, 0x00, 0x04, 0x08, 0x00, 0x01, 0x05, 0x01, 0x00, 0x23, 0x00, 0x01, 0x01, 0x00, 0x11, 0x38, 0x15, 0x00, 0x00, 0x0a,
+  0x00, 0x01, 0x2e, 0x00, 0x00, 0x1b, 0x01, 0x00, 0x20, 0x00, 0x01, 0x16, 0x00, 0x01, 0xe5, 0x01, 0x11, 0x2a, 0x39, 0x01, 0x11, 0x19, 0x05, 0x00,
+  0x00, 0xcc, 0x01, 0x00, 0xb7, 0x01, 0x10, 0x19, 0xa2, 0x07, 0x00, 0xc2, 0x01, 0x02, 0x0d, 0x00, 0x03, 0xf3, 0x01, 0x01, 0x10, 0x00, 0x40, 0x23,
+  0x23, 0x23, 0x1c, 0x1c, 0x00, 0x00, 0x55, 0x03, 0x70, 0x1c, 0x19, 0x1c, 0x12, 0x1c, 0x12, 0xa0, 0x4c, 0x05, 0x10, 0x9f, 0x50, 0x05, 0x52, 0x9c,
+  0x12, 0x9c, 0xa0, 0x9c, 0x65, 0x09, 0x70, 0x9e, 0x96, 0x9e, 0x96, 0x96, 0x90, 0xac, 0xbf, 0x03, 0x00, 0xb5, 0x01, 0x10, 0xa9, 0xe1, 0x01, 0x00,
+  0xe0, 0x01, 0x70, 0xab, 0xa6, 0xa6, 0xa6, 0xae, 0x68, 0xae, 0xd8, 0x01, 0x01, 0x05, 0x00, 0x00, 0x01, 0x00, 0x01, 0xe1, 0x01, 0x01, 0xc3, 0x03,
+  0x10, 0xa8, 0x09, 0x0f, 0x00, 0xdd, 0x01, 0x00, 0xe0, 0x01, 0x10, 0x9e, 0x2e, 0x02, 0x20, 0x9f, 0x9e, 0xe2, 0x01, 0x02, 0x80, 0x00, 0x00, 0x5c,
+  0x02, 0x21, 0x23, 0x23, 0xdf, 0x00, 0x00, 0x05, 0x00, 0x20, 0x30, 0x30, 0x10, 0x01, 0x00, 0xb5, 0x04, 0x00, 0x1f, 0x01, 0x00, 0x01, 0x00, 0x00,
+  0x2b, 0x01, 0x01, 0x02, 0x00, 0x0f, 0x01, 0x00, 0x04, 0x10, 0x42, 0x58, 0x01, 0x0f, 0x01, 0x00, 0x10, 0x0f, 0x25, 0x00, 0x01, 0x01, 0x86, 0x01,
+  0x12, 0x40, 0x80, 0x07, 0x02, 0x02, 0x00, 0x00, 0xc4, 0x01, 0x21, 0x51, 0x4d, 0xcc, 0x01, 0x00, 0x05, 0x00, 0x01, 0xb5, 0x03, 0x00, 0xb7, 0x03,
+  0x00, 0x04, 0x00, 0x00, 0xdc, 0x01, 0x90, 0x4c, 0x4b, 0x49, 0x4b, 0x49, 0x47, 0x47, 0x4e, 0x4c, 0xdc, 0x01, 0x00, 0xb7, 0x03, 0x11, 0x47, 0xdf,
+  0x01, 0x00, 0x0c, 0x00, 0x00, 0x51, 0x00, 0x03, 0x53, 0x00, 0x01, 0x56, 0x00, 0x02, 0x01, 0x00, 0x00, 0xac, 0x02, 0x52, 0x30, 0x33, 0x30, 0x2a,
+  0x33, 0xa6, 0x01, 0x21, 0x30, 0x30, 0x09, 0x00, 0x01, 0x02, 0x00, 0x40, 0x2a, 0x2a, 0x2a, 0x2b, 0x05, 0x00, 0x00, 0x0c, 0x00, 0x01, 0x02, 0x00,
+  0x20, 0x30, 0x33, 0xf7, 0x00, 0x01, 0xfa, 0x00, 0x22, 0x30, 0x33, 0x02, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x15, 0x01, 0x00, 0x0c, 0x00, 0x20, 0x30,
+  0x2b, 0x20, 0x01, 0x30, 0x2a, 0x30, 0x2a, 0xdf, 0x01, 0x21, 0x2a, 0x23, 0x8a, 0x05, 0x00, 0x03, 0x00, 0x00, 0x96, 0x09, 0x00, 0x4b, 0x01, 0x01,
+  0x88, 0x05, 0x01, 0x8a, 0x05, 0x00, 0xcc, 0x01, 0x00, 0x61, 0x01, 0x03, 0x01, 0x00, 0x10, 0x1c, 0x05, 0x00, 0x21, 0x12, 0x12, 0xd9, 0x01, 0x10,
+  0x1c, 0x23, 0x00, 0x02, 0x12, 0x00, 0x41, 0x1c, 0x12, 0x12, 0xa0, 0x02, 0x00, 0xa1, 0x12, 0x9e, 0x9c, 0x9f, 0xa0, 0x9f, 0x9e, 0x9c, 0x96, 0xa0,
+  0xc3, 0x03, 0x01, 0xc5, 0x03, 0x01, 0x01, 0x00, 0x05, 0x45, 0x0b, 0x00, 0xd2, 0x01, 0x03, 0x01, 0x00, 0x01, 0xe2, 0x01, 0x11, 0xab, 0xdf, 0x01,
+  0x10, 0xa8, 0x02, 0x00, 0x20, 0x84, 0xa8, 0xa1, 0x05, 0x10, 0xac, 0x37, 0x00, 0x60, 0x96, 0x96, 0x96, 0x9e, 0x96, 0x9e, 0x2d, 0x02, 0x04, 0xe2,
+  0x01, 0x02, 0xe4, 0x01, 0x02, 0xaa, 0x00, 0x21, 0x23, 0x19, 0xe2, 0x01, 0x01, 0x01, 0x00, 0x03, 0xb8, 0x02, 0x00, 0xfa, 0x02, 0x00, 0xee, 0x00,
+  0x00, 0x06, 0x00, 0x02, 0x1c, 0x03, 0x04, 0x01, 0x00, 0x00, 0x5b, 0x01, 0x00, 0x53, 0x01, 0x00, 0x5d, 0x01, 0x00, 0x05, 0x00, 0x03, 0x02, 0x00,
+  0x05, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x20, 0x00, 0x00, 0x07, 0x00, 0x00, 0x10, 0x00, 0x02, 0x01, 0x00, 0x06, 0x0d, 0x00, 0x00, 0x08, 0x00,
+  0x90, 0x42, 0x40, 0x40, 0x40, 0x40, 0x42, 0x40, 0x40, 0x40, 0x18, 0x51, 0x01, 0x00, 0xf1, 0x2d, 0x4f, 0x51, 0x4d, 0x4f, 0x4d, 0x4f, 0x4f, 0x4f,
+  0x51, 0x4f, 0x50, 0x4f, 0x51, 0x51, 0x4f, 0x4f, 0x4f, 0x4c, 0x4b, 0x4c, 0x4b, 0x4c, 0x4f, 0x4c, 0x4c, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x47, 0x47,
+  0x4a, 0x4c, 0x4a, 0x47, 0x47, 0x49, 0x4b, 0x4e, 0x4c, 0x4b, 0x42, 0x42, 0x42, 0x42, 0x4a, 0x4e, 0x4a, 0x47, 0x47, 0x42, 0x47, 0x47, 0x42, 0x42,
+  0x42, 0x40, 0x42, 0x40, 0x05, 0x00, 0x21, 0x38, 0x40, 0x01, 0x00, 0x30, 0x38, 0x40, 0x38, 0x03, 0x00, 0x01, 0x01, 0x00, 0x2d, 0x33, 0x30, 0x02,
+  0x00, 0x70, 0x2a, 0x30, 0x33, 0x2a, 0x33, 0x2a, 0x30, 0x01, 0x00, 0x00, 0x10, 0x00, 0x01, 0x23, 0x00, 0x20, 0x38, 0x30, 0x2d, 0x00, 0x00, 0x01,
+  0x00, 0xa0, 0x30, 0x38, 0x38, 0x30, 0x33, 0x38, 0x38, 0x30, 0x30, 0x30, 0x04, 0x00, 0x01, 0x06, 0x00, 0x50, 0x33, 0x30, 0x2b, 0x30, 0x2a, 0x01,
+  0x00, 0x70, 0x33, 0x2a, 0x2a, 0x23, 0x21, 0x23, 0x2a, 0x02, 0x00, 0xa0, 0x2a, 0x2a, 0x23, 0x23, 0x23, 0x21, 0x23, 0x23, 0x23, 0x23, 0x09, 0x00,
+  0xc0, 0x23, 0x23, 0x23, 0x1c, 0x19, 0x1c, 0x19, 0x1c, 0x12, 0x12, 0x1c, 0x12, 0x06, 0x00, 0x07, 0x01, 0x00, 0x20, 0xa0, 0x9f, 0x15, 0x00, 0x31,
+  0x12, 0x12, 0x9f, 0x1d, 0x00, 0x01, 0x05, 0x00, 0x10, 0xa0, 0x17, 0x00, 0x10, 0x12, 0x0a, 0x00, 0x82, 0x12, 0xa0, 0x12, 0xa0, 0x9c, 0xa0, 0x9c,
+  0x9e, 0x02, 0x00, 0xf2, 0x0d, 0x96, 0x96, 0x9e, 0x96, 0x9e, 0x96, 0x96, 0x96, 0x96, 0xa9, 0x96, 0xa9, 0xa9, 0xa9, 0xb3, 0x84, 0xa8, 0x84, 0xa8,
+  0xa7, 0xa7, 0xa8, 0xa8, 0xa7, 0xa7, 0xa7, 0xab, 0xa6, 0x01, 0x00, 0xb0, 0xab, 0xa6, 0xa7, 0xa6, 0xa6, 0xab, 0xa7, 0xa7, 0xa7, 0xa7, 0xa8, 0x1e,
+  0x00, 0x90, 0x84, 0xa9, 0xa9, 0x90, 0xac, 0x90, 0x96, 0xac, 0x96, 0x3a, 0x00, 0x00, 0x42, 0x00, 0xb0, 0x9c, 0x9e, 0x9f, 0x9e, 0x12, 0x9e, 0x12,
+  0x9e, 0x9f, 0x9e, 0x9f, 0x61, 0x00, 0x01, 0x64, 0x00, 0x01, 0x99, 0x00, 0x30, 0x19, 0x1c, 0x19, 0xa5, 0x00, 0x00, 0xae, 0x00, 0x01, 0xbd, 0x00,
+  0x50, 0x2a, 0x2a, 0x30, 0x2a, 0x33, 0xda, 0x00, 0x12, 0x2a, 0xfd, 0x00, 0x11, 0x33, 0x30, 0x01, 0x00, 0x38, 0x01, 0x30, 0x40, 0x40, 0x40, 0x5e,
+  0x01, 0x0f, 0x01, 0x00, 0x05, 0x00, 0x6f, 0x01, 0x01, 0x01, 0x00, 0x01, 0x74, 0x01, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x02, 0x00, 0x01, 0x05, 0x00, 0x00, 0xd7, 0x01, 0x04, 0x01, 0x00, 0xb1, 0x4d, 0x4f, 0x4d,
+  0x4e, 0x4c, 0x4b, 0x4c, 0x4c, 0x4f, 0x4c, 0x4f, 0x01, 0x00, 0x00, 0xd7, 0x01, 0x12, 0x47, 0xda, 0x01, 0x20, 0x47, 0x42, 0xca, 0x01, 0x10, 0x49,
+  0xe1, 0x01, 0x60, 0x4a, 0x4c, 0x4e, 0x4b, 0x4a, 0x47, 0x08, 0x00, 0x63, 0x4b, 0x4c, 0x4a, 0x47, 0x4e, 0x4a, 0x71, 0x00, 0x00, 0x5c, 0x00, 0x23,
+  0x40, 0x42, 0x9d, 0x00, 0x00, 0xa5, 0x00, 0x02, 0xe7, 0x01, 0x00, 0xe2, 0x01, 0x01, 0x04, 0x00, 0x11, 0x33, 0xeb, 0x01, 0x00, 0x04, 0x00, 0x25,
+  0x30, 0x33, 0x05, 0x00, 0x00, 0x1f, 0x00, 0x09, 0x01, 0x00, 0x11, 0x30, 0x26, 0x00, 0x01, 0xf4, 0x01, 0x41, 0x38, 0x30, 0x38, 0x30, 0x02, 0x01,
+  0x20, 0x30, 0x2b, 0xe1, 0x01, 0x20, 0x2a, 0x2b, 0x15, 0x01, 0x00, 0xd7, 0x01, 0x01, 0x05, 0x00, 0x00, 0x29, 0x01, 0x20, 0x21, 0x23, 0x0c, 0x00,
+  0x04, 0xe0, 0x01, 0x01, 0x01, 0x00, 0x01, 0x49, 0x01, 0x04, 0x02, 0x00, 0x00, 0x5c, 0x01, 0x00, 0xc4, 0x01, 0x00, 0x05, 0x00, 0x61, 0xa0, 0x9c,
+  0xa0, 0x12, 0xa0, 0x19, 0x02, 0x00, 0x01, 0xd4, 0x01, 0x00, 0x82, 0x01, 0x00, 0x90, 0x01, 0x00, 0x09, 0x00, 0x50, 0x9c, 0x9e, 0x96, 0x9c, 0x96,
+  0x06, 0x00, 0x00, 0x11, 0x00, 0x02, 0xe2, 0x01, 0x12, 0xa9, 0x01, 0x00, 0x01, 0xc4, 0x01, 0x01, 0xe1, 0x01, 0x50, 0xa7, 0xa6, 0xa6, 0xa6, 0xaf,
+  0xe2, 0x01, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x03, 0xe2, 0x01, 0x32, 0xa9, 0xac, 0x90, 0xde, 0x01, 0x00, 0x1b, 0x02, 0x02, 0x4d, 0x00, 0x00,
+  0xdc, 0x01, 0x00, 0x02, 0x00, 0x00, 0x68, 0x00, 0x21, 0x12, 0xa0, 0x7e, 0x00, 0x03, 0xe5, 0x01, 0x10, 0x23, 0xe4, 0x01, 0x10, 0x2a, 0x03, 0x00,
+  0x30, 0x2a, 0x2a, 0x23, 0xb2, 0x02, 0x30, 0x2b, 0x30, 0x23, 0xd8, 0x00, 0x30, 0x33, 0x2a, 0x38, 0xf5, 0x00, 0x05, 0x10, 0x01, 0x00, 0x3b, 0x01,
+  0x03, 0x01, 0x00, 0x00, 0x4e, 0x01, 0x00, 0xd5, 0x01, 0x01, 0x66, 0x01, 0x00, 0x07, 0x00, 0x0a, 0x09, 0x00, 0x06, 0x01, 0x00, 0x05, 0x11, 0x00,
+  0x03, 0x07, 0x00, 0x03, 0x01, 0x00, 0x00, 0xd8, 0x01, 0x00, 0x01, 0x00, 0x00, 0xbb, 0x03, 0x12, 0x4c, 0x01, 0x00, 0x00, 0xb4, 0x03, 0x01, 0x01,
+  0x00, 0x00, 0xd8, 0x01, 0x09, 0x01, 0x00, 0x30, 0x4a, 0x4b, 0x47, 0x14, 0x00, 0x01, 0xda, 0x01, 0x10, 0x49, 0x09, 0x00, 0x50, 0x49, 0x4b, 0x4c,
+  0x4e, 0x47, 0xd8, 0x01, 0x20, 0x42, 0x42, 0x20, 0x00, 0x03, 0x5b, 0x00, 0x11, 0x47, 0xf4, 0x01, 0x00, 0x9e, 0x00, 0x10, 0x40, 0xe2, 0x01, 0x02,
+  0x06, 0x00, 0x01, 0x01, 0x00, 0x02, 0xeb, 0x01, 0x04, 0x05, 0x00, 0x06, 0x01, 0x00, 0x06, 0x0f, 0x00, 0x00, 0xd5, 0x01, 0x00, 0xe2, 0x01, 0x00,
+  0x0a, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xef, 0x03, 0x05, 0x04, 0x00, 0x00, 0x12, 0x01, 0x00, 0xfa, 0x02, 0x13, 0x2b, 0xd5, 0x01, 0x00, 0xdd, 0x01,
+  0x01, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x36, 0x01, 0x02, 0x07, 0x00, 0x02, 0x01, 0x00, 0x10, 0x19, 0xd2, 0x03, 0x11, 0x1c, 0x58, 0x01, 0x02,
+  0xd2, 0x03, 0x01, 0xdd, 0x01, 0x01, 0xdf, 0x01, 0x00, 0x83, 0x01, 0x31, 0x9e, 0x9c, 0x9e, 0xcf, 0x01, 0x02, 0x0b, 0x00, 0x00, 0xa1, 0x01, 0x01,
+  0x04, 0x00, 0x01, 0x01, 0x00, 0x50, 0xac, 0x96, 0xa9, 0xa9, 0xa8, 0xe0, 0x01, 0x00, 0xe2, 0x01, 0x10, 0xa8, 0xe2, 0x01, 0x22, 0xa8, 0xa7, 0xe5,
+  0x01, 0x31, 0xab, 0xa6, 0xa7, 0xbe, 0x03, 0x41, 0xa7, 0xa7, 0xa8, 0xa7, 0xdf, 0x01, 0x31, 0xa9, 0xa9, 0xa9, 0xbf, 0x03, 0x00, 0xdd, 0x01, 0x31,
+  0x9c, 0x9e, 0x9e, 0x4f, 0x00, 0x02, 0xe1, 0x01, 0x01, 0x22, 0x04, 0x00, 0x21, 0x04, 0x01, 0xdf, 0x01, 0x60, 0x12, 0x1c, 0x1c, 0x1c, 0x23, 0x1c,
+  0x98, 0x00, 0x01, 0xa3, 0x00, 0x03, 0xa5, 0x00, 0x01, 0xd0, 0x00, 0x01, 0x03, 0x00, 0x00, 0xd8, 0x00, 0x00, 0xc8, 0x02, 0x01, 0x02, 0x00, 0x00,
+  0xff, 0x00, 0x02, 0x15, 0x01, 0x00, 0x3c, 0x01, 0x00, 0x47, 0x01, 0x00, 0x8b, 0x03, 0x01, 0xbb, 0x01, 0x00, 0x66, 0x01, 0x02, 0x01, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x3e, 0x05, 0x00, 0x0c, 0x00, 0x01, 0x0b, 0x00, 0x01, 0x0d, 0x00, 0x01, 0x02, 0x00, 0x03, 0x01, 0x00, 0x00, 0x33, 0x00, 0x00,
+  0xdc, 0x01, 0x60, 0x51, 0x50, 0x51, 0x4d, 0x51, 0x4f, 0x90, 0x05, 0x91, 0x4f, 0x4f, 0x4e, 0x4f, 0x4e, 0x4d, 0x4e, 0x4c, 0x4c, 0x03, 0x00, 0x30,
+  0x4b, 0x4c, 0x4a, 0x02, 0x00, 0x20, 0x49, 0x47, 0xcc, 0x01, 0x00, 0x37, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x31, 0x47, 0x47, 0x4a, 0x07,
+  0x00, 0x00, 0x09, 0x00, 0x03, 0x13, 0x00, 0x21, 0x42, 0x42, 0x2a, 0x00, 0x01, 0x56, 0x00, 0x00, 0x13, 0x00, 0x00, 0x91, 0x00, 0x00, 0x98, 0x00,
+  0x61, 0x38, 0x40, 0x3c, 0x42, 0x4a, 0x47, 0xe1, 0x01, 0x00, 0xd0, 0x03, 0x30, 0x40, 0x42, 0x42, 0x0b, 0x00, 0x01, 0x01, 0x00, 0x02, 0xd2, 0x03,
+  0x01, 0xb2, 0x03, 0x02, 0x09, 0x00, 0x00, 0xdc, 0x01, 0x02, 0x0b, 0x00, 0x01, 0x02, 0x00, 0x02, 0x10, 0x00, 0x40, 0x2a, 0x30, 0x30, 0x2a, 0xdb,
+  0x01, 0x00, 0x02, 0x00, 0x01, 0xa7, 0x05, 0x11, 0x2b, 0xe8, 0x01, 0x01, 0x1e, 0x01, 0x02, 0xe1, 0x01, 0x00, 0x1d, 0x01, 0x00, 0xe8, 0x01, 0x01,
+  0x28, 0x01, 0x00, 0x10, 0x03, 0x01, 0x1b, 0x00, 0x00, 0xe2, 0x01, 0x20, 0x1c, 0x23, 0xe2, 0x01, 0x01, 0x01, 0x00, 0x30, 0x12, 0x1c, 0x1c, 0xdd,
+  0x01, 0x00, 0xdf, 0x01, 0x10, 0x9f, 0x92, 0x05, 0x05, 0x94, 0x05, 0x01, 0xe7, 0x01, 0x04, 0xe2, 0x01, 0x23, 0x96, 0xb5, 0xba, 0x03, 0x32, 0xa8,
+  0x84, 0xab, 0xa0, 0x03, 0x41, 0xa8, 0xa9, 0xa8, 0x84, 0xce, 0x01, 0x00, 0x04, 0x00, 0x00, 0xe7, 0x01, 0x01, 0x16, 0x00, 0x02, 0x02, 0x00, 0x00,
+  0x29, 0x00, 0x10, 0xa9, 0x36, 0x00, 0x02, 0xbc, 0x03, 0x04, 0x02, 0x00, 0x00, 0xb6, 0x03, 0x03, 0xe1, 0x01, 0x08, 0x02, 0x00, 0x02, 0xc4, 0x03,
+  0x10, 0x23, 0x02, 0x00, 0x00, 0x4e, 0x06, 0x00, 0x05, 0x00, 0x01, 0xa9, 0x00, 0x01, 0xc4, 0x00, 0x02, 0xbf, 0x00, 0x00, 0xda, 0x00, 0x11, 0x2b,
+  0xaf, 0x04, 0x10, 0x2a, 0x09, 0x01, 0x00, 0x25, 0x01, 0x04, 0x01, 0x00, 0x02, 0xe7, 0x01, 0x00, 0xb3, 0x01, 0x00, 0x8a, 0x01, 0x00, 0xd1, 0x01,
+  0x02, 0x08, 0x00, 0x04, 0x0b, 0x00, 0x04, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x19, 0x00, 0x00, 0xaf, 0x01, 0x00, 0xa3, 0x01, 0x10, 0x50, 0xe0,
+  0x01, 0x00, 0x9a, 0x05, 0x00, 0xc2, 0x03, 0x20, 0x51, 0x4c, 0x0a, 0x00, 0x00, 0x83, 0x07, 0x30, 0x4d, 0x4f, 0x4f, 0x78, 0x07, 0x00, 0xac, 0x05,
+  0x40, 0x4e, 0x4c, 0x4f, 0x4b, 0x82, 0x07, 0x23, 0x47, 0x49, 0xcd, 0x01, 0x00, 0x17, 0x02, 0x00, 0x08, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x5b, 0x00,
+  0x00, 0x08, 0x00, 0x01, 0x20, 0x00, 0x01, 0x8c, 0x00, 0x00, 0xdf, 0x01, 0x60, 0x38, 0x40, 0x38, 0x42, 0x42, 0x47, 0x9f, 0x00, 0x31, 0x38, 0x40,
+  0x47, 0xfc, 0x01, 0x21, 0x3c, 0x40, 0xdb, 0x01, 0x04, 0x01, 0x00, 0x00, 0xba, 0x05, 0x00, 0xb2, 0x03, 0x00, 0x02, 0x00, 0x11, 0x33, 0x7a, 0x07,
+  0x00, 0x0b, 0x00, 0x01, 0x05, 0x00, 0x00, 0xb4, 0x03, 0x00, 0x9f, 0x06, 0x00, 0xdb, 0x01, 0x11, 0x33, 0xd8, 0x01, 0x01, 0xfc, 0x00, 0x20, 0x33,
+  0x33, 0x0d, 0x00, 0x00, 0x04, 0x03, 0x00, 0x05, 0x00, 0x00, 0x17, 0x01, 0x00, 0x0c, 0x00, 0x00, 0x08, 0x00, 0x04, 0x2f, 0x01, 0x00, 0xdf, 0x01,
+  0x00, 0x05, 0x00, 0x01, 0x4a, 0x01, 0x22, 0x23, 0x1c, 0xc9, 0x03, 0x00, 0x61, 0x01, 0x00, 0x63, 0x01, 0x02, 0x7d, 0x01, 0x04, 0xe1, 0x01, 0x01,
+  0x38, 0x07, 0x01, 0xdb, 0x01, 0x20, 0xa9, 0x96, 0x8a, 0x03, 0x00, 0xb3, 0x01, 0x00, 0xd7, 0x01, 0x00, 0xd1, 0x01, 0x01, 0xd6, 0x01, 0x40, 0xa7,
+  0xab, 0xa6, 0xab, 0x72, 0x07, 0x21, 0xa6, 0xab, 0xe1, 0x01, 0xe1, 0xa8, 0x84, 0xb3, 0xa9, 0xa9, 0xb3, 0xa9, 0xb3, 0xa9, 0xa9, 0xac, 0xa9, 0xa9,
+  0xa9, 0xba, 0x03, 0x02, 0xde, 0x01, 0x00, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0xcb, 0x01, 0x01, 0xe1, 0x01, 0x00, 0x06, 0x00, 0x01, 0x02, 0x00,
+  0x00, 0xc4, 0x03, 0x10, 0x12, 0xc0, 0x03, 0x00, 0x7e, 0x00, 0x00, 0xc5, 0x03, 0x02, 0x97, 0x00, 0x03, 0x01, 0x00, 0x03, 0xab, 0x00, 0x00, 0xbf,
+  0x00, 0x00, 0xe2, 0x00, 0x00, 0x6b, 0x08, 0x00, 0xe3, 0x00, 0x02, 0x03, 0x00, 0x00, 0x21, 0x01, 0x00, 0x0b, 0x01, 0x05, 0x31, 0x01, 0x00, 0x53,
+  0x01, 0x00, 0x58, 0x01, 0x20, 0x40, 0x3c, 0x66, 0x01, 0x00, 0x01, 0x00, 0x00, 0xca, 0x01, 0x00, 0xd9, 0x01, 0x03, 0xd8, 0x01, 0x00, 0x03, 0x00,
+  0x02, 0x01, 0x00, 0x01, 0x09, 0x00, 0x60, 0x42, 0x51, 0x51, 0x4d, 0x51, 0x4d, 0xdb, 0x01, 0x01, 0xd7, 0x01, 0x10, 0x4f, 0xda, 0x01, 0x00, 0x02,
+  0x00, 0x03, 0x03, 0x00, 0x40, 0x4f, 0x4c, 0x4f, 0x4d, 0xe9, 0x01, 0x12, 0x4f, 0xcf, 0x03, 0x00, 0xbc, 0x05, 0x01, 0xd3, 0x03, 0x01, 0x9a, 0x07,
+  0x01, 0x01, 0x00, 0x00, 0x63, 0x00, 0x00, 0x01, 0x00, 0x00, 0x6f, 0x00, 0x05, 0x10, 0x00, 0x00, 0x0d, 0x00, 0x11, 0x3c, 0x8b, 0x00, 0x00, 0x94,
+  0x00, 0x00, 0x01, 0x00, 0x10, 0x33, 0xe8, 0x01, 0x00, 0x20, 0x00, 0x23, 0x4a, 0x47, 0xc1, 0x03, 0x00, 0xc9, 0x01, 0x01, 0x02, 0x00, 0x00, 0xa9,
+  0x02, 0x01, 0x98, 0x07, 0x00, 0x16, 0x00, 0x02, 0x0a, 0x00, 0x01, 0xdd, 0x00, 0x00, 0x02, 0x00, 0x00, 0xd2, 0x02, 0x00, 0xbf, 0x03, 0x00, 0xf9,
+  0x00, 0x00, 0xa3, 0x05, 0x00, 0x02, 0x00, 0x01, 0x1c, 0x00, 0x21, 0x2b, 0x30, 0xae, 0x03, 0x00, 0x12, 0x01, 0x01, 0xb0, 0x03, 0x02, 0x29, 0x01,
+  0x01, 0x01, 0x00, 0x00, 0x2e, 0x01, 0x00, 0x05, 0x00, 0x10, 0x2b, 0x35, 0x01, 0x01, 0xdf, 0x01, 0x12, 0x23, 0x5d, 0x01, 0x00, 0x02, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x74, 0x01, 0x20, 0xa0, 0x12, 0x67, 0x03, 0x00, 0x95, 0x01, 0x10, 0x9c, 0xb9, 0x03, 0xf1, 0x00, 0x9e, 0x96, 0xb5, 0x96, 0xac,
+  0xa9, 0xac, 0xa9, 0x96, 0xa9, 0xac, 0xa9, 0xb3, 0x84, 0xb3, 0x73, 0x07, 0x02, 0x53, 0x09, 0x02, 0x06, 0x00, 0x00, 0xe5, 0x01, 0x00, 0xf0, 0x01,
+  0x00, 0xfa, 0x01, 0x00, 0xba, 0x03, 0x10, 0x84, 0xdc, 0x01, 0x01, 0xde, 0x01, 0x21, 0x9e, 0x96, 0x45, 0x00, 0x00, 0x99, 0x05, 0x00, 0x59, 0x09,
+  0x10, 0xa0, 0x5b, 0x00, 0x07, 0x02, 0x00, 0x04, 0x59, 0x02, 0x04, 0x01, 0x00, 0x00, 0x2c, 0x06, 0x00, 0x70, 0x02, 0x01, 0x97, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0xae, 0x00, 0x01, 0xc9, 0x00, 0x00, 0xcb, 0x00, 0x03, 0xda, 0x00, 0x02, 0xe6, 0x00, 0x00, 0xe9, 0x00, 0x00, 0xad, 0x06, 0x12, 0x38,
+  0xff, 0x02, 0x00, 0x1a, 0x01, 0x00, 0x21, 0x01, 0x01, 0x01, 0x00, 0x01, 0x58, 0x01, 0x04, 0x9d, 0x07, 0x01, 0xd7, 0x01, 0x00, 0x7b, 0x01, 0x05,
+  0x05, 0x00, 0x07, 0x01, 0x00, 0x01, 0xc0, 0x03, 0x10, 0x50, 0xe1, 0x01, 0x41, 0x4f, 0x4d, 0x4f, 0x50, 0xdc, 0x01, 0x02, 0x02, 0x00, 0x04, 0xd9,
+  0x01, 0x03, 0x02, 0x00, 0x40, 0x4f, 0x4c, 0x4c, 0x4d, 0xb6, 0x05, 0x0d, 0x01, 0x00, 0x00, 0x8b, 0x07, 0x00, 0x02, 0x00, 0x10, 0x47, 0x5a, 0x0b,
+  0x10, 0x4c, 0xa3, 0x03, 0x00, 0xa5, 0x03, 0x16, 0x47, 0xdc, 0x01, 0x00, 0xa1, 0x00, 0x01, 0xe0, 0x01, 0x10, 0x33, 0xd4, 0x03, 0x30, 0x47, 0x42,
+  0x38, 0xba, 0x00, 0x01, 0xb7, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x11, 0x33, 0x04, 0x00, 0x00, 0xd1, 0x00, 0x00, 0xdf, 0x01, 0x03, 0x02, 0x00, 0x02,
+  0xef, 0x00, 0x01, 0xf9, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x01, 0x00, 0x01, 0xdd, 0x01, 0x00, 0x93, 0x05, 0x02, 0xd2, 0x01, 0x00,
+  0x03, 0x00, 0x02, 0x01, 0x00, 0x02, 0xc4, 0x03, 0x00, 0x0f, 0x00, 0x40, 0x2b, 0x2a, 0x2b, 0x23, 0x58, 0x01, 0x01, 0x67, 0x01, 0x11, 0xa0, 0x6b,
+  0x01, 0x00, 0x02, 0x00, 0x01, 0x7c, 0x01, 0x20, 0x12, 0xa0, 0x98, 0x01, 0x10, 0x9e, 0xdc, 0x01, 0x00, 0x74, 0x07, 0x10, 0x90, 0x2a, 0x09, 0x20,
+  0xac, 0x96, 0x97, 0x03, 0x21, 0xb3, 0xa9, 0xc1, 0x03, 0x11, 0xab, 0x6c, 0x07, 0x33, 0xab, 0xa6, 0xaf, 0x0a, 0x00, 0x10, 0xa7, 0xbd, 0x03, 0x01,
+  0x52, 0x0b, 0x22, 0xa8, 0xa8, 0x9d, 0x05, 0x01, 0xe3, 0x01, 0x20, 0x96, 0x9e, 0xe3, 0x01, 0x30, 0x9e, 0x9e, 0xa0, 0x4d, 0x00, 0x21, 0x12, 0x9e,
+  0x5a, 0x00, 0x00, 0x02, 0x00, 0x01, 0x6a, 0x00, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x52, 0x04, 0x00, 0xa7, 0x00, 0x01, 0x01, 0x00, 0x00, 0xa6, 0x00,
+  0x00, 0xae, 0x00, 0x02, 0xe6, 0x01, 0x21, 0x33, 0x2a, 0xd7, 0x00, 0x00, 0xde, 0x00, 0x00, 0x01, 0x00, 0x01, 0xdb, 0x01, 0x05, 0x18, 0x01, 0x05,
+  0x02, 0x00, 0x00, 0x01, 0x00, 0x42, 0x33, 0x38, 0x38, 0x3c, 0x02, 0x00, 0x20, 0x40, 0x3c, 0xe5, 0x01, 0x05, 0x01, 0x00, 0x01, 0xe4, 0x01, 0x00,
+  0x83, 0x01, 0x01, 0x01, 0x00, 0x01, 0xc0, 0x03, 0x01, 0xa1, 0x05, 0x03, 0x02, 0x00, 0x13, 0x4c, 0xb3, 0x03, 0x10, 0x4d, 0x88, 0x07, 0x00, 0x09,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x16, 0x00, 0x00, 0x14, 0x00, 0x01, 0x06, 0x00, 0x06, 0x02, 0x00, 0x08, 0xf1, 0x01, 0x10, 0x4b, 0x0e, 0x00, 0x30,
+  0x4b, 0x4c, 0x4b, 0xed, 0x01, 0x30, 0x4c, 0x4b, 0x49, 0xa6, 0x03, 0x01, 0xa4, 0x01, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0e, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x38, 0x0a, 0x00, 0xb4, 0x01, 0x00, 0x02, 0x00, 0x00, 0xae, 0x00, 0x01, 0xbe, 0x00, 0x07, 0xc1, 0x00, 0x05, 0x01, 0x00, 0x02,
+  0xcf, 0x01, 0x00, 0x26, 0x00, 0x01, 0x16, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x04, 0x3c, 0x00, 0x00, 0x91, 0x05, 0x40, 0x2a, 0x23, 0x23,
+  0x2b, 0x21, 0x01, 0x0f, 0x01, 0x00, 0x03, 0x00, 0x4d, 0x01, 0x12, 0x1c, 0x05, 0x0d, 0x07, 0x02, 0x00, 0x01, 0xba, 0x03, 0x02, 0xc7, 0x0c, 0x00,
+  0x01, 0x00, 0x00, 0x83, 0x03, 0x00, 0xbf, 0x03, 0x00, 0xc0, 0x03, 0x00, 0xdf, 0x01, 0x10, 0xac, 0x7f, 0x05, 0x01, 0xa2, 0x05, 0x01, 0x04, 0x00,
+  0x00, 0xd8, 0x01, 0x00, 0x55, 0x09, 0x10, 0xab, 0xaf, 0x05, 0x00, 0x8f, 0x07, 0x00, 0x01, 0x00, 0x20, 0x84, 0xb3, 0xc2, 0x03, 0x11, 0xa9, 0x3d,
+  0x0b, 0x10, 0xb5, 0x41, 0x00, 0x00, 0xe2, 0x01, 0x02, 0x02, 0x00, 0x00, 0x57, 0x00, 0x01, 0x63, 0x00, 0x02, 0x02, 0x00, 0x00, 0x80, 0x00, 0x02,
+  0xe7, 0x01, 0x02, 0xc8, 0x0b, 0x02, 0xa5, 0x05, 0x11, 0x19, 0xe2, 0x01, 0x06, 0xe5, 0x01, 0x00, 0xc6, 0x00, 0x02, 0xdf, 0x01, 0x00, 0x99, 0x04,
+  0x00, 0x04, 0x00, 0x42, 0x33, 0x33, 0x33, 0x2b, 0xf4, 0x00, 0x01, 0xf7, 0x00, 0x00, 0xde, 0x04, 0x01, 0x0f, 0x00, 0x00, 0xd8, 0x01, 0x02, 0x01,
+  0x00, 0x20, 0x33, 0x3c, 0x06, 0x00, 0x01, 0xc8, 0x03, 0x21, 0x40, 0x3c, 0xb0, 0x05, 0x00, 0xd0, 0x03, 0x00, 0x04, 0x00, 0x01, 0x3e, 0x07, 0x03,
+  0xe3, 0x01, 0x30, 0x51, 0x4d, 0x4f, 0x3b, 0x0b, 0x02, 0x02, 0x00, 0x17, 0x4c, 0x05, 0x00, 0x11, 0x4e, 0xe6, 0x01, 0x00, 0xdf, 0x01, 0x01, 0x06,
+  0x00, 0x00, 0x09, 0x00, 0x01, 0xc6, 0x03, 0x01, 0x01, 0x00, 0x00, 0x13, 0x00, 0x01, 0x15, 0x00, 0x00, 0x02, 0x00, 0x01, 0xe5, 0x01, 0x01, 0x0e,
+  0x00, 0x00, 0x01, 0x00, 0x01, 0xe5, 0x01, 0x00, 0xd4, 0x03, 0x40, 0x47, 0x47, 0x40, 0x40, 0xd5, 0x01, 0x00, 0x22, 0x07, 0x20, 0x23, 0x2a, 0x98,
+  0x02, 0x05, 0x7b, 0x04, 0x00, 0xc1, 0x00, 0x02, 0x02, 0x00, 0x01, 0xad, 0x02, 0x00, 0xc9, 0x00, 0x01, 0x01, 0x00, 0x00, 0xbf, 0x00, 0x02, 0x03,
+  0x00, 0x00, 0x39, 0x00, 0x06, 0x01, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x11, 0x00, 0x01, 0x03, 0x00, 0x00, 0x05, 0x01, 0x05, 0x02, 0x00, 0x00, 0xe1,
+  0x01, 0x01, 0x01, 0x00, 0x10, 0x1c, 0x05, 0x03, 0x02, 0x01, 0x00, 0x02, 0x37, 0x01, 0x00, 0x53, 0x01, 0x00, 0x5c, 0x01, 0x00, 0x52, 0x09, 0x00,
+  0xd1, 0x01, 0x00, 0xd3, 0x01, 0x30, 0x9e, 0x9e, 0xa0, 0x95, 0x05, 0x02, 0x6b, 0x03, 0x10, 0xa0, 0x06, 0x00, 0x00, 0x9c, 0x01, 0x10, 0xb5, 0xc1,
+  0x03, 0x10, 0xac, 0x9b, 0x05, 0x00, 0xbd, 0x03, 0x01, 0xc0, 0x03, 0x20, 0x84, 0xb3, 0xc6, 0x01, 0x00, 0xe0, 0x01, 0x00, 0x01, 0x00, 0x02, 0x82,
+  0x07, 0x00, 0x02, 0x00, 0x00, 0xf3, 0x01, 0x03, 0x01, 0x00, 0x21, 0xa9, 0xac, 0xee, 0x03, 0x00, 0xa2, 0x05, 0x02, 0xc4, 0x07, 0x00, 0x50, 0x00,
+  0x26, 0xa0, 0xa0, 0xbf, 0x03, 0x01, 0xc1, 0x03, 0x07, 0x01, 0x00, 0x09, 0x0d, 0x00, 0x00, 0xc5, 0x03, 0x00, 0x04, 0x00, 0x01, 0xaa, 0x00, 0x00,
+  0x05, 0x00, 0x12, 0x23, 0xc0, 0x03, 0x02, 0xdd, 0x01, 0x71, 0x2b, 0x2a, 0x2b, 0x33, 0x2b, 0x33, 0x2a, 0x18, 0x01, 0x00, 0xc2, 0x01, 0x00, 0xce,
+  0x01, 0x00, 0x09, 0x00, 0x00, 0x0a, 0x01, 0x01, 0x02, 0x00, 0x00, 0xbf, 0x03, 0x11, 0x3c, 0xe3, 0x01, 0x02, 0x02, 0x00, 0x00, 0x2e, 0x05, 0x01,
+  0xe5, 0x01, 0x12, 0x3c, 0xe1, 0x01, 0x00, 0x01, 0x00, 0x00, 0x10, 0x0b, 0x52, 0x42, 0x47, 0x4d, 0x4f, 0x4d, 0xd0, 0x01, 0x00, 0x9e, 0x01, 0x00,
+  0x95, 0x05, 0x30, 0x4d, 0x4f, 0x4c, 0xab, 0x05, 0x00, 0xab, 0x01, 0x00, 0xcb, 0x03, 0x01, 0xc2, 0x01, 0x04, 0x02, 0x00, 0x01, 0x17, 0x00, 0x00,
+  0x04, 0x00, 0x02, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x04, 0x00, 0x04, 0x05, 0x00, 0x02, 0x02, 0x00, 0x31, 0x4c, 0x4c, 0x4c, 0xaf, 0x05, 0x00,
+  0x64, 0x00, 0x00, 0x61, 0x09, 0x21, 0x33, 0x30, 0xca, 0x0a, 0x10, 0x23, 0xff, 0x0b, 0x00, 0x7d, 0x03, 0x00, 0x9b, 0x02, 0x00, 0x01, 0x00, 0x01,
+  0xc7, 0x00, 0x00, 0xb6, 0x02, 0x00, 0x99, 0x01, 0x01, 0x0a, 0x00, 0x04, 0xeb, 0x01, 0x11, 0x30, 0x06, 0x00, 0x09, 0x01, 0x00, 0x01, 0xea, 0x03,
+  0x00, 0x01, 0x00, 0x01, 0x36, 0x00, 0x06, 0xe3, 0x01, 0x20, 0x33, 0x2b, 0xc0, 0x03, 0x04, 0xda, 0x01, 0x03, 0x2d, 0x01, 0x01, 0x3a, 0x01, 0x00,
+  0x03, 0x00, 0x01, 0x63, 0x01, 0x00, 0x6a, 0x01, 0x02, 0xe1, 0x01, 0x01, 0x55, 0x09, 0x00, 0x6a, 0x03, 0x00, 0xc3, 0x0c, 0x01, 0x0b, 0x00, 0x04,
+  0x9d, 0x05, 0x00, 0xaa, 0x01, 0x00, 0xba, 0x03, 0x01, 0xc1, 0x03, 0x01, 0xdf, 0x01, 0x01, 0xa3, 0x05, 0x00, 0xe1, 0x01, 0x00, 0xe3, 0x01, 0x01,
+  0xdb, 0x01, 0x00, 0xa0, 0x05, 0x01, 0xb5, 0x05, 0x00, 0xc7, 0x03, 0x01, 0x9f, 0x05, 0x00, 0xdf, 0x01, 0x00, 0x43, 0x00, 0x01, 0x02, 0x00, 0x00,
+  0xbc, 0x03, 0x51, 0xa0, 0x9c, 0xa0, 0x9f, 0xa0, 0xb4, 0x03, 0x40, 0x1c, 0xa0, 0x1c, 0xa0, 0x07, 0x00, 0x00, 0xc3, 0x01, 0x00, 0x93, 0x00, 0x04,
+  0x95, 0x00, 0x01, 0x01, 0x00, 0x00, 0x08, 0x00, 0x01, 0x16, 0x00, 0x00, 0x06, 0x00, 0x00, 0x08, 0x00, 0x02, 0x01, 0x00, 0x00, 0x09, 0x01, 0x05,
+  0xdc, 0x00, 0x20, 0x23, 0x33, 0x11, 0x01, 0x00, 0x5a, 0x09, 0x00, 0xda, 0x01, 0x00, 0x03, 0x00, 0x00, 0x02, 0x01, 0x01, 0xd9, 0x01, 0x01, 0x02,
+  0x00, 0x50, 0x3c, 0x33, 0x38, 0x38, 0x36, 0xf9, 0x01, 0x02, 0x01, 0x00, 0x01, 0xe5, 0x01, 0x20, 0x3c, 0x42, 0xdf, 0x01, 0x00, 0xaf, 0x05, 0x13,
+  0x3c, 0xc9, 0x03, 0x20, 0x42, 0x42, 0x92, 0x01, 0x11, 0x4d, 0xb9, 0x01, 0x00, 0x0a, 0x00, 0x00, 0x03, 0x00, 0x08, 0xd3, 0x01, 0x00, 0x03, 0x00,
+  0x01, 0xbb, 0x01, 0x01, 0x04, 0x00, 0x01, 0x12, 0x00, 0x04, 0x0b, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x02, 0x15, 0x00, 0x01, 0x38, 0x00,
+  0x01, 0x08, 0x00, 0x11, 0x4f, 0xd1, 0x03, 0x00, 0xe2, 0x01, 0x00, 0xcf, 0x12, 0x21, 0x33, 0x33, 0x7c, 0x01, 0x00, 0x51, 0x08, 0x31, 0x23, 0x23,
+  0x2b, 0x91, 0x01, 0x01, 0xbd, 0x01, 0x00, 0xa0, 0x02, 0x12, 0x2b, 0xae, 0x01, 0x00, 0xdc, 0x01, 0x03, 0x01, 0x00, 0x01, 0xda, 0x00, 0x00, 0x1d,
+  0x00, 0x00, 0x05, 0x02, 0x00, 0xef, 0x01, 0x00, 0x05, 0x00, 0x00, 0x27, 0x00, 0x02, 0xce, 0x02, 0x00, 0x18, 0x00, 0x00, 0x22, 0x00, 0x00, 0x15,
+  0x02, 0x11, 0x2a, 0x4d, 0x00, 0x00, 0xec, 0x02, 0x00, 0xdb, 0x04, 0x00, 0x3d, 0x00, 0x00, 0x07, 0x00, 0x01, 0xf5, 0x04, 0x01, 0x02, 0x00, 0x00,
+  0x42, 0x01, 0x01, 0x67, 0x01, 0x03, 0x39, 0x03, 0x32, 0xa0, 0x12, 0xa0, 0x01, 0x00, 0x00, 0xd5, 0x01, 0x0b, 0x01, 0x00, 0x30, 0xac, 0x9e, 0xb5,
+  0xe1, 0x01, 0x00, 0xc2, 0x03, 0x00, 0x03, 0x00, 0x25, 0xa9, 0xa9, 0xbe, 0x03, 0x00, 0x6d, 0x07, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x10, 0xb1,
+  0x09, 0x00, 0x01, 0x0e, 0x00, 0x00, 0xe1, 0x01, 0x01, 0x2a, 0x00, 0x01, 0x9d, 0x05, 0x05, 0x01, 0x00, 0x10, 0xa0, 0x1f, 0x04, 0x00, 0xc0, 0x03,
+  0x00, 0x70, 0x00, 0x10, 0x1c, 0xb8, 0x01, 0x00, 0x8a, 0x00, 0x70, 0x24, 0x23, 0x23, 0x23, 0x24, 0x23, 0x24, 0xa4, 0x00, 0x10, 0x24, 0xa5, 0x00,
+  0x01, 0x0f, 0x00, 0x09, 0x01, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x01, 0x00, 0x01, 0xd6, 0x00, 0x20, 0x2a, 0x33, 0xd9, 0x00, 0x01, 0x05, 0x01, 0x01,
+  0x29, 0x01, 0x01, 0x01, 0x00, 0x00, 0xd1, 0x01, 0x01, 0xbd, 0x03, 0x00, 0x0c, 0x00, 0x01, 0xe3, 0x01, 0x01, 0x03, 0x00, 0x00, 0xe2, 0x01, 0x30,
+  0x36, 0x38, 0x3c, 0x10, 0x00, 0x01, 0xe3, 0x01, 0x00, 0xe6, 0x01, 0x10, 0x40, 0xd8, 0x0a, 0x00, 0xad, 0x05, 0x00, 0xe2, 0x01, 0x30, 0x3c, 0x40,
+  0x3c, 0xdd, 0x01, 0x30, 0x4c, 0x4d, 0x4e, 0xe2, 0x01, 0x10, 0x4d, 0x9f, 0x01, 0x00, 0x04, 0x00, 0x01, 0x09, 0x00, 0x00, 0x0b, 0x00, 0x01, 0x07,
+  0x00, 0x00, 0x02, 0x00, 0x01, 0x05, 0x00, 0x03, 0x12, 0x00, 0x01, 0x01, 0x00, 0x01, 0x07, 0x00, 0x01, 0x18, 0x00, 0x00, 0x01, 0x00, 0x01, 0x06,
+  0x00, 0x00, 0x21, 0x00, 0x03, 0x09, 0x00, 0x00, 0xa6, 0x05, 0x04, 0xe5, 0x01, 0x10, 0x42, 0x8b, 0x00, 0x00, 0xe5, 0x01, 0x00, 0x8b, 0x01, 0x00,
+  0x01, 0x00, 0x00, 0xc6, 0x00, 0x00, 0xe7, 0x01, 0x90, 0x2a, 0x33, 0x38, 0x42, 0x42, 0x3c, 0x33, 0x33, 0x2b, 0x01, 0x00, 0x00, 0x03, 0x01, 0x30,
+  0x2b, 0x23, 0x24, 0xae, 0x01, 0x00, 0x1d, 0x00, 0x01, 0x02, 0x00, 0x02, 0xe4, 0x00, 0x00, 0xef, 0x00, 0x00, 0x15, 0x02, 0x00, 0x08, 0x00, 0x01,
+  0x07, 0x00, 0x00, 0x15, 0x02, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x01, 0x5b, 0x00, 0x10, 0x24, 0x26, 0x01, 0x02, 0x60, 0x00,
+  0x00, 0x40, 0x01, 0x00, 0x59, 0x01, 0x30, 0x23, 0x23, 0x24, 0x67, 0x01, 0x04, 0x01, 0x00, 0x20, 0xa0, 0x1c, 0xdd, 0x01, 0x0f, 0xdf, 0x01, 0x01,
+  0x00, 0x7e, 0x03, 0x10, 0x96, 0xa5, 0x05, 0x00, 0xc2, 0x03, 0x01, 0x7e, 0x07, 0x02, 0xbc, 0x03, 0x30, 0xa7, 0xab, 0xab, 0xb9, 0x03, 0x71, 0xab,
+  0xa7, 0xa7, 0xab, 0xab, 0xa7, 0xb1, 0xe2, 0x01, 0x10, 0xb1, 0xbb, 0x03, 0x01, 0xdf, 0x01, 0x40, 0xb3, 0xa9, 0xa9, 0xa9, 0x16, 0x02, 0x06, 0xe1,
+  0x01, 0x00, 0x5d, 0x00, 0x00, 0x3f, 0x0b, 0x00, 0xc0, 0x03, 0x10, 0x2b, 0x81, 0x00, 0x12, 0x1c, 0xd7, 0x01, 0x01, 0x02, 0x00, 0x10, 0x2b, 0x06,
+  0x00, 0x00, 0xa2, 0x00, 0x00, 0xed, 0x00, 0x30, 0x2b, 0x2b, 0x24, 0x0f, 0x00, 0x00, 0x02, 0x00, 0x00, 0x23, 0x00, 0x00, 0x2b, 0x00, 0x12, 0x23,
+  0xfc, 0x00, 0x00, 0x25, 0x01, 0x11, 0x30, 0xe7, 0x00, 0x00, 0xd0, 0x02, 0x11, 0x42, 0xb3, 0x01, 0x03, 0xd1, 0x01, 0x00, 0x0e, 0x01, 0x00, 0x01,
+  0x00, 0x00, 0xcc, 0x01, 0x41, 0x33, 0x38, 0x3c, 0x33, 0x02, 0x00, 0x00, 0xdd, 0x01, 0x01, 0xe9, 0x01, 0x00, 0x0a, 0x00, 0x00, 0x02, 0x00, 0x10,
+  0x33, 0xa4, 0x05, 0x05, 0x02, 0x00, 0x32, 0x42, 0x3c, 0x42, 0x8f, 0x01, 0x07, 0x05, 0x00, 0x00, 0x07, 0x00, 0x01, 0x09, 0x00, 0x06, 0x05, 0x00,
+  0x05, 0x01, 0x00, 0x00, 0xe7, 0x03, 0x01, 0x01, 0x00, 0x01, 0x09, 0x00, 0x00, 0xe9, 0x03, 0x00, 0x03, 0x00, 0x0f, 0x01, 0x00, 0x0c, 0x00, 0x72,
+  0x09, 0x21, 0x47, 0x42, 0x89, 0x00, 0x01, 0xc2, 0x00, 0x00, 0x82, 0x01, 0x00, 0x01, 0x00, 0x30, 0x1c, 0x23, 0x33, 0x1a, 0x00, 0x11, 0x33, 0x14,
+  0x00, 0x00, 0xea, 0x00, 0x03, 0xfc, 0x00, 0x00, 0xdd, 0x00, 0x30, 0x2b, 0x30, 0x2b, 0xad, 0x00, 0x02, 0x01, 0x00, 0x20, 0x2b, 0x33, 0x1a, 0x00,
+  0x00, 0x16, 0x00, 0x20, 0x2b, 0x2b, 0xc3, 0x05, 0x30, 0x2a, 0x2b, 0x24, 0xeb, 0x01, 0x00, 0x15, 0x00, 0x00, 0xe4, 0x01, 0x01, 0x36, 0x01, 0x10,
+  0x23, 0x4e, 0x01, 0x02, 0xd9, 0x01, 0x10, 0x1c, 0x34, 0x03, 0x05, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x2c, 0x05, 0x01, 0xdf, 0x01, 0x01, 0x01,
+  0x00, 0x00, 0x8c, 0x01, 0x0e, 0x01, 0x00, 0x00, 0xe0, 0x01, 0x01, 0x65, 0x09, 0x00, 0x3e, 0x0b, 0x07, 0xc0, 0x03, 0x20, 0xb1, 0xa7, 0xdc, 0x01,
+  0x00, 0x81, 0x07, 0x01, 0x47, 0x0b, 0x01, 0xe0, 0x01, 0x30, 0xa8, 0xa8, 0xa8, 0x22, 0x00, 0x00, 0x04, 0x0f, 0x0b, 0xe1, 0x01, 0x10, 0xa0, 0xe1,
+  0x01, 0x00, 0x7a, 0x00, 0x00, 0x94, 0x00, 0x23, 0x24, 0x2a, 0xdf, 0x01, 0x03, 0xad, 0x00, 0x00, 0x01, 0x00, 0x01, 0x08, 0x00, 0x00, 0xaf, 0x00,
+  0x00, 0xd9, 0x01, 0x02, 0x02, 0x00, 0x02, 0xb4, 0x00, 0x00, 0xe2, 0x01, 0x01, 0x36, 0x00, 0x00, 0xd5, 0x00, 0x00, 0xec, 0x00, 0x30, 0x33, 0x33,
+  0x33, 0x93, 0x0c, 0x00, 0x02, 0x00, 0x03, 0x0a, 0x01, 0x02, 0x06, 0x00, 0x00, 0xdf, 0x01, 0x13, 0x36, 0xe6, 0x01, 0x00, 0xfe, 0x01, 0x10, 0x36,
+  0x06, 0x00, 0x00, 0x06, 0x02, 0x00, 0x04, 0x00, 0x00, 0x15, 0x00, 0x00, 0x0e, 0x00, 0x01, 0xc9, 0x03, 0x10, 0x42, 0x02, 0x00, 0x00, 0x82, 0x01,
+  0x0f, 0x01, 0x00, 0x1f, 0x02, 0xa8, 0x07, 0x0c, 0x01, 0x00, 0x02, 0x12, 0x00, 0x02, 0x06, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x42, 0x0d, 0x20, 0x4a,
+  0x49, 0x91, 0x02, 0x20, 0x38, 0x33, 0x8d, 0x01, 0x01, 0x01, 0x00, 0x56, 0x23, 0x2b, 0x33, 0x38, 0x33, 0x65, 0x03, 0x05, 0x0a, 0x00, 0x60, 0x24,
+  0x1c, 0x23, 0x24, 0x2a, 0x24, 0xaa, 0x04, 0x00, 0xd0, 0x00, 0x00, 0xd7, 0x01, 0x20, 0x2b, 0x33, 0xb3, 0x02, 0x00, 0xe5, 0x01, 0x00, 0xae, 0x05,
+  0x32, 0x2b, 0x2a, 0x24, 0x26, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x2d, 0x01, 0x00, 0xac, 0x03, 0x01, 0x55, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x34, 0x01, 0x04, 0x0c, 0x00, 0x11, 0x1c, 0xda, 0x01, 0x01, 0x05, 0x00, 0x03, 0x01, 0x00, 0x00, 0x8d, 0x01, 0x0c, 0x01, 0x00, 0x20, 0x96,
+  0xb5, 0x04, 0x00, 0x00, 0xe1, 0x01, 0x31, 0xac, 0xa9, 0xac, 0xbf, 0x01, 0x03, 0x01, 0x00, 0x20, 0xab, 0xab, 0xb9, 0x03, 0x32, 0xab, 0xa7, 0xab,
+  0x64, 0x09, 0x00, 0xd8, 0x01, 0x00, 0x17, 0x00, 0x01, 0x08, 0x00, 0x00, 0x84, 0x07, 0x10, 0xac, 0xff, 0x03, 0x00, 0x01, 0x00, 0x02, 0xc0, 0x03,
+  0x00, 0x6a, 0x00, 0x01, 0xb9, 0x03, 0x01, 0x6f, 0x02, 0x00, 0xe1, 0x01, 0x10, 0x24, 0xab, 0x00, 0x00, 0xa2, 0x04, 0x00, 0x08, 0x00, 0x01, 0xb9,
+  0x03, 0x00, 0x18, 0x00, 0x03, 0x1f, 0x00, 0x04, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x04, 0x00, 0x00, 0xe4, 0x01, 0x00, 0x24, 0x00, 0x00, 0x01,
+  0x00, 0x10, 0x33, 0xa0, 0x01, 0x00, 0xfc, 0x0c, 0x01, 0xda, 0x01, 0x00, 0x04, 0x00, 0x02, 0x06, 0x00, 0x10, 0x38, 0xdf, 0x01, 0x11, 0x33, 0x9a,
+  0x05, 0x01, 0x02, 0x00, 0x00, 0x8e, 0x07, 0x00, 0x0e, 0x03, 0x00, 0x0b, 0x00, 0x20, 0x3c, 0x40, 0x0b, 0x00, 0x01, 0xdf, 0x01, 0x00, 0x02, 0x00,
+  0x20, 0x42, 0x3c, 0x7d, 0x01, 0x0f, 0x01, 0x00, 0x18, 0x07, 0xbd, 0x01, 0x01, 0x70, 0x07, 0x02, 0x01, 0x00, 0x07, 0x16, 0x00, 0x0f, 0x01, 0x00,
+  0x0a, 0x00, 0xb0, 0x03, 0x10, 0x49, 0x94, 0x05, 0x00, 0xb4, 0x01, 0x01, 0xb9, 0x02, 0x11, 0x24, 0xfc, 0x08, 0x03, 0x02, 0x00, 0x04, 0x01, 0x00,
+  0x03, 0xc2, 0x06, 0x00, 0xe7, 0x01, 0x10, 0x2b, 0x22, 0x01, 0x00, 0xed, 0x00, 0x00, 0xd8, 0x01, 0x10, 0x33, 0x10, 0x02, 0x00, 0x01, 0x00, 0x00,
+  0xe8, 0x01, 0x01, 0x42, 0x00, 0x10, 0x33, 0x05, 0x00, 0x20, 0x2b, 0x2b, 0xd2, 0x01, 0x15, 0x24, 0xd3, 0x01, 0x04, 0xb9, 0x03, 0x01, 0x06, 0x00,
+  0x43, 0xa0, 0xa0, 0x1c, 0x1c, 0x79, 0x01, 0x03, 0x06, 0x00, 0x01, 0x09, 0x00, 0x03, 0xa9, 0x05, 0x04, 0x08, 0x00, 0x01, 0x01, 0x00, 0x04, 0xa6,
+  0x05, 0x00, 0xc5, 0x03, 0x72, 0xb3, 0xb3, 0xa8, 0xb3, 0xa8, 0xb3, 0xb3, 0xc0, 0x03, 0x00, 0x02, 0x00, 0x90, 0xb1, 0xa7, 0xa7, 0xab, 0xb1, 0xa6,
+  0xb1, 0xa7, 0xb1, 0xda, 0x01, 0x00, 0xdc, 0x01, 0x00, 0xbe, 0x03, 0x01, 0x02, 0x00, 0x30, 0xb5, 0x9e, 0xb5, 0x3e, 0x00, 0x01, 0x4d, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x5f, 0x0f, 0x00, 0x7b, 0x00, 0x00, 0xdf, 0x09, 0x02, 0x01, 0x00, 0x02, 0xba, 0x02, 0x20, 0x23, 0x24, 0xc0, 0x01, 0x00, 0xd1,
+  0x00, 0x00, 0x06, 0x00, 0x10, 0x24, 0x72, 0x04, 0x03, 0x05, 0x00, 0x01, 0x9d, 0x06, 0x00, 0xd2, 0x00, 0x03, 0x06, 0x00, 0x00, 0x01, 0x00, 0x02,
+  0xed, 0x00, 0x30, 0x3c, 0x38, 0x36, 0xf3, 0x00, 0x00, 0x04, 0x00, 0x10, 0x33, 0x69, 0x07, 0x00, 0xab, 0x05, 0x40, 0x38, 0x33, 0x33, 0x36, 0x10,
+  0x00, 0x00, 0xe2, 0x01, 0x00, 0xcf, 0x01, 0x20, 0x40, 0x36, 0x06, 0x00, 0x00, 0xdd, 0x01, 0x00, 0x06, 0x00, 0x02, 0x0c, 0x00, 0x21, 0x38, 0x3c,
+  0x0b, 0x00, 0x1f, 0x40, 0xe0, 0x01, 0x1d, 0x0f, 0x01, 0x00, 0x2f, 0x20, 0x49, 0x4c, 0xe4, 0x01, 0x51, 0x42, 0x42, 0x3c, 0x3c, 0x33, 0x7b, 0x10,
+  0x01, 0x12, 0x01, 0x10, 0xa0, 0xfa, 0x11, 0x20, 0xa0, 0x12, 0x23, 0x01, 0x00, 0x02, 0x00, 0x02, 0xec, 0x01, 0x01, 0xcb, 0x06, 0x00, 0x0f, 0x03,
+  0x20, 0x1c, 0x23, 0xf9, 0x00, 0x00, 0x03, 0x01, 0x03, 0xda, 0x01, 0x01, 0x05, 0x00, 0x01, 0x08, 0x00, 0x02, 0x0a, 0x00, 0x20, 0x1c, 0x1c, 0x21,
+  0x00, 0x00, 0xd9, 0x01, 0x01, 0xe4, 0x01, 0x00, 0x37, 0x01, 0x03, 0x01, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x01, 0x00, 0x00, 0x7f,
+  0x01, 0x01, 0x5e, 0x00, 0x00, 0xd5, 0x01, 0x07, 0xd8, 0x01, 0x05, 0x01, 0x00, 0x00, 0xaa, 0x01, 0x02, 0xe2, 0x01, 0x01, 0xa4, 0x05, 0x01, 0xa8,
+  0x03, 0x50, 0xa7, 0xb1, 0xa8, 0xa7, 0xb1, 0xbe, 0x03, 0x00, 0xea, 0x01, 0x00, 0x05, 0x00, 0x04, 0xe3, 0x01, 0x30, 0xb3, 0xa9, 0xc2, 0xdf, 0x01,
+  0x00, 0xa2, 0x05, 0x11, 0x9c, 0xe1, 0x01, 0x30, 0xa0, 0x9e, 0x1c, 0x5b, 0x00, 0x04, 0xd4, 0x01, 0x05, 0x01, 0x00, 0x0c, 0x11, 0x00, 0x73, 0x24,
+  0x23, 0x24, 0x1c, 0x24, 0x24, 0x24, 0xf5, 0x01, 0x01, 0xae, 0x00, 0x01, 0xdb, 0x03, 0x04, 0x01, 0x00, 0x01, 0xd3, 0x00, 0x00, 0x05, 0x00, 0x00,
+  0xc4, 0x01, 0x03, 0xdb, 0x01, 0x00, 0x08, 0x00, 0x00, 0x4c, 0x09, 0x0a, 0x02, 0x00, 0x00, 0xd1, 0x01, 0x10, 0x3c, 0xc9, 0x01, 0x61, 0x3c, 0x40,
+  0x3c, 0x3c, 0x3c, 0x42, 0x0b, 0x00, 0x01, 0xdf, 0x01, 0xb0, 0x36, 0x38, 0x3c, 0x3c, 0x38, 0x3c, 0x3c, 0x3c, 0x42, 0x3c, 0x3c, 0x1f, 0x4c, 0x01,
+  0x00, 0x5f, 0xff, 0x0e, 0x4e, 0x49, 0x4c, 0x4c, 0x49, 0x4c, 0x49, 0x49, 0x49, 0x47, 0x49, 0x42, 0x3c, 0x2b, 0x2b, 0x23, 0x2b, 0x23, 0x24, 0x23,
+  0x24, 0x23, 0xa0, 0x19, 0xa0, 0x1c, 0xa0, 0x12, 0xa0, 0x01, 0x00, 0x03, 0x12, 0x1c, 0x01, 0x00, 0x30, 0x24, 0x24, 0x2b, 0x03, 0x00, 0x13, 0x23,
+  0x04, 0x00, 0x20, 0x2b, 0x2b, 0x3e, 0x00, 0x13, 0x2b, 0x0d, 0x00, 0x00, 0x06, 0x00, 0x00, 0x09, 0x00, 0x60, 0x1c, 0xa0, 0x1c, 0x23, 0x24, 0x23,
+  0x2f, 0x00, 0x00, 0x01, 0x00, 0x50, 0xa0, 0xa0, 0x1c, 0xa0, 0x1c, 0x43, 0x00, 0x20, 0xa0, 0x9e, 0x04, 0x00, 0x03, 0x01, 0x00, 0x10, 0xb5, 0x05,
+  0x00, 0x70, 0x9e, 0x9e, 0xb6, 0x96, 0xb5, 0x96, 0xac, 0x09, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0d, 0x00, 0xf0, 0x14, 0xb5, 0xa9, 0xb5, 0x96, 0xac,
+  0xa9, 0xa9, 0xa8, 0xb3, 0xa9, 0xb3, 0xa9, 0xa9, 0xa8, 0xa8, 0xa8, 0xb3, 0xa7, 0xb1, 0xa8, 0xa8, 0xa8, 0xab, 0xab, 0xab, 0xab, 0xa7, 0xa8, 0xa7,
+  0xb1, 0xa7, 0xa7, 0xab, 0xa7, 0xab, 0x07, 0x00, 0xf3, 0x00, 0xb1, 0xa7, 0xb1, 0xa7, 0xa8, 0xa7, 0xa8, 0xb3, 0xb3, 0xac, 0xac, 0xac, 0xa9, 0xb5,
+  0x96, 0x4e, 0x00, 0x00, 0x6b, 0x00, 0x41, 0xa0, 0xa0, 0x1c, 0x24, 0x02, 0x00, 0x04, 0x01, 0x00, 0x31, 0x24, 0xa0, 0x1c, 0x0e, 0x00, 0x30, 0x24,
+  0x1c, 0x24, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x9d, 0x00, 0x00, 0xf2, 0x00, 0x22, 0x24, 0x24, 0x06, 0x00, 0x12, 0x23, 0xc5, 0x00, 0x01, 0x06,
+  0x00, 0x00, 0x01, 0x00, 0x10, 0x33, 0x05, 0x00, 0x00, 0x08, 0x00, 0x00, 0x01, 0x00, 0x52, 0x38, 0x36, 0x33, 0x33, 0x33, 0x0b, 0x00, 0x00, 0x0e,
+  0x00, 0x84, 0x33, 0x38, 0x33, 0x33, 0x36, 0x38, 0x33, 0x3c, 0x02, 0x00, 0x31, 0x3c, 0x3c, 0x38, 0x03, 0x00, 0x21, 0x3c, 0x40, 0x03, 0x00, 0x01,
+  0x01, 0x00, 0x10, 0x38, 0x11, 0x00, 0x00, 0x14, 0x00, 0x40, 0x42, 0x3c, 0x40, 0x3c, 0x71, 0x01, 0x0f, 0x01, 0x00, 0x34, 0x10, 0x4f, 0x05, 0x00,
+  0x0f, 0x01, 0x00, 0x1b, 0x01, 0xe7, 0x01, 0x00, 0xe9, 0x01, 0x20, 0x47, 0x42, 0xd8, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x24, 0x01, 0x06, 0xe8, 0x01,
+  0x01, 0x0e, 0x00, 0x03, 0x06, 0x00, 0x02, 0xe6, 0x01, 0x05, 0x27, 0x01, 0x02, 0x24, 0x01, 0x00, 0x15, 0x01, 0x03, 0x29, 0x01, 0x00, 0xfc, 0x01,
+  0x20, 0x2b, 0x2b, 0x3d, 0x01, 0x10, 0x2b, 0x25, 0x00, 0x12, 0x24, 0x4f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0xde, 0x01, 0x50, 0xb5,
+  0x9e, 0x96, 0x9e, 0xb5, 0xcb, 0x01, 0x20, 0x96, 0xac, 0x02, 0x00, 0x00, 0x07, 0x00, 0x10, 0xb5, 0xf0, 0x01, 0xd0, 0xb5, 0x9e, 0xb5, 0x96, 0xac,
+  0xac, 0xac, 0x96, 0xac, 0xac, 0xa9, 0xb3, 0xa8, 0xe1, 0x01, 0x00, 0x06, 0x00, 0xd0, 0xa8, 0xa8, 0xa7, 0xa8, 0xb1, 0xa7, 0xb1, 0xa6, 0xa7, 0xab,
+  0xab, 0xb1, 0xab, 0xdb, 0x01, 0x10, 0xb1, 0xe3, 0x01, 0x11, 0xab, 0xf6, 0x01, 0x10, 0xb3, 0x25, 0x00, 0x60, 0xa9, 0xa9, 0xac, 0xac, 0xb5, 0x96,
+  0x58, 0x00, 0x02, 0x41, 0x02, 0x00, 0xa5, 0x00, 0x20, 0x24, 0x24, 0xcd, 0x01, 0x01, 0x06, 0x00, 0x00, 0xd8, 0x01, 0x00, 0x13, 0x00, 0x00, 0xae,
+  0x00, 0x00, 0x02, 0x00, 0x00, 0x15, 0x00, 0x01, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x03, 0x05, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x99, 0x02, 0x10, 0x23,
+  0xad, 0x02, 0x00, 0x0e, 0x00, 0x21, 0x2b, 0x33, 0xe3, 0x01, 0x00, 0xd0, 0x01, 0x51, 0x33, 0x33, 0x36, 0x33, 0x3c, 0xe1, 0x01, 0x20, 0x36, 0x33,
+  0xe9, 0x01, 0x30, 0x36, 0x33, 0x36, 0xf1, 0x01, 0x00, 0x0d, 0x00, 0x01, 0x0b, 0x00, 0x43, 0x38, 0x3c, 0x33, 0x36, 0xcd, 0x01, 0x05, 0x01, 0x00,
+  0x00, 0x16, 0x00, 0x00, 0x12, 0x00, 0x02, 0x15, 0x00, 0x00, 0x66, 0x01, 0x0e, 0x9b, 0x01, 0x13, 0x4d, 0x04, 0x00, 0x0f, 0x01, 0x00, 0x19, 0x0d,
+  0x30, 0x00, 0x0c, 0x55, 0x00, 0x0f, 0x01, 0x00, 0x03, 0x01, 0xcd, 0x03, 0x00, 0x08, 0x00, 0x00, 0xe8, 0x01, 0x60, 0x3c, 0x38, 0x36, 0x33, 0x24,
+  0x23, 0x83, 0x03, 0x03, 0x02, 0x00, 0x00, 0x96, 0x01, 0x01, 0x02, 0x00, 0x04, 0x05, 0x00, 0x01, 0x01, 0x00, 0x00, 0x07, 0x00, 0x40, 0x1c, 0xa0,
+  0x1c, 0xa1, 0x29, 0x01, 0x02, 0x25, 0x01, 0x00, 0x39, 0x01, 0x02, 0x07, 0x00, 0x00, 0x09, 0x00, 0x00, 0xc0, 0x03, 0x11, 0x23, 0x4b, 0x01, 0x20,
+  0x24, 0x1c, 0x46, 0x00, 0x01, 0x48, 0x00, 0x01, 0x01, 0x00, 0x00, 0x46, 0x00, 0x30, 0xb6, 0x9e, 0x9e, 0xd3, 0x01, 0x30, 0x96, 0xac, 0xac, 0xe5,
+  0x01, 0x30, 0xac, 0xac, 0xb5, 0x82, 0x03, 0x60, 0xb5, 0xac, 0x96, 0xb5, 0xb5, 0xb5, 0x0e, 0x00, 0x00, 0xe1, 0x01, 0x20, 0xa9, 0xb3, 0x01, 0x00,
+  0x51, 0xa8, 0xa8, 0xa8, 0xa8, 0xb1, 0xd2, 0x01, 0x20, 0xaf, 0xa6, 0xd7, 0x01, 0x21, 0xab, 0xab, 0xe1, 0x01, 0x00, 0x05, 0x00, 0x80, 0xb1, 0xa8,
+  0xa8, 0xb3, 0xac, 0xa9, 0xc2, 0xa9, 0x31, 0x00, 0x40, 0x9e, 0xb5, 0xb5, 0x9e, 0x58, 0x00, 0x00, 0x96, 0x00, 0x00, 0x01, 0x00, 0x01, 0x77, 0x00,
+  0x02, 0x8d, 0x00, 0x02, 0x69, 0x02, 0x01, 0x11, 0x00, 0x00, 0x05, 0x00, 0x00, 0x86, 0x02, 0x00, 0x18, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x14, 0x00,
+  0x00, 0x06, 0x00, 0x00, 0xa5, 0x02, 0x00, 0x9b, 0x02, 0x00, 0xe9, 0x01, 0x01, 0x01, 0x00, 0x00, 0xdf, 0x01, 0x01, 0x01, 0x00, 0x01, 0xd3, 0x01,
+  0x00, 0xf0, 0x01, 0x01, 0x01, 0x00, 0x00, 0xe2, 0x01, 0x00, 0xd8, 0x01, 0x10, 0x33, 0xc1, 0x03, 0x10, 0x38, 0xea, 0x01, 0x00, 0x02, 0x00, 0x20,
+  0x38, 0x36, 0xc7, 0x03, 0x00, 0xcf, 0x01, 0x00, 0xb9, 0x03, 0x20, 0x38, 0x36, 0x0d, 0x00, 0x06, 0x01, 0x00, 0x0e, 0x97, 0x01, 0x01, 0x01, 0x00,
+  0x0f, 0x16, 0x00, 0x03, 0x0f, 0x01, 0x00, 0x1b, 0x0f, 0x44, 0x00, 0x1c, 0x10, 0x4a, 0xce, 0x03, 0x50, 0x4c, 0x49, 0x4a, 0x49, 0x3c, 0xc6, 0x02,
+  0x00, 0xc5, 0x04, 0x06, 0x7a, 0x03, 0x13, 0xa0, 0x41, 0x01, 0x10, 0x9e, 0x84, 0x03, 0x00, 0x0f, 0x00, 0x01, 0x03, 0x00, 0x00, 0x4c, 0x01, 0x00,
+  0x25, 0x01, 0x00, 0xc2, 0x01, 0x04, 0x01, 0x00, 0x11, 0x24, 0x60, 0x01, 0x00, 0x11, 0x00, 0x00, 0x1a, 0x00, 0x30, 0x1c, 0x1c, 0xa1, 0x1e, 0x00,
+  0x10, 0xa1, 0x2b, 0x00, 0x06, 0x01, 0x00, 0x00, 0xad, 0x03, 0x10, 0x9e, 0xe1, 0x01, 0x00, 0xd7, 0x01, 0x00, 0xe6, 0x01, 0x02, 0xe9, 0x01, 0x11,
+  0xa9, 0xbe, 0x03, 0x01, 0xe1, 0x01, 0x22, 0xc2, 0xa8, 0xde, 0x01, 0x31, 0xb2, 0xa8, 0xb1, 0xd8, 0x01, 0x10, 0xa6, 0x05, 0x00, 0x00, 0xa6, 0x05,
+  0x02, 0xc4, 0x03, 0x21, 0xb1, 0xa8, 0xc1, 0x03, 0x30, 0xac, 0xb3, 0xb3, 0x34, 0x00, 0x00, 0x1f, 0x02, 0x00, 0x96, 0x00, 0x00, 0x9f, 0x00, 0x01,
+  0x78, 0x02, 0x00, 0x87, 0x00, 0x01, 0x76, 0x02, 0x00, 0x09, 0x00, 0x03, 0x07, 0x00, 0x00, 0x04, 0x00, 0x01, 0xf1, 0x01, 0x00, 0x02, 0x00, 0x00,
+  0x03, 0x00, 0x01, 0x12, 0x00, 0x00, 0x03, 0x00, 0x02, 0x05, 0x00, 0x13, 0x2b, 0x84, 0x04, 0x09, 0x01, 0x00, 0x00, 0xdb, 0x01, 0x00, 0x05, 0x00,
+  0x21, 0x33, 0x2b, 0xb5, 0x03, 0x01, 0xcf, 0x01, 0x00, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x00, 0xe0, 0x01, 0x11, 0x38, 0x12, 0x00, 0x01, 0xa9, 0x05,
+  0x04, 0xe4, 0x01, 0x02, 0xdf, 0x01, 0x01, 0xbc, 0x03, 0x01, 0x05, 0x00, 0x07, 0x85, 0x01, 0x07, 0x70, 0x03, 0x1f, 0x4d, 0x9d, 0x01, 0x1d, 0x0f,
+  0x01, 0x00, 0x01, 0x07, 0x50, 0x00, 0x0c, 0x01, 0x00, 0x0f, 0x1b, 0x00, 0x08, 0x01, 0xcb, 0x03, 0xb0, 0x47, 0x49, 0x42, 0x36, 0x33, 0x3c, 0x2b,
+  0x24, 0x1c, 0x1c, 0x12, 0xac, 0x01, 0x00, 0x95, 0x01, 0x00, 0x01, 0x00, 0x01, 0x42, 0x01, 0x00, 0xeb, 0x01, 0x00, 0x50, 0x01, 0x00, 0x03, 0x00,
+  0x00, 0x15, 0x00, 0x11, 0xa0, 0xc9, 0x03, 0x00, 0xcc, 0x03, 0x01, 0x5a, 0x01, 0x00, 0x11, 0x00, 0x00, 0x2a, 0x00, 0x01, 0x17, 0x00, 0x0c, 0xd9,
+  0x01, 0x00, 0x35, 0x00, 0x00, 0x08, 0x00, 0x70, 0x9e, 0xb5, 0x9e, 0xb6, 0x9e, 0x9e, 0xac, 0x05, 0x00, 0x32, 0xb5, 0xac, 0xb5, 0x01, 0x00, 0x12,
+  0xac, 0xdc, 0x01, 0x00, 0x04, 0x00, 0x10, 0xc2, 0x9e, 0x05, 0x00, 0x02, 0x00, 0x21, 0xa8, 0xb1, 0xe1, 0x01, 0x10, 0xa6, 0xe1, 0x01, 0x10, 0xa7,
+  0x05, 0x00, 0x02, 0xc3, 0x03, 0x10, 0xb1, 0x1b, 0x00, 0x11, 0xb4, 0x9e, 0x05, 0x10, 0xb5, 0x02, 0x00, 0x00, 0xe1, 0x01, 0x11, 0xb6, 0x5a, 0x00,
+  0x40, 0xa1, 0xa0, 0xa0, 0xa1, 0x78, 0x00, 0x00, 0xbd, 0x01, 0x00, 0x87, 0x04, 0x01, 0xbc, 0x01, 0x00, 0x06, 0x00, 0x01, 0xe8, 0x01, 0x00, 0xb8,
+  0x02, 0x00, 0xdd, 0x01, 0x00, 0xac, 0x03, 0x01, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x06, 0x00, 0x00, 0x14, 0x00, 0x00, 0x05, 0x00, 0x00, 0x1a,
+  0x00, 0x08, 0x01, 0x00, 0x00, 0xcc, 0x01, 0x01, 0xe1, 0x01, 0x00, 0xea, 0x01, 0x00, 0xd7, 0x01, 0x00, 0xec, 0x01, 0x00, 0x88, 0x07, 0x30, 0x36,
+  0x33, 0x36, 0xd5, 0x01, 0x00, 0xe4, 0x01, 0x00, 0xc2, 0x03, 0x30, 0x3c, 0x33, 0x3c, 0xac, 0x05, 0x00, 0xc0, 0x03, 0x00, 0xd5, 0x01, 0x00, 0x01,
+  0x00, 0x03, 0x09, 0x00, 0x00, 0x50, 0x01, 0x0f, 0x01, 0x00, 0x00, 0x0f, 0xdf, 0x01, 0x11, 0x0f, 0x24, 0x00, 0x11, 0x0f, 0x01, 0x00, 0x05, 0x27,
+  0x4d, 0x4f, 0x3e, 0x00, 0x01, 0xa0, 0x05, 0x03, 0x06, 0x00, 0x05, 0x01, 0x00, 0x00, 0x9b, 0x07, 0x70, 0x47, 0x49, 0x42, 0xfe, 0x42, 0x36, 0x33,
+  0x21, 0x01, 0x00, 0x2b, 0x01, 0x00, 0x41, 0x01, 0x04, 0xdc, 0x01, 0x05, 0x01, 0x00, 0x11, 0xb5, 0x58, 0x01, 0x03, 0xca, 0x03, 0x00, 0x2d, 0x01,
+  0x10, 0xa1, 0x44, 0x03, 0x09, 0x01, 0x00, 0x04, 0x09, 0x02, 0x03, 0x38, 0x00, 0x40, 0xa0, 0xa0, 0xa0, 0xb6, 0x0a, 0x00, 0x00, 0x97, 0x01, 0x00,
+  0x9c, 0x05, 0x01, 0xc3, 0x03, 0x10, 0x96, 0xa8, 0x01, 0x03, 0xe3, 0x01, 0x12, 0xa9, 0xc0, 0x03, 0x33, 0xb2, 0xa7, 0xb1, 0xdf, 0x01, 0x40, 0xaf,
+  0xa6, 0xaf, 0xa6, 0x82, 0x07, 0x30, 0xaf, 0xa6, 0xaf, 0xe3, 0x01, 0x60, 0xab, 0xa8, 0xb1, 0xa8, 0xb2, 0xa8, 0xc2, 0x05, 0x10, 0xac, 0x62, 0x09,
+  0x01, 0xf5, 0x03, 0x11, 0x96, 0x5d, 0x00, 0x01, 0x64, 0x00, 0x00, 0x6b, 0x00, 0x01, 0xe4, 0x01, 0x00, 0xcc, 0x03, 0x12, 0xa1, 0xe2, 0x01, 0x00,
+  0xc4, 0x01, 0x01, 0x05, 0x00, 0x00, 0x3b, 0x06, 0x00, 0x08, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x00, 0xe4, 0x01, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x00,
+  0x11, 0x33, 0xba, 0x03, 0x00, 0x9f, 0x03, 0x00, 0x02, 0x00, 0x01, 0xb3, 0x03, 0x00, 0x05, 0x00, 0x03, 0x02, 0x00, 0x01, 0xd8, 0x01, 0x50, 0x38,
+  0x3c, 0x36, 0x38, 0x36, 0x04, 0x00, 0x02, 0xe7, 0x01, 0x00, 0xe2, 0x01, 0x09, 0xc0, 0x03, 0x01, 0x01, 0x00, 0x20, 0x4d, 0x4d, 0xac, 0x03, 0x02,
+  0x6d, 0x01, 0x02, 0x06, 0x00, 0x02, 0x01, 0x00, 0x11, 0x4d, 0x03, 0x00, 0x06, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x04, 0x04, 0x00, 0x01, 0x01, 0x00,
+  0x05, 0x09, 0x00, 0x0f, 0x01, 0x00, 0x24, 0x0f, 0x40, 0x00, 0x09, 0x00, 0xa9, 0x05, 0x00, 0x03, 0x00, 0x02, 0x04, 0x00, 0x30, 0x49, 0x47, 0x3c,
+  0xf1, 0x00, 0x00, 0xce, 0x03, 0x00, 0x3b, 0x01, 0x02, 0xbf, 0x01, 0x00, 0xa9, 0x01, 0x00, 0x01, 0x00, 0x01, 0x1b, 0x05, 0x00, 0x59, 0x01, 0x01,
+  0x54, 0x01, 0x00, 0x27, 0x01, 0x00, 0xcc, 0x03, 0x1d, 0xa1, 0x94, 0x05, 0x01, 0x01, 0x00, 0x01, 0xd7, 0x01, 0x21, 0xa0, 0xb6, 0x3e, 0x00, 0x10,
+  0xb6, 0x3e, 0x00, 0x10, 0xb6, 0x9c, 0x05, 0x00, 0x9f, 0x01, 0x00, 0xda, 0x01, 0x01, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x7b, 0x07, 0x00, 0x04,
+  0x00, 0x11, 0xb2, 0x9c, 0x05, 0x32, 0xab, 0xaf, 0xab, 0xd6, 0x01, 0x00, 0x9d, 0x05, 0x00, 0xdb, 0x01, 0x00, 0xba, 0x05, 0x70, 0xb3, 0xa8, 0xb3,
+  0xc2, 0xa9, 0xc2, 0xa9, 0xdf, 0x01, 0x01, 0xc0, 0x03, 0x41, 0x96, 0xb6, 0x9e, 0xb6, 0xdc, 0x01, 0x00, 0x8a, 0x00, 0x00, 0x91, 0x00, 0x01, 0xeb,
+  0x01, 0x00, 0xe1, 0x01, 0x00, 0x02, 0x00, 0x00, 0x91, 0x00, 0x00, 0x02, 0x00, 0x01, 0xa0, 0x00, 0x01, 0x88, 0x02, 0x02, 0x02, 0x00, 0x02, 0x01,
+  0x00, 0x00, 0xd6, 0x01, 0x02, 0x07, 0x00, 0x03, 0x01, 0x00, 0x03, 0x0e, 0x00, 0x02, 0x10, 0x00, 0x00, 0xda, 0x01, 0x00, 0xbd, 0x03, 0x30, 0x2b,
+  0x2b, 0x2f, 0x0b, 0x00, 0x00, 0xcb, 0x01, 0x01, 0xba, 0x03, 0x00, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0xdf, 0x01, 0x01, 0x02, 0x00, 0x00, 0x16,
+  0x00, 0x00, 0xd9, 0x01, 0x01, 0xec, 0x01, 0x05, 0xca, 0x03, 0x01, 0xdd, 0x01, 0x04, 0x6c, 0x01, 0x04, 0x08, 0x00, 0x01, 0x13, 0x00, 0x05, 0x0d,
+  0x00, 0x08, 0x01, 0x00, 0x00, 0x15, 0x00, 0x00, 0x04, 0x00, 0x01, 0x07, 0x00, 0x00, 0x02, 0x00, 0x01, 0x09, 0x00, 0x02, 0x01, 0x00, 0x04, 0x08,
+  0x00, 0x0f, 0x01, 0x00, 0x2a, 0x00, 0xd2, 0x01, 0x01, 0x01, 0x00, 0x03, 0xe2, 0x01, 0x00, 0x01, 0x00, 0x20, 0x49, 0x4c, 0x62, 0x0b, 0x41, 0x3c,
+  0x38, 0x2b, 0x33, 0x1e, 0x01, 0x34, 0xa0, 0x24, 0x24, 0xa2, 0x01, 0x00, 0xf8, 0x0a, 0x40, 0x96, 0xb6, 0x24, 0xa1, 0xcd, 0x01, 0x00, 0x1b, 0x05,
+  0x80, 0xa0, 0x24, 0xa1, 0x1c, 0xd5, 0x1c, 0x1c, 0xa1, 0x27, 0x00, 0x10, 0xa1, 0x07, 0x02, 0x00, 0x4f, 0x09, 0x02, 0x02, 0x00, 0x03, 0x80, 0x01,
+  0x04, 0x06, 0x00, 0x10, 0xb6, 0x68, 0x09, 0x30, 0xb6, 0x9e, 0xb6, 0xc5, 0x03, 0x01, 0xa2, 0x05, 0x01, 0xaa, 0x01, 0x01, 0x05, 0x00, 0x00, 0x17,
+  0x0b, 0x10, 0xb4, 0x62, 0x09, 0x91, 0xa8, 0xb2, 0xa8, 0xb2, 0xa7, 0xb2, 0xa8, 0xa7, 0xb1, 0x76, 0x07, 0x01, 0xb4, 0x03, 0x00, 0x13, 0x00, 0x00,
+  0xb9, 0x03, 0x00, 0xe1, 0x01, 0x01, 0xde, 0x01, 0x00, 0xbb, 0x03, 0x20, 0xb5, 0xb5, 0xef, 0x05, 0x00, 0x62, 0x00, 0x10, 0xb6, 0x73, 0x00, 0x00,
+  0x8d, 0x00, 0x01, 0x09, 0x00, 0x00, 0xac, 0x05, 0x00, 0x7a, 0x04, 0x01, 0xca, 0x03, 0x10, 0xa1, 0x82, 0x04, 0x03, 0xd5, 0x01, 0x02, 0x05, 0x00,
+  0x00, 0xe3, 0x0b, 0x00, 0x09, 0x00, 0x02, 0xd1, 0x01, 0x00, 0xd3, 0x01, 0x04, 0xd4, 0x01, 0x00, 0x01, 0x00, 0x01, 0x12, 0x00, 0x35, 0x2b, 0x2b,
+  0x24, 0x6c, 0x09, 0x00, 0xd4, 0x03, 0x00, 0xc4, 0x03, 0x00, 0xbe, 0x01, 0x11, 0x33, 0xc6, 0x01, 0x00, 0xb4, 0x03, 0x00, 0x10, 0x00, 0x00, 0x62,
+  0x09, 0x02, 0xa3, 0x05, 0x02, 0xbe, 0x03, 0x08, 0x01, 0x00, 0x05, 0xc0, 0x03, 0x00, 0x05, 0x00, 0x01, 0xa2, 0x01, 0x22, 0x4d, 0x4c, 0x13, 0x00,
+  0x03, 0x06, 0x00, 0x05, 0x15, 0x00, 0x01, 0x02, 0x00, 0x00, 0x03, 0x00, 0x05, 0x0f, 0x00, 0x05, 0x08, 0x00, 0x00, 0x28, 0x00, 0x02, 0x07, 0x00,
+  0x00, 0x1d, 0x00, 0x06, 0x18, 0x00, 0x0d, 0x01, 0x00, 0x0f, 0x14, 0x00, 0x01, 0x0f, 0x01, 0x00, 0x12, 0x00, 0xd2, 0x03, 0x61, 0x49, 0x47, 0x49,
+  0x3c, 0x3c, 0x36, 0x50, 0x0a, 0x00, 0xbb, 0x01, 0x01, 0xe1, 0x01, 0x01, 0xe7, 0x01, 0x00, 0xed, 0x01, 0x04, 0x01, 0x00, 0x02, 0xb8, 0x01, 0x00,
+  0x5c, 0x01, 0x01, 0xd2, 0x03, 0x00, 0xe1, 0x01, 0x00, 0x17, 0x00, 0x00, 0x50, 0x03, 0x00, 0x76, 0x01, 0x00, 0x21, 0x00, 0x04, 0x02, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x1b, 0x0d, 0x00, 0x0a, 0x00, 0x11, 0x9e, 0xe2, 0x01, 0x00, 0xed, 0x0c, 0x10, 0xa9, 0xbf, 0x03, 0x71, 0xb4, 0xa9, 0xc2, 0xb3,
+  0xc2, 0xa9, 0xb4, 0xa9, 0x03, 0x20, 0xb2, 0xb3, 0xda, 0x01, 0x01, 0xdf, 0x01, 0x00, 0xd6, 0x03, 0xc1, 0xb3, 0xa8, 0xa8, 0xc2, 0xa8, 0xb3, 0xb2,
+  0xa8, 0xb3, 0xb2, 0xa9, 0xb3, 0x31, 0x00, 0x00, 0xde, 0x01, 0x03, 0x45, 0x00, 0x02, 0x1d, 0x04, 0x01, 0x01, 0x00, 0x10, 0xa1, 0xe7, 0x01, 0x11,
+  0xa1, 0xd0, 0x01, 0xa0, 0x1c, 0x24, 0xa1, 0x24, 0xa1, 0x1c, 0xa0, 0x24, 0xd5, 0x24, 0xef, 0x01, 0x00, 0xb8, 0x01, 0x00, 0x17, 0x00, 0x01, 0x09,
+  0x00, 0x01, 0x01, 0x00, 0x01, 0xab, 0x03, 0x00, 0x09, 0x00, 0x00, 0xd0, 0x01, 0x60, 0x2b, 0x2f, 0x2b, 0x2f, 0x2b, 0x24, 0x05, 0x00, 0x01, 0x0c,
+  0x00, 0x33, 0x2b, 0x33, 0x2f, 0xe1, 0x01, 0x01, 0x1d, 0x00, 0x00, 0xe4, 0x01, 0x00, 0xc7, 0x03, 0x00, 0xa3, 0x05, 0x31, 0x33, 0x36, 0x36, 0x3a,
+  0x0b, 0x00, 0x07, 0x00, 0x00, 0xb1, 0x05, 0x01, 0x9f, 0x05, 0x00, 0x04, 0x00, 0x02, 0x01, 0x00, 0x30, 0x42, 0x3c, 0x42, 0x07, 0x00, 0x01, 0xc1,
+  0x01, 0x07, 0xa0, 0x01, 0x01, 0x02, 0x00, 0x04, 0x15, 0x00, 0x00, 0x0a, 0x00, 0x01, 0x07, 0x00, 0x00, 0x9b, 0x01, 0x00, 0x07, 0x00, 0x02, 0x05,
+  0x00, 0x09, 0x02, 0x00, 0x00, 0x1b, 0x00, 0x03, 0x02, 0x00, 0x05, 0x05, 0x00, 0x00, 0x08, 0x00, 0x01, 0x3a, 0x00, 0x02, 0x56, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00, 0x06, 0x00, 0x02, 0x15, 0x00, 0x04, 0x08, 0x00, 0x0f, 0x01, 0x00, 0x18, 0x00, 0x94, 0x07, 0x01,
+  0x47, 0x0d, 0x00, 0xc6, 0x03, 0x00, 0x02, 0x05, 0x06, 0x01, 0x00, 0x00, 0x46, 0x03, 0x01, 0x03, 0x00, 0x01, 0xb3, 0x01, 0x00, 0xc0, 0x01, 0x00,
+  0x6b, 0x01, 0x00, 0x62, 0x09, 0x00, 0x09, 0x00, 0x20, 0x9e, 0xb6, 0x6f, 0x01, 0x24, 0xa0, 0xa0, 0x87, 0x01, 0x02, 0x30, 0x00, 0x00, 0x2a, 0x00,
+  0x01, 0x02, 0x00, 0x32, 0xb6, 0xb5, 0xb6, 0xe1, 0x01, 0x20, 0xac, 0xac, 0x53, 0x07, 0x02, 0xc6, 0x01, 0x01, 0xcd, 0x01, 0x00, 0x2a, 0x0b, 0x10,
+  0xb1, 0x87, 0x07, 0x00, 0x09, 0x00, 0x00, 0xc0, 0x03, 0x01, 0xba, 0x05, 0x01, 0x01, 0x00, 0x20, 0xa9, 0xc2, 0x30, 0x00, 0x10, 0xac, 0x1d, 0x0d,
+  0x00, 0xdf, 0x01, 0x12, 0xb6, 0x73, 0x00, 0x01, 0x48, 0x02, 0x00, 0xde, 0x01, 0x11, 0x1c, 0x03, 0x00, 0x11, 0xa0, 0xdc, 0x01, 0x01, 0x4e, 0x04,
+  0x04, 0x02, 0x00, 0x00, 0x0d, 0x00, 0x00, 0xbe, 0x03, 0x00, 0x0a, 0x00, 0x00, 0x3c, 0x0b, 0x06, 0xde, 0x01, 0x02, 0xd7, 0x01, 0x32, 0x2f, 0x33,
+  0x2f, 0xcd, 0x01, 0x40, 0x2f, 0x2b, 0x2b, 0x36, 0xce, 0x01, 0x41, 0x36, 0x33, 0x2f, 0x36, 0x16, 0x00, 0x10, 0x36, 0x16, 0x00, 0x01, 0xef, 0x01,
+  0x01, 0x9d, 0x07, 0x10, 0x2b, 0x20, 0x00, 0x00, 0x02, 0x00, 0x01, 0x05, 0x00, 0x00, 0xe5, 0x01, 0x00, 0x01, 0x00, 0x0b, 0xc6, 0x03, 0x00, 0x67,
+  0x01, 0x00, 0x87, 0x01, 0x09, 0x02, 0x00, 0x09, 0x01, 0x00, 0x00, 0x11, 0x00, 0x00, 0x13, 0x00, 0x40, 0x4c, 0x4d, 0x4d, 0x50, 0x10, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0xef, 0x01, 0x00, 0x07, 0x00, 0x05, 0x02, 0x00, 0x0e, 0x01, 0x00, 0x03, 0x2c, 0x00, 0x06, 0x01, 0x00, 0x00, 0x27, 0x00, 0x01,
+  0x02, 0x00, 0x01, 0x01, 0x00, 0x01, 0x34, 0x00, 0x01, 0x06, 0x00, 0x00, 0x0e, 0x00, 0x0f, 0x01, 0x00, 0x19, 0x00, 0xe5, 0x01, 0x10, 0x47, 0xbb,
+  0x00, 0x30, 0x36, 0x3c, 0x3c, 0xee, 0x02, 0x00, 0x42, 0x10, 0x02, 0xea, 0x01, 0x00, 0x8c, 0x07, 0x30, 0x9e, 0x9e, 0xa0, 0xb1, 0x01, 0x00, 0x09,
+  0x00, 0x11, 0xb5, 0xc8, 0x03, 0x00, 0x04, 0x00, 0x90, 0xa0, 0xb6, 0xa0, 0xb5, 0x24, 0x3d, 0xfe, 0x3d, 0x36, 0xed, 0x01, 0x00, 0x18, 0x00, 0x00,
+  0xd5, 0x01, 0x40, 0x9e, 0xb5, 0x9e, 0xac, 0xdb, 0x01, 0x00, 0x0a, 0x00, 0x03, 0x01, 0x00, 0x00, 0xb0, 0x01, 0x00, 0xbb, 0x01, 0x01, 0x87, 0x05,
+  0x30, 0xb2, 0xb1, 0xb2, 0x07, 0x00, 0x90, 0xa8, 0xb1, 0xa7, 0xb2, 0xa8, 0xb2, 0xb1, 0xa7, 0xb2, 0xb4, 0x03, 0x31, 0xa8, 0xb1, 0xb3, 0x9f, 0x05,
+  0x51, 0xb3, 0xac, 0xc2, 0xac, 0xc2, 0xd0, 0x05, 0x00, 0x26, 0x02, 0x00, 0x6e, 0x00, 0x10, 0xb6, 0x03, 0x00, 0x00, 0xe1, 0x01, 0x00, 0x6d, 0x00,
+  0x04, 0x01, 0x00, 0x00, 0x99, 0x05, 0x00, 0xd3, 0x01, 0x30, 0xd5, 0x1c, 0xd5, 0xcd, 0x01, 0x04, 0x0f, 0x00, 0x00, 0x0c, 0x00, 0x00, 0xc5, 0x03,
+  0x00, 0xde, 0x01, 0x00, 0x0a, 0x00, 0x00, 0xdb, 0x01, 0x32, 0x24, 0x2b, 0x2f, 0xd5, 0x01, 0x01, 0xef, 0x01, 0x01, 0x02, 0x00, 0x00, 0xe2, 0x01,
+  0x00, 0xd7, 0x01, 0x20, 0x33, 0x2f, 0xc2, 0x01, 0x02, 0xb7, 0x03, 0x00, 0xc0, 0x04, 0x00, 0xca, 0x01, 0x00, 0x11, 0x00, 0x00, 0x01, 0x02, 0x02,
+  0xe8, 0x01, 0x00, 0x9d, 0x07, 0x03, 0xec, 0x01, 0x00, 0x23, 0x00, 0x00, 0x1d, 0x01, 0x04, 0x01, 0x00, 0x00, 0x7a, 0x01, 0x04, 0x01, 0x00, 0x00,
+  0x73, 0x01, 0x08, 0x01, 0x00, 0x1a, 0x50, 0xa5, 0x01, 0x11, 0x50, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x01, 0x2c, 0x00, 0x04, 0x02, 0x00, 0x00, 0x01,
+  0x00, 0x10, 0x4c, 0x19, 0x00, 0x00, 0x1e, 0x00, 0x04, 0x01, 0x00, 0x32, 0x4d, 0x50, 0x51, 0x06, 0x00, 0x20, 0x4d, 0x51, 0x0b, 0x00, 0x50, 0x51,
+  0x4d, 0x51, 0x50, 0x4f, 0x29, 0x00, 0x30, 0x4d, 0x4d, 0x51, 0x58, 0x00, 0x01, 0x01, 0x00, 0x10, 0x51, 0x05, 0x00, 0x05, 0x01, 0x00, 0x00, 0xf4,
+  0x01, 0x00, 0x50, 0x00, 0x30, 0x49, 0x49, 0x49, 0xfe, 0x01, 0x09, 0x01, 0x00, 0x04, 0x89, 0x07, 0x02, 0x01, 0x00, 0x01, 0xac, 0x05, 0x00, 0x28,
+  0x00, 0x05, 0x01, 0x00, 0x50, 0xfe, 0x3c, 0x36, 0x2b, 0xfd, 0x7b, 0x07, 0x20, 0x24, 0x24, 0xc0, 0x01, 0x11, 0xac, 0xb8, 0x01, 0x01, 0x79, 0x01,
+  0x00, 0x04, 0x00, 0x00, 0x66, 0x07, 0x70, 0xb5, 0x9e, 0x9e, 0x24, 0x2f, 0x36, 0x2f, 0x7d, 0x01, 0x00, 0xe3, 0x01, 0x00, 0x13, 0x00, 0x00, 0x24,
+  0x00, 0x04, 0xda, 0x01, 0x01, 0xa8, 0x01, 0x10, 0xb5, 0x42, 0x0b, 0x00, 0x36, 0x09, 0x11, 0xb4, 0xe1, 0x01, 0x00, 0xb5, 0x03, 0x10, 0xb1, 0x58,
+  0x09, 0x20, 0xab, 0xb1, 0x15, 0x0d, 0x11, 0xb1, 0x14, 0x00, 0x00, 0xf1, 0x01, 0x00, 0xdf, 0x01, 0x02, 0xe9, 0x03, 0x00, 0x5c, 0x0d, 0x02, 0x63,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x5a, 0x00, 0x00, 0xbb, 0x03, 0x00, 0x04, 0x00, 0x40, 0xa1, 0xa1, 0xa1, 0x1c, 0x03, 0x00, 0x00, 0xe4, 0x01, 0x02,
+  0xd1, 0x01, 0x10, 0xa1, 0xc8, 0x01, 0x10, 0xd5, 0x0d, 0x00, 0x00, 0x0e, 0x00, 0x08, 0x01, 0x00, 0x01, 0xcd, 0x01, 0x00, 0xb9, 0x03, 0x40, 0x2b,
+  0x2f, 0x24, 0x2f, 0x89, 0x05, 0x00, 0xc0, 0x03, 0x20, 0x24, 0x2f, 0x02, 0x00, 0x00, 0x15, 0x00, 0x00, 0xcd, 0x01, 0x03, 0x01, 0x00, 0x01, 0xc0,
+  0x01, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x99, 0x05, 0x13, 0x3c, 0x06, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x07, 0x01,
+  0x0d, 0x00, 0x05, 0xe5, 0x01, 0x00, 0xb8, 0x01, 0x00, 0x5f, 0x01, 0x00, 0x5c, 0x01, 0x0d, 0x01, 0x00, 0x00, 0xb4, 0x01, 0x00, 0x05, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0xb0, 0x01, 0x12, 0x51, 0x11, 0x00, 0x05, 0xe5, 0x01, 0x08, 0x01, 0x00, 0x00, 0xd6, 0x01, 0x01, 0x01, 0x00, 0x00, 0x29, 0x00,
+  0x01, 0x05, 0x00, 0x12, 0x51, 0x2c, 0x00, 0x00, 0x0b, 0x00, 0x01, 0x01, 0x00, 0x40, 0x4d, 0x50, 0x4d, 0x51, 0xec, 0x01, 0x00, 0x47, 0x00, 0x00,
+  0x4a, 0x00, 0x00, 0x79, 0x00, 0x01, 0x05, 0x00, 0x09, 0x01, 0x00, 0x00, 0xc2, 0x01, 0x00, 0x37, 0x02, 0x03, 0x02, 0x00, 0x0d, 0x01, 0x00, 0x03,
+  0x78, 0x09, 0x01, 0xe3, 0x01, 0x01, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0xb5, 0x05, 0x00, 0x05, 0x00, 0x80, 0x49, 0xfe, 0x2f, 0x1c, 0x9e, 0x96,
+  0xac, 0xa9, 0x8d, 0x12, 0x35, 0x9e, 0xb5, 0xb6, 0xc1, 0x01, 0x00, 0x0f, 0x00, 0x00, 0x57, 0x03, 0x31, 0x9e, 0xb6, 0xb6, 0xf4, 0x01, 0x20, 0xb6,
+  0xb6, 0xf3, 0x01, 0x00, 0x9a, 0x01, 0x00, 0x1b, 0x00, 0x00, 0x88, 0x03, 0x00, 0x59, 0x09, 0x01, 0xe5, 0x01, 0x80, 0xac, 0xac, 0xc2, 0xac, 0xb4,
+  0xb3, 0xb3, 0xb3, 0xca, 0x01, 0x21, 0xb2, 0xb1, 0x3e, 0x0b, 0x10, 0xa6, 0x42, 0x0b, 0x21, 0xa7, 0xb1, 0x01, 0x00, 0x00, 0xd6, 0x03, 0x40, 0xb3,
+  0xb3, 0xc2, 0xac, 0xc2, 0x03, 0x10, 0xac, 0x12, 0x02, 0x20, 0xb5, 0xac, 0xde, 0x05, 0x01, 0xe1, 0x01, 0x00, 0xc3, 0x09, 0x00, 0x66, 0x00, 0x01,
+  0xe1, 0x01, 0x00, 0xd9, 0x01, 0x00, 0xec, 0x01, 0x00, 0x5b, 0x09, 0x10, 0xa1, 0xa5, 0x05, 0x01, 0xc5, 0x03, 0x10, 0x24, 0xb0, 0x05, 0x00, 0xd5,
+  0x01, 0x00, 0x6d, 0x07, 0x01, 0x06, 0x00, 0x40, 0x24, 0x2b, 0x2f, 0x2f, 0x8b, 0x03, 0x08, 0x02, 0x00, 0x00, 0xd6, 0x01, 0x00, 0xbf, 0x03, 0x11,
+  0x24, 0xce, 0x03, 0x01, 0xa6, 0x05, 0x00, 0xbf, 0x03, 0x00, 0x06, 0x00, 0x10, 0x2f, 0xbd, 0x01, 0x12, 0x2f, 0xd8, 0x01, 0x04, 0x05, 0x00, 0x00,
+  0x02, 0x00, 0x12, 0x36, 0xd1, 0x01, 0x01, 0x0c, 0x00, 0x01, 0x0e, 0x00, 0x03, 0x06, 0x00, 0x01, 0xb1, 0x01, 0x0d, 0x65, 0x01, 0x02, 0x01, 0x00,
+  0x01, 0x9f, 0x01, 0x01, 0xa2, 0x01, 0x05, 0xa4, 0x01, 0x02, 0xa7, 0x01, 0x00, 0x19, 0x00, 0x1a, 0x51, 0x34, 0x00, 0x02, 0x15, 0x00, 0x02, 0x01,
+  0x00, 0x01, 0x30, 0x00, 0x00, 0x33, 0x00, 0x01, 0x27, 0x00, 0x00, 0x04, 0x00, 0x04, 0x02, 0x00, 0x04, 0x01, 0x00, 0x03, 0x0a, 0x00, 0x01, 0x13,
+  0x00, 0x02, 0x82, 0x00, 0x01, 0x01, 0x00, 0x01, 0x09, 0x00, 0x00, 0xd7, 0x01, 0x02, 0x03, 0x00, 0x01, 0x72, 0x02, 0x00, 0xe4, 0x01, 0x40, 0x49,
+  0x4c, 0x49, 0x4d, 0xd5, 0x01, 0x05, 0x01, 0x00, 0x01, 0xd6, 0x01, 0x00, 0x17, 0x00, 0x01, 0x02, 0x00, 0x00, 0xb1, 0x05, 0x60, 0x49, 0x36, 0x3c,
+  0x3c, 0x47, 0x49, 0xfe, 0x12, 0x61, 0x3d, 0xfd, 0x24, 0xa1, 0xa0, 0xb6, 0x7b, 0x01, 0x10, 0x9e, 0x62, 0x03, 0x00, 0xba, 0x01, 0x00, 0xb9, 0x01,
+  0x01, 0xd1, 0x01, 0x04, 0xf1, 0x01, 0x01, 0x0e, 0x00, 0x11, 0xb6, 0x03, 0x00, 0x02, 0xde, 0x01, 0x00, 0x92, 0x03, 0x00, 0x99, 0x03, 0x00, 0xc0,
+  0x03, 0x21, 0xc2, 0xb3, 0xc2, 0x03, 0x40, 0xb1, 0xb2, 0xa8, 0xb1, 0x77, 0x16, 0x03, 0x1f, 0x0d, 0x10, 0xab, 0xdf, 0x01, 0x01, 0x01, 0x00, 0x00,
+  0xc2, 0x03, 0x00, 0x23, 0x00, 0x00, 0x81, 0x07, 0x01, 0x68, 0x00, 0x01, 0x29, 0x02, 0x01, 0x16, 0x04, 0x01, 0xc1, 0x03, 0x00, 0x02, 0x00, 0x01,
+  0x05, 0x00, 0x10, 0xa1, 0xc7, 0x03, 0x00, 0xb4, 0x03, 0x00, 0x06, 0x00, 0x00, 0xb7, 0x03, 0x50, 0xa1, 0x1c, 0xd5, 0x23, 0xa1, 0xe4, 0x01, 0x02,
+  0x01, 0x00, 0x20, 0x2b, 0x24, 0xa5, 0x03, 0x00, 0x0a, 0x00, 0x01, 0x7b, 0x07, 0x00, 0x02, 0x00, 0x07, 0xb9, 0x03, 0x10, 0xfd, 0xc9, 0x03, 0x00,
+  0x14, 0x00, 0x10, 0x2f, 0x03, 0x02, 0x70, 0x2f, 0x2f, 0x2f, 0x36, 0x2f, 0x36, 0x36, 0xe2, 0x01, 0x10, 0x2f, 0xd7, 0x01, 0x03, 0xc0, 0x01, 0x11,
+  0x3c, 0x05, 0x00, 0x00, 0x0c, 0x00, 0x03, 0x09, 0x00, 0x02, 0x11, 0x00, 0x05, 0x02, 0x00, 0x00, 0x53, 0x01, 0x00, 0x63, 0x01, 0x01, 0x62, 0x01,
+  0x01, 0x51, 0x03, 0x00, 0x0f, 0x00, 0x00, 0x07, 0x00, 0x01, 0x01, 0x00, 0x01, 0x82, 0x01, 0x07, 0x01, 0x00, 0x01, 0x0e, 0x00, 0x03, 0xb7, 0x01,
+  0x00, 0x24, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x15, 0x00, 0x02, 0x03, 0x00, 0x02, 0x01, 0x00, 0x03, 0x0c, 0x00,
+  0x00, 0x04, 0x00, 0x02, 0x01, 0x00, 0x00, 0xaf, 0x05, 0x01, 0xd4, 0x01, 0x01, 0x1a, 0x00, 0x00, 0x32, 0x00, 0x00, 0x69, 0x00, 0x01, 0x05, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x09, 0x00, 0x03, 0x0b, 0x00, 0x03, 0x01, 0x00, 0x01, 0xdd, 0x01, 0x60, 0x49, 0xfe, 0x49, 0xfe, 0x47, 0xfe, 0x9e, 0x03,
+  0x34, 0x47, 0x49, 0x47, 0xe7, 0x01, 0x04, 0x08, 0x00, 0x05, 0x0b, 0x00, 0x00, 0xd8, 0x05, 0x30, 0x49, 0x4c, 0x49, 0x37, 0x0a, 0x10, 0x36, 0xe1,
+  0x01, 0x02, 0x9a, 0x03, 0x00, 0xbd, 0x01, 0x01, 0x82, 0x01, 0x00, 0x08, 0x00, 0x02, 0x8c, 0x01, 0x05, 0x07, 0x00, 0x02, 0xc0, 0x03, 0x02, 0x01,
+  0x00, 0x00, 0xb6, 0x03, 0x00, 0xe1, 0x01, 0x10, 0xc2, 0xbb, 0x01, 0x00, 0xbe, 0x03, 0x03, 0xc0, 0x03, 0x00, 0xdf, 0x01, 0x06, 0x04, 0x00, 0x00,
+  0x06, 0x00, 0x10, 0xaf, 0xe8, 0x01, 0x02, 0x25, 0x0d, 0x13, 0xb4, 0xde, 0x01, 0x01, 0x01, 0x00, 0x01, 0xc0, 0x03, 0x00, 0xfc, 0x05, 0x01, 0xd7,
+  0x01, 0x00, 0xbe, 0x03, 0x00, 0xe1, 0x01, 0x02, 0x71, 0x07, 0x40, 0xa1, 0x1c, 0xa1, 0x24, 0x3d, 0x06, 0x00, 0x51, 0x09, 0x00, 0xcd, 0x01, 0x02,
+  0x01, 0x00, 0x01, 0xc0, 0x03, 0x01, 0xc7, 0x03, 0x00, 0x76, 0x07, 0x01, 0xc7, 0x01, 0x01, 0x55, 0x07, 0x01, 0x02, 0x00, 0x01, 0xb9, 0x03, 0x02,
+  0xe4, 0x01, 0x02, 0x73, 0x09, 0x30, 0x2f, 0x33, 0x36, 0x6c, 0x09, 0x00, 0xbe, 0x01, 0x00, 0x01, 0x00, 0x07, 0xd3, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x07, 0x00, 0x00, 0x15, 0x00, 0x00, 0x05, 0x00, 0x08, 0x01, 0x00, 0x00, 0x78, 0x01, 0x08, 0x85, 0x01, 0x00, 0x63, 0x01, 0x00, 0x06, 0x00, 0x00,
+  0xe8, 0x01, 0x01, 0x05, 0x00, 0x00, 0x07, 0x00, 0x03, 0x16, 0x00, 0x06, 0x01, 0x00, 0x00, 0x77, 0x03, 0x03, 0x01, 0x00, 0x01, 0x65, 0x03, 0x04,
+  0x28, 0x00, 0x21, 0x51, 0xff, 0x06, 0x00, 0x00, 0x20, 0x00, 0x03, 0x52, 0x00, 0x01, 0x07, 0x00, 0x00, 0x11, 0x00, 0x00, 0x02, 0x00, 0x06, 0x01,
+  0x00, 0x06, 0xc8, 0x01, 0x01, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x09, 0x00, 0x00, 0x04, 0x00, 0x06, 0x01, 0x00, 0x01, 0xde, 0x01, 0x11, 0x42,
+  0xe8, 0x13, 0x82, 0xa0, 0x1c, 0x1c, 0x2f, 0x42, 0x49, 0x47, 0xfe, 0x86, 0x05, 0x10, 0x4c, 0x03, 0x00, 0x04, 0xd2, 0x01, 0x00, 0xdd, 0x01, 0x00,
+  0xe0, 0x01, 0x00, 0x03, 0x00, 0x20, 0x49, 0x47, 0xbf, 0x04, 0x40, 0x3c, 0x2f, 0x24, 0xa0, 0x83, 0x05, 0x00, 0x7d, 0x14, 0x00, 0xdf, 0x01, 0x02,
+  0xdb, 0x01, 0x00, 0x07, 0x00, 0x00, 0x09, 0x00, 0x00, 0x2e, 0x0b, 0x04, 0x02, 0x00, 0x20, 0x9e, 0xb6, 0x07, 0x00, 0x01, 0x1e, 0x00, 0x70, 0xc2,
+  0xac, 0xc2, 0xc2, 0xb3, 0xc2, 0xb3, 0x9c, 0x05, 0x10, 0xb2, 0x02, 0x00, 0x01, 0xc0, 0x03, 0x13, 0xb2, 0xd5, 0x01, 0x00, 0xd7, 0x01, 0x01, 0xd9,
+  0x01, 0x01, 0x0a, 0x00, 0x70, 0xab, 0xb1, 0xb1, 0xab, 0xb2, 0xb2, 0xb2, 0xe1, 0x01, 0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0d, 0x06, 0x01,
+  0xe2, 0x01, 0x00, 0x83, 0x07, 0x00, 0xe1, 0x01, 0x00, 0x7d, 0x07, 0x10, 0x1c, 0x07, 0x00, 0x00, 0x91, 0x05, 0x00, 0xc0, 0x03, 0x01, 0xda, 0x01,
+  0x13, 0xfd, 0x03, 0x00, 0x00, 0x02, 0x00, 0x20, 0x24, 0xfd, 0x81, 0x05, 0x03, 0xc4, 0x01, 0x06, 0xa3, 0x05, 0x00, 0x01, 0x00, 0x30, 0x36, 0x2b,
+  0x36, 0x0b, 0x00, 0x11, 0x36, 0x11, 0x00, 0x00, 0xad, 0x05, 0x02, 0xb6, 0x03, 0x12, 0x2b, 0xb9, 0x03, 0x04, 0x01, 0x00, 0x00, 0xe2, 0x01, 0x25,
+  0x3c, 0x3d, 0x02, 0x00, 0x04, 0x01, 0x00, 0x05, 0xe1, 0x01, 0x50, 0x3c, 0x3c, 0x3d, 0x3c, 0x3d, 0x34, 0x50, 0xff, 0x50, 0x01, 0x00, 0x50, 0x4d,
+  0x50, 0x50, 0x50, 0x51, 0x03, 0x00, 0x30, 0x51, 0x50, 0x4d, 0x0d, 0x00, 0x11, 0x51, 0x15, 0x00, 0x20, 0x4d, 0x4d, 0x04, 0x00, 0x00, 0x05, 0x00,
+  0x00, 0x22, 0x00, 0x00, 0x24, 0x00, 0x01, 0x06, 0x00, 0x00, 0x05, 0x00, 0x00, 0x18, 0x00, 0x01, 0x01, 0x00, 0x00, 0x29, 0x00, 0x03, 0x01, 0x00,
+  0x00, 0x41, 0x00, 0x11, 0xff, 0x3a, 0x00, 0x01, 0x0b, 0x00, 0x00, 0x29, 0x00, 0x04, 0x01, 0x00, 0x01, 0x33, 0x00, 0x00, 0x14, 0x00, 0x10, 0x51,
+  0x14, 0x00, 0x12, 0x4d, 0x66, 0x00, 0x04, 0x3d, 0x00, 0x11, 0x51, 0x0d, 0x00, 0x02, 0x53, 0x00, 0x10, 0x4c, 0x05, 0x00, 0x00, 0x01, 0x00, 0xf1,
+  0x19, 0x4c, 0x42, 0x36, 0x2b, 0x24, 0x24, 0x1c, 0x24, 0x24, 0x2b, 0x24, 0x1c, 0x1c, 0x24, 0x2f, 0x2b, 0x2f, 0x2b, 0x24, 0xa1, 0x24, 0xfd, 0x36,
+  0x2f, 0x2f, 0x3d, 0x3c, 0xfe, 0x42, 0xfe, 0x3d, 0x49, 0xfe, 0x49, 0x49, 0x49, 0x4c, 0x49, 0x4c, 0x4c, 0x04, 0x00, 0x00, 0x05, 0x00, 0x00, 0x0e,
+  0x00, 0xf2, 0x10, 0x49, 0x4a, 0xfe, 0x33, 0xa1, 0x9e, 0xb6, 0x96, 0xb5, 0x96, 0xb5, 0xb6, 0x2b, 0xd5, 0x24, 0xa1, 0xa0, 0x9e, 0xb5, 0x9e, 0xb5,
+  0x96, 0xb5, 0x9e, 0xb5, 0xb5, 0xac, 0xac, 0xac, 0xc2, 0xac, 0x05, 0x00, 0x12, 0xb5, 0x01, 0x00, 0x10, 0xb6, 0x05, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x16, 0x00, 0xf0, 0x07, 0xb4, 0xb3, 0xc2, 0xb5, 0xac, 0xac, 0xb3, 0xb4, 0xb3, 0xb3, 0xb4, 0xa8, 0xb2, 0xb2, 0xb1, 0xb1, 0xab, 0xb1, 0xb1, 0xab,
+  0xab, 0xab, 0x06, 0x00, 0x01, 0x08, 0x00, 0x00, 0x01, 0x00, 0x03, 0x12, 0x00, 0x90, 0xab, 0xb0, 0xa8, 0xb2, 0xb3, 0xbd, 0xb3, 0xb4, 0xb3, 0x4c,
+  0x00, 0x01, 0x4d, 0x00, 0x40, 0x9e, 0xb5, 0x9e, 0xb6, 0x01, 0x00, 0xf0, 0x13, 0xa0, 0xb6, 0xa0, 0xb6, 0xb6, 0xa1, 0xa0, 0xa1, 0xa0, 0xa1, 0xa1,
+  0xa0, 0xa1, 0xd5, 0x24, 0x1c, 0x24, 0xa1, 0x1c, 0xa1, 0x24, 0xd5, 0x1c, 0xd5, 0x1c, 0x24, 0xfd, 0x24, 0xfd, 0x24, 0x2b, 0xfd, 0x24, 0x24, 0x09,
+  0x00, 0x70, 0x2b, 0xfd, 0x2b, 0x24, 0x2f, 0x24, 0x2b, 0x02, 0x00, 0x30, 0x2f, 0x24, 0x2b, 0xd9, 0x00, 0xf1, 0x02, 0x36, 0x2f, 0x36, 0x2f, 0x2f,
+  0x2f, 0x2b, 0x2b, 0x2f, 0x33, 0x2f, 0x2b, 0x2f, 0x36, 0x36, 0x36, 0x36, 0x05, 0x00, 0x20, 0x36, 0x2f, 0x17, 0x00, 0x12, 0x36, 0x15, 0x00, 0x00,
+  0x20, 0x00, 0x22, 0x2f, 0x2b, 0x05, 0x00, 0x00, 0x1c, 0x00, 0x01, 0x01, 0x00, 0xa0, 0x3c, 0x3d, 0x3c, 0x3c, 0x36, 0x3c, 0x36, 0x3c, 0x3c, 0x3d,
+  0x0a, 0x00, 0x30, 0x3c, 0x3c, 0xfe, 0x05, 0x00, 0x02, 0x01, 0x00, 0x10, 0x3d, 0x03, 0x00, 0x32, 0x50, 0xff, 0x51, 0x02, 0x00, 0x00, 0x65, 0x01,
+  0x20, 0x50, 0x51, 0xee, 0x01, 0x22, 0x51, 0xff, 0x6a, 0x01, 0x01, 0x05, 0x00, 0x03, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x09, 0x00, 0x00, 0xb2,
+  0x01, 0x01, 0x0c, 0x00, 0x01, 0x0f, 0x00, 0x02, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x15, 0x00, 0x02, 0xd0, 0x01, 0x01, 0x41, 0x00, 0x00, 0x24,
+  0x02, 0x00, 0x06, 0x00, 0x04, 0x12, 0x00, 0x02, 0x01, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x01, 0x00, 0x01, 0xdc, 0x01, 0x01, 0x55, 0x00, 0x00, 0x0c,
+  0x00, 0x04, 0x24, 0x00, 0x00, 0x0f, 0x00, 0x01, 0x24, 0x00, 0x00, 0x05, 0x00, 0x01, 0x01, 0x00, 0x40, 0x4c, 0x49, 0x49, 0x47, 0xa7, 0x00, 0x40,
+  0x36, 0x24, 0x2b, 0xa1, 0xe2, 0x01, 0x51, 0x24, 0xa0, 0x9e, 0xb6, 0xa0, 0x3d, 0x01, 0xb0, 0xa1, 0xa1, 0xa0, 0xa0, 0xb6, 0xa0, 0xa1, 0x24, 0x2f,
+  0x36, 0x49, 0x01, 0x00, 0x10, 0x4c, 0x05, 0x00, 0x04, 0x01, 0x00, 0xf2, 0x0e, 0x42, 0x36, 0x24, 0x24, 0xa0, 0xb6, 0xa1, 0xfd, 0x2f, 0x36, 0x49,
+  0xfe, 0x49, 0xfe, 0xfe, 0x3d, 0x3d, 0xf8, 0x36, 0xf8, 0x36, 0xf8, 0x24, 0xb6, 0xb5, 0xa9, 0xc2, 0xa9, 0xb3, 0x01, 0x00, 0x41, 0xb4, 0xb3, 0xc2,
+  0xb3, 0x98, 0x01, 0x12, 0xb5, 0xed, 0x01, 0x20, 0xac, 0xc2, 0xe0, 0x01, 0x00, 0x05, 0x00, 0x01, 0xe7, 0x01, 0x41, 0xb3, 0xb2, 0xb2, 0xb2, 0xca,
+  0x01, 0x40, 0xab, 0xaf, 0xaf, 0xaf, 0x06, 0x00, 0x00, 0x08, 0x00, 0x31, 0xae, 0xae, 0xaf, 0x0e, 0x00, 0x10, 0xaf, 0xf1, 0x01, 0x60, 0xb1, 0xb3,
+  0xb2, 0xb3, 0xb4, 0xc2, 0x48, 0x00, 0x20, 0xac, 0xc2, 0x41, 0x00, 0x60, 0xb5, 0xb6, 0xb5, 0xb6, 0xb6, 0xb6, 0xe4, 0x01, 0x00, 0xe2, 0x01, 0x12,
+  0xa1, 0xe3, 0x01, 0x90, 0x1c, 0xd5, 0x1c, 0xa1, 0x1c, 0xa1, 0x1c, 0xd5, 0x24, 0x04, 0x00, 0x91, 0x24, 0x24, 0x24, 0xa1, 0x24, 0x24, 0x24, 0xd5,
+  0x1c, 0xe3, 0x01, 0x03, 0x03, 0x00, 0x00, 0xe9, 0x01, 0x00, 0x01, 0x00, 0x10, 0x2f, 0xc3, 0x01, 0x10, 0x36, 0xba, 0x01, 0x08, 0xbf, 0x01, 0x00,
+  0x0b, 0x00, 0x02, 0x02, 0x00, 0x60, 0x33, 0x2f, 0x36, 0x2f, 0x36, 0x2b, 0xeb, 0x01, 0x10, 0x36, 0xea, 0x01, 0x00, 0x1d, 0x00, 0x05, 0x01, 0x00,
+  0x00, 0xda, 0x01, 0x01, 0x25, 0x01, 0x00, 0x06, 0x00, 0x00, 0xee, 0x01, 0x02, 0xdc, 0x01, 0x01, 0x06, 0x00, 0x83, 0x3d, 0xff, 0x51, 0xf4, 0x51,
+  0xf4, 0x51, 0xff, 0xc7, 0x03, 0x01, 0x99, 0x01, 0x05, 0x6a, 0x01, 0x00, 0x68, 0x01, 0x07, 0x0d, 0x00, 0x00, 0x0f, 0x00, 0x01, 0x07, 0x00, 0x00,
+  0x14, 0x00, 0x0f, 0x01, 0x00, 0x01, 0x01, 0x1c, 0x00, 0x13, 0x4d, 0xd9, 0x01, 0x01, 0x01, 0x00, 0x01, 0x09, 0x00, 0x01, 0x05, 0x00, 0x04, 0x01,
+  0x00, 0x00, 0x3d, 0x00, 0x03, 0x01, 0x00, 0x00, 0x31, 0x00, 0x00, 0x01, 0x00, 0x01, 0x35, 0x00, 0x01, 0x01, 0x00, 0x10, 0x4d, 0xc7, 0x03, 0x00,
+  0x07, 0x00, 0x00, 0x17, 0x00, 0x00, 0x19, 0x00, 0x01, 0xe3, 0x01, 0x40, 0x3c, 0x2f, 0x3c, 0x33, 0xc6, 0x03, 0x31, 0xfd, 0x24, 0x24, 0x36, 0x01,
+  0x00, 0x01, 0x00, 0x10, 0xa0, 0x8f, 0x03, 0x30, 0xb5, 0xac, 0x9e, 0xcf, 0x03, 0xd0, 0x3d, 0x3c, 0xfe, 0xfe, 0xfe, 0xfe, 0x47, 0xfe, 0x42, 0xfe,
+  0x42, 0x3d, 0x42, 0x08, 0x00, 0x70, 0x3c, 0x3c, 0x3c, 0xf9, 0x42, 0x3d, 0x47, 0xde, 0x03, 0xf1, 0x0c, 0x47, 0x49, 0x49, 0x47, 0xfe, 0x3c, 0x36,
+  0xa0, 0x3c, 0xfe, 0x47, 0xfe, 0x3d, 0x24, 0xa1, 0xb6, 0x9e, 0xac, 0xac, 0xb3, 0xb3, 0xb3, 0xb2, 0xa8, 0xbd, 0xa8, 0xb2, 0x9c, 0x01, 0x00, 0xd1,
+  0x01, 0x00, 0xa2, 0x01, 0x01, 0x02, 0x00, 0x51, 0xc2, 0xb3, 0xc2, 0xac, 0xb3, 0xb4, 0x01, 0x60, 0xb4, 0xa8, 0xb2, 0xa8, 0xb2, 0xb1, 0xad, 0x03,
+  0x01, 0xda, 0x01, 0xb1, 0xaf, 0xaf, 0xae, 0xa6, 0xae, 0xae, 0xae, 0xae, 0xaa, 0xae, 0xad, 0xe7, 0x01, 0x41, 0xab, 0xaf, 0xab, 0xab, 0x40, 0x00,
+  0x42, 0xb4, 0xa9, 0xb4, 0xac, 0x28, 0x02, 0x12, 0xb6, 0x02, 0x00, 0x11, 0xb6, 0x04, 0x00, 0x00, 0x84, 0x02, 0x00, 0xa5, 0x00, 0x00, 0xbc, 0x03,
+  0x60, 0xa1, 0x1c, 0xa1, 0xa1, 0x24, 0xa1, 0x0a, 0x00, 0x00, 0xc6, 0x03, 0x50, 0xd5, 0x1c, 0xd5, 0x24, 0xd5, 0xc0, 0x03, 0x00, 0xd5, 0x01, 0x41,
+  0x2b, 0x2b, 0x2f, 0x24, 0x02, 0x00, 0x00, 0xc2, 0x01, 0x21, 0x2b, 0x2f, 0x09, 0x00, 0x01, 0x0a, 0x00, 0x00, 0xce, 0x03, 0x00, 0x01, 0x00, 0x10,
+  0x2f, 0xe3, 0x01, 0x00, 0x06, 0x00, 0x00, 0xbb, 0x03, 0x00, 0xdb, 0x01, 0x41, 0x36, 0x36, 0x33, 0x2f, 0x07, 0x00, 0x02, 0x1d, 0x00, 0x00, 0xf5,
+  0x03, 0x31, 0x36, 0x36, 0x3c, 0xc6, 0x03, 0x40, 0x3d, 0x3c, 0x36, 0x3d, 0xbf, 0x03, 0x00, 0x0a, 0x00, 0x00, 0xee, 0x01, 0x03, 0x02, 0x00, 0x21,
+  0xff, 0xfb, 0xe1, 0x01, 0x00, 0xe3, 0x01, 0x03, 0x01, 0x00, 0x00, 0x6e, 0x01, 0x01, 0x5d, 0x01, 0x00, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0a,
+  0x00, 0x01, 0x8d, 0x01, 0x08, 0x02, 0x00, 0x07, 0x01, 0x00, 0x10, 0x4c, 0x03, 0x00, 0x05, 0x54, 0x05, 0x00, 0x01, 0x00, 0x00, 0x21, 0x00, 0x02,
+  0x4b, 0x00, 0x02, 0x01, 0x00, 0x03, 0xe2, 0x01, 0x01, 0x16, 0x00, 0x02, 0x14, 0x00, 0x09, 0x42, 0x00, 0x03, 0x14, 0x00, 0x01, 0x15, 0x00, 0x08,
+  0x18, 0x00, 0x02, 0x0d, 0x00, 0x00, 0x9b, 0x03, 0x30, 0xfe, 0x3c, 0x2f, 0xd5, 0x00, 0xb0, 0x2f, 0x1c, 0xa1, 0xa0, 0xb6, 0x9e, 0xa0, 0x9e, 0xb6,
+  0x9e, 0xb6, 0x52, 0x05, 0x02, 0x01, 0x00, 0x50, 0xb5, 0xb5, 0x9e, 0x9e, 0xa0, 0x30, 0x03, 0x11, 0xa1, 0xbd, 0x05, 0x40, 0x3d, 0x3c, 0xfe, 0x47,
+  0xc5, 0x03, 0x02, 0xd4, 0x03, 0x00, 0x04, 0x00, 0x02, 0xe7, 0x01, 0xa0, 0x49, 0x49, 0x3c, 0x2f, 0x36, 0x3d, 0x36, 0xfd, 0xa0, 0xb5, 0xe2, 0x01,
+  0x00, 0xc2, 0x03, 0x00, 0x5d, 0x05, 0x01, 0x02, 0x00, 0x50, 0xc2, 0xc2, 0xb3, 0xb4, 0xc2, 0x06, 0x00, 0x03, 0x0c, 0x00, 0x01, 0x98, 0x03, 0x20,
+  0xb4, 0xb2, 0x01, 0x00, 0x00, 0x91, 0x05, 0x10, 0xb1, 0xe5, 0x01, 0x20, 0xab, 0xae, 0xe9, 0x01, 0x51, 0xae, 0xa6, 0xaf, 0xaf, 0xae, 0x0f, 0x00,
+  0xa0, 0xaf, 0xb1, 0xb2, 0xb3, 0xb2, 0xb3, 0xc2, 0xc2, 0xc2, 0xac, 0x68, 0x02, 0x10, 0xac, 0xe1, 0x01, 0x04, 0xe6, 0x01, 0x00, 0x01, 0x00, 0x40,
+  0xa1, 0xa1, 0xa0, 0xb6, 0xe3, 0x01, 0x01, 0x01, 0x00, 0x10, 0x1c, 0xeb, 0x01, 0x01, 0x01, 0x00, 0x10, 0x24, 0x04, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0xae, 0x05, 0x20, 0x24, 0xfd, 0xcd, 0x01, 0x40, 0x2f, 0x2b, 0xfd, 0x2b, 0x96, 0x03, 0x22, 0x2b, 0x2f, 0x10, 0x00, 0x11, 0x36, 0x14, 0x00, 0x01,
+  0xba, 0x01, 0x00, 0xc1, 0x01, 0x00, 0x9d, 0x05, 0x01, 0x04, 0x00, 0x02, 0x01, 0x00, 0x04, 0x08, 0x00, 0x00, 0x01, 0x00, 0x10, 0x3d, 0x05, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0xca, 0x01, 0x00, 0x0e, 0x00, 0x03, 0xb5, 0x03, 0x07, 0xe1, 0x01, 0x00, 0xdb, 0x01, 0x00, 0x02, 0x00, 0x15, 0xff, 0xa4,
+  0x05, 0x03, 0x01, 0x00, 0x00, 0x74, 0x01, 0x00, 0x5f, 0x01, 0x04, 0x08, 0x00, 0x00, 0x7c, 0x01, 0x02, 0x0b, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x05,
+  0x00, 0x01, 0x02, 0x00, 0x04, 0x01, 0x00, 0x01, 0xe2, 0x01, 0x12, 0xfc, 0xe6, 0x01, 0x00, 0x28, 0x00, 0x07, 0x01, 0x00, 0x09, 0x57, 0x00, 0x04,
+  0x01, 0x00, 0x01, 0x3b, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x04, 0x00, 0x0d, 0x01, 0x00, 0x20,
+  0x4c, 0x4d, 0x5d, 0x07, 0x01, 0xa9, 0x01, 0x00, 0x8b, 0x03, 0x10, 0x24, 0x2e, 0x01, 0x00, 0x04, 0x05, 0x00, 0xe2, 0x01, 0x00, 0x9f, 0x01, 0x00,
+  0x01, 0x00, 0x00, 0x5c, 0x01, 0x00, 0x01, 0x00, 0x61, 0x9e, 0xb5, 0xb5, 0xb5, 0xa0, 0xa0, 0xe5, 0x01, 0x01, 0xdd, 0x01, 0x04, 0x02, 0x00, 0x02,
+  0x05, 0x00, 0x00, 0xdd, 0x03, 0x30, 0x3c, 0xd5, 0xa0, 0x64, 0x07, 0x30, 0xb3, 0xb3, 0xac, 0xdf, 0x01, 0x12, 0xb3, 0xb0, 0x03, 0x20, 0xb4, 0xb3,
+  0xd0, 0x03, 0x01, 0x91, 0x03, 0x00, 0x0d, 0x00, 0x10, 0xc2, 0x05, 0x00, 0x30, 0xbd, 0xa8, 0xbd, 0x87, 0x07, 0x40, 0xb1, 0xb2, 0xb1, 0xb1, 0x8c,
+  0x07, 0x00, 0x93, 0x05, 0x00, 0xeb, 0x01, 0x01, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x11, 0xb1, 0x29, 0x00, 0x60, 0xc2, 0xc2, 0xb5, 0xc2, 0xb5, 0xac,
+  0x4c, 0x04, 0x02, 0xe1, 0x01, 0x27, 0xb5, 0xb6, 0x88, 0x07, 0x00, 0xd6, 0x01, 0x10, 0x1c, 0xd7, 0x01, 0x02, 0x01, 0x00, 0x00, 0xbd, 0x03, 0x00,
+  0x08, 0x00, 0x00, 0x05, 0x00, 0x13, 0x1c, 0xe7, 0x01, 0x00, 0xb5, 0x03, 0x00, 0xb1, 0x03, 0x00, 0x7a, 0x05, 0x03, 0x09, 0x00, 0x00, 0x0b, 0x00,
+  0x00, 0xac, 0x03, 0x04, 0xe4, 0x01, 0x03, 0x10, 0x00, 0x02, 0x02, 0x00, 0x00, 0x26, 0x00, 0x00, 0xd1, 0x01, 0x02, 0x01, 0x00, 0x10, 0x3c, 0x05,
+  0x00, 0x02, 0x01, 0x00, 0x10, 0x3d, 0xc5, 0x03, 0x11, 0x36, 0xa4, 0x05, 0x00, 0x02, 0x00, 0x00, 0xcf, 0x03, 0x01, 0x09, 0x00, 0x10, 0x50, 0xdd,
+  0x01, 0x80, 0xf4, 0x51, 0xf4, 0x50, 0xff, 0xff, 0xff, 0xff, 0x5b, 0x05, 0x00, 0x02, 0x00, 0x01, 0x80, 0x01, 0x00, 0x73, 0x01, 0x00, 0x02, 0x00,
+  0x00, 0x05, 0x00, 0x00, 0xd8, 0x01, 0x00, 0x0c, 0x00, 0x01, 0x09, 0x00, 0x00, 0x01, 0x00, 0x03, 0x07, 0x00, 0x0b, 0x01, 0x00, 0x02, 0xdf, 0x01,
+  0x00, 0x01, 0x00, 0x00, 0xc3, 0x01, 0x0f, 0x01, 0x00, 0x07, 0x00, 0x61, 0x00, 0x00, 0x01, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x2d, 0x00, 0x01, 0x2f,
+  0x00, 0x00, 0x0a, 0x00, 0x0c, 0x01, 0x00, 0x01, 0x36, 0x02, 0x02, 0x08, 0x00, 0x01, 0xa2, 0x01, 0x11, 0x49, 0x51, 0x07, 0x60, 0x36, 0xfd, 0xfd,
+  0x24, 0xa1, 0xb6, 0xe1, 0x01, 0x60, 0xc2, 0xa9, 0xc2, 0xb3, 0xc2, 0xb3, 0x06, 0x00, 0x01, 0x06, 0x07, 0x00, 0x59, 0x01, 0x01, 0x5b, 0x01, 0x80,
+  0xa1, 0xa0, 0xa1, 0x24, 0xfd, 0x3c, 0x3d, 0xfe, 0xe6, 0x01, 0x02, 0xdc, 0x01, 0x01, 0x05, 0x00, 0x00, 0x01, 0x00, 0xf0, 0x04, 0x3c, 0x3d, 0x2f,
+  0xfd, 0xa1, 0xa1, 0xb6, 0xd2, 0xb6, 0xd5, 0xb6, 0xa1, 0xcd, 0xa1, 0xcd, 0xb6, 0xb5, 0xac, 0xc2, 0xac, 0x03, 0x00, 0xc8, 0x01, 0x31, 0xb1, 0xb1,
+  0xb1, 0x08, 0x00, 0x00, 0xb9, 0x03, 0x10, 0xb3, 0x03, 0x00, 0x01, 0x87, 0x07, 0x00, 0x06, 0x00, 0x00, 0x1b, 0x00, 0x20, 0xab, 0xb2, 0x90, 0x07,
+  0x20, 0xb1, 0xb1, 0x80, 0x07, 0x20, 0xb1, 0xb0, 0x23, 0x00, 0x00, 0xe9, 0x03, 0x00, 0xe3, 0x05, 0x00, 0xd8, 0x01, 0x00, 0x01, 0x00, 0x01, 0xbe,
+  0x03, 0x03, 0x85, 0x00, 0x00, 0x01, 0x00, 0x00, 0xe0, 0x01, 0x00, 0xcd, 0x01, 0x00, 0xb6, 0x03, 0x03, 0x01, 0x00, 0x11, 0x24, 0x02, 0x00, 0x00,
+  0xf6, 0x01, 0x00, 0xa7, 0x05, 0x31, 0x24, 0xfd, 0x2b, 0xc7, 0x03, 0x03, 0x99, 0x05, 0x00, 0xab, 0x05, 0x00, 0x0a, 0x00, 0x01, 0xe8, 0x01, 0x00,
+  0xcf, 0x01, 0x00, 0x05, 0x00, 0x02, 0x01, 0x00, 0x01, 0x08, 0x00, 0x01, 0x12, 0x00, 0x06, 0x01, 0x00, 0x00, 0xb1, 0x03, 0x11, 0x3d, 0x03, 0x00,
+  0x00, 0xd8, 0x01, 0x01, 0x08, 0x00, 0x00, 0xa4, 0x05, 0x0a, 0x02, 0x00, 0x01, 0xdd, 0x01, 0x36, 0x51, 0xff, 0x50, 0xa7, 0x05, 0x00, 0x02, 0x00,
+  0x02, 0x01, 0x00, 0x06, 0xe4, 0x01, 0x02, 0x02, 0x00, 0x03, 0x03, 0x00, 0x00, 0x05, 0x00, 0x06, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x2d, 0x00, 0x04, 0x11, 0x00, 0x01, 0x29, 0x00, 0x00, 0x43, 0x00, 0x0f, 0x01, 0x00, 0x06, 0x05, 0xe3, 0x01, 0x00, 0x05, 0x00, 0x00, 0x01,
+  0x00, 0x04, 0x3d, 0x00, 0x01, 0x01, 0x00, 0x05, 0x09, 0x00, 0x10, 0x49, 0xe2, 0x01, 0x03, 0x9d, 0x01, 0x20, 0x3d, 0x3d, 0xa1, 0x02, 0x00, 0x9e,
+  0x01, 0x10, 0xa0, 0x3e, 0x01, 0x01, 0xa1, 0x05, 0x01, 0x83, 0x03, 0x00, 0x82, 0x03, 0x12, 0xc2, 0x67, 0x01, 0x10, 0xcd, 0x5f, 0x01, 0x10, 0xa1,
+  0x1f, 0x00, 0x00, 0xe7, 0x01, 0x53, 0xb6, 0x9e, 0xa1, 0xd5, 0xfd, 0xe6, 0x01, 0x06, 0x01, 0x00, 0xf2, 0x0a, 0xfe, 0xfe, 0xfe, 0xf9, 0xf8, 0xf8,
+  0xf8, 0xeb, 0xeb, 0xeb, 0xeb, 0xea, 0xfd, 0xd7, 0xd5, 0xd2, 0xcd, 0xb5, 0xb4, 0xb3, 0xb2, 0xb1, 0xb1, 0xb0, 0xab, 0x02, 0x00, 0x00, 0x05, 0x00,
+  0x20, 0xb1, 0xb1, 0x03, 0x00, 0x00, 0xde, 0x01, 0x00, 0xad, 0x03, 0x00, 0x87, 0x07, 0x00, 0x01, 0x00, 0x14, 0xae, 0x62, 0x09, 0x00, 0x14, 0x00,
+  0x30, 0xb0, 0xb3, 0xb4, 0xc1, 0x07, 0x12, 0xc2, 0xa1, 0x09, 0x01, 0x42, 0x04, 0x14, 0xcd, 0x62, 0x02, 0x03, 0x01, 0x00, 0x00, 0xe0, 0x01, 0x03,
+  0x9b, 0x05, 0x31, 0xa0, 0xa1, 0xb6, 0x08, 0x00, 0x02, 0xbf, 0x03, 0x20, 0x24, 0xd5, 0x88, 0x07, 0x00, 0xdb, 0x01, 0x20, 0xd5, 0x24, 0xe9, 0x01,
+  0x00, 0x0b, 0x00, 0x06, 0xde, 0x01, 0x12, 0x36, 0x07, 0x00, 0x02, 0x06, 0x00, 0x00, 0xd5, 0x01, 0x00, 0xcd, 0x01, 0x01, 0x01, 0x00, 0x05, 0x0c,
+  0x00, 0x02, 0xcc, 0x01, 0x02, 0x02, 0x00, 0x01, 0x01, 0x00, 0x00, 0xcb, 0x01, 0x01, 0xc1, 0x03, 0x00, 0x06, 0x00, 0x08, 0x02, 0x00, 0x02, 0xd5,
+  0x01, 0x23, 0xff, 0xfb, 0xc8, 0x03, 0x17, 0xff, 0x88, 0x07, 0x01, 0xa3, 0x01, 0x03, 0x6b, 0x01, 0x04, 0x08, 0x00, 0x05, 0x01, 0x00, 0x04, 0x11,
+  0x00, 0x00, 0x06, 0x00, 0x01, 0x26, 0x00, 0x00, 0x33, 0x00, 0x01, 0xb6, 0x01, 0x00, 0x0c, 0x00, 0x00, 0x02, 0x00, 0x06, 0x01, 0x00, 0x00, 0x16,
+  0x00, 0x0e, 0x01, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x08, 0x00, 0x06, 0x01, 0x00, 0x00, 0x4b, 0x00, 0x01, 0x02, 0x00, 0x08, 0x01, 0x00, 0x10, 0x4c,
+  0x7e, 0x07, 0x32, 0x3d, 0x3c, 0xfd, 0x5c, 0x09, 0x00, 0xb5, 0x01, 0x01, 0x3a, 0x01, 0x00, 0x06, 0x00, 0x51, 0xcd, 0xb6, 0xcf, 0xb6, 0xcd, 0xfd,
+  0x0a, 0x01, 0xc6, 0x03, 0x01, 0x2a, 0x09, 0x54, 0xb5, 0xb5, 0xcd, 0xb6, 0xcd, 0x2b, 0x05, 0x00, 0x25, 0x00, 0x90, 0xb6, 0xb5, 0xa0, 0xa1, 0xa1,
+  0x2f, 0x2f, 0x3d, 0x3d, 0x80, 0x09, 0x20, 0xfe, 0x47, 0x80, 0x09, 0x70, 0x36, 0x24, 0x24, 0xb6, 0x9e, 0xb5, 0x9e, 0x20, 0x02, 0x00, 0x8a, 0x07,
+  0x21, 0xa8, 0xbd, 0xde, 0x01, 0x03, 0xe1, 0x01, 0x21, 0xb1, 0xb0, 0xdc, 0x01, 0x00, 0xc3, 0x01, 0x00, 0x23, 0x0d, 0x11, 0xb0, 0x6d, 0x07, 0x60,
+  0xab, 0xaf, 0xaf, 0xae, 0xaf, 0xad, 0x63, 0x09, 0xe0, 0xab, 0xaf, 0xaf, 0xab, 0xb0, 0xb1, 0xab, 0xb0, 0xb1, 0xb2, 0xbd, 0xb2, 0xbd, 0xb4, 0xd7,
+  0x01, 0x00, 0x39, 0x04, 0x11, 0xb5, 0xa7, 0x05, 0x00, 0x42, 0x04, 0x02, 0x74, 0x00, 0x05, 0x01, 0x00, 0x00, 0xd1, 0x01, 0x00, 0xd9, 0x01, 0x01,
+  0xb8, 0x00, 0x03, 0x93, 0x07, 0x31, 0x1c, 0xd5, 0xd5, 0xc6, 0x03, 0x10, 0x24, 0x6b, 0x09, 0x00, 0x02, 0x00, 0x00, 0x8c, 0x07, 0x10, 0xfd, 0xbf,
+  0x03, 0x42, 0x2f, 0x2f, 0x2f, 0xfd, 0x84, 0x05, 0x03, 0x01, 0x00, 0x00, 0xd3, 0x01, 0x08, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x00, 0xe5, 0x02, 0x01,
+  0xa8, 0x03, 0x10, 0x36, 0xf1, 0x02, 0x00, 0x0f, 0x00, 0x00, 0x7b, 0x07, 0x00, 0x05, 0x00, 0x01, 0x18, 0x00, 0x01, 0xd6, 0x01, 0x06, 0x02, 0x00,
+  0x22, 0xf4, 0x50, 0x42, 0x0b, 0x13, 0xfb, 0xba, 0x03, 0x02, 0xdf, 0x01, 0x01, 0x66, 0x01, 0x01, 0x7f, 0x01, 0x00, 0x06, 0x00, 0x02, 0x77, 0x01,
+  0x08, 0x01, 0x00, 0x00, 0x13, 0x00, 0x00, 0x14, 0x00, 0x01, 0x23, 0x00, 0x03, 0x01, 0x00, 0x00, 0xd9, 0x05, 0x02, 0x3e, 0x00, 0x00, 0x01, 0x00,
+  0x07, 0x19, 0x00, 0x02, 0x01, 0x00, 0x02, 0x1b, 0x00, 0x05, 0x32, 0x00, 0x05, 0x09, 0x00, 0x05, 0x01, 0x00, 0x00, 0x56, 0x00, 0x01, 0x05, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0xb8, 0x03, 0x01, 0x02, 0x00, 0x40, 0xfc, 0x4c, 0xfe, 0x36, 0xff, 0x0e, 0x20, 0xa1, 0x1c, 0x77, 0x07, 0x00, 0x59, 0x09,
+  0x04, 0x43, 0x01, 0x10, 0xcd, 0xdd, 0x01, 0x00, 0x82, 0x07, 0x00, 0xda, 0x01, 0x00, 0x28, 0x05, 0x10, 0xb3, 0x93, 0x0e, 0x00, 0x56, 0x03, 0x10,
+  0xc2, 0x19, 0x07, 0x00, 0x17, 0x00, 0x02, 0x02, 0x00, 0x00, 0x6e, 0x07, 0x51, 0xb5, 0xa1, 0xd5, 0xfd, 0xfd, 0x07, 0x01, 0x50, 0x3d, 0x2f, 0xfd,
+  0xfd, 0xa1, 0x97, 0x05, 0x21, 0xb4, 0xb3, 0x80, 0x05, 0x01, 0x01, 0x00, 0x31, 0xb0, 0xb1, 0xb0, 0xdb, 0x01, 0x01, 0xa1, 0x05, 0x01, 0x02, 0x00,
+  0x00, 0x19, 0x00, 0x00, 0xf0, 0x01, 0x11, 0xb0, 0xbc, 0x03, 0x10, 0xab, 0xbd, 0x03, 0x01, 0xc0, 0x03, 0x10, 0xae, 0xc0, 0x03, 0xf1, 0x00, 0xb0,
+  0xab, 0xb1, 0xb3, 0xb2, 0xbd, 0xb3, 0xc2, 0xb5, 0xd2, 0xd5, 0xcf, 0xb5, 0xb6, 0xc8, 0xe1, 0x01, 0x02, 0x01, 0x00, 0x00, 0x36, 0x06, 0x02, 0xa1,
+  0x00, 0x02, 0x06, 0x00, 0x00, 0x2b, 0x0d, 0x0b, 0x01, 0x00, 0x10, 0xd5, 0xc0, 0x03, 0x01, 0xe3, 0x01, 0x00, 0xdd, 0x01, 0x00, 0xdf, 0x01, 0x00,
+  0x04, 0x00, 0x10, 0xfd, 0xdf, 0x01, 0x36, 0xfd, 0x2f, 0x24, 0xbf, 0x03, 0x03, 0x01, 0x00, 0x07, 0x95, 0x05, 0x00, 0xb7, 0x03, 0x00, 0x01, 0x00,
+  0x00, 0x67, 0x07, 0x03, 0xcf, 0x01, 0x00, 0xc1, 0x03, 0x00, 0x0b, 0x00, 0x03, 0x02, 0x00, 0x00, 0xe0, 0x00, 0x24, 0x3c, 0x3d, 0x04, 0x00, 0x42,
+  0x3c, 0x3d, 0x3c, 0x51, 0xba, 0x03, 0x11, 0xfb, 0xa1, 0x05, 0x01, 0x84, 0x01, 0x01, 0x05, 0x00, 0x00, 0x6f, 0x01, 0x00, 0x70, 0x01, 0x02, 0x03,
+  0x00, 0x01, 0x02, 0x00, 0x01, 0x01, 0x00, 0x02, 0x19, 0x00, 0x00, 0x01, 0x00, 0x01, 0x1a, 0x00, 0x00, 0x10, 0x00, 0x02, 0x01, 0x00, 0x20, 0xff,
+  0x50, 0xc2, 0x07, 0x01, 0xe3, 0x01, 0x02, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x16, 0x0f, 0x07, 0x01, 0x00, 0x00, 0x3a, 0x00, 0x04, 0x01, 0x00,
+  0x00, 0xda, 0x03, 0x00, 0x30, 0x00, 0x07, 0x01, 0x00, 0x00, 0x57, 0x00, 0x00, 0x91, 0x05, 0x02, 0xd9, 0x01, 0x02, 0x04, 0x00, 0x01, 0x9c, 0x05,
+  0x10, 0xf1, 0x56, 0x05, 0x40, 0x3d, 0xf9, 0xfd, 0xa1, 0x3f, 0x01, 0x01, 0x3a, 0x01, 0x00, 0xb7, 0x03, 0x00, 0xb6, 0x03, 0x00, 0xb4, 0x03, 0x00,
+  0xc6, 0x01, 0x70, 0xc8, 0xd2, 0xb6, 0xb4, 0xb4, 0xbd, 0xbd, 0x77, 0x10, 0x10, 0xb2, 0x1c, 0x09, 0x03, 0x02, 0x00, 0x11, 0xb2, 0x12, 0x00, 0x62,
+  0xbd, 0xb3, 0xbd, 0xa9, 0xc2, 0xb5, 0x6a, 0x01, 0x02, 0x9a, 0x09, 0x00, 0xdd, 0x01, 0x03, 0x59, 0x07, 0x00, 0xc9, 0x01, 0x00, 0xdb, 0x01, 0x00,
+  0xb2, 0x03, 0x50, 0xb2, 0xb2, 0xbd, 0xbd, 0xbd, 0x80, 0x07, 0x10, 0xb1, 0xf1, 0x01, 0x10, 0xb0, 0x09, 0x0d, 0x02, 0xff, 0x0e, 0x00, 0xe6, 0x01,
+  0x11, 0xae, 0x02, 0x00, 0x00, 0xa1, 0x05, 0x00, 0xc3, 0x05, 0x00, 0x04, 0x02, 0x10, 0xb2, 0x2f, 0x0f, 0x01, 0x68, 0x09, 0x00, 0x82, 0x00, 0x00,
+  0x3b, 0x04, 0x00, 0x04, 0x00, 0x20, 0xb6, 0xcd, 0xde, 0x01, 0x00, 0xa7, 0x00, 0x00, 0xaa, 0x00, 0x02, 0xe1, 0x01, 0x00, 0xc5, 0x03, 0x04, 0x06,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0xe6, 0x01, 0x01, 0x02, 0x00, 0x60, 0xfd, 0x24, 0xd5, 0xfd, 0xfd, 0xfd, 0xe1, 0x01, 0x02, 0x02, 0x00, 0x30, 0x2f,
+  0x24, 0x2f, 0x91, 0x07, 0x00, 0x0b, 0x00, 0x30, 0xfd, 0x2b, 0xfd, 0xe2, 0x01, 0x00, 0x01, 0x00, 0x01, 0xbb, 0x03, 0x40, 0x36, 0x36, 0x36, 0xf8,
+  0x05, 0x00, 0x00, 0xe9, 0x01, 0x00, 0xec, 0x01, 0x11, 0xf8, 0xb5, 0x03, 0x02, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x03, 0xd4, 0x03,
+  0x00, 0x63, 0x0a, 0x00, 0xe1, 0x01, 0x00, 0x9d, 0x05, 0x00, 0x01, 0x00, 0x12, 0x51, 0x95, 0x01, 0x01, 0x05, 0x00, 0x04, 0x01, 0x00, 0x00, 0xc2,
+  0x01, 0x00, 0x02, 0x00, 0x00, 0x8c, 0x01, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x06, 0x05, 0x00, 0x00, 0xa5, 0x01, 0x01, 0x36, 0x00, 0x00, 0xd8,
+  0x01, 0x12, 0x51, 0xe3, 0x01, 0x01, 0xcb, 0x03, 0x02, 0x48, 0x00, 0x00, 0x38, 0x00, 0x01, 0xc9, 0x01, 0x04, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x00,
+  0x10, 0x00, 0x0c, 0x19, 0x00, 0x02, 0x10, 0x00, 0x00, 0xd1, 0x01, 0x01, 0x21, 0x07, 0x11, 0x42, 0x34, 0x07, 0x01, 0x0c, 0x00, 0xe0, 0x49, 0xfe,
+  0xfe, 0x3c, 0xfe, 0x3d, 0x3c, 0x3d, 0xfe, 0x3d, 0x2f, 0xfd, 0x24, 0xd5, 0xbf, 0x03, 0xa0, 0xb5, 0xb6, 0xa1, 0xd5, 0xd5, 0xb6, 0xac, 0xac, 0xc2,
+  0xb4, 0x01, 0x00, 0x00, 0x5d, 0x01, 0x10, 0xc2, 0xf8, 0x0a, 0x00, 0x04, 0x00, 0x20, 0xbd, 0xb3, 0x9f, 0x01, 0x00, 0x02, 0x00, 0x08, 0x01, 0x00,
+  0x00, 0xb2, 0x01, 0x11, 0xbd, 0xf5, 0x01, 0x01, 0x66, 0x03, 0x00, 0x1d, 0x02, 0x40, 0xcd, 0xb5, 0xb5, 0xc8, 0x55, 0x05, 0x00, 0x3a, 0x00, 0x00,
+  0x23, 0x00, 0x10, 0xb0, 0xad, 0x01, 0x05, 0x01, 0x00, 0x00, 0xdd, 0x01, 0x01, 0xd0, 0x03, 0x01, 0xe2, 0x01, 0x00, 0x02, 0x00, 0x02, 0x01, 0x00,
+  0x02, 0x0a, 0x00, 0x20, 0xb0, 0xb0, 0x0d, 0x02, 0x00, 0x7a, 0x09, 0x50, 0xb2, 0xb1, 0xb2, 0xbd, 0xb1, 0x5c, 0x00, 0x61, 0xb2, 0xbd, 0xb4, 0xb4,
+  0xb4, 0xc2, 0xc6, 0x03, 0x00, 0xda, 0x01, 0x01, 0x80, 0x02, 0x01, 0xe1, 0x01, 0x00, 0x01, 0x00, 0x26, 0xa1, 0xb6, 0x7d, 0x07, 0x10, 0xb6, 0xd9,
+  0x01, 0x01, 0x01, 0x00, 0x11, 0xd5, 0x02, 0x00, 0x00, 0xe2, 0x01, 0x00, 0x90, 0x07, 0x00, 0x02, 0x00, 0x00, 0xd2, 0x01, 0x50, 0xd5, 0x24, 0xfd,
+  0xfd, 0x2f, 0xda, 0x01, 0x00, 0xd4, 0x01, 0x00, 0xe1, 0x01, 0x01, 0xd3, 0x03, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x00, 0x02, 0x82, 0x07, 0x01, 0xca,
+  0x01, 0x03, 0x05, 0x00, 0x02, 0x02, 0x00, 0x00, 0xa2, 0x05, 0x00, 0x01, 0x00, 0x05, 0xdd, 0x01, 0x00, 0xbc, 0x05, 0x00, 0xdf, 0x01, 0x20, 0x3c,
+  0x50, 0x92, 0x01, 0x00, 0x94, 0x01, 0x0f, 0x01, 0x00, 0x03, 0x00, 0x83, 0x01, 0x00, 0x89, 0x01, 0x03, 0x02, 0x00, 0x01, 0x05, 0x00, 0x0b, 0x02,
+  0x00, 0x02, 0x01, 0x00, 0x00, 0x42, 0x00, 0x00, 0xe3, 0x01, 0x11, 0xff, 0xda, 0x01, 0x00, 0x0e, 0x00, 0x00, 0x01, 0x00, 0x00, 0xb4, 0x01, 0x02,
+  0x23, 0x00, 0x01, 0x07, 0x00, 0x00, 0x42, 0x00, 0x00, 0xd6, 0x01, 0x05, 0x12, 0x00, 0x09, 0x02, 0x00, 0x20, 0x4d, 0x4d, 0xd0, 0x01, 0x54, 0x3c,
+  0xfe, 0x3c, 0x49, 0x3c, 0x7a, 0x14, 0x00, 0xe0, 0x01, 0x05, 0x90, 0x06, 0x30, 0xfd, 0x24, 0xfd, 0x56, 0x0e, 0x00, 0x3f, 0x01, 0x50, 0xd5, 0xa1,
+  0xb6, 0xcd, 0xb5, 0x9c, 0x01, 0x03, 0x01, 0x00, 0x00, 0x62, 0x09, 0x30, 0xb3, 0xb4, 0xb4, 0xdf, 0x01, 0x01, 0xe2, 0x01, 0x01, 0x74, 0x01, 0x00,
+  0x7f, 0x01, 0x04, 0xb7, 0x01, 0x00, 0x83, 0x01, 0x00, 0xcb, 0x03, 0x30, 0xb4, 0xc2, 0xac, 0xd7, 0x01, 0x10, 0xb5, 0x0d, 0x02, 0x30, 0xb3, 0xb4,
+  0xbd, 0x22, 0x00, 0x00, 0xbd, 0x03, 0x13, 0xb0, 0xc1, 0x03, 0x03, 0xd0, 0x03, 0x01, 0x0c, 0x00, 0x00, 0x06, 0x00, 0x16, 0xb0, 0xd5, 0x01, 0x00,
+  0x02, 0x00, 0x00, 0x1d, 0x0d, 0x00, 0xfe, 0x01, 0x00, 0x4f, 0x00, 0x01, 0x51, 0x00, 0x10, 0xbd, 0x32, 0x04, 0x00, 0xf3, 0x03, 0x11, 0xb4, 0xe1,
+  0x01, 0x02, 0x2f, 0x0d, 0x00, 0x69, 0x09, 0x02, 0xca, 0x03, 0x00, 0xe6, 0x01, 0x00, 0x01, 0x00, 0x00, 0xe2, 0x01, 0x01, 0xd3, 0x01, 0x0d, 0x01,
+  0x00, 0x01, 0xdf, 0x01, 0x51, 0xd5, 0xa1, 0xfd, 0xd5, 0xfd, 0x1d, 0x00, 0x00, 0xe3, 0x01, 0x04, 0xd2, 0x01, 0x00, 0xae, 0x05, 0x00, 0x03, 0x00,
+  0x03, 0x05, 0x00, 0x00, 0xe2, 0x01, 0x02, 0x82, 0x07, 0x02, 0xbf, 0x01, 0x00, 0xe1, 0x01, 0x01, 0x06, 0x00, 0x02, 0x7a, 0x07, 0x06, 0x02, 0x00,
+  0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x11, 0xfe, 0xab, 0x05, 0x00, 0x7d, 0x07, 0x20, 0x50, 0xfb, 0x70, 0x01, 0x05, 0x95, 0x01, 0x00, 0x7b, 0x01,
+  0x08, 0x01, 0x00, 0x01, 0x7d, 0x01, 0x00, 0xdc, 0x01, 0x04, 0x0b, 0x00, 0x01, 0x01, 0x00, 0x02, 0x09, 0x00, 0x40, 0x4d, 0x50, 0x4d, 0xfc, 0x08,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x04, 0x00, 0x07, 0x01, 0x00, 0x00, 0x25, 0x00, 0x01, 0x39, 0x00, 0x0f, 0x01, 0x00, 0x01, 0x01,
+  0x1d, 0x00, 0x01, 0x3e, 0x00, 0x00, 0x11, 0x15, 0x00, 0xbe, 0x03, 0x02, 0xe1, 0x01, 0x00, 0xa5, 0x00, 0x12, 0x3c, 0xc2, 0x0e, 0x00, 0xe0, 0x01,
+  0x00, 0x9d, 0x12, 0x00, 0x01, 0x00, 0x01, 0x0b, 0x00, 0x90, 0xf9, 0x3d, 0xf8, 0xf8, 0xfd, 0xd5, 0xd5, 0xa1, 0xa1, 0x7b, 0x07, 0x32, 0xb4, 0xb4,
+  0xb4, 0x59, 0x01, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x01, 0xdc, 0x01, 0x00, 0x77, 0x01, 0x01, 0x80, 0x01, 0x0f, 0x01, 0x00, 0x02, 0x00, 0x20,
+  0x00, 0x04, 0xfa, 0x01, 0x00, 0xcf, 0x01, 0x00, 0xd9, 0x01, 0x00, 0xcf, 0x01, 0x60, 0xb2, 0xb2, 0xbd, 0xb3, 0xb3, 0xc2, 0x01, 0x04, 0x00, 0xb6,
+  0x05, 0x00, 0xc5, 0x01, 0x00, 0xc5, 0x03, 0x20, 0xab, 0xb0, 0x97, 0x05, 0x34, 0xad, 0xaa, 0xad, 0x99, 0x05, 0x20, 0xab, 0xb2, 0x92, 0x09, 0x00,
+  0x03, 0x13, 0x22, 0xb2, 0xb4, 0xb6, 0x03, 0x00, 0x04, 0x00, 0x00, 0x05, 0x00, 0x01, 0x08, 0x00, 0x00, 0x33, 0x0d, 0x01, 0xe3, 0x01, 0x12, 0xcd,
+  0xe8, 0x09, 0x00, 0x02, 0x00, 0x01, 0xdf, 0x01, 0x01, 0xba, 0x03, 0x06, 0xe1, 0x01, 0x03, 0x09, 0x00, 0x31, 0xd5, 0x24, 0xd5, 0xba, 0x03, 0x00,
+  0xb1, 0x03, 0x61, 0x24, 0xd5, 0xfd, 0xd5, 0x24, 0xa1, 0xc0, 0x03, 0x32, 0xfd, 0x2f, 0xfd, 0xd3, 0x01, 0x00, 0x06, 0x00, 0x05, 0xee, 0x01, 0x00,
+  0x01, 0x00, 0x00, 0x9e, 0x05, 0x11, 0x2f, 0xac, 0x03, 0x10, 0x3d, 0xab, 0x05, 0x00, 0xca, 0x01, 0x00, 0x0a, 0x00, 0x01, 0x07, 0x00, 0x04, 0x04,
+  0x00, 0x00, 0x85, 0x07, 0x10, 0xfe, 0x9c, 0x05, 0x10, 0xf9, 0x85, 0x07, 0x20, 0xf4, 0xff, 0x7f, 0x07, 0x00, 0x97, 0x01, 0x04, 0x77, 0x03, 0x00,
+  0x71, 0x01, 0x0d, 0x01, 0x00, 0x4f, 0x4d, 0x50, 0x4d, 0xff, 0x19, 0x00, 0x02, 0x08, 0x2f, 0x00, 0x01, 0x3f, 0x00, 0x03, 0xb3, 0x01, 0x00, 0x32,
+  0x00, 0x00, 0x07, 0x00, 0x03, 0x17, 0x00, 0x00, 0x04, 0x00, 0x03, 0x07, 0x00, 0x04, 0x68, 0x00, 0x05, 0x01, 0x00, 0x00, 0x28, 0x00, 0x01, 0xe7,
+  0x03, 0x35, 0x4d, 0x4c, 0xfc, 0xd2, 0x01, 0x00, 0x41, 0x18, 0x00, 0xd4, 0x01, 0x10, 0x2b, 0xc3, 0x15, 0x60, 0xa0, 0xa1, 0xa0, 0xa0, 0xa1, 0x2f,
+  0x95, 0x02, 0x40, 0x3d, 0x3d, 0x3d, 0xeb, 0x1e, 0x09, 0x21, 0xb5, 0xac, 0xdf, 0x01, 0x00, 0x5b, 0x01, 0x00, 0xd5, 0x01, 0x00, 0xdf, 0x01, 0x00,
+  0xd7, 0x01, 0x00, 0xbe, 0x01, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x02, 0xc0, 0x03, 0x02, 0x06, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x01, 0x19, 0x00,
+  0x11, 0xbd, 0x95, 0x01, 0xb1, 0xc8, 0xb6, 0xcd, 0xcf, 0xd2, 0xd2, 0xb6, 0xcf, 0xb6, 0xd2, 0xcd, 0x01, 0x00, 0x00, 0xbc, 0x05, 0x30, 0xb3, 0xbd,
+  0xb3, 0xbd, 0x12, 0x40, 0xab, 0xaf, 0xb1, 0xb3, 0xb3, 0x01, 0xf3, 0x00, 0xcd, 0xb5, 0xcd, 0xcd, 0xb6, 0xcf, 0xd2, 0xd2, 0xd2, 0xcf, 0xcd, 0xc5,
+  0xb5, 0xc2, 0xc2, 0x6a, 0x00, 0x01, 0xdc, 0x01, 0x01, 0xde, 0x01, 0x00, 0x8e, 0x00, 0x00, 0xc7, 0x03, 0x01, 0xe3, 0x01, 0x00, 0xc8, 0x03, 0x02,
+  0xbe, 0x03, 0x80, 0xb6, 0xb6, 0xb6, 0xd2, 0xa0, 0xcd, 0xa0, 0xcd, 0xd1, 0x01, 0x03, 0x03, 0x00, 0x01, 0xa3, 0x02, 0x00, 0x09, 0x00, 0x00, 0x97,
+  0x05, 0x01, 0x04, 0x00, 0x00, 0x06, 0x00, 0x03, 0x02, 0x00, 0x00, 0xed, 0x01, 0x02, 0xe6, 0x01, 0x00, 0xd3, 0x01, 0x02, 0xba, 0x03, 0x02, 0x01,
+  0x00, 0x20, 0x36, 0x2f, 0x49, 0x17, 0x01, 0x06, 0x00, 0x01, 0xe2, 0x01, 0x00, 0x01, 0x00, 0x17, 0x2f, 0xe9, 0x01, 0x00, 0x07, 0x00, 0x02, 0x01,
+  0x00, 0x00, 0xdb, 0x01, 0x00, 0x7a, 0x17, 0x10, 0x3d, 0x3f, 0x0b, 0x0b, 0x70, 0x01, 0x03, 0x01, 0x00, 0x00, 0x77, 0x01, 0x01, 0x01, 0x00, 0x01,
+  0x1e, 0x00, 0x02, 0x0e, 0x00, 0x04, 0x71, 0x03, 0x04, 0x01, 0x00, 0x01, 0x1b, 0x00, 0x00, 0x98, 0x05, 0x01, 0x02, 0x00, 0x04, 0x21, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x02, 0x00, 0x01, 0x10, 0x00, 0x02, 0x1f, 0x00, 0x03, 0x07, 0x00, 0x00, 0x02, 0x00, 0x01, 0x01, 0x00, 0x01, 0x09, 0x00, 0x03,
+  0x0c, 0x00, 0x00, 0x27, 0x00, 0x10, 0xfc, 0x31, 0x00, 0x01, 0xa1, 0x05, 0x20, 0x3d, 0x36, 0x59, 0x19, 0x92, 0x24, 0xfd, 0x1c, 0xd5, 0x1c, 0xa0,
+  0xa0, 0xfd, 0x3c, 0xee, 0x01, 0x70, 0xfe, 0x3d, 0xf8, 0x2f, 0x2f, 0x2f, 0x24, 0x42, 0x0b, 0x00, 0xfa, 0x0a, 0x71, 0xc2, 0xb5, 0xcd, 0xcd, 0xcd,
+  0xd2, 0xc2, 0x58, 0x01, 0x01, 0x02, 0x00, 0x01, 0xda, 0x01, 0x00, 0x6f, 0x01, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x06, 0x01, 0x00, 0x11, 0xb1,
+  0x5c, 0x07, 0x00, 0xb0, 0x03, 0x00, 0x02, 0x00, 0x0f, 0x01, 0x00, 0x03, 0x13, 0xb4, 0x8f, 0x01, 0xf0, 0x01, 0xac, 0xb5, 0xcd, 0xd2, 0xd2, 0xd7,
+  0xea, 0xea, 0xea, 0xea, 0xd7, 0xd7, 0xd2, 0xd2, 0xcd, 0xcd, 0x52, 0x07, 0x01, 0xb6, 0x01, 0x30, 0xb2, 0xb4, 0xc2, 0xaf, 0x07, 0x10, 0xb5, 0xe1,
+  0x01, 0x91, 0xcd, 0xb6, 0xd2, 0xd2, 0xcd, 0xc2, 0xc2, 0xc8, 0xb4, 0x67, 0x00, 0x02, 0x5c, 0x02, 0x31, 0xbd, 0xbd, 0xb2, 0xdb, 0x01, 0x00, 0x2c,
+  0x00, 0x00, 0xa6, 0x05, 0x00, 0xe4, 0x01, 0x00, 0x3d, 0x00, 0x00, 0x55, 0x00, 0x00, 0x32, 0x00, 0x02, 0xc4, 0x03, 0x03, 0x7d, 0x07, 0x00, 0xe2,
+  0x01, 0x00, 0x04, 0x00, 0x02, 0x03, 0x00, 0x03, 0xd9, 0x01, 0x11, 0xfd, 0x65, 0x09, 0x01, 0xeb, 0x01, 0x10, 0xd5, 0x0b, 0x00, 0x11, 0x24, 0x03,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0xd9, 0x01, 0x04, 0x01, 0x00, 0x01, 0xea, 0x01, 0x02, 0x05, 0x00, 0x00, 0xd7, 0x01, 0x01, 0xda, 0x01, 0x00, 0xec,
+  0x01, 0x41, 0xf8, 0x36, 0x3d, 0x2f, 0xdf, 0x01, 0x01, 0xe8, 0x01, 0x20, 0x3d, 0x3d, 0xda, 0x01, 0x00, 0x61, 0x09, 0x20, 0xfe, 0x3d, 0x66, 0x01,
+  0x04, 0x68, 0x01, 0x01, 0x45, 0x03, 0x00, 0x01, 0x00, 0x02, 0x06, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x00, 0xba, 0x01, 0x07, 0x01, 0x00,
+  0x03, 0x3b, 0x00, 0x03, 0xc2, 0x07, 0x03, 0x0e, 0x00, 0x01, 0x28, 0x00, 0x00, 0x0a, 0x00, 0x09, 0x2b, 0x00, 0x0f, 0x01, 0x00, 0x0d, 0x01, 0x36,
+  0x00, 0x00, 0xe2, 0x01, 0x00, 0xce, 0x10, 0x10, 0xf1, 0x9a, 0x05, 0x00, 0xc9, 0x03, 0x00, 0xfe, 0x19, 0x10, 0xd5, 0x8c, 0x12, 0x50, 0x2f, 0x2f,
+  0xf8, 0x2f, 0xeb, 0x01, 0x01, 0x40, 0xa1, 0xcd, 0xb5, 0xc2, 0xe9, 0x06, 0x00, 0x4f, 0x09, 0x00, 0x2f, 0x03, 0x03, 0x5f, 0x01, 0x00, 0x62, 0x01,
+  0x02, 0x02, 0x00, 0x00, 0x03, 0x00, 0x06, 0x01, 0x00, 0x30, 0xb1, 0xb2, 0xb0, 0x02, 0x00, 0x10, 0xb1, 0x04, 0x00, 0x22, 0xb1, 0xb0, 0x0e, 0x00,
+  0x00, 0xe7, 0x01, 0x02, 0x0a, 0x00, 0x00, 0xf2, 0x01, 0x00, 0x0a, 0x00, 0x31, 0xbd, 0xc2, 0xc8, 0xb3, 0x03, 0x00, 0x4d, 0x0f, 0x00, 0x5c, 0x0b,
+  0x10, 0xa8, 0x82, 0x05, 0x00, 0x94, 0x16, 0x00, 0x85, 0x09, 0x30, 0xb4, 0xc2, 0xb4, 0x2c, 0x1a, 0x70, 0xb3, 0xb4, 0xa8, 0xb0, 0xaf, 0xab, 0xb1,
+  0x2d, 0x0d, 0x10, 0xb1, 0x93, 0x0b, 0x00, 0x2c, 0x02, 0x00, 0x6e, 0x00, 0x04, 0x86, 0x00, 0x00, 0x7f, 0x07, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x34, 0x00, 0x41, 0xc2, 0xc2, 0xb5, 0xc5, 0xc7, 0x03, 0x00, 0xde, 0x01, 0x22, 0xd2, 0xa1, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0xe3, 0x01,
+  0x02, 0x05, 0x00, 0x11, 0xfd, 0xc0, 0x03, 0x01, 0xdb, 0x01, 0x10, 0xd5, 0x99, 0x05, 0x03, 0xd2, 0x01, 0x02, 0x06, 0x00, 0x00, 0x07, 0x00, 0x01,
+  0xc4, 0x03, 0x03, 0x02, 0x00, 0x00, 0x05, 0x00, 0x06, 0x01, 0x00, 0x00, 0xd6, 0x01, 0x01, 0x8b, 0x07, 0x01, 0xde, 0x01, 0x04, 0x98, 0x05, 0x00,
+  0xdb, 0x01, 0x00, 0x0a, 0x00, 0xb0, 0x36, 0x3d, 0x36, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0xfe, 0x10, 0x50, 0x01, 0x00, 0x10, 0xff, 0x05,
+  0x00, 0x01, 0x01, 0x00, 0x60, 0xfc, 0x50, 0x50, 0x4d, 0x50, 0x4d, 0x0a, 0x00, 0x0e, 0x01, 0x00, 0x00, 0x19, 0x00, 0x07, 0x1b, 0x00, 0x07, 0x0b,
+  0x00, 0x08, 0x42, 0x00, 0x02, 0x1a, 0x00, 0x02, 0x1d, 0x00, 0x50, 0x4d, 0x50, 0x4d, 0x4d, 0x4d, 0x35, 0x00, 0x00, 0x02, 0x00, 0x09, 0x01, 0x00,
+  0x00, 0x11, 0x00, 0x40, 0x4d, 0x50, 0x4d, 0xfc, 0x06, 0x00, 0x01, 0x01, 0x00, 0x02, 0x09, 0x00, 0x00, 0x2f, 0x00, 0x21, 0x4d, 0xfc, 0x04, 0x00,
+  0xf1, 0x00, 0xfc, 0x49, 0x4c, 0xfc, 0x4d, 0xfe, 0x24, 0xa1, 0x1c, 0xb6, 0xa0, 0xb6, 0xa0, 0xb6, 0x9e, 0x02, 0x00, 0x10, 0xb5, 0x01, 0x00, 0x41,
+  0xac, 0xc2, 0xc2, 0xb4, 0x01, 0x00, 0x10, 0xbd, 0x02, 0x00, 0x05, 0x01, 0x00, 0x14, 0xb2, 0x02, 0x00, 0x31, 0xb2, 0xba, 0xb2, 0x01, 0x00, 0x31,
+  0xb1, 0xb2, 0xb1, 0x06, 0x00, 0x30, 0xb0, 0xb1, 0xb0, 0x04, 0x00, 0x21, 0xb1, 0xb0, 0x05, 0x00, 0x04, 0x02, 0x00, 0x01, 0x05, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x01, 0x00, 0xf2, 0x06, 0xb1, 0xb4, 0xb4, 0xc2, 0xc5, 0xb5, 0xcd, 0xcd, 0xb6, 0xcd, 0xcd, 0xcd, 0xcd, 0xb6, 0xc8, 0xac, 0xb4, 0xb1,
+  0xb0, 0xb0, 0xab, 0x01, 0x00, 0x80, 0xb1, 0xab, 0xaf, 0xaf, 0xab, 0xaf, 0xaf, 0xae, 0x05, 0x00, 0x90, 0xaf, 0xaf, 0xaf, 0xab, 0xb0, 0xb1, 0xb2,
+  0xbd, 0xb3, 0x7e, 0x00, 0x21, 0xb4, 0xbd, 0x04, 0x00, 0xc1, 0xbd, 0xb4, 0xb4, 0xc2, 0xc2, 0xb4, 0xc2, 0xb4, 0xc2, 0xc2, 0xc5, 0xc2, 0x01, 0x00,
+  0x13, 0xb4, 0x04, 0x00, 0x30, 0xc2, 0xb5, 0xc2, 0xae, 0x00, 0xb0, 0xcd, 0xb6, 0xcd, 0xb6, 0xcd, 0xa1, 0xb6, 0xa1, 0xa1, 0xa1, 0xd5, 0x03, 0x00,
+  0x41, 0xd5, 0xd5, 0xd5, 0xa1, 0x0c, 0x00, 0x11, 0xd5, 0x01, 0x00, 0x50, 0x24, 0xd5, 0xd5, 0xd5, 0xfd, 0x01, 0x00, 0x22, 0x24, 0xfd, 0x08, 0x00,
+  0x61, 0xd5, 0x24, 0xfd, 0xfd, 0xfd, 0xa1, 0x04, 0x00, 0x02, 0x11, 0x00, 0x20, 0xfd, 0x2f, 0x03, 0x00, 0x31, 0x2f, 0xfd, 0x2f, 0x01, 0x00, 0x13,
+  0x36, 0x08, 0x00, 0xa0, 0x2f, 0x36, 0x2f, 0xf8, 0x36, 0x36, 0x36, 0x2f, 0x3d, 0x36, 0x06, 0x00, 0x70, 0x36, 0x36, 0x36, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x05, 0x00, 0x10, 0x36, 0x02, 0x00, 0x10, 0xf8, 0x0b, 0x00, 0x00, 0x0e, 0x00, 0x30, 0x3d, 0x3d, 0x3c, 0x5c, 0x01, 0x05, 0x01, 0x00, 0x02, 0x65,
+  0x01, 0x00, 0x05, 0x00, 0x00, 0x0a, 0x00, 0x01, 0x07, 0x00, 0x0f, 0x01, 0x00, 0x04, 0x01, 0x1e, 0x00, 0x02, 0x01, 0x00, 0x00, 0xc2, 0x01, 0x11,
+  0x50, 0xab, 0x01, 0x03, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x20, 0x00, 0x00, 0xda, 0x01, 0x31, 0xfc, 0x4d, 0xfc, 0x10, 0x00, 0x00, 0x01, 0x00,
+  0x09, 0x04, 0x02, 0x03, 0x24, 0x00, 0x01, 0x01, 0x00, 0x31, 0x4d, 0xfc, 0x4c, 0x02, 0x00, 0x03, 0x08, 0x00, 0xf1, 0x12, 0x49, 0xfc, 0x49, 0xfc,
+  0x49, 0x49, 0xfe, 0xfe, 0xfe, 0x49, 0xf1, 0x49, 0xfe, 0xfe, 0xf9, 0xfe, 0xf9, 0xf9, 0xec, 0xf8, 0xf8, 0xeb, 0xeb, 0xeb, 0xd5, 0xd2, 0xb6, 0xcd,
+  0xb5, 0xcd, 0xb5, 0xc5, 0xb5, 0xe0, 0x01, 0x00, 0x5b, 0x01, 0x00, 0xd8, 0x01, 0x07, 0x01, 0x00, 0x00, 0xdd, 0x01, 0x01, 0xde, 0x01, 0x00, 0x04,
+  0x00, 0x72, 0xb2, 0xba, 0xb2, 0xba, 0xb1, 0xb2, 0xb0, 0x02, 0x00, 0x01, 0xc7, 0x01, 0x01, 0x05, 0x00, 0x01, 0x01, 0x00, 0x06, 0x0a, 0x00, 0x04,
+  0x01, 0x00, 0xf3, 0x24, 0xb1, 0xb2, 0xbd, 0xc2, 0xc2, 0xb5, 0xc8, 0xb5, 0xcd, 0xb5, 0xc8, 0xac, 0xc5, 0xc2, 0xb4, 0xb1, 0xb7, 0xaf, 0xaf, 0xae,
+  0xae, 0xae, 0xaf, 0xae, 0xae, 0xad, 0xaa, 0xaa, 0xaa, 0x54, 0xaa, 0xa3, 0xaa, 0xa3, 0xaa, 0xad, 0xad, 0xae, 0xae, 0xaf, 0xab, 0xb0, 0xbd, 0xc2,
+  0xc2, 0xcd, 0xc8, 0xcd, 0xc8, 0xb5, 0xc8, 0x86, 0x00, 0x00, 0xe0, 0x01, 0x11, 0xc0, 0xd0, 0x01, 0x03, 0xe1, 0x01, 0x01, 0x0b, 0x00, 0x50, 0xb5,
+  0xc8, 0xb5, 0xc8, 0xb6, 0x4f, 0x00, 0x00, 0xde, 0x01, 0x11, 0xd2, 0x02, 0x00, 0x10, 0xa1, 0xdb, 0x01, 0x10, 0xd5, 0xda, 0x01, 0x00, 0xdd, 0x01,
+  0x00, 0xc0, 0x01, 0x20, 0xd5, 0xfd, 0xe2, 0x01, 0x00, 0xc5, 0x01, 0x00, 0xd9, 0x01, 0x00, 0x02, 0x00, 0x00, 0x09, 0x00, 0x20, 0xfd, 0xfd, 0x22,
+  0x00, 0x00, 0x08, 0x00, 0x02, 0xde, 0x01, 0x10, 0xfd, 0xd4, 0x01, 0x00, 0x04, 0x00, 0x06, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0xe2, 0x01, 0x10,
+  0xf8, 0xcb, 0x01, 0x00, 0x07, 0x00, 0x50, 0x3d, 0x36, 0x3d, 0xf8, 0x3d, 0x07, 0x00, 0x03, 0x0d, 0x00, 0x00, 0xdd, 0x01, 0x00, 0x04, 0x00, 0x29,
+  0x3d, 0x3d, 0x76, 0x01, 0x11, 0xff, 0x0e, 0x00, 0x00, 0x04, 0x00, 0x00, 0xc9, 0x03, 0x0e, 0x01, 0x00, 0x11, 0xfc, 0x03, 0x00, 0x00, 0x97, 0x01,
+  0x00, 0xb8, 0x01, 0x00, 0x01, 0x00, 0x00, 0x06, 0x00, 0x20, 0xfc, 0x50, 0x70, 0x03, 0x00, 0xe1, 0x01, 0x00, 0xd2, 0x01, 0x00, 0xd4, 0x01, 0x20,
+  0x50, 0x4d, 0x15, 0x00, 0x00, 0x20, 0x00, 0x00, 0x2d, 0x00, 0x03, 0x09, 0x00, 0x04, 0x5a, 0x00, 0x03, 0x01, 0x00, 0x00, 0xfb, 0x01, 0x01, 0x02,
+  0x00, 0x40, 0x4d, 0x50, 0x4d, 0x49, 0xb9, 0x00, 0x30, 0x3d, 0x49, 0xfe, 0x96, 0x00, 0x80, 0xf8, 0x2f, 0xf8, 0x2f, 0x2f, 0xf8, 0x2f, 0xeb, 0xe6,
+  0x00, 0x00, 0xea, 0x02, 0x01, 0x0e, 0x01, 0x70, 0xfd, 0xd5, 0xfd, 0xea, 0xd5, 0xd5, 0xcd, 0x10, 0x03, 0x48, 0xb5, 0xb5, 0xc2, 0xc2, 0xdb, 0x01,
+  0x02, 0x0a, 0x00, 0x01, 0xdb, 0x01, 0x01, 0xd4, 0x01, 0x00, 0x05, 0x00, 0x20, 0xb2, 0xb2, 0xd5, 0x01, 0x02, 0x02, 0x00, 0x02, 0xa4, 0x03, 0x00,
+  0x04, 0x00, 0x08, 0x01, 0x00, 0x50, 0xab, 0xb0, 0xab, 0xb7, 0xab, 0x06, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x01, 0x00, 0x10, 0xb2, 0x4a, 0x00, 0x00,
+  0xb0, 0x01, 0x60, 0xbd, 0xbd, 0xb1, 0xb0, 0xb1, 0xb7, 0xae, 0x03, 0x30, 0xad, 0xae, 0xaa, 0xde, 0x01, 0x01, 0x01, 0x00, 0x10, 0x53, 0x05, 0x00,
+  0xa0, 0xaa, 0xb1, 0xb0, 0xaf, 0xb7, 0xab, 0xb1, 0xb7, 0xb2, 0xb2, 0xd7, 0x01, 0x21, 0xb4, 0xc0, 0x2f, 0x00, 0x11, 0xc0, 0xbd, 0x03, 0x11, 0xc2,
+  0xc0, 0x03, 0x01, 0xd7, 0x01, 0x40, 0xb5, 0xc8, 0xb5, 0xc2, 0x88, 0x02, 0x20, 0xcd, 0xb5, 0xbb, 0x03, 0x30, 0xb6, 0xd2, 0xb6, 0xba, 0x03, 0x30,
+  0xa1, 0xa1, 0xd2, 0x07, 0x00, 0x10, 0xd2, 0x0a, 0x00, 0x00, 0x01, 0x00, 0x00, 0xbd, 0x03, 0x04, 0x01, 0x00, 0x00, 0xdc, 0x01, 0x00, 0xd5, 0x01,
+  0x01, 0xd2, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0xe0, 0x01, 0x03, 0x02, 0x00, 0x30, 0x2f, 0x2f, 0xeb, 0x17, 0x01,
+  0x40, 0xfd, 0x2f, 0xeb, 0x2f, 0x22, 0x01, 0x02, 0x06, 0x00, 0x31, 0xf8, 0x2f, 0x36, 0xd2, 0x01, 0x02, 0x02, 0x00, 0x22, 0x3d, 0x3d, 0xe3, 0x01,
+  0x00, 0xeb, 0x01, 0x00, 0xdb, 0x01, 0x00, 0x11, 0x00, 0x19, 0x3d, 0x75, 0x01, 0x40, 0xff, 0x50, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x77, 0x01, 0x00,
+  0x10, 0x00, 0x0d, 0x01, 0x00, 0x02, 0x1e, 0x00, 0x00, 0x0a, 0x00, 0x00, 0xa1, 0x01, 0x13, 0x50, 0x26, 0x00, 0x00, 0xa5, 0x01, 0x00, 0x32, 0x00,
+  0x01, 0xaf, 0x01, 0x02, 0x0c, 0x00, 0x03, 0xf0, 0x01, 0x05, 0x02, 0x00, 0x02, 0x05, 0x00, 0x04, 0x01, 0x00, 0x51, 0x4d, 0xfc, 0x4c, 0xf1, 0x49,
+  0xa3, 0x03, 0x10, 0x3d, 0xa7, 0x03, 0xc1, 0xfe, 0xfe, 0xf8, 0xf8, 0x2f, 0x3d, 0xfe, 0xfe, 0x3d, 0x3d, 0x36, 0x2f, 0xd7, 0x01, 0x50, 0xb6, 0xa0,
+  0xb6, 0xb6, 0xb6, 0x06, 0x00, 0x11, 0xa1, 0x02, 0x00, 0x00, 0x01, 0x00, 0x11, 0xb5, 0x9d, 0x05, 0x00, 0x3d, 0x01, 0x20, 0xcc, 0xcd, 0x3a, 0x03,
+  0x00, 0x89, 0x01, 0x00, 0x05, 0x00, 0x00, 0x95, 0x01, 0x00, 0xe3, 0x01, 0x41, 0xb2, 0xba, 0xbd, 0xbd, 0xdc, 0x01, 0x10, 0xba, 0x96, 0x05, 0x00,
+  0x01, 0x00, 0x10, 0xb1, 0xe5, 0x01, 0x30, 0xb1, 0xb1, 0xb0, 0x03, 0x00, 0x00, 0xc2, 0x01, 0x05, 0x01, 0x00, 0x07, 0xd6, 0x01, 0x02, 0x09, 0x00,
+  0x02, 0x06, 0x00, 0x30, 0xb0, 0xb0, 0xb7, 0x08, 0x02, 0xc1, 0xb2, 0xb2, 0xba, 0xb0, 0xb0, 0xaf, 0xb7, 0xae, 0xae, 0xae, 0xad, 0xad, 0xd8, 0x01,
+  0x00, 0xdb, 0x01, 0xf1, 0x00, 0xa3, 0xaa, 0x54, 0xaa, 0xaa, 0xaa, 0xad, 0xa8, 0xb4, 0xc2, 0xac, 0xc2, 0xc2, 0xb3, 0xb1, 0x95, 0x05, 0x01, 0xaf,
+  0x03, 0x10, 0xc0, 0x0a, 0x00, 0x02, 0x91, 0x05, 0x12, 0xb5, 0xb8, 0x03, 0x00, 0xa8, 0x00, 0x00, 0xdd, 0x01, 0x00, 0xdc, 0x01, 0x00, 0xde, 0x01,
+  0x30, 0xd2, 0xa0, 0xd2, 0xc5, 0x01, 0x12, 0xd5, 0xc4, 0x03, 0x01, 0x06, 0x00, 0x00, 0x02, 0x00, 0x01, 0x01, 0x00, 0x00, 0xf9, 0x01, 0x00, 0x1c,
+  0x00, 0x00, 0xdf, 0x01, 0x03, 0x02, 0x00, 0x31, 0xfd, 0xd5, 0xd5, 0xb5, 0x03, 0x02, 0x06, 0x00, 0x00, 0x01, 0x00, 0x04, 0x08, 0x00, 0x00, 0xe4,
+  0x01, 0x00, 0xc2, 0x03, 0x01, 0x08, 0x00, 0x01, 0x05, 0x00, 0x11, 0xf8, 0xc3, 0x03, 0x01, 0x05, 0x00, 0x00, 0xca, 0x03, 0x03, 0x06, 0x00, 0x02,
+  0xe7, 0x01, 0x04, 0x01, 0x00, 0x00, 0x6f, 0x01, 0x00, 0xb9, 0x01, 0x02, 0xe7, 0x01, 0x00, 0x07, 0x00, 0x01, 0x09, 0x00, 0x02, 0xe4, 0x01, 0x03,
+  0xca, 0x01, 0x06, 0x01, 0x00, 0x02, 0x1e, 0x00, 0x05, 0x18, 0x00, 0x00, 0xa7, 0x03, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0xc1, 0x01, 0x00,
+  0x02, 0x00, 0x01, 0x1e, 0x00, 0x00, 0xcc, 0x01, 0x00, 0x04, 0x00, 0x02, 0x05, 0x00, 0x02, 0x4e, 0x00, 0x10, 0x4c, 0x24, 0x00, 0x00, 0x01, 0x00,
+  0xf2, 0x10, 0x4d, 0xfc, 0x4d, 0x49, 0x49, 0x3d, 0x2f, 0x2f, 0xfd, 0x2b, 0xd5, 0x1c, 0xa1, 0xa0, 0xa1, 0xa0, 0xa0, 0xa1, 0xa1, 0xa0, 0xd2, 0xa1,
+  0xd5, 0xd5, 0x2f, 0xf8, 0xf8, 0xf9, 0xfe, 0xf9, 0xfe, 0x93, 0x05, 0x51, 0xf9, 0x3d, 0xf8, 0x36, 0xeb, 0xb6, 0x02, 0x00, 0xdb, 0x00, 0x31, 0xd5,
+  0xa1, 0xcd, 0xdc, 0x01, 0x20, 0xc8, 0xb5, 0x4d, 0x01, 0x02, 0xde, 0x01, 0xd2, 0xbd, 0xbd, 0xbd, 0xc2, 0xc8, 0xc8, 0xcd, 0xcd, 0xcf, 0xcd, 0xcd,
+  0xc8, 0xb4, 0xc1, 0x03, 0x20, 0xba, 0xbd, 0xe1, 0x01, 0x00, 0x21, 0x07, 0x21, 0xb3, 0xb3, 0x11, 0x00, 0x8a, 0xb2, 0xb3, 0xb1, 0xb3, 0xb2, 0xb4,
+  0xb4, 0xbd, 0xe1, 0x01, 0x23, 0xb0, 0xb0, 0xbc, 0x03, 0x30, 0xaf, 0xb0, 0xaf, 0x08, 0x00, 0x10, 0xb7, 0x02, 0x00, 0x20, 0xb0, 0xaf, 0x19, 0x00,
+  0xc1, 0xba, 0xb1, 0xba, 0xbd, 0xb1, 0xb0, 0xb7, 0xb0, 0xaf, 0xaf, 0xae, 0xad, 0x9c, 0x05, 0x03, 0xdd, 0x01, 0x11, 0x53, 0xe1, 0x01, 0x42, 0xaa,
+  0xad, 0xae, 0xab, 0x89, 0x07, 0x40, 0xab, 0xb1, 0xbd, 0xb2, 0x36, 0x04, 0x31, 0xb4, 0xb4, 0xc0, 0xb7, 0x03, 0x00, 0x9b, 0x00, 0x03, 0x8f, 0x05,
+  0x21, 0xcd, 0xcd, 0x07, 0x00, 0x50, 0xb6, 0xcd, 0xa0, 0xcf, 0xa0, 0xca, 0x01, 0x20, 0xd2, 0xd5, 0x6f, 0x07, 0x00, 0x09, 0x00, 0x71, 0xa1, 0xb6,
+  0xa1, 0xd2, 0xa0, 0xd2, 0xa0, 0xdd, 0x01, 0x02, 0x11, 0x00, 0x11, 0xd5, 0xd6, 0x03, 0x20, 0xa1, 0xfd, 0x91, 0x05, 0x00, 0xda, 0x01, 0x00, 0xea,
+  0x00, 0x01, 0x06, 0x00, 0x00, 0xea, 0x01, 0x01, 0xfa, 0x00, 0x00, 0xd0, 0x01, 0x07, 0x0a, 0x00, 0x10, 0xf8, 0x06, 0x00, 0x13, 0xeb, 0x04, 0x00,
+  0x54, 0xf8, 0x2f, 0x36, 0xf8, 0x3d, 0xdf, 0x01, 0x00, 0x02, 0x00, 0x07, 0xe3, 0x01, 0x06, 0xc0, 0x03, 0x00, 0x01, 0x00, 0x00, 0xb6, 0x01, 0x02,
+  0x01, 0x00, 0x06, 0x0a, 0x00, 0x07, 0x01, 0x00, 0x03, 0x15, 0x00, 0x02, 0xcd, 0x01, 0x00, 0x08, 0x00, 0x02, 0xa9, 0x01, 0x14, 0xfc, 0x12, 0x00,
+  0x00, 0xd2, 0x01, 0x10, 0xfc, 0xb8, 0x01, 0x02, 0x02, 0x00, 0x01, 0x21, 0x00, 0x00, 0xe7, 0x01, 0x06, 0x01, 0x00, 0x11, 0x4d, 0xae, 0x03, 0x10,
+  0x49, 0x18, 0x00, 0x00, 0x2c, 0x00, 0x41, 0x4d, 0xf1, 0x49, 0xf1, 0x12, 0x00, 0x61, 0xf9, 0x3d, 0xf8, 0x2f, 0xea, 0xfd, 0xa3, 0x03, 0x00, 0xaa,
+  0x03, 0x01, 0x02, 0x00, 0x33, 0xa1, 0xd5, 0xfd, 0xd7, 0x03, 0x01, 0x04, 0x00, 0x70, 0xf9, 0xf9, 0xec, 0xeb, 0xd5, 0xcd, 0xb5, 0x20, 0x03, 0x00,
+  0xb4, 0x08, 0x03, 0xdf, 0x01, 0x00, 0xe1, 0x01, 0x20, 0xb4, 0xbd, 0x38, 0x03, 0x00, 0xf9, 0x06, 0x10, 0xb4, 0x6c, 0x01, 0x22, 0xba, 0xb2, 0xdf,
+  0x01, 0xf4, 0x03, 0xb2, 0xb5, 0xd7, 0xea, 0xeb, 0xd7, 0xd5, 0xd2, 0xa1, 0xcf, 0xa1, 0xd7, 0xd5, 0xd5, 0xd7, 0xea, 0xd7, 0xc2, 0xdf, 0x01, 0x02,
+  0xa9, 0x03, 0x00, 0xda, 0x01, 0x00, 0xac, 0x03, 0x10, 0xb7, 0xe1, 0x01, 0x30, 0xb7, 0xb0, 0xb7, 0x11, 0x00, 0x10, 0xb7, 0xa3, 0x05, 0x01, 0xaf,
+  0x01, 0x30, 0xb4, 0xb4, 0xbd, 0x1e, 0x00, 0x00, 0x7f, 0x07, 0x10, 0xae, 0x73, 0x07, 0x01, 0xe6, 0x01, 0x02, 0x82, 0x07, 0x01, 0xe3, 0x01, 0x30,
+  0xaa, 0xad, 0xad, 0x8b, 0x07, 0x01, 0x73, 0x09, 0x50, 0xb7, 0xb0, 0xb0, 0xbd, 0xbd, 0xe2, 0x01, 0x01, 0xba, 0x03, 0x10, 0xb5, 0xdb, 0x01, 0x00,
+  0x70, 0x07, 0x00, 0x02, 0x00, 0x01, 0xbc, 0x01, 0x00, 0xbe, 0x01, 0x03, 0x02, 0x00, 0x10, 0xd2, 0xdb, 0x01, 0x01, 0xd4, 0x01, 0x04, 0x02, 0x00,
+  0x00, 0x8e, 0x07, 0x13, 0xa1, 0xfe, 0x01, 0x00, 0xc3, 0x03, 0x02, 0x93, 0x07, 0x00, 0xde, 0x01, 0x00, 0xe1, 0x01, 0x20, 0x24, 0xfd, 0xa5, 0x03,
+  0x51, 0xfd, 0xfd, 0x2f, 0xeb, 0x36, 0xdb, 0x01, 0x30, 0xfd, 0xfd, 0xfd, 0xd3, 0x01, 0x01, 0xb8, 0x03, 0x00, 0xf6, 0x02, 0x05, 0xbf, 0x03, 0x00,
+  0xac, 0x03, 0x00, 0x06, 0x00, 0x00, 0xd7, 0x01, 0x10, 0xf8, 0xde, 0x06, 0x00, 0xd7, 0x01, 0x00, 0xe2, 0x01, 0x00, 0xee, 0x06, 0x13, 0xf9, 0xe0,
+  0x01, 0x04, 0xc2, 0x01, 0x00, 0xa1, 0x03, 0x00, 0x84, 0x05, 0x01, 0xa8, 0x03, 0x00, 0x05, 0x00, 0x00, 0x18, 0x00, 0x02, 0x06, 0x00, 0x00, 0xa5,
+  0x01, 0x04, 0x09, 0x00, 0x00, 0xd1, 0x01, 0x01, 0x10, 0x00, 0x04, 0x8a, 0x07, 0x00, 0xde, 0x01, 0x02, 0x10, 0x00, 0x01, 0x12, 0x00, 0x30, 0x50,
+  0x4d, 0xff, 0xe7, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x19, 0x00, 0x00, 0x02, 0x00, 0x42, 0x50, 0xfc, 0x4d, 0x49, 0xb4, 0x05, 0x00, 0x02, 0x02, 0x20,
+  0x49, 0x4d, 0x9f, 0x05, 0x00, 0x71, 0x07, 0x10, 0x36, 0x6d, 0x04, 0x00, 0xb1, 0x02, 0x30, 0xea, 0x2f, 0xeb, 0xc9, 0x00, 0x21, 0xd5, 0xa1, 0x68,
+  0x08, 0x30, 0x24, 0xd5, 0x24, 0x09, 0x00, 0x40, 0xa1, 0xa1, 0xa1, 0xb6, 0xf1, 0x04, 0x00, 0x42, 0x01, 0x62, 0xc8, 0xcd, 0xcd, 0xd2, 0xd2, 0xd2,
+  0xc0, 0x03, 0x02, 0xe4, 0x01, 0x34, 0xbd, 0xbd, 0xc0, 0x0a, 0x00, 0x01, 0xd9, 0x01, 0x04, 0x02, 0x00, 0x73, 0xb4, 0xb6, 0xf0, 0x49, 0xf1, 0xfe,
+  0xf0, 0x02, 0x00, 0x30, 0xee, 0xb5, 0xb2, 0xd6, 0x01, 0x09, 0x01, 0x00, 0x00, 0xc0, 0x03, 0x21, 0xb7, 0xb1, 0xdc, 0x01, 0x21, 0xb7, 0xab, 0xe4,
+  0x01, 0x00, 0x82, 0x07, 0x01, 0x73, 0x05, 0x70, 0xc5, 0xc2, 0xb4, 0xb2, 0xba, 0xb1, 0xb0, 0xa5, 0x03, 0x00, 0x3a, 0x0b, 0x41, 0xab, 0xab, 0xae,
+  0xae, 0xc4, 0x03, 0x01, 0xdf, 0x01, 0x00, 0x05, 0x00, 0x10, 0xad, 0xc7, 0x03, 0x10, 0xaf, 0x02, 0x00, 0x00, 0xf6, 0x03, 0x60, 0xb0, 0xb0, 0xba,
+  0xb0, 0xb2, 0xbd, 0x17, 0x02, 0x01, 0x6b, 0x02, 0x50, 0xb5, 0xb5, 0xb5, 0xb6, 0xcf, 0x53, 0x09, 0x00, 0xb3, 0x01, 0x05, 0x01, 0x00, 0x00, 0xc3,
+  0x01, 0x02, 0xd3, 0x01, 0x00, 0x0e, 0x00, 0x00, 0xbb, 0x03, 0x00, 0x07, 0x00, 0x00, 0x18, 0x00, 0x02, 0x01, 0x00, 0x00, 0xb7, 0x03, 0x00, 0xc2,
+  0x01, 0x03, 0x01, 0x00, 0x80, 0x2f, 0xfd, 0xfd, 0xf8, 0xfd, 0xeb, 0xfd, 0xeb, 0xc7, 0x01, 0x45, 0xfd, 0x2f, 0x2f, 0xf8, 0xdb, 0x01, 0x40, 0xeb,
+  0x2f, 0xf8, 0xf8, 0x16, 0x00, 0x10, 0xf8, 0x01, 0x00, 0x10, 0x36, 0xc5, 0x01, 0x01, 0x06, 0x00, 0x31, 0xf8, 0x36, 0xeb, 0xe7, 0x01, 0x31, 0x3d,
+  0x3d, 0xf8, 0xe4, 0x01, 0x01, 0xdf, 0x01, 0x03, 0x01, 0x00, 0x04, 0xb2, 0x01, 0x01, 0x8e, 0x01, 0x03, 0xcd, 0x01, 0x04, 0x14, 0x00, 0x01, 0x0b,
+  0x00, 0x05, 0x0d, 0x00, 0x00, 0x20, 0x00, 0x10, 0x4d, 0x0e, 0x00, 0x11, 0xff, 0x2d, 0x00, 0x01, 0xbe, 0x03, 0x00, 0x32, 0x00, 0x03, 0x9e, 0x05,
+  0x10, 0xfc, 0x19, 0x00, 0x00, 0xd0, 0x01, 0x00, 0x04, 0x00, 0x01, 0x01, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x19, 0x00, 0x01, 0xd2, 0x01, 0x02, 0x02,
+  0x00, 0x00, 0x27, 0x00, 0x01, 0x09, 0x00, 0x01, 0xc0, 0x03, 0x00, 0x9e, 0x03, 0x01, 0x67, 0x02, 0x01, 0x6d, 0x02, 0x10, 0x2f, 0xce, 0x01, 0x41,
+  0xea, 0x2f, 0xf8, 0xf9, 0x01, 0x00, 0x20, 0x3d, 0xf9, 0x86, 0x02, 0x60, 0xf8, 0xeb, 0xfd, 0xd5, 0xcd, 0xcd, 0xdf, 0x01, 0x33, 0xc2, 0xc2, 0xac,
+  0x6d, 0x0c, 0x71, 0xc8, 0xb5, 0xc5, 0xc2, 0xc5, 0xc2, 0xc0, 0x02, 0x00, 0x20, 0xb4, 0xc0, 0x02, 0x00, 0x00, 0xab, 0x05, 0x61, 0xbd, 0xba, 0xb2,
+  0xba, 0xbd, 0xba, 0x06, 0x00, 0x50, 0xbd, 0xc2, 0xd5, 0xf0, 0xfe, 0xf9, 0x03, 0x01, 0x4b, 0x00, 0x4e, 0xeb, 0xea, 0xcd, 0xc2, 0xe1, 0x01, 0x01,
+  0xd2, 0x01, 0x00, 0xcb, 0x03, 0x02, 0x08, 0x00, 0x00, 0x01, 0x00, 0x62, 0xba, 0xb2, 0xbd, 0xb4, 0xc2, 0xc1, 0xe2, 0x01, 0x10, 0xbd, 0x32, 0x00,
+  0x20, 0xab, 0xb0, 0x8b, 0x05, 0x01, 0xc1, 0x03, 0x80, 0x52, 0xaa, 0x52, 0xaa, 0xa3, 0xaa, 0x53, 0x52, 0xe7, 0x01, 0x30, 0xa3, 0xad, 0xaa, 0xd7,
+  0x03, 0x00, 0x32, 0x0d, 0x30, 0xb7, 0xab, 0xb0, 0x50, 0x02, 0x00, 0x4b, 0x04, 0x00, 0xc5, 0x03, 0x20, 0xc8, 0xac, 0x2f, 0x06, 0x41, 0xd2, 0xa1,
+  0xd2, 0xfd, 0xdf, 0x01, 0x00, 0x8f, 0x03, 0x00, 0x37, 0x09, 0x01, 0x01, 0x00, 0x02, 0x09, 0x00, 0x02, 0xd1, 0x01, 0x03, 0xdf, 0x01, 0x40, 0xa1,
+  0xd2, 0xd5, 0xd2, 0x13, 0x00, 0x02, 0x0e, 0x00, 0x00, 0xd9, 0x01, 0x01, 0x05, 0x00, 0x10, 0xfd, 0xde, 0x01, 0x00, 0x01, 0x00, 0x00, 0xa0, 0x06,
+  0x00, 0xce, 0x01, 0x00, 0xca, 0x03, 0x00, 0x91, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x54, 0x09, 0x10, 0xf8, 0xe0, 0x01, 0x33, 0x2f, 0xf8, 0x2f, 0xc7,
+  0x01, 0x20, 0xf8, 0x3d, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0xdc, 0x01, 0x00, 0x02, 0x00, 0x02, 0x15, 0x00, 0x00, 0x1c, 0x00, 0x06, 0xa0, 0x05,
+  0x04, 0xb0, 0x03, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x06, 0xa4, 0x01, 0x02, 0x10, 0x00, 0x01, 0x01, 0x00, 0x01, 0x80, 0x03, 0x00, 0xad, 0x03,
+  0x02, 0xc4, 0x01, 0x01, 0x96, 0x03, 0x30, 0xfc, 0x4d, 0xff, 0x13, 0x00, 0x00, 0x19, 0x00, 0x05, 0x01, 0x00, 0x10, 0x4d, 0x36, 0x00, 0x00, 0x4d,
+  0x00, 0x00, 0x0c, 0x04, 0x00, 0x7a, 0x07, 0x02, 0x02, 0x00, 0x20, 0x49, 0xfc, 0x2f, 0x00, 0x11, 0xf1, 0xb7, 0x03, 0x00, 0x6f, 0x02, 0x22, 0x2f,
+  0x2f, 0xca, 0x0b, 0x01, 0x49, 0x04, 0x41, 0xf8, 0x2f, 0xfd, 0xd5, 0x9d, 0x05, 0x00, 0x7a, 0x06, 0x00, 0xc4, 0x00, 0xe0, 0x2f, 0xf8, 0xf8, 0x3d,
+  0xf9, 0x36, 0xeb, 0xd5, 0xa1, 0xa1, 0xcd, 0xb6, 0xc5, 0xb5, 0x02, 0x05, 0x01, 0xdf, 0x01, 0x40, 0xb6, 0xcd, 0xb5, 0xc8, 0xef, 0x01, 0x01, 0x01,
+  0x00, 0x61, 0xc5, 0xc2, 0xc2, 0xb4, 0xc0, 0xbd, 0xe1, 0x01, 0x00, 0xde, 0x01, 0x01, 0x66, 0x09, 0x32, 0xbd, 0xbd, 0xc2, 0x27, 0x00, 0x00, 0xcd,
+  0x05, 0x00, 0x1b, 0x02, 0x30, 0xb4, 0xb4, 0xba, 0x39, 0x09, 0x0b, 0x01, 0x00, 0x06, 0xd9, 0x01, 0x50, 0xb0, 0xb0, 0xb1, 0xba, 0xb1, 0xa8, 0x01,
+  0x70, 0xba, 0xc0, 0xc0, 0xc2, 0xc1, 0xc2, 0xc1, 0x31, 0x02, 0x00, 0xe0, 0x01, 0x00, 0xdd, 0x01, 0x00, 0x64, 0x09, 0x31, 0x54, 0xaa, 0xa3, 0x01,
+  0x00, 0x41, 0x52, 0xa3, 0xa3, 0xa3, 0x6e, 0x09, 0x60, 0xae, 0xaa, 0xaf, 0xae, 0xaf, 0xaf, 0xf6, 0x03, 0x91, 0xba, 0xb0, 0xb2, 0xba, 0xbd, 0xc0,
+  0xc0, 0xbd, 0xb4, 0x3d, 0x0b, 0x00, 0x9e, 0x05, 0x31, 0xcf, 0xb6, 0xd2, 0xb7, 0x01, 0x00, 0x6a, 0x05, 0x00, 0xaf, 0x01, 0x00, 0x04, 0x00, 0x01,
+  0x92, 0x03, 0x00, 0x60, 0x07, 0x02, 0xce, 0x01, 0x04, 0x95, 0x05, 0x02, 0x02, 0x00, 0x00, 0x01, 0x00, 0x14, 0xa1, 0x28, 0x00, 0x03, 0x07, 0x00,
+  0x11, 0x2f, 0x09, 0x00, 0x01, 0x6e, 0x05, 0x00, 0x02, 0x00, 0x02, 0xdd, 0x01, 0x00, 0xed, 0x01, 0x00, 0x15, 0x01, 0x00, 0x04, 0x00, 0x13, 0x3d,
+  0xc0, 0x03, 0x00, 0x09, 0x00, 0x00, 0xc0, 0x03, 0x03, 0xcd, 0x01, 0x07, 0xc1, 0x03, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x4a, 0x05, 0x01,
+  0x91, 0x01, 0x00, 0x1d, 0x0b, 0x01, 0x90, 0x01, 0x00, 0x99, 0x01, 0x01, 0x02, 0x00, 0x00, 0xe6, 0x01, 0x01, 0x76, 0x05, 0x00, 0x13, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x29, 0x00, 0x00, 0xa2, 0x01, 0x00, 0xf1, 0x0e, 0x00, 0x16, 0x00, 0x00, 0xd5, 0x01, 0x00, 0x90, 0x03, 0x00, 0x09, 0x00, 0x01,
+  0x11, 0x02, 0x00, 0x36, 0x00, 0x01, 0x02, 0x00, 0x00, 0xe8, 0x03, 0x01, 0x09, 0x00, 0x20, 0x50, 0xfc, 0xce, 0x01, 0x00, 0xcb, 0x01, 0x02, 0x01,
+  0x00, 0x10, 0xf8, 0xab, 0x03, 0x00, 0x59, 0x07, 0x40, 0xf1, 0x49, 0xf0, 0x49, 0xc5, 0x03, 0x31, 0xf1, 0x49, 0xfc, 0x06, 0x00, 0x70, 0xf1, 0x49,
+  0xf1, 0xfe, 0x49, 0xf9, 0xf8, 0x05, 0x01, 0x00, 0xdc, 0x00, 0x01, 0x01, 0x00, 0x10, 0x2f, 0x63, 0x09, 0x20, 0xfd, 0xd5, 0xf8, 0x0e, 0x01, 0x3b,
+  0x01, 0x01, 0x16, 0x03, 0x50, 0xd2, 0xd2, 0xb5, 0xc8, 0xc2, 0xc2, 0x03, 0x00, 0x4d, 0x05, 0x22, 0xc0, 0xc2, 0xbf, 0x03, 0x00, 0x04, 0x00, 0x00,
+  0xe1, 0x01, 0x00, 0xc1, 0x03, 0x20, 0xbc, 0xbd, 0xc9, 0x0e, 0x00, 0x46, 0x0d, 0x00, 0xc2, 0x05, 0x00, 0xf4, 0x01, 0x00, 0x12, 0x0b, 0x0c, 0x01,
+  0x00, 0x08, 0xdf, 0x01, 0x10, 0xba, 0x02, 0x00, 0x00, 0x1a, 0x02, 0x00, 0x13, 0x04, 0x80, 0xc0, 0xb4, 0xbd, 0xb0, 0xb2, 0xba, 0xb0, 0xb7, 0xde,
+  0x01, 0x00, 0x9a, 0x05, 0x20, 0x52, 0xaa, 0xda, 0x01, 0x00, 0xdc, 0x01, 0x10, 0xa3, 0xbe, 0x03, 0x22, 0xaa, 0xad, 0x01, 0x00, 0x60, 0xaf, 0xaf,
+  0xb0, 0xb0, 0xaf, 0xb0, 0x17, 0x02, 0x40, 0xbd, 0xc0, 0xb4, 0xc1, 0x9d, 0x05, 0x00, 0x41, 0x06, 0x00, 0xdf, 0x01, 0x20, 0xcd, 0xb6, 0x8b, 0x05,
+  0x00, 0x58, 0x09, 0x00, 0xbf, 0x03, 0x05, 0xcd, 0x00, 0x11, 0xea, 0xe1, 0x01, 0x00, 0x11, 0x00, 0x00, 0xd1, 0x01, 0x00, 0x05, 0x00, 0x11, 0xd5,
+  0x09, 0x02, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0xd6, 0x01, 0x01, 0x07, 0x02, 0x50, 0xfd, 0xfd, 0x2f, 0xea, 0x2f, 0xe5, 0x02, 0x03, 0x88,
+  0x05, 0x50, 0xf8, 0xf8, 0x2f, 0xeb, 0x36, 0x05, 0x00, 0x01, 0xec, 0x01, 0x02, 0x74, 0x07, 0x01, 0xc6, 0x01, 0x03, 0xd6, 0x01, 0x10, 0xf9, 0xed,
+  0x01, 0x00, 0xf0, 0x04, 0x10, 0xf9, 0x0e, 0x00, 0x00, 0x19, 0x00, 0x01, 0xdd, 0x01, 0x00, 0x0e, 0x00, 0x33, 0xf9, 0x3d, 0x3d, 0x64, 0x05, 0x01,
+  0x01, 0x00, 0x00, 0x90, 0x01, 0x04, 0x02, 0x00, 0x02, 0x01, 0x00, 0x00, 0x32, 0x07, 0x01, 0x79, 0x05, 0x00, 0x03, 0x00, 0x20, 0x50, 0x50, 0x56,
+  0x07, 0x01, 0x3f, 0x09, 0x01, 0x16, 0x00, 0x00, 0xe2, 0x01, 0x00, 0xde, 0x01, 0x00, 0xbb, 0x03, 0x00, 0x06, 0x00, 0x00, 0x21, 0x00, 0x05, 0x02,
+  0x00, 0x03, 0x01, 0x00, 0x00, 0xbd, 0x03, 0x51, 0x49, 0xfc, 0x49, 0xfe, 0x49, 0x7b, 0x00, 0x30, 0x2f, 0x2f, 0x2f, 0x55, 0x07, 0x00, 0x02, 0x00,
+  0x00, 0xbe, 0x01, 0x65, 0xf8, 0xf9, 0x3d, 0xee, 0x49, 0xf0, 0xe9, 0x01, 0x20, 0xf1, 0xf1, 0xe5, 0x01, 0x00, 0x73, 0x09, 0x20, 0xf8, 0xf8, 0x92,
+  0x04, 0x00, 0xa3, 0x02, 0x00, 0xe1, 0x01, 0xc0, 0xfd, 0xd5, 0xd2, 0xd5, 0xb6, 0xd2, 0xd2, 0xd2, 0xd2, 0xa1, 0xd7, 0xd5, 0x06, 0x0f, 0x13, 0xcd,
+  0xd8, 0x01, 0x21, 0xb4, 0xc0, 0x05, 0x00, 0x01, 0xdd, 0x01, 0x05, 0xdf, 0x01, 0x70, 0xbd, 0xba, 0xb4, 0xc2, 0xcd, 0xcf, 0xb6, 0xe8, 0x08, 0x10,
+  0xb5, 0x8c, 0x09, 0x00, 0x1a, 0x00, 0x11, 0xb2, 0xc1, 0x01, 0x00, 0xca, 0x01, 0x0f, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x04, 0xdf, 0x01, 0x00,
+  0x01, 0x00, 0x60, 0xbd, 0xba, 0xb7, 0xb7, 0xb7, 0xab, 0xdf, 0x01, 0x02, 0x9b, 0x05, 0x30, 0xa3, 0xa3, 0x54, 0xdb, 0x01, 0x00, 0xe5, 0x01, 0x20,
+  0xaa, 0x54, 0x84, 0x07, 0x21, 0xaa, 0xae, 0x9f, 0x05, 0x10, 0xae, 0x70, 0x0b, 0x10, 0xba, 0x03, 0x08, 0x11, 0xc0, 0xf7, 0x03, 0x62, 0xc8, 0xc2,
+  0xcd, 0xb5, 0xcf, 0xb6, 0x02, 0x00, 0x10, 0xd2, 0x02, 0x00, 0x14, 0xa1, 0xbe, 0x01, 0x00, 0xd6, 0x01, 0x00, 0x01, 0x00, 0x63, 0xd2, 0xd5, 0xd5,
+  0xd7, 0xfd, 0xea, 0x02, 0x00, 0x00, 0xa2, 0x03, 0x00, 0xd8, 0x01, 0x40, 0xd5, 0xfd, 0xfd, 0xeb, 0x60, 0x07, 0x00, 0x02, 0x00, 0x00, 0xd7, 0x0e,
+  0x00, 0x02, 0x00, 0x20, 0xfd, 0x2f, 0x20, 0x00, 0x01, 0x10, 0x00, 0x00, 0xc6, 0x01, 0x00, 0xd5, 0x01, 0x01, 0x0d, 0x01, 0x00, 0xf0, 0x01, 0x11,
+  0xf9, 0xbe, 0x03, 0x00, 0x02, 0x00, 0x02, 0xdf, 0x01, 0x40, 0xf8, 0x3d, 0xf8, 0xf9, 0xab, 0x03, 0x03, 0xdf, 0x01, 0x10, 0xf9, 0x03, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x06, 0x00, 0x10, 0xfe, 0x60, 0x09, 0x00, 0x8d, 0x01, 0x04, 0x8f, 0x01, 0x01, 0x9e, 0x05, 0x01, 0xcd, 0x01, 0x02, 0x12, 0x00,
+  0x02, 0xfd, 0x01, 0x00, 0xd5, 0x03, 0x00, 0x12, 0x00, 0x02, 0x14, 0x00, 0x01, 0xcf, 0x01, 0x00, 0x02, 0x00, 0x01, 0x01, 0x00, 0x03, 0xe8, 0x01,
+  0x00, 0x2c, 0x00, 0x00, 0xaa, 0x05, 0x02, 0x29, 0x00, 0x02, 0x06, 0x00, 0x02, 0x02, 0x00, 0x00, 0xfa, 0x01, 0x00, 0x1b, 0x00, 0x20, 0xfc, 0xfc,
+  0xe8, 0x01, 0x00, 0xc5, 0x01, 0x50, 0xfe, 0xf1, 0xfe, 0xfe, 0x3d, 0xd8, 0x00, 0x00, 0x9b, 0x03, 0x00, 0xe6, 0x00, 0x00, 0xce, 0x02, 0x01, 0xf4,
+  0x01, 0x70, 0x24, 0xd5, 0xfd, 0xeb, 0xf8, 0xf9, 0xf9, 0xc6, 0x0f, 0x01, 0x02, 0x0c, 0x00, 0xca, 0x00, 0x01, 0x76, 0x09, 0x00, 0x1e, 0x01, 0x00,
+  0x12, 0x03, 0x00, 0xf7, 0x02, 0x50, 0xd2, 0xcd, 0xcd, 0xc2, 0xc5, 0xd8, 0x01, 0x00, 0x02, 0x00, 0x03, 0xdd, 0x01, 0x00, 0xd8, 0x01, 0x02, 0x06,
+  0x00, 0x00, 0x4e, 0x03, 0x40, 0xc8, 0xd2, 0xd2, 0xd2, 0x4e, 0x01, 0x20, 0xcf, 0xd2, 0x3b, 0x0d, 0x10, 0xc5, 0x92, 0x03, 0x01, 0xc2, 0x03, 0x00,
+  0x04, 0x00, 0x0a, 0x01, 0x00, 0x40, 0xba, 0xb0, 0xb0, 0xb8, 0xdd, 0x01, 0x00, 0x46, 0x07, 0x60, 0xbd, 0xba, 0xc0, 0xc0, 0xc1, 0xb4, 0xbe, 0x03,
+  0x20, 0xb0, 0xab, 0x1f, 0x0b, 0x22, 0xaf, 0xaf, 0xdf, 0x10, 0x00, 0xba, 0x03, 0x11, 0x52, 0xbb, 0x03, 0x00, 0x45, 0x0b, 0x00, 0x40, 0x0b, 0x20,
+  0xae, 0xab, 0xde, 0x01, 0x00, 0x01, 0x04, 0x01, 0x7b, 0x07, 0x00, 0xf5, 0x03, 0x12, 0xc1, 0x9f, 0x05, 0x10, 0xd2, 0x59, 0x02, 0x10, 0xcd, 0x08,
+  0x0a, 0x00, 0xe5, 0x01, 0x00, 0xc3, 0x03, 0x12, 0xd2, 0x6d, 0x07, 0x30, 0xd2, 0xd5, 0xd2, 0xf2, 0x01, 0x05, 0xf1, 0x01, 0x00, 0xb3, 0x03, 0x01,
+  0x05, 0x00, 0x00, 0x01, 0x00, 0x10, 0x2f, 0x5b, 0x0a, 0x00, 0xee, 0x00, 0x02, 0x01, 0x00, 0x01, 0xe3, 0x01, 0x11, 0xea, 0x06, 0x00, 0x02, 0xd9,
+  0x01, 0x00, 0x06, 0x00, 0x10, 0xeb, 0x1a, 0x00, 0x00, 0xb7, 0x01, 0x02, 0x42, 0x0e, 0x00, 0x01, 0x00, 0x02, 0xa4, 0x08, 0x00, 0x05, 0x00, 0x00,
+  0xda, 0x01, 0x03, 0x04, 0x00, 0x01, 0x0d, 0x00, 0x01, 0x1a, 0x00, 0x00, 0x7c, 0x08, 0x31, 0xf9, 0x3d, 0xfe, 0x26, 0x07, 0x00, 0x88, 0x01, 0x01,
+  0x09, 0x00, 0x01, 0x0b, 0x00, 0x00, 0xa1, 0x01, 0x00, 0x01, 0x00, 0x01, 0xbb, 0x01, 0x13, 0xfc, 0x17, 0x00, 0x01, 0x18, 0x00, 0x03, 0x1a, 0x00,
+  0x03, 0x19, 0x00, 0x00, 0xc5, 0x03, 0x01, 0x0b, 0x00, 0x04, 0x01, 0x00, 0x05, 0x43, 0x00, 0x00, 0xd0, 0x01, 0x01, 0x7a, 0x05, 0x24, 0xfc, 0xfc,
+  0x77, 0x14, 0x01, 0x90, 0x05, 0x00, 0x94, 0x00, 0x00, 0xa9, 0x00, 0x10, 0xf9, 0x63, 0x04, 0x10, 0x2f, 0xc4, 0x0f, 0x02, 0x3e, 0x06, 0x01, 0x99,
+  0x11, 0x00, 0x45, 0x0a, 0x00, 0x20, 0x0d, 0x44, 0xb6, 0xb6, 0xb6, 0xfd, 0xc4, 0x00, 0x00, 0x25, 0x09, 0x11, 0xeb, 0xe5, 0x02, 0x00, 0xe1, 0x01,
+  0x10, 0xd2, 0x41, 0x0b, 0x00, 0x7f, 0x07, 0x40, 0xc5, 0xc2, 0xc1, 0xc2, 0x6c, 0x03, 0x00, 0xdd, 0x01, 0x00, 0x04, 0x00, 0x04, 0xdc, 0x01, 0x00,
+  0xe6, 0x01, 0x80, 0xc0, 0xc2, 0xcd, 0xcf, 0xa1, 0xd2, 0xd5, 0xd7, 0xc7, 0x08, 0x00, 0x2f, 0x00, 0x71, 0xcd, 0xcd, 0xc8, 0xc2, 0xc1, 0xbd, 0xbd,
+  0xc6, 0x01, 0x00, 0xd4, 0x01, 0x21, 0xb0, 0xb8, 0x04, 0x00, 0x02, 0x0c, 0x00, 0x11, 0xba, 0xdb, 0x01, 0x00, 0x01, 0x00, 0x31, 0xbd, 0xba, 0xb2,
+  0x2d, 0x02, 0x00, 0xbb, 0x05, 0x21, 0xaf, 0xaa, 0xe0, 0x01, 0x10, 0xaa, 0xe0, 0x01, 0x50, 0xae, 0xa3, 0xaa, 0xa3, 0x54, 0xde, 0x01, 0x00, 0x7b,
+  0x07, 0x01, 0xe0, 0x01, 0x20, 0xaa, 0xaf, 0xb9, 0x14, 0x00, 0x3c, 0x0b, 0x10, 0xb2, 0xc0, 0x03, 0xa1, 0xb0, 0xc0, 0xc5, 0xc5, 0xc0, 0xbd, 0xc2,
+  0xc5, 0xb5, 0xc5, 0x37, 0x04, 0x00, 0xfe, 0x0e, 0x22, 0xd2, 0xb6, 0xe1, 0x01, 0x20, 0xd5, 0xd2, 0x29, 0x0d, 0x00, 0x53, 0x06, 0x00, 0x0f, 0x00,
+  0x31, 0xcd, 0xa1, 0xcf, 0x87, 0x04, 0x02, 0x5e, 0x0b, 0x00, 0xdf, 0x01, 0x00, 0x06, 0x00, 0x00, 0xe4, 0x02, 0x00, 0x01, 0x00, 0x00, 0xd2, 0x01,
+  0x10, 0x36, 0xd4, 0x01, 0x20, 0xfd, 0x2f, 0xd1, 0x03, 0x03, 0xd2, 0x03, 0x10, 0xeb, 0x15, 0x00, 0x40, 0x36, 0xeb, 0x2f, 0xf8, 0xff, 0x01, 0x01,
+  0xdf, 0x01, 0x00, 0x01, 0x00, 0x31, 0xfe, 0xfe, 0xfe, 0x41, 0x0a, 0x00, 0xec, 0x04, 0x00, 0x06, 0x00, 0x03, 0xf3, 0x01, 0x10, 0xf9, 0xad, 0x0a,
+  0x02, 0xb3, 0x0a, 0x10, 0xfe, 0xe2, 0x01, 0x01, 0x05, 0x00, 0x20, 0x50, 0xfc, 0xb7, 0x01, 0x01, 0x02, 0x00, 0x03, 0x01, 0x00, 0x00, 0xaa, 0x01,
+  0x00, 0xbf, 0x01, 0x01, 0x05, 0x00, 0x02, 0x19, 0x00, 0x04, 0x0a, 0x00, 0x04, 0x01, 0x00, 0x08, 0x0c, 0x00, 0x01, 0xbf, 0x05, 0x01, 0x02, 0x00,
+  0x04, 0x01, 0x00, 0x00, 0x74, 0x07, 0x11, 0xfe, 0xf7, 0x0c, 0x70, 0x2f, 0x2f, 0x2f, 0x3d, 0xf8, 0xfe, 0x49, 0x76, 0x05, 0x00, 0x8a, 0x02, 0x10,
+  0x36, 0x97, 0x03, 0x00, 0x15, 0x00, 0x00, 0x79, 0x05, 0x00, 0xae, 0x05, 0x10, 0xeb, 0xb1, 0x00, 0x00, 0xcd, 0x10, 0x00, 0x01, 0x00, 0x40, 0xf8,
+  0xf8, 0xf8, 0xea, 0xf4, 0x00, 0x00, 0xf7, 0x00, 0x30, 0xeb, 0x2f, 0xf8, 0xb4, 0x00, 0x00, 0x0f, 0x02, 0x00, 0xf8, 0x01, 0x00, 0x04, 0x01, 0x11,
+  0xea, 0xac, 0x01, 0x11, 0xb5, 0x3e, 0x0b, 0x20, 0xb4, 0xc5, 0x06, 0x09, 0x04, 0xbf, 0x03, 0x00, 0x04, 0x00, 0x01, 0xe3, 0x01, 0x00, 0x0b, 0x00,
+  0x30, 0xc0, 0xc2, 0xc5, 0x40, 0x03, 0x00, 0x34, 0x03, 0x00, 0x01, 0x00, 0x30, 0xcd, 0xcd, 0xcd, 0x30, 0x00, 0x10, 0xc0, 0xa5, 0x05, 0x00, 0xe1,
+  0x01, 0x00, 0xd7, 0x01, 0x00, 0x06, 0x00, 0x03, 0x02, 0x00, 0x02, 0xdc, 0x01, 0x14, 0xb2, 0x09, 0x00, 0x10, 0xba, 0xdd, 0x01, 0x41, 0xb7, 0xab,
+  0xaf, 0xad, 0xfb, 0x0e, 0x00, 0xbe, 0x03, 0x05, 0xfc, 0x0e, 0x02, 0xdb, 0x01, 0x20, 0xaa, 0xae, 0xfd, 0x0e, 0x30, 0xaf, 0xaf, 0xae, 0x21, 0x0f,
+  0xf0, 0x01, 0xb7, 0xb0, 0xb7, 0xb2, 0xba, 0xb0, 0xb8, 0xb4, 0xc5, 0xbd, 0xbd, 0xc0, 0xc8, 0xc2, 0xc8, 0xcd, 0x60, 0x09, 0x01, 0x6f, 0x11, 0x50,
+  0xcd, 0xd2, 0xd2, 0xa1, 0xcf, 0xaf, 0x03, 0x20, 0xa1, 0xcf, 0x02, 0x00, 0x10, 0xd2, 0xf5, 0x10, 0x00, 0xfb, 0x01, 0x00, 0x63, 0x06, 0x00, 0xc5,
+  0x03, 0x00, 0x5f, 0x09, 0x00, 0x01, 0x00, 0x00, 0x16, 0x0e, 0x10, 0xd5, 0x04, 0x00, 0x32, 0xfd, 0xd5, 0xeb, 0x10, 0x0d, 0x00, 0xd9, 0x01, 0x00,
+  0xee, 0x01, 0x30, 0xea, 0x2f, 0xea, 0x0f, 0x00, 0x00, 0xc3, 0x03, 0x01, 0x01, 0x00, 0x00, 0x3e, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x8f, 0x05, 0x01,
+  0x22, 0x03, 0x10, 0x36, 0x82, 0x05, 0x02, 0x97, 0x05, 0x03, 0xde, 0x01, 0x0f, 0x01, 0x00, 0x00, 0x00, 0x5d, 0x01, 0x02, 0x97, 0x01, 0x02, 0x06,
+  0x00, 0x04, 0x01, 0x00, 0x00, 0xcd, 0x01, 0x04, 0x9d, 0x03, 0x01, 0xba, 0x01, 0x00, 0xcf, 0x01, 0x00, 0x05, 0x00, 0x02, 0x02, 0x00, 0x00, 0x1f,
+  0x00, 0x00, 0x10, 0x00, 0x03, 0x23, 0x00, 0x0e, 0xe1, 0x01, 0x00, 0xbf, 0x03, 0x10, 0x4c, 0x52, 0x07, 0x00, 0xa0, 0x10, 0x61, 0x49, 0xfc, 0xfc,
+  0xff, 0x4d, 0x4d, 0x9c, 0x05, 0x00, 0x04, 0x00, 0x00, 0xc8, 0x03, 0x10, 0xf0, 0x19, 0x00, 0x00, 0x1d, 0x0d, 0x00, 0x06, 0x00, 0x00, 0x02, 0x00,
+  0x00, 0x89, 0x02, 0x00, 0x4c, 0x06, 0x80, 0xf8, 0xeb, 0xd7, 0xfd, 0xd7, 0xfd, 0xea, 0xeb, 0xb4, 0x03, 0x00, 0xea, 0x00, 0x10, 0x2f, 0x97, 0x08,
+  0x00, 0x8c, 0x06, 0x00, 0x84, 0x07, 0x11, 0xb6, 0xdb, 0x01, 0x00, 0xe1, 0x0a, 0x02, 0xbc, 0x03, 0x00, 0x01, 0x00, 0x00, 0xd1, 0x01, 0x02, 0x06,
+  0x00, 0x00, 0x08, 0x00, 0x10, 0xc0, 0x27, 0x05, 0x00, 0x28, 0x05, 0x10, 0xcd, 0x28, 0x03, 0x80, 0xa1, 0xd2, 0xb6, 0xcf, 0xcd, 0xb5, 0xc5, 0xc5,
+  0x2e, 0x00, 0x30, 0xbd, 0xbc, 0xbd, 0xbf, 0x01, 0x03, 0xe3, 0x01, 0x00, 0x6f, 0x07, 0x00, 0xd2, 0x01, 0x00, 0x07, 0x00, 0x01, 0x09, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0xc3, 0x05, 0x50, 0xb7, 0xb0, 0xb7, 0xb7, 0xaf, 0x5b, 0x09, 0x00, 0xc4, 0x10, 0x10, 0xaf, 0x5e, 0x09, 0x01, 0xc4, 0x03, 0x04,
+  0xdd, 0x01, 0x10, 0xaa, 0x77, 0x07, 0x30, 0xad, 0xae, 0xad, 0xc1, 0x03, 0x00, 0x40, 0x0b, 0x50, 0xae, 0xb0, 0xb1, 0xb7, 0xb8, 0x3f, 0x0b, 0x83,
+  0xc0, 0xc8, 0xc5, 0xc8, 0xc2, 0xc8, 0xc8, 0xcc, 0x81, 0x07, 0x01, 0xc4, 0x01, 0x00, 0x64, 0x02, 0x01, 0x60, 0x02, 0x03, 0x01, 0x00, 0x01, 0xc2,
+  0x03, 0x02, 0x5c, 0x0b, 0x05, 0x04, 0x00, 0x00, 0xbb, 0x03, 0x12, 0xd5, 0xe2, 0x00, 0x11, 0xeb, 0x51, 0x09, 0x00, 0x07, 0x00, 0x01, 0x0c, 0x00,
+  0x00, 0x08, 0x00, 0x04, 0xdd, 0x01, 0x01, 0xf1, 0x04, 0x01, 0xdc, 0x01, 0x00, 0x07, 0x03, 0x00, 0x76, 0x05, 0x03, 0x75, 0x07, 0x02, 0x56, 0x09,
+  0x00, 0x05, 0x00, 0x00, 0xe4, 0x01, 0x09, 0xe9, 0x01, 0x00, 0x54, 0x01, 0x01, 0xe4, 0x03, 0x00, 0xad, 0x01, 0x00, 0x94, 0x01, 0x00, 0x05, 0x00,
+  0x00, 0x04, 0x00, 0x01, 0x07, 0x00, 0x00, 0xc1, 0x01, 0x01, 0xc4, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x01, 0x00, 0x01, 0x13, 0x00, 0x00, 0x79, 0x05,
+  0x01, 0x19, 0x00, 0x01, 0x02, 0x00, 0x10, 0x4d, 0x0d, 0x00, 0x00, 0x7d, 0x0b, 0x03, 0x23, 0x00, 0x04, 0x01, 0x00, 0x00, 0x10, 0x00, 0x40, 0x50,
+  0xff, 0x4d, 0xfa, 0x99, 0x0b, 0x20, 0x4d, 0xfc, 0x02, 0x02, 0x30, 0xff, 0x50, 0xff, 0x07, 0x02, 0x00, 0x0f, 0x00, 0x00, 0x83, 0x18, 0x00, 0xaf,
+  0x05, 0x01, 0x0c, 0x00, 0x01, 0x02, 0x00, 0x01, 0x33, 0x0d, 0x00, 0x0e, 0x02, 0x50, 0xf0, 0xfe, 0xfe, 0xf8, 0x2f, 0x66, 0x07, 0x00, 0xac, 0x03,
+  0x50, 0x2f, 0xeb, 0xeb, 0xeb, 0xeb, 0x05, 0x00, 0x20, 0xfd, 0xeb, 0xe2, 0x01, 0x00, 0x07, 0x00, 0x21, 0xd5, 0xcd, 0xa1, 0x19, 0x00, 0xec, 0x06,
+  0x20, 0xc1, 0xb4, 0x02, 0x00, 0x00, 0xd1, 0x01, 0x06, 0x01, 0x00, 0x00, 0xf7, 0x01, 0x30, 0xc1, 0xc2, 0xc8, 0x29, 0x14, 0x00, 0x45, 0x03, 0x80,
+  0xd2, 0xd2, 0xd2, 0xcf, 0xb6, 0xcf, 0xb5, 0xc8, 0x8a, 0x09, 0x01, 0xe0, 0x03, 0x15, 0xbc, 0xe3, 0x01, 0x01, 0x01, 0x00, 0x02, 0xdb, 0x01, 0x02,
+  0x01, 0x00, 0x00, 0x1d, 0x02, 0x00, 0x1c, 0x00, 0x40, 0xb0, 0xb8, 0xb0, 0xaf, 0xdf, 0x01, 0x10, 0xab, 0x9b, 0x05, 0x00, 0x84, 0x05, 0x10, 0xad,
+  0x4e, 0x09, 0x00, 0x63, 0x09, 0x00, 0xe4, 0x01, 0x00, 0x35, 0x0b, 0x30, 0xad, 0xaf, 0xad, 0xdd, 0x01, 0x40, 0xae, 0xb7, 0xaf, 0xb7, 0xe1, 0x10,
+  0xf0, 0x00, 0xb0, 0xb2, 0xb7, 0xaf, 0xb0, 0xc0, 0xbd, 0xbd, 0xc0, 0xc5, 0xc5, 0xcd, 0xc8, 0xc8, 0xc2, 0x1b, 0x17, 0x00, 0x01, 0x00, 0x20, 0xcf,
+  0xb6, 0x3d, 0x13, 0x00, 0xca, 0x01, 0x01, 0xe0, 0x01, 0x00, 0x70, 0x02, 0x40, 0xcd, 0xd2, 0xcf, 0xd2, 0x94, 0x00, 0x00, 0x15, 0x00, 0x20, 0xfd,
+  0xd7, 0xda, 0x01, 0x00, 0xe2, 0x01, 0x01, 0xc6, 0x03, 0x00, 0xd1, 0x01, 0x01, 0xe3, 0x01, 0x00, 0xf1, 0x00, 0x01, 0xef, 0x00, 0x04, 0x7e, 0x07,
+  0x01, 0x74, 0x07, 0x00, 0xe4, 0x01, 0x00, 0xda, 0x01, 0x32, 0x3d, 0xf8, 0xf9, 0xcf, 0x01, 0x00, 0x02, 0x00, 0x02, 0xea, 0x01, 0x00, 0x0a, 0x00,
+  0x01, 0xdc, 0x01, 0x00, 0x07, 0x00, 0x00, 0x08, 0x05, 0x01, 0x02, 0x00, 0x02, 0x01, 0x00, 0x90, 0xf9, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+  0xfe, 0x7f, 0x50, 0xfc, 0x50, 0xfc, 0xff, 0x50, 0xff, 0x01, 0x00, 0x07, 0x02, 0x1c, 0x00, 0x14, 0x50, 0x02, 0x00, 0x11, 0xfc, 0x02, 0x00, 0x00,
+  0x16, 0x00, 0x01, 0x08, 0x00, 0x42, 0xff, 0x50, 0xff, 0xfc, 0x20, 0x00, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x17, 0x00, 0x02, 0x13, 0x00,
+  0xf1, 0x02, 0xfc, 0xfc, 0x49, 0xf1, 0x49, 0xf1, 0xf1, 0xf1, 0xf0, 0xfe, 0xf0, 0x49, 0xf1, 0xfc, 0xfc, 0xfc, 0x4d, 0x1b, 0x00, 0x35, 0x50, 0xfc,
+  0x4d, 0x02, 0x00, 0x64, 0x50, 0xfc, 0x4d, 0x4d, 0x50, 0x50, 0x14, 0x00, 0x40, 0x49, 0xeb, 0xa1, 0xd2, 0x02, 0x00, 0x10, 0xd5, 0x01, 0x00, 0x20,
+  0xfd, 0xea, 0x02, 0x00, 0x03, 0x01, 0x00, 0xf0, 0x01, 0xfd, 0xea, 0xeb, 0xea, 0xd5, 0xd2, 0xcd, 0xcd, 0xb5, 0xc8, 0xc2, 0xc5, 0xc2, 0xc5, 0xc2,
+  0xc1, 0x02, 0x00, 0x15, 0xc0, 0x01, 0x00, 0x40, 0xc1, 0xc0, 0xc0, 0xc1, 0x15, 0x00, 0xf0, 0x06, 0xc5, 0xc2, 0xc5, 0xc5, 0xc8, 0xc8, 0xc8, 0xc8,
+  0xcd, 0xc8, 0xcd, 0xcd, 0xcf, 0xd2, 0xd2, 0xd2, 0xcf, 0xb5, 0xc5, 0xc2, 0xc2, 0x1e, 0x00, 0xe0, 0xc0, 0xbc, 0xbd, 0xbc, 0xbd, 0xba, 0xba, 0xba,
+  0xba, 0xbd, 0xba, 0xbd, 0xba, 0xbc, 0x05, 0x00, 0x00, 0x01, 0x00, 0x10, 0xb2, 0x05, 0x00, 0x40, 0xba, 0xbd, 0xbc, 0xbd, 0x44, 0x00, 0xf1, 0x03,
+  0xc0, 0xba, 0xba, 0xba, 0xb8, 0xb0, 0xb7, 0xb7, 0xaf, 0xad, 0xaf, 0xb0, 0xb7, 0xae, 0xae, 0xae, 0xad, 0xaa, 0x05, 0x00, 0x60, 0xaa, 0xaa, 0xae,
+  0xaa, 0xaa, 0xaa, 0x08, 0x00, 0x00, 0x07, 0x00, 0xf1, 0x11, 0xad, 0xad, 0xaa, 0xaa, 0xad, 0xae, 0xaf, 0xad, 0xaf, 0xaf, 0xaf, 0xaf, 0xb0, 0xae,
+  0xaf, 0xb7, 0xb0, 0xbd, 0xb7, 0xb8, 0xb2, 0xbc, 0xb0, 0xc0, 0xc5, 0xc1, 0xc2, 0xc8, 0xc8, 0xc2, 0xc5, 0xbd, 0x7a, 0x00, 0x61, 0xcd, 0xd2, 0xcd,
+  0xd2, 0xd2, 0xd5, 0x02, 0x00, 0xb0, 0xd2, 0xd2, 0xcd, 0xcf, 0xb5, 0xcc, 0xb5, 0xc8, 0xcd, 0xcd, 0xd2, 0x01, 0x00, 0x13, 0xb6, 0xde, 0x00, 0x73,
+  0xfd, 0xd5, 0xd5, 0xd5, 0xd7, 0xd5, 0xd5, 0x0e, 0x00, 0xf1, 0x09, 0xd5, 0xd5, 0xd5, 0xeb, 0xfd, 0xea, 0x2f, 0xea, 0xeb, 0xeb, 0xf8, 0xf8, 0xfd,
+  0xeb, 0x2f, 0xeb, 0x2f, 0xf8, 0xeb, 0x2f, 0xeb, 0xfd, 0xf8, 0xeb, 0x0b, 0x00, 0x01, 0x01, 0x00, 0x10, 0x3d, 0x05, 0x00, 0x20, 0xf8, 0xf9, 0x07,
+  0x00, 0xb0, 0x3d, 0xf9, 0x3d, 0xf9, 0xf9, 0x3d, 0xf8, 0x3d, 0xf8, 0xf9, 0x3d, 0x07, 0x00, 0x20, 0xf9, 0xf9, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x07, 0x00, 0x12, 0xfe, 0x04, 0x00, 0x30, 0xfe, 0xf9, 0x3d, 0x07, 0x00, 0x21, 0xf9, 0xfe, 0x06, 0x00, 0x00, 0xb4, 0x01, 0x00, 0x8d, 0x01, 0x01,
+  0x92, 0x01, 0x00, 0x05, 0x00, 0x01, 0x01, 0x00, 0x05, 0x0a, 0x00, 0x07, 0x09, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x06, 0x00, 0x06, 0x02, 0x00, 0x02,
+  0x11, 0x00, 0x10, 0x50, 0x0b, 0x00, 0x01, 0xf3, 0x01, 0x00, 0xec, 0x01, 0x01, 0x03, 0x02, 0x02, 0x1b, 0x00, 0x80, 0xfc, 0x3d, 0x2f, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xd5, 0x02, 0x00, 0x98, 0x2f, 0x2f, 0xf8, 0x3d, 0xfe, 0x49, 0xf1, 0x49, 0xfc, 0x02, 0x00, 0x42, 0x4d, 0xfc, 0x4c, 0xfc, 0x01, 0x00,
+  0x00, 0xeb, 0x01, 0x61, 0xfc, 0xfc, 0xf1, 0xfe, 0xf9, 0xf8, 0xf7, 0x00, 0x00, 0xf5, 0x00, 0xf6, 0x09, 0xa1, 0xd2, 0xa1, 0xcd, 0xa1, 0xd2, 0xb6,
+  0xcd, 0xcd, 0xb6, 0xcf, 0xa1, 0xea, 0xfd, 0xfd, 0xea, 0xfd, 0xd5, 0xd2, 0xcf, 0xcd, 0xc8, 0xcd, 0xc5, 0xe3, 0x01, 0x10, 0xc0, 0x05, 0x00, 0x01,
+  0x02, 0x00, 0x12, 0xc0, 0x11, 0x00, 0x01, 0xe3, 0x01, 0x20, 0xc2, 0xc8, 0x02, 0x00, 0x11, 0xcd, 0x01, 0x00, 0x30, 0xc8, 0xc5, 0xc5, 0x1e, 0x00,
+  0x40, 0xc0, 0xc0, 0xc0, 0xbd, 0xe3, 0x01, 0x20, 0xbc, 0xba, 0x02, 0x00, 0x61, 0xba, 0xbc, 0xbd, 0xbc, 0xb0, 0xba, 0x07, 0x00, 0x02, 0x02, 0x00,
+  0x20, 0xc0, 0xbc, 0x22, 0x00, 0xf0, 0x00, 0xba, 0xba, 0xb0, 0xb7, 0xb0, 0xaf, 0xaf, 0xae, 0xb7, 0xaf, 0xaf, 0xad, 0xae, 0xaf, 0xae, 0xca, 0x01,
+  0x00, 0xe5, 0x01, 0x20, 0xad, 0xad, 0x08, 0x00, 0x00, 0xe2, 0x01, 0x00, 0xdd, 0x01, 0xf0, 0x12, 0xaa, 0xaa, 0xad, 0xaf, 0xad, 0xae, 0xb7, 0xaf,
+  0xad, 0xb7, 0xb0, 0xb7, 0xae, 0xb0, 0xb0, 0xbd, 0xb0, 0xb0, 0xc0, 0xba, 0xbd, 0xc1, 0xc0, 0xb2, 0xc1, 0xc5, 0xc5, 0xc2, 0xc0, 0xc2, 0xc8, 0xcd,
+  0xc2, 0x76, 0x00, 0x00, 0xce, 0x01, 0x60, 0xb6, 0xcf, 0xd2, 0xd2, 0xcd, 0xcd, 0xf1, 0x01, 0x00, 0x6d, 0x02, 0x01, 0x6f, 0x02, 0x00, 0xf0, 0x01,
+  0x00, 0xd8, 0x01, 0x10, 0xea, 0x03, 0x00, 0x00, 0xd0, 0x00, 0x20, 0xd5, 0xd5, 0xdf, 0x01, 0x60, 0xd7, 0xd5, 0xea, 0xfd, 0xeb, 0xfd, 0x04, 0x00,
+  0x20, 0xf8, 0xeb, 0x02, 0x00, 0x30, 0xeb, 0xeb, 0xf8, 0xd9, 0x01, 0x02, 0xde, 0x01, 0x10, 0xeb, 0xda, 0x01, 0x03, 0x01, 0x00, 0x12, 0xeb, 0xe1,
+  0x01, 0x01, 0xd8, 0x01, 0x10, 0x3d, 0x08, 0x00, 0x01, 0x02, 0x00, 0x00, 0xc8, 0x01, 0x01, 0x07, 0x00, 0x01, 0x12, 0x00, 0x00, 0x0f, 0x00, 0x01,
+  0xd8, 0x01, 0x01, 0x05, 0x00, 0x00, 0x13, 0x00, 0x02, 0x8b, 0x01, 0x02, 0x05, 0x00, 0x21, 0x50, 0xf4, 0x07, 0x00, 0x00, 0x03, 0x00, 0x01, 0x04,
+  0x00, 0x07, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x04, 0xc1, 0x01, 0x00, 0x03, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x14,
+  0x00, 0x00, 0x13, 0x00, 0x00, 0xb6, 0x03, 0x20, 0x50, 0xfa, 0xab, 0x01, 0x00, 0x09, 0x00, 0xc0, 0xfc, 0x49, 0xfe, 0xf8, 0x2f, 0x2f, 0x2f, 0x2f,
+  0xeb, 0x2f, 0xeb, 0xf8, 0x93, 0x02, 0x00, 0x02, 0x00, 0x21, 0x36, 0xf8, 0x9d, 0x00, 0x21, 0xf9, 0xf8, 0x02, 0x00, 0x10, 0x2f, 0x95, 0x02, 0xb0,
+  0xf9, 0x2f, 0xfd, 0x2f, 0xf8, 0xf9, 0xf9, 0xfe, 0xee, 0x49, 0xf0, 0xec, 0x03, 0x23, 0xfe, 0xf0, 0x02, 0x00, 0xd0, 0xf9, 0xee, 0xf9, 0xeb, 0xd5,
+  0xcd, 0xcd, 0xb5, 0xcd, 0xb5, 0xcd, 0xb6, 0xd2, 0x12, 0x01, 0x30, 0xea, 0xd5, 0xd2, 0xe1, 0x01, 0x21, 0xb5, 0xc5, 0x01, 0x00, 0x01, 0xce, 0x01,
+  0x02, 0xe1, 0x01, 0x01, 0x05, 0x00, 0x02, 0x02, 0x00, 0x14, 0xc5, 0xc8, 0x03, 0x20, 0xc2, 0xc8, 0x36, 0x03, 0x43, 0xcf, 0xb5, 0xc8, 0xc5, 0x20,
+  0x00, 0x01, 0xc5, 0x03, 0x02, 0xe6, 0x01, 0x10, 0xba, 0xe4, 0x01, 0x20, 0xba, 0xbc, 0xba, 0x03, 0x11, 0xbc, 0xde, 0x01, 0x01, 0xc3, 0x03, 0x00,
+  0x18, 0x00, 0x71, 0xb0, 0xb0, 0xb7, 0xb7, 0xad, 0xaf, 0xaf, 0xe2, 0x01, 0x50, 0xad, 0xad, 0xad, 0xaf, 0xaa, 0xdc, 0x01, 0x10, 0xae, 0xc9, 0x03,
+  0x00, 0x01, 0x00, 0x00, 0xe3, 0x01, 0x00, 0x16, 0x00, 0xf1, 0x09, 0xad, 0xad, 0xaf, 0xae, 0xaf, 0xaf, 0xb0, 0xaf, 0xb7, 0xb0, 0xba, 0xba, 0xb0,
+  0xbc, 0xbd, 0xba, 0xc0, 0xbd, 0xbd, 0xba, 0xc1, 0xb4, 0xc1, 0xc2, 0x3c, 0x04, 0x01, 0x59, 0x02, 0x11, 0xcf, 0x04, 0x00, 0x10, 0xcc, 0x87, 0x00,
+  0x12, 0xc2, 0x4f, 0x04, 0x25, 0xcd, 0xcf, 0xdf, 0x01, 0x20, 0xfd, 0xea, 0xbe, 0x02, 0x02, 0x96, 0x04, 0x00, 0x0a, 0x00, 0x00, 0xac, 0x04, 0x30,
+  0xfd, 0xea, 0xfd, 0xe4, 0x01, 0x01, 0xdb, 0x01, 0x00, 0xd8, 0x01, 0x00, 0x32, 0x01, 0x00, 0xd3, 0x01, 0x00, 0xd6, 0x01, 0x00, 0x05, 0x00, 0x00,
+  0xf8, 0x01, 0x01, 0x06, 0x00, 0x02, 0x01, 0x00, 0x30, 0x3d, 0xf8, 0xf9, 0x49, 0x01, 0x01, 0x3f, 0x01, 0x03, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00,
+  0x04, 0x00, 0x02, 0x01, 0x00, 0x13, 0xfe, 0xe6, 0x01, 0x00, 0xc0, 0x03, 0x01, 0x9b, 0x01, 0x02, 0xa1, 0x01, 0x02, 0x01, 0x00, 0x00, 0x9f, 0x01,
+  0x00, 0x04, 0x00, 0x02, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x1c, 0x00, 0x10, 0xfc, 0xdc, 0x01, 0x01, 0x0c, 0x00, 0x01, 0x09, 0x00, 0x0f, 0x01,
+  0x00, 0x01, 0x00, 0x27, 0x00, 0x00, 0x29, 0x00, 0x01, 0xcc, 0x03, 0x70, 0xff, 0xfc, 0x49, 0xf0, 0xfe, 0xfe, 0xfe, 0x2d, 0x04, 0x00, 0x47, 0x02,
+  0x00, 0x6b, 0x00, 0x10, 0xf8, 0x05, 0x00, 0x00, 0x0f, 0x00, 0x10, 0x3d, 0x0a, 0x00, 0x00, 0xa1, 0x00, 0x50, 0x3d, 0xf8, 0x3d, 0xeb, 0x2f, 0xbb,
+  0x02, 0x40, 0xfd, 0xeb, 0x2f, 0xea, 0x01, 0x02, 0x10, 0x2f, 0xca, 0x00, 0x00, 0xf8, 0x01, 0x00, 0xe9, 0x00, 0x10, 0xfd, 0x13, 0x01, 0x02, 0x16,
+  0x01, 0x11, 0xd7, 0xdf, 0x01, 0x00, 0x92, 0x03, 0x20, 0xc8, 0xc8, 0xbf, 0x01, 0x00, 0x8b, 0x05, 0x02, 0xe6, 0x01, 0x40, 0xc5, 0xc1, 0xc2, 0xc4,
+  0x07, 0x00, 0x03, 0x04, 0x00, 0x20, 0xc1, 0xc0, 0x05, 0x00, 0x00, 0x6b, 0x01, 0x01, 0x63, 0x01, 0x01, 0xc0, 0x03, 0x10, 0xc5, 0xe3, 0x01, 0x00,
+  0x09, 0x00, 0x00, 0xa7, 0x03, 0x01, 0xe9, 0x01, 0x00, 0x02, 0x00, 0x53, 0xb9, 0xbd, 0xbc, 0xc0, 0xba, 0xdf, 0x01, 0x03, 0x02, 0x00, 0x20, 0xb8,
+  0xae, 0xa2, 0x05, 0x00, 0xc2, 0x03, 0x60, 0xaf, 0xae, 0xae, 0xae, 0xb7, 0xab, 0xd8, 0x01, 0x21, 0xae, 0xaf, 0x06, 0x00, 0x00, 0xc4, 0x03, 0x20,
+  0xae, 0xaa, 0xd1, 0x03, 0x00, 0x10, 0x00, 0xf2, 0x0a, 0xaf, 0xb7, 0xaf, 0xb0, 0xb7, 0xb7, 0xbd, 0xb7, 0xaf, 0xba, 0xba, 0xbd, 0xc0, 0xc1, 0xbc,
+  0xb8, 0xbd, 0xc0, 0xc0, 0xba, 0xc0, 0xc5, 0xc8, 0xc8, 0xb4, 0xcc, 0x01, 0xb0, 0xcd, 0xcf, 0xcd, 0xd2, 0xcd, 0xcd, 0xc5, 0xc2, 0xc2, 0xc5, 0xc5,
+  0xf6, 0x01, 0x11, 0xb5, 0xe3, 0x01, 0x00, 0xc3, 0x03, 0x00, 0xb6, 0x05, 0x10, 0xd7, 0xb3, 0x03, 0x10, 0xd7, 0xd2, 0x01, 0x00, 0x82, 0x06, 0x70,
+  0xd7, 0xfd, 0xd7, 0xfd, 0xea, 0xd5, 0xeb, 0x0b, 0x00, 0x41, 0xeb, 0xeb, 0xeb, 0xeb, 0x05, 0x00, 0x01, 0xde, 0x01, 0x40, 0xeb, 0xf8, 0xeb, 0xf9,
+  0xcc, 0x01, 0x05, 0xd7, 0x01, 0x04, 0x0e, 0x00, 0x01, 0x01, 0x00, 0x01, 0x20, 0x03, 0x00, 0xe8, 0x01, 0x00, 0x01, 0x00, 0x01, 0x5d, 0x01, 0x04,
+  0x94, 0x05, 0x00, 0xdc, 0x01, 0x00, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x11, 0x00, 0x00, 0x93, 0x01, 0x0f, 0x01, 0x00, 0x04, 0x01, 0xb0, 0x01,
+  0x01, 0x05, 0x00, 0x02, 0x01, 0x00, 0x02, 0x0b, 0x00, 0x00, 0xe4, 0x03, 0x07, 0x01, 0x00, 0x01, 0xf4, 0x03, 0x22, 0xff, 0xf4, 0x17, 0x00, 0x02,
+  0x22, 0x00, 0x01, 0xa3, 0x05, 0x01, 0x54, 0x07, 0x01, 0x01, 0x00, 0x00, 0x85, 0x07, 0x30, 0xfc, 0xf0, 0x49, 0x7d, 0x05, 0x12, 0xf8, 0x91, 0x00,
+  0x02, 0x80, 0x00, 0x02, 0x02, 0x00, 0x00, 0xf8, 0x01, 0x00, 0xcf, 0x01, 0x00, 0xb6, 0x00, 0x01, 0x05, 0x00, 0x00, 0x07, 0x00, 0x00, 0xdd, 0x01,
+  0x20, 0xeb, 0xeb, 0xf6, 0x00, 0x01, 0x01, 0x00, 0x00, 0x14, 0x01, 0x20, 0xd2, 0xcf, 0xdd, 0x01, 0x20, 0xc2, 0xc8, 0xd9, 0x01, 0x00, 0x04, 0x00,
+  0x05, 0x01, 0x00, 0x01, 0xec, 0x01, 0x11, 0xc1, 0x13, 0x00, 0x01, 0xbb, 0x05, 0x32, 0xc5, 0xc8, 0xc5, 0x51, 0x01, 0x30, 0xcd, 0xcf, 0xcd, 0x11,
+  0x00, 0x00, 0xbf, 0x03, 0x00, 0x0a, 0x02, 0x01, 0x24, 0x00, 0x00, 0xe3, 0x01, 0x01, 0xd3, 0x01, 0x02, 0x06, 0x00, 0x22, 0xbc, 0xbc, 0xc7, 0x03,
+  0x21, 0xbd, 0xbc, 0xa7, 0x07, 0x40, 0xbd, 0xba, 0xb0, 0xb8, 0xb9, 0x01, 0x10, 0xad, 0xe0, 0x01, 0x20, 0xaf, 0xb7, 0xe5, 0x01, 0x20, 0xae, 0xaf,
+  0xbe, 0x03, 0x01, 0xad, 0x05, 0x01, 0xa8, 0x05, 0x00, 0x13, 0x00, 0x60, 0xad, 0xaf, 0xae, 0xad, 0xaf, 0xb0, 0x01, 0x00, 0x20, 0xb7, 0xb7, 0xbd,
+  0x07, 0x10, 0xbd, 0x3d, 0x00, 0x92, 0xbd, 0xb0, 0xb4, 0xc5, 0xc1, 0xc2, 0xcc, 0xcd, 0xcc, 0xa0, 0x05, 0x21, 0xd2, 0xcf, 0x2d, 0x08, 0x02, 0x9e,
+  0x00, 0x10, 0xc2, 0x92, 0x00, 0x02, 0xe2, 0x01, 0x00, 0xce, 0x01, 0x20, 0xd2, 0xd5, 0xcf, 0x01, 0x00, 0xc0, 0x03, 0x00, 0x02, 0x00, 0x20, 0xd5,
+  0xfd, 0xea, 0x01, 0x10, 0xd7, 0xf0, 0x00, 0x00, 0xc4, 0x03, 0x00, 0x83, 0x07, 0x00, 0x09, 0x01, 0x00, 0xed, 0x02, 0x00, 0xeb, 0x01, 0x00, 0x02,
+  0x00, 0x00, 0x13, 0x01, 0x00, 0xd0, 0x01, 0x01, 0x09, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x8d, 0x07, 0x00, 0xbf, 0x03, 0x00, 0x3d, 0x01, 0x01, 0x4f,
+  0x01, 0x03, 0x01, 0x00, 0x02, 0x94, 0x05, 0x01, 0x58, 0x01, 0x00, 0x14, 0x00, 0x00, 0x04, 0x00, 0x00, 0x91, 0x01, 0x0f, 0x01, 0x00, 0x07, 0x03,
+  0xac, 0x03, 0x13, 0xfc, 0x02, 0x00, 0x06, 0xca, 0x01, 0x01, 0x0c, 0x00, 0x01, 0x01, 0x00, 0x02, 0xd4, 0x01, 0x01, 0x07, 0x00, 0x02, 0xb9, 0x03,
+  0x00, 0x09, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0xe5, 0x01, 0x10, 0x50, 0x0c, 0x00, 0x11, 0x49, 0xaf, 0x05, 0x02, 0x9c, 0x00, 0x00,
+  0x24, 0x06, 0x00, 0xe2, 0x01, 0x02, 0x04, 0x00, 0x05, 0x01, 0x00, 0x11, 0xf8, 0xea, 0x01, 0x00, 0xc6, 0x00, 0x01, 0x86, 0x06, 0x02, 0x01, 0x00,
+  0x01, 0xfb, 0x00, 0x73, 0xd7, 0xd2, 0xd2, 0xcf, 0xcf, 0xcd, 0xc8, 0xc0, 0x01, 0x00, 0x01, 0x00, 0x24, 0xc2, 0xc8, 0xcf, 0x01, 0x03, 0x11, 0x00,
+  0x02, 0x5a, 0x09, 0x30, 0xc8, 0xcd, 0xcc, 0x1d, 0x05, 0x50, 0xcc, 0xcf, 0xcf, 0xcd, 0xcf, 0x32, 0x00, 0x10, 0xc8, 0x27, 0x00, 0x10, 0xc1, 0x1e,
+  0x00, 0x04, 0x01, 0x00, 0x30, 0xc1, 0xc1, 0xc0, 0x02, 0x00, 0x11, 0xbc, 0xc6, 0x03, 0x00, 0xda, 0x01, 0x00, 0x87, 0x07, 0x50, 0xc0, 0xbc, 0xc0,
+  0xc5, 0xc5, 0xa5, 0x09, 0x50, 0xbd, 0xba, 0xb7, 0xb7, 0xb8, 0x60, 0x09, 0x10, 0xaf, 0x83, 0x05, 0x02, 0x04, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x01,
+  0x00, 0x03, 0xe3, 0x01, 0x01, 0xe1, 0x01, 0xd0, 0xaa, 0xae, 0xb7, 0xaf, 0xba, 0xb7, 0xae, 0xb7, 0xb7, 0xbd, 0xbc, 0xba, 0xc0, 0xca, 0x07, 0x40,
+  0xba, 0xbd, 0xba, 0xb8, 0x05, 0x08, 0x11, 0xcd, 0x82, 0x00, 0x00, 0xc8, 0x01, 0x01, 0x4e, 0x06, 0x10, 0xcc, 0x82, 0x00, 0x00, 0x98, 0x00, 0x10,
+  0xc5, 0x50, 0x04, 0x00, 0xd7, 0x03, 0x40, 0xd5, 0xd7, 0xd2, 0xd5, 0xe5, 0x01, 0x00, 0x80, 0x07, 0x42, 0xea, 0xea, 0xea, 0xeb, 0xe6, 0x01, 0x11,
+  0xeb, 0xc4, 0x04, 0x10, 0xea, 0xe1, 0x01, 0x31, 0xeb, 0xeb, 0xea, 0xe1, 0x01, 0x00, 0xfd, 0x00, 0x00, 0x01, 0x00, 0x00, 0xe9, 0x01, 0x00, 0x37,
+  0x01, 0x00, 0x18, 0x01, 0x00, 0x04, 0x00, 0x02, 0x01, 0x00, 0x00, 0x27, 0x01, 0x01, 0x32, 0x01, 0x00, 0xf7, 0x01, 0x00, 0x3d, 0x01, 0x00, 0x17,
+  0x05, 0x00, 0x01, 0x00, 0x00, 0xd9, 0x01, 0x02, 0x54, 0x01, 0x00, 0x08, 0x00, 0x31, 0xfe, 0xf9, 0xfe, 0x8b, 0x01, 0x00, 0x94, 0x01, 0x03, 0x96,
+  0x01, 0x00, 0x09, 0x00, 0x07, 0x01, 0x00, 0x00, 0x23, 0x0b, 0x11, 0xfc, 0x03, 0x00, 0x02, 0x01, 0x00, 0x11, 0xf4, 0x03, 0x00, 0x07, 0x01, 0x00,
+  0x01, 0x20, 0x00, 0x04, 0x02, 0x00, 0x00, 0x01, 0x00, 0x51, 0x50, 0xfc, 0x49, 0xf1, 0xfe, 0x43, 0x07, 0x30, 0xfe, 0xfe, 0xfe, 0x40, 0x0b, 0x20,
+  0x49, 0xf1, 0xaa, 0x05, 0x00, 0x92, 0x00, 0x00, 0x94, 0x00, 0x01, 0x01, 0x00, 0x41, 0xee, 0xf9, 0xfe, 0xee, 0x7e, 0x00, 0x01, 0x8c, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x21, 0x00, 0x02, 0xc5, 0x00, 0x02, 0xe1, 0x00, 0x80, 0xf8, 0xfd, 0xeb, 0xea, 0xeb, 0xea, 0xd7, 0xd5, 0xdd,
+  0x01, 0x01, 0xbc, 0x03, 0x10, 0xc5, 0x02, 0x00, 0x01, 0x05, 0x00, 0x00, 0xb8, 0x01, 0x00, 0xae, 0x01, 0x06, 0xbd, 0x01, 0x00, 0x46, 0x01, 0x40,
+  0xc8, 0xcd, 0xc8, 0xcf, 0xd8, 0x01, 0x00, 0x40, 0x03, 0x00, 0x5e, 0x01, 0x10, 0xcd, 0x59, 0x01, 0x02, 0x02, 0x02, 0x02, 0x31, 0x00, 0x12, 0xc2,
+  0x30, 0x00, 0x10, 0xc1, 0xc8, 0x03, 0x10, 0xc1, 0xbe, 0x03, 0x00, 0xc1, 0x03, 0x00, 0xe1, 0x01, 0x21, 0xc0, 0xc0, 0x24, 0x00, 0x60, 0xc0, 0xba,
+  0xb8, 0xb7, 0xba, 0xb0, 0xb9, 0x01, 0x00, 0x25, 0x0b, 0x10, 0xb8, 0x28, 0x0b, 0x01, 0xde, 0x01, 0x00, 0xd3, 0x01, 0x00, 0x07, 0x00, 0x30, 0xad,
+  0xae, 0xae, 0x41, 0x0b, 0x00, 0x04, 0x00, 0x00, 0xa2, 0x05, 0x20, 0xb8, 0xb0, 0x8a, 0x0b, 0x40, 0xb0, 0xbc, 0xb0, 0xb7, 0xb9, 0x09, 0x30, 0xbd,
+  0xc1, 0xc1, 0x48, 0x0b, 0x00, 0xc8, 0x01, 0x70, 0xd2, 0xd6, 0xd5, 0xd7, 0xd5, 0xd2, 0xd7, 0x86, 0x00, 0x02, 0x66, 0x09, 0x00, 0xc0, 0x03, 0x01,
+  0x1a, 0x00, 0x40, 0xcf, 0xd2, 0xcf, 0xcf, 0xfe, 0x01, 0x00, 0xb7, 0x02, 0x01, 0xbe, 0x02, 0x00, 0xdf, 0x01, 0x42, 0xfd, 0xea, 0xeb, 0xf8, 0xe9,
+  0x01, 0x00, 0xe1, 0x01, 0x00, 0x88, 0x07, 0x00, 0x3e, 0x0b, 0x01, 0xdd, 0x01, 0x01, 0x01, 0x00, 0x00, 0x17, 0x01, 0x05, 0x01, 0x00, 0x00, 0x2f,
+  0x01, 0x00, 0x05, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x3c, 0x01, 0x01, 0xdf, 0x01, 0x0f, 0x01, 0x00, 0x05, 0x01, 0x98, 0x01, 0x00, 0x02, 0x00, 0x14,
+  0xfa, 0xa9, 0x01, 0x13, 0xfa, 0x02, 0x00, 0x08, 0xde, 0x01, 0x00, 0x02, 0x00, 0x03, 0x01, 0x00, 0x00, 0xc1, 0x03, 0x00, 0x02, 0x00, 0x02, 0xa1,
+  0x03, 0x00, 0x80, 0x05, 0x02, 0xcc, 0x01, 0x00, 0x04, 0x0d, 0xc0, 0x49, 0xfc, 0xfc, 0xff, 0xfc, 0xf1, 0xfe, 0xf8, 0xf8, 0xfd, 0x2f, 0xea, 0x27,
+  0x08, 0x00, 0x4f, 0x07, 0x00, 0x84, 0x00, 0x30, 0xf8, 0xf9, 0xec, 0x06, 0x00, 0x40, 0xec, 0xf9, 0xec, 0xf8, 0xb3, 0x00, 0x03, 0xa7, 0x00, 0x03,
+  0x9c, 0x00, 0x00, 0x01, 0x00, 0x01, 0xaf, 0x00, 0x01, 0x01, 0x00, 0x01, 0x09, 0x00, 0x00, 0xa0, 0x04, 0x01, 0x01, 0x00, 0x23, 0xea, 0xea, 0x99,
+  0x05, 0x01, 0x04, 0x03, 0x00, 0xc5, 0x01, 0x00, 0xa0, 0x01, 0x01, 0x0e, 0x00, 0x01, 0x01, 0x00, 0x02, 0x7c, 0x05, 0x01, 0xc3, 0x01, 0x01, 0x1e,
+  0x00, 0x00, 0x5c, 0x01, 0x02, 0x01, 0x00, 0x00, 0x7e, 0x07, 0x00, 0x34, 0x00, 0x01, 0x2a, 0x00, 0x01, 0xd6, 0x01, 0x00, 0x08, 0x00, 0x12, 0xc0,
+  0x0a, 0x00, 0x22, 0xc1, 0xc1, 0xc0, 0x03, 0x11, 0xba, 0xe0, 0x01, 0x10, 0xbc, 0x9e, 0x05, 0x00, 0x17, 0x00, 0xe0, 0xc8, 0xc1, 0xb0, 0xb8, 0xbc,
+  0xba, 0xb0, 0xae, 0xb7, 0xb0, 0xb0, 0xaf, 0xae, 0xae, 0x23, 0x0b, 0x02, 0xa4, 0x05, 0x11, 0xae, 0xd7, 0x01, 0x02, 0x01, 0x00, 0x00, 0xac, 0x05,
+  0x10, 0xaa, 0xb5, 0x05, 0xd0, 0xb7, 0xaf, 0xb7, 0xb0, 0xae, 0xb8, 0xba, 0xb7, 0xb0, 0xb9, 0xbd, 0xb7, 0xb8, 0x87, 0x07, 0x32, 0xc1, 0xc1, 0xbd,
+  0xf9, 0x07, 0x00, 0x8f, 0x02, 0x00, 0xdf, 0x01, 0x00, 0x68, 0x07, 0x90, 0xd5, 0xd7, 0xd5, 0xd6, 0xd2, 0xcd, 0xcf, 0xc8, 0xcd, 0xb9, 0x05, 0x00,
+  0xbc, 0x05, 0x01, 0xc6, 0x03, 0x30, 0xd2, 0xd5, 0xd7, 0xbf, 0x03, 0x01, 0x81, 0x06, 0x00, 0x81, 0x07, 0x00, 0xd2, 0x01, 0x00, 0xdf, 0x01, 0x00,
+  0x11, 0x00, 0x00, 0x02, 0x00, 0x00, 0xfb, 0x00, 0x05, 0xde, 0x01, 0x40, 0xeb, 0xeb, 0xf8, 0xec, 0x15, 0x01, 0x00, 0x01, 0x00, 0x01, 0x34, 0x01,
+  0x00, 0x04, 0x00, 0x01, 0x2f, 0x03, 0x00, 0xa2, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x29, 0x03, 0x02, 0xe6, 0x01, 0x00, 0x0a, 0x00,
+  0x06, 0x0b, 0x00, 0x00, 0xc9, 0x01, 0x03, 0xbc, 0x01, 0x03, 0xd5, 0x01, 0x00, 0xd8, 0x01, 0x01, 0x0e, 0x00, 0x04, 0x01, 0x00, 0x01, 0xdd, 0x01,
+  0x00, 0x05, 0x00, 0x02, 0x02, 0x00, 0x03, 0x01, 0x00, 0x10, 0xfa, 0xd2, 0x0c, 0x00, 0x63, 0x07, 0x20, 0xf1, 0x49, 0x45, 0x09, 0x00, 0x22, 0x04,
+  0x10, 0xf8, 0x09, 0x00, 0x00, 0x74, 0x05, 0x00, 0x63, 0x00, 0x20, 0xfe, 0xee, 0x0a, 0x00, 0x20, 0xeb, 0xfd, 0xce, 0x01, 0x32, 0xeb, 0xeb, 0x2f,
+  0x94, 0x04, 0x00, 0x70, 0x06, 0x10, 0xd5, 0x6b, 0x06, 0x02, 0xad, 0x00, 0x00, 0x04, 0x00, 0x12, 0xf9, 0xf8, 0x01, 0x00, 0xc3, 0x00, 0x00, 0x11,
+  0x00, 0x01, 0x02, 0x02, 0x00, 0x04, 0x00, 0x01, 0xde, 0x01, 0x06, 0xdf, 0x01, 0x11, 0xc5, 0xa9, 0x01, 0x00, 0x09, 0x00, 0x02, 0x01, 0x00, 0x00,
+  0xd3, 0x01, 0x00, 0x51, 0x07, 0x00, 0xae, 0x01, 0x00, 0x10, 0x00, 0x00, 0x24, 0x00, 0x10, 0xcd, 0x5c, 0x01, 0x00, 0xdd, 0x01, 0x00, 0x9d, 0x0c,
+  0x10, 0xcc, 0xd1, 0x05, 0x03, 0x30, 0x00, 0x01, 0x22, 0x00, 0x00, 0x07, 0x00, 0x11, 0xc1, 0x05, 0x00, 0x00, 0x6c, 0x07, 0x21, 0xbc, 0xc0, 0xda,
+  0x01, 0x01, 0x79, 0x03, 0x00, 0xe1, 0x01, 0x00, 0xd4, 0x03, 0x30, 0xc1, 0xc0, 0xba, 0x6f, 0x05, 0x31, 0xb8, 0xb0, 0xb8, 0x67, 0x09, 0x30, 0xb0,
+  0xb8, 0xaf, 0x08, 0x00, 0x00, 0x10, 0x0d, 0x00, 0xba, 0x03, 0x00, 0x05, 0x00, 0x00, 0xcd, 0x03, 0x00, 0x0b, 0x00, 0xb1, 0xb7, 0xaf, 0xae, 0xaf,
+  0xb8, 0xaf, 0xb8, 0xb7, 0xb8, 0xba, 0xb7, 0x53, 0x0f, 0x00, 0x41, 0x00, 0x71, 0xc1, 0xc1, 0xc1, 0xc0, 0xc5, 0xc8, 0xcc, 0x9c, 0x0d, 0x00, 0x85,
+  0x00, 0x00, 0xdd, 0x01, 0x10, 0xfd, 0x3c, 0x08, 0x11, 0xd7, 0x6e, 0x02, 0x00, 0x02, 0x00, 0x12, 0xcd, 0x42, 0x06, 0x00, 0x4d, 0x0b, 0x00, 0xc3,
+  0x03, 0x00, 0xdf, 0x01, 0x02, 0xe1, 0x01, 0x01, 0xf0, 0x00, 0x01, 0x63, 0x09, 0x10, 0xea, 0xb5, 0x04, 0x01, 0xc0, 0x04, 0x01, 0x0b, 0x01, 0x01,
+  0x19, 0x00, 0x21, 0xf8, 0xeb, 0x20, 0x01, 0x20, 0xf9, 0xec, 0x2f, 0x01, 0x00, 0x02, 0x00, 0x01, 0xe4, 0x01, 0x00, 0x43, 0x01, 0x01, 0x37, 0x03,
+  0x00, 0xca, 0x01, 0x06, 0x01, 0x00, 0x01, 0x63, 0x09, 0x06, 0x01, 0x00, 0x00, 0xaa, 0x01, 0x03, 0xb5, 0x03, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00,
+  0x12, 0xfa, 0x0f, 0x00, 0x00, 0x02, 0x00, 0x10, 0xfc, 0x12, 0x00, 0x01, 0x1f, 0x00, 0x00, 0xdb, 0x01, 0x01, 0x01, 0x00, 0x01, 0x0e, 0x00, 0x02,
+  0x02, 0x00, 0x00, 0x1d, 0x00, 0x03, 0x17, 0x00, 0x21, 0xf1, 0xfc, 0x89, 0x05, 0x00, 0x02, 0x00, 0x12, 0xf0, 0x8f, 0x05, 0x00, 0x78, 0x00, 0x10,
+  0xfe, 0x54, 0x09, 0x00, 0xb8, 0x0f, 0x20, 0xfd, 0xd5, 0xec, 0x00, 0x20, 0xfd, 0xd7, 0xf0, 0x0d, 0x20, 0xfd, 0xec, 0x78, 0x00, 0x06, 0x01, 0x00,
+  0x00, 0xa2, 0x00, 0x02, 0xdd, 0x03, 0x12, 0xf9, 0xdf, 0x01, 0x00, 0x02, 0x00, 0x01, 0xa8, 0x04, 0x10, 0xfd, 0x9c, 0x05, 0x00, 0xd9, 0x04, 0x02,
+  0xaa, 0x01, 0x01, 0xe5, 0x01, 0x00, 0x06, 0x00, 0x04, 0x01, 0x00, 0x11, 0xc8, 0xe3, 0x01, 0x00, 0x08, 0x00, 0x00, 0x17, 0x00, 0x21, 0xc8, 0xc8,
+  0x3b, 0x01, 0x00, 0xa1, 0x05, 0x02, 0x35, 0x00, 0x03, 0x2b, 0x00, 0x20, 0xc2, 0xc1, 0xbd, 0x01, 0x00, 0x68, 0x0b, 0x01, 0xe3, 0x01, 0x01, 0xbe,
+  0x03, 0x00, 0x73, 0x07, 0x00, 0x9d, 0x05, 0x01, 0xe0, 0x01, 0x21, 0xbc, 0xbc, 0x5c, 0x05, 0x00, 0x04, 0x0f, 0x10, 0xb8, 0x9c, 0x07, 0x00, 0x79,
+  0x05, 0x30, 0xb8, 0xaf, 0xae, 0x8a, 0x07, 0x00, 0xc0, 0x03, 0x01, 0x51, 0x0b, 0x00, 0xd4, 0x10, 0x00, 0xe0, 0x01, 0x00, 0x8e, 0x07, 0x00, 0xd4,
+  0x03, 0xc0, 0xad, 0xb7, 0xb7, 0xb0, 0xb7, 0xb7, 0xb7, 0xb0, 0xba, 0xb8, 0xba, 0xba, 0x46, 0x00, 0x00, 0xd8, 0x07, 0x10, 0xba, 0x8b, 0x00, 0x70,
+  0xcc, 0xcd, 0xcc, 0xcf, 0xcd, 0xcd, 0xcf, 0xfb, 0x0b, 0x00, 0xbd, 0x03, 0x40, 0xd7, 0xd5, 0xea, 0xd7, 0xfb, 0x0b, 0x00, 0x42, 0x08, 0x00, 0x11,
+  0x08, 0x00, 0x98, 0x00, 0x20, 0xcd, 0xcd, 0x81, 0x02, 0x01, 0x1c, 0x00, 0x01, 0xe2, 0x01, 0x02, 0xb0, 0x03, 0x00, 0xdd, 0x01, 0x04, 0x06, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x38, 0x01, 0x00, 0x09, 0x01, 0x00, 0x14, 0x00, 0x00, 0x18, 0x01, 0x00, 0xf0, 0x01, 0x00, 0x28, 0x01, 0x02, 0x05, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x10, 0x00, 0x30, 0xec, 0xf8, 0xec, 0x42, 0x01, 0x05, 0x01, 0x00, 0x30, 0xfe, 0xf9, 0xee, 0x7c, 0x01, 0x04, 0x01, 0x00,
+  0x23, 0xf8, 0xfe, 0xa7, 0x01, 0x53, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x78, 0x05, 0x03, 0xb3, 0x03, 0x34, 0xfc, 0xfa, 0x50, 0xc5, 0x01, 0x02, 0x05,
+  0x00, 0x01, 0x15, 0x00, 0x03, 0x02, 0x00, 0x00, 0x01, 0x00, 0x04, 0x08, 0x00, 0x02, 0x0b, 0x00, 0x25, 0x50, 0xfc, 0xed, 0x01, 0x00, 0xee, 0x01,
+  0x21, 0xfc, 0xf1, 0xd0, 0x0e, 0x00, 0xbf, 0x12, 0x30, 0xf0, 0xf9, 0xec, 0xda, 0x01, 0x00, 0xac, 0x02, 0x00, 0x05, 0x00, 0x10, 0xeb, 0x79, 0x00,
+  0x30, 0xf9, 0xee, 0xfe, 0x02, 0x00, 0x00, 0x83, 0x00, 0x32, 0xec, 0xf8, 0xec, 0xc1, 0x03, 0x01, 0xe1, 0x01, 0x00, 0xc3, 0x05, 0x30, 0xec, 0xf8,
+  0xeb, 0x7a, 0x07, 0x00, 0x39, 0x0b, 0x00, 0x19, 0x01, 0x00, 0x14, 0x01, 0x08, 0x01, 0x00, 0x00, 0xd8, 0x01, 0x01, 0x04, 0x00, 0x03, 0x05, 0x00,
+  0x02, 0x01, 0x00, 0x20, 0xcd, 0xc8, 0xff, 0x04, 0x00, 0xdd, 0x01, 0x00, 0xde, 0x01, 0x00, 0x09, 0x11, 0x02, 0x7c, 0x07, 0x04, 0xde, 0x01, 0x10,
+  0xc1, 0xdb, 0x01, 0x02, 0x32, 0x00, 0x01, 0x6b, 0x03, 0x00, 0x75, 0x07, 0x10, 0xc0, 0xba, 0x03, 0x00, 0x6c, 0x09, 0x21, 0xc0, 0xc5, 0x11, 0x00,
+  0xe0, 0xbc, 0xbd, 0xc0, 0xc5, 0xc1, 0xbd, 0xc1, 0xb8, 0xba, 0xba, 0xb7, 0xb8, 0xb8, 0xba, 0x06, 0x00, 0x22, 0xae, 0xaf, 0x6e, 0x09, 0x00, 0x6b,
+  0x09, 0x10, 0xad, 0x0c, 0x00, 0x03, 0x01, 0x00, 0x00, 0x9e, 0x05, 0x20, 0xb8, 0xb0, 0x29, 0x00, 0x10, 0xba, 0xe3, 0x01, 0x10, 0xc0, 0xe0, 0x01,
+  0x40, 0xc1, 0xc1, 0xc8, 0xc5, 0x42, 0x04, 0x11, 0xcf, 0x45, 0x04, 0x10, 0xcd, 0xc1, 0x01, 0x80, 0xd7, 0xd5, 0xd7, 0xd7, 0xfd, 0xd7, 0xd7, 0xd7,
+  0x8c, 0x07, 0x12, 0xcf, 0x13, 0x08, 0x40, 0xcd, 0xcc, 0xcd, 0xcc, 0xe0, 0x01, 0x03, 0xe0, 0x03, 0x00, 0x01, 0x00, 0x00, 0xe1, 0x01, 0x12, 0xfd,
+  0xcc, 0x01, 0x00, 0x01, 0x00, 0x10, 0xea, 0xd8, 0x01, 0x03, 0xc3, 0x04, 0x01, 0xdf, 0x01, 0x10, 0xea, 0xf7, 0x02, 0x42, 0xec, 0xf8, 0xf9, 0xf9,
+  0xe6, 0x01, 0x02, 0xe2, 0x01, 0x01, 0xe1, 0x01, 0x00, 0xe3, 0x01, 0x08, 0xdf, 0x01, 0x0e, 0x01, 0x00, 0x00, 0x9e, 0x01, 0x15, 0xfa, 0xa8, 0x01,
+  0x01, 0x3c, 0x09, 0x00, 0xd6, 0x01, 0x00, 0xac, 0x01, 0x00, 0x18, 0x00, 0x02, 0x02, 0x00, 0x00, 0x10, 0x00, 0x10, 0xfa, 0x19, 0x00, 0x05, 0x29,
+  0x00, 0x01, 0x10, 0x00, 0x02, 0x08, 0x00, 0x11, 0xfc, 0x27, 0x00, 0x03, 0xda, 0x01, 0x12, 0xfc, 0xc2, 0x03, 0x00, 0x5c, 0x09, 0x01, 0x06, 0x06,
+  0x01, 0x08, 0x06, 0x00, 0xac, 0x00, 0x50, 0xea, 0xec, 0xeb, 0xf8, 0xeb, 0x73, 0x06, 0x21, 0xeb, 0xf8, 0xd7, 0x01, 0x00, 0xdd, 0x03, 0x10, 0xf0,
+  0x76, 0x09, 0x00, 0xa5, 0x00, 0x10, 0xec, 0xc8, 0x00, 0x00, 0xa7, 0x00, 0x00, 0xe9, 0x01, 0x20, 0xeb, 0xec, 0xbd, 0x02, 0x00, 0xf6, 0x00, 0x00,
+  0xc0, 0x03, 0x10, 0xd7, 0xdc, 0x04, 0x00, 0x17, 0x01, 0x00, 0xc2, 0x01, 0x00, 0x01, 0x00, 0x02, 0xa9, 0x05, 0x02, 0x01, 0x00, 0x00, 0x6e, 0x09,
+  0x00, 0x11, 0x00, 0x02, 0x01, 0x00, 0x00, 0x38, 0x0b, 0x00, 0x8c, 0x09, 0x02, 0x58, 0x09, 0x02, 0x26, 0x00, 0x01, 0xdc, 0x01, 0x03, 0x03, 0x00,
+  0x01, 0xe1, 0x01, 0x00, 0x34, 0x00, 0x10, 0xc5, 0x44, 0x0b, 0x00, 0x73, 0x03, 0x00, 0xdd, 0x14, 0x00, 0x99, 0x01, 0x00, 0x7e, 0x07, 0x01, 0x05,
+  0x00, 0x00, 0x08, 0x00, 0x50, 0xc1, 0xc5, 0xbc, 0xba, 0xb8, 0xb5, 0x01, 0x50, 0xba, 0xba, 0xb7, 0xb7, 0xb7, 0x8b, 0x05, 0x00, 0x39, 0x0b, 0x10,
+  0xae, 0xbc, 0x03, 0x00, 0x0c, 0x00, 0x00, 0x03, 0x00, 0x00, 0x99, 0x07, 0x11, 0xb7, 0xe7, 0x03, 0x70, 0xba, 0xb7, 0xba, 0xb0, 0xb8, 0xb8, 0xbc,
+  0x0e, 0x04, 0x00, 0x47, 0x00, 0x20, 0xc8, 0xcc, 0xde, 0x01, 0x00, 0x9e, 0x03, 0x02, 0xeb, 0x0e, 0x00, 0xc3, 0x01, 0x01, 0xc0, 0x03, 0x00, 0x99,
+  0x00, 0x00, 0xf7, 0x10, 0x00, 0x41, 0x0d, 0x00, 0x62, 0x0b, 0x10, 0xcf, 0x0c, 0x0f, 0x02, 0xdf, 0x01, 0x00, 0x84, 0x07, 0x01, 0x82, 0x07, 0x04,
+  0x01, 0x00, 0x01, 0xdf, 0x01, 0x00, 0xe2, 0x02, 0x03, 0x01, 0x00, 0x02, 0xc9, 0x01, 0x01, 0x05, 0x00, 0x00, 0x1b, 0x01, 0x00, 0x24, 0x01, 0x00,
+  0x78, 0x07, 0x40, 0xf8, 0xf8, 0xf8, 0xee, 0x31, 0x01, 0x05, 0xc0, 0x03, 0x03, 0x07, 0x00, 0x00, 0x3d, 0x03, 0x01, 0x04, 0x00, 0x01, 0x10, 0x00,
+  0x00, 0xbd, 0x01, 0x00, 0x01, 0x00, 0x00, 0x7b, 0x03, 0x01, 0x0a, 0x00, 0x01, 0x05, 0x00, 0x00, 0x10, 0x00, 0x00, 0x09, 0x00, 0x07, 0xd2, 0x01,
+  0x00, 0x10, 0x00, 0x00, 0xe4, 0x03, 0x00, 0x02, 0x00, 0x01, 0x07, 0x02, 0x00, 0xa4, 0x03, 0x01, 0xa7, 0x03, 0x00, 0x60, 0x16, 0x01, 0x02, 0x00,
+  0x02, 0xd5, 0x01, 0x01, 0x6a, 0x00, 0x01, 0x88, 0x03, 0x00, 0x8c, 0x02, 0x00, 0xa1, 0x00, 0x00, 0x01, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x13, 0x00,
+  0x00, 0x50, 0x04, 0x00, 0x01, 0x00, 0x00, 0x3c, 0x06, 0x00, 0xdf, 0x01, 0x00, 0x0b, 0x00, 0x00, 0xb0, 0x03, 0x00, 0xc8, 0x00, 0x00, 0xba, 0x00,
+  0x01, 0xca, 0x03, 0x00, 0xf0, 0x01, 0x00, 0xfb, 0x00, 0x20, 0xea, 0xd7, 0x68, 0x0c, 0x02, 0xb4, 0x01, 0x10, 0xcc, 0xa1, 0x03, 0x00, 0xc7, 0x01,
+  0x02, 0x01, 0x00, 0x00, 0xc1, 0x01, 0x03, 0x02, 0x00, 0x01, 0x9a, 0x05, 0x01, 0x1f, 0x00, 0x00, 0xbd, 0x03, 0x21, 0xcf, 0xc8, 0x96, 0x0c, 0x01,
+  0xc8, 0x01, 0x03, 0x06, 0x00, 0x03, 0xde, 0x01, 0x01, 0xe0, 0x01, 0x02, 0x11, 0x00, 0x00, 0xe1, 0x01, 0x01, 0x02, 0x00, 0x10, 0xc0, 0x78, 0x07,
+  0x10, 0xbc, 0x1a, 0x00, 0x10, 0xc1, 0x48, 0x00, 0x01, 0x3a, 0x00, 0x41, 0xc4, 0xc0, 0xbc, 0xbc, 0xdf, 0x01, 0x40, 0xba, 0xb8, 0xb7, 0xb7, 0x4d,
+  0x0b, 0x00, 0x04, 0x00, 0x04, 0xc2, 0x03, 0x00, 0xc3, 0x03, 0x10, 0xaf, 0x14, 0x00, 0x20, 0xb8, 0xb8, 0xe4, 0x03, 0x10, 0xb7, 0x0a, 0x02, 0x60,
+  0xbc, 0xc0, 0xbc, 0xc1, 0xbc, 0xbd, 0x45, 0x00, 0x02, 0x84, 0x00, 0x00, 0xdf, 0x01, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x61, 0xea, 0xd7, 0xd7,
+  0xd7, 0xd6, 0xd2, 0x99, 0x00, 0x00, 0xb8, 0x05, 0x00, 0x62, 0x04, 0x04, 0xbd, 0x03, 0x00, 0xcd, 0x04, 0x01, 0xa7, 0x04, 0x02, 0xe5, 0x01, 0x00,
+  0x7b, 0x07, 0x00, 0x01, 0x00, 0x00, 0x0d, 0x01, 0x00, 0xdf, 0x01, 0x00, 0x12, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x7e, 0x07, 0x00, 0x1d, 0x01, 0x00,
+  0x04, 0x00, 0x00, 0x09, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x79, 0x07, 0x01, 0x9b, 0x05, 0x00, 0x01, 0x00, 0x03, 0x07, 0x00, 0x02, 0x01, 0x00, 0x00,
+  0xdb, 0x01, 0x01, 0x11, 0x00, 0x00, 0x09, 0x00, 0x32, 0xf9, 0xfe, 0xee, 0xca, 0x01, 0x00, 0xcc, 0x01, 0x00, 0x01, 0x00, 0x20, 0xfa, 0xff, 0x95,
+  0x05, 0x00, 0x90, 0x03, 0x04, 0x12, 0x00, 0x01, 0x14, 0x00, 0x01, 0x02, 0x00, 0x00, 0xdf, 0x01, 0x01, 0x05, 0x00, 0x00, 0x07, 0x00, 0x10, 0xfa,
+  0xb0, 0x03, 0x03, 0xa7, 0x03, 0x11, 0xfe, 0x4c, 0x09, 0x01, 0xe6, 0x01, 0x20, 0xfe, 0xee, 0x5a, 0x02, 0x02, 0x5e, 0x00, 0x00, 0x84, 0x03, 0x00,
+  0x45, 0x08, 0x10, 0xea, 0x60, 0x04, 0x00, 0xdf, 0x01, 0x03, 0xbc, 0x01, 0x21, 0xf8, 0xee, 0x70, 0x0b, 0x00, 0x7d, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0xce, 0x03, 0x00, 0xb2, 0x00, 0x11, 0xeb, 0xa7, 0x05, 0x00, 0x02, 0x00, 0x21, 0xf8, 0xec, 0xce, 0x00, 0x00, 0x1d, 0x02, 0x02, 0xa2, 0x05, 0x00,
+  0xfe, 0x02, 0x00, 0x38, 0x01, 0x23, 0xcd, 0xcc, 0xc4, 0x03, 0x00, 0x01, 0x00, 0x01, 0xd8, 0x01, 0x20, 0xc8, 0xcc, 0x07, 0x00, 0x11, 0xcc, 0xf5,
+  0x04, 0x30, 0xcd, 0xcc, 0xcc, 0x09, 0x00, 0x01, 0x23, 0x00, 0x00, 0xb9, 0x03, 0x05, 0x01, 0x00, 0x03, 0xde, 0x01, 0x03, 0xc0, 0x03, 0x00, 0x11,
+  0x00, 0x61, 0xc1, 0xc1, 0xc4, 0xc0, 0xc1, 0xc4, 0xa7, 0x05, 0x00, 0x72, 0x09, 0x11, 0xc1, 0xf8, 0x0a, 0x01, 0x2b, 0x02, 0x00, 0xf2, 0x12, 0xa0,
+  0xc5, 0xc0, 0xba, 0xbc, 0xbc, 0xb8, 0xb8, 0xb9, 0xba, 0xb9, 0x6b, 0x09, 0x52, 0xba, 0xb7, 0xb0, 0xaf, 0xb7, 0xe4, 0x01, 0x00, 0x08, 0x00, 0x00,
+  0x1e, 0x0f, 0x11, 0xae, 0xe0, 0x01, 0x30, 0xb7, 0xb8, 0xb0, 0xdf, 0x01, 0x00, 0xc6, 0x05, 0x51, 0xba, 0xc0, 0xc0, 0xbc, 0xba, 0x72, 0x02, 0x20,
+  0xc8, 0xc8, 0x1f, 0x0b, 0x00, 0x01, 0x00, 0x00, 0x43, 0x09, 0x43, 0xd7, 0xd2, 0xd5, 0xd7, 0xe1, 0x0d, 0x01, 0x02, 0x00, 0x00, 0xc6, 0x03, 0x00,
+  0x1c, 0x00, 0x30, 0xd7, 0xea, 0xd7, 0xd5, 0x01, 0x00, 0xe4, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x28, 0x01, 0x00, 0x2f, 0x0d, 0x01, 0x12, 0x00, 0x01,
+  0xc0, 0x04, 0x00, 0x0c, 0x00, 0x01, 0x25, 0x00, 0x21, 0xeb, 0xeb, 0x5c, 0x09, 0x00, 0x12, 0x00, 0x40, 0xec, 0xeb, 0xeb, 0xec, 0x1b, 0x00, 0x00,
+  0x4d, 0x01, 0x01, 0xcc, 0x06, 0x00, 0xc9, 0x01, 0x00, 0xc2, 0x03, 0x02, 0x6f, 0x01, 0x01, 0x01, 0x00, 0x01, 0x08, 0x00, 0x00, 0x4a, 0x03, 0x01,
+  0x16, 0x00, 0x00, 0x05, 0x07, 0x00, 0xb3, 0x01, 0x00, 0x01, 0x00, 0x00, 0xc2, 0x01, 0x00, 0xda, 0x01, 0x01, 0xdd, 0x01, 0x00, 0x07, 0x00, 0x00,
+  0xa6, 0x03, 0x30, 0xf4, 0xff, 0xf4, 0xd8, 0x01, 0x02, 0x01, 0x00, 0x01, 0x11, 0x00, 0x02, 0x0f, 0x00, 0x00, 0x06, 0x00, 0x00, 0xa1, 0x07, 0x00,
+  0xf5, 0x03, 0x02, 0x6e, 0x07, 0x01, 0x79, 0x09, 0x00, 0x22, 0x18, 0x21, 0xeb, 0xeb, 0xa4, 0x01, 0x40, 0xfe, 0xf9, 0xec, 0xeb, 0x9a, 0x10, 0x40,
+  0xd5, 0xea, 0xea, 0xf8, 0xbc, 0x03, 0x03, 0x7b, 0x00, 0x01, 0x92, 0x00, 0x21, 0xee, 0xf9, 0x30, 0x00, 0x00, 0x01, 0x00, 0x00, 0x95, 0x09, 0x82,
+  0xfc, 0xf1, 0xf1, 0xfe, 0xf1, 0xfe, 0xf0, 0xf9, 0x39, 0x00, 0x10, 0xf9, 0xe0, 0x00, 0x03, 0xd2, 0x00, 0x01, 0xfa, 0x00, 0x10, 0xd5, 0xc2, 0x03,
+  0x00, 0x01, 0x00, 0x30, 0xcf, 0xcd, 0xcf, 0xa5, 0x03, 0x01, 0x9f, 0x03, 0x05, 0x01, 0x00, 0x11, 0xcc, 0x54, 0x01, 0x00, 0xd8, 0x01, 0x01, 0x17,
+  0x00, 0x01, 0x05, 0x00, 0x00, 0xaa, 0x01, 0x03, 0xa9, 0x03, 0x00, 0x01, 0x00, 0x00, 0x59, 0x09, 0x30, 0xc1, 0xc5, 0xc0, 0xe7, 0x01, 0x00, 0x0e,
+  0x00, 0x03, 0xce, 0x03, 0x03, 0x01, 0x00, 0x00, 0xc1, 0x03, 0x00, 0x77, 0x03, 0x00, 0x37, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x05, 0x0f, 0x31, 0xc1,
+  0xbc, 0xbc, 0x58, 0x07, 0x11, 0xba, 0x84, 0x07, 0x20, 0xb0, 0xb8, 0xc6, 0x03, 0x03, 0x01, 0x00, 0x10, 0xb0, 0xd7, 0x01, 0x00, 0x09, 0x00, 0x00,
+  0xe0, 0x01, 0x00, 0x0c, 0x00, 0x60, 0xb8, 0xbc, 0xb8, 0xb9, 0xba, 0xb8, 0xc1, 0x03, 0x20, 0xc0, 0xc1, 0x21, 0x02, 0x50, 0xcc, 0xc8, 0xcf, 0xd2,
+  0xd6, 0xc2, 0x01, 0x00, 0x41, 0x09, 0x71, 0xd6, 0xd2, 0xd2, 0xd6, 0xd5, 0xea, 0xd7, 0xa3, 0x02, 0x00, 0xa0, 0x05, 0x00, 0x07, 0x00, 0x70, 0xd2,
+  0xd6, 0xd2, 0xd7, 0xd7, 0xea, 0xd7, 0xde, 0x00, 0x04, 0x01, 0x00, 0x00, 0x88, 0x06, 0x20, 0xd7, 0xd5, 0xcd, 0x01, 0x01, 0x48, 0x0b, 0x00, 0xfc,
+  0x00, 0x20, 0xea, 0xeb, 0x3c, 0x01, 0x20, 0xd7, 0xd5, 0xe0, 0x01, 0x01, 0xef, 0x02, 0x00, 0x19, 0x00, 0x02, 0xea, 0x01, 0x00, 0xdf, 0x01, 0x00,
+  0x51, 0x01, 0x00, 0xc6, 0x01, 0x00, 0x96, 0x0a, 0x00, 0x09, 0x00, 0x03, 0x5f, 0x01, 0x01, 0x0d, 0x00, 0x00, 0xf2, 0x01, 0x00, 0xce, 0x05, 0x10,
+  0xee, 0x0b, 0x00, 0x10, 0xee, 0x20, 0x0d, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x03, 0x0b, 0x00, 0x01, 0xe4, 0x01, 0x02, 0x01, 0x00, 0x01, 0x1f,
+  0x00, 0x01, 0xec, 0x01, 0x00, 0xba, 0x03, 0x00, 0x19, 0x00, 0x01, 0x02, 0x00, 0x02, 0x05, 0x00, 0x01, 0x06, 0x00, 0x00, 0x16, 0x00, 0x00, 0x01,
+  0x00, 0x42, 0xfc, 0xf1, 0xfe, 0xfe, 0xbf, 0x03, 0x61, 0xf9, 0xee, 0xf8, 0xf9, 0xeb, 0xeb, 0x81, 0x02, 0x10, 0xea, 0x97, 0x00, 0x01, 0x7d, 0x00,
+  0x10, 0xec, 0x17, 0x00, 0x10, 0xec, 0x75, 0x04, 0x00, 0x76, 0x00, 0x01, 0x5a, 0x00, 0x02, 0x04, 0x00, 0x00, 0x59, 0x02, 0x10, 0xf1, 0xd5, 0x00,
+  0x80, 0xec, 0xec, 0xec, 0xec, 0xeb, 0xec, 0xeb, 0xec, 0xe4, 0x03, 0x30, 0xee, 0xfe, 0xf0, 0x36, 0x00, 0x10, 0xf8, 0x30, 0x00, 0x50, 0xec, 0xec,
+  0xee, 0xee, 0xed, 0x9f, 0x08, 0x11, 0xcc, 0xe2, 0x01, 0x02, 0x01, 0x00, 0x21, 0xcc, 0xc8, 0xd4, 0x01, 0x00, 0x14, 0x00, 0x07, 0x16, 0x00, 0x00,
+  0x01, 0x00, 0x03, 0xdc, 0x01, 0x00, 0xba, 0x01, 0x00, 0x04, 0x00, 0x00, 0x06, 0x00, 0x02, 0xa2, 0x03, 0x03, 0x0b, 0x00, 0x00, 0xd9, 0x01, 0x01,
+  0x01, 0x00, 0x10, 0xbc, 0xc5, 0x03, 0x01, 0xe0, 0x01, 0x22, 0xcc, 0xcf, 0x41, 0x00, 0x20, 0xc5, 0xc9, 0xbe, 0x05, 0x10, 0xb8, 0xbb, 0x03, 0x40,
+  0xbc, 0xba, 0xb9, 0xba, 0x03, 0x00, 0x30, 0xb8, 0xb0, 0xb9, 0x90, 0x07, 0x00, 0x35, 0x0d, 0x90, 0xb7, 0xb8, 0xb8, 0xb8, 0xb0, 0xb9, 0xb0, 0xb8,
+  0xba, 0x7c, 0x07, 0x40, 0xb7, 0xba, 0xba, 0xae, 0x3e, 0x0b, 0x11, 0xba, 0x1d, 0x0d, 0x00, 0x04, 0x00, 0x01, 0xe1, 0x01, 0x00, 0xc7, 0x01, 0x00,
+  0xd3, 0x01, 0x00, 0x5b, 0x09, 0x23, 0xd5, 0xd7, 0x01, 0x00, 0x00, 0xe0, 0x01, 0x00, 0xdb, 0x01, 0x00, 0x04, 0x00, 0x10, 0xd7, 0xbc, 0x03, 0x01,
+  0xaf, 0x01, 0x00, 0xf0, 0x00, 0x00, 0xc4, 0x02, 0x00, 0xdd, 0x01, 0x00, 0x15, 0x00, 0x20, 0xea, 0xea, 0xa4, 0x03, 0x00, 0xbc, 0x04, 0x00, 0x13,
+  0x00, 0x01, 0xf2, 0x01, 0x00, 0xfc, 0x00, 0x00, 0xf5, 0x04, 0x00, 0x30, 0x00, 0x01, 0x01, 0x00, 0x01, 0xe5, 0x04, 0x00, 0xc4, 0x01, 0x03, 0x55,
+  0x01, 0x10, 0xee, 0x1e, 0x00, 0x00, 0x14, 0x00, 0x03, 0x02, 0x00, 0x31, 0xf8, 0xee, 0xf9, 0x97, 0x07, 0x80, 0xf9, 0xf9, 0xf9, 0xf9, 0xec, 0xf9,
+  0xf9, 0xf9, 0x12, 0xff, 0x01, 0x00, 0x11, 0xfa, 0x02, 0x00, 0x10, 0xf4, 0x02, 0x00, 0x04, 0x09, 0x00, 0x50, 0xff, 0xff, 0xfc, 0xff, 0xfc, 0x0d,
+  0x00, 0x00, 0x1e, 0x00, 0x04, 0x01, 0x00, 0xf0, 0x01, 0xfc, 0xfc, 0xfc, 0xfc, 0xf1, 0xfc, 0x49, 0xf0, 0xfe, 0xee, 0xfe, 0xf0, 0xfe, 0xf0, 0xf0,
+  0xf1, 0x01, 0x00, 0x41, 0xfc, 0xf1, 0xfc, 0xfa, 0x29, 0x00, 0x00, 0x1d, 0x00, 0x70, 0xfc, 0xfc, 0xf1, 0xf1, 0xf0, 0xf0, 0xf1, 0x22, 0x00, 0xf0,
+  0x0c, 0xf8, 0xd7, 0xd5, 0xd7, 0xd5, 0xea, 0xea, 0xeb, 0xeb, 0xec, 0xec, 0xf9, 0xf9, 0xee, 0xf8, 0xec, 0xec, 0xec, 0xec, 0xeb, 0xeb, 0xea, 0xea,
+  0xd5, 0xea, 0xeb, 0xf9, 0x35, 0x00, 0x43, 0xf1, 0xf0, 0xf1, 0xf0, 0x42, 0x00, 0x61, 0xf1, 0xf1, 0xf0, 0xee, 0xfd, 0xea, 0x2c, 0x00, 0x30, 0xeb,
+  0xeb, 0xec, 0x04, 0x00, 0x30, 0xf9, 0xf0, 0xfa, 0x4c, 0x00, 0x00, 0x01, 0x00, 0x10, 0xf1, 0x05, 0x00, 0xf0, 0x02, 0xfc, 0xf0, 0xd7, 0xcd, 0xcf,
+  0xcd, 0xcc, 0xcd, 0xcc, 0xcc, 0xcc, 0xc8, 0xc8, 0xc8, 0xcc, 0xc8, 0xcc, 0x05, 0x00, 0x00, 0x01, 0x00, 0x62, 0xcc, 0xc8, 0xcd, 0xcc, 0xcc, 0xc8,
+  0x17, 0x00, 0x20, 0xc8, 0xc8, 0x07, 0x00, 0x10, 0xc5, 0x02, 0x00, 0x11, 0xc5, 0x04, 0x00, 0x06, 0x01, 0x00, 0x70, 0xcc, 0xc8, 0xc9, 0xc8, 0xc9,
+  0xc5, 0xc8, 0x15, 0x00, 0xd0, 0xc1, 0xc1, 0xc1, 0xc1, 0xc0, 0xc4, 0xc1, 0xc4, 0xc0, 0xc1, 0xbc, 0xc0, 0xc1, 0x1c, 0x00, 0x20, 0xc5, 0xc1, 0x40,
+  0x00, 0xf0, 0x00, 0xcc, 0xcc, 0xc5, 0xc5, 0xc8, 0xc8, 0xc8, 0xc5, 0xc1, 0xc4, 0xc0, 0xbe, 0xba, 0xb9, 0xba, 0x01, 0x00, 0x60, 0xb9, 0xba, 0xbc,
+  0xb8, 0xba, 0xbc, 0x0a, 0x00, 0xf0, 0x07, 0xba, 0xbc, 0xbc, 0xba, 0xb8, 0xb8, 0xb7, 0xba, 0xb8, 0xba, 0xba, 0xbc, 0xba, 0xbc, 0xba, 0xb8, 0xb9,
+  0xb0, 0xb8, 0xb8, 0xb7, 0xb7, 0x27, 0x00, 0x00, 0x1f, 0x00, 0x80, 0xbc, 0xc4, 0xc1, 0xbc, 0xbc, 0xc0, 0xc1, 0xc1, 0x41, 0x00, 0xe0, 0xcc, 0xcf,
+  0xcd, 0xd2, 0xd2, 0xd5, 0xd7, 0xd7, 0xd2, 0xd2, 0xd7, 0xea, 0xea, 0xd7, 0x02, 0x01, 0x72, 0xd7, 0xea, 0xd7, 0xd7, 0xd2, 0xd6, 0xd2, 0x03, 0x00,
+  0x00, 0x11, 0x00, 0x10, 0xea, 0x01, 0x00, 0x00, 0xea, 0x00, 0x01, 0x01, 0x00, 0x60, 0xfd, 0xd7, 0xfd, 0xea, 0xea, 0xd7, 0x13, 0x00, 0x11, 0xd7,
+  0x16, 0x00, 0x02, 0x25, 0x01, 0x20, 0xd7, 0xd7, 0x2b, 0x00, 0x00, 0x0e, 0x00, 0x10, 0xf8, 0x10, 0x01, 0x32, 0xf8, 0xeb, 0xea, 0x18, 0x01, 0x90,
+  0xeb, 0xf9, 0xf9, 0xec, 0xf9, 0xee, 0xf9, 0xec, 0xf9, 0x53, 0x01, 0x03, 0x09, 0x00, 0x11, 0xec, 0x05, 0x00, 0x00, 0x18, 0x00, 0x60, 0xf8, 0xee,
+  0xf8, 0xec, 0xf8, 0xec, 0x23, 0x00, 0x31, 0xec, 0xf9, 0xee, 0x22, 0x00, 0x11, 0xec, 0xd8, 0x01, 0x06, 0xc0, 0x01, 0x02, 0x01, 0x00, 0x00, 0xdf,
+  0x01, 0x00, 0x02, 0x00, 0x01, 0xdb, 0x01, 0x00, 0x02, 0x00, 0x01, 0x05, 0x00, 0x00, 0x02, 0x00, 0x00, 0xe3, 0x01, 0x00, 0xc8, 0x01, 0x80, 0xf0,
+  0xfe, 0xf9, 0xf8, 0xeb, 0xeb, 0xfd, 0xea, 0x02, 0x00, 0x65, 0xea, 0xeb, 0xeb, 0xfe, 0xfc, 0xfc, 0x90, 0x01, 0x01, 0x01, 0x00, 0x00, 0xc0, 0x01,
+  0x20, 0xf8, 0xea, 0xde, 0x00, 0x40, 0xd5, 0xea, 0xeb, 0xea, 0x76, 0x00, 0x00, 0xcc, 0x00, 0x00, 0xde, 0x01, 0xf0, 0x00, 0xd7, 0xfd, 0xea, 0xeb,
+  0xec, 0xf8, 0xf9, 0xfe, 0xf9, 0xfe, 0xfe, 0xf8, 0xf9, 0x3d, 0xf9, 0x01, 0x00, 0x80, 0xfe, 0xf9, 0xf9, 0xf9, 0xf8, 0xeb, 0xec, 0xea, 0x4c, 0x00,
+  0x10, 0xea, 0xdd, 0x00, 0x40, 0xd5, 0xd7, 0xeb, 0xf9, 0x34, 0x02, 0x00, 0x4a, 0x00, 0x00, 0x06, 0x00, 0x60, 0xfa, 0xfc, 0xf1, 0xea, 0xd2, 0xcf,
+  0xdd, 0x01, 0x01, 0xe2, 0x01, 0x00, 0xe8, 0x01, 0x00, 0x93, 0x01, 0x00, 0xd2, 0x01, 0x03, 0x08, 0x00, 0x30, 0xcc, 0xc8, 0xcc, 0xbe, 0x01, 0x00,
+  0xa1, 0x01, 0x10, 0xc8, 0xdc, 0x01, 0x01, 0xca, 0x01, 0x32, 0xc8, 0xc8, 0xc9, 0x1b, 0x00, 0x00, 0x01, 0x00, 0x20, 0xc8, 0xcc, 0x16, 0x00, 0x00,
+  0x17, 0x00, 0x30, 0xc1, 0xc1, 0xc1, 0x04, 0x00, 0x30, 0xc0, 0xbc, 0xbc, 0x0a, 0x00, 0x11, 0xc4, 0x2e, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x19, 0x00, 0x61, 0xc1, 0xbc, 0xbc, 0xbc, 0xba, 0xbc, 0x01, 0x00, 0x01, 0x07, 0x00, 0x01, 0x05, 0x00, 0x40, 0xbc, 0xba, 0xb9, 0xb8, 0xd0,
+  0x01, 0xa0, 0xbc, 0xc0, 0xba, 0xba, 0xb9, 0xb8, 0xba, 0xb7, 0xba, 0xb8, 0xed, 0x01, 0x10, 0xb9, 0x1a, 0x00, 0x10, 0xc1, 0x2d, 0x02, 0x30, 0xc1,
+  0xc1, 0xbc, 0x73, 0x00, 0xc0, 0xcc, 0xcf, 0xd2, 0xd2, 0xd6, 0xd7, 0xd2, 0xd2, 0xd2, 0xd7, 0xd7, 0xea, 0xda, 0x01, 0x00, 0x07, 0x00, 0x70, 0xd5,
+  0xd7, 0xd7, 0xcf, 0xd2, 0xcf, 0xd2, 0x01, 0x00, 0x30, 0xd7, 0xd6, 0xd7, 0xcc, 0x01, 0x00, 0x0c, 0x01, 0x23, 0xeb, 0xea, 0x03, 0x00, 0x00, 0xdc,
+  0x01, 0x02, 0x01, 0x00, 0x80, 0xeb, 0xec, 0xeb, 0xec, 0xf8, 0xec, 0xec, 0xeb, 0x33, 0x00, 0x40, 0xd5, 0xd7, 0xd7, 0xea, 0xed, 0x01, 0x31, 0xec,
+  0xeb, 0xf8, 0xdb, 0x01, 0x00, 0xec, 0x01, 0x00, 0xbd, 0x01, 0x24, 0xec, 0xee, 0xd1, 0x01, 0x30, 0xf9, 0xee, 0xf8, 0xcb, 0x01, 0x02, 0xe5, 0x01,
+  0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x20, 0xec, 0xf9, 0x25, 0x00, 0x06, 0x15, 0x00, 0x00, 0x77, 0x03, 0x00, 0xba, 0x01, 0x01, 0x81, 0x03, 0x04,
+  0x02, 0x00, 0x62, 0xf4, 0xfb, 0xfb, 0xfb, 0xff, 0xfb, 0x0b, 0x00, 0x03, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x03, 0xe8, 0x01, 0x00, 0x72, 0x01, 0x01,
+  0xa7, 0x03, 0x20, 0xfe, 0xee, 0xa6, 0x00, 0x20, 0xea, 0xfd, 0xc4, 0x01, 0x00, 0x68, 0x00, 0x10, 0xee, 0x52, 0x02, 0xe1, 0xee, 0xee, 0xee, 0xee,
+  0xed, 0xf9, 0xee, 0xfe, 0xf0, 0xf0, 0xfe, 0xee, 0xee, 0xee, 0x17, 0x00, 0x60, 0xfe, 0xee, 0xfe, 0xfe, 0xf9, 0xf9, 0xa1, 0x00, 0x01, 0xcc, 0x00,
+  0x30, 0xec, 0xeb, 0xf8, 0x13, 0x00, 0x71, 0xf1, 0xf1, 0xf0, 0xf8, 0xf9, 0xf8, 0xf9, 0x1f, 0x00, 0x70, 0xf9, 0xf9, 0xec, 0xf8, 0xf0, 0xf8, 0xeb,
+  0xde, 0x00, 0x70, 0xea, 0xd7, 0xd2, 0xd7, 0xd2, 0xd5, 0xd7, 0x42, 0x00, 0x30, 0xfe, 0xf0, 0xf0, 0x4e, 0x00, 0x10, 0xf0, 0x09, 0x00, 0x30, 0xec,
+  0xd2, 0xcf, 0xd8, 0x01, 0x50, 0xc8, 0xcc, 0xcd, 0xcc, 0xcf, 0xaf, 0x01, 0x31, 0xcd, 0xc8, 0xcd, 0x92, 0x01, 0x04, 0x98, 0x01, 0x03, 0x01, 0x00,
+  0x02, 0xd9, 0x01, 0x30, 0xc9, 0xc8, 0xc9, 0xe8, 0x01, 0x02, 0xd9, 0x01, 0x02, 0x30, 0x00, 0x01, 0x27, 0x00, 0x60, 0xc9, 0xc8, 0xc8, 0xc9, 0xc5,
+  0xc5, 0xb5, 0x03, 0x20, 0xc1, 0xc4, 0xe3, 0x01, 0x40, 0xc1, 0xc5, 0xc4, 0xc0, 0xc1, 0x03, 0x00, 0x98, 0x01, 0x02, 0x0f, 0x02, 0x00, 0xa9, 0x01,
+  0x30, 0xbe, 0xbc, 0xc0, 0xb6, 0x01, 0x10, 0xbe, 0x05, 0x00, 0x00, 0x03, 0x02, 0x00, 0xdc, 0x01, 0x00, 0x04, 0x00, 0x00, 0xaf, 0x03, 0x20, 0xba,
+  0xc1, 0xca, 0x03, 0x00, 0xde, 0x01, 0x41, 0xba, 0xba, 0xba, 0xb8, 0xde, 0x01, 0x10, 0xc0, 0x29, 0x02, 0x21, 0xc0, 0xbc, 0xe0, 0x01, 0x72, 0xc8,
+  0xc8, 0xcd, 0xcc, 0xd2, 0xd2, 0xd5, 0xe1, 0x01, 0x01, 0xe0, 0x01, 0x21, 0xd5, 0xd7, 0xbe, 0x03, 0x20, 0xcf, 0xd2, 0x03, 0x00, 0x10, 0xd2, 0x95,
+  0x03, 0x00, 0x03, 0x01, 0x03, 0x01, 0x00, 0x00, 0x3e, 0x01, 0x00, 0x06, 0x00, 0x00, 0xe5, 0x01, 0x00, 0xc2, 0x01, 0x00, 0xc5, 0x01, 0x00, 0x14,
+  0x00, 0x00, 0x35, 0x00, 0x00, 0x28, 0x00, 0x00, 0x11, 0x00, 0x00, 0x12, 0x00, 0x02, 0x04, 0x00, 0x00, 0xb2, 0x01, 0x00, 0x02, 0x00, 0x20, 0xee,
+  0xf9, 0xe7, 0x01, 0x21, 0xec, 0xec, 0x6e, 0x01, 0x14, 0xf9, 0xee, 0x01, 0x00, 0xfa, 0x01, 0x00, 0x06, 0x00, 0x02, 0x14, 0x00, 0x01, 0x07, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0xb1, 0x01, 0x03, 0xe3, 0x01, 0x06, 0x02, 0x00, 0x60, 0xf4, 0xff, 0xfb, 0xf4, 0xf4, 0xf4, 0xd1, 0x01, 0x02, 0x04, 0x00,
+  0x00, 0x02, 0x00, 0x01, 0x7f, 0x05, 0x40, 0xf1, 0x49, 0xf0, 0x49, 0xb9, 0x01, 0x11, 0xfe, 0x96, 0x01, 0x60, 0xf0, 0xee, 0xf0, 0xee, 0xec, 0xec,
+  0xc8, 0x00, 0x00, 0xa0, 0x00, 0x03, 0x02, 0x00, 0x00, 0xd2, 0x03, 0x00, 0x74, 0x04, 0xd0, 0xf8, 0xf9, 0xec, 0xf8, 0xeb, 0xeb, 0xf8, 0xec, 0xf8,
+  0xf9, 0xf9, 0xf0, 0xfe, 0x83, 0x05, 0x51, 0xf1, 0xf0, 0xf0, 0xfe, 0xec, 0x73, 0x04, 0x60, 0xec, 0xec, 0xf9, 0xf1, 0xfc, 0xfa, 0x51, 0x00, 0x30,
+  0xf1, 0xf1, 0xf0, 0x80, 0x05, 0x00, 0x2c, 0x02, 0x02, 0xae, 0x05, 0x82, 0xfc, 0xee, 0xeb, 0xd7, 0xd5, 0xd7, 0xd2, 0xd7, 0xdb, 0x00, 0x00, 0xcd,
+  0x05, 0x00, 0x03, 0x00, 0x00, 0xe4, 0x02, 0xf0, 0x04, 0xd2, 0xd2, 0xcd, 0xcc, 0xcd, 0xcf, 0xcf, 0xcf, 0xcf, 0xcd, 0xcf, 0xcf, 0xcd, 0xcd, 0xcf,
+  0xcf, 0xd2, 0xd6, 0xd2, 0xb5, 0x01, 0x10, 0xc5, 0xb8, 0x01, 0x00, 0xe7, 0x01, 0x30, 0xc8, 0xc5, 0xc9, 0xbb, 0x03, 0x13, 0xc5, 0xdb, 0x01, 0x02,
+  0x02, 0x00, 0x50, 0xcc, 0xc8, 0xcc, 0xcf, 0xcf, 0x19, 0x02, 0x13, 0xcf, 0xe6, 0x01, 0x00, 0x01, 0x00, 0x20, 0xc5, 0xc1, 0xe6, 0x01, 0x01, 0x01,
+  0x00, 0x30, 0xc9, 0xc5, 0xc1, 0x28, 0x00, 0x00, 0x99, 0x01, 0x00, 0xf7, 0x03, 0x10, 0xcc, 0xbf, 0x03, 0x00, 0xac, 0x01, 0x02, 0xdc, 0x01, 0x00,
+  0xdf, 0x01, 0x31, 0xc6, 0xc0, 0xbe, 0x02, 0x00, 0x00, 0xc0, 0x03, 0x00, 0xe6, 0x01, 0xb1, 0xc0, 0xba, 0xba, 0xb8, 0xb8, 0xb8, 0xb8, 0xba, 0xb7,
+  0xb7, 0xb8, 0xf4, 0x01, 0x01, 0xfb, 0x01, 0x41, 0xc1, 0xc1, 0xc4, 0xc5, 0x2b, 0x02, 0x11, 0xcc, 0xbf, 0x03, 0x10, 0xd6, 0xca, 0x01, 0x10, 0xd2,
+  0xa4, 0x01, 0x00, 0x01, 0x00, 0x10, 0xd5, 0x0d, 0x00, 0x00, 0xc0, 0x03, 0x60, 0xcf, 0xd2, 0xcf, 0xd6, 0xd2, 0xd6, 0x13, 0x00, 0x01, 0xd2, 0x00,
+  0x00, 0xe1, 0x00, 0x09, 0x01, 0x00, 0x00, 0x12, 0x00, 0x00, 0xf0, 0x01, 0x00, 0x51, 0x01, 0x01, 0xbe, 0x03, 0x00, 0x4f, 0x01, 0x00, 0x19, 0x00,
+  0x03, 0x34, 0x01, 0x02, 0xc0, 0x01, 0x01, 0x08, 0x00, 0x00, 0xcb, 0x03, 0x10, 0xee, 0x83, 0x05, 0x00, 0xe9, 0x01, 0x00, 0x05, 0x00, 0x00, 0x9a,
+  0x05, 0x01, 0xc2, 0x03, 0x10, 0xee, 0xe0, 0x03, 0x00, 0x19, 0x00, 0x00, 0xdd, 0x01, 0x36, 0xee, 0xf9, 0xee, 0xdc, 0x01, 0x00, 0xc3, 0x01, 0x10,
+  0xfa, 0x7f, 0x07, 0x41, 0xf4, 0xff, 0xf4, 0xf4, 0xc0, 0x03, 0x00, 0x12, 0x00, 0x00, 0x04, 0x00, 0x03, 0x02, 0x00, 0x92, 0xfc, 0xf1, 0xf1, 0x49,
+  0xee, 0xf8, 0xf8, 0xf8, 0xeb, 0xc5, 0x01, 0x00, 0x77, 0x00, 0x10, 0xeb, 0x92, 0x03, 0x10, 0xeb, 0x6b, 0x00, 0x00, 0x0c, 0x04, 0x02, 0x01, 0x00,
+  0x00, 0xd7, 0x01, 0x40, 0xeb, 0xeb, 0xeb, 0xf9, 0xa3, 0x05, 0x00, 0xd6, 0x01, 0x20, 0xfe, 0xfe, 0xc0, 0x03, 0x02, 0x18, 0x02, 0x00, 0x77, 0x02,
+  0x01, 0x79, 0x02, 0x20, 0xfe, 0xfa, 0x43, 0x02, 0x00, 0x6b, 0x00, 0x40, 0xff, 0xf4, 0xf4, 0xf4, 0xeb, 0x01, 0x11, 0xfc, 0x0d, 0x06, 0x80, 0xf1,
+  0xfe, 0xee, 0xf9, 0xee, 0xeb, 0xf8, 0xeb, 0xd3, 0x03, 0x30, 0xf9, 0xec, 0xfd, 0xe9, 0x00, 0x40, 0xd5, 0xd6, 0xd5, 0xd2, 0xd6, 0x05, 0x00, 0x93,
+  0x06, 0x00, 0x2a, 0x04, 0x10, 0xeb, 0xd4, 0x03, 0x50, 0xee, 0xf0, 0xf0, 0xdc, 0xcf, 0xe0, 0x01, 0x02, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0xda,
+  0x01, 0x00, 0xc0, 0x03, 0x01, 0x04, 0x00, 0x01, 0x07, 0x00, 0x00, 0x20, 0x00, 0x60, 0xcc, 0xcf, 0xd2, 0xcf, 0xcc, 0xcf, 0x03, 0x00, 0x00, 0x05,
+  0x00, 0x00, 0xe6, 0x01, 0x10, 0xc9, 0xcb, 0x05, 0x00, 0xb9, 0x05, 0x81, 0xc8, 0xc9, 0xcc, 0xc9, 0xc8, 0xc8, 0xcc, 0xc9, 0xde, 0x01, 0x01, 0x36,
+  0x00, 0x22, 0xc5, 0xc5, 0xd7, 0x03, 0x50, 0xbc, 0xc0, 0xbc, 0xba, 0xbc, 0xd7, 0x01, 0x30, 0xc1, 0xbc, 0xc1, 0x99, 0x03, 0x40, 0xc1, 0xbc, 0xb9,
+  0xba, 0xe0, 0x01, 0x00, 0x87, 0x07, 0x20, 0xb9, 0xb8, 0x9a, 0x05, 0x21, 0xb8, 0xb9, 0xef, 0x01, 0x11, 0xb8, 0xc3, 0x03, 0x50, 0xba, 0xc1, 0xc4,
+  0xc5, 0xc6, 0x25, 0x02, 0x20, 0xcc, 0xcc, 0xc5, 0x01, 0x00, 0x7d, 0x07, 0x53, 0xd2, 0xd6, 0xd2, 0xd6, 0xd5, 0xbe, 0x03, 0x20, 0xd7, 0xd7, 0xf1,
+  0x01, 0x00, 0xbf, 0x03, 0x10, 0xd6, 0x85, 0x07, 0x01, 0xfa, 0x01, 0x02, 0xba, 0x01, 0x00, 0x9c, 0x08, 0x00, 0x2c, 0x01, 0x00, 0x06, 0x00, 0x00,
+  0xf3, 0x01, 0x01, 0xfc, 0x01, 0x00, 0xfe, 0x01, 0x00, 0x01, 0x00, 0x00, 0x15, 0x00, 0x01, 0x23, 0x00, 0x01, 0x01, 0x00, 0x11, 0xec, 0xb5, 0x01,
+  0x00, 0xcd, 0x01, 0x00, 0x6d, 0x01, 0x02, 0x0b, 0x00, 0x00, 0x4f, 0x01, 0x00, 0x8f, 0x05, 0x00, 0x0c, 0x00, 0x30, 0xec, 0xf9, 0xf8, 0x59, 0x01,
+  0x00, 0xd3, 0x01, 0x00, 0x02, 0x00, 0x01, 0x28, 0x00, 0x40, 0xed, 0xf9, 0xee, 0xee, 0xb9, 0x01, 0x01, 0x02, 0x00, 0x64, 0xfb, 0xf4, 0xfb, 0xfb,
+  0xf4, 0xf4, 0x06, 0x00, 0x00, 0x01, 0x00, 0x11, 0xfb, 0x7e, 0x01, 0x01, 0x1d, 0x00, 0x02, 0x02, 0x00, 0x00, 0x7a, 0x07, 0x01, 0x87, 0x03, 0x00,
+  0x61, 0x01, 0x00, 0x06, 0x04, 0x00, 0x0c, 0x08, 0x31, 0xeb, 0xeb, 0xf0, 0x02, 0x09, 0x00, 0x67, 0x09, 0x00, 0xd0, 0x01, 0x00, 0x01, 0x00, 0x73,
+  0xf0, 0xf9, 0xec, 0xeb, 0xf8, 0xf0, 0x50, 0x3e, 0x00, 0x20, 0xfa, 0xfa, 0x4b, 0x07, 0x50, 0xf2, 0xfc, 0xf0, 0xf9, 0xee, 0x30, 0x00, 0x71, 0xee,
+  0xf0, 0xf1, 0xf1, 0xfe, 0xf1, 0xfc, 0x69, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0xfb, 0x05, 0x02, 0x2e, 0x00, 0x00, 0x4b, 0x00, 0x00,
+  0x01, 0x00, 0x30, 0xfa, 0xfc, 0xf1, 0xb1, 0x05, 0x00, 0xba, 0x03, 0x60, 0xd7, 0xd7, 0xd6, 0xd5, 0xea, 0xf0, 0x90, 0x09, 0x00, 0x01, 0x00, 0x00,
+  0xf0, 0x03, 0x00, 0x21, 0x06, 0x22, 0xee, 0xcd, 0xa1, 0x05, 0x00, 0x01, 0x00, 0x00, 0xae, 0x01, 0x00, 0x3e, 0x09, 0x02, 0x01, 0x00, 0x01, 0x9f,
+  0x07, 0x01, 0xb1, 0x01, 0x00, 0xb3, 0x03, 0x20, 0xcf, 0xd6, 0xdd, 0x01, 0x01, 0xe0, 0x01, 0x10, 0xd2, 0xe4, 0x01, 0x21, 0xcc, 0xc8, 0xd6, 0x01,
+  0x00, 0x70, 0x09, 0x00, 0x20, 0x00, 0x00, 0x31, 0x00, 0x00, 0xea, 0x03, 0x20, 0xc5, 0xc9, 0x0d, 0x04, 0x00, 0xe1, 0x01, 0x10, 0xc6, 0x62, 0x09,
+  0x40, 0xbc, 0xbc, 0xbc, 0xb9, 0xda, 0x01, 0x60, 0xba, 0xbc, 0xc1, 0xbe, 0xba, 0xb9, 0xdc, 0x01, 0x00, 0x6d, 0x09, 0xc1, 0xb8, 0xb8, 0xb8, 0xb7,
+  0xb8, 0xb7, 0xb8, 0xba, 0xb8, 0xb7, 0xb7, 0xb9, 0xb0, 0x05, 0x30, 0xb9, 0xba, 0xba, 0xdc, 0x03, 0x60, 0xc4, 0xc5, 0xc1, 0xc0, 0xc8, 0xc9, 0x6d,
+  0x00, 0x00, 0xa2, 0x03, 0x31, 0xcf, 0xd6, 0xd6, 0x04, 0x00, 0x00, 0x6c, 0x07, 0x00, 0x6d, 0x06, 0x22, 0xd7, 0xd5, 0xd8, 0x01, 0x02, 0x06, 0x00,
+  0x00, 0x9f, 0x07, 0x00, 0xa5, 0x05, 0x02, 0x32, 0x09, 0x01, 0x22, 0x03, 0x00, 0x09, 0x00, 0x11, 0xdc, 0xe9, 0x00, 0x00, 0xb7, 0x03, 0x00, 0xe4,
+  0x01, 0x61, 0xea, 0xeb, 0xeb, 0xed, 0xeb, 0xed, 0x1e, 0x00, 0x01, 0xbc, 0x03, 0x00, 0x09, 0x00, 0x10, 0xec, 0xe0, 0x06, 0x00, 0xcb, 0x01, 0x10,
+  0xed, 0x79, 0x01, 0x00, 0xc1, 0x01, 0x00, 0xab, 0x03, 0x04, 0x01, 0x00, 0x00, 0xd2, 0x01, 0x00, 0xbf, 0x03, 0x00, 0x02, 0x00, 0x03, 0x0d, 0x00,
+  0x43, 0xec, 0xf9, 0xed, 0xec, 0xa0, 0x05, 0x00, 0x73, 0x07, 0x10, 0xe9, 0x01, 0x00, 0x10, 0xfb, 0x02, 0x00, 0x10, 0xfb, 0x54, 0x03, 0x11, 0xff,
+  0x79, 0x01, 0x01, 0x7b, 0x01, 0x00, 0x73, 0x07, 0x01, 0x07, 0x00, 0x00, 0xc5, 0x03, 0x40, 0xff, 0xfc, 0xfc, 0xf2, 0x81, 0x01, 0x01, 0x01, 0x00,
+  0x01, 0xd3, 0x01, 0x00, 0x11, 0x00, 0x06, 0x13, 0x00, 0x01, 0x01, 0x00, 0x60, 0xf1, 0xf9, 0xeb, 0xeb, 0xfc, 0xfc, 0xb2, 0x01, 0x00, 0x42, 0x00,
+  0x00, 0x47, 0x00, 0x40, 0xf4, 0xf4, 0xf1, 0xf9, 0xc3, 0x00, 0x40, 0xea, 0xd7, 0xea, 0xf0, 0x49, 0x00, 0x03, 0x1c, 0x00, 0x04, 0xe5, 0x01, 0x01,
+  0x01, 0x00, 0x01, 0xe1, 0x01, 0x31, 0xfa, 0xfa, 0xf4, 0x12, 0x02, 0x31, 0xfc, 0xfe, 0xf8, 0xbe, 0x00, 0x10, 0xdc, 0xb9, 0x03, 0x61, 0xd2, 0xd7,
+  0xee, 0xf1, 0xfa, 0xfc, 0x28, 0x02, 0x01, 0x1d, 0x00, 0x40, 0xfa, 0xfc, 0xf1, 0xeb, 0xab, 0x01, 0x01, 0xa6, 0x01, 0x00, 0xde, 0x01, 0x00, 0xdd,
+  0x01, 0xf1, 0x03, 0xc5, 0xcc, 0xc9, 0xc8, 0xcf, 0xd2, 0xea, 0xec, 0xed, 0xec, 0xed, 0xed, 0xeb, 0xec, 0xea, 0xd7, 0xd6, 0xd2, 0xd0, 0x05, 0x00,
+  0xd4, 0x01, 0x00, 0xd6, 0x01, 0x00, 0x0a, 0x00, 0x11, 0xcf, 0xd0, 0x01, 0x00, 0x32, 0x00, 0x00, 0x37, 0x00, 0x00, 0x02, 0x00, 0x00, 0xcb, 0x03,
+  0x50, 0xc5, 0xc9, 0xc8, 0xc5, 0xc4, 0xad, 0x05, 0x40, 0xc8, 0xc9, 0xc5, 0xc4, 0xc0, 0x03, 0x03, 0xe1, 0x01, 0x30, 0xba, 0xb9, 0xbc, 0xc7, 0x01,
+  0x20, 0xb8, 0xb7, 0xb1, 0x03, 0x20, 0xb7, 0xb7, 0x33, 0x0b, 0x30, 0xb7, 0xb8, 0xae, 0xe2, 0x01, 0x90, 0xae, 0xae, 0xb8, 0xba, 0xba, 0xb9, 0xb7,
+  0xba, 0xba, 0x05, 0x02, 0x50, 0xbe, 0xbc, 0xc1, 0xc4, 0xc1, 0xbd, 0x03, 0x40, 0xcc, 0xc9, 0xcf, 0xd0, 0x96, 0x00, 0x00, 0xdd, 0x0b, 0x00, 0xed,
+  0x01, 0x00, 0x30, 0x0b, 0x00, 0xaf, 0x01, 0x00, 0xa5, 0x05, 0x02, 0xdd, 0x01, 0x00, 0x06, 0x00, 0x11, 0xd6, 0x80, 0x06, 0x00, 0xa1, 0x03, 0x04,
+  0x01, 0x00, 0x00, 0x0d, 0x00, 0x04, 0x28, 0x00, 0x00, 0xde, 0x01, 0x20, 0xd7, 0xea, 0xdc, 0x01, 0x01, 0xcd, 0x01, 0x00, 0x06, 0x00, 0x10, 0xee,
+  0x05, 0x00, 0x01, 0x01, 0x00, 0x01, 0xc6, 0x03, 0x00, 0xba, 0x01, 0x01, 0xb4, 0x03, 0x00, 0x01, 0x00, 0x02, 0xe2, 0x01, 0x00, 0xec, 0x01, 0x00,
+  0xc2, 0x03, 0x00, 0xd9, 0x03, 0x02, 0xe2, 0x01, 0x01, 0x29, 0x00, 0x00, 0x05, 0x00, 0x00, 0x52, 0x01, 0x01, 0x02, 0x00, 0x20, 0xe9, 0xf7, 0xe0,
+  0x01, 0x01, 0xe3, 0x01, 0x00, 0x3b, 0x05, 0x10, 0xfb, 0x02, 0x00, 0x00, 0x84, 0x01, 0x01, 0xde, 0x01, 0x02, 0x33, 0x03, 0x00, 0x58, 0x01, 0x00,
+  0x61, 0x01, 0x06, 0x0a, 0x00, 0x10, 0xfa, 0xb5, 0x05, 0x00, 0x78, 0x05, 0x01, 0x02, 0x00, 0x10, 0xec, 0xd7, 0x03, 0x03, 0xce, 0x03, 0x11, 0xf0,
+  0x6a, 0x03, 0x00, 0xfd, 0x01, 0x01, 0x01, 0x00, 0x51, 0xff, 0xfc, 0xfa, 0xf0, 0xec, 0xa1, 0x02, 0x41, 0xd5, 0xd7, 0xeb, 0xf1, 0x5f, 0x00, 0x07,
+  0x01, 0x00, 0x00, 0x4b, 0x02, 0x00, 0x6c, 0x00, 0x01, 0x4e, 0x02, 0x03, 0x01, 0x00, 0x10, 0xfc, 0x8f, 0x07, 0x50, 0xf0, 0xf0, 0xed, 0xd7, 0xd2,
+  0x77, 0x03, 0x20, 0xd2, 0xeb, 0x4a, 0x00, 0x13, 0xfa, 0x52, 0x02, 0x00, 0x50, 0x0d, 0x31, 0xed, 0xd6, 0xcd, 0x8a, 0x03, 0x33, 0xc8, 0xc9, 0xc5,
+  0xaf, 0x01, 0x00, 0x7a, 0x05, 0x23, 0xd2, 0xef, 0x78, 0x00, 0x10, 0xf0, 0x02, 0x00, 0x20, 0xed, 0xd6, 0x3c, 0x00, 0x00, 0x72, 0x01, 0x00, 0x01,
+  0x00, 0x00, 0x9e, 0x05, 0x00, 0xde, 0x01, 0x00, 0xc9, 0x01, 0x00, 0xa9, 0x03, 0x01, 0x87, 0x09, 0x01, 0x3c, 0x00, 0x00, 0x8b, 0x07, 0x12, 0xc4,
+  0x97, 0x07, 0x00, 0xe0, 0x01, 0x11, 0xc4, 0x80, 0x07, 0x30, 0xba, 0xb9, 0xb9, 0x20, 0x0b, 0x30, 0xb8, 0xb9, 0xb7, 0xd7, 0x01, 0x10, 0xaf, 0x06,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0xc2, 0x03, 0x00, 0xec, 0x01, 0x10, 0xb8, 0xd5, 0x03, 0x01, 0xe0, 0x01, 0x60, 0xbc, 0xc1, 0xbe, 0xc1, 0xc1, 0xc9,
+  0xbf, 0x03, 0x13, 0xc8, 0xbd, 0x09, 0x00, 0xac, 0x05, 0x00, 0xe4, 0x01, 0x00, 0xd1, 0x01, 0x01, 0xb1, 0x01, 0x11, 0xd7, 0xd9, 0x01, 0x01, 0x9a,
+  0x07, 0x00, 0xd5, 0x03, 0x00, 0xd0, 0x01, 0x00, 0x9a, 0x04, 0x00, 0xc5, 0x03, 0x10, 0xdc, 0xa4, 0x04, 0x00, 0xdb, 0x01, 0x00, 0xdc, 0x01, 0x01,
+  0xdf, 0x01, 0x10, 0xea, 0x15, 0x00, 0x30, 0xec, 0xeb, 0xed, 0x1e, 0x05, 0x02, 0xb7, 0x03, 0x09, 0x01, 0x00, 0x01, 0xb9, 0x01, 0x03, 0x08, 0x00,
+  0x00, 0xce, 0x0a, 0x10, 0xf9, 0x0b, 0x00, 0x00, 0xb0, 0x03, 0x00, 0x96, 0x05, 0x00, 0xe0, 0x0a, 0x00, 0x1a, 0x00, 0x00, 0xdc, 0x03, 0x00, 0x21,
+  0x00, 0x23, 0xec, 0xfc, 0x80, 0x07, 0x16, 0xf4, 0xdf, 0x01, 0x0a, 0x54, 0x03, 0x00, 0x4a, 0x03, 0x40, 0xee, 0xfe, 0xee, 0xf0, 0x01, 0x00, 0x00,
+  0xb6, 0x01, 0x00, 0xde, 0x0e, 0x03, 0x01, 0x00, 0x00, 0x70, 0x01, 0x30, 0xfe, 0xee, 0x2f, 0x8e, 0x07, 0x21, 0xd7, 0xfd, 0x9c, 0x00, 0x00, 0xed,
+  0x0d, 0x10, 0xeb, 0x21, 0x00, 0x00, 0x46, 0x05, 0x80, 0xfc, 0xf0, 0xfe, 0xf0, 0xfe, 0xf1, 0xf0, 0xf1, 0x3b, 0x09, 0x80, 0xfe, 0xf0, 0xf1, 0xf1,
+  0xf9, 0xec, 0xeb, 0xeb, 0x9d, 0x02, 0x21, 0xf9, 0xfc, 0x59, 0x00, 0x00, 0xd0, 0x01, 0x01, 0x49, 0x02, 0x00, 0xc7, 0x03, 0x00, 0x53, 0x02, 0x00,
+  0x12, 0x00, 0x00, 0x02, 0x00, 0x00, 0x90, 0x07, 0x00, 0xe9, 0x01, 0x00, 0x27, 0x02, 0x11, 0xec, 0xde, 0x01, 0xa0, 0xcf, 0xcf, 0xd6, 0xed, 0xee,
+  0xec, 0xee, 0xf1, 0xf0, 0xee, 0xb4, 0x00, 0xa0, 0xed, 0xec, 0xeb, 0xd7, 0xea, 0xea, 0xd6, 0xd2, 0xcf, 0xcc, 0x9f, 0x01, 0x02, 0x83, 0x03, 0x00,
+  0x57, 0x07, 0x00, 0x62, 0x01, 0x10, 0xea, 0x78, 0x00, 0x00, 0x06, 0x02, 0x00, 0x01, 0x00, 0x20, 0xf1, 0xf1, 0xbb, 0x0a, 0x00, 0x74, 0x07, 0x00,
+  0xa2, 0x05, 0x00, 0x08, 0x00, 0x00, 0x5b, 0x03, 0x00, 0xc5, 0x01, 0x71, 0xc5, 0xc4, 0xc1, 0xc4, 0xc1, 0xc1, 0xc4, 0xde, 0x01, 0x10, 0xc9, 0x82,
+  0x07, 0x13, 0xc9, 0x04, 0x00, 0x10, 0xc1, 0x3f, 0x0d, 0x30, 0xc4, 0xc1, 0xc0, 0x3e, 0x0b, 0x00, 0xdf, 0x01, 0x00, 0xbe, 0x03, 0x20, 0xb7, 0xae,
+  0xd6, 0x01, 0x01, 0x04, 0x00, 0x00, 0xcb, 0x03, 0x01, 0x07, 0x00, 0x50, 0xba, 0xb7, 0xb8, 0xba, 0xba, 0x62, 0x09, 0x60, 0xb9, 0xbc, 0xbe, 0xc1,
+  0xbe, 0xba, 0xfc, 0x0e, 0x00, 0x2f, 0x02, 0x52, 0xc5, 0xc8, 0xc1, 0xc4, 0xc8, 0x74, 0x0d, 0x00, 0xe2, 0x01, 0x00, 0x13, 0x06, 0x01, 0x49, 0x0b,
+  0x02, 0xbc, 0x03, 0x10, 0xd2, 0x61, 0x09, 0x00, 0xf1, 0x01, 0x22, 0xd7, 0xdc, 0xe1, 0x01, 0x02, 0x02, 0x00, 0x30, 0xea, 0xd7, 0xea, 0xc6, 0x05,
+  0x03, 0x01, 0x00, 0x01, 0x1a, 0x00, 0x10, 0xec, 0xc1, 0x03, 0x00, 0x02, 0x00, 0x02, 0x01, 0x00, 0x04, 0x0a, 0x00, 0x02, 0x06, 0x00, 0x00, 0xd8,
+  0x01, 0x00, 0x05, 0x00, 0x01, 0xc6, 0x01, 0x01, 0x12, 0x01, 0x00, 0x04, 0x00, 0x01, 0x16, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x06, 0x00, 0x01, 0x19,
+  0x00, 0x00, 0xe9, 0x01, 0x05, 0x80, 0x07, 0x03, 0xa0, 0x05, 0x00, 0x01, 0x00, 0x05, 0xe0, 0x01, 0x02, 0x81, 0x07, 0x41, 0xfc, 0xfc, 0xf1, 0xfe,
+  0x34, 0x09, 0x00, 0x04, 0x00, 0x01, 0x12, 0x07, 0x04, 0xf5, 0x07, 0x50, 0xec, 0xf1, 0xfc, 0xfc, 0xf0, 0x75, 0x01, 0x10, 0xed, 0x5e, 0x00, 0x03,
+  0x86, 0x02, 0x00, 0x20, 0x08, 0x10, 0xf8, 0x59, 0x02, 0x00, 0xd6, 0x0c, 0x00, 0x02, 0x02, 0x70, 0xf1, 0xf1, 0xf1, 0x49, 0xf0, 0xf1, 0xf0, 0x70,
+  0x01, 0x01, 0x24, 0x02, 0x02, 0x3b, 0x0b, 0x00, 0x64, 0x03, 0x00, 0x07, 0x02, 0x01, 0xd9, 0x05, 0x31, 0xfa, 0xff, 0xf7, 0xc4, 0x03, 0x04, 0x01,
+  0x00, 0x00, 0xe4, 0x01, 0x00, 0xe6, 0x01, 0x20, 0xf2, 0xee, 0xdf, 0x01, 0x00, 0x5a, 0x05, 0x03, 0xb5, 0x06, 0x22, 0xd7, 0xd5, 0x27, 0x01, 0x01,
+  0x01, 0x00, 0x10, 0xcc, 0x45, 0x07, 0x01, 0xd9, 0x01, 0x30, 0xc8, 0xc5, 0xc9, 0xca, 0x03, 0x41, 0xc8, 0xc8, 0xd2, 0xf0, 0x50, 0x00, 0x04, 0x01,
+  0x00, 0x10, 0xf1, 0x78, 0x0e, 0x00, 0xb7, 0x03, 0x00, 0x01, 0x00, 0x01, 0x06, 0x00, 0x00, 0xe5, 0x03, 0x10, 0xc8, 0x64, 0x07, 0x01, 0x01, 0x00,
+  0x00, 0x99, 0x05, 0x00, 0x1f, 0x02, 0x00, 0x43, 0x00, 0x10, 0xc6, 0x7b, 0x07, 0x91, 0xc5, 0xc6, 0xc9, 0xc9, 0xc5, 0xc4, 0xc4, 0xc4, 0xbe, 0x7b,
+  0x07, 0x10, 0xbe, 0xf3, 0x0e, 0x00, 0xb4, 0x03, 0x01, 0xd6, 0x01, 0x41, 0xae, 0xb7, 0xb8, 0xb9, 0x3c, 0x0b, 0xf0, 0x08, 0xb8, 0xb8, 0xba, 0xb9,
+  0xba, 0xb8, 0xb9, 0xb9, 0xb8, 0xb9, 0xb9, 0xbc, 0xbe, 0xb9, 0xba, 0xbe, 0xc1, 0xbc, 0xb9, 0xc1, 0xc1, 0xc4, 0xc4, 0xdf, 0x10, 0x40, 0xc5, 0xc9,
+  0xc5, 0xc9, 0x8b, 0x00, 0x00, 0x6d, 0x02, 0x00, 0xc1, 0x03, 0x40, 0xcd, 0xcc, 0xcf, 0xcf, 0xba, 0x01, 0x10, 0xd2, 0xac, 0x05, 0x01, 0x4d, 0x04,
+  0x20, 0xd2, 0xd6, 0xc1, 0x01, 0x50, 0xea, 0xdc, 0xea, 0xdc, 0xeb, 0x02, 0x00, 0x30, 0xea, 0xeb, 0xdc, 0xb4, 0x06, 0x00, 0xd5, 0x03, 0x00, 0xdb,
+  0x01, 0x01, 0xed, 0x01, 0x00, 0xe0, 0x01, 0x00, 0x01, 0x00, 0x42, 0xeb, 0xeb, 0xed, 0xec, 0x5a, 0x01, 0x01, 0xd0, 0x01, 0x00, 0xbc, 0x01, 0x00,
+  0x8e, 0x07, 0x03, 0xcd, 0x01, 0x00, 0xbd, 0x01, 0x00, 0x07, 0x00, 0x02, 0x09, 0x00, 0x11, 0xee, 0x33, 0x00, 0x01, 0x0a, 0x00, 0x04, 0x02, 0x00,
+  0x02, 0xca, 0x03, 0x01, 0xdd, 0x01, 0x08, 0xc0, 0x03, 0x07, 0xe0, 0x01, 0x01, 0xdf, 0x01, 0x00, 0x4b, 0x03, 0x00, 0xf0, 0x04, 0x01, 0x85, 0x05,
+  0x02, 0x1d, 0x0b, 0x00, 0x87, 0x00, 0x01, 0x01, 0x00, 0x20, 0xf8, 0xec, 0xe8, 0x0e, 0x00, 0xa9, 0x01, 0x00, 0xda, 0x03, 0x11, 0xf0, 0x4d, 0x0b,
+  0x00, 0x14, 0x0a, 0x03, 0xbf, 0x0b, 0x40, 0xee, 0xee, 0xf1, 0xfa, 0x02, 0x04, 0x10, 0xfa, 0x61, 0x00, 0x20, 0xfa, 0xf4, 0x02, 0x00, 0x20, 0xff,
+  0xfa, 0x58, 0x00, 0x31, 0xfa, 0xf1, 0xf0, 0x69, 0x0d, 0x01, 0xdf, 0x0e, 0x00, 0x0b, 0x0f, 0x02, 0xcb, 0x03, 0x01, 0x42, 0x0b, 0x01, 0x71, 0x00,
+  0x01, 0x31, 0x00, 0x00, 0x11, 0x02, 0x21, 0xea, 0xd6, 0x97, 0x01, 0x00, 0x80, 0x03, 0x01, 0x0d, 0x03, 0x00, 0xec, 0x01, 0x00, 0x78, 0x07, 0x00,
+  0x14, 0x00, 0x00, 0x8a, 0x03, 0x11, 0xc5, 0x48, 0x01, 0x00, 0x09, 0x00, 0x62, 0xc8, 0xc6, 0xc5, 0xc5, 0xc8, 0xdc, 0xb9, 0x03, 0x00, 0x10, 0x06,
+  0x01, 0xff, 0x03, 0x11, 0xd7, 0x38, 0x00, 0x01, 0x35, 0x00, 0x02, 0x02, 0x00, 0x00, 0x36, 0x00, 0x10, 0xc6, 0xcc, 0x01, 0x00, 0x87, 0x05, 0x11,
+  0xc4, 0x19, 0x02, 0x01, 0xf8, 0x0e, 0x10, 0xc9, 0x12, 0x0f, 0x50, 0xc4, 0xc5, 0xc6, 0xc8, 0xc9, 0xe1, 0x01, 0x80, 0xc1, 0xbe, 0xc0, 0xbe, 0xbc,
+  0xbe, 0xbc, 0xb9, 0x7b, 0x07, 0x00, 0xe1, 0x01, 0x60, 0xba, 0xb8, 0xb9, 0xb7, 0xb8, 0xb9, 0x86, 0x07, 0x01, 0xbe, 0x03, 0x01, 0x08, 0x00, 0x11,
+  0xbc, 0x3b, 0x0b, 0x90, 0xb9, 0xba, 0xbb, 0xc0, 0xbe, 0xc0, 0xbb, 0xbc, 0xbe, 0x0b, 0x13, 0x10, 0xc4, 0xc3, 0x03, 0x00, 0x42, 0x02, 0x00, 0x4a,
+  0x04, 0x00, 0xd9, 0x01, 0x10, 0xea, 0xef, 0x02, 0x70, 0xd7, 0xd7, 0xeb, 0xea, 0xd5, 0xd7, 0xea, 0x96, 0x02, 0x01, 0x15, 0x00, 0x52, 0xd7, 0xea,
+  0xda, 0xeb, 0xdc, 0x7a, 0x05, 0x00, 0x28, 0x03, 0x01, 0x3b, 0x0b, 0x01, 0xdd, 0x01, 0x10, 0xd7, 0x97, 0x05, 0x60, 0xdc, 0xeb, 0xea, 0xdc, 0xeb,
+  0xea, 0x42, 0x01, 0x10, 0xee, 0x84, 0x07, 0x00, 0x04, 0x00, 0x00, 0xb2, 0x04, 0x00, 0xcb, 0x01, 0x01, 0xec, 0x01, 0x30, 0xec, 0xec, 0xeb, 0x0c,
+  0x00, 0x00, 0xcc, 0x01, 0x02, 0x03, 0x00, 0x02, 0x02, 0x00, 0x02, 0x03, 0x00, 0x01, 0x1a, 0x00, 0x01, 0xbc, 0x03, 0x02, 0x06, 0x00, 0x00, 0x40,
+  0x0b, 0x00, 0x50, 0x01, 0x00, 0x4d, 0x09, 0x00, 0xda, 0x01, 0x02, 0x01, 0x00, 0x1b, 0xf7, 0xe1, 0x01, 0x00, 0x76, 0x01, 0x00, 0x34, 0x01, 0x00,
+  0x71, 0x01, 0x00, 0x76, 0x03, 0x00, 0xa7, 0x05, 0x02, 0x9b, 0x01, 0x00, 0xf1, 0x01, 0x01, 0x93, 0x0b, 0x50, 0xfe, 0xf9, 0xf9, 0xfe, 0xf2, 0xab,
+  0x03, 0x00, 0x18, 0x00, 0x01, 0x64, 0x00, 0x00, 0x76, 0x02, 0x00, 0x25, 0x0d, 0x04, 0x68, 0x07, 0x00, 0xc0, 0x01, 0x05, 0x01, 0x00, 0x00, 0x4f,
+  0x00, 0x50, 0xfa, 0xfc, 0xfa, 0xf1, 0xf9, 0xb3, 0x05, 0x32, 0xec, 0xf8, 0xee, 0x96, 0x01, 0x01, 0x27, 0x02, 0x00, 0x5d, 0x00, 0x00, 0x08, 0x00,
+  0x01, 0x05, 0x00, 0x21, 0xee, 0xeb, 0x87, 0x05, 0x02, 0xad, 0x03, 0x00, 0x06, 0x00, 0x00, 0xa1, 0x01, 0x00, 0x01, 0x00, 0x00, 0x41, 0x01, 0x00,
+  0x48, 0x01, 0x01, 0x51, 0x01, 0x00, 0xa0, 0x05, 0x00, 0xdd, 0x01, 0x50, 0xc5, 0xc5, 0xcf, 0xf1, 0xf2, 0xd9, 0x01, 0x00, 0xb0, 0x00, 0x01, 0x0a,
+  0x0a, 0x21, 0xf1, 0xd6, 0xfa, 0x0e, 0x01, 0x59, 0x01, 0x00, 0x09, 0x00, 0x40, 0xcc, 0xd0, 0xcc, 0xcc, 0xbf, 0x01, 0x21, 0xc4, 0xc4, 0x04, 0x00,
+  0x31, 0xc5, 0xc6, 0xc8, 0xd1, 0x01, 0x40, 0xc9, 0xc8, 0xc1, 0xc9, 0x10, 0x00, 0x00, 0x12, 0x00, 0x60, 0xc5, 0xc4, 0xc8, 0xc4, 0xbc, 0xbe, 0x71,
+  0x14, 0x32, 0xc1, 0xbc, 0xb9, 0x96, 0x05, 0x00, 0xb2, 0x03, 0x00, 0x9c, 0x14, 0x00, 0x01, 0x00, 0x01, 0xcd, 0x03, 0x50, 0xb7, 0xba, 0xb8, 0xb7,
+  0xb9, 0xbf, 0x05, 0x12, 0xbe, 0x06, 0x11, 0x00, 0x49, 0x0d, 0x20, 0xc1, 0xc4, 0xb7, 0x03, 0x10, 0xcc, 0x02, 0x00, 0x00, 0x2b, 0x04, 0x50, 0xcf,
+  0xcf, 0xd6, 0xd7, 0xe1, 0xf4, 0x02, 0x01, 0x02, 0x00, 0x00, 0x01, 0x00, 0x11, 0xdc, 0xe0, 0x01, 0x01, 0x01, 0x0f, 0x01, 0x61, 0x07, 0x21, 0xeb,
+  0xed, 0xc1, 0x03, 0x30, 0xdc, 0xeb, 0xdc, 0xb4, 0x03, 0x00, 0x15, 0x00, 0x10, 0xea, 0x33, 0x01, 0x00, 0xd3, 0x01, 0x01, 0xd4, 0x01, 0x07, 0x01,
+  0x00, 0x01, 0xae, 0x01, 0x01, 0x02, 0x00, 0x00, 0xd1, 0x03, 0x00, 0xe7, 0x01, 0x00, 0x0c, 0x00, 0x00, 0x02, 0x00, 0x01, 0x0a, 0x00, 0x00, 0xcf,
+  0x01, 0x01, 0x01, 0x00, 0x01, 0x12, 0x00, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x01, 0x81, 0x07, 0x10, 0xee, 0x7c, 0x01, 0x46, 0xfb, 0xfb, 0xf7,
+  0xfb, 0xbf, 0x03, 0x00, 0xe0, 0x01, 0x01, 0x8f, 0x01, 0x05, 0x92, 0x01, 0x00, 0xe6, 0x01, 0x00, 0x05, 0x00, 0x00, 0xdd, 0x0a, 0x00, 0x56, 0x09,
+  0x00, 0x2f, 0x0b, 0x00, 0xf1, 0x0c, 0x08, 0x01, 0x00, 0x00, 0xb6, 0x0c, 0x21, 0xf2, 0xfa, 0x14, 0x00, 0x00, 0xce, 0x00, 0x20, 0xf0, 0xf0, 0x99,
+  0x0d, 0x30, 0xf9, 0xee, 0xfc, 0x6b, 0x05, 0x00, 0x4e, 0x00, 0x00, 0x4d, 0x00, 0x11, 0xfb, 0x05, 0x0d, 0x02, 0x01, 0x00, 0x00, 0x4d, 0x00, 0x00,
+  0x2a, 0x00, 0x20, 0xf0, 0xf1, 0x86, 0x00, 0x12, 0xee, 0x2f, 0x02, 0x02, 0xd2, 0x02, 0x00, 0xaa, 0x14, 0x11, 0xec, 0x04, 0x01, 0x10, 0xd7, 0x6a,
+  0x0c, 0x02, 0xd5, 0x01, 0x01, 0x05, 0x00, 0x04, 0x01, 0x00, 0x20, 0xc9, 0xcc, 0x4b, 0x01, 0x00, 0x77, 0x03, 0x00, 0x51, 0x01, 0x00, 0x09, 0x00,
+  0x82, 0xc8, 0xc5, 0xc8, 0xc4, 0xc5, 0xc8, 0xd6, 0xf2, 0x4f, 0x02, 0x20, 0xf4, 0xfb, 0x46, 0x17, 0x00, 0xb5, 0x16, 0x00, 0x14, 0x02, 0x00, 0x58,
+  0x01, 0x20, 0xcf, 0xd3, 0x07, 0x00, 0x00, 0x14, 0x02, 0x10, 0xc4, 0x79, 0x07, 0x10, 0xc1, 0xb0, 0x0e, 0x30, 0xc1, 0xc4, 0xc5, 0xf9, 0x03, 0x40,
+  0xc9, 0xc9, 0xc8, 0xc4, 0xca, 0x12, 0x00, 0x17, 0x00, 0x00, 0xe9, 0x0c, 0x00, 0x9a, 0x07, 0x10, 0xc6, 0x56, 0x07, 0x31, 0xb9, 0xba, 0xbb, 0xde,
+  0x01, 0x00, 0x98, 0x14, 0x11, 0xb9, 0xa1, 0x05, 0x90, 0xb7, 0xb7, 0xb8, 0xb9, 0xae, 0xb8, 0xad, 0xad, 0xae, 0xeb, 0x01, 0x10, 0xb9, 0x7f, 0x07,
+  0x50, 0xbe, 0xc1, 0xbc, 0xbc, 0xb9, 0x32, 0x00, 0x00, 0xc7, 0x07, 0x00, 0xff, 0x05, 0x00, 0x01, 0x00, 0x20, 0xcf, 0xd0, 0x32, 0x08, 0x20, 0xea,
+  0xf0, 0x28, 0x01, 0x02, 0xbb, 0x02, 0x40, 0xfc, 0xf2, 0xf1, 0xee, 0xca, 0x00, 0x21, 0xd6, 0xcf, 0x53, 0x0b, 0x10, 0xda, 0xa2, 0x05, 0x00, 0xbb,
+  0x03, 0x12, 0xed, 0x0d, 0x05, 0x00, 0xbf, 0x03, 0x11, 0xda, 0xb2, 0x05, 0x10, 0xec, 0x17, 0x0d, 0x03, 0x1b, 0x00, 0x00, 0xef, 0x01, 0x03, 0xeb,
+  0x01, 0x01, 0xb3, 0x01, 0x00, 0xb5, 0x01, 0x30, 0xec, 0xed, 0xee, 0xc9, 0x03, 0x04, 0x0e, 0x00, 0x00, 0x18, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0c,
+  0x00, 0x01, 0x0f, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x08, 0x00, 0x01, 0x33, 0x07, 0x00, 0x19, 0x00, 0x00, 0x0f, 0x01, 0x35, 0xf7, 0xe9, 0xfb, 0x3e,
+  0x0b, 0x02, 0xe0, 0x01, 0x01, 0x27, 0x01, 0x00, 0xbd, 0x0c, 0x01, 0x02, 0x00, 0x00, 0x9c, 0x01, 0x00, 0x08, 0x00, 0x00, 0x07, 0x00, 0x01, 0x65,
+  0x05, 0x30, 0xf4, 0xff, 0xf3, 0x75, 0x05, 0x01, 0xc9, 0x0c, 0x02, 0x4c, 0x05, 0x00, 0xfa, 0x01, 0x02, 0x05, 0x00, 0x01, 0x59, 0x0b, 0x00, 0xec,
+  0x03, 0x00, 0xde, 0x00, 0x25, 0xf2, 0xfc, 0x10, 0x0b, 0x02, 0x07, 0x04, 0x05, 0x20, 0x0b, 0x03, 0x34, 0x00, 0x30, 0xff, 0xfa, 0xfc, 0x70, 0x11,
+  0x00, 0x01, 0x0a, 0x00, 0xf3, 0x03, 0x00, 0xca, 0x02, 0x00, 0x4f, 0x0a, 0x01, 0x4b, 0x0a, 0x20, 0xd5, 0xd7, 0xb1, 0x06, 0x01, 0x9e, 0x01, 0x00,
+  0x36, 0x01, 0x07, 0xe3, 0x01, 0x01, 0xda, 0x10, 0x01, 0x30, 0x03, 0x01, 0x53, 0x01, 0x21, 0xc9, 0xcc, 0xc8, 0x03, 0x40, 0xc8, 0xc8, 0xdc, 0xf3,
+  0xce, 0x00, 0x00, 0xbc, 0x00, 0x21, 0xfb, 0xfb, 0xe0, 0x01, 0x00, 0x41, 0x00, 0x31, 0xd6, 0xcf, 0xd3, 0x51, 0x03, 0x31, 0xcf, 0xd0, 0xcf, 0xde,
+  0x01, 0x30, 0xc4, 0xc1, 0xbe, 0xde, 0x01, 0x00, 0x89, 0x05, 0x10, 0xc6, 0x11, 0x0d, 0x10, 0xc8, 0xb5, 0x03, 0x10, 0xc9, 0xd1, 0x03, 0x40, 0xc6,
+  0xc1, 0xc1, 0xc6, 0xc6, 0x03, 0x00, 0xb5, 0x01, 0x00, 0x7d, 0x07, 0x10, 0xb9, 0xbf, 0x10, 0x00, 0xe5, 0x0e, 0x11, 0xb9, 0xca, 0x03, 0x00, 0x67,
+  0x09, 0x20, 0xb9, 0xba, 0x22, 0x0d, 0x20, 0xb7, 0xb8, 0x5d, 0x0b, 0x00, 0x3e, 0x0d, 0x90, 0xbc, 0xbe, 0xb9, 0xbc, 0xba, 0xbe, 0xc4, 0xc1, 0xc6,
+  0x96, 0x00, 0x01, 0xab, 0x00, 0x02, 0x06, 0x00, 0x31, 0xd6, 0xd6, 0xcf, 0xf2, 0x0b, 0x06, 0x01, 0x00, 0x21, 0xee, 0xd2, 0x14, 0x0f, 0x00, 0x01,
+  0x00, 0x00, 0x7f, 0x07, 0x02, 0xc0, 0x03, 0x00, 0x88, 0x07, 0x20, 0xec, 0xda, 0x14, 0x00, 0x00, 0xaf, 0x12, 0x10, 0xed, 0x34, 0x0b, 0x00, 0x23,
+  0x10, 0x21, 0xeb, 0xea, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x09, 0x00, 0x00, 0xab, 0x01, 0x01, 0xad, 0x01, 0x00, 0x0b, 0x03, 0x00, 0x57, 0x0b,
+  0x10, 0xed, 0xe7, 0x01, 0x40, 0xee, 0xec, 0xed, 0xee, 0x07, 0x00, 0x00, 0x01, 0x00, 0x03, 0xd8, 0x01, 0x04, 0xde, 0x03, 0x01, 0x18, 0x00, 0x00,
+  0x04, 0x00, 0x21, 0xec, 0xee, 0xdb, 0x01, 0x00, 0x02, 0x00, 0x07, 0x01, 0x00, 0x04, 0x23, 0x01, 0x0f, 0x01, 0x00, 0x00, 0x04, 0xe7, 0x01, 0x04,
+  0x01, 0x00, 0x05, 0x8f, 0x03, 0x02, 0x02, 0x00, 0x04, 0x3f, 0x07, 0x00, 0x87, 0x1a, 0x01, 0xfe, 0x01, 0x02, 0xc6, 0x01, 0x03, 0x01, 0x00, 0x01,
+  0xf8, 0x01, 0x03, 0x13, 0x00, 0x03, 0x53, 0x0f, 0x20, 0xfa, 0xff, 0xe3, 0x02, 0x00, 0x69, 0x09, 0x00, 0x01, 0x00, 0x00, 0x80, 0x09, 0x20, 0xf0,
+  0xf1, 0xcd, 0x03, 0x00, 0xc6, 0x0f, 0x00, 0xdd, 0x02, 0x00, 0x5b, 0x0c, 0x02, 0xcf, 0x15, 0x00, 0x02, 0x12, 0x23, 0xcf, 0xcd, 0x02, 0x00, 0x00,
+  0x6c, 0x18, 0x11, 0xcd, 0x3b, 0x1a, 0x03, 0x01, 0x00, 0x10, 0xc9, 0x9b, 0x03, 0x42, 0xc8, 0xed, 0xfa, 0xf7, 0xbc, 0x00, 0x10, 0xe9, 0xc1, 0x03,
+  0x40, 0xfc, 0xfc, 0xf0, 0xd6, 0xdf, 0x01, 0x01, 0xc3, 0x07, 0x00, 0xc1, 0x03, 0x00, 0x65, 0x07, 0x00, 0xbf, 0x03, 0x00, 0xd8, 0x01, 0x30, 0xd0,
+  0xcf, 0xcc, 0x9a, 0x05, 0x00, 0xfd, 0x03, 0x00, 0xc4, 0x03, 0x21, 0xc5, 0xc9, 0xc3, 0x03, 0x02, 0x02, 0x00, 0x10, 0xbc, 0x39, 0x09, 0x30, 0xc0,
+  0xbb, 0xb7, 0x72, 0x07, 0x00, 0xdf, 0x01, 0x00, 0xad, 0x03, 0x00, 0x3e, 0x0b, 0x60, 0xb7, 0xb9, 0xb7, 0xba, 0xb9, 0xb9, 0x08, 0x0f, 0xd0, 0xb8,
+  0xb9, 0xb9, 0xb9, 0xbc, 0xbb, 0xbc, 0xbb, 0xba, 0xbe, 0xbe, 0xbc, 0xbe, 0x55, 0x00, 0x61, 0xc5, 0xc9, 0xcc, 0xd0, 0xcf, 0xd3, 0x02, 0x00, 0x00,
+  0x74, 0x04, 0x00, 0xac, 0x03, 0x11, 0xea, 0xcd, 0x04, 0x05, 0xc1, 0x03, 0x10, 0xee, 0x5f, 0x09, 0x00, 0xe1, 0x01, 0x30, 0xea, 0xdc, 0xeb, 0x81,
+  0x07, 0x00, 0x02, 0x00, 0x00, 0x08, 0x0c, 0x00, 0xe3, 0x00, 0x00, 0xdf, 0x01, 0x02, 0x14, 0x00, 0x10, 0xec, 0xf6, 0x01, 0x00, 0xc4, 0x03, 0x00,
+  0xae, 0x01, 0x01, 0xaf, 0x01, 0x01, 0xc8, 0x03, 0x00, 0x0c, 0x00, 0x00, 0xaf, 0x01, 0x00, 0x07, 0x00, 0x00, 0x1c, 0x00, 0x00, 0xc7, 0x05, 0x01,
+  0xe5, 0x01, 0x00, 0xc7, 0x01, 0x11, 0xee, 0x27, 0x00, 0x40, 0xec, 0xed, 0xec, 0xdc, 0x17, 0x00, 0x00, 0x2c, 0x00, 0x01, 0x0b, 0x02, 0x01, 0xfb,
+  0x01, 0x10, 0xec, 0xd9, 0x01, 0x11, 0xf7, 0x03, 0x00, 0x06, 0x01, 0x00, 0x00, 0xe5, 0x10, 0x03, 0xe6, 0x01, 0x03, 0x30, 0x01, 0x0f, 0x01, 0x00,
+  0x01, 0x01, 0xe9, 0x01, 0x02, 0x06, 0x00, 0x00, 0x08, 0x00, 0x00, 0xe7, 0x03, 0x05, 0x0c, 0x00, 0x00, 0x0e, 0x13, 0x01, 0xf6, 0x01, 0x01, 0x05,
+  0x00, 0x01, 0xc4, 0x07, 0x01, 0x9c, 0x05, 0x02, 0x05, 0x00, 0x00, 0x0f, 0x00, 0x01, 0xde, 0x01, 0x02, 0x02, 0x00, 0x00, 0xf5, 0x01, 0x00, 0x56,
+  0x0f, 0x00, 0x02, 0x00, 0x02, 0x01, 0x00, 0x00, 0x93, 0x16, 0x01, 0xf2, 0x01, 0x10, 0xf2, 0x05, 0x00, 0x40, 0xe4, 0xf1, 0xf0, 0xe5, 0xf9, 0x01,
+  0x40, 0xef, 0xef, 0xf0, 0xef, 0x01, 0x00, 0xf1, 0x02, 0xed, 0xed, 0xe1, 0xed, 0xed, 0xdc, 0xdc, 0xdc, 0xea, 0xda, 0xd7, 0xdc, 0xd7, 0xd7, 0xd9,
+  0xd7, 0xd6, 0x5e, 0x0e, 0x00, 0x9c, 0x0a, 0x20, 0xf0, 0xf5, 0xbb, 0x00, 0x00, 0x8b, 0x00, 0x02, 0xc0, 0x03, 0x10, 0xf1, 0x17, 0x02, 0x11, 0xd6,
+  0x51, 0x03, 0x30, 0xcf, 0xcc, 0xcf, 0xff, 0x0c, 0x00, 0x4b, 0x05, 0x10, 0xc1, 0xc0, 0x12, 0x00, 0x0e, 0x07, 0x00, 0xa9, 0x09, 0x00, 0xe1, 0x01,
+  0x30, 0xc8, 0xc6, 0xcc, 0x8a, 0x07, 0x70, 0xc6, 0xc5, 0xbe, 0xc1, 0xc6, 0xc1, 0xc4, 0x52, 0x07, 0x10, 0xbb, 0x5e, 0x09, 0x30, 0xb8, 0xb8, 0xae,
+  0xc3, 0x03, 0x00, 0x76, 0x07, 0x01, 0x08, 0x00, 0x41, 0xb7, 0xb7, 0xb9, 0xb9, 0x09, 0x00, 0x41, 0xb9, 0xb9, 0xb8, 0xba, 0x3b, 0x0b, 0x50, 0xbb,
+  0xb9, 0xba, 0xc4, 0xbe, 0x53, 0x00, 0x10, 0xc4, 0x4b, 0x04, 0x00, 0x51, 0x00, 0x00, 0xbf, 0x03, 0x01, 0xdf, 0x01, 0x31, 0xd6, 0xcf, 0xee, 0x40,
+  0x0e, 0x02, 0x01, 0x00, 0x40, 0xff, 0xfc, 0xfc, 0xee, 0xac, 0x0d, 0x21, 0xd6, 0xd7, 0x9c, 0x05, 0x00, 0xc1, 0x03, 0x00, 0x79, 0x07, 0x10, 0xda,
+  0xdc, 0x01, 0x20, 0xd6, 0xd7, 0xf6, 0x01, 0x40, 0xd7, 0xd7, 0xeb, 0xdc, 0x99, 0x03, 0x00, 0xbc, 0x01, 0x30, 0xed, 0xec, 0xdc, 0xb0, 0x01, 0x20,
+  0xeb, 0xe1, 0x06, 0x00, 0x00, 0xd4, 0x01, 0x05, 0x02, 0x00, 0x00, 0xbe, 0x03, 0x00, 0xc3, 0x05, 0x22, 0xec, 0xed, 0xdc, 0x01, 0x00, 0x0e, 0x00,
+  0x00, 0x04, 0x00, 0x01, 0xed, 0x01, 0x10, 0xee, 0x40, 0x00, 0x20, 0xed, 0xec, 0x96, 0x14, 0xa0, 0xec, 0xee, 0xec, 0xee, 0xee, 0xee, 0xec, 0xee,
+  0xec, 0xee, 0x3c, 0xe9, 0xf7, 0xe9, 0x01, 0x00, 0x11, 0xfb, 0x14, 0x00, 0x10, 0xf7, 0x08, 0x00, 0x24, 0xfb, 0xfb, 0x06, 0x00, 0x32, 0xf7, 0xfb,
+  0xf7, 0x03, 0x00, 0x41, 0xfb, 0xf7, 0xfb, 0xfb, 0x04, 0x00, 0x0f, 0x01, 0x00, 0x05, 0x60, 0xf4, 0xfb, 0xf4, 0xf4, 0xfb, 0xf4, 0x09, 0x00, 0x00,
+  0x0a, 0x00, 0x01, 0x04, 0x00, 0x00, 0x10, 0x00, 0x03, 0x09, 0x00, 0x30, 0xff, 0xfb, 0xff, 0x08, 0x00, 0x02, 0x01, 0x00, 0xa1, 0xff, 0xf4, 0xff,
+  0xf4, 0xfa, 0xfa, 0xfa, 0xfa, 0xf4, 0xfa, 0x07, 0x00, 0x40, 0xfa, 0xfa, 0xfa, 0xfc, 0x05, 0x00, 0x00, 0x07, 0x00, 0xf0, 0x01, 0xfc, 0xfa, 0xfc,
+  0xff, 0xf2, 0xfa, 0xfc, 0xfa, 0xf2, 0xf2, 0xf2, 0xfc, 0xf2, 0xfc, 0xfc, 0xfc, 0x06, 0x00, 0x01, 0x02, 0x00, 0x10, 0xf1, 0x03, 0x00, 0x10, 0xf1,
+  0x04, 0x00, 0x07, 0x01, 0x00, 0x10, 0xf0, 0x01, 0x00, 0xf0, 0x27, 0xef, 0xf1, 0xfa, 0xfb, 0xfb, 0xf7, 0xe9, 0xfb, 0xfb, 0xfb, 0xe9, 0xe9, 0xfb,
+  0xf4, 0xff, 0xfa, 0xfc, 0xfa, 0xf1, 0xf0, 0xee, 0xed, 0xed, 0xeb, 0xd7, 0xd7, 0xd7, 0xea, 0xd7, 0xd7, 0xd2, 0xcf, 0xc8, 0xc8, 0xcc, 0xc0, 0xc2,
+  0xc5, 0xc8, 0xc8, 0xc5, 0xc8, 0xc8, 0xc8, 0xcf, 0xcf, 0xd7, 0xd6, 0xd2, 0xcf, 0xcc, 0xc8, 0xcc, 0xcc, 0x04, 0x00, 0x10, 0xc8, 0x04, 0x00, 0xf0,
+  0x15, 0xc9, 0xc5, 0xc5, 0xc8, 0xc4, 0xc1, 0xbc, 0xc1, 0xc1, 0xbc, 0xbe, 0xbc, 0xbc, 0xbb, 0xbc, 0xb8, 0xb9, 0xb8, 0xb8, 0xb7, 0xba, 0xb9, 0xb9,
+  0xb8, 0xb9, 0xb7, 0xb7, 0xb8, 0xba, 0xb9, 0xb8, 0xb7, 0xb9, 0xb8, 0xb8, 0xb9, 0x10, 0x00, 0xf0, 0x0c, 0xb8, 0xb8, 0xba, 0xb9, 0xb9, 0xbe, 0xba,
+  0xbe, 0xc0, 0xbb, 0xbc, 0xb9, 0xba, 0xb9, 0xc1, 0xbe, 0xc4, 0xbe, 0xc1, 0xc6, 0xc5, 0xc9, 0xc8, 0xc9, 0xcc, 0xcc, 0xd0, 0x03, 0x00, 0x20, 0xd0,
+  0xcf, 0x01, 0x00, 0x70, 0xd6, 0xcf, 0xd6, 0xee, 0xf2, 0xfc, 0xfa, 0xdf, 0x00, 0xd0, 0xff, 0xf4, 0xfa, 0xff, 0xfc, 0xfa, 0xf2, 0xee, 0xd7, 0xd6,
+  0xd7, 0xd6, 0xd6, 0x8c, 0x00, 0x11, 0xda, 0x02, 0x00, 0x11, 0xd7, 0x05, 0x00, 0x70, 0xd7, 0xd7, 0xd7, 0xd6, 0xd7, 0xd7, 0xda, 0x0d, 0x00, 0x47,
+  0xeb, 0xdc, 0xec, 0xdc, 0x04, 0x00, 0x91, 0xed, 0xeb, 0xed, 0xec, 0xec, 0xec, 0xed, 0xec, 0xed, 0x05, 0x00, 0x50, 0xed, 0xec, 0xee, 0xee, 0xee,
+  0x09, 0x00, 0x00, 0x16, 0x00, 0x00, 0x05, 0x00, 0x09, 0x02, 0x00, 0x00, 0x01, 0x00, 0x30, 0xec, 0xed, 0xed, 0x36, 0x00, 0x00, 0x02, 0x00, 0x10,
+  0xee, 0x01, 0x00, 0x00, 0x31, 0x00, 0x71, 0xee, 0xee, 0xee, 0xfb, 0xf7, 0xf7, 0xf7, 0xd0, 0x01, 0x07, 0x01, 0x00, 0x04, 0x0f, 0x00, 0x01, 0xe9,
+  0x01, 0x00, 0xe8, 0x01, 0x02, 0x02, 0x00, 0x00, 0xde, 0x01, 0x02, 0x01, 0x00, 0x03, 0xe6, 0x01, 0x03, 0x01, 0x00, 0x02, 0x0d, 0x00, 0x00, 0x04,
+  0x00, 0x0c, 0x01, 0x00, 0x01, 0xd6, 0x01, 0x01, 0x02, 0x00, 0x01, 0xed, 0x01, 0x08, 0x02, 0x00, 0x02, 0x10, 0x00, 0x00, 0x03, 0x00, 0x40, 0xf4,
+  0xf4, 0xf4, 0xfa, 0x05, 0x00, 0x01, 0x08, 0x00, 0x31, 0xfa, 0xfa, 0xf4, 0x13, 0x01, 0x00, 0x02, 0x00, 0x00, 0xf9, 0x01, 0x54, 0xff, 0xf4, 0xff,
+  0xff, 0xfa, 0x02, 0x00, 0x00, 0x01, 0x00, 0x30, 0xfc, 0xfa, 0xfa, 0xba, 0x01, 0x00, 0x04, 0x00, 0x11, 0xfc, 0x06, 0x02, 0x00, 0xf4, 0x01, 0x00,
+  0x07, 0x00, 0x00, 0x01, 0x00, 0x10, 0xf4, 0x8a, 0x02, 0x60, 0xfb, 0xfb, 0xf7, 0xf7, 0xe9, 0xfb, 0x46, 0x00, 0x23, 0xfc, 0xfc, 0x05, 0x02, 0x01,
+  0xfe, 0x01, 0xf0, 0x27, 0xef, 0xef, 0xe1, 0xdf, 0xdc, 0xdf, 0xdf, 0xe1, 0xe1, 0xe1, 0xdf, 0xe1, 0xed, 0xe1, 0xee, 0xef, 0xee, 0xef, 0xe1, 0xd7,
+  0xd7, 0xda, 0xda, 0xd6, 0xd6, 0xda, 0xda, 0xcf, 0xcc, 0xd6, 0xd9, 0xcf, 0xc8, 0xcc, 0xcf, 0xd0, 0xcc, 0xc8, 0xc5, 0xc9, 0xc5, 0xc5, 0xc1, 0xba,
+  0xbc, 0xbc, 0xbc, 0xb9, 0xb7, 0xb8, 0xb7, 0xb8, 0xb8, 0xb9, 0xd4, 0x01, 0x00, 0xdb, 0x01, 0x41, 0xb8, 0xb9, 0xb9, 0xb9, 0xdf, 0x01, 0x00, 0x02,
+  0x00, 0x70, 0xb8, 0xbc, 0xba, 0xbe, 0xb9, 0xb9, 0xbc, 0xe1, 0x01, 0x80, 0xbe, 0xc1, 0xc4, 0xbc, 0xbc, 0xc4, 0xc9, 0xcc, 0x02, 0x00, 0x10, 0xcf,
+  0xdc, 0x01, 0x00, 0x06, 0x00, 0x71, 0xd0, 0xcf, 0xcf, 0xd6, 0xd7, 0xf0, 0xfa, 0x02, 0x01, 0x00, 0x01, 0x00, 0x51, 0xf4, 0xfa, 0xfa, 0xfc, 0xee,
+  0xde, 0x01, 0x00, 0xd3, 0x01, 0x61, 0xea, 0xdc, 0xeb, 0xda, 0xea, 0xd9, 0xda, 0x01, 0x30, 0xd6, 0xd6, 0xd6, 0xe0, 0x01, 0x11, 0xd6, 0x15, 0x00,
+  0x00, 0x02, 0x00, 0xa0, 0xed, 0xeb, 0xed, 0xeb, 0xeb, 0xed, 0xeb, 0xdc, 0xea, 0xea, 0x0c, 0x00, 0x01, 0xb0, 0x01, 0x00, 0x14, 0x00, 0x00, 0x08,
+  0x00, 0x21, 0xee, 0xee, 0x07, 0x00, 0x31, 0xec, 0xed, 0xed, 0x09, 0x00, 0x30, 0xec, 0xec, 0xeb, 0x0d, 0x00, 0x01, 0xf0, 0x01, 0x00, 0x07, 0x00,
+  0x23, 0xed, 0xec, 0x29, 0x00, 0x02, 0xdb, 0x01, 0x00, 0x04, 0x00, 0x42, 0xf0, 0xee, 0xf0, 0xee, 0x5c, 0x01, 0x00, 0xf8, 0x02, 0x05, 0x01, 0x00,
+  0x03, 0xf0, 0x01, 0x00, 0xd3, 0x01, 0x01, 0x02, 0x00, 0x00, 0xc0, 0x01, 0x01, 0xdb, 0x01, 0x00, 0x04, 0x00, 0x01, 0x01, 0x00, 0x08, 0x09, 0x00,
+  0x10, 0xe9, 0x54, 0x01, 0x00, 0x21, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x5e, 0x01, 0x0f, 0x01, 0x00, 0x09, 0x00, 0x05, 0x02, 0x00, 0xd9, 0x01, 0x01,
+  0x01, 0x00, 0x00, 0x07, 0x00, 0x01, 0x7d, 0x00, 0x01, 0x03, 0x00, 0x01, 0x04, 0x00, 0x01, 0x01, 0x00, 0x05, 0x09, 0x00, 0x04, 0x01, 0x00, 0x00,
+  0x02, 0x03, 0x02, 0xf4, 0x01, 0x04, 0x06, 0x00, 0x07, 0x02, 0x00, 0x00, 0x06, 0x02, 0x00, 0x05, 0x00, 0x00, 0x0d, 0x00, 0x01, 0xc8, 0x00, 0x00,
+  0xe0, 0x01, 0x50, 0xf7, 0xf7, 0xf4, 0xf4, 0xff, 0x0d, 0x02, 0x00, 0xfd, 0x01, 0x40, 0xf1, 0xf2, 0xfc, 0xf1, 0x02, 0x00, 0x70, 0xf2, 0xf1, 0xf2,
+  0xf1, 0xe5, 0xf1, 0xe5, 0xf1, 0x01, 0x27, 0xf1, 0xf1, 0x00, 0x04, 0x00, 0xfe, 0x01, 0x02, 0x01, 0x02, 0x30, 0xf0, 0xef, 0xe1, 0xff, 0x01, 0x40,
+  0xd9, 0xcc, 0xbc, 0xbc, 0xae, 0x03, 0x01, 0xd6, 0x01, 0x60, 0xbc, 0xbc, 0xbc, 0xbc, 0xba, 0xbe, 0x06, 0x00, 0x00, 0xf5, 0x01, 0xf0, 0x0d, 0xba,
+  0xb9, 0xb9, 0xba, 0xbc, 0xb8, 0xb7, 0xb9, 0xbb, 0xb8, 0xb9, 0xb9, 0xbe, 0xbc, 0xbc, 0xba, 0xbc, 0xc1, 0xc1, 0xc4, 0xc4, 0xc4, 0xc5, 0xc9, 0xc9,
+  0xc9, 0xcc, 0xcc, 0xbb, 0x03, 0x20, 0xd0, 0xcc, 0xbe, 0x03, 0x61, 0xcf, 0xcf, 0xd6, 0xd6, 0xd6, 0xf0, 0x16, 0x01, 0x00, 0x4b, 0x01, 0x30, 0xf7,
+  0xf4, 0xfa, 0xc0, 0x03, 0x00, 0x01, 0x00, 0x00, 0xb5, 0x03, 0x40, 0xda, 0xeb, 0xdc, 0xea, 0xb4, 0x03, 0x00, 0xdb, 0x01, 0x00, 0xe3, 0x01, 0x60,
+  0xd7, 0xd6, 0xd7, 0xda, 0xea, 0xdc, 0xc8, 0x01, 0x00, 0xe2, 0x01, 0x02, 0x02, 0x00, 0x82, 0xda, 0xea, 0xea, 0xeb, 0xdc, 0xed, 0xeb, 0xec, 0x03,
+  0x00, 0x00, 0xec, 0x01, 0x00, 0xc4, 0x03, 0x01, 0xbc, 0x01, 0x11, 0xec, 0xdf, 0x01, 0x00, 0x2f, 0x00, 0x00, 0xec, 0x01, 0x00, 0x1c, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0xf4, 0x03, 0x10, 0xea, 0x11, 0x00, 0x10, 0xee, 0xfb, 0x01, 0x00, 0x28, 0x00, 0x20, 0xee, 0xf0, 0xc0, 0x03, 0x00, 0x1a, 0x01,
+  0x00, 0x23, 0x01, 0x10, 0xfb, 0xd3, 0x01, 0x03, 0x01, 0x00, 0x00, 0x94, 0x00, 0x00, 0xae, 0x03, 0x02, 0x69, 0x01, 0x00, 0x91, 0x01, 0x05, 0x01,
+  0x00, 0x01, 0x95, 0x01, 0x01, 0xa9, 0x01, 0x03, 0x02, 0x00, 0x00, 0xe4, 0x01, 0x01, 0xb8, 0x05, 0x03, 0x08, 0x00, 0x01, 0xe8, 0x03, 0x02, 0x16,
+  0x00, 0x00, 0x0f, 0x00, 0x00, 0x06, 0x00, 0x20, 0xfb, 0xf6, 0x05, 0x00, 0x00, 0x04, 0x00, 0x02, 0x02, 0x00, 0x00, 0x03, 0x00, 0x0b, 0x01, 0x00,
+  0x00, 0xe1, 0x03, 0x01, 0x02, 0x00, 0x01, 0x05, 0x00, 0x00, 0x69, 0x00, 0x05, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0xd3, 0x05, 0x01, 0xd8, 0x01,
+  0x00, 0x0a, 0x00, 0x00, 0x05, 0x00, 0x01, 0x0d, 0x00, 0x01, 0x02, 0x00, 0x00, 0x01, 0x00, 0x22, 0xf4, 0xfa, 0x0f, 0x00, 0x20, 0xf4, 0xf4, 0x7d,
+  0x00, 0x02, 0x77, 0x00, 0x04, 0x32, 0x00, 0x00, 0xe5, 0x01, 0x04, 0xdf, 0x03, 0x00, 0x01, 0x00, 0x07, 0x0b, 0x00, 0x00, 0xf7, 0x05, 0x00, 0xf8,
+  0x01, 0x02, 0xfa, 0x01, 0x06, 0x01, 0x00, 0x40, 0xf0, 0xef, 0xe1, 0xd3, 0xe1, 0x01, 0x01, 0xb2, 0x03, 0x10, 0xbc, 0xc2, 0x01, 0xd0, 0xc1, 0xc5,
+  0xc1, 0xc5, 0xc9, 0xc5, 0xc1, 0xc1, 0xc1, 0xc0, 0xbc, 0xbd, 0xb8, 0x04, 0x00, 0x91, 0xbc, 0xbd, 0xba, 0xba, 0xc0, 0xc1, 0xc1, 0xb9, 0xb8, 0xd6,
+  0x05, 0x10, 0xd0, 0xfb, 0x05, 0x22, 0xcf, 0xcc, 0xdb, 0x01, 0x50, 0xd6, 0xd6, 0xcf, 0xd6, 0xd2, 0x04, 0x00, 0x20, 0xf0, 0xf4, 0x4a, 0x01, 0x00,
+  0x02, 0x00, 0x01, 0xc1, 0x03, 0x11, 0xee, 0x8d, 0x05, 0x00, 0x9e, 0x05, 0x20, 0xea, 0xdc, 0x33, 0x06, 0x00, 0xc0, 0x03, 0x01, 0xdc, 0x01, 0x02,
+  0xb4, 0x05, 0x50, 0xec, 0xed, 0xdc, 0xec, 0xdc, 0xb0, 0x01, 0x00, 0xb6, 0x01, 0x00, 0xeb, 0x01, 0x13, 0xea, 0x10, 0x00, 0x00, 0xb4, 0x01, 0x01,
+  0xc5, 0x01, 0x50, 0xec, 0xec, 0xeb, 0xed, 0xee, 0x02, 0x00, 0x20, 0xee, 0xed, 0xc6, 0x01, 0x03, 0x1a, 0x00, 0x00, 0xdb, 0x01, 0x21, 0xed, 0xed,
+  0x32, 0x00, 0x00, 0x3a, 0x00, 0x01, 0xc0, 0x03, 0x20, 0xee, 0xee, 0x26, 0x00, 0x02, 0x01, 0x00, 0x01, 0x1e, 0x01, 0x37, 0xfa, 0xfa, 0xfa, 0xe0,
+  0x01, 0x01, 0xb2, 0x05, 0x43, 0xf7, 0xfb, 0xf4, 0xfb, 0x1b, 0x00, 0x01, 0x38, 0x05, 0x00, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x02, 0x02, 0x00, 0x03,
+  0x01, 0x00, 0x01, 0x1b, 0x00, 0x02, 0x01, 0x00, 0x01, 0x1d, 0x00, 0x00, 0x9f, 0x01, 0x03, 0x01, 0x00, 0x06, 0x1a, 0x00, 0x20, 0xf4, 0xf3, 0xad,
+  0x01, 0x11, 0xf5, 0x1a, 0x00, 0x00, 0x7a, 0x01, 0x04, 0xfe, 0x01, 0x09, 0x01, 0x00, 0x00, 0xcf, 0x01, 0x05, 0x01, 0x00, 0x07, 0xda, 0x01, 0x04,
+  0x01, 0x00, 0x00, 0xe2, 0x01, 0x12, 0xfa, 0x07, 0x00, 0x02, 0x06, 0x00, 0x00, 0x6f, 0x00, 0x01, 0xbf, 0x01, 0x00, 0x17, 0x00, 0x01, 0x05, 0x00,
+  0x00, 0x14, 0x02, 0x00, 0xbb, 0x00, 0x00, 0x9f, 0x02, 0x20, 0xfb, 0xf7, 0x0f, 0x00, 0x01, 0xe3, 0x05, 0x00, 0x24, 0x00, 0x00, 0xe5, 0x01, 0x01,
+  0x05, 0x00, 0x01, 0x32, 0x00, 0x04, 0x01, 0x00, 0x01, 0xe4, 0x05, 0x00, 0x16, 0x00, 0x00, 0xf6, 0x01, 0x04, 0xf8, 0x01, 0x01, 0xec, 0x03, 0x70,
+  0xf1, 0xdf, 0xcc, 0xbc, 0xb9, 0xb9, 0xbc, 0xdd, 0x01, 0x60, 0xc8, 0xd6, 0xdc, 0xe1, 0xe1, 0xdf, 0xd7, 0x05, 0xe0, 0xed, 0xdf, 0xed, 0xdc, 0xdf,
+  0xdc, 0xda, 0xdc, 0xdc, 0xdf, 0xdc, 0xea, 0xda, 0xdc, 0x01, 0x00, 0x20, 0xd9, 0xcd, 0x1d, 0x00, 0x70, 0xe1, 0xed, 0xef, 0xe1, 0xdf, 0xed, 0xdf,
+  0x04, 0x07, 0x00, 0x01, 0x00, 0x01, 0x8c, 0x01, 0x00, 0x71, 0x01, 0x10, 0xfc, 0xe9, 0x00, 0x03, 0x2b, 0x03, 0x40, 0xfa, 0xfa, 0xf2, 0xf0, 0x87,
+  0x03, 0x00, 0xdc, 0x01, 0x00, 0x21, 0x00, 0x20, 0xea, 0xea, 0x13, 0x08, 0x05, 0x01, 0x00, 0x40, 0xeb, 0xda, 0xeb, 0xdc, 0x6e, 0x05, 0x00, 0xa0,
+  0x01, 0x00, 0x3b, 0x00, 0x01, 0x06, 0x00, 0x00, 0x2a, 0x00, 0x02, 0xab, 0x03, 0x00, 0x02, 0x00, 0x21, 0xed, 0xee, 0xa2, 0x05, 0x00, 0x02, 0x00,
+  0x01, 0xdf, 0x01, 0x00, 0x14, 0x00, 0x01, 0x0b, 0x00, 0x00, 0x19, 0x00, 0x00, 0x30, 0x00, 0x31, 0xed, 0xec, 0xdc, 0x13, 0x00, 0x01, 0x02, 0x00,
+  0x31, 0xee, 0xed, 0xf9, 0xe2, 0x01, 0x20, 0xef, 0xee, 0x1b, 0x01, 0x00, 0x02, 0x00, 0x09, 0xe0, 0x01, 0x00, 0x71, 0x05, 0x00, 0x64, 0x01, 0x00,
+  0x06, 0x01, 0x06, 0x01, 0x00, 0x41, 0xf2, 0xfc, 0xf2, 0xfa, 0xee, 0x06, 0x00, 0x02, 0x00, 0x00, 0x11, 0x00, 0x00, 0xe3, 0x04, 0x00, 0x0c, 0x00,
+  0x01, 0x14, 0x01, 0x00, 0x08, 0x00, 0x00, 0x15, 0x00, 0x02, 0x01, 0x00, 0x60, 0xf2, 0xfa, 0xf2, 0xf1, 0xf0, 0xf2, 0x63, 0x00, 0xd0, 0xee, 0xee,
+  0xf0, 0xef, 0xf0, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xe5, 0xfc, 0xf3, 0xe2, 0x01, 0x00, 0x85, 0x01, 0x50, 0xfb, 0xf4, 0xf3, 0xf3, 0xf3, 0x83, 0x01,
+  0x00, 0x95, 0x01, 0x23, 0xf4, 0xf5, 0xd2, 0x01, 0x05, 0x07, 0x00, 0x09, 0x01, 0x00, 0x0b, 0x0f, 0x00, 0x00, 0x97, 0x00, 0x01, 0xe2, 0x01, 0x02,
+  0x05, 0x00, 0x00, 0xbc, 0x00, 0x04, 0x06, 0x00, 0x01, 0x59, 0x09, 0x00, 0x32, 0x03, 0x21, 0xf7, 0xe9, 0xc1, 0x03, 0x00, 0x23, 0x00, 0x00, 0xd2,
+  0x01, 0x01, 0x05, 0x00, 0x07, 0x02, 0x00, 0x01, 0x05, 0x00, 0x03, 0x02, 0x00, 0x00, 0x01, 0x00, 0x01, 0xdf, 0x01, 0x00, 0x02, 0x00, 0x00, 0xdf,
+  0x01, 0x00, 0x07, 0x00, 0xd0, 0xf1, 0xe4, 0xcf, 0xbc, 0xbc, 0xb9, 0xbc, 0xbe, 0xc1, 0xc4, 0xcc, 0xdf, 0xef, 0xbc, 0x05, 0x11, 0xf1, 0x02, 0x00,
+  0x02, 0x01, 0x00, 0x10, 0xf1, 0x03, 0x00, 0x01, 0x0d, 0x00, 0x30, 0xef, 0xf0, 0xef, 0xf0, 0x03, 0x0f, 0x01, 0x00, 0x01, 0x40, 0xe5, 0xf1, 0xf2,
+  0xfa, 0xbb, 0x03, 0x01, 0x01, 0x00, 0x30, 0xf7, 0xfb, 0xf4, 0x55, 0x00, 0x40, 0xf1, 0xf1, 0xf1, 0xe4, 0x37, 0x00, 0x00, 0x3c, 0x00, 0x10, 0xef,
+  0x03, 0x00, 0x40, 0xef, 0xef, 0xee, 0xe1, 0xba, 0x01, 0x80, 0xe1, 0xef, 0xee, 0xef, 0xf0, 0xee, 0xf0, 0xef, 0x2d, 0x01, 0x05, 0x01, 0x00, 0x40,
+  0xed, 0xec, 0xee, 0xed, 0x8c, 0x05, 0x00, 0x06, 0x00, 0x00, 0xdb, 0x01, 0x04, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x01, 0x15, 0x00, 0x00, 0xe3, 0x01,
+  0x00, 0x87, 0x05, 0x01, 0xd0, 0x03, 0x00, 0x1b, 0x02, 0x00, 0xb9, 0x05, 0x00, 0x0f, 0x00, 0x01, 0x05, 0x00, 0x01, 0x01, 0x00, 0x34, 0xef, 0xee,
+  0xf0, 0x1d, 0x01, 0x03, 0x8b, 0x00, 0x01, 0x01, 0x00, 0x03, 0x5f, 0x03, 0x01, 0xc0, 0x01, 0x03, 0xcb, 0x00, 0x02, 0x01, 0x00, 0x02, 0xd3, 0x05,
+  0x00, 0x01, 0x00, 0x80, 0xf0, 0xf0, 0xfc, 0xf1, 0xf1, 0xee, 0xed, 0xeb, 0x58, 0x00, 0x01, 0x3f, 0x02, 0x00, 0x4c, 0x00, 0x00, 0xb4, 0x08, 0x01,
+  0xf2, 0x01, 0x80, 0xf2, 0xf2, 0xf2, 0xf1, 0xe5, 0xf0, 0xf0, 0xe1, 0x4b, 0x06, 0x00, 0x92, 0x04, 0x00, 0x02, 0x00, 0x50, 0xd7, 0xdc, 0xeb, 0xed,
+  0xf1, 0x57, 0x00, 0x00, 0xe4, 0x01, 0x20, 0xfa, 0xef, 0x43, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x53, 0x00, 0x12, 0xf0, 0x1f, 0x05, 0x20, 0xf2, 0xf1,
+  0x39, 0x00, 0x02, 0x01, 0x00, 0x10, 0xf3, 0x03, 0x00, 0x15, 0xf3, 0x01, 0x00, 0x10, 0xf4, 0x03, 0x00, 0x00, 0x0a, 0x04, 0x10, 0xfa, 0x04, 0x00,
+  0x01, 0x05, 0x00, 0x01, 0xb9, 0x00, 0x01, 0xbc, 0x00, 0x00, 0x0b, 0x00, 0x01, 0xde, 0x01, 0x00, 0x3a, 0x02, 0x00, 0xdc, 0x01, 0x00, 0x03, 0x00,
+  0x01, 0xa0, 0x02, 0x01, 0xe1, 0x01, 0x00, 0x02, 0x00, 0x00, 0xcb, 0x01, 0x04, 0x06, 0x00, 0x02, 0x08, 0x00, 0x05, 0x02, 0x00, 0x03, 0x01, 0x00,
+  0x00, 0xb0, 0x0b, 0x01, 0xe4, 0x01, 0x00, 0xe6, 0x01, 0xc0, 0xf1, 0xe5, 0xcf, 0xbc, 0xbb, 0xbb, 0xbb, 0xc1, 0xc4, 0xc1, 0xdc, 0xe4, 0xaa, 0x07,
+  0x04, 0x02, 0x00, 0x00, 0x01, 0x00, 0x01, 0x06, 0x00, 0x10, 0xfc, 0x03, 0x00, 0x03, 0x02, 0x00, 0x10, 0xf2, 0xf2, 0x00, 0x0a, 0x02, 0x00, 0x00,
+  0xdf, 0x02, 0x24, 0xfa, 0xf4, 0xdf, 0x01, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x00, 0x10, 0xf2, 0x0e, 0x0a, 0x00, 0x1f, 0x00, 0x00, 0x24, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x1a, 0x08, 0x00, 0x09, 0x00, 0x00, 0x08, 0x00, 0x03, 0x10, 0x00, 0x00, 0x02, 0x00, 0x04, 0x32, 0x06, 0x01, 0x05, 0x00, 0x09,
+  0x01, 0x00, 0x00, 0x5a, 0x02, 0x01, 0x60, 0x02, 0x03, 0x01, 0x00, 0x02, 0x45, 0x01, 0x02, 0x07, 0x00, 0x23, 0xee, 0xf0, 0x9e, 0x01, 0x00, 0x0d,
+  0x00, 0x01, 0x0b, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x1f, 0x01, 0x00, 0x02, 0x00, 0x07, 0xc0, 0x03, 0x03, 0x25, 0x09, 0x50, 0xf4, 0xfa, 0xf0, 0xee,
+  0xfe, 0x1e, 0x02, 0x00, 0x2b, 0x02, 0x00, 0xb4, 0x07, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x00, 0x68, 0x00, 0x90, 0xed, 0xea, 0xdc, 0xea, 0xdc,
+  0xea, 0xea, 0xda, 0xd7, 0x6e, 0x04, 0x30, 0xeb, 0xda, 0xeb, 0x0d, 0x00, 0x00, 0x5d, 0x04, 0x00, 0x18, 0x06, 0x30, 0xdc, 0xeb, 0xda, 0x7a, 0x04,
+  0x10, 0xd9, 0x65, 0x06, 0x01, 0x01, 0x00, 0x60, 0xd7, 0xd6, 0xd7, 0xea, 0xf0, 0xf5, 0x59, 0x00, 0x40, 0xfb, 0xfb, 0xf4, 0xf0, 0xa9, 0x04, 0x00,
+  0x69, 0x06, 0x10, 0xea, 0xaa, 0x04, 0x00, 0x27, 0x0a, 0x70, 0xeb, 0xeb, 0xdc, 0xeb, 0xeb, 0xdc, 0xec, 0x33, 0x0a, 0x01, 0x56, 0x06, 0xa0, 0xed,
+  0xec, 0xea, 0xeb, 0xeb, 0xea, 0xeb, 0xeb, 0xed, 0xec, 0xe3, 0x02, 0x60, 0xed, 0xef, 0xee, 0xe1, 0xee, 0xef, 0x4b, 0x03, 0x30, 0xe4, 0xf1, 0xe5,
+  0x00, 0x02, 0x00, 0xff, 0x01, 0x30, 0xe7, 0xf2, 0xe8, 0x07, 0x02, 0x22, 0xf3, 0xf3, 0x0b, 0x02, 0x30, 0xf4, 0xf4, 0xf6, 0xc5, 0x00, 0x00, 0xde,
+  0x01, 0x01, 0x53, 0x01, 0x00, 0x2e, 0x06, 0x01, 0x01, 0x00, 0x00, 0xdf, 0x00, 0x21, 0xfa, 0xfb, 0x06, 0x02, 0x01, 0xcd, 0x03, 0x09, 0xe1, 0x01,
+  0x02, 0x01, 0x00, 0x01, 0x8f, 0x04, 0x05, 0x01, 0x00, 0x40, 0xfc, 0xf2, 0xf0, 0xd9, 0x23, 0x0d, 0x50, 0xbe, 0xc1, 0xcc, 0xef, 0xf1, 0xb5, 0x05,
+  0x0f, 0x01, 0x00, 0x03, 0x00, 0x0a, 0x02, 0x01, 0x11, 0x02, 0x05, 0x02, 0x00, 0x05, 0x01, 0x00, 0x00, 0x74, 0x02, 0x02, 0x5b, 0x09, 0x00, 0x50,
+  0x01, 0x22, 0xe9, 0xf7, 0x0b, 0x05, 0x01, 0x05, 0x00, 0x0a, 0x01, 0x00, 0x03, 0x36, 0x00, 0x00, 0x05, 0x00, 0x02, 0x04, 0x00, 0x01, 0x02, 0x00,
+  0x00, 0x11, 0x0c, 0x00, 0x04, 0x00, 0x00, 0x21, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x69, 0x00, 0x04, 0x6b, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x05, 0x02,
+  0x00, 0x3b, 0x08, 0x01, 0x05, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x0f, 0x00, 0x03, 0x1f, 0x02, 0x00, 0x73, 0x02, 0x00, 0x80, 0x02, 0x02, 0x01, 0x00,
+  0x10, 0xfc, 0x74, 0x00, 0x00, 0x8e, 0x00, 0x02, 0x89, 0x00, 0x01, 0x01, 0x00, 0x00, 0xfd, 0x02, 0x00, 0x05, 0x07, 0x11, 0xfc, 0x27, 0x02, 0x01,
+  0xff, 0x03, 0x00, 0xb3, 0x01, 0x50, 0xed, 0xee, 0xee, 0xf1, 0xf1, 0x9c, 0x02, 0x00, 0x50, 0x00, 0x00, 0xb7, 0x02, 0x30, 0xef, 0xec, 0xdc, 0x98,
+  0x03, 0x13, 0xda, 0x02, 0x00, 0x00, 0x03, 0x00, 0x52, 0xd7, 0xd7, 0xd7, 0xdc, 0xea, 0x5a, 0x06, 0x00, 0x1a, 0x0a, 0x02, 0x01, 0x00, 0x11, 0xd2,
+  0x02, 0x00, 0x50, 0xd6, 0xd7, 0xd6, 0xea, 0xf0, 0x83, 0x05, 0x51, 0xfb, 0xfb, 0xf4, 0xf3, 0xed, 0xd3, 0x03, 0x60, 0xda, 0xea, 0xda, 0xd7, 0xd7,
+  0xd9, 0x5c, 0x08, 0x00, 0x01, 0x00, 0x01, 0x15, 0x0c, 0x10, 0xea, 0x53, 0x00, 0x01, 0x18, 0x00, 0x00, 0x1b, 0x02, 0x02, 0x43, 0x00, 0x21, 0xd2,
+  0xcf, 0xb2, 0x08, 0x01, 0x01, 0x00, 0x00, 0x07, 0x00, 0x43, 0xd2, 0xd6, 0xd7, 0xd9, 0x1b, 0x00, 0xf1, 0x01, 0xd6, 0xd7, 0xda, 0xdf, 0xdc, 0xda,
+  0xdf, 0xdc, 0xe1, 0xe1, 0xef, 0xe3, 0xe5, 0xe5, 0xe7, 0xf4, 0xbf, 0x03, 0x02, 0x02, 0x00, 0x00, 0xc4, 0x00, 0x10, 0xfb, 0xe9, 0x03, 0x03, 0xfd,
+  0x03, 0x00, 0xff, 0x03, 0x31, 0xfa, 0xfa, 0xf3, 0xef, 0x00, 0x0b, 0x01, 0x00, 0x03, 0x11, 0x00, 0x01, 0x8c, 0x09, 0x00, 0x01, 0x00, 0x20, 0xf2,
+  0xfc, 0xc0, 0x03, 0x61, 0xbc, 0xbb, 0xbb, 0xc4, 0xcf, 0xe4, 0x3a, 0x01, 0x01, 0x01, 0x00, 0x01, 0xcf, 0x01, 0x02, 0x01, 0x00, 0x03, 0xb2, 0x07,
+  0x01, 0x91, 0x01, 0x0b, 0x01, 0x00, 0x00, 0x4c, 0x02, 0x00, 0x4a, 0x02, 0x01, 0xcb, 0x0b, 0x04, 0x01, 0x00, 0x00, 0xcd, 0x08, 0x06, 0x68, 0x06,
+  0x02, 0x22, 0x00, 0x02, 0x04, 0x00, 0x08, 0x02, 0x00, 0x00, 0x99, 0x04, 0x01, 0x02, 0x00, 0x00, 0x05, 0x00, 0x02, 0x1e, 0x00, 0x10, 0xf3, 0x0e,
+  0x00, 0x07, 0x01, 0x00, 0x00, 0xbf, 0x00, 0x03, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x02, 0x11, 0x07, 0x01, 0x03, 0x02, 0x01, 0x0c, 0x00, 0x12, 0xfc,
+  0x0d, 0x00, 0x00, 0x06, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x1e, 0x02, 0x01, 0x41, 0x00, 0x29, 0xf4, 0xfa, 0xe0, 0x01, 0x00, 0x1a, 0x01, 0x00, 0x1c,
+  0x01, 0x30, 0xfc, 0xfa, 0xf2, 0x0e, 0x04, 0x10, 0xf0, 0x26, 0x10, 0x10, 0xed, 0x46, 0x05, 0x01, 0x70, 0x00, 0x40, 0xf4, 0xf3, 0xfa, 0xf3, 0x47,
+  0x00, 0x30, 0xf1, 0xf0, 0xec, 0x95, 0x0b, 0x00, 0xea, 0x09, 0xe0, 0xea, 0xdc, 0xec, 0xea, 0xdc, 0xdc, 0xeb, 0xdc, 0xdc, 0xda, 0xda, 0xdc, 0xea,
+  0xda, 0x9a, 0x01, 0x00, 0xcf, 0x01, 0x02, 0x02, 0x00, 0x51, 0xd6, 0xcf, 0xd6, 0xcf, 0xd3, 0x8b, 0x01, 0x30, 0xd7, 0xea, 0xf0, 0x4e, 0x07, 0x50,
+  0xfb, 0xfb, 0xf4, 0xf2, 0xed, 0x7a, 0x0e, 0x03, 0x2b, 0x00, 0x01, 0x1d, 0x0c, 0x01, 0xe0, 0x0b, 0x10, 0xeb, 0x12, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x37, 0x00, 0x00, 0xe1, 0x01, 0x10, 0xd9, 0xde, 0x01, 0x30, 0xd6, 0xd6, 0xd3, 0x53, 0x0e, 0x10, 0xcc, 0x57, 0x0e, 0x02, 0x08, 0x00, 0x21, 0xcc,
+  0xcc, 0x66, 0x0e, 0x11, 0xcc, 0x01, 0x00, 0x01, 0x07, 0x00, 0x00, 0xfb, 0x01, 0x42, 0xcf, 0xcf, 0xd7, 0xe5, 0xd0, 0x08, 0x00, 0x37, 0x03, 0x01,
+  0xc2, 0x00, 0x30, 0xf4, 0xf2, 0xf1, 0xf5, 0x03, 0x00, 0xf9, 0x0c, 0x93, 0xf0, 0xe3, 0xf0, 0xe4, 0xf0, 0xe5, 0xe5, 0xf0, 0xe4, 0xff, 0x03, 0x10,
+  0xe7, 0x00, 0x04, 0x31, 0xe7, 0xf2, 0xe7, 0xff, 0x03, 0x10, 0xf3, 0x16, 0x01, 0x00, 0x06, 0x04, 0x00, 0x1c, 0x01, 0x00, 0x1f, 0x01, 0xa3, 0xe4,
+  0xcf, 0xbe, 0xbe, 0xbe, 0xbc, 0xb9, 0xc0, 0xd0, 0xf1, 0x47, 0x03, 0x00, 0xd3, 0x01, 0x02, 0xd5, 0x01, 0x01, 0x05, 0x00, 0x00, 0x4a, 0x01, 0x02,
+  0x50, 0x01, 0x00, 0x01, 0x00, 0x03, 0x07, 0x00, 0x00, 0x49, 0x01, 0x00, 0x95, 0x01, 0x00, 0x9c, 0x01, 0x00, 0xe0, 0x01, 0x01, 0x88, 0x00, 0x02,
+  0x01, 0x00, 0x00, 0x8d, 0x00, 0x01, 0xe0, 0x01, 0x03, 0x07, 0x00, 0x0e, 0x06, 0x00, 0x01, 0x05, 0x00, 0x03, 0x01, 0x00, 0x08, 0x0c, 0x00, 0x04,
+  0x01, 0x00, 0x03, 0x56, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x04, 0x00, 0x00, 0x05, 0x00, 0x02, 0x08, 0x00, 0x00,
+  0x88, 0x00, 0x00, 0x08, 0x00, 0x02, 0x02, 0x00, 0x00, 0xdf, 0x01, 0x0e, 0xe0, 0x01, 0x00, 0x21, 0x00, 0x10, 0xf3, 0xca, 0x01, 0x33, 0xf3, 0xfa,
+  0xf2, 0x08, 0x06, 0x22, 0xfa, 0xfa, 0xf7, 0x06, 0x00, 0x09, 0x03, 0x60, 0xf3, 0xfa, 0xf3, 0xfc, 0xf2, 0xf1, 0x25, 0x08, 0x00, 0x18, 0x08, 0x00,
+  0xca, 0x09, 0x10, 0xeb, 0x84, 0x0d, 0x50, 0xea, 0xdc, 0xdc, 0xdc, 0xea, 0x98, 0x01, 0x00, 0xa1, 0x01, 0x31, 0xd9, 0xdc, 0xda, 0xa2, 0x01, 0x01,
+  0xa4, 0x01, 0x50, 0xd6, 0xd7, 0xd9, 0xd7, 0xdc, 0xee, 0x07, 0x00, 0x5c, 0x00, 0x30, 0xfa, 0xed, 0xd7, 0xe0, 0x0f, 0x01, 0xcb, 0x01, 0x20, 0xd6,
+  0xd6, 0xbe, 0x11, 0x00, 0x8f, 0x0a, 0x01, 0x01, 0x00, 0x20, 0xea, 0xdc, 0xfc, 0x0f, 0x00, 0x02, 0x00, 0x10, 0xda, 0x1f, 0x00, 0x00, 0xe6, 0x01,
+  0x10, 0xd6, 0xb5, 0x03, 0x80, 0xd0, 0xcf, 0xcc, 0xd0, 0xd6, 0xd0, 0xd6, 0xd0, 0x67, 0x0e, 0x00, 0xe4, 0x01, 0x01, 0xea, 0x01, 0x30, 0xd0, 0xc8,
+  0xc9, 0x34, 0x12, 0xb0, 0xc9, 0xc9, 0xc9, 0xd0, 0xcc, 0xc9, 0xcc, 0xcc, 0xcf, 0xe4, 0xf5, 0x9f, 0x05, 0x00, 0x57, 0x01, 0x00, 0x01, 0x0f, 0x50,
+  0xf4, 0xf4, 0xf1, 0xd7, 0xd7, 0x7b, 0x00, 0x90, 0xcf, 0xd0, 0xd2, 0xd0, 0xcf, 0xcc, 0xc8, 0xd0, 0xc8, 0x3e, 0x00, 0x60, 0xcf, 0xd6, 0xcf, 0xd9,
+  0xd7, 0xda, 0x96, 0x00, 0x81, 0xcf, 0xd6, 0xd6, 0xd9, 0xdc, 0xdf, 0xdc, 0xdf, 0xf9, 0x0e, 0x80, 0xe4, 0xef, 0xe2, 0xdf, 0xe3, 0xef, 0xe4, 0xf2,
+  0xe2, 0x01, 0xc3, 0xfc, 0xf2, 0xe5, 0xc5, 0xbc, 0xbe, 0xbe, 0xb9, 0xbb, 0xbc, 0xcc, 0xe4, 0x0a, 0x03, 0x00, 0xff, 0x04, 0x04, 0xdc, 0x01, 0x0f,
+  0x01, 0x00, 0x01, 0x00, 0x49, 0x01, 0x01, 0x02, 0x00, 0x01, 0x01, 0x00, 0x01, 0x41, 0x01, 0x07, 0xc0, 0x03, 0x00, 0xe0, 0x01, 0x02, 0x01, 0x00,
+  0x03, 0x1b, 0x00, 0x00, 0xe5, 0x02, 0x00, 0xc7, 0x01, 0x01, 0x0b, 0x00, 0x00, 0x31, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0d, 0x00, 0x00, 0x08, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x11, 0x00, 0x06, 0x1c, 0x00, 0x00, 0x03, 0x00, 0x01, 0x05, 0x00, 0x06, 0x0d, 0x00, 0x00, 0x07, 0x00, 0x03, 0x09, 0x00,
+  0x02, 0x01, 0x00, 0x02, 0x0d, 0x00, 0x02, 0x06, 0x00, 0x01, 0x09, 0x00, 0x11, 0xfb, 0xe8, 0x03, 0x3d, 0xf3, 0xf4, 0xfa, 0x8d, 0x00, 0x03, 0x01,
+  0x02, 0x00, 0xd9, 0x06, 0x00, 0xe8, 0x01, 0x00, 0xd3, 0x01, 0x01, 0x11, 0x00, 0x01, 0xc0, 0x03, 0x03, 0x13, 0x00, 0x01, 0x3d, 0x14, 0x00, 0x03,
+  0x00, 0xc0, 0xf1, 0xf1, 0xf0, 0xe4, 0xf0, 0xef, 0xef, 0xdc, 0xda, 0xda, 0xea, 0xda, 0xd5, 0x01, 0x10, 0xd7, 0xcf, 0x01, 0x10, 0xda, 0xe0, 0x01,
+  0x00, 0xa0, 0x01, 0x20, 0xd9, 0xd6, 0x07, 0x00, 0x51, 0xda, 0xea, 0xed, 0xf1, 0xf3, 0xba, 0x00, 0x71, 0xf4, 0xf2, 0xee, 0xdc, 0xea, 0xda, 0xda,
+  0xc1, 0x01, 0x00, 0xfa, 0x01, 0x00, 0xc3, 0x03, 0x10, 0xda, 0x06, 0x04, 0x00, 0xe7, 0x01, 0x12, 0xda, 0x02, 0x00, 0x00, 0x82, 0x0c, 0x30, 0xed,
+  0xdf, 0xdc, 0x79, 0x0c, 0x10, 0xda, 0x42, 0x00, 0x21, 0xd6, 0xd3, 0x9e, 0x05, 0x80, 0xd0, 0xcf, 0xd0, 0xd0, 0xcf, 0xd3, 0xcc, 0xd0, 0xe4, 0x01,
+  0x01, 0xd9, 0x01, 0x70, 0xc9, 0xd0, 0xd0, 0xcc, 0xca, 0xc8, 0xc6, 0x0a, 0x00, 0x40, 0xc9, 0xcf, 0xe4, 0xf6, 0xc7, 0x00, 0x00, 0x7f, 0x07, 0x10,
+  0xe9, 0xa1, 0x0d, 0x70, 0xf3, 0xf0, 0xd6, 0xd6, 0xd3, 0xd6, 0xcf, 0x07, 0x02, 0x60, 0xc9, 0xc9, 0xc6, 0xc9, 0xc6, 0xc5, 0x27, 0x00, 0x01, 0x1c,
+  0x02, 0xd0, 0xd3, 0xcc, 0xc9, 0xc8, 0xc9, 0xc9, 0xc6, 0xc8, 0xc5, 0xcc, 0xcc, 0xcc, 0xd6, 0x58, 0x00, 0xf1, 0x02, 0xd6, 0xcc, 0xcf, 0xc8, 0xc5,
+  0xc5, 0xc8, 0xc8, 0xef, 0xf2, 0xff, 0xfa, 0xfa, 0xf2, 0xf2, 0xe3, 0xc5, 0xab, 0x12, 0x32, 0xba, 0xc8, 0xe4, 0x2a, 0x0c, 0x33, 0xfa, 0xf2, 0xf2,
+  0xf8, 0x03, 0x05, 0x01, 0x00, 0x00, 0x37, 0x01, 0x00, 0x3d, 0x01, 0x01, 0x05, 0x00, 0x01, 0x18, 0x01, 0x00, 0x22, 0x01, 0x03, 0x01, 0x00, 0x00,
+  0xe6, 0x00, 0x00, 0x2b, 0x06, 0x01, 0x6e, 0x02, 0x00, 0x93, 0x00, 0x00, 0x55, 0x0a, 0x01, 0x38, 0x03, 0x0f, 0x01, 0x00, 0x3e, 0x02, 0x0f, 0x02,
+  0x00, 0x72, 0x00, 0x00, 0xcf, 0x01, 0x01, 0x0b, 0x00, 0x02, 0x02, 0x00, 0x01, 0x01, 0x00, 0x02, 0xa1, 0x06, 0x0a, 0xc0, 0x03, 0x01, 0x23, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0xb2, 0x00, 0x00, 0xb9, 0x06, 0x02, 0xcf, 0x01, 0x00, 0xb6, 0x0a, 0x03, 0xf4, 0x01, 0x01, 0x0d, 0x00, 0x00, 0xdb, 0x00,
+  0x01, 0x04, 0x00, 0x00, 0x1d, 0x00, 0x60, 0xf2, 0xe5, 0xf0, 0xee, 0xe1, 0xeb, 0xb1, 0x01, 0x00, 0xbe, 0x03, 0x61, 0xd6, 0xd9, 0xd6, 0xda, 0xd7,
+  0xdc, 0xc0, 0x01, 0x00, 0xc7, 0x01, 0x00, 0x01, 0x00, 0x62, 0xdc, 0xdc, 0xeb, 0xe1, 0xee, 0xf1, 0xfa, 0x00, 0x40, 0xf4, 0xf3, 0xf0, 0xec, 0xab,
+  0x03, 0x00, 0xc7, 0x01, 0x00, 0x49, 0x03, 0x00, 0xfe, 0x01, 0x70, 0xd9, 0xda, 0xd6, 0xda, 0xd9, 0xda, 0xd9, 0x33, 0x00, 0x10, 0xd9, 0x23, 0x02,
+  0x30, 0xd7, 0xd9, 0xdc, 0x4b, 0x14, 0x05, 0x77, 0x0e, 0x00, 0x74, 0x07, 0x40, 0xd3, 0xd6, 0xd3, 0xd6, 0xb8, 0x03, 0x32, 0xcc, 0xd0, 0xc9, 0xdc,
+  0x01, 0x03, 0x01, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x01, 0x00, 0x10, 0xcc, 0xc0, 0x03, 0x00, 0xdf, 0x01, 0x00, 0x44, 0x08, 0x00, 0xa8, 0x04, 0x80,
+  0xef, 0xcf, 0xcf, 0xd0, 0xd0, 0xc9, 0xcc, 0xc9, 0xdb, 0x01, 0x32, 0xc4, 0xc4, 0xc6, 0xe1, 0x01, 0x00, 0xf8, 0x03, 0x00, 0x13, 0x00, 0x71, 0xc4,
+  0xc4, 0xc4, 0xc4, 0xc6, 0xc9, 0xc9, 0x20, 0x00, 0x40, 0xd0, 0xcc, 0xc9, 0xc5, 0x01, 0x02, 0x30, 0xc5, 0xe1, 0xf2, 0x6f, 0x05, 0xa0, 0xf1, 0xe3,
+  0xc2, 0xb9, 0xb9, 0xb9, 0xbb, 0xb9, 0xb7, 0xc5, 0xe0, 0x01, 0xb0, 0xfc, 0xfa, 0xfc, 0xe5, 0xe1, 0xd6, 0xdc, 0xde, 0xdc, 0xe3, 0xef, 0xe0, 0x05,
+  0x00, 0x02, 0x00, 0x24, 0xe5, 0xe4, 0xf0, 0x01, 0x00, 0xd5, 0x05, 0x10, 0xf2, 0xdf, 0x05, 0x00, 0xf1, 0x02, 0x01, 0x0d, 0x03, 0x01, 0x02, 0x00,
+  0x00, 0xe8, 0x00, 0x01, 0x8c, 0x00, 0x01, 0x8e, 0x00, 0x00, 0x91, 0x0f, 0x0b, 0xde, 0x01, 0x00, 0x21, 0x00, 0x03, 0x01, 0x00, 0x0b, 0x1a, 0x00,
+  0x04, 0x01, 0x00, 0x0d, 0x17, 0x00, 0x0d, 0x11, 0x00, 0x01, 0x14, 0x00, 0x02, 0x02, 0x00, 0x01, 0x01, 0x00, 0x03, 0x07, 0x00, 0x09, 0x01, 0x00,
+  0x01, 0x8e, 0x00, 0x1a, 0xf3, 0x60, 0x09, 0x00, 0xbd, 0x03, 0x01, 0xdf, 0x01, 0x11, 0xf4, 0xb4, 0x00, 0x12, 0xfa, 0xb6, 0x00, 0x00, 0xc0, 0x03,
+  0x00, 0xca, 0x02, 0x00, 0x02, 0x00, 0x01, 0xa8, 0x09, 0x01, 0xd8, 0x0b, 0x20, 0xf3, 0xf4, 0xec, 0x01, 0x50, 0xf2, 0xfc, 0xee, 0xed, 0xeb, 0x83,
+  0x03, 0x01, 0xab, 0x01, 0x01, 0x02, 0x00, 0x00, 0xde, 0x01, 0x00, 0x85, 0x03, 0x00, 0x01, 0x00, 0x73, 0xea, 0xda, 0xed, 0xdc, 0xee, 0xe1, 0xef,
+  0xbf, 0x03, 0x60, 0xfb, 0xf4, 0xfa, 0xf2, 0xee, 0xed, 0xa6, 0x03, 0x11, 0xea, 0xdf, 0x01, 0x00, 0x0f, 0x02, 0x00, 0x03, 0x00, 0x0c, 0x01, 0x00,
+  0x00, 0x9c, 0x05, 0x24, 0xda, 0xd7, 0x44, 0x00, 0x11, 0xda, 0x0c, 0x02, 0x03, 0x8b, 0x07, 0x21, 0xcc, 0xca, 0xe1, 0x01, 0x40, 0xc6, 0xc9, 0xc9,
+  0xca, 0x05, 0x00, 0x11, 0xc9, 0x08, 0x00, 0x30, 0xc8, 0xcc, 0xe3, 0xe0, 0x01, 0x00, 0x03, 0x00, 0x00, 0xd2, 0x08, 0x52, 0xfa, 0xf4, 0xf2, 0xef,
+  0xcf, 0x26, 0x00, 0x20, 0xc6, 0xc9, 0xcd, 0x01, 0x31, 0xc4, 0xc6, 0xc6, 0x2e, 0x00, 0x01, 0x14, 0x00, 0x50, 0xc4, 0xc4, 0xc6, 0xc4, 0xc6, 0x1a,
+  0x00, 0x00, 0x0d, 0x00, 0x10, 0xc5, 0x3f, 0x00, 0x50, 0xc6, 0xc4, 0xc6, 0xb9, 0xc1, 0xe0, 0x01, 0xc0, 0xfa, 0xf2, 0xe5, 0xe1, 0xba, 0xb7, 0xb8,
+  0xb9, 0xba, 0xbb, 0xb9, 0xc1, 0xe0, 0x01, 0x00, 0x50, 0x0b, 0x81, 0xbd, 0xb7, 0xba, 0xba, 0xba, 0xc5, 0xd3, 0xd6, 0x93, 0x18, 0x30, 0xc8, 0xcf,
+  0xcc, 0xe5, 0x09, 0x00, 0x49, 0x06, 0xa0, 0xd7, 0xdc, 0xed, 0xdc, 0xd7, 0xd7, 0xdc, 0xec, 0xef, 0xec, 0xa8, 0x06, 0x41, 0xef, 0xf0, 0xf1, 0xef,
+  0xa9, 0x0c, 0x40, 0xf0, 0xe5, 0xf1, 0xf2, 0x4d, 0x13, 0x01, 0x8f, 0x0f, 0x00, 0x8e, 0x00, 0x00, 0x90, 0x00, 0x00, 0xe3, 0x07, 0x00, 0x01, 0x00,
+  0x03, 0x34, 0x03, 0x02, 0x05, 0x00, 0x10, 0xf5, 0x02, 0x00, 0x31, 0xf6, 0xf4, 0xf5, 0x74, 0x01, 0x03, 0x01, 0x00, 0x00, 0xf2, 0x13, 0x01, 0x04,
+  0x12, 0x01, 0xf7, 0x03, 0x00, 0x0d, 0x00, 0x00, 0x02, 0x00, 0x01, 0x0d, 0x00, 0x03, 0x02, 0x00, 0x00, 0x43, 0x10, 0x01, 0x02, 0x00, 0x00, 0x09,
+  0x00, 0x03, 0x08, 0x00, 0x00, 0x13, 0x00, 0x05, 0x0e, 0x00, 0x00, 0x3b, 0x04, 0x01, 0x33, 0x00, 0x00, 0x81, 0x03, 0x00, 0x93, 0x0d, 0x00, 0x87,
+  0x00, 0x03, 0x01, 0x00, 0x00, 0x63, 0x00, 0x00, 0x65, 0x04, 0x00, 0xa8, 0x03, 0x00, 0xbd, 0x01, 0x00, 0xb7, 0x03, 0x01, 0x0d, 0x00, 0x00, 0xdf,
+  0x01, 0x02, 0xd3, 0x15, 0x04, 0x02, 0x00, 0x00, 0xd3, 0x10, 0x01, 0x1a, 0x00, 0x20, 0xf2, 0xf1, 0x4f, 0x0f, 0x20, 0xf0, 0xe1, 0x53, 0x0b, 0x01,
+  0x83, 0x03, 0x12, 0xd9, 0xe4, 0x01, 0x00, 0x9a, 0x01, 0x10, 0xea, 0x07, 0x00, 0x60, 0xed, 0xe1, 0xef, 0xf0, 0xf1, 0xf3, 0x5b, 0x00, 0x00, 0x54,
+  0x02, 0x32, 0xfc, 0xe4, 0xee, 0x8d, 0x05, 0x00, 0xed, 0x03, 0x04, 0x01, 0x00, 0x70, 0xd3, 0xd7, 0xd3, 0xd2, 0xd3, 0xcf, 0xd3, 0x2e, 0x05, 0x01,
+  0x1d, 0x07, 0x00, 0xf9, 0x01, 0x00, 0x2b, 0x02, 0x00, 0x52, 0x00, 0x62, 0xda, 0xda, 0xd6, 0xd9, 0xd9, 0xd9, 0xdf, 0x01, 0x00, 0x01, 0x00, 0x00,
+  0x97, 0x01, 0x12, 0xca, 0x04, 0x00, 0x31, 0xca, 0xc5, 0xc6, 0x07, 0x00, 0x50, 0xc4, 0xc6, 0xcc, 0xe4, 0xf5, 0xd9, 0x00, 0x00, 0x51, 0x01, 0x01,
+  0x61, 0x18, 0x31, 0xf2, 0xe1, 0xcc, 0x23, 0x00, 0x20, 0xc4, 0xc6, 0x01, 0x00, 0x01, 0xe1, 0x01, 0x22, 0xc9, 0xc6, 0xdf, 0x01, 0x00, 0xcf, 0x01,
+  0x50, 0xc4, 0xc6, 0xc9, 0xc6, 0xc4, 0xda, 0x01, 0x00, 0x04, 0x00, 0x00, 0x1f, 0x00, 0x41, 0xbc, 0xbe, 0xc0, 0xe1, 0x70, 0x07, 0x30, 0xe5, 0xdf,
+  0xba, 0x9e, 0x14, 0x30, 0xbb, 0xc0, 0xc5, 0x91, 0x07, 0xc2, 0xfc, 0xfa, 0xe5, 0xd6, 0xb7, 0xb7, 0xb9, 0xb8, 0xb9, 0xbc, 0xbe, 0xc5, 0x2a, 0x02,
+  0x32, 0xc5, 0xc9, 0xcc, 0xf1, 0x07, 0x80, 0xd0, 0xcc, 0xcc, 0xd3, 0xcf, 0xd6, 0xd6, 0xd2, 0x25, 0x08, 0x00, 0x47, 0x08, 0x10, 0xed, 0xee, 0x00,
+  0x20, 0xd7, 0xdc, 0x5c, 0x08, 0x20, 0xeb, 0xf1, 0x61, 0x09, 0x03, 0x01, 0x00, 0x80, 0xfb, 0xfb, 0xf4, 0xf1, 0xec, 0xdc, 0xed, 0xdc, 0xa9, 0x08,
+  0x60, 0xec, 0xe1, 0xeb, 0xef, 0xed, 0xee, 0xe2, 0x18, 0x40, 0xed, 0xef, 0xef, 0xf1, 0xe7, 0x10, 0x30, 0xf0, 0xef, 0xf0, 0xf6, 0x0d, 0x02, 0xff,
+  0x0f, 0x00, 0x0f, 0x04, 0x01, 0xf6, 0x0d, 0x07, 0x0d, 0x04, 0x40, 0xf4, 0xf5, 0xf4, 0xf6, 0x84, 0x01, 0x00, 0x03, 0x02, 0x30, 0xf5, 0xf4, 0xf5,
+  0xf1, 0x15, 0x20, 0xf4, 0xf6, 0x06, 0x00, 0x02, 0xfb, 0x01, 0x01, 0xd4, 0x01, 0x01, 0x02, 0x00, 0x00, 0x50, 0x02, 0x00, 0x01, 0x00, 0x00, 0xe3,
+  0x01, 0x01, 0x11, 0x00, 0x41, 0xfb, 0xf3, 0xfa, 0xf2, 0x2d, 0x0d, 0x10, 0xfa, 0x87, 0x00, 0x01, 0x01, 0x00, 0x00, 0xbf, 0x03, 0x00, 0x4d, 0x02,
+  0x41, 0xf4, 0xfa, 0xfc, 0xf1, 0xbe, 0x01, 0x02, 0x6a, 0x02, 0x00, 0x81, 0x04, 0x00, 0xc9, 0x01, 0x00, 0xe5, 0x01, 0x10, 0xf2, 0xe6, 0x01, 0x00,
+  0x90, 0x02, 0x02, 0x98, 0x04, 0x00, 0xac, 0x05, 0x20, 0xf2, 0xfa, 0xa6, 0x04, 0x20, 0xfc, 0xf1, 0xc6, 0x02, 0x20, 0xed, 0xdf, 0xb8, 0x01, 0x30,
+  0xd9, 0xd6, 0xda, 0x80, 0x03, 0x00, 0xe6, 0x01, 0x00, 0x41, 0x09, 0x51, 0xea, 0xdc, 0xec, 0xee, 0xf2, 0xa3, 0x02, 0x10, 0xf4, 0x5a, 0x0f, 0x00,
+  0x69, 0x07, 0x00, 0xe0, 0x01, 0x00, 0xc5, 0x01, 0x41, 0xd6, 0xd6, 0xd3, 0xd2, 0x63, 0x0b, 0x00, 0xe5, 0x01, 0x00, 0x03, 0x00, 0x02, 0x02, 0x00,
+  0x00, 0x19, 0x00, 0x00, 0xff, 0x01, 0x00, 0x3d, 0x01, 0x01, 0x09, 0x00, 0x01, 0xbf, 0x03, 0x10, 0xd3, 0xc1, 0x03, 0x20, 0xc9, 0xd0, 0xd3, 0x01,
+  0x00, 0xa7, 0x01, 0x01, 0x02, 0x00, 0x00, 0x05, 0x00, 0x31, 0xc5, 0xc6, 0xc5, 0xe0, 0x01, 0x01, 0x01, 0x00, 0x20, 0xf7, 0xf7, 0x5d, 0x15, 0x50,
+  0xf2, 0xef, 0xd0, 0xc9, 0xca, 0xdb, 0x01, 0x00, 0xbe, 0x01, 0x00, 0xa0, 0x03, 0x00, 0x03, 0x00, 0x03, 0xcf, 0x01, 0x00, 0x12, 0x00, 0x00, 0xf8,
+  0x01, 0x21, 0xc9, 0xca, 0x12, 0x00, 0x90, 0xc6, 0xc6, 0xc4, 0xc3, 0xc4, 0xc3, 0xc4, 0xc8, 0xe3, 0xe0, 0x00, 0xc0, 0xfc, 0xe5, 0xda, 0xb7, 0xb8,
+  0xb9, 0xbb, 0xb9, 0xbb, 0xba, 0xc9, 0xe5, 0xdf, 0x01, 0x30, 0xfc, 0xe5, 0xda, 0x8f, 0x07, 0x84, 0xbb, 0xb9, 0xbb, 0xb9, 0xbe, 0xbe, 0xbe, 0xbe,
+  0x08, 0x04, 0x51, 0xc9, 0xc9, 0xca, 0xcc, 0xca, 0x01, 0x08, 0x50, 0xd3, 0xd6, 0xd9, 0xd2, 0xd9, 0xad, 0x0d, 0x01, 0x90, 0x02, 0x01, 0xbe, 0x09,
+  0x30, 0xd7, 0xea, 0xe5, 0x61, 0x09, 0x01, 0x6e, 0x02, 0x00, 0xe0, 0x01, 0x20, 0xf3, 0xf0, 0x35, 0x18, 0x00, 0xf6, 0x00, 0x30, 0xd7, 0xdc, 0xda,
+  0xe0, 0x14, 0x01, 0x3d, 0x0a, 0x00, 0x76, 0x0c, 0x01, 0x7c, 0x08, 0x02, 0x23, 0x0e, 0x01, 0x9d, 0x12, 0x10, 0xee, 0x8a, 0x0e, 0x00, 0x2e, 0x03,
+  0x00, 0x66, 0x10, 0x00, 0x02, 0x00, 0x00, 0xff, 0x13, 0x01, 0xdb, 0x10, 0x00, 0xfc, 0x12, 0x00, 0xe1, 0x10, 0x02, 0x23, 0x19, 0x00, 0x07, 0x02,
+  0x00, 0x28, 0x13, 0x00, 0x01, 0x00, 0x10, 0xfa, 0xac, 0x03, 0x02, 0x02, 0x00, 0x01, 0x10, 0x02, 0xa0, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4,
+  0xf4, 0xf4, 0xfb, 0xa5, 0xf4, 0xf3, 0xfa, 0xf3, 0xf2, 0xfc, 0xf2, 0xfc, 0xf4, 0xe9, 0x01, 0x00, 0xf0, 0x01, 0xfb, 0xfb, 0xfb, 0xf4, 0xfb, 0xfb,
+  0xf4, 0xf4, 0xfc, 0xf0, 0xf0, 0xf1, 0xf3, 0xf4, 0xf4, 0xf4, 0x04, 0x00, 0xf0, 0x02, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xfa, 0xf3,
+  0xfa, 0xf3, 0xf3, 0xf3, 0xfa, 0xf3, 0xfa, 0x03, 0x00, 0x00, 0x01, 0x00, 0x02, 0x0e, 0x00, 0x01, 0x0d, 0x00, 0x10, 0xf2, 0x09, 0x00, 0xe0, 0xf2,
+  0xf2, 0xe5, 0xf2, 0xe4, 0xee, 0xdf, 0xda, 0xd6, 0xd9, 0xd7, 0xd9, 0xd6, 0xd9, 0x01, 0x00, 0xe0, 0xd7, 0xd9, 0xd7, 0xda, 0xda, 0xda, 0xdc, 0xdc,
+  0xdc, 0xdc, 0xe1, 0xf1, 0xf4, 0xfb, 0x5d, 0x00, 0xf3, 0x00, 0xf4, 0xf2, 0xee, 0xdc, 0xda, 0xda, 0xd7, 0xdc, 0xea, 0xda, 0xd7, 0xda, 0xd9, 0xd9,
+  0xd6, 0x01, 0x00, 0x05, 0x09, 0x00, 0x03, 0x01, 0x00, 0x70, 0xd9, 0xd6, 0xd9, 0xd6, 0xda, 0xd9, 0xda, 0x08, 0x00, 0x01, 0x1b, 0x00, 0x10, 0xd3,
+  0x02, 0x00, 0x31, 0xd0, 0xcc, 0xd0, 0x01, 0x00, 0xf0, 0x0b, 0xc9, 0xd0, 0xc9, 0xc9, 0xca, 0xd0, 0xc9, 0xc9, 0xd0, 0xca, 0xc9, 0xc9, 0xc9, 0xc9,
+  0xc6, 0xca, 0xc9, 0xc9, 0xca, 0xc4, 0xc6, 0xcc, 0xe5, 0xf5, 0xf7, 0xf7, 0xc2, 0x00, 0xf0, 0x00, 0xe9, 0xf7, 0xe9, 0xf4, 0xf4, 0xfa, 0xfa, 0xf2,
+  0xef, 0xd0, 0xc9, 0xc6, 0xc6, 0xc4, 0xc4, 0x04, 0x00, 0x40, 0xc4, 0xc4, 0xc4, 0xc6, 0x02, 0x00, 0x13, 0xc9, 0x02, 0x00, 0xf1, 0x01, 0xc6, 0xc4,
+  0xc6, 0xc6, 0xc6, 0xca, 0xc6, 0xc6, 0xc6, 0xc9, 0xc4, 0xca, 0xca, 0xc9, 0xc6, 0xca, 0x23, 0x00, 0xf0, 0x05, 0xc9, 0xc9, 0xe3, 0xf2, 0xfc, 0xfa,
+  0xfa, 0xfc, 0xe5, 0xdf, 0xb9, 0xb7, 0xb8, 0xb9, 0xbc, 0xbb, 0xc1, 0xd9, 0xe5, 0xf2, 0x1d, 0x01, 0x70, 0xe5, 0xdc, 0xbc, 0xb9, 0xbe, 0xb9, 0xbb,
+  0x03, 0x00, 0x80, 0xbe, 0xbe, 0xbe, 0xc6, 0xca, 0xc9, 0xd0, 0xc6, 0x81, 0x00, 0xd0, 0xc6, 0xc9, 0xc9, 0xca, 0xc5, 0xc6, 0xc9, 0xc9, 0xc9, 0xd3,
+  0xd6, 0xd6, 0xd0, 0x9f, 0x00, 0x70, 0xda, 0xd6, 0xcf, 0xd9, 0xda, 0xda, 0xda, 0xf2, 0x00, 0x40, 0xd9, 0xdc, 0xf1, 0xfb, 0x8a, 0x00, 0x02, 0x01,
+  0x00, 0x90, 0xfb, 0xf4, 0xfa, 0xf0, 0xed, 0xdc, 0xd7, 0xd9, 0xda, 0x0e, 0x01, 0x00, 0x02, 0x00, 0x00, 0x24, 0x00, 0x00, 0x1f, 0x01, 0x00, 0x03,
+  0x01, 0xa0, 0xda, 0xd7, 0xda, 0xdc, 0xda, 0xed, 0xdc, 0xed, 0xdc, 0xed, 0x01, 0x00, 0x44, 0xdc, 0xea, 0xdc, 0xec, 0x0c, 0x00, 0x00, 0x01, 0x00,
+  0x30, 0xec, 0xdc, 0xec, 0x07, 0x00, 0x70, 0xed, 0xed, 0xed, 0xe1, 0xed, 0xed, 0xee, 0x08, 0x00, 0x04, 0x01, 0x00, 0x03, 0x0d, 0x00, 0x60, 0xee,
+  0xe1, 0xee, 0xed, 0xee, 0xf2, 0x59, 0x01, 0xf0, 0x01, 0xf7, 0xfb, 0xf7, 0xfb, 0xf3, 0xf0, 0xf0, 0xef, 0xf0, 0xf0, 0xf0, 0xf1, 0xf1, 0xf1, 0xf0,
+  0xf1, 0x06, 0x00, 0x20, 0xf3, 0xfa, 0xe2, 0x01, 0x30, 0xfa, 0xfa, 0xf6, 0x87, 0x00, 0x02, 0x01, 0x00, 0x00, 0x2b, 0x00, 0x01, 0x86, 0x01, 0x40,
+  0xf1, 0xf1, 0xf2, 0xfa, 0xdc, 0x01, 0x01, 0xde, 0x01, 0x02, 0x02, 0x00, 0x11, 0xf3, 0x06, 0x00, 0x00, 0x02, 0x00, 0x10, 0xfa, 0x0e, 0x00, 0x61,
+  0xfa, 0xf2, 0xfc, 0xe5, 0xfc, 0xf2, 0x01, 0x00, 0x03, 0xdf, 0x01, 0xa0, 0xfa, 0xe5, 0xf1, 0xf0, 0xef, 0xdc, 0xea, 0xd9, 0xd7, 0xd9, 0x98, 0x01,
+  0x01, 0xc6, 0x00, 0x00, 0xdf, 0x01, 0x72, 0xea, 0xda, 0xea, 0xdc, 0xeb, 0xed, 0xe5, 0xe0, 0x01, 0x50, 0xf3, 0xf2, 0xed, 0xdc, 0xd7, 0xf1, 0x01,
+  0x00, 0xe6, 0x01, 0x20, 0xd9, 0xd9, 0xe4, 0x01, 0x00, 0x02, 0x00, 0x00, 0xd4, 0x01, 0x02, 0x08, 0x00, 0x10, 0xd9, 0xd2, 0x01, 0x70, 0xd9, 0xd9,
+  0xda, 0xda, 0xdc, 0xda, 0xda, 0x20, 0x00, 0x21, 0xd7, 0xd9, 0xdf, 0x01, 0x22, 0xcf, 0xd3, 0xda, 0x01, 0x02, 0xe5, 0x01, 0xa0, 0xc9, 0xd0, 0xc9,
+  0xca, 0xcc, 0xd0, 0xc9, 0xca, 0xc9, 0xca, 0x68, 0x01, 0x00, 0x05, 0x00, 0x51, 0xcf, 0xe4, 0xf5, 0xf7, 0xe9, 0xe1, 0x01, 0x03, 0xe0, 0x01, 0x30,
+  0xe1, 0xcc, 0xc6, 0x01, 0x00, 0x00, 0xcb, 0x01, 0xa1, 0xc4, 0xc3, 0xc4, 0xc3, 0xc4, 0xc6, 0xc6, 0xca, 0xc4, 0xc6, 0x32, 0x00, 0x00, 0xeb, 0x01,
+  0x00, 0x01, 0x00, 0x54, 0xc4, 0xc4, 0xc6, 0xca, 0xca, 0x22, 0x00, 0x50, 0xc6, 0xc6, 0xc2, 0xe2, 0xf2, 0xa9, 0x02, 0xb0, 0xe5, 0xe1, 0xc0, 0xb9,
+  0xb9, 0xb9, 0xbb, 0xbc, 0xbe, 0xcc, 0xe5, 0xdf, 0x01, 0xa0, 0xf2, 0xe5, 0xda, 0xb9, 0xb9, 0xbe, 0xbb, 0xb9, 0xbb, 0xbb, 0xe1, 0x01, 0x00, 0x46,
+  0x00, 0x20, 0xca, 0xc4, 0x5a, 0x02, 0x04, 0x4b, 0x00, 0x80, 0xc9, 0xd0, 0xd3, 0xd3, 0xcc, 0xcc, 0xd0, 0xcf, 0x8d, 0x02, 0x00, 0xaf, 0x00, 0x80,
+  0xdc, 0xdf, 0xdc, 0xda, 0xd7, 0xdc, 0xf1, 0xf5, 0x8b, 0x00, 0x00, 0x04, 0x00, 0x02, 0xe0, 0x01, 0x80, 0xdc, 0xdc, 0xda, 0xdc, 0xda, 0xd7, 0xd9,
+  0xd6, 0x01, 0x02, 0x10, 0xda, 0x01, 0x00, 0x01, 0xea, 0x00, 0x20, 0xda, 0xd9, 0x0e, 0x00, 0x40, 0xdc, 0xdc, 0xdc, 0xed, 0x10, 0x01, 0x50, 0xed,
+  0xdc, 0xdc, 0xeb, 0xdf, 0x07, 0x00, 0xb1, 0xec, 0xdc, 0xed, 0xdf, 0xdc, 0xed, 0xdf, 0xe1, 0xed, 0xed, 0xdf, 0xec, 0x01, 0x05, 0xf2, 0x01, 0x11,
+  0xe1, 0x03, 0x00, 0x10, 0xdf, 0x03, 0x00, 0x10, 0xdc, 0x24, 0x00, 0x01, 0x35, 0x00, 0x40, 0xed, 0xe1, 0xf1, 0xf5, 0x5a, 0x01, 0xe0, 0xfb, 0xfb,
+  0xfb, 0xf1, 0xee, 0xed, 0xee, 0xe1, 0xef, 0xef, 0xef, 0xee, 0xef, 0xf0, 0x05, 0x00, 0x10, 0xee, 0x96, 0x03, 0x42, 0xf3, 0xf4, 0xfa, 0xf4, 0x88,
+  0x00, 0x01, 0x01, 0x00, 0x31, 0xf7, 0xf4, 0xfb, 0x02, 0x00, 0x41, 0xf4, 0xf2, 0xf2, 0xfc, 0xbc, 0x03, 0x00, 0xe0, 0x01, 0x00, 0xcf, 0x01, 0x00,
+  0xd5, 0x01, 0x01, 0x08, 0x00, 0x01, 0x12, 0x00, 0xb0, 0xf4, 0xf4, 0xf4, 0xf2, 0xfc, 0xf0, 0xee, 0xee, 0xef, 0xee, 0xed, 0x4e, 0x00, 0x10, 0xf1,
+  0xe5, 0x01, 0x51, 0xf2, 0xf1, 0xef, 0xe1, 0xed, 0xb7, 0x01, 0x01, 0xb2, 0x01, 0x01, 0xbf, 0x03, 0x02, 0xc2, 0x00, 0x00, 0xc3, 0x00, 0x02, 0xc0,
+  0x03, 0x00, 0x38, 0x00, 0x10, 0xee, 0x24, 0x00, 0x00, 0x04, 0x00, 0x11, 0xd9, 0x03, 0x00, 0x00, 0xcc, 0x01, 0x01, 0x1a, 0x01, 0x04, 0x04, 0x00,
+  0x01, 0xf6, 0x01, 0x01, 0x0b, 0x00, 0x03, 0x46, 0x00, 0x00, 0xdd, 0x01, 0x80, 0xcf, 0xd0, 0xcc, 0xd0, 0xca, 0xcc, 0xca, 0xc9, 0xe2, 0x01, 0x32,
+  0xc9, 0xc9, 0xc9, 0xe4, 0x01, 0x30, 0xcc, 0xca, 0xc9, 0x69, 0x01, 0x00, 0xe3, 0x01, 0x44, 0xcc, 0xd6, 0xe5, 0xfb, 0xc7, 0x00, 0x20, 0xf7, 0xf4,
+  0xa8, 0x01, 0x01, 0xe0, 0x01, 0x00, 0xbc, 0x01, 0x01, 0x07, 0x00, 0x01, 0xe1, 0x01, 0x41, 0xc6, 0xc6, 0xc9, 0xca, 0xd2, 0x01, 0x00, 0xd7, 0x03,
+  0x03, 0x01, 0x00, 0x11, 0xc9, 0xcb, 0x03, 0xf0, 0x14, 0xc4, 0xbe, 0xc4, 0xc6, 0xc9, 0xe3, 0xf2, 0xfa, 0xfc, 0xfa, 0xfc, 0xe5, 0xe2, 0xc4, 0xbc,
+  0xbb, 0xb9, 0xb9, 0xbb, 0xba, 0xcf, 0xe5, 0xf2, 0xfa, 0xfc, 0xf2, 0xfc, 0xe4, 0xda, 0xb9, 0xb8, 0xb9, 0xb8, 0xb8, 0xb9, 0xf5, 0x01, 0x20, 0xbb,
+  0xbe, 0x47, 0x00, 0x00, 0xf5, 0x03, 0x00, 0x78, 0x00, 0x22, 0xca, 0xd0, 0xe0, 0x01, 0x10, 0xcf, 0x93, 0x00, 0x90, 0xd0, 0xd6, 0xd0, 0xd3, 0xd3,
+  0xd6, 0xd9, 0xd6, 0xdc, 0xbb, 0x01, 0x25, 0xda, 0xf0, 0x13, 0x05, 0x70, 0xf7, 0xf7, 0xfb, 0xf4, 0xf3, 0xf0, 0xec, 0x03, 0x01, 0x01, 0x01, 0x00,
+  0x00, 0x0e, 0x01, 0x00, 0xe0, 0x01, 0x10, 0xd9, 0xed, 0x01, 0x02, 0xde, 0x01, 0x01, 0x01, 0x00, 0x30, 0xdf, 0xed, 0xdf, 0xb2, 0x01, 0x20, 0xed,
+  0xe1, 0xb2, 0x01, 0x20, 0xed, 0xdc, 0xc6, 0x01, 0x04, 0x17, 0x00, 0x10, 0xed, 0xd1, 0x01, 0x00, 0x02, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x06, 0x00,
+  0x01, 0x02, 0x00, 0x00, 0x03, 0x00, 0x01, 0x21, 0x00, 0x30, 0xed, 0xf0, 0xf3, 0xbf, 0x03, 0xf0, 0x08, 0xfb, 0xfb, 0xf4, 0xe5, 0xee, 0xed, 0xe1,
+  0xee, 0xee, 0xee, 0xee, 0xe1, 0xee, 0xef, 0xee, 0xef, 0xe1, 0xee, 0xef, 0xf3, 0xfa, 0xf4, 0xf4, 0x04, 0x00, 0x04, 0x19, 0x01, 0x00, 0x6d, 0x02,
+  0x03, 0xa0, 0x05, 0x30, 0xf3, 0xf3, 0xf3, 0x97, 0x03, 0x01, 0xd5, 0x01, 0x02, 0x06, 0x00, 0x00, 0xe3, 0x01, 0x08, 0x02, 0x00, 0x50, 0xfa, 0xf2,
+  0xf1, 0xf0, 0xe1, 0x7c, 0x00, 0x00, 0x01, 0x00, 0x10, 0xe1, 0x18, 0x04, 0x10, 0xef, 0x61, 0x04, 0x20, 0xda, 0xea, 0xbf, 0x00, 0x50, 0xda, 0xdc,
+  0xda, 0xdc, 0xea, 0x7f, 0x00, 0x00, 0x63, 0x02, 0x82, 0xed, 0xe1, 0xee, 0xe1, 0xed, 0xee, 0xe5, 0xf4, 0x59, 0x00, 0x20, 0xf2, 0xe1, 0xe5, 0x00,
+  0x00, 0xfd, 0x01, 0x01, 0xbd, 0x01, 0x20, 0xd9, 0xd6, 0xd6, 0x04, 0x00, 0xf2, 0x00, 0x00, 0x03, 0x00, 0x01, 0x3c, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0xdd, 0x03, 0x00, 0x25, 0x00, 0x10, 0xd3, 0xbc, 0x03, 0x10, 0xcc, 0x36, 0x03, 0x01, 0xdb, 0x01, 0x00, 0xbd, 0x03, 0x01, 0xe0,
+  0x01, 0x00, 0x04, 0x00, 0xc2, 0xca, 0xc9, 0xca, 0xd0, 0xca, 0xca, 0xcc, 0xc9, 0xd6, 0xe5, 0xf6, 0xf7, 0x32, 0x03, 0x90, 0xf7, 0xf7, 0xfb, 0xfa,
+  0xfa, 0xf2, 0xf2, 0xe1, 0xc9, 0xde, 0x01, 0x00, 0xc9, 0x01, 0x00, 0x04, 0x00, 0x30, 0xc6, 0xc4, 0xbe, 0xcd, 0x01, 0x01, 0x2e, 0x00, 0x01, 0x0f,
+  0x00, 0x00, 0x05, 0x00, 0x20, 0xc6, 0xca, 0x99, 0x05, 0x00, 0xe0, 0x01, 0x80, 0xc6, 0xbe, 0xc4, 0xc4, 0xcc, 0xe3, 0xf2, 0xf2, 0x39, 0x00, 0x31,
+  0xe2, 0xc5, 0xbb, 0xad, 0x03, 0x00, 0xa0, 0x05, 0x61, 0xfa, 0xfc, 0xf2, 0xe5, 0xd9, 0xbc, 0xdd, 0x01, 0x00, 0xdf, 0x01, 0x60, 0xbc, 0xbe, 0xc4,
+  0xbe, 0xc3, 0xca, 0x00, 0x04, 0x10, 0xc9, 0xe4, 0x01, 0x00, 0xcd, 0x03, 0x30, 0xc9, 0xca, 0xd0, 0x9e, 0x00, 0xf0, 0x01, 0xc9, 0xcc, 0xd3, 0xd0,
+  0xcf, 0xd3, 0xd3, 0xd3, 0xcf, 0xd0, 0xd6, 0xd3, 0xd9, 0xd9, 0xdc, 0xef, 0x54, 0x01, 0x00, 0x8d, 0x00, 0x71, 0xe9, 0xe9, 0xf7, 0xfb, 0xf4, 0xf2,
+  0xf0, 0x6c, 0x03, 0x10, 0xdc, 0x06, 0x00, 0x00, 0x1b, 0x01, 0x00, 0xb9, 0x04, 0x00, 0xdf, 0x01, 0x61, 0xda, 0xd6, 0xda, 0xdc, 0xed, 0xdf, 0xe4,
+  0x01, 0x41, 0xdf, 0xed, 0xdc, 0xdf, 0xcd, 0x01, 0x00, 0xdc, 0x01, 0x10, 0xe1, 0xc1, 0x01, 0x13, 0xdf, 0xca, 0x03, 0x00, 0xe1, 0x01, 0x00, 0x68,
+  0x01, 0x00, 0x09, 0x00, 0x00, 0x0f, 0x00, 0x01, 0x1c, 0x00, 0x02, 0xdc, 0x01, 0x30, 0xdc, 0xda, 0xea, 0x0e, 0x00, 0x00, 0xe0, 0x01, 0x00, 0xe1,
+  0x01, 0x20, 0xf3, 0xf0, 0x6a, 0x01, 0x01, 0xc0, 0x03, 0x01, 0x05, 0x00, 0x31, 0xee, 0xf4, 0xfa, 0x73, 0x05, 0x05, 0x6c, 0x02, 0x41, 0xe9, 0xe9,
+  0xe9, 0xf6, 0xbd, 0x03, 0x72, 0xf4, 0xfb, 0xf3, 0xfa, 0xf2, 0xf2, 0xf1, 0xcf, 0x05, 0x91, 0xf0, 0xf1, 0xf0, 0xe5, 0xf1, 0xf2, 0xf2, 0xf3, 0xf4,
+  0xc8, 0x03, 0x00, 0xf2, 0x03, 0x03, 0x02, 0x00, 0x60, 0xfa, 0xf2, 0xf2, 0xf0, 0xf0, 0xef, 0xd6, 0x01, 0x00, 0xc5, 0x01, 0x32, 0xed, 0xed, 0xef,
+  0x15, 0x06, 0x00, 0x1d, 0x04, 0x00, 0x60, 0x00, 0x90, 0xe4, 0xf0, 0xf0, 0xf0, 0xe4, 0xf0, 0xe4, 0xf1, 0xe4, 0x06, 0x00, 0x30, 0xf0, 0xee, 0xf2,
+  0xc0, 0x03, 0x51, 0xfb, 0xf4, 0xfa, 0xf2, 0xed, 0xdf, 0x01, 0x00, 0x75, 0x05, 0x14, 0xd6, 0xa9, 0x07, 0x00, 0xcf, 0x03, 0x11, 0xd7, 0x06, 0x00,
+  0x00, 0xb6, 0x00, 0x00, 0x21, 0x00, 0x00, 0xfd, 0x00, 0x01, 0x06, 0x04, 0x00, 0xba, 0x05, 0x01, 0xc0, 0x03, 0x00, 0xcd, 0x01, 0x20, 0xc9, 0xca,
+  0xc0, 0x03, 0x00, 0x3e, 0x03, 0x10, 0xca, 0xa9, 0x05, 0x01, 0xec, 0x01, 0x10, 0xca, 0xd8, 0x03, 0x41, 0xd0, 0xd0, 0xd7, 0xe7, 0x7f, 0x07, 0x00,
+  0xa4, 0x05, 0x90, 0xfb, 0xfb, 0xfa, 0xfa, 0xfa, 0xe5, 0xe1, 0xc5, 0xc4, 0xb9, 0x01, 0x00, 0x8d, 0x01, 0x00, 0x08, 0x00, 0x00, 0x09, 0x00, 0x00,
+  0x8e, 0x01, 0x00, 0x96, 0x01, 0x04, 0x11, 0x00, 0x00, 0x01, 0x00, 0x31, 0xbe, 0xc4, 0xc4, 0x0d, 0x00, 0x20, 0xc3, 0xc1, 0xc0, 0x03, 0x10, 0xf2,
+  0xe0, 0x01, 0x70, 0xc4, 0xbc, 0xbb, 0xbb, 0xb9, 0xbe, 0xc1, 0xa0, 0x05, 0x00, 0x84, 0x06, 0x10, 0xda, 0xbd, 0x03, 0x04, 0xa1, 0x05, 0x60, 0xc3,
+  0xbe, 0xc4, 0xbe, 0xbe, 0xc3, 0x4a, 0x00, 0x40, 0xce, 0xca, 0xc6, 0xd0, 0x1a, 0x06, 0x00, 0xdf, 0x01, 0x10, 0xd4, 0x90, 0x00, 0x40, 0xd3, 0xcc,
+  0xd3, 0xcf, 0xe1, 0x01, 0x55, 0xd0, 0xcf, 0xd0, 0xd6, 0xef, 0x4d, 0x04, 0x61, 0xe9, 0xe9, 0xf4, 0xf4, 0xf3, 0xf0, 0xd3, 0x00, 0x00, 0x91, 0x01,
+  0x01, 0xdf, 0x01, 0x01, 0xdb, 0x00, 0x60, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd7, 0xc6, 0x01, 0x01, 0xf3, 0x00, 0x01, 0x01, 0x00, 0x10, 0xed, 0xe8,
+  0x01, 0x00, 0xd1, 0x01, 0x01, 0x0a, 0x00, 0x00, 0x0c, 0x00, 0x01, 0x16, 0x00, 0x51, 0xdf, 0xee, 0xe1, 0xed, 0xe1, 0xf6, 0x01, 0x01, 0x16, 0x00,
+  0x00, 0x18, 0x00, 0x01, 0x06, 0x00, 0x00, 0xf5, 0x05, 0x50, 0xdf, 0xdf, 0xed, 0xef, 0xf2, 0xdf, 0x01, 0x70, 0xf7, 0xf4, 0xfa, 0xf0, 0xef, 0xee,
+  0xed, 0xbb, 0x03, 0x01, 0xdd, 0x01, 0x40, 0xef, 0xee, 0xef, 0xf3, 0x81, 0x07, 0x27, 0xf3, 0xf3, 0x8c, 0x00, 0x40, 0xe9, 0xfb, 0xf4, 0xf5, 0x7d,
+  0x05, 0x20, 0xf4, 0xfa, 0xbb, 0x01, 0x20, 0xee, 0xed, 0xec, 0x03, 0x01, 0xf3, 0x03, 0x30, 0xef, 0xf0, 0xf1, 0xd9, 0x01, 0x20, 0xfa, 0xf4, 0x32,
+  0x00, 0x00, 0xdd, 0x01, 0x00, 0x02, 0x00, 0x00, 0xe4, 0x03, 0x11, 0xf0, 0x95, 0x05, 0x00, 0x99, 0x01, 0x80, 0xef, 0xf0, 0xe5, 0xe5, 0xf1, 0xe5,
+  0xf2, 0xe5, 0xab, 0x05, 0x20, 0xf2, 0xf3, 0x05, 0x00, 0x50, 0xe5, 0xf2, 0xf1, 0xe4, 0xf0, 0x70, 0x00, 0x00, 0x07, 0x08, 0x01, 0x26, 0x06, 0x00,
+  0xc0, 0x03, 0x10, 0xdf, 0x7e, 0x05, 0x01, 0xb9, 0x01, 0x11, 0xd3, 0x9e, 0x03, 0x00, 0xe0, 0x01, 0x00, 0xf2, 0x01, 0x00, 0xfc, 0x00, 0x00, 0x01,
+  0x00, 0x01, 0xbb, 0x00, 0x00, 0x11, 0x00, 0x10, 0xd6, 0x04, 0x00, 0x30, 0xd3, 0xd6, 0xd9, 0x5b, 0x09, 0x01, 0x01, 0x00, 0x01, 0xdd, 0x01, 0x00,
+  0x08, 0x00, 0x00, 0xa8, 0x01, 0x30, 0xd1, 0xd0, 0xd3, 0x17, 0x05, 0x10, 0xca, 0x14, 0x00, 0x90, 0xc9, 0xd0, 0xcc, 0xd6, 0xf2, 0xf6, 0xe9, 0xf7,
+  0xf7, 0xdf, 0x01, 0x21, 0xf7, 0xe9, 0x7b, 0x02, 0x20, 0xdc, 0xd0, 0xb7, 0x01, 0x00, 0xc6, 0x01, 0x00, 0x94, 0x05, 0x00, 0xc4, 0x01, 0x11, 0xca,
+  0xc0, 0x03, 0x00, 0x5b, 0x05, 0x11, 0xc4, 0x13, 0x00, 0x00, 0x5c, 0x09, 0x10, 0xc6, 0x1b, 0x00, 0x81, 0xc4, 0xca, 0xca, 0xc4, 0xbe, 0xc4, 0xc9,
+  0xe4, 0x80, 0x07, 0x50, 0xf2, 0xe2, 0xc1, 0xc4, 0xbe, 0x8b, 0x05, 0xf0, 0x02, 0xcf, 0xe6, 0xf2, 0xfa, 0xf2, 0xfc, 0xf2, 0xe4, 0xda, 0xba, 0xb9,
+  0xbb, 0xbb, 0xb8, 0xb9, 0xbb, 0xbe, 0xe2, 0x01, 0x71, 0xbc, 0xc3, 0xbe, 0xc3, 0xbe, 0xbe, 0xc1, 0x5a, 0x00, 0x01, 0x3e, 0x02, 0x01, 0x81, 0x00,
+  0x01, 0x74, 0x09, 0x00, 0xe9, 0x01, 0x01, 0x01, 0x00, 0x40, 0xcc, 0xcc, 0xd6, 0xed, 0xc0, 0x03, 0x02, 0x01, 0x00, 0x50, 0xf7, 0xf4, 0xf3, 0xfa,
+  0xef, 0xf1, 0x00, 0x00, 0xa2, 0x04, 0x00, 0xe9, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x00, 0xef, 0x00, 0x00, 0xb7, 0x01,
+  0x00, 0xaf, 0x03, 0x00, 0xdf, 0x01, 0x00, 0xb8, 0x01, 0x00, 0x0c, 0x00, 0x00, 0xce, 0x03, 0x01, 0x0e, 0x00, 0x00, 0x59, 0x01, 0x02, 0x97, 0x05,
+  0x10, 0xe1, 0x05, 0x00, 0x10, 0xdf, 0x97, 0x07, 0x00, 0x07, 0x00, 0x41, 0xdc, 0xe1, 0xdf, 0xdf, 0x76, 0x01, 0x51, 0xdc, 0xdc, 0xeb, 0xef, 0xfa,
+  0x3b, 0x03, 0x20, 0xfb, 0xf3, 0xda, 0x01, 0x00, 0xb0, 0x01, 0x10, 0xe1, 0x09, 0x00, 0x30, 0xef, 0xef, 0xef, 0x84, 0x01, 0x00, 0x8c, 0x01, 0x06,
+  0x60, 0x09, 0x20, 0xf7, 0xf6, 0xbe, 0x03, 0x00, 0xe0, 0x01, 0x00, 0x85, 0x09, 0x00, 0xc0, 0x03, 0x33, 0xee, 0xef, 0xee, 0xc6, 0x03, 0x00, 0xcd,
+  0x05, 0x03, 0x02, 0x00, 0x04, 0x84, 0x07, 0x40, 0xf3, 0xf3, 0xf2, 0xef, 0x9e, 0x00, 0x00, 0x49, 0x02, 0xb2, 0xdc, 0xdc, 0xe1, 0xef, 0xf1, 0xe5,
+  0xe5, 0xf2, 0xe7, 0xf2, 0xe7, 0xdd, 0x01, 0x30, 0xf0, 0xef, 0xef, 0x77, 0x02, 0x02, 0x6e, 0x02, 0x30, 0xdc, 0xed, 0xf1, 0xa0, 0x05, 0x51, 0xfb,
+  0xf3, 0xfa, 0xe5, 0xed, 0x9e, 0x04, 0x10, 0xd3, 0xe3, 0x01, 0x00, 0xe6, 0x00, 0x02, 0xeb, 0x00, 0x01, 0x89, 0x05, 0x01, 0xf0, 0x00, 0x00, 0xf3,
+  0x00, 0x10, 0xdf, 0xe5, 0x02, 0x01, 0x01, 0x01, 0x01, 0xe8, 0x03, 0x00, 0x18, 0x03, 0x01, 0x57, 0x09, 0x00, 0xca, 0x01, 0x01, 0x06, 0x00, 0x00,
+  0x89, 0x07, 0x04, 0x01, 0x00, 0x00, 0x40, 0x0b, 0x50, 0xc9, 0xd0, 0xd7, 0xe7, 0xfb, 0xdf, 0x01, 0x00, 0x01, 0x00, 0x10, 0xf7, 0xea, 0x0b, 0x30,
+  0xe5, 0xdf, 0xc9, 0xa1, 0x05, 0x01, 0xdf, 0x01, 0x00, 0xdc, 0x01, 0x00, 0x4d, 0x05, 0x00, 0x1b, 0x02, 0x00, 0x21, 0x02, 0x11, 0xc9, 0xdc, 0x01,
+  0x00, 0x0f, 0x00, 0x32, 0xca, 0xc9, 0xc6, 0x04, 0x00, 0x30, 0xca, 0xc6, 0xc4, 0x70, 0x07, 0x00, 0xc0, 0x03, 0x90, 0xe3, 0xc9, 0xc4, 0xbe, 0xc3,
+  0xc4, 0xbe, 0xc1, 0xd3, 0xa0, 0x05, 0x40, 0xf2, 0xfc, 0xe5, 0xdd, 0xa0, 0x05, 0x11, 0xbb, 0x01, 0x00, 0x80, 0xb9, 0xb9, 0xbb, 0xc3, 0xbe, 0xbe,
+  0xbe, 0xc3, 0x65, 0x09, 0x00, 0xfd, 0x03, 0x10, 0xc6, 0xa2, 0x09, 0x00, 0x33, 0x02, 0x10, 0xca, 0xd2, 0x03, 0x00, 0x8d, 0x00, 0x81, 0xd3, 0xd3,
+  0xd0, 0xd9, 0xd3, 0xd3, 0xd6, 0xef, 0x60, 0x09, 0x01, 0x01, 0x00, 0x50, 0xf7, 0xfb, 0xf3, 0xf2, 0xef, 0x8c, 0x06, 0x01, 0xd1, 0x00, 0x00, 0xf6,
+  0x00, 0x01, 0x1f, 0x0c, 0x10, 0xd9, 0x7e, 0x07, 0x00, 0xed, 0x00, 0x02, 0x4a, 0x07, 0x12, 0xdf, 0xa1, 0x05, 0x01, 0x11, 0x00, 0x00, 0xba, 0x01,
+  0x00, 0x01, 0x00, 0x03, 0x07, 0x00, 0x02, 0xf2, 0x02, 0x01, 0xa6, 0x05, 0x00, 0x22, 0x00, 0x01, 0x0c, 0x00, 0x02, 0xc4, 0x05, 0x02, 0x01, 0x00,
+  0x30, 0xed, 0xef, 0xfa, 0xde, 0x01, 0x31, 0xfb, 0xf4, 0xfa, 0xb5, 0x03, 0x00, 0x76, 0x01, 0x00, 0xdd, 0x01, 0x32, 0xee, 0xef, 0xef, 0xc4, 0x01,
+  0x27, 0xf0, 0xf1, 0xa1, 0x05, 0x01, 0xc0, 0x03, 0x20, 0xf5, 0xfb, 0xba, 0x01, 0x03, 0x01, 0x00, 0x22, 0xf1, 0xf2, 0x3e, 0x09, 0x21, 0xf2, 0xf2,
+  0xb9, 0x03, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x84, 0x07, 0x00, 0x66, 0x00, 0x00, 0x89, 0x01, 0x01, 0xe2, 0x01, 0x52,
+  0xed, 0xed, 0xee, 0xef, 0xef, 0x0f, 0x02, 0x32, 0xef, 0xee, 0xe1, 0x67, 0x04, 0x02, 0x04, 0x00, 0x30, 0xed, 0xed, 0xe5, 0xd9, 0x07, 0x10, 0xf5,
+  0x80, 0x07, 0x00, 0xd3, 0x01, 0x00, 0xe9, 0x00, 0x00, 0xf2, 0x00, 0x00, 0xeb, 0x01, 0x00, 0xec, 0x00, 0x01, 0xf6, 0x00, 0x00, 0xf0, 0x00, 0x10,
+  0xdf, 0x05, 0x00, 0x01, 0x55, 0x00, 0x01, 0x57, 0x00, 0x60, 0xd9, 0xd9, 0xd3, 0xd9, 0xd3, 0xd3, 0x81, 0x07, 0x00, 0x8f, 0x01, 0x01, 0x79, 0x07,
+  0x00, 0xce, 0x01, 0x00, 0x9a, 0x01, 0x05, 0x31, 0x03, 0x01, 0x26, 0x05, 0x20, 0xd7, 0xe7, 0x80, 0x07, 0x00, 0x50, 0x01, 0x10, 0xf7, 0x32, 0x03,
+  0x30, 0xf2, 0xf2, 0xdf, 0x18, 0x00, 0x00, 0x86, 0x01, 0x10, 0xca, 0xad, 0x03, 0x01, 0x33, 0x07, 0x00, 0xd1, 0x05, 0x21, 0xca, 0xcc, 0x31, 0x00,
+  0x01, 0xe1, 0x01, 0x10, 0xd1, 0x0b, 0x00, 0x01, 0x95, 0x01, 0x50, 0xd3, 0xd0, 0xca, 0xc9, 0xda, 0xc0, 0x03, 0xc1, 0xf2, 0xfa, 0xe5, 0xe4, 0xc8,
+  0xc4, 0xbe, 0xbe, 0xc6, 0xc3, 0xc1, 0xd3, 0xdf, 0x01, 0x44, 0xf2, 0xe4, 0xd9, 0xba, 0x9f, 0x05, 0x00, 0x01, 0x00, 0x00, 0x9e, 0x05, 0x00, 0xd6,
+  0x01, 0x00, 0xde, 0x01, 0x11, 0xc6, 0x29, 0x02, 0x30, 0xd0, 0xd0, 0xd0, 0xe4, 0x09, 0x00, 0x91, 0x00, 0x00, 0x01, 0x00, 0x10, 0xd3, 0x2d, 0x0d,
+  0x23, 0xef, 0xf4, 0x7e, 0x07, 0x00, 0x6e, 0x02, 0x30, 0xf4, 0xf3, 0xee, 0x46, 0x0a, 0x01, 0x31, 0x0a, 0x00, 0x91, 0x04, 0x00, 0x02, 0x00, 0x00,
+  0xf4, 0x00, 0x00, 0x01, 0x00, 0x50, 0xd9, 0xdc, 0xda, 0xdc, 0xdf, 0xdd, 0x01, 0x00, 0xf3, 0x00, 0x00, 0xf9, 0x00, 0x01, 0xc9, 0x03, 0x00, 0x04,
+  0x01, 0x01, 0x07, 0x00, 0x00, 0x02, 0x00, 0x00, 0xfd, 0x01, 0x00, 0xd6, 0x01, 0x00, 0x2b, 0x03, 0x02, 0x31, 0x03, 0x02, 0x02, 0x00, 0x02, 0x22,
+  0x00, 0x01, 0xe0, 0x01, 0x00, 0x13, 0x0b, 0x60, 0xfb, 0xfb, 0xf3, 0xef, 0xef, 0xe1, 0xe3, 0x01, 0x01, 0xc1, 0x03, 0x40, 0xee, 0xe1, 0xef, 0xf0,
+  0xbe, 0x01, 0x00, 0xe2, 0x01, 0x10, 0xf3, 0x88, 0x00, 0x02, 0x01, 0x00, 0x10, 0xf7, 0xc0, 0x01, 0x00, 0x83, 0x07, 0x00, 0xec, 0x0e, 0x00, 0xe6,
+  0x01, 0x00, 0xd3, 0x02, 0x03, 0x68, 0x09, 0x00, 0x03, 0x00, 0x00, 0x14, 0x00, 0x00, 0xa8, 0x05, 0x02, 0x55, 0x0b, 0x30, 0xf3, 0xf1, 0xf0, 0x7e,
+  0x07, 0x00, 0x86, 0x00, 0x00, 0xe2, 0x01, 0x00, 0x01, 0x00, 0x01, 0x7b, 0x00, 0x04, 0x02, 0x00, 0x00, 0x7b, 0x02, 0x10, 0xe1, 0x7f, 0x02, 0x30,
+  0xdf, 0xdf, 0xee, 0x20, 0x0d, 0x10, 0xf6, 0xa0, 0x05, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x00, 0x00, 0xe3, 0x01, 0x00, 0xd9, 0x01,
+  0x00, 0xc8, 0x01, 0x02, 0xe0, 0x01, 0x02, 0x01, 0x00, 0x00, 0xe5, 0x00, 0x01, 0xa4, 0x05, 0x00, 0x9d, 0x05, 0x21, 0xcf, 0xd3, 0xca, 0x01, 0x01,
+  0x40, 0x01, 0x00, 0x20, 0x09, 0x01, 0x96, 0x01, 0x00, 0xad, 0x01, 0x00, 0x16, 0x00, 0x00, 0xea, 0x01, 0x00, 0x1d, 0x05, 0x01, 0x80, 0x07, 0x00,
+  0x03, 0x00, 0x11, 0xe9, 0xe0, 0x01, 0x32, 0xf3, 0xe5, 0xdf, 0x6a, 0x07, 0x02, 0xc1, 0x03, 0x01, 0x70, 0x03, 0x01, 0x2c, 0x00, 0x30, 0xca, 0xc9,
+  0xce, 0xe0, 0x01, 0x10, 0xbe, 0x96, 0x09, 0x00, 0xef, 0x01, 0x20, 0xca, 0xc6, 0x74, 0x03, 0x61, 0xd3, 0xd1, 0xd0, 0xca, 0xd6, 0xe5, 0xa0, 0x05,
+  0x30, 0xe7, 0xe4, 0xc9, 0x16, 0x02, 0x21, 0xc4, 0xc4, 0x60, 0x09, 0x52, 0xf2, 0xf2, 0xe5, 0xdb, 0xbc, 0xda, 0x01, 0x20, 0xbb, 0xbe, 0x02, 0x00,
+  0x12, 0xbe, 0x6c, 0x0d, 0x01, 0x01, 0x00, 0x00, 0xdc, 0x05, 0x31, 0xc6, 0xca, 0xca, 0x95, 0x00, 0x00, 0x7a, 0x02, 0x30, 0xd0, 0xd0, 0xcc, 0xdf,
+  0x01, 0x46, 0xd0, 0xd3, 0xd6, 0xe1, 0xc0, 0x03, 0x50, 0xf6, 0xf4, 0xf3, 0xf3, 0xe1, 0xcf, 0x01, 0x00, 0xcd, 0x02, 0x01, 0x8e, 0x04, 0x20, 0xd6,
+  0xd3, 0xed, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf4, 0x01, 0x00, 0xea, 0x00, 0x00, 0xc2, 0x01, 0x02, 0x01, 0x00, 0x00, 0xa2, 0x03, 0x01, 0x01, 0x00,
+  0x00, 0x21, 0x01, 0x02, 0x05, 0x00, 0x01, 0x01, 0x00, 0x00, 0x7d, 0x09, 0x00, 0xdd, 0x01, 0x01, 0xdf, 0x01, 0x00, 0x53, 0x01, 0x00, 0x15, 0x00,
+  0x02, 0x01, 0x00, 0x20, 0xdf, 0xee, 0x60, 0x09, 0x50, 0xfb, 0xfb, 0xfb, 0xf2, 0xf0, 0x5f, 0x09, 0x10, 0xe1, 0x46, 0x0d, 0x02, 0x66, 0x09, 0x01,
+  0x1c, 0x0b, 0x36, 0xf2, 0xf2, 0xf1, 0x2d, 0x06, 0x00, 0xee, 0x09, 0x40, 0xf4, 0xf4, 0xf4, 0xf5, 0xc6, 0x01, 0x00, 0xc0, 0x01, 0x02, 0x03, 0x00,
+  0x01, 0x04, 0x00, 0x04, 0xd1, 0x03, 0x20, 0xf3, 0xf2, 0x0d, 0x00, 0x01, 0x15, 0x00, 0x20, 0xf4, 0xf3, 0x43, 0x0b, 0x00, 0x91, 0x00, 0x00, 0x8b,
+  0x00, 0x00, 0x85, 0x00, 0x20, 0xed, 0xdf, 0xd7, 0x01, 0x00, 0x8f, 0x02, 0x00, 0x49, 0x06, 0x01, 0x08, 0x00, 0x01, 0xde, 0x01, 0x80, 0xdc, 0xed,
+  0xed, 0xe5, 0xf4, 0xf5, 0xfb, 0xf5, 0xe0, 0x01, 0x20, 0xef, 0xdf, 0x2a, 0x00, 0x00, 0x35, 0x00, 0x00, 0xc1, 0x01, 0x03, 0xe6, 0x00, 0x02, 0xd0,
+  0x03, 0x01, 0x19, 0x00, 0x20, 0xda, 0xda, 0x06, 0x00, 0x00, 0x08, 0x00, 0x01, 0xde, 0x01, 0x02, 0xc5, 0x01, 0x02, 0x01, 0x00, 0x01, 0x92, 0x01,
+  0x00, 0x08, 0x00, 0x03, 0x02, 0x00, 0x00, 0xf5, 0x01, 0x00, 0x1e, 0x05, 0x60, 0xca, 0xd0, 0xd0, 0xda, 0xf2, 0xf6, 0x5e, 0x09, 0x00, 0xbf, 0x03,
+  0x10, 0xf7, 0xd8, 0x00, 0x21, 0xe5, 0xda, 0xa7, 0x01, 0x00, 0xd8, 0x01, 0x01, 0x85, 0x01, 0x00, 0x8c, 0x01, 0x20, 0xd1, 0xc9, 0xd0, 0x01, 0x00,
+  0x30, 0x0f, 0x00, 0x3d, 0x07, 0x01, 0x17, 0x00, 0x00, 0x01, 0x02, 0x00, 0x5a, 0x00, 0x70, 0xc9, 0xc6, 0xc4, 0xcf, 0xe4, 0xf2, 0xf3, 0xc0, 0x03,
+  0xa0, 0xe3, 0xc5, 0xc1, 0xc7, 0xc6, 0xcb, 0xc3, 0xc4, 0xd6, 0xe6, 0xe0, 0x01, 0x42, 0xfc, 0xe5, 0xdd, 0xba, 0x3d, 0x0b, 0x80, 0xbe, 0xbb, 0xbe,
+  0xbf, 0xbb, 0xbb, 0xbb, 0xc3, 0x56, 0x00, 0x00, 0x50, 0x00, 0x00, 0x07, 0x00, 0x10, 0xc6, 0xf0, 0x10, 0x01, 0x89, 0x00, 0x00, 0x44, 0x00, 0x20,
+  0xd0, 0xd3, 0xdf, 0x01, 0x54, 0xd3, 0xd3, 0xcf, 0xd9, 0xef, 0x6d, 0x11, 0x01, 0x6e, 0x02, 0x31, 0xf2, 0xef, 0xd7, 0xbb, 0x03, 0x00, 0x8c, 0x04,
+  0x00, 0xd3, 0x00, 0x01, 0x8d, 0x06, 0x00, 0xba, 0x04, 0x00, 0xd4, 0x02, 0x00, 0xc4, 0x01, 0x00, 0x3d, 0x01, 0x00, 0x45, 0x01, 0x01, 0xa7, 0x05,
+  0x00, 0x01, 0x01, 0x02, 0x0e, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x58, 0x01, 0x00, 0x79, 0x07, 0x00, 0x02, 0x00, 0x00, 0x56, 0x01,
+  0x00, 0x84, 0x07, 0x03, 0xf1, 0x03, 0x32, 0xdc, 0xdf, 0xe1, 0x40, 0x0b, 0x00, 0x5b, 0x10, 0x30, 0xf0, 0xef, 0xe1, 0xec, 0x08, 0x50, 0xe1, 0xe1,
+  0xe1, 0xed, 0xe1, 0x0b, 0x00, 0x03, 0xa5, 0x01, 0x07, 0x80, 0x07, 0x20, 0xe9, 0xf7, 0x84, 0x01, 0x00, 0xa6, 0x0e, 0x20, 0xf1, 0xf1, 0x97, 0x05,
+  0x01, 0xa5, 0x03, 0x11, 0xf3, 0x06, 0x02, 0x01, 0x50, 0x0b, 0x00, 0x13, 0x0b, 0x11, 0xf1, 0x42, 0x09, 0x20, 0xf3, 0xf2, 0xce, 0x03, 0x01, 0xd2,
+  0x10, 0x10, 0xe1, 0x75, 0x02, 0x00, 0xb5, 0x01, 0x63, 0xed, 0xdf, 0xe1, 0xdf, 0xe1, 0xdf, 0x01, 0x00, 0x00, 0x4e, 0x04, 0x22, 0xdf, 0xdc, 0x8a,
+  0x00, 0x00, 0x64, 0x06, 0x40, 0xf1, 0xf5, 0xfb, 0xf6, 0x5d, 0x00, 0x20, 0xf2, 0xef, 0xa4, 0x00, 0x00, 0x9b, 0x00, 0x20, 0xda, 0xdc, 0x93, 0x06,
+  0x01, 0xdd, 0x01, 0x00, 0xe8, 0x01, 0x01, 0xd1, 0x00, 0x01, 0x01, 0x00, 0x00, 0xd3, 0x00, 0x20, 0xda, 0xda, 0x0a, 0x01, 0x00, 0xba, 0x03, 0x00,
+  0xb8, 0x12, 0x10, 0xd3, 0x3e, 0x01, 0x01, 0xc1, 0x03, 0x01, 0xc3, 0x03, 0x03, 0xe3, 0x01, 0x10, 0xd0, 0xa6, 0x0c, 0x11, 0xd0, 0xdf, 0x01, 0x41,
+  0xd3, 0xdc, 0xe7, 0xf6, 0xbe, 0x03, 0x00, 0xc3, 0x00, 0x01, 0xa7, 0x01, 0x13, 0xda, 0xdb, 0x01, 0x02, 0x8d, 0x01, 0x30, 0xca, 0xca, 0xce, 0x0b,
+  0x00, 0x00, 0x93, 0x01, 0x00, 0xf7, 0x01, 0x10, 0xc3, 0x17, 0x00, 0x00, 0x09, 0x00, 0x40, 0xc1, 0xc3, 0xc4, 0xc6, 0x4b, 0x00, 0x21, 0xca, 0xbe,
+  0x50, 0x09, 0x00, 0x60, 0x09, 0x72, 0xe3, 0xcc, 0xc6, 0xc6, 0xbe, 0xbb, 0xbc, 0x20, 0x0d, 0x40, 0xf2, 0xf2, 0xe5, 0xd3, 0x9f, 0x05, 0x33, 0xb9,
+  0xb9, 0xb8, 0xa1, 0x05, 0x10, 0xbf, 0x0c, 0x11, 0x10, 0xce, 0x59, 0x00, 0x00, 0x44, 0x00, 0x01, 0x7d, 0x00, 0x00, 0x01, 0x00, 0x00, 0xe4, 0x05,
+  0x11, 0xd3, 0xbd, 0x03, 0x00, 0x06, 0x00, 0x06, 0xe0, 0x01, 0x04, 0xc0, 0x03, 0x00, 0xd2, 0x01, 0x12, 0xcf, 0xbd, 0x03, 0x20, 0xd9, 0xd6, 0x23,
+  0x00, 0x00, 0x2d, 0x0f, 0x00, 0xc7, 0x03, 0x11, 0xdc, 0x02, 0x01, 0x01, 0xe6, 0x01, 0x10, 0xd9, 0xc7, 0x03, 0x01, 0x1b, 0x01, 0x03, 0x22, 0x01,
+  0x00, 0x0a, 0x01, 0x00, 0x01, 0x00, 0x10, 0xdf, 0xc7, 0x01, 0x10, 0xe1, 0x53, 0x01, 0x02, 0x02, 0x00, 0x10, 0xe1, 0xae, 0x07, 0x00, 0x37, 0x03,
+  0x00, 0x31, 0x05, 0x40, 0xe1, 0xf0, 0xf3, 0xf5, 0x41, 0x0b, 0x63, 0xfb, 0xfa, 0xe4, 0xee, 0xef, 0xe1, 0x61, 0x09, 0x50, 0xe1, 0xee, 0xe1, 0xf0,
+  0xef, 0xdc, 0x10, 0x38, 0xf3, 0xf4, 0xf4, 0x40, 0x0b, 0x11, 0xf7, 0x81, 0x07, 0x00, 0x99, 0x03, 0x00, 0x99, 0x07, 0x00, 0xc5, 0x12, 0x21, 0xf2,
+  0xfc, 0xd9, 0x01, 0x10, 0xee, 0x0b, 0x0d, 0x00, 0xdc, 0x05, 0x00, 0xe2, 0x05, 0x00, 0x65, 0x07, 0x40, 0xf1, 0xe5, 0xfc, 0xf2, 0x82, 0x07, 0x61,
+  0xf2, 0xe5, 0xf0, 0xe1, 0xed, 0xe1, 0x33, 0x04, 0x00, 0xe1, 0x01, 0x01, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0xeb, 0x01, 0x11, 0xed, 0xee, 0x01,
+  0x01, 0xac, 0x00, 0x01, 0xc0, 0x12, 0x61, 0xf5, 0xf4, 0xf5, 0xf3, 0xf2, 0xef, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0xb4, 0x04, 0x00, 0xde, 0x00,
+  0x00, 0xdf, 0x01, 0x01, 0xe3, 0x00, 0x02, 0xd0, 0x00, 0x00, 0xec, 0x00, 0x01, 0x9a, 0x05, 0x00, 0xd7, 0x01, 0x40, 0xd0, 0xd0, 0xd0, 0xd1, 0x05,
+  0x00, 0x03, 0x0c, 0x00, 0x01, 0x01, 0x00, 0x03, 0xe9, 0x01, 0x03, 0xe6, 0x01, 0x01, 0x1b, 0x05, 0x40, 0xcc, 0xd9, 0xf3, 0xf6, 0x9c, 0x05, 0x01,
+  0xc0, 0x03, 0x02, 0x80, 0x07, 0x01, 0xba, 0x10, 0x00, 0x01, 0x00, 0x02, 0xd7, 0x01, 0x00, 0x0e, 0x00, 0x00, 0xed, 0x0e, 0x01, 0x01, 0x00, 0x91,
+  0xc3, 0xbe, 0xc6, 0xc6, 0xcb, 0xc4, 0xc3, 0xc4, 0xc7, 0xdb, 0x12, 0x81, 0xcb, 0xc6, 0xca, 0xc3, 0xc4, 0xc4, 0xd3, 0xe5, 0x8e, 0x06, 0xb0, 0xe7,
+  0xe3, 0xd0, 0xc4, 0xc3, 0xc3, 0xbe, 0xbf, 0xbe, 0xd3, 0xe4, 0x0f, 0x00, 0x30, 0xf2, 0xe4, 0xd9, 0xbf, 0x03, 0x22, 0xb9, 0xb7, 0xde, 0x01, 0x00,
+  0xe3, 0x10, 0x00, 0x41, 0x00, 0x04, 0x3a, 0x02, 0x41, 0xd0, 0xca, 0xd0, 0xd1, 0x90, 0x00, 0x01, 0xd7, 0x01, 0x03, 0x2c, 0x08, 0x30, 0xd6, 0xd9,
+  0xef, 0x0d, 0x08, 0x02, 0x57, 0x01, 0x11, 0xf6, 0xc0, 0x03, 0x01, 0xe0, 0x01, 0x00, 0xd5, 0x01, 0x10, 0xd3, 0xa8, 0x05, 0x01, 0x09, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x03, 0x00, 0x00, 0xff, 0x00, 0x04, 0xe2, 0x02, 0x02, 0x1e, 0x01, 0x02, 0x06, 0x00, 0x00, 0xda, 0x01, 0x00,
+  0x42, 0x01, 0x02, 0x4e, 0x01, 0x01, 0x04, 0x00, 0x61, 0xed, 0xdf, 0xe1, 0xe1, 0xe1, 0xdf, 0x69, 0x01, 0x01, 0x1f, 0x00, 0x33, 0xdc, 0xed, 0xef,
+  0xe0, 0x10, 0x30, 0xf3, 0xf0, 0xe1, 0xb7, 0x03, 0x00, 0xa5, 0x05, 0x02, 0x01, 0x00, 0x00, 0xbd, 0x03, 0x00, 0x6e, 0x07, 0x00, 0x87, 0x00, 0x03,
+  0x01, 0x00, 0x01, 0x63, 0x03, 0x00, 0x40, 0x0b, 0x15, 0xf2, 0x7b, 0x14, 0x00, 0x62, 0x09, 0x00, 0x8a, 0x09, 0x00, 0xe6, 0x01, 0x10, 0xef, 0xef,
+  0x0c, 0x02, 0x02, 0x00, 0x30, 0xf0, 0xf1, 0xf1, 0x24, 0x00, 0x20, 0xf1, 0xe5, 0x4b, 0x09, 0x00, 0x6e, 0x00, 0x00, 0x02, 0x00, 0x03, 0x08, 0x00,
+  0x20, 0xe1, 0xdf, 0x23, 0x04, 0x01, 0xde, 0x01, 0x01, 0x83, 0x00, 0x00, 0x55, 0x04, 0x12, 0xe5, 0xc0, 0x03, 0x00, 0xe0, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0xed, 0x0e, 0x01, 0xc7, 0x01, 0x00, 0xe3, 0x00, 0x00, 0xd2, 0x01, 0x00, 0x10, 0x00, 0x00, 0x16, 0x00, 0x00, 0x17, 0x00, 0x00, 0x18, 0x00,
+  0x10, 0xd6, 0xba, 0x03, 0x00, 0x03, 0x00, 0x01, 0xc3, 0x03, 0x00, 0x08, 0x00, 0x0c, 0x05, 0x00, 0x00, 0xb0, 0x05, 0x00, 0x8d, 0x07, 0x01, 0x07,
+  0x00, 0x10, 0xd9, 0x60, 0x09, 0x01, 0x52, 0x01, 0x01, 0xe0, 0x01, 0x30, 0xf3, 0xf2, 0xdf, 0x5d, 0x16, 0x00, 0xa7, 0x0e, 0x01, 0x84, 0x05, 0x02,
+  0xcc, 0x03, 0x00, 0xeb, 0x01, 0x11, 0xc6, 0xd4, 0x01, 0x33, 0xbe, 0xc4, 0xc6, 0xdd, 0x01, 0xa0, 0xc7, 0xc6, 0xc6, 0xbe, 0xc7, 0xc4, 0xc3, 0xbb,
+  0xc4, 0xd0, 0xa0, 0x05, 0x70, 0xf3, 0xfa, 0xe5, 0xe2, 0xc4, 0xc4, 0xbe, 0x0c, 0x0d, 0x11, 0xcc, 0xf0, 0x01, 0x40, 0xfc, 0xe4, 0xdd, 0xb9, 0xbf,
+  0x12, 0x20, 0xb8, 0xbe, 0xdd, 0x01, 0x00, 0xe0, 0x01, 0x30, 0xbf, 0xc6, 0xc7, 0x4f, 0x00, 0x56, 0xc6, 0xc3, 0xc4, 0xc6, 0xd1, 0xbe, 0x03, 0x50,
+  0xd6, 0xd0, 0xd9, 0xdd, 0xd9, 0xff, 0x0e, 0x00, 0xc8, 0x03, 0x30, 0xd6, 0xef, 0xf6, 0x68, 0x02, 0x00, 0x8e, 0x00, 0x00, 0xd2, 0x08, 0x20, 0xf3,
+  0xef, 0xd1, 0x00, 0x00, 0xd4, 0x00, 0x00, 0xec, 0x00, 0x01, 0xde, 0x00, 0x09, 0x01, 0x00, 0x01, 0xf9, 0x00, 0x02, 0xe0, 0x01, 0x01, 0x6e, 0x09,
+  0x02, 0x01, 0x00, 0x02, 0x0a, 0x00, 0x11, 0xe1, 0x0a, 0x05, 0x00, 0x08, 0x00, 0x00, 0xd9, 0x01, 0x01, 0x63, 0x01, 0x00, 0xe0, 0x01, 0x02, 0x5c,
+  0x01, 0x00, 0xd1, 0x05, 0x20, 0xdc, 0xdf, 0x00, 0x0f, 0x02, 0xa0, 0x05, 0x22, 0xe1, 0xe1, 0x1b, 0x0d, 0x01, 0xe5, 0x01, 0x20, 0xee, 0xef, 0x15,
+  0x00, 0x28, 0xfb, 0xf6, 0xbf, 0x03, 0x10, 0xe9, 0x84, 0x01, 0x01, 0xe3, 0x01, 0x02, 0xdc, 0x03, 0x00, 0x49, 0x09, 0x01, 0x06, 0x00, 0x05, 0xa5,
+  0x05, 0x00, 0xfa, 0x0c, 0x30, 0xf2, 0xe5, 0xf1, 0xea, 0x0e, 0x00, 0x01, 0x00, 0x20, 0xfc, 0xe5, 0xa2, 0x09, 0x20, 0xef, 0xf0, 0x33, 0x02, 0x00,
+  0x15, 0x04, 0x00, 0xe1, 0x07, 0x00, 0x1b, 0x13, 0x00, 0x08, 0x00, 0x01, 0x8f, 0x00, 0x00, 0x9c, 0x00, 0x00, 0xcf, 0x0b, 0x20, 0xe1, 0xf2, 0x80,
+  0x07, 0x00, 0x80, 0x16, 0x03, 0xc0, 0x03, 0x01, 0xd2, 0x00, 0x04, 0xdc, 0x00, 0x02, 0x11, 0x00, 0x01, 0x01, 0x00, 0x00, 0x11, 0x00, 0x02, 0x36,
+  0x0b, 0x01, 0xc6, 0x01, 0x01, 0xbd, 0x03, 0x00, 0x09, 0x00, 0x03, 0x0c, 0x00, 0x01, 0x21, 0x03, 0x00, 0x0b, 0x05, 0x00, 0x11, 0x00, 0x00, 0xe3,
+  0x01, 0x02, 0x03, 0x00, 0x30, 0xcc, 0xd6, 0xe7, 0x52, 0x01, 0x00, 0xcb, 0x00, 0x02, 0xe0, 0x01, 0x20, 0xe5, 0xe1, 0x98, 0x07, 0x00, 0x26, 0x0b,
+  0x00, 0x6e, 0x03, 0x01, 0x6d, 0x03, 0x01, 0xf7, 0x0a, 0x01, 0x8c, 0x14, 0x00, 0xda, 0x01, 0x50, 0xc7, 0xc6, 0xc3, 0xbe, 0xc7, 0xea, 0x01, 0x20,
+  0xc3, 0xc6, 0xb7, 0x10, 0x50, 0xc3, 0xbe, 0xc9, 0xe6, 0xe7, 0xb0, 0x03, 0xb1, 0xe7, 0xe0, 0xc1, 0xbb, 0xbe, 0xbb, 0xbf, 0xbe, 0xbe, 0xcc, 0xe4,
+  0x10, 0x00, 0x41, 0xe5, 0xd9, 0xb8, 0xb7, 0x9f, 0x05, 0x01, 0x01, 0x00, 0x30, 0xbf, 0xbe, 0xbf, 0xc1, 0x03, 0x21, 0xc3, 0xc3, 0xe3, 0x05, 0x00,
+  0xfe, 0x0e, 0x00, 0x81, 0x07, 0x00, 0x95, 0x00, 0x40, 0xd3, 0xd3, 0xd9, 0xdb, 0x79, 0x05, 0x61, 0xd3, 0xd0, 0xd3, 0xcf, 0xd9, 0xee, 0xe0, 0x01,
+  0x00, 0x8e, 0x00, 0x00, 0x00, 0x0f, 0x10, 0xf2, 0xe0, 0x01, 0x02, 0xed, 0x00, 0x01, 0xa7, 0x04, 0x02, 0x0e, 0x00, 0x02, 0x43, 0x19, 0x01, 0xe0,
+  0x01, 0x01, 0xf8, 0x00, 0x00, 0xfa, 0x00, 0x00, 0xd5, 0x01, 0x00, 0x1d, 0x03, 0x00, 0xde, 0x0e, 0x01, 0x02, 0x00, 0x00, 0x2c, 0x03, 0x00, 0xd8,
+  0x01, 0x00, 0xc0, 0x03, 0x00, 0x59, 0x07, 0x01, 0x01, 0x00, 0x00, 0x47, 0x03, 0x00, 0xbe, 0x03, 0x00, 0xc0, 0x03, 0x00, 0xa1, 0x05, 0x02, 0x80,
+  0x07, 0x11, 0xfb, 0x80, 0x07, 0x00, 0xc3, 0x03, 0x00, 0x87, 0x01, 0x50, 0xe1, 0xef, 0xef, 0xe1, 0xf4, 0x53, 0x03, 0x1a, 0xf7, 0xe0, 0x01, 0x22,
+  0xf7, 0xf6, 0xe3, 0x01, 0x02, 0xc8, 0x12, 0x01, 0x01, 0x00, 0x11, 0xf5, 0xe4, 0x01, 0x00, 0xf3, 0x01, 0x01, 0x57, 0x0b, 0x00, 0x02, 0x00, 0x02,
+  0x01, 0x00, 0x00, 0x0a, 0x00, 0x10, 0xfa, 0xe6, 0x01, 0x20, 0xfa, 0xe5, 0x45, 0x0d, 0x00, 0xdc, 0x10, 0x01, 0xfa, 0x01, 0x41, 0xf1, 0xe4, 0xf1,
+  0xe4, 0xee, 0x03, 0x00, 0xf5, 0x01, 0x12, 0xef, 0x73, 0x00, 0x40, 0xef, 0xf2, 0xf6, 0xfb, 0xa1, 0x05, 0x01, 0x32, 0x0f, 0x00, 0xbb, 0x00, 0x00,
+  0xd3, 0x00, 0x01, 0xb3, 0x02, 0x00, 0x84, 0x02, 0x03, 0x01, 0x00, 0x10, 0xda, 0x5f, 0x09, 0x00, 0x17, 0x00, 0x00, 0xea, 0x04, 0x10, 0xd6, 0xce,
+  0x01, 0x00, 0xc3, 0x01, 0x00, 0x01, 0x00, 0x01, 0xdb, 0x01, 0x00, 0x09, 0x00, 0x11, 0xd0, 0xa4, 0x08, 0x00, 0xb4, 0x14, 0x00, 0x4a, 0x01, 0x02,
+  0x13, 0x00, 0x00, 0x1d, 0x00, 0x21, 0xda, 0xe8, 0x46, 0x08, 0x00, 0xc4, 0x03, 0x01, 0xe0, 0x01, 0x21, 0xf2, 0xdf, 0x32, 0x0f, 0x00, 0xe1, 0x01,
+  0x00, 0xd5, 0x01, 0x02, 0xa3, 0x05, 0x01, 0xad, 0x05, 0x32, 0xc3, 0xc4, 0xc3, 0xa0, 0x05, 0x00, 0x87, 0x07, 0x20, 0xc3, 0xc6, 0x50, 0x07, 0x10,
+  0xc3, 0x19, 0x0b, 0x24, 0xd0, 0xe6, 0xc0, 0x03, 0x00, 0xab, 0x03, 0x41, 0xbe, 0xbb, 0xd0, 0xe4, 0xbe, 0x04, 0x70, 0xe4, 0xdb, 0xb9, 0xb9, 0xb9,
+  0xae, 0xbb, 0x84, 0x07, 0x01, 0xe1, 0x01, 0x21, 0xbb, 0xbf, 0x1b, 0x02, 0x00, 0x33, 0x02, 0x01, 0x51, 0x00, 0x02, 0xc3, 0x03, 0x00, 0x6b, 0x04,
+  0x00, 0x91, 0x00, 0x00, 0x06, 0x00, 0x02, 0x80, 0x07, 0x00, 0x2a, 0x06, 0x00, 0x92, 0x00, 0x10, 0xe9, 0x73, 0x08, 0x00, 0xd3, 0x01, 0x10, 0xd6,
+  0x0d, 0x0d, 0x02, 0xa8, 0x04, 0x00, 0x97, 0x06, 0x10, 0xda, 0x5c, 0x09, 0x01, 0xc5, 0x12, 0x00, 0x04, 0x01, 0x00, 0xf8, 0x00, 0x30, 0xd9, 0xda,
+  0xda, 0xcc, 0x01, 0x00, 0x12, 0x03, 0x00, 0x21, 0x01, 0x01, 0xde, 0x01, 0x01, 0xb8, 0x03, 0x00, 0xb2, 0x03, 0x00, 0xf4, 0x01, 0x00, 0xbb, 0x03,
+  0x01, 0x9d, 0x03, 0x13, 0xef, 0x01, 0x02, 0x01, 0x01, 0x00, 0x71, 0xe1, 0xef, 0xf3, 0xf6, 0xfb, 0xfb, 0xf6, 0xc0, 0x03, 0x02, 0x6d, 0x01, 0x01,
+  0x30, 0x00, 0x31, 0xef, 0xe1, 0xee, 0xdd, 0x01, 0x09, 0xdf, 0x01, 0x00, 0xc0, 0x03, 0x32, 0xf7, 0xf7, 0xf7, 0xd8, 0x03, 0x11, 0xfb, 0x72, 0x03,
+  0x20, 0xf5, 0xf6, 0x97, 0x01, 0x01, 0x0a, 0x00, 0x00, 0xed, 0x01, 0x01, 0x01, 0x00, 0x01, 0xef, 0x01, 0x00, 0xdf, 0x10, 0x00, 0x09, 0x00, 0x01,
+  0xea, 0x01, 0x00, 0x8b, 0x07, 0x00, 0x06, 0x00, 0x00, 0xfb, 0x01, 0x21, 0xfa, 0xe7, 0xf5, 0x01, 0x02, 0x01, 0x00, 0x05, 0xf5, 0x01, 0x10, 0xf3,
+  0x43, 0x00, 0x00, 0x21, 0x02, 0x10, 0xf1, 0xc1, 0x14, 0x00, 0xa3, 0x00, 0x10, 0xe1, 0x4e, 0x08, 0x01, 0xe5, 0x03, 0x10, 0xef, 0x05, 0x00, 0x00,
+  0xa7, 0x09, 0x02, 0xdc, 0x0f, 0x00, 0xd5, 0x02, 0x02, 0xb7, 0x12, 0x02, 0xc0, 0x01, 0x10, 0xd3, 0x63, 0x09, 0x01, 0x3a, 0x01, 0x01, 0x41, 0x01,
+  0x00, 0xdf, 0x01, 0x02, 0xe1, 0x01, 0x00, 0x12, 0x00, 0x00, 0xdd, 0x01, 0x41, 0xd3, 0xd0, 0xd6, 0xda, 0x80, 0x07, 0x10, 0xfb, 0x64, 0x09, 0x00,
+  0xe0, 0x01, 0x33, 0xf2, 0xe7, 0xe1, 0xfd, 0x01, 0x30, 0xd0, 0xca, 0xd1, 0x0c, 0x0d, 0x00, 0xe1, 0x01, 0x20, 0xca, 0xca, 0xae, 0x05, 0x00, 0x20,
+  0x09, 0x01, 0x01, 0x00, 0x40, 0xc7, 0xc6, 0xbe, 0xc3, 0xae, 0x05, 0x84, 0xbe, 0xc3, 0xc6, 0xc3, 0xc3, 0xbe, 0xbe, 0xc5, 0xc0, 0x03, 0x10, 0xc6,
+  0xe0, 0x01, 0x41, 0xbf, 0xbc, 0xd0, 0xe5, 0x10, 0x00, 0x40, 0xe4, 0xdb, 0xc0, 0xbb, 0xc1, 0x03, 0x12, 0xb9, 0xc3, 0x12, 0x30, 0xbb, 0xbf, 0xbe,
+  0xdf, 0x01, 0x50, 0xbf, 0xc3, 0xc7, 0xc6, 0xc7, 0xe0, 0x01, 0x00, 0x5b, 0x00, 0x00, 0x66, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x89, 0x00, 0x00, 0x94,
+  0x00, 0x02, 0xe0, 0x01, 0x02, 0x2e, 0x06, 0x00, 0x6e, 0x02, 0x30, 0xf2, 0xe1, 0xd7, 0xcc, 0x01, 0x02, 0xc0, 0x03, 0x01, 0xe4, 0x01, 0x40, 0xda,
+  0xdc, 0xda, 0xdd, 0xfd, 0x0e, 0x01, 0x72, 0x17, 0x03, 0xba, 0x04, 0x30, 0xda, 0xda, 0xda, 0xb4, 0x01, 0x00, 0x79, 0x05, 0x02, 0x07, 0x01, 0x00,
+  0xe2, 0x01, 0x01, 0xa5, 0x05, 0x30, 0xed, 0xdf, 0xef, 0xbd, 0x03, 0x00, 0xde, 0x01, 0x01, 0x38, 0x01, 0x00, 0xc6, 0x01, 0x11, 0xe1, 0x1a, 0x00,
+  0x01, 0x20, 0x00, 0x20, 0xef, 0xf3, 0x9d, 0x01, 0x01, 0xc0, 0x03, 0x00, 0x20, 0x00, 0xa0, 0xef, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xef,
+  0xe1, 0x96, 0xfb, 0xf7, 0xf7, 0xfb, 0xe9, 0xe9, 0xe9, 0xf7, 0xe9, 0x01, 0x00, 0xa0, 0xf7, 0xf7, 0xf7, 0xf7, 0xfb, 0xf7, 0xfb, 0xf7, 0xf6, 0xfb,
+  0x02, 0x00, 0x20, 0xfb, 0xfb, 0x07, 0x00, 0xc0, 0xf6, 0xf5, 0xfb, 0xf5, 0xfb, 0xf5, 0xf4, 0xfb, 0xf5, 0xf4, 0xf5, 0xfb, 0x06, 0x00, 0x00, 0x07,
+  0x00, 0x50, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0x01, 0x00, 0x01, 0x06, 0x00, 0x63, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0x06, 0x00, 0x00, 0x09, 0x00,
+  0x01, 0x01, 0x00, 0x10, 0xf2, 0x02, 0x00, 0x10, 0xfa, 0x06, 0x00, 0x00, 0x0c, 0x00, 0xf2, 0x15, 0xf4, 0xf5, 0xfb, 0xf6, 0xfb, 0xf5, 0xf4, 0xf3,
+  0xf3, 0xf2, 0xf2, 0xe5, 0xf2, 0xe5, 0xf2, 0xf1, 0xe5, 0xf2, 0xe5, 0xf1, 0xe4, 0xe5, 0xe5, 0xe5, 0xf1, 0xe4, 0xf1, 0xe5, 0xf0, 0xe5, 0xf0, 0xe4,
+  0xf0, 0xe4, 0xf0, 0xef, 0x01, 0x00, 0xf0, 0x10, 0xe1, 0xdf, 0xed, 0xdc, 0xdc, 0xda, 0xda, 0xd9, 0xd6, 0xd6, 0xcf, 0xd6, 0xd6, 0xd6, 0xd9, 0xd6,
+  0xd6, 0xd3, 0xcf, 0xd3, 0xd3, 0xd0, 0xd0, 0xd3, 0xd3, 0xcf, 0xd3, 0xd6, 0xd0, 0xd6, 0xd3, 0x02, 0x00, 0x31, 0xd9, 0xd3, 0xd9, 0x08, 0x00, 0xc1,
+  0xd3, 0xd3, 0xd0, 0xd1, 0xd3, 0xd1, 0xd3, 0xd0, 0xd3, 0xd6, 0xef, 0xe8, 0xc7, 0x00, 0xc0, 0xf7, 0xf7, 0xe9, 0xf7, 0xfb, 0xf4, 0xfa, 0xf3, 0xf3,
+  0xe7, 0xef, 0xd9, 0x35, 0x00, 0x10, 0xca, 0x02, 0x00, 0xf1, 0x06, 0xca, 0xd1, 0xd0, 0xca, 0xca, 0xca, 0xc6, 0xca, 0xca, 0xca, 0xd0, 0xca, 0xcb,
+  0xca, 0xc7, 0xc4, 0xc6, 0xc6, 0xcb, 0xc6, 0xc7, 0x02, 0x00, 0xf0, 0x2d, 0xc3, 0xbe, 0xbe, 0xc3, 0xc7, 0xc6, 0xc3, 0xc3, 0xbe, 0xc4, 0xc3, 0xc1,
+  0xd0, 0xe5, 0xe7, 0xfa, 0xf3, 0xfa, 0xf3, 0xe5, 0xde, 0xc1, 0xbb, 0xbb, 0xbb, 0xbe, 0xbf, 0xbe, 0xd3, 0xe6, 0xf2, 0xf2, 0xfa, 0xf2, 0xf2, 0xe4,
+  0xdb, 0xb9, 0xb9, 0xb9, 0xbb, 0xbf, 0xbb, 0xbb, 0xbb, 0xbb, 0xb9, 0xbb, 0xbb, 0xbb, 0xbf, 0xbb, 0xbf, 0xbe, 0xbf, 0xbe, 0xbb, 0xbe, 0xc3, 0xc4,
+  0x40, 0x00, 0x50, 0xc6, 0xc6, 0xca, 0xd1, 0xca, 0x58, 0x00, 0xa0, 0xd0, 0xd1, 0xd0, 0xd0, 0xd3, 0xca, 0xd0, 0xd0, 0xd0, 0xd3, 0x04, 0x00, 0x30,
+  0xd6, 0xe1, 0xf5, 0x89, 0x00, 0x00, 0x91, 0x00, 0xf1, 0x09, 0xe9, 0xf7, 0xf4, 0xf4, 0xf2, 0xe1, 0xd9, 0xd9, 0xd9, 0xd9, 0xda, 0xd9, 0xd9, 0xda,
+  0xda, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xde, 0xda, 0xdf, 0xdc, 0xe2, 0x00, 0x00, 0x0f, 0x00, 0x31, 0xdc, 0xdc, 0xdc, 0x0e, 0x00, 0x13, 0xdc, 0x0c,
+  0x00, 0x20, 0xdf, 0xdf, 0x04, 0x00, 0x10, 0xdf, 0x12, 0x00, 0x01, 0x0e, 0x00, 0x02, 0x10, 0x00, 0x15, 0xe1, 0x01, 0x00, 0x50, 0xed, 0xdf, 0xe1,
+  0xe1, 0xef, 0x09, 0x00, 0x13, 0xe1, 0x1c, 0x00, 0xd1, 0xed, 0xef, 0xf3, 0xf4, 0xfb, 0xf5, 0xfb, 0xfb, 0xfb, 0xf3, 0xf0, 0xef, 0xe1, 0x40, 0x01,
+  0x21, 0xef, 0xe1, 0x08, 0x00, 0x24, 0xef, 0xe9, 0x84, 0x00, 0x07, 0x01, 0x00, 0x00, 0xe1, 0x01, 0x01, 0xe2, 0x01, 0x20, 0xfb, 0xf7, 0xdd, 0x01,
+  0x03, 0x07, 0x00, 0x01, 0xe2, 0x01, 0x01, 0x02, 0x00, 0x21, 0xfb, 0xfb, 0xe8, 0x01, 0x01, 0x13, 0x00, 0x10, 0xf5, 0xf7, 0x01, 0x60, 0xf5, 0xf4,
+  0xfb, 0xf4, 0xf4, 0xfb, 0x02, 0x00, 0x11, 0xfb, 0xef, 0x01, 0x00, 0x10, 0x00, 0x10, 0xf5, 0xf3, 0x01, 0x01, 0xee, 0x01, 0x02, 0x02, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x19, 0x02, 0x42, 0xf3, 0xfa, 0xf3, 0xfa, 0xf6, 0x01, 0x12, 0xf2, 0x01, 0x00, 0x10, 0xfa, 0x05, 0x00, 0x07,
+  0x01, 0x00, 0xf0, 0x04, 0xe5, 0xf2, 0xe5, 0xe5, 0xe4, 0xe5, 0xe4, 0xef, 0xe4, 0xef, 0xe2, 0xe3, 0xe1, 0xe2, 0xe1, 0xe1, 0xe2, 0xe1, 0xe2, 0xc9,
+  0x00, 0x40, 0xdc, 0xdc, 0xdc, 0xde, 0x15, 0x01, 0x30, 0xdc, 0xdc, 0xdc, 0x18, 0x01, 0x00, 0x32, 0x01, 0x30, 0xd6, 0xd6, 0xd6, 0xc4, 0x01, 0x70,
+  0xcc, 0xd3, 0xd3, 0xd6, 0xd9, 0xe1, 0xf3, 0xb9, 0x00, 0x00, 0xd2, 0x00, 0x20, 0xf7, 0xf7, 0x64, 0x00, 0x20, 0xf2, 0xef, 0x06, 0x02, 0x00, 0x6e,
+  0x01, 0xf0, 0x00, 0xcc, 0xd0, 0xcf, 0xd3, 0xd3, 0xcc, 0xd0, 0xd0, 0xd0, 0xd0, 0xc9, 0xc9, 0xca, 0xcc, 0xc6, 0x01, 0x00, 0x60, 0xca, 0xca, 0xc4,
+  0xbe, 0xc6, 0xc4, 0x0a, 0x00, 0xf0, 0x0e, 0xc6, 0xc3, 0xbe, 0xc3, 0xc6, 0xc3, 0xc4, 0xc3, 0xcb, 0xcb, 0xca, 0xd3, 0xe5, 0xf3, 0xf2, 0xfa, 0xf3,
+  0xf2, 0xe7, 0xde, 0xc4, 0xbe, 0xbb, 0xbf, 0xbf, 0xc3, 0xbe, 0xd3, 0xe4, 0x9e, 0x02, 0x50, 0xfa, 0xe4, 0xdd, 0xbc, 0xb9, 0xd9, 0x01, 0x02, 0xdf,
+  0x01, 0x00, 0xe2, 0x01, 0xf0, 0x00, 0xc3, 0xbe, 0xc3, 0xc3, 0xc3, 0xbe, 0xc3, 0xc4, 0xc3, 0xca, 0xc3, 0xc6, 0xca, 0xce, 0xc9, 0x3a, 0x02, 0xa0,
+  0xd0, 0xd1, 0xd0, 0xca, 0xd3, 0xd1, 0xd0, 0xd0, 0xd0, 0xd1, 0x89, 0x02, 0x40, 0xd0, 0xd6, 0xdf, 0xf4, 0x8b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x8e,
+  0x00, 0x53, 0xe7, 0xe1, 0xd9, 0xd9, 0xd3, 0xdf, 0x01, 0x10, 0xde, 0xbc, 0x00, 0x00, 0xcd, 0x01, 0x50, 0xda, 0xdc, 0xd9, 0xd9, 0xd9, 0xc6, 0x01,
+  0x00, 0xcb, 0x01, 0x00, 0xf7, 0x01, 0x30, 0xd9, 0xd9, 0xda, 0xeb, 0x01, 0x01, 0xb7, 0x01, 0x00, 0x14, 0x00, 0x02, 0xe1, 0x01, 0x00, 0xdd, 0x01,
+  0x01, 0x01, 0x00, 0x00, 0xd2, 0x01, 0x01, 0xd5, 0x01, 0x12, 0xe1, 0x0b, 0x00, 0x10, 0xef, 0x0c, 0x00, 0x01, 0x02, 0x02, 0x11, 0xef, 0x5c, 0x01,
+  0x10, 0xf6, 0xe0, 0x01, 0x04, 0x01, 0x00, 0x02, 0xe0, 0x01, 0x02, 0x11, 0x01, 0x09, 0x01, 0x00, 0x11, 0xf7, 0x10, 0x00, 0x01, 0x26, 0x01, 0x10,
+  0xfb, 0x05, 0x00, 0x50, 0xf7, 0xf7, 0xf7, 0xf6, 0xf7, 0xcd, 0x01, 0x10, 0xf6, 0xd0, 0x03, 0x00, 0x09, 0x00, 0x00, 0x4a, 0x00, 0x30, 0xf6, 0xfb,
+  0xf6, 0x07, 0x00, 0x40, 0xfb, 0xfb, 0xf6, 0xf6, 0x94, 0x03, 0x02, 0xe7, 0x01, 0x01, 0x08, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x04, 0x00, 0x01, 0x02,
+  0x00, 0x00, 0x05, 0x00, 0x01, 0x13, 0x00, 0x00, 0x0a, 0x00, 0x02, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x43, 0xf3, 0xf5, 0xf4, 0xf5, 0xf7, 0x01, 0x10,
+  0xf3, 0x09, 0x02, 0x00, 0x36, 0x03, 0x00, 0xe2, 0x03, 0x00, 0xe8, 0x03, 0x01, 0x07, 0x00, 0x03, 0xfb, 0x01, 0x11, 0xe7, 0xec, 0x01, 0x00, 0x02,
+  0x00, 0x05, 0x01, 0x00, 0x10, 0xe4, 0x02, 0x00, 0x70, 0xe4, 0xe4, 0xe4, 0xf0, 0xe4, 0xef, 0xe3, 0xc2, 0x00, 0x01, 0xe4, 0x00, 0x10, 0xd9, 0x1e,
+  0x01, 0x30, 0xed, 0xf5, 0xf7, 0xb8, 0x00, 0x00, 0x04, 0x00, 0x20, 0xf6, 0xfb, 0x51, 0x00, 0xc1, 0xe3, 0xd2, 0xd3, 0xd6, 0xd6, 0xd6, 0xda, 0xe1,
+  0xef, 0xdf, 0xef, 0xe4, 0x35, 0x00, 0x71, 0xef, 0xe3, 0xe1, 0xe1, 0xe1, 0xde, 0xdc, 0xfe, 0x03, 0x70, 0xc9, 0xc9, 0xc9, 0xc6, 0xc6, 0xc4, 0xc4,
+  0xd3, 0x03, 0xc0, 0xc6, 0xbe, 0xbe, 0xc6, 0xcb, 0xc6, 0xca, 0xc6, 0xc6, 0xd6, 0xe6, 0xf2, 0x8b, 0x00, 0x40, 0xe6, 0xe2, 0xc6, 0xbe, 0xc7, 0x01,
+  0x40, 0xc4, 0xd3, 0xe6, 0xe7, 0x89, 0x02, 0x30, 0xe5, 0xde, 0xc1, 0xc1, 0x03, 0x01, 0x01, 0x00, 0x10, 0xbf, 0x02, 0x00, 0x20, 0xc3, 0xc7, 0x14,
+  0x02, 0x20, 0xc7, 0xc6, 0x18, 0x02, 0x20, 0xc7, 0xc4, 0x42, 0x00, 0x10, 0xc6, 0x19, 0x04, 0x01, 0xe4, 0x01, 0x12, 0xd0, 0xe5, 0x01, 0x20, 0xd9,
+  0xdf, 0x8e, 0x00, 0x01, 0x01, 0x00, 0x00, 0xe0, 0x01, 0x70, 0xf3, 0xe1, 0xda, 0xd3, 0xd9, 0xda, 0xdb, 0xc3, 0x03, 0x11, 0xdc, 0xc8, 0x01, 0xd0,
+  0xdd, 0xdc, 0xda, 0xda, 0xdf, 0xde, 0xdc, 0xda, 0xda, 0xdd, 0xda, 0xdc, 0xda, 0xa6, 0x01, 0x01, 0xe3, 0x01, 0x01, 0xdf, 0x01, 0x00, 0xcb, 0x01,
+  0x00, 0x07, 0x00, 0x00, 0x0e, 0x00, 0x04, 0x10, 0x00, 0x00, 0x01, 0x00, 0x11, 0xdc, 0xd2, 0x01, 0x10, 0xe1, 0xde, 0x01, 0x11, 0xdf, 0xc4, 0x03,
+  0x11, 0xe2, 0x0f, 0x00, 0x70, 0xdc, 0xdf, 0xed, 0xe1, 0xf0, 0xf3, 0xf4, 0x8c, 0x01, 0x30, 0xfb, 0xfa, 0xe4, 0xbb, 0x03, 0x00, 0x17, 0x01, 0x03,
+  0x01, 0x00, 0x00, 0x6a, 0x05, 0x32, 0xfb, 0xf4, 0xfb, 0xd4, 0x01, 0x02, 0x01, 0x00, 0x05, 0x0b, 0x00, 0x01, 0xfb, 0x01, 0x00, 0x1a, 0x00, 0x00,
+  0xe3, 0x01, 0x00, 0xe5, 0x01, 0x00, 0x01, 0x00, 0x10, 0xf6, 0x03, 0x00, 0x30, 0xf6, 0xf6, 0xf6, 0x0e, 0x00, 0x00, 0xe5, 0x01, 0x03, 0xf5, 0x01,
+  0x00, 0xc4, 0x01, 0x03, 0x02, 0x00, 0x00, 0x01, 0x00, 0x02, 0xcf, 0x03, 0x00, 0xcc, 0x01, 0x01, 0x02, 0x00, 0x01, 0x18, 0x00, 0x01, 0x0a, 0x00,
+  0x01, 0x16, 0x00, 0x00, 0x01, 0x00, 0x10, 0xf5, 0x09, 0x00, 0x01, 0x0b, 0x00, 0x01, 0x05, 0x00, 0x00, 0xe6, 0x01, 0x08, 0x02, 0x00, 0x06, 0x01,
+  0x00, 0x30, 0xfa, 0xf2, 0xfa, 0x05, 0x00, 0x04, 0xf2, 0x01, 0x07, 0x01, 0x00, 0x10, 0xe7, 0x05, 0x00, 0x02, 0xfc, 0x01, 0x10, 0xe4, 0x03, 0x00,
+  0x20, 0xf2, 0xf6, 0xac, 0x00, 0x02, 0xba, 0x00, 0xf0, 0x08, 0xf4, 0xf4, 0xf4, 0xfa, 0xf2, 0xf2, 0xe3, 0xe1, 0xe2, 0xe3, 0xe4, 0xe7, 0xe7, 0xe8,
+  0xf3, 0xe7, 0xf3, 0xf2, 0xf1, 0xe5, 0xf1, 0xe7, 0xf3, 0x0a, 0x00, 0xf0, 0x1e, 0xe5, 0xe3, 0xe1, 0xe3, 0xe4, 0xe3, 0xe4, 0xe2, 0xde, 0xdd, 0xdb,
+  0xd9, 0xd4, 0xd3, 0xdb, 0xd3, 0xdd, 0xd3, 0xd3, 0xc6, 0xc1, 0xc4, 0xc6, 0xc9, 0xca, 0xc6, 0xc5, 0xd9, 0xe7, 0xf2, 0xf3, 0xfa, 0xfa, 0xf3, 0xe5,
+  0xe2, 0xc4, 0xbe, 0xbf, 0xbb, 0xbf, 0xb9, 0xbb, 0xc9, 0xe6, 0xbf, 0x03, 0x51, 0xf2, 0xe5, 0xdd, 0xba, 0xb9, 0x01, 0x00, 0x02, 0xa4, 0x05, 0xe1,
+  0xbf, 0xbe, 0xbf, 0xc3, 0xc6, 0xc7, 0xcb, 0xc6, 0xc7, 0xc4, 0xc7, 0xc6, 0xc6, 0xcb, 0xf5, 0x05, 0x20, 0xca, 0xc6, 0xa4, 0x05, 0x11, 0xd0, 0xdc,
+  0x01, 0x01, 0xdf, 0x01, 0x42, 0xd3, 0xd6, 0xe1, 0xe8, 0x3d, 0x01, 0x00, 0x8f, 0x00, 0x20, 0xf4, 0xf3, 0xa0, 0x05, 0x31, 0xd3, 0xd9, 0xd3, 0xc3,
+  0x01, 0x11, 0xdd, 0x8f, 0x02, 0x01, 0x9c, 0x03, 0x20, 0xdc, 0xdd, 0xa5, 0x03, 0x50, 0xdf, 0xdc, 0xde, 0xda, 0xde, 0xad, 0x03, 0x52, 0xde, 0xdc,
+  0xda, 0xdf, 0xde, 0xdd, 0x01, 0x76, 0xdc, 0xdc, 0xde, 0xda, 0xdd, 0xda, 0xde, 0xdd, 0x01, 0x00, 0x05, 0x00, 0x01, 0xda, 0x01, 0x01, 0x08, 0x00,
+  0x01, 0xa2, 0x05, 0x00, 0xdf, 0x01, 0x00, 0x01, 0x00, 0x42, 0xdf, 0xe1, 0xf0, 0xe7, 0x7e, 0x03, 0x31, 0xf3, 0xef, 0xed, 0x18, 0x00, 0x00, 0xdb,
+  0x01, 0x51, 0xef, 0xef, 0xf0, 0xef, 0xef, 0x4c, 0x01, 0x32, 0xf4, 0xf3, 0xf4, 0x89, 0x00, 0x00, 0x8c, 0x00, 0x02, 0x22, 0x01, 0x00, 0x24, 0x01,
+  0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x01, 0x36, 0x01, 0x00, 0x0d, 0x00, 0x01, 0xdd, 0x01, 0x03, 0x01, 0x00, 0x02, 0xdf, 0x01, 0x00, 0xc8, 0x05,
+  0x01, 0x0a, 0x00, 0x00, 0x0d, 0x00, 0x02, 0x02, 0x00, 0x02, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0xe0, 0x03, 0x00, 0xd9, 0x01, 0x02, 0xbd, 0x07,
+  0x00, 0x13, 0x00, 0x00, 0xbb, 0x07, 0x00, 0xcf, 0x01, 0x01, 0x07, 0x00, 0x04, 0xf2, 0x01, 0x01, 0xe2, 0x01, 0x00, 0xee, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x15, 0x00, 0x10, 0xf3, 0x09, 0x00, 0x05, 0x01, 0x00, 0x10, 0xf3, 0x6b, 0x05, 0x00, 0x06, 0x00, 0x03, 0x01, 0x00, 0x00, 0xee, 0x01, 0x02,
+  0xe8, 0x03, 0x02, 0xeb, 0x03, 0x20, 0xf2, 0xe7, 0x05, 0x00, 0x50, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xba, 0x00, 0x00, 0x04, 0x00, 0x40, 0xe9, 0xe9,
+  0xf7, 0xfb, 0x1e, 0x00, 0x70, 0xf3, 0xf3, 0xe8, 0xf3, 0xf5, 0xf5, 0xe8, 0x24, 0x04, 0x00, 0x0d, 0x00, 0x30, 0xf3, 0xf3, 0xe8, 0x71, 0x00, 0x20,
+  0xf3, 0xf2, 0xf0, 0x07, 0xf1, 0x11, 0xe7, 0xe5, 0xe7, 0xe5, 0xe6, 0xe4, 0xe5, 0xe6, 0xe5, 0xe5, 0xe5, 0xe6, 0xe4, 0xe2, 0xe0, 0xde, 0xdc, 0xd3,
+  0xd3, 0xc9, 0xc8, 0xd6, 0xe5, 0xf3, 0xfa, 0xfa, 0xf2, 0xfa, 0xe6, 0xe2, 0xbe, 0xc6, 0xca, 0x01, 0xb0, 0xc5, 0xe6, 0xe7, 0xf3, 0xfa, 0xf2, 0xf2,
+  0xe6, 0xd9, 0xb9, 0xb8, 0xba, 0x03, 0x04, 0xa1, 0x05, 0x40, 0xbf, 0xbf, 0xbe, 0xc7, 0x7b, 0x07, 0xa0, 0xc3, 0xc3, 0xca, 0xc7, 0xca, 0xcb, 0xca,
+  0xca, 0xce, 0xd0, 0xde, 0x01, 0x90, 0xca, 0xd1, 0xd1, 0xd1, 0xd0, 0xd3, 0xd3, 0xd3, 0xd8, 0xdf, 0x01, 0x40, 0xd8, 0xd9, 0xed, 0xf5, 0x36, 0x01,
+  0x00, 0x8d, 0x00, 0x00, 0xe0, 0x01, 0x90, 0xf3, 0xe1, 0xda, 0xdb, 0xd6, 0xd8, 0xda, 0xdb, 0xd9, 0xd2, 0x01, 0x30, 0xdd, 0xda, 0xdc, 0xbb, 0x01,
+  0x01, 0xea, 0x01, 0x20, 0xd9, 0xd9, 0xe3, 0x01, 0x00, 0x03, 0x00, 0x21, 0xdc, 0xdd, 0xd8, 0x01, 0x02, 0xca, 0x01, 0x00, 0xd2, 0x03, 0x00, 0x94,
+  0x04, 0x11, 0xdc, 0xad, 0x05, 0x00, 0xa3, 0x04, 0x00, 0x14, 0x00, 0x03, 0x06, 0x00, 0x00, 0xd4, 0x01, 0x04, 0x01, 0x00, 0x30, 0xdf, 0xe1, 0xe2,
+  0xd0, 0x01, 0x91, 0xf3, 0xfb, 0xf7, 0xf6, 0xf6, 0xfb, 0xfb, 0xf3, 0xef, 0xbb, 0x05, 0x00, 0xdd, 0x01, 0x02, 0x01, 0x00, 0x01, 0x5d, 0x01, 0x25,
+  0xf3, 0xf4, 0x4c, 0x04, 0x00, 0x8e, 0x00, 0x00, 0x05, 0x00, 0x21, 0xe9, 0xf7, 0x7e, 0x01, 0x00, 0xa1, 0x01, 0x00, 0x01, 0x00, 0x00, 0x6f, 0x09,
+  0x02, 0xad, 0x03, 0x03, 0x2a, 0x01, 0x00, 0x2b, 0x01, 0x01, 0xa3, 0x01, 0x00, 0x81, 0x07, 0x40, 0xf5, 0xf5, 0xf6, 0xf5, 0x05, 0x00, 0x02, 0x01,
+  0x00, 0x21, 0xfb, 0xf6, 0xe1, 0x03, 0x20, 0xfb, 0xf7, 0x30, 0x00, 0x00, 0xc5, 0x05, 0x00, 0x0d, 0x00, 0x10, 0xf5, 0x13, 0x00, 0x00, 0x09, 0x00,
+  0x02, 0x13, 0x00, 0x03, 0xfa, 0x01, 0x03, 0x02, 0x00, 0x00, 0x76, 0x01, 0x00, 0x89, 0x00, 0x31, 0xf5, 0xf4, 0xf6, 0x06, 0x00, 0x03, 0xeb, 0x01,
+  0x00, 0x99, 0x00, 0x00, 0x06, 0x00, 0x08, 0x01, 0x00, 0x02, 0xea, 0x01, 0x09, 0xf1, 0x01, 0x01, 0xbf, 0x01, 0x00, 0xee, 0x05, 0x10, 0xf6, 0xb8,
+  0x00, 0x01, 0x01, 0x00, 0x01, 0xc0, 0x03, 0x20, 0xf4, 0xf4, 0x92, 0x00, 0x00, 0x08, 0x00, 0x00, 0x2d, 0x04, 0x01, 0x3c, 0x00, 0x01, 0x4f, 0x00,
+  0x02, 0x16, 0x02, 0x01, 0x04, 0x00, 0x06, 0x01, 0x00, 0x02, 0xe6, 0x01, 0x10, 0xe4, 0x27, 0x04, 0x51, 0xfa, 0xf3, 0xe6, 0xe0, 0xc4, 0xa0, 0x05,
+  0x30, 0xbb, 0xc9, 0xe4, 0x70, 0x09, 0x92, 0xf2, 0xe5, 0xde, 0xba, 0xb9, 0xbe, 0xcb, 0xc4, 0xc3, 0x15, 0x00, 0xb0, 0xbb, 0xbe, 0xbb, 0xbb, 0xbe,
+  0xc6, 0xc6, 0xc4, 0xc7, 0xc6, 0xc4, 0x9b, 0x05, 0x00, 0xb8, 0x03, 0x10, 0xd1, 0xc6, 0x09, 0x31, 0xd0, 0xd3, 0xd3, 0xdf, 0x01, 0x10, 0xd9, 0x80,
+  0x07, 0x39, 0xd9, 0xd6, 0xdf, 0xc0, 0x03, 0x70, 0xe7, 0xef, 0xda, 0xd3, 0xd3, 0xd9, 0xdb, 0xbf, 0x03, 0x00, 0xce, 0x01, 0x00, 0xc0, 0x03, 0x50,
+  0xde, 0xdc, 0xdd, 0xdc, 0xdd, 0xaf, 0x05, 0x22, 0xdc, 0xde, 0x67, 0x09, 0x22, 0xda, 0xda, 0xbf, 0x01, 0x00, 0xa2, 0x01, 0x20, 0xe1, 0xe0, 0x0f,
+  0x00, 0x00, 0xaf, 0x05, 0x02, 0x01, 0x00, 0x05, 0xf7, 0x01, 0x00, 0x1e, 0x00, 0x01, 0xc6, 0x03, 0x00, 0xc7, 0x01, 0x00, 0xf9, 0x01, 0x00, 0x2d,
+  0x00, 0x31, 0xe1, 0xef, 0xf3, 0x5a, 0x01, 0x10, 0xf4, 0xe0, 0x01, 0x13, 0xdf, 0xdf, 0x01, 0x00, 0xbe, 0x06, 0x50, 0xf0, 0xe8, 0xf4, 0xf4, 0xe8,
+  0x51, 0x03, 0x00, 0x87, 0x00, 0x04, 0x01, 0x00, 0x00, 0xb6, 0x03, 0x22, 0xf7, 0xfb, 0x1a, 0x01, 0x02, 0x62, 0x01, 0x00, 0x73, 0x01, 0x10, 0xfb,
+  0xce, 0x01, 0x01, 0xfe, 0x02, 0x31, 0xf0, 0xf0, 0xef, 0x02, 0x00, 0xb0, 0xf0, 0xe4, 0xf1, 0xe4, 0xf1, 0xe4, 0xf0, 0xe4, 0xf1, 0xe5, 0xe5, 0x23,
+  0x07, 0x50, 0xf2, 0xf3, 0xe7, 0xf2, 0xe8, 0x32, 0x03, 0x01, 0xfa, 0x01, 0x01, 0x01, 0x00, 0x00, 0xd2, 0x01, 0x11, 0xf6, 0xd0, 0x05, 0x00, 0xe0,
+  0x03, 0x03, 0xe3, 0x01, 0x01, 0x07, 0x00, 0x02, 0xe1, 0x01, 0x00, 0xf5, 0x09, 0x02, 0x02, 0x00, 0x00, 0xc4, 0x07, 0x04, 0x15, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x03, 0x00, 0x01, 0x71, 0x00, 0x06, 0x01, 0x00, 0x01, 0xd4, 0x01, 0x31, 0xf4, 0xf3, 0xfb, 0x06, 0x00, 0x01, 0x05, 0x00, 0x01, 0x02,
+  0x00, 0x03, 0x1a, 0x00, 0x00, 0x44, 0x00, 0x02, 0x4e, 0x01, 0x00, 0x01, 0x00, 0x10, 0xfb, 0xae, 0x00, 0x00, 0x5a, 0x04, 0x30, 0xf5, 0xfb, 0xf5,
+  0x51, 0x02, 0x03, 0x48, 0x00, 0x01, 0x1a, 0x02, 0x42, 0xf4, 0xf4, 0xf5, 0xf5, 0x15, 0x02, 0x02, 0xd8, 0x09, 0x04, 0xe9, 0x01, 0x10, 0xe7, 0x09,
+  0x04, 0x01, 0x0a, 0x06, 0x32, 0xe6, 0xdd, 0xc4, 0xae, 0x03, 0x11, 0xc9, 0x80, 0x07, 0xf0, 0x04, 0xe7, 0xf2, 0xe2, 0xc5, 0xc0, 0xc1, 0xca, 0xc9,
+  0xc6, 0xbe, 0xbc, 0xbe, 0xc4, 0xc4, 0xc4, 0xbe, 0xc4, 0xbe, 0xc1, 0x70, 0x07, 0xf0, 0x00, 0xc9, 0xc4, 0xc6, 0xd0, 0xca, 0xc5, 0xca, 0xc9, 0xc6,
+  0xc9, 0xc9, 0xd3, 0xd0, 0xca, 0xc5, 0x35, 0x0b, 0x00, 0xda, 0x01, 0x00, 0x01, 0x00, 0x64, 0xcf, 0xd8, 0xd9, 0xd6, 0xed, 0xf6, 0xbf, 0x03, 0x22,
+  0xe9, 0xe9, 0xa0, 0x05, 0x00, 0x41, 0x0b, 0x10, 0xdb, 0xb6, 0x01, 0x00, 0x5f, 0x09, 0x01, 0x08, 0x00, 0x11, 0xdc, 0x09, 0x00, 0x00, 0x8b, 0x07,
+  0x00, 0xcc, 0x01, 0x00, 0xce, 0x01, 0x03, 0xc6, 0x01, 0x30, 0xe1, 0xdf, 0xe1, 0x06, 0x02, 0x01, 0xdf, 0x01, 0x01, 0x05, 0x00, 0x00, 0x06, 0x00,
+  0x00, 0xc9, 0x01, 0x01, 0x05, 0x00, 0x00, 0x7c, 0x07, 0x01, 0x09, 0x00, 0x30, 0xdf, 0xed, 0xdf, 0xbd, 0x03, 0x00, 0xe0, 0x01, 0x02, 0x34, 0x03,
+  0x40, 0xf3, 0xef, 0xdf, 0xed, 0xf3, 0x01, 0x02, 0xa2, 0x05, 0x21, 0xe3, 0xf0, 0xc0, 0x03, 0x00, 0x88, 0x03, 0x00, 0x86, 0x00, 0x03, 0x01, 0x00,
+  0x00, 0x17, 0x01, 0x00, 0x34, 0x0b, 0x02, 0x1b, 0x00, 0x01, 0x3d, 0x01, 0x10, 0xf4, 0x57, 0x01, 0x01, 0x04, 0x03, 0x40, 0xf4, 0xe8, 0xf3, 0xe7,
+  0xd6, 0x0c, 0x03, 0xa8, 0x09, 0x61, 0xee, 0xef, 0xe1, 0xee, 0xe1, 0xe1, 0x04, 0x00, 0x03, 0x54, 0x00, 0x20, 0xef, 0xef, 0xe6, 0x0c, 0x10, 0xf0,
+  0xed, 0x0c, 0x00, 0x00, 0x0d, 0x00, 0x3f, 0x05, 0x10, 0xe7, 0xee, 0x03, 0x42, 0xe8, 0xf5, 0xf5, 0xf5, 0xe2, 0x05, 0x10, 0xf7, 0x7a, 0x0d, 0x00,
+  0x76, 0x01, 0x01, 0x04, 0x00, 0x01, 0x01, 0x00, 0x10, 0xf6, 0x10, 0x00, 0x00, 0x11, 0x00, 0x01, 0x09, 0x04, 0x01, 0xe5, 0x01, 0x43, 0xf4, 0xf5,
+  0xf5, 0xf6, 0x78, 0x03, 0x00, 0x88, 0x00, 0x01, 0xc3, 0x05, 0x01, 0x01, 0x00, 0x01, 0x90, 0x00, 0x00, 0x05, 0x00, 0x02, 0x02, 0x00, 0x01, 0x01,
+  0x00, 0x10, 0xf3, 0x23, 0x00, 0x06, 0x45, 0x08, 0x00, 0x40, 0x0b, 0x10, 0xfb, 0x3c, 0x06, 0x20, 0xfb, 0xfb, 0x71, 0x00, 0x00, 0x3c, 0x02, 0x00,
+  0x01, 0x00, 0x01, 0x2f, 0x00, 0x00, 0xd4, 0x00, 0x00, 0xa3, 0x0d, 0x20, 0xf3, 0xf6, 0xef, 0x01, 0x00, 0xee, 0x05, 0x04, 0x01, 0x00, 0x20, 0xfa,
+  0xf2, 0xf4, 0x01, 0x00, 0x07, 0x00, 0x21, 0xe5, 0xe0, 0x80, 0x07, 0x32, 0xbb, 0xbe, 0xd0, 0x70, 0x09, 0x40, 0xe5, 0xe5, 0xe2, 0xe0, 0x02, 0x00,
+  0x52, 0xdd, 0xdb, 0xdb, 0xde, 0xdd, 0x01, 0x00, 0x80, 0xde, 0xde, 0xde, 0xdd, 0xdb, 0xde, 0xde, 0xda, 0x05, 0x00, 0xf0, 0x08, 0xd9, 0xdb, 0xdf,
+  0xde, 0xdd, 0xdd, 0xde, 0xdf, 0xe0, 0xdf, 0xdc, 0xda, 0xd6, 0xdd, 0xdf, 0xde, 0xdf, 0xdc, 0xe0, 0xdf, 0xdf, 0xdf, 0xf0, 0xa0, 0x05, 0x02, 0x01,
+  0x00, 0x00, 0x80, 0x07, 0x11, 0xef, 0xdf, 0x01, 0x00, 0xc9, 0x01, 0x00, 0x4c, 0x09, 0x00, 0xc4, 0x03, 0x00, 0xce, 0x01, 0x00, 0xc4, 0x01, 0x21,
+  0xda, 0xdf, 0xdb, 0x01, 0x00, 0x0e, 0x00, 0x00, 0xc9, 0x01, 0x02, 0xbc, 0x01, 0x00, 0x09, 0x00, 0x00, 0x12, 0x00, 0x01, 0x13, 0x00, 0x01, 0x0e,
+  0x00, 0x00, 0x15, 0x00, 0x00, 0x67, 0x01, 0x02, 0x01, 0x00, 0x20, 0xdf, 0xed, 0x71, 0x01, 0x05, 0x13, 0x00, 0x21, 0xf0, 0xe8, 0x80, 0x07, 0x02,
+  0xc0, 0x03, 0x00, 0x31, 0x00, 0x03, 0x8d, 0x01, 0x11, 0xe4, 0xbe, 0x03, 0x34, 0xf5, 0xf4, 0xfb, 0x8b, 0x00, 0x00, 0x8e, 0x00, 0x10, 0xf7, 0x6b,
+  0x03, 0x11, 0xfb, 0xe5, 0x02, 0x01, 0xb1, 0x06, 0x01, 0x24, 0x00, 0x00, 0xe8, 0x03, 0x00, 0x47, 0x01, 0x00, 0x26, 0x01, 0x00, 0xf9, 0x06, 0x30,
+  0xf2, 0xf2, 0xf1, 0xb3, 0x08, 0x00, 0xeb, 0x01, 0x30, 0xf0, 0xe4, 0xef, 0x6f, 0x00, 0x26, 0xe1, 0xe1, 0x05, 0x00, 0x42, 0xe1, 0xed, 0xe1, 0xed,
+  0x7c, 0x00, 0x02, 0xa9, 0x0b, 0x61, 0xe3, 0xf0, 0xe4, 0xf0, 0xe5, 0xf2, 0xbb, 0x01, 0x00, 0xe1, 0x01, 0x10, 0xf3, 0x15, 0x09, 0x01, 0xfb, 0x01,
+  0x11, 0xf2, 0xf4, 0x03, 0x70, 0xe8, 0xf3, 0xf5, 0xe8, 0xf5, 0xe8, 0xf5, 0x06, 0x00, 0x21, 0xf5, 0xf5, 0x01, 0x04, 0x00, 0x03, 0x04, 0x01, 0x07,
+  0x00, 0x00, 0x06, 0x00, 0x01, 0xb9, 0x05, 0x03, 0xbb, 0x05, 0x01, 0xd2, 0x01, 0x00, 0xb0, 0x01, 0x00, 0xae, 0x01, 0x01, 0x0d, 0x00, 0x01, 0x10,
+  0x00, 0x01, 0xbf, 0x03, 0x03, 0xe1, 0x01, 0x41, 0xf7, 0xf7, 0xf6, 0xf4, 0x0e, 0x00, 0x00, 0xdc, 0x01, 0x00, 0x38, 0x02, 0x00, 0x23, 0x00, 0x02,
+  0xc7, 0x07, 0x04, 0x26, 0x02, 0x40, 0xf3, 0xfa, 0xf5, 0xf4, 0x18, 0x00, 0x00, 0xcb, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x01, 0xca, 0x0b,
+  0x00, 0x07, 0x00, 0x91, 0xf2, 0xe5, 0xe3, 0xc6, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0x40, 0x0b, 0x00, 0xee, 0x07, 0x00, 0xc3, 0x09, 0x00, 0x80, 0x0b,
+  0x03, 0x01, 0x00, 0x30, 0xe6, 0xe4, 0xe6, 0x8f, 0x0b, 0x01, 0xc9, 0x0b, 0x00, 0x05, 0x00, 0x03, 0x02, 0x00, 0x02, 0x24, 0x00, 0x00, 0x07, 0x00,
+  0x50, 0xe5, 0xe7, 0xe5, 0xf2, 0xe8, 0x07, 0x05, 0x00, 0x8f, 0x00, 0x01, 0xc0, 0x03, 0x70, 0xf3, 0xe5, 0xf0, 0xe4, 0xe4, 0xe3, 0xf0, 0x02, 0x00,
+  0x00, 0xc8, 0x0b, 0x50, 0xef, 0xe3, 0xef, 0xe3, 0xf0, 0x41, 0x05, 0x00, 0x1f, 0x01, 0x06, 0xa7, 0x01, 0x02, 0x3c, 0x01, 0x00, 0x36, 0x01, 0x01,
+  0x02, 0x00, 0x00, 0xc7, 0x01, 0x00, 0xcb, 0x03, 0x00, 0x03, 0x00, 0x02, 0x15, 0x00, 0x00, 0x2f, 0x0c, 0x12, 0xed, 0x07, 0x00, 0x00, 0x10, 0x00,
+  0x02, 0x1a, 0x00, 0x40, 0xef, 0xe1, 0xef, 0xf0, 0xa0, 0x05, 0x51, 0xfb, 0xf6, 0xfb, 0xe8, 0xf0, 0xe0, 0x01, 0x05, 0xc2, 0x03, 0x31, 0xef, 0xe8,
+  0xf4, 0x80, 0x08, 0x13, 0xf3, 0x1b, 0x01, 0x00, 0x1d, 0x01, 0x01, 0x48, 0x05, 0x30, 0xfb, 0xf5, 0xf4, 0x9b, 0x0a, 0x02, 0xc8, 0x08, 0x30, 0xf4,
+  0xe8, 0xf4, 0xe9, 0x01, 0x00, 0x18, 0x01, 0x01, 0xe6, 0x01, 0x00, 0xec, 0x01, 0x00, 0x8a, 0x05, 0x00, 0x01, 0x00, 0x62, 0xe8, 0xf3, 0xf2, 0xe7,
+  0xf2, 0xe5, 0x8e, 0x00, 0x00, 0x17, 0x06, 0x00, 0x01, 0x00, 0x00, 0x04, 0x06, 0x00, 0x08, 0x00, 0x12, 0xdc, 0x08, 0x00, 0x02, 0xb9, 0x00, 0x00,
+  0x0d, 0x06, 0x01, 0x4f, 0x0d, 0x41, 0xf7, 0xf6, 0xf5, 0xe5, 0x2e, 0x00, 0x00, 0x16, 0x00, 0x00, 0x01, 0x00, 0x00, 0x88, 0x00, 0x01, 0xf7, 0x03,
+  0x00, 0x02, 0x00, 0x01, 0x0a, 0x02, 0x02, 0x01, 0x00, 0x76, 0xe7, 0xe5, 0xe7, 0xe7, 0xe7, 0xe7, 0xe8, 0x01, 0x00, 0x10, 0xf3, 0x05, 0x00, 0x40,
+  0xe8, 0xe8, 0xe8, 0xf5, 0x05, 0x00, 0x02, 0x08, 0x00, 0x01, 0x12, 0x02, 0x00, 0x04, 0x02, 0x42, 0xf5, 0xf5, 0xfb, 0xf6, 0xd1, 0x08, 0x00, 0xb8,
+  0x03, 0x00, 0xde, 0x01, 0x02, 0x01, 0x00, 0x20, 0xf6, 0xf7, 0xc7, 0x01, 0x00, 0x02, 0x00, 0x01, 0xdf, 0x01, 0x01, 0x01, 0x00, 0x00, 0xb7, 0x03,
+  0x00, 0x0e, 0x06, 0x00, 0x16, 0x04, 0x00, 0x1b, 0x00, 0x00, 0x05, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x05, 0x00, 0x00, 0x06, 0x00, 0xa2, 0xe7, 0xe5,
+  0xe0, 0xd4, 0xca, 0xc4, 0xc3, 0xbe, 0xc3, 0xd9, 0xc0, 0x03, 0x01, 0xcf, 0x02, 0x02, 0x01, 0x00, 0x00, 0x93, 0x04, 0x10, 0xe5, 0x09, 0x00, 0x01,
+  0x0c, 0x00, 0x0f, 0x01, 0x00, 0x04, 0x01, 0xff, 0x09, 0x01, 0x33, 0x03, 0x01, 0x04, 0x00, 0x21, 0xf7, 0xf7, 0xb6, 0x08, 0x00, 0x03, 0x06, 0x00,
+  0xf4, 0x0b, 0x00, 0x37, 0x00, 0x01, 0xfb, 0x0b, 0x00, 0x09, 0x00, 0x00, 0x4e, 0x00, 0x01, 0xdf, 0x06, 0x05, 0x01, 0x00, 0x01, 0x11, 0x00, 0x00,
+  0x38, 0x03, 0x10, 0xf1, 0x34, 0x02, 0x00, 0x08, 0x0e, 0x12, 0xf0, 0x05, 0x00, 0x00, 0x12, 0x00, 0x00, 0x08, 0x00, 0x01, 0x02, 0x00, 0x02, 0x1e,
+  0x02, 0x05, 0x3d, 0x01, 0x21, 0xe4, 0xfa, 0x89, 0x06, 0x32, 0xfb, 0xf2, 0xef, 0x59, 0x03, 0x00, 0x74, 0x01, 0x01, 0x1b, 0x00, 0x00, 0x76, 0x00,
+  0x44, 0xf2, 0xe5, 0xf1, 0xf2, 0x61, 0x09, 0x00, 0x7b, 0x07, 0x00, 0x22, 0x07, 0x40, 0xfb, 0xf6, 0xf3, 0xe5, 0x20, 0x00, 0x31, 0xe4, 0xf2, 0xe5,
+  0x61, 0x05, 0x01, 0x01, 0x00, 0x10, 0xe8, 0xd3, 0x01, 0x00, 0xca, 0x08, 0x02, 0x4a, 0x03, 0x02, 0x06, 0x00, 0x01, 0x01, 0x00, 0x30, 0xf2, 0xe5,
+  0xf0, 0x4f, 0x00, 0x01, 0xe2, 0x01, 0x02, 0x02, 0x00, 0x00, 0xe1, 0x0b, 0x00, 0xe4, 0x01, 0x02, 0x01, 0x00, 0x00, 0xea, 0x01, 0x30, 0xe1, 0xef,
+  0xf3, 0x85, 0x01, 0x50, 0xf6, 0xf6, 0xf6, 0xf3, 0xf0, 0x22, 0x00, 0x00, 0x02, 0x00, 0x01, 0x88, 0x00, 0x00, 0x05, 0x00, 0x02, 0x04, 0x00, 0x01,
+  0x2b, 0x00, 0x00, 0xac, 0x04, 0x00, 0xc9, 0x04, 0x00, 0x2c, 0x0e, 0x20, 0xda, 0xda, 0x1c, 0x0e, 0x01, 0x17, 0x00, 0xf1, 0x05, 0xe0, 0xe1, 0xe3,
+  0xef, 0xe3, 0xe4, 0xe3, 0xe3, 0xe3, 0xe4, 0xe4, 0xe6, 0xe5, 0xe7, 0xe6, 0xe5, 0xe4, 0xe7, 0xe6, 0xe6, 0xff, 0x01, 0x02, 0x02, 0x02, 0x34, 0xf5,
+  0xe8, 0xf5, 0x80, 0x07, 0x10, 0xfb, 0xea, 0x01, 0x03, 0x01, 0x00, 0x10, 0xf6, 0xf7, 0x03, 0x00, 0xc0, 0x01, 0x21, 0xfa, 0xf3, 0x7e, 0x04, 0x00,
+  0x04, 0x00, 0x00, 0xc3, 0x01, 0x00, 0xc9, 0x01, 0x00, 0xf6, 0x03, 0x01, 0xca, 0x07, 0x00, 0xe4, 0x01, 0x00, 0xf4, 0x01, 0x02, 0xb7, 0x09, 0xd0,
+  0xf4, 0xf3, 0xf2, 0xe6, 0xe4, 0xe4, 0xde, 0xd0, 0xca, 0xc3, 0xbe, 0xd3, 0xe6, 0x92, 0x07, 0x00, 0x2d, 0x00, 0x00, 0xb4, 0x01, 0x00, 0x61, 0x08,
+  0x01, 0x8d, 0x11, 0x00, 0xca, 0x05, 0x00, 0xfb, 0x02, 0x00, 0xc7, 0x01, 0x05, 0x1c, 0x00, 0x01, 0x09, 0x00, 0x00, 0x03, 0x00, 0x00, 0x5b, 0x00,
+  0x32, 0xf3, 0xf4, 0xf4, 0x32, 0x03, 0x00, 0x05, 0x00, 0x10, 0xf7, 0x63, 0x02, 0x02, 0x74, 0x00, 0x01, 0x25, 0x00, 0x00, 0xf2, 0x07, 0x00, 0x05,
+  0x00, 0x00, 0x7c, 0x01, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x04, 0x08, 0x00, 0x03, 0xfb, 0x01, 0x09, 0x01, 0x00, 0x10, 0xe7, 0x03, 0x00, 0x04,
+  0x17, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0xfd, 0x13, 0x00, 0x02, 0x00, 0x02, 0xff, 0x08, 0x01, 0x70, 0x12, 0x22, 0xf6, 0xf5, 0xb5,
+  0x01, 0x00, 0x2e, 0x03, 0x10, 0xef, 0x06, 0x02, 0x20, 0xe4, 0xf0, 0x22, 0x00, 0x00, 0x24, 0x00, 0x04, 0xe0, 0x01, 0x00, 0xfe, 0x02, 0x00, 0xf9,
+  0x0a, 0x20, 0xfb, 0xf5, 0xeb, 0x12, 0x02, 0x04, 0x02, 0x05, 0x2c, 0x00, 0x00, 0x71, 0x02, 0x00, 0xd8, 0x00, 0x01, 0xb8, 0x05, 0x00, 0xd4, 0x03,
+  0x00, 0x12, 0x03, 0x00, 0xcd, 0x00, 0x50, 0xf5, 0xf3, 0xf3, 0xe5, 0xe5, 0x70, 0x10, 0x01, 0xa5, 0x01, 0x00, 0x3e, 0x06, 0x30, 0xe0, 0xdf, 0xdd,
+  0x52, 0x06, 0x00, 0x9a, 0x01, 0x04, 0xc4, 0x0d, 0x30, 0xe1, 0xef, 0xe7, 0xdf, 0x01, 0x50, 0xfb, 0xf6, 0xfb, 0xe7, 0xef, 0xb0, 0x01, 0x20, 0xdc,
+  0xde, 0x60, 0x06, 0x01, 0xac, 0x06, 0x00, 0x1e, 0x00, 0x00, 0xe1, 0x01, 0xc0, 0xdf, 0xdf, 0xdc, 0xdb, 0xda, 0xdb, 0xd9, 0xdb, 0xd9, 0xd8, 0xd9,
+  0xd8, 0x2f, 0x0e, 0x20, 0xd3, 0xd3, 0x05, 0x00, 0x20, 0xd9, 0xd8, 0x09, 0x00, 0x30, 0xd3, 0xd0, 0xd6, 0xf2, 0x01, 0x10, 0xd9, 0xa3, 0x14, 0x00,
+  0xb8, 0x12, 0x51, 0xd3, 0xd6, 0xd9, 0xd6, 0xd3, 0x7f, 0x0a, 0x01, 0x8d, 0x04, 0x31, 0xe1, 0xe3, 0xef, 0x00, 0x0f, 0x00, 0xfa, 0x0b, 0x01, 0xc5,
+  0x03, 0x00, 0xdd, 0x01, 0x00, 0xf6, 0x05, 0x01, 0x01, 0x00, 0x13, 0xe7, 0x06, 0x02, 0x03, 0x01, 0x00, 0x01, 0xc3, 0x00, 0x00, 0x16, 0x06, 0x00,
+  0xef, 0x01, 0x12, 0xf5, 0x95, 0x04, 0x02, 0x97, 0x01, 0x01, 0x02, 0x00, 0xd4, 0xe7, 0xe4, 0xd6, 0xe2, 0xe4, 0xe2, 0xd4, 0xc4, 0xbe, 0xcc, 0xe6,
+  0xe7, 0xfa, 0x8d, 0x0d, 0x00, 0x91, 0x01, 0x01, 0x05, 0x00, 0x00, 0xf2, 0x01, 0x01, 0xf4, 0x01, 0x02, 0x08, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x3d,
+  0x02, 0x01, 0x42, 0x00, 0x00, 0x07, 0x00, 0x00, 0x55, 0x00, 0x20, 0xf5, 0xf4, 0x9e, 0x14, 0x02, 0xdf, 0x01, 0x30, 0xe9, 0xe9, 0xe9, 0x65, 0x02,
+  0x00, 0xe7, 0x06, 0x00, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x23, 0x03, 0x00, 0x2b, 0x00, 0x02, 0x34, 0x00, 0x02, 0x34, 0x03, 0x03, 0x0b, 0x00,
+  0x02, 0x08, 0x00, 0x11, 0xf2, 0x06, 0x00, 0x03, 0x01, 0x00, 0x00, 0x73, 0x00, 0x03, 0x02, 0x00, 0x02, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07,
+  0x00, 0x03, 0xf4, 0x01, 0x00, 0x67, 0x05, 0x00, 0x8c, 0x0a, 0x30, 0xf6, 0xf6, 0xfb, 0x4b, 0x06, 0x00, 0x02, 0x00, 0x00, 0xfe, 0x01, 0x01, 0x02,
+  0x00, 0x21, 0xe4, 0xe5, 0xff, 0x03, 0x13, 0xe5, 0x6f, 0x02, 0x02, 0xc0, 0x03, 0x01, 0xc7, 0x0a, 0x20, 0xf3, 0xe4, 0x73, 0x01, 0x01, 0x01, 0x00,
+  0x00, 0x3f, 0x01, 0x02, 0xeb, 0x01, 0x00, 0xd2, 0x03, 0x60, 0xf0, 0xe4, 0xe5, 0xf2, 0xe7, 0xe7, 0xd4, 0x03, 0x01, 0xa9, 0x00, 0x01, 0xd2, 0x00,
+  0x00, 0x75, 0x0c, 0x40, 0xe7, 0xf2, 0xe5, 0xe4, 0x28, 0x00, 0x00, 0x01, 0x00, 0x00, 0xaa, 0x01, 0x00, 0x6a, 0x08, 0x21, 0xde, 0xdc, 0x05, 0x00,
+  0x00, 0x7c, 0x08, 0x10, 0xdf, 0xc0, 0x03, 0x00, 0xbe, 0x03, 0x61, 0xf6, 0xf6, 0xe7, 0xef, 0xdc, 0xde, 0x02, 0x00, 0x31, 0xdd, 0xda, 0xdd, 0xfd,
+  0x01, 0x20, 0xde, 0xdc, 0x21, 0x00, 0x00, 0x08, 0x00, 0x15, 0xdd, 0xdf, 0x01, 0x02, 0xd5, 0x01, 0x12, 0xd3, 0x07, 0x00, 0x00, 0x97, 0x0a, 0xb0,
+  0xd0, 0xc9, 0xd1, 0xd3, 0xd8, 0xd3, 0xd8, 0xd0, 0xd1, 0xcc, 0xd1, 0x11, 0x00, 0x30, 0xd0, 0xd1, 0xd0, 0x06, 0x00, 0x01, 0x1b, 0x00, 0x00, 0x01,
+  0x00, 0x30, 0xd0, 0xcc, 0xdc, 0xa5, 0x02, 0x20, 0xf7, 0xe9, 0xdf, 0x01, 0x01, 0xe0, 0x01, 0xa0, 0xf6, 0xf2, 0xe2, 0xe2, 0xe3, 0xe6, 0xe4, 0xe3,
+  0xe3, 0xe4, 0x05, 0x00, 0x01, 0x07, 0x00, 0x10, 0xe6, 0x01, 0x00, 0x01, 0xf6, 0x05, 0x01, 0x02, 0x00, 0x30, 0xe7, 0xe8, 0xf3, 0xd2, 0x09, 0x00,
+  0xff, 0x09, 0x01, 0xcf, 0x00, 0x00, 0x86, 0x01, 0xe1, 0xf3, 0xf5, 0xf3, 0xe7, 0xe2, 0xcc, 0xd0, 0xde, 0xe4, 0xe2, 0xc9, 0xbe, 0xd9, 0xe6, 0xbc,
+  0x01, 0x00, 0xc3, 0x01, 0x00, 0x67, 0x01, 0x00, 0x5d, 0x01, 0x00, 0xc1, 0x14, 0x02, 0xd9, 0x01, 0x01, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0xeb, 0x02, 0x00, 0x05, 0x00, 0x01, 0x17, 0x04, 0x01, 0x30, 0x08, 0x00, 0x7f, 0x07, 0x04, 0x12, 0x08, 0x11, 0xf6, 0xce, 0x11, 0x00,
+  0x84, 0x01, 0x01, 0x1f, 0x0c, 0x00, 0x03, 0x00, 0x05, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x28, 0x03, 0x04, 0x01, 0x00, 0x02, 0x14, 0x00, 0x00,
+  0x47, 0x00, 0x07, 0x16, 0x00, 0x01, 0x5b, 0x00, 0x00, 0x02, 0x00, 0x20, 0xf3, 0xe8, 0x76, 0x01, 0x00, 0x09, 0x00, 0x09, 0x01, 0x00, 0x01, 0xc9,
+  0x0e, 0x00, 0x1a, 0x05, 0x20, 0xe8, 0xf2, 0x89, 0x01, 0x00, 0xa7, 0x00, 0x02, 0x08, 0x00, 0x11, 0xe4, 0xc8, 0x05, 0x24, 0xe4, 0xf1, 0x3c, 0x0e,
+  0x00, 0x9c, 0x17, 0x00, 0xea, 0x03, 0x02, 0xc0, 0x03, 0x01, 0x56, 0x03, 0x0a, 0x01, 0x00, 0x03, 0xb8, 0x07, 0x00, 0x10, 0x06, 0x10, 0xe5, 0x59,
+  0x00, 0x02, 0x7d, 0x09, 0x10, 0xf5, 0x21, 0x01, 0x20, 0xe8, 0xf2, 0xe2, 0x01, 0x60, 0xdf, 0xe1, 0xe0, 0xe1, 0xe0, 0xe1, 0x87, 0x11, 0x00, 0xe5,
+  0x01, 0x22, 0xde, 0xdc, 0x04, 0x00, 0x00, 0x0d, 0x00, 0x01, 0xc0, 0x03, 0x00, 0x5b, 0x00, 0x23, 0xf2, 0xe1, 0xfe, 0x0d, 0x20, 0xdc, 0xdd, 0xc6,
+  0x05, 0x02, 0x0b, 0x00, 0x00, 0x22, 0x00, 0x33, 0xdc, 0xde, 0xda, 0xdd, 0x01, 0x00, 0xc0, 0x03, 0x04, 0x01, 0x00, 0x60, 0xd4, 0xd3, 0xd0, 0xd4,
+  0xd0, 0xd1, 0x3e, 0x10, 0x90, 0xd0, 0xd1, 0xd3, 0xd4, 0xd1, 0xd0, 0xd1, 0xd0, 0xd4, 0x11, 0x00, 0x00, 0x02, 0x00, 0x20, 0xd1, 0xd1, 0x4c, 0x10,
+  0x00, 0x36, 0x12, 0x32, 0xce, 0xd0, 0xd0, 0x12, 0x14, 0x03, 0xdf, 0x01, 0x00, 0x68, 0x00, 0x20, 0xe1, 0xd6, 0xb0, 0x0c, 0x70, 0xd6, 0xd6, 0xde,
+  0xde, 0xd0, 0xd0, 0xc9, 0xfa, 0x17, 0xf0, 0x0c, 0xd0, 0xcc, 0xd8, 0xd0, 0xd0, 0xd0, 0xdd, 0xda, 0xda, 0xdd, 0xe4, 0xe0, 0xdf, 0xe0, 0xdc, 0xd9,
+  0xe2, 0xe4, 0xe8, 0xe8, 0xf5, 0xe5, 0xe5, 0xe6, 0xe5, 0xe6, 0xe7, 0x02, 0x00, 0x20, 0xe7, 0xe8, 0x15, 0x0e, 0xd0, 0xf3, 0xf3, 0xe7, 0xe0, 0xc6,
+  0xc9, 0xd0, 0xe0, 0xe3, 0xe0, 0xc8, 0xda, 0xe7, 0xc3, 0x02, 0x01, 0x58, 0x01, 0x02, 0xe1, 0x01, 0x04, 0x01, 0x00, 0x02, 0xd5, 0x01, 0x01, 0x01,
+  0x00, 0x00, 0x21, 0x00, 0x01, 0x04, 0x00, 0x01, 0x2b, 0x00, 0x00, 0x0b, 0x01, 0x00, 0xc7, 0x01, 0x11, 0xf6, 0xda, 0x01, 0x03, 0x04, 0x00, 0x02,
+  0x11, 0x05, 0x00, 0x28, 0x10, 0x00, 0x06, 0x00, 0x10, 0xfb, 0x07, 0x00, 0x11, 0xf6, 0x34, 0x08, 0x03, 0xee, 0x01, 0x00, 0x14, 0x00, 0x00, 0x38,
+  0x00, 0x00, 0x0d, 0x00, 0x00, 0xfa, 0x08, 0x01, 0x43, 0x00, 0x20, 0xf4, 0xf6, 0xe4, 0x0d, 0x01, 0x0b, 0x00, 0x01, 0x12, 0x00, 0x03, 0x5c, 0x00,
+  0x02, 0x02, 0x00, 0x01, 0x05, 0x00, 0x00, 0x14, 0x00, 0x00, 0x94, 0x02, 0x20, 0xf4, 0xe8, 0x27, 0x00, 0x00, 0x29, 0x00, 0x22, 0xfb, 0xf5, 0x0b,
+  0x04, 0x00, 0x28, 0x04, 0x01, 0xfa, 0x0e, 0x10, 0xe8, 0xac, 0x01, 0x41, 0xef, 0xe3, 0xf0, 0xe5, 0x1b, 0x01, 0x00, 0x18, 0x01, 0x20, 0xe9, 0xe9,
+  0x3c, 0x0b, 0x00, 0x23, 0x0e, 0x00, 0xc0, 0x03, 0x10, 0xe0, 0xd3, 0x01, 0x08, 0x01, 0x00, 0x05, 0xf2, 0x01, 0x60, 0xe2, 0xef, 0xef, 0xef, 0xe5,
+  0xf2, 0x47, 0x00, 0x01, 0x63, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xfe, 0x13, 0x20, 0xf2, 0xe4, 0xbc, 0x03, 0x60, 0xe1, 0xdf, 0xe0, 0xe1, 0xdf, 0xdd,
+  0xb9, 0x03, 0x00, 0x02, 0x00, 0x00, 0xc3, 0x03, 0x51, 0xdf, 0xdd, 0xdc, 0xdf, 0xe1, 0xc0, 0x03, 0x51, 0xfb, 0xf5, 0xf4, 0xe5, 0xe1, 0xd5, 0x01,
+  0x21, 0xda, 0xdd, 0xe6, 0x01, 0x30, 0xdc, 0xdc, 0xdd, 0x37, 0x0c, 0x60, 0xdd, 0xdc, 0xdf, 0xde, 0xdd, 0xda, 0xd9, 0x01, 0x10, 0xd8, 0xa7, 0x03,
+  0x12, 0xd9, 0xba, 0x03, 0xf1, 0x00, 0xd8, 0xd3, 0xd4, 0xd3, 0xd3, 0xd3, 0xd1, 0xd3, 0xd4, 0xd3, 0xd1, 0xd3, 0xd1, 0xd4, 0xd3, 0xd5, 0x01, 0x01,
+  0x30, 0x1a, 0x00, 0xf0, 0x01, 0x00, 0xf2, 0x01, 0x00, 0xf3, 0x01, 0x80, 0xd3, 0xd1, 0xce, 0xd1, 0xca, 0xca, 0xd0, 0xe0, 0xc5, 0x00, 0x03, 0x26,
+  0x0d, 0x00, 0x03, 0x0c, 0x20, 0xe8, 0xdf, 0x77, 0x10, 0x50, 0xca, 0xd0, 0xdd, 0xdd, 0xd0, 0x22, 0x16, 0x00, 0x48, 0x14, 0x10, 0xc6, 0x66, 0x16,
+  0x20, 0xca, 0xce, 0x2d, 0x16, 0xf0, 0x06, 0xd1, 0xd3, 0xce, 0xc9, 0xd0, 0xd8, 0xde, 0xe6, 0xe7, 0xef, 0xd9, 0xd0, 0xd3, 0xd3, 0xdb, 0xd0, 0xca,
+  0xd3, 0xd8, 0xd6, 0xe5, 0xa4, 0x01, 0xe1, 0xf3, 0xf3, 0xe6, 0xde, 0xc9, 0xc6, 0xce, 0xd1, 0xde, 0xe4, 0xe2, 0xef, 0xe7, 0xe8, 0xc0, 0x05, 0x00,
+  0x37, 0x03, 0x21, 0xe7, 0xf3, 0x05, 0x07, 0x00, 0xd1, 0x01, 0x04, 0x01, 0x00, 0x01, 0x49, 0x03, 0x02, 0x4d, 0x17, 0x03, 0x04, 0x01, 0x03, 0x83,
+  0x01, 0x00, 0x4b, 0x03, 0x01, 0x87, 0x00, 0x03, 0x01, 0x00, 0x01, 0xe1, 0x01, 0x00, 0x02, 0x00, 0x30, 0xfb, 0xf6, 0xf6, 0xd9, 0x09, 0x01, 0x0a,
+  0x00, 0x00, 0xa7, 0x19, 0x01, 0xd3, 0x13, 0x00, 0x41, 0x12, 0x01, 0x34, 0x00, 0x00, 0xd5, 0x01, 0x00, 0xad, 0x0f, 0x01, 0x02, 0x00, 0x01, 0x48,
+  0x00, 0x00, 0x1e, 0x00, 0x00, 0x15, 0x03, 0x00, 0x06, 0x00, 0x14, 0xf5, 0x1b, 0x00, 0x10, 0xf4, 0x35, 0x00, 0x01, 0xcf, 0x01, 0x00, 0x12, 0x00,
+  0x10, 0xf4, 0x27, 0x02, 0x04, 0x02, 0x00, 0x03, 0x80, 0x00, 0x00, 0x02, 0x00, 0x01, 0x47, 0x02, 0x31, 0xf4, 0xe4, 0xef, 0x8c, 0x09, 0x20, 0xf1,
+  0xf5, 0x4d, 0x04, 0x00, 0xbe, 0x03, 0x00, 0xfa, 0x02, 0x00, 0x1f, 0x00, 0x80, 0xf4, 0xe8, 0xf0, 0xe3, 0xe1, 0xe2, 0xef, 0xe2, 0xbc, 0x19, 0x00,
+  0xd0, 0x01, 0x00, 0x01, 0x00, 0x03, 0x9b, 0x03, 0x00, 0xc0, 0x01, 0x00, 0x0f, 0x00, 0x30, 0xef, 0xe4, 0xe5, 0x3b, 0x06, 0x00, 0x2d, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0xc1, 0x02, 0x30, 0xf3, 0xe5, 0xe4, 0xd6, 0x01, 0x22, 0xdf, 0xe0, 0x70, 0x05, 0x20, 0xdf, 0xdf, 0x0b, 0x00, 0x00, 0x9b, 0x03,
+  0x70, 0xdd, 0xdc, 0xdd, 0xdf, 0xe1, 0xe7, 0xf5, 0xd3, 0x00, 0x20, 0xf5, 0xe8, 0xc0, 0x03, 0x00, 0xb3, 0x03, 0x00, 0xc0, 0x11, 0x00, 0x02, 0x02,
+  0x30, 0xdd, 0xdc, 0xdb, 0x0c, 0x00, 0x20, 0xdc, 0xdb, 0xdf, 0x01, 0x00, 0xe0, 0x01, 0x00, 0xd8, 0x01, 0x30, 0xd8, 0xd3, 0xd8, 0x05, 0x00, 0x02,
+  0xe2, 0x01, 0x30, 0xd8, 0xd3, 0xd4, 0xc8, 0x01, 0x71, 0xd4, 0xd8, 0xd3, 0xd1, 0xd1, 0xd0, 0xd4, 0xc4, 0x03, 0x00, 0xbb, 0x03, 0x00, 0x05, 0x00,
+  0x11, 0xce, 0xcc, 0x03, 0x61, 0xca, 0xce, 0xca, 0xd1, 0xe1, 0xf5, 0xc0, 0x00, 0x00, 0x59, 0x01, 0x01, 0x25, 0x0a, 0x20, 0xe7, 0xdf, 0x14, 0x1c,
+  0x80, 0xd0, 0xd4, 0xdd, 0xd0, 0xca, 0xcb, 0xcb, 0xc7, 0x52, 0x14, 0x00, 0x03, 0x00, 0x90, 0xc7, 0xc3, 0xc6, 0xcb, 0xc6, 0xcb, 0xc7, 0xbe, 0xc6,
+  0x5a, 0x14, 0xa0, 0xd0, 0xc9, 0xdd, 0xe7, 0xe6, 0xd9, 0xd0, 0xc6, 0xca, 0xca, 0x4c, 0x1a, 0x21, 0xd0, 0xe2, 0xfd, 0x04, 0x01, 0xc0, 0x12, 0x60,
+  0xc7, 0xca, 0xc6, 0xe0, 0xe6, 0xe5, 0xa1, 0x04, 0x50, 0xf4, 0xf5, 0xf3, 0xe7, 0xe7, 0xd8, 0x05, 0x03, 0xe0, 0x05, 0x12, 0xe7, 0xec, 0x03, 0x01,
+  0xe5, 0x05, 0x00, 0xe6, 0x05, 0x02, 0x01, 0x00, 0x00, 0xeb, 0x07, 0x02, 0xcd, 0x0b, 0x00, 0x05, 0x00, 0x07, 0xe0, 0x01, 0x00, 0x32, 0x03, 0x00,
+  0x8e, 0x00, 0x00, 0x05, 0x00, 0x00, 0xe9, 0x11, 0x00, 0xa1, 0x06, 0x05, 0x09, 0x00, 0x00, 0xbe, 0x0d, 0x00, 0xd9, 0x01, 0x00, 0xf8, 0x02, 0x00,
+  0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0xce, 0x01, 0x01, 0x04, 0x00, 0x11, 0xf6, 0xd3, 0x01, 0x01, 0x0b, 0x00, 0x00, 0x37, 0x01, 0x00, 0x1c, 0x00,
+  0x00, 0x21, 0x02, 0x03, 0x08, 0x00, 0x03, 0x02, 0x00, 0x01, 0x52, 0x01, 0x06, 0x02, 0x00, 0x07, 0x2a, 0x00, 0x50, 0xfb, 0xfb, 0xf5, 0xfb, 0xf5,
+  0xf0, 0x10, 0xf2, 0xf2, 0xf2, 0xf2, 0xe5, 0xe5, 0xf0, 0xe5, 0xf5, 0xf7, 0xf7, 0xf7, 0xe9, 0xf7, 0xe9, 0xf7, 0xf7, 0xe9, 0xe9, 0xf7, 0xfb, 0xf5,
+  0xf4, 0xf5, 0xf4, 0xf5, 0xe8, 0xe5, 0xf0, 0xe3, 0xef, 0x02, 0x00, 0x02, 0x05, 0x00, 0x60, 0xe2, 0xef, 0xe2, 0xe1, 0xe2, 0xe1, 0x01, 0x00, 0xf0,
+  0x08, 0xe0, 0xe1, 0xe1, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe1, 0xe1, 0xef, 0xe5, 0xe5, 0xe7, 0xe7, 0xf3, 0xe8, 0xf3, 0xe8, 0xf4, 0xf3, 0xf3, 0xf4,
+  0x05, 0x00, 0x54, 0xf3, 0xf3, 0xe5, 0xef, 0xdf, 0x01, 0x00, 0x00, 0x24, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x29, 0xde, 0xdf, 0xde, 0xdf, 0xdd, 0xdc,
+  0xdc, 0xef, 0xf3, 0xf5, 0xfb, 0xf6, 0xfb, 0xf6, 0xf5, 0xf4, 0xe5, 0xdf, 0xdd, 0xdc, 0xdd, 0xdc, 0xdb, 0xda, 0xdb, 0xda, 0xdd, 0xda, 0xdd, 0xdc,
+  0xde, 0xdf, 0xdd, 0xda, 0xde, 0xdc, 0xde, 0xdc, 0xdd, 0xda, 0xdb, 0xd9, 0xd3, 0xd4, 0xd3, 0xd8, 0xd8, 0xdb, 0xd3, 0xd3, 0xd3, 0xd3, 0xdb, 0xd3,
+  0xd8, 0xd3, 0x0e, 0x00, 0x21, 0xd3, 0xd4, 0x06, 0x00, 0x70, 0xd8, 0xd8, 0xd3, 0xd1, 0xd1, 0xd1, 0xd1, 0x0e, 0x00, 0x30, 0xd1, 0xd1, 0xd0, 0x03,
+  0x00, 0x00, 0x05, 0x00, 0x31, 0xce, 0xd0, 0xd1, 0x0b, 0x00, 0xd0, 0xca, 0xca, 0xcb, 0xca, 0xca, 0xd3, 0xe0, 0xf5, 0xe9, 0xf7, 0xf7, 0xfb, 0xe9,
+  0x01, 0x00, 0xf2, 0x03, 0xf7, 0xfb, 0xf7, 0xf7, 0xf6, 0xe7, 0xdf, 0xd1, 0xd1, 0xca, 0xca, 0xd1, 0xde, 0xd4, 0xc6, 0xcb, 0xc6, 0xc7, 0x02, 0x00,
+  0x40, 0xc7, 0xc7, 0xc7, 0xc3, 0x05, 0x00, 0xf0, 0x0a, 0xc7, 0xcb, 0xc7, 0xc6, 0xcb, 0xca, 0xcb, 0xcb, 0xcb, 0xca, 0xd0, 0xde, 0xe6, 0xe6, 0xd0,
+  0xd0, 0xc6, 0xca, 0xcb, 0xcb, 0xc7, 0xc6, 0xca, 0xe3, 0xe7, 0xc4, 0x00, 0xb0, 0xf3, 0xe7, 0xde, 0xc4, 0xc3, 0xbf, 0xc7, 0xca, 0xd0, 0xe3, 0xe6,
+  0x0e, 0x00, 0xd0, 0xf4, 0xf3, 0xe8, 0xe3, 0xcc, 0xc6, 0xc4, 0xca, 0xcb, 0xc4, 0xbe, 0xc4, 0xca, 0x6c, 0x00, 0x00, 0x73, 0x00, 0xf0, 0x14, 0xd1,
+  0xdb, 0xce, 0xd0, 0xdb, 0xe0, 0xe0, 0xde, 0xd8, 0xd4, 0xe0, 0xe2, 0xe2, 0xe2, 0xe2, 0xe0, 0xe3, 0xe6, 0xe6, 0xe6, 0xe4, 0xe6, 0xe7, 0xe6, 0xe7,
+  0xe6, 0xe6, 0xe6, 0xe7, 0xe7, 0xe8, 0xe8, 0xe8, 0xf5, 0xf5, 0x4b, 0x01, 0x03, 0x54, 0x01, 0x52, 0xf7, 0xf7, 0xf6, 0xf6, 0xf5, 0x01, 0x00, 0x73,
+  0xe8, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf5, 0x0f, 0x00, 0x30, 0xf6, 0xf6, 0xfb, 0x0d, 0x00, 0x01, 0x01, 0x00, 0x11, 0xf7, 0x04, 0x00, 0x00, 0x2b,
+  0x00, 0xb1, 0xf6, 0xf6, 0xf6, 0xf5, 0xfb, 0xf5, 0xfb, 0xf6, 0xf6, 0xf7, 0xfb, 0x02, 0x00, 0x20, 0xf6, 0xf6, 0x04, 0x00, 0x00, 0x1e, 0x00, 0x30,
+  0xfb, 0xf7, 0xfb, 0x28, 0x00, 0x01, 0x14, 0x00, 0x00, 0x2b, 0x00, 0x20, 0xf7, 0xf6, 0x52, 0x01, 0x01, 0x46, 0x00, 0x01, 0x13, 0x00, 0x21, 0xf6,
+  0xfb, 0x39, 0x00, 0x02, 0x27, 0x00, 0xf1, 0x00, 0xfb, 0xfb, 0xf5, 0xfb, 0xf3, 0xf4, 0xf5, 0xf3, 0xf3, 0xf2, 0xe5, 0xf1, 0xf6, 0xf6, 0xf7, 0x18,
+  0x01, 0x41, 0xe9, 0xf7, 0xe9, 0xfb, 0x25, 0x00, 0x71, 0xf4, 0xe8, 0xf2, 0xe4, 0xe4, 0xef, 0xe4, 0xdd, 0x01, 0x34, 0xe3, 0xef, 0xe3, 0x09, 0x00,
+  0x62, 0xe2, 0xef, 0xe2, 0xef, 0xe0, 0xef, 0xe9, 0x01, 0xc0, 0xe1, 0xe1, 0xe1, 0xef, 0xe4, 0xf0, 0xe5, 0xf2, 0xe7, 0xf3, 0xe7, 0xf3, 0xe4, 0x01,
+  0x81, 0xe8, 0xf3, 0xe8, 0xe7, 0xe5, 0xe1, 0xdf, 0xdc, 0xcf, 0x01, 0x60, 0xdf, 0xde, 0xe1, 0xe0, 0xdf, 0xe0, 0x04, 0x00, 0x00, 0xec, 0x01, 0x01,
+  0xe5, 0x01, 0x30, 0xef, 0xe7, 0xf5, 0x8f, 0x00, 0xb2, 0xf5, 0xe8, 0xe7, 0xdf, 0xdc, 0xdd, 0xdc, 0xdd, 0xda, 0xdd, 0xd9, 0xe1, 0x01, 0x00, 0x02,
+  0x00, 0x80, 0xde, 0xdc, 0xdd, 0xdd, 0xda, 0xd8, 0xd9, 0xd8, 0xcb, 0x01, 0x40, 0xd9, 0xd8, 0xd3, 0xd3, 0xde, 0x01, 0x01, 0xe1, 0x01, 0x02, 0x02,
+  0x00, 0x80, 0xd8, 0xd8, 0xdb, 0xd8, 0xd3, 0xd1, 0xd0, 0xd0, 0xe1, 0x01, 0x00, 0x5e, 0x01, 0x62, 0xd0, 0xce, 0xd1, 0xce, 0xd0, 0xce, 0x06, 0x00,
+  0x10, 0xca, 0xf9, 0x01, 0x60, 0xca, 0xca, 0xc6, 0xd0, 0xe2, 0xf5, 0xf9, 0x00, 0x01, 0xc7, 0x00, 0x00, 0x01, 0x00, 0xf0, 0x04, 0xf5, 0xe6, 0xdc,
+  0xd3, 0xd1, 0xce, 0xd0, 0xdb, 0xd4, 0xca, 0xc7, 0xc6, 0xc7, 0xcb, 0xcb, 0xcb, 0xcb, 0xc7, 0xc7, 0xe2, 0x01, 0xf1, 0x06, 0xc3, 0xc7, 0xc3, 0xc3,
+  0xc6, 0xc7, 0xc3, 0xc6, 0xc7, 0xce, 0xc7, 0xc7, 0xc6, 0xcb, 0xce, 0xca, 0xd1, 0xd9, 0xe6, 0xe2, 0xd1, 0x21, 0x00, 0x31, 0xc6, 0xca, 0xe2, 0xcf,
+  0x01, 0xb3, 0xf3, 0xe7, 0xdd, 0xc4, 0xbf, 0xbf, 0xc3, 0xc7, 0xc4, 0xd4, 0xe4, 0xf0, 0x01, 0xf0, 0x27, 0xe0, 0xca, 0xcb, 0xbb, 0xbb, 0xbf, 0xbb,
+  0xbb, 0xbb, 0xbf, 0xcb, 0xcb, 0xc6, 0xcb, 0xc6, 0xbe, 0xc3, 0xc4, 0xc6, 0xce, 0xc4, 0xc3, 0xc6, 0xd1, 0xca, 0xd0, 0xc6, 0xc4, 0xca, 0xd0, 0xd0,
+  0xd0, 0xc9, 0xca, 0xd3, 0xd9, 0xd3, 0xd0, 0xd3, 0xd9, 0xd9, 0xdc, 0xdd, 0xdc, 0xd3, 0xd6, 0xde, 0xdf, 0xdf, 0xdf, 0xdc, 0xe1, 0xf0, 0xf6, 0x4d,
+  0x01, 0x10, 0xf7, 0x6a, 0x02, 0xf0, 0x0b, 0xe9, 0xf7, 0xf6, 0xf5, 0xf3, 0xe4, 0xef, 0xe4, 0xf0, 0xe4, 0xe4, 0xef, 0xef, 0xe4, 0xe5, 0xe5, 0xe5,
+  0xe5, 0xf2, 0xe5, 0xe5, 0xe7, 0xf2, 0xe5, 0xe7, 0xe7, 0x3b, 0x01, 0x20, 0xe8, 0xf3, 0x10, 0x02, 0x00, 0x13, 0x02, 0x00, 0xfc, 0x01, 0x00, 0xfd,
+  0x01, 0x02, 0x01, 0x00, 0x10, 0xf6, 0x0c, 0x00, 0x03, 0x01, 0x00, 0x01, 0x0b, 0x00, 0x11, 0xf7, 0xd1, 0x01, 0x01, 0xc7, 0x01, 0x02, 0xdc, 0x01,
+  0x10, 0xf7, 0xf0, 0x00, 0x04, 0x0b, 0x00, 0x00, 0x15, 0x00, 0x00, 0x05, 0x00, 0x02, 0x1c, 0x00, 0x01, 0x18, 0x02, 0xb0, 0xfb, 0xf6, 0xf6, 0xf4,
+  0xf5, 0xf4, 0xf4, 0xe8, 0xf3, 0xf3, 0xe8, 0xbf, 0x03, 0x00, 0x19, 0x01, 0x32, 0xe9, 0xe9, 0xe9, 0xdf, 0x01, 0xf0, 0x03, 0xf5, 0xf4, 0xe5, 0xf1,
+  0xe3, 0xf0, 0xe3, 0xf0, 0xe4, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xf0, 0xe3, 0xe4, 0xe3, 0x01, 0x00, 0x01, 0xe4, 0x01, 0x00, 0x02, 0x00, 0x00, 0xcd,
+  0x03, 0x40, 0xe0, 0xe1, 0xdf, 0xe1, 0xc6, 0x03, 0x00, 0xb3, 0x00, 0x20, 0xe8, 0xf3, 0x46, 0x00, 0x41, 0xe7, 0xf2, 0xe5, 0xe3, 0xd0, 0x01, 0x30,
+  0xde, 0xdf, 0xdc, 0xd4, 0x01, 0x00, 0x02, 0x00, 0x01, 0x05, 0x00, 0x50, 0xe0, 0xe1, 0xde, 0xdf, 0xdf, 0xc0, 0x03, 0xf0, 0x01, 0xfb, 0xf6, 0xf5,
+  0xf5, 0xf4, 0xe7, 0xdf, 0xdd, 0xda, 0xdb, 0xdf, 0xdb, 0xda, 0xdd, 0xd9, 0xdd, 0xe1, 0x01, 0x30, 0xda, 0xdd, 0xdf, 0x06, 0x00, 0x40, 0xd8, 0xd9,
+  0xdb, 0xd8, 0xda, 0x01, 0x10, 0xd3, 0xad, 0x03, 0x20, 0xd8, 0xd9, 0x0c, 0x00, 0x00, 0xba, 0x03, 0x00, 0xdf, 0x01, 0x00, 0x08, 0x00, 0x42, 0xd8,
+  0xd4, 0xd3, 0xd4, 0xdd, 0x01, 0x10, 0xd4, 0xd6, 0x01, 0x01, 0xba, 0x03, 0x00, 0x08, 0x00, 0x30, 0xce, 0xca, 0xca, 0x15, 0x00, 0x50, 0xce, 0xce,
+  0xd0, 0xdf, 0xf5, 0xd7, 0x00, 0x01, 0xc5, 0x00, 0x70, 0xf7, 0xf7, 0xf6, 0xfb, 0xe8, 0xe6, 0xda, 0x2d, 0x00, 0x40, 0xdd, 0xca, 0xca, 0xc7, 0xd3,
+  0x01, 0xb1, 0xcb, 0xc6, 0xcb, 0xcb, 0xc3, 0xc3, 0xc3, 0xbf, 0xc3, 0xc7, 0xcb, 0xe8, 0x01, 0xf0, 0x07, 0xcb, 0xcb, 0xc6, 0xc7, 0xc3, 0xc7, 0xce,
+  0xce, 0xd0, 0xce, 0xde, 0xe3, 0xde, 0xc6, 0xc6, 0xbe, 0xc3, 0xc3, 0xc7, 0xca, 0xe3, 0xe8, 0xdf, 0x01, 0xd0, 0xe8, 0xe6, 0xdd, 0xca, 0xbf, 0xbf,
+  0xc3, 0xcb, 0xc4, 0xc6, 0xdf, 0xe7, 0xf2, 0xe0, 0x01, 0x70, 0xe6, 0xdd, 0xbe, 0xc3, 0xbf, 0xc3, 0xbf, 0xe1, 0x01, 0x90, 0xc3, 0xc3, 0xc3, 0xc7,
+  0xc7, 0xc3, 0xc6, 0xcb, 0xce, 0x54, 0x00, 0x20, 0xcb, 0xcb, 0x59, 0x00, 0xc1, 0xca, 0xd0, 0xce, 0xc4, 0xcb, 0xd0, 0xce, 0xc6, 0xca, 0xd0, 0xd3,
+  0xd1, 0xa1, 0x00, 0x60, 0xd0, 0xd0, 0xd9, 0xd3, 0xd0, 0xd9, 0x8e, 0x00, 0x41, 0xe9, 0xf7, 0xf7, 0xf5, 0xe0, 0x01, 0xf0, 0x02, 0xfb, 0xe8, 0xef,
+  0xda, 0xda, 0xdc, 0xde, 0xdc, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xdf, 0xdf, 0xdf, 0xe1, 0x03, 0x02, 0x80, 0xdc, 0xdc, 0xdc, 0xdf, 0xdf, 0xe1, 0xe1,
+  0xe1, 0x05, 0x00, 0x10, 0xef, 0x47, 0x01, 0x41, 0xef, 0xe4, 0xe3, 0xe4, 0xff, 0x01, 0x01, 0x05, 0x00, 0x00, 0x1d, 0x05, 0x00, 0x03, 0x02, 0x60,
+  0xe7, 0xe7, 0xe7, 0xe8, 0xe7, 0xf3, 0x01, 0x02, 0x00, 0x01, 0x00, 0x02, 0x05, 0x02, 0x00, 0xfd, 0x01, 0x01, 0xf4, 0x01, 0x02, 0xfd, 0x03, 0x00,
+  0xcf, 0x02, 0x00, 0xfc, 0x00, 0x00, 0x02, 0x02, 0x01, 0x0e, 0x00, 0x00, 0xbf, 0x04, 0x01, 0xe8, 0x01, 0x10, 0xf4, 0x8b, 0x05, 0x10, 0xf4, 0x85,
+  0x00, 0x00, 0xdb, 0x01, 0x01, 0x04, 0x00, 0x00, 0xd7, 0x03, 0x20, 0xf4, 0xf6, 0xc0, 0x03, 0x01, 0x72, 0x00, 0x00, 0xc4, 0x03, 0x20, 0xf0, 0xe3,
+  0x0a, 0x00, 0x10, 0xe4, 0xf0, 0x01, 0x13, 0xe3, 0xb6, 0x05, 0x00, 0xc9, 0x03, 0x01, 0x9e, 0x03, 0x10, 0xe0, 0xb1, 0x05, 0x20, 0xef, 0xe4, 0x93,
+  0x02, 0x50, 0xe5, 0xe5, 0xe4, 0xe4, 0xef, 0xdd, 0x01, 0x02, 0x02, 0x00, 0x00, 0x1d, 0x00, 0x02, 0x05, 0x00, 0x00, 0xc8, 0x03, 0x00, 0xc0, 0x03,
+  0x01, 0x78, 0x04, 0x70, 0xf5, 0xe8, 0xe5, 0xe1, 0xdc, 0xdd, 0xd9, 0xa1, 0x05, 0x00, 0xd7, 0x01, 0x30, 0xdb, 0xda, 0xdb, 0xc2, 0x03, 0x21, 0xda,
+  0xdb, 0xd2, 0x01, 0x10, 0xd8, 0xdc, 0x01, 0x00, 0xc6, 0x03, 0x40, 0xdb, 0xd8, 0xd9, 0xd4, 0xc3, 0x03, 0x00, 0x02, 0x00, 0x00, 0xc0, 0x03, 0x00,
+  0xee, 0x01, 0x40, 0xd1, 0xd3, 0xd4, 0xd4, 0xc5, 0x03, 0x01, 0xc1, 0x03, 0x00, 0xbc, 0x01, 0x51, 0xd1, 0xce, 0xd1, 0xce, 0xce, 0xc1, 0x03, 0x63,
+  0xca, 0xce, 0xca, 0xd3, 0xe2, 0xe8, 0x86, 0x04, 0x01, 0x38, 0x03, 0x10, 0xf5, 0xe0, 0x01, 0x50, 0xd0, 0xd3, 0xdd, 0xd4, 0xca, 0xd1, 0x01, 0x00,
+  0xd0, 0x01, 0x30, 0xcb, 0xc7, 0xcb, 0xbd, 0x03, 0x00, 0xc3, 0x03, 0x40, 0xc7, 0xcb, 0xc7, 0xca, 0xac, 0x05, 0x00, 0xcb, 0x03, 0xb0, 0xc6, 0xc4,
+  0xdd, 0xe3, 0xd1, 0xc6, 0xc3, 0xc3, 0xc7, 0xcb, 0xd0, 0xa0, 0x05, 0xf0, 0x10, 0xf4, 0xf3, 0xf2, 0xe6, 0xdd, 0xc3, 0xbe, 0xbf, 0xbf, 0xc3, 0xc3,
+  0xce, 0xdd, 0xe7, 0xe7, 0xf3, 0xf3, 0xf2, 0xf3, 0xe6, 0xdd, 0xc6, 0xbf, 0xbf, 0xbf, 0xbb, 0xbf, 0xbb, 0xbf, 0xbf, 0xbf, 0xe8, 0x01, 0x10, 0xbf,
+  0x39, 0x00, 0xf0, 0x02, 0xc3, 0xbf, 0xc3, 0xc3, 0xc7, 0xc3, 0xc6, 0xc3, 0xcb, 0xce, 0xce, 0xd1, 0xc3, 0xc7, 0xcb, 0xca, 0xcb, 0xb8, 0x05, 0x00,
+  0xdd, 0x01, 0x80, 0xd1, 0xd0, 0xce, 0xd3, 0xd1, 0xd3, 0xd3, 0xe1, 0x34, 0x03, 0xf0, 0x00, 0xf7, 0xfb, 0xfb, 0xfb, 0xf6, 0xe9, 0xe9, 0xf7, 0xf5,
+  0xe8, 0xe1, 0xd9, 0xd8, 0xd9, 0xdd, 0xa0, 0x04, 0x00, 0xb5, 0x04, 0x00, 0xe1, 0x04, 0x00, 0xf3, 0x00, 0xd0, 0xda, 0xdb, 0xda, 0xde, 0xdc, 0xdc,
+  0xda, 0xdc, 0xda, 0xdc, 0xdd, 0xdc, 0xdc, 0xf7, 0x03, 0x00, 0xfb, 0x01, 0x10, 0xe2, 0xf2, 0x01, 0x00, 0xf4, 0x01, 0x00, 0x01, 0x00, 0x02, 0x07,
+  0x00, 0x18, 0xef, 0x01, 0x00, 0x40, 0xe4, 0xe4, 0xf0, 0xe5, 0x04, 0x00, 0x70, 0xe5, 0xf2, 0xf2, 0xe7, 0xe5, 0xf2, 0xe5, 0x05, 0x00, 0x10, 0xf2,
+  0x5f, 0x07, 0x00, 0xc6, 0x03, 0x32, 0xf7, 0xf6, 0xf3, 0x13, 0x04, 0x30, 0xf3, 0xf3, 0xf3, 0x24, 0x06, 0x40, 0xf5, 0xe8, 0xf4, 0xf4, 0xe3, 0x01,
+  0x21, 0xf6, 0xf6, 0x27, 0x06, 0x00, 0xe1, 0x01, 0x03, 0xd6, 0x03, 0x40, 0xf5, 0xf3, 0xe5, 0xf0, 0x95, 0x05, 0x00, 0xc0, 0x03, 0x10, 0xe4, 0xc7,
+  0x03, 0x10, 0xe4, 0xc5, 0x03, 0x00, 0x01, 0x00, 0x01, 0xec, 0x01, 0x01, 0xcb, 0x03, 0x31, 0xe2, 0xe1, 0xe1, 0xae, 0x03, 0x00, 0xc7, 0x03, 0x40,
+  0xef, 0xe2, 0xef, 0xef, 0x85, 0x02, 0x00, 0x13, 0x00, 0x00, 0xcd, 0x01, 0x20, 0xe0, 0xdf, 0x09, 0x00, 0x00, 0x20, 0x00, 0x02, 0x07, 0x00, 0x60,
+  0xe0, 0xdf, 0xdf, 0xef, 0xe8, 0xf5, 0x3c, 0x02, 0x00, 0x80, 0x07, 0x11, 0xde, 0xdb, 0x01, 0x90, 0xdd, 0xdd, 0xde, 0xdd, 0xdb, 0xda, 0xdb, 0xdb,
+  0xdd, 0xde, 0x01, 0x10, 0xdb, 0xb3, 0x03, 0x01, 0xa9, 0x03, 0x04, 0xd2, 0x01, 0x20, 0xd8, 0xd4, 0x05, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x17, 0x00,
+  0x23, 0xd4, 0xd8, 0x7b, 0x07, 0x50, 0xd1, 0xd0, 0xce, 0xca, 0xce, 0x94, 0x05, 0x20, 0xd1, 0xd1, 0xe5, 0x01, 0x60, 0xca, 0xca, 0xcb, 0xce, 0xd4,
+  0xd4, 0xf0, 0x01, 0x00, 0xe0, 0x01, 0x01, 0x7f, 0x07, 0x00, 0xdf, 0x01, 0xb0, 0xf7, 0xf5, 0xe8, 0xe7, 0xdb, 0xd0, 0xd0, 0xd8, 0xde, 0xd0, 0xcb,
+  0xa0, 0x05, 0x00, 0xc1, 0x03, 0x00, 0xe8, 0x01, 0x00, 0xdf, 0x01, 0x00, 0x0d, 0x00, 0x02, 0xef, 0x01, 0x00, 0x0b, 0x00, 0xd1, 0xc3, 0xcb, 0xc6,
+  0xcb, 0xdd, 0xe3, 0xcb, 0xc4, 0xc7, 0xc7, 0xbf, 0xc6, 0xe0, 0x19, 0x01, 0xe0, 0xf2, 0xe6, 0xd8, 0xbe, 0xbf, 0xc3, 0xc3, 0xbf, 0xbb, 0xbe, 0xd9,
+  0xe6, 0xf3, 0xf2, 0xd0, 0x03, 0x31, 0xdb, 0xc3, 0xbb, 0x01, 0x00, 0x00, 0xdf, 0x01, 0x00, 0xd6, 0x01, 0x13, 0xcb, 0x47, 0x00, 0x01, 0x38, 0x02,
+  0xb0, 0xc6, 0xcb, 0xcb, 0xce, 0xcb, 0xc6, 0xc7, 0xcb, 0xce, 0xce, 0xce, 0xc0, 0x03, 0x00, 0x5e, 0x04, 0x00, 0xb0, 0x00, 0x21, 0xdf, 0xe8, 0xa1,
+  0x05, 0x00, 0x28, 0x05, 0x61, 0xf7, 0xfb, 0xf5, 0xf2, 0xe2, 0xd9, 0xd9, 0x00, 0x90, 0xd8, 0xd9, 0xd8, 0xd9, 0xdb, 0xd9, 0xdd, 0xdc, 0xe0, 0xa0,
+  0x06, 0x00, 0x81, 0x08, 0x00, 0x0a, 0x03, 0x30, 0xda, 0xdd, 0xdc, 0xe3, 0x02, 0x00, 0x13, 0x00, 0xa0, 0xdc, 0xde, 0xdc, 0xe1, 0xde, 0xdf, 0xde,
+  0xdc, 0xdf, 0xdc, 0xe4, 0x03, 0x40, 0xe1, 0xdf, 0xe0, 0xe1, 0x0a, 0x05, 0x10, 0xdf, 0x11, 0x07, 0x10, 0xdf, 0x0a, 0x00, 0x00, 0xf1, 0x01, 0x12,
+  0xef, 0x02, 0x00, 0x10, 0xef, 0x78, 0x03, 0x01, 0x09, 0x00, 0x30, 0xe3, 0xef, 0xf2, 0xae, 0x07, 0x00, 0xa1, 0x05, 0x20, 0xe8, 0xf0, 0x18, 0x00,
+  0x00, 0x06, 0x02, 0xd0, 0xef, 0xe3, 0xf0, 0xe4, 0xf0, 0xe4, 0xf4, 0xe8, 0xf4, 0xe8, 0xf4, 0xf4, 0xe8, 0xc0, 0x03, 0x00, 0x8e, 0x00, 0x00, 0xda,
+  0x04, 0x00, 0x83, 0x01, 0x00, 0x80, 0x07, 0x31, 0xe5, 0xe4, 0xef, 0xc6, 0x01, 0x01, 0xc7, 0x03, 0x01, 0x3d, 0x06, 0x21, 0xe4, 0xf0, 0x0a, 0x00,
+  0x10, 0xe3, 0xd5, 0x03, 0x01, 0x1b, 0x00, 0x50, 0xe2, 0xe0, 0xe1, 0xde, 0xe0, 0xa3, 0x00, 0x01, 0xcf, 0x01, 0x30, 0xe1, 0xe0, 0xe1, 0xb7, 0x05,
+  0x11, 0xe1, 0xbb, 0x05, 0x02, 0x0b, 0x00, 0x10, 0xef, 0x04, 0x02, 0x10, 0xdf, 0x10, 0x00, 0x30, 0xe0, 0xdf, 0xe0, 0xe0, 0x01, 0x01, 0xc0, 0x03,
+  0x40, 0xf2, 0xdf, 0xda, 0xdd, 0xd4, 0x01, 0x11, 0xdc, 0x02, 0x00, 0x00, 0xe6, 0x00, 0x30, 0xdd, 0xda, 0xdb, 0xcb, 0x01, 0x00, 0xe0, 0x02, 0x31,
+  0xd8, 0xd3, 0xd1, 0xd4, 0x01, 0x00, 0x03, 0x00, 0x00, 0x12, 0x01, 0x00, 0xdb, 0x01, 0x01, 0xe1, 0x01, 0x10, 0xd8, 0xd2, 0x01, 0x02, 0x01, 0x00,
+  0x40, 0xca, 0xce, 0xd0, 0xd1, 0xed, 0x01, 0x30, 0xce, 0xca, 0xce, 0xc0, 0x03, 0xa0, 0xce, 0xca, 0xd1, 0xce, 0xca, 0xca, 0xd0, 0xe2, 0xe8, 0xf6,
+  0x9f, 0x05, 0x00, 0x01, 0x00, 0x01, 0xe0, 0x01, 0x00, 0xa0, 0x05, 0x51, 0xdd, 0xdd, 0xce, 0xca, 0xc7, 0x7b, 0x07, 0x00, 0x91, 0x01, 0x00, 0xba,
+  0x03, 0x01, 0x98, 0x01, 0x11, 0xc3, 0xdd, 0x01, 0x00, 0x9e, 0x01, 0x00, 0x88, 0x03, 0x50, 0xc6, 0xce, 0xde, 0xde, 0xca, 0x94, 0x07, 0xa1, 0xe2,
+  0xe7, 0xe8, 0xf4, 0xe8, 0xf3, 0xe8, 0xe6, 0xd8, 0xbe, 0xcc, 0x01, 0x30, 0xbb, 0xdb, 0xe6, 0xc0, 0x03, 0x12, 0xe8, 0xc0, 0x03, 0x10, 0xbf, 0x14,
+  0x00, 0x21, 0xc7, 0xc3, 0xe3, 0x01, 0x30, 0xc3, 0xc7, 0xbf, 0xea, 0x05, 0x00, 0x4c, 0x00, 0x00, 0x99, 0x09, 0x42, 0xcb, 0xc6, 0xcb, 0xce, 0xc2,
+  0x03, 0x20, 0xd4, 0xd8, 0x72, 0x02, 0x41, 0xd1, 0xd8, 0xd8, 0xd9, 0xe0, 0x01, 0x00, 0x8b, 0x00, 0x00, 0x2d, 0x06, 0x41, 0xe8, 0xe8, 0xe3, 0xda,
+  0xdd, 0x01, 0xd0, 0xdb, 0xd8, 0xdb, 0xdb, 0xd3, 0xd9, 0xdd, 0xdd, 0xdc, 0xde, 0xde, 0xde, 0xdd, 0xea, 0x01, 0x00, 0x0a, 0x03, 0x30, 0xde, 0xe1,
+  0xde, 0x5f, 0x0a, 0x00, 0xf5, 0x02, 0x00, 0xf8, 0x04, 0x00, 0xdd, 0x03, 0x40, 0xde, 0xde, 0xe0, 0xe0, 0x15, 0x03, 0x00, 0x02, 0x00, 0x00, 0x83,
+  0x0a, 0x00, 0x08, 0x00, 0x00, 0x4c, 0x03, 0x00, 0x65, 0x01, 0x11, 0xdf, 0x5b, 0x01, 0x02, 0x64, 0x01, 0x90, 0xe1, 0xe0, 0xdf, 0xe1, 0xe2, 0xef,
+  0xef, 0xe4, 0xf4, 0x60, 0x09, 0x40, 0xf7, 0xf6, 0xf7, 0xe7, 0x3a, 0x07, 0x01, 0x61, 0x05, 0x01, 0x88, 0x01, 0x20, 0xe1, 0xe8, 0xbe, 0x03, 0x20,
+  0xf5, 0xf4, 0xb4, 0x05, 0x01, 0xdf, 0x01, 0x00, 0x70, 0x02, 0x00, 0x85, 0x01, 0x01, 0xc0, 0x03, 0x01, 0x3c, 0x0b, 0x20, 0xe4, 0xe4, 0x0e, 0x04,
+  0x02, 0xb7, 0x03, 0x01, 0xdd, 0x01, 0x00, 0x3e, 0x00, 0x00, 0x41, 0x00, 0x00, 0x52, 0x0b, 0x01, 0x8e, 0x00, 0x00, 0xdf, 0x01, 0x00, 0xc0, 0x01,
+  0x70, 0xdf, 0xe1, 0xe0, 0xef, 0xe2, 0xef, 0xe3, 0x29, 0x00, 0x02, 0xea, 0x03, 0x02, 0x47, 0x06, 0x00, 0x52, 0x0b, 0x41, 0xe0, 0xdf, 0xe0, 0xdc,
+  0x80, 0x07, 0x00, 0x0c, 0x0a, 0x21, 0xe8, 0xf2, 0xbe, 0x02, 0x10, 0xdb, 0xbc, 0x03, 0x50, 0xdd, 0xdb, 0xdb, 0xd9, 0xdb, 0xc4, 0x03, 0x11, 0xdb,
+  0xc0, 0x03, 0x00, 0x01, 0x00, 0x10, 0xd4, 0x82, 0x07, 0x00, 0x6c, 0x07, 0x00, 0xeb, 0x01, 0x10, 0xd4, 0xad, 0x05, 0x10, 0xd8, 0x99, 0x07, 0x30,
+  0xd8, 0xd4, 0xd3, 0x98, 0x05, 0x41, 0xd1, 0xd1, 0xd4, 0xd4, 0xe2, 0x01, 0x00, 0xe8, 0x01, 0x01, 0x7f, 0x07, 0x02, 0xe5, 0x01, 0x73, 0xd0, 0xce,
+  0xd3, 0xe2, 0xf5, 0xf6, 0xf4, 0x67, 0x06, 0xa0, 0xf7, 0xe9, 0xf5, 0xf4, 0xe7, 0xe7, 0xdd, 0xd0, 0xd1, 0xde, 0x9f, 0x05, 0x01, 0xe0, 0x01, 0x00,
+  0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x85, 0x07, 0x00, 0x9a, 0x01, 0x01, 0x01, 0x00, 0x00, 0xad, 0x05, 0xe0, 0xbe, 0xbf, 0xbe, 0xc3, 0xd1, 0xe3,
+  0xde, 0xcb, 0xc4, 0xc3, 0xca, 0xe2, 0xe8, 0xe8, 0xc2, 0x03, 0x21, 0xe6, 0xd1, 0x6d, 0x07, 0x41, 0xbf, 0xc6, 0xdd, 0xe7, 0x81, 0x07, 0x30, 0xe6,
+  0xde, 0xbc, 0x9f, 0x05, 0x00, 0xbe, 0x03, 0x00, 0x4b, 0x00, 0x00, 0x41, 0x00, 0x01, 0x18, 0x02, 0x10, 0xc7, 0x80, 0x07, 0x01, 0x46, 0x00, 0x70,
+  0xc3, 0xc7, 0xcb, 0xce, 0xc7, 0xca, 0xcb, 0x94, 0x00, 0x00, 0xa3, 0x00, 0x71, 0xd1, 0xd8, 0xd3, 0xdb, 0xe2, 0xe8, 0xf6, 0x8d, 0x00, 0x00, 0x90,
+  0x00, 0x61, 0xfb, 0xe8, 0xf2, 0xe2, 0xda, 0xdb, 0xc3, 0x02, 0x10, 0xdb, 0xc1, 0x03, 0x90, 0xdd, 0xdc, 0xdd, 0xde, 0xde, 0xdd, 0xdd, 0xdb, 0xda,
+  0x03, 0x00, 0x00, 0xed, 0x04, 0x40, 0xe0, 0xdf, 0xde, 0xdc, 0xc9, 0x01, 0x00, 0xcb, 0x01, 0x00, 0x52, 0x01, 0x10, 0xdc, 0xc8, 0x01, 0x00, 0x53,
+  0x01, 0x00, 0x3a, 0x01, 0x01, 0x18, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0a, 0x02, 0x01, 0x19, 0x00, 0x00, 0x02, 0x00, 0x22, 0xdf, 0xe1, 0x0d, 0x00,
+  0x71, 0xdf, 0xe1, 0xe1, 0xe3, 0xef, 0xe5, 0xe8, 0x48, 0x0b, 0x41, 0xf7, 0xf5, 0xe7, 0xef, 0x59, 0x03, 0x02, 0x52, 0x03, 0xa0, 0xe1, 0xe1, 0xe1,
+  0xe8, 0xf5, 0xe8, 0xf4, 0xe8, 0xe8, 0xf3, 0xc0, 0x05, 0x00, 0xe0, 0x01, 0x00, 0x06, 0x00, 0x00, 0x24, 0x07, 0x00, 0xc0, 0x03, 0x10, 0xf2, 0x92,
+  0x05, 0x01, 0xee, 0x05, 0x11, 0xe5, 0xbb, 0x03, 0x20, 0xf0, 0xe4, 0x7d, 0x07, 0x02, 0xc3, 0x03, 0x01, 0xdf, 0x01, 0x00, 0x87, 0x05, 0x02, 0x02,
+  0x00, 0x10, 0xe0, 0xa2, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xc2, 0x03, 0x41, 0xe3, 0xe3, 0xe5, 0xe4, 0x22, 0x08, 0xa0, 0xe6, 0xe7, 0xe7, 0xe7, 0xe5,
+  0xe5, 0xe6, 0xe4, 0xe3, 0xe2, 0x21, 0x00, 0x11, 0xdf, 0x80, 0x07, 0x00, 0xb5, 0x0b, 0x50, 0xf5, 0xe5, 0xe1, 0xde, 0xdc, 0xdd, 0x01, 0x01, 0xdf,
+  0x00, 0x00, 0x39, 0x0b, 0x20, 0xdb, 0xdd, 0xe6, 0x01, 0x10, 0xd8, 0xe3, 0x01, 0x01, 0x83, 0x07, 0x00, 0x96, 0x05, 0x00, 0x08, 0x00, 0x32, 0xd4,
+  0xd4, 0xd3, 0xa4, 0x05, 0x00, 0xe0, 0x01, 0x30, 0xd8, 0xd8, 0xd4, 0xb5, 0x03, 0x00, 0xc1, 0x08, 0x01, 0x06, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x14,
+  0x05, 0x01, 0xe2, 0x01, 0x64, 0xca, 0xce, 0xd1, 0xd3, 0xe3, 0xf5, 0x80, 0x07, 0x01, 0x33, 0x03, 0x10, 0xf3, 0xc0, 0x03, 0x10, 0xe0, 0x9f, 0x05,
+  0x01, 0xe1, 0x01, 0x00, 0x8a, 0x01, 0x00, 0x87, 0x01, 0x00, 0x1a, 0x09, 0x00, 0x0e, 0x00, 0x03, 0x8b, 0x07, 0x00, 0x78, 0x07, 0xb0, 0xc3, 0xc3,
+  0xc4, 0xd4, 0xe4, 0xdb, 0xc6, 0xc3, 0xca, 0xe3, 0xe7, 0xe6, 0x0d, 0x40, 0xe7, 0xe6, 0xca, 0xbe, 0x4c, 0x09, 0x01, 0xe0, 0x01, 0x70, 0xf3, 0xf2,
+  0xf3, 0xe7, 0xe6, 0xde, 0xc6, 0xe0, 0x01, 0x00, 0x32, 0x00, 0x00, 0x76, 0x07, 0x00, 0x3b, 0x00, 0x40, 0xc7, 0xc7, 0xc3, 0xbf, 0x33, 0x02, 0x00,
+  0x0d, 0x00, 0x00, 0x3a, 0x02, 0x73, 0xc3, 0xc7, 0xca, 0xce, 0xc6, 0xcb, 0xce, 0x78, 0x02, 0x56, 0xd8, 0xd3, 0xd8, 0xda, 0xe1, 0xe0, 0x01, 0x61,
+  0xe9, 0xf6, 0xf3, 0xe7, 0xef, 0xdb, 0x50, 0x08, 0x00, 0xfe, 0x0d, 0x10, 0xd9, 0xb7, 0x04, 0x10, 0xdd, 0xbb, 0x04, 0x10, 0xdd, 0xa5, 0x05, 0x00,
+  0xe1, 0x01, 0x41, 0xde, 0xde, 0xde, 0xdc, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x01, 0x02, 0x00, 0x00, 0x32, 0x01, 0x01, 0x02, 0x00, 0x40, 0xe1, 0xe0,
+  0xde, 0xde, 0xf7, 0x01, 0x00, 0x13, 0x00, 0x10, 0xde, 0xe1, 0x01, 0x02, 0x15, 0x00, 0x10, 0xdf, 0xa3, 0x0c, 0x00, 0x09, 0x00, 0x00, 0xa6, 0x03,
+  0x40, 0xef, 0xe4, 0xf4, 0xf5, 0x5a, 0x09, 0x40, 0xf6, 0xf5, 0xe5, 0xef, 0xdb, 0x01, 0x00, 0xde, 0x01, 0x01, 0x1a, 0x00, 0x30, 0xe2, 0xf2, 0xe7,
+  0x18, 0x09, 0x20, 0xf2, 0xe7, 0xc1, 0x03, 0x00, 0xe0, 0x01, 0x00, 0x1a, 0x01, 0x01, 0xdf, 0x01, 0x10, 0xf5, 0x38, 0x0d, 0x10, 0xe7, 0x33, 0x09,
+  0x00, 0xc9, 0x09, 0x00, 0xc8, 0x09, 0x51, 0xe6, 0xf2, 0xe6, 0xf2, 0xe7, 0x02, 0x00, 0x00, 0x16, 0x00, 0x11, 0xe4, 0x6a, 0x07, 0x00, 0x77, 0x00,
+  0x00, 0x9e, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x89, 0x07, 0x00, 0xcc, 0x03, 0x01, 0xe5, 0x01, 0x01, 0x26, 0x04, 0x10, 0xe4, 0x28, 0x00, 0x00, 0xbf,
+  0x07, 0x10, 0xe0, 0x19, 0x00, 0x01, 0xa0, 0x05, 0x00, 0xe2, 0x01, 0x20, 0xe8, 0xe7, 0xaf, 0x02, 0x00, 0xc2, 0x03, 0x20, 0xda, 0xdb, 0xa8, 0x05,
+  0x00, 0xca, 0x03, 0x00, 0xbf, 0x03, 0x01, 0xe0, 0x02, 0x00, 0x93, 0x05, 0x00, 0x07, 0x00, 0x10, 0xdb, 0xbf, 0x03, 0x10, 0xd8, 0x2a, 0x01, 0x01,
+  0x0f, 0x00, 0x00, 0x9a, 0x07, 0x32, 0xd4, 0xd8, 0xd1, 0xe2, 0x01, 0x01, 0xdb, 0x01, 0x03, 0xe1, 0x01, 0x00, 0x0e, 0x00, 0x02, 0x07, 0x00, 0x42,
+  0xd3, 0xe2, 0xf5, 0xf5, 0xa0, 0x05, 0x00, 0xc9, 0x00, 0x90, 0xf5, 0xf5, 0xe7, 0xe6, 0xd9, 0xd0, 0xd4, 0xdd, 0xce, 0xe6, 0x0e, 0x00, 0x82, 0x01,
+  0x00, 0x84, 0x01, 0x00, 0x01, 0x00, 0x00, 0xfb, 0x0a, 0x02, 0x0d, 0x00, 0x03, 0x9f, 0x01, 0x00, 0xe0, 0x01, 0x60, 0xc7, 0xd1, 0xe2, 0xe4, 0xd8,
+  0xca, 0x40, 0x0b, 0x00, 0x02, 0x00, 0x31, 0xe6, 0xd4, 0xbb, 0xd0, 0x01, 0x20, 0xbe, 0xde, 0x80, 0x07, 0x50, 0xf2, 0xf3, 0xe6, 0xe0, 0xca, 0x56,
+  0x09, 0x00, 0x93, 0x07, 0x00, 0x95, 0x05, 0x02, 0xe5, 0x01, 0x00, 0x2d, 0x02, 0x10, 0xcb, 0x3e, 0x00, 0x00, 0x7e, 0x0d, 0x20, 0xce, 0xcb, 0x67,
+  0x09, 0x00, 0xb1, 0x0d, 0x00, 0x5f, 0x04, 0x00, 0x98, 0x02, 0x27, 0xd3, 0xe0, 0xe0, 0x01, 0x50, 0xf4, 0xf5, 0xe7, 0xdf, 0xd9, 0x43, 0x08, 0x00,
+  0x83, 0x06, 0xb1, 0xd9, 0xdb, 0xdd, 0xdb, 0xde, 0xdd, 0xda, 0xdd, 0xde, 0xdd, 0xd8, 0xa7, 0x06, 0x00, 0xa8, 0x01, 0x41, 0xde, 0xdf, 0xde, 0xe0,
+  0x48, 0x01, 0x00, 0xbe, 0x01, 0x21, 0xde, 0xde, 0x51, 0x01, 0x00, 0xbc, 0x03, 0x00, 0x10, 0x00, 0x00, 0xaf, 0x05, 0x10, 0xdd, 0x5e, 0x01, 0x00,
+  0x05, 0x05, 0x00, 0x19, 0x00, 0x00, 0xbb, 0x01, 0x03, 0x10, 0x00, 0x00, 0x0a, 0x00, 0x52, 0xe1, 0xe2, 0xef, 0xe2, 0xf0, 0xc0, 0x03, 0x40, 0xf5,
+  0xf5, 0xe5, 0xe3, 0x97, 0x05, 0x21, 0xe0, 0xe1, 0x86, 0x01, 0x40, 0xe2, 0xe3, 0xe2, 0xe4, 0x74, 0x05, 0x31, 0xef, 0xe4, 0xe5, 0xe0, 0x01, 0x00,
+  0xde, 0x01, 0x03, 0xdf, 0x10, 0x00, 0x63, 0x09, 0x30, 0xe8, 0xf5, 0xe8, 0x81, 0x03, 0x00, 0xdf, 0x01, 0x00, 0x01, 0x00, 0x00, 0xa9, 0x0b, 0x00,
+  0xbb, 0x0f, 0x10, 0xf3, 0x07, 0x00, 0x40, 0xe5, 0xe4, 0xe3, 0xe2, 0x22, 0x06, 0x00, 0x95, 0x00, 0x00, 0x74, 0x00, 0x10, 0xde, 0xc3, 0x03, 0x03,
+  0xc5, 0x03, 0x02, 0x02, 0x00, 0x30, 0xdc, 0xe0, 0xdf, 0xc8, 0x05, 0x51, 0xef, 0xef, 0xe3, 0xe3, 0xe2, 0x77, 0x02, 0x00, 0x60, 0x09, 0x12, 0xf7,
+  0x00, 0x0f, 0x60, 0xe1, 0xde, 0xdc, 0xde, 0xdd, 0xde, 0x77, 0x07, 0x00, 0x6a, 0x06, 0x01, 0x68, 0x08, 0x01, 0xe2, 0x01, 0x00, 0xc9, 0x01, 0x00,
+  0xd9, 0x10, 0x13, 0xd1, 0xd4, 0x01, 0x00, 0xa4, 0x05, 0x00, 0xe7, 0x01, 0x00, 0xb0, 0x05, 0x00, 0xb3, 0x05, 0x00, 0x9b, 0x05, 0x00, 0xbd, 0x03,
+  0x01, 0x46, 0x01, 0x00, 0x02, 0x00, 0x03, 0x51, 0x01, 0x00, 0xea, 0x01, 0x30, 0xd4, 0xd9, 0xe3, 0x81, 0x06, 0x00, 0xdd, 0x01, 0x00, 0xe3, 0x01,
+  0x90, 0xfb, 0xe8, 0xe8, 0xe6, 0xda, 0xd3, 0xdb, 0xdb, 0xce, 0x19, 0x07, 0x00, 0x4c, 0x09, 0x12, 0xce, 0xe5, 0x01, 0x03, 0x09, 0x00, 0x40, 0xc3,
+  0xbf, 0xbe, 0xc3, 0xf9, 0x01, 0x00, 0xa3, 0x01, 0xf2, 0x05, 0xcb, 0xc7, 0xc3, 0xbe, 0xce, 0xde, 0xe6, 0xe4, 0xd1, 0xd0, 0xe3, 0xe8, 0xe8, 0xf4,
+  0xf3, 0xf4, 0xe8, 0xe6, 0xdb, 0xc6, 0x6a, 0x0b, 0x10, 0xdb, 0x40, 0x0b, 0x50, 0xf3, 0xe7, 0xe7, 0xe0, 0xc4, 0x9d, 0x05, 0x01, 0x01, 0x00, 0x00,
+  0xbf, 0x03, 0x00, 0x01, 0x00, 0x01, 0xc3, 0x07, 0x00, 0xc6, 0x07, 0x00, 0x05, 0x00, 0x50, 0xce, 0xcb, 0xce, 0xc6, 0xce, 0x59, 0x09, 0x00, 0x81,
+  0x07, 0x10, 0xdb, 0x8c, 0x02, 0x12, 0xdb, 0x80, 0x07, 0x03, 0x8d, 0x00, 0x40, 0xf6, 0xe8, 0xe7, 0xe2, 0x1f, 0x0c, 0x00, 0xac, 0x02, 0x20, 0xdb,
+  0xdb, 0x38, 0x0c, 0x10, 0xdb, 0x5c, 0x0a, 0x70, 0xd9, 0xdb, 0xde, 0xdd, 0xde, 0xdd, 0xdf, 0x02, 0x00, 0x06, 0xbd, 0x03, 0x20, 0xe0, 0xdc, 0xed,
+  0x11, 0x00, 0x31, 0x01, 0x04, 0x4c, 0x01, 0x32, 0xdd, 0xdc, 0xdd, 0xff, 0x01, 0x22, 0xdf, 0xde, 0x8a, 0x07, 0x00, 0x41, 0x03, 0x50, 0xe0, 0xe0,
+  0xe0, 0xe1, 0xe0, 0xc2, 0x01, 0x20, 0xe2, 0xdf, 0x80, 0x07, 0x10, 0xf3, 0xbe, 0x03, 0x60, 0xf6, 0xf6, 0xe8, 0xe5, 0xef, 0xe2, 0x5d, 0x03, 0x00,
+  0x01, 0x02, 0x30, 0xe2, 0xdf, 0xe3, 0xbb, 0x05, 0x00, 0x4f, 0x07, 0x20, 0xef, 0xe5, 0xfb, 0x11, 0x00, 0xbe, 0x03, 0x01, 0x60, 0x09, 0x10, 0xf4,
+  0xc2, 0x03, 0x80, 0xf5, 0xe8, 0xe8, 0xe7, 0xe8, 0xe7, 0xe7, 0xe6, 0x84, 0x03, 0x10, 0xe4, 0x24, 0x00, 0x10, 0xe3, 0xe8, 0x0e, 0x00, 0x93, 0x0d,
+  0x00, 0x95, 0x03, 0x23, 0xe3, 0xe3, 0x81, 0x00, 0x00, 0x78, 0x00, 0x00, 0x01, 0x00, 0x01, 0xe2, 0x01, 0x03, 0x14, 0x00, 0x00, 0x87, 0x00, 0x00,
+  0x89, 0x00, 0x00, 0x8d, 0x07, 0x10, 0xe3, 0x70, 0x00, 0x00, 0x66, 0x02, 0x22, 0xe0, 0xe1, 0xc0, 0x03, 0x90, 0xfb, 0xf5, 0xf3, 0xe7, 0xe1, 0xdf,
+  0xde, 0xda, 0xde, 0xdc, 0x00, 0x00, 0xe1, 0x01, 0x00, 0x07, 0x00, 0x00, 0x80, 0x07, 0x00, 0xe2, 0x01, 0x02, 0xd1, 0x01, 0x30, 0xd4, 0xd8, 0xd4,
+  0xad, 0x05, 0x30, 0xd8, 0xd1, 0xd3, 0xd0, 0x10, 0x00, 0x12, 0x00, 0x01, 0xf2, 0x01, 0x00, 0x40, 0x0b, 0x03, 0xb3, 0x03, 0x41, 0xd4, 0xd4, 0xd4,
+  0xd8, 0x03, 0x00, 0x00, 0x0d, 0x05, 0x00, 0x17, 0x03, 0x51, 0xd4, 0xd3, 0xd4, 0xd9, 0xe4, 0xe0, 0x01, 0x02, 0x01, 0x00, 0xa1, 0xf7, 0xf6, 0xf5,
+  0xe7, 0xe6, 0xda, 0xd3, 0xde, 0xd4, 0xca, 0x9e, 0x07, 0x01, 0x84, 0x01, 0x00, 0x01, 0x00, 0x01, 0xb8, 0x03, 0x10, 0xce, 0x94, 0x01, 0x00, 0xdd,
+  0x10, 0x00, 0x14, 0x00, 0x00, 0xbe, 0x05, 0x92, 0xc3, 0xc3, 0xca, 0xd3, 0xe0, 0xe7, 0xe0, 0xd2, 0xe4, 0xa6, 0x11, 0x22, 0xe6, 0xdb, 0xdc, 0x03,
+  0x30, 0xc6, 0xdb, 0xe7, 0x8f, 0x07, 0x51, 0xf3, 0xe6, 0xde, 0xca, 0xc7, 0xd2, 0x03, 0x00, 0x03, 0x00, 0x00, 0xe3, 0x01, 0x00, 0x1d, 0x00, 0x00,
+  0xcb, 0x07, 0x01, 0x04, 0x00, 0x00, 0x5e, 0x00, 0x12, 0xc3, 0xc0, 0x03, 0x00, 0x81, 0x02, 0x01, 0xc4, 0x00, 0x32, 0xdb, 0xd8, 0xd8, 0x20, 0x0d,
+  0x00, 0x2b, 0x06, 0xb0, 0xf7, 0xe9, 0xf5, 0xf5, 0xe7, 0xe2, 0xdc, 0xd8, 0xd3, 0xdb, 0xdb, 0x1f, 0x0d, 0x11, 0xd9, 0x31, 0x0c, 0x00, 0x3b, 0x0c,
+  0x00, 0xea, 0x01, 0x20, 0xde, 0xe0, 0xa2, 0x0a, 0x20, 0xdd, 0xde, 0x92, 0x07, 0x00, 0x36, 0x01, 0x01, 0x02, 0x00, 0x32, 0xe0, 0xe0, 0xe0, 0xa4,
+  0x01, 0x01, 0x4e, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x0a, 0x00, 0x00, 0x96, 0x09, 0x02, 0xc0, 0x03, 0x01, 0x1f, 0x00, 0x00, 0x26, 0x05, 0x00, 0x09,
+  0x00, 0x40, 0xe2, 0xe1, 0xe4, 0xe8, 0xde, 0x01, 0x40, 0xfb, 0xf6, 0xf4, 0xe5, 0x1d, 0x09, 0x00, 0x18, 0x00, 0x01, 0x85, 0x09, 0x21, 0xe2, 0xe1,
+  0xbe, 0x03, 0x20, 0xef, 0xe3, 0xa0, 0x14, 0x00, 0xdd, 0x01, 0x00, 0x02, 0x00, 0x21, 0xf6, 0xfb, 0x73, 0x09, 0x30, 0xe8, 0xf2, 0xe5, 0x74, 0x07,
+  0x21, 0xef, 0xe4, 0xf8, 0x0c, 0x00, 0x2c, 0x00, 0x00, 0x36, 0x0b, 0x01, 0xea, 0x01, 0x00, 0x9c, 0x09, 0x06, 0xac, 0x03, 0x03, 0x97, 0x00, 0x30,
+  0xe0, 0xdf, 0xe0, 0xc8, 0x01, 0x00, 0x5f, 0x02, 0x03, 0x1a, 0x00, 0x00, 0xf1, 0x01, 0x00, 0x38, 0x00, 0x00, 0xac, 0x00, 0x00, 0x95, 0x00, 0x11,
+  0xe4, 0xe0, 0x01, 0x70, 0xf6, 0xf5, 0xf3, 0xe5, 0xe2, 0xe0, 0xe0, 0x43, 0x0a, 0x00, 0xb9, 0x02, 0x21, 0xdd, 0xde, 0x18, 0x0c, 0x11, 0xda, 0x82,
+  0x07, 0x20, 0xdb, 0xdb, 0x71, 0x07, 0x22, 0xdb, 0xdb, 0xea, 0x02, 0x01, 0xb9, 0x01, 0x01, 0xd5, 0x04, 0x11, 0xdb, 0x07, 0x00, 0x02, 0xb4, 0x03,
+  0x12, 0xd4, 0x87, 0x07, 0x00, 0x0e, 0x00, 0x00, 0xe7, 0x01, 0x00, 0x15, 0x00, 0x00, 0x14, 0x00, 0x39, 0xd8, 0xd8, 0xda, 0xe0, 0x01, 0x81, 0xf7,
+  0xf3, 0xe8, 0xe4, 0xda, 0xd3, 0xde, 0xdb, 0x9c, 0x07, 0x20, 0xcb, 0xca, 0xcc, 0x01, 0x00, 0x02, 0x00, 0x00, 0xe2, 0x01, 0x00, 0xb3, 0x0e, 0x00,
+  0x90, 0x01, 0x17, 0xcb, 0x05, 0x00, 0x70, 0xce, 0xd1, 0xd8, 0xe4, 0xe6, 0xe3, 0xe5, 0xef, 0x11, 0x50, 0xf3, 0xf3, 0xe6, 0xd4, 0xc4, 0xe3, 0x03,
+  0x51, 0xc3, 0xc3, 0xde, 0xe6, 0xe8, 0x00, 0x0f, 0x30, 0xdb, 0xc6, 0xc7, 0xd8, 0x01, 0x00, 0x3d, 0x0b, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x9e, 0x05, 0x20, 0xce, 0xce, 0xe0, 0x01, 0x01, 0x20, 0x02, 0x10, 0xcb, 0x0b, 0x08, 0x10, 0xca, 0x9c, 0x00, 0x00, 0x09, 0x0a, 0x51, 0xd8, 0xd8,
+  0xdb, 0xda, 0xe3, 0xe0, 0x01, 0x00, 0x01, 0x00, 0x00, 0x4d, 0x04, 0x40, 0xe7, 0xef, 0xdd, 0xdb, 0x87, 0x06, 0x00, 0xd5, 0x01, 0x00, 0xef, 0x00,
+  0x01, 0x99, 0x06, 0x00, 0xa0, 0x06, 0x20, 0xde, 0xe0, 0x9f, 0x15, 0x00, 0x0a, 0x01, 0x00, 0x4b, 0x01, 0x00, 0x3c, 0x01, 0x00, 0x51, 0x01, 0x11,
+  0xe0, 0x14, 0x03, 0x21, 0xe0, 0xe2, 0x46, 0x01, 0x00, 0x4c, 0x01, 0x00, 0x02, 0x00, 0x14, 0xdd, 0x6a, 0x01, 0x00, 0x1e, 0x00, 0x01, 0x52, 0x01,
+  0x01, 0x5b, 0x01, 0x70, 0xe1, 0xe2, 0xdf, 0xe1, 0xe4, 0xf3, 0xf6, 0x92, 0x14, 0x02, 0x80, 0x07, 0x10, 0xe2, 0x9c, 0x10, 0x00, 0xfe, 0x0a, 0x42,
+  0xe3, 0xe2, 0xe2, 0xf2, 0x98, 0x10, 0x13, 0xf2, 0x18, 0x01, 0x01, 0x8d, 0x00, 0x11, 0xf5, 0x14, 0x0f, 0x10, 0xf3, 0xd9, 0x01, 0x00, 0xce, 0x01,
+  0x00, 0x2a, 0x00, 0x01, 0x02, 0x00, 0x01, 0x08, 0x00, 0x00, 0xf1, 0x0c, 0x00, 0x55, 0x00, 0x01, 0xc8, 0x01, 0x00, 0x4f, 0x02, 0x00, 0x72, 0x00,
+  0x00, 0x02, 0x00, 0x01, 0x6b, 0x00, 0x01, 0x18, 0x00, 0x00, 0x3c, 0x04, 0x00, 0xe4, 0x01, 0x00, 0x9a, 0x00, 0x01, 0x0f, 0x00, 0x00, 0x04, 0x00,
+  0x01, 0xc0, 0x03, 0x00, 0x26, 0x15, 0x10, 0xf5, 0x4d, 0x0a, 0x11, 0xe1, 0xae, 0x00, 0x00, 0x01, 0x00, 0x00, 0xa0, 0x05, 0x01, 0x01, 0x00, 0x00,
+  0xa0, 0x05, 0x00, 0xc3, 0x03, 0x20, 0xd3, 0xd3, 0xe1, 0x01, 0x00, 0x01, 0x00, 0x00, 0x27, 0x01, 0x00, 0x0a, 0x00, 0x00, 0x54, 0x0c, 0x01, 0x07,
+  0x00, 0x11, 0xd8, 0xd3, 0x01, 0x00, 0x04, 0x00, 0x00, 0xe3, 0x01, 0x21, 0xd4, 0xd0, 0xed, 0x01, 0x01, 0x37, 0x0d, 0x80, 0xd4, 0xd3, 0xd8, 0xd9,
+  0xdd, 0xe4, 0xf6, 0xf7, 0x4d, 0x10, 0x00, 0x01, 0x00, 0x40, 0xf7, 0xf7, 0xf6, 0xf4, 0xa0, 0x05, 0x70, 0xde, 0xdb, 0xd1, 0xd1, 0xca, 0xcb, 0xca,
+  0xdd, 0x01, 0x11, 0xce, 0xe4, 0x01, 0x00, 0x8e, 0x01, 0x02, 0x65, 0x09, 0x41, 0xc7, 0xce, 0xd4, 0xd1, 0xba, 0x05, 0x12, 0xc7, 0xe1, 0x03, 0x30,
+  0xc6, 0xdb, 0xe6, 0x12, 0x10, 0x20, 0xf3, 0xf5, 0x20, 0x0d, 0x10, 0xbb, 0xa0, 0x03, 0x31, 0xc7, 0xca, 0xe0, 0xc0, 0x03, 0x30, 0xe7, 0xe6, 0xdd,
+  0x41, 0x0f, 0x02, 0xe0, 0x01, 0x00, 0xf7, 0x01, 0x00, 0xe6, 0x05, 0x00, 0x3a, 0x00, 0x20, 0xd1, 0xd1, 0x1a, 0x02, 0x00, 0x1f, 0x02, 0x22, 0xc7,
+  0xd1, 0x67, 0x11, 0x00, 0x86, 0x02, 0x00, 0x6e, 0x04, 0x32, 0xd4, 0xd3, 0xdd, 0xe0, 0x01, 0x00, 0xbf, 0x03, 0xa1, 0xf7, 0xf6, 0xf5, 0xf4, 0xe7,
+  0xe2, 0xda, 0xdc, 0xdd, 0xde, 0xc4, 0x02, 0x01, 0xdc, 0x01, 0x00, 0x9f, 0x05, 0x00, 0x3c, 0x0c, 0x10, 0xdd, 0xb5, 0x01, 0x00, 0x4d, 0x0b, 0x31,
+  0xdc, 0xdd, 0xe0, 0x54, 0x07, 0x00, 0xed, 0x02, 0x30, 0xdc, 0xdd, 0xde, 0x45, 0x01, 0x01, 0x41, 0x01, 0x01, 0x20, 0x00, 0x00, 0xb1, 0x05, 0x20,
+  0xde, 0xdd, 0x05, 0x00, 0x00, 0x6f, 0x01, 0x00, 0xd6, 0x01, 0x00, 0x6d, 0x01, 0x01, 0xbc, 0x03, 0x00, 0x02, 0x00, 0x41, 0xe2, 0xe1, 0xe5, 0xe8,
+  0xc8, 0x12, 0x20, 0xf6, 0xf3, 0xc0, 0x03, 0x11, 0xef, 0xb7, 0x05, 0x00, 0x01, 0x00, 0x11, 0xef, 0x11, 0x0c, 0x40, 0xe8, 0xf3, 0xf3, 0xf5, 0x15,
+  0x01, 0x02, 0x01, 0x00, 0x22, 0xf7, 0xf5, 0x33, 0x0d, 0x20, 0xe8, 0xf2, 0x19, 0x0d, 0x01, 0x1f, 0x09, 0x01, 0x0f, 0x0d, 0x00, 0x02, 0x00, 0x03,
+  0x17, 0x02, 0x20, 0xe1, 0xe2, 0xb2, 0x01, 0x00, 0xe1, 0x01, 0x00, 0xbd, 0x0b, 0x00, 0xc4, 0x01, 0x00, 0x71, 0x02, 0x01, 0x69, 0x00, 0x00, 0x0c,
+  0x00, 0x11, 0xe2, 0x0c, 0x0f, 0x21, 0xe0, 0xe0, 0xa1, 0x07, 0x00, 0x27, 0x00, 0x01, 0x01, 0x00, 0x31, 0xdf, 0xe2, 0xef, 0x85, 0x00, 0x00, 0x80,
+  0x07, 0x50, 0xe2, 0xe0, 0xe0, 0xde, 0xdd, 0x6f, 0x04, 0x00, 0xbf, 0x00, 0x00, 0xc0, 0x00, 0x03, 0xc6, 0x03, 0x00, 0xc2, 0x03, 0x00, 0xd5, 0x01,
+  0x01, 0x45, 0x0c, 0x00, 0xe3, 0x01, 0x01, 0xf0, 0x02, 0x00, 0xe1, 0x01, 0x00, 0xde, 0x01, 0x00, 0xc2, 0x03, 0x03, 0xdb, 0x01, 0x00, 0x9b, 0x05,
+  0x10, 0xd4, 0x4f, 0x10, 0x00, 0x15, 0x00, 0x00, 0xe1, 0x01, 0x00, 0x32, 0x03, 0x10, 0xe4, 0x77, 0x15, 0x00, 0xc3, 0x00, 0x00, 0xc6, 0x00, 0x00,
+  0xe0, 0x01, 0x40, 0xd6, 0xd0, 0xe0, 0xdb, 0x1e, 0x00, 0x01, 0x83, 0x01, 0x00, 0x89, 0x01, 0x00, 0x8a, 0x01, 0x00, 0x7e, 0x07, 0x31, 0xcb, 0xcb,
+  0xce, 0x9c, 0x14, 0x10, 0xd1, 0x8c, 0x07, 0x00, 0x85, 0x03, 0x80, 0xce, 0xcb, 0xc3, 0xc3, 0xc6, 0xe0, 0xe8, 0xf5, 0x18, 0x0e, 0x43, 0xf5, 0xf3,
+  0xe6, 0xdb, 0xc5, 0x01, 0x11, 0xde, 0xe0, 0x01, 0x40, 0xf3, 0xe6, 0xd8, 0xc7, 0x53, 0x09, 0x20, 0xcb, 0xcb, 0x34, 0x0b, 0x01, 0xe9, 0x01, 0x00,
+  0xe4, 0x05, 0x20, 0xc3, 0xbe, 0xd8, 0x10, 0x00, 0x35, 0x02, 0x02, 0x5d, 0x00, 0x00, 0x77, 0x02, 0x00, 0xe0, 0x01, 0x00, 0x28, 0x08, 0x50, 0xd1,
+  0xd8, 0xdc, 0xe3, 0xf5, 0x95, 0x0c, 0x02, 0x01, 0x00, 0x71, 0xf4, 0xe8, 0xe7, 0xe4, 0xde, 0xdd, 0xe0, 0xd3, 0x01, 0x00, 0xc1, 0x03, 0x01, 0x7a,
+  0x07, 0x00, 0x3d, 0x0c, 0x30, 0xdd, 0xdb, 0xdc, 0xeb, 0x01, 0x00, 0x83, 0x08, 0x01, 0x95, 0x05, 0x70, 0xe2, 0xe2, 0xe0, 0xde, 0xe0, 0xe0, 0xde,
+  0x70, 0x19, 0x00, 0x3d, 0x03, 0x00, 0xcc, 0x03, 0x20, 0xdc, 0xdd, 0x3b, 0x0d, 0x00, 0x20, 0x01, 0x04, 0xa2, 0x07, 0x00, 0xc2, 0x03, 0x00, 0xa6,
+  0x03, 0x00, 0xc5, 0x01, 0x00, 0x6a, 0x01, 0x40, 0xe2, 0xe3, 0xe3, 0xe5, 0xcd, 0x09, 0x10, 0xf7, 0x80, 0x07, 0x00, 0xde, 0x01, 0x01, 0x6c, 0x05,
+  0x10, 0xe2, 0x80, 0x12, 0x10, 0xe2, 0xc7, 0x14, 0x00, 0xca, 0x14, 0x00, 0x14, 0x01, 0x02, 0x01, 0x00, 0x00, 0xc0, 0x03, 0x00, 0xc2, 0x03, 0x00,
+  0x3f, 0x0b, 0x00, 0x02, 0x00, 0x02, 0x05, 0x00, 0x00, 0x33, 0x0b, 0x00, 0xef, 0x01, 0x00, 0x01, 0x00, 0x02, 0xa5, 0x05, 0x00, 0xea, 0x01, 0x01,
+  0x1c, 0x04, 0x00, 0x05, 0x00, 0x01, 0x46, 0x02, 0x21, 0xe2, 0xe0, 0x5b, 0x00, 0x01, 0x02, 0x00, 0x00, 0x03, 0x00, 0x02, 0xee, 0x01, 0x00, 0x08,
+  0x08, 0x00, 0x02, 0x00, 0x11, 0xe0, 0x25, 0x06, 0x01, 0x1d, 0x13, 0x20, 0xe5, 0xef, 0x18, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x6c, 0x06, 0x00, 0xc0,
+  0x03, 0x03, 0xc5, 0x03, 0x00, 0xcc, 0x01, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0xde, 0x01, 0x02, 0xea, 0x02, 0x02, 0xf3, 0x01, 0x21, 0xdb,
+  0xd8, 0x41, 0x01, 0x02, 0xc0, 0x03, 0x00, 0xdf, 0x01, 0x00, 0x2e, 0x03, 0x00, 0x26, 0x00, 0x10, 0xd8, 0xa9, 0x07, 0x40, 0xd9, 0xde, 0xdf, 0xe1,
+  0x65, 0x06, 0x02, 0x41, 0x0b, 0x00, 0x85, 0x13, 0x81, 0xf4, 0xe7, 0xe6, 0xdc, 0xd3, 0xe0, 0xd8, 0xd4, 0x15, 0x07, 0x01, 0x61, 0x12, 0x00, 0x53,
+  0x05, 0x00, 0xa3, 0x05, 0x00, 0x5d, 0x05, 0x12, 0xc7, 0x7a, 0x03, 0x11, 0xd1, 0x9e, 0x01, 0x00, 0x9e, 0x10, 0x80, 0xcb, 0xc7, 0xce, 0xd4, 0xe6,
+  0xf5, 0xfb, 0xf5, 0x2f, 0x1a, 0x20, 0xe6, 0xd4, 0x8e, 0x16, 0x34, 0xc3, 0xc7, 0xc6, 0xc0, 0x03, 0x10, 0xdb, 0xbf, 0x14, 0x00, 0x1a, 0x02, 0x01,
+  0xbf, 0x03, 0x01, 0x0c, 0x00, 0x00, 0xf3, 0x03, 0x00, 0x5e, 0x09, 0x00, 0x44, 0x00, 0x10, 0xca, 0x57, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x67, 0x02,
+  0x00, 0xc1, 0x03, 0x60, 0xd8, 0xd3, 0xde, 0xdd, 0xe4, 0xf5, 0x73, 0x01, 0x00, 0x01, 0x00, 0xc0, 0xe9, 0xf7, 0xf6, 0xf3, 0xf3, 0xe3, 0xdc, 0xde,
+  0xda, 0xde, 0xdd, 0xde, 0xde, 0x00, 0x00, 0x42, 0x0b, 0x01, 0xf0, 0x00, 0x01, 0xdf, 0x00, 0x00, 0xbb, 0x13, 0x02, 0xec, 0x01, 0x00, 0xcd, 0x04,
+  0x01, 0x0e, 0x03, 0x00, 0xa8, 0x05, 0x00, 0xab, 0x03, 0x01, 0x55, 0x09, 0x00, 0x23, 0x01, 0x20, 0xe2, 0xe0, 0x80, 0x19, 0x11, 0xdd, 0xb7, 0x19,
+  0x02, 0x34, 0x03, 0x00, 0x5f, 0x07, 0x10, 0xe2, 0x74, 0x01, 0x01, 0x85, 0x01, 0x00, 0xe0, 0x01, 0x01, 0x01, 0x00, 0x10, 0xf3, 0x60, 0x09, 0x00,
+  0xb8, 0x03, 0x10, 0xe3, 0xfe, 0x01, 0x31, 0xe1, 0xe2, 0xef, 0xdd, 0x01, 0x17, 0xf7, 0xdf, 0x01, 0x00, 0x80, 0x07, 0x00, 0x5e, 0x09, 0x31, 0xf4,
+  0xf5, 0xf3, 0xdb, 0x03, 0x01, 0x2f, 0x0b, 0x00, 0xd5, 0x14, 0x10, 0xf2, 0x37, 0x0b, 0x00, 0x3a, 0x0b, 0x00, 0xf2, 0x14, 0x50, 0xe7, 0xe5, 0xe6,
+  0xe5, 0xe6, 0xe6, 0x0e, 0x02, 0xef, 0x01, 0x00, 0x10, 0x0f, 0x03, 0x02, 0x00, 0x11, 0xe4, 0xfa, 0x01, 0x02, 0x02, 0x00, 0x00, 0x7c, 0x00, 0x00,
+  0xda, 0x01, 0x00, 0xb5, 0x00, 0x10, 0xdf, 0x85, 0x00, 0x11, 0xf5, 0x5c, 0x00, 0x33, 0xf3, 0xe7, 0xe2, 0xdf, 0x01, 0x02, 0xa4, 0x02, 0x00, 0xc0,
+  0x03, 0x11, 0xdd, 0xc4, 0x03, 0x00, 0xc7, 0x01, 0x00, 0x02, 0x01, 0x00, 0xfb, 0x00, 0x00, 0x09, 0x00, 0x00, 0x0a, 0x00, 0x03, 0xe0, 0x01, 0x21,
+  0xd8, 0xdb, 0x8b, 0x03, 0x01, 0xbe, 0x03, 0x00, 0x07, 0x05, 0x01, 0xb7, 0x03, 0x10, 0xd4, 0x1a, 0x00, 0x91, 0xdb, 0xdb, 0xdd, 0xde, 0xe2, 0xe2,
+  0xe3, 0xe4, 0xe6, 0x5f, 0x0f, 0x01, 0x43, 0x08, 0x00, 0x20, 0x1c, 0x80, 0xf5, 0xe8, 0xe6, 0xdf, 0xdb, 0xe0, 0xdb, 0xca, 0x65, 0x1a, 0x32, 0xca,
+  0xce, 0xd1, 0xd7, 0x01, 0x00, 0x97, 0x01, 0x00, 0x64, 0x09, 0x01, 0xec, 0x01, 0x00, 0x0e, 0x00, 0x01, 0xb2, 0x05, 0x00, 0xc1, 0x03, 0x70, 0xc7,
+  0xbf, 0xbe, 0xc6, 0xde, 0xe8, 0xf6, 0xf9, 0x0f, 0x30, 0xf3, 0xe6, 0xd4, 0xe0, 0x10, 0x35, 0xc3, 0xc3, 0xce, 0xe0, 0x01, 0x01, 0xba, 0x03, 0x00,
+  0x3a, 0x0f, 0x51, 0xc3, 0xbf, 0xbb, 0xb9, 0xc3, 0x17, 0x0d, 0x01, 0xdf, 0x01, 0x21, 0xc7, 0xce, 0x06, 0x04, 0x00, 0x2d, 0x02, 0x00, 0x9f, 0x05,
+  0x30, 0xd0, 0xd4, 0xdb, 0x6d, 0x13, 0x00, 0xc7, 0x03, 0x25, 0xd9, 0xef, 0xe0, 0x01, 0x01, 0x16, 0x16, 0x30, 0xe4, 0xe0, 0xdb, 0x63, 0x05, 0x00,
+  0xaf, 0x00, 0x11, 0xd8, 0xd0, 0x01, 0x10, 0xdb, 0xc3, 0x03, 0x11, 0xdd, 0x65, 0x0a, 0x01, 0x0e, 0x00, 0x10, 0xd9, 0xe4, 0x01, 0x01, 0x9e, 0x03,
+  0x20, 0xdd, 0xde, 0xac, 0x0a, 0x00, 0x1d, 0x00, 0x01, 0xe9, 0x01, 0x10, 0xdd, 0x3f, 0x01, 0x00, 0x0b, 0x00, 0x00, 0xdb, 0x01, 0x02, 0x01, 0x02,
+  0x00, 0xd9, 0x01, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x5e, 0x01, 0x30, 0xe1, 0xe4, 0xe8, 0x08, 0x15, 0x40, 0xf6, 0xf6, 0xe8, 0xe4, 0xb5,
+  0x03, 0xb0, 0xef, 0xe2, 0xe3, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe3, 0xe1, 0xe2, 0x95, 0xf7, 0xf6, 0xf7, 0xf6, 0xf6, 0xf7, 0xf7, 0xf7, 0xe9, 0x01,
+  0x00, 0x81, 0xf7, 0xfb, 0xf5, 0xf6, 0xf6, 0xfb, 0xf5, 0xf4, 0x02, 0x00, 0xa1, 0xf3, 0xf5, 0xf5, 0xf3, 0xf5, 0xf4, 0xf3, 0xe8, 0xf4, 0xf3, 0x01,
+  0x00, 0x42, 0xe8, 0xf3, 0xf3, 0xe7, 0x02, 0x00, 0x02, 0x05, 0x00, 0x05, 0x01, 0x00, 0x31, 0xe5, 0xe7, 0xe5, 0x05, 0x00, 0x04, 0x01, 0x00, 0x10,
+  0xe4, 0x01, 0x00, 0xf0, 0x26, 0xe3, 0xef, 0xe3, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe1, 0xe1, 0xe1, 0xef, 0xe1, 0xe1, 0xe2, 0xef, 0xe4, 0xf5, 0xf6,
+  0xf6, 0xf5, 0xfb, 0xf5, 0xf4, 0xe8, 0xf2, 0xe2, 0xdf, 0xe0, 0xe1, 0xe0, 0xdf, 0xe0, 0xe0, 0xe0, 0xdf, 0xe0, 0xdc, 0xde, 0xe0, 0xde, 0xde, 0xde,
+  0xde, 0xda, 0xdd, 0xdd, 0xde, 0xdd, 0xdb, 0xdb, 0xdd, 0xdb, 0x01, 0x00, 0x10, 0xdd, 0x08, 0x00, 0x70, 0xd8, 0xd3, 0xdb, 0xdb, 0xdd, 0xdd, 0xde,
+  0x10, 0x00, 0x40, 0xdb, 0xdb, 0xdb, 0xd8, 0x01, 0x00, 0x11, 0xd4, 0x01, 0x00, 0x53, 0xd1, 0xd4, 0xd1, 0xd4, 0xd4, 0x0c, 0x00, 0xf0, 0x32, 0xd8,
+  0xdb, 0xd9, 0xdd, 0xde, 0xe2, 0xe3, 0xe0, 0xdd, 0xdb, 0xde, 0xde, 0xe3, 0xe7, 0xf5, 0xf6, 0xf6, 0xf4, 0xfb, 0xfb, 0xe9, 0xf7, 0xe9, 0xf7, 0xf7,
+  0xfb, 0xf6, 0xf6, 0xe8, 0xe6, 0xdf, 0xd9, 0xde, 0xde, 0xd1, 0xca, 0xce, 0xce, 0xce, 0xcb, 0xcb, 0xcb, 0xcb, 0xc7, 0xcb, 0xc7, 0xc7, 0xc3, 0xc7,
+  0xce, 0xd1, 0xce, 0xcb, 0xc7, 0xc3, 0xbf, 0xc3, 0xcb, 0xcb, 0xcb, 0xce, 0xc7, 0xc7, 0xcb, 0xce, 0x05, 0x00, 0x10, 0xcb, 0x04, 0x00, 0xf0, 0x09,
+  0xcb, 0xc3, 0xc3, 0xc6, 0xd4, 0xe6, 0xf6, 0xf6, 0xf5, 0xf4, 0xf3, 0xe7, 0xe6, 0xdb, 0xc7, 0xc7, 0xc7, 0xbf, 0xc7, 0xc3, 0xc6, 0xe2, 0xe7, 0xe8,
+  0xf3, 0x00, 0x60, 0xe6, 0xdb, 0xbb, 0xbf, 0xbf, 0xbf, 0x46, 0x00, 0x70, 0xc7, 0xc3, 0xc3, 0xbf, 0xbb, 0xc3, 0xc7, 0x4c, 0x00, 0x00, 0x0c, 0x00,
+  0x10, 0xc3, 0x39, 0x00, 0x20, 0xd4, 0xce, 0x62, 0x00, 0x60, 0xc7, 0xce, 0xd1, 0xd1, 0xd4, 0xd1, 0xaa, 0x00, 0x90, 0xd4, 0xd1, 0xd4, 0xd8, 0xd4,
+  0xd8, 0xd3, 0xde, 0xe8, 0x58, 0x01, 0x00, 0x01, 0x00, 0x80, 0xe9, 0xf7, 0xfb, 0xe8, 0xf3, 0xe3, 0xdf, 0xdd, 0x01, 0x00, 0x02, 0xc9, 0x00, 0x10,
+  0xdd, 0xe8, 0x00, 0x00, 0xe6, 0x00, 0x30, 0xdd, 0xde, 0xde, 0xe4, 0x00, 0x00, 0x0f, 0x00, 0x10, 0xdb, 0x1f, 0x00, 0x30, 0xde, 0xdd, 0xde, 0x13,
+  0x01, 0x10, 0xdf, 0x17, 0x00, 0x20, 0xdb, 0xda, 0x12, 0x00, 0x91, 0xdd, 0xde, 0xde, 0xde, 0xe0, 0xde, 0xdf, 0xde, 0xdc, 0x09, 0x00, 0x81, 0xdf,
+  0xe0, 0xde, 0xde, 0xdf, 0xe0, 0xe0, 0xe1, 0x02, 0x00, 0xf0, 0x00, 0xe2, 0xe0, 0xe1, 0xe2, 0xe3, 0xe2, 0xe1, 0xe0, 0xdf, 0xde, 0xe1, 0xe4, 0xe8,
+  0xf6, 0xf6, 0xca, 0x01, 0xf0, 0x08, 0xe8, 0xe5, 0xef, 0xe2, 0xe1, 0xe2, 0xe2, 0xef, 0xe2, 0xe3, 0xe2, 0xe2, 0xe3, 0xe3, 0xe2, 0xe2, 0xe2, 0xf7,
+  0xf7, 0xf6, 0xfb, 0xf7, 0xf6, 0xd8, 0x01, 0x05, 0x01, 0x00, 0x40, 0xf6, 0xf6, 0xf6, 0xfb, 0x02, 0x00, 0x50, 0xf5, 0xf5, 0xf5, 0xf5, 0xfb, 0x03,
+  0x00, 0x00, 0xe9, 0x01, 0x02, 0x06, 0x00, 0x00, 0xf1, 0x01, 0x90, 0xf3, 0xf5, 0xf3, 0xf4, 0xe8, 0xf4, 0xe8, 0xf3, 0xe8, 0xfb, 0x00, 0x00, 0xf3,
+  0x01, 0x02, 0x02, 0x00, 0x06, 0xfa, 0x01, 0x00, 0x01, 0x00, 0x10, 0xf2, 0x02, 0x00, 0xc0, 0xe5, 0xe7, 0xe6, 0xe7, 0xe5, 0xe6, 0xe5, 0xe6, 0xe4,
+  0xe5, 0xe4, 0xe6, 0xf0, 0x01, 0x40, 0xf2, 0xe8, 0xf5, 0xfb, 0x49, 0x00, 0x30, 0xe8, 0xe7, 0xe3, 0x85, 0x00, 0x30, 0xe2, 0xe2, 0xe2, 0xa6, 0x00,
+  0x21, 0xe0, 0xdf, 0xbe, 0x00, 0x00, 0x02, 0x00, 0x10, 0xda, 0xf5, 0x00, 0x30, 0xda, 0xdb, 0xda, 0xd8, 0x01, 0x32, 0xdd, 0xd8, 0xd8, 0xf4, 0x00,
+  0x33, 0xd8, 0xd9, 0xdb, 0x17, 0x01, 0x30, 0xd4, 0xd4, 0xd1, 0x3b, 0x01, 0x01, 0x40, 0x01, 0x00, 0x06, 0x00, 0xf0, 0x02, 0xd1, 0xd4, 0xd4, 0xd3,
+  0xdb, 0xdb, 0xe2, 0xe3, 0xe2, 0xe0, 0xdd, 0xd3, 0xd3, 0xd8, 0xd8, 0xda, 0xe5, 0x4d, 0x01, 0x30, 0xf6, 0xfb, 0xfb, 0xb1, 0x02, 0xc0, 0xf4, 0xf5,
+  0xf6, 0xe8, 0xe6, 0xdd, 0xd3, 0xd8, 0xe0, 0xd4, 0xd1, 0xd1, 0x80, 0x01, 0x00, 0x83, 0x01, 0x21, 0xcb, 0xc7, 0x90, 0x01, 0x01, 0x08, 0x00, 0x71,
+  0xc7, 0xc3, 0xbe, 0xcb, 0xcb, 0xce, 0xcb, 0x16, 0x00, 0x12, 0xcb, 0xa8, 0x01, 0x40, 0xc7, 0xc7, 0xd1, 0xe3, 0x22, 0x02, 0xd1, 0xf5, 0xf3, 0xe6,
+  0xd1, 0xbe, 0xc3, 0xc7, 0xc7, 0xc7, 0xc7, 0xce, 0xe0, 0xe7, 0xd9, 0x00, 0xf4, 0x03, 0xe6, 0xd4, 0xc3, 0xbf, 0xbf, 0xbb, 0xc3, 0xbf, 0xbf, 0xc7,
+  0xc3, 0xcb, 0xc3, 0xc3, 0xbf, 0xbf, 0xc3, 0xc7, 0x32, 0x00, 0xf0, 0x01, 0xc7, 0xc7, 0xc3, 0xce, 0xd1, 0xcb, 0xc7, 0xce, 0xc7, 0xbe, 0xc3, 0xcb,
+  0xce, 0xce, 0xd1, 0xd4, 0xaa, 0x01, 0x11, 0xd8, 0x7f, 0x02, 0x40, 0xd8, 0xdc, 0xe8, 0xf5, 0x90, 0x00, 0x00, 0x3b, 0x03, 0x50, 0xf7, 0xf5, 0xf3,
+  0xe7, 0xe4, 0xbf, 0x02, 0x20, 0xdb, 0xd9, 0xc7, 0x00, 0x10, 0xd3, 0xda, 0x00, 0x50, 0xdb, 0xdd, 0xdd, 0xd9, 0xd8, 0x06, 0x00, 0x30, 0xde, 0xdd,
+  0xde, 0xf8, 0x01, 0x00, 0x12, 0x00, 0x90, 0xdb, 0xdd, 0xde, 0xe0, 0xde, 0xe0, 0xe2, 0xe0, 0xe0, 0xf3, 0x02, 0x00, 0xdb, 0x01, 0x30, 0xdd, 0xdd,
+  0xdc, 0xfd, 0x02, 0x00, 0xf0, 0x01, 0x00, 0x27, 0x00, 0x10, 0xdc, 0x0a, 0x00, 0x90, 0xe0, 0xde, 0xe0, 0xe0, 0xe2, 0xe2, 0xe0, 0xe2, 0xe0, 0x3f,
+  0x01, 0xa0, 0xe2, 0xe1, 0xe2, 0xe0, 0xe0, 0xde, 0xdf, 0xe0, 0xe4, 0xf3, 0xde, 0x01, 0x40, 0xf6, 0xf5, 0xf5, 0xe4, 0xd5, 0x01, 0x70, 0xef, 0xe2,
+  0xef, 0xe3, 0xe3, 0xef, 0xe2, 0x5e, 0x03, 0x00, 0x81, 0x00, 0x01, 0x84, 0x00, 0x10, 0xe9, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x10,
+  0xf6, 0x01, 0x00, 0x20, 0xf7, 0xf5, 0x32, 0x00, 0x52, 0xfb, 0xf5, 0xfb, 0xf6, 0xf4, 0xd1, 0x03, 0x00, 0x9c, 0x01, 0x12, 0xf6, 0xeb, 0x01, 0x02,
+  0x01, 0x00, 0x40, 0xe8, 0xf3, 0xf5, 0xe8, 0xec, 0x01, 0x04, 0x02, 0x00, 0x01, 0xe9, 0x01, 0x13, 0xe8, 0xf4, 0x01, 0x00, 0x00, 0x02, 0x04, 0xf1,
+  0x01, 0x10, 0xf2, 0x05, 0x00, 0x40, 0xe7, 0xf3, 0xf5, 0xf6, 0x33, 0x02, 0x60, 0xe8, 0xf4, 0xe7, 0xe7, 0xe5, 0xe4, 0x02, 0x00, 0x04, 0x01, 0x00,
+  0x00, 0x91, 0x00, 0x31, 0xe0, 0xe1, 0xe3, 0xea, 0x01, 0x10, 0xda, 0xc8, 0x00, 0x00, 0x02, 0x00, 0x00, 0xe9, 0x01, 0x60, 0xdd, 0xdc, 0xdd, 0xdb,
+  0xd9, 0xd8, 0xe8, 0x00, 0x30, 0xd8, 0xd8, 0xd4, 0x1b, 0x01, 0x20, 0xd1, 0xd1, 0xda, 0x01, 0x30, 0xd1, 0xd8, 0xdb, 0xee, 0x01, 0x00, 0xbf, 0x03,
+  0x40, 0xdd, 0xe2, 0xe3, 0xdd, 0xea, 0x03, 0x60, 0xdb, 0xd8, 0xd8, 0xd9, 0xe5, 0xf6, 0xba, 0x03, 0x00, 0xb4, 0x00, 0xf2, 0x04, 0xfb, 0xf5, 0xf4,
+  0xf4, 0xf5, 0xf5, 0xe6, 0xdc, 0xd3, 0xd4, 0xe2, 0xd3, 0xd4, 0xd4, 0xd1, 0xce, 0xcb, 0xce, 0xcb, 0xcb, 0x01, 0x11, 0xc7, 0x0a, 0x00, 0x10, 0xcb,
+  0x07, 0x00, 0x11, 0xbf, 0xa2, 0x01, 0x70, 0xcb, 0xce, 0xd4, 0xce, 0xbe, 0xc3, 0xc3, 0xce, 0x03, 0xf0, 0x06, 0xc3, 0xcb, 0xce, 0xe3, 0xf5, 0xf6,
+  0xf7, 0xf7, 0xf3, 0xe8, 0xe6, 0xdb, 0xc7, 0xce, 0xc7, 0xce, 0xcb, 0xc3, 0xca, 0xe2, 0xe7, 0xcb, 0x00, 0x50, 0xe7, 0xe6, 0xdd, 0xcb, 0xc3, 0xb9,
+  0x03, 0x50, 0xbf, 0xbf, 0xbf, 0xc7, 0xbf, 0xe0, 0x01, 0x01, 0xba, 0x03, 0x01, 0xc7, 0x03, 0xc3, 0xbb, 0xc3, 0xcb, 0xd1, 0xcb, 0xcb, 0xd1, 0xd1,
+  0xcb, 0xce, 0xca, 0xce, 0x98, 0x00, 0x92, 0xd1, 0xd1, 0xd4, 0xdb, 0xd8, 0xdb, 0xd3, 0xdc, 0xe7, 0xc0, 0x03, 0x00, 0x4f, 0x04, 0x60, 0xfb, 0xf3,
+  0xf3, 0xe2, 0xdc, 0xdb, 0xe2, 0x01, 0x20, 0xdd, 0xdb, 0xdc, 0x03, 0x30, 0xdb, 0xdb, 0xd8, 0xb5, 0x02, 0x00, 0xf1, 0x01, 0x03, 0x03, 0x00, 0x01,
+  0xcd, 0x03, 0x00, 0xcf, 0x02, 0x10, 0xdb, 0xa7, 0x03, 0x20, 0xde, 0xdf, 0xf4, 0x00, 0x02, 0xe3, 0x01, 0x10, 0xde, 0xb9, 0x03, 0x01, 0x01, 0x00,
+  0x10, 0xdd, 0xe6, 0x04, 0x00, 0x0e, 0x00, 0x10, 0xdf, 0xf9, 0x04, 0x30, 0xe2, 0xe1, 0xe0, 0xcc, 0x01, 0xf0, 0x04, 0xe0, 0xe2, 0xe0, 0xdf, 0xe0,
+  0xe1, 0xe4, 0xe8, 0xf7, 0xf6, 0xfb, 0xf6, 0xf6, 0xf5, 0xe8, 0xe4, 0xe1, 0xe2, 0xef, 0x3a, 0x03, 0x12, 0xe3, 0xbf, 0x03, 0x13, 0xe3, 0x82, 0x00,
+  0x00, 0xd8, 0x01, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x13, 0x00, 0x00, 0x01, 0x00, 0x00, 0xe4, 0x01, 0x04, 0x01, 0x00, 0x13, 0xfb, 0x05,
+  0x00, 0x00, 0xd9, 0x03, 0x00, 0x05, 0x00, 0x00, 0xaa, 0x01, 0x30, 0xf6, 0xf5, 0xf6, 0xea, 0x01, 0x00, 0xb4, 0x01, 0x00, 0x06, 0x00, 0x00, 0xde,
+  0x03, 0x20, 0xf4, 0xf5, 0xf1, 0x01, 0x01, 0xe7, 0x03, 0x20, 0xf4, 0xf5, 0xf2, 0x01, 0x10, 0xf4, 0x00, 0x03, 0x00, 0xee, 0x01, 0x00, 0x02, 0x00,
+  0x20, 0xf4, 0xf5, 0x34, 0x02, 0x41, 0xf5, 0xf5, 0xe8, 0xe8, 0xf2, 0x01, 0x10, 0xe5, 0xf4, 0x01, 0x00, 0xe3, 0x03, 0x81, 0xe7, 0xe5, 0xe7, 0xe6,
+  0xe6, 0xe5, 0xe6, 0xe6, 0xf3, 0x01, 0x10, 0xe3, 0xd9, 0x05, 0x01, 0x5d, 0x04, 0x20, 0xe3, 0xe0, 0x01, 0x00, 0x11, 0xe2, 0xce, 0x00, 0x50, 0xde,
+  0xd9, 0xd3, 0xd8, 0xd9, 0x3e, 0x01, 0x40, 0xd3, 0xd1, 0xd3, 0xd8, 0xda, 0x03, 0xc0, 0xd3, 0xd4, 0xd3, 0xdb, 0xd3, 0xd3, 0xd8, 0xdd, 0xe3, 0xe3,
+  0xde, 0xdc, 0x28, 0x01, 0x00, 0xf5, 0x04, 0x01, 0xc0, 0x03, 0x00, 0x9a, 0x05, 0x00, 0xdf, 0x01, 0x91, 0xe8, 0xfb, 0xe8, 0xe6, 0xdb, 0xd3, 0xd4,
+  0xe0, 0xdd, 0xc0, 0x03, 0x20, 0xcb, 0xc7, 0xe1, 0x01, 0x00, 0x08, 0x00, 0x20, 0xbf, 0xc3, 0x5a, 0x05, 0x00, 0xe1, 0x01, 0x00, 0x12, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x50, 0xc3, 0xc3, 0xc6, 0xe2, 0xe8, 0x07, 0x03, 0x60, 0xf3, 0xe6, 0xd4, 0xbe, 0xc7, 0xbf, 0xe9,
+  0x03, 0x02, 0xe0, 0x01, 0x70, 0xe8, 0xe6, 0xe0, 0xce, 0xc3, 0xc3, 0xc7, 0xd9, 0x01, 0x10, 0xc7, 0x06, 0x00, 0x10, 0xbf, 0xbf, 0x03, 0x40, 0xc3,
+  0xc7, 0xbf, 0xc3, 0xf2, 0x05, 0x10, 0xc3, 0x3c, 0x00, 0x21, 0xce, 0xce, 0x66, 0x00, 0x20, 0xd4, 0xd8, 0x89, 0x00, 0x30, 0xd1, 0xd4, 0xd8, 0xaa,
+  0x00, 0x10, 0xdf, 0xa0, 0x05, 0x01, 0x4d, 0x01, 0x01, 0xc0, 0x03, 0x10, 0xef, 0xbc, 0x01, 0x00, 0x04, 0x00, 0x00, 0xa8, 0x02, 0x00, 0xb1, 0x00,
+  0x01, 0x0d, 0x00, 0x12, 0xdd, 0xc3, 0x03, 0x00, 0xfa, 0x01, 0x00, 0x01, 0x00, 0x00, 0xa4, 0x06, 0x01, 0xe2, 0x01, 0x00, 0xd7, 0x01, 0x04, 0xda,
+  0x01, 0x02, 0x06, 0x00, 0x07, 0x01, 0x00, 0x11, 0xdd, 0xc7, 0x03, 0x22, 0xe1, 0xe0, 0x04, 0x05, 0x01, 0x25, 0x01, 0x30, 0xe4, 0xf3, 0xf5, 0xb1,
+  0x01, 0x40, 0xf5, 0xe8, 0xe4, 0xef, 0x3c, 0x01, 0x00, 0xba, 0x03, 0x00, 0x07, 0x00, 0x21, 0xe2, 0xe3, 0x81, 0x00, 0x05, 0xdb, 0x01, 0x01, 0x01,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x15, 0x00, 0x00, 0x01, 0x00, 0x51, 0xf6, 0xf7, 0xf6, 0xf7, 0xfb, 0xea, 0x01, 0x01, 0x05, 0x00, 0x00, 0xe7, 0x01,
+  0x00, 0x48, 0x00, 0x00, 0x09, 0x00, 0x00, 0x1c, 0x00, 0x05, 0x01, 0x00, 0x01, 0xed, 0x01, 0x20, 0xf5, 0xf5, 0xe1, 0x01, 0x00, 0xd4, 0x05, 0x02,
+  0x09, 0x00, 0x00, 0x01, 0x00, 0x10, 0xf4, 0x03, 0x00, 0x00, 0x0d, 0x00, 0x11, 0xe8, 0x00, 0x04, 0x00, 0x7c, 0x01, 0x00, 0x03, 0x02, 0x00, 0x16,
+  0x03, 0x01, 0xc5, 0x07, 0x60, 0xe7, 0xf3, 0xe7, 0xe8, 0xe7, 0xe8, 0x09, 0x00, 0x04, 0x01, 0x00, 0x00, 0xeb, 0x01, 0x01, 0xd7, 0x05, 0x40, 0xe5,
+  0xe6, 0xe5, 0xe4, 0xde, 0x05, 0x01, 0xdc, 0x05, 0x12, 0xe3, 0x01, 0x00, 0x41, 0xe2, 0xe0, 0xdc, 0xde, 0xa0, 0x04, 0x02, 0xe2, 0x02, 0xf1, 0x01,
+  0xda, 0xe2, 0xe4, 0xdf, 0xda, 0xde, 0xdd, 0xde, 0xdc, 0xdd, 0xd9, 0xd9, 0xd9, 0xdf, 0xe7, 0xf6, 0xbd, 0x00, 0x00, 0x98, 0x00, 0xc0, 0xf5, 0xf4,
+  0xf3, 0xf4, 0xe8, 0xe6, 0xd9, 0xd3, 0xd8, 0xe0, 0xde, 0xd3, 0xbc, 0x01, 0x00, 0xc9, 0x01, 0x02, 0xcf, 0x01, 0x10, 0xc7, 0x6d, 0x07, 0x01, 0x7e,
+  0x03, 0x01, 0x98, 0x01, 0x01, 0x14, 0x00, 0x00, 0x06, 0x00, 0x00, 0x04, 0x00, 0x20, 0xca, 0xe0, 0x94, 0x01, 0x40, 0xf6, 0xe8, 0xe6, 0xd8, 0xc2,
+  0x01, 0xe0, 0xc7, 0xc3, 0xcb, 0xde, 0xe7, 0xe7, 0xf5, 0xf3, 0xf3, 0xe8, 0xe6, 0xdd, 0xca, 0xc3, 0xb5, 0x03, 0x00, 0xd9, 0x01, 0x00, 0xe0, 0x01,
+  0x00, 0xca, 0x03, 0x01, 0xc4, 0x03, 0x01, 0x4d, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x00, 0x20, 0xcb, 0xce, 0x53, 0x04, 0x10, 0xd4, 0x6b, 0x04,
+  0x31, 0xd1, 0xd8, 0xd3, 0x4c, 0x00, 0x00, 0x90, 0x00, 0x82, 0xf7, 0xf7, 0xf7, 0xf5, 0xf4, 0xe7, 0xe4, 0xe0, 0xc4, 0x01, 0x10, 0xd4, 0xc4, 0x03,
+  0x02, 0x03, 0x00, 0x00, 0xc2, 0x03, 0x00, 0x98, 0x02, 0x00, 0xca, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x14, 0x00, 0x21, 0xdb, 0xdb, 0x77, 0x07, 0x00,
+  0xfd, 0x01, 0x00, 0xe0, 0x01, 0x20, 0xe0, 0xe0, 0xfd, 0x01, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0xe1, 0x01, 0x01, 0x82,
+  0x07, 0x00, 0x9f, 0x03, 0x01, 0xbf, 0x03, 0x00, 0xc7, 0x08, 0x20, 0xe3, 0xe7, 0x91, 0x01, 0x30, 0xf6, 0xf5, 0xf3, 0x29, 0x01, 0x20, 0xe4, 0xe4,
+  0x1a, 0x00, 0x00, 0x23, 0x03, 0x21, 0xe2, 0xe2, 0x7c, 0x01, 0x28, 0xf6, 0xf6, 0xe2, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x96, 0x00, 0x01, 0x2b, 0x01,
+  0x00, 0x05, 0x00, 0x01, 0x0a, 0x00, 0x00, 0x88, 0x09, 0x01, 0x0b, 0x00, 0x01, 0x09, 0x00, 0x04, 0x0a, 0x00, 0x03, 0x01, 0x00, 0x00, 0x07, 0x02,
+  0x00, 0x08, 0x00, 0x00, 0xd0, 0x05, 0x20, 0xf4, 0xf6, 0x66, 0x07, 0x10, 0xfb, 0xc9, 0x05, 0x00, 0xe8, 0x03, 0x00, 0xd5, 0x01, 0x00, 0x0b, 0x00,
+  0x01, 0xdb, 0x01, 0x02, 0xe7, 0x03, 0x00, 0xf4, 0x01, 0x30, 0xf5, 0xf3, 0xf5, 0xc3, 0x05, 0x13, 0xe8, 0xca, 0x05, 0x01, 0xd6, 0x05, 0x01, 0xf4,
+  0x01, 0x79, 0xf2, 0xf3, 0xe7, 0xf2, 0xe8, 0xe7, 0xf3, 0xf4, 0x01, 0x00, 0xe4, 0x03, 0x01, 0xf1, 0x01, 0x60, 0xe6, 0xe6, 0xe4, 0xe4, 0xe6, 0xe5,
+  0xe9, 0x03, 0x01, 0xf8, 0x01, 0x60, 0xe6, 0xe6, 0xe7, 0xe4, 0xe6, 0xe4, 0xa8, 0x02, 0x53, 0xe3, 0xe2, 0xe2, 0xe4, 0xe8, 0xa7, 0x00, 0x10, 0xf6,
+  0x51, 0x01, 0x00, 0x97, 0x01, 0x90, 0xd9, 0xd3, 0xd3, 0xde, 0xe3, 0xdd, 0xd4, 0xd1, 0xc6, 0x64, 0x09, 0x51, 0xca, 0xca, 0xd1, 0xce, 0xca, 0x8e,
+  0x01, 0x20, 0xcb, 0xc6, 0x58, 0x09, 0x30, 0xc3, 0xc7, 0xc7, 0xd6, 0x01, 0x30, 0xcb, 0xcb, 0xc3, 0x9a, 0x01, 0x00, 0xe7, 0x01, 0x30, 0xcb, 0xce,
+  0xe1, 0x94, 0x01, 0x20, 0xf7, 0xf5, 0x90, 0x05, 0x71, 0xbf, 0xbf, 0xc3, 0xbf, 0xca, 0xde, 0xe7, 0x84, 0x04, 0x23, 0xe7, 0xdb, 0xb4, 0x07, 0x00,
+  0xd6, 0x01, 0x42, 0xbf, 0xbf, 0xbb, 0xbb, 0x08, 0x00, 0x00, 0xdc, 0x01, 0x00, 0xa5, 0x05, 0x00, 0xe0, 0x01, 0x10, 0xd1, 0x42, 0x00, 0x21, 0xce,
+  0xce, 0x17, 0x08, 0x00, 0x80, 0x07, 0x40, 0xdb, 0xdb, 0xe1, 0xe8, 0xed, 0x05, 0x30, 0xe9, 0xf7, 0xe9, 0x94, 0x00, 0x50, 0xe8, 0xe8, 0xe4, 0xde,
+  0xdb, 0xac, 0x03, 0x00, 0xfd, 0x01, 0x21, 0xd8, 0xdb, 0xb0, 0x01, 0x20, 0xdb, 0xdb, 0x59, 0x09, 0x00, 0xcc, 0x03, 0x05, 0xee, 0x01, 0x03, 0xd7,
+  0x03, 0x00, 0x01, 0x00, 0x11, 0xdb, 0xf5, 0x01, 0x00, 0x05, 0x00, 0x00, 0xb2, 0x03, 0x00, 0x0a, 0x00, 0x00, 0xb8, 0x03, 0x01, 0xdf, 0x01, 0x30,
+  0xde, 0xde, 0xe0, 0xc0, 0x01, 0x00, 0xc0, 0x08, 0x20, 0xe2, 0xe1, 0xdf, 0x01, 0x21, 0xe0, 0xe0, 0x60, 0x09, 0x00, 0xe0, 0x01, 0x00, 0x77, 0x07,
+  0x40, 0xe3, 0xe3, 0xe3, 0xe1, 0x1c, 0x00, 0x00, 0x01, 0x00, 0x30, 0xf2, 0xe7, 0xe7, 0x59, 0x01, 0x08, 0x62, 0x09, 0x01, 0xe0, 0x01, 0x10, 0xe9,
+  0x0e, 0x02, 0x20, 0xf5, 0xe8, 0xfc, 0x01, 0x01, 0x99, 0x03, 0x10, 0xf5, 0xd4, 0x01, 0x00, 0xfd, 0x00, 0x00, 0x01, 0x00, 0x00, 0xcf, 0x01, 0x01,
+  0x0f, 0x00, 0x00, 0x15, 0x00, 0x00, 0x0a, 0x00, 0x10, 0xfb, 0x09, 0x00, 0x00, 0xd5, 0x03, 0x03, 0x01, 0x00, 0x01, 0xda, 0x01, 0x00, 0x05, 0x00,
+  0x00, 0x02, 0x00, 0x01, 0xd0, 0x05, 0x01, 0x48, 0x00, 0x01, 0xbd, 0x07, 0x01, 0xde, 0x01, 0x06, 0x02, 0x00, 0x00, 0xb1, 0x09, 0x01, 0xee, 0x01,
+  0x21, 0xf3, 0xf3, 0x4c, 0x01, 0x12, 0xf4, 0xed, 0x01, 0x00, 0xd6, 0x05, 0x10, 0xf5, 0x05, 0x00, 0x01, 0xf5, 0x01, 0x00, 0xe5, 0x03, 0x15, 0xe7,
+  0x04, 0x00, 0x06, 0x01, 0x00, 0x10, 0xe8, 0xeb, 0x05, 0x00, 0xe4, 0x05, 0x10, 0xe6, 0x0d, 0x00, 0x20, 0xf5, 0xfb, 0x9f, 0x05, 0x10, 0xf7, 0x9f,
+  0x05, 0x01, 0x3b, 0x00, 0x80, 0xe7, 0xe5, 0xe3, 0xdf, 0xe2, 0xe4, 0xe3, 0xe2, 0xbe, 0x07, 0x00, 0xcc, 0x08, 0xf0, 0x03, 0xd8, 0xd3, 0xca, 0xd0,
+  0xce, 0xd0, 0xca, 0xd0, 0xd1, 0xd1, 0xca, 0xca, 0xce, 0xd1, 0xca, 0xce, 0xca, 0xc6, 0x07, 0x00, 0x10, 0xca, 0x9d, 0x01, 0x01, 0x8a, 0x07, 0x40,
+  0xd1, 0xc9, 0xe2, 0xf5, 0x14, 0x09, 0x30, 0xf6, 0xe8, 0xd8, 0xe7, 0x03, 0x03, 0x60, 0x09, 0x60, 0xe8, 0xf5, 0xf5, 0xe6, 0xdd, 0xca, 0xca, 0x01,
+  0x00, 0xb1, 0x03, 0x00, 0xd8, 0x01, 0x13, 0xc3, 0xa8, 0x05, 0x00, 0x23, 0x00, 0x00, 0xa9, 0x05, 0x04, 0xe0, 0x01, 0x00, 0x09, 0x00, 0x01, 0xcf,
+  0x09, 0x01, 0xc3, 0x03, 0x10, 0xe0, 0x90, 0x00, 0x01, 0x4a, 0x01, 0x71, 0xf7, 0xf7, 0xf7, 0xe8, 0xe8, 0xe3, 0xdb, 0x83, 0x00, 0x00, 0xe2, 0x03,
+  0x00, 0xd2, 0x01, 0x00, 0x19, 0x0c, 0x00, 0x05, 0x00, 0x01, 0xdb, 0x01, 0x01, 0x01, 0x00, 0x00, 0xc3, 0x01, 0x00, 0x03, 0x00, 0x02, 0xad, 0x03,
+  0x02, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0xf5, 0x01, 0x00, 0x04, 0x00, 0x03, 0xe1, 0x01, 0x00, 0xd2, 0x01, 0x11, 0xe2, 0x5c,
+  0x09, 0x02, 0x9f, 0x05, 0x31, 0xe0, 0xe1, 0xe3, 0x99, 0x02, 0x00, 0xa0, 0x05, 0x20, 0xe2, 0xe1, 0xe0, 0x01, 0x00, 0xbf, 0x03, 0x01, 0xe3, 0x01,
+  0x80, 0xe4, 0xf1, 0xe5, 0xe5, 0xe7, 0xf2, 0xe7, 0xf3, 0x89, 0x00, 0x03, 0x01, 0x00, 0x00, 0x74, 0x02, 0x00, 0x2c, 0x00, 0x30, 0xf3, 0xe7, 0xf2,
+  0xeb, 0x0c, 0x02, 0xf9, 0x0c, 0x01, 0x46, 0x05, 0xd0, 0xe8, 0xe8, 0xf5, 0xf6, 0xf5, 0xe8, 0xe8, 0xf5, 0xe8, 0xf3, 0xe7, 0xe8, 0xf5, 0x02, 0x00,
+  0x05, 0x01, 0x00, 0x10, 0xf6, 0xc0, 0x01, 0x00, 0xf1, 0x01, 0x00, 0x04, 0x00, 0x02, 0xfe, 0x01, 0x00, 0xef, 0x07, 0x10, 0xfb, 0xa7, 0x07, 0x01,
+  0xda, 0x01, 0x06, 0x01, 0x00, 0x00, 0x2e, 0x00, 0x00, 0xce, 0x05, 0x10, 0xf6, 0xc8, 0x03, 0x05, 0xed, 0x01, 0x04, 0x08, 0x00, 0x10, 0xe8, 0x09,
+  0x00, 0x01, 0x0a, 0x00, 0x31, 0xf5, 0xf4, 0xe8, 0xcb, 0x05, 0x03, 0xe9, 0x03, 0x10, 0xf5, 0xe8, 0x03, 0x00, 0x04, 0x00, 0x07, 0x01, 0x00, 0x03,
+  0xdf, 0x09, 0x00, 0x05, 0x02, 0x41, 0xe8, 0xe8, 0xf4, 0xf5, 0x1a, 0x0d, 0x00, 0xbb, 0x00, 0x11, 0xf4, 0xbf, 0x03, 0x50, 0xf3, 0xe8, 0xe7, 0xe7,
+  0xe6, 0xdb, 0x07, 0x00, 0xe0, 0x05, 0x00, 0xe3, 0x05, 0x13, 0xe4, 0xcf, 0x04, 0x00, 0x15, 0x01, 0x00, 0x2a, 0x01, 0x33, 0xdd, 0xdb, 0xd8, 0x5c,
+  0x01, 0x20, 0xdb, 0xd4, 0xf0, 0x01, 0x31, 0xd8, 0xdb, 0xe4, 0x74, 0x03, 0x40, 0xf7, 0xe8, 0xdd, 0xc6, 0xa6, 0x07, 0x30, 0xce, 0xd1, 0xe3, 0x57,
+  0x00, 0x61, 0xf5, 0xe8, 0xe7, 0xdd, 0xd1, 0xd1, 0xe0, 0x01, 0x00, 0x04, 0x00, 0x01, 0x3e, 0x0b, 0x00, 0x0a, 0x00, 0x00, 0xde, 0x01, 0x01, 0xa6,
+  0x07, 0x00, 0xdd, 0x07, 0x00, 0x02, 0x06, 0x01, 0xca, 0x03, 0x11, 0xd1, 0x01, 0x00, 0x20, 0xd4, 0xd4, 0xc0, 0x03, 0x02, 0xf9, 0x06, 0x00, 0x12,
+  0x04, 0x30, 0xf3, 0xe7, 0xe4, 0xa3, 0x01, 0x01, 0xae, 0x03, 0x00, 0x94, 0x05, 0x00, 0xad, 0x01, 0x00, 0xda, 0x01, 0x00, 0xb6, 0x01, 0x00, 0xca,
+  0x03, 0x00, 0x09, 0x00, 0x00, 0xba, 0x01, 0x00, 0x15, 0x00, 0x02, 0xc7, 0x01, 0x00, 0x18, 0x00, 0x00, 0x01, 0x00, 0x00, 0xd2, 0x01, 0x00, 0x0b,
+  0x00, 0x01, 0x18, 0x00, 0x00, 0x09, 0x00, 0x02, 0x1f, 0x00, 0x02, 0xe4, 0x01, 0x00, 0xa4, 0x03, 0x00, 0xdf, 0x01, 0x10, 0xe0, 0xe0, 0x01, 0x00,
+  0x7e, 0x01, 0x01, 0x80, 0x07, 0x00, 0x5d, 0x09, 0x00, 0xbc, 0x03, 0x00, 0xe6, 0x03, 0x20, 0xe5, 0xe4, 0xc2, 0x01, 0x21, 0xf2, 0xf3, 0x8a, 0x00,
+  0x03, 0x01, 0x00, 0x00, 0x71, 0x02, 0x40, 0xf6, 0xfb, 0xe8, 0xf2, 0xf6, 0x06, 0x10, 0xef, 0x0e, 0x02, 0x00, 0x01, 0x00, 0x00, 0xf9, 0x08, 0x20,
+  0xe3, 0xe4, 0x14, 0x07, 0x07, 0x01, 0x00, 0x00, 0xff, 0x01, 0x02, 0x39, 0x05, 0x00, 0x40, 0x03, 0x00, 0x86, 0x01, 0x02, 0x01, 0x00, 0x02, 0xc1,
+  0x01, 0x02, 0x93, 0x07, 0x01, 0x78, 0x00, 0x00, 0x01, 0x00, 0x04, 0xdf, 0x03, 0x00, 0xed, 0x01, 0x01, 0xb0, 0x05, 0x03, 0x01, 0x00, 0x01, 0x29,
+  0x00, 0x11, 0xfb, 0xf0, 0x01, 0x10, 0xf6, 0xa0, 0x0b, 0x01, 0xec, 0x01, 0x03, 0x03, 0x00, 0x00, 0xb9, 0x07, 0x10, 0xf5, 0xb1, 0x09, 0x20, 0xf4,
+  0xe8, 0xc2, 0x07, 0x00, 0xed, 0x01, 0x00, 0x02, 0x00, 0x00, 0xd6, 0x01, 0x00, 0x15, 0x00, 0x02, 0x23, 0x00, 0x03, 0x76, 0x00, 0x00, 0x84, 0x04,
+  0x00, 0xe1, 0x01, 0x00, 0xc2, 0x0f, 0x01, 0x3d, 0x00, 0x20, 0xf3, 0xf4, 0xe4, 0x05, 0x01, 0xe7, 0x05, 0x37, 0xe6, 0xe7, 0xe6, 0x01, 0x00, 0x10,
+  0xe4, 0x03, 0x00, 0x12, 0xe4, 0xe3, 0x05, 0x60, 0xe4, 0xe3, 0xe4, 0xe3, 0xe6, 0xe3, 0xb7, 0x06, 0x70, 0xe3, 0xe3, 0xe4, 0xe8, 0xf5, 0xf5, 0xfb,
+  0xde, 0x05, 0x20, 0xe2, 0xc9, 0x3c, 0x09, 0x30, 0xce, 0xd8, 0xe4, 0xd3, 0x00, 0x70, 0xf4, 0xe8, 0xe7, 0xe2, 0xd8, 0xd8, 0xca, 0xb3, 0x07, 0x00,
+  0x56, 0x09, 0x10, 0xbf, 0xd7, 0x01, 0x01, 0x40, 0x0b, 0x00, 0x63, 0x09, 0x00, 0x78, 0x07, 0x30, 0xc7, 0xc7, 0xc7, 0xf2, 0x05, 0x00, 0xe6, 0x05,
+  0x20, 0xce, 0xd1, 0xe1, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x4e, 0x01, 0x00, 0x70, 0x0e, 0x50, 0xf5, 0xe8, 0xe8, 0xe4, 0xda, 0xd2,
+  0x01, 0x00, 0xd9, 0x03, 0x10, 0xdb, 0xdf, 0x01, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x03, 0xba, 0x01, 0x00, 0xe7, 0x01, 0x00, 0xb7, 0x01, 0x01,
+  0x0a, 0x00, 0x00, 0x0c, 0x00, 0x00, 0xcc, 0x01, 0x00, 0xe4, 0x01, 0x02, 0x01, 0x00, 0x00, 0x14, 0x00, 0x05, 0x2c, 0x00, 0x00, 0x28, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0xa9, 0x02, 0x00, 0xb1, 0x02, 0x00, 0xa9, 0x03, 0x00, 0xe0, 0x01, 0x00, 0x72, 0x05, 0x00, 0xe0, 0x01, 0x01, 0xdc, 0x01, 0x01,
+  0x06, 0x00, 0x30, 0xe1, 0xe2, 0xe2, 0xfd, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x89, 0x00, 0x03, 0x01, 0x00, 0x01, 0xdf, 0x01, 0x40, 0xf7, 0xf5, 0xe8,
+  0xe5, 0xd8, 0x06, 0x00, 0xce, 0x05, 0x00, 0xde, 0x06, 0x00, 0x05, 0x00, 0x03, 0x01, 0x00, 0x00, 0xe2, 0x05, 0x11, 0xef, 0x02, 0x00, 0x00, 0x03,
+  0x00, 0x21, 0xe3, 0xef, 0x05, 0x00, 0x21, 0xe2, 0xef, 0x02, 0x02, 0x00, 0xef, 0x01, 0x31, 0xe4, 0xe5, 0xe5, 0x36, 0x05, 0x10, 0xe8, 0x03, 0x00,
+  0x00, 0xf5, 0x01, 0x11, 0xe8, 0xf4, 0x03, 0x00, 0x83, 0x01, 0x01, 0x01, 0x00, 0x01, 0xf6, 0x01, 0x03, 0x08, 0x00, 0x00, 0xdb, 0x01, 0x01, 0xf1,
+  0x01, 0x01, 0xf9, 0x03, 0x00, 0xdd, 0x03, 0x00, 0xfc, 0x01, 0x01, 0x8a, 0x09, 0x00, 0x07, 0x00, 0x00, 0xd7, 0x01, 0x00, 0x15, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0xce, 0x01, 0x00, 0xd0, 0x01, 0x00, 0xed, 0x01, 0x03, 0xfe, 0x01, 0x12, 0xf6, 0x07, 0x00, 0x20, 0xf5, 0xf4, 0x43, 0x08, 0x00, 0xe0,
+  0x01, 0x00, 0xdf, 0x01, 0x00, 0x52, 0x01, 0x00, 0x2c, 0x02, 0x00, 0x18, 0x00, 0x00, 0xc5, 0x03, 0x00, 0xca, 0x03, 0x04, 0xac, 0x0d, 0x0a, 0xd6,
+  0x07, 0x00, 0x01, 0x00, 0x01, 0xcc, 0x09, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x01, 0x49, 0x00, 0xf0, 0x06, 0xf6, 0xe9, 0xf5, 0xe7, 0xdd, 0xc6,
+  0xc7, 0xc3, 0xc7, 0xd1, 0xdb, 0xe6, 0xe8, 0xe8, 0xfb, 0xf5, 0xe8, 0xf5, 0xe7, 0xe6, 0xe0, 0x48, 0x0f, 0x20, 0xcb, 0xc6, 0x48, 0x0d, 0x00, 0xa9,
+  0x03, 0x60, 0xc3, 0xc7, 0xcb, 0xc6, 0xc3, 0xbe, 0x0e, 0x00, 0x31, 0xd4, 0xd1, 0xc6, 0xd8, 0x01, 0x00, 0x78, 0x07, 0x00, 0x22, 0x0d, 0x20, 0xce,
+  0xc6, 0xb8, 0x0d, 0x00, 0xea, 0x10, 0x25, 0xef, 0xe8, 0xbf, 0x03, 0x50, 0xf7, 0xf5, 0xf3, 0xe8, 0xe4, 0x9e, 0x01, 0x10, 0xdb, 0x1b, 0x00, 0x00,
+  0x83, 0x09, 0x00, 0xc7, 0x03, 0x00, 0xb3, 0x01, 0x01, 0xc5, 0x01, 0x01, 0xb6, 0x01, 0x00, 0x0b, 0x00, 0x01, 0x0d, 0x00, 0x05, 0x01, 0x00, 0x00,
+  0xdf, 0x01, 0x02, 0x16, 0x00, 0x01, 0xef, 0x01, 0x01, 0x12, 0x00, 0x02, 0x11, 0x00, 0x20, 0xe0, 0xde, 0x77, 0x09, 0x01, 0xdf, 0x01, 0x10, 0xe1,
+  0x06, 0x00, 0x00, 0x7c, 0x08, 0x00, 0x42, 0x01, 0x00, 0xe0, 0x01, 0x03, 0xac, 0x01, 0x02, 0xe1, 0x01, 0x20, 0xe3, 0xe2, 0xf9, 0x00, 0x41, 0xe8,
+  0xe7, 0xe8, 0xf5, 0x8b, 0x00, 0x02, 0x01, 0x00, 0x02, 0x71, 0x03, 0x20, 0xf5, 0xf3, 0xeb, 0x03, 0x00, 0x2d, 0x00, 0x03, 0xda, 0x01, 0x01, 0x07,
+  0x00, 0x00, 0xd3, 0x03, 0x00, 0x38, 0x00, 0x00, 0x01, 0x00, 0x00, 0x58, 0x00, 0x01, 0x6d, 0x0d, 0x10, 0xe1, 0x28, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0xb7, 0x10, 0x01, 0xf8, 0x01, 0x00, 0xfa, 0x01, 0x00, 0xf3, 0x01, 0x30, 0xef, 0xe3, 0xe1, 0x0f, 0x02, 0x00, 0x1e, 0x03, 0x00, 0xf1, 0x0e, 0x10,
+  0xe6, 0x4f, 0x01, 0x30, 0xe6, 0xe7, 0xe6, 0xec, 0x05, 0x00, 0x76, 0x00, 0x00, 0x01, 0x00, 0x06, 0xf9, 0x01, 0x00, 0xa1, 0x00, 0x01, 0x7b, 0x00,
+  0x01, 0xf1, 0x01, 0x00, 0x04, 0x00, 0x00, 0x06, 0x00, 0x01, 0x19, 0x00, 0x01, 0x1f, 0x00, 0x00, 0x05, 0x00, 0x00, 0xcb, 0x01, 0x01, 0xff, 0x01,
+  0x00, 0xfe, 0x01, 0x00, 0x20, 0x00, 0x12, 0xfb, 0x12, 0x00, 0x00, 0xfe, 0x0d, 0x00, 0xf8, 0x0b, 0x02, 0xe0, 0x01, 0x00, 0x60, 0x09, 0x00, 0xf7,
+  0x07, 0x01, 0x3f, 0x00, 0x00, 0x8a, 0x07, 0x00, 0xe1, 0x01, 0x01, 0xc5, 0x05, 0x11, 0xf5, 0xd5, 0x05, 0x00, 0xd2, 0x05, 0x05, 0x02, 0x00, 0x10,
+  0xf2, 0xf7, 0x01, 0x00, 0x14, 0x00, 0x02, 0x6c, 0x07, 0x00, 0x37, 0x00, 0xa1, 0xf6, 0xf5, 0xe6, 0xd4, 0xc6, 0xc7, 0xcb, 0xd4, 0xe3, 0xe7, 0x49,
+  0x02, 0x00, 0x02, 0x0f, 0x01, 0xea, 0x03, 0x02, 0xfa, 0x00, 0x03, 0xde, 0x05, 0x01, 0x5a, 0x13, 0x31, 0xdd, 0xe0, 0xde, 0x75, 0x05, 0x00, 0x47,
+  0x05, 0x00, 0x94, 0x03, 0x50, 0xd8, 0xd3, 0xd0, 0xdb, 0xd3, 0xc2, 0x0f, 0x31, 0xde, 0xef, 0xe6, 0x51, 0x04, 0x01, 0x8e, 0x00, 0x01, 0x60, 0x09,
+  0x70, 0xe0, 0xdf, 0xde, 0xdd, 0xd9, 0xd8, 0xd8, 0x8a, 0x11, 0x04, 0xbd, 0x03, 0x00, 0xad, 0x01, 0x10, 0xe0, 0x59, 0x09, 0x00, 0x0b, 0x00, 0x00,
+  0xb9, 0x01, 0x00, 0xc1, 0x01, 0x01, 0xca, 0x01, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x01, 0x6b, 0x00, 0x03, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x06,
+  0x0e, 0x00, 0x02, 0xe1, 0x01, 0x00, 0x72, 0x06, 0x24, 0xe1, 0xe3, 0xe0, 0x01, 0x20, 0xf3, 0xe5, 0xa1, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00,
+  0x30, 0xe3, 0xe2, 0xe3, 0xec, 0x00, 0x39, 0xe7, 0xf3, 0xe5, 0xe0, 0x01, 0x00, 0xe2, 0x00, 0x40, 0xf6, 0xf5, 0xe7, 0xe4, 0x07, 0x02, 0x00, 0xd7,
+  0x01, 0x00, 0x2c, 0x00, 0x00, 0xa4, 0x01, 0x01, 0x08, 0x00, 0x03, 0x38, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0xd7, 0x01, 0x07, 0x01,
+  0x00, 0x00, 0xf7, 0x07, 0x00, 0xe7, 0x01, 0x01, 0xe4, 0x06, 0x00, 0x80, 0x00, 0x00, 0x07, 0x00, 0x10, 0xdf, 0x85, 0x00, 0x00, 0x6b, 0x02, 0x40,
+  0xdf, 0xe0, 0xdf, 0xe2, 0xc5, 0x10, 0x00, 0x19, 0x00, 0x41, 0xdf, 0xe1, 0xe1, 0xe1, 0x47, 0x00, 0x00, 0xe8, 0x05, 0x30, 0xe6, 0xe7, 0xe5, 0xf4,
+  0x01, 0x00, 0xec, 0x01, 0x00, 0xcd, 0x01, 0x00, 0xf7, 0x01, 0x04, 0x01, 0x00, 0x06, 0x0a, 0x00, 0x08, 0x01, 0x00, 0x10, 0xf6, 0xe4, 0x01, 0x03,
+  0xe1, 0x01, 0x00, 0xef, 0x05, 0x00, 0x17, 0x02, 0x01, 0xad, 0x0a, 0x03, 0x01, 0x00, 0x10, 0xf7, 0xa9, 0x0b, 0x00, 0xc7, 0x00, 0x01, 0xb5, 0x04,
+  0x00, 0xae, 0x09, 0x00, 0xf5, 0x03, 0x01, 0xd6, 0x05, 0x00, 0x52, 0x02, 0x30, 0xe8, 0xf4, 0xf5, 0xdb, 0x01, 0x00, 0x02, 0x00, 0x03, 0x01, 0x00,
+  0x00, 0xc6, 0x01, 0x10, 0xe8, 0x20, 0x04, 0x01, 0x3a, 0x06, 0x81, 0xf5, 0xe8, 0xe3, 0xd1, 0xc6, 0xce, 0xde, 0xe0, 0xb1, 0x05, 0x00, 0x2b, 0x00,
+  0x01, 0xe9, 0x03, 0x06, 0xe5, 0x05, 0x11, 0xe4, 0x04, 0x00, 0x00, 0x02, 0x00, 0x01, 0x09, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x03,
+  0x00, 0x10, 0xe3, 0xd6, 0x0b, 0x51, 0xe6, 0xe6, 0xe6, 0xe7, 0xe8, 0x70, 0x02, 0x01, 0x32, 0x06, 0x40, 0xf7, 0xf7, 0xf5, 0xe7, 0xd8, 0x06, 0x10,
+  0xe3, 0x0f, 0x01, 0x00, 0x99, 0x01, 0x00, 0xe2, 0x0c, 0x02, 0x05, 0x00, 0x21, 0xe2, 0xde, 0x95, 0x12, 0x00, 0x01, 0x00, 0x02, 0x2a, 0x01, 0x00,
+  0x01, 0x00, 0x00, 0x9c, 0x05, 0x00, 0x01, 0x00, 0x00, 0xab, 0x12, 0x01, 0x06, 0x00, 0x01, 0x1d, 0x00, 0x02, 0xbc, 0x03, 0x01, 0x01, 0x00, 0x10,
+  0xe0, 0x1a, 0x00, 0x10, 0xe0, 0x7e, 0x01, 0x00, 0x62, 0x01, 0x30, 0xe2, 0xe2, 0xe3, 0x00, 0x0f, 0x01, 0xb8, 0x00, 0x10, 0xe5, 0xf9, 0x0e, 0x03,
+  0x02, 0x00, 0x00, 0x8a, 0x01, 0x01, 0xbc, 0x00, 0x32, 0xe5, 0xe5, 0xe7, 0xeb, 0x09, 0x01, 0x01, 0x00, 0x00, 0xc0, 0x03, 0x40, 0xf5, 0xf6, 0xe8,
+  0xe7, 0x76, 0x03, 0x07, 0x01, 0x00, 0x04, 0xe9, 0x01, 0x05, 0x01, 0x00, 0x00, 0x42, 0x00, 0x03, 0x2d, 0x02, 0x00, 0xbd, 0x01, 0x00, 0x06, 0x00,
+  0x00, 0x4f, 0x02, 0x01, 0xf2, 0x01, 0x05, 0xe0, 0x01, 0x02, 0x09, 0x00, 0x03, 0x01, 0x00, 0x00, 0x80, 0x04, 0x00, 0x9f, 0x00, 0x21, 0xdd, 0xdc,
+  0xa8, 0x02, 0x21, 0xde, 0xdc, 0x0f, 0x00, 0x00, 0xc0, 0x10, 0x00, 0xda, 0x00, 0x20, 0xe1, 0xe0, 0xe6, 0x03, 0x70, 0xe7, 0xe8, 0xe6, 0xe6, 0xe2,
+  0xe3, 0xe2, 0xfb, 0x0c, 0x00, 0x0c, 0x0f, 0x02, 0x2d, 0x01, 0x00, 0x0d, 0x00, 0x03, 0xf0, 0x03, 0x02, 0x01, 0x00, 0x01, 0xf7, 0x01, 0x00, 0x04,
+  0x00, 0x00, 0x31, 0x07, 0x00, 0x90, 0x02, 0x00, 0xd4, 0x09, 0x00, 0x01, 0x00, 0x01, 0xc1, 0x00, 0x00, 0x34, 0x03, 0x00, 0x8b, 0x16, 0x00, 0xb6,
+  0x05, 0x00, 0x4b, 0x08, 0x10, 0xf5, 0x95, 0x0b, 0x10, 0xf3, 0xd8, 0x01, 0x00, 0x31, 0x00, 0x01, 0xdf, 0x01, 0x00, 0xb2, 0x0b, 0x00, 0x9e, 0x09,
+  0x00, 0x0e, 0x00, 0x00, 0x15, 0x00, 0x00, 0xf3, 0x05, 0x10, 0xf6, 0x0a, 0x00, 0x10, 0xf3, 0x51, 0x09, 0x91, 0xe4, 0xe6, 0xe7, 0xe3, 0xd0, 0xd8,
+  0xe0, 0xda, 0xe5, 0x27, 0x06, 0x01, 0xa5, 0x11, 0x01, 0xdf, 0x05, 0x05, 0x01, 0x00, 0x00, 0xed, 0x01, 0x00, 0x93, 0x00, 0x08, 0x01, 0x00, 0x03,
+  0x9e, 0x04, 0x02, 0x01, 0x00, 0x20, 0xe8, 0xf3, 0x7b, 0x00, 0x00, 0xdc, 0x01, 0x01, 0xc0, 0x03, 0x11, 0xf5, 0xed, 0x09, 0x01, 0x20, 0x02, 0x00,
+  0x16, 0x02, 0x00, 0xd6, 0x0f, 0x11, 0xe5, 0x05, 0x00, 0x00, 0xde, 0x02, 0x00, 0x15, 0x02, 0x00, 0xdc, 0x06, 0x03, 0x09, 0x00, 0x00, 0x54, 0x01,
+  0x01, 0xbd, 0x10, 0x00, 0x3a, 0x03, 0x00, 0x02, 0x0d, 0x00, 0xa2, 0x03, 0x00, 0x46, 0x09, 0x40, 0xde, 0xdf, 0xe0, 0xdf, 0xdc, 0x01, 0x01, 0x59,
+  0x01, 0x10, 0xe2, 0xdf, 0x01, 0x11, 0xe3, 0x73, 0x01, 0x00, 0xdb, 0x17, 0x00, 0xc0, 0x03, 0x00, 0x60, 0x09, 0x11, 0xe5, 0x75, 0x05, 0x00, 0x99,
+  0x01, 0x01, 0x01, 0x00, 0x10, 0xe2, 0x61, 0x0c, 0x43, 0xe5, 0xe5, 0xe4, 0xf2, 0xec, 0x09, 0x00, 0x01, 0x00, 0x10, 0xf6, 0x12, 0x01, 0x25, 0xfb,
+  0xf5, 0xe0, 0x01, 0x02, 0x2d, 0x00, 0x00, 0x4e, 0x00, 0x09, 0x01, 0x00, 0x00, 0x48, 0x00, 0x00, 0x14, 0x00, 0x01, 0x4d, 0x00, 0x00, 0x68, 0x00,
+  0x00, 0x75, 0x00, 0x00, 0x06, 0x00, 0x00, 0x12, 0x00, 0x00, 0x85, 0x00, 0x02, 0x01, 0x00, 0x00, 0x15, 0x00, 0x01, 0x0f, 0x00, 0x00, 0x9a, 0x00,
+  0x03, 0x7c, 0x04, 0x01, 0x8b, 0x06, 0x01, 0x07, 0x00, 0x01, 0x9b, 0x04, 0x00, 0xa3, 0x02, 0x00, 0xf6, 0x01, 0x01, 0x72, 0x04, 0x00, 0xd5, 0x00,
+  0x01, 0x24, 0x00, 0x00, 0x16, 0x00, 0x01, 0xd3, 0x04, 0x71, 0xde, 0xdd, 0xde, 0xdb, 0xda, 0xde, 0xdd, 0xdc, 0x02, 0x30, 0xe2, 0xe2, 0xe3, 0xa2,
+  0x15, 0x25, 0xe4, 0xe3, 0x34, 0x07, 0x06, 0xeb, 0x03, 0x00, 0x51, 0x01, 0x06, 0xc6, 0x00, 0x00, 0x55, 0x01, 0x12, 0xf5, 0x0f, 0x0b, 0x10, 0xf7,
+  0xd5, 0x01, 0x01, 0xad, 0x03, 0x00, 0x27, 0x00, 0x00, 0xfc, 0x03, 0x00, 0xd5, 0x05, 0x00, 0xae, 0x09, 0x04, 0xb0, 0x09, 0x00, 0x0a, 0x00, 0x00,
+  0x1d, 0x00, 0x00, 0xf2, 0x0b, 0x00, 0x37, 0x00, 0x92, 0xde, 0xd3, 0xe6, 0xe7, 0xe4, 0xe0, 0xde, 0xe2, 0xe7, 0x24, 0x04, 0x40, 0xf5, 0xf5, 0xf5,
+  0xe7, 0x0b, 0x02, 0x01, 0x44, 0x00, 0x00, 0xd6, 0x01, 0x00, 0xc7, 0x07, 0x02, 0x67, 0x02, 0x01, 0x01, 0x00, 0x03, 0x06, 0x04, 0x00, 0xea, 0x06,
+  0x00, 0x22, 0x00, 0x00, 0x09, 0x04, 0x13, 0xe8, 0xce, 0x0b, 0x01, 0x05, 0x00, 0x30, 0xf7, 0xf6, 0xf4, 0x20, 0x00, 0x00, 0xaf, 0x00, 0x0f, 0x01,
+  0x00, 0x00, 0x00, 0x15, 0x02, 0x00, 0xab, 0x17, 0x04, 0x06, 0x00, 0x00, 0x12, 0x08, 0x00, 0xb3, 0x0a, 0x30, 0xe6, 0xe6, 0xe4, 0x04, 0x02, 0x00,
+  0x15, 0x04, 0x01, 0x01, 0x00, 0x00, 0x75, 0x01, 0x00, 0x71, 0x01, 0x00, 0x01, 0x00, 0x11, 0xe4, 0x09, 0x00, 0x00, 0x00, 0x0b, 0x01, 0x7f, 0x01,
+  0x10, 0xe4, 0x80, 0x16, 0x00, 0x48, 0x02, 0x00, 0x35, 0x09, 0x01, 0x1e, 0x07, 0x04, 0x01, 0x00, 0x00, 0x0b, 0x16, 0x55, 0xe4, 0xe3, 0xe4, 0xe6,
+  0xf4, 0x19, 0x01, 0x00, 0xfa, 0x0e, 0x00, 0xd4, 0x00, 0x05, 0xe0, 0x01, 0x05, 0x55, 0x00, 0x07, 0x09, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x01, 0x00,
+  0x04, 0x0c, 0x00, 0x02, 0xcd, 0x01, 0x00, 0x01, 0x00, 0x00, 0x8b, 0x01, 0x00, 0x90, 0x01, 0x00, 0x92, 0x01, 0x00, 0x18, 0x00, 0x00, 0x0a, 0x00,
+  0x03, 0xc4, 0x01, 0x00, 0xd6, 0x01, 0x00, 0xe1, 0x01, 0x00, 0x06, 0x00, 0x00, 0xde, 0x01, 0x01, 0xcb, 0x01, 0x01, 0x68, 0x08, 0x00, 0x12, 0x0a,
+  0x03, 0x29, 0x00, 0x00, 0xdf, 0x06, 0x00, 0x58, 0x18, 0x00, 0x09, 0x02, 0x10, 0xdb, 0x8e, 0x14, 0x00, 0x60, 0x18, 0x20, 0xd8, 0xd9, 0x48, 0x0c,
+  0x20, 0xdb, 0xd8, 0xc2, 0x06, 0x10, 0xd9, 0x79, 0x16, 0x00, 0x25, 0x02, 0x01, 0xe0, 0x10, 0x01, 0x05, 0x01, 0x10, 0xe6, 0xbc, 0x0e, 0x00, 0xc1,
+  0x00, 0x02, 0x01, 0x00, 0x30, 0xf7, 0xf7, 0xf5, 0xf3, 0x03, 0x00, 0xa1, 0x01, 0x01, 0xa2, 0x01, 0x00, 0x62, 0x01, 0x02, 0xc4, 0x01, 0x01, 0x0f,
+  0x00, 0x01, 0x05, 0x00, 0x00, 0xb0, 0x03, 0x01, 0xc0, 0x07, 0x02, 0xd3, 0x03, 0x00, 0x16, 0x00, 0x00, 0x60, 0x13, 0xb0, 0xe6, 0xd0, 0xca, 0xde,
+  0xe6, 0xe7, 0xe4, 0xe3, 0xda, 0xdc, 0xe8, 0xc1, 0x03, 0x01, 0x84, 0x07, 0x01, 0x02, 0x02, 0x00, 0x43, 0x00, 0x10, 0xf3, 0x20, 0x0e, 0x00, 0xdb,
+  0x01, 0x02, 0x02, 0x00, 0x01, 0xf5, 0x05, 0x00, 0x07, 0x00, 0x01, 0x0e, 0x00, 0x05, 0x4a, 0x0a, 0x13, 0xfb, 0x3d, 0x0b, 0x00, 0x89, 0x00, 0x00,
+  0x2e, 0x06, 0x00, 0x63, 0x00, 0x01, 0x01, 0x00, 0x00, 0xff, 0x01, 0x05, 0x02, 0x00, 0x00, 0x3e, 0x05, 0x02, 0xad, 0x15, 0x03, 0x01, 0x00, 0x00,
+  0x3e, 0x02, 0x08, 0x11, 0x00, 0x02, 0x0f, 0x04, 0x00, 0xf4, 0x01, 0x00, 0x02, 0x00, 0x00, 0xf5, 0x01, 0x00, 0xaf, 0x0c, 0x01, 0xfb, 0x01, 0x00,
+  0xfd, 0x01, 0x00, 0xe7, 0x11, 0x01, 0xd5, 0x0a, 0x00, 0x3b, 0x1b, 0x00, 0xb8, 0x01, 0x10, 0xf5, 0x08, 0x12, 0x00, 0x1c, 0x00, 0x10, 0xe4, 0xe8,
+  0x0a, 0x41, 0xe4, 0xe4, 0xe4, 0xe7, 0xc7, 0x01, 0x10, 0xe4, 0x9b, 0x17, 0x03, 0x01, 0x00, 0x00, 0xdb, 0x04, 0x00, 0xbe, 0x06, 0x01, 0x19, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0xd6, 0x01, 0x00, 0xa4, 0x03, 0x00, 0x05, 0x00, 0x01, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x00, 0xb8, 0x01, 0x00, 0xba, 0x01,
+  0x00, 0x3f, 0x02, 0x00, 0x0a, 0x00, 0x01, 0x01, 0x00, 0x00, 0x8e, 0x05, 0x00, 0x05, 0x00, 0x01, 0xa7, 0x01, 0x11, 0xe2, 0xb0, 0x01, 0x00, 0x0d,
+  0x00, 0x02, 0x76, 0x06, 0x01, 0xc7, 0x01, 0x03, 0xd3, 0x01, 0x00, 0xe2, 0x01, 0x00, 0x04, 0x00, 0x00, 0xa2, 0x01, 0x01, 0xe0, 0x01, 0x00, 0x0d,
+  0x00, 0x02, 0xe1, 0x01, 0x02, 0x28, 0x00, 0x01, 0x0b, 0x0e, 0x01, 0xce, 0x01, 0x00, 0xbf, 0x08, 0x00, 0xf5, 0x11, 0x02, 0xb6, 0x15, 0x00, 0x01,
+  0x00, 0x10, 0xd4, 0x0e, 0x00, 0x30, 0xdb, 0xe0, 0xe2, 0x8a, 0x19, 0x40, 0xd9, 0xe2, 0xe3, 0xde, 0x71, 0x0c, 0x50, 0xdb, 0xdb, 0xda, 0xe0, 0xe8,
+  0xa5, 0x05, 0x00, 0xc3, 0x00, 0x01, 0x01, 0x00, 0x70, 0xf7, 0xf6, 0xe8, 0xe1, 0xe2, 0xdf, 0xe4, 0x1f, 0x01, 0x10, 0xe5, 0x82, 0x01, 0x40, 0xe7,
+  0xe4, 0xe5, 0xe6, 0xe3, 0x07, 0x00, 0xad, 0x0c, 0x00, 0xea, 0x01, 0x00, 0x8c, 0x01, 0x03, 0x06, 0x00, 0x01, 0x07, 0x00, 0x01, 0x83, 0x01, 0x00,
+  0xbd, 0x03, 0xd2, 0xf5, 0xe7, 0xe0, 0xc6, 0xd0, 0xde, 0xdb, 0xe4, 0xe7, 0xe6, 0xdc, 0xe1, 0xe8, 0xe8, 0x09, 0x00, 0x07, 0x02, 0x01, 0x12, 0x02,
+  0x00, 0x06, 0x02, 0x00, 0xd1, 0x01, 0x00, 0x04, 0x00, 0x00, 0xc8, 0x0b, 0x01, 0x35, 0x00, 0x01, 0x16, 0x00, 0x06, 0x01, 0x00, 0x11, 0xf6, 0xc2,
+  0x13, 0x07, 0x8a, 0x00, 0x20, 0xe9, 0xe9, 0xe6, 0x05, 0x04, 0x01, 0x00, 0x00, 0x6b, 0x00, 0x02, 0x02, 0x00, 0x03, 0xbf, 0x0f, 0x01, 0x01, 0x00,
+  0x01, 0x11, 0x00, 0x02, 0x8d, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x32, 0x08, 0x01, 0x02, 0x02, 0x00, 0x0f, 0x00, 0x03, 0xfc, 0x0b, 0x10, 0xf3, 0xad,
+  0x04, 0x05, 0xad, 0x19, 0x03, 0xbf, 0x17, 0x03, 0x07, 0x00, 0x10, 0xf3, 0x63, 0x0a, 0x00, 0xb3, 0x04, 0x04, 0x44, 0x06, 0x80, 0xe6, 0xe7, 0xe7,
+  0xe7, 0xe7, 0xe6, 0xe7, 0xe6, 0xa4, 0xe6, 0xe5, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe7, 0xf6, 0xe9, 0x01, 0x00, 0xb2, 0xf7, 0xf7, 0xf5, 0xfb, 0xf6,
+  0xfb, 0xf5, 0xf5, 0xe8, 0xe4, 0xe3, 0x01, 0x00, 0x11, 0xe2, 0x04, 0x00, 0x00, 0x06, 0x00, 0x03, 0x07, 0x00, 0x30, 0xe2, 0xe2, 0xe2, 0x09, 0x00,
+  0x41, 0xe2, 0xe0, 0xe2, 0xe2, 0x04, 0x00, 0x00, 0x01, 0x00, 0x10, 0xe0, 0x02, 0x00, 0x03, 0x03, 0x00, 0x22, 0xe0, 0xde, 0x0e, 0x00, 0x52, 0xde,
+  0xe0, 0xe0, 0xe0, 0xe2, 0x08, 0x00, 0x83, 0xde, 0xde, 0xde, 0xdd, 0xde, 0xdd, 0xdd, 0xde, 0x08, 0x00, 0x01, 0x04, 0x00, 0x02, 0x05, 0x00, 0x10,
+  0xdb, 0x09, 0x00, 0x00, 0x01, 0x00, 0x01, 0x07, 0x00, 0x21, 0xe0, 0xe0, 0x15, 0x00, 0x00, 0x0c, 0x00, 0x31, 0xdd, 0xdb, 0xdb, 0x06, 0x00, 0x70,
+  0xd8, 0xd8, 0xdb, 0xdb, 0xd8, 0xd4, 0xd8, 0x01, 0x00, 0x10, 0xdb, 0x0a, 0x00, 0x01, 0x0b, 0x00, 0xf1, 0x00, 0xd4, 0xdb, 0xdd, 0xe2, 0xde, 0xdb,
+  0xd8, 0xd8, 0xd4, 0xd8, 0xe0, 0xde, 0xdb, 0xd3, 0xd4, 0x15, 0x00, 0x44, 0xe0, 0xe8, 0xf7, 0xf7, 0xc7, 0x00, 0xf0, 0x0f, 0xf7, 0xf7, 0xf7, 0xe9,
+  0xf5, 0xe8, 0xe1, 0xdb, 0xd3, 0xd1, 0xdb, 0xdd, 0xe3, 0xe6, 0xe2, 0xe4, 0xe7, 0xf5, 0xe8, 0xe5, 0xd9, 0xd6, 0xde, 0xe6, 0xe6, 0xe7, 0xe8, 0xe7,
+  0xe5, 0xe1, 0xa7, 0x00, 0xb0, 0xe4, 0xe6, 0xe4, 0xe0, 0xe4, 0xe3, 0xe6, 0xe6, 0xe6, 0xe7, 0xe7, 0x03, 0x00, 0x23, 0xe6, 0xe7, 0x01, 0x00, 0xa0,
+  0xe8, 0xe8, 0xe7, 0xe3, 0xd3, 0xd4, 0xdb, 0xde, 0xd3, 0xe2, 0x13, 0x00, 0xc7, 0xf5, 0xf5, 0xf7, 0xf6, 0xf6, 0xfb, 0xf6, 0xf6, 0xf5, 0xf3, 0xe8,
+  0xf5, 0x01, 0x00, 0x10, 0xf4, 0x05, 0x00, 0x05, 0x01, 0x00, 0x35, 0xf4, 0xf5, 0xfb, 0x12, 0x00, 0x00, 0x08, 0x00, 0x61, 0xf6, 0xf5, 0xf6, 0xfb,
+  0xf7, 0xf7, 0x87, 0x00, 0x00, 0x05, 0x00, 0x00, 0x08, 0x00, 0x40, 0xf5, 0xf7, 0xf6, 0xf7, 0x1f, 0x00, 0x03, 0x01, 0x00, 0x32, 0xf6, 0xf4, 0xf5,
+  0x02, 0x00, 0x01, 0x01, 0x00, 0x10, 0xe8, 0x02, 0x00, 0x46, 0xf4, 0xf5, 0xf6, 0xe8, 0x13, 0x00, 0x02, 0x01, 0x00, 0x04, 0x0d, 0x00, 0x00, 0x21,
+  0x00, 0x00, 0x06, 0x00, 0x41, 0xf5, 0xe8, 0xe8, 0xe8, 0x04, 0x00, 0x10, 0xf3, 0x90, 0x00, 0x30, 0xe8, 0xe8, 0xf3, 0x03, 0x00, 0x01, 0x05, 0x00,
+  0x50, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xab, 0x00, 0x90, 0xe8, 0xf4, 0xe8, 0xf3, 0xe7, 0xe8, 0xf3, 0xe7, 0xf3, 0xcc, 0x00, 0xb4, 0xf3, 0xe7, 0xe7,
+  0xe6, 0xe5, 0xe4, 0xe4, 0xe4, 0xe4, 0xe5, 0xe7, 0x8a, 0x00, 0x50, 0xe9, 0xe9, 0xf7, 0xfb, 0xf7, 0x2d, 0x00, 0x34, 0xf5, 0xe8, 0xe4, 0xe1, 0x01,
+  0x03, 0x01, 0x00, 0x01, 0xdb, 0x01, 0x02, 0x09, 0x00, 0x00, 0xd2, 0x01, 0x10, 0xe3, 0xd5, 0x01, 0x06, 0x01, 0x00, 0x03, 0xcc, 0x01, 0x02, 0x07,
+  0x00, 0x00, 0xda, 0x01, 0x00, 0xe8, 0x01, 0x11, 0xde, 0xf0, 0x01, 0x10, 0xde, 0xdf, 0x01, 0x02, 0xb8, 0x01, 0x02, 0x06, 0x00, 0x00, 0x07, 0x00,
+  0x10, 0xdb, 0xd9, 0x01, 0x01, 0x0b, 0x00, 0x00, 0x14, 0x00, 0x10, 0xdb, 0xd2, 0x01, 0x02, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0f, 0x00, 0x01,
+  0x23, 0x00, 0xa0, 0xde, 0xde, 0xde, 0xdb, 0xdb, 0xdb, 0xdb, 0xdd, 0xdb, 0xdb, 0xd6, 0x01, 0x10, 0xd8, 0x14, 0x00, 0x30, 0xd4, 0xd1, 0xd4, 0xe9,
+  0x01, 0x30, 0xde, 0xe3, 0xdb, 0x07, 0x00, 0x20, 0xdd, 0xe2, 0xe6, 0x01, 0x80, 0xd1, 0xd4, 0xd4, 0xd8, 0xdb, 0xe0, 0xe7, 0xf7, 0xd7, 0x01, 0x02,
+  0x01, 0x00, 0xf0, 0x00, 0xf7, 0xf7, 0xf7, 0xf5, 0xe8, 0xe4, 0xde, 0xd8, 0xd8, 0xd3, 0xd4, 0xd3, 0xdb, 0xe2, 0xe3, 0xd8, 0x01, 0xf0, 0x24, 0xe6,
+  0xe2, 0xe0, 0xda, 0xe1, 0xe4, 0xe7, 0xe7, 0xe7, 0xe4, 0xe2, 0xda, 0xd9, 0xd3, 0xdd, 0xe3, 0xda, 0xd3, 0xde, 0xdd, 0xd3, 0xd1, 0xd8, 0xdb, 0xd8,
+  0xd9, 0xdb, 0xdb, 0xd1, 0xd0, 0xd4, 0xdb, 0xdb, 0xd0, 0xd8, 0xd0, 0xd3, 0xde, 0xdc, 0xdd, 0xe0, 0xde, 0xdd, 0xe0, 0xdb, 0xde, 0xdd, 0xdb, 0xd6,
+  0xd6, 0xe8, 0x51, 0x00, 0x10, 0xf6, 0x05, 0x00, 0x30, 0xf5, 0xe8, 0xe8, 0xb8, 0x01, 0x04, 0x01, 0x00, 0x54, 0xf6, 0xe8, 0xf6, 0xe8, 0xf6, 0x10,
+  0x00, 0x11, 0xf6, 0x5d, 0x01, 0x01, 0x01, 0x00, 0x10, 0xf7, 0x64, 0x01, 0x00, 0x08, 0x00, 0x02, 0x89, 0x00, 0x00, 0x04, 0x00, 0x01, 0x01, 0x00,
+  0x10, 0xf7, 0x17, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x42, 0xf5, 0xf5, 0xfb, 0xf5, 0x2a, 0x00, 0x30, 0xf5, 0xfb, 0xf5, 0x0d, 0x00, 0x00,
+  0xc9, 0x01, 0x12, 0xfb, 0x55, 0x03, 0x01, 0x10, 0x00, 0x20, 0xf6, 0xf6, 0x0e, 0x00, 0x00, 0x09, 0x00, 0x22, 0xf5, 0xf4, 0x37, 0x00, 0x01, 0x17,
+  0x00, 0x31, 0xfb, 0xf5, 0xf5, 0x0a, 0x00, 0x04, 0xf6, 0x01, 0x00, 0xef, 0x01, 0x02, 0xf6, 0x01, 0x01, 0x1f, 0x00, 0x06, 0x52, 0x00, 0x00, 0x18,
+  0x00, 0x00, 0x14, 0x00, 0x00, 0x18, 0x02, 0x11, 0xe8, 0xbf, 0x02, 0x24, 0xe7, 0xe8, 0xf9, 0x02, 0x00, 0x8c, 0x00, 0x00, 0x47, 0x00, 0x60, 0xf6,
+  0xf5, 0xe7, 0xe5, 0xe3, 0xe4, 0xcc, 0x01, 0x01, 0x01, 0x00, 0x03, 0x07, 0x00, 0x00, 0xdb, 0x01, 0x00, 0x06, 0x00, 0x00, 0xdd, 0x01, 0x01, 0x04,
+  0x00, 0x01, 0xe3, 0x01, 0x02, 0x04, 0x00, 0x00, 0xd8, 0x01, 0x04, 0x01, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x13, 0x00, 0x00, 0x01, 0x00, 0x02, 0xde,
+  0x01, 0x02, 0xe0, 0x01, 0x02, 0x08, 0x00, 0x10, 0xdb, 0xbd, 0x01, 0x00, 0xc4, 0x01, 0x03, 0xc2, 0x01, 0x00, 0x14, 0x00, 0x00, 0x01, 0x00, 0x11,
+  0xde, 0x2b, 0x00, 0x00, 0x0a, 0x00, 0x20, 0xdd, 0xdb, 0x27, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x07, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x0c, 0x00, 0x00,
+  0xd0, 0x01, 0x03, 0x01, 0x00, 0x41, 0xd8, 0xdb, 0xe0, 0xe2, 0xfa, 0x01, 0x20, 0xde, 0xe2, 0x1b, 0x00, 0x01, 0xdb, 0x03, 0x00, 0xc0, 0x03, 0x00,
+  0xc1, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf7, 0xe9, 0xf7, 0xf6, 0xf5, 0xe6, 0xe6, 0xe6, 0xe5, 0x03, 0x21, 0xd3, 0xd4, 0xef, 0x03, 0xf0, 0x08, 0xe6,
+  0xe6, 0xe6, 0xe6, 0xe4, 0xe4, 0xef, 0xe1, 0xe5, 0xe7, 0xe6, 0xe7, 0xe4, 0xe3, 0xd9, 0xd9, 0xe0, 0xda, 0xde, 0xe2, 0xdd, 0xd0, 0xce, 0x1c, 0x02,
+  0xf0, 0x07, 0xd4, 0xce, 0xc6, 0xc7, 0xcb, 0xce, 0xce, 0xce, 0xc7, 0xc6, 0xce, 0xd3, 0xd8, 0xd9, 0xe2, 0xdd, 0xd0, 0xdd, 0xde, 0xd1, 0xce, 0xdd,
+  0x0c, 0x02, 0x50, 0xf6, 0xe9, 0xf7, 0xf5, 0xe7, 0xd0, 0x01, 0x20, 0xe6, 0xe3, 0xdb, 0x03, 0x00, 0x38, 0x01, 0x02, 0x55, 0x01, 0x04, 0xef, 0x01,
+  0x01, 0x08, 0x00, 0x00, 0xb6, 0x01, 0x00, 0x01, 0x00, 0x02, 0x0e, 0x02, 0x01, 0x09, 0x00, 0x01, 0xdc, 0x01, 0x02, 0x06, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x20, 0x00, 0x41, 0xf7, 0xf7, 0xf6, 0xfb, 0x0d, 0x00, 0x00, 0x29, 0x00, 0x02, 0x04, 0x00, 0x00, 0x03,
+  0x00, 0x10, 0xf5, 0x9d, 0x01, 0x01, 0xdd, 0x01, 0x02, 0x14, 0x00, 0x02, 0xe6, 0x01, 0x00, 0x50, 0x00, 0x00, 0x98, 0x03, 0x01, 0x64, 0x00, 0x10,
+  0xf5, 0x08, 0x00, 0x00, 0x16, 0x00, 0x00, 0x29, 0x00, 0x01, 0x01, 0x00, 0x31, 0xf4, 0xf5, 0xf4, 0x8c, 0x00, 0x31, 0xf5, 0xf5, 0xfb, 0x5a, 0x00,
+  0x02, 0x17, 0x00, 0x01, 0x07, 0x02, 0x02, 0x01, 0x00, 0x83, 0xe8, 0xe8, 0xe8, 0xe8, 0xe7, 0xe8, 0xe8, 0xf5, 0x89, 0x00, 0x00, 0x8c, 0x00, 0x00,
+  0x60, 0x00, 0x10, 0xf5, 0xc0, 0x03, 0x10, 0xe3, 0xe1, 0x01, 0x00, 0xd4, 0x01, 0x01, 0x05, 0x00, 0x00, 0x07, 0x00, 0x00, 0xd6, 0x01, 0x00, 0x07,
+  0x00, 0x00, 0x09, 0x00, 0x08, 0x01, 0x00, 0x01, 0xcd, 0x01, 0x02, 0xcf, 0x01, 0x06, 0x01, 0x00, 0x03, 0x12, 0x00, 0x00, 0x76, 0x05, 0x00, 0x96,
+  0x05, 0x00, 0x9a, 0x03, 0x10, 0xdb, 0x06, 0x00, 0x00, 0xb3, 0x03, 0x00, 0xbf, 0x01, 0x01, 0xc8, 0x01, 0x00, 0x05, 0x00, 0x01, 0x15, 0x00, 0x00,
+  0xb3, 0x03, 0x02, 0x09, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x03, 0x00, 0x00, 0xa0, 0x03, 0x00, 0x23, 0x00, 0x02, 0xde, 0x01, 0x02, 0x0b, 0x00, 0x01,
+  0x1c, 0x00, 0x01, 0x19, 0x00, 0xb0, 0xe0, 0xe3, 0xde, 0xde, 0xdb, 0xd8, 0xdb, 0xde, 0xe2, 0xdb, 0xd8, 0x21, 0x00, 0x64, 0xd8, 0xd8, 0xdb, 0xe2,
+  0xe8, 0xf6, 0xc6, 0x00, 0x01, 0xdf, 0x01, 0x90, 0xe8, 0xe2, 0xd9, 0xdd, 0xe3, 0xe6, 0xe4, 0xe0, 0xdd, 0xf3, 0x03, 0x70, 0xd1, 0xd3, 0xd3, 0xde,
+  0xe3, 0xe4, 0xe4, 0xe5, 0x01, 0x00, 0x83, 0x05, 0xa0, 0xe7, 0xe6, 0xe4, 0xe4, 0xe2, 0xe3, 0xe3, 0xe0, 0xd0, 0xca, 0xfb, 0x03, 0xf1, 0x2c, 0xd1,
+  0xce, 0xcb, 0xcb, 0xce, 0xce, 0xca, 0xcb, 0xca, 0xcb, 0xd4, 0xe2, 0xe0, 0xdb, 0xe0, 0xde, 0xdd, 0xde, 0xce, 0xc6, 0xc6, 0xe3, 0xe8, 0xf5, 0xe8,
+  0xf2, 0xf5, 0xe9, 0xf7, 0xe7, 0xee, 0xf3, 0xf3, 0xf3, 0xe5, 0xe0, 0xb2, 0xc8, 0xef, 0xe4, 0xe1, 0xe1, 0xdc, 0xf0, 0xe5, 0xef, 0xdf, 0xef, 0xe4,
+  0xe3, 0xdc, 0xe1, 0xe6, 0xe7, 0xe7, 0xe5, 0xe7, 0xe6, 0xe5, 0xf6, 0x01, 0x02, 0xf9, 0x01, 0x10, 0xf5, 0x61, 0x01, 0x00, 0x01, 0x00, 0x00, 0x95,
+  0x01, 0x03, 0x8a, 0x00, 0x03, 0x07, 0x00, 0x02, 0xe1, 0x01, 0x06, 0x01, 0x00, 0x00, 0x21, 0x00, 0x00, 0x01, 0x00, 0x00, 0xb5, 0x01, 0x00, 0xc0,
+  0x01, 0x01, 0x11, 0x00, 0x00, 0x06, 0x00, 0x01, 0x0f, 0x00, 0x01, 0x0c, 0x00, 0x00, 0xd3, 0x05, 0x00, 0xec, 0x01, 0x00, 0x25, 0x00, 0x21, 0xf7,
+  0xfb, 0x12, 0x00, 0x00, 0x98, 0x01, 0x03, 0xa8, 0x03, 0x00, 0x01, 0x00, 0x04, 0x59, 0x02, 0x00, 0xc7, 0x01, 0x12, 0xf5, 0x39, 0x00, 0x00, 0x0f,
+  0x00, 0x00, 0x1f, 0x00, 0x00, 0x09, 0x00, 0x01, 0x1f, 0x00, 0x11, 0xf7, 0xde, 0x01, 0x28, 0xe8, 0xf3, 0xe0, 0x01, 0x00, 0x24, 0x00, 0x00, 0xa0,
+  0x05, 0x16, 0xe5, 0xa1, 0x05, 0x0d, 0x09, 0x00, 0x00, 0xd5, 0x01, 0x02, 0x06, 0x00, 0x00, 0x01, 0x00, 0x01, 0xc1, 0x03, 0x02, 0x05, 0x00, 0x01,
+  0x01, 0x00, 0x02, 0x97, 0x05, 0x02, 0xe1, 0x01, 0x00, 0xab, 0x01, 0x00, 0x06, 0x00, 0x00, 0xe3, 0x01, 0x30, 0xdb, 0xdd, 0xdd, 0xf0, 0x01, 0x01,
+  0xca, 0x01, 0x01, 0xd8, 0x01, 0x00, 0xde, 0x01, 0x00, 0x0d, 0x00, 0x13, 0xe0, 0xdf, 0x01, 0x01, 0xbe, 0x01, 0x00, 0xd2, 0x01, 0x00, 0xe8, 0x01,
+  0x00, 0x78, 0x07, 0x01, 0xd6, 0x01, 0x00, 0x25, 0x00, 0x10, 0xd8, 0x17, 0x00, 0x10, 0xd8, 0x4c, 0x00, 0x00, 0xe0, 0x01, 0x00, 0xd8, 0x01, 0x10,
+  0xe2, 0x16, 0x00, 0x32, 0xd8, 0xde, 0xe2, 0xdf, 0x03, 0x48, 0xd4, 0xd1, 0xd4, 0xdd, 0xc0, 0x03, 0xf0, 0x05, 0xf6, 0xf6, 0xe8, 0xe8, 0xe2, 0xd9,
+  0xd8, 0xdb, 0xdd, 0xe2, 0xe4, 0xe4, 0xe6, 0xe3, 0xe2, 0xdd, 0xd3, 0xd0, 0xd3, 0xd3, 0x2d, 0x04, 0x11, 0xe3, 0xe0, 0x01, 0x01, 0xd5, 0x02, 0x21,
+  0xe7, 0xe8, 0xfd, 0x01, 0x52, 0xdb, 0xdb, 0xd8, 0xc9, 0xd1, 0x79, 0x00, 0x00, 0xd5, 0x00, 0xa0, 0xe0, 0xdd, 0xd4, 0xcb, 0xcb, 0xd8, 0xdd, 0xda,
+  0xde, 0xe7, 0x26, 0x01, 0x00, 0x99, 0x01, 0x00, 0x0f, 0x03, 0xf0, 0x17, 0xe7, 0xe4, 0xe1, 0xe5, 0xe7, 0xe7, 0xf2, 0xe5, 0xf0, 0xe5, 0xe5, 0xef,
+  0xda, 0xef, 0xef, 0xdf, 0xd2, 0xd6, 0xe1, 0xf0, 0xe4, 0xed, 0xe1, 0xd6, 0xda, 0xdf, 0xdc, 0xdc, 0xe1, 0xe1, 0xef, 0xdc, 0xdf, 0xda, 0xdf, 0xef,
+  0xf2, 0xf3, 0x2f, 0x00, 0x00, 0xd3, 0x03, 0x41, 0xe8, 0xe8, 0xf3, 0xf4, 0x11, 0x05, 0x22, 0xf7, 0xe9, 0x93, 0x00, 0x00, 0xb3, 0x01, 0x00, 0x86,
+  0x01, 0x16, 0xf5, 0x05, 0x02, 0x02, 0x01, 0x00, 0x01, 0x9e, 0x01, 0x00, 0x04, 0x00, 0x00, 0x8c, 0x01, 0x02, 0x9c, 0x01, 0x01, 0x01, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x1f, 0x00, 0x02, 0x05, 0x00, 0x01, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x07, 0x00, 0x00, 0xcb, 0x01, 0x06,
+  0x16, 0x00, 0x21, 0xf5, 0xf5, 0x10, 0x00, 0x0e, 0x01, 0x00, 0xa5, 0xf6, 0xf7, 0xf7, 0xe8, 0xe7, 0xf3, 0xe8, 0xe7, 0xf3, 0xf3, 0xfa, 0x02, 0x00,
+  0x1b, 0x01, 0x00, 0x76, 0x00, 0x14, 0xfb, 0xe0, 0x01, 0x20, 0xe4, 0xe3, 0xe9, 0x02, 0x00, 0xa5, 0x07, 0x02, 0xff, 0x02, 0x00, 0x13, 0x00, 0x21,
+  0xe4, 0xe4, 0xdb, 0x01, 0x00, 0xe1, 0x01, 0x00, 0x04, 0x00, 0x00, 0xda, 0x01, 0x00, 0x06, 0x00, 0x00, 0xcf, 0x01, 0x00, 0xd8, 0x01, 0x00, 0xe1,
+  0x01, 0x00, 0xec, 0x01, 0x00, 0xa6, 0x05, 0x00, 0xb5, 0x01, 0x02, 0x08, 0x00, 0x10, 0xe0, 0x4b, 0x07, 0x10, 0xdd, 0x11, 0x00, 0x00, 0x01, 0x00,
+  0x01, 0xf2, 0x01, 0x01, 0x1d, 0x00, 0x01, 0x0d, 0x00, 0x20, 0xde, 0xdd, 0x1a, 0x00, 0x00, 0xaa, 0x01, 0x00, 0x14, 0x00, 0x00, 0xf5, 0x01, 0x01,
+  0x79, 0x01, 0x01, 0xb1, 0x03, 0x05, 0x0a, 0x00, 0x01, 0x0d, 0x00, 0xa1, 0xde, 0xdd, 0xdb, 0xd4, 0xd8, 0xdb, 0xd8, 0xdb, 0xe2, 0xe0, 0x17, 0x00,
+  0x20, 0xe0, 0xe3, 0xcc, 0x05, 0x00, 0x78, 0x09, 0x18, 0xd8, 0xe0, 0x01, 0x60, 0xe9, 0xf6, 0xf5, 0xf5, 0xe7, 0xe2, 0x76, 0x09, 0x30, 0xd8, 0xdb,
+  0xde, 0xe4, 0x01, 0x22, 0xe3, 0xe3, 0x9a, 0x00, 0x40, 0xe0, 0xe0, 0xe1, 0xe6, 0xdf, 0x01, 0x01, 0x72, 0x03, 0x40, 0xe8, 0xe8, 0xe6, 0xe7, 0xb5,
+  0x05, 0x01, 0x67, 0x09, 0x00, 0xdb, 0x03, 0x80, 0xe6, 0xe6, 0xe4, 0xe2, 0xd8, 0xc1, 0xbe, 0xd0, 0x04, 0x02, 0x00, 0x21, 0x01, 0x00, 0x88, 0x03,
+  0x00, 0x03, 0x00, 0x10, 0xf6, 0x9f, 0x03, 0x00, 0x78, 0x01, 0x11, 0xf5, 0x0b, 0x00, 0x00, 0x1e, 0x02, 0x00, 0x06, 0x00, 0x10, 0xe8, 0xc5, 0x08,
+  0x90, 0xe7, 0xe6, 0xe7, 0xe6, 0xe4, 0xe3, 0xe4, 0xe5, 0xe8, 0xbb, 0x01, 0x60, 0xf5, 0xe5, 0xee, 0xe3, 0xe4, 0xe5, 0xf1, 0x06, 0x04, 0x32, 0x03,
+  0x00, 0x07, 0x00, 0x00, 0x6b, 0x01, 0x10, 0xe8, 0x31, 0x04, 0x20, 0xe5, 0xe4, 0x0d, 0x07, 0x11, 0xe7, 0x51, 0x05, 0x01, 0xd8, 0x01, 0x32, 0xe8,
+  0xf2, 0xe5, 0x01, 0x00, 0x00, 0x17, 0x00, 0x02, 0x01, 0x00, 0x00, 0x9c, 0x00, 0x01, 0x01, 0x00, 0x00, 0x74, 0x00, 0x00, 0x01, 0x00, 0x00, 0x78,
+  0x00, 0x00, 0xf3, 0x01, 0x00, 0x05, 0x00, 0x01, 0x07, 0x00, 0x00, 0x4f, 0x00, 0x01, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0xdc, 0x07, 0x00, 0xc9,
+  0x01, 0x0f, 0x01, 0x00, 0x04, 0x30, 0xf3, 0xf3, 0xe7, 0x81, 0x09, 0x08, 0xe0, 0x01, 0x40, 0xf7, 0xf6, 0xfb, 0xf6, 0xc4, 0x07, 0x11, 0xe7, 0x7b,
+  0x09, 0x00, 0x01, 0x00, 0x30, 0xe6, 0xe4, 0xe5, 0xdb, 0x01, 0x01, 0xaa, 0x07, 0x30, 0xe7, 0xe6, 0xe5, 0x08, 0x01, 0x10, 0xe5, 0xe6, 0x01, 0x00,
+  0xf3, 0x01, 0x00, 0x3b, 0x01, 0x00, 0xd7, 0x03, 0x00, 0xb9, 0x05, 0x02, 0xe5, 0x01, 0x01, 0xe6, 0x01, 0x00, 0xf1, 0x01, 0x01, 0x01, 0x00, 0x00,
+  0xc0, 0x01, 0x00, 0xbc, 0x01, 0x01, 0xe5, 0x01, 0x41, 0xdb, 0xdd, 0xe0, 0xe0, 0xbe, 0x01, 0x00, 0x0d, 0x00, 0x00, 0xdd, 0x01, 0x06, 0x9e, 0x07,
+  0x01, 0x05, 0x00, 0x02, 0xb1, 0x03, 0x00, 0xe5, 0x01, 0x01, 0xd7, 0x01, 0x00, 0xd6, 0x01, 0x00, 0x9f, 0x03, 0x11, 0xdb, 0xb3, 0x03, 0x00, 0xc4,
+  0x03, 0x00, 0x0c, 0x02, 0x50, 0xdd, 0xd4, 0xd1, 0xd8, 0xd8, 0x3f, 0x0b, 0x60, 0xdb, 0xd1, 0xd8, 0xd8, 0xe0, 0xe3, 0xde, 0x01, 0x00, 0x7e, 0x09,
+  0x00, 0x80, 0x07, 0x00, 0xc0, 0x00, 0x01, 0x01, 0x00, 0x00, 0x80, 0x04, 0x20, 0xe8, 0xe3, 0x77, 0x0b, 0x10, 0xd4, 0x5d, 0x0b, 0x31, 0xdb, 0xdd,
+  0xe0, 0xa5, 0x02, 0x10, 0xe6, 0xc7, 0x00, 0x11, 0xe6, 0xbc, 0x03, 0x13, 0xe7, 0x3f, 0x01, 0x00, 0xa6, 0x01, 0x00, 0xcf, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0xf5, 0x00, 0x50, 0xe6, 0xe3, 0xe0, 0xe2, 0xe4, 0x54, 0x01, 0x00, 0xd8, 0x01, 0x02, 0x02, 0x00, 0x00, 0xb8, 0x01, 0x10, 0xf5, 0x9c, 0x0b,
+  0x00, 0x13, 0x00, 0x01, 0x01, 0x00, 0x04, 0x50, 0x01, 0x00, 0x26, 0x00, 0x03, 0x78, 0x01, 0x11, 0xf6, 0xca, 0x01, 0x30, 0xf6, 0xf2, 0xe5, 0x8d,
+  0x0b, 0x00, 0x10, 0x01, 0x04, 0x93, 0x0c, 0x02, 0x35, 0x00, 0x30, 0xf5, 0xe4, 0xdf, 0x98, 0x06, 0x01, 0xf0, 0x00, 0x10, 0xe0, 0x8d, 0x00, 0x40,
+  0xe2, 0xe3, 0xe3, 0xe6, 0xc4, 0x01, 0xf1, 0x01, 0xe8, 0xf2, 0xe6, 0xf1, 0xe3, 0xef, 0xe1, 0xef, 0xe3, 0xe3, 0xe2, 0xe1, 0xe0, 0xe2, 0xe0, 0xdf,
+  0x08, 0x05, 0x10, 0xe1, 0x24, 0x05, 0x01, 0x5d, 0x01, 0x10, 0xe6, 0x02, 0x00, 0x00, 0xdf, 0x0b, 0x01, 0x7c, 0x01, 0x03, 0xa8, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x67, 0x02, 0x00, 0x23, 0x02, 0x00, 0x7b, 0x00, 0x07, 0xbf, 0x03, 0x00, 0x6c, 0x00, 0x08, 0x01, 0x00, 0x00, 0x5d, 0x0b, 0x33, 0xe8,
+  0xf3, 0xf5, 0x8c, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1a, 0x02, 0x02, 0xf9, 0x00, 0x22, 0xe7, 0xe6, 0xcc, 0x01, 0x02, 0xdb, 0x01, 0x00, 0xb9, 0x00,
+  0x00, 0x63, 0x00, 0x01, 0x05, 0x00, 0x00, 0xb5, 0x02, 0x00, 0xe6, 0x01, 0x00, 0x05, 0x00, 0x02, 0x01, 0x00, 0x00, 0x88, 0x00, 0x02, 0xed, 0x01,
+  0x02, 0x01, 0x00, 0x00, 0xe1, 0x01, 0x03, 0xd7, 0x03, 0x00, 0xd3, 0x00, 0x00, 0xd6, 0x00, 0x00, 0xac, 0x05, 0x02, 0x0f, 0x00, 0x04, 0xe2, 0x01,
+  0x00, 0xb0, 0x01, 0x02, 0x01, 0x00, 0x01, 0x23, 0x00, 0x00, 0xe1, 0x01, 0x00, 0xdc, 0x01, 0x10, 0xdb, 0x94, 0x03, 0x06, 0xe2, 0x01, 0x00, 0xbd,
+  0x01, 0x02, 0x01, 0x00, 0x00, 0x15, 0x00, 0x00, 0xba, 0x05, 0x60, 0xd4, 0xd8, 0xdb, 0xe3, 0xdd, 0xd4, 0xbf, 0x01, 0x20, 0xde, 0xe3, 0x27, 0x0d,
+  0x00, 0x01, 0x00, 0x08, 0xe0, 0x01, 0x00, 0x91, 0x01, 0xd0, 0xf5, 0xe8, 0xe4, 0xdd, 0xd1, 0xd4, 0xd4, 0xd1, 0xd1, 0xd1, 0xd1, 0xce, 0xce, 0x27,
+  0x0b, 0x00, 0xf0, 0x05, 0x00, 0x24, 0x02, 0x20, 0xd8, 0xdb, 0x70, 0x00, 0x30, 0xe0, 0xe6, 0xe4, 0xc9, 0x03, 0x00, 0xc4, 0x03, 0x00, 0xc0, 0x03,
+  0x04, 0x3b, 0x01, 0x60, 0xe6, 0xe3, 0xe2, 0xe3, 0xe0, 0xe3, 0x17, 0x03, 0x01, 0x2a, 0x01, 0x01, 0x4c, 0x00, 0x00, 0xc4, 0x01, 0x02, 0x0f, 0x00,
+  0x01, 0x17, 0x00, 0x00, 0x94, 0x03, 0x00, 0x05, 0x00, 0x03, 0x04, 0x00, 0x02, 0x0e, 0x00, 0x04, 0x01, 0x00, 0x41, 0xf7, 0xf5, 0xe4, 0xdc, 0xb8,
+  0x00, 0x21, 0xde, 0xef, 0x1d, 0x00, 0x02, 0x01, 0x00, 0x40, 0xf7, 0xf7, 0xe8, 0xe3, 0xd6, 0x00, 0x01, 0xbe, 0x00, 0x00, 0x4f, 0x06, 0x90, 0xdb,
+  0xde, 0xde, 0xdb, 0xde, 0xde, 0xe0, 0xe3, 0xe4, 0x5b, 0x02, 0x20, 0xe7, 0xe8, 0x45, 0x04, 0x41, 0xe2, 0xe1, 0xde, 0xdf, 0x08, 0x01, 0x01, 0xda,
+  0x06, 0x00, 0xfd, 0x04, 0x02, 0x41, 0x01, 0x20, 0xe2, 0xe1, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x14, 0x02, 0x00, 0x01, 0x00, 0x00, 0xf8, 0x01,
+  0x00, 0x54, 0x03, 0x50, 0xe4, 0xe4, 0xe5, 0xe5, 0xe7, 0x02, 0x00, 0x01, 0xbc, 0x00, 0x01, 0x05, 0x00, 0x01, 0xd1, 0x00, 0x00, 0x06, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x05, 0x00, 0x01, 0x6e, 0x0b, 0x00, 0x01, 0x02, 0x00, 0x87, 0x00, 0x01, 0x01, 0x00, 0x20, 0xf6, 0xf7, 0xdf, 0x01, 0x00, 0x31,
+  0x00, 0x01, 0xc5, 0x01, 0x01, 0xd7, 0x01, 0x01, 0x4d, 0x08, 0x06, 0x01, 0x00, 0x00, 0x11, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x04, 0x00, 0x00, 0x10,
+  0x00, 0x00, 0x0f, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x05, 0x00, 0x00, 0xec, 0x01, 0x02, 0x01, 0x00, 0x00, 0x87, 0x00, 0x05, 0xf4, 0x01, 0x00, 0xe9,
+  0x01, 0x01, 0xee, 0x01, 0x01, 0x01, 0x00, 0x01, 0xbe, 0x00, 0x20, 0xe2, 0xe3, 0xce, 0x00, 0x01, 0xd0, 0x00, 0x00, 0x01, 0x00, 0x01, 0xe1, 0x01,
+  0x00, 0xfa, 0x01, 0x00, 0x7c, 0x07, 0x00, 0x94, 0x03, 0x00, 0x06, 0x00, 0x02, 0xd9, 0x01, 0x00, 0xbf, 0x01, 0x00, 0x54, 0x09, 0x00, 0x0c, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x2a, 0x0d, 0x21, 0xe2, 0xdb, 0x99, 0x03, 0x20, 0xde, 0xe3, 0x25, 0x00, 0x00, 0x02, 0x00, 0x30, 0xdb, 0xe2, 0xe8, 0xbf,
+  0x00, 0x02, 0x01, 0x00, 0x00, 0xfb, 0x04, 0xe0, 0xe8, 0xe6, 0xdd, 0xd8, 0xd1, 0xd4, 0xce, 0xce, 0xce, 0xd4, 0xd1, 0xce, 0xce, 0xce, 0x48, 0x09,
+  0x00, 0xcc, 0x03, 0x00, 0x01, 0x00, 0xa0, 0xd1, 0xd4, 0xd1, 0xd0, 0xd1, 0xd8, 0xd4, 0xdb, 0xde, 0xe2, 0xd0, 0x03, 0x81, 0xe4, 0xe3, 0xe2, 0xe0,
+  0xdf, 0xde, 0xda, 0xd9, 0x5d, 0x02, 0x50, 0xdd, 0xe2, 0xe3, 0xe4, 0xe6, 0xa9, 0x09, 0x00, 0xcd, 0x01, 0x05, 0xc0, 0x01, 0x00, 0x0d, 0x00, 0x00,
+  0x03, 0x00, 0x02, 0xca, 0x01, 0x01, 0x07, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0x00, 0x00, 0x18, 0x00, 0x07, 0x01, 0x00, 0x51, 0xf7, 0xf7, 0xe8,
+  0xe2, 0xda, 0xa1, 0x00, 0x16, 0xe6, 0x34, 0x03, 0x50, 0xf7, 0xe9, 0xf6, 0xf5, 0xe4, 0xd6, 0x00, 0x00, 0x01, 0x00, 0x01, 0xd8, 0x00, 0x00, 0xe0,
+  0x01, 0x00, 0x09, 0x00, 0x30, 0xdd, 0xde, 0xe0, 0x71, 0x00, 0x00, 0x9c, 0x01, 0x00, 0xe6, 0x05, 0x20, 0xe2, 0xdf, 0xf2, 0x02, 0x00, 0xfb, 0x04,
+  0x02, 0xe8, 0x01, 0x00, 0x2f, 0x01, 0x03, 0x05, 0x00, 0x00, 0x0d, 0x00, 0x01, 0x02, 0x00, 0x00, 0x10, 0x00, 0x30, 0xe0, 0xe2, 0xdf, 0x0b, 0x00,
+  0x00, 0xf0, 0x01, 0x01, 0xbf, 0x10, 0x20, 0xe5, 0xe4, 0xed, 0x0c, 0x14, 0xe4, 0x71, 0x05, 0x01, 0x02, 0x02, 0x61, 0xe4, 0xe5, 0xe5, 0xe6, 0xe5,
+  0xe4, 0x5e, 0x04, 0x00, 0xc0, 0x00, 0x03, 0xa7, 0x00, 0x00, 0xac, 0x02, 0x20, 0xf5, 0xfb, 0x06, 0x02, 0x11, 0xf2, 0xb8, 0x01, 0x01, 0x04, 0x00,
+  0x01, 0xbd, 0x03, 0x01, 0x03, 0x00, 0x06, 0xe6, 0x01, 0x01, 0xcc, 0x01, 0x00, 0x09, 0x00, 0x03, 0x01, 0x00, 0x04, 0x0c, 0x00, 0x03, 0x08, 0x00,
+  0x00, 0x1d, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x02, 0xe2, 0x03, 0x00, 0x05, 0x00, 0x01, 0xf5, 0x01, 0x01, 0x07, 0x00, 0x00, 0x96, 0x00,
+  0x00, 0x0d, 0x00, 0x03, 0x04, 0x02, 0x00, 0xa5, 0x02, 0x00, 0x0b, 0x02, 0x11, 0xe0, 0xc7, 0x05, 0x00, 0xea, 0x01, 0x01, 0xd4, 0x01, 0x01, 0xe6,
+  0x01, 0x00, 0x05, 0x00, 0x31, 0xdd, 0xde, 0xdd, 0xcb, 0x01, 0x51, 0xdb, 0xdb, 0xdd, 0xe3, 0xdd, 0xe7, 0x10, 0x30, 0xdb, 0xe2, 0xdd, 0xe6, 0x10,
+  0x00, 0x01, 0x00, 0x08, 0xc0, 0x03, 0x01, 0x26, 0x07, 0x10, 0xe4, 0x1b, 0x00, 0x01, 0xc1, 0x03, 0x30, 0xd1, 0xce, 0xd1, 0xe1, 0x01, 0x00, 0x12,
+  0x02, 0x11, 0xd4, 0xee, 0x01, 0x31, 0xd4, 0xd4, 0xce, 0x07, 0x00, 0x00, 0x3c, 0x00, 0xf1, 0x03, 0xd4, 0xd1, 0xd4, 0xde, 0xe2, 0xe3, 0xe0, 0xe0,
+  0xdb, 0xd8, 0xd0, 0xca, 0xc4, 0xbe, 0xbe, 0xc9, 0xd0, 0xdf, 0x0e, 0x10, 0x01, 0xbd, 0x01, 0x00, 0x01, 0x00, 0x00, 0x1c, 0x01, 0x01, 0x23, 0x01,
+  0x00, 0x83, 0x05, 0x01, 0x14, 0x00, 0x00, 0x07, 0x00, 0x01, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x09, 0x00, 0x07, 0x01, 0x00, 0x94, 0xf7, 0xf5,
+  0xe7, 0xde, 0xd8, 0xd1, 0xd4, 0xd4, 0xdb, 0xa0, 0x05, 0x00, 0x01, 0x00, 0x01, 0x8c, 0x0f, 0x00, 0xb7, 0x00, 0x00, 0xba, 0x00, 0x00, 0x3d, 0x0a,
+  0x32, 0xdd, 0xdd, 0xde, 0xd2, 0x00, 0x00, 0xd4, 0x00, 0x40, 0xde, 0xe0, 0xe0, 0xe3, 0xa2, 0x0f, 0x00, 0xe4, 0x01, 0x01, 0xfe, 0x00, 0x01, 0x04,
+  0x00, 0x01, 0xc9, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x00, 0x01, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x16, 0x00, 0x00, 0x07,
+  0x00, 0x02, 0xd3, 0x03, 0x03, 0x40, 0x01, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0xdf, 0x0c, 0x00, 0x06, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xdf,
+  0x01, 0x01, 0xbd, 0x00, 0x01, 0x01, 0x00, 0x00, 0x7d, 0x07, 0x10, 0xf7, 0x68, 0x0f, 0x00, 0xe1, 0x01, 0x00, 0xa5, 0x06, 0x00, 0x02, 0x00, 0x0f,
+  0x01, 0x00, 0x01, 0x00, 0xb7, 0x01, 0x00, 0xee, 0x01, 0x00, 0x08, 0x00, 0x00, 0x01, 0x00, 0x01, 0x05, 0x02, 0x10, 0xe7, 0x02, 0x02, 0x04, 0x13,
+  0x00, 0x00, 0x07, 0x00, 0x03, 0x02, 0x00, 0x00, 0x05, 0x00, 0x04, 0xe5, 0x01, 0x0f, 0x01, 0x00, 0x12, 0x10, 0xe4, 0xfd, 0x03, 0x60, 0xe3, 0xe6,
+  0xe3, 0xe6, 0xe3, 0xe4, 0xd0, 0x00, 0x00, 0xc8, 0x05, 0x00, 0xdc, 0x05, 0x00, 0x9f, 0x09, 0x01, 0x3f, 0x0b, 0x00, 0x88, 0x0b, 0x01, 0x5d, 0x07,
+  0x00, 0x96, 0x05, 0x10, 0xde, 0xaf, 0x05, 0x00, 0xb2, 0x05, 0x15, 0xe0, 0xc0, 0x03, 0x20, 0xf7, 0xe9, 0xc7, 0x0a, 0x00, 0x80, 0x07, 0x01, 0x24,
+  0x00, 0x01, 0xd5, 0x01, 0x30, 0xd4, 0xd1, 0xce, 0xd4, 0x01, 0xa1, 0xd4, 0xce, 0xd4, 0xd1, 0xd1, 0xce, 0xd4, 0xd1, 0xcb, 0xcb, 0x09, 0x00, 0x00,
+  0x02, 0x00, 0x40, 0xce, 0xcb, 0xcb, 0xcb, 0xcc, 0x03, 0xb4, 0xe3, 0xe3, 0xe4, 0xe2, 0xe0, 0xdb, 0xd9, 0xd8, 0xd6, 0xe1, 0xe8, 0xb3, 0x01, 0x01,
+  0x07, 0x00, 0x00, 0x60, 0x09, 0x01, 0x1b, 0x01, 0x00, 0x0d, 0x00, 0x01, 0x01, 0x00, 0x0f, 0x0a, 0x00, 0x01, 0x06, 0x01, 0x00, 0x00, 0x78, 0x00,
+  0x31, 0xd8, 0xdb, 0xde, 0x25, 0x02, 0x03, 0x01, 0x00, 0x30, 0xf7, 0xf5, 0xe8, 0x28, 0x08, 0x00, 0xad, 0x02, 0x02, 0xc8, 0x00, 0x00, 0xe5, 0x01,
+  0x00, 0xc1, 0x03, 0x00, 0xe9, 0x03, 0x00, 0x0d, 0x00, 0x00, 0xe2, 0x00, 0x01, 0xe4, 0x01, 0x00, 0x88, 0x11, 0x03, 0xbf, 0x0a, 0x00, 0xe5, 0x01,
+  0x02, 0x01, 0x00, 0x01, 0xcc, 0x01, 0x00, 0xf3, 0x04, 0x01, 0x09, 0x00, 0x00, 0x17, 0x00, 0x00, 0x0e, 0x00, 0x01, 0x09, 0x00, 0x32, 0xe2, 0xe2,
+  0xe2, 0xde, 0x01, 0x01, 0xe9, 0x01, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x17, 0x00, 0x00, 0x0c, 0x00, 0x20, 0xe3, 0xe2, 0xdf, 0x01, 0x06,
+  0xe0, 0x01, 0x00, 0xfc, 0x0e, 0x00, 0x4a, 0x13, 0x00, 0xa2, 0x05, 0x00, 0xa5, 0x05, 0x02, 0x02, 0x00, 0x07, 0x01, 0x00, 0x05, 0xfb, 0x12, 0x03,
+  0x01, 0x00, 0x20, 0xf2, 0xe7, 0xe7, 0x03, 0x00, 0x01, 0x00, 0x01, 0xda, 0x03, 0x00, 0xf3, 0x01, 0x30, 0xe5, 0xe7, 0xe5, 0xcf, 0x01, 0x03, 0xfd,
+  0x01, 0x01, 0xc4, 0x05, 0x00, 0x15, 0x00, 0x00, 0x07, 0x00, 0x00, 0x02, 0x00, 0x03, 0x07, 0x00, 0x10, 0xe4, 0x05, 0x00, 0x22, 0xe6, 0xe4, 0x09,
+  0x00, 0x00, 0xc9, 0x07, 0x00, 0x2a, 0x00, 0x00, 0x31, 0x00, 0x00, 0x29, 0x00, 0x01, 0x0c, 0x00, 0x04, 0x01, 0x00, 0x03, 0xe7, 0x03, 0x04, 0x01,
+  0x00, 0x30, 0xe4, 0xe3, 0xe3, 0xe0, 0x00, 0x12, 0xe2, 0xbf, 0x12, 0x10, 0xdb, 0x48, 0x0b, 0x00, 0x5c, 0x07, 0x00, 0x00, 0x0f, 0x11, 0xf5, 0x4b,
+  0x01, 0x00, 0x04, 0x00, 0x00, 0x63, 0x06, 0x61, 0xe8, 0xe7, 0xe3, 0xd4, 0xd1, 0xd1, 0xe1, 0x01, 0x20, 0xdb, 0xdb, 0x02, 0x02, 0x00, 0xc8, 0x10,
+  0x02, 0xcb, 0x03, 0x01, 0x01, 0x00, 0x30, 0xd4, 0xd4, 0xd4, 0xf6, 0x0e, 0xd0, 0xce, 0xcb, 0xc7, 0xc7, 0xcb, 0xcb, 0xce, 0xc7, 0xc3, 0xc3, 0xce,
+  0xdd, 0xe0, 0x6b, 0x00, 0x37, 0xe3, 0xe3, 0xe7, 0x6e, 0x0a, 0x00, 0x01, 0x00, 0x20, 0xf7, 0xe9, 0x5b, 0x09, 0x02, 0xe0, 0x01, 0x01, 0x05, 0x00,
+  0x02, 0x01, 0x00, 0x04, 0xb9, 0x03, 0x02, 0x06, 0x00, 0x06, 0x01, 0x00, 0x20, 0xf6, 0xe6, 0x9b, 0x00, 0x22, 0xdd, 0xe6, 0x31, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0xe0, 0x01, 0x00, 0xdf, 0x01, 0x01, 0xcb, 0x01, 0x01, 0xdf, 0x01, 0x00, 0x9a, 0x04, 0x00, 0x11, 0x08, 0x00, 0x38, 0x0a, 0x00, 0xdf,
+  0x01, 0x00, 0xc2, 0x02, 0x00, 0xd7, 0x15, 0x00, 0xe4, 0x01, 0x00, 0x07, 0x08, 0x00, 0xe4, 0x01, 0x14, 0xe0, 0x8a, 0x03, 0x00, 0xd6, 0x01, 0x00,
+  0x04, 0x00, 0x09, 0x01, 0x00, 0x00, 0xc8, 0x05, 0x00, 0x01, 0x00, 0x00, 0x15, 0x01, 0x00, 0xd6, 0x01, 0x00, 0x0a, 0x00, 0x00, 0xbf, 0x00, 0x00,
+  0xd4, 0x03, 0x00, 0x17, 0x00, 0x00, 0x02, 0x00, 0x03, 0xc0, 0x03, 0x01, 0xe3, 0x01, 0x02, 0xe6, 0x01, 0x00, 0xdf, 0x01, 0x00, 0x10, 0x00, 0x01,
+  0xe8, 0x01, 0x00, 0x07, 0x00, 0x00, 0x28, 0x0f, 0x00, 0xa8, 0x09, 0x04, 0x01, 0x00, 0x01, 0xb5, 0x09, 0x00, 0x07, 0x00, 0x00, 0x87, 0x00, 0x60,
+  0xe8, 0xe7, 0xf3, 0xe7, 0xf3, 0xf3, 0x04, 0x15, 0x01, 0x7a, 0x02, 0x02, 0x01, 0x00, 0x01, 0xbf, 0x03, 0x00, 0xa5, 0x01, 0x03, 0x02, 0x00, 0x01,
+  0xdc, 0x01, 0x21, 0xe7, 0xe5, 0xbe, 0x01, 0x00, 0x02, 0x00, 0x03, 0xbe, 0x01, 0x00, 0xd7, 0x01, 0x02, 0x05, 0x00, 0x02, 0x01, 0x00, 0x01, 0xfc,
+  0x01, 0x01, 0x06, 0x02, 0x00, 0x25, 0x00, 0x00, 0x12, 0x00, 0x0f, 0x01, 0x00, 0x08, 0x32, 0xe4, 0xe6, 0xe6, 0xf6, 0x00, 0x30, 0xe3, 0xe6, 0xe3,
+  0xe1, 0x01, 0x00, 0xe8, 0x04, 0x14, 0xe2, 0x93, 0x0c, 0x01, 0xa0, 0x05, 0x41, 0xf5, 0xe8, 0xe8, 0xe4, 0xc0, 0x03, 0x00, 0x95, 0x05, 0x00, 0x48,
+  0x01, 0x00, 0x09, 0x00, 0x00, 0x6b, 0x09, 0x00, 0x8c, 0x07, 0x00, 0xb4, 0x03, 0x01, 0x07, 0x00, 0x00, 0x01, 0x00, 0x01, 0xe1, 0x01, 0xc6, 0xcb,
+  0xc7, 0xc3, 0xc3, 0xcb, 0xce, 0xd4, 0xce, 0xd8, 0xde, 0xe2, 0xe3, 0xe8, 0x05, 0x03, 0x01, 0x00, 0x00, 0xdc, 0x01, 0x0c, 0x14, 0x00, 0x0f, 0x01,
+  0x00, 0x07, 0x81, 0xf7, 0xe7, 0xde, 0xd8, 0xdb, 0xdb, 0xd9, 0xe3, 0x6f, 0x02, 0x02, 0x01, 0x00, 0x01, 0xe0, 0x01, 0x00, 0x7b, 0x07, 0x00, 0x97,
+  0x05, 0x11, 0xdb, 0x93, 0x15, 0x20, 0xde, 0xe0, 0x10, 0x00, 0x01, 0xf6, 0x09, 0x01, 0xe1, 0x01, 0x00, 0x7d, 0x08, 0x01, 0x80, 0x0a, 0x23, 0xe3,
+  0xe4, 0xa3, 0x0f, 0x01, 0x91, 0x07, 0x00, 0xa9, 0x01, 0x00, 0x01, 0x00, 0x15, 0xe3, 0xbd, 0x03, 0x04, 0x01, 0x00, 0x02, 0x18, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0xcb, 0x01, 0x02, 0x07, 0x00, 0x01, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x10, 0x00, 0x00, 0x13, 0x00, 0x11, 0xe3, 0xc4, 0x01, 0x01,
+  0xdc, 0x01, 0x01, 0x08, 0x00, 0x00, 0xbc, 0x12, 0x02, 0x0a, 0x00, 0x04, 0x15, 0x00, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x00, 0xe1, 0x01, 0x00,
+  0xf1, 0x01, 0x00, 0x20, 0x0f, 0x0d, 0x01, 0x00, 0x00, 0x94, 0x00, 0x00, 0xde, 0x03, 0x04, 0xe0, 0x03, 0x04, 0xf0, 0x01, 0x00, 0x01, 0x00, 0x10,
+  0xf2, 0xf5, 0x01, 0x01, 0xe3, 0x03, 0x00, 0xfa, 0x01, 0x01, 0xe3, 0x01, 0x00, 0xf8, 0x01, 0x01, 0xd6, 0x01, 0x00, 0x02, 0x00, 0x00, 0x0c, 0x08,
+  0x01, 0x02, 0x00, 0x00, 0x13, 0x00, 0x00, 0x18, 0x00, 0x01, 0x0d, 0x00, 0x00, 0x02, 0x00, 0x01, 0x0b, 0x00, 0x06, 0x01, 0x00, 0x00, 0xa9, 0x0d,
+  0x00, 0xf8, 0x03, 0x07, 0x02, 0x02, 0x21, 0xe4, 0xe2, 0x9a, 0x09, 0x10, 0xde, 0x98, 0x01, 0x03, 0x86, 0x01, 0x02, 0xe0, 0x01, 0x10, 0xe3, 0x9b,
+  0x16, 0x01, 0x03, 0x00, 0x10, 0xd8, 0x12, 0x07, 0x00, 0x6a, 0x07, 0x00, 0xd0, 0x01, 0x06, 0x01, 0x00, 0xf0, 0x00, 0xd4, 0xce, 0xc7, 0xc3, 0xcb,
+  0xce, 0xd1, 0xce, 0xc7, 0xc7, 0xcb, 0xc7, 0xc7, 0xc3, 0xc3, 0xe8, 0x01, 0x53, 0xce, 0xce, 0xc7, 0xc9, 0xe6, 0x46, 0x00, 0x04, 0x01, 0x00, 0x0f,
+  0xdf, 0x01, 0x1b, 0x90, 0xe9, 0xf7, 0xe8, 0xdd, 0xd3, 0xdb, 0xdd, 0xdd, 0xe4, 0xe0, 0x01, 0x03, 0x37, 0x00, 0x40, 0xf7, 0xf5, 0xe8, 0xe2, 0xb6,
+  0x03, 0x00, 0x3b, 0x0b, 0x11, 0xd8, 0x2e, 0x0e, 0x00, 0x60, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x6d, 0x06, 0x00, 0xf1, 0x01, 0x00, 0xdc, 0x01, 0x00,
+  0x06, 0x00, 0x00, 0x8e, 0x06, 0x00, 0x99, 0x01, 0x10, 0xe6, 0xc0, 0x0d, 0x01, 0xe3, 0x01, 0x00, 0xbe, 0x01, 0x00, 0xb0, 0x01, 0x00, 0xd4, 0x01,
+  0x01, 0x01, 0x00, 0x04, 0x0a, 0x00, 0x00, 0xc1, 0x01, 0x02, 0x01, 0x00, 0x01, 0x21, 0x00, 0x00, 0xdb, 0x01, 0x00, 0x01, 0x00, 0x00, 0x0a, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x24, 0xe3, 0xe2, 0xa6, 0x03, 0x00, 0xcc, 0x01, 0x00, 0xce, 0x01, 0x00, 0x0b, 0x00, 0x01, 0x10, 0x00, 0x03,
+  0x04, 0x00, 0x06, 0x07, 0x00, 0x09, 0x01, 0x00, 0x00, 0xfc, 0x16, 0x10, 0xf6, 0x79, 0x0b, 0x05, 0x01, 0x00, 0x00, 0xe2, 0x01, 0x02, 0x01, 0x00,
+  0x00, 0x5c, 0x01, 0x10, 0xf3, 0xed, 0x01, 0x00, 0x84, 0x02, 0x00, 0x05, 0x00, 0x00, 0xd2, 0x18, 0x00, 0xd9, 0x01, 0x01, 0xf3, 0x01, 0x03, 0x0a,
+  0x00, 0x01, 0x01, 0x00, 0x10, 0xf2, 0xe4, 0x01, 0x00, 0xa4, 0x0b, 0x02, 0x02, 0x00, 0x00, 0x05, 0x00, 0x04, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
+  0x10, 0x00, 0x01, 0x05, 0x00, 0x00, 0xe1, 0x01, 0x02, 0x04, 0x00, 0x02, 0x02, 0x00, 0x00, 0xd4, 0x05, 0x10, 0xe7, 0xe5, 0x01, 0x03, 0x01, 0x00,
+  0x00, 0xb5, 0x05, 0x30, 0xe3, 0xe3, 0xe6, 0x61, 0x10, 0x02, 0x51, 0x01, 0x00, 0xbf, 0x12, 0xa0, 0xf5, 0xe7, 0xe6, 0xdd, 0xd8, 0xce, 0xd4, 0xd4,
+  0xd8, 0xce, 0x43, 0x01, 0x10, 0xdb, 0xdb, 0x01, 0x00, 0xa3, 0x05, 0x00, 0x7e, 0x07, 0x03, 0xba, 0x03, 0x00, 0x06, 0x00, 0x00, 0xb4, 0x03, 0x60,
+  0xcb, 0xbf, 0xcb, 0xc7, 0xc7, 0xc7, 0x80, 0x16, 0x6b, 0xc3, 0xbf, 0xbf, 0xc7, 0xcb, 0xca, 0xe0, 0x01, 0x05, 0x56, 0x00, 0x0f, 0x01, 0x00, 0x00,
+  0x0f, 0x19, 0x00, 0x01, 0x30, 0xf7, 0xe7, 0xe0, 0x52, 0x02, 0x21, 0xe3, 0xf6, 0x3b, 0x00, 0x01, 0x12, 0x00, 0x00, 0xc0, 0x03, 0x00, 0xba, 0x01,
+  0x00, 0x7d, 0x07, 0x00, 0x7b, 0x07, 0x04, 0xd1, 0x01, 0x00, 0x0f, 0x00, 0x00, 0x7b, 0x04, 0x00, 0xf3, 0x01, 0x02, 0x1a, 0x00, 0x03, 0x59, 0x07,
+  0x00, 0x1b, 0x0b, 0x01, 0xc6, 0x03, 0x00, 0xa7, 0x0e, 0x00, 0x81, 0x0a, 0x11, 0xe3, 0x92, 0x05, 0x01, 0xd5, 0x01, 0x00, 0x1f, 0x00, 0x02, 0x01,
+  0x00, 0x02, 0x70, 0x09, 0x03, 0xb1, 0x03, 0x00, 0x03, 0x01, 0x00, 0x08, 0x00, 0x01, 0xd7, 0x01, 0x00, 0x10, 0x00, 0x00, 0x09, 0x00, 0x00, 0xa0,
+  0x05, 0x00, 0xd7, 0x01, 0x01, 0x01, 0x00, 0x00, 0xa7, 0x01, 0x02, 0x10, 0x00, 0x00, 0x96, 0x05, 0x00, 0x01, 0x00, 0x01, 0x0b, 0x00, 0x04, 0x01,
+  0x00, 0x00, 0xdc, 0x03, 0x00, 0xda, 0x01, 0x02, 0x08, 0x00, 0x05, 0x01, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x05, 0x00, 0x00, 0xd9, 0x01, 0x12, 0xfb,
+  0x38, 0x00, 0x00, 0x0b, 0x00, 0x05, 0xf1, 0x01, 0x00, 0xc3, 0x07, 0x03, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x01, 0x00, 0x04,
+  0x04, 0x02, 0x00, 0xe8, 0x01, 0x03, 0x01, 0x00, 0x00, 0xd3, 0x03, 0x00, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x04, 0x00, 0x03, 0xe3, 0x01, 0x02,
+  0x02, 0x00, 0x00, 0xd4, 0x01, 0x01, 0x07, 0x00, 0x00, 0x09, 0x00, 0x00, 0xf1, 0x11, 0x00, 0x0e, 0x00, 0x00, 0x02, 0x00, 0x00, 0xe9, 0x01, 0x01,
+  0x89, 0x0d, 0x01, 0x41, 0x12, 0x01, 0x50, 0x01, 0x30, 0xe9, 0xe9, 0xf6, 0x77, 0x17, 0x60, 0xe6, 0xe2, 0xdb, 0xd8, 0xd0, 0xd8, 0x14, 0x15, 0x40,
+  0xe0, 0xe2, 0xe0, 0xde, 0x2d, 0x0d, 0x00, 0x0e, 0x05, 0x01, 0x6f, 0x09, 0x00, 0x6e, 0x09, 0x12, 0xd4, 0x53, 0x0b, 0x20, 0xd8, 0xd8, 0xe8, 0x01,
+  0x01, 0x60, 0x18, 0x11, 0xce, 0xa6, 0x05, 0x1d, 0xd1, 0xe0, 0x01, 0x0f, 0xc7, 0x01, 0x02, 0x0f, 0x01, 0x00, 0x06, 0x70, 0xf7, 0xe8, 0xe0, 0xdb,
+  0xd8, 0xd1, 0xd4, 0x2f, 0x06, 0x00, 0x39, 0x16, 0x01, 0x39, 0x03, 0x00, 0x40, 0x0b, 0x01, 0x01, 0x00, 0x00, 0x68, 0x07, 0x01, 0xaa, 0x01, 0x00,
+  0x0b, 0x00, 0x10, 0xdd, 0x26, 0x0c, 0x00, 0xd8, 0x03, 0x00, 0x19, 0x00, 0x00, 0x08, 0x00, 0x01, 0x4c, 0x0b, 0x01, 0x1b, 0x00, 0x00, 0xca, 0x01,
+  0x60, 0xe3, 0xe3, 0xe5, 0xe6, 0xe8, 0xe8, 0x49, 0x01, 0x00, 0xa4, 0x0f, 0x00, 0xa6, 0x04, 0x01, 0xca, 0x00, 0x01, 0xe2, 0x01, 0x01, 0x05, 0x00,
+  0x01, 0x08, 0x00, 0x00, 0x28, 0x00, 0x00, 0x06, 0x00, 0x01, 0xe1, 0x01, 0x01, 0x05, 0x00, 0xc0, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2,
+  0xe2, 0xe2, 0xe2, 0xe3, 0x40, 0xf7, 0xf6, 0xf7, 0xf6, 0x03, 0x00, 0x11, 0xf6, 0x09, 0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0x00, 0x04, 0x06, 0x00,
+  0x40, 0xf6, 0xf7, 0xf6, 0xfb, 0x05, 0x00, 0x05, 0x04, 0x00, 0x10, 0xfb, 0x15, 0x00, 0x02, 0x06, 0x00, 0x31, 0xf5, 0xf5, 0xf5, 0x08, 0x00, 0x40,
+  0xf6, 0xf6, 0xfb, 0xf5, 0x06, 0x00, 0x24, 0xf6, 0xfb, 0x10, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x06, 0x00, 0x00, 0x08, 0x00, 0x10, 0xf5, 0x04, 0x00,
+  0x00, 0x0f, 0x00, 0x10, 0xf5, 0x02, 0x00, 0x04, 0x0f, 0x00, 0x05, 0x01, 0x00, 0x50, 0xe8, 0xf5, 0xe8, 0xe8, 0xe8, 0x06, 0x00, 0x00, 0x08, 0x00,
+  0x02, 0x01, 0x00, 0x13, 0xe7, 0x05, 0x00, 0x12, 0xe7, 0x01, 0x00, 0x31, 0xe5, 0xe7, 0xe5, 0x01, 0x00, 0x32, 0xe6, 0xe5, 0xe6, 0x05, 0x00, 0x03,
+  0x02, 0x00, 0x50, 0xe7, 0xe6, 0xe5, 0xe6, 0xe6, 0x0a, 0x00, 0xf0, 0x00, 0xe7, 0xe7, 0xe6, 0xe4, 0xe6, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xf7, 0xf7,
+  0xe9, 0xe9, 0xe9, 0x04, 0x00, 0xf1, 0x00, 0xe9, 0xf7, 0xf6, 0xf5, 0xf4, 0xe8, 0xe8, 0xe8, 0xe6, 0xe4, 0xe3, 0xe2, 0xe4, 0xe4, 0xe6, 0x01, 0x00,
+  0x50, 0xe4, 0xe4, 0xe3, 0xe2, 0xe3, 0x01, 0x00, 0x20, 0xe2, 0xe0, 0x08, 0x00, 0xa1, 0xe0, 0xe2, 0xe2, 0xe4, 0xe4, 0xe3, 0xe4, 0xe4, 0xe2, 0xe0,
+  0x01, 0x00, 0xf0, 0x00, 0xde, 0xe0, 0xde, 0xe0, 0xe0, 0xde, 0xd4, 0xd4, 0xce, 0xd4, 0xd4, 0xd4, 0xdb, 0xe7, 0xf6, 0x44, 0x00, 0x05, 0x01, 0x00,
+  0x12, 0xf7, 0x54, 0x00, 0x0f, 0x01, 0x00, 0x16, 0xf0, 0x08, 0xf7, 0xe6, 0xe0, 0xe0, 0xdb, 0xd4, 0xdb, 0xe4, 0xf5, 0xf7, 0xe9, 0xf7, 0xfb, 0xf6,
+  0xf7, 0xf7, 0xf7, 0xf7, 0xf6, 0xf5, 0xf5, 0xe8, 0xe3, 0x64, 0x00, 0x60, 0xdd, 0xdd, 0xdd, 0xde, 0xde, 0xdd, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x31,
+  0xde, 0xdd, 0xdb, 0x01, 0x00, 0x11, 0xdd, 0x01, 0x00, 0x10, 0xde, 0x1e, 0x00, 0x50, 0xdd, 0xde, 0xe0, 0xe2, 0xe2, 0x23, 0x00, 0x00, 0x95, 0x00,
+  0x01, 0x9c, 0x00, 0x40, 0xe4, 0xe6, 0xe8, 0xf6, 0x3f, 0x01, 0x50, 0xe8, 0xe6, 0xe5, 0xe4, 0xe3, 0xa9, 0x00, 0x12, 0xe2, 0x18, 0x00, 0x50, 0xe2,
+  0xe0, 0xde, 0xde, 0xde, 0x2e, 0x00, 0x33, 0xe2, 0xe3, 0xe2, 0x01, 0x00, 0x12, 0xe3, 0x02, 0x00, 0x00, 0xe4, 0x00, 0x01, 0x14, 0x00, 0x40, 0xe0,
+  0xe2, 0xe2, 0xe3, 0xb6, 0x01, 0x01, 0xd5, 0x01, 0x02, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x02, 0x09, 0x00, 0x11, 0xf7, 0x06, 0x00, 0x03, 0x01, 0x00,
+  0x01, 0x10, 0x00, 0x00, 0x0f, 0x00, 0x93, 0xf5, 0xf6, 0xf7, 0xf5, 0xfb, 0xf5, 0xf7, 0xf5, 0xfb, 0xae, 0x01, 0x02, 0x2c, 0x00, 0x06, 0xd9, 0x01,
+  0x01, 0xe7, 0x01, 0x00, 0x06, 0x00, 0x00, 0x2d, 0x00, 0x01, 0x07, 0x00, 0x00, 0xc6, 0x01, 0x01, 0x12, 0x00, 0x03, 0x13, 0x00, 0x00, 0x0f, 0x00,
+  0x0c, 0x01, 0x00, 0x06, 0x15, 0x00, 0x10, 0xe8, 0x05, 0x00, 0x01, 0x11, 0x00, 0x10, 0xe8, 0x04, 0x00, 0x03, 0xf6, 0x01, 0x03, 0xf3, 0x01, 0x00,
+  0xef, 0x01, 0x10, 0xe7, 0xd9, 0x01, 0x41, 0xe5, 0xe5, 0xe7, 0xe5, 0x0b, 0x00, 0x02, 0x08, 0x00, 0x95, 0xe7, 0xe6, 0xe6, 0xe6, 0xe7, 0xe7, 0xe8,
+  0xf5, 0xf6, 0x88, 0x01, 0x30, 0xf7, 0xf6, 0xf4, 0x3c, 0x00, 0x01, 0x19, 0x00, 0x03, 0x04, 0x00, 0x00, 0x01, 0x00, 0x20, 0xe4, 0xe6, 0xed, 0x01,
+  0x02, 0x06, 0x00, 0x04, 0x01, 0x00, 0x40, 0xe4, 0xe6, 0xe4, 0xe4, 0x04, 0x00, 0x00, 0x09, 0x00, 0x00, 0x1b, 0x01, 0x40, 0xe3, 0xe3, 0xe6, 0xe8,
+  0xd8, 0x00, 0x00, 0x47, 0x00, 0x0f, 0x01, 0x00, 0x23, 0x30, 0xf6, 0xe3, 0xdf, 0x88, 0x01, 0x10, 0xe5, 0xe0, 0x01, 0x40, 0xf7, 0xf6, 0xf7, 0xe9,
+  0xf8, 0x00, 0x51, 0xf5, 0xe8, 0xe4, 0xdd, 0xde, 0xe1, 0x01, 0x00, 0x96, 0x01, 0x14, 0xde, 0xcd, 0x01, 0x00, 0xdd, 0x01, 0x01, 0x04, 0x00, 0x30,
+  0xdd, 0xdb, 0xdb, 0x13, 0x00, 0x00, 0xf8, 0x01, 0x00, 0x6e, 0x02, 0x10, 0xde, 0xc0, 0x01, 0x03, 0x01, 0x00, 0x80, 0xe3, 0xe3, 0xe5, 0xe7, 0xf5,
+  0xf5, 0xf7, 0xf6, 0x0c, 0x01, 0x00, 0xb1, 0x02, 0x10, 0xe0, 0xb9, 0x01, 0x30, 0xe0, 0xe0, 0xe2, 0x42, 0x00, 0x01, 0x2e, 0x00, 0x00, 0x0f, 0x00,
+  0x02, 0xb5, 0x02, 0x00, 0x01, 0x00, 0x03, 0x08, 0x00, 0x00, 0xee, 0x01, 0x00, 0xf3, 0x01, 0x00, 0x7d, 0x00, 0x02, 0xa5, 0x01, 0x01, 0x01, 0x00,
+  0x00, 0xc9, 0x01, 0x00, 0x08, 0x00, 0x00, 0x33, 0x02, 0x00, 0x01, 0x00, 0x01, 0xd5, 0x01, 0x04, 0x15, 0x00, 0x00, 0xf7, 0x00, 0x01, 0xd1, 0x03,
+  0x00, 0xcf, 0x01, 0x02, 0x87, 0x01, 0x01, 0x19, 0x00, 0x21, 0xf5, 0xf5, 0x12, 0x00, 0x01, 0x1e, 0x00, 0x02, 0x01, 0x00, 0x01, 0x08, 0x00, 0x04,
+  0xd0, 0x03, 0x00, 0x2a, 0x00, 0x20, 0xfb, 0xf6, 0x02, 0x00, 0x00, 0x03, 0x00, 0x01, 0x0f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x37, 0x00, 0x01, 0x07,
+  0x00, 0x06, 0x14, 0x00, 0x03, 0x2e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x6e, 0x00, 0x01, 0x02, 0x00, 0x00, 0x03, 0x00, 0x01, 0x01, 0x00, 0x11, 0xf6,
+  0xe6, 0x03, 0x00, 0xe6, 0x00, 0x09, 0x01, 0x00, 0x03, 0xea, 0x03, 0x31, 0xe8, 0xe8, 0xf5, 0xbf, 0x03, 0x01, 0x01, 0x00, 0x31, 0xf7, 0xf7, 0xf5,
+  0xc0, 0x03, 0x00, 0x19, 0x00, 0x02, 0xe8, 0x03, 0x51, 0xe6, 0xe5, 0xe6, 0xe4, 0xe5, 0xc4, 0x01, 0x00, 0x05, 0x00, 0x01, 0xd6, 0x01, 0x00, 0x18,
+  0x00, 0x10, 0xe5, 0x0d, 0x00, 0x02, 0x03, 0x00, 0x07, 0x01, 0x00, 0x00, 0x36, 0x00, 0x1a, 0xe8, 0xc4, 0x03, 0x0f, 0x01, 0x00, 0x14, 0x01, 0x82,
+  0x00, 0x11, 0xf5, 0x4f, 0x02, 0x11, 0xe4, 0x06, 0x04, 0x01, 0x11, 0x00, 0x00, 0xc2, 0x00, 0x48, 0xe8, 0xe3, 0xdb, 0xdb, 0xe2, 0x01, 0x40, 0xde,
+  0xdd, 0xdd, 0xdb, 0xe1, 0x01, 0x11, 0xdd, 0xe0, 0x01, 0x00, 0x16, 0x00, 0x01, 0x0d, 0x00, 0x03, 0x1d, 0x00, 0x00, 0xd8, 0x01, 0x04, 0x01, 0x00,
+  0x70, 0xe2, 0xe3, 0xe3, 0xe4, 0xe4, 0xe6, 0xe7, 0xfa, 0x00, 0x10, 0xe7, 0x02, 0x00, 0x10, 0xe6, 0xe5, 0x01, 0x00, 0xfe, 0x01, 0x02, 0x28, 0x00,
+  0x00, 0xc8, 0x01, 0x03, 0xc6, 0x03, 0x00, 0xd8, 0x01, 0x03, 0x01, 0x00, 0x01, 0x10, 0x00, 0x00, 0x05, 0x00, 0x00, 0x8c, 0x01, 0x00, 0x8e, 0x01,
+  0x10, 0xf7, 0xa1, 0x03, 0x02, 0x09, 0x00, 0x00, 0x0c, 0x00, 0x01, 0x8a, 0x01, 0x00, 0x0c, 0x00, 0x01, 0x69, 0x01, 0x20, 0xf6, 0xf7, 0x74, 0x01,
+  0x22, 0xf7, 0xfb, 0x10, 0x00, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x21, 0xf5, 0xfb, 0xda, 0x01, 0x00, 0x7d, 0x01, 0x0c, 0x01, 0x00, 0x01, 0x2b,
+  0x00, 0x04, 0x1e, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x11, 0x00, 0x00, 0x01, 0x00, 0x06, 0xb2, 0x01, 0x00, 0x09, 0x00, 0x01, 0x5c, 0x00, 0x00, 0x0c,
+  0x00, 0x31, 0xf5, 0xf6, 0xf5, 0x66, 0x00, 0x00, 0xd5, 0x01, 0x07, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x1d, 0x00, 0x01, 0x0a, 0x00, 0x05, 0x01,
+  0x00, 0x02, 0xe7, 0x03, 0x02, 0x06, 0x00, 0x00, 0xf2, 0x01, 0x00, 0x0b, 0x00, 0x17, 0xf7, 0xe0, 0x01, 0x02, 0xfc, 0x03, 0x22, 0xf3, 0xe7, 0xf4,
+  0x03, 0x20, 0xe6, 0xe7, 0xcb, 0x01, 0x00, 0x04, 0x00, 0x00, 0x79, 0x01, 0x03, 0xe6, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x02, 0x00, 0x01, 0x09, 0x00,
+  0x21, 0xe6, 0xe5, 0xef, 0x01, 0x02, 0x01, 0x00, 0x10, 0xe7, 0xe1, 0x01, 0x20, 0xf3, 0xf5, 0x49, 0x00, 0x0f, 0x01, 0x00, 0x1d, 0x00, 0x82, 0x00,
+  0x01, 0x69, 0x03, 0x00, 0x94, 0x00, 0x00, 0x0d, 0x00, 0x01, 0x01, 0x00, 0x30, 0xfb, 0xf6, 0xf7, 0xc0, 0x03, 0x03, 0xbd, 0x01, 0x00, 0x98, 0x01,
+  0x02, 0xe0, 0x01, 0x00, 0xf1, 0x01, 0x02, 0xe7, 0x01, 0x00, 0x08, 0x00, 0x00, 0x09, 0x00, 0x01, 0x0b, 0x00, 0x00, 0xb6, 0x01, 0x01, 0x25, 0x00,
+  0x00, 0x08, 0x00, 0x00, 0xc2, 0x01, 0x01, 0x01, 0x00, 0x21, 0xe3, 0xe6, 0xca, 0x02, 0x10, 0xe5, 0x9d, 0x00, 0x30, 0xe7, 0xe7, 0xe6, 0xc3, 0x01,
+  0x00, 0xc7, 0x03, 0x00, 0x1f, 0x00, 0x04, 0x22, 0x00, 0x03, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xe3, 0x01, 0x02, 0xc0, 0x03,
+  0x00, 0xdc, 0x01, 0x00, 0x05, 0x00, 0x01, 0x86, 0x01, 0x02, 0x12, 0x00, 0x00, 0x01, 0x00, 0x01, 0x0a, 0x00, 0x00, 0xe9, 0x01, 0x00, 0xf1, 0x01,
+  0x00, 0x88, 0x01, 0x01, 0x0b, 0x00, 0x01, 0x05, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x72, 0x01, 0x00, 0x0a, 0x00, 0x00, 0x9f, 0x03, 0x01, 0x01, 0x00,
+  0x01, 0x1d, 0x00, 0x00, 0x07, 0x00, 0x03, 0x09, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x01, 0x00, 0x00, 0xbc, 0x01, 0x02, 0x24, 0x00, 0x00, 0xf1, 0x01,
+  0x02, 0x17, 0x00, 0x00, 0x08, 0x00, 0x00, 0xcc, 0x05, 0x00, 0xe0, 0x05, 0x00, 0x11, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0a, 0x00, 0x01, 0x08, 0x00,
+  0x02, 0x5a, 0x00, 0x01, 0x18, 0x00, 0x0f, 0x01, 0x00, 0x06, 0x0b, 0x1d, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x62, 0x01, 0x00, 0xa8, 0x02, 0x00, 0x10,
+  0x00, 0x01, 0xf9, 0x01, 0x04, 0xc5, 0x03, 0x00, 0x01, 0x00, 0x11, 0xf2, 0xe9, 0x01, 0x00, 0xb2, 0x07, 0x00, 0xd1, 0x01, 0x00, 0xf0, 0x01, 0x04,
+  0xd4, 0x01, 0x01, 0x07, 0x00, 0x00, 0xfa, 0x05, 0x01, 0x02, 0x00, 0x00, 0x16, 0x02, 0x20, 0xe8, 0xe8, 0xe0, 0x01, 0x40, 0xf7, 0xf7, 0xf5, 0xf4,
+  0x49, 0x00, 0x00, 0x01, 0x00, 0x01, 0x1f, 0x01, 0x00, 0x25, 0x01, 0x02, 0x0a, 0x03, 0x05, 0xbd, 0x01, 0x0b, 0x01, 0x00, 0x20, 0xf7, 0xf6, 0x73,
+  0x00, 0x00, 0x41, 0x00, 0x06, 0xe4, 0x05, 0x00, 0xe4, 0x00, 0x20, 0xe8, 0xe7, 0x76, 0x03, 0x10, 0xe3, 0x92, 0x01, 0x01, 0xe2, 0x01, 0x02, 0xc9,
+  0x03, 0x10, 0xe0, 0x07, 0x00, 0x01, 0x08, 0x00, 0x11, 0xe0, 0xe3, 0x01, 0x02, 0xd6, 0x01, 0x00, 0x25, 0x00, 0x01, 0x27, 0x00, 0x00, 0x07, 0x00,
+  0x01, 0xbd, 0x01, 0x01, 0x0f, 0x00, 0x10, 0xe0, 0xe3, 0x01, 0x62, 0xe7, 0xe5, 0xe4, 0xe3, 0xe4, 0xe3, 0x64, 0x04, 0x02, 0xca, 0x03, 0x00, 0xe7,
+  0x01, 0x01, 0x02, 0x00, 0x00, 0xdc, 0x01, 0x07, 0xdb, 0x01, 0x00, 0x7e, 0x07, 0x02, 0x80, 0x07, 0x01, 0x04, 0x00, 0x01, 0xb9, 0x00, 0x02, 0xc2,
+  0x00, 0x00, 0x08, 0x00, 0x03, 0x05, 0x00, 0x05, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x04, 0x00, 0x02, 0x06, 0x00, 0x01, 0xa6, 0x01, 0x00, 0x02,
+  0x00, 0x09, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x04, 0x01, 0x00, 0x03, 0x40, 0x00, 0x03, 0x29, 0x00, 0x03, 0x01, 0x00, 0x02, 0xe3, 0x01, 0x00, 0xbd,
+  0x01, 0x00, 0x31, 0x01, 0x02, 0x01, 0x00, 0x00, 0x35, 0x00, 0x00, 0x23, 0x00, 0x00, 0x13, 0x00, 0x05, 0x01, 0x00, 0x0a, 0x0e, 0x00, 0x03, 0xa8,
+  0x03, 0x01, 0x15, 0x00, 0x01, 0x05, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x33, 0x00, 0x00, 0x13, 0x00, 0x00, 0x78, 0x01, 0x00, 0x51, 0x00, 0x00, 0x5c,
+  0x00, 0x01, 0x12, 0x00, 0x01, 0x24, 0x00, 0x00, 0xe5, 0x01, 0x00, 0xde, 0x04, 0x01, 0x01, 0x00, 0x00, 0x7b, 0x01, 0x01, 0x09, 0x03, 0x07, 0x01,
+  0x00, 0x10, 0xe6, 0xf3, 0x01, 0x00, 0xcb, 0x07, 0x00, 0x02, 0x00, 0x02, 0xde, 0x01, 0x02, 0x7f, 0x03, 0x01, 0x3e, 0x00, 0xc0, 0xf4, 0xe8, 0xe8,
+  0xf3, 0xf3, 0xf3, 0xf3, 0xe8, 0xf3, 0xf2, 0xf3, 0xe7, 0x09, 0x00, 0x12, 0xf3, 0x07, 0x00, 0x00, 0x95, 0x00, 0x10, 0xf4, 0x75, 0x00, 0x00, 0xc3,
+  0x00, 0x00, 0x79, 0x00, 0x01, 0x59, 0x02, 0x33, 0xf6, 0xf5, 0xf3, 0x5c, 0x00, 0x06, 0x30, 0x06, 0x00, 0x18, 0x00, 0x11, 0xf5, 0xb5, 0x05, 0x00,
+  0x16, 0x06, 0x11, 0xe3, 0x94, 0x01, 0x04, 0x97, 0x01, 0x00, 0x47, 0x07, 0x10, 0xde, 0x8e, 0x01, 0x30, 0xe2, 0xe2, 0xe0, 0x56, 0x09, 0x00, 0xde,
+  0x01, 0x10, 0xe3, 0x23, 0x00, 0x00, 0xe6, 0x01, 0x01, 0x16, 0x00, 0x00, 0xb9, 0x01, 0x02, 0x18, 0x02, 0x00, 0x1b, 0x00, 0x10, 0xe4, 0xa1, 0x05,
+  0x20, 0xe2, 0xe1, 0x25, 0x00, 0x01, 0xe4, 0x01, 0x10, 0xe8, 0xbe, 0x00, 0x03, 0x38, 0x08, 0x02, 0x01, 0x00, 0x00, 0x35, 0x00, 0x00, 0x31, 0x00,
+  0x01, 0x09, 0x00, 0x20, 0xe2, 0xe3, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x00, 0x85, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0x09, 0x00, 0x08, 0x04, 0x00, 0x32, 0xf6, 0xf6, 0xf5, 0x07, 0x00, 0x00, 0x45, 0x0b, 0x01, 0xd6, 0x00, 0x00, 0x3d, 0x01, 0x02, 0x10, 0x00, 0x01,
+  0x07, 0x00, 0x01, 0x5a, 0x01, 0x05, 0x02, 0x00, 0x01, 0x05, 0x00, 0x00, 0x25, 0x00, 0x02, 0x01, 0x00, 0x01, 0x0b, 0x00, 0x03, 0xde, 0x01, 0x00,
+  0x9b, 0x01, 0x02, 0x7c, 0x01, 0x03, 0x01, 0x00, 0x00, 0x09, 0x00, 0x02, 0x12, 0x00, 0x02, 0x04, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x07, 0x00, 0x0b,
+  0x01, 0x00, 0x05, 0x14, 0x00, 0x02, 0x09, 0x00, 0x00, 0x37, 0x00, 0x00, 0x08, 0x00, 0x02, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x52, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x18, 0x00, 0x04, 0x01, 0x00, 0x01, 0x0c, 0x00, 0x11, 0xe8, 0x03, 0x00,
+  0x00, 0x05, 0x00, 0x00, 0x02, 0x00, 0x03, 0xfd, 0x01, 0x03, 0x01, 0x00, 0x00, 0xd8, 0x01, 0x00, 0x04, 0x00, 0x01, 0x01, 0x00, 0x02, 0xb1, 0x03,
+  0x00, 0x2b, 0x00, 0x00, 0x01, 0x00, 0x07, 0x20, 0x02, 0x45, 0xf3, 0xe7, 0xf3, 0xe8, 0x02, 0x00, 0x10, 0xf3, 0x3a, 0x02, 0x00, 0x04, 0x02, 0x20,
+  0xf5, 0xf4, 0x05, 0x00, 0x00, 0x20, 0x00, 0x00, 0x74, 0x01, 0x00, 0x7a, 0x01, 0x05, 0xbf, 0x03, 0x00, 0xe2, 0x01, 0x30, 0xf6, 0xf5, 0xe8, 0x36,
+  0x04, 0x0c, 0x01, 0x00, 0x00, 0xf8, 0x07, 0x10, 0xe3, 0x05, 0x00, 0x01, 0x0c, 0x00, 0x21, 0xe3, 0xe4, 0x0c, 0x00, 0x00, 0x72, 0x02, 0x12, 0xe4,
+  0x01, 0x00, 0x00, 0xf6, 0x0b, 0x02, 0x08, 0x00, 0x81, 0xe6, 0xe4, 0xe4, 0xe2, 0xe2, 0xe1, 0xe3, 0xe3, 0xe2, 0x01, 0x31, 0xe4, 0xe2, 0xe1, 0xae,
+  0x03, 0x00, 0x1a, 0x00, 0x00, 0x5a, 0x0a, 0x00, 0x98, 0x00, 0x00, 0x6b, 0x0c, 0x00, 0xdb, 0x03, 0x02, 0x01, 0x00, 0x00, 0xdc, 0x01, 0x00, 0xe5,
+  0x01, 0x14, 0xe3, 0x7d, 0x01, 0x01, 0xe0, 0x01, 0x01, 0x73, 0x03, 0x02, 0x04, 0x00, 0x02, 0x06, 0x00, 0x00, 0x04, 0x00, 0x03, 0x01, 0x00, 0x01,
+  0x9e, 0x01, 0x01, 0x05, 0x00, 0x02, 0x01, 0x00, 0x00, 0x2f, 0x01, 0x09, 0x21, 0x00, 0x09, 0x01, 0x00, 0x00, 0x18, 0x00, 0x01, 0x50, 0x00, 0x00,
+  0x34, 0x00, 0x00, 0x36, 0x00, 0x14, 0xf7, 0x16, 0x02, 0x02, 0x3b, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x01, 0x0b, 0x00, 0x01, 0x06, 0x00,
+  0x00, 0x46, 0x01, 0x05, 0x01, 0x00, 0x07, 0x0e, 0x00, 0x00, 0x48, 0x0b, 0x09, 0x01, 0x00, 0x03, 0x10, 0x00, 0x04, 0x39, 0x00, 0x00, 0x0a, 0x00,
+  0x05, 0x05, 0x00, 0x00, 0x12, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x03, 0x01, 0x00, 0x00, 0x18, 0x00, 0x02, 0x01, 0x00, 0x00, 0x16, 0x00,
+  0x0f, 0x01, 0x00, 0x06, 0x00, 0xec, 0x01, 0x00, 0xaa, 0x01, 0x00, 0x07, 0x00, 0x02, 0x01, 0x00, 0x00, 0x13, 0x01, 0x00, 0x40, 0x00, 0x01, 0x45,
+  0x00, 0x07, 0x3a, 0x00, 0x01, 0x25, 0x00, 0x13, 0xe8, 0x29, 0x00, 0x00, 0x0d, 0x00, 0x05, 0x02, 0x00, 0x03, 0x01, 0x00, 0x02, 0xe1, 0x01, 0x21,
+  0xf3, 0xf5, 0x8e, 0x07, 0x02, 0x01, 0x00, 0x00, 0xc1, 0x03, 0x01, 0x16, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x06, 0x08, 0x02, 0x00, 0x00, 0x0d,
+  0x02, 0x00, 0x05, 0x00, 0x01, 0x01, 0x00, 0x00, 0x59, 0x00, 0x00, 0x3e, 0x08, 0x00, 0x18, 0x00, 0x00, 0x4c, 0x00, 0x01, 0x13, 0x00, 0x02, 0x01,
+  0x00, 0x00, 0x02, 0x04, 0x00, 0x2e, 0x00, 0x12, 0xf5, 0x0d, 0x04, 0x00, 0x64, 0x06, 0x11, 0xe4, 0x03, 0x00, 0x00, 0x23, 0x00, 0x00, 0x95, 0x00,
+  0x01, 0x82, 0x00, 0x00, 0x53, 0x00, 0x01, 0x1f, 0x02, 0x00, 0x2e, 0x02, 0x22, 0xe3, 0xe4, 0x84, 0x01, 0x00, 0x8c, 0x01, 0x01, 0xce, 0x00, 0x02,
+  0xe2, 0x01, 0x03, 0x0e, 0x00, 0x02, 0xa1, 0x01, 0x02, 0x06, 0x00, 0x04, 0x0d, 0x0b, 0x01, 0x0d, 0x00, 0x02, 0xf2, 0x00, 0x06, 0x0c, 0x00, 0x00,
+  0x04, 0x01, 0x00, 0x23, 0x0b, 0x00, 0x2b, 0x00, 0x02, 0x02, 0x00, 0x00, 0xd7, 0x01, 0x01, 0x01, 0x00, 0x01, 0x07, 0x00, 0x01, 0x05, 0x00, 0x02,
+  0x06, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x2d, 0x01, 0x00, 0x0c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x52, 0x00, 0x02, 0x11, 0x00, 0x00, 0x2f, 0x01, 0x0f,
+  0x01, 0x00, 0x11, 0x01, 0x43, 0x00, 0x03, 0xbc, 0x07, 0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x02, 0x09, 0x00, 0x01, 0x5a, 0x00, 0x03, 0x55, 0x00,
+  0x05, 0x9d, 0x00, 0x07, 0x1b, 0x00, 0x05, 0x04, 0x00, 0x03, 0x01, 0x00, 0x0f, 0x0b, 0x00, 0x00, 0x01, 0x08, 0x00, 0x00, 0x46, 0x00, 0x02, 0x44,
+  0x00, 0x01, 0x07, 0x00, 0x01, 0x0e, 0x00, 0x00, 0x18, 0x00, 0x02, 0x06, 0x00, 0x01, 0x0d, 0x00, 0x01, 0x16, 0x00, 0x09, 0x1c, 0x00, 0x04, 0x01,
+  0x00, 0x00, 0x64, 0x01, 0x31, 0xe8, 0xf3, 0xf5, 0xf0, 0x09, 0x04, 0xa2, 0x05, 0x00, 0x83, 0x07, 0x00, 0xb5, 0x01, 0x00, 0xfc, 0x01, 0x03, 0x01,
+  0x00, 0x00, 0x09, 0x00, 0x01, 0xec, 0x03, 0x01, 0xc3, 0x01, 0x00, 0xa2, 0x01, 0x02, 0x01, 0x00, 0x00, 0x43, 0x00, 0x03, 0x46, 0x00, 0x00, 0x08,
+  0x00, 0x00, 0x70, 0x00, 0x03, 0x60, 0x00, 0x01, 0x07, 0x00, 0x01, 0x91, 0x00, 0x04, 0x58, 0x04, 0x00, 0xeb, 0x07, 0x03, 0x6d, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x71, 0x00, 0x00, 0xf6, 0x00, 0x00, 0x40, 0x00, 0x01, 0x42, 0x00, 0x31, 0xe8, 0xe8, 0xe8, 0xca, 0x01, 0x00, 0x15, 0x00, 0x00, 0x09,
+  0x00, 0x03, 0x0b, 0x00, 0x00, 0xdb, 0x01, 0x01, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x02, 0x0e, 0x00, 0x0b, 0x01, 0x00, 0x03, 0x6a,
+  0x00, 0x01, 0x4f, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x04, 0x00, 0x01, 0x01, 0x00, 0x01, 0x15, 0x00, 0x08, 0x11, 0x00, 0x01, 0x01, 0x00, 0x00, 0x95,
+  0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x14, 0x00, 0x00, 0x23, 0x00, 0x00, 0xf7, 0x05, 0x02, 0x12, 0x00, 0x00, 0x05,
+  0x00, 0x00, 0x0c, 0x00, 0x01, 0x0b, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x15, 0x00, 0x00, 0x04, 0x00, 0x02, 0x01, 0x00, 0x00, 0x29, 0x00, 0x02, 0x01,
+  0x00, 0x02, 0x0e, 0x00, 0x00, 0x38, 0x00, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0xf9, 0x01, 0x02, 0x1f, 0x00, 0x00, 0x06, 0x00, 0x00, 0x15,
+  0x00, 0x04, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x09, 0x0f, 0x00, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x00, 0x06, 0x01, 0x00, 0x01, 0xfd, 0x00, 0x00, 0x33,
+  0x00, 0x00, 0x05, 0x00, 0x0b, 0x01, 0x00, 0x04, 0x11, 0x00, 0x04, 0x08, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0d, 0x00, 0x01, 0x73, 0x04, 0x00, 0x3f,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0xc6, 0x03, 0x03, 0x3f, 0x01, 0x00, 0x62, 0x00, 0x01, 0x01, 0x00, 0x00, 0x79, 0x01, 0x01, 0x73, 0x03, 0x00, 0x07,
+  0x00, 0x00, 0xe4, 0x01, 0x05, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x01, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x33, 0x00, 0x00, 0x83, 0x0e, 0x04, 0x01,
+  0x00, 0x00, 0x54, 0x00, 0x04, 0x0e, 0x00, 0x01, 0x3e, 0x06, 0x01, 0x06, 0x00, 0x00, 0x68, 0x03, 0x00, 0x01, 0x00, 0x01, 0x0e, 0x00, 0x01, 0x01,
+  0x00, 0x03, 0x08, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x21, 0x00, 0x00, 0x06, 0x00, 0x00, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00, 0x1d, 0x00, 0x04, 0x10,
+  0x00, 0x01, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x06, 0x00, 0x00, 0x01, 0x00, 0x04, 0x08, 0x00, 0x08, 0x01, 0x00, 0x00, 0x13, 0x01, 0x00, 0x18,
+  0x01, 0x03, 0xd3, 0x00, 0x00, 0x24, 0x00, 0x01, 0x44, 0x00, 0x01, 0x6e, 0x0b, 0x01, 0x1a, 0x00, 0x00, 0x09, 0x00, 0x07, 0x01, 0x00, 0x00, 0x12,
+  0x00, 0x04, 0x14, 0x00, 0x02, 0x51, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x14, 0x00, 0x01, 0x17, 0x00, 0x00, 0x1f, 0x00, 0x04, 0x0e, 0x00, 0x04, 0x01,
+  0x00, 0x06, 0x13, 0x00, 0x01, 0x07, 0x00, 0x02, 0x05, 0x00, 0x00, 0x34, 0x00, 0x00, 0xdc, 0x00, 0x02, 0x46, 0x00, 0x06, 0x88, 0x01, 0x00, 0x0e,
+  0x00, 0x01, 0x0b, 0x00, 0x01, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x32, 0x00, 0x00, 0x03, 0x00, 0x00, 0xfb, 0x0b, 0x00, 0x01,
+  0x00, 0x01, 0x0d, 0x00, 0x03, 0x01, 0x00, 0x02, 0x09, 0x00, 0x00, 0x06, 0x00, 0x01, 0x39, 0x00, 0x00, 0x37, 0x00, 0x00, 0x4a, 0x00, 0x01, 0x3b,
+  0x00, 0x10, 0xf5, 0xcc, 0x00, 0x06, 0x01, 0x00, 0x08, 0x0c, 0x00, 0x05, 0x01, 0x00, 0x01, 0x23, 0x00, 0x00, 0x36, 0x00, 0x04, 0x01, 0x00, 0x00,
+  0x26, 0x00, 0x01, 0x15, 0x00, 0x30, 0xfb, 0xf7, 0xfb, 0x53, 0x01, 0x00, 0x56, 0x01, 0x03, 0x01, 0x00, 0x01, 0x67, 0x00, 0x01, 0xd7, 0x01, 0x03,
+  0xda, 0x01, 0x00, 0xbb, 0x03, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0xf8, 0x09, 0x00, 0x08, 0x00, 0x04, 0x01, 0x00, 0x00, 0x92, 0x00, 0x00,
+  0x4a, 0x00, 0x00, 0x03, 0x00, 0x01, 0x57, 0x01, 0x01, 0x01, 0x00, 0x00, 0x4f, 0x00, 0x05, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x02, 0x00, 0x01, 0x01, 0x00, 0x03, 0x31, 0x00, 0x00, 0xe4, 0x00, 0x01, 0x15, 0x00, 0x02, 0x0f, 0x00, 0x01, 0x1e, 0x00, 0x00,
+  0x06, 0x00, 0x01, 0x0f, 0x00, 0x00, 0x06, 0x00, 0x00, 0x08, 0x00, 0x02, 0x01, 0x00, 0x03, 0xb0, 0x01, 0x03, 0x01, 0x00, 0x02, 0x0b, 0x00, 0x00,
+  0x6f, 0x05, 0x01, 0x81, 0x00, 0x02, 0x18, 0x01, 0x00, 0x8d, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x36, 0x00, 0x01, 0x3e, 0x00, 0x00, 0x10, 0x00, 0x03,
+  0x16, 0x00, 0x00, 0x01, 0x00, 0x03, 0x0b, 0x00, 0x00, 0x35, 0x00, 0x01, 0x09, 0x00, 0x01, 0x24, 0x00, 0x01, 0x5a, 0x00, 0x00, 0x0f, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x00, 0x03, 0x4f, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x15, 0x00, 0x04, 0x0d, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x03, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x44, 0x00, 0x02, 0x04, 0x00, 0x01, 0x01, 0x00, 0x02, 0x1c, 0x00, 0x03, 0x07, 0x00, 0x01,
+  0x05, 0x00, 0x03, 0x1b, 0x00, 0x02, 0x4a, 0x00, 0x00, 0x11, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0e, 0x00, 0x01, 0x16, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x0c, 0x00, 0x01, 0x05, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x26, 0x00, 0x00, 0x32, 0x00, 0x03, 0x3d, 0x00, 0x01, 0x05, 0x00, 0x09,
+  0x01, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x18, 0x00, 0x00, 0x48, 0x01, 0x00, 0x04, 0x00, 0x00, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x01,
+  0x08, 0x00, 0x01, 0x05, 0x00, 0x00, 0x4e, 0x01, 0x00, 0x1b, 0x00, 0x02, 0x01, 0x00, 0x01, 0x09, 0x00, 0x00, 0x05, 0x00, 0x00, 0x66, 0x00, 0x05,
+  0xe1, 0x01, 0x01, 0xda, 0x01, 0x00, 0x9e, 0x05, 0x40, 0xe7, 0xe8, 0xe7, 0xf3, 0x07, 0x00, 0x03, 0x10, 0x00, 0x10, 0xf3, 0x07, 0x00, 0x00, 0x1e,
+  0x00, 0x00, 0xe5, 0x01, 0x00, 0xee, 0x07, 0x00, 0x34, 0x00, 0x01, 0x01, 0x00, 0x00, 0x64, 0x00, 0x00, 0x61, 0x00, 0x01, 0x64, 0x00, 0x00, 0x66,
+  0x00, 0x02, 0x05, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x00, 0x10, 0xf6, 0x18, 0x04, 0x03, 0x63, 0x00, 0x02, 0xe2, 0x01, 0x00,
+  0x77, 0x00, 0x03, 0x27, 0x00, 0x01, 0x0e, 0x00, 0x01, 0x06, 0x00, 0x03, 0x0e, 0x00, 0x01, 0x02, 0x00, 0x06, 0x01, 0x00, 0x00, 0xfe, 0x00, 0x03,
+  0x65, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x54, 0x00, 0x01, 0x57, 0x00, 0x02, 0x11, 0x00, 0x02, 0x01, 0x00, 0x02, 0x34, 0x00, 0x00,
+  0x15, 0x00, 0x04, 0x1a, 0x00, 0x02, 0x06, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x02, 0x00, 0x03, 0x01, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x21, 0x00, 0x03,
+  0x13, 0x00, 0x04, 0xc0, 0x00, 0x00, 0x08, 0x00, 0x00, 0x54, 0x00, 0x06, 0x01, 0x00, 0x02, 0x35, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x05, 0x00, 0x00, 0x63, 0x03, 0x03, 0x01, 0x00, 0x04, 0x49, 0x00, 0x00, 0x05, 0x00, 0x01, 0x07, 0x00, 0x04,
+  0x01, 0x00, 0x00, 0x0f, 0x00, 0x04, 0x1d, 0x00, 0x03, 0x45, 0x00, 0x00, 0x07, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0b, 0x00, 0x01,
+  0x02, 0x00, 0x04, 0x08, 0x00, 0x00, 0x28, 0x00, 0x02, 0x1e, 0x00, 0x01, 0xa4, 0x00, 0x04, 0x01, 0x00, 0x02, 0x0a, 0x00, 0x00, 0xb4, 0x00, 0x01,
+  0x24, 0x01, 0x00, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x15, 0x00, 0x00, 0x09, 0x00, 0x02, 0x04, 0x00, 0x00, 0x06, 0x00, 0x00, 0x21, 0x00, 0x06,
+  0x01, 0x00, 0x01, 0x21, 0x0d, 0x04, 0x01, 0x00, 0x02, 0x1a, 0x00, 0x00, 0x27, 0x00, 0x03, 0x7b, 0x00, 0x04, 0xbc, 0x01, 0x02, 0x08, 0x00, 0x00,
+  0x95, 0x01, 0x03, 0x01, 0x00, 0x01, 0x87, 0x0d, 0x10, 0xe8, 0xa5, 0x0b, 0x07, 0x02, 0x00, 0x00, 0xbb, 0x01, 0x02, 0x2a, 0x00, 0x00, 0x32, 0x00,
+  0x00, 0xe1, 0x05, 0x00, 0x87, 0x07, 0x03, 0x37, 0x00, 0x01, 0x10, 0x02, 0x00, 0x08, 0x00, 0x00, 0x1e, 0x02, 0x01, 0x29, 0x02, 0x26, 0xe8, 0xe8,
+  0x72, 0x00, 0x00, 0x97, 0x00, 0x00, 0x9e, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x17, 0x00, 0x00, 0x0d, 0x00, 0x02, 0x04, 0x00, 0x03, 0x07, 0x00, 0x03,
+  0x05, 0x00, 0x06, 0xfb, 0x00, 0x00, 0x0b, 0x00, 0x02, 0x0b, 0x01, 0x00, 0x70, 0x00, 0x02, 0x0d, 0x00, 0x02, 0x01, 0x00, 0x02, 0xe4, 0x02, 0x02,
+  0x01, 0x00, 0x00, 0x15, 0x00, 0x00, 0x1b, 0x00, 0x02, 0x02, 0x00, 0x01, 0x0d, 0x00, 0x00, 0x03, 0x00, 0x02, 0x01, 0x00, 0x00, 0x52, 0x00, 0x02,
+  0x0d, 0x00, 0x00, 0x41, 0x00, 0x03, 0x03, 0x00, 0x06, 0x21, 0x00, 0x00, 0x58, 0x00, 0x00, 0x10, 0x00, 0x01, 0x12, 0x00, 0x00, 0x0a, 0x00, 0x04,
+  0x01, 0x00, 0x02, 0x1d, 0x00, 0x00, 0x06, 0x00, 0x01, 0x44, 0x00, 0x02, 0x0a, 0x00, 0x07, 0x29, 0x00, 0x01, 0x07, 0x00, 0x02, 0x5d, 0x00, 0x00,
+  0x02, 0x00, 0x04, 0x1c, 0x00, 0x05, 0x07, 0x00, 0x01, 0x2f, 0x00, 0x00, 0x07, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x01,
+  0x13, 0x00, 0x01, 0x08, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x57, 0x00, 0x08, 0xc8, 0x00, 0x02, 0x13, 0x01, 0x01, 0x09, 0x00, 0x02, 0x01, 0x00, 0x04,
+  0x08, 0x00, 0x01, 0x1a, 0x00, 0x01, 0x48, 0x01, 0x01, 0x06, 0x00, 0x00, 0x09, 0x00, 0x0f, 0x01, 0x00, 0x0e, 0x00, 0x25, 0x00, 0x01, 0x2e, 0x00,
+  0x05, 0x45, 0x00, 0x00, 0x74, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x05, 0x00, 0x01, 0x01, 0x00, 0x05, 0x09, 0x00, 0x04, 0x01, 0x00,
+  0x00, 0x89, 0x0f, 0x00, 0x02, 0x00, 0x10, 0xf5, 0x05, 0x00, 0x01, 0x02, 0x00, 0x04, 0x01, 0x00, 0x30, 0xf3, 0xe8, 0xf3, 0xe1, 0x01, 0x04, 0xfd,
+  0x03, 0x00, 0xdf, 0x01, 0x32, 0xe7, 0xe7, 0xe7, 0x61, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x03, 0x00, 0x02, 0xda, 0x01, 0x01, 0x06, 0x00, 0x01, 0x11,
+  0x00, 0x01, 0x08, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01, 0x00, 0x04, 0x08, 0x00, 0x05, 0x01, 0x00, 0x02, 0x90, 0x00, 0x02, 0x09, 0x00, 0x05, 0x0c,
+  0x00, 0x00, 0xdb, 0x01, 0x01, 0x3c, 0x00, 0x01, 0x79, 0x05, 0x02, 0x01, 0x00, 0x05, 0x09, 0x00, 0x01, 0x2a, 0x00, 0x06, 0x0e, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x39, 0x00, 0x04, 0x12, 0x00, 0x00, 0xc1, 0x00, 0x0a, 0x1f, 0x00, 0x00, 0x10, 0x00, 0x00, 0x34, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x02,
+  0x00, 0x02, 0x01, 0x00, 0x00, 0x32, 0x00, 0x01, 0x05, 0x00, 0x01, 0x04, 0x00, 0x05, 0x06, 0x00, 0x01, 0x01, 0x00, 0x01, 0x07, 0x00, 0x03, 0x33,
+  0x00, 0x00, 0x1a, 0x00, 0x04, 0x09, 0x00, 0x01, 0x01, 0x00, 0x00, 0x11, 0x00, 0x03, 0x01, 0x00, 0x02, 0x09, 0x00, 0x01, 0x15, 0x00, 0x02, 0x02,
+  0x00, 0x01, 0x13, 0x00, 0x00, 0x3a, 0x00, 0x01, 0x07, 0x00, 0x05, 0x01, 0x00, 0x03, 0xf7, 0x00, 0x01, 0x09, 0x01, 0x00, 0xd6, 0x00, 0x09, 0x02,
+  0x00, 0x00, 0xc5, 0x0b, 0x00, 0x1c, 0x00, 0x03, 0x1e, 0x00, 0x00, 0x09, 0x00, 0x05, 0x01, 0x00, 0x11, 0xe9, 0x03, 0x00, 0x0a, 0x01, 0x00, 0x06,
+  0x11, 0x00, 0x0a, 0x2c, 0x00, 0x02, 0x01, 0x00, 0x03, 0x65, 0x00, 0x03, 0x25, 0x00, 0x01, 0x22, 0x00, 0x00, 0x10, 0x00, 0x00, 0x02, 0x00, 0x02,
+  0x90, 0x01, 0x01, 0x01, 0x00, 0x00, 0xb3, 0x00, 0x01, 0x5c, 0x11, 0x01, 0x79, 0x0f, 0x10, 0xe8, 0x79, 0x0f, 0x00, 0x02, 0x00, 0x21, 0xf5, 0xf3,
+  0x10, 0x00, 0x06, 0xf1, 0x01, 0x50, 0xe8, 0xe7, 0xe7, 0xf3, 0xe7, 0x3c, 0x00, 0x01, 0x39, 0x00, 0x11, 0xf7, 0xee, 0x02, 0x00, 0x49, 0x00, 0x00,
+  0x55, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x02, 0x0a, 0x00, 0x00, 0x0b, 0x00, 0x14, 0xfb, 0x28, 0x00, 0x00, 0x16, 0x00, 0x03, 0xd7, 0x02,
+  0x00, 0xdf, 0x05, 0x01, 0x10, 0x00, 0x00, 0x24, 0x01, 0x02, 0x23, 0x01, 0x02, 0x01, 0x00, 0x03, 0x2b, 0x00, 0x01, 0x05, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x32, 0x01, 0x00, 0x37, 0x01, 0x01, 0x07, 0x00, 0x01, 0x08, 0x00, 0x00, 0x43, 0x00, 0x02, 0x03, 0x00, 0x05, 0x38, 0x00, 0x00, 0x1b, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x4b, 0x00, 0x01, 0x36, 0x00, 0x03, 0x15, 0x00, 0x00, 0x10, 0x00, 0x00, 0x41, 0x00, 0x03, 0x0c, 0x00, 0x00, 0x01, 0x00,
+  0x02, 0x10, 0x00, 0x07, 0x01, 0x00, 0x10, 0xf5, 0x6c, 0x00, 0x00, 0x1a, 0x00, 0x02, 0x22, 0x00, 0x00, 0x05, 0x00, 0x00, 0x17, 0x00, 0x05, 0x5f,
+  0x00, 0x00, 0x15, 0x00, 0x00, 0x14, 0x00, 0x02, 0x17, 0x00, 0x00, 0x0f, 0x00, 0x03, 0x07, 0x00, 0x05, 0x01, 0x00, 0x03, 0xb4, 0x00, 0x01, 0x14,
+  0x00, 0x02, 0x35, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x57, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x01, 0x00, 0x03, 0x0a, 0x00, 0x00, 0x06, 0x00, 0x02, 0x0b,
+  0x00, 0x01, 0x06, 0x00, 0x00, 0x05, 0x00, 0x07, 0x01, 0x00, 0x03, 0x21, 0x15, 0x00, 0x1a, 0x0d, 0x00, 0x0d, 0x00, 0x0e, 0x01, 0x00, 0x0f, 0x14,
+  0x00, 0x01, 0x38, 0xf7, 0xf7, 0xe9, 0x45, 0x00, 0x01, 0x31, 0x0f, 0x04, 0x01, 0x00, 0x02, 0x19, 0x00, 0x07, 0x11, 0x00, 0x00, 0x79, 0x00, 0x20,
+  0xf5, 0xf6, 0x96, 0x1a, 0x01, 0x0c, 0x00, 0x00, 0x82, 0x00, 0x00, 0x08, 0x00, 0x04, 0xc1, 0x01, 0x00, 0x93, 0x00, 0xb0, 0xf5, 0xf6, 0xf5, 0xf6,
+  0xf5, 0xf5, 0xe8, 0xf5, 0xf5, 0xe8, 0xf5,
+};
+
+const lv_img_dsc_t dev_bg_tlz = {
+  .header.cf = LV_IMG_CF_USER_ENCODED_0,
+  .header.always_zero = 0,
+  .header.reserved = 0,
+  .header.w = 480,
+  .header.h = 480,
+  .data_size = 156871,
+  .data = dev_bg_tlz_map,
+};
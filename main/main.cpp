@@ -25,6 +25,7 @@ SOFTWARE.
 static const char *TAG = "ESP32-TUX";
 #include "main.hpp"
 #include "WebServer.hpp"
+#include "MetricsWriter.hpp"
 #include "events/gui_events.hpp"
 #include "esp_netif.h"
 #include "mdns_responder.h"
@@ -38,15 +39,24 @@ static const char *TAG = "ESP32-TUX";
 // Async callback for config changes - runs in LVGL context safely
 static void config_changed_async_cb(void *data) {
     ESP_LOGI(TAG, "Config changed async - updating language, brightness, theme and sending MSG_CONFIG_CHANGED");
-    // Update language from config
-    if (cfg && !cfg->Language.empty()) {
-        set_language_from_code(cfg->Language.c_str());
-    }
-    
-    // Apply brightness from config
     if (cfg) {
-        lcd.setBrightness(cfg->Brightness);
-        ESP_LOGI(TAG, "Applied brightness from config: %d", cfg->Brightness);
+        // Copied under the config lock: a web handler may be changing them
+        std::string language;
+        uint8_t brightness;
+        {
+            std::lock_guard<std::recursive_mutex> lock(cfg->mutex);
+            language = cfg->Language;
+            brightness = cfg->Brightness;
+        }
+
+        // Update language from config
+        if (!language.empty()) {
+            set_language_from_code(language.c_str());
+        }
+
+        // Apply brightness from config
+        lcd.setBrightness(brightness);
+        ESP_LOGI(TAG, "Applied brightness from config: %d", brightness);
     }
     
     lv_msg_send(MSG_CONFIG_CHANGED, NULL);
@@ -82,9 +92,12 @@ static void set_timezone()
     const char *source = "settings default";
     std::string tz_value = "UTC0";
 
-    if (cfg && !cfg->TimeZone.empty()) {
-        tz_value = cfg->TimeZone;
-        source = "web config";
+    if (cfg) {
+        std::lock_guard<std::recursive_mutex> lock(cfg->mutex);
+        if (!cfg->TimeZone.empty()) {
+            tz_value = cfg->TimeZone;
+            source = "web config";
+        }
     }
 
     setenv("TZ", tz_value.c_str(), 1);
@@ -111,8 +124,8 @@ static void update_datetime_ui()
         return;
     }
 
-    // Send update time to UI via IPC queue (LVGL task will consume)
-    ui_ipc_post_time(datetimeinfo);
+    // Send update time to UI via the UI bus (LVGL task will consume)
+    ui_bus_post_time(datetimeinfo);
 }
 
 static const char* get_id_string(esp_event_base_t base, int32_t id) {
@@ -160,7 +173,7 @@ static void tux_event_handler(void* arg, esp_event_base_t event_base,
         update_datetime_ui();
 
         // Enable timer after the date/time is set.
-        lv_timer_ready(timer_weather); 
+        ui_bus_post_timer(timer_weather, ui_timer_op::READY);
         
         // Start MQTT connection to Bambu printer now that time is synced
         // This ensures TLS certificate verification has accurate system time
@@ -174,26 +187,26 @@ static void tux_event_handler(void* arg, esp_event_base_t event_base,
         // OTA Started
         char buffer[150] = {0};
         snprintf(buffer,sizeof(buffer),"OTA: %s",(char*)event_data);
-        lv_msg_send(MSG_OTA_STATUS,buffer);
+        ui_bus_post_lv_msg(MSG_OTA_STATUS, buffer, UI_BUS_SLOT_OTA);
 
     } else if (event_id == TUX_EVENT_OTA_IN_PROGRESS) {
         // OTA In Progress - progressbar?
         char buffer[150] = {0};
         int bytes_read = (*(int *)event_data)/1024;
         snprintf(buffer,sizeof(buffer),"OTA: Data read : %dkb", bytes_read);
-        lv_msg_send(MSG_OTA_STATUS,buffer);
+        ui_bus_post_lv_msg(MSG_OTA_STATUS, buffer, UI_BUS_SLOT_OTA);
 
     } else if (event_id == TUX_EVENT_OTA_ROLLBACK) {
         // OTA Rollback - god knows why!
         char buffer[150] = {0};
         snprintf(buffer,sizeof(buffer),"OTA: %s", (char*)event_data);
-        lv_msg_send(MSG_OTA_STATUS,buffer);
+        ui_bus_post_lv_msg(MSG_OTA_STATUS, buffer, UI_BUS_SLOT_OTA);
 
     } else if (event_id == TUX_EVENT_OTA_COMPLETED) {
         // OTA Completed - YAY! Success
         char buffer[150] = {0};
         snprintf(buffer,sizeof(buffer),"OTA: %s", (char*)event_data);
-        lv_msg_send(MSG_OTA_STATUS,buffer);
+        ui_bus_post_lv_msg(MSG_OTA_STATUS, buffer, UI_BUS_SLOT_OTA);
 
         // wait before reboot
         vTaskDelay(3000 / portTICK_PERIOD_MS);
@@ -202,13 +215,13 @@ static void tux_event_handler(void* arg, esp_event_base_t event_base,
         // OTA Aborted - Not a good day for updates
         char buffer[150] = {0};
         snprintf(buffer,sizeof(buffer),"OTA: %s", (char*)event_data);
-        lv_msg_send(MSG_OTA_STATUS,buffer);
+        ui_bus_post_lv_msg(MSG_OTA_STATUS, buffer, UI_BUS_SLOT_OTA);
 
     } else if (event_id == TUX_EVENT_OTA_FAILED) {
         // OTA Failed - huh! - maybe in red color?
         char buffer[150] = {0};
         snprintf(buffer,sizeof(buffer),"OTA: %s", (char*)event_data);
-        lv_msg_send(MSG_OTA_STATUS,buffer);
+        ui_bus_post_lv_msg(MSG_OTA_STATUS, buffer, UI_BUS_SLOT_OTA);
 
     } else if (event_id == TUX_EVENT_WEATHER_UPDATED) {
         // Weather updates - summer?
@@ -218,9 +231,9 @@ static void tux_event_handler(void* arg, esp_event_base_t event_base,
 
     } else if (event_id == TUX_EVENT_CONFIG_CHANGED) {
         // Config changed via web UI - rebuild carousel
-        // Use lv_async_call to safely call LVGL from event handler context
+        // Runs on the LVGL task; lv_async_call is not safe from the event loop task
         ESP_LOGI(TAG, "Config changed, scheduling carousel rebuild");
-        lv_async_call(config_changed_async_cb, NULL);
+        ui_bus_post_call(config_changed_async_cb, NULL);
     }
 }                          
 
@@ -232,27 +245,27 @@ static void wifi_event_handler(void* arg, esp_event_base_t event_base,
     if (event_base == WIFI_EVENT  && event_id == WIFI_EVENT_STA_CONNECTED)
     {
         is_wifi_connected = true;
-        lv_timer_ready(timer_datetime);   // start timer
+        ui_bus_post_timer(timer_datetime, ui_timer_op::READY);   // start timer
 
         // After OTA device restart, RTC will have time but not timezone
         set_timezone();
 
         // Not a warning but just for highlight
         ESP_LOGW(TAG,"WIFI_EVENT_STA_CONNECTED");
-        lv_msg_send(MSG_WIFI_CONNECTED,NULL);
+        ui_bus_post_lv_msg(MSG_WIFI_CONNECTED);
     }
     else if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_STA_DISCONNECTED)
     {
         is_wifi_connected = false;        
-        lv_timer_pause(timer_datetime);   // stop/pause timer
+        ui_bus_post_timer(timer_datetime, ui_timer_op::PAUSE);   // stop/pause timer
 
         ESP_LOGW(TAG,"WIFI_EVENT_STA_DISCONNECTED");
-        lv_msg_send(MSG_WIFI_DISCONNECTED,NULL);
+        ui_bus_post_lv_msg(MSG_WIFI_DISCONNECTED);
     }
     else if (event_base == IP_EVENT && event_id == IP_EVENT_STA_GOT_IP)
     {
         is_wifi_connected = true;
-        lv_timer_ready(timer_datetime);   // start timer
+        ui_bus_post_timer(timer_datetime, ui_timer_op::READY);   // start timer
 
         ESP_LOGW(TAG,"IP_EVENT_STA_GOT_IP");
         ip_event_got_ip_t* event = (ip_event_got_ip_t*) event_data;
@@ -318,9 +331,7 @@ static void wifi_event_handler(void* arg, esp_event_base_t event_base,
 
         // Kick weather timer but let it run from the LVGL timer context
         // (avoid heavy work on the sys_evt task stack)
-        if (timer_weather) {
-            lv_timer_ready(timer_weather);
-        }
+        ui_bus_post_timer(timer_weather, ui_timer_op::READY);
     }
     else if (event_base == IP_EVENT && event_id == IP_EVENT_STA_LOST_IP)
     {
@@ -405,6 +416,113 @@ static void storage_health_task(void *pvParameters)
     vTaskDelete(NULL);
 }
 
+/**
+ * @brief /api/perf control hook (runs in the HTTP server task)
+ */
+static void perf_control(int hud, bool reset)
+{
+    if (reset) prof_reset();
+    if (hud >= 0) {
+        lvgl_acquire();
+        prof_hud_show(hud == 1);
+        lvgl_release();
+    }
+}
+
+// One benchmark at a time; the request waits while the LVGL task runs it
+static struct {
+    SemaphoreHandle_t done;
+    volatile bool busy;
+    int slides;
+    bool png;
+    std::string result;
+} perf_bench_req = {};
+
+static void perf_bench_run(void *arg)
+{
+    (void)arg;
+    perf_bench_req.result = ui_bench_run(perf_bench_req.slides,
+                                         (perf_bench_req.png && is_sdcard_enabled) ? "/sdcard/bench" : NULL);
+    xSemaphoreGive(perf_bench_req.done);
+}
+
+/**
+ * @brief /api/perf/bench hook (runs in the HTTP server task)
+ *
+ * The scenarios render on the LVGL task, whose stack is sized for it; the
+ * HTTP task only waits for the report.
+ */
+static std::string perf_bench(int slides, bool png)
+{
+    if (!perf_bench_req.done) perf_bench_req.done = xSemaphoreCreateBinary();
+    if (!perf_bench_req.done) return "{\"error\":\"no memory\"}";
+    if (perf_bench_req.busy) return "{\"error\":\"benchmark already running\"}";
+
+    perf_bench_req.busy = true;
+    perf_bench_req.slides = slides;
+    perf_bench_req.png = png;
+    xSemaphoreTake(perf_bench_req.done, 0);
+    if (!ui_bus_post_call(perf_bench_run, NULL)) {
+        perf_bench_req.busy = false;
+        return "{\"error\":\"UI queue full\"}";
+    }
+
+    std::string json;
+    if (xSemaphoreTake(perf_bench_req.done, pdMS_TO_TICKS(60000)) == pdTRUE) {
+        json.swap(perf_bench_req.result);
+        perf_bench_req.busy = false;
+    } else {
+        // Leave busy set; the late run still owns the request slot
+        json = "{\"error\":\"timeout\"}";
+    }
+    return json;
+}
+
+/**
+ * @brief /metrics hook: storage health and LVGL frame times (runs in an HTTP worker)
+ */
+static void app_metrics(MetricsWriter &m)
+{
+    storage_health_t storage;
+    storage_health_get_status(&storage);
+    m.family("tux_storage_mounted", "gauge", "Storage is mounted")
+        .integer("tux_storage_mounted", storage.sd_mounted ? 1 : 0, "medium", "sd")
+        .integer("tux_storage_mounted", storage.spiffs_mounted ? 1 : 0, "medium", "spiffs");
+    // The health monitor counts errors per ERROR_WINDOW_MS, so these are not counters
+    m.family("tux_storage_recent_errors", "gauge", "Storage errors in the current error window")
+        .integer("tux_storage_recent_errors", storage.sd_errors, "medium", "sd")
+        .integer("tux_storage_recent_errors", storage.spiffs_errors, "medium", "spiffs");
+
+    prof_slot_t frame = {};
+    portENTER_CRITICAL(&prof_lock);
+    if (prof_slot_frame) frame = *prof_slot_frame;
+    uint16_t fps = prof.fps;
+    uint16_t load = prof.gui_load_permille;
+    uint32_t worst_ms = prof.worst_frame_ms;
+    portEXIT_CRITICAL(&prof_lock);
+
+    // prof_bucket_ms are exclusive upper bounds, close enough to "le" at ms resolution
+    m.family("tux_lvgl_frame_seconds", "histogram", "LVGL frame render time");
+    uint32_t cumulative = 0;
+    for (uint8_t b = 0; b < PROF_BUCKETS - 1; b++) {
+        char le[12];
+        snprintf(le, sizeof(le), "%g", prof_bucket_ms[b] / 1000.0);
+        cumulative += frame.hist[b];
+        m.integer("tux_lvgl_frame_seconds_bucket", cumulative, "le", le);
+    }
+    m.integer("tux_lvgl_frame_seconds_bucket", frame.count, "le", "+Inf")
+        .number("tux_lvgl_frame_seconds_sum", frame.total_us / 1e6)
+        .integer("tux_lvgl_frame_seconds_count", frame.count);
+    m.family("tux_lvgl_frame_seconds_max", "gauge", "Slowest LVGL frame since the profiler was reset")
+        .number("tux_lvgl_frame_seconds_max", frame.max_us / 1e6);
+    m.family("tux_lvgl_fps", "gauge", "Frames rendered in the last second")
+        .integer("tux_lvgl_fps", fps);
+    m.family("tux_lvgl_worst_frame_seconds", "gauge", "Slowest frame in the last second")
+        .number("tux_lvgl_worst_frame_seconds", worst_ms / 1e3);
+    m.family("tux_lvgl_load_ratio", "gauge", "Share of the last second spent in lv_timer_handler()")
+        .number("tux_lvgl_load_ratio", load / 1000.0);
+}
+
 extern "C" void app_main(void)
 {
     esp_log_level_set(TAG, ESP_LOG_DEBUG);      // enable DEBUG logs for this App
@@ -431,6 +549,7 @@ extern "C" void app_main(void)
 
     // Init SPIFF - needed for lvgl images
     init_spiff();
+    assets_init();      // Map the asset partition (splash/background images)
 
 #ifdef SD_SUPPORTED
     // Initializing SDSPI 
@@ -492,6 +611,8 @@ extern "C" void app_main(void)
     lcd.init();         // Initialize LovyanGFX
     lcd.initDMA();      // Init DMA
     lv_init();          // Initialize lvgl
+    img_tlz_init();     // Decoder for compressed .tlz images
+    lv_fs_cache_init(); // Block cache for F:/S: (before the first lv_fs_open)
 
     if (lv_display_init() != ESP_OK) // Configure LVGL
     {
@@ -520,17 +641,18 @@ extern "C" void app_main(void)
     create_splash_screen();
     lvgl_release();
 
+    ui_bus_start();     // Also starts the I/O worker, used by the polling timers in show_ui()
+
     // Main UI
     lvgl_acquire();
     lv_setup_styles();    
     show_ui();
     lvgl_release();
-    ui_ipc_init();
 /* Push these to its own UI task later*/
 
 #ifdef SD_SUPPORTED
-    // Icon status color update
-    lv_msg_send(MSG_SDCARD_STATUS,&is_sdcard_enabled);
+    // Icon status color update (payload is a pointer, so send it from the LVGL task)
+    ui_bus_post_call([](void *) { lv_msg_send(MSG_SDCARD_STATUS, &is_sdcard_enabled); }, NULL);
 #endif
 
     // Wifi Provision and connection.
@@ -542,8 +664,13 @@ extern "C" void app_main(void)
     // Create web server instance (but don't start yet - wait for WiFi connection
     // to avoid port 80 conflict with provisioning HTTP server)
     web_server = new WebServer();
+    WebServer::set_perf_hooks(prof_to_json, perf_control);
+    WebServer::set_perf_bench_hook(perf_bench);
+    WebServer::set_metrics_hook(app_metrics);
 
     ESP_LOGI(TAG, "[APP] Free memory: %" PRIu32 " bytes", esp_get_free_heap_size());
+    img_tlz_log_stats();    // Decode cost of the compressed splash/background images
+    lv_fs_cache_log_stats();
 
     // Date/Time update timer - once per sec
     timer_datetime = lv_timer_create(timer_datetime_callback, 1000,  NULL);
@@ -594,6 +721,7 @@ extern "C" void app_main(void)
 
 static void timer_datetime_callback(lv_timer_t * timer)
 {
+    PROF_SCOPE("timer_datetime");
     // Battery icon animation
     if (battery_value>100) battery_value=0;
     battery_value+=10;
@@ -606,13 +734,43 @@ static void timer_datetime_callback(lv_timer_t * timer)
 static int weather_api_calls_today = 0;
 static int weather_api_last_reset_day = -1;
 
+#define WEATHER_REQUEST_GAP_MS  2000    // Delay between API calls for consecutive locations
+
+struct weather_fetch_job_t {
+    std::vector<std::string> queries;
+};
+
+static volatile bool weather_fetch_pending = false;
+
+// I/O worker: HTTP requests (or cache reads) that refresh /spiffs/weather/<city>.json
+static void weather_fetch_work(void *ctx)
+{
+    weather_fetch_job_t *job = (weather_fetch_job_t *)ctx;
+    for (size_t i = 0; i < job->queries.size(); i++) {
+        if (i > 0) vTaskDelay(pdMS_TO_TICKS(WEATHER_REQUEST_GAP_MS));
+        owm->request_weather_update(job->queries[i]);
+        ui_bus_post_weather(i);   // Pick up the new file now rather than on the next 5 s poll
+    }
+}
+
+static void weather_fetch_release(void *ctx)
+{
+    delete (weather_fetch_job_t *)ctx;
+    weather_fetch_pending = false;
+}
+
 static void timer_weather_callback(lv_timer_t * timer)
 {
+    PROF_SCOPE("timer_weather");
     ESP_LOGD(TAG, "timer_weather_callback fired");
     if (cfg->WeatherAPIkey.empty()) {
         ESP_LOGW(TAG,"Weather API Key not set");
         return;
     }
+    if (weather_fetch_pending) {
+        ESP_LOGD(TAG, "Previous weather update still running");
+        return;
+    }
 
     // Reset daily counter at midnight
     time_t now;
@@ -639,7 +797,8 @@ static void timer_weather_callback(lv_timer_t * timer)
         return;
     }
 
-    // Update weather for all enabled locations
+    // Update weather for all enabled locations on the I/O worker
+    weather_fetch_job_t *job = new weather_fetch_job_t();
     for (int i = 0; i < location_count; i++) {
         weather_location_t loc = cfg->get_weather_location(i);
         if (loc.enabled) {
@@ -649,18 +808,26 @@ static void timer_weather_callback(lv_timer_t * timer)
             }
             ESP_LOGD(TAG, "Updating weather for: %s (API calls today: %d)",
                      location_query.c_str(), weather_api_calls_today + 1);
-            owm->request_weather_update(location_query);
+            job->queries.push_back(location_query);
             weather_api_calls_today++;
-            vTaskDelay(pdMS_TO_TICKS(2000));  // Delay between API calls
         }
     }
+
+    if (job->queries.empty()) {
+        delete job;
+        return;
+    }
+    weather_fetch_pending = true;
+    io_submit("weather_fetch", weather_fetch_work, NULL, weather_fetch_release, job);
 }
 
-// Timer callback to poll printer data files from SD card or SPIFFS
-static void timer_printer_callback(lv_timer_t * timer)
+static volatile bool printer_scan_pending = false;
+
+// I/O worker: scan the printer data files from SD card or SPIFFS and log the online ones
+static void printer_scan_work(void *ctx)
 {
-    ESP_LOGI(TAG, "timer_printer_callback fired - checking printer files");
-    
+    LV_UNUSED(ctx);
+
     // Read all printer JSON files from SD card or SPIFFS
     // Only process files with recent timestamps (online printers)
     const char* printer_path = get_printer_storage_path();
@@ -733,6 +900,18 @@ static void timer_printer_callback(lv_timer_t * timer)
     }
 }
 
+// Timer callback to poll printer data files; the scan itself runs on the I/O worker
+static void timer_printer_callback(lv_timer_t * timer)
+{
+    PROF_SCOPE("timer_printer");
+    ESP_LOGD(TAG, "timer_printer_callback fired - checking printer files");
+    if (printer_scan_pending) return;
+
+    printer_scan_pending = true;
+    io_submit("printer_scan", printer_scan_work, NULL,
+              [](void *) { printer_scan_pending = false; }, NULL);
+}
+
 // Callback to notify App UI change
 static void tux_ui_change_cb(void * s, lv_msg_t *m)
 {
@@ -59,6 +59,14 @@ using namespace std ;
 
 // Make SPIFF available to LVGL Filesystem
 #include "helper_lv_fs.hpp"
+// Block cache with read-ahead in front of the F: and S: drives
+#include "helper_lv_fs_cache.hpp"
+
+// LVGL decoder for compressed (.tlz) images
+#include "helper_img_tlz.hpp"
+
+// Images and fonts mapped from the read-only asset partition
+#include "helper_assets.hpp"
 
 /********************DEVICE SELECTION ******************/
 #if defined(CONFIG_TUX_DEVICE_WT32_SC01)
@@ -82,7 +90,14 @@ using namespace std ;
 
 /********************************************************/
 
+// Frame/callback timing and performance HUD
+#include "helper_profiler.hpp"
+// Background task for file reads, HTTP and JSON parsing
+#include "helper_io_worker.hpp"
+
 #include "helper_display.hpp"
+// Typed message bus from other tasks into the LVGL task
+#include "helper_ui_bus.hpp"
 
 // LVGL v9 stubs for v8.3.3 compatibility
 #include "lvgl_v9_stubs.hpp"
@@ -100,6 +115,7 @@ using namespace std ;
 
 // UI design
 #include "gui.hpp"
+#include "helpers/helper_ui_bench.hpp"   // On-device rendering benchmark (/api/perf/bench)
 #include "events/tux_events.hpp"
 
 #include "OpenWeatherMap.hpp"
@@ -0,0 +1,131 @@
+/*
+ * Carousel slide diff
+ * Matches the keys of the current slides to the keys of the desired list and
+ * returns the panel operations that turn one into the other: which panels are
+ * reused, created and deleted, and the fewest moves that restore the order.
+ * No LVGL here, so it can be tested on the host (host_test/).
+ */
+
+#ifndef CAROUSEL_DIFF_HPP
+#define CAROUSEL_DIFF_HPP
+
+#include <vector>
+#include <string.h>
+
+// Identity of a slide: key ("" never matches) and slide type
+struct carousel_key_t {
+    const char *key;
+    int type;
+};
+
+struct carousel_move_t {
+    int slide;                  // Desired index of the panel to move
+    int to;                     // Flex index to move it to (lv_obj_move_to_index)
+};
+
+struct carousel_diff_t {
+    std::vector<int> source;                // Per desired slide: old index reused, -1 to create
+    std::vector<int> removed;               // Old indices whose panel is deleted
+    std::vector<carousel_move_t> moves;     // Applied in order, after deletes and creates
+    int current;                            // Desired index to show
+};
+
+/**
+ * Diff old slides against desired ones
+ *
+ * Panels are assumed to be laid out in old order; removed panels are deleted
+ * first and new panels are appended in desired order. The panels that already
+ * are in the right relative order (longest increasing run) stay put, every
+ * other one is moved once, which is the fewest moves possible.
+ *
+ * @param current: Index of the slide on screen; its key is followed to its new
+ *                 position (0 if it went away, same index if it has no key)
+ */
+static inline carousel_diff_t carousel_diff(const std::vector<carousel_key_t> &old_keys,
+                                            const std::vector<carousel_key_t> &new_keys,
+                                            int current)
+{
+    const int old_n = (int)old_keys.size();
+    const int new_n = (int)new_keys.size();
+    carousel_diff_t diff;
+    diff.source.assign(new_n, -1);
+    diff.current = 0;
+
+    std::vector<int> reused_by(old_n, -1);
+    for (int i = 0; i < new_n; i++) {
+        const carousel_key_t &want = new_keys[i];
+        if (!want.key || !want.key[0]) continue;
+        for (int j = 0; j < old_n; j++) {
+            if (reused_by[j] < 0 && old_keys[j].key && old_keys[j].type == want.type &&
+                strcmp(old_keys[j].key, want.key) == 0) {
+                reused_by[j] = i;
+                diff.source[i] = j;
+                break;
+            }
+        }
+    }
+    for (int j = 0; j < old_n; j++) {
+        if (reused_by[j] < 0) diff.removed.push_back(j);
+    }
+
+    // Flex order after deletes and appends, as desired indices
+    std::vector<int> order;
+    for (int j = 0; j < old_n; j++) {
+        if (reused_by[j] >= 0) order.push_back(reused_by[j]);
+    }
+    for (int i = 0; i < new_n; i++) {
+        if (diff.source[i] < 0) order.push_back(i);
+    }
+
+    // Longest run of panels already in desired order stays; n is at most 10
+    std::vector<int> pos(new_n);
+    for (int p = 0; p < new_n; p++) pos[order[p]] = p;
+    std::vector<int> len(new_n, 1), prev(new_n, -1);
+    int best = -1;
+    for (int i = 0; i < new_n; i++) {
+        for (int k = 0; k < i; k++) {
+            if (pos[k] < pos[i] && len[k] + 1 > len[i]) {
+                len[i] = len[k] + 1;
+                prev[i] = k;
+            }
+        }
+        if (best < 0 || len[i] > len[best]) best = i;
+    }
+    std::vector<bool> placed(new_n, false);
+    for (int i = best; i >= 0; i = prev[i]) placed[i] = true;
+
+    // Move the rest, left to right, in behind the last placed panel before them
+    for (int i = 0; i < new_n; i++) {
+        if (placed[i]) continue;
+        for (size_t p = 0; p < order.size(); p++) {
+            if (order[p] == i) {
+                order.erase(order.begin() + p);
+                break;
+            }
+        }
+        int to = 0;
+        for (int p = (int)order.size() - 1; p >= 0; p--) {
+            if (placed[order[p]] && order[p] < i) {
+                to = p + 1;
+                break;
+            }
+        }
+        order.insert(order.begin() + to, i);
+        placed[i] = true;
+        diff.moves.push_back({i, to});
+    }
+
+    if (current >= 0 && current < old_n && old_keys[current].key && old_keys[current].key[0]) {
+        for (int i = 0; i < new_n; i++) {
+            if (new_keys[i].key && strcmp(new_keys[i].key, old_keys[current].key) == 0) {
+                diff.current = i;
+                break;
+            }
+        }
+    } else if (current >= 0 && current < new_n) {
+        diff.current = current;
+    }
+    return diff;
+}
+
+#endif // CAROUSEL_DIFF_HPP
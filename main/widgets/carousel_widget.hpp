@@ -9,51 +9,24 @@
 #include "lvgl/lvgl.h"
 #include <vector>
 #include <string>
+#include <string.h>
 #include "esp_log.h"
 #include "i18n/lang.hpp"  // Internationalization support
 #include "SettingsConfig.hpp"  // For theme settings
+#include "helper_theme.hpp"    // Cached theme palette
 #include "../apps/weather/weathericons.h"  // Weather icon font codes
+#include "carousel_diff.hpp"   // Keyed slide diff (host tested)
+#include <algorithm>
 
 // External reference to settings config
 extern SettingsConfig *cfg;
 
-// Theme-aware color helpers for carousel backgrounds
-// Dark theme: dark grays (0x1e1e1e, 0x2a2a2a)
-// Light theme: light grays (0xe0e0e0, 0xd0d0d0)
-static inline lv_color_t carousel_get_container_bg() {
-    if (cfg && cfg->CurrentTheme == "light") {
-        return lv_color_hex(0xe0e0e0);  // Light gray for light theme
-    }
-    return lv_color_hex(0x1e1e1e);  // Dark gray for dark theme
-}
-
-static inline lv_color_t carousel_get_indicator_bg() {
-    if (cfg && cfg->CurrentTheme == "light") {
-        return lv_color_hex(0xd0d0d0);  // Slightly darker light gray
-    }
-    return lv_color_hex(0x2a2a2a);  // Slightly lighter dark gray
-}
-
-static inline lv_color_t carousel_get_default_slide_bg() {
-    if (cfg && cfg->CurrentTheme == "light") {
-        return lv_color_hex(0xd0d0d0);  // Light theme slide background
-    }
-    return lv_color_hex(0x2a2a2a);  // Dark theme slide background
-}
-
-static inline lv_color_t carousel_get_text_color() {
-    if (cfg && cfg->CurrentTheme == "light") {
-        return lv_color_hex(0x333333);  // Dark text for light theme
-    }
-    return lv_color_white();  // White text for dark theme
-}
-
-static inline lv_color_t carousel_get_subtitle_color() {
-    if (cfg && cfg->CurrentTheme == "light") {
-        return lv_color_hex(0x666666);  // Medium gray for light theme
-    }
-    return lv_color_hex(0xaaaaaa);  // Light gray for dark theme
-}
+// Theme-aware color helpers for carousel backgrounds (cached palette, see helper_theme.hpp)
+static inline lv_color_t carousel_get_container_bg() { return ui_palette_get().container_bg; }
+static inline lv_color_t carousel_get_indicator_bg() { return ui_palette_get().indicator_bg; }
+static inline lv_color_t carousel_get_default_slide_bg() { return ui_palette_get().slide_bg; }
+static inline lv_color_t carousel_get_text_color() { return ui_palette_get().text; }
+static inline lv_color_t carousel_get_subtitle_color() { return ui_palette_get().subtitle; }
 
 // Font declarations
 LV_FONT_DECLARE(font_fa_weather_42)
@@ -69,6 +42,130 @@ LV_FONT_DECLARE(font_fa_printer_24)
 #define ICON_PRINTER_THERMOMETER  "\xEF\x8B\x89"      // f2c9 - Thermometer Half
 #define ICON_PRINTER_FIRE         "\xEF\x81\xAD"      // f06d - Fire (Heating/Bed)
 
+// Shared carousel styles. Every slide panel and label references these instead of
+// carrying its own local styles, so LVGL heap use no longer scales with
+// slides x labels and a theme switch only touches the theme-dependent styles.
+#define CAROUSEL_WEATHER_BG  0x1e3a5f  // Blue weather theme
+#define CAROUSEL_PRINTER_BG  0x3a1e2f  // Purple printer theme
+
+static bool carousel_styles_ready = false;
+static lv_style_t style_carousel_container;   // Container + scroll container background (theme)
+static lv_style_t style_carousel_indicator;   // Page indicator background (theme)
+static lv_style_t style_carousel_dot;         // Inactive page dot
+static lv_style_t style_carousel_dot_active;  // Current page dot
+static lv_style_t style_carousel_panel;       // Common slide panel layout
+static lv_style_t style_carousel_panel_weather;
+static lv_style_t style_carousel_panel_printer;
+static lv_style_t style_carousel_panel_default;  // Placeholder/other slides (theme)
+static lv_style_t style_carousel_title;
+static lv_style_t style_carousel_subtitle;
+static lv_style_t style_carousel_value_weather;  // Large temperature
+static lv_style_t style_carousel_value_printer;  // Large progress
+static lv_style_t style_carousel_text;           // Description / nozzle temp
+static lv_style_t style_carousel_info;           // Bed/layer, temp range, wind
+static lv_style_t style_carousel_muted;          // File name
+static lv_style_t style_carousel_icon_weather;   // Weather icon, day
+static lv_style_t style_carousel_icon_night;     // Weather icon, night
+static lv_style_t style_carousel_icon_nozzle;
+static lv_style_t style_carousel_icon_bed;
+static lv_style_t style_carousel_status_idle;
+static lv_style_t style_carousel_status_running;
+static lv_style_t style_carousel_status_paused;
+static lv_style_t style_carousel_status_error;
+static lv_style_t style_carousel_status_finished;
+
+static inline void carousel_text_style(lv_style_t *style, const lv_font_t *font, lv_color_t color)
+{
+    lv_style_init(style);
+    if (font) lv_style_set_text_font(style, font);
+    lv_style_set_text_color(style, color);
+}
+
+// Theme-dependent colors only; called on init and by switch_theme(), whose
+// global style refresh then updates every object using these styles
+static void carousel_styles_apply_theme()
+{
+    lv_style_set_bg_color(&style_carousel_container, carousel_get_container_bg());
+    lv_style_set_bg_color(&style_carousel_indicator, carousel_get_indicator_bg());
+    lv_style_set_bg_color(&style_carousel_panel_default, carousel_get_default_slide_bg());
+}
+
+static void carousel_styles_init()
+{
+    if (carousel_styles_ready) return;
+    
+    lv_style_init(&style_carousel_container);
+    lv_style_set_bg_opa(&style_carousel_container, LV_OPA_COVER);
+    lv_style_init(&style_carousel_indicator);
+    lv_style_init(&style_carousel_panel_default);
+    carousel_styles_apply_theme();
+    
+    lv_style_init(&style_carousel_dot);
+    lv_style_set_radius(&style_carousel_dot, 6);  // Make it circular
+    lv_style_set_border_width(&style_carousel_dot, 0);
+    lv_style_set_bg_color(&style_carousel_dot, lv_color_hex(0x666666));  // Gray
+    lv_style_init(&style_carousel_dot_active);
+    lv_style_set_bg_color(&style_carousel_dot_active, lv_color_hex(0xffa500));  // Orange
+    
+    lv_style_init(&style_carousel_panel);
+    lv_style_set_border_width(&style_carousel_panel, 0);
+    lv_style_set_radius(&style_carousel_panel, 0);  // No rounded corners
+    lv_style_set_pad_all(&style_carousel_panel, 0);  // No padding - position content explicitly
+    lv_style_init(&style_carousel_panel_weather);
+    lv_style_set_bg_color(&style_carousel_panel_weather, lv_color_hex(CAROUSEL_WEATHER_BG));
+    lv_style_init(&style_carousel_panel_printer);
+    lv_style_set_bg_color(&style_carousel_panel_printer, lv_color_hex(CAROUSEL_PRINTER_BG));
+    
+    carousel_text_style(&style_carousel_title, &font_ui_24, lv_color_white());
+    carousel_text_style(&style_carousel_subtitle, &font_ui_16, lv_color_hex(0xaaaaaa));
+    carousel_text_style(&style_carousel_value_weather, &font_ui_32, lv_color_hex(0xffa500));
+    carousel_text_style(&style_carousel_value_printer, &font_ui_32, lv_color_hex(0x00cc00));  // Green for progress
+    carousel_text_style(&style_carousel_text, &font_ui_16, lv_color_hex(0xcccccc));
+    carousel_text_style(&style_carousel_info, &font_ui_16, lv_color_hex(0x88ccff));
+    carousel_text_style(&style_carousel_muted, &font_ui_16, lv_color_hex(0x888888));
+    carousel_text_style(&style_carousel_icon_weather, &font_fa_weather_42, lv_color_make(241, 235, 156));  // Warm yellow
+    carousel_text_style(&style_carousel_icon_night, &font_fa_weather_42, lv_palette_main(LV_PALETTE_BLUE_GREY));
+    carousel_text_style(&style_carousel_icon_nozzle, &font_fa_printer_42, lv_color_hex(0xff6600));  // Orange
+    carousel_text_style(&style_carousel_icon_bed, &font_fa_printer_42, lv_color_hex(0xff3300));  // Red-orange
+    
+    // Status icon variants, swapped as the printer state changes
+    carousel_text_style(&style_carousel_status_idle, &font_fa_printer_42, lv_color_hex(0x888888));  // Gray
+    carousel_text_style(&style_carousel_status_running, &font_fa_printer_42, lv_color_hex(0x00cc00));  // Green
+    carousel_text_style(&style_carousel_status_paused, &font_fa_printer_42, lv_color_hex(0xffaa00));  // Amber
+    carousel_text_style(&style_carousel_status_error, &font_fa_printer_42, lv_color_hex(0xff3333));  // Red
+    carousel_text_style(&style_carousel_status_finished, &font_fa_printer_42, lv_color_hex(0x00aaff));  // Blue
+    
+    carousel_styles_ready = true;
+}
+
+// Swap one shared style for another on an object (used for state-colored icons)
+static inline void carousel_swap_style(lv_obj_t *obj, lv_style_t *from, lv_style_t *to)
+{
+    if (from == to) return;
+    if (from) lv_obj_remove_style(obj, from, 0);
+    lv_obj_add_style(obj, to, 0);
+}
+
+// Log LVGL heap usage so style/allocation changes can be compared on-device
+static inline void carousel_log_lv_mem(const char *what)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    ESP_LOGI("CarouselWidget", "%s: LVGL mem used %lu bytes (%d%%), frag %d%%, max used %lu",
+             what, (unsigned long)(mon.total_size - mon.free_size), mon.used_pct, mon.frag_pct,
+             (unsigned long)mon.max_used);
+}
+
+static inline lv_obj_t *carousel_label_create(lv_obj_t *parent, lv_style_t *style, const char *text,
+                                              lv_coord_t x, lv_coord_t y)
+{
+    lv_obj_t *label = lv_label_create(parent);
+    lv_obj_add_style(label, style, 0);
+    lv_label_set_text(label, text);
+    lv_obj_set_pos(label, x, y);
+    return label;
+}
+
 // Slide types
 enum carousel_slide_type_t {
     SLIDE_TYPE_WEATHER = 0,
@@ -76,20 +173,64 @@ enum carousel_slide_type_t {
     SLIDE_TYPE_OTHER = 2
 };
 
-// Slide data structure
+// Fixed-capacity inline text for slide fields. Assigning the same text again is a
+// no-op; assigning different text sets the dirty flag so only changed labels are
+// pushed to LVGL (each lv_label_set_text invalidates and re-lays out the label).
+template <size_t N>
+struct slide_text_t {
+    char buf[N];
+    bool dirty;
+    
+    slide_text_t() : dirty(true) { buf[0] = '\0'; }
+    
+    // Returns true if the text changed
+    bool set(const char *text) {
+        if (!text) text = "";
+        size_t len = strnlen(text, N - 1);
+        // Don't cut a UTF-8 sequence in half when truncating
+        if (len == N - 1 && text[len] != '\0') {
+            while (len > 0 && ((unsigned char)text[len] & 0xC0) == 0x80) len--;
+        }
+        if (buf[len] == '\0' && memcmp(buf, text, len) == 0) {
+            return false;
+        }
+        memcpy(buf, text, len);
+        buf[len] = '\0';
+        dirty = true;
+        return true;
+    }
+    
+    slide_text_t &operator=(const char *text) { set(text); return *this; }
+    slide_text_t &operator=(const std::string &text) { set(text.c_str()); return *this; }
+    bool operator==(const char *text) const { return strcmp(buf, text ? text : "") == 0; }
+    bool operator==(const std::string &text) const { return text == buf; }
+    bool operator==(const slide_text_t &other) const { return strcmp(buf, other.buf) == 0; }
+    bool operator!=(const slide_text_t &other) const { return !(*this == other); }
+    
+    const char *c_str() const { return buf; }
+    bool empty() const { return buf[0] == '\0'; }
+    bool contains(const char *needle) const { return needle && needle[0] && strstr(buf, needle) != nullptr; }
+};
+
+// Slide data structure - no heap allocations, safe to copy around in the diff
 struct carousel_slide_t {
-    std::string title;           // Location name or printer name
-    std::string subtitle;        // Time, city, country or status
-    std::string value1;          // Temperature or progress
-    std::string value2;          // Weather/status description
-    std::string value3;          // Additional info (temp range, humidity, wind)
-    std::string value4;          // Extra info line
+    slide_text_t<48> title;      // Location name or printer name
+    slide_text_t<64> subtitle;   // Time, city, country or status
+    slide_text_t<48> value1;     // Temperature or progress
+    slide_text_t<64> value2;     // Weather/status description
+    slide_text_t<96> value3;     // Additional info (temp range, humidity, wind)
+    slide_text_t<64> value4;     // Extra info line
     lv_color_t bg_color;         // Background color
     uint32_t icon_code;          // Font icon code (if used)
     carousel_slide_type_t type;  // Slide type for icon font selection
     int printer_index;           // BambuMonitor printer index
+    slide_text_t<48> key;        // Stable identity for diffing ("printer:<serial>", "weather:<city>")
     
     carousel_slide_t() : bg_color(carousel_get_default_slide_bg()), icon_code(0), type(SLIDE_TYPE_OTHER), printer_index(-1) {}
+    
+    void clear_dirty() {
+        title.dirty = subtitle.dirty = value1.dirty = value2.dirty = value3.dirty = value4.dirty = false;
+    }
 };
 
 // Carousel callback types
@@ -112,9 +253,13 @@ public:
     lv_obj_t *page_indicator;  // Shows current page (dots)
     lv_obj_t *scroll_container;
     
+    // Label update counters (dirty-checked writes vs. skipped unchanged fields)
+    uint32_t label_writes;
+    uint32_t label_skips;
+    
     CarouselWidget(lv_obj_t *parent, int width, int height)
         : container(nullptr), current_slide(0), on_slide_changed(nullptr), on_touch(nullptr),
-          page_indicator(nullptr), scroll_container(nullptr)
+          page_indicator(nullptr), scroll_container(nullptr), label_writes(0), label_skips(0)
     {
         create_carousel(parent, width, height);
     }
@@ -128,15 +273,18 @@ public:
     void create_carousel(lv_obj_t *parent, int width, int height);
     void add_slide(const carousel_slide_t &slide);
     void update_slides();
+    void sync_slides(const std::vector<carousel_slide_t> &desired_in);  // Keyed diff, keeps panels alive
+    int find_slide(const char *key);
     void update_slide_labels(int index);
     void show_slide(int index);
     void next_slide();
     void prev_slide();
     int get_current_slide() { return current_slide; }
     int get_slide_count() { return slides.size(); }
-    void update_theme_colors();  // Update colors when theme changes
+    void set_weather_icon(int index, const char *icon, bool daytime);
     
 private:
+    lv_obj_t *create_slide_panel(const carousel_slide_t &slide);
     void create_page_indicator();
     void update_page_indicator();
     static void scroll_event_cb(lv_event_t *e);
@@ -149,16 +297,16 @@ private:
 void CarouselWidget::create_carousel(lv_obj_t *parent, int width, int height)
 {
     ESP_LOGW("CarouselWidget", "Creating carousel: width=%d, height=%d", width, height);
+    carousel_styles_init();
     
     // Main carousel container
     container = lv_obj_create(parent);
     lv_obj_clear_flag(container, LV_OBJ_FLAG_SCROLLABLE);
     lv_obj_set_size(container, width, height);
     // Don't set position here - it will be set after creation in gui.hpp
-    lv_obj_set_style_bg_color(container, carousel_get_container_bg(), 0);
+    lv_obj_add_style(container, &style_carousel_container, 0);  // Opaque, theme background
     lv_obj_set_style_border_width(container, 0, 0);
     lv_obj_set_style_pad_all(container, 0, 0);
-    lv_obj_set_style_bg_opa(container, LV_OPA_COVER, 0);  // Ensure container is visible
     
     ESP_LOGW("CarouselWidget", "Container created at position: x=%d, y=%d, size: %dx%d", 
              lv_obj_get_x(container), lv_obj_get_y(container),
@@ -169,7 +317,7 @@ void CarouselWidget::create_carousel(lv_obj_t *parent, int width, int height)
     lv_obj_set_size(scroll_container, width, height - 50);  // Use passed width, not queried size
     lv_obj_set_pos(scroll_container, 0, 0);
     lv_obj_set_scroll_dir(scroll_container, LV_DIR_HOR);
-    lv_obj_set_style_bg_color(scroll_container, carousel_get_container_bg(), 0);  // Match container bg
+    lv_obj_add_style(scroll_container, &style_carousel_container, 0);  // Match container bg
     lv_obj_set_style_border_width(scroll_container, 0, 0);
     lv_obj_set_style_radius(scroll_container, 0, 0);  // No rounded corners
     lv_obj_set_style_pad_all(scroll_container, 0, 0);
@@ -178,7 +326,6 @@ void CarouselWidget::create_carousel(lv_obj_t *parent, int width, int height)
     lv_obj_set_style_pad_column(scroll_container, 0, 0);  // No column gap
     lv_obj_set_scrollbar_mode(scroll_container, LV_SCROLLBAR_MODE_OFF);
     lv_obj_set_scroll_snap_x(scroll_container, LV_SCROLL_SNAP_START);  // Snap to start for clean alignment
-    lv_obj_set_style_bg_opa(scroll_container, LV_OPA_COVER, 0);  // Ensure scroll container is visible
     lv_obj_clear_flag(scroll_container, LV_OBJ_FLAG_SCROLL_ELASTIC);  // Disable elastic scroll
     
     // Save dimensions for later use
@@ -195,7 +342,7 @@ void CarouselWidget::create_carousel(lv_obj_t *parent, int width, int height)
     page_indicator = lv_obj_create(container);
     lv_obj_set_size(page_indicator, width, 40);
     lv_obj_set_pos(page_indicator, 0, height - 40);
-    lv_obj_set_style_bg_color(page_indicator, carousel_get_indicator_bg(), 0);
+    lv_obj_add_style(page_indicator, &style_carousel_indicator, 0);
     lv_obj_set_style_border_width(page_indicator, 0, 0);
     lv_obj_set_flex_flow(page_indicator, LV_FLEX_FLOW_ROW);
     lv_obj_set_flex_align(page_indicator, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
@@ -229,46 +376,10 @@ void CarouselWidget::add_slide(const carousel_slide_t &slide)
     slides.push_back(slide);
     ESP_LOGW("CarouselWidget", "Adding slide %d: %s", slides.size(), slide.title.c_str());
     
-    // Create slide panel
-    lv_obj_t *slide_panel = lv_obj_create(scroll_container);
-    int panel_width = lv_obj_get_width(scroll_container);
-    int panel_height = lv_obj_get_height(scroll_container);
-    lv_obj_set_size(slide_panel, panel_width, panel_height);
-    lv_obj_set_style_bg_color(slide_panel, slide.bg_color, 0);
-    lv_obj_set_style_border_width(slide_panel, 0, 0);
-    lv_obj_set_style_pad_all(slide_panel, 20, 0);
-    lv_obj_set_flex_grow(slide_panel, 0);  // Don't grow, keep exact size
-    
-    // Title
-    lv_obj_t *title = lv_label_create(slide_panel);
-    lv_label_set_text(title, slide.title.c_str());
-    lv_obj_set_style_text_font(title, &font_montserrat_int_24, 0);
-    lv_obj_set_style_text_color(title, lv_color_white(), 0);
-    lv_obj_set_pos(title, 20, 20);
-    
-    // Subtitle
-    lv_obj_t *subtitle = lv_label_create(slide_panel);
-    lv_label_set_text(subtitle, slide.subtitle.c_str());
-    lv_obj_set_style_text_font(subtitle, &font_montserrat_int_16, 0);
-    lv_obj_set_style_text_color(subtitle, lv_color_hex(0xaaaaaa), 0);
-    lv_obj_set_pos(subtitle, 20, 50);
-    
-    // Main value (temperature, progress, etc.)
-    lv_obj_t *value1 = lv_label_create(slide_panel);
-    lv_label_set_text(value1, slide.value1.c_str());
-    lv_obj_set_style_text_font(value1, &font_montserrat_int_32, 0);
-    lv_obj_set_style_text_color(value1, lv_color_hex(0xffa500), 0);
-    lv_obj_align(value1, LV_ALIGN_CENTER, 0, -30);
-    
-    // Secondary value (description)
-    lv_obj_t *value2 = lv_label_create(slide_panel);
-    lv_label_set_text(value2, slide.value2.c_str());
-    lv_obj_set_style_text_font(value2, &font_montserrat_int_16, 0);
-    lv_obj_set_style_text_color(value2, lv_color_hex(0xcccccc), 0);
-    lv_obj_align(value2, LV_ALIGN_CENTER, 0, 40);
-    
+    lv_obj_t *slide_panel = create_slide_panel(slides.back());
+    slides.back().clear_dirty();
     slide_panels.push_back(slide_panel);
-    slide_labels.push_back(title);
+    slide_labels.push_back(lv_obj_get_child(slide_panel, 0));  // title
     
     update_page_indicator();
 }
@@ -286,139 +397,9 @@ void CarouselWidget::update_slides()
     
     // Recreate visual panels from slides data
     for (size_t i = 0; i < slides.size(); i++) {
-        const auto &slide = slides[i];
-        ESP_LOGW("CarouselWidget", "Creating panel %d for: %s (type=%d)", i, slide.title.c_str(), slide.type);
-        
-        // Create slide panel - use saved dimensions, identical for all slide types
-        lv_obj_t *slide_panel = lv_obj_create(scroll_container);
-        lv_obj_set_size(slide_panel, width, height - 50);  // Use saved dimensions
-        lv_obj_set_style_bg_color(slide_panel, slide.bg_color, 0);
-        lv_obj_set_style_border_width(slide_panel, 0, 0);
-        lv_obj_set_style_radius(slide_panel, 0, 0);  // No rounded corners
-        lv_obj_set_style_pad_all(slide_panel, 0, 0);  // No padding - position content explicitly
-        lv_obj_set_flex_grow(slide_panel, 0);  // Don't grow, keep exact size
-        lv_obj_clear_flag(slide_panel, LV_OBJ_FLAG_SCROLLABLE);  // Slide panels don't scroll
-        
-        if (slide.type == SLIDE_TYPE_PRINTER) {
-            // ============ PRINTER SLIDE LAYOUT ============
-            // Child order: 0=title, 1=subtitle, 2=value1(progress), 3=nozzle_icon, 4=value2(nozzle temp),
-            //              5=bed_icon, 6=value3(bed+layer), 7=value4(file), 8=status_icon(top-right)
-            
-            // Child 0: Title (Printer name)
-            lv_obj_t *title = lv_label_create(slide_panel);
-            lv_label_set_text(title, slide.title.c_str());
-            lv_obj_set_style_text_font(title, &font_montserrat_int_24, 0);
-            lv_obj_set_style_text_color(title, lv_color_white(), 0);
-            lv_obj_set_pos(title, 10, 5);
-            
-            // Child 1: Subtitle (State + time remaining)
-            lv_obj_t *subtitle = lv_label_create(slide_panel);
-            lv_label_set_text(subtitle, slide.subtitle.c_str());
-            lv_obj_set_style_text_font(subtitle, &font_montserrat_int_16, 0);
-            lv_obj_set_style_text_color(subtitle, lv_color_hex(0xaaaaaa), 0);
-            lv_obj_set_pos(subtitle, 10, 38);
-            
-            // Child 2: Progress (large)
-            lv_obj_t *value1 = lv_label_create(slide_panel);
-            lv_label_set_text(value1, slide.value1.c_str());
-            lv_obj_set_style_text_font(value1, &font_montserrat_int_32, 0);
-            lv_obj_set_style_text_color(value1, lv_color_hex(0x00cc00), 0);  // Green for progress
-            lv_obj_set_pos(value1, 10, 62);
-            
-            // Child 3: Nozzle icon (tint/droplet - represents melted filament)
-            lv_obj_t *nozzle_icon = lv_label_create(slide_panel);
-            lv_obj_set_style_text_font(nozzle_icon, &font_fa_printer_42, 0);
-            lv_obj_set_style_text_color(nozzle_icon, lv_color_hex(0xff6600), 0);  // Orange
-            lv_label_set_text(nozzle_icon, "\xEF\x81\x83");  // f043 tint (droplet)
-            lv_obj_set_pos(nozzle_icon, 10, 105);
-            
-            // Child 4: Nozzle temperature text (value2)
-            lv_obj_t *value2 = lv_label_create(slide_panel);
-            lv_label_set_text(value2, slide.value2.c_str());
-            lv_obj_set_style_text_font(value2, &font_montserrat_int_16, 0);
-            lv_obj_set_style_text_color(value2, lv_color_hex(0xcccccc), 0);
-            lv_obj_set_pos(value2, 55, 115);
-            
-            // Child 5: Bed icon (thermometer - represents heated bed)
-            lv_obj_t *bed_icon = lv_label_create(slide_panel);
-            lv_obj_set_style_text_font(bed_icon, &font_fa_printer_42, 0);
-            lv_obj_set_style_text_color(bed_icon, lv_color_hex(0xff3300), 0);  // Red-orange
-            lv_label_set_text(bed_icon, "\xEF\x8B\x89");  // f2c9 thermometer
-            lv_obj_set_pos(bed_icon, 200, 105);
-            
-            // Child 6: Bed temp + Layer progress (value3)
-            lv_obj_t *value3 = lv_label_create(slide_panel);
-            lv_label_set_text(value3, slide.value3.empty() ? "" : slide.value3.c_str());
-            lv_obj_set_style_text_font(value3, &font_montserrat_int_16, 0);
-            lv_obj_set_style_text_color(value3, lv_color_hex(0x88ccff), 0);
-            lv_obj_set_pos(value3, 10, 155);
-            
-            // Child 7: File name (value4)
-            lv_obj_t *value4 = lv_label_create(slide_panel);
-            lv_label_set_text(value4, slide.value4.empty() ? "" : slide.value4.c_str());
-            lv_obj_set_style_text_font(value4, &font_montserrat_int_16, 0);
-            lv_obj_set_style_text_color(value4, lv_color_hex(0x888888), 0);
-            lv_obj_set_pos(value4, 10, 180);
-            
-            // Child 8: Main status icon (right side, same position as weather icon)
-            lv_obj_t *status_icon = lv_label_create(slide_panel);
-            lv_obj_set_style_text_font(status_icon, &font_fa_printer_42, 0);
-            lv_obj_set_style_text_color(status_icon, lv_color_hex(0x888888), 0);  // Default gray
-            lv_label_set_text(status_icon, "\xEF\x80\x91");  // f011 power-off (idle)
-            lv_obj_set_pos(status_icon, width - 100, 60);  // Same position as weather icon
-            
-        } else {
-            // ============ WEATHER/DEFAULT SLIDE LAYOUT ============
-            // Title (Location)
-            lv_obj_t *title = lv_label_create(slide_panel);
-            lv_label_set_text(title, slide.title.c_str());
-            lv_obj_set_style_text_font(title, &font_montserrat_int_24, 0);
-            lv_obj_set_style_text_color(title, lv_color_white(), 0);
-            lv_obj_set_pos(title, 10, 10);
-            
-            // Subtitle (Time, Date, Location details)
-            lv_obj_t *subtitle = lv_label_create(slide_panel);
-            lv_label_set_text(subtitle, slide.subtitle.c_str());
-            lv_obj_set_style_text_font(subtitle, &font_montserrat_int_16, 0);
-            lv_obj_set_style_text_color(subtitle, lv_color_hex(0xaaaaaa), 0);
-            lv_obj_set_pos(subtitle, 10, 45);
-            
-            // Main value (Current temperature)
-            lv_obj_t *value1 = lv_label_create(slide_panel);
-            lv_label_set_text(value1, slide.value1.c_str());
-            lv_obj_set_style_text_font(value1, &font_montserrat_int_32, 0);
-            lv_obj_set_style_text_color(value1, lv_color_hex(0xffa500), 0);
-            lv_obj_set_pos(value1, 10, 70);
-            
-            // Secondary value (Weather description)
-            lv_obj_t *value2 = lv_label_create(slide_panel);
-            lv_label_set_text(value2, slide.value2.c_str());
-            lv_obj_set_style_text_font(value2, &font_montserrat_int_16, 0);
-            lv_obj_set_style_text_color(value2, lv_color_hex(0xcccccc), 0);
-            lv_obj_set_pos(value2, 10, 115);
-            
-            // Value 3 (Temp range, humidity)
-            lv_obj_t *value3 = lv_label_create(slide_panel);
-            lv_label_set_text(value3, slide.value3.empty() ? "" : slide.value3.c_str());
-            lv_obj_set_style_text_font(value3, &font_montserrat_int_16, 0);
-            lv_obj_set_style_text_color(value3, lv_color_hex(0x88ccff), 0);
-            lv_obj_set_pos(value3, 10, 145);
-            
-            // Value 4 (Wind, pressure)
-            lv_obj_t *value4 = lv_label_create(slide_panel);
-            lv_label_set_text(value4, slide.value4.empty() ? "" : slide.value4.c_str());
-            lv_obj_set_style_text_font(value4, &font_montserrat_int_16, 0);
-            lv_obj_set_style_text_color(value4, lv_color_hex(0x88ccff), 0);
-            lv_obj_set_pos(value4, 10, 175);
-            
-            // Weather icon (child 6) - positioned on the right side
-            lv_obj_t *icon = lv_label_create(slide_panel);
-            lv_label_set_text(icon, FA_WEATHER_CLOUD);  // Default cloud icon until weather updates
-            lv_obj_set_style_text_font(icon, &font_fa_weather_42, 0);
-            lv_obj_set_style_text_color(icon, lv_color_make(241, 235, 156), 0);  // Warm yellow
-            lv_obj_set_pos(icon, width - 100, 60);  // Position on right side
-        }
-        
+        ESP_LOGW("CarouselWidget", "Creating panel %d for: %s (type=%d)", i, slides[i].title.c_str(), slides[i].type);
+        lv_obj_t *slide_panel = create_slide_panel(slides[i]);
+        slides[i].clear_dirty();  // Panel was created with the current text
         slide_panels.push_back(slide_panel);
         slide_labels.push_back(lv_obj_get_child(slide_panel, 0));  // title
     }
@@ -427,11 +408,184 @@ void CarouselWidget::update_slides()
     update_page_indicator();
     
     ESP_LOGW("CarouselWidget", "update_slides() complete, %d panels created", slide_panels.size());
+    carousel_log_lv_mem("update_slides()");
+}
+
+lv_obj_t *CarouselWidget::create_slide_panel(const carousel_slide_t &slide)
+{
+    // Create slide panel - use saved dimensions, identical for all slide types
+    lv_obj_t *slide_panel = lv_obj_create(scroll_container);
+    lv_obj_set_size(slide_panel, width, height - 50);  // Use saved dimensions
+    lv_obj_add_style(slide_panel, &style_carousel_panel, 0);
+    lv_obj_set_flex_grow(slide_panel, 0);  // Don't grow, keep exact size
+    lv_obj_clear_flag(slide_panel, LV_OBJ_FLAG_SCROLLABLE);  // Slide panels don't scroll
+    
+    if (slide.type == SLIDE_TYPE_PRINTER) {
+        lv_obj_add_style(slide_panel, &style_carousel_panel_printer, 0);
+        if (slide.bg_color.full != lv_color_hex(CAROUSEL_PRINTER_BG).full) {
+            lv_obj_set_style_bg_color(slide_panel, slide.bg_color, 0);  // Custom color only
+        }
+        
+        // ============ PRINTER SLIDE LAYOUT ============
+        // Child order: 0=title, 1=subtitle, 2=value1(progress), 3=nozzle_icon, 4=value2(nozzle temp),
+        //              5=bed_icon, 6=value3(bed+layer), 7=value4(file), 8=status_icon(top-right)
+        carousel_label_create(slide_panel, &style_carousel_title, slide.title.c_str(), 10, 5);
+        carousel_label_create(slide_panel, &style_carousel_subtitle, slide.subtitle.c_str(), 10, 38);
+        carousel_label_create(slide_panel, &style_carousel_value_printer, slide.value1.c_str(), 10, 62);
+        carousel_label_create(slide_panel, &style_carousel_icon_nozzle, "\xEF\x81\x83", 10, 105);  // f043 tint (droplet)
+        carousel_label_create(slide_panel, &style_carousel_text, slide.value2.c_str(), 55, 115);
+        carousel_label_create(slide_panel, &style_carousel_icon_bed, "\xEF\x8B\x89", 200, 105);  // f2c9 thermometer
+        carousel_label_create(slide_panel, &style_carousel_info, slide.value3.c_str(), 10, 155);
+        carousel_label_create(slide_panel, &style_carousel_muted, slide.value4.c_str(), 10, 180);
+        // Main status icon (right side, same position as weather icon)
+        carousel_label_create(slide_panel, &style_carousel_status_idle, "\xEF\x80\x91", width - 100, 60);  // f011 power-off (idle)
+        
+    } else {
+        if (slide.type == SLIDE_TYPE_WEATHER) {
+            lv_obj_add_style(slide_panel, &style_carousel_panel_weather, 0);
+            if (slide.bg_color.full != lv_color_hex(CAROUSEL_WEATHER_BG).full) {
+                lv_obj_set_style_bg_color(slide_panel, slide.bg_color, 0);  // Custom color only
+            }
+        } else {
+            lv_obj_add_style(slide_panel, &style_carousel_panel_default, 0);  // Follows theme
+        }
+        
+        // ============ WEATHER/DEFAULT SLIDE LAYOUT ============
+        // Child order: 0=title, 1=subtitle, 2=value1(temp), 3=value2(description),
+        //              4=value3(range, humidity), 5=value4(wind, pressure), 6=icon
+        carousel_label_create(slide_panel, &style_carousel_title, slide.title.c_str(), 10, 10);
+        carousel_label_create(slide_panel, &style_carousel_subtitle, slide.subtitle.c_str(), 10, 45);
+        carousel_label_create(slide_panel, &style_carousel_value_weather, slide.value1.c_str(), 10, 70);
+        carousel_label_create(slide_panel, &style_carousel_text, slide.value2.c_str(), 10, 115);
+        carousel_label_create(slide_panel, &style_carousel_info, slide.value3.c_str(), 10, 145);
+        carousel_label_create(slide_panel, &style_carousel_info, slide.value4.c_str(), 10, 175);
+        // Default cloud icon until weather updates
+        carousel_label_create(slide_panel, &style_carousel_icon_weather, FA_WEATHER_CLOUD, width - 100, 60);
+    }
+    
+    return slide_panel;
+}
+
+void CarouselWidget::set_weather_icon(int index, const char *icon, bool daytime)
+{
+    if (index < 0 || index >= (int)slide_panels.size()) return;
+    lv_obj_t *panel = slide_panels[index];
+    if (!panel || lv_obj_get_child_cnt(panel) < 7) return;
+    
+    lv_obj_t *icon_lbl = lv_obj_get_child(panel, 6);
+    if (strcmp(lv_label_get_text(icon_lbl), icon) != 0) {
+        lv_label_set_text(icon_lbl, icon);
+    }
+    if (daytime) {
+        carousel_swap_style(icon_lbl, &style_carousel_icon_night, &style_carousel_icon_weather);
+    } else {
+        carousel_swap_style(icon_lbl, &style_carousel_icon_weather, &style_carousel_icon_night);
+    }
+}
+
+void CarouselWidget::sync_slides(const std::vector<carousel_slide_t> &desired_in)
+{
+    // Keyed diff between the current slides and the desired list (carousel_diff.hpp).
+    // Panels whose key survives are reused (keeping their live data), only new keys
+    // get a panel and only vanished keys get deleted. Keyless slides never match.
+    std::vector<carousel_slide_t> desired(desired_in.begin(),
+                                          desired_in.begin() + std::min<size_t>(desired_in.size(), 10));  // Same limit as add_slide()
+    
+    std::vector<carousel_key_t> old_keys, new_keys;
+    for (size_t j = 0; j < slides.size() && j < slide_panels.size(); j++) {
+        old_keys.push_back({slides[j].key.c_str(), (int)slides[j].type});
+    }
+    for (const auto &want : desired) {
+        new_keys.push_back({want.key.c_str(), (int)want.type});
+    }
+    carousel_diff_t diff = carousel_diff(old_keys, new_keys, current_slide);
+    
+    for (int j : diff.removed) {
+        lv_obj_del(slide_panels[j]);
+    }
+    
+    std::vector<carousel_slide_t> new_slides;
+    std::vector<lv_obj_t*> new_panels;
+    int created = 0;
+    for (size_t i = 0; i < desired.size(); i++) {
+        const carousel_slide_t &want = desired[i];
+        int old_idx = diff.source[i];
+        if (old_idx >= 0) {
+            carousel_slide_t kept = slides[old_idx];
+            lv_obj_t *panel = slide_panels[old_idx];
+            if (kept.title != want.title) {
+                // Renamed in config - only the title label changes
+                kept.title = want.title;
+                lv_label_set_text(lv_obj_get_child(panel, 0), kept.title.c_str());
+                kept.title.dirty = false;
+            }
+            kept.printer_index = want.printer_index;
+            new_slides.push_back(kept);
+            new_panels.push_back(panel);
+        } else {
+            // Appended to the flex container, in desired order
+            new_slides.push_back(want);
+            new_panels.push_back(create_slide_panel(want));
+            new_slides.back().clear_dirty();
+            created++;
+        }
+    }
+    
+    for (const carousel_move_t &move : diff.moves) {
+        lv_obj_move_to_index(new_panels[move.slide], move.to);
+    }
+    
+    slides = std::move(new_slides);
+    slide_panels = std::move(new_panels);
+    slide_labels.clear();
+    for (auto panel : slide_panels) {
+        slide_labels.push_back(lv_obj_get_child(panel, 0));  // title
+    }
+    
+    int removed = (int)diff.removed.size();
+    int moved = (int)diff.moves.size();
+    if (created || removed || moved || diff.current != current_slide) {
+        current_slide = diff.current;
+        lv_obj_update_layout(scroll_container);
+        lv_obj_scroll_to_x(scroll_container, current_slide * lv_obj_get_width(scroll_container), LV_ANIM_OFF);
+        update_page_indicator();
+    }
+    
+    ESP_LOGI("CarouselWidget", "sync_slides(): %d slides, %d created, %d removed, %d moved, current=%d",
+             (int)slides.size(), created, removed, moved, current_slide);
+    if (created || removed) {
+        carousel_log_lv_mem("sync_slides()");
+    }
+}
+
+int CarouselWidget::find_slide(const char *key)
+{
+    for (size_t i = 0; i < slides.size(); i++) {
+        if (slides[i].key == key) return i;
+    }
+    return -1;
+}
+
+// Push a field to its label only when the text changed since the last push
+template <size_t N>
+static inline void carousel_apply_text(lv_obj_t *panel, uint32_t child, slide_text_t<N> &field,
+                                       uint32_t &writes, uint32_t &skips)
+{
+    if (!field.dirty) {
+        skips++;
+        return;
+    }
+    if (child < lv_obj_get_child_cnt(panel)) {
+        lv_label_set_text(lv_obj_get_child(panel, child), field.c_str());
+        writes++;
+    }
+    field.dirty = false;
 }
 
 void CarouselWidget::update_slide_labels(int index)
 {
-    // Update the text labels of a specific slide with current data from slides vector
+    // Update the text labels of a specific slide with current data from slides vector.
+    // Only fields whose text changed are written, so unchanged labels are not invalidated.
     if (index < 0 || index >= (int)slides.size() || index >= (int)slide_panels.size()) {
         return;
     }
@@ -439,101 +593,77 @@ void CarouselWidget::update_slide_labels(int index)
     lv_obj_t *panel = slide_panels[index];
     if (!panel) return;
     
-    const auto &slide = slides[index];
+    auto &slide = slides[index];
     uint32_t child_count = lv_obj_get_child_cnt(panel);
     
     if (slide.type == SLIDE_TYPE_PRINTER) {
         // Printer layout child indices (9 children):
         // 0=title, 1=subtitle, 2=value1(progress), 3=nozzle_icon, 4=value2(nozzle temp),
         // 5=bed_icon, 6=value3(bed+layer), 7=value4(file), 8=status_icon(top-right)
+        bool state_changed = slide.subtitle.dirty;
         
-        if (child_count >= 1) {
-            lv_obj_t *title = lv_obj_get_child(panel, 0);
-            lv_label_set_text(title, slide.title.c_str());
-        }
-        if (child_count >= 2) {
-            lv_obj_t *subtitle = lv_obj_get_child(panel, 1);
-            lv_label_set_text(subtitle, slide.subtitle.c_str());
-        }
-        if (child_count >= 3) {
-            lv_obj_t *value1 = lv_obj_get_child(panel, 2);
-            lv_label_set_text(value1, slide.value1.c_str());
-        }
+        carousel_apply_text(panel, 0, slide.title, label_writes, label_skips);
+        carousel_apply_text(panel, 1, slide.subtitle, label_writes, label_skips);
+        carousel_apply_text(panel, 2, slide.value1, label_writes, label_skips);
         // Child 3 is nozzle_icon - no text update needed
-        if (child_count >= 5) {
-            lv_obj_t *value2 = lv_obj_get_child(panel, 4);
-            lv_label_set_text(value2, slide.value2.c_str());
-        }
+        carousel_apply_text(panel, 4, slide.value2, label_writes, label_skips);
         // Child 5 is bed_icon - no text update needed
-        if (child_count >= 7) {
-            lv_obj_t *value3 = lv_obj_get_child(panel, 6);
-            lv_label_set_text(value3, slide.value3.c_str());
-        }
-        if (child_count >= 8) {
-            lv_obj_t *value4 = lv_obj_get_child(panel, 7);
-            lv_label_set_text(value4, slide.value4.c_str());
-        }
-        // Child 8 is status_icon - update based on state in subtitle
-        if (child_count >= 9) {
+        carousel_apply_text(panel, 6, slide.value3, label_writes, label_skips);
+        carousel_apply_text(panel, 7, slide.value4, label_writes, label_skips);
+        
+        // Child 8 is status_icon - derived from the state in subtitle, so only when that changed
+        if (state_changed && child_count >= 9) {
             lv_obj_t *status_icon = lv_obj_get_child(panel, 8);
             // Set icon and color based on state in subtitle (check all language translations)
-            bool is_running = (slide.subtitle.find(TR(STR_RUNNING)) != std::string::npos ||
-                              slide.subtitle.find(TR(STR_PRINTING)) != std::string::npos ||
-                              slide.subtitle.find("RUNNING") != std::string::npos ||
-                              slide.subtitle.find("PRINTING") != std::string::npos);
-            bool is_paused = (slide.subtitle.find(TR(STR_PAUSED)) != std::string::npos ||
-                             slide.subtitle.find("PAUSE") != std::string::npos);
-            bool is_error = (slide.subtitle.find(TR(STR_ERROR)) != std::string::npos ||
-                            slide.subtitle.find(TR(STR_FAILED)) != std::string::npos ||
-                            slide.subtitle.find("ERROR") != std::string::npos ||
-                            slide.subtitle.find("FAILED") != std::string::npos);
-            bool is_finished = (slide.subtitle.find(TR(STR_FINISHED)) != std::string::npos ||
-                               slide.subtitle.find("FINISH") != std::string::npos);
+            bool is_running = (slide.subtitle.contains(TR(STR_RUNNING)) ||
+                              slide.subtitle.contains(TR(STR_PRINTING)) ||
+                              slide.subtitle.contains("RUNNING") ||
+                              slide.subtitle.contains("PRINTING"));
+            bool is_paused = (slide.subtitle.contains(TR(STR_PAUSED)) ||
+                             slide.subtitle.contains("PAUSE"));
+            bool is_error = (slide.subtitle.contains(TR(STR_ERROR)) ||
+                            slide.subtitle.contains(TR(STR_FAILED)) ||
+                            slide.subtitle.contains("ERROR") ||
+                            slide.subtitle.contains("FAILED"));
+            bool is_finished = (slide.subtitle.contains(TR(STR_FINISHED)) ||
+                               slide.subtitle.contains("FINISH"));
             
+            const char *icon = "\xEF\x80\x91";  // f011 power-off (idle)
+            lv_style_t *style = &style_carousel_status_idle;
             if (is_running) {
-                lv_label_set_text(status_icon, "\xEF\x80\x93");  // f013 cog (working)
-                lv_obj_set_style_text_color(status_icon, lv_color_hex(0x00cc00), 0);  // Green
+                icon = "\xEF\x80\x93";  // f013 cog (working)
+                style = &style_carousel_status_running;
             } else if (is_paused) {
-                lv_label_set_text(status_icon, "\xEF\x81\x8C");  // f04c pause
-                lv_obj_set_style_text_color(status_icon, lv_color_hex(0xffaa00), 0);  // Amber
+                icon = "\xEF\x81\x8C";  // f04c pause
+                style = &style_carousel_status_paused;
             } else if (is_error) {
-                lv_label_set_text(status_icon, "\xEF\x81\xB1");  // f071 warning
-                lv_obj_set_style_text_color(status_icon, lv_color_hex(0xff3333), 0);  // Red
+                icon = "\xEF\x81\xB1";  // f071 warning
+                style = &style_carousel_status_error;
             } else if (is_finished) {
-                lv_label_set_text(status_icon, "\xEF\x80\x8C");  // f00c check
-                lv_obj_set_style_text_color(status_icon, lv_color_hex(0x00aaff), 0);  // Blue
-            } else {
-                lv_label_set_text(status_icon, "\xEF\x80\x91");  // f011 power-off (idle)
-                lv_obj_set_style_text_color(status_icon, lv_color_hex(0x888888), 0);  // Gray
+                icon = "\xEF\x80\x8C";  // f00c check
+                style = &style_carousel_status_finished;
+            }
+            
+            lv_label_set_text(status_icon, icon);
+            static lv_style_t *const status_styles[] = {
+                &style_carousel_status_idle, &style_carousel_status_running, &style_carousel_status_paused,
+                &style_carousel_status_error, &style_carousel_status_finished
+            };
+            for (lv_style_t *st : status_styles) {
+                if (st != style) lv_obj_remove_style(status_icon, st, 0);
             }
+            lv_obj_add_style(status_icon, style, 0);
+            label_writes++;
         }
     } else {
         // Weather/default layout child indices (7 children):
         // 0=title, 1=subtitle, 2=value1, 3=value2, 4=value3, 5=value4, 6=icon
-        if (child_count >= 1) {
-            lv_obj_t *title = lv_obj_get_child(panel, 0);
-            lv_label_set_text(title, slide.title.c_str());
-        }
-        if (child_count >= 2) {
-            lv_obj_t *subtitle = lv_obj_get_child(panel, 1);
-            lv_label_set_text(subtitle, slide.subtitle.c_str());
-        }
-        if (child_count >= 3) {
-            lv_obj_t *value1 = lv_obj_get_child(panel, 2);
-            lv_label_set_text(value1, slide.value1.c_str());
-        }
-        if (child_count >= 4) {
-            lv_obj_t *value2 = lv_obj_get_child(panel, 3);
-            lv_label_set_text(value2, slide.value2.c_str());
-        }
-        if (child_count >= 5) {
-            lv_obj_t *value3 = lv_obj_get_child(panel, 4);
-            lv_label_set_text(value3, slide.value3.c_str());
-        }
-        if (child_count >= 6) {
-            lv_obj_t *value4 = lv_obj_get_child(panel, 5);
-            lv_label_set_text(value4, slide.value4.c_str());
-        }
+        carousel_apply_text(panel, 0, slide.title, label_writes, label_skips);
+        carousel_apply_text(panel, 1, slide.subtitle, label_writes, label_skips);
+        carousel_apply_text(panel, 2, slide.value1, label_writes, label_skips);
+        carousel_apply_text(panel, 3, slide.value2, label_writes, label_skips);
+        carousel_apply_text(panel, 4, slide.value3, label_writes, label_skips);
+        carousel_apply_text(panel, 5, slide.value4, label_writes, label_skips);
     }
 }
 
@@ -591,13 +721,9 @@ void CarouselWidget::create_page_indicator()
         lv_obj_t *dot = lv_obj_create(page_indicator);
         lv_obj_set_size(dot, 12, 12);
         lv_obj_set_pos(dot, start_x + i * 20, 14);
-        lv_obj_set_style_radius(dot, 6, 0);  // Make it circular
-        lv_obj_set_style_border_width(dot, 0, 0);
-        
+        lv_obj_add_style(dot, &style_carousel_dot, 0);
         if (i == current_slide) {
-            lv_obj_set_style_bg_color(dot, lv_color_hex(0xffa500), 0);  // Orange
-        } else {
-            lv_obj_set_style_bg_color(dot, lv_color_hex(0x666666), 0);  // Gray
+            lv_obj_add_style(dot, &style_carousel_dot_active, 0);
         }
     }
 }
@@ -629,21 +755,4 @@ void CarouselWidget::scroll_event_cb(lv_event_t *e)
     }
 }
 
-void CarouselWidget::update_theme_colors()
-{
-    // Update container backgrounds when theme changes
-    if (container) {
-        lv_obj_set_style_bg_color(container, carousel_get_container_bg(), 0);
-    }
-    if (scroll_container) {
-        lv_obj_set_style_bg_color(scroll_container, carousel_get_container_bg(), 0);
-    }
-    if (page_indicator) {
-        lv_obj_set_style_bg_color(page_indicator, carousel_get_indicator_bg(), 0);
-    }
-    
-    ESP_LOGI("CarouselWidget", "Theme colors updated: container bg=%s", 
-             (cfg && cfg->CurrentTheme == "light") ? "light" : "dark");
-}
-
 #endif // CAROUSEL_WIDGET_HPP
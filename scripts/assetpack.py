@@ -0,0 +1,182 @@
+#!/usr/bin/env python3
+"""
+Asset partition packer
+
+Builds the image of the read-only "assets" partition. The firmware maps the
+partition into the address space (main/helpers/helper_assets.hpp) and hands
+LVGL pointers straight into flash, so images and fonts stored here are drawn
+without file I/O and without a RAM copy.
+
+Every file below the source directory becomes one entry, named by its path
+relative to that directory ("bg/tux-logo.tlz"):
+
+    .bin .tlz   LVGL image (lv_img_header_t + data, as written by the LVGL
+                image converter or scripts/img2tlz.py)
+    .c          LVGL font from lv_font_conv (--format lvgl --no-compress),
+                stored as a glyph table + bitmaps; kerning is dropped
+    other       raw data, looked up with asset_raw()
+
+Image layout (all integers little-endian, entries 4-byte aligned):
+
+    magic          "TAP1"
+    entry count    u32
+    image size     u32, bytes used in the partition
+    reserved       u32
+    index          entry count * 48 bytes, sorted by name:
+                     char name[32] (NUL padded), u8 type (0 raw, 1 image,
+                     2 font), u8[3] reserved, u32 offset (from the magic),
+                     u32 size, u32 reserved
+    data           entries
+
+Font entries:
+
+    u8 bpp, u8 line height, i8 base line, u8 reserved,
+    u32 glyph count, u32 glyph table offset, u32 bitmap offset (from the entry)
+    glyph table    glyph count * 16 bytes, sorted by code point, same layout
+                   as the language packs (scripts/langpack.py)
+    bitmaps        uncompressed, bpp from the font
+
+Usage:
+    assetpack.py flash_assets -o build/assets.bin [--max-size 0x80000]
+    assetpack.py --list build/assets.bin
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+from langpack import CFont, GLYPH_FMT
+
+MAGIC = b"TAP1"
+HEADER_FMT = "<4sIII"
+ENTRY_FMT = "<32sB3xIII"
+FONT_FMT = "<BBbBIII"
+
+TYPE_RAW = 0
+TYPE_IMAGE = 1
+TYPE_FONT = 2
+TYPE_NAMES = {TYPE_RAW: "raw", TYPE_IMAGE: "image", TYPE_FONT: "font"}
+
+ALIGN = 4
+
+
+def align(n):
+    return (n + ALIGN - 1) & ~(ALIGN - 1)
+
+
+def check_image(path, data):
+    """lv_img_header_t: cf:5, always_zero:3, reserved:2, w:11, h:11"""
+    if len(data) < 4:
+        sys.exit(f"{path}: too short for an LVGL image")
+    hdr = struct.unpack("<I", data[:4])[0]
+    cf = hdr & 0x1F
+    w = (hdr >> 10) & 0x7FF
+    h = (hdr >> 21) & 0x7FF
+    if cf == 0 or w == 0 or h == 0:
+        sys.exit(f"{path}: not an LVGL image (cf={cf}, {w}x{h})")
+    return f"{w}x{h} cf {cf}"
+
+
+def pack_font(path):
+    font = CFont(path)
+    cps = sorted(font.glyphs)
+    table = bytearray()
+    bitmaps = bytearray()
+    for cp in cps:
+        adv_w, box_w, box_h, ofs_x, ofs_y, data = font.glyphs[cp]
+        table += struct.pack(GLYPH_FMT, cp, len(bitmaps), adv_w, box_w, box_h, ofs_x, ofs_y, 0)
+        bitmaps += data
+    glyph_offset = struct.calcsize(FONT_FMT)
+    bitmap_offset = glyph_offset + len(table)
+    head = struct.pack(FONT_FMT, font.bpp, font.line_height, font.base_line, 0,
+                       len(cps), glyph_offset, bitmap_offset)
+    return head + table + bitmaps, f"{len(cps)} glyphs, {font.bpp} bpp"
+
+
+def collect(src):
+    entries = []
+    for root, dirs, files in os.walk(src):
+        dirs[:] = sorted(d for d in dirs if not d.startswith("."))
+        for fn in sorted(files):
+            if fn.startswith("."):
+                continue
+            path = os.path.join(root, fn)
+            name = os.path.relpath(path, src).replace(os.sep, "/")
+            ext = os.path.splitext(fn)[1].lower()
+            if ext == ".c":
+                name = name[:-2]
+                data, info = pack_font(path)
+                kind = TYPE_FONT
+            else:
+                data = open(path, "rb").read()
+                if ext in (".bin", ".tlz"):
+                    kind = TYPE_IMAGE
+                    info = check_image(path, data)
+                else:
+                    kind = TYPE_RAW
+                    info = ""
+            if len(name.encode()) >= 32:
+                sys.exit(f"{name}: asset names must be shorter than 32 bytes")
+            entries.append((name, kind, data, info))
+    entries.sort(key=lambda e: e[0].encode())
+    return entries
+
+
+def build(entries):
+    pos = align(struct.calcsize(HEADER_FMT) + struct.calcsize(ENTRY_FMT) * len(entries))
+    index = bytearray()
+    body = bytearray()
+    for name, kind, data, _ in entries:
+        index += struct.pack(ENTRY_FMT, name.encode(), kind, pos + len(body), len(data), 0)
+        body += data
+        body += b"\0" * (align(len(body)) - len(body))
+    head = struct.pack(HEADER_FMT, MAGIC, len(entries), pos + len(body), 0) + index
+    head += b"\0" * (pos - len(head))
+    return bytes(head + body)
+
+
+def list_image(path):
+    data = open(path, "rb").read()
+    magic, count, size, _ = struct.unpack_from(HEADER_FMT, data)
+    if magic != MAGIC:
+        sys.exit(f"{path}: not an asset image")
+    print(f"{path}: {count} entries, {size} bytes")
+    for i in range(count):
+        name, kind, offset, length, _ = struct.unpack_from(
+            ENTRY_FMT, data, struct.calcsize(HEADER_FMT) + i * struct.calcsize(ENTRY_FMT))
+        name = name.rstrip(b"\0").decode()
+        print(f"  {offset:8d} {length:8d}  {TYPE_NAMES.get(kind, '?'):5s}  {name}")
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Build the asset partition image")
+    ap.add_argument("source", help="asset directory, or the image with --list")
+    ap.add_argument("-o", "--output", help="output image")
+    ap.add_argument("--max-size", type=lambda s: int(s, 0), default=0,
+                    help="partition size; fail if the image does not fit")
+    ap.add_argument("--list", action="store_true", help="print the index of an image")
+    args = ap.parse_args()
+
+    if args.list:
+        list_image(args.source)
+        return
+    if not args.output:
+        ap.error("-o is required")
+
+    entries = collect(args.source)
+    data = build(entries)
+    if args.max_size and len(data) > args.max_size:
+        sys.exit(f"assets need {len(data)} bytes, partition has {args.max_size}")
+
+    os.makedirs(os.path.dirname(os.path.abspath(args.output)), exist_ok=True)
+    with open(args.output, "wb") as f:
+        f.write(data)
+    for name, kind, payload, info in entries:
+        print(f"  {TYPE_NAMES[kind]:5s} {name:32s} {len(payload):8d}  {info}")
+    print(f"{args.output}: {len(entries)} assets, {len(data)} bytes"
+          + (f" of {args.max_size}" if args.max_size else ""))
+
+
+if __name__ == "__main__":
+    main()
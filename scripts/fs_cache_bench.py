@@ -0,0 +1,243 @@
+#!/usr/bin/env python3
+"""
+LVGL file cache benchmark
+
+Replays LVGL file access patterns against the files of a FAT image (or a
+directory) through the block cache in main/helpers/helper_lv_fs_cache.hpp,
+for a range of block sizes and read-ahead settings. The replay is
+host_test/fs_cache_replay.cpp, which builds the cache header itself on the
+host over a stdio lv_fs driver; this script compiles it once per setting
+(the settings are compile-time Kconfig values) and tabulates its output. It
+reports how many read calls and bytes reach the drive, which is what costs
+time on SPIFFS and the SD card, and fails if any read returned wrong data.
+
+Access patterns come from:
+  - a device log captured with TUX_FS_CACHE_TRACE enabled
+    ("FSTRACE open|read|close" lines, e.g. `idf.py monitor | tee boot.log`)
+  - or, without a device, the read sequence of the decoders replayed on the
+    .tlz and .gif files found in the image (--synth): helper_img_tlz.hpp
+    reads header, palette, band table and then one band per seek; LVGL's
+    gifdec reads the LZW stream one byte at a time.
+
+Usage:
+    fs_cache_bench.py --image sdcard.img --trace boot.log
+    fs_cache_bench.py --root fatfs --synth
+    fs_cache_bench.py --root fatfs --synth --block-size 4096 --readahead 2 --pool-kb 128
+    fs_cache_bench.py --root fatfs --synth --replay build_host/fs_cache_replay
+
+FAT images are read with mtools (mcopy); a directory works as is. The
+replay is built with $CXX (default c++); --replay runs an already built one
+(host_test target fs_cache_replay, Kconfig defaults) instead.
+"""
+
+import argparse
+import json
+import os
+import shutil
+import struct
+import subprocess
+import sys
+import tempfile
+
+REPO = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+REPLAY_SRC = os.path.join(REPO, "host_test", "fs_cache_replay.cpp")
+
+
+# Access patterns: ("open", id, name, size) / ("read", id, pos, len) / ("close", id),
+# written as FSTRACE records without the log prefix
+
+class Recorder:
+    """File-like object that logs the reads a decoder makes"""
+
+    def __init__(self, ops, fid, name, data):
+        self.ops, self.fid, self.data, self.pos = ops, fid, data, 0
+        ops.append(("open", fid, name, len(data)))
+
+    def read(self, n):
+        self.ops.append(("read", self.fid, self.pos, n))
+        out = self.data[self.pos:self.pos + n]
+        self.pos += len(out)
+        return out
+
+    def seek(self, pos):
+        self.pos = pos
+
+    def close(self):
+        self.ops.append(("close", self.fid))
+
+
+def synth_tlz(ops, fid, name, data, redraws):
+    # tlz_decoder_info: header; tlz_decoder_open/read_line: per redraw
+    f = Recorder(ops, fid + "i", name, data)
+    f.read(4 + 12)
+    f.close()
+    if data[4:8] != b"TLZ1":
+        return
+    band_rows = data[4 + 6]
+    palette = struct.unpack_from("<H", data, 4 + 8)[0]
+    h = (struct.unpack_from("<I", data, 0)[0] >> 21) & 0x7FF
+    bands = (h + band_rows - 1) // band_rows
+    table = 4 + 12 + palette * 4
+    offsets = struct.unpack_from(f"<{bands + 1}I", data, table)
+    for r in range(redraws):
+        f = Recorder(ops, f"{fid}r{r}", name, data)
+        f.seek(4)
+        f.read(12)
+        if palette:
+            f.seek(4 + 12)
+            f.read(palette * 4)
+        f.seek(table)
+        f.read((bands + 1) * 4)
+        for b in range(bands):
+            f.seek(4 + offsets[b])
+            f.read(offsets[b + 1] - offsets[b])
+        f.close()
+
+
+def synth_gif(ops, fid, name, data, loops):
+    # gifdec: header and palette, then byte-wise LZW reads per frame
+    f = Recorder(ops, fid, name, data)
+    f.read(6)
+    f.read(7)
+    flags = data[10]
+    if flags & 0x80:
+        f.read(3 * (2 << (flags & 7)))
+    start = f.pos
+    for _ in range(loops):
+        f.seek(start)
+        while f.pos < len(data):
+            sep = f.read(1)
+            if not sep or sep == b";":
+                break
+            if sep == b"!":
+                f.read(1)
+                while True:
+                    n = f.read(1)
+                    if not n or n[0] == 0:
+                        break
+                    f.read(n[0])
+            elif sep == b",":
+                desc = f.read(9)
+                if len(desc) < 9:
+                    break
+                if desc[8] & 0x80:
+                    f.read(3 * (2 << (desc[8] & 7)))
+                f.read(1)           # LZW key size
+                while True:
+                    n = f.read(1)
+                    if not n or n[0] == 0:
+                        break
+                    for _ in range(n[0]):
+                        f.read(1)
+            else:
+                break
+    f.close()
+
+
+def synthesize(root, redraws):
+    ops = []
+    for dirpath, _, files in os.walk(root):
+        for fn in sorted(files):
+            path = os.path.join(dirpath, fn)
+            name = "/" + os.path.relpath(path, root).replace(os.sep, "/")
+            data = open(path, "rb").read()
+            if fn.lower().endswith(".tlz"):
+                synth_tlz(ops, name, name, data, redraws)
+            elif fn.lower().endswith(".gif"):
+                synth_gif(ops, name, name, data, redraws)
+    return ops
+
+
+def write_trace(path, ops, logs):
+    with open(path, "w", encoding="utf-8") as out:
+        for log in logs:
+            for line in open(log, encoding="utf-8", errors="replace"):
+                if "FSTRACE " in line:
+                    out.write(line[line.index("FSTRACE "):])
+        for op in ops:
+            out.write(" ".join(str(x) for x in op) + "\n")
+
+
+def build_replay(cxx, out_dir, block_size, blocks, readahead):
+    exe = os.path.join(out_dir, f"fs_cache_replay_{block_size}_{blocks}_{readahead}")
+    subprocess.run([cxx, "-std=c++17", "-O2", "-o", exe, REPLAY_SRC,
+                    "-I", os.path.join(REPO, "host_test", "stubs"),
+                    "-I", os.path.join(REPO, "main", "helpers"),
+                    f"-DCONFIG_TUX_FS_CACHE_BLOCK_SIZE={block_size}",
+                    f"-DCONFIG_TUX_FS_CACHE_BLOCKS={blocks}",
+                    f"-DCONFIG_TUX_FS_CACHE_READAHEAD={readahead}"], check=True)
+    return exe
+
+
+def run_replay(exe, root, trace):
+    proc = subprocess.run([exe, root, trace], stdout=subprocess.PIPE, text=True)
+    lines = [l for l in proc.stdout.splitlines() if l.startswith("{")]
+    if not lines:
+        sys.exit(f"{exe} failed (exit {proc.returncode})")
+    result = json.loads(lines[-1])
+    if proc.returncode != 0 or result["mismatches"]:
+        sys.exit(f"{exe}: {result['mismatches']} reads returned wrong data")
+    return result
+
+
+def extract_image(image, dest):
+    if not shutil.which("mcopy"):
+        sys.exit("mcopy (mtools) is needed to read FAT images; use --root with a directory")
+    subprocess.run(["mcopy", "-s", "-n", "-i", image, "::/", dest], check=True)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Replay LVGL reads through the file cache")
+    src = ap.add_mutually_exclusive_group(required=True)
+    src.add_argument("--image", help="FAT image with the files")
+    src.add_argument("--root", help="directory with the files")
+    ap.add_argument("--trace", action="append", default=[], help="device log with FSTRACE lines")
+    ap.add_argument("--synth", action="store_true", help="replay decoder read patterns of .tlz/.gif files")
+    ap.add_argument("--redraws", type=int, default=3, help="--synth: redraws per image / loops per GIF")
+    ap.add_argument("--pool-kb", type=int, default=128, help="cache size (TUX_FS_CACHE_BLOCKS * block size)")
+    ap.add_argument("--block-size", type=int, action="append", help="block sizes to try")
+    ap.add_argument("--readahead", type=int, action="append", help="read-ahead settings to try")
+    ap.add_argument("--replay", help="prebuilt fs_cache_replay to run instead of building one per setting")
+    ap.add_argument("--cxx", default=os.environ.get("CXX", "c++"), help="compiler for the replay")
+    args = ap.parse_args()
+    if not args.trace and not args.synth:
+        ap.error("give --trace and/or --synth")
+
+    with tempfile.TemporaryDirectory() as tmp:
+        root = args.root
+        if args.image:
+            root = os.path.join(tmp, "fs")
+            os.mkdir(root)
+            extract_image(args.image, root)
+
+        ops = synthesize(root, args.redraws) if args.synth else []
+        trace = os.path.join(tmp, "trace.txt")
+        write_trace(trace, ops, args.trace)
+
+        if args.replay:
+            runs = [run_replay(args.replay, root, trace)]
+        else:
+            runs = []
+            for bs in args.block_size or [512, 1024, 2048, 4096, 8192]:
+                for ra in args.readahead or [0, 1, 2, 4]:
+                    blocks = max(1, args.pool_kb * 1024 // bs)
+                    runs.append(run_replay(build_replay(args.cxx, tmp, bs, blocks, ra), root, trace))
+
+    reads = runs[0]["lv_reads"]
+    if not reads:
+        sys.exit("no reads to replay")
+    print(f"{reads} lv_fs_read calls, {runs[0]['lv_kb']} KB; uncached: {reads} drive reads")
+    print(f"{'block':>6} {'ahead':>5} {'blocks':>6} {'hit %':>6} {'drive reads':>11} {'KB':>7} "
+          f"{'calls saved':>11} {'ahead used':>10}")
+    for r in runs:
+        c = r["fs_cache"]
+        lookups = c["hits"] + c["misses"]
+        print(f"{c['block_size']:6d} {c['readahead_blocks']:5d} {c['blocks']:6d} "
+              f"{100.0 * c['hits'] / max(1, lookups):6.1f} "
+              f"{r['drive']['reads']:11d} {r['drive']['kb']:7d} "
+              f"{100.0 * (1 - r['drive']['reads'] / reads):10.1f}% "
+              f"{c['readahead_used']:4d}/{c['readahead']:<5d}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,322 @@
+#!/usr/bin/env python3
+"""
+LVGL image -> TLZ (banded LZ4) converter
+
+Converts LVGL images (.bin files written by the LVGL image converter, the
+C arrays it generates, or any image Pillow can read) into the compressed
+format decoded on the device by main/helpers/helper_img_tlz.hpp.
+
+The image is cut into bands of N rows and every band is compressed on its
+own as an LZ4 block, so the decoder only ever needs one band in RAM and can
+jump straight to the band that holds a requested line.
+
+File layout (all integers little-endian):
+
+    lv_img_header_t  4 bytes, cf = LV_IMG_CF_USER_ENCODED_0 (24)
+    magic            "TLZ1"
+    pixel format     u8  (0 = RGB565, 1 = 8-bit palette index)
+    filter           u8  (0 = none, 1 = horizontal delta, RGB565 only)
+    band rows        u8
+    flags            u8  (bit 0 = palette has transparent entries)
+    palette count    u16
+    reserved         u16
+    palette          palette count * 4 bytes (B, G, R, A as in LVGL)
+    band offsets     (band count + 1) * u32, relative to the magic
+    bands            LZ4 block format, no frame header
+
+The horizontal delta filter stores each RGB565 pixel as the difference to
+its left neighbour. Smooth gradients turn into long runs of identical small
+values, which LZ4 compresses far better than the raw colours. The converter
+keeps whichever variant is smaller.
+
+Usage:
+    img2tlz.py fatfs/bg/dev_bg9.bin -o fatfs/bg/dev_bg9.tlz
+    img2tlz.py main/images/dev_bg1.bin --c-array dev_bg_tlz -o main/images/dev_bg_tlz.c
+    img2tlz.py wallpaper.png -o wallpaper.tlz          (needs Pillow)
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+CF_TRUE_COLOR = 4
+CF_INDEXED_8BIT = 10
+CF_RGB565 = 18
+CF_USER_ENCODED_0 = 24
+
+FMT_RGB565 = 0
+FMT_INDEXED8 = 1
+
+FILTER_NONE = 0
+FILTER_DELTA = 1
+
+FLAG_ALPHA = 0x01
+
+MAGIC = b"TLZ1"
+HEADER_LEN = 12
+DEFAULT_BAND_ROWS = 16
+
+
+def parse_header(data):
+    (word,) = struct.unpack_from("<I", data, 0)
+    return word & 0x1F, (word >> 10) & 0x7FF, (word >> 21) & 0x7FF
+
+
+def make_header(cf, w, h):
+    return struct.pack("<I", (cf & 0x1F) | ((w & 0x7FF) << 10) | ((h & 0x7FF) << 21))
+
+
+def load_bin(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    cf, w, h = parse_header(data)
+    return cf, w, h, data[4:]
+
+
+def load_c_array(path):
+    """Read the pixel array and header fields of an LVGL generated C file."""
+    with open(path, "r") as f:
+        text = f.read()
+    body = re.search(r"_map\[\]\s*=\s*\{(.*?)\};", text, re.S)
+    if not body:
+        raise ValueError("no image map array found in " + path)
+    # Drop comments so "Color of index 0" does not count as data
+    values = re.sub(r"/\*.*?\*/", "", body.group(1), flags=re.S)
+    data = bytes(int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]{2}", values))
+
+    cf_name = re.search(r"\.header\.cf\s*=\s*LV_IMG_CF_(\w+)", text).group(1)
+    w = int(re.search(r"\.header\.w\s*=\s*(\d+)", text).group(1))
+    h = int(re.search(r"\.header\.h\s*=\s*(\d+)", text).group(1))
+    cf = {"TRUE_COLOR": CF_TRUE_COLOR, "INDEXED_8BIT": CF_INDEXED_8BIT,
+          "RGB565": CF_RGB565}.get(cf_name)
+    if cf is None:
+        raise ValueError("unsupported color format LV_IMG_CF_" + cf_name)
+    return cf, w, h, data
+
+
+def load_pil(path):
+    from PIL import Image  # Optional dependency, only for plain images
+    img = Image.open(path).convert("RGB")
+    w, h = img.size
+    out = bytearray()
+    for r, g, b in img.getdata():
+        out += struct.pack("<H", ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3))
+    return CF_RGB565, w, h, bytes(out)
+
+
+def lz4_compress(src):
+    """Greedy LZ4 block compressor (min match 4, 64 KB window)."""
+    n = len(src)
+    out = bytearray()
+    table = {}
+    anchor = 0
+    i = 0
+    match_limit = n - 5  # LZ4 rule: the last 5 bytes are always literals
+
+    def put_len(v):
+        while v >= 255:
+            out.append(255)
+            v -= 255
+        out.append(v)
+
+    def emit(lit_end, match_len, offset):
+        lit_len = lit_end - anchor
+        token = min(lit_len, 15) << 4
+        if match_len:
+            token |= min(match_len - 4, 15)
+        out.append(token)
+        if lit_len >= 15:
+            put_len(lit_len - 15)
+        out.extend(src[anchor:lit_end])
+        if match_len:
+            out.extend(struct.pack("<H", offset))
+            if match_len - 4 >= 15:
+                put_len(match_len - 4 - 15)
+
+    while i < n - 12:
+        key = src[i:i + 4]
+        cand = table.get(key)
+        table[key] = i
+        if cand is not None and i - cand < 65536:
+            m = 4
+            while i + m < match_limit and src[cand + m] == src[i + m]:
+                m += 1
+            emit(i, m, i - cand)
+            for j in range(i + 1, min(i + m, n - 4)):
+                table[src[j:j + 4]] = j
+            i += m
+            anchor = i
+        else:
+            i += 1
+    emit(n, 0, 0)
+    return bytes(out)
+
+
+def lz4_decompress(src):
+    """Reference decoder, used to verify every band before it is written."""
+    out = bytearray()
+    i = 0
+    while i < len(src):
+        token = src[i]
+        i += 1
+        lit_len = token >> 4
+        if lit_len == 15:
+            while True:
+                b = src[i]
+                i += 1
+                lit_len += b
+                if b != 255:
+                    break
+        out += src[i:i + lit_len]
+        i += lit_len
+        if i >= len(src):
+            break
+        offset = src[i] | (src[i + 1] << 8)
+        i += 2
+        match_len = token & 15
+        if match_len == 15:
+            while True:
+                b = src[i]
+                i += 1
+                match_len += b
+                if b != 255:
+                    break
+        for _ in range(match_len + 4):
+            out.append(out[-offset])
+    return bytes(out)
+
+
+def delta_filter(pixels, w):
+    """Replace each RGB565 pixel with the difference to its left neighbour."""
+    values = struct.unpack("<%dH" % (len(pixels) // 2), pixels)
+    out = []
+    for i, v in enumerate(values):
+        out.append(v if i % w == 0 else (v - values[i - 1]) & 0xFFFF)
+    return struct.pack("<%dH" % len(out), *out)
+
+
+def split_pixels(cf, w, h, data, swapped):
+    """Return (pixel format, palette bytes, pixel bytes)."""
+    if cf == CF_INDEXED_8BIT:
+        palette = data[:256 * 4]
+        pixels = data[256 * 4:256 * 4 + w * h]
+        used = max(pixels) + 1  # Trim unused trailing palette entries
+        return FMT_INDEXED8, palette[:used * 4], pixels
+
+    if cf in (CF_TRUE_COLOR, CF_RGB565):
+        pixels = data[:w * h * 2]
+        if swapped:
+            pixels = bytes(b for i in range(0, len(pixels), 2) for b in (pixels[i + 1], pixels[i]))
+        return FMT_RGB565, b"", pixels
+
+    raise ValueError("unsupported color format %d (need 4, 10 or 18)" % cf)
+
+
+def pack_bands(pixels, w, h, px_size, band_rows):
+    stride = w * px_size
+    bands = []
+    for y in range(0, h, band_rows):
+        raw = pixels[y * stride:min(h, y + band_rows) * stride]
+        block = lz4_compress(raw)
+        if lz4_decompress(block) != raw:
+            raise RuntimeError("LZ4 round trip failed at row %d" % y)
+        bands.append(block)
+    return bands
+
+
+def encode(cf, w, h, data, band_rows=DEFAULT_BAND_ROWS, swapped=False):
+    pix_fmt, palette, pixels = split_pixels(cf, w, h, data, swapped)
+    px_size = 1 if pix_fmt == FMT_INDEXED8 else 2
+
+    pix_filter = FILTER_NONE
+    bands = pack_bands(pixels, w, h, px_size, band_rows)
+    if pix_fmt == FMT_RGB565:
+        delta = pack_bands(delta_filter(pixels, w), w, h, px_size, band_rows)
+        if sum(map(len, delta)) < sum(map(len, bands)):
+            pix_filter, bands = FILTER_DELTA, delta
+
+    offsets = []
+    pos = HEADER_LEN + len(palette) + (len(bands) + 1) * 4
+    for band in bands:
+        offsets.append(pos)
+        pos += len(band)
+    offsets.append(pos)
+
+    flags = FLAG_ALPHA if any(a != 0xFF for a in palette[3::4]) else 0
+
+    payload = bytearray(MAGIC)
+    payload += struct.pack("<BBBBHH", pix_fmt, pix_filter, band_rows, flags, len(palette) // 4, 0)
+    payload += palette
+    payload += struct.pack("<%dI" % len(offsets), *offsets)
+    for band in bands:
+        payload += band
+    return bytes(payload)
+
+
+def write_c_array(path, name, w, h, payload, source):
+    guard = "LV_ATTRIBUTE_IMG_" + name.upper()
+    with open(path, "w") as f:
+        f.write("/* Generated by scripts/img2tlz.py from %s - do not edit */\n\n" % source)
+        f.write('#if defined(LV_LVGL_H_INCLUDE_SIMPLE)\n#include "lvgl.h"\n#else\n'
+                '#include "lvgl/lvgl.h"\n#endif\n\n')
+        f.write("#ifndef LV_ATTRIBUTE_MEM_ALIGN\n#define LV_ATTRIBUTE_MEM_ALIGN\n#endif\n\n")
+        f.write("#ifndef %s\n#define %s\n#endif\n\n" % (guard, guard))
+        f.write("const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST %s uint8_t %s_map[] = {\n"
+                % (guard, name))
+        for i in range(0, len(payload), 24):
+            f.write("  " + ", ".join("0x%02x" % b for b in payload[i:i + 24]) + ",\n")
+        f.write("};\n\n")
+        f.write("const lv_img_dsc_t %s = {\n" % name)
+        f.write("  .header.cf = LV_IMG_CF_USER_ENCODED_0,\n")
+        f.write("  .header.always_zero = 0,\n")
+        f.write("  .header.reserved = 0,\n")
+        f.write("  .header.w = %d,\n" % w)
+        f.write("  .header.h = %d,\n" % h)
+        f.write("  .data_size = %d,\n" % len(payload))
+        f.write("  .data = %s_map,\n" % name)
+        f.write("};\n")
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Convert LVGL images to the TLZ compressed format")
+    ap.add_argument("input", help="LVGL .bin, LVGL C array (.c) or any image Pillow can read")
+    ap.add_argument("-o", "--output", help="Output file (default: input with .tlz extension)")
+    ap.add_argument("--c-array", metavar="NAME", help="Write a C source with an lv_img_dsc_t named NAME")
+    ap.add_argument("--band-rows", type=int, default=DEFAULT_BAND_ROWS,
+                    help="Rows per compressed band (default %d)" % DEFAULT_BAND_ROWS)
+    ap.add_argument("--swapped", action="store_true",
+                    help="Input RGB565 data is byte swapped (LV_COLOR_16_SWAP)")
+    args = ap.parse_args()
+
+    if not 1 <= args.band_rows <= 255:
+        ap.error("--band-rows must be 1..255")
+
+    ext = os.path.splitext(args.input)[1].lower()
+    if ext == ".bin":
+        cf, w, h, data = load_bin(args.input)
+    elif ext == ".c":
+        cf, w, h, data = load_c_array(args.input)
+    else:
+        cf, w, h, data = load_pil(args.input)
+
+    payload = encode(cf, w, h, data, args.band_rows, args.swapped)
+
+    out = args.output or os.path.splitext(args.input)[0] + (".c" if args.c_array else ".tlz")
+    if args.c_array:
+        write_c_array(out, args.c_array, w, h, payload, os.path.basename(args.input))
+    else:
+        with open(out, "wb") as f:
+            f.write(make_header(CF_USER_ENCODED_0, w, h))
+            f.write(payload)
+
+    src_size = len(data) + 4
+    dst_size = len(payload) + 4
+    print("%s: %dx%d cf=%d, %d -> %d bytes (%.1f%%)"
+          % (out, w, h, cf, src_size, dst_size, 100.0 * dst_size / src_size))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,237 @@
+#!/usr/bin/env python3
+"""
+Language pack builder
+
+Builds the .lpk files loaded by main/i18n/lang_pack.hpp from the storage
+partition (fatfs/lang/). English is compiled into the firmware; every other
+language is a pack, so adding one only adds a file to the storage image.
+
+A pack holds the translated string table and, per UI font size, the glyphs
+the built-in fonts do not carry (e.g. Cyrillic). The glyphs are taken from
+C fonts written by lv_font_conv (--format lvgl --no-compress); a TTF/OTF/WOFF
+can be given instead when lv_font_conv is installed.
+
+Pack source (main/i18n/packs/<code>.json):
+
+    {
+        "code": "RU",                       2-4 letters, matches settings.json
+        "name": "Русский",                  native name
+        "glyphs": "0x401,0x410-0x44F",      optional extra ranges (weather
+                                            descriptions come from the API)
+        "strings": { "STR_IDLE": "...", ... }   keys from string_id_t
+    }
+
+Every character used by the strings that the firmware fonts do not cover is
+added to the glyph set automatically.
+
+File layout (all integers little-endian):
+
+    magic          "TLP1"
+    code           char[4], NUL padded
+    name           char[32], UTF-8, NUL padded
+    string count   u16
+    font count     u8
+    reserved       u8
+    strings offset u32
+    strings size   u32
+    fonts          font count * 16 bytes:
+                     u8 size, u8 bpp, u8 line height, i8 base line,
+                     u32 glyph count, u32 glyph table offset, u32 bitmap offset
+    glyph tables   glyph count * 16 bytes per font, sorted by code point:
+                     u32 code point, u32 bitmap offset (from the font's bitmaps),
+                     u16 advance (1/16 px), u8 box w, u8 box h, i8 ofs x, i8 ofs y,
+                     u16 reserved
+    strings        u32 offsets[string count] from the strings offset (0 = not
+                   translated, English is used), then NUL-terminated UTF-8
+    bitmaps        raw lv_font_conv bitmaps (uncompressed, bpp from the font)
+
+Usage:
+    langpack.py main/i18n/packs/ru.json -o fatfs/lang/ru.lpk \\
+        --font 14=Montserrat-Medium.ttf --font 16=... --font 24=... --font 32=...
+    langpack.py main/i18n/packs/de.json -o fatfs/lang/de.lpk
+"""
+
+import argparse
+import json
+import os
+import re
+import struct
+import subprocess
+import sys
+import tempfile
+
+MAGIC = b"TLP1"
+HEADER_FMT = "<4s4s32sHBBII"
+FONT_FMT = "<BBBbIII"
+GLYPH_FMT = "<IIHBBbbH"
+
+LANG_HPP = os.path.join(os.path.dirname(__file__), "..", "main", "i18n", "lang.hpp")
+
+# Code points in the firmware fonts (main/fonts/font_montserrat_int_*.c)
+BUILTIN_RANGES = "0x20-0x7F,0xB0,0xD3,0xF3,0x100-0x17F,0x2022"
+
+
+def parse_ranges(spec):
+    cps = set()
+    for part in filter(None, (p.strip() for p in spec.split(","))):
+        lo, _, hi = part.partition("-")
+        lo = int(lo, 0)
+        hi = int(hi, 0) if hi else lo
+        cps.update(range(lo, hi + 1))
+    return cps
+
+
+def string_ids(path):
+    """string_id_t names in declaration order"""
+    src = open(path, encoding="utf-8").read()
+    start = src.index("typedef enum {", src.index("// String IDs"))
+    body = src[start:src.index("} string_id_t;", start)]
+    names = re.findall(r"^\s*(STR_\w+)\s*[,=]", body, re.M)
+    return [n for n in names if n != "STR_COUNT"]
+
+
+class CFont:
+    """Glyphs of an lv_font_conv C file (--format lvgl --no-compress)"""
+
+    def __init__(self, path):
+        src = open(path, encoding="utf-8").read()
+        if "--no-compress" not in src.split("*/", 1)[0]:
+            sys.exit(f"{path}: compressed fonts are not supported, use --no-compress")
+
+        bitmap = src[src.index("glyph_bitmap[] = {"):]
+        bitmap = bitmap[:bitmap.index("};")]
+        parts = re.split(r'/\* U\+([0-9A-F]+) ".*?" \*/', bitmap)[1:]
+        blocks = [(int(parts[i], 16), bytes(int(b, 16) for b in re.findall(r"0x([0-9a-f]+)", parts[i + 1])))
+                  for i in range(0, len(parts), 2)]
+
+        dsc = re.findall(r"\{\.bitmap_index = (\d+), \.adv_w = (\d+), \.box_w = (\d+), \.box_h = (\d+), "
+                         r"\.ofs_x = (-?\d+), \.ofs_y = (-?\d+)\}", src)
+        dsc = [tuple(map(int, d)) for d in dsc[1:]]     # id 0 is reserved
+        if len(dsc) != len(blocks):
+            sys.exit(f"{path}: {len(blocks)} bitmaps but {len(dsc)} glyph descriptors")
+
+        def field(name):
+            return int(re.search(r"\." + name + r" = (-?\d+)", src).group(1))
+
+        self.bpp = field("bpp")
+        self.line_height = field("line_height")
+        self.base_line = field("base_line")
+        self.glyphs = {}
+        for (cp, data), (_, adv_w, box_w, box_h, ofs_x, ofs_y) in zip(blocks, dsc):
+            if len(data) != (box_w * box_h * self.bpp + 7) // 8:
+                sys.exit(f"{path}: U+{cp:04X} bitmap has {len(data)} bytes")
+            self.glyphs[cp] = (adv_w, box_w, box_h, ofs_x, ofs_y, data)
+
+
+def load_font(size, path, cps):
+    if path.endswith(".c"):
+        return CFont(path)
+    # Outline font: render just the needed code points with lv_font_conv
+    ranges = ",".join(f"0x{cp:X}" for cp in sorted(cps))
+    with tempfile.TemporaryDirectory() as tmp:
+        out = os.path.join(tmp, "font.c")
+        subprocess.run(["lv_font_conv", "--no-compress", "--bpp", "4", "--size", str(size),
+                        "--font", path, "--range", ranges, "--format", "lvgl", "-o", out], check=True)
+        return CFont(out)
+
+
+def build(pack, ids, fonts):
+    strings = pack.get("strings", {})
+    unknown = sorted(set(strings) - set(ids))
+    if unknown:
+        sys.exit(f"unknown string ids: {', '.join(unknown)}")
+
+    builtin = parse_ranges(BUILTIN_RANGES)
+    wanted = parse_ranges(pack.get("glyphs", ""))
+    wanted |= {ord(c) for s in strings.values() for c in s}
+    wanted -= builtin
+
+    # Strings
+    blob = bytearray()
+    offsets = []
+    table_len = 4 * len(ids)
+    for name in ids:
+        text = strings.get(name)
+        if not text:
+            offsets.append(0)
+            continue
+        offsets.append(table_len + len(blob))
+        blob += text.encode("utf-8") + b"\0"
+    str_data = struct.pack(f"<{len(ids)}I", *offsets) + bytes(blob)
+
+    # Glyphs per font size
+    font_entries = []
+    for size, path in sorted(fonts.items()):
+        font = load_font(size, path, wanted)
+        cps = sorted(cp for cp in wanted if cp in font.glyphs)
+        missing = sorted(wanted - set(cps))
+        if missing:
+            print(f"warning: {size}px source lacks " + " ".join(f"U+{cp:04X}" for cp in missing[:16]) +
+                  (" ..." if len(missing) > 16 else ""), file=sys.stderr)
+        if cps:
+            font_entries.append((size, font, cps))
+
+    out = bytearray()
+    pos = struct.calcsize(HEADER_FMT) + struct.calcsize(FONT_FMT) * len(font_entries)
+    tables, bitmaps, dir_entries = [], [], []
+    glyph_pos = pos
+    for _, _, cps in font_entries:
+        glyph_pos += struct.calcsize(GLYPH_FMT) * len(cps)
+    str_offset = glyph_pos
+    bmp_pos = str_offset + len(str_data)
+    for size, font, cps in font_entries:
+        table = bytearray()
+        bmp = bytearray()
+        for cp in cps:
+            adv_w, box_w, box_h, ofs_x, ofs_y, data = font.glyphs[cp]
+            table += struct.pack(GLYPH_FMT, cp, len(bmp), adv_w, box_w, box_h, ofs_x, ofs_y, 0)
+            bmp += data
+        dir_entries.append(struct.pack(FONT_FMT, size, font.bpp, font.line_height, font.base_line,
+                                       len(cps), pos, bmp_pos))
+        tables.append(table)
+        bitmaps.append(bmp)
+        pos += len(table)
+        bmp_pos += len(bmp)
+
+    name = pack["name"].encode("utf-8")
+    if len(name) >= 32 or not 2 <= len(pack["code"]) <= 4:
+        sys.exit("name must be < 32 bytes and code 2-4 letters")
+    out += struct.pack(HEADER_FMT, MAGIC, pack["code"].upper().encode(), name, len(ids),
+                       len(font_entries), 0, str_offset, len(str_data))
+    for entry in dir_entries:
+        out += entry
+    for table in tables:
+        out += table
+    out += str_data
+    for bmp in bitmaps:
+        out += bmp
+
+    glyphs = sum(len(cps) for _, _, cps in font_entries)
+    return bytes(out), len([o for o in offsets if o]), glyphs, len(font_entries)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Build a language pack (.lpk)")
+    ap.add_argument("source", help="pack source (.json)")
+    ap.add_argument("-o", "--output", required=True, help="output .lpk")
+    ap.add_argument("--font", action="append", default=[], metavar="SIZE=PATH",
+                    help="glyph source for a UI font size (.c from lv_font_conv, or .ttf/.otf/.woff)")
+    ap.add_argument("--lang-hpp", default=LANG_HPP, help="lang.hpp with the string_id_t enum")
+    args = ap.parse_args()
+
+    fonts = {}
+    for spec in args.font:
+        size, _, path = spec.partition("=")
+        fonts[int(size)] = path
+
+    pack = json.load(open(args.source, encoding="utf-8"))
+    data, translated, glyphs, sizes = build(pack, string_ids(args.lang_hpp), fonts)
+    os.makedirs(os.path.dirname(os.path.abspath(args.output)), exist_ok=True)
+    with open(args.output, "wb") as f:
+        f.write(data)
+    print(f"{args.output}: {pack['code']} {translated} strings, {glyphs} glyphs "
+          f"in {sizes} sizes, {len(data)} bytes")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+"""
+Web UI packer
+
+Turns the web UI page (components/WebServer/www/index.html) into a C source
+with the page minified and gzipped, plus a strong ETag derived from the
+compressed bytes. The web server sends the blob as is with
+"Content-Encoding: gzip" and answers a matching If-None-Match with 304.
+
+Minification is line based and conservative, so inline scripts keep working:
+
+    - leading and trailing whitespace is stripped, blank lines are dropped
+      (line breaks are kept, JS relies on them for semicolon insertion)
+    - lines that are only an HTML, CSS or JS comment are dropped
+
+Output (C, linked into the WebServer component):
+
+    const uint8_t web_ui_gz[];      gzip data (mtime 0, so builds are
+                                    reproducible and the ETag only changes
+                                    with the page)
+    const size_t web_ui_gz_len;
+    const char web_ui_etag[];       "\"<first 16 hex of sha256>\""
+
+Usage:
+    webui_pack.py components/WebServer/www/index.html -o build/web_ui.c
+    webui_pack.py --stats components/WebServer/www/index.html
+"""
+
+import argparse
+import gzip
+import hashlib
+import re
+import sys
+
+COMMENT_LINE = re.compile(r"^(<!--.*-->|//.*|/\*.*\*/)$")
+
+
+def minify(html):
+    out = []
+    for line in html.splitlines():
+        line = line.strip()
+        if not line or COMMENT_LINE.match(line):
+            continue
+        out.append(line)
+    return "\n".join(out) + "\n"
+
+
+def pack(html):
+    data = minify(html).encode("utf-8")
+    gz = gzip.compress(data, compresslevel=9, mtime=0)
+    etag = '"' + hashlib.sha256(gz).hexdigest()[:16] + '"'
+    return data, gz, etag
+
+
+def c_source(src_name, gz, etag):
+    lines = [
+        f"/* Generated by scripts/webui_pack.py from {src_name}, do not edit */",
+        "",
+        "#include <stddef.h>",
+        "#include <stdint.h>",
+        "",
+        f"const size_t web_ui_gz_len = {len(gz)};",
+        "const char web_ui_etag[] = \"" + etag.replace('"', '\\"') + "\";",
+        "const uint8_t web_ui_gz[] = {",
+    ]
+    for i in range(0, len(gz), 16):
+        lines.append("    " + ", ".join(f"0x{b:02x}" for b in gz[i:i + 16]) + ",")
+    lines.append("};")
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Minify and gzip the web UI into a C source")
+    parser.add_argument("html", help="web UI page")
+    parser.add_argument("-o", "--output", help="C source to write")
+    parser.add_argument("--stats", action="store_true", help="print sizes and the ETag only")
+    args = parser.parse_args()
+
+    with open(args.html, encoding="utf-8") as f:
+        html = f.read()
+    data, gz, etag = pack(html)
+
+    print(f"web UI: {len(html.encode('utf-8'))} bytes, minified {len(data)}, "
+          f"gzipped {len(gz)}, ETag {etag}")
+    if args.stats:
+        return
+    if not args.output:
+        sys.exit("no output given (-o)")
+    with open(args.output, "w") as f:
+        f.write(c_source(args.html.split("/")[-1], gz, etag))
+
+
+if __name__ == "__main__":
+    main()